@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/handle.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <vector>
+
+namespace cugraph {
+namespace bench {
+
+// wall clock time after every GPU (every rank in multi-GPU) finished the work queued so far
+template <bool multi_gpu>
+double synchronized_seconds(raft::handle_t const& handle)
+{
+  handle.sync_stream();
+  if constexpr (multi_gpu) { handle.get_comms().barrier(); }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// only rank 0 reports in multi-GPU; every rank still runs every benchmark as the benchmarked
+// functions are collective
+class null_reporter_t : public benchmark::BenchmarkReporter {
+ public:
+  bool ReportContext(Context const&) override { return true; }
+  void ReportRuns(std::vector<Run> const&) override {}
+};
+
+}  // namespace bench
+}  // namespace cugraph
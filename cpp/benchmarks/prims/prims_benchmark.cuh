@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "common/benchmark_utilities.hpp"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_e.cuh"
+#include "prims/transform_reduce_e_by_src_dst_key.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace bench {
+
+// graph shapes to benchmark the primitives with (R-mat graphs with a skewed degree distribution and
+// with a uniform degree distribution)
+enum class graph_shape_t { rmat_skewed, rmat_uniform };
+
+inline std::string to_string(graph_shape_t shape)
+{
+  return shape == graph_shape_t::rmat_skewed ? "rmat_skewed" : "rmat_uniform";
+}
+
+struct prims_benchmark_options_t {
+  size_t scale{20};
+  size_t edge_factor{16};
+  size_t num_iterations{10};  // fixed so every GPU runs the same number of iterations in multi-GPU
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct benchmark_graph_t {
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu> graph;
+  rmm::device_uvector<vertex_t> renumber_map;
+};
+
+// graphs are constructed once and shared by every primitive benchmarked on the same graph
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::map<graph_shape_t, std::unique_ptr<benchmark_graph_t<vertex_t, edge_t, multi_gpu>>>&
+benchmark_graph_cache()
+{
+  static std::map<graph_shape_t, std::unique_ptr<benchmark_graph_t<vertex_t, edge_t, multi_gpu>>>
+    graphs{};
+  return graphs;
+}
+
+// call before the handle and the memory resource the graphs were allocated with are destroyed
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void clear_benchmark_graphs()
+{
+  benchmark_graph_cache<vertex_t, edge_t, multi_gpu>().clear();
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+benchmark_graph_t<vertex_t, edge_t, multi_gpu>& get_benchmark_graph(
+  raft::handle_t const& handle, graph_shape_t shape, prims_benchmark_options_t const& options)
+{
+  auto& graphs = benchmark_graph_cache<vertex_t, edge_t, multi_gpu>();
+
+  auto it = graphs.find(shape);
+  if (it == graphs.end()) {
+    auto skewed = (shape == graph_shape_t::rmat_skewed);
+    cugraph::test::Rmat_Usecase usecase(options.scale,
+                                        options.edge_factor,
+                                        skewed ? 0.57 : 0.25,
+                                        skewed ? 0.19 : 0.25,
+                                        skewed ? 0.19 : 0.25,
+                                        uint64_t{0},
+                                        true /* undirected */,
+                                        true /* scramble_vertex_ids */);
+    cugraph::graph_t<vertex_t, edge_t, false, multi_gpu> graph(handle);
+    std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+    std::tie(graph, std::ignore, renumber_map) =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, multi_gpu>(
+        handle, usecase, false, true);
+    it = graphs
+           .emplace(shape,
+                    std::make_unique<benchmark_graph_t<vertex_t, edge_t, multi_gpu>>(
+                      benchmark_graph_t<vertex_t, edge_t, multi_gpu>{std::move(graph),
+                                                                     std::move(*renumber_map)}))
+           .first;
+  }
+  return *(it->second);
+}
+
+template <typename vertex_t, typename result_t>
+struct e_op_t {
+  __device__ result_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 result_t src_property,
+                                 result_t dst_property,
+                                 cuda::std::nullopt_t) const
+  {
+    return src_property < dst_property ? src_property : dst_property;
+  }
+};
+
+// Runs prim (after one untimed warm-up call) options.num_iterations times and reports the
+// (aggregate) edges processed per second and the bytes communicated per iteration (recorded by the
+// prim_profiler_t instrumentation in a separate, untimed call as profiling adds synchronizations).
+template <typename vertex_t, typename edge_t, bool multi_gpu, typename PrimFunc>
+void run_prim_benchmark(benchmark::State& state,
+                        raft::handle_t const& handle,
+                        graph_shape_t shape,
+                        prims_benchmark_options_t const& options,
+                        PrimFunc prim)
+{
+  auto& bench_graph = get_benchmark_graph<vertex_t, edge_t, multi_gpu>(handle, shape, options);
+  auto graph_view   = bench_graph.graph.view();
+  auto num_edges    = graph_view.compute_number_of_edges(handle);
+
+  auto state_of_prim = prim.setup(handle, graph_view, bench_graph.renumber_map);
+  prim.run(handle, graph_view, state_of_prim);  // warm-up
+
+  for (auto _ : state) {
+    auto start = synchronized_seconds<multi_gpu>(handle);
+    prim.run(handle, graph_view, state_of_prim);
+    state.SetIterationTime(synchronized_seconds<multi_gpu>(handle) - start);
+  }
+
+  auto& profiler = cugraph::prim_profiler_t::instance();
+  profiler.clear();
+  profiler.enable(true);
+  prim.run(handle, graph_view, state_of_prim);
+  profiler.enable(false);
+  size_t bytes_communicated{0};
+  for (auto const& record : profiler.report()) {
+    bytes_communicated += record.bytes_communicated;
+  }
+  profiler.clear();
+  if constexpr (multi_gpu) {
+    bytes_communicated = cugraph::host_scalar_allreduce(
+      handle.get_comms(), bytes_communicated, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  state.counters["edges_per_second"] = benchmark::Counter(
+    static_cast<double>(num_edges), benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["bytes_communicated"] = static_cast<double>(bytes_communicated);
+  state.counters["num_vertices"]       = static_cast<double>(graph_view.number_of_vertices());
+  state.counters["num_edges"]          = static_cast<double>(num_edges);
+  state.counters["num_gpus"] =
+    static_cast<double>(multi_gpu ? handle.get_comms().get_size() : 1);
+}
+
+// per_v_transform_reduce_outgoing_e (incoming_e if incoming is true) with a plus reduction
+template <bool incoming>
+struct per_v_transform_reduce_e_prim_t {
+  static constexpr char const* name =
+    incoming ? "per_v_transform_reduce_incoming_e" : "per_v_transform_reduce_outgoing_e";
+
+  template <typename GraphViewType>
+  auto setup(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             rmm::device_uvector<typename GraphViewType::vertex_type> const& renumber_map) const
+  {
+    auto vertex_prop = cugraph::test::generate<GraphViewType, int32_t>::vertex_property(
+      handle, renumber_map, 5 /* hash_bin_count */);
+    auto src_prop    = cugraph::test::generate<GraphViewType, int32_t>::src_property(
+      handle, graph_view, vertex_prop);
+    auto dst_prop    = cugraph::test::generate<GraphViewType, int32_t>::dst_property(
+      handle, graph_view, vertex_prop);
+    rmm::device_uvector<int32_t> results(graph_view.local_vertex_partition_range_size(),
+                                         handle.get_stream());
+    return std::make_tuple(std::move(src_prop), std::move(dst_prop), std::move(results));
+  }
+
+  template <typename GraphViewType, typename StateType>
+  void run(raft::handle_t const& handle, GraphViewType const& graph_view, StateType& state) const
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    if constexpr (incoming) {
+      per_v_transform_reduce_incoming_e(handle,
+                                        graph_view,
+                                        std::get<0>(state).view(),
+                                        std::get<1>(state).view(),
+                                        cugraph::edge_dummy_property_t{}.view(),
+                                        e_op_t<vertex_t, int32_t>{},
+                                        int32_t{0},
+                                        cugraph::reduce_op::plus<int32_t>{},
+                                        std::get<2>(state).begin());
+    } else {
+      per_v_transform_reduce_outgoing_e(handle,
+                                        graph_view,
+                                        std::get<0>(state).view(),
+                                        std::get<1>(state).view(),
+                                        cugraph::edge_dummy_property_t{}.view(),
+                                        e_op_t<vertex_t, int32_t>{},
+                                        int32_t{0},
+                                        cugraph::reduce_op::plus<int32_t>{},
+                                        std::get<2>(state).begin());
+    }
+  }
+};
+
+struct transform_reduce_e_prim_t {
+  static constexpr char const* name = "transform_reduce_e";
+
+  template <typename GraphViewType>
+  auto setup(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             rmm::device_uvector<typename GraphViewType::vertex_type> const& renumber_map) const
+  {
+    auto vertex_prop = cugraph::test::generate<GraphViewType, int32_t>::vertex_property(
+      handle, renumber_map, 5 /* hash_bin_count */);
+    auto src_prop    = cugraph::test::generate<GraphViewType, int32_t>::src_property(
+      handle, graph_view, vertex_prop);
+    auto dst_prop    = cugraph::test::generate<GraphViewType, int32_t>::dst_property(
+      handle, graph_view, vertex_prop);
+    return std::make_tuple(std::move(src_prop), std::move(dst_prop));
+  }
+
+  template <typename GraphViewType, typename StateType>
+  void run(raft::handle_t const& handle, GraphViewType const& graph_view, StateType& state) const
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    benchmark::DoNotOptimize(transform_reduce_e(handle,
+                                                graph_view,
+                                                std::get<0>(state).view(),
+                                                std::get<1>(state).view(),
+                                                cugraph::edge_dummy_property_t{}.view(),
+                                                e_op_t<vertex_t, int32_t>{},
+                                                int32_t{0}));
+  }
+};
+
+struct transform_reduce_e_by_src_key_prim_t {
+  static constexpr char const* name = "transform_reduce_e_by_src_key";
+
+  template <typename GraphViewType>
+  auto setup(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             rmm::device_uvector<typename GraphViewType::vertex_type> const& renumber_map) const
+  {
+    using vertex_t   = typename GraphViewType::vertex_type;
+    auto vertex_prop = cugraph::test::generate<GraphViewType, int32_t>::vertex_property(
+      handle, renumber_map, 5 /* hash_bin_count */);
+    auto src_prop    = cugraph::test::generate<GraphViewType, int32_t>::src_property(
+      handle, graph_view, vertex_prop);
+    auto dst_prop    = cugraph::test::generate<GraphViewType, int32_t>::dst_property(
+      handle, graph_view, vertex_prop);
+    auto vertex_key = cugraph::test::generate<GraphViewType, vertex_t>::vertex_property(
+      handle, renumber_map, 5 /* hash_bin_count */);
+    auto src_key    = cugraph::test::generate<GraphViewType, vertex_t>::src_property(
+      handle, graph_view, vertex_key);
+    return std::make_tuple(std::move(src_prop), std::move(dst_prop), std::move(src_key));
+  }
+
+  template <typename GraphViewType, typename StateType>
+  void run(raft::handle_t const& handle, GraphViewType const& graph_view, StateType& state) const
+  {
+    using vertex_t      = typename GraphViewType::vertex_type;
+    auto [keys, values] = transform_reduce_e_by_src_key(handle,
+                                                        graph_view,
+                                                        std::get<0>(state).view(),
+                                                        std::get<1>(state).view(),
+                                                        cugraph::edge_dummy_property_t{}.view(),
+                                                        std::get<2>(state).view(),
+                                                        e_op_t<vertex_t, int32_t>{},
+                                                        int32_t{0},
+                                                        cugraph::reduce_op::plus<int32_t>{});
+    benchmark::DoNotOptimize(keys.data());
+  }
+};
+
+struct update_edge_src_property_prim_t {
+  static constexpr char const* name = "update_edge_src_property";
+
+  template <typename GraphViewType>
+  auto setup(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             rmm::device_uvector<typename GraphViewType::vertex_type> const& renumber_map) const
+  {
+    auto vertex_prop = cugraph::test::generate<GraphViewType, int32_t>::vertex_property(
+      handle, renumber_map, 5 /* hash_bin_count */);
+    cugraph::edge_src_property_t<GraphViewType, int32_t> src_prop(handle, graph_view);
+    return std::make_tuple(std::move(vertex_prop), std::move(src_prop));
+  }
+
+  template <typename GraphViewType, typename StateType>
+  void run(raft::handle_t const& handle, GraphViewType const& graph_view, StateType& state) const
+  {
+    update_edge_src_property(handle,
+                             graph_view,
+                             std::get<0>(state).begin(),
+                             std::get<1>(state).mutable_view());
+  }
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu, typename PrimType>
+void register_prim_benchmark(raft::handle_t const& handle,
+                             graph_shape_t shape,
+                             prims_benchmark_options_t const& options)
+{
+  auto name = std::string(PrimType::name) + "/" + to_string(shape) + "/v" +
+              std::to_string(sizeof(vertex_t) * 8) + "_e" + std::to_string(sizeof(edge_t) * 8) +
+              "/scale" + std::to_string(options.scale);
+  benchmark::RegisterBenchmark(name.c_str(),
+                               [&handle, shape, options](benchmark::State& state) {
+                                 run_prim_benchmark<vertex_t, edge_t, multi_gpu>(
+                                   state, handle, shape, options, PrimType{});
+                               })
+    ->UseManualTime()
+    ->Iterations(options.num_iterations)
+    ->Unit(benchmark::kMillisecond);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void register_prims_benchmarks(raft::handle_t const& handle,
+                               prims_benchmark_options_t const& options)
+{
+  for (auto shape : {graph_shape_t::rmat_skewed, graph_shape_t::rmat_uniform}) {
+    register_prim_benchmark<vertex_t, edge_t, multi_gpu, per_v_transform_reduce_e_prim_t<false>>(
+      handle, shape, options);
+    register_prim_benchmark<vertex_t, edge_t, multi_gpu, per_v_transform_reduce_e_prim_t<true>>(
+      handle, shape, options);
+    register_prim_benchmark<vertex_t, edge_t, multi_gpu, transform_reduce_e_prim_t>(
+      handle, shape, options);
+    register_prim_benchmark<vertex_t, edge_t, multi_gpu, transform_reduce_e_by_src_key_prim_t>(
+      handle, shape, options);
+    register_prim_benchmark<vertex_t, edge_t, multi_gpu, update_edge_src_property_prim_t>(
+      handle, shape, options);
+  }
+}
+
+// parses (and removes) the --prims_benchmark_{scale|edge_factor|iterations}=N arguments left after
+// benchmark::Initialize()
+inline prims_benchmark_options_t parse_prims_benchmark_options(int& argc, char** argv)
+{
+  prims_benchmark_options_t options{};
+  int num_remaining_args{1};
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    auto parse = [&arg](std::string const& prefix, size_t& value) {
+      if (arg.rfind(prefix, 0) == 0) {
+        value = std::stoull(arg.substr(prefix.size()));
+        return true;
+      }
+      return false;
+    };
+    if (!parse("--prims_benchmark_scale=", options.scale) &&
+        !parse("--prims_benchmark_edge_factor=", options.edge_factor) &&
+        !parse("--prims_benchmark_iterations=", options.num_iterations)) {
+      argv[num_remaining_args++] = argv[i];
+    }
+  }
+  argc = num_remaining_args;
+  return options;
+}
+
+}  // namespace bench
+}  // namespace cugraph
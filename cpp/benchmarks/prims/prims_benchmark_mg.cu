@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prims/prims_benchmark.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/mg_utilities.hpp"
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+// Usage: mpirun -np <num_gpus> PRIMS_BENCH_MG [same options as PRIMS_BENCH]
+int main(int argc, char** argv)
+{
+  cugraph::test::initialize_mpi(argc, argv);
+  auto comm_rank = cugraph::test::query_mpi_comm_world_rank();
+  int num_gpus_per_node{};
+  RAFT_CUDA_TRY(cudaGetDeviceCount(&num_gpus_per_node));
+  RAFT_CUDA_TRY(cudaSetDevice(comm_rank % num_gpus_per_node));
+
+  if (comm_rank != 0) {  // only rank 0 writes the (e.g. JSON) output file
+    int num_remaining_args{1};
+    for (int i = 1; i < argc; ++i) {
+      if (std::string(argv[i]).rfind("--benchmark_out", 0) != 0) {
+        argv[num_remaining_args++] = argv[i];
+      }
+    }
+    argc = num_remaining_args;
+  }
+  benchmark::Initialize(&argc, argv);
+  auto options = cugraph::bench::parse_prims_benchmark_options(argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    cugraph::test::finalize_mpi();
+    return 1;
+  }
+
+  auto resource = cugraph::test::create_memory_resource("pool");
+  rmm::mr::set_current_device_resource(resource.get());
+
+  {
+    auto handle = cugraph::test::initialize_mg_handle();
+    cugraph::test::enforce_p2p_initialization(handle->get_comms(), handle->get_stream());
+
+    cugraph::bench::register_prims_benchmarks<int32_t, int32_t, true>(*handle, options);
+    cugraph::bench::register_prims_benchmarks<int64_t, int64_t, true>(*handle, options);
+
+    if (comm_rank == 0) {
+      benchmark::RunSpecifiedBenchmarks();
+    } else {
+      cugraph::bench::null_reporter_t display_reporter{};
+      benchmark::RunSpecifiedBenchmarks(&display_reporter);
+    }
+    benchmark::Shutdown();
+
+    cugraph::bench::clear_benchmark_graphs<int32_t, int32_t, true>();
+    cugraph::bench::clear_benchmark_graphs<int64_t, int64_t, true>();
+  }
+
+  cugraph::test::finalize_mpi();
+  return 0;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prims/prims_benchmark.cuh"
+#include "utilities/base_fixture.hpp"
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <benchmark/benchmark.h>
+
+// Usage: PRIMS_BENCH [--prims_benchmark_scale=N] [--prims_benchmark_edge_factor=N]
+//                    [--prims_benchmark_iterations=N] [Google Benchmark flags, e.g.
+//                    --benchmark_filter=<regex> --benchmark_out=<file>
+//                    --benchmark_out_format=json]
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  auto options = cugraph::bench::parse_prims_benchmark_options(argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+
+  auto resource = cugraph::test::create_memory_resource("pool");
+  rmm::mr::set_current_device_resource(resource.get());
+
+  raft::handle_t handle{};
+  cugraph::bench::register_prims_benchmarks<int32_t, int32_t, false>(handle, options);
+  cugraph::bench::register_prims_benchmarks<int64_t, int64_t, false>(handle, options);
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  cugraph::bench::clear_benchmark_graphs<int32_t, int32_t, false>();
+  cugraph::bench::clear_benchmark_graphs<int64_t, int64_t, false>();
+  return 0;
+}
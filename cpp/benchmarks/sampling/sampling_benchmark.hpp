@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "common/benchmark_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace bench {
+
+// synthetic R-mat graphs with the average degree (and roughly the size, scaled down to fit a single
+// GPU by default) of the OGB node property prediction datasets commonly used to benchmark GNN
+// training
+enum class sampling_graph_t {
+  ogbn_products_like,  // 2.4M vertices, 62M undirected edges
+  ogbn_papers_like     // 111M vertices, 1.6B edges (scaled down to 16M vertices, 240M edges)
+};
+
+inline std::string to_string(sampling_graph_t graph)
+{
+  return graph == sampling_graph_t::ogbn_products_like ? "ogbn_products_like"
+                                                        : "ogbn_papers_like";
+}
+
+struct sampling_benchmark_options_t {
+  size_t scale_delta{0};       // added to the default scale of every graph
+  size_t num_minibatches{16};  // per GPU with weak scaling, in total with strong scaling
+  bool weak_scaling{true};     // with weak scaling, the graph size (scale + log2(# GPUs)) and the
+                               // total number of minibatches grow with the number of GPUs
+  size_t num_iterations{10};  // fixed so every GPU runs the same number of iterations in multi-GPU
+  int32_t num_edge_types{4};  // for heterogeneous sampling
+};
+
+// per-hop fanouts and minibatch sizes (GraphSAGE on ogbn-products uses [15, 10, 5] with batch
+// size 1024 and [25, 10] with batch size 512)
+struct sampling_config_t {
+  std::vector<int32_t> fan_out{};
+  size_t batch_size{};
+  bool heterogeneous{false};
+};
+
+inline std::string to_string(sampling_config_t const& config)
+{
+  std::string str = config.heterogeneous ? "heterogeneous" : "homogeneous";
+  str += "/fanout";
+  for (auto f : config.fan_out) {
+    str += "_" + std::to_string(f);
+  }
+  return str + "/batch" + std::to_string(config.batch_size);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct sampling_benchmark_graph_t {
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu> graph;
+  cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>, int32_t>
+    edge_types;
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+using sampling_benchmark_graph_cache_t =
+  std::map<sampling_graph_t,
+           std::unique_ptr<sampling_benchmark_graph_t<vertex_t, edge_t, multi_gpu>>>;
+
+// graphs are constructed once and shared by every configuration benchmarked on the same graph
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+sampling_benchmark_graph_cache_t<vertex_t, edge_t, multi_gpu>& sampling_benchmark_graph_cache()
+{
+  static sampling_benchmark_graph_cache_t<vertex_t, edge_t, multi_gpu> graphs{};
+  return graphs;
+}
+
+// call before the handle and the memory resource the graphs were allocated with are destroyed
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void clear_sampling_benchmark_graphs()
+{
+  sampling_benchmark_graph_cache<vertex_t, edge_t, multi_gpu>().clear();
+}
+
+inline size_t graph_scale(raft::handle_t const& handle,
+                          sampling_graph_t graph,
+                          sampling_benchmark_options_t const& options,
+                          bool multi_gpu)
+{
+  size_t scale = (graph == sampling_graph_t::ogbn_products_like ? 21 : 24) + options.scale_delta;
+  if (multi_gpu && options.weak_scaling) {
+    for (auto p = handle.get_comms().get_size(); p > 1; p /= 2) {
+      ++scale;
+    }
+  }
+  return scale;
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+sampling_benchmark_graph_t<vertex_t, edge_t, multi_gpu>& get_sampling_benchmark_graph(
+  raft::handle_t const& handle, sampling_graph_t graph, sampling_benchmark_options_t const& options)
+{
+  auto& graphs = sampling_benchmark_graph_cache<vertex_t, edge_t, multi_gpu>();
+
+  auto it = graphs.find(graph);
+  if (it == graphs.end()) {
+    cugraph::test::Rmat_Usecase usecase(
+      graph_scale(handle, graph, options, multi_gpu),
+      graph == sampling_graph_t::ogbn_products_like ? 26 : 15 /* half the average degree */,
+      0.57,
+      0.19,
+      0.19,
+      uint64_t{0},
+      true /* undirected */,
+      true /* scramble_vertex_ids */);
+    cugraph::graph_t<vertex_t, edge_t, false, multi_gpu> g(handle);
+    std::tie(g, std::ignore, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, multi_gpu>(
+        handle, usecase, false, true);
+    auto edge_types =
+      cugraph::test::generate<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                              int32_t>::edge_property(handle, g.view(), options.num_edge_types);
+    it = graphs
+           .emplace(graph,
+                    std::make_unique<sampling_benchmark_graph_t<vertex_t, edge_t, multi_gpu>>(
+                      sampling_benchmark_graph_t<vertex_t, edge_t, multi_gpu>{
+                        std::move(g), std::move(edge_types)}))
+           .first;
+  }
+  return *(it->second);
+}
+
+// Seeds of the minibatches assigned to this GPU (drawn from the locally owned vertices as a
+// distributed data loader does) with their minibatch IDs as labels.
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int32_t>> generate_minibatches(
+  raft::handle_t const& handle,
+  vertex_t local_vertex_first,
+  vertex_t local_vertex_last,
+  size_t batch_size,
+  size_t num_minibatches,
+  int32_t minibatch_id_first,
+  std::mt19937& rng)
+{
+  std::uniform_int_distribution<vertex_t> distribution(local_vertex_first, local_vertex_last - 1);
+  std::vector<vertex_t> h_seeds(batch_size * num_minibatches);
+  std::vector<int32_t> h_labels(h_seeds.size());
+  for (size_t i = 0; i < h_seeds.size(); ++i) {
+    h_seeds[i]  = distribution(rng);
+    h_labels[i] = minibatch_id_first + static_cast<int32_t>(i / batch_size);
+  }
+
+  rmm::device_uvector<vertex_t> seeds(h_seeds.size(), handle.get_stream());
+  rmm::device_uvector<int32_t> labels(h_labels.size(), handle.get_stream());
+  raft::update_device(seeds.data(), h_seeds.data(), h_seeds.size(), handle.get_stream());
+  raft::update_device(labels.data(), h_labels.data(), h_labels.size(), handle.get_stream());
+  handle.sync_stream();
+
+  return std::make_tuple(std::move(seeds), std::move(labels));
+}
+
+// Runs one GNN minibatch generation step per iteration (after one untimed warm-up step): samples
+// the neighborhoods of every minibatch assigned to this GPU (homogeneous_uniform_neighbor_sample or
+// heterogeneous_uniform_neighbor_sample with the options of the PyG data loaders, the sampled edges
+// of each minibatch are returned to the GPU owning the minibatch) and converts them to the per
+// minibatch CSR subgraphs fed to the GNN layers (renumber_and_compress_sampled_edgelist, run
+// independently by every GPU on its own minibatches). Reports the aggregate minibatches per second
+// and the (slowest GPU's) time spent in each stage.
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void run_sampling_benchmark(benchmark::State& state,
+                            raft::handle_t const& handle,
+                            sampling_graph_t graph,
+                            sampling_config_t const& config,
+                            sampling_benchmark_options_t const& options)
+{
+  auto& bench_graph =
+    get_sampling_benchmark_graph<vertex_t, edge_t, multi_gpu>(handle, graph, options);
+  auto graph_view     = bench_graph.graph.view();
+  auto edge_type_view = bench_graph.edge_types.view();
+
+  int comm_rank{0};
+  int comm_size{1};
+  if constexpr (multi_gpu) {
+    comm_rank = handle.get_comms().get_rank();
+    comm_size = handle.get_comms().get_size();
+  }
+
+  // minibatches are evenly distributed over the GPUs with consecutive IDs on each GPU
+
+  auto num_total_minibatches = options.weak_scaling
+                                 ? options.num_minibatches * static_cast<size_t>(comm_size)
+                                 : options.num_minibatches;
+  auto num_local_minibatches =
+    num_total_minibatches / comm_size +
+    (static_cast<size_t>(comm_rank) < num_total_minibatches % comm_size ? size_t{1} : size_t{0});
+  auto minibatch_id_first = static_cast<int32_t>(
+    (num_total_minibatches / comm_size) * comm_rank +
+    std::min(static_cast<size_t>(comm_rank), num_total_minibatches % comm_size));
+
+  std::optional<rmm::device_uvector<int32_t>> label_to_output_comm_rank{std::nullopt};
+  if constexpr (multi_gpu) {
+    std::vector<int32_t> h_label_to_output_comm_rank(num_total_minibatches);
+    for (int r = 0; r < comm_size; ++r) {
+      auto first = (num_total_minibatches / comm_size) * r +
+                   std::min(static_cast<size_t>(r), num_total_minibatches % comm_size);
+      auto count = num_total_minibatches / comm_size +
+                   (static_cast<size_t>(r) < num_total_minibatches % comm_size ? 1 : 0);
+      std::fill(h_label_to_output_comm_rank.begin() + first,
+                h_label_to_output_comm_rank.begin() + first + count,
+                r);
+    }
+    label_to_output_comm_rank =
+      rmm::device_uvector<int32_t>(h_label_to_output_comm_rank.size(), handle.get_stream());
+    raft::update_device(label_to_output_comm_rank->data(),
+                        h_label_to_output_comm_rank.data(),
+                        h_label_to_output_comm_rank.size(),
+                        handle.get_stream());
+  }
+
+  // the heterogeneous configurations split every hop's fanout evenly over the edge types
+
+  auto num_hops = config.fan_out.size();
+  std::vector<int32_t> fan_out{};
+  if (config.heterogeneous) {
+    for (auto f : config.fan_out) {
+      fan_out.insert(fan_out.end(),
+                     options.num_edge_types,
+                     std::max(f / options.num_edge_types, int32_t{1}));
+    }
+  } else {
+    fan_out = config.fan_out;
+  }
+
+  raft::random::RngState rng_state(static_cast<uint64_t>(comm_rank));
+  std::mt19937 seed_rng(static_cast<uint32_t>(comm_rank));
+
+  double sample_seconds{0.0};
+  double post_processing_seconds{0.0};
+  size_t num_sampled_edges{0};
+
+  auto step = [&]() {
+    auto [seeds, labels] = generate_minibatches(handle,
+                                                graph_view.local_vertex_partition_range_first(),
+                                                graph_view.local_vertex_partition_range_last(),
+                                                config.batch_size,
+                                                num_local_minibatches,
+                                                minibatch_id_first,
+                                                seed_rng);
+
+    auto start = synchronized_seconds<multi_gpu>(handle);
+
+    rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+    std::optional<rmm::device_uvector<int32_t>> edge_types{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> hops{std::nullopt};
+    std::optional<rmm::device_uvector<size_t>> offsets{std::nullopt};
+
+    // exclude the vertices sampled in the previous hops from the frontiers (and dedupe the
+    // frontiers) as the PyG data loaders do, this also meets the requirements of
+    // renumber_and_compress_sampled_edgelist with compress_per_hop = false
+    auto flags = cugraph::sampling_flags_t{cugraph::prior_sources_behavior_t::EXCLUDE,
+                                           true /* return_hops */,
+                                           true /* dedupe_sources */,
+                                           false /* with_replacement */};
+    auto label_to_output_comm_rank_span =
+      label_to_output_comm_rank
+        ? std::make_optional(raft::device_span<int32_t const>(label_to_output_comm_rank->data(),
+                                                              label_to_output_comm_rank->size()))
+        : std::nullopt;
+
+    if (config.heterogeneous) {
+      std::tie(srcs, dsts, std::ignore, std::ignore, edge_types, hops, offsets) =
+        cugraph::heterogeneous_uniform_neighbor_sample(
+          handle,
+          rng_state,
+          graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::make_optional(edge_type_view),
+          raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+          std::make_optional(raft::device_span<int32_t const>(labels.data(), labels.size())),
+          label_to_output_comm_rank_span,
+          raft::host_span<int32_t const>(fan_out.data(), fan_out.size()),
+          options.num_edge_types,
+          flags);
+    } else {
+      std::tie(srcs, dsts, std::ignore, std::ignore, std::ignore, hops, offsets) =
+        cugraph::homogeneous_uniform_neighbor_sample(
+          handle,
+          rng_state,
+          graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+          std::make_optional(raft::device_span<int32_t const>(labels.data(), labels.size())),
+          label_to_output_comm_rank_span,
+          raft::host_span<int32_t const>(fan_out.data(), fan_out.size()),
+          flags);
+    }
+
+    auto sampled = synchronized_seconds<multi_gpu>(handle);
+
+    // minibatches without any sampled edge have no offsets entry
+    auto num_labels      = offsets ? std::max(offsets->size(), size_t{2}) - 1 : size_t{1};
+    auto local_num_edges = srcs.size();
+    if (local_num_edges > 0) {
+      std::ignore = renumber_and_compress_sampled_edgelist<vertex_t, float, edge_t, int32_t>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::nullopt,
+        std::nullopt,
+        std::move(edge_types),
+        std::move(hops),
+        std::nullopt,
+        std::nullopt,
+        num_labels >= 2 ? std::make_optional(raft::device_span<size_t const>(offsets->data(),
+                                                                             offsets->size()))
+                        : std::nullopt,
+        num_labels,
+        num_hops,
+        true /* src_is_major */,
+        false /* compress_per_hop */,
+        false /* doubly_compress */);
+    }
+
+    auto post_processed = synchronized_seconds<multi_gpu>(handle);
+
+    if constexpr (multi_gpu) {
+      local_num_edges = cugraph::host_scalar_allreduce(
+        handle.get_comms(), local_num_edges, raft::comms::op_t::SUM, handle.get_stream());
+    }
+
+    return std::make_tuple(sampled - start, post_processed - sampled, local_num_edges);
+  };
+
+  step();  // warm-up
+
+  for (auto _ : state) {
+    auto [sample_time, post_processing_time, num_edges] = step();
+    sample_seconds += sample_time;
+    post_processing_seconds += post_processing_time;
+    num_sampled_edges += num_edges;
+    state.SetIterationTime(sample_time + post_processing_time);
+  }
+
+  state.counters["minibatches_per_second"] = benchmark::Counter(
+    static_cast<double>(num_total_minibatches), benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["sample_seconds"] =
+    benchmark::Counter(sample_seconds, benchmark::Counter::kAvgIterations);
+  state.counters["post_processing_seconds"] =
+    benchmark::Counter(post_processing_seconds, benchmark::Counter::kAvgIterations);
+  state.counters["sampled_edges_per_minibatch"] = benchmark::Counter(
+    static_cast<double>(num_sampled_edges) / static_cast<double>(num_total_minibatches),
+    benchmark::Counter::kAvgIterations);
+  state.counters["num_vertices"] = static_cast<double>(graph_view.number_of_vertices());
+  state.counters["num_gpus"]     = static_cast<double>(comm_size);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void register_sampling_benchmarks(raft::handle_t const& handle,
+                                  sampling_benchmark_options_t const& options)
+{
+  std::vector<sampling_config_t> configs{
+    {{10, 10, 10}, 1024, false},
+    {{15, 10, 5}, 1024, false},
+    {{25, 10}, 512, false},
+    {{15, 10, 5}, 1024, true},
+    {{25, 10}, 512, true}};
+
+  for (auto graph : {sampling_graph_t::ogbn_products_like, sampling_graph_t::ogbn_papers_like}) {
+    for (auto const& config : configs) {
+      auto name = to_string(graph) + "/" + to_string(config) + "/v" +
+                  std::to_string(sizeof(vertex_t) * 8) + "_e" + std::to_string(sizeof(edge_t) * 8) +
+                  "/scale" +
+                  std::to_string(graph_scale(handle, graph, options, multi_gpu)) +
+                  (options.weak_scaling ? "/weak" : "/strong");
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   [&handle, graph, config, options](benchmark::State& state) {
+                                     run_sampling_benchmark<vertex_t, edge_t, multi_gpu>(
+                                       state, handle, graph, config, options);
+                                   })
+        ->UseManualTime()
+        ->Iterations(options.num_iterations)
+        ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+
+// parses (and removes) the
+// --sampling_benchmark_{scale_delta|minibatches|iterations|edge_types}=N and
+// --sampling_benchmark_scaling={weak|strong} arguments left after benchmark::Initialize()
+inline sampling_benchmark_options_t parse_sampling_benchmark_options(int& argc, char** argv)
+{
+  sampling_benchmark_options_t options{};
+  int num_remaining_args{1};
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    auto parse = [&arg](std::string const& prefix, auto& value) {
+      if (arg.rfind(prefix, 0) == 0) {
+        value = static_cast<std::remove_reference_t<decltype(value)>>(
+          std::stoull(arg.substr(prefix.size())));
+        return true;
+      }
+      return false;
+    };
+    std::string const scaling_prefix = "--sampling_benchmark_scaling=";
+    if (arg.rfind(scaling_prefix, 0) == 0) {
+      options.weak_scaling = (arg.substr(scaling_prefix.size()) != "strong");
+    } else if (!parse("--sampling_benchmark_scale_delta=", options.scale_delta) &&
+               !parse("--sampling_benchmark_minibatches=", options.num_minibatches) &&
+               !parse("--sampling_benchmark_iterations=", options.num_iterations) &&
+               !parse("--sampling_benchmark_edge_types=", options.num_edge_types)) {
+      argv[num_remaining_args++] = argv[i];
+    }
+  }
+  argc = num_remaining_args;
+  return options;
+}
+
+}  // namespace bench
+}  // namespace cugraph
@@ -28,6 +28,7 @@ EXAMPLES_ROOT_DIR=$(dirname "$(realpath "$0")")
 EXAMPLES=(
     "users/single_gpu_application"
     "users/multi_gpu_application"
+    "users/graph500_benchmark"
     "developers/vertex_and_edge_partition"
     "developers/graph_operations")
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -127,13 +127,23 @@ create_graph(raft::handle_t const& handle,
   //
 
   if (multi_gpu) {
-    std::tie(d_edge_srcs, d_edge_dsts, d_edge_wgts, std::ignore, std::ignore, std::ignore) =
-      cugraph::shuffle_external_edges<vertex_t, vertex_t, weight_t, int32_t>(handle,
-                                                                             std::move(d_edge_srcs),
-                                                                             std::move(d_edge_dsts),
-                                                                             std::move(d_edge_wgts),
-                                                                             std::nullopt,
-                                                                             std::nullopt);
+    std::tie(d_edge_srcs,
+             d_edge_dsts,
+             d_edge_wgts,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore) =
+      cugraph::shuffle_external_edges<vertex_t, vertex_t, weight_t, int32_t, int32_t>(
+        handle,
+        std::move(d_edge_srcs),
+        std::move(d_edge_dsts),
+        std::move(d_edge_wgts),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
   }
 
   //
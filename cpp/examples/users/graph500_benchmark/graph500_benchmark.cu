@@ -0,0 +1,633 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//
+// Graph500 style benchmark (https://graph500.org): generate a scrambled R-mat graph, build the
+// graph (kernel 1), and run BFS (kernel 2) and SSSP (kernel 3) from randomly chosen roots with
+// validation. Run with a single process for single-GPU or with mpirun for multi-GPU.
+//
+// Usage: graph500_benchmark [scale] [edge_factor] [--num-roots N] [--seed S] [--no-validate]
+//        [--profile] [--shuffle-memory-budget BYTES]
+//
+
+using vertex_t = int64_t;
+using edge_t   = int64_t;
+using weight_t = float;
+
+struct benchmark_options_t {
+  size_t scale{16};
+  size_t edge_factor{16};
+  size_t num_roots{64};
+  uint64_t seed{0};
+  bool validate{true};
+  bool profile{false};
+  size_t shuffle_memory_budget{size_t{1} << 30};
+};
+
+struct kernel_statistics_t {
+  std::vector<double> times{};
+  std::vector<double> teps{};
+  size_t num_validation_failures{0};
+};
+
+benchmark_options_t parse_options(int argc, char** argv)
+{
+  benchmark_options_t options{};
+  size_t num_positional_args{0};
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    if ((arg == "--num-roots") && (i + 1 < argc)) {
+      options.num_roots = std::stoull(argv[++i]);
+    } else if ((arg == "--seed") && (i + 1 < argc)) {
+      options.seed = std::stoull(argv[++i]);
+    } else if ((arg == "--shuffle-memory-budget") && (i + 1 < argc)) {
+      options.shuffle_memory_budget = std::stoull(argv[++i]);
+    } else if (arg == "--no-validate") {
+      options.validate = false;
+    } else if (arg == "--profile") {
+      options.profile = true;
+    } else if (num_positional_args == 0) {
+      options.scale = std::stoull(arg);
+      ++num_positional_args;
+    } else if (num_positional_args == 1) {
+      options.edge_factor = std::stoull(arg);
+      ++num_positional_args;
+    } else {
+      throw std::invalid_argument("Invalid argument: " + arg);
+    }
+  }
+  return options;
+}
+
+void initialize_mpi_and_set_device(int argc, char** argv)
+{
+  RAFT_MPI_TRY(MPI_Init(&argc, &argv));
+
+  int comm_rank{};
+  RAFT_MPI_TRY(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank));
+
+  int num_gpus_per_node{};
+  RAFT_CUDA_TRY(cudaGetDeviceCount(&num_gpus_per_node));
+  RAFT_CUDA_TRY(cudaSetDevice(comm_rank % num_gpus_per_node));
+}
+
+std::unique_ptr<raft::handle_t> initialize_handle(bool multi_gpu)
+{
+  std::shared_ptr<rmm::mr::device_memory_resource> resource =
+    std::make_shared<rmm::mr::cuda_memory_resource>();
+  rmm::mr::set_current_device_resource(resource.get());
+
+  std::unique_ptr<raft::handle_t> handle =
+    std::make_unique<raft::handle_t>(rmm::cuda_stream_per_thread, resource);
+
+  if (multi_gpu) {
+    raft::comms::initialize_mpi_comms(handle.get(), MPI_COMM_WORLD);
+    auto& comm           = handle->get_comms();
+    auto const comm_size = comm.get_size();
+
+    auto gpu_row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % gpu_row_comm_size != 0) {
+      --gpu_row_comm_size;
+    }
+
+    cugraph::partition_manager::init_subcomm(*handle, gpu_row_comm_size);
+  }
+
+  return handle;
+}
+
+// wall time (in seconds) after every GPU finishes the work queued so far
+double synchronized_time(raft::handle_t const& handle, bool multi_gpu)
+{
+  handle.sync_stream();
+  if (multi_gpu) { handle.get_comms().barrier(); }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+size_t global_sum(size_t value, bool multi_gpu)
+{
+  static_assert(sizeof(size_t) == sizeof(uint64_t));
+  if (multi_gpu) {
+    size_t ret{};
+    RAFT_MPI_TRY(MPI_Allreduce(&value, &ret, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD));
+    return ret;
+  }
+  return value;
+}
+
+// every GPU receives the values of every vertex (used only for validation)
+template <typename value_t, bool multi_gpu>
+rmm::device_uvector<value_t> gather_vertex_values(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  rmm::device_uvector<value_t> const& local_values)
+{
+  rmm::device_uvector<value_t> values(graph_view.number_of_vertices(), handle.get_stream());
+  if constexpr (multi_gpu) {
+    auto& comm       = handle.get_comms();
+    auto range_lasts = graph_view.vertex_partition_range_lasts();
+    std::vector<size_t> counts(range_lasts.size());
+    std::vector<size_t> displacements(range_lasts.size());
+    for (size_t i = 0; i < range_lasts.size(); ++i) {
+      displacements[i] = (i == 0) ? size_t{0} : static_cast<size_t>(range_lasts[i - 1]);
+      counts[i]        = static_cast<size_t>(range_lasts[i]) - displacements[i];
+    }
+    comm.allgatherv(local_values.data(),
+                    values.data(),
+                    counts.data(),
+                    displacements.data(),
+                    handle.get_stream());
+  } else {
+    thrust::copy(
+      handle.get_thrust_policy(), local_values.begin(), local_values.end(), values.begin());
+  }
+  return values;
+}
+
+// Graph500 counts the undirected input edges in the traversed component; this sums the degrees of
+// the reached vertices and halves the sum as every undirected edge is stored in both directions.
+template <typename distance_t, bool multi_gpu>
+double count_traversed_edges(raft::handle_t const& handle,
+                             rmm::device_uvector<distance_t> const& distances,
+                             rmm::device_uvector<edge_t> const& degrees)
+{
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(distances.begin(), degrees.begin()));
+  auto local_sum = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + distances.size(),
+    [invalid_distance = std::numeric_limits<distance_t>::max()] __device__(auto pair) {
+      return thrust::get<0>(pair) != invalid_distance ? thrust::get<1>(pair) : edge_t{0};
+    },
+    edge_t{0},
+    thrust::plus<edge_t>{});
+  edge_t sum{local_sum};
+  if (multi_gpu) {
+    RAFT_MPI_TRY(MPI_Allreduce(&local_sum, &sum, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD));
+  }
+  return static_cast<double>(sum) / 2.0;
+}
+
+// randomly choose roots among the vertices with at least one edge (in the internal vertex ID space)
+std::vector<vertex_t> choose_roots(raft::handle_t const& handle,
+                                   rmm::device_uvector<edge_t> const& degrees,
+                                   vertex_t local_vertex_partition_range_first,
+                                   benchmark_options_t const& options,
+                                   int comm_rank,
+                                   int comm_size)
+{
+  std::vector<edge_t> h_degrees(degrees.size());
+  raft::update_host(h_degrees.data(), degrees.data(), degrees.size(), handle.get_stream());
+  handle.sync_stream();
+
+  std::vector<vertex_t> candidates{};
+  for (size_t i = 0; i < h_degrees.size(); ++i) {
+    if (h_degrees[i] > 0) {
+      candidates.push_back(local_vertex_partition_range_first + static_cast<vertex_t>(i));
+    }
+  }
+  std::mt19937_64 local_gen(options.seed + comm_rank);
+  std::shuffle(candidates.begin(), candidates.end(), local_gen);
+  candidates.resize(std::min(candidates.size(), options.num_roots));
+
+  int count = static_cast<int>(candidates.size());
+  std::vector<int> counts(comm_size);
+  RAFT_MPI_TRY(MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD));
+  std::vector<int> displacements(comm_size);
+  std::exclusive_scan(counts.begin(), counts.end(), displacements.begin(), 0);
+  std::vector<vertex_t> roots(displacements.back() + counts.back());
+  RAFT_MPI_TRY(MPI_Allgatherv(candidates.data(),
+                              count,
+                              MPI_INT64_T,
+                              roots.data(),
+                              counts.data(),
+                              displacements.data(),
+                              MPI_INT64_T,
+                              MPI_COMM_WORLD));
+
+  std::mt19937_64 global_gen(options.seed);  // identical in every process
+  std::shuffle(roots.begin(), roots.end(), global_gen);
+  roots.resize(std::min(roots.size(), options.num_roots));
+  return roots;
+}
+
+template <bool multi_gpu>
+size_t validate_bfs(raft::handle_t const& handle,
+                    cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                    rmm::device_uvector<vertex_t> const& edge_srcs,
+                    rmm::device_uvector<vertex_t> const& edge_dsts,
+                    rmm::device_uvector<vertex_t> const& distances,
+                    rmm::device_uvector<vertex_t> const& predecessors,
+                    vertex_t root)
+{
+  auto global_distances = gather_vertex_values(handle, graph_view, distances);
+  auto invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  // every edge connects two reached vertices whose levels differ by at most one or two unreached
+  // vertices
+  auto num_failures = thrust::count_if(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(edge_srcs.size()),
+    [srcs      = edge_srcs.data(),
+     dsts      = edge_dsts.data(),
+     distances = global_distances.data(),
+     invalid_distance] __device__(size_t i) {
+      auto src_distance = distances[srcs[i]];
+      auto dst_distance = distances[dsts[i]];
+      if ((src_distance == invalid_distance) != (dst_distance == invalid_distance)) { return true; }
+      if (src_distance == invalid_distance) { return false; }
+      return (src_distance > dst_distance + 1) || (dst_distance > src_distance + 1);
+    });
+
+  // the root is at level 0 and every other reached vertex has a predecessor one level closer
+  num_failures += thrust::count_if(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_size()),
+    [distances    = global_distances.data(),
+     predecessors = predecessors.data(),
+     v_first      = graph_view.local_vertex_partition_range_first(),
+     root,
+     invalid_distance,
+     invalid_vertex = cugraph::invalid_vertex_id<vertex_t>::value] __device__(vertex_t i) {
+      auto v    = v_first + i;
+      auto d    = distances[v];
+      auto pred = predecessors[i];
+      if (v == root) { return d != 0; }
+      if (d == invalid_distance) { return pred != invalid_vertex; }
+      return (pred == invalid_vertex) || (distances[pred] != d - 1);
+    });
+
+  return global_sum(static_cast<size_t>(num_failures), multi_gpu);
+}
+
+template <bool multi_gpu>
+size_t validate_sssp(raft::handle_t const& handle,
+                     cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                     rmm::device_uvector<vertex_t> const& edge_srcs,
+                     rmm::device_uvector<vertex_t> const& edge_dsts,
+                     rmm::device_uvector<weight_t> const& edge_weights,
+                     rmm::device_uvector<weight_t> const& distances,
+                     rmm::device_uvector<vertex_t> const& predecessors,
+                     vertex_t root)
+{
+  auto global_distances = gather_vertex_values(handle, graph_view, distances);
+  auto invalid_distance = std::numeric_limits<weight_t>::max();
+  weight_t tolerance{1e-5};
+
+  // no edge can further relax a reached vertex
+  auto num_failures = thrust::count_if(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(edge_srcs.size()),
+    [srcs      = edge_srcs.data(),
+     dsts      = edge_dsts.data(),
+     weights   = edge_weights.data(),
+     distances = global_distances.data(),
+     invalid_distance,
+     tolerance] __device__(size_t i) {
+      auto src_distance = distances[srcs[i]];
+      auto dst_distance = distances[dsts[i]];
+      if ((src_distance == invalid_distance) != (dst_distance == invalid_distance)) { return true; }
+      if (src_distance == invalid_distance) { return false; }
+      auto relaxed = src_distance + weights[i];
+      return dst_distance > relaxed + tolerance * relaxed;
+    });
+
+  // the root is at distance 0 and every other reached vertex has a predecessor not further away
+  num_failures += thrust::count_if(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_size()),
+    [distances    = global_distances.data(),
+     predecessors = predecessors.data(),
+     v_first      = graph_view.local_vertex_partition_range_first(),
+     root,
+     invalid_distance,
+     invalid_vertex = cugraph::invalid_vertex_id<vertex_t>::value] __device__(vertex_t i) {
+      auto v    = v_first + i;
+      auto d    = distances[v];
+      auto pred = predecessors[i];
+      if (v == root) { return d != weight_t{0}; }
+      if (d == invalid_distance) { return pred != invalid_vertex; }
+      return (pred == invalid_vertex) || (distances[pred] > d);
+    });
+
+  return global_sum(static_cast<size_t>(num_failures), multi_gpu);
+}
+
+void print_kernel_statistics(std::string const& name, kernel_statistics_t statistics)
+{
+  if (statistics.times.empty()) { return; }
+  std::sort(statistics.times.begin(), statistics.times.end());
+  std::sort(statistics.teps.begin(), statistics.teps.end());
+  auto n = statistics.times.size();
+  auto harmonic_mean_teps =
+    static_cast<double>(n) /
+    std::accumulate(statistics.teps.begin(), statistics.teps.end(), 0.0, [](auto sum, auto teps) {
+      return sum + 1.0 / teps;
+    });
+  std::cout << name << "_min_time: " << statistics.times.front() << std::endl;
+  std::cout << name << "_median_time: " << statistics.times[n / 2] << std::endl;
+  std::cout << name << "_max_time: " << statistics.times.back() << std::endl;
+  std::cout << name << "_mean_time: "
+            << std::accumulate(statistics.times.begin(), statistics.times.end(), 0.0) / n
+            << std::endl;
+  std::cout << name << "_min_TEPS: " << statistics.teps.front() << std::endl;
+  std::cout << name << "_median_TEPS: " << statistics.teps[n / 2] << std::endl;
+  std::cout << name << "_max_TEPS: " << statistics.teps.back() << std::endl;
+  std::cout << name << "_harmonic_mean_TEPS: " << harmonic_mean_teps << std::endl;
+  std::cout << name << "_validation_failures: " << statistics.num_validation_failures
+            << std::endl;
+}
+
+void print_profile(std::string const& title)
+{
+  std::cout << title << " per-primitive breakdown:" << std::endl;
+  for (auto const& record : cugraph::prim_profiler_t::instance().report()) {
+    std::cout << "  " << record.name << ": calls " << record.num_calls << ", time "
+              << record.elapsed_seconds << " s, bytes communicated " << record.bytes_communicated
+              << ", edges touched " << record.edges_touched << std::endl;
+  }
+}
+
+template <bool multi_gpu>
+size_t run_benchmark(raft::handle_t const& handle, benchmark_options_t const& options)
+{
+  auto const comm_rank = multi_gpu ? handle.get_comms().get_rank() : 0;
+  auto const comm_size = multi_gpu ? handle.get_comms().get_size() : 1;
+  auto& profiler       = cugraph::prim_profiler_t::instance();
+
+  //
+  // Generate the edge list (not timed as a Graph500 kernel)
+  //
+
+  auto generation_start = synchronized_time(handle, multi_gpu);
+
+  auto global_num_edges = (size_t{1} << options.scale) * options.edge_factor;
+  auto num_edges        = global_num_edges / comm_size +
+                   (static_cast<size_t>(comm_rank) < (global_num_edges % comm_size) ? 1 : 0);
+  raft::random::RngState rng_state(options.seed + comm_rank);
+
+  auto [srcs, dsts] = cugraph::generate_rmat_edgelist<vertex_t>(
+    handle, rng_state, options.scale, num_edges, 0.57, 0.19, 0.19, false, false);
+  std::tie(srcs, dsts) =
+    cugraph::scramble_vertex_ids<vertex_t>(handle, std::move(srcs), std::move(dsts), options.scale);
+  rmm::device_uvector<weight_t> weights(srcs.size(), handle.get_stream());
+  cugraph::detail::uniform_random_fill(
+    handle.get_stream(), weights.data(), weights.size(), weight_t{0.0}, weight_t{1.0}, rng_state);
+
+  // Graph500 graphs are undirected, store every edge in both directions (with the same weight)
+  srcs.resize(num_edges * 2, handle.get_stream());
+  dsts.resize(num_edges * 2, handle.get_stream());
+  weights.resize(num_edges * 2, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), srcs.begin(), srcs.begin() + num_edges, dsts.begin() + num_edges);
+  thrust::copy(
+    handle.get_thrust_policy(), dsts.begin(), dsts.begin() + num_edges, srcs.begin() + num_edges);
+  thrust::copy(handle.get_thrust_policy(),
+               weights.begin(),
+               weights.begin() + num_edges,
+               weights.begin() + num_edges);
+
+  auto generation_time = synchronized_time(handle, multi_gpu) - generation_start;
+
+  //
+  // Kernel 1: graph construction
+  //
+
+  if (options.profile) {
+    profiler.clear();
+    profiler.enable(true);
+  }
+  auto construction_start = synchronized_time(handle, multi_gpu);
+
+  std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+  std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> weight_chunks{
+    std::vector<rmm::device_uvector<weight_t>>{}};
+  if constexpr (multi_gpu) {
+    std::tie(src_chunks,
+             dst_chunks,
+             weight_chunks,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore) =
+      cugraph::shuffle_external_edges_in_chunks<vertex_t, edge_t, weight_t, int32_t, int32_t>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::make_optional(std::move(weights)),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        options.shuffle_memory_budget);
+  } else {
+    src_chunks.push_back(std::move(srcs));
+    dst_chunks.push_back(std::move(dsts));
+    (*weight_chunks).push_back(std::move(weights));
+  }
+
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu> graph(handle);
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>
+    edge_weights{std::nullopt};
+  std::tie(graph, edge_weights, std::ignore, std::ignore, std::ignore) =
+    cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, false, multi_gpu>(
+      handle,
+      std::nullopt,
+      std::move(src_chunks),
+      std::move(dst_chunks),
+      std::move(weight_chunks),
+      std::nullopt,
+      std::nullopt,
+      cugraph::graph_properties_t{true /* symmetric */, true /* multigraph */},
+      true /* renumber */);
+
+  auto construction_time = synchronized_time(handle, multi_gpu) - construction_start;
+  if (options.profile && (comm_rank == 0)) { print_profile("construction"); }
+
+  auto graph_view       = graph.view();
+  auto edge_weight_view = (*edge_weights).view();
+
+  auto degrees = graph_view.compute_out_degrees(handle);
+  auto roots   = choose_roots(handle,
+                            degrees,
+                            graph_view.local_vertex_partition_range_first(),
+                            options,
+                            comm_rank,
+                            comm_size);
+
+  std::optional<rmm::device_uvector<vertex_t>> edge_srcs{std::nullopt};
+  std::optional<rmm::device_uvector<vertex_t>> edge_dsts{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> edge_wgts{std::nullopt};
+  if (options.validate) {
+    std::tie(edge_srcs, edge_dsts, edge_wgts, std::ignore, std::ignore) =
+      cugraph::decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t, false, multi_gpu>(
+        handle,
+        graph_view,
+        std::make_optional(edge_weight_view),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
+  }
+
+  //
+  // Kernel 2 (BFS) and kernel 3 (SSSP)
+  //
+
+  rmm::device_uvector<vertex_t> d_source(1, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_bfs_distances(graph_view.local_vertex_partition_range_size(),
+                                                handle.get_stream());
+  rmm::device_uvector<weight_t> d_sssp_distances(graph_view.local_vertex_partition_range_size(),
+                                                 handle.get_stream());
+  rmm::device_uvector<vertex_t> d_predecessors(graph_view.local_vertex_partition_range_size(),
+                                               handle.get_stream());
+
+  kernel_statistics_t bfs_statistics{};
+  kernel_statistics_t sssp_statistics{};
+  double validation_time{0.0};
+  if (options.profile) { profiler.clear(); }
+  for (auto root : roots) {
+    auto is_local_root = (root >= graph_view.local_vertex_partition_range_first()) &&
+                         (root < graph_view.local_vertex_partition_range_last());
+    if (is_local_root) {
+      raft::update_device(d_source.data(), &root, size_t{1}, handle.get_stream());
+    }
+
+    auto bfs_start = synchronized_time(handle, multi_gpu);
+    cugraph::bfs(handle,
+                 graph_view,
+                 d_bfs_distances.data(),
+                 d_predecessors.data(),
+                 d_source.data(),
+                 is_local_root ? size_t{1} : size_t{0},
+                 true /* direction_optimizing */);
+    auto bfs_time = synchronized_time(handle, multi_gpu) - bfs_start;
+    bfs_statistics.times.push_back(bfs_time);
+    bfs_statistics.teps.push_back(
+      count_traversed_edges<vertex_t, multi_gpu>(handle, d_bfs_distances, degrees) / bfs_time);
+
+    if (options.validate) {
+      auto validation_start = synchronized_time(handle, multi_gpu);
+      bfs_statistics.num_validation_failures += validate_bfs(
+        handle, graph_view, *edge_srcs, *edge_dsts, d_bfs_distances, d_predecessors, root);
+      validation_time += synchronized_time(handle, multi_gpu) - validation_start;
+    }
+
+    auto sssp_start = synchronized_time(handle, multi_gpu);
+    cugraph::sssp(handle,
+                  graph_view,
+                  edge_weight_view,
+                  d_sssp_distances.data(),
+                  d_predecessors.data(),
+                  root);
+    auto sssp_time = synchronized_time(handle, multi_gpu) - sssp_start;
+    sssp_statistics.times.push_back(sssp_time);
+    sssp_statistics.teps.push_back(
+      count_traversed_edges<weight_t, multi_gpu>(handle, d_sssp_distances, degrees) / sssp_time);
+
+    if (options.validate) {
+      auto validation_start = synchronized_time(handle, multi_gpu);
+      sssp_statistics.num_validation_failures += validate_sssp(handle,
+                                                               graph_view,
+                                                               *edge_srcs,
+                                                               *edge_dsts,
+                                                               *edge_wgts,
+                                                               d_sssp_distances,
+                                                               d_predecessors,
+                                                               root);
+      validation_time += synchronized_time(handle, multi_gpu) - validation_start;
+    }
+  }
+  profiler.enable(false);
+
+  if (comm_rank == 0) {
+    std::cout << "SCALE: " << options.scale << std::endl;
+    std::cout << "edgefactor: " << options.edge_factor << std::endl;
+    std::cout << "num_gpus: " << comm_size << std::endl;
+    std::cout << "num_roots: " << roots.size() << std::endl;
+    std::cout << "generation_time: " << generation_time << std::endl;
+    std::cout << "construction_time: " << construction_time << std::endl;
+    print_kernel_statistics("bfs", bfs_statistics);
+    print_kernel_statistics("sssp", sssp_statistics);
+    if (options.validate) { std::cout << "validation_time: " << validation_time << std::endl; }
+    if (options.profile) { print_profile("bfs & sssp"); }
+  }
+
+  return bfs_statistics.num_validation_failures + sssp_statistics.num_validation_failures;
+}
+
+int main(int argc, char** argv)
+{
+  initialize_mpi_and_set_device(argc, argv);
+
+  auto options = parse_options(argc, argv);
+
+  int comm_size{};
+  RAFT_MPI_TRY(MPI_Comm_size(MPI_COMM_WORLD, &comm_size));
+
+  size_t num_validation_failures{0};
+  {
+    auto handle = initialize_handle(comm_size > 1);
+    num_validation_failures = comm_size > 1 ? run_benchmark<true>(*handle, options)
+                                            : run_benchmark<false>(*handle, options);
+  }
+
+  RAFT_MPI_TRY(MPI_Finalize());
+
+  return num_validation_failures == 0 ? 0 : 1;
+}
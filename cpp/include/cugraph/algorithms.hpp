@@ -15,13 +15,14 @@
  */
 #pragma once
 
-#include <cugraph/api_helpers.hpp>
 #include <cugraph/dendrogram.hpp>
+#include <cugraph/edge_partition_edge_type_index.hpp>
 #include <cugraph/edge_property.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/legacy/graph.hpp>
 #include <cugraph/legacy/internals.hpp>
+#include <cugraph/utilities/reduced_precision_weights.hpp>
 
 #include <raft/core/device_span.hpp>
 #include <raft/core/handle.hpp>
@@ -29,6 +30,8 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <array>
+#include <functional>
 #include <optional>
 #include <tuple>
 
@@ -248,6 +251,75 @@ void force_atlas2(raft::handle_t const& handle,
                   bool verbose                                  = false,
                   internals::GraphBasedDimRedCallback* callback = nullptr);
 
+/**
+ * @ingroup layout_cpp
+ * @brief ForceAtlas2 graph layout on the graph_view_t (single-GPU and multi-GPU).
+ *
+ * Attraction forces are computed along the edges and repulsion forces are approximated with
+ * Barnes-Hut over a quadtree covering the bounding box of all the vertices (in multi-GPU, each GPU
+ * inserts its local vertices and the quadtree cell aggregates are reduced over the GPUs). If
+ * @p initialize_positions is true and @p num_coarsening_levels is positive, the graph is
+ * recursively coarsened by collapsing matched vertex pairs and the positions are initialized from
+ * the layout of the coarsened graph; this typically requires far fewer iterations than starting
+ * from random positions.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object of the input graph. The graph should be symmetric.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. Edges have
+ * unit weights if @p edge_weight_view.has_value() is false.
+ * @param x_positions x-axis positions of the local vertices (in/out). Input values are used as
+ * starting positions if @p initialize_positions is false.
+ * @param y_positions y-axis positions of the local vertices (in/out).
+ * @param initialize_positions Flag to initialize the positions (from the coarsened graph layout if
+ * @p num_coarsening_levels is positive, randomly otherwise) instead of using the input positions.
+ * @param max_iterations The maximum number of iterations to run (in each level).
+ * @param num_coarsening_levels The maximum number of coarsening levels used in initialization.
+ * Coarsening stops early if the matching no longer shrinks the graph by at least 10%.
+ * @param outbound_attraction_distribution Distributes attraction along outbound edges. Hubs
+ * attract less and thus are pushed to the borders.
+ * @param lin_log_mode Switch ForceAtlas' model from lin-lin to lin-log. Makes clusters more tight.
+ * @param edge_weight_influence How much influence you give to the edge weights. 0 is "no
+ * influence" and 1 is "normal".
+ * @param jitter_tolerance How much swinging you allow. Above 1 discouraged. Lower gives less speed
+ * and more precision.
+ * @param barnes_hut_theta Tradeoff for speed (larger) vs accuracy (smaller) of the repulsion.
+ * @param scaling_ratio Strictly positive. How much repulsion you want.
+ * @param strong_gravity_mode Sets a force that attracts the vertices that are distant from the
+ * center more.
+ * @param gravity Attracts vertices to the center. Prevents islands from drifting away.
+ * @param verbose Output convergence info at each iteration.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2(raft::handle_t const& handle,
+                  raft::random::RngState& rng_state,
+                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                  raft::device_span<float> x_positions,
+                  raft::device_span<float> y_positions,
+                  bool initialize_positions             = true,
+                  size_t max_iterations                 = 500,
+                  size_t num_coarsening_levels          = 0,
+                  bool outbound_attraction_distribution = true,
+                  bool lin_log_mode                     = false,
+                  float edge_weight_influence           = 1.0,
+                  float jitter_tolerance                = 1.0,
+                  float barnes_hut_theta                = 0.5,
+                  float scaling_ratio                   = 2.0,
+                  bool strong_gravity_mode              = false,
+                  float gravity                         = 1.0,
+                  bool verbose                          = false,
+                  bool do_expensive_check               = false);
+
 /**
  * @ingroup centrality_cpp
  * @brief     Compute betweenness centrality for a graph
@@ -385,6 +457,52 @@ rmm::device_uvector<weight_t> betweenness_centrality(
   bool const include_endpoints  = false,
   bool const do_expensive_check = false);
 
+/**
+ * @ingroup centrality_cpp
+ * @brief     Approximate betweenness centrality with an (epsilon, delta) error bound
+ *
+ * Uniformly random sources are added in rounds (the number of sources doubles every round) until
+ * the absolute error of the normalized betweenness centrality of every vertex is bounded by
+ * @p epsilon with probability at least 1 - @p delta. The stopping test uses the empirical Bernstein
+ * bound on the per-vertex dependencies, so low variance vertex centralities (the common case)
+ * need far fewer sources than the worst case Hoeffding bound. The number of sources is capped at
+ * the Hoeffding bound.
+ *
+ * The current implementation does not support a weighted graph.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. Currently,
+ * edge_weight_view.has_value() should be false as we don't support weighted graphs, yet.
+ * @param epsilon Target absolute error bound of the normalized centralities, in (0, 1).
+ * @param delta Target failure probability, in (0, 1).
+ * @param initial_num_sources Number of sources in the first round (should be larger than 1).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ *
+ * @return tuple of the normalized centralities (normalized as in betweenness_centrality with
+ * normalized = true and include_endpoints = false), the achieved error bound (smaller than or equal
+ * to @p epsilon unless the number of sources hits the cap), and the number of sampled sources.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, weight_t, size_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  weight_t epsilon,
+  weight_t delta,
+  size_t initial_num_sources    = 64,
+  bool const do_expensive_check = false);
+
 /**
  * @ingroup centrality_cpp
  * @brief     Compute edge betweenness centrality for a graph
@@ -427,6 +545,51 @@ edge_betweenness_centrality(
   bool normalized         = true,
   bool do_expensive_check = false);
 
+/**
+ * @ingroup centrality_cpp
+ * @brief Approximate the neighborhood function, harmonic & closeness centralities, and the
+ * effective diameter of a graph with HyperANF.
+ *
+ * Every vertex keeps a HyperLogLog counter of the vertices within distance t (following the
+ * out-going edges), and the counters of the next distance are computed by unioning (register-wise
+ * max) the counters of the out-going neighbors. This requires O(diameter) passes over the edges
+ * and O(2^log2_num_registers) bytes per vertex, and the relative standard error of each counter is
+ * approximately 1.04 / sqrt(2^log2_num_registers).
+ *
+ * [1] Boldi, P. et al., 2011. "HyperANF: Approximating the Neighbourhood Function of Very Large
+ * Graphs on a Budget"
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param log2_num_registers Base 2 logarithm of the number of HyperLogLog registers per vertex,
+ * should be in [4, 16].
+ * @param max_distance Maximum distance to explore (the iteration stops earlier if no counter
+ * changes).
+ * @param effective_diameter_fraction The effective diameter is the (interpolated) smallest
+ * distance within which this fraction of the reachable vertex pairs are connected.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return A tuple of the estimated neighborhood function (the number of vertex pairs within
+ * distance t, for t = 0, 1, ...), the harmonic centralities (the sum of the inverse distances to
+ * the reachable vertices) and the closeness centralities (the number of reachable vertices
+ * excluding the vertex itself divided by the sum of the distances to them) of the local vertices,
+ * and the effective diameter.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<std::vector<double>, rmm::device_uvector<double>, rmm::device_uvector<double>, double>
+hyper_anf(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+          size_t log2_num_registers          = 6,
+          size_t max_distance                = std::numeric_limits<size_t>::max(),
+          double effective_diameter_fraction = 0.9,
+          bool do_expensive_check            = false);
+
 enum class cugraph_cc_t {
   CUGRAPH_STRONG,  ///> Strongly Connected Components
   NUM_CONNECTIVITY_TYPES
@@ -535,6 +698,124 @@ weight_t hungarian(raft::handle_t const& handle,
                    vertex_t* assignments,
                    weight_t epsilon);
 
+/**
+ * @ingroup linear_cpp
+ * @brief Compute a minimum cost assignment of workers to jobs on a sparse bipartite graph using
+ * the auction algorithm with epsilon scaling.
+ *
+ * Edges from a worker to jobs identify the jobs the worker can be assigned to and the edge weights
+ * identify the costs. Unlike hungarian, this does not build a dense cost matrix, so the memory
+ * footprint is proportional to the number of edges. Workers bid for their best jobs (in parallel)
+ * until every worker is assigned; epsilon is reduced by @p epsilon_scaling_factor in every phase
+ * until it reaches @p epsilon. The total cost of the assignment is within (# workers) * @p epsilon
+ * of the optimum (optimal if the costs are integers and @p epsilon is smaller than 1 / # workers).
+ * Workers that cannot be assigned (as there is no feasible assignment covering them) drop out once
+ * their bids exceed a bound; this may take many rounds.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be a signed integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input bipartite graph. Only the outgoing edges of the
+ * workers are used, so the graph can be either directed (worker to job) or symmetric. There should
+ * be no edge between two workers.
+ * @param edge_weight_view View object holding edge weights (costs) for @p graph_view.
+ * @param workers Worker vertices (assigned to this process in multi-GPU; they should be local to
+ * this process). The remaining vertices are jobs.
+ * @param epsilon Final epsilon. If std::nullopt, 1 / (# workers + 1) is used.
+ * @param epsilon_scaling_factor Factor (should be larger than 1) epsilon is divided by in every
+ * phase.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the jobs assigned to @p workers (invalid_vertex_id<vertex_t>::value if a worker
+ * is not assigned) and the total cost of the assignment.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> workers,
+  std::optional<weight_t> epsilon = std::nullopt,
+  weight_t epsilon_scaling_factor = 4.0,
+  bool do_expensive_check         = false);
+
+/**
+ * @brief State of a Louvain or Leiden run after a completed level
+ *
+ * @p clustering maps every local vertex of the input graph to the vertex of the coarsened graph
+ * (the graph contracted by the clustering so far) it belongs to. @p louvain_clustering (Leiden
+ * only) maps every local vertex of the input graph to the Louvain cluster (identified by a vertex
+ * of the coarsened graph) of its refined cluster; this seeds the next level. Coarsened graph
+ * vertex IDs are meaningful only within a run, a resumed run re-derives the coarsened graph from
+ * the input graph and @p clustering.
+ *
+ * In multi-GPU, every GPU holds the state of its local vertices, so the state can be saved and
+ * restored per GPU (with the same GPU partitioning of the input graph).
+ */
+template <typename vertex_t, typename weight_t>
+struct clustering_checkpoint_view_t {
+  size_t num_levels{0};
+  weight_t modularity{0};
+  raft::device_span<vertex_t const> clustering{};
+  std::optional<raft::device_span<vertex_t const>> louvain_clustering{std::nullopt};
+};
+
+/**
+ * @brief Checkpointing options of Louvain and Leiden
+ *
+ * If @p callback is set, it is called (on every GPU) with the current state every @p
+ * level_interval completed levels (a level is complete once the graph is contracted for the next
+ * level). The device spans are valid only until the callback returns, and the callback should copy
+ * them (e.g. to a per-GPU local file) on the handle's stream.
+ */
+template <typename vertex_t, typename weight_t>
+struct clustering_checkpoint_options_t {
+  size_t level_interval{1};
+  std::function<void(clustering_checkpoint_view_t<vertex_t, weight_t> const&)> callback{};
+};
+
+/**
+ * @brief Policies to place the clusters (the vertices of the coarsened graph) on the GPUs when
+ * Louvain and Leiden contract the graph at the end of each level in multi-GPU.
+ */
+enum class cluster_placement_t {
+  hash /* place each cluster on the GPU its cluster ID hashes to (like the input graph vertices) */,
+  majority /* place each cluster on the GPU holding the most of its members, so clusters whose
+              members are local stay on the same GPU */
+};
+
+/**
+ * @ingroup community_cpp
+ * @brief Set the cluster placement policy Louvain and Leiden use in the calls using @p handle.
+ *
+ * With cluster_placement_t::hash, most clusters move to another GPU at every level (the GPU a
+ * cluster ID hashes to is unrelated to the GPUs holding its members). With
+ * cluster_placement_t::majority, the clusters are relabeled before the graph contraction so that
+ * every cluster ID hashes to the GPU holding the most of its members. This costs a few shuffles
+ * of one value per (cluster, GPU) pair, but reduces the all-to-all volume of the graph contraction
+ * (the vertex data of the coarsened graph mostly stays local), especially in the deeper levels
+ * where most clusters have all their members on one GPU. The number of vertices per GPU then
+ * follows the number of clusters formed on each GPU. Cluster IDs break ties in the cluster moves,
+ * so the clustering may slightly differ from the clustering with cluster_placement_t::hash. Set
+ * the same policy on every GPU. This has no effect in single-GPU.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param placement Cluster placement policy (cluster_placement_t::hash by default).
+ */
+void set_cluster_placement_hint(raft::handle_t const& handle, cluster_placement_t placement);
+
+/**
+ * @brief Get the cluster placement policy set by set_cluster_placement_hint
+ * (cluster_placement_t::hash if not set).
+ */
+cluster_placement_t get_cluster_placement_hint(raft::handle_t const& handle);
+
 /**
  * @ingroup community_cpp
  * @brief      Louvain implementation
@@ -568,6 +849,9 @@ weight_t hungarian(raft::handle_t const& handle,
  *                               of the communities.  Higher resolutions lead to more smaller
  *                               communities, lower resolutions lead to fewer larger
  *                               communities. (default 1)
+ * @param[in]  prune_inactive_vertices (optional) If true, only the vertices with a neighbor that
+ *                               changed clusters in the previous iteration (or that could not move
+ *                               yet) are re-evaluated. (default false)
  *
  * @return                       a pair containing:
  *                                 1) number of levels of the returned clustering
@@ -581,9 +865,112 @@ std::pair<size_t, weight_t> louvain(
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   vertex_t* clustering,
-  size_t max_level    = 100,
-  weight_t threshold  = weight_t{1e-7},
-  weight_t resolution = weight_t{1});
+  size_t max_level             = 100,
+  weight_t threshold           = weight_t{1e-7},
+  weight_t resolution          = weight_t{1},
+  bool prune_inactive_vertices = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief      Louvain implementation with checkpointing
+ *
+ * Same as the above Louvain function except that the state after every
+ * @p checkpoint_options.level_interval completed levels is passed to
+ * @p checkpoint_options.callback (see clustering_checkpoint_options_t), and that the run can be
+ * resumed from a previously checkpointed state. A resumed run continues from the checkpointed
+ * level (the levels in the checkpoint count towards @p max_level) and is equivalent to the
+ * original run up to the relabeling of the coarsened graph vertices (the random cluster
+ * assignments drawn from @p rng_state differ).
+ *
+ * @throws cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param[in]  handle            Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state.
+ * @param[in]  graph_view        Input graph view object.
+ * @param[in]  edge_weight_view  Optional view object holding edge weights for @p graph_view.
+ * @param[out] clustering        Pointer to device array where the clustering should be stored
+ * @param[in]  max_level         maximum number of levels to run
+ * @param[in]  threshold         threshold for convergence at each level
+ * @param[in]  resolution        The value of the resolution parameter to use.
+ * @param[in]  prune_inactive_vertices If true, only the vertices with a neighbor that changed
+ *                               clusters in the previous iteration are re-evaluated.
+ * @param[in]  checkpoint_options Checkpointing options.
+ * @param[in]  resume_state      Optional state (checkpointed by a run on the same graph with the
+ *                               same GPU partitioning) to resume from.
+ *
+ * @return                       a pair containing:
+ *                                 1) number of levels of the returned clustering (including the
+ *                                    levels in @p resume_state)
+ *                                 2) modularity of the returned clustering
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> louvain(
+  raft::handle_t const& handle,
+  std::optional<std::reference_wrapper<raft::random::RngState>> rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t threshold,
+  weight_t resolution,
+  bool prune_inactive_vertices,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options,
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state);
+
+/**
+ * @ingroup community_cpp
+ * @brief      Louvain implementation with an initial clustering (warm start)
+ *
+ * Same as the above Louvain function except that the first level starts from
+ * @p initial_clustering instead of singleton clusters (and @p rng_state is not used in the first
+ * level). This is useful to re-cluster a graph after a small update starting from the previous
+ * result.
+ *
+ * @throws cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param[in]  handle            Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state.
+ * @param[in]  graph_view        Input graph view object.
+ * @param[in]  edge_weight_view  Optional view object holding edge weights for @p graph_view.
+ * @param[in]  initial_clustering Initial cluster IDs of the local vertices. Cluster IDs can be any
+ *                               vertex_t values (they do not need to be vertex IDs of
+ *                               @p graph_view), vertices with invalid_vertex_id<vertex_t>::value
+ *                               start in singleton clusters.
+ * @param[out] clustering        Pointer to device array where the clustering should be stored
+ * @param[in]  max_level         (optional) maximum number of levels to run (default 100)
+ * @param[in]  threshold         (optional) threshold for convergence at each level (default 1e-7)
+ * @param[in]  resolution        (optional) The value of the resolution parameter to use.
+ *                               (default 1)
+ * @param[in]  prune_inactive_vertices (optional) If true, only the vertices with a neighbor that
+ *                               changed clusters in the previous iteration are re-evaluated.
+ *                               (default false)
+ *
+ * @return                       a pair containing:
+ *                                 1) number of levels of the returned clustering
+ *                                 2) modularity of the returned clustering
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> louvain(
+  raft::handle_t const& handle,
+  std::optional<std::reference_wrapper<raft::random::RngState>> rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> initial_clustering,
+  vertex_t* clustering,
+  size_t max_level             = 100,
+  weight_t threshold           = weight_t{1e-7},
+  weight_t resolution          = weight_t{1},
+  bool prune_inactive_vertices = false);
 
 /**
  * @ingroup community_cpp
@@ -591,6 +978,11 @@ std::pair<size_t, weight_t> louvain(
  *
  * Compute a clustering of the graph by maximizing modularity
  *
+ * Every level of the returned dendrogram stays in device memory until it is returned, as the
+ * caller may flatten the dendrogram at any level (so the levels cannot be folded into a single
+ * clustering as they complete). Use the overload writing a flat clustering if only the final
+ * clustering is needed; it keeps only the current level alive.
+ *
  * Computed using the Louvain method described in:
  *
  *    VD Blondel, J-L Guillaume, R Lambiotte and E Lefebvre: Fast unfolding of
@@ -617,6 +1009,9 @@ std::pair<size_t, weight_t> louvain(
  *                               of the communities.  Higher resolutions lead to more smaller
  *                               communities, lower resolutions lead to fewer larger
  *                               communities. (default 1)
+ * @param[in]  prune_inactive_vertices (optional) If true, only the vertices with a neighbor that
+ *                               changed clusters in the previous iteration (or that could not move
+ *                               yet) are re-evaluated. (default false)
  * @return                       a pair containing:
  *                                 1) unique pointer to dendrogram
  *                                 2) modularity of the returned clustering
@@ -628,9 +1023,10 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   std::optional<std::reference_wrapper<raft::random::RngState>> rng_state,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-  size_t max_level    = 100,
-  weight_t threshold  = weight_t{1e-7},
-  weight_t resolution = weight_t{1});
+  size_t max_level             = 100,
+  weight_t threshold           = weight_t{1e-7},
+  weight_t resolution          = weight_t{1},
+  bool prune_inactive_vertices = false);
 
 /**
  * @ingroup community_cpp
@@ -657,6 +1053,19 @@ void flatten_dendrogram(raft::handle_t const& handle,
                         Dendrogram<typename graph_view_t::vertex_type> const& dendrogram,
                         typename graph_view_t::vertex_type* clustering);
 
+/**
+ * @brief Leiden refinement method
+ *
+ * maximal_independent_moves moves, in every refinement round, a maximal independent set of the
+ * vertices with a positive gain move (independent in the graph of the moves, rebuilt every round).
+ * color_classes colors the subgraph of the edges within the Louvain clusters once and, in every
+ * round, moves all the vertices with a positive gain move in the next color class (no two of them
+ * are adjacent, so their moves never conflict). This typically takes fewer rounds and skips
+ * building the graph of the moves in every round. Both methods only merge singleton vertices into
+ * well-connected refined clusters, so the refined clusters keep the same guarantees.
+ */
+enum class leiden_refinement_method_t { maximal_independent_moves, color_classes };
+
 /**
  * @ingroup community_cpp
  * @brief      Leiden implementation
@@ -694,6 +1103,9 @@ void flatten_dendrogram(raft::handle_t const& handle,
  *                                    gain in Leiden refinement phase. It is used to compute
  *                                    the probability of joining a random leiden community.
  *                                    Called theta in the Leiden algorithm.
+ * @param[in]  prune_inactive_vertices (optional) If true, only the vertices with a neighbor that
+ *                                    changed clusters in the previous iteration (or that could not
+ *                                    move yet) are re-evaluated. (default false)
  *
  * @return                           a pair containing:
  *                                     1) unique pointer to dendrogram
@@ -706,9 +1118,10 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
   raft::random::RngState& rng_state,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-  size_t max_level    = 100,
-  weight_t resolution = weight_t{1},
-  weight_t theta      = weight_t{1});
+  size_t max_level             = 100,
+  weight_t resolution          = weight_t{1},
+  weight_t theta               = weight_t{1},
+  bool prune_inactive_vertices = false);
 
 /**
 .* @ingroup community_cpp
@@ -747,6 +1160,9 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
  *                                    gain in Leiden refinement phase. It is used to compute
  *                                    the probability of joining a random leiden community.
  *                                    Called theta in the Leiden algorithm.
+ * @param[in]  prune_inactive_vertices (optional) If true, only the vertices with a neighbor that
+ *                                    changed clusters in the previous iteration (or that could not
+ *                                    move yet) are re-evaluated. (default false)
  * communities. (default 1)
  *
  * @return                           a pair containing:
@@ -760,87 +1176,418 @@ std::pair<size_t, weight_t> leiden(
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   vertex_t* clustering,  // FIXME: Use (device_)span instead
-  size_t max_level    = 100,
-  weight_t resolution = weight_t{1},
-  weight_t theta      = weight_t{1});
+  size_t max_level             = 100,
+  weight_t resolution          = weight_t{1},
+  weight_t theta               = weight_t{1},
+  bool prune_inactive_vertices = false);
 
 /**
-.* @ingroup community_cpp
- * @brief Computes the ecg clustering of the given graph.
- *
- * ECG runs truncated Louvain on an ensemble of permutations of the input graph,
- * then uses the ensemble partitions to determine weights for the input graph.
- * The final result is found by running full Louvain on the input graph using
- * the determined weights. See https://arxiv.org/abs/1809.05578 for further
- * information.
+ * @ingroup community_cpp
+ * @brief      Leiden implementation with checkpointing
  *
- * @throws     cugraph::logic_error when an error occurs.
+ * Same as the above Leiden function except that the state after every
+ * @p checkpoint_options.level_interval completed levels is passed to
+ * @p checkpoint_options.callback (see clustering_checkpoint_options_t), and that the run can be
+ * resumed from a previously checkpointed state. A resumed run continues from the checkpointed
+ * level (the levels in the checkpoint count towards @p max_level) and is equivalent to the
+ * original run up to the relabeling of the coarsened graph vertices (the random numbers drawn from
+ * @p rng_state in the refinement phase differ).
  *
- * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
- * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
- * @tparam weight_t Type of edge weights. Needs to be a floating point type.
- * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @throws cugraph::logic_error when an error occurs.
  *
- * @param[in]  handle            Library handle (RAFT). If a communicator is set in the handle,
- * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state.
- * @param[in]  graph_view        Input graph view object
- * @param[in]  edge_weight_view  View object holding edge weights for @p graph_view.
- * @param[in]  min_weight        Minimum edge weight to use in the final call of the clustering
- *                               algorithm if an edge does not appear in any of the ensemble runs.
- * @param[in]  ensemble_size     The ensemble size parameter
- * @param[in]  max_level         (optional) maximum number of levels to run (default 100)
- * @param[in]  threshold         (optional) threshold for convergence at each level (default 1e-7)
- * @param[in]  resolution        (optional) The value of the resolution parameter to use.
- *                               Called gamma in the modularity formula, this changes the size
- *                               of the communities.  Higher resolutions lead to more smaller
- *                               communities, lower resolutions lead to fewer larger
- *                               communities. (default 1)
+ * @tparam vertex_t                  Type of vertex identifiers.
+ * @tparam edge_t                    Type of edge identifiers.
+ * @tparam weight_t                  Type of edge weights. Supported values : float or double.
  *
- * @return                       a tuple containing:
- *                                 1) Device vector containing clustering result
- *                                 2) number of levels of the returned clustering
- *                                 3) modularity of the returned clustering
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param clustering Pointer to device array where the clustering should be stored.
+ * @param max_level Maximum number of levels to run.
+ * @param resolution The value of the resolution parameter to use.
+ * @param theta The value of the parameter to scale modularity gain in Leiden refinement phase.
+ * @param prune_inactive_vertices If true, only the vertices with a neighbor that changed clusters
+ * in the previous iteration are re-evaluated.
+ * @param checkpoint_options Checkpointing options.
+ * @param resume_state Optional state (checkpointed by a Leiden run on the same graph with the same
+ * GPU partitioning, louvain_clustering should be set) to resume from.
  *
+ * @return                           a pair containing:
+ *                                     1) number of levels of the returned clustering (including
+ *                                        the levels in @p resume_state)
+ *                                     2) modularity of the returned clustering
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-std::tuple<rmm::device_uvector<vertex_t>, size_t, weight_t> ecg(
+std::pair<size_t, weight_t> leiden(
   raft::handle_t const& handle,
   raft::random::RngState& rng_state,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-  weight_t min_weight,
-  size_t ensemble_size,
-  size_t max_level    = 100,
-  weight_t threshold  = weight_t{1e-7},
-  weight_t resolution = weight_t{1});
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t resolution,
+  weight_t theta,
+  bool prune_inactive_vertices,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options,
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state);
 
 /**
- * @ingroup tree_cpp
- * @brief Generate edges in a minimum spanning forest of an undirected weighted graph.
+ * @ingroup community_cpp
+ * @brief      Leiden implementation with an initial clustering (warm start)
  *
- * A minimum spanning tree is a subgraph of the graph (a tree) with the minimum sum of edge weights.
- * A spanning forest is a union of the spanning trees for each connected component of the graph.
- * If the graph is connected it returns the minimum spanning tree.
+ * Same as the above Leiden function except that the Louvain phase of the first level starts from
+ * @p initial_clustering instead of singleton clusters.
  *
- * @throws     cugraph::logic_error when an error occurs.
+ * @throws cugraph::logic_error when an error occurs.
  *
- * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
- * 32-bit)
- * @tparam edge_t                    Type of edge identifiers.  Supported value : int (signed,
- * 32-bit)
+ * @tparam vertex_t                  Type of vertex identifiers.
+ * @tparam edge_t                    Type of edge identifiers.
  * @tparam weight_t                  Type of edge weights. Supported values : float or double.
  *
- * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
- * @param[in]  graph_csr             input graph object (CSR) expected to be symmetric
- * @param[in]  mr                    Memory resource used to allocate the returned graph
- * @return out_graph             Unique pointer to MSF subgraph in COO format
- */
-template <typename vertex_t, typename edge_t, typename weight_t>
-std::unique_ptr<legacy::GraphCOO<vertex_t, edge_t, weight_t>> minimum_spanning_tree(
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param initial_clustering Initial cluster IDs of the local vertices. Cluster IDs can be any
+ * vertex_t values, vertices with invalid_vertex_id<vertex_t>::value start in singleton clusters.
+ * @param clustering Pointer to device array where the clustering should be stored.
+ * @param max_level (optional) Maximum number of levels to run (default 100).
+ * @param resolution (optional) The value of the resolution parameter to use (default 1).
+ * @param theta (optional) The value of the parameter to scale modularity gain in Leiden refinement
+ * phase (default 1).
+ * @param prune_inactive_vertices (optional) If true, only the vertices with a neighbor that changed
+ * clusters in the previous iteration are re-evaluated (default false).
+ *
+ * @return                           a pair containing:
+ *                                     1) number of levels of the returned clustering
+ *                                     2) modularity of the returned clustering
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> leiden(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> initial_clustering,
+  vertex_t* clustering,
+  size_t max_level             = 100,
+  weight_t resolution          = weight_t{1},
+  weight_t theta               = weight_t{1},
+  bool prune_inactive_vertices = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief      Leiden implementation with a refinement method
+ *
+ * Same as the above Leiden function (without an initial clustering) except that the refinement
+ * phase uses @p refinement_method (see leiden_refinement_method_t).
+ *
+ * @throws cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t                  Type of vertex identifiers.
+ * @tparam edge_t                    Type of edge identifiers.
+ * @tparam weight_t                  Type of edge weights. Supported values : float or double.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object (should be symmetric if @p refinement_method is
+ * color_classes).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param clustering Pointer to device array where the clustering should be stored.
+ * @param max_level Maximum number of levels to run.
+ * @param resolution The value of the resolution parameter to use.
+ * @param theta The value of the parameter to scale modularity gain in Leiden refinement phase.
+ * @param prune_inactive_vertices If true, only the vertices with a neighbor that changed clusters
+ * in the previous iteration are re-evaluated.
+ * @param refinement_method The refinement method.
+ *
+ * @return                           a pair containing:
+ *                                     1) number of levels of the returned clustering
+ *                                     2) modularity of the returned clustering
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> leiden(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t resolution,
+  weight_t theta,
+  bool prune_inactive_vertices,
+  leiden_refinement_method_t refinement_method);
+
+/**
+.* @ingroup community_cpp
+ * @brief Computes the ecg clustering of the given graph.
+ *
+ * ECG runs truncated Louvain on an ensemble of permutations of the input graph,
+ * then uses the ensemble partitions to determine weights for the input graph.
+ * The final result is found by running full Louvain on the input graph using
+ * the determined weights. See https://arxiv.org/abs/1809.05578 for further
+ * information.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param[in]  handle            Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state.
+ * @param[in]  graph_view        Input graph view object
+ * @param[in]  edge_weight_view  View object holding edge weights for @p graph_view.
+ * @param[in]  min_weight        Minimum edge weight to use in the final call of the clustering
+ *                               algorithm if an edge does not appear in any of the ensemble runs.
+ * @param[in]  ensemble_size     The ensemble size parameter
+ * @param[in]  max_level         (optional) maximum number of levels to run (default 100)
+ * @param[in]  threshold         (optional) threshold for convergence at each level (default 1e-7)
+ * @param[in]  resolution        (optional) The value of the resolution parameter to use.
+ *                               Called gamma in the modularity formula, this changes the size
+ *                               of the communities.  Higher resolutions lead to more smaller
+ *                               communities, lower resolutions lead to fewer larger
+ *                               communities. (default 1)
+ *
+ * @return                       a tuple containing:
+ *                                 1) Device vector containing clustering result
+ *                                 2) number of levels of the returned clustering
+ *                                 3) modularity of the returned clustering
+ *
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, size_t, weight_t> ecg(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  weight_t min_weight,
+  size_t ensemble_size,
+  size_t max_level    = 100,
+  weight_t threshold  = weight_t{1e-7},
+  weight_t resolution = weight_t{1});
+
+/**
+ * @ingroup community_cpp
+ * @brief Computes the label propagation clustering of the given graph.
+ *
+ * Every vertex repeatedly adopts the label with the largest sum of the (incident) edge weights
+ * among its neighbors' labels till no vertex changes its label. Ties are broken in favor of the
+ * vertex's current label, then the label with fewer vertices, then at random. Only the vertices
+ * with a neighbor that changed its label in the previous update are re-evaluated. In the
+ * synchronous mode, all the vertices are updated at once (this may oscillate in bipartite-like
+ * substructures), in the semi-synchronous mode, the vertices are colored (no two neighbors share a
+ * color) and the color classes are updated one after another using the labels of the previously
+ * updated classes. See https://arxiv.org/abs/0709.2938 and https://arxiv.org/abs/1103.4550 for
+ * further information.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param[in]  handle            RAFT handle object to encapsulate resources (e.g. CUDA stream,
+ *                               communicator, and handles to various CUDA libraries) to run graph
+ *                               algorithms.
+ * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state.
+ * @param[in]  graph_view        Input graph view object (should be symmetric).
+ * @param[in]  edge_weight_view  View object holding edge weights for @p graph_view. If
+ *                               std::nullopt, every edge has weight 1.
+ * @param[in,out] labels         Device span of the (local) vertex labels. Read as the initial
+ *                               labels if @p warm_start is true (e.g. the labels of a previous
+ *                               run on a slightly different graph, invalid_vertex_id should not
+ *                               appear), every vertex starts with its own vertex ID as its label
+ *                               otherwise. Stores the final labels on return.
+ * @param[in]  warm_start        Flag to start from the labels in @p labels.
+ * @param[in]  semi_synchronous  Flag to update the vertices one color class at a time (if true)
+ *                               or all at once (if false).
+ * @param[in]  max_iterations    (optional) Maximum number of sweeps over the active vertices
+ *                               (default 100).
+ * @param[in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ *                               `true`).
+ *
+ * @return                       Number of sweeps performed.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t> labels,
+  bool warm_start         = false,
+  bool semi_synchronous   = false,
+  size_t max_iterations   = 100,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief Spectral clustering (balanced cut) of the given graph.
+ *
+ * The vertices are embedded with the eigenvectors of the @p num_eigenvectors smallest eigenvalues
+ * of the normalized Laplacian L = I - D^{-1/2} A D^{-1/2} (rows normalized to unit length, Ng,
+ * Jordan & Weiss), and the embedding is clustered with k-means (k-means++ seeding). The Laplacian
+ * is applied implicitly over @p graph_view and the eigenvectors are computed with a (restarted,
+ * deflated) Lanczos method, so the graph is never copied and both the eigensolver and k-means run
+ * on the local vertex partitions in multi-GPU. This is the graph_view_t counterpart of
+ * ext_raft::balancedCutClustering.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param[in]  handle            RAFT handle object to encapsulate resources (e.g. CUDA stream,
+ * communicator, and handles to various CUDA libraries) to run graph algorithms.
+ * @param[in]  rng_state         The RngState instance holding pseudo-random number generator state
+ *                               (for the eigensolver starting vectors and k-means seeding).
+ * @param[in]  graph_view        Graph view object of the input graph, should be symmetric.
+ * @param[in]  edge_weight_view  Optional view object holding (non-negative) edge weights for
+ *                               @p graph_view. If @p edge_weight_view.has_value() == false, edge
+ *                               weights are assumed to be 1.0.
+ * @param[in]  num_clusters      The desired number of clusters.
+ * @param[in]  num_eigenvectors  The number of eigenvectors to embed the vertices with.
+ * @param[in]  eigenvalue_tolerance  Relative residual tolerance of the eigensolver.
+ * @param[in]  max_eigensolver_operator_applications  Maximum number of Laplacian applications
+ *                               (over all eigenvectors), the eigenvectors computed so far are used
+ *                               if this budget runs out.
+ * @param[in]  kmeans_tolerance  k-means stops once the relative decrease of the sum of squared
+ *                               distances to the centroids is at most this value.
+ * @param[in]  max_kmeans_iterations  Maximum number of k-means iterations.
+ * @param[in]  do_expensive_check  A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @return Device vector of the cluster IDs (in [0, @p num_clusters)) of the vertices in the local
+ * vertex partition.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> spectral_clustering(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t eigenvalue_tolerance                = weight_t{1e-5},
+  size_t max_eigensolver_operator_applications = 4000,
+  weight_t kmeans_tolerance                    = weight_t{1e-4},
+  size_t max_kmeans_iterations                 = 200,
+  bool do_expensive_check                      = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief Balanced k-way graph partitioning (multilevel, METIS-like).
+ *
+ * The graph is coarsened by repeated heavy-edge matching (approximate_weighted_matching, only the
+ * edges whose endpoints are light enough to be merged take part) and contraction (coarsen_graph)
+ * till it has a few tens of vertices per partition or stops shrinking. The coarsest graph is
+ * partitioned by greedy graph growing, and the partitioning is projected back level by level,
+ * refined on every level by label-propagation-style boundary moves that never push a partition over
+ * the balance limit (and move vertices out of overweight partitions). Vertex weights are the number
+ * of input vertices a (coarse) vertex represents, so the balance constraint bounds the number of
+ * vertices per partition by ceil((1 + @p imbalance_tolerance) * V / @p num_partitions).
+ *
+ * The partition IDs can serve as a vertex-to-GPU mapping (with @p num_partitions set to the number
+ * of GPUs) to re-distribute and renumber the graph so that fewer edges cross GPU boundaries.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param[in]  handle            RAFT handle object to encapsulate resources (e.g. CUDA stream,
+ * communicator, and handles to various CUDA libraries) to run graph algorithms.
+ * @param[in]  graph_view        Graph view object of the input graph, should be symmetric.
+ * @param[in]  edge_weight_view  Optional view object holding (non-negative) edge weights for
+ *                               @p graph_view. If @p edge_weight_view.has_value() == false, edge
+ *                               weights are assumed to be 1.0.
+ * @param[in]  num_partitions    The number of partitions.
+ * @param[in]  imbalance_tolerance  Allowed relative excess of a partition's vertex count over the
+ *                               average (default 0.03).
+ * @param[in]  max_refinement_iterations  Maximum number of refinement steps per level.
+ * @param[in]  do_expensive_check  A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @return Tuple of the partition IDs (in [0, @p num_partitions)) of the vertices in the local
+ * vertex partition and the edge cut (the total weight of the edges between different partitions).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> multilevel_partition(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_partitions,
+  double imbalance_tolerance       = 0.03,
+  size_t max_refinement_iterations = 20,
+  bool do_expensive_check          = false);
+
+/**
+ * @ingroup tree_cpp
+ * @brief Generate edges in a minimum spanning forest of an undirected weighted graph.
+ *
+ * A minimum spanning tree is a subgraph of the graph (a tree) with the minimum sum of edge weights.
+ * A spanning forest is a union of the spanning trees for each connected component of the graph.
+ * If the graph is connected it returns the minimum spanning tree.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
+ * 32-bit)
+ * @tparam edge_t                    Type of edge identifiers.  Supported value : int (signed,
+ * 32-bit)
+ * @tparam weight_t                  Type of edge weights. Supported values : float or double.
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph_csr             input graph object (CSR) expected to be symmetric
+ * @param[in]  mr                    Memory resource used to allocate the returned graph
+ * @return out_graph             Unique pointer to MSF subgraph in COO format
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::unique_ptr<legacy::GraphCOO<vertex_t, edge_t, weight_t>> minimum_spanning_tree(
   raft::handle_t const& handle,
   legacy::GraphCSRView<vertex_t, edge_t, weight_t> const& graph,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @ingroup tree_cpp
+ * @brief Find the edges of a minimum spanning forest of an undirected weighted graph.
+ *
+ * This function runs Borůvka's algorithm: in every round, each component selects its minimum
+ * weight outgoing edge (ties are broken by the edge end points), and the components linked by the
+ * selected edges are merged. This supports both single-GPU and multi-GPU graphs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph. The graph should be symmetric.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the source vertex IDs, destination vertex IDs, and weights of the minimum
+ * spanning forest edges. Each undirected edge is returned once (with the source vertex ID smaller
+ * than the destination vertex ID). In multi-GPU, the edges are distributed over the GPUs.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                        bool do_expensive_check = false);
+
 namespace subgraph {
 /**
 .* @ingroup utility_cpp
@@ -1114,14 +1861,53 @@ void bfs(raft::handle_t const& handle,
          vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
          bool do_expensive_check   = false);
 
+/**
+ * @brief Direction optimizing breadth-first search options.
+ *
+ * Breadth-first search switches from push (top-down) to pull (bottom-up) if m_f * alpha > m_u
+ * (m_f: the number of edges to check from the frontier, m_u: the number of edges to check from
+ * the unvisited vertices) and the frontier is growing, and switches back to push if
+ * n_f * beta < n_u (n_f: the frontier size, n_u: the number of unvisited vertices) and the
+ * frontier is shrinking (S. Beamer, K. Asanovic, D. Patterson, Direction-Optimizing Breadth-First
+ * Search, 2012).
+ */
+struct bfs_options_t {
+  /**
+   * If true, switch between push and pull based breadth-first search depending on the frontier
+   * size. Valid only for symmetric input graphs; the remaining options are ignored if false.
+   * Default is false.
+   */
+  bool direction_optimizing{false};
+
+  /**
+   * Push to pull switch threshold. Default (std::nullopt) is the average vertex degree / 3.75.
+   */
+  std::optional<double> alpha{std::nullopt};
+
+  /**
+   * Pull to push switch threshold. Default (std::nullopt) is 24.
+   */
+  std::optional<double> beta{std::nullopt};
+
+  /**
+   * If true, alpha and beta (starting from the values above) are re-computed from the measured
+   * per-edge cost of the push and pull steps in the first few iterations. Default is false.
+   */
+  bool auto_tune{false};
+
+  /**
+   * Maximum number of push iterations to sample in auto-tuning. Default is 4.
+   */
+  size_t auto_tune_levels{4};
+};
+
 /**
  * @ingroup traversal_cpp
- * @brief Extract paths from breadth-first search output
+ * @brief Run breadth-first search to find the distances (and predecessors) from the source
+ * vertex.
  *
- * This function extracts paths from the BFS output.  BFS outputs distances
- * and predecessors.  The path from a vertex v back to the original source vertex
- * can be extracted by recursively looking up the predecessor vertex until you arrive
- * back at the original source vertex.
+ * Identical to the above overload except that the direction optimizing behavior is configured
+ * through @p options.
  *
  * @throws cugraph::logic_error on erroneous input arguments.
  *
@@ -1132,57 +1918,275 @@ void bfs(raft::handle_t const& handle,
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
- * @param distances Pointer to the distance array constructed by bfs.
- * @param predecessors Pointer to the predecessor array constructed by bfs.
- * @param destinations Destination vertices, extract path from source to each of these destinations
- * In a multi-gpu context the destination vertex should be local to this GPU.
- * @param n_destinations number of destinations (one source per component at most).
- *
- * @return std::tuple<rmm::device_uvector<vertex_t>, vertex_t> pair containing
- *       the paths as a dense matrix in the vector and the maximum path length.
- *       Unused elements in the paths will be set to invalid_vertex_id (-1 for a signed
- *       vertex_t, std::numeric_limits<vertex_t>::max() for an unsigned vertex_t type).
+ * @param distances Pointer to the output distance array.
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param sources Source vertices to start breadth-first search (root vertex of the breath-first
+ * search tree). If more than one source is passed, there must be a single source per component.
+ * In a multi-gpu context the source vertices should be local to this GPU.
+ * @param n_sources number of sources (one source per component at most).
+ * @param options Direction optimizing options (see bfs_options_t).
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from @p source_vertex will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
-std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
-  raft::handle_t const& handle,
-  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-  vertex_t const* distances,
-  vertex_t const* predecessors,
-  vertex_t const* destinations,
-  size_t n_destinations);
+void bfs(raft::handle_t const& handle,
+         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+         vertex_t* distances,
+         vertex_t* predecessors,
+         vertex_t const* sources,
+         size_t n_sources,
+         bfs_options_t const& options,
+         vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+         bool do_expensive_check = false);
 
 /**
  * @ingroup traversal_cpp
- * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
- * the source vertex.
+ * @brief Run breadth-first search and return only the vertices reached within the depth limit.
  *
- * This function computes the distances (minimum edge weight sums) from the source vertex. If @p
- * predecessors is not `nullptr`, this function calculates the predecessor of each vertex in the
- * shortest-path as well. Graph edge weights should be non-negative.
+ * This function is similar to the bfs function above, but avoids allocating (and initializing)
+ * the O(V) distance and predecessor arrays. Visited vertices are tracked in a hash map and the work
+ * in each iteration is proportional to the out-going edges of the current frontier. This is faster
+ * than bfs if @p depth_limit limits the search to a small fraction of the graph. Unlike bfs, there
+ * is no restriction on the number of sources per component.
  *
  * @throws cugraph::logic_error on erroneous input arguments.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
- * @tparam weight_t Type of edge weights. Needs to be a floating point type.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
- * @param edge_weight_view View object holding edge weights for @p graph_view.
- * @param distances Pointer to the output distance array.
- * @param predecessors Pointer to the output predecessor array or `nullptr`.
- * @param source_vertex Source vertex to start single-source shortest-path.
- * In a multi-gpu context the source vertex should be local to this GPU.
- * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
- * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param sources Source vertices to start breadth-first search. In a multi-gpu context the source
+ * vertices should be local to this GPU.
+ * @param compute_predecessors Flag to return the predecessors as well.
+ * @param depth_limit Sets the maximum number of breadth-first search iterations.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the reached vertices (local to this GPU, sorted in ascending order), their
+ * distances (number of hops from the nearest source), and optional predecessors
+ * (invalid_vertex_id<vertex_t>::value for the sources).
  */
-template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-void sssp(raft::handle_t const& handle,
-          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+sparse_bfs(raft::handle_t const& handle,
+           graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+           raft::device_span<vertex_t const> sources,
+           bool compute_predecessors = false,
+           vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
+           bool do_expensive_check   = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Run independent breadth-first searches from multiple sources concurrently.
+ *
+ * Sources are processed in batches of 64; a batch shares a single edge scan per iteration (each
+ * vertex holds a 64 bit frontier word with one bit per source in the batch), so K sources need
+ * about K/64 traversals instead of K.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Source vertices (duplicates are allowed, each source runs an independent
+ * breadth-first search). In a multi-gpu context, @p sources should be identical in every GPU.
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from a source will be marked as unreachable from the source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the source indices (i for sources[i]), vertices, and distances of the reached
+ * (source, vertex) pairs (unreachable pairs are omitted, so the output size is proportional to the
+ * number of reached pairs instead of @p sources.size() x the number of vertices). The triplets are
+ * not sorted. In a multi-gpu context, only the vertices in the local vertex partition range are
+ * returned.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+multi_source_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Compute the exact eccentricity (the largest distance to a reachable vertex) of every
+ * vertex.
+ *
+ * Lower and upper eccentricity bounds are maintained for every vertex and tightened by
+ * breadth-first searches from the vertices with the largest upper bounds and the smallest lower
+ * bounds (64 sources per multi-source BFS sweep), a vertex is resolved once its bounds meet. This
+ * typically requires far fewer breadth-first searches than the number of vertices.
+ *
+ * [1] Takes, F. W. & Kosters, W. A., 2013. "Computing the Eccentricity Distribution of Large
+ * Graphs"
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, should be symmetric.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Eccentricities of the local vertices (distances are measured within each connected
+ * component, an isolated vertex has eccentricity 0).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Compute the exact diameter (the largest eccentricity over the connected components).
+ *
+ * Uses the same eccentricity bounding as eccentricity() but stops as soon as no unresolved vertex
+ * can have an eccentricity larger than the largest lower bound.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, should be symmetric.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return The diameter.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+vertex_t diameter(raft::handle_t const& handle,
+                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Extract paths from breadth-first search output
+ *
+ * This function extracts paths from the BFS output.  BFS outputs distances
+ * and predecessors.  The path from a vertex v back to the original source vertex
+ * can be extracted by recursively looking up the predecessor vertex until you arrive
+ * back at the original source vertex.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the distance array constructed by bfs.
+ * @param predecessors Pointer to the predecessor array constructed by bfs.
+ * @param destinations Destination vertices, extract path from source to each of these destinations
+ * In a multi-gpu context the destination vertex should be local to this GPU.
+ * @param n_destinations number of destinations (one source per component at most).
+ *
+ * @return std::tuple<rmm::device_uvector<vertex_t>, vertex_t> pair containing
+ *       the paths as a dense matrix in the vector and the maximum path length.
+ *       Unused elements in the paths will be set to invalid_vertex_id (-1 for a signed
+ *       vertex_t, std::numeric_limits<vertex_t>::max() for an unsigned vertex_t type).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  vertex_t const* distances,
+  vertex_t const* predecessors,
+  vertex_t const* destinations,
+  size_t n_destinations);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Extract paths from breadth-first search output using pointer jumping
+ *
+ * This function returns the same paths as the function above, but walks the predecessors by
+ * pointer jumping (doubling): each round doubles the number of hops covered from the destinations.
+ * This finishes in O(log(maximum path length)) rounds (each round requires a single collective
+ * communication step in multi-GPU) instead of one round per hop, at the cost of updating an
+ * ancestor table for every local vertex in each round. This is faster than the function above
+ * for deep breadth-first search trees, especially in multi-GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the distance array constructed by bfs.
+ * @param predecessors Pointer to the predecessor array constructed by bfs.
+ * @param destinations Destination vertices, extract path from source to each of these destinations
+ * In a multi-gpu context the destination vertex should be local to this GPU.
+ * @param n_destinations number of destinations (one source per component at most).
+ * @param max_destinations_per_batch Optional maximum number of (local) destinations to process at a
+ * time, this bounds the temporary memory used in each round (all the destinations if
+ * std::nullopt).
+ *
+ * @return std::tuple<rmm::device_uvector<vertex_t>, vertex_t> pair containing
+ *       the paths as a dense matrix in the vector and the maximum path length.
+ *       Unused elements in the paths will be set to invalid_vertex_id (-1 for a signed
+ *       vertex_t, std::numeric_limits<vertex_t>::max() for an unsigned vertex_t type).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  vertex_t const* distances,
+  vertex_t const* predecessors,
+  vertex_t const* destinations,
+  size_t n_destinations,
+  std::optional<size_t> max_destinations_per_batch);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
+ * the source vertex.
+ *
+ * This function computes the distances (minimum edge weight sums) from the source vertex. If @p
+ * predecessors is not `nullptr`, this function calculates the predecessor of each vertex in the
+ * shortest-path as well. Graph edge weights should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param distances Pointer to the output distance array.
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to start single-source shortest-path.
+ * In a multi-gpu context the source vertex should be local to this GPU.
+ * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
+ * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
           edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
           weight_t* distances,
           vertex_t* predecessors,
@@ -1190,44 +2194,353 @@ void sssp(raft::handle_t const& handle,
           weight_t cutoff         = std::numeric_limits<weight_t>::max(),
           bool do_expensive_check = false);
 
+/**
+ * @ingroup traversal_cpp
+ * @brief Identify how the delta-stepping single-source shortest-path advances the near-far
+ * threshold.
+ *
+ * FIXED uses a single delta value computed from the average vertex degree and edge weight.
+ * ADAPTIVE advances the threshold based on a histogram of the far pile distances to keep the near
+ * pile large enough (and batches the far pile insertions from consecutive iterations), this reduces
+ * the number of iterations on high diameter graphs with skewed edge weights.
+ */
+enum class sssp_delta_mode_t { FIXED = 0, ADAPTIVE };
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
+ * the source vertex with the user specified delta-stepping mode.
+ *
+ * This function computes the distances (minimum edge weight sums) from the source vertex. If @p
+ * predecessors is not `nullptr`, this function calculates the predecessor of each vertex in the
+ * shortest-path as well. Graph edge weights should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param distances Pointer to the output distance array.
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to start single-source shortest-path.
+ * In a multi-gpu context the source vertex should be local to this GPU.
+ * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
+ * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param delta_mode Delta-stepping mode (see sssp_delta_mode_t).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+          edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+          weight_t* distances,
+          vertex_t* predecessors,
+          vertex_t source_vertex,
+          weight_t cutoff,
+          sssp_delta_mode_t delta_mode,
+          bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Run shortest-path from the source vertex to a (small) set of target vertices.
+ *
+ * This function is similar to cugraph::sssp but terminates as soon as the distances to every
+ * target are settled (and does not explore vertices that can't be on a shortest path to any
+ * target). If @p heuristics is provided, vertices are explored in the order of distance +
+ * heuristic (A* search), this can significantly reduce the number of visited vertices for a good
+ * (e.g. geometric) heuristic. A heuristic should be consistent (h(u) <= w(u, v) + h(v) for every
+ * edge (u, v) with weight w(u, v)) for the returned distances to be exact. Only the distances (and
+ * predecessors) of the targets and the vertices on the shortest paths to the targets are valid on
+ * return; the other vertices may hold tentative distances. Graph edge weights should be
+ * non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param distances Pointer to the output distance array.
+ * @param predecessors Pointer to the output predecessor array or `nullptr`.
+ * @param source_vertex Source vertex to start shortest-path.
+ * @param targets Target vertices. In a multi-gpu context, @p targets should be identical in every
+ * GPU.
+ * @param heuristics Optional lower bounds of the distances from the local vertices (in the local
+ * vertex partition range) to the targets.
+ * @param cutoff Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp_to_targets(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                     edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                     weight_t* distances,
+                     vertex_t* predecessors,
+                     vertex_t source_vertex,
+                     raft::device_span<vertex_t const> targets,
+                     std::optional<raft::device_span<weight_t const>> heuristics = std::nullopt,
+                     weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+                     bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Run single-source shortest-path and return only the vertices reached within the cutoff.
+ *
+ * This function is similar to the sssp function above, but avoids allocating (and initializing)
+ * the O(V) distance and predecessor arrays. Tentative distances are tracked in a hash map and the
+ * work in each iteration is proportional to the out-going edges of the vertices whose distances
+ * improved in the previous iteration. This is faster than sssp if @p cutoff limits the search to a
+ * small fraction of the graph. Graph edge weights should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param source_vertex Source vertex to start shortest-path.
+ * @param cutoff Vertices with a distance no smaller than @p cutoff are not reached (the source
+ * vertex is always reached).
+ * @param compute_predecessors Flag to return the predecessors as well.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the reached vertices (local to this GPU, sorted in ascending order), their
+ * shortest distances, and optional predecessors (invalid_vertex_id<vertex_t>::value for the
+ * source vertex).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+sparse_sssp(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+            edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+            vertex_t source_vertex,
+            weight_t cutoff           = std::numeric_limits<weight_t>::max(),
+            bool compute_predecessors = false,
+            bool do_expensive_check   = false);
+
 /**
 .* @ingroup traversal_cpp
  * @brief Compute the shortest distances from the given origins to all the given destinations.
  *
- * This algorithm is designed for large diameter graphs. For small diameter graphs, running the
- * cugraph::sssp function in a sequentially executed loop might be faster. This algorithms currently
- * works only for single-GPU (we are not aware of large diameter graphs that won't fit in a single
- * GPU).
+ * This algorithm is designed for large diameter graphs. For small diameter graphs, running the
+ * cugraph::sssp function in a sequentially executed loop might be faster. This algorithms currently
+ * works only for single-GPU (we are not aware of large diameter graphs that won't fit in a single
+ * GPU).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param origins An array of origins (starting vertices) to find shortest distances. There should
+ * be no duplicates in @p origins.
+ * @param destinations An array of destinations (end vertices) to find shortest distances. There
+ * should be no duplicates in @p destinations.
+ * @param cutoff Any destinations farther than @p cutoff will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return A vector of size @p origins.size() * @p destinations.size(). The i'th element of the
+ * returned vector is the shortest distance from the (i / @p destinations.size())'th origin to the
+ * (i % @p destinations.size())'th destination.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> od_shortest_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> origins,
+  raft::device_span<vertex_t const> destinations,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Compute the shortest distances from the given origins to all the given destinations with
+ * landmark (ALT) pruning, processing the origins in memory-bounded batches.
+ *
+ * This function is similar to the od_shortest_distances function above, but 1) prunes the search
+ * using the triangle inequality lower bounds (d(v, t) >= d(l, t) - d(l, v) for every landmark l)
+ * if @p landmark_distances is provided and 2) runs the search for at most @p max_origins_per_batch
+ * origins at a time (this bounds the peak memory usage which grows with the number of origins
+ * searched concurrently). This algorithm currently works only for single-GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param origins An array of origins (starting vertices) to find shortest distances. There should
+ * be no duplicates in @p origins.
+ * @param destinations An array of destinations (end vertices) to find shortest distances. There
+ * should be no duplicates in @p destinations.
+ * @param landmark_distances Optional distances from a set of landmarks to every vertex (landmark
+ * major, see compute_landmark_distances). The distances can be computed once and reused for
+ * multiple queries on the same graph.
+ * @param max_origins_per_batch Optional maximum number of origins to search concurrently (all
+ * the origins if std::nullopt).
+ * @param cutoff Any destinations farther than @p cutoff will be marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return A vector of size @p origins.size() * @p destinations.size(). The i'th element of the
+ * returned vector is the shortest distance from the (i / @p destinations.size())'th origin to the
+ * (i % @p destinations.size())'th destination.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> od_shortest_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> origins,
+  raft::device_span<vertex_t const> destinations,
+  std::optional<raft::device_span<weight_t const>> landmark_distances,
+  std::optional<size_t> max_origins_per_batch,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Compute the shortest distances from the given landmarks to every vertex.
+ *
+ * The output can be used as @p landmark_distances in od_shortest_distances. This algorithm
+ * currently works only for single-GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param landmarks An array of landmark vertices. Landmarks spread over the periphery of the graph
+ * (e.g. picked by farthest-point selection) typically provide the tightest bounds.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return A vector of size @p landmarks.size() * graph_view.number_of_vertices(). The i'th element
+ * of the returned vector is the shortest distance from the (i / graph_view.number_of_vertices())'th
+ * landmark to the vertex (i % graph_view.number_of_vertices()).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> compute_landmark_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> landmarks,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Contraction hierarchy index for repeated shortest distance queries.
+ *
+ * Vertices are contracted in rounds (an independent set of low degree vertices per round), and
+ * shortcut edges are added between the neighbors of every contracted vertex to preserve the
+ * shortest distances among the remaining vertices. @p upward_graph holds the edges from every
+ * vertex to its neighbors contracted in later rounds (including the shortcuts), so a shortest path
+ * between any two vertices can be found by two searches on @p upward_graph only (which are
+ * typically orders of magnitude smaller than a search on the input graph for road network like
+ * graphs).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct contraction_hierarchy_t {
+  graph_t<vertex_t, edge_t, false, false> upward_graph;
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, false>, weight_t> upward_edge_weights;
+  rmm::device_uvector<vertex_t> vertex_levels;  // the round each vertex is contracted in
+};
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Build a contraction hierarchy index of the given graph.
+ *
+ * The index is built once and can be reused for any number of
+ * contraction_hierarchy_shortest_distances calls. Every pair of neighbors of a contracted vertex
+ * gets a shortcut unless an existing edge is no longer than the shortcut (no witness search), so
+ * the index is compact only for graphs with mostly low degree vertices (e.g. road networks). This
+ * algorithm currently works only for single-GPU and symmetric graphs.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Needs to be symmetric.
+ * @param edge_weight_view View object holding edge weights for @p graph_view. Edge weights should
+ * be non-negative.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return The contraction hierarchy index (vertex IDs are the same as in @p graph_view).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup traversal_cpp
+ * @brief Compute the shortest distances of the given (source, target) pairs using a contraction
+ * hierarchy index.
+ *
+ * All the pairs are searched concurrently. For each pair, an upward search from the source and an
+ * upward search from the target are run on the index, and the shortest distance is the minimum
+ * over the vertices reached by both searches of the sum of the two distances.
  *
  * @throws cugraph::logic_error on erroneous input arguments.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
- * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
- * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object.
- * @param edge_weight_view View object holding edge weights for @p graph_view.
- * @param origins An array of origins (starting vertices) to find shortest distances. There should
- * be no duplicates in @p origins.
- * @param destinations An array of destinations (end vertices) to find shortest distances. There
- * should be no duplicates in @p destinations.
- * @param cutoff Any destinations farther than @p cutoff will be marked as unreachable.
+ * @param contraction_hierarchy Contraction hierarchy index (see build_contraction_hierarchy).
+ * @param sources An array of source vertices.
+ * @param targets An array of target vertices (size should coincide with @p sources.size()).
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return A vector of size @p origins.size() * @p destinations.size(). The i'th element of the
- * returned vector is the shortest distance from the (i / @p destinations.size())'th origin to the
- * (i % @p destinations.size())'th destination.
+ * @return A vector of size @p sources.size(). The i'th element is the shortest distance from
+ * @p sources[i] to @p targets[i] (std::numeric_limits<weight_t>::max() if unreachable).
  */
-template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-rmm::device_uvector<weight_t> od_shortest_distances(
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> contraction_hierarchy_shortest_distances(
   raft::handle_t const& handle,
-  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
-  raft::device_span<vertex_t const> origins,
-  raft::device_span<vertex_t const> destinations,
-  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& contraction_hierarchy,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
   bool do_expensive_check = false);
 
 /**
@@ -1303,6 +2616,64 @@ struct centrality_algorithm_metadata_t {
   bool converged_{};
 };
 
+/**
+ * @brief Iteration schedule of the PageRank, Katz centrality and eigenvector centrality iterations
+ *
+ * By default, every iteration computes all the values from the values of the previous iteration
+ * (Jacobi iteration) and checks convergence (a global reduction and a host synchronization).
+ *
+ * If num_blocks > 1, the local vertices of every GPU are split into num_blocks contiguous ranges
+ * updated one after another, each from the latest values of the previous ranges (block
+ * Gauss-Seidel iteration within a GPU). This usually needs fewer iterations, but every iteration
+ * runs num_blocks smaller updates (and in multi-GPU, num_blocks edge source property updates).
+ *
+ * Convergence is checked only every convergence_check_interval iterations (and at the last
+ * iteration), so up to convergence_check_interval - 1 iterations may run past convergence.
+ *
+ * If message_precision is set (PageRank only), the scaled PageRank values cached for the edge
+ * sources (the values communicated every iteration in multi-GPU) are stored in FP16 or BF16 and
+ * accumulated in result_t. Once the iteration stops improving at that precision, the remaining
+ * iterations use full precision values to converge to the requested epsilon.
+ *
+ * If use_cuda_graph is set (batched personalized PageRank and batched Katz Centrality only), the
+ * iterations between two convergence checks (rounded down to an even number) are captured once as
+ * a CUDA graph and replayed with a single launch, removing the per-kernel launch overhead that
+ * dominates the iterations of small graphs. This takes effect only if
+ * convergence_check_interval >= 2.
+ */
+struct centrality_iteration_schedule_t {
+  size_t num_blocks{1};
+  size_t convergence_check_interval{1};
+  std::optional<half_precision_t> message_precision{std::nullopt};
+  bool use_cuda_graph{false};
+};
+
+/**
+ * @brief Checkpointing options of PageRank
+ *
+ * If @p callback is set, it is called (on every GPU) with the number of completed iterations and
+ * the PageRank values of the local vertices every @p iteration_interval iterations. The device
+ * span is valid only until the callback returns, and the callback should copy it (e.g. to a per-GPU
+ * local file) on the handle's stream. A run is resumed by passing the checkpointed values as the
+ * initial PageRank values and the checkpointed iteration count as the number of resumed
+ * iterations.
+ */
+template <typename result_t>
+struct pagerank_checkpoint_options_t {
+  size_t iteration_interval{1};
+  std::function<void(size_t, raft::device_span<result_t const>)> callback{};
+};
+
+/**
+ * @brief Eigensolver of the eigenvector centrality and HITS computations
+ *
+ * power_iteration repeats (normalized) matrix-vector products until the values stop changing.
+ * lanczos uses the restarted Lanczos method, which needs far fewer matrix-vector products when the
+ * gap between the two largest eigenvalues is small, but stores a Krylov basis of 16 vectors of the
+ * local vertex partition size (and, for eigenvector centrality, requires a symmetric graph).
+ */
+enum class centrality_eigensolver_t { power_iteration, lanczos };
+
 /**
 .* @ingroup link_analysis_cpp
  * @brief Compute PageRank scores.
@@ -1343,6 +2714,8 @@ struct centrality_algorithm_metadata_t {
  * vertices in the graph multiplied by @p epsilon.
  * @param max_iterations Maximum number of PageRank iterations.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule (block Gauss-Seidel updates and the convergence check
+ * interval).
  * @return tuple containing the optional pagerank results (populated if @p initial_pageranks is
  * set to `std::nullopt`) and a metadata structure with metadata indicating how many iterations
  * were run and whether the algorithm converged or not.
@@ -1358,6 +2731,292 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
   std::optional<raft::device_span<result_t const>> initial_pageranks,
   result_t alpha,
   result_t epsilon,
+  size_t max_iterations                    = 500,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{});
+
+/**
+ * @ingroup link_analysis_cpp
+ * @brief Compute PageRank scores with checkpointing.
+ *
+ * Same as the above PageRank function except that the PageRank values are passed to @p
+ * checkpoint_options.callback every @p checkpoint_options.iteration_interval iterations (see
+ * pagerank_checkpoint_options_t), and that the run can be resumed from checkpointed values. To
+ * resume, pass the checkpointed values (of the local vertices, with the same GPU partitioning) as
+ * @p initial_pageranks and the checkpointed iteration count as @p num_resumed_iterations; the
+ * resumed iterations count towards @p max_iterations.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param precomputed_vertex_out_weight_sums Optional device span storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`.
+ * @param personalization Optional tuple containing device spans of vertex identifiers and
+ * personalization values for the vertices (compute personalized PageRank) or `std::nullopt`
+ * (compute general PageRank).
+ * @param initial_pageranks Optional device span containing initial PageRank values (the
+ * checkpointed values if resuming).
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param checkpoint_options Checkpointing options.
+ * @param num_resumed_iterations Number of iterations completed before the checkpoint in @p
+ * initial_pageranks (0 if not resuming). Should be smaller than @p max_iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule.
+ * @return tuple containing the PageRank results and a metadata structure with the number of
+ * iterations (including @p num_resumed_iterations) and whether the algorithm converged or not.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>>
+    personalization,
+  std::optional<raft::device_span<result_t const>> initial_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  pagerank_checkpoint_options_t<result_t> const& checkpoint_options,
+  size_t num_resumed_iterations,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{});
+
+/**
+ * @ingroup link_analysis_cpp
+ * @brief Compute PageRank scores with reduced precision edge weights.
+ *
+ * Same as the above PageRank function except that edge weights are stored in a reduced precision
+ * encoding (16 bit floating point bits or quantized uint8_t values, see @ref
+ * encode_half_edge_weights and @ref quantize_edge_weights) to cut edge weight memory footprint
+ * and bandwidth. Edge weights are decoded with @p edge_weight_decoder on the fly and the PageRank
+ * values are accumulated in @p result_t.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_weight_storage_t Type of the encoded edge weights (uint16_t or uint8_t).
+ * @tparam EdgeWeightDecoder Type of the functor decoding the edge weights to float
+ * (half_edge_weight_decoder_t or uint8_edge_weight_decoder_t).
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param encoded_edge_weight_view View object holding the encoded edge weights for @p graph_view.
+ * @param edge_weight_decoder Functor to decode the values in @p encoded_edge_weight_view.
+ * @param precomputed_vertex_out_weight_sums Optional device span storing sums of (decoded)
+ * out-going edge weights for the vertices (for re-use) or `std::nullopt`.
+ * @param personalization Optional tuple containing device spans of vertex identifiers and
+ * personalization values for the vertices (compute personalized PageRank) or `std::nullopt`
+ * (compute general PageRank).
+ * @param initial_pageranks Optional device span containing initial PageRank values.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing the PageRank results and a metadata structure with metadata
+ * indicating how many iterations were run and whether the algorithm converged or not.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_weight_storage_t,
+          typename EdgeWeightDecoder,
+          typename result_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_weight_storage_t const*> encoded_edge_weight_view,
+  EdgeWeightDecoder edge_weight_decoder,
+  std::optional<raft::device_span<result_t const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>>
+    personalization,
+  std::optional<raft::device_span<result_t const>> initial_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup link_analysis_cpp
+ * @brief Approximate personalized PageRank scores with forward push.
+ *
+ * Andersen-Chung-Lang style local computation: the personalization vector is the initial residual,
+ * and every iteration settles (1 - @p alpha) of the residual of the vertices whose residual is at
+ * least @p epsilon times their out-going edge weight sum (or @p epsilon if the vertex has no
+ * out-going edge) and pushes the rest to their out-going neighbors (the residual of the vertices
+ * without out-going edges is pushed to the personalization vertices, as in PageRank). Only the
+ * vertices above the push threshold and their neighbors are touched, so for a small
+ * personalization vector the work is proportional to the neighborhood reached rather than to the
+ * graph size. The error of the score of a vertex is bounded by @p epsilon times its out-going edge
+ * weight sum.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (storing the out-going edges of each vertex).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param precomputed_vertex_out_weight_sums Optional device span storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`.
+ * @param personalization Tuple containing device spans of vertex identifiers (local to this GPU
+ * in multi-GPU) and personalization values for the vertices.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Residual threshold (per unit of out-going edge weight) for pushing a vertex.
+ * @param max_iterations Maximum number of push iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing the approximate PageRank scores of the local vertices and a metadata
+ * structure with the number of iterations run and whether every residual dropped below the push
+ * threshold.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>
+    personalization,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = std::numeric_limits<size_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup link_analysis_cpp
+ * @brief Compute personalized PageRank scores for a batch of personalization vectors.
+ *
+ * Computes the same scores as calling the personalized PageRank function once per
+ * personalization vector, but iterates the K personalization vectors together: every edge pass
+ * updates the scores of all the vectors that have not converged yet (a sparse matrix dense matrix
+ * multiplication instead of K sparse matrix vector multiplications). The scores are stored in a
+ * [V x K] row-major matrix, so the memory footprint grows with K; a large number of
+ * personalization vectors should be processed in batches of a size fitting in memory.
+ *
+ * A personalization vector converges on the device (its convergence flag is set in the iteration
+ * that satisfies @p epsilon), so the host needs to check convergence only every
+ * schedule.convergence_check_interval iterations and the iterations in between can be replayed
+ * from a CUDA graph (schedule.use_cuda_graph).
+ *
+ * This function is currently supported only in single-GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param precomputed_vertex_out_weight_sums Optional device span storing sums of out-going edge
+ * weights for the vertices (for re-use across batches) or `std::nullopt`.
+ * @param personalization_offsets Device span of size K + 1, personalization vector k consists of
+ * the [personalization_offsets[k], personalization_offsets[k + 1]) elements of @p
+ * personalization_vertices and @p personalization_values.
+ * @param personalization_vertices Device span of the vertices of the personalization vectors.
+ * @param personalization_values Device span of the values of the personalization vectors.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence. A personalization vector is converged (and
+ * its scores are no longer updated) once the sum of the differences in its scores between two
+ * consecutive iterations is less than @p epsilon.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule (see centrality_iteration_schedule_t), num_blocks should be 1
+ * and message_precision should not be set.
+ * @return tuple containing the [V x K] row-major PageRank scores (the score of vertex v for
+ * personalization vector k is at v * K + k) and a metadata structure with the number of iterations
+ * run and whether every personalization vector converged.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<vertex_t const> personalization_vertices,
+  raft::device_span<result_t const> personalization_values,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations                    = 500,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{});
+
+/**
+.* @ingroup link_analysis_cpp
+ * @brief Incrementally update PageRank scores after edge insertions and deletions.
+ *
+ * The current graph is @p graph_view (with its attached edge mask, if any). The previous graph
+ * differs from the current graph by the edges flagged in @p edge_mask_delta: a flagged edge that is
+ * valid in the current graph was inserted and a flagged edge that is masked out in the current
+ * graph was deleted. Starting from @p previous_pageranks (the PageRank scores of the previous
+ * graph), this function pushes the residuals of the vertices incident to the changed edges until
+ * every residual falls below @p epsilon divided by the number of vertices. This touches only the
+ * part of the graph affected by the changes if the changes are small.
+ *
+ * This function runs in the push model (the residuals are propagated along the outgoing edges), so
+ * @p graph_view should not be storage transposed. Personalized PageRank is not supported.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the current graph.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param edge_mask_delta Edge mask (defined on @p graph_view without its edge mask) flagging the
+ * edges inserted or deleted since @p previous_pageranks were computed.
+ * @param previous_pageranks Device span holding the PageRank scores of the previous graph for the
+ * vertices in the local vertex partition range.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if every residual is
+ * less than @p epsilon divided by the number of vertices in the graph.
+ * @param max_iterations Maximum number of push iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing the updated PageRank scores and a metadata structure with metadata
+ * indicating how many iterations were run and whether the algorithm converged or not.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  edge_property_view_t<edge_t, uint32_t const*, bool> edge_mask_delta,
+  raft::device_span<result_t const> previous_pageranks,
+  result_t alpha,
+  result_t epsilon,
   size_t max_iterations   = 500,
   bool do_expensive_check = false);
 
@@ -1365,7 +3024,8 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
 .* @ingroup centrality_cpp
  * @brief Compute Eigenvector Centrality scores.
  *
- * This function computes eigenvector centrality scores using the power method.
+ * This function computes eigenvector centrality scores using the power method (or the Lanczos
+ * method, see centrality_eigensolver_t).
  *
  * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
  * max_iterations.
@@ -1387,6 +3047,13 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
  * number of vertices in the graph multiplied by @p epsilon.
  * @param max_iterations Maximum number of power iterations.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule (only the convergence check interval, block Gauss-Seidel
+ * updates are not supported by the power method and schedule.num_blocks should be 1).
+ * @param solver Eigensolver. With centrality_eigensolver_t::lanczos, @p graph_view should be
+ * symmetric, convergence is assumed once the L2 norm of the eigenpair residual is less than the
+ * eigenvalue multiplied by sqrt(number of vertices) * @p epsilon (which bounds the sum of the
+ * differences of one more power iteration by the number of vertices multiplied by @p epsilon),
+ * @p max_iterations bounds the number of matrix-vector products and @p schedule is ignored.
  * @return device vector containing the centralities.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -1396,8 +3063,10 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   std::optional<raft::device_span<weight_t const>> initial_centralities,
   weight_t epsilon,
-  size_t max_iterations   = 500,
-  bool do_expensive_check = false);
+  size_t max_iterations                    = 500,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{},
+  centrality_eigensolver_t solver          = centrality_eigensolver_t::power_iteration);
 
 /**
 .* @ingroup link_analysis_cpp
@@ -1425,19 +3094,27 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
  * @param normalize If set to `true`, final hub and authority scores are normalized (the L1-norm of
  * the returned hub and authority score arrays is 1.0) before returning.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param solver Eigensolver. With centrality_eigensolver_t::lanczos, the authorities are computed
+ * as the dominant eigenvector of A^T A (A is the adjacency matrix) and the hubs from the
+ * authorities. Convergence is assumed once the L2 norm of the eigenpair residual is less than the
+ * eigenvalue multiplied by sqrt(number of vertices) * @p epsilon, the returned difference is this
+ * relative residual norm multiplied by sqrt(number of vertices), and @p max_iterations bounds the
+ * number of A^T A products.
  * @return std::tuple<result_t, size_t> A tuple of sum of the differences of hub scores of the last
  * two iterations and the total number of iterations taken to reach the final result
  */
 template <typename vertex_t, typename edge_t, typename result_t, bool multi_gpu>
-std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
-                                  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
-                                  result_t* hubs,
-                                  result_t* authorities,
-                                  result_t epsilon,
-                                  size_t max_iterations,
-                                  bool has_initial_hubs_guess,
-                                  bool normalize,
-                                  bool do_expensive_check);
+std::tuple<result_t, size_t> hits(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  result_t* hubs,
+  result_t* authorities,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_hubs_guess,
+  bool normalize,
+  bool do_expensive_check,
+  centrality_eigensolver_t solver = centrality_eigensolver_t::power_iteration);
 
 /**
 .* @ingroup centrality_cpp
@@ -1477,20 +3154,89 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
  * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
  * the returned Katz Centrality score array is 1.0) before returning.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule (block Gauss-Seidel updates and the convergence check
+ * interval).
  */
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
-void katz_centrality(raft::handle_t const& handle,
-                     graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
-                     std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-                     result_t const* betas,
-                     result_t* katz_centralities,
-                     result_t alpha,
-                     result_t beta,
-                     result_t epsilon,
-                     size_t max_iterations   = 500,
-                     bool has_initial_guess  = false,
-                     bool normalize          = false,
-                     bool do_expensive_check = false);
+void katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  result_t const* betas,
+  result_t* katz_centralities,
+  result_t alpha,
+  result_t beta,
+  result_t epsilon,
+  size_t max_iterations                    = 500,
+  bool has_initial_guess                   = false,
+  bool normalize                           = false,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{});
+
+/**
+.* @ingroup centrality_cpp
+ * @brief Compute Katz Centrality scores for a batch of (alpha, beta) pairs.
+ *
+ * Computes the same scores as calling the Katz Centrality function once per column, but iterates
+ * the K columns together: every edge pass updates the scores of all the columns that have not
+ * converged yet (a sparse matrix dense matrix multiplication instead of K sparse matrix vector
+ * multiplications). Column k uses the attenuation factor alphas[k] and adds betas[k] to every
+ * vertex's new score in every iteration, and if @p personalization is set, additionally adds the
+ * values of personalization vector k to the new scores of its vertices (e.g. alphas[k] from a
+ * parameter sweep, betas[k] = 0, and a single seed vertex per column for personalized Katz
+ * Centrality). The scores are stored in a [V x K] row-major matrix, so the memory footprint grows
+ * with K; a large number of columns should be processed in batches of a size fitting in memory.
+ *
+ * A column converges on the device (its convergence flag is set in the iteration that satisfies @p
+ * epsilon and its scores are no longer updated), so the host needs to check convergence only every
+ * schedule.convergence_check_interval iterations and the iterations in between can be replayed
+ * from a CUDA graph (schedule.use_cuda_graph). The scores start from zero.
+ *
+ * This function is currently supported only in single-GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Katz Centrality scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == false, edge weights are assumed to be 1.0.
+ * @param alphas Device span of size K holding the attenuation factor of each column.
+ * @param betas Device span of size K holding the constant added to every vertex's new score of
+ * each column in every iteration.
+ * @param personalization Optional tuple of (offsets, vertices, values) device spans; offsets is of
+ * size K + 1 and personalization vector k consists of the [offsets[k], offsets[k + 1]) elements of
+ * vertices and values.
+ * @param epsilon Error tolerance to check convergence. A column is converged once the sum of the
+ * differences in its scores between two consecutive iterations is less than @p epsilon.
+ * @param max_iterations Maximum number of Katz Centrality iterations.
+ * @param normalize If set to `true`, every column is normalized to the unit L2 norm.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param schedule Iteration schedule (see centrality_iteration_schedule_t), num_blocks should be 1
+ * and message_precision should not be set.
+ * @return tuple containing the [V x K] row-major Katz Centrality scores (the score of vertex v for
+ * column k is at v * K + k) and a metadata structure with the number of iterations run and whether
+ * every column converged.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> batched_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<result_t const> alphas,
+  raft::device_span<result_t const> betas,
+  std::optional<std::tuple<raft::device_span<size_t const>,
+                           raft::device_span<vertex_t const>,
+                           raft::device_span<result_t const>>> personalization,
+  result_t epsilon,
+  size_t max_iterations                    = 500,
+  bool normalize                           = false,
+  bool do_expensive_check                  = false,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{});
 
 /**
 .* @ingroup community_cpp
@@ -1555,57 +3301,56 @@ std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
            std::optional<rmm::device_uvector<weight_t>>,
            rmm::device_uvector<size_t>>
-extract_ego(raft::handle_t const& handle,
-            graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-            std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-            raft::device_span<vertex_t const> source_vertices,
-            vertex_t radius,
-            bool do_expensive_check = false);
-
-/**
-.* @ingroup sampling_cpp
- * @brief returns random walks (RW) from starting sources, where each path is of given maximum
- * length. Uniform distribution is assumed for the random engine.
- *
- * @deprecated This algorithm will be deprecated once all of the functionality is migrated
- *             to the newer APIS: uniform_random_walks(), biased_random_walks(), and
- *             node2vec_random_walks().
- *
- * @tparam graph_t Type of graph/view (typically, graph_view_t).
- * @tparam index_t Type used to store indexing and sizes.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph Graph (view )object to generate RW on.
- * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
- * @param num_paths = number(paths).
- * @param max_depth maximum length of RWs.
- * @param use_padding (optional) specifies if return uses padded format (true), or coalesced
- * (compressed) format; when padding is used the output is a matrix of vertex paths and a matrix of
- * edges paths (weights); in this case the matrices are stored in row major order; the vertex path
- * matrix is padded with `num_vertices` values and the weight matrix is padded with `0` values;
- * @param sampling_strategy pointer for sampling strategy: uniform, biased, etc.; possible
- * values{0==uniform, 1==biased, 2==node2vec}; defaults to nullptr == uniform;
- * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>,
- * rmm::device_uvector<index_t>> Triplet of either padded or coalesced RW paths; in the coalesced
- * case (default), the return consists of corresponding vertex and edge weights for each, and
- * corresponding path sizes. This is meant to minimize the number of DF's to be passed to the Python
- * layer. The meaning of "coalesced" here is that a 2D array of paths of different sizes is
- * represented as a 1D contiguous array. In the padded case the return is a matrix of num_paths x
- * max_depth vertex paths; and num_paths x (max_depth-1) edge (weight) paths, with an empty array of
- * sizes. Note: if the graph is un-weighted the edge (weight) paths consists of `weight_t{1}`
- * entries;
- */
-template <typename vertex_t, typename edge_t, typename weight_t, typename index_t, bool multi_gpu>
-std::
-  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>, rmm::device_uvector<index_t>>
-  random_walks(raft::handle_t const& handle,
-               graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-               std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-               vertex_t const* ptr_d_start,
-               index_t num_paths,
-               index_t max_depth,
-               bool use_padding                                     = false,
-               std::unique_ptr<sampling_params_t> sampling_strategy = nullptr);
+extract_ego(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+            std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+            raft::device_span<vertex_t const> source_vertices,
+            vertex_t radius,
+            bool do_expensive_check = false);
+
+/**
+.* @ingroup community_cpp
+ * @brief returns induced EgoNet subgraphs centered at nodes in source_vertices within a given
+ * radius, storing the edges shared by multiple EgoNet subgraphs only once.
+ *
+ * Unlike extract_ego, the neighborhoods of all the centers are found by a single breadth-first
+ * search and the edges of all the EgoNet subgraphs are extracted together. Each edge in the union
+ * of the EgoNet subgraphs appears once in the returned edge list, and each EgoNet subgraph is
+ * returned as a list of indices into this edge list (overlapping neighborhoods do not replicate
+ * edges).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of, we extract induced egonet subgraphs from @p graph_view.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param source_vertices Device span of egonet center vertices (duplicates are allowed). In a
+ * multi-GPU context, the center vertices should be local to this GPU.
+ * @param radius  Include all neighbors of distance <= radius from @p source_vertices.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of edge source vertices, edge destination vertices, edge weights (if @p
+ * edge_weight_view.has_value() == true) of the deduplicated edge list, offsets (size ==
+ * source_vertices.size() + 1) and edge indices. The indices between offsets[i] (inclusive) and
+ * offsets[i + 1] (exclusive) are the positions of the edges of the i'th EgoNet subgraph in the
+ * edge list (in ascending order). In a multi-GPU context, the edge list holds the edges of the
+ * EgoNet subgraphs centered at this GPU's @p source_vertices.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<size_t>>
+extract_ego_batched(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                    raft::device_span<vertex_t const> source_vertices,
+                    vertex_t radius,
+                    bool do_expensive_check = false);
 
 /**
 .* @ingroup sampling_cpp
@@ -1653,6 +3398,92 @@ uniform_random_walks(raft::handle_t const& handle,
                      raft::device_span<vertex_t const> start_vertices,
                      size_t max_length);
 
+/**
+.* @ingroup sampling_cpp
+ * @brief returns uniform random walks from starting sources in a compacted (CSR-like) format,
+ * where each path is of given maximum length.
+ *
+ * This function generates the same kind of walks as uniform_random_walks() but in a single GPU
+ * kernel (each walker is advanced all the steps in one kernel launch instead of one kernel launch
+ * per step) and returns the paths without padding, which is beneficial if many paths terminate
+ * early. Each path is walked twice (once to compute the path lengths and once to store the paths),
+ * but no per-step gather/scatter is necessary.
+ *
+ * @p start_vertices can contain duplicates, in which case different random walks will
+ * be generated for each instance.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param graph_view graph view to operate on (single-GPU only)
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param start_vertices Device span defining the starting vertices
+ * @param max_length maximum length of random walk
+ * @return tuple containing device vectors of path offsets, path vertices, and the edge weights (if
+ *         @p edge_weight_view.has_value() is true)<br>
+ *         The vertices of the i'th path (starting from start_vertices[i]) are stored in
+ *         [offsets[i], offsets[i + 1]) of the path vertex vector (offsets size =
+ *         start_vertices.size() + 1); a path has between 1 and (max_length+1) vertices.<br>
+ *         The weights of the edges traversed in the i'th path are stored in
+ *         [offsets[i] - i, offsets[i + 1] - (i + 1)) of the weight vector.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_uniform_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length);
+
+/**
+.* @ingroup sampling_cpp
+ * @brief returns uniform random walks following a metapath (a sequence of edge types) from
+ * starting sources in a compacted (CSR-like) format.
+ *
+ * The k'th step of every walk moves to a uniformly selected neighbor over the outgoing edges of
+ * type metapath[k]; a walk terminates early if the current vertex does not have an outgoing edge
+ * of the required type. The candidate edges of each step are read from the edge type index, so
+ * the edges of the other types are never visited. Like compacted_uniform_random_walks(), each
+ * walker is advanced all the steps in a single kernel launch.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param graph_view graph view to operate on (single-GPU only)
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_type_index_view View object of the edge type index of @p graph_view's edge partition
+ * (see build_edge_partition_edge_type_index).
+ * @param start_vertices Device span defining the starting vertices
+ * @param metapath Device span defining the edge type of every step (the maximum path length is
+ * metapath.size()), edge types should be in [0, edge_type_index_view.number_of_edge_types()).
+ * @return tuple containing device vectors of path offsets, path vertices, and the edge weights (if
+ *         @p edge_weight_view.has_value() is true) in the same format as
+ *         compacted_uniform_random_walks().
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_metapath_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t> edge_type_index_view,
+  raft::device_span<vertex_t const> start_vertices,
+  raft::device_span<edge_type_t const> metapath);
+
 /**
 .* @ingroup sampling_cpp
  * @brief returns biased random walks from starting sources, where each path is of given
@@ -1748,6 +3579,164 @@ node2vec_random_walks(raft::handle_t const& handle,
                       weight_t p,
                       weight_t q);
 
+/**
+.* @ingroup sampling_cpp
+ * @brief returns uniform random walks following a metapath (a sequence of edge types) from
+ * starting sources.
+ *
+ * The k'th step of every walk moves to a uniformly selected neighbor over the outgoing edges of
+ * type metapath[k] (e.g. a metapath2vec style user->item->user walk); a walk terminates early if
+ * the current vertex does not have an outgoing edge of the required type. Only the edges of the
+ * required type are sampled in each step (instead of filtering the output of
+ * uniform_random_walks()). See compacted_metapath_random_walks() for a single-GPU variant
+ * returning the paths in a compacted format.
+ *
+ * @p start_vertices can contain duplicates, in which case different random walks will
+ * be generated for each instance.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param graph_view graph view to operate on
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_type_view View object holding edge types for @p graph_view.
+ * @param num_edge_types Number of edge types (edge types should be in [0, num_edge_types)).
+ * @param start_vertices Device span defining the starting vertices
+ * @param metapath Device span defining the edge type of every step (the maximum path length is
+ * metapath.size()); should be identical in every GPU in multi-GPU.
+ * @return tuple containing device vectors of vertices and the edge weights (if
+ *         @p edge_weight_view.has_value() is true) in the same format as uniform_random_walks()
+ *         with max_length = metapath.size().
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+metapath_random_walks(raft::handle_t const& handle,
+                      raft::random::RngState& rng_state,
+                      graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                      std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                      edge_property_view_t<edge_t, edge_type_t const*> edge_type_view,
+                      edge_type_t num_edge_types,
+                      raft::device_span<vertex_t const> start_vertices,
+                      raft::device_span<edge_type_t const> metapath);
+
+/**
+ * @ingroup sampling_cpp
+ * @brief Estimate personalized PageRank scores of many seeds with random walks
+ *
+ * @p num_walks_per_seed walks are launched from every seed. Before each step a walk stops with
+ * probability 1 - @p alpha (so walk lengths are geometric), and a walk at a vertex without
+ * out-going edges jumps back to its seed. The score of vertex v for seed s is estimated as (1 -
+ * @p alpha) times the average number of visits to v by the walks of s. Walk paths are not
+ * stored, the visit counts of each (seed, vertex) pair are accumulated step by step.
+ *
+ * This is cheaper than power iteration when there are many seeds and low precision is
+ * acceptable; the standard error of a score p is about sqrt(p / @p num_walks_per_seed).
+ *
+ * If @p edge_weight_view.has_value() == true, walks follow an out-going edge with probability
+ * proportional to its weight (as in biased_random_walks), otherwise uniformly (as in
+ * uniform_random_walks).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights and scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view graph view to operate on
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param seeds Device span defining the seeds (in multi-GPU, the seeds of this GPU)
+ * @param num_walks_per_seed Number of walks launched from every seed
+ * @param alpha PageRank damping factor (probability of taking another step), in [0.0, 1.0)
+ * @param max_length Maximum number of steps of a walk (walks truncated at this length bias the
+ * estimates down)
+ * @return tuple of offsets (size @p seeds.size() + 1), vertices and scores; the vertices with a
+ * non-zero estimated score for seeds[i] and their scores are in [offsets[i], offsets[i + 1]),
+ * sorted by vertex
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  monte_carlo_personalized_pagerank(
+    raft::handle_t const& handle,
+    raft::random::RngState& rng_state,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> seeds,
+    size_t num_walks_per_seed,
+    weight_t alpha,
+    size_t max_length = std::numeric_limits<size_t>::max());
+
+/**
+ * @ingroup sampling_cpp
+ * @brief Train node2vec (DeepWalk if p = q = 1) vertex embeddings with skip-gram and negative
+ * sampling.
+ *
+ * The random walks are generated in chunks of @p walk_chunk_size walks, and each chunk is consumed
+ * by the skip-gram trainer on the device before the next chunk is generated, so the full walk
+ * corpus (num_vertices * @p num_walks_per_vertex * (@p walk_length + 1) vertices per epoch) is
+ * never materialized. For every vertex in a walk, the vertices within a randomly shrunk window of
+ * at most @p window_size steps are positive samples, and @p num_negative_samples negative samples
+ * per positive sample are drawn with probabilities proportional to out_degree^0.75. The embedding
+ * tables are updated asynchronously (Hogwild!) and the learning rate decays linearly over the
+ * walks; the results are not deterministic.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object of the input graph (single-GPU only).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If
+ * @p edge_weight_view.has_value() is true, the walks select the next vertex with probabilities
+ * proportional to the edge weights (see biased_random_walks() and node2vec_random_walks()).
+ * @param embedding_dimension Number of embedding dimensions.
+ * @param num_walks_per_vertex Number of walks starting from each vertex in each epoch.
+ * @param walk_length Maximum number of steps of a walk.
+ * @param p node2vec return parameter
+ * @param q node2vec in-out parameter
+ * @param window_size Maximum distance (in steps) between a vertex and its context vertices.
+ * @param num_negative_samples Number of negative samples per positive sample.
+ * @param num_epochs Number of passes over the walks (new walks are generated in every epoch).
+ * @param learning_rate Initial learning rate.
+ * @param walk_chunk_size Number of walks generated and trained at once (larger values improve GPU
+ * utilization at the cost of more memory).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Vertex embeddings (size = graph_view.number_of_vertices() * @p embedding_dimension); the
+ * embedding of vertex v is stored in [v * @p embedding_dimension, (v + 1) * @p
+ * embedding_dimension).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<float> node2vec_embedding(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t embedding_dimension,
+  size_t num_walks_per_vertex = 10,
+  size_t walk_length          = 80,
+  weight_t p                  = 1.0,
+  weight_t q                  = 1.0,
+  size_t window_size          = 5,
+  size_t num_negative_samples = 5,
+  size_t num_epochs           = 1,
+  float learning_rate         = 0.025,
+  size_t walk_chunk_size      = size_t{1} << 20,
+  bool do_expensive_check     = false);
+
 /**
 .* @ingroup components_cpp
  * @brief Finds (weakly-connected-)component IDs of each vertices in the input graph.
@@ -1764,12 +3753,78 @@ node2vec_random_walks(raft::handle_t const& handle,
  * @param graph_view Graph view object.
  * @param components Pointer to the output component ID array.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param num_sampled_neighbors If set, components are first linked along up to
+ * @p num_sampled_neighbors randomly sampled neighbors per vertex (Afforest-style subgraph
+ * sampling), and only the edges of the vertices outside the largest component found this way are
+ * processed afterwards. This skips most edges in graphs with one giant component. If
+ * std::nullopt, all edges are processed.
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 void weakly_connected_components(raft::handle_t const& handle,
                                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
                                  vertex_t* components,
-                                 bool do_expensive_check = false);
+                                 bool do_expensive_check                    = false,
+                                 std::optional<size_t> num_sampled_neighbors = std::nullopt);
+
+/**
+.* @ingroup components_cpp
+ * @brief Updates (weakly-connected-)component IDs after inserting a batch of new edges.
+ *
+ * Instead of recomputing the components from scratch, only the new edges are processed: the
+ * components linked by the new edges are merged with a concurrent union-find (with path
+ * compression) and the component IDs are relabeled. The merged component takes one of the
+ * component IDs of its members (component IDs not touched by the new edges are unchanged).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (only the vertex partitioning is used, so this can be the
+ * graph either before or after inserting the new edges).
+ * @param new_edge_srcs Device span holding the source vertex IDs of the new edges (new edges are
+ * treated as undirected, so one direction suffices). In multi-GPU, each GPU can pass an arbitrary
+ * subset of the new edges.
+ * @param new_edge_dsts Device span holding the destination vertex IDs of the new edges.
+ * @param components Device span holding the component IDs of the local vertices before inserting
+ * the new edges (e.g. from weakly_connected_components). Updated in-place.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> new_edge_srcs,
+  raft::device_span<vertex_t const> new_edge_dsts,
+  raft::device_span<vertex_t> components,
+  bool do_expensive_check = false);
+
+/**
+.* @ingroup components_cpp
+ * @brief Finds (strongly-connected-)component IDs of each vertices in the input graph.
+ *
+ * The input graph can be directed. Component IDs can be arbitrary integers (they can be
+ * non-consecutive and are not ordered by component size or any other criterion), but all the
+ * vertices in a strongly connected component share the same component ID. Vertices with
+ * self-loops only (or no edges) form singleton components.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param components Pointer to the output component ID array.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  bool do_expensive_check = false);
 
 /**
 .* @ingroup core_cpp
@@ -1811,87 +3866,224 @@ void core_number(raft::handle_t const& handle,
                  bool do_expensive_check = false);
 
 /**
-.* @ingroup core_cpp
- * @brief   Extract K-Core of a graph
+.* @ingroup core_cpp
+ * @brief   Extract K-Core of a graph
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param  graph_view      Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param  k               Order of the core. This value must not be negative.
+ * @param degree_type Optional parameter to dictate whether to compute the K-Core decomposition
+ *                    based on in-degrees, out-degrees, or in-degrees + out_degrees.  One of @p
+ *                    degree_type and @p core_numbers must be specified.
+ * @param  core_numbers    Optional output from core_number algorithm.  If not specified then
+ *                         k_core will call core_number itself using @p degree_type
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ *
+ * @return edge list for the graph
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+k_core(raft::handle_t const& handle,
+       graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+       std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+       size_t k,
+       std::optional<k_core_degree_type_t> degree_type,
+       std::optional<raft::device_span<edge_t const>> core_numbers,
+       bool do_expensive_check = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief Compute triangle counts.
+ *
+ * Compute triangle counts for the entire set of vertices (if @p vertices is std::nullopt) or the
+ * given vertices (@p vertices.has_value() is true).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param vertices Vertices to compute triangle counts. If @p vertices.has_value() is false, compute
+ * triangle counts for the entire set of vertices.
+ * @param counts Output triangle count array. The size of the array should be the local vertex
+ * partition range size (if @p vertices is std::nullopt) or the size of @p vertices (if @p
+ * vertices.has_value() is true).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void triangle_count(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                    std::optional<raft::device_span<vertex_t const>> vertices,
+                    raft::device_span<edge_t> counts,
+                    bool do_expensive_check = false);
+
+/**
+.* @ingroup community_cpp
+ * @brief Compute edge triangle counts.
+ *
+ * Compute edge triangle counts for the entire set of edges.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ *  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ *
+ * @return edge_property_t containing the edge triangle count
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> edge_triangle_count(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief Compute local clustering coefficients and global transitivity.
+ *
+ * The local clustering coefficient of a vertex v is 2 * T(v) / (d(v) * (d(v) - 1)) where T(v) is
+ * the number of triangles incident to v and d(v) is the number of v's neighbors (excluding v
+ * itself); vertices with less than two neighbors have coefficient 0. Transitivity is the ratio of
+ * closed wedges (paths of length two) to all wedges in the graph. Both are computed from a single
+ * triangle counting pass and a single degree computation pass.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Should be symmetric and should not be a multi-graph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the local clustering coefficients (for the local vertex partition range), the
+ * global transitivity, and the average local clustering coefficient.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, double, double> clustering_coefficient(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup community_cpp
+ * @brief Approximate local clustering coefficients and global transitivity by wedge sampling.
  *
- * @throws     cugraph::logic_error when an error occurs.
+ * For every vertex with two or more neighbors, @p num_wedge_samples_per_vertex pairs of neighbors
+ * are sampled uniformly at random (with replacement, pairs with identical endpoints are discarded)
+ * and the local clustering coefficient is estimated as the fraction of the sampled wedges that are
+ * closed. Transitivity is estimated as the wedge count weighted average of the local estimates.
+ * Standard errors are reported for every estimate.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
- * @tparam weight_t Type of edge weights. Needs to be a floating point type.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
- * @param  graph_view      Graph view object.
- * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
- * @param  k               Order of the core. This value must not be negative.
- * @param degree_type Optional parameter to dictate whether to compute the K-Core decomposition
- *                    based on in-degrees, out-degrees, or in-degrees + out_degrees.  One of @p
- *                    degree_type and @p core_numbers must be specified.
- * @param  core_numbers    Optional output from core_number algorithm.  If not specified then
- *                         k_core will call core_number itself using @p degree_type
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param graph_view Graph view object. Should be symmetric and should not be a multi-graph.
+ * @param num_wedge_samples_per_vertex Number of wedges to sample per vertex.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- *
- * @return edge list for the graph
+ * @return Tuple of the estimated local clustering coefficients and their standard errors (for the
+ * local vertex partition range), the estimated global transitivity, and its standard error.
  */
-template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-std::tuple<rmm::device_uvector<vertex_t>,
-           rmm::device_uvector<vertex_t>,
-           std::optional<rmm::device_uvector<weight_t>>>
-k_core(raft::handle_t const& handle,
-       graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-       std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
-       size_t k,
-       std::optional<k_core_degree_type_t> degree_type,
-       std::optional<raft::device_span<edge_t const>> core_numbers,
-       bool do_expensive_check = false);
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>, double, double>
+approximate_clustering_coefficient(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t num_wedge_samples_per_vertex = 64,
+  bool do_expensive_check             = false);
 
 /**
  * @ingroup community_cpp
- * @brief Compute triangle counts.
+ * @brief Count k-cliques.
  *
- * Compute triangle counts for the entire set of vertices (if @p vertices is std::nullopt) or the
- * given vertices (@p vertices.has_value() is true).
+ * The edges are oriented from a low-degree vertex to a high-degree vertex (ties broken by vertex
+ * ID) and every k-clique is enumerated exactly once by repeatedly intersecting the out-neighbor
+ * lists of the last two vertices of each partial clique (in multi-GPU, the vertex pairs are
+ * shuffled to the GPUs owning the corresponding edge partitions for the intersection). Self-loops
+ * are ignored.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object.
- * @param vertices Vertices to compute triangle counts. If @p vertices.has_value() is false, compute
- * triangle counts for the entire set of vertices.
- * @param counts Output triangle count array. The size of the array should be the local vertex
- * partition range size (if @p vertices is std::nullopt) or the size of @p vertices (if @p
- * vertices.has_value() is true).
+ * @param graph_view Graph view object. Should be symmetric and should not be a multi-graph.
+ * @param k Clique size (should be 3 or larger; memory usage grows quickly with k, the primary use
+ * case is k = 4 to 6).
+ * @param compute_vertex_counts Flag to compute the number of k-cliques each vertex belongs to.
+ * @param compute_edge_counts Flag to compute the number of k-cliques each edge belongs to.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the total number of k-cliques, the optional per-vertex counts (for the local
+ * vertex partition range, valid if @p compute_vertex_counts is true), and the optional per-edge
+ * counts (valid if @p compute_edge_counts is true).
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
-void triangle_count(raft::handle_t const& handle,
-                    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-                    std::optional<raft::device_span<vertex_t const>> vertices,
-                    raft::device_span<edge_t> counts,
-                    bool do_expensive_check = false);
+std::tuple<size_t,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>>>
+k_clique_count(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+               size_t k,
+               bool compute_vertex_counts = false,
+               bool compute_edge_counts   = false,
+               bool do_expensive_check    = false);
 
 /**
-.* @ingroup community_cpp
- * @brief Compute edge triangle counts.
+ * @ingroup community_cpp
+ * @brief Connected 4-node graphlet types.
+ */
+enum class four_node_graphlet_t {
+  PATH = 0,         // 3-path
+  STAR,             // 3-star
+  CYCLE,            // 4-cycle
+  TAILED_TRIANGLE,  // triangle with a pendant edge
+  DIAMOND,          // 4-clique minus an edge
+  CLIQUE,           // 4-clique
+  NUM_TYPES
+};
+
+/**
+ * @ingroup community_cpp
+ * @brief Count connected 4-node graphlets.
  *
- * Compute edge triangle counts for the entire set of edges.
+ * The non-induced counts are computed from the degrees, the per-vertex and per-edge triangle
+ * counts, the 4-clique count (from k_clique_count), and the 4-cycle count (from degree-ordered
+ * wedge enumeration). The induced counts are derived from the non-induced counts by subtracting
+ * the copies of every graphlet embedded in the denser graphlets. Self-loops are ignored.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object.
- *  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
- * `true`).
- *
- * @return edge_property_t containing the edge triangle count
+ * @param graph_view Graph view object. Should be symmetric and should not be a multi-graph.
+ * @param induced Flag to return the induced (if true) or non-induced (if false) graphlet counts.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Graphlet counts indexed by four_node_graphlet_t.
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
-edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> edge_triangle_count(
+std::array<size_t, static_cast<size_t>(four_node_graphlet_t::NUM_TYPES)> four_node_graphlet_count(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool induced            = true,
   bool do_expensive_check = false);
 
 /**
@@ -1921,6 +4113,31 @@ k_truss(raft::handle_t const& handle,
         edge_t k,
         bool do_expensive_check = false);
 
+/**
+.* @ingroup community_cpp
+ * @brief Compute truss numbers.
+ *
+ * Compute the truss number of every edge (i.e. the largest k such that the edge belongs to the
+ * K-Truss subgraph). Edge triangle counts are computed once, and the graph is peeled for k = 3, 4,
+ * ...; when an edge is removed, only the triangle counts of the other two edges of the triangles
+ * the edge belongs to are updated. Self-loops have the truss number of 0 and edges that do not
+ * belong to any triangle have the truss number of 2.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return edge_property_t containing the truss numbers
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> truss_number(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
 /**
 .* @ingroup similarity_cpp
  * @brief     Compute Jaccard similarity coefficient
@@ -2053,7 +4270,211 @@ rmm::device_uvector<weight_t> overlap_coefficients(
 
 /**
 .* @ingroup similarity_cpp
- * @brief     Compute Jaccard all pairs similarity coefficient
+ * @brief     Compute Jaccard all pairs similarity coefficient
+ *
+ * Similarity is computed for all pairs of vertices.  Note that in a sparse
+ * graph, many of the vertex pairs will have a score of zero.  We actually
+ * compute similarity only for vertices that are two hop neighbors within
+ * the graph, since vertices that are not two hop neighbors will have
+ * a score of 0.
+ *
+ * If @p vertices is specified we will compute similarity on two hop
+ * neighbors the @p vertices.  If @p vertices is not specified it will
+ * compute similarity on all two hop neighbors in the graph.
+ *
+ * If @p topk is specified only the top @p topk scoring vertex pairs
+ * will be returned, if not specified then scores for all computed vertex pairs
+ * will be returned.
+ *
+ * Note the list of two hop neighbors in the entire graph might be a large
+ * number of vertex pairs.  If the graph is dense enough it could be as large
+ * as the the number of vertices squared, which might run out of memory.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param vertices optional device span defining the seed vertices. In a multi-gpu context the
+ * vertices should be local to this GPU.
+ * @param topk optional specification of the how many of the top scoring vertex pairs should be
+ * returned
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
+ * elements in the vectors identify a result, v1 identifying a vertex in the graph, v2 identifying
+ * one of v1's two hop neighors, and the score identifying the similarity score between v1 and v2.
+ * If @p topk was specified then the vectors will be no longer than @p topk elements.  In a
+ * multi-gpu context, if @p topk is specified all results will return on GPU rank 0, otherwise they
+ * will be returned on the local GPU for vertex v1.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  jaccard_all_pairs_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    std::optional<size_t> topk,
+    bool do_expensive_check = false);
+
+/**
+.* @ingroup similarity_cpp
+ * @brief     Compute Jaccard similarity coefficient of the top scoring two hop neighbors of each
+ * vertex
+ *
+ * Similarity is computed between each seed vertex and its two hop neighbors (vertices that are not
+ * two hop neighbors have a score of 0), and the @p topk_per_vertex top scoring two hop neighbors of
+ * each seed vertex are returned. Unlike jaccard_all_pairs_coefficients, the seed vertices are
+ * processed in chunks and only the top scoring vertex pairs of each seed vertex are retained, so
+ * the memory footprint is bounded by the number of seed vertices times @p topk_per_vertex (plus a
+ * chunk of vertex pairs) instead of the total number of two hop neighbor pairs.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param vertices optional device span defining the seed vertices (all the vertices if not
+ * specified). In a multi-gpu context the vertices should be local to this GPU.
+ * @param topk_per_vertex maximum number of top scoring vertex pairs to return for each seed vertex
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
+ * elements in the vectors identify a result, v1 identifying a seed vertex, v2 identifying one of
+ * v1's two hop neighors, and the score identifying the similarity score between v1 and v2. The
+ * results are grouped by v1 and sorted by score in descending order within each group (ties are
+ * broken by v2). In a multi-gpu context, the results are returned on the local GPU for vertex v1.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  jaccard_per_vertex_topk_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    size_t topk_per_vertex,
+    bool do_expensive_check = false);
+
+/**
+.* @ingroup similarity_cpp
+ * @brief     Compute Consine all pairs similarity coefficient
+ *
+ * Similarity is computed for all pairs of vertices.  Note that in a sparse
+ * graph, many of the vertex pairs will have a score of zero.  We actually
+ * compute similarity only for vertices that are two hop neighbors within
+ * the graph, since vertices that are not two hop neighbors will have
+ * a score of 0.
+ *
+ * If @p vertices is specified we will compute similarity on two hop
+ * neighbors the @p vertices.  If @p vertices is not specified it will
+ * compute similarity on all two hop neighbors in the graph.
+ *
+ * If @p topk is specified only the top @p topk scoring vertex pairs
+ * will be returned, if not specified then scores for all computed vertex pairs
+ * will be returned.
+ *
+ * Note the list of two hop neighbors in the entire graph might be a large
+ * number of vertex pairs.  If the graph is dense enough it could be as large
+ * as the the number of vertices squared, which might run out of memory.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param vertices optional device span defining the seed vertices. In a multi-gpu context the
+ * vertices should be local to this GPU.
+ * @param topk optional specification of the how many of the top scoring vertex pairs should be
+ * returned
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
+ * elements in the vectors identify a result, v1 identifying a vertex in the graph, v2 identifying
+ * one of v1's two hop neighors, and the score identifying the similarity score between v1 and v2.
+ * If @p topk was specified then the vectors will be no longer than @p topk elements.  In a
+ * multi-gpu context, if @p topk is specified all results will return on GPU rank 0, otherwise they
+ * will be returned on the local GPU for vertex v1.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  cosine_similarity_all_pairs_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    std::optional<size_t> topk,
+    bool do_expensive_check = false);
+
+/**
+.* @ingroup similarity_cpp
+ * @brief     Compute Cosine similarity coefficient of the top scoring two hop neighbors of each
+ * vertex
+ *
+ * Similarity is computed between each seed vertex and its two hop neighbors (vertices that are not
+ * two hop neighbors have a score of 0), and the @p topk_per_vertex top scoring two hop neighbors of
+ * each seed vertex are returned. Unlike cosine_similarity_all_pairs_coefficients, the seed vertices
+ * are processed in chunks and only the top scoring vertex pairs of each seed vertex are retained,
+ * so the memory footprint is bounded by the number of seed vertices times @p topk_per_vertex (plus
+ * a chunk of vertex pairs) instead of the total number of two hop neighbor pairs.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param vertices optional device span defining the seed vertices (all the vertices if not
+ * specified). In a multi-gpu context the vertices should be local to this GPU.
+ * @param topk_per_vertex maximum number of top scoring vertex pairs to return for each seed vertex
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
+ * elements in the vectors identify a result, v1 identifying a seed vertex, v2 identifying one of
+ * v1's two hop neighors, and the score identifying the similarity score between v1 and v2. The
+ * results are grouped by v1 and sorted by score in descending order within each group (ties are
+ * broken by v2). In a multi-gpu context, the results are returned on the local GPU for vertex v1.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  cosine_similarity_per_vertex_topk_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    size_t topk_per_vertex,
+    bool do_expensive_check = false);
+
+/**
+.* @ingroup similarity_cpp
+ * @brief     Compute Sorensen similarity coefficient
  *
  * Similarity is computed for all pairs of vertices.  Note that in a sparse
  * graph, many of the vertex pairs will have a score of zero.  We actually
@@ -2085,8 +4506,7 @@ rmm::device_uvector<weight_t> overlap_coefficients(
  * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
  * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
  * a weight of 1 for all edges.
- * @param vertices optional device span defining the seed vertices. In a multi-gpu context the
- * vertices should be local to this GPU.
+ * @param vertices optional device span defining the seed vertices.
  * @param topk optional specification of the how many of the top scoring vertex pairs should be
  * returned
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
@@ -2100,7 +4520,7 @@ rmm::device_uvector<weight_t> overlap_coefficients(
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
-  jaccard_all_pairs_coefficients(
+  sorensen_all_pairs_coefficients(
     raft::handle_t const& handle,
     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
     std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
@@ -2110,25 +4530,15 @@ std::
 
 /**
 .* @ingroup similarity_cpp
- * @brief     Compute Consine all pairs similarity coefficient
- *
- * Similarity is computed for all pairs of vertices.  Note that in a sparse
- * graph, many of the vertex pairs will have a score of zero.  We actually
- * compute similarity only for vertices that are two hop neighbors within
- * the graph, since vertices that are not two hop neighbors will have
- * a score of 0.
- *
- * If @p vertices is specified we will compute similarity on two hop
- * neighbors the @p vertices.  If @p vertices is not specified it will
- * compute similarity on all two hop neighbors in the graph.
- *
- * If @p topk is specified only the top @p topk scoring vertex pairs
- * will be returned, if not specified then scores for all computed vertex pairs
- * will be returned.
+ * @brief     Compute Sorensen similarity coefficient of the top scoring two hop neighbors of each
+ * vertex
  *
- * Note the list of two hop neighbors in the entire graph might be a large
- * number of vertex pairs.  If the graph is dense enough it could be as large
- * as the the number of vertices squared, which might run out of memory.
+ * Similarity is computed between each seed vertex and its two hop neighbors (vertices that are not
+ * two hop neighbors have a score of 0), and the @p topk_per_vertex top scoring two hop neighbors of
+ * each seed vertex are returned. Unlike sorensen_all_pairs_coefficients, the seed vertices are
+ * processed in chunks and only the top scoring vertex pairs of each seed vertex are retained, so
+ * the memory footprint is bounded by the number of seed vertices times @p topk_per_vertex (plus a
+ * chunk of vertex pairs) instead of the total number of two hop neighbor pairs.
  *
  * @throws                 cugraph::logic_error when an error occurs.
  *
@@ -2142,32 +4552,30 @@ std::
  * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
  * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
  * a weight of 1 for all edges.
- * @param vertices optional device span defining the seed vertices. In a multi-gpu context the
- * vertices should be local to this GPU.
- * @param topk optional specification of the how many of the top scoring vertex pairs should be
- * returned
+ * @param vertices optional device span defining the seed vertices (all the vertices if not
+ * specified). In a multi-gpu context the vertices should be local to this GPU.
+ * @param topk_per_vertex maximum number of top scoring vertex pairs to return for each seed vertex
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
- * elements in the vectors identify a result, v1 identifying a vertex in the graph, v2 identifying
- * one of v1's two hop neighors, and the score identifying the similarity score between v1 and v2.
- * If @p topk was specified then the vectors will be no longer than @p topk elements.  In a
- * multi-gpu context, if @p topk is specified all results will return on GPU rank 0, otherwise they
- * will be returned on the local GPU for vertex v1.
+ * elements in the vectors identify a result, v1 identifying a seed vertex, v2 identifying one of
+ * v1's two hop neighors, and the score identifying the similarity score between v1 and v2. The
+ * results are grouped by v1 and sorted by score in descending order within each group (ties are
+ * broken by v2). In a multi-gpu context, the results are returned on the local GPU for vertex v1.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
-  cosine_similarity_all_pairs_coefficients(
+  sorensen_per_vertex_topk_coefficients(
     raft::handle_t const& handle,
     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
     std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
     std::optional<raft::device_span<vertex_t const>> vertices,
-    std::optional<size_t> topk,
+    size_t topk_per_vertex,
     bool do_expensive_check = false);
 
 /**
 .* @ingroup similarity_cpp
- * @brief     Compute Sorensen similarity coefficient
+ * @brief     Compute overlap similarity coefficient
  *
  * Similarity is computed for all pairs of vertices.  Note that in a sparse
  * graph, many of the vertex pairs will have a score of zero.  We actually
@@ -2213,7 +4621,7 @@ std::
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
-  sorensen_all_pairs_coefficients(
+  overlap_all_pairs_coefficients(
     raft::handle_t const& handle,
     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
     std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
@@ -2223,25 +4631,15 @@ std::
 
 /**
 .* @ingroup similarity_cpp
- * @brief     Compute overlap similarity coefficient
- *
- * Similarity is computed for all pairs of vertices.  Note that in a sparse
- * graph, many of the vertex pairs will have a score of zero.  We actually
- * compute similarity only for vertices that are two hop neighbors within
- * the graph, since vertices that are not two hop neighbors will have
- * a score of 0.
+ * @brief     Compute Overlap similarity coefficient of the top scoring two hop neighbors of each
+ * vertex
  *
- * If @p vertices is specified we will compute similarity on two hop
- * neighbors the @p vertices.  If @p vertices is not specified it will
- * compute similarity on all two hop neighbors in the graph.
- *
- * If @p topk is specified only the top @p topk scoring vertex pairs
- * will be returned, if not specified then scores for all computed vertex pairs
- * will be returned.
- *
- * Note the list of two hop neighbors in the entire graph might be a large
- * number of vertex pairs.  If the graph is dense enough it could be as large
- * as the the number of vertices squared, which might run out of memory.
+ * Similarity is computed between each seed vertex and its two hop neighbors (vertices that are not
+ * two hop neighbors have a score of 0), and the @p topk_per_vertex top scoring two hop neighbors of
+ * each seed vertex are returned. Unlike overlap_all_pairs_coefficients, the seed vertices are
+ * processed in chunks and only the top scoring vertex pairs of each seed vertex are retained, so
+ * the memory footprint is bounded by the number of seed vertices times @p topk_per_vertex (plus a
+ * chunk of vertex pairs) instead of the total number of two hop neighbor pairs.
  *
  * @throws                 cugraph::logic_error when an error occurs.
  *
@@ -2255,26 +4653,238 @@ std::
  * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
  * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
  * a weight of 1 for all edges.
- * @param vertices optional device span defining the seed vertices.
- * @param topk optional specification of the how many of the top scoring vertex pairs should be
- * returned
+ * @param vertices optional device span defining the seed vertices (all the vertices if not
+ * specified). In a multi-gpu context the vertices should be local to this GPU.
+ * @param topk_per_vertex maximum number of top scoring vertex pairs to return for each seed vertex
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  * @return tuple containing three device vectors (v1, v2, score) of the same length.  Corresponding
- * elements in the vectors identify a result, v1 identifying a vertex in the graph, v2 identifying
- * one of v1's two hop neighors, and the score identifying the similarity score between v1 and v2.
- * If @p topk was specified then the vectors will be no longer than @p topk elements.  In a
- * multi-gpu context, if @p topk is specified all results will return on GPU rank 0, otherwise they
- * will be returned on the local GPU for vertex v1.
+ * elements in the vectors identify a result, v1 identifying a seed vertex, v2 identifying one of
+ * v1's two hop neighors, and the score identifying the similarity score between v1 and v2. The
+ * results are grouped by v1 and sorted by score in descending order within each group (ties are
+ * broken by v2). In a multi-gpu context, the results are returned on the local GPU for vertex v1.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
-  overlap_all_pairs_coefficients(
+  overlap_per_vertex_topk_coefficients(
     raft::handle_t const& handle,
     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
     std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
     std::optional<raft::device_span<vertex_t const>> vertices,
-    std::optional<size_t> topk,
+    size_t topk_per_vertex,
+    bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Compute MinHash sketches of the vertex neighborhoods
+ *
+ * One permutation hashing is used: every neighbor is hashed once, the hash value selects one of
+ * the @p sketch_size bins and each bin keeps the minimum hash value hashed into the bin. Sketches
+ * are mergeable with an element-wise minimum, so a sketch can be updated in place when edges are
+ * added (see update_minhash_sketches). Edge weights are ignored.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sketch_size Number of bins in each vertex's sketch (the estimation error decreases as
+ * O(1/sqrt(sketch_size))).
+ * @param seed Hash function seed, sketches should be built and updated with the same seed to be
+ * comparable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Vertex property of the local vertex partition range size times @p sketch_size elements;
+ * the sketch of the i'th local vertex is stored in [i * @p sketch_size, (i + 1) * @p sketch_size)
+ * and empty bins hold std::numeric_limits<uint64_t>::max().
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<uint64_t> compute_minhash_sketches(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t sketch_size,
+  uint64_t seed,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Update MinHash sketches with new edges
+ *
+ * Edge (src, dst) adds dst to the neighborhood of src. For an undirected graph, the caller should
+ * provide both (src, dst) and (dst, src). The new edges should be between vertices of @p
+ * graph_view (the sketch of a new vertex requires rebuilding the sketches for a larger vertex
+ * range). Removing edges is not supported (a removed neighbor may hold the minimum of its bin).
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (this defines the vertex partitioning of @p sketches).
+ * @param sketches Sketches returned by compute_minhash_sketches, updated in place.
+ * @param sketch_size Number of bins in each vertex's sketch.
+ * @param seed Hash function seed used to build @p sketches.
+ * @param edge_srcs Source vertex IDs of the new edges (can be on any GPU in multi-GPU).
+ * @param edge_dsts Destination vertex IDs of the new edges.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void update_minhash_sketches(raft::handle_t const& handle,
+                             graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                             raft::device_span<uint64_t> sketches,
+                             size_t sketch_size,
+                             uint64_t seed,
+                             raft::device_span<vertex_t const> edge_srcs,
+                             raft::device_span<vertex_t const> edge_dsts,
+                             bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Estimate Jaccard similarity coefficients from MinHash sketches
+ *
+ * Each pair is estimated in O(@p sketch_size) (independent of the vertex degrees) as the fraction
+ * of the bins holding the same minimum among the bins that are not empty in both sketches.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of the returned coefficients. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sketches Sketches returned by compute_minhash_sketches.
+ * @param sketch_size Number of bins in each vertex's sketch.
+ * @param vertex_pairs tuple of device spans defining the vertex pairs to compute coefficients for.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Device vector of the estimated coefficients (one per vertex pair).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> approx_jaccard_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<vertex_t const>> vertex_pairs,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Estimate Sorensen similarity coefficients from MinHash sketches
+ *
+ * The Sorensen coefficient is derived from the estimated Jaccard coefficient J as 2J / (1 + J).
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of the returned coefficients. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sketches Sketches returned by compute_minhash_sketches.
+ * @param sketch_size Number of bins in each vertex's sketch.
+ * @param vertex_pairs tuple of device spans defining the vertex pairs to compute coefficients for.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Device vector of the estimated coefficients (one per vertex pair).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> approx_sorensen_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<vertex_t const>> vertex_pairs,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Compute item-item Jaccard similarity coefficients of a bipartite graph
+ *
+ * The input graph stores a user-item bipartite graph as an undirected graph. The co-occurrences of
+ * the @p items are computed as a sparse A^T A product over the user-item adjacency A (every user
+ * pairs the items in its neighbor list) with per-item hash tables, instead of enumerating the
+ * two-hop vertex pairs and intersecting the neighbor lists of every pair. Seed items are processed
+ * in batches of bounded two-hop degree sums to bound the memory footprint. The scores coincide
+ * with jaccard_coefficients on the returned pairs.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the (undirected) user-item graph.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param items Seed items to compute the similarity scores for (in multi-GPU, the items should be
+ * in the local vertex partition range).
+ * @param topk_per_item Optional, if specified only the @p topk_per_item highest scoring pairs of
+ * every seed item are returned (ties are broken by the smaller second vertex ID).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing the seed items, the items co-occurring with the seed items (the two-hop
+ * neighbors excluding the seed itself) and the similarity scores.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  jaccard_bipartite_projection_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> items,
+    std::optional<size_t> topk_per_item,
+    bool do_expensive_check = false);
+
+/**
+ * @ingroup similarity_cpp
+ * @brief     Compute item-item cosine similarity coefficients of a bipartite graph
+ *
+ * The input graph stores a user-item bipartite graph as an undirected graph. The co-occurrences of
+ * the @p items are computed as a sparse A^T A product over the user-item adjacency A (every user
+ * pairs the items in its neighbor list) with per-item hash tables, instead of enumerating the
+ * two-hop vertex pairs and intersecting the neighbor lists of every pair. Seed items are processed
+ * in batches of bounded two-hop degree sums to bound the memory footprint. The scores coincide
+ * with cosine_similarity_coefficients on the returned pairs.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the (undirected) user-item graph.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view. If @p
+ * edge_weight_view.has_value() == true, use the weights associated with the graph. If false, assume
+ * a weight of 1 for all edges.
+ * @param items Seed items to compute the similarity scores for (in multi-GPU, the items should be
+ * in the local vertex partition range).
+ * @param topk_per_item Optional, if specified only the @p topk_per_item highest scoring pairs of
+ * every seed item are returned (ties are broken by the smaller second vertex ID).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple containing the seed items, the items co-occurring with the seed items (the two-hop
+ * neighbors excluding the seed itself) and the similarity scores.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  cosine_bipartite_projection_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> items,
+    std::optional<size_t> topk_per_item,
     bool do_expensive_check = false);
 
 /*
@@ -2307,6 +4917,109 @@ std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> k_hop_nbr
   size_t k,
   bool do_expensive_check = false);
 
+/**
+ * @brief Type of the callback receiving each hop's output from k_hop_nbrs_streamed.
+ *
+ * The arguments are the hop (1 to K), the indices of the start vertices (in the start vertex
+ * array local to this GPU), and the neighbors newly reached at this hop (paired with the start
+ * vertex indices, sorted by (start vertex index, neighbor)). The device spans are valid only until
+ * the callback returns.
+ */
+template <typename vertex_t>
+struct k_hop_nbrs_callback {
+  using type = std::function<void(
+    size_t, raft::device_span<size_t const>, raft::device_span<vertex_t const>)>;
+};
+
+/*
+.* @ingroup utility_cpp
+ * @brief Enumerate the vertices within K hops hop by hop, streaming each hop's output
+ *
+ * Unlike k_hop_nbrs (which returns the vertices reachable by walks of exactly K hops and holds them
+ * in device memory), this tracks the vertices visited from each start vertex (as a bitmap for a
+ * small number of start vertices and as a hash set otherwise) and reports every vertex within K
+ * hops once, at its hop distance from the start vertex (the start vertex itself is not reported).
+ * Each hop's (start vertex index, neighbor) pairs are passed to @p hop_callback and released before
+ * the next hop, so the peak memory footprint is set by the largest hop and the visited sets
+ * instead of the total output. The iteration stops early (before K hops) if no new vertex is
+ * reached.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param start_vertices Find K-hop neighbors from each vertex in @p start_vertices.
+ * @param k Number of hops to make to enumerate neighbors.
+ * @param hop_callback Callback invoked (on every GPU in a multi-GPU context) after each hop with
+ * the hop, the start vertex indices, and the newly reached neighbors.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void k_hop_nbrs_streamed(raft::handle_t const& handle,
+                         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                         raft::device_span<vertex_t const> start_vertices,
+                         size_t k,
+                         typename k_hop_nbrs_callback<vertex_t>::type const& hop_callback,
+                         bool do_expensive_check = false);
+
+/*
+.* @ingroup utility_cpp
+ * @brief Compute upper bounds of the number of two-hop neighbors
+ *
+ * The bound for a start vertex is the number of two-hop walks from the vertex (the sum of the
+ * out-degrees of its out-neighbors), this is also the number of intermediate (start vertex,
+ * neighbor) pairs k_hop_nbrs generates for the vertex with k = 2. This can be used to size output
+ * buffers or to choose start vertex batches before enumerating two-hop neighbors.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param start_vertices Start vertices (local to this GPU in a multi-GPU context).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Upper bounds of the number of two-hop neighbors (one per element of @p start_vertices).
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<size_t> two_hop_nbr_count_upper_bounds(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> start_vertices,
+  bool do_expensive_check = false);
+
+/*
+.* @ingroup utility_cpp
+ * @brief Enumerate two-hop neighbors in memory bounded chunks
+ *
+ * This returns the same output as k_hop_nbrs with k = 2, but processes the start vertices in
+ * consecutive chunks whose two_hop_nbr_count_upper_bounds sum does not exceed @p max_chunk_size (a
+ * chunk with a single start vertex may exceed the limit), bounding the intermediate memory
+ * footprint by the caller's budget instead of the total number of two-hop walks.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param start_vertices Find two-hop neighbors from each vertex in @p start_vertices.
+ * @param max_chunk_size Maximum number of two-hop walks (intermediate (start vertex, neighbor)
+ * pairs) to process at a time.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of two arrays: offsets (size = @p start_vertices.size() + 1) and two-hop neighbors,
+ * in the same format as k_hop_nbrs.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> two_hop_nbrs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_chunk_size,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup tree_cpp
  * @brief Find a Maximal Independent Set
@@ -2326,6 +5039,23 @@ rmm::device_uvector<vertex_t> maximal_independent_set(
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   raft::random::RngState& rng_state);
 
+/**
+ * @brief Vertex coloring method
+ *
+ * maximal_independent_set colors one maximal independent set per round, so the number of rounds
+ * equals the number of colors. speculative_first_fit colors all the uncolored vertices in every
+ * round with the smallest color not used by their neighbors (per-vertex forbidden color bitmaps)
+ * and uncolors the lower priority (pseudo-random) endpoint of every edge whose endpoints picked the
+ * same color for the next round, which typically takes far fewer rounds than colors.
+ * speculative_largest_first prioritizes higher degree vertices in resolving the conflicts (and
+ * tends to use fewer colors). The speculative methods require a symmetric graph.
+ */
+enum class vertex_coloring_method_t {
+  maximal_independent_set,
+  speculative_first_fit,
+  speculative_largest_first
+};
+
 /**
  * @ingroup utility_cpp
  * @brief Find a Greedy Vertex Coloring
@@ -2334,7 +5064,8 @@ rmm::device_uvector<vertex_t> maximal_independent_set(
  * no two adjacent vertices have the same color or label. Finding the minimum number of colors
  * needed to color the vertices of a graph is an NP-hard problem and therefore for practical
  * use cases greedy coloring is used. Here we provide an implementation of greedy vertex
- * coloring based on maximal independent set.
+ * coloring based on maximal independent set and speculative (first-fit) greedy coloring with
+ * conflict resolution.
  * See
  * https://research.nvidia.com/sites/default/files/pubs/2015-05_Parallel-Graph-Coloring/nvr-2015-001.pdf
  * for further information.
@@ -2346,13 +5077,15 @@ rmm::device_uvector<vertex_t> maximal_independent_set(
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Graph view object.
  * @param rng_state The RngState instance holding pseudo-random number generator state.
+ * @param method The coloring method (see vertex_coloring_method_t).
  * @return A device vector containing color for each vertex.
  */
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 rmm::device_uvector<vertex_t> vertex_coloring(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-  raft::random::RngState& rng_state);
+  raft::random::RngState& rng_state,
+  vertex_coloring_method_t method = vertex_coloring_method_t::maximal_independent_set);
 
 /**
 .* @ingroup utility_cpp
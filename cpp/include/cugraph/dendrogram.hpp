@@ -36,6 +36,14 @@ class Dendrogram {
     level_first_index_.push_back(first_index);
   }
 
+  // Free the device memory of a level that is no longer needed (e.g. already folded into the
+  // flattened clustering), the level still counts in num_levels() but is empty afterwards.
+  void release_level(size_t level, rmm::cuda_stream_view stream_view)
+  {
+    level_ptr_[level]->resize(0, stream_view);
+    level_ptr_[level]->shrink_to_fit(stream_view);
+  }
+
   size_t current_level() const { return level_ptr_.size() - 1; }
 
   size_t num_levels() const { return level_ptr_.size(); }
@@ -44,6 +44,39 @@ rmm::device_uvector<T> device_allgatherv(raft::handle_t const& handle,
                                          raft::comms::comms_t const& comm,
                                          raft::device_span<T const> d_input);
 
+/**
+ * @ingroup collect_comm_wrapper_cpp
+ * @brief Gather the span of data from all ranks (or to a root rank) into a caller-provided buffer
+ * in bounded size rounds.
+ *
+ * Unlike device_allgatherv, the combined data is never materialized in device memory. Every round
+ * gathers up to @p max_chunk_size elements from each rank into a device staging buffer and copies
+ * them to @p output, so the temporary device memory is bounded by the comm size times
+ * @p max_chunk_size elements.
+ *
+ * @param[in] handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+ * and handles to various CUDA libraries) to run graph algorithms.
+ * @param[in] comm Raft comms that manages underlying NCCL comms handles across the ranks.
+ * @param[in] d_input The span of data to gather.
+ * @param[out] output Pointer to device or host memory to store the combined data (in rank order).
+ * With pinned host memory, the copies from the staging buffer are asynchronous. Ignored on the
+ * ranks other than @p root if @p root is set.
+ * @param[in] output_size Size of the @p output buffer, should be at least the sum of the input
+ * sizes over the ranks on the receiving ranks.
+ * @param[in] max_chunk_size Maximum number of elements gathered from each rank in a round.
+ * @param[in] root If set, gather to this rank only; otherwise, gather to every rank.
+ *
+ * @return The number of the combined elements (the sum of the input sizes over the ranks).
+ */
+template <typename T>
+size_t device_gatherv_to_buffer(raft::handle_t const& handle,
+                                raft::comms::comms_t const& comm,
+                                raft::device_span<T const> d_input,
+                                T* output,
+                                size_t output_size,
+                                size_t max_chunk_size,
+                                std::optional<int> root);
+
 }  // namespace detail
 }  // namespace cugraph
 /**
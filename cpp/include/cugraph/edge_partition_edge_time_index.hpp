@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cugraph {
+
+// Edge time index layout: the edge time index stores the edge times of an edge partition sorted in
+// non-decreasing order (sorted_times) and the local edge indices in the same order (edge_indices).
+// The edges with times in [t0, t1) are the contiguous range [lower_bound(t0), lower_bound(t1)) of
+// edge_indices, so a time window (and the difference between two time windows) is enumerated
+// without scanning the edges outside the window.
+
+template <typename edge_t, typename edge_time_t>
+class edge_partition_edge_time_index_view_t {
+ public:
+  edge_partition_edge_time_index_view_t(raft::device_span<edge_time_t const> sorted_times,
+                                        raft::device_span<edge_t const> edge_indices)
+    : sorted_times_(sorted_times), edge_indices_(edge_indices)
+  {
+  }
+
+  edge_t number_of_edges() const { return static_cast<edge_t>(edge_indices_.size()); }
+
+  raft::device_span<edge_time_t const> sorted_times() const { return sorted_times_; }
+  raft::device_span<edge_t const> edge_indices() const { return edge_indices_; }
+
+ private:
+  raft::device_span<edge_time_t const> sorted_times_{};
+  raft::device_span<edge_t const> edge_indices_{};
+};
+
+// owning class for the edge time index of an edge partition
+template <typename edge_t, typename edge_time_t>
+class edge_partition_edge_time_index_t {
+ public:
+  edge_partition_edge_time_index_t(rmm::device_uvector<edge_time_t>&& sorted_times,
+                                   rmm::device_uvector<edge_t>&& edge_indices)
+    : sorted_times_(std::move(sorted_times)), edge_indices_(std::move(edge_indices))
+  {
+  }
+
+  edge_t number_of_edges() const { return static_cast<edge_t>(edge_indices_.size()); }
+
+  edge_partition_edge_time_index_view_t<edge_t, edge_time_t> view() const
+  {
+    return edge_partition_edge_time_index_view_t<edge_t, edge_time_t>(
+      raft::device_span<edge_time_t const>(sorted_times_.data(), sorted_times_.size()),
+      raft::device_span<edge_t const>(edge_indices_.data(), edge_indices_.size()));
+  }
+
+ private:
+  rmm::device_uvector<edge_time_t> sorted_times_;
+  rmm::device_uvector<edge_t> edge_indices_;
+};
+
+/**
+ * @brief Build the edge time index of every local edge partition of a graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge times. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to index. The edge mask (if attached) is
+ * ignored.
+ * @param edge_time_view View object holding edge times (e.g. edge start times) for @p graph_view.
+ * @return Edge time index of the local edge partitions (one element per local edge partition).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>>
+build_edge_partition_edge_time_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view);
+
+/**
+ * @brief Create an edge mask selecting the edges with times in [@p window_start, @p window_end).
+ *
+ * Attach the returned mask to @p graph_view (graph_view_t::attach_edge_mask) to run the existing
+ * algorithms on the time window without reconstructing the graph. Besides clearing the mask
+ * buffer, this function visits only the edges in the window.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge times. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object the edge time index was built on.
+ * @param edge_time_indices Edge time index of the local edge partitions (the return value of
+ * build_edge_partition_edge_time_index).
+ * @param window_start Start time of the window (inclusive).
+ * @param window_end End time of the window (exclusive).
+ * @return Edge mask selecting the edges in the window.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
+create_edge_time_window_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>> const& edge_time_indices,
+  edge_time_t window_start,
+  edge_time_t window_end);
+
+/**
+ * @brief Slide an edge time window mask from [@p old_window_start, @p old_window_end) to
+ * [@p new_window_start, @p new_window_end).
+ *
+ * Only the edges in the symmetric difference of the two windows are visited, so sliding a window
+ * by a small step costs time proportional to the number of edges entering and leaving the window.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge times. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object the edge time index was built on.
+ * @param edge_time_indices Edge time index of the local edge partitions (the return value of
+ * build_edge_partition_edge_time_index).
+ * @param edge_mask_view Mutable view of an edge mask selecting exactly the edges in
+ * [@p old_window_start, @p old_window_end) (e.g. created by create_edge_time_window_mask). Updated
+ * in-place to select the edges in [@p new_window_start, @p new_window_end).
+ * @param old_window_start Start time of the current window (inclusive).
+ * @param old_window_end End time of the current window (exclusive).
+ * @param new_window_start Start time of the new window (inclusive).
+ * @param new_window_end End time of the new window (exclusive).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+void update_edge_time_window_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>> const& edge_time_indices,
+  edge_property_view_t<edge_t, uint32_t*, bool> edge_mask_view,
+  edge_time_t old_window_start,
+  edge_time_t old_window_end,
+  edge_time_t new_window_start,
+  edge_time_t new_window_end);
+
+}  // namespace cugraph
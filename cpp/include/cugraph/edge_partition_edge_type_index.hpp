@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cugraph {
+
+// Edge type index layout: the edges of each major vertex are stored sorted by minor vertex IDs (and
+// this order is required by the neighbor intersection and edge existence primitives), so the edges
+// of a specific type are scattered in the major vertex's neighbor list. The edge type index stores
+// the local edge indices of an edge partition grouped by (major, type) (edge_indices) and the
+// per-(major, type) offsets into edge_indices (type_offsets, size = (# major indices) *
+// num_edge_types + 1, the major indexing is identical to the edge partition's offsets including the
+// hypersparse segment). The edges of a given (major, type) pair are visited without scanning the
+// edges of the other types.
+
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+class edge_partition_edge_type_index_view_t {
+ public:
+  edge_partition_edge_type_index_view_t(raft::device_span<edge_t const> type_offsets,
+                                        raft::device_span<edge_t const> edge_indices,
+                                        edge_type_t num_edge_types)
+    : type_offsets_(type_offsets), edge_indices_(edge_indices), num_edge_types_(num_edge_types)
+  {
+  }
+
+  edge_t number_of_edges() const { return static_cast<edge_t>(edge_indices_.size()); }
+  edge_type_t number_of_edge_types() const { return num_edge_types_; }
+
+  raft::device_span<edge_t const> type_offsets() const { return type_offsets_; }
+  raft::device_span<edge_t const> edge_indices() const { return edge_indices_; }
+
+ private:
+  raft::device_span<edge_t const> type_offsets_{};
+  raft::device_span<edge_t const> edge_indices_{};
+  edge_type_t num_edge_types_{0};
+};
+
+// owning class for the edge type index of an edge partition
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+class edge_partition_edge_type_index_t {
+ public:
+  edge_partition_edge_type_index_t(rmm::device_uvector<edge_t>&& type_offsets,
+                                   rmm::device_uvector<edge_t>&& edge_indices,
+                                   edge_type_t num_edge_types)
+    : type_offsets_(std::move(type_offsets)),
+      edge_indices_(std::move(edge_indices)),
+      num_edge_types_(num_edge_types)
+  {
+  }
+
+  edge_t number_of_edges() const { return static_cast<edge_t>(edge_indices_.size()); }
+  edge_type_t number_of_edge_types() const { return num_edge_types_; }
+
+  edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t> view() const
+  {
+    return edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t>(
+      raft::device_span<edge_t const>(type_offsets_.data(), type_offsets_.size()),
+      raft::device_span<edge_t const>(edge_indices_.data(), edge_indices_.size()),
+      num_edge_types_);
+  }
+
+ private:
+  rmm::device_uvector<edge_t> type_offsets_;
+  rmm::device_uvector<edge_t> edge_indices_;
+  edge_type_t num_edge_types_{0};
+};
+
+/**
+ * @brief Build the edge type index of every local edge partition of a graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to index. The edge mask (if attached) is ignored
+ * (code using the index should check the edge mask with the local edge indices).
+ * @param edge_type_view View object holding edge types for @p graph_view.
+ * @param num_edge_types Number of edge types, edge types should be in [0, @p num_edge_types).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Edge type index of the local edge partitions (one element per local edge partition). Use
+ * edge_partition_edge_type_index_device_view_t to access the edges of a (major, type) pair in
+ * device code.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::vector<edge_partition_edge_type_index_t<vertex_t, edge_t, edge_type_t>>
+build_edge_partition_edge_type_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_type_t const*> edge_type_view,
+  edge_type_t num_edge_types,
+  bool do_expensive_check = false);
+
+}  // namespace cugraph
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_partition_edge_type_index.hpp>
+
+#include <raft/core/device_span.hpp>
+
+#include <thrust/tuple.h>
+
+namespace cugraph {
+
+// type-restricted access to the edges of an edge partition, the local edge indices returned by
+// local_edges index edge_partition_device_view_t::indices() and the edge property values of the
+// edge partition
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+class edge_partition_edge_type_index_device_view_t {
+ public:
+  using vertex_type    = vertex_t;
+  using edge_type      = edge_t;
+  using edge_type_type = edge_type_t;
+
+  edge_partition_edge_type_index_device_view_t(
+    edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t> view)
+    : type_offsets_(view.type_offsets()),
+      edge_indices_(view.edge_indices()),
+      num_edge_types_(view.number_of_edge_types())
+  {
+  }
+
+  __host__ __device__ edge_type_t number_of_edge_types() const { return num_edge_types_; }
+
+  // major_idx is identical to the major_idx of edge_partition_device_view_t, returns the local edge
+  // indices of the edges of the given type and their count
+  __device__ thrust::tuple<edge_t const*, edge_t> local_edges(vertex_t major_idx,
+                                                              edge_type_t type) const noexcept
+  {
+    auto i     = static_cast<size_t>(major_idx) * static_cast<size_t>(num_edge_types_) + type;
+    auto first = type_offsets_[i];
+    return thrust::make_tuple(edge_indices_.data() + first, type_offsets_[i + 1] - first);
+  }
+
+  __device__ edge_t local_degree(vertex_t major_idx, edge_type_t type) const noexcept
+  {
+    auto i = static_cast<size_t>(major_idx) * static_cast<size_t>(num_edge_types_) + type;
+    return type_offsets_[i + 1] - type_offsets_[i];
+  }
+
+ private:
+  raft::device_span<edge_t const> type_offsets_{};
+  raft::device_span<edge_t const> edge_indices_{};
+  edge_type_t num_edge_types_{0};
+};
+
+}  // namespace cugraph
@@ -61,6 +61,7 @@ class edge_partition_endpoint_property_device_view_t {
       key_chunk_start_offsets_ = (*(view.key_chunk_start_offsets()))[partition_idx];
       key_chunk_size_          = *(view.key_chunk_size());
     }
+    if (view.default_value()) { default_value_ = *(view.default_value()); }
     value_first_ = view.value_firsts()[partition_idx];
     range_first_ = view.major_range_firsts()[partition_idx];
   }
@@ -73,13 +74,21 @@ class edge_partition_endpoint_property_device_view_t {
       key_chunk_start_offsets_ = *(view.key_chunk_start_offsets());
       key_chunk_size_          = *(view.key_chunk_size());
     }
+    if (view.default_value()) { default_value_ = *(view.default_value()); }
     value_first_ = view.value_first();
     range_first_ = view.minor_range_first();
   }
 
   __device__ value_t get(vertex_t offset) const
   {
-    auto val_offset = value_offset(offset);
+    vertex_t val_offset{};
+    if (default_value_) {  // sparse, offset may not have a stored value
+      auto found_offset = find_value_offset(offset);
+      if (!found_offset) { return *default_value_; }
+      val_offset = *found_offset;
+    } else {
+      val_offset = value_offset(offset);
+    }
     if constexpr (has_packed_bool_element) {
       static_assert(is_packed_bool, "unimplemented for thrust::tuple types.");
       auto mask = cugraph::packed_bool_mask(val_offset);
@@ -183,11 +192,25 @@ class edge_partition_endpoint_property_device_view_t {
     return cugraph::elementwise_atomic_max(value_first_ + val_offset, val);
   }
 
+  // apply a custom atomic update (atomic_op(value_iterator, val), e.g. a different atomic operation
+  // per thrust tuple element) to the value stored for offset
+  template <typename AtomicOp, typename Iter = ValueIterator, typename T = value_t>
+  __device__ std::enable_if_t<
+    !std::is_const_v<std::remove_reference_t<typename std::iterator_traits<Iter>::reference>> &&
+      !cugraph::has_packed_bool_element<Iter, T>() /* undefined for (packed-)bool */,
+    void>
+  atomic_apply(vertex_t offset, value_t val, AtomicOp atomic_op) const
+  {
+    auto val_offset = value_offset(offset);
+    atomic_op(value_first_ + val_offset, val);
+  }
+
  private:
   cuda::std::optional<raft::device_span<vertex_t const>> keys_{cuda::std::nullopt};
   cuda::std::optional<raft::device_span<vertex_t const>> key_chunk_start_offsets_{
     cuda::std::nullopt};
   cuda::std::optional<size_t> key_chunk_size_{cuda::std::nullopt};
+  cuda::std::optional<value_t> default_value_{cuda::std::nullopt};
 
   ValueIterator value_first_{};
   vertex_t range_first_{};
@@ -209,6 +232,20 @@ class edge_partition_endpoint_property_device_view_t {
     }
     return val_offset;
   }
+
+  __device__ cuda::std::optional<vertex_t> find_value_offset(vertex_t offset) const
+  {
+    auto chunk_idx = static_cast<size_t>(offset) / (*key_chunk_size_);
+    auto it        = thrust::lower_bound(thrust::seq,
+                                  (*keys_).begin() + (*key_chunk_start_offsets_)[chunk_idx],
+                                  (*keys_).begin() + (*key_chunk_start_offsets_)[chunk_idx + 1],
+                                  range_first_ + offset);
+    if ((it == (*keys_).begin() + (*key_chunk_start_offsets_)[chunk_idx + 1]) ||
+        (*it != (range_first_ + offset))) {
+      return cuda::std::nullopt;
+    }
+    return static_cast<vertex_t>(thrust::distance((*keys_).begin(), it));
+  }
 };
 
 template <typename vertex_t>
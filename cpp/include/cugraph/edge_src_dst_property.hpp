@@ -24,11 +24,14 @@
 #include <raft/core/handle.hpp>
 #include <raft/core/host_span.hpp>
 
+#include <rmm/device_uvector.hpp>
+
 #include <cuda/std/optional>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 
+#include <memory>
 #include <optional>
 #include <type_traits>
 
@@ -79,6 +82,23 @@ class edge_major_property_view_t {
   {
   }
 
+  // sparse: vertices not in edge_partition_keys take default_value
+  edge_major_property_view_t(
+    raft::host_span<raft::device_span<vertex_t const> const> edge_partition_keys,
+    raft::host_span<raft::device_span<vertex_t const> const> edge_partition_key_chunk_start_offsets,
+    size_t key_chunk_size,
+    std::vector<ValueIterator> const& edge_partition_value_firsts,
+    std::vector<vertex_t> const& edge_partition_major_range_firsts,
+    value_t default_value)
+    : edge_partition_keys_(edge_partition_keys),
+      edge_partition_key_chunk_start_offsets_(edge_partition_key_chunk_start_offsets),
+      key_chunk_size_(key_chunk_size),
+      default_value_(default_value),
+      edge_partition_value_firsts_(edge_partition_value_firsts),
+      edge_partition_major_range_firsts_(edge_partition_major_range_firsts)
+  {
+  }
+
   std::optional<raft::host_span<raft::device_span<vertex_t const> const>> keys() const
   {
     return edge_partition_keys_;
@@ -92,6 +112,8 @@ class edge_major_property_view_t {
 
   std::optional<size_t> key_chunk_size() const { return key_chunk_size_; }
 
+  std::optional<value_t> default_value() const { return default_value_; }
+
   std::vector<ValueIterator> const& value_firsts() const { return edge_partition_value_firsts_; }
 
   std::vector<vertex_t> const& major_range_firsts() const
@@ -105,6 +127,7 @@ class edge_major_property_view_t {
   std::optional<raft::host_span<raft::device_span<vertex_t const> const>>
     edge_partition_key_chunk_start_offsets_{std::nullopt};
   std::optional<size_t> key_chunk_size_{std::nullopt};
+  std::optional<value_t> default_value_{std::nullopt};
 
   std::vector<ValueIterator> edge_partition_value_firsts_{};
   std::vector<vertex_t> edge_partition_major_range_firsts_{};
@@ -143,6 +166,22 @@ class edge_minor_property_view_t {
   {
   }
 
+  // sparse: vertices not in keys take default_value
+  edge_minor_property_view_t(raft::device_span<vertex_t const> keys,
+                             raft::device_span<vertex_t const> key_chunk_start_offsets,
+                             size_t key_chunk_size,
+                             ValueIterator value_first,
+                             vertex_t minor_range_first,
+                             value_t default_value)
+    : keys_(keys),
+      key_chunk_start_offsets_(key_chunk_start_offsets),
+      key_chunk_size_(key_chunk_size),
+      default_value_(default_value),
+      value_first_(value_first),
+      minor_range_first_(minor_range_first)
+  {
+  }
+
   std::optional<raft::device_span<vertex_t const>> keys() const { return keys_; }
 
   std::optional<raft::device_span<vertex_t const>> key_chunk_start_offsets() const
@@ -152,6 +191,8 @@ class edge_minor_property_view_t {
 
   std::optional<size_t> key_chunk_size() const { return key_chunk_size_; }
 
+  std::optional<value_t> default_value() const { return default_value_; }
+
   ValueIterator value_first() const { return value_first_; }
 
   vertex_t minor_range_first() const { return minor_range_first_; }
@@ -160,6 +201,7 @@ class edge_minor_property_view_t {
   std::optional<raft::device_span<vertex_t const>> keys_{std::nullopt};
   std::optional<raft::device_span<vertex_t const>> key_chunk_start_offsets_{std::nullopt};
   std::optional<size_t> key_chunk_size_{std::nullopt};
+  std::optional<value_t> default_value_{std::nullopt};
 
   ValueIterator value_first_{};
   vertex_t minor_range_first_{};
@@ -214,11 +256,53 @@ class edge_major_property_t {
     }
   }
 
+  // sparse: store values only for edge_partition_keys (owned), others take default_value
+  edge_major_property_t(
+    raft::handle_t const& handle,
+    std::vector<rmm::device_uvector<vertex_t>>&& edge_partition_keys,
+    std::vector<rmm::device_uvector<vertex_t>>&& edge_partition_key_chunk_start_offsets,
+    size_t key_chunk_size,
+    std::vector<vertex_t> const& edge_partition_major_range_firsts,
+    T default_value)
+    : sparse_storage_(std::make_unique<sparse_key_storage_t>()),
+      key_chunk_size_(key_chunk_size),
+      default_value_(default_value),
+      edge_partition_major_range_firsts_(edge_partition_major_range_firsts)
+  {
+    sparse_storage_->keys                    = std::move(edge_partition_keys);
+    sparse_storage_->key_chunk_start_offsets = std::move(edge_partition_key_chunk_start_offsets);
+    for (size_t i = 0; i < sparse_storage_->keys.size(); ++i) {
+      sparse_storage_->key_spans.emplace_back(sparse_storage_->keys[i].data(),
+                                              sparse_storage_->keys[i].size());
+      sparse_storage_->key_chunk_start_offset_spans.emplace_back(
+        sparse_storage_->key_chunk_start_offsets[i].data(),
+        sparse_storage_->key_chunk_start_offsets[i].size());
+    }
+    edge_partition_keys_ = raft::host_span<raft::device_span<vertex_t const> const>(
+      sparse_storage_->key_spans.data(), sparse_storage_->key_spans.size());
+    edge_partition_key_chunk_start_offsets_ =
+      raft::host_span<raft::device_span<vertex_t const> const>(
+        sparse_storage_->key_chunk_start_offset_spans.data(),
+        sparse_storage_->key_chunk_start_offset_spans.size());
+
+    buffers_.reserve(edge_partition_major_range_firsts_.size());
+    for (size_t i = 0; i < edge_partition_major_range_firsts_.size(); ++i) {
+      size_t buffer_size = std::is_same_v<T, bool>
+                             ? cugraph::packed_bool_size(sparse_storage_->keys[i].size())
+                             : sparse_storage_->keys[i].size();
+      buffers_.push_back(
+        allocate_dataframe_buffer<std::conditional_t<std::is_same_v<T, bool>, uint32_t, T>>(
+          buffer_size, handle.get_stream()));
+    }
+  }
+
   void clear(raft::handle_t const& handle)
   {
+    sparse_storage_                         = nullptr;
     edge_partition_keys_                    = std::nullopt;
     edge_partition_key_chunk_start_offsets_ = std::nullopt;
     key_chunk_size_                         = std::nullopt;
+    default_value_                          = std::nullopt;
 
     buffers_.clear();
     buffers_.shrink_to_fit();
@@ -235,7 +319,15 @@ class edge_major_property_t {
       edge_partition_value_firsts[i] = get_dataframe_buffer_cbegin(buffers_[i]);
     }
 
-    if (edge_partition_keys_) {
+    if (default_value_) {
+      return edge_major_property_view_t<vertex_t, const_value_iterator, T>(
+        *edge_partition_keys_,
+        *edge_partition_key_chunk_start_offsets_,
+        *key_chunk_size_,
+        edge_partition_value_firsts,
+        edge_partition_major_range_firsts_,
+        *default_value_);
+    } else if (edge_partition_keys_) {
       return edge_major_property_view_t<vertex_t, const_value_iterator, T>(
         *edge_partition_keys_,
         *edge_partition_key_chunk_start_offsets_,
@@ -257,7 +349,15 @@ class edge_major_property_t {
       edge_partition_value_firsts[i] = get_dataframe_buffer_begin(buffers_[i]);
     }
 
-    if (edge_partition_keys_) {
+    if (default_value_) {
+      return edge_major_property_view_t<vertex_t, value_iterator, T>(
+        *edge_partition_keys_,
+        *edge_partition_key_chunk_start_offsets_,
+        *key_chunk_size_,
+        edge_partition_value_firsts,
+        edge_partition_major_range_firsts_,
+        *default_value_);
+    } else if (edge_partition_keys_) {
       return edge_major_property_view_t<vertex_t, value_iterator, T>(
         *edge_partition_keys_,
         *edge_partition_key_chunk_start_offsets_,
@@ -271,11 +371,21 @@ class edge_major_property_t {
   }
 
  private:
+  struct sparse_key_storage_t {
+    std::vector<rmm::device_uvector<vertex_t>> keys{};
+    std::vector<rmm::device_uvector<vertex_t>> key_chunk_start_offsets{};
+    std::vector<raft::device_span<vertex_t const>> key_spans{};
+    std::vector<raft::device_span<vertex_t const>> key_chunk_start_offset_spans{};
+  };
+
+  std::unique_ptr<sparse_key_storage_t> sparse_storage_{
+    nullptr};  // owns edge_partition_keys_ & edge_partition_key_chunk_start_offsets_ if sparse
   std::optional<raft::host_span<raft::device_span<vertex_t const> const>> edge_partition_keys_{
     std::nullopt};
   std::optional<raft::host_span<raft::device_span<vertex_t const> const>>
     edge_partition_key_chunk_start_offsets_{std::nullopt};
   std::optional<size_t> key_chunk_size_{std::nullopt};
+  std::optional<T> default_value_{std::nullopt};
 
   std::vector<buffer_type> buffers_{};
   std::vector<vertex_t> edge_partition_major_range_firsts_{};
@@ -318,11 +428,37 @@ class edge_minor_property_t {
   {
   }
 
+  // sparse: store values only for keys (owned), others take default_value
+  edge_minor_property_t(raft::handle_t const& handle,
+                        rmm::device_uvector<vertex_t>&& keys,
+                        rmm::device_uvector<vertex_t>&& key_chunk_start_offsets,
+                        size_t key_chunk_size,
+                        vertex_t minor_range_first,
+                        T default_value)
+    : owned_keys_(std::make_unique<rmm::device_uvector<vertex_t>>(std::move(keys))),
+      owned_key_chunk_start_offsets_(
+        std::make_unique<rmm::device_uvector<vertex_t>>(std::move(key_chunk_start_offsets))),
+      keys_(raft::device_span<vertex_t const>(owned_keys_->data(), owned_keys_->size())),
+      key_chunk_start_offsets_(raft::device_span<vertex_t const>(
+        owned_key_chunk_start_offsets_->data(), owned_key_chunk_start_offsets_->size())),
+      key_chunk_size_(key_chunk_size),
+      default_value_(default_value),
+      buffer_(allocate_dataframe_buffer<std::conditional_t<std::is_same_v<T, bool>, uint32_t, T>>(
+        std::is_same_v<T, bool> ? cugraph::packed_bool_size(owned_keys_->size())
+                                : owned_keys_->size(),
+        handle.get_stream())),
+      minor_range_first_(minor_range_first)
+  {
+  }
+
   void clear(raft::handle_t const& handle)
   {
-    keys_                    = std::nullopt;
-    key_chunk_start_offsets_ = std::nullopt;
-    key_chunk_size_          = std::nullopt;
+    owned_keys_                    = nullptr;
+    owned_key_chunk_start_offsets_ = nullptr;
+    keys_                          = std::nullopt;
+    key_chunk_start_offsets_       = std::nullopt;
+    key_chunk_size_                = std::nullopt;
+    default_value_                 = std::nullopt;
 
     resize_dataframe_buffer(buffer_, size_t{0}, handle.get_stream());
     shrink_to_fit_dataframe_buffer(buffer_, handle.get_stream());
@@ -332,7 +468,14 @@ class edge_minor_property_t {
   auto view() const
   {
     auto value_first = get_dataframe_buffer_cbegin(buffer_);
-    if (keys_) {
+    if (default_value_) {
+      return edge_minor_property_view_t<vertex_t, decltype(value_first), T>(*keys_,
+                                                                            *key_chunk_start_offsets_,
+                                                                            *key_chunk_size_,
+                                                                            value_first,
+                                                                            minor_range_first_,
+                                                                            *default_value_);
+    } else if (keys_) {
       return edge_minor_property_view_t<vertex_t, decltype(value_first), T>(
         *keys_, *key_chunk_start_offsets_, *key_chunk_size_, value_first, minor_range_first_);
     } else {
@@ -344,7 +487,14 @@ class edge_minor_property_t {
   auto mutable_view()
   {
     auto value_first = get_dataframe_buffer_begin(buffer_);
-    if (keys_) {
+    if (default_value_) {
+      return edge_minor_property_view_t<vertex_t, decltype(value_first), T>(*keys_,
+                                                                            *key_chunk_start_offsets_,
+                                                                            *key_chunk_size_,
+                                                                            value_first,
+                                                                            minor_range_first_,
+                                                                            *default_value_);
+    } else if (keys_) {
       return edge_minor_property_view_t<vertex_t, decltype(value_first), T>(
         *keys_, *key_chunk_start_offsets_, *key_chunk_size_, value_first, minor_range_first_);
     } else {
@@ -354,9 +504,13 @@ class edge_minor_property_t {
   }
 
  private:
+  std::unique_ptr<rmm::device_uvector<vertex_t>> owned_keys_{nullptr};  // set if sparse
+  std::unique_ptr<rmm::device_uvector<vertex_t>> owned_key_chunk_start_offsets_{
+    nullptr};  // set if sparse
   std::optional<raft::device_span<vertex_t const>> keys_{std::nullopt};
   std::optional<raft::device_span<vertex_t const>> key_chunk_start_offsets_{std::nullopt};
   std::optional<size_t> key_chunk_size_{std::nullopt};
+  std::optional<T> default_value_{std::nullopt};
 
   decltype(allocate_dataframe_buffer<std::conditional_t<std::is_same_v<T, bool>, uint32_t, T>>(
     size_t{0}, rmm::cuda_stream_view{})) buffer_;
@@ -377,9 +531,20 @@ class edge_src_property_t {
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
 
   using value_type = T;
+  using property_type =
+    std::conditional_t<GraphViewType::is_storage_transposed,
+                       detail::edge_minor_property_t<typename GraphViewType::vertex_type, T>,
+                       detail::edge_major_property_t<typename GraphViewType::vertex_type, T>>;
 
   edge_src_property_t(raft::handle_t const& handle) : property_(handle) {}
 
+  // for advanced users (e.g. to store only the vertices with non-default values, see
+  // create_sparse_edge_src_property)
+  edge_src_property_t(raft::handle_t const& handle, property_type&& property)
+    : property_(std::move(property))
+  {
+  }
+
   edge_src_property_t(raft::handle_t const& handle, GraphViewType const& graph_view)
     : property_(handle)
   {
@@ -452,10 +617,7 @@ class edge_src_property_t {
   auto mutable_view() { return property_.mutable_view(); }
 
  private:
-  std::conditional_t<GraphViewType::is_storage_transposed,
-                     detail::edge_minor_property_t<typename GraphViewType::vertex_type, T>,
-                     detail::edge_major_property_t<typename GraphViewType::vertex_type, T>>
-    property_;
+  property_type property_;
 
   std::optional<std::vector<raft::device_span<typename GraphViewType::vertex_type const>>>
     edge_partition_keys_{std::nullopt};
@@ -469,9 +631,20 @@ class edge_dst_property_t {
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
 
   using value_type = T;
+  using property_type =
+    std::conditional_t<GraphViewType::is_storage_transposed,
+                       detail::edge_major_property_t<typename GraphViewType::vertex_type, T>,
+                       detail::edge_minor_property_t<typename GraphViewType::vertex_type, T>>;
 
   edge_dst_property_t(raft::handle_t const& handle) : property_(handle) {}
 
+  // for advanced users (e.g. to store only the vertices with non-default values, see
+  // create_sparse_edge_dst_property)
+  edge_dst_property_t(raft::handle_t const& handle, property_type&& property)
+    : property_(std::move(property))
+  {
+  }
+
   edge_dst_property_t(raft::handle_t const& handle, GraphViewType const& graph_view)
     : property_(handle)
   {
@@ -544,10 +717,7 @@ class edge_dst_property_t {
   auto mutable_view() { return property_.mutable_view(); }
 
  private:
-  std::conditional_t<GraphViewType::is_storage_transposed,
-                     detail::edge_major_property_t<typename GraphViewType::vertex_type, T>,
-                     detail::edge_minor_property_t<typename GraphViewType::vertex_type, T>>
-    property_;
+  property_type property_;
 
   std::optional<std::vector<raft::device_span<typename GraphViewType::vertex_type const>>>
     edge_partition_keys_{std::nullopt};
@@ -578,6 +748,7 @@ auto view_concat(detail::edge_major_property_view_t<vertex_t, Iters, Types> cons
 
   std::vector<concat_value_iterator> edge_partition_concat_value_firsts{};
   auto first_view = get_first_of_pack(views...);
+  assert(!first_view.default_value());  // sparse views do not share keys
   edge_partition_concat_value_firsts.resize(first_view.major_range_firsts().size());
   for (size_t i = 0; i < edge_partition_concat_value_firsts.size(); ++i) {
     edge_partition_concat_value_firsts[i] = thrust::make_zip_iterator(
@@ -607,6 +778,7 @@ auto view_concat(detail::edge_minor_property_view_t<vertex_t, Iters, Types> cons
   concat_value_iterator edge_partition_concat_value_first{};
 
   auto first_view = get_first_of_pack(views...);
+  assert(!first_view.default_value());  // sparse views do not share keys
 
   edge_partition_concat_value_first =
     thrust::make_zip_iterator(thrust_tuple_cat(to_thrust_iterator_tuple(views.value_first())...));
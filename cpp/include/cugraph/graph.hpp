@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -228,7 +229,8 @@ class graph_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<mu
         local_sorted_unique_edge_dsts,
         local_sorted_unique_edge_dst_chunk_start_offsets,
         local_sorted_unique_edge_dst_chunk_size_,
-        local_sorted_unique_edge_dst_vertex_partition_offsets});
+        local_sorted_unique_edge_dst_vertex_partition_offsets,
+        metadata_cache_.get()});
   }
 
  private:
@@ -276,6 +278,9 @@ class graph_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<mu
                      std::optional<std::vector<vertex_t>>,
                      std::optional<std::byte> /* dummy */>
     local_sorted_unique_edge_dst_vertex_partition_offsets_{std::nullopt};
+
+  std::unique_ptr<detail::graph_metadata_cache_t<edge_t>> metadata_cache_{
+    std::make_unique<detail::graph_metadata_cache_t<edge_t>>()};
 };
 
 // single-GPU version
@@ -299,28 +304,59 @@ class graph_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!m
           graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
           bool do_expensive_check = false);
 
+  /**
+   * @brief Construct a graph referencing caller-owned CSR (CSC if store_transposed) arrays
+   *
+   * The arrays are not copied, they must outlive the graph (and the views created from it) and
+   * must not be modified while the graph exists.  meta.segment_offsets should be set only if the
+   * vertices are sorted by degree (see compute_sorted_degree_segment_offsets).
+   *
+   * @param handle  RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator,
+   * and handles to various CUDA libraries) to run graph algorithms.
+   * @param offsets  CSR offsets (size meta.number_of_vertices + 1)
+   * @param indices  CSR indices
+   * @param meta  Graph meta data
+   * @param do_expensive_check  A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  graph_t(raft::handle_t const& handle,
+          raft::device_span<edge_t const> offsets,
+          raft::device_span<vertex_t const> indices,
+          graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
+          bool do_expensive_check = false);
+
   edge_t number_of_edges() const { return this->number_of_edges_; }
 
   graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> view() const
   {
     return graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>(
-      raft::device_span<edge_t const>(offsets_.data(), offsets_.size()),
-      raft::device_span<vertex_t const>(indices_.data(), indices_.size()),
+      external_offsets_ ? *external_offsets_
+                        : raft::device_span<edge_t const>(offsets_.data(), offsets_.size()),
+      external_indices_ ? *external_indices_
+                        : raft::device_span<vertex_t const>(indices_.data(), indices_.size()),
       graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu>{
         this->number_of_vertices(),
         this->number_of_edges(),
         this->properties_,
         segment_offsets_,
-        hypersparse_degree_offsets_});
+        hypersparse_degree_offsets_,
+        metadata_cache_.get()});
   }
 
  private:
   rmm::device_uvector<edge_t> offsets_;
   rmm::device_uvector<vertex_t> indices_;
 
+  // caller-owned CSR arrays (used instead of offsets_ & indices_ if set)
+  std::optional<raft::device_span<edge_t const>> external_offsets_{std::nullopt};
+  std::optional<raft::device_span<vertex_t const>> external_indices_{std::nullopt};
+
   // segment offsets based on vertex degree, relevant only if sorted_by_global_degree is true
   std::optional<std::vector<vertex_t>> segment_offsets_{};
   std::optional<std::vector<vertex_t>> hypersparse_degree_offsets_{};
+
+  std::unique_ptr<detail::graph_metadata_cache_t<edge_t>> metadata_cache_{
+    std::make_unique<detail::graph_metadata_cache_t<edge_t>>()};
 };
 
 template <typename T, typename Enable = void>
@@ -18,15 +18,20 @@
 #include <cugraph/edge_property.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/reduced_precision_weights.hpp>
 
 #include <raft/core/device_span.hpp>
 #include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
 #include <raft/random/rng_state.hpp>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -53,6 +58,107 @@ struct renumber_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gpu>
   std::optional<std::vector<vertex_t>> hypersparse_degree_offsets{};
 };
 
+/**
+ * @brief Algorithms to find the unique external vertex IDs (and their degrees) in renumbering.
+ */
+enum class renumber_method_t {
+  sort /* sort and unique the edge end points (lower memory footprint) */,
+  hash /* insert the edge end points to a hash table and sort only the unique vertex IDs (faster
+          if the number of edges is much larger than the number of unique vertices) */
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Set the algorithm renumber_edgelist (and graph creation with renumbering) uses to find
+ * the unique vertex IDs in the edge list in the calls using @p handle.
+ *
+ * Both methods produce the same renumber map. The hash method avoids sorting every edge end point
+ * and counts single-GPU vertex degrees in the same pass but temporarily requires more memory per
+ * edge end point (the edge list is processed in multiple hash bins to bound this). If (local)
+ * vertices are explicitly provided, they are sorted with either method.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param method Renumbering method (renumber_method_t::sort by default).
+ */
+void set_renumber_method_hint(raft::handle_t const& handle, renumber_method_t method);
+
+/**
+ * @brief Get the renumbering method set by set_renumber_method_hint (renumber_method_t::sort if
+ * not set).
+ */
+renumber_method_t get_renumber_method_hint(raft::handle_t const& handle);
+
+/**
+ * @brief Vertex orders within the high, mid, and low degree segments of a vertex partition in
+ * renumbering.
+ */
+enum class renumber_order_t {
+  degree /* order by degree (non-ascending) */,
+  input /* order by external vertex ID (preserves the locality of the input vertex IDs) */,
+  neighbor /* order by the smallest external ID of the vertex's neighbors (destinations if not
+              store_transposed, sources otherwise), so vertices sharing a neighbor get adjacent
+              internal IDs (single level breadth-first ordering in the spirit of RCM) */
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Set the vertex order renumber_edgelist (and graph creation with renumbering) uses within
+ * each degree segment in the calls using @p handle.
+ *
+ * Vertices are always grouped into the high, mid, low, (hypersparse,) and zero degree segments
+ * the graph primitives specialize for; this only changes the order within the high, mid, and low
+ * degree segments to improve the locality of the vertex property accesses in the graph
+ * primitives. The renumber map reflects the order.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param order Vertex order (renumber_order_t::degree by default).
+ */
+void set_renumber_order_hint(raft::handle_t const& handle, renumber_order_t order);
+
+/**
+ * @brief Get the vertex order set by set_renumber_order_hint (renumber_order_t::degree if not
+ * set).
+ */
+renumber_order_t get_renumber_order_hint(raft::handle_t const& handle);
+
+/**
+ * @brief Policies to choose the degree boundaries of the high, mid, and low degree segments in
+ * renumbering.
+ */
+enum class degree_segment_policy_t {
+  fixed /* use the compile-time thresholds (detail::low_degree_threshold and
+           detail::mid_degree_threshold) */,
+  adaptive /* choose the low, mid boundary per graph from the measured degree distribution, so
+              vertices well above the typical low degree move to the mid degree segment (the graph
+              primitives process this segment with a (sub-)warp per vertex) */
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Set the policy renumber_edgelist (and graph creation with renumbering) uses to choose the
+ * degree segment boundaries in the calls using @p handle.
+ *
+ * The chosen boundaries are reflected in the segment offsets stored in the graph object. With
+ * degree_segment_policy_t::adaptive, the low, mid boundary is set to the smallest power of two
+ * (between detail::min_low_degree_threshold and detail::low_degree_threshold) not smaller than the
+ * average (local) degree of the low and mid degree vertices. The graph primitives pick the
+ * sub-warp size for the mid degree segment from the segment's average degree if the same policy
+ * is set for the handle used to run them.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param policy Degree segment policy (degree_segment_policy_t::fixed by default).
+ */
+void set_degree_segment_policy_hint(raft::handle_t const& handle, degree_segment_policy_t policy);
+
+/**
+ * @brief Get the degree segment policy set by set_degree_segment_policy_hint
+ * (degree_segment_policy_t::fixed if not set).
+ */
+degree_segment_policy_t get_degree_segment_policy_hint(raft::handle_t const& handle);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief renumber edgelist (multi-GPU)
@@ -155,6 +261,31 @@ renumber_edgelist(raft::handle_t const& handle,
                   bool store_transposed,
                   bool do_expensive_check = false);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Compute the degree segment offsets of a single-GPU CSR (or CSC) whose vertices are sorted
+ * by degree.
+ *
+ * The renumbering sorts vertices by degree (non-ascending) and the graph primitives specialize
+ * their kernels for the high, mid, low, and zero degree segments of the vertex range.  This
+ * function computes the segment offsets (to set graph_meta_t::segment_offsets) for a CSR that has
+ * already been sorted by degree outside of cuGraph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param offsets CSR offsets (size number of vertices + 1).
+ * @param do_expensive_check A flag to check that the vertices are sorted by degree (if set to
+ * `true`).
+ * @return Segment offsets (size detail::num_sparse_segments_per_vertex_partition + 2).
+ */
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> compute_sorted_degree_segment_offsets(
+  raft::handle_t const& handle,
+  raft::device_span<edge_t const> offsets,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Renumber external vertices to internal vertices based on the provided @p
@@ -224,7 +355,9 @@ void unrenumber_local_int_vertices(
  * @brief Unrenumber (possibly non-local) internal vertices to external vertices based on the
  * providied @p renumber_map_labels.
  *
- * Note cugraph::invalid_id<vertex_t>::value remains unchanged.
+ * Note cugraph::invalid_id<vertex_t>::value remains unchanged. In multi-GPU, if every GPU holds
+ * only local vertices (e.g. per-vertex algorithm outputs), the vertices are unrenumbered with a
+ * direct local gather (skipping inter-GPU communication).
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
@@ -248,6 +381,41 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
                              std::vector<vertex_t> const& vertex_partition_range_lasts,
                              bool do_expensive_check = false);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Unrenumber local internal vertices, drop cugraph::invalid_id<vertex_t>::value, and copy
+ * the resulting external vertices to a page-locked host buffer.
+ *
+ * This fuses the gather, the compaction, and the device to host copy into a single pass (the
+ * external vertices are written directly to the device accessible page-locked host memory).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices Local internal vertices to be unrenumbered. Each valid input element should be in
+ * [@p local_int_vertex_first, @p local_int_vertex_last).
+ * @param renumber_map_labels Pointer to the external vertices corresponding to the internal
+ * vertices in the range [@p local_int_vertex_first, @p local_int_vertex_last).
+ * @param local_int_vertex_first The first local internal vertex (inclusive, assigned to this
+ * process in multi-GPU).
+ * @param local_int_vertex_last The last local internal vertex (exclusive, assigned to this process
+ * in multi-GPU).
+ * @param ext_vertices Page-locked host buffer to store the external vertices (in the order of the
+ * valid input vertices). Should be large enough to hold all the valid input vertices.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Number of external vertices stored in @p ext_vertices (the call returns after the copy
+ * is complete).
+ */
+template <typename vertex_t>
+size_t unrenumber_local_int_vertices_to_host(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> vertices,
+  vertex_t const* renumber_map_labels /* size = local_int_vertex_last - local_int_vertex_first */,
+  vertex_t local_int_vertex_first,
+  vertex_t local_int_vertex_last,
+  raft::host_span<vertex_t> ext_vertices /* [OUT] */,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Unrenumber local edges' internal source & destination IDs to external IDs based on the
@@ -351,6 +519,41 @@ void renumber_local_ext_vertices(raft::handle_t const& handle,
                                  vertex_t local_int_vertex_first,
                                  vertex_t local_int_vertex_last,
                                  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Extend an existing renumber map with the previously unseen vertices in a new batch of
+ * external vertices.
+ *
+ * Existing vertices keep their positions in the (local) renumber map, and the new vertices are
+ * appended (in ascending external vertex ID order), so the internal vertex IDs of the existing
+ * vertices stay stable in single-GPU. In multi-GPU, every GPU appends the new vertices assigned to
+ * it to its local renumber map, so the existing vertices keep their offsets within the local
+ * vertex partition but the vertex partition ranges (and the internal IDs of the vertices in the
+ * vertex partitions of the GPUs with higher ranks) shift if other GPUs append new vertices. This
+ * function does not update graph objects; a graph including the new vertices needs to be created
+ * with the extended renumber map (e.g. by renumbering the new edges with renumber_ext_vertices).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param renumber_map_labels The existing (local) renumber map (external vertex IDs of the local
+ * internal vertices).
+ * @param new_ext_vertices External vertex IDs in the new batch (may include duplicates and
+ * previously seen vertices). In multi-GPU, this can include vertices assigned to any GPU.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, vertex_t> Tuple of the extended (local)
+ * renumber map and the number of (locally) appended vertices.
+ */
+template <typename vertex_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extend_renumber_map(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& renumber_map_labels,
+  raft::device_span<vertex_t const> new_ext_vertices,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Construct the edge list from the graph view object.
@@ -398,103 +601,128 @@ decompress_to_edgelist(
 
 /**
  * @ingroup graph_functions_cpp
- * @brief Symmetrize edgelist.
+ * @brief Construct the edge list from the graph view object in bounded size chunks.
+ *
+ * decompress_to_edgelist materializes the entire (local) edge list. This function instead
+ * decompresses edge partition ranges of (at most) @p chunk_size edges at a time into reusable
+ * device buffers and passes each chunk to @p callback (the spans are valid only during the
+ * callback), so the peak memory usage is bounded by @p chunk_size regardless of the number of
+ * edges. In multi-GPU, this is a collective call (if @p renumber_map.has_value() is true,
+ * unrenumbering each chunk requires communication, and every GPU processes the same number of
+ * chunks).
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
- * @tparam edge_type_t Type of edge type identifiers. Needs to be an integral type.
- * @tparam edge_time_t Type of edge time. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
  * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
  * true) as major indices in storing edges using a 2D sparse matrix.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
- *
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param edgelist_srcs Vector of edge source vertex IDs. If multi-GPU, applying the
- * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
- * function to work (edges should be pre-shuffled).
- * @param edgelist_dsts Vector of edge destination vertex IDs.
- * @param edgelist_weights Vector of edge weights.
- * @param edgelist_edge_ids Vector of edge ids
- * @param edgelist_edge_types Vector of edge types
- * @param edgelist_edge_start_times Vector of edge start times
- * @param edgelist_edge_end_times Vector of edge end times
- * @param reciprocal Flag indicating whether to keep (if set to `false`) or discard (if set to
- * `true`) edges that appear only in one direction.
- * @return Tuple of symmetrized sources, destinations, optional weights, optional edge ids, optional
- * edge types, optional edge start times and optional edge end times
+ * @param graph_view Graph view object of the graph to be decompressed.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param renumber_map If valid, return the renumbered edge list based on the provided @p
+ * renumber_map
+ * @param chunk_size Maximum number of edges in a chunk.
+ * @param callback Function called (in the calling thread) with the edge sources, destinations,
+ * (optional) weights, (optional) ids, and (optional) types of every non-empty chunk. Device work on
+ * the spans should be ordered on handle.get_stream().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  */
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
           typename edge_type_t,
-          typename edge_time_t,
+          bool store_transposed,
           bool multi_gpu>
-std::tuple<rmm::device_uvector<vertex_t>,
-           rmm::device_uvector<vertex_t>,
-           std::optional<rmm::device_uvector<weight_t>>,
-           std::optional<rmm::device_uvector<edge_t>>,
-           std::optional<rmm::device_uvector<edge_type_t>>,
-           std::optional<rmm::device_uvector<edge_time_t>>,
-           std::optional<rmm::device_uvector<edge_time_t>>>
-symmetrize_edgelist(raft::handle_t const& handle,
-                    rmm::device_uvector<vertex_t>&& edgelist_srcs,
-                    rmm::device_uvector<vertex_t>&& edgelist_dsts,
-                    std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
-                    std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
-                    std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
-                    std::optional<rmm::device_uvector<edge_time_t>>&& edgelist_edge_start_times,
-                    std::optional<rmm::device_uvector<edge_time_t>>&& edgelist_edge_end_times,
-                    bool reciprocal);
+void decompress_to_edgelist_in_chunks(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<vertex_t const>,
+                     raft::device_span<vertex_t const>,
+                     std::optional<raft::device_span<weight_t const>>,
+                     std::optional<raft::device_span<edge_t const>>,
+                     std::optional<raft::device_span<edge_type_t const>>)> const& callback,
+  bool do_expensive_check = false);
 
 /**
  * @ingroup graph_functions_cpp
- * @brief Symmetrize the input graph.
+ * @brief Construct the edge list from the graph view object in bounded size chunks in pinned host
+ * memory.
+ *
+ * Same as decompress_to_edgelist_in_chunks, but every chunk is copied to reusable pinned
+ * (page-locked) host buffers (at the full interconnect bandwidth) before @p callback is called with
+ * host spans (valid only during the callback), e.g. to stream the edge list to a file.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
  * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
  * true) as major indices in storing edges using a 2D sparse matrix.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph Graph object to be symmetrized.
- * @param edge_weights Optional owning object holding edge weights for @p graph.
- * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
- * IDs. This should be valid if multi-GPU.
- * @param reciprocal If true, an edge is kept only when the reversed edge also exists. If false,
- * keep (and symmetrize) all the edges that appear only in one direction.
+ * @param graph_view Graph view object of the graph to be decompressed.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param renumber_map If valid, return the renumbered edge list based on the provided @p
+ * renumber_map
+ * @param chunk_size Maximum number of edges in a chunk.
+ * @param callback Function called (in the calling thread) with the edge sources, destinations,
+ * (optional) weights, (optional) ids, and (optional) types of every non-empty chunk.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return Return a symmetrized graph, an owning object holding edge weights (if @p
- * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
- * @p renumber_map.has_value() is true).
  */
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
+          typename edge_type_t,
           bool store_transposed,
           bool multi_gpu>
-std::tuple<
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-symmetrize_graph(
+void decompress_to_host_edgelist_in_chunks(
   raft::handle_t const& handle,
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
-  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-                                weight_t>>&& edge_weights,
-  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
-  bool reciprocal         = false,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<vertex_t const>,
+                     raft::host_span<vertex_t const>,
+                     std::optional<raft::host_span<weight_t const>>,
+                     std::optional<raft::host_span<edge_t const>>,
+                     std::optional<raft::host_span<edge_type_t const>>)> const& callback,
   bool do_expensive_check = false);
 
 /**
  * @ingroup graph_functions_cpp
- * @brief Transpose the input graph.
+ * @brief Rebuild a graph's local edge partitions without the masked out edges.
+ *
+ * Long-lived graphs accumulate masked out (dead) edges after many edge mask updates, and their
+ * edge partition buffers may be scattered over a fragmented memory pool after partial rebuilds.
+ * This function builds a new graph object (and edge weights) holding only the unmasked edges (all
+ * the edges if @p graph_view has no edge mask) in freshly allocated buffers. The vertex
+ * partitioning, the vertex IDs, and the degree based segment offsets are preserved, so the
+ * renumber map and the vertex property arrays of @p graph_view remain valid for the compacted
+ * graph (re-segmenting or reordering vertices would change the vertex IDs; create a new graph
+ * with renumbering for that).
+ *
+ * @p graph_view is only read, so the graph can keep serving reads while this function runs on a
+ * separate stream: pass a @p handle whose stream differs from the serving stream (and the same
+ * communicators in multi-GPU), and synchronize the serving stream after the last update of the
+ * graph (e.g. its edge mask) before calling this function. Replace the old graph (e.g. by move
+ * assignment) once @p handle's stream is synchronized.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
@@ -505,14 +733,10 @@ symmetrize_graph(
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph Graph object to be transposed.
- * @param edge_weights Optional owning object holding edge weights for @p graph.
- * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
- * IDs. This should be valid if multi-GPU.
+ * @param graph_view Graph view object of the graph to be compacted.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return Return a transposed graph, an owning object holding edge weights (if @p
- * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
- * @p renumber_map.has_value() is true).
+ * @return A tuple of the compacted graph object and its (optional) edge weights.
  */
 template <typename vertex_t,
           typename edge_t,
@@ -522,22 +746,22 @@ template <typename vertex_t,
 std::tuple<
   graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
   std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-transpose_graph(
-  raft::handle_t const& handle,
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
-  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-                                weight_t>>&& edge_weights,
-  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
-  bool do_expensive_check = false);
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+              std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+              bool do_expensive_check = false);
 
 /**
  * @ingroup graph_functions_cpp
- * @brief Transpose the storage format (no change in an actual graph topology).
+ * @brief Compact a masked graph if only a small fraction of its edges remain unmasked.
  *
- * In SG, convert between CSR and CSC. In multi-GPU, currently convert between CSR + DCSR hybrid
- * and CSC + DCSC hybrid (but the internal representation in multi-GPU is subject to change).
+ * Primitives skip masked out edges but still scan them, so iterative algorithms that mask out most
+ * of the edges (e.g. K-truss after peeling) keep paying for the removed edges. If @p graph_view has
+ * an attached edge mask and the number of unmasked edges is less than @p density_threshold times
+ * the number of edges, this function builds a new graph object (and edge weights) holding only the
+ * unmasked edges. The vertex partitioning (and the vertex IDs) are preserved, so vertex property
+ * arrays of @p graph_view remain valid for the compacted graph.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
@@ -548,82 +772,696 @@ transpose_graph(
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph Graph object to transpose its storage format.
- * @param edge_weights Optional owning object holding edge weights for @p graph.
- * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
- * IDs. This should be valid if multi-GPU.
+ * @param graph_view Graph view object of the graph to be compacted.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param density_threshold Compact if the fraction of unmasked edges is less than this value.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>,
- * @return Return a storage transposed graph, an owning object holding edge weights (if @p
- * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
- * @p renumber_map.has_value() is true).
+ * @return std::nullopt if @p graph_view has no edge mask or the fraction of unmasked edges is not
+ * less than @p density_threshold, otherwise a tuple of the compacted graph object and its
+ * (optional) edge weights.
  */
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
           bool store_transposed,
           bool multi_gpu>
-std::tuple<
-  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+std::optional<std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
   std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-transpose_graph_storage(
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>>
+compact_graph_if_sparse(
   raft::handle_t const& handle,
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
-  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-                                weight_t>>&& edge_weights,
-  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
-  bool do_expensive_check = false);
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  double density_threshold = 0.5,
+  bool do_expensive_check  = false);
 
 /**
  * @ingroup graph_functions_cpp
- * @brief Compute the coarsened graph.
+ * @brief Write a binary snapshot of the graph (and its edge properties and renumber map).
  *
- * Aggregates the vertices with the same label to a new vertex in the output coarsened graph.
- * Multi-edges in the coarsened graph are collapsed to a single edge with its weight equal to the
- * sum of multi-edge weights.
+ * The snapshot stores the compressed local edge partitions (offsets, indices, and DCS non-zero
+ * major vertices), the vertex partitioning, the degree based segment offsets, the edge properties,
+ * and the renumber map as is, so read_graph_snapshot can reconstruct the graph without
+ * renumbering or re-compressing edges. In multi-GPU, each GPU writes its local partitions to a
+ * separate file (@p filename suffixed with "." and the GPU rank), and the snapshot should be read
+ * with the same GPU partitioning. The snapshot format is versioned, and read_graph_snapshot rejects
+ * files written with a different format version.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
  * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
  * true) as major indices in storing edges using a 2D sparse matrix.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Graph view object of the input graph to be coarsened.
+ * @param graph_view Graph view object of the graph to write. Should not have an edge mask.
  * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
- * @param labels Vertex labels (assigned to this process in multi-GPU) to be used in coarsening.
- * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
- * is true). Setting @p renumber to false is highly discouraged except for testing as this
- * negatively affects the performance and memory footprint. If @p renumber is set to true, @p labels
- * should have only non-negative integers and the number of vertices is assumed to be the maximum
- * element in @p labels (reduced over the entire set of GPUs in multi-GPU) + 1. This may produce
- * many isolated vertices if the number of unique elements (over the entire set of GPUs in
- * multi-GPU) in @p labels is much smaller than the assumed number of vertices.
- * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return Tuple of the coarsened graph, coarsened graph edge weights (if @p
- * edge_weight_view.has_value() is true) and the renumber map (if @p renumber is true).
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param renumber_map Optional renumber map of the local vertex partition.
+ * @param filename Path of the snapshot file (path prefix in multi-GPU).
  */
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
+          typename edge_type_t,
           bool store_transposed,
           bool multi_gpu>
-std::tuple<
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-coarsen_graph(raft::handle_t const& handle,
+void write_graph_snapshot(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  std::string const& filename);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Read a binary snapshot written by write_graph_snapshot.
+ *
+ * The snapshot file is memory mapped and its sections are copied straight to the device buffers
+ * backing the graph's local edge partitions (no renumbering or edge compression is performed).
+ * If cuGraph is built with CUGRAPH_ENABLE_CUFILE and the file system supports GPUDirect Storage,
+ * the device sections (edge partitions, edge properties, and the renumber map) are read with
+ * cuFile directly into device memory without staging them in host memory (write_graph_snapshot
+ * writes them the same way).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param filename Path of the snapshot file (path prefix in multi-GPU). The template parameters
+ * and the GPU partitioning should match with the ones used in writing the snapshot.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the graph and optional edge_property_t objects storing the edge weights, edge
+ * ids, and edge types and the renumber map (if they were included in the snapshot).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+read_graph_snapshot(raft::handle_t const& handle,
+                    std::string const& filename,
+                    bool do_expensive_check = false);
+
+/**
+ * @brief Load balance of the vertex and edge partitioning of a graph across GPUs.
+ */
+template <typename vertex_t, typename edge_t>
+struct partition_imbalance_t {
+  // local vertex partition range sizes, indexed by GPU rank
+  std::vector<vertex_t> vertex_counts{};
+  // numbers of edges in the local edge partitions (masked out edges excluded), indexed by GPU rank
+  std::vector<edge_t> edge_counts{};
+  double vertex_imbalance{1.0};  // max / mean of vertex_counts (1.0 if perfectly balanced)
+  double edge_imbalance{1.0};    // max / mean of edge_counts (1.0 if perfectly balanced)
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Compute the load balance of the vertex and edge partitioning of a graph.
+ *
+ * In multi-GPU, vertices are assigned to GPUs by hashing the external vertex IDs (so vertex
+ * counts are balanced), and the number of edges stored in each GPU varies with the degree
+ * distribution. The GPU with the most edges typically sets the pace of the collective operations
+ * in the graph primitives; this function reports the per-GPU counts and the imbalance ratios.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to inspect.
+ * @return Per-GPU vertex and edge counts and the imbalance ratios (identical in every GPU).
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+partition_imbalance_t<vertex_t, edge_t> compute_partition_imbalance(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view);
+
+/**
+ * @brief Blocked bloom filter over the (source, destination) pairs of the edges in the local edge
+ * partitions of a graph.
+ *
+ * A filter answers "may (src, dst) be an edge" without false negatives; has_edges uses it to skip
+ * the adjacency list search for most non-edges. Built by build_edge_existence_filter; the filter
+ * should be rebuilt if the graph's edges change (an edge mask that only removes edges from the set
+ * used in building the filter does not invalidate the filter).
+ */
+struct edge_existence_filter_t {
+  rmm::device_uvector<uint32_t> blocks; /* each block has 8 32-bit words (256 bits) */
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Build an edge existence filter for the edges stored in this GPU's local edge partitions.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to index (the edge mask, if set, is honored).
+ * @param bits_per_edge Filter size in bits per local edge; 16 bits per edge keeps the false
+ * positive rate well under 1%.
+ * @return The edge existence filter.
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+edge_existence_filter_t build_edge_existence_filter(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  size_t bits_per_edge = 16);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Query the existence of a batch of (src, dst) pairs using an edge existence filter.
+ *
+ * Pairs rejected by @p filter are reported as non-edges without touching the adjacency lists, the
+ * remaining pairs (edges and false positives) are confirmed with graph_view_t::has_edge. The
+ * result is identical to graph_view_t::has_edge.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to query.
+ * @param filter Edge existence filter built from @p graph_view (or from a graph view with a
+ * superset of its edges).
+ * @param edge_srcs Source vertices of the pairs to query. (@p edge_srcs, @p edge_dsts) should be
+ * pre-shuffled to the GPUs owning the corresponding edge partitions in multi-GPU.
+ * @param edge_dsts Destination vertices of the pairs to query.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Flags indicating whether each (src, dst) pair is an edge.
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+rmm::device_uvector<bool> has_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_existence_filter_t const& filter,
+  raft::device_span<vertex_t const> edge_srcs,
+  raft::device_span<vertex_t const> edge_dsts,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Read an edge list from a Matrix Market file.
+ *
+ * The file is read in chunks of complete lines; each chunk is copied to the GPU and tokenized and
+ * parsed there (only the banner and the size line are parsed on the host). Only sparse
+ * (coordinate) matrices with real, integer, or pattern entries and general or symmetric symmetry
+ * are supported. Row and column indices are converted from 1-based to 0-based, and the symmetric
+ * complements of the off-diagonal entries are added if the file is symmetric.
+ *
+ * In multi-GPU, each GPU reads and parses its own (approximately equal size) byte range of the
+ * file, and the edges and vertices are shuffled to their owning GPUs (with
+ * shuffle_external_edges) before returning, so the output can be passed to
+ * create_graph_from_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param filename Path of the Matrix Market file.
+ * @param read_weights Flag indicating whether to return edge weights (set to 1.0 if the file has
+ * pattern entries) or not.
+ * @param store_transposed Flag indicating whether the edges will be used to create a graph storing
+ * transposed edges (relevant only in multi-GPU to shuffle edges to their owning GPUs).
+ * @param chunk_size Size (in bytes) of the file chunks streamed to the GPU. Should be larger
+ * than the longest line in the file.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of edge sources, destinations, (optional) edge weights, the vertices (assigned to
+ * this GPU in multi-GPU), and a flag indicating whether the file is symmetric.
+ */
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<vertex_t>,
+           bool>
+read_matrix_market_edgelist(raft::handle_t const& handle,
+                            std::string const& filename,
+                            bool read_weights,
+                            bool store_transposed,
+                            size_t chunk_size       = size_t{1} << 28,
+                            bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Relocate the edge partition indices (and edge weights) of a graph to memory allocated
+ * from the given memory resource.
+ *
+ * This is to run algorithms on graphs that do not fit into the GPU memory. Passing an
+ * rmm::mr::managed_memory_resource keeps the edges in managed memory (BFS and SSSP prefetch the
+ * edges of each iteration's frontier range to the GPU); passing an
+ * rmm::mr::pinned_host_memory_resource keeps the edges in pinned host memory which the GPU
+ * accesses directly through the interconnect (PCIe or NVLink-C2C). Edge partition offsets (and
+ * other per-vertex data) remain in the GPU memory.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph object to relocate the edges of. @p graph is consumed (the graph's edges are
+ * released as soon as they are copied).
+ * @param edge_weights Optional edge_property_t object holding edge weights for @p graph. Relocated
+ * to @p mr as well if provided.
+ * @param mr Memory resource to allocate the relocated edge partition indices and edge weights from.
+ * The memory resource should be device accessible and should outlive the returned objects.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the relocated graph and the (optional) relocated edge weights.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>
+relocate_graph_edges(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Symmetrize edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type identifiers. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param edgelist_srcs Vector of edge source vertex IDs. If multi-GPU, applying the
+ * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
+ * function to work (edges should be pre-shuffled).
+ * @param edgelist_dsts Vector of edge destination vertex IDs.
+ * @param edgelist_weights Vector of edge weights.
+ * @param edgelist_edge_ids Vector of edge ids
+ * @param edgelist_edge_types Vector of edge types
+ * @param edgelist_edge_start_times Vector of edge start times
+ * @param edgelist_edge_end_times Vector of edge end times
+ * @param reciprocal Flag indicating whether to keep (if set to `false`) or discard (if set to
+ * `true`) edges that appear only in one direction.
+ * @return Tuple of symmetrized sources, destinations, optional weights, optional edge ids, optional
+ * edge types, optional edge start times and optional edge end times
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<edge_time_t>>,
+           std::optional<rmm::device_uvector<edge_time_t>>>
+symmetrize_edgelist(raft::handle_t const& handle,
+                    rmm::device_uvector<vertex_t>&& edgelist_srcs,
+                    rmm::device_uvector<vertex_t>&& edgelist_dsts,
+                    std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+                    std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+                    std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
+                    std::optional<rmm::device_uvector<edge_time_t>>&& edgelist_edge_start_times,
+                    std::optional<rmm::device_uvector<edge_time_t>>&& edgelist_edge_end_times,
+                    bool reciprocal);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Symmetrize the input graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph object to be symmetrized.
+ * @param edge_weights Optional owning object holding edge weights for @p graph.
+ * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
+ * IDs. This should be valid if multi-GPU.
+ * @param reciprocal If true, an edge is kept only when the reversed edge also exists. If false,
+ * keep (and symmetrize) all the edges that appear only in one direction.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Return a symmetrized graph, an owning object holding edge weights (if @p
+ * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
+ * @p renumber_map.has_value() is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+symmetrize_graph(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+                                weight_t>>&& edge_weights,
+  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
+  bool reciprocal         = false,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Transpose the input graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph object to be transposed.
+ * @param edge_weights Optional owning object holding edge weights for @p graph.
+ * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
+ * IDs. This should be valid if multi-GPU.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Return a transposed graph, an owning object holding edge weights (if @p
+ * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
+ * @p renumber_map.has_value() is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+transpose_graph(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+                                weight_t>>&& edge_weights,
+  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Transpose the storage format (no change in an actual graph topology).
+ *
+ * In SG, convert between CSR and CSC. In multi-GPU, currently convert between CSR + DCSR hybrid
+ * and CSC + DCSC hybrid (but the internal representation in multi-GPU is subject to change).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph object to transpose its storage format.
+ * @param edge_weights Optional owning object holding edge weights for @p graph.
+ * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
+ * IDs. This should be valid if multi-GPU.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>,
+ * @return Return a storage transposed graph, an owning object holding edge weights (if @p
+ * edge_weights.has_value() is true) and a new renumber map (to recover the original vertex IDs, if
+ * @p renumber_map.has_value() is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+                                weight_t>>&& edge_weights,
+  std::optional<rmm::device_uvector<vertex_t>>&& renumber_map,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Create a copy of a graph with the transposed storage format (no change in an actual graph
+ * topology).
+ *
+ * Unlike the overload taking the graph by rvalue reference, the input graph is left intact, so
+ * both storage formats can be kept (e.g. to run algorithms requiring either format on the same
+ * graph without converting back and forth). This requires memory for both graphs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to copy.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param renumber_map Renumber map to recover the original vertex IDs from the renumbered vertex
+ * IDs. This should be valid if multi-GPU.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Return a storage transposed graph, an owning object holding edge weights (if @p
+ * edge_weight_view.has_value() is true) and a new renumber map (to recover the original vertex
+ * IDs, if @p renumber_map.has_value() is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Method to collapse the multi-edges of the coarsened graph in coarsen_graph.
+ */
+enum class coarsen_groupby_t {
+  sort /* sort the relabeled edges and reduce the multi-edge weights (deterministic) */,
+  hash /* bucket the relabeled edges by source (destination if store_transposed) and collapse the
+          multi-edges with a hash table per bucket (avoids sorting the edges, but the summation
+          order of the multi-edge weights is not deterministic) */
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Compute the coarsened graph.
+ *
+ * Aggregates the vertices with the same label to a new vertex in the output coarsened graph.
+ * Multi-edges in the coarsened graph are collapsed to a single edge with its weight equal to the
+ * sum of multi-edge weights.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to be coarsened.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param labels Vertex labels (assigned to this process in multi-GPU) to be used in coarsening.
+ * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
+ * is true). Setting @p renumber to false is highly discouraged except for testing as this
+ * negatively affects the performance and memory footprint. If @p renumber is set to true, @p labels
+ * should have only non-negative integers and the number of vertices is assumed to be the maximum
+ * element in @p labels (reduced over the entire set of GPUs in multi-GPU) + 1. This may produce
+ * many isolated vertices if the number of unique elements (over the entire set of GPUs in
+ * multi-GPU) in @p labels is much smaller than the assumed number of vertices.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the coarsened graph, coarsened graph edge weights (if @p
+ * edge_weight_view.has_value() is true) and the renumber map (if @p renumber is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+              std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+              vertex_t const* labels,
+              bool renumber,
+              bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Compute the coarsened graph with the given multi-edge grouping method.
+ *
+ * Same as the coarsen_graph overload above (which uses coarsen_groupby_t::sort), but @p groupby
+ * selects how the multi-edges of the coarsened graph are collapsed. coarsen_groupby_t::hash falls
+ * back to coarsen_groupby_t::sort if the range of the relabeled sources (destinations if
+ * store_transposed) is larger than the number of edges to group.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to be coarsened.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param labels Vertex labels (assigned to this process in multi-GPU) to be used in coarsening.
+ * @param renumber Flag indicating whether to renumber vertices or not (see the overload above).
+ * @param groupby Method to collapse the multi-edges of the coarsened graph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the coarsened graph, coarsened graph edge weights (if @p
+ * edge_weight_view.has_value() is true) and the renumber map (if @p renumber is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+coarsen_graph(raft::handle_t const& handle,
               graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
               std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
               vertex_t const* labels,
               bool renumber,
+              coarsen_groupby_t groupby,
               bool do_expensive_check = false);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Compute the coarsened graph, consuming the input graph.
+ *
+ * Same as the coarsen_graph overload taking a graph view, but the input graph and its edge weights
+ * are released once the coarsened edge list is built and before the coarsened graph is created,
+ * so the input and the coarsened graphs do not co-exist (this lowers the peak memory usage of
+ * multi-level algorithms that coarsen their own intermediate graphs).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph Graph object to be coarsened (released inside this function, @p graph is empty on
+ * return).
+ * @param edge_weights Optional edge weights of @p graph (released inside this function).
+ * @param labels Vertex labels (assigned to this process in multi-GPU) to be used in coarsening.
+ * Should not point to memory owned by @p graph.
+ * @param renumber Flag indicating whether to renumber vertices or not (see the overload above).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the coarsened graph, coarsened graph edge weights (if @p
+ * edge_weights.has_value() is true) and the renumber map (if @p renumber is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>&&
+    edge_weights,
+  vertex_t const* labels,
+  bool renumber,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Relabel old labels to new labels.
@@ -705,6 +1543,34 @@ extract_induced_subgraphs(
   raft::device_span<vertex_t const> subgraph_vertices,
   bool do_expensive_check = false);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Derive the edge mask equivalent to the vertex mask attached to a graph view.
+ *
+ * An edge is kept (the mask bit is set) if both end points are kept by the vertex mask and the edge
+ * is kept by the edge mask attached to @p graph_view (if any). Attaching the returned edge mask to
+ * the graph view runs the algorithms (and the primitives) on the subgraph induced by the kept
+ * vertices without extracting the subgraph and creating a new graph object. Masked out vertices
+ * become isolated vertices (they still appear in per-vertex outputs).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object with a vertex mask attached (see
+ * graph_view_t::attach_vertex_mask).
+ * @return Edge mask to attach to @p graph_view (or to a view of the same graph).
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
+compute_edge_mask_from_vertex_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view);
+
 // FIXME: this code should be re-factored (there should be a header file for this function including
 // implementation) to support different types (arithmetic types or thrust tuple of arithmetic types)
 // of edge properties.
@@ -861,25 +1727,275 @@ create_graph_from_edgelist(
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered.
- * This parameter can be used to include isolated vertices. If @p renumber is false and @p vertices
- * is valid, @p vertices elements should be consecutive integers starting from 0. If multi-GPU,
- * applying the compute_gpu_id_from_vertex_t to every vertex should return the local GPU ID for this
- * function to work (vertices should be pre-shuffled).
- * @param edgelist_srcs Vectors of edge source vertex IDs. If multi-GPU, applying the
- * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
- * function to work (edges should be pre-shuffled).
- * @param edgelist_dsts Vectors of edge destination vertex IDs.
- * @param edgelist_weights Vectors of weight values for edges
- * @param edgelist_edge_ids Vectors of edge_id values for edges
- * @param edgelist_edge_types Vectors of edge_type values for edges
- * @param graph_properties Properties of the graph represented by the input (optional vertex list
- * and) edge list.
- * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
- * is true).
- * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered.
+ * This parameter can be used to include isolated vertices. If @p renumber is false and @p vertices
+ * is valid, @p vertices elements should be consecutive integers starting from 0. If multi-GPU,
+ * applying the compute_gpu_id_from_vertex_t to every vertex should return the local GPU ID for this
+ * function to work (vertices should be pre-shuffled).
+ * @param edgelist_srcs Vectors of edge source vertex IDs. If multi-GPU, applying the
+ * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
+ * function to work (edges should be pre-shuffled).
+ * @param edgelist_dsts Vectors of edge destination vertex IDs.
+ * @param edgelist_weights Vectors of weight values for edges
+ * @param edgelist_edge_ids Vectors of edge_id values for edges
+ * @param edgelist_edge_types Vectors of edge_type values for edges
+ * @param graph_properties Properties of the graph represented by the input (optional vertex list
+ * and) edge list.
+ * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
+ * is true).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the generated graph and optional edge_property_t objects storing the provided
+ * edge properties and a renumber map (if @p renumber is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_srcs,
+  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_dsts,
+  std::optional<std::vector<rmm::device_uvector<weight_t>>>&& edgelist_weights,
+  std::optional<std::vector<rmm::device_uvector<edge_t>>>&& edgelist_edge_ids,
+  std::optional<std::vector<rmm::device_uvector<edge_type_t>>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief create a graph from (the optional vertex list and) the given edge list (with optional edge
+ * IDs, types, start and end times).
+ *
+ * This version takes edge list in multiple chunks (e.g. edge data from multiple files).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weight.  Needs to be floating point type
+ * @tparam edge_type_t Type of edge type.  Needs to be an integral type, currently only int32_t is
+ * supported
+ * @tparam edge_time_t Type of edge time.  Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered.
+ * This parameter can be used to include isolated vertices. If @p renumber is false and @p vertices
+ * is valid, @p vertices elements should be consecutive integers starting from 0. If multi-GPU,
+ * applying the compute_gpu_id_from_vertex_t to every vertex should return the local GPU ID for this
+ * function to work (vertices should be pre-shuffled).
+ * @param edgelist_srcs Vectors of edge source vertex IDs. If multi-GPU, applying the
+ * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
+ * function to work (edges should be pre-shuffled).
+ * @param edgelist_dsts Vectors of edge destination vertex IDs.
+ * @param edgelist_weights Vectors of weight values for edges
+ * @param edgelist_edge_ids Vectors of edge_id values for edges
+ * @param edgelist_edge_types Vectors of edge_type values for edges
+ * @param edgelist_edge_start_times Vector of start time values for edges
+ * @param edgelist_edge_end_times Vector of end time values for edges
+ * @param graph_properties Properties of the graph represented by the input (optional vertex list
+ * and) edge list.
+ * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
+ * is true).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the generated graph and optional edge_property_t objects storing the provided
+ * edge properties and a renumber map (if @p renumber is true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_time_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_time_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_srcs,
+  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_dsts,
+  std::optional<std::vector<rmm::device_uvector<weight_t>>>&& edgelist_weights,
+  std::optional<std::vector<rmm::device_uvector<edge_t>>>&& edgelist_edge_ids,
+  std::optional<std::vector<rmm::device_uvector<edge_type_t>>>&& edgelist_edge_types,
+  std::optional<std::vector<rmm::device_uvector<edge_time_t>>>&& edgelist_edge_start_times,
+  std::optional<std::vector<rmm::device_uvector<edge_time_t>>>&& edgelist_edge_end_times,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief create a multi-GPU graph whose vertex partitions follow a caller-provided vertex to GPU
+ * assignment.
+ *
+ * The default multi-GPU graph creation path assigns vertices to GPUs by hashing external vertex
+ * IDs, which ignores the graph structure. If most edges connect vertices assigned to the same GPU
+ * (e.g. the assignment is computed by compute_vertex_gpu_assignment), fewer edge end points need to
+ * be fetched from remote GPUs, and this reduces the communication volume in the primitives that
+ * access edge source/destination properties of a subset of vertices.
+ *
+ * Internally, every vertex is paired with a proxy vertex ID that hashes to the assigned GPU, the
+ * graph is built from the proxy edge list, and the proxy IDs are replaced with the original
+ * external vertex IDs in the returned renumber map. Vertex-valued inputs to algorithms running on
+ * the returned graph should be shuffled following the same assignment (e.g. using the returned
+ * renumber map) instead of using the hash-based shuffle functions.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weight.  Needs to be floating point type
+ * @tparam edge_type_t Type of edge type.  Needs to be an integral type, currently only int32_t is
+ * supported
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true). Only multi-GPU is supported.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertex_gpu_assignment Tuple of (external) vertex IDs and the GPU ranks (in [0, comm_size))
+ * the vertices are assigned to. Every vertex in the graph (including isolated vertices) should
+ * appear exactly once (over all the GPUs). The pairs can be stored in any GPU.
+ * @param edgelist_srcs Vector of edge source (external) vertex IDs. Unlike the default overload,
+ * edges do not need to be pre-shuffled.
+ * @param edgelist_dsts Vector of edge destination (external) vertex IDs.
+ * @param edgelist_weights Vector of weight values for edges
+ * @param edgelist_edge_ids Vector of edge_id values for edges
+ * @param edgelist_edge_types Vector of edge_type values for edges
+ * @param graph_properties Properties of the graph represented by the input edge list.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the generated graph and optional edge_property_t objects storing the provided
+ * edge properties and a renumber map. The local vertex partition (i.e. the renumber map) of each
+ * GPU coincides with the set of vertices assigned to the GPU.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist(
+  raft::handle_t const& handle,
+  std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>>&& vertex_gpu_assignment,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief compute a vertex to GPU assignment that reduces the number of edges crossing GPU
+ * boundaries.
+ *
+ * The vertices are partitioned into comm_size balanced parts using multilevel_partition, and part
+ * i is assigned to GPU rank i. The result can be passed to the create_graph_from_edgelist overload
+ * taking a vertex to GPU assignment to re-create the graph with a communication-volume-reducing
+ * vertex partitioning. This pays off if the graph is used repeatedly.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weight.  Needs to be floating point type
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true). Only multi-GPU is supported.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph. Should be symmetric.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param renumber_map Renumber map for the local vertex partition of @p graph_view.
+ * @param imbalance_tolerance Allowed relative excess of the number of vertices assigned to a GPU
+ * over the perfectly balanced value.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of (external) vertex IDs (the local elements of @p renumber_map) and the GPU ranks
+ * assigned to the vertices.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>> compute_vertex_gpu_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> renumber_map,
+  double imbalance_tolerance = 0.03,
+  bool do_expensive_check    = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief create a graph sharing the vertex set (the renumber map and the vertex partitioning) of
+ * an existing graph from the given edge list (with optional edge IDs and types).
+ *
+ * This is useful for storing multiple edge sets (e.g. relation-specific layers of a multigraph)
+ * over the same vertex set. The created graph has the same internal vertex IDs (and the same local
+ * vertex partition range in multi-GPU) as @p base_graph_view, so vertex property values (e.g.
+ * algorithm outputs) can be shared across the graphs without unrenumbering and renumbering, and
+ * the renumber map needs to be stored only once.
+ *
+ * Vertices are sorted by their degrees in @p base_graph_view and not in the created graph, so the
+ * created graph does not use degree-based segments (in single-GPU) or places every vertex in the
+ * mid-degree segment (in multi-GPU), and hypersparse (DCSR or DCSC) storage is not used. Graph
+ * algorithms run correctly on the created graph, but may run slower than on a graph created with
+ * its own renumber map if the vertex degree distributions of the graphs differ significantly.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weight.  Needs to be floating point type
+ * @tparam edge_type_t Type of edge type.  Needs to be an integral type, currently only int32_t is
+ * supported
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param base_graph_view Graph view object of the graph to share the vertex set with.
+ * @param base_renumber_map Renumber map of @p base_graph_view (for the local vertex partition in
+ * multi-GPU).
+ * @param edgelist_srcs Vector of edge source (external) vertex IDs. Every edge end point should
+ * appear in the renumber map of @p base_graph_view. Unlike the default overload, edges do not need
+ * to be pre-shuffled in multi-GPU.
+ * @param edgelist_dsts Vector of edge destination (external) vertex IDs.
+ * @param edgelist_weights Vector of weight values for edges
+ * @param edgelist_edge_ids Vector of edge_id values for edges
+ * @param edgelist_edge_types Vector of edge_type values for edges
+ * @param graph_properties Properties of the graph represented by the input edge list.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`,
+ * the symmetry of the edge list is checked only in single-GPU).
  * @return Tuple of the generated graph and optional edge_property_t objects storing the provided
- * edge properties and a renumber map (if @p renumber is true).
+ * edge properties. @p base_renumber_map serves as the renumber map of the generated graph.
  */
 template <typename vertex_t,
           typename edge_t,
@@ -894,93 +2010,96 @@ std::tuple<
   std::optional<
     edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
   std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-create_graph_from_edgelist(
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>>
+create_graph_from_edgelist_with_shared_vertices(
   raft::handle_t const& handle,
-  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
-  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_srcs,
-  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_dsts,
-  std::optional<std::vector<rmm::device_uvector<weight_t>>>&& edgelist_weights,
-  std::optional<std::vector<rmm::device_uvector<edge_t>>>&& edgelist_edge_ids,
-  std::optional<std::vector<rmm::device_uvector<edge_type_t>>>&& edgelist_edge_types,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& base_graph_view,
+  raft::device_span<vertex_t const> base_renumber_map,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
   graph_properties_t graph_properties,
-  bool renumber,
   bool do_expensive_check = false);
 
 /**
  * @ingroup graph_functions_cpp
- * @brief create a graph from (the optional vertex list and) the given edge list (with optional edge
- * IDs, types, start and end times).
+ * @brief create a graph topology from (the optional vertex list and) the given edge list and
+ * return an edge permutation to attach edge properties later.
  *
- * This version takes edge list in multiple chunks (e.g. edge data from multiple files).
+ * create_graph_from_edgelist carries every edge property through the sort and shuffle phases of
+ * graph construction. This function carries only a single edge_t column (the edge positions in the
+ * input edge list), and edge property values are attached afterwards one column at a time with
+ * attach_edgelist_property. This reduces the peak memory usage of graph construction if many edge
+ * properties exist, and edge properties unused by the caller need not be loaded at all.
  *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
- * @tparam weight_t Type of edge weight.  Needs to be floating point type
- * @tparam edge_type_t Type of edge type.  Needs to be an integral type, currently only int32_t is
- * supported
- * @tparam edge_time_t Type of edge time.  Needs to be an integral type.
  * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
- * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * true) as major indices in storing edges using a 2D sparse matrix.
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * or multi-GPU (true).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered.
- * This parameter can be used to include isolated vertices. If @p renumber is false and @p vertices
- * is valid, @p vertices elements should be consecutive integers starting from 0. If multi-GPU,
- * applying the compute_gpu_id_from_vertex_t to every vertex should return the local GPU ID for this
- * function to work (vertices should be pre-shuffled).
- * @param edgelist_srcs Vectors of edge source vertex IDs. If multi-GPU, applying the
- * compute_gpu_id_from_ext_edge_endpoints_t to every edge should return the local GPU ID for this
- * function to work (edges should be pre-shuffled).
- * @param edgelist_dsts Vectors of edge destination vertex IDs.
- * @param edgelist_weights Vectors of weight values for edges
- * @param edgelist_edge_ids Vectors of edge_id values for edges
- * @param edgelist_edge_types Vectors of edge_type values for edges
- * @param edgelist_edge_start_times Vector of start time values for edges
- * @param edgelist_edge_end_times Vector of end time values for edges
+ * @param vertices  If valid, part of the entire set of vertices in the graph to be renumbered (see
+ * create_graph_from_edgelist).
+ * @param edgelist_srcs Vector of edge source vertex IDs. If multi-GPU, edges should be
+ * pre-shuffled (see create_graph_from_edgelist).
+ * @param edgelist_dsts Vector of edge destination vertex IDs.
  * @param graph_properties Properties of the graph represented by the input (optional vertex list
  * and) edge list.
  * @param renumber Flag indicating whether to renumber vertices or not (must be true if @p multi_gpu
  * is true).
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
- * @return Tuple of the generated graph and optional edge_property_t objects storing the provided
- * edge properties and a renumber map (if @p renumber is true).
+ * @return Tuple of the generated graph, an edge_property_t object storing the position of each
+ * edge in the input edge list (local to this GPU in multi-GPU), and a renumber map (if @p renumber
+ * is true).
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+           edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_topology_from_edgelist(raft::handle_t const& handle,
+                                    std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+                                    rmm::device_uvector<vertex_t>&& edgelist_srcs,
+                                    rmm::device_uvector<vertex_t>&& edgelist_dsts,
+                                    graph_properties_t graph_properties,
+                                    bool renumber,
+                                    bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief attach an edge property column to a graph created by create_graph_topology_from_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @tparam T Type of the edge property values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph returned by create_graph_topology_from_edgelist.
+ * @param edge_permutation_view View object of the edge permutation returned by
+ * create_graph_topology_from_edgelist.
+ * @param edgelist_values Edge property values in the order of the edge list passed to
+ * create_graph_topology_from_edgelist (local to this GPU in multi-GPU).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return edge_property_t object storing the edge property values for @p graph_view.
  */
 template <typename vertex_t,
           typename edge_t,
-          typename weight_t,
-          typename edge_type_t,
-          typename edge_time_t,
           bool store_transposed,
-          bool multi_gpu>
-std::tuple<
-  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_time_t>>,
-  std::optional<
-    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_time_t>>,
-  std::optional<rmm::device_uvector<vertex_t>>>
-create_graph_from_edgelist(
+          bool multi_gpu,
+          typename T>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, T>
+attach_edgelist_property(
   raft::handle_t const& handle,
-  std::optional<rmm::device_uvector<vertex_t>>&& vertices,
-  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_srcs,
-  std::vector<rmm::device_uvector<vertex_t>>&& edgelist_dsts,
-  std::optional<std::vector<rmm::device_uvector<weight_t>>>&& edgelist_weights,
-  std::optional<std::vector<rmm::device_uvector<edge_t>>>&& edgelist_edge_ids,
-  std::optional<std::vector<rmm::device_uvector<edge_type_t>>>&& edgelist_edge_types,
-  std::optional<std::vector<rmm::device_uvector<edge_time_t>>>&& edgelist_edge_start_times,
-  std::optional<std::vector<rmm::device_uvector<edge_time_t>>>&& edgelist_edge_end_times,
-  graph_properties_t graph_properties,
-  bool renumber,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_t const*> edge_permutation_view,
+  raft::device_span<T const> edgelist_values,
   bool do_expensive_check = false);
 
 /**
@@ -1149,6 +2268,73 @@ weight_t compute_total_edge_weight(
   graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
   edge_property_view_t<edge_t, weight_t const*> edge_weight_view);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Encode edge weights in a 16 bit floating point format (FP16 or BF16).
+ *
+ * The encoded weights are stored as raw bits in an edge property of type uint16_t (edge properties
+ * should have arithmetic value types) and take half (float) or a quarter (double) of the memory of
+ * @p edge_weight_view. Decode with @ref half_edge_weight_decoder_t.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param  handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @param precision 16 bit floating point format to encode the edge weights in.
+ * @return Edge property object holding the encoded edge weights.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint16_t>
+encode_half_edge_weights(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  half_precision_t precision);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Quantize edge weights to uint8_t.
+ *
+ * Edge weights are linearly mapped from [minimum weight, maximum weight] (over all the GPUs) to
+ * [0, 255] and rounded to the nearest integer. The returned decoder maps the quantized values back
+ * to float.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param  handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param edge_weight_view View object holding edge weights for @p graph_view.
+ * @return Tuple of an edge property object holding the quantized edge weights and the decoder
+ * (scale & offset) to reconstruct the edge weights.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint8_t>,
+           uint8_edge_weight_decoder_t>
+quantize_edge_weights(raft::handle_t const& handle,
+                      graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                      edge_property_view_t<edge_t, weight_t const*> edge_weight_view);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Select random vertices
@@ -1182,6 +2368,90 @@ rmm::device_uvector<vertex_t> select_random_vertices(
   bool sort_vertices,
   bool do_expensive_check = false);
 
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Select the top-k vertices based on the vertex property values (e.g. algorithm outputs)
+ *
+ * Each GPU first reduces its local vertices to (at most) @p k candidates and unrenumbers only the
+ * candidates with its local renumber map, so neither the full property array nor the renumber map
+ * is shuffled. Ties are broken by internal vertex IDs (smaller vertex IDs are selected first).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam value_t Type of vertex property values. Needs to be an arithmetic type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param vertex_values Vertex property values for the local vertex partition range.
+ * @param renumber_map Optional renumber map (for the local vertex partition range). If provided,
+ * the selected vertices are returned in external IDs.
+ * @param k Number of vertices to select.
+ * @param largest If true, select the vertices with the largest values; otherwise, select the
+ * vertices with the smallest values.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the selected vertices and their property values, ordered by values. The same
+ * (at most @p k) vertices are returned in every GPU in multi-GPU.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<value_t>> select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  raft::device_span<value_t const> vertex_values,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Select the vertices whose property values (e.g. algorithm outputs) pass a threshold
+ *
+ * The selection is done in the GPUs owning the vertices and only the selected vertices are
+ * unrenumbered (with the local renumber map), so this does not require inter-GPU communication.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam value_t Type of vertex property values. Needs to be an arithmetic type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param vertex_values Vertex property values for the local vertex partition range.
+ * @param renumber_map Optional renumber map (for the local vertex partition range). If provided,
+ * the selected vertices are returned in external IDs.
+ * @param threshold Threshold value.
+ * @param greater If true, select the vertices with values greater than or equal to @p threshold;
+ * otherwise, select the vertices with values less than or equal to @p threshold.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the selected local vertices and their property values (in the ascending internal
+ * vertex ID order).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<value_t>>
+select_vertices_by_threshold(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  raft::device_span<value_t const> vertex_values,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  value_t threshold,
+  bool greater,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Remove self loops from an edge list
@@ -1284,6 +2554,69 @@ remove_multi_edges(raft::handle_t const& handle,
                    std::optional<rmm::device_uvector<edge_time_t>>&& edgelist_edge_edge_times,
                    bool keep_min_value_edge = false);
 
+/**
+ * @brief Operators to reduce the weights of multi-edges in clean_edgelist.
+ */
+enum class edge_weight_reduce_op_t {
+  any /* keep an arbitrary weight (minimum if symmetrizing, to keep the weights symmetric) */,
+  sum,
+  min,
+  max
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Remove self-loops, symmetrize, and reduce multi-edges of an edge list in one pipeline.
+ *
+ * This is equivalent to calling remove_self_loops, symmetrize_edgelist, and remove_multi_edges in
+ * sequence (with weight reduction instead of selection), but the edge list is shuffled (if
+ * multi-GPU) and sorted only once: the reversed edges are appended before shuffling, and an edge's
+ * multi-edges and the reversed copies of its opposite direction edges are reduced together in a
+ * single reduction pass. Use estimate_clean_edgelist_peak_memory to estimate the peak memory
+ * requirement.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param edgelist_srcs Vector of edge source vertex IDs. If multi-GPU, the edges need not be
+ * pre-shuffled; the returned edges are shuffled treating sources as majors (swap @p edgelist_srcs
+ * and @p edgelist_dsts if the graph will store transposed edges).
+ * @param edgelist_dsts Vector of edge destination vertex IDs.
+ * @param edgelist_weights Optional vector of edge weights.
+ * @param remove_self_loops Flag indicating whether to remove self-loops.
+ * @param symmetrize Flag indicating whether to add the reversed edges (so that an edge exists in
+ * both directions with the same weight).
+ * @param reduce_op Operator to reduce the weights of multi-edges (after symmetrization).
+ * @return Tuple of vectors storing edge sources, destinations, and optional weights (sorted by
+ * (source, destination) in each GPU).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+clean_edgelist(raft::handle_t const& handle,
+               rmm::device_uvector<vertex_t>&& edgelist_srcs,
+               rmm::device_uvector<vertex_t>&& edgelist_dsts,
+               std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+               bool remove_self_loops,
+               bool symmetrize,
+               edge_weight_reduce_op_t reduce_op = edge_weight_reduce_op_t::any);
+
+/**
+ * @brief Estimate the peak device memory (in bytes) clean_edgelist temporarily requires (including
+ * the input edge list) for @p num_edges (local) input edges.
+ *
+ * The estimate assumes balanced shuffles in multi-GPU and no self-loops to remove (an upper bound
+ * otherwise).
+ */
+template <typename vertex_t, typename weight_t>
+size_t estimate_clean_edgelist_peak_memory(size_t num_edges, bool has_weights, bool symmetrize);
+
 /**
  * @ingroup graph_functions_cpp
  * @brief Shuffle external vertex ids to the proper GPU.
@@ -1326,6 +2659,8 @@ shuffle_external_vertex_value_pairs(raft::handle_t const& handle,
  * @tparam vertex_t    Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t      Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t    Type of edge weight. Currently float and double are supported.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time. Needs to be an integral type.
  *
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
@@ -1334,22 +2669,88 @@ shuffle_external_vertex_value_pairs(raft::handle_t const& handle,
  * @param edge_weights  Optional list of edge weights
  * @param edge_ids  Optional list of edge ids
  * @param edge_types Optional list of edge types
+ * @param edge_start_times Optional list of edge start times
+ * @param edge_end_times Optional list of edge end times
  * @return Tuple of vectors storing edge sources, destinations, optional weights,
- *          optional edge ids, optional edge types mapped to this GPU and a vector storing the
- *          number of edges received from each GPU.
+ *          optional edge ids, optional edge types, optional edge start times, optional edge end
+ *          times mapped to this GPU and a vector storing the number of edges received from each
+ *          GPU.
  */
-template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
            std::optional<rmm::device_uvector<weight_t>>,
            std::optional<rmm::device_uvector<edge_t>>,
            std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<edge_time_t>>,
+           std::optional<rmm::device_uvector<edge_time_t>>,
            std::vector<size_t>>
 shuffle_external_edges(raft::handle_t const& handle,
                        rmm::device_uvector<vertex_t>&& edge_srcs,
                        rmm::device_uvector<vertex_t>&& edge_dsts,
                        std::optional<rmm::device_uvector<weight_t>>&& edge_weights,
                        std::optional<rmm::device_uvector<edge_t>>&& edge_ids,
-                       std::optional<rmm::device_uvector<edge_type_t>>&& edge_types);
+                       std::optional<rmm::device_uvector<edge_type_t>>&& edge_types,
+                       std::optional<rmm::device_uvector<edge_time_t>>&& edge_start_times,
+                       std::optional<rmm::device_uvector<edge_time_t>>&& edge_end_times);
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Shuffle external edges to the proper GPU in chunks to bound the temporary memory usage.
+ *
+ * shuffle_external_edges groups and shuffles the entire edge list at once, and the temporary
+ * buffers can exceed twice the edge list size. This function shuffles at most (approximately) @p
+ * memory_budget bytes of edges at a time and returns the received edges in chunks (the input edge
+ * list is released before returning). The returned chunks can be directly passed to the
+ * create_graph_from_edgelist overload taking edge list chunks, which sorts & compresses the chunks
+ * without concatenating them. Every GPU shuffles the same number of chunks (smaller edge lists are
+ * padded with empty chunks). This function treats @p edge_srcs as majors; swap @p edge_srcs and @p
+ * edge_dsts if the graph will store transposed edges.
+ *
+ * @tparam vertex_t    Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t      Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t    Type of edge weight. Currently float and double are supported.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time. Needs to be an integral type.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param edge_srcs  List of source vertex ids
+ * @param edge_dsts  List of destination vertex ids
+ * @param edge_weights  Optional list of edge weights
+ * @param edge_ids  Optional list of edge ids
+ * @param edge_types Optional list of edge types
+ * @param edge_start_times Optional list of edge start times
+ * @param edge_end_times Optional list of edge end times
+ * @param memory_budget Temporary memory (in bytes) to be used in shuffling each chunk.
+ * @return Tuple of vectors of edge source, destination, optional weight, optional edge id,
+ * optional edge type, optional edge start time, and optional edge end time chunks mapped to this
+ * GPU.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>,
+           std::vector<rmm::device_uvector<vertex_t>>,
+           std::optional<std::vector<rmm::device_uvector<weight_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_type_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_time_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_time_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<vertex_t>&& edge_srcs,
+                                 rmm::device_uvector<vertex_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<weight_t>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<edge_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<edge_type_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<edge_time_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<edge_time_t>>&& edge_end_times,
+                                 size_t memory_budget);
 
 }  // namespace cugraph
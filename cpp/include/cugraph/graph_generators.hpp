@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 /** @defgroup graph_generators_cpp C++ Graph Generators
  */
@@ -140,6 +141,56 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generat
   bool clip_and_flip       = false,
   bool scramble_vertex_ids = false);
 
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate the edges of an R-mat graph that belong to this GPU's 2D edge partition, in
+ * bounded chunks.
+ *
+ * Unlike generate_rmat_edgelist, this function never materializes (or shuffles) the global edge
+ * list. In multi-GPU, every GPU generates the same edge stream (so @p rng_state should be identical
+ * in every GPU and @p num_edges should be the global number of edges) and keeps only the edges
+ * assigned to itself. The returned chunks can be passed directly to the create_graph_from_edgelist
+ * overload taking edge list chunks. The generated edge set is identical to the edge set of
+ * generate_rmat_edgelist with the same input parameters.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state RAFT RNG state, updated with each call
+ * @param scale Scale factor to set the number of vertices in the graph. Vertex IDs have values in
+ * [0, V), where V = 1 << @p scale.
+ * @param num_edges Number of edges to generate (in the entire graph).
+ * @param a a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param b a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param c a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator.
+ * @param clip_and_flip Flag controlling whether to generate edges only in the lower triangular part
+ * (including the diagonal) of the graph adjacency matrix (if set to `true`) or not (if set to
+ * `false`).
+ * @param scramble_vertex_ids Flag controlling whether to scramble vertex ID bits (if set to `true`)
+ * or not (if set to `false`).
+ * @param store_transposed Flag indicating whether the edges will be used to create a graph storing
+ * transposed edges (relevant only in multi-GPU to find the edges in this GPU's partition).
+ * @param max_chunk_size Maximum number of edges in each returned chunk.
+ * @return std::tuple<std::vector<rmm::device_uvector<vertex_t>>,
+ * std::vector<rmm::device_uvector<vertex_t>>> A tuple of edge source vertex ID chunks and edge
+ * destination vertex ID chunks.
+ */
+template <typename vertex_t, bool multi_gpu>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>, std::vector<rmm::device_uvector<vertex_t>>>
+generate_rmat_edgelist_for_local_partition(raft::handle_t const& handle,
+                                           raft::random::RngState& rng_state,
+                                           size_t scale,
+                                           size_t num_edges,
+                                           double a                 = 0.57,
+                                           double b                 = 0.19,
+                                           double c                 = 0.19,
+                                           bool clip_and_flip       = false,
+                                           bool scramble_vertex_ids = false,
+                                           bool store_transposed    = false,
+                                           size_t max_chunk_size    = size_t{1} << 26);
+
 /**
  * @ingroup graph_generators_cpp
  * @brief generate an edge list for a bipartite R-mat graph.
@@ -422,6 +473,43 @@ generate_erdos_renyi_graph_edgelist_gnp(raft::handle_t const& handle,
                                         vertex_t base_vertex_id,
                                         uint64_t seed = 0);
 
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate the edges of an Erdos-Renyi graph (G(n,p) model) that belong to this GPU's 2D
+ * edge partition, in bounded chunks.
+ *
+ * Every GPU visits every candidate edge (O(n^2) work per GPU) but keeps only the edges assigned to
+ * itself, so the global edge list is never materialized (or shuffled). @p seed should be identical
+ * in every GPU. The returned chunks can be passed directly to the create_graph_from_edgelist
+ * overload taking edge list chunks.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param num_vertices Number of vertices to use in the generated graph
+ * @param p Probability for edge creation
+ * @param base_vertex_id Starting vertex id for the generated graph
+ * @param seed Seed value for the random number generator.
+ * @param store_transposed Flag indicating whether the edges will be used to create a graph storing
+ * transposed edges (relevant only in multi-GPU to find the edges in this GPU's partition).
+ * @param max_chunk_size Maximum number of edges in each returned chunk.
+ * @return std::tuple<std::vector<rmm::device_uvector<vertex_t>>,
+ * std::vector<rmm::device_uvector<vertex_t>>> A tuple of edge source vertex ID chunks and edge
+ * destination vertex ID chunks.
+ */
+template <typename vertex_t, bool multi_gpu>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>, std::vector<rmm::device_uvector<vertex_t>>>
+generate_erdos_renyi_graph_edgelist_gnp_for_local_partition(
+  raft::handle_t const& handle,
+  vertex_t num_vertices,
+  float p,
+  vertex_t base_vertex_id,
+  uint64_t seed         = 0,
+  bool store_transposed = false,
+  size_t max_chunk_size = size_t{1} << 26);
+
 /**
  * @ingroup graph_generators_cpp
  * @brief generate an edge lists for an Erdos-Renyi graph
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace cugraph {
+
+/**
+ * @brief CUDA IPC handles of the CSR (CSC if store_transposed) arrays of a single-GPU graph and
+ * the graph metadata.
+ *
+ * Created by export_graph_ipc_handle in the process owning the graph and passed to the
+ * attached_graph_t constructor in the other processes. This is a trivially copyable type, send it
+ * to the other processes as raw bytes (e.g. over a pipe or a Unix domain socket).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ */
+template <typename vertex_t, typename edge_t>
+struct graph_ipc_handle_t {
+  cudaUUID_t device_uuid{};  // the device storing the graph
+  bool store_transposed{false};
+
+  // CUDA IPC handles refer to the base of an allocation, the arrays may start at an offset (e.g.
+  // if allocated from a memory pool)
+  cudaIpcMemHandle_t offsets_mem_handle{};
+  size_t offsets_byte_offset{0};
+  cudaIpcMemHandle_t indices_mem_handle{};
+  size_t indices_byte_offset{0};
+
+  vertex_t number_of_vertices{0};
+  edge_t number_of_edges{0};
+  graph_properties_t properties{};
+
+  bool has_segment_offsets{false};
+  std::array<vertex_t, detail::num_sparse_segments_per_vertex_partition + 2> segment_offsets{};
+};
+
+/**
+ * @ingroup graph_functions_cpp
+ * @brief Export the CSR (CSC if store_transposed) arrays of a single-GPU graph through CUDA IPC,
+ * so other processes on the same node can attach to the graph without copying it.
+ *
+ * Every process attaching to the graph maps the arrays of @p graph_view instead of storing its own
+ * copy, so the graph is stored once per GPU and attaching is a constant time operation. The graph
+ * (the graph_t object @p graph_view is created from) should stay alive and unmodified until every
+ * attached_graph_t object is destroyed. The arrays should be allocated with cudaMalloc (e.g. with
+ * rmm::mr::cuda_memory_resource or a pool_memory_resource on top of it); CUDA IPC does not support
+ * stream-ordered (cudaMallocAsync) and managed memory allocations. Edge properties are not
+ * exported.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to export. Should not have an edge mask.
+ * @return IPC handle to pass to the attached_graph_t constructor in the other processes.
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed>
+graph_ipc_handle_t<vertex_t, edge_t> export_graph_ipc_handle(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, false> const& graph_view);
+
+/**
+ * @brief A read-only single-GPU graph mapping the CSR (CSC if store_transposed) arrays of a graph
+ * exported by another process (see export_graph_ipc_handle).
+ *
+ * The arrays are mapped with CUDA IPC (not copied) and unmapped when this object is destroyed.
+ * view() returns a graph view object to run the graph algorithms on (the algorithms only read the
+ * graph's arrays); the per-graph metadata (e.g. the minor degrees) is cached per process. A process
+ * should attach to an exported graph once and share the attached_graph_t object (CUDA IPC does not
+ * allow opening the same allocation more than once per process).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ */
+template <typename vertex_t, typename edge_t, bool store_transposed>
+class attached_graph_t {
+ public:
+  using vertex_type                           = vertex_t;
+  using edge_type                             = edge_t;
+  static constexpr bool is_storage_transposed = store_transposed;
+
+  /**
+   * @brief Attach to a graph exported by export_graph_ipc_handle in another process.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms. The current device should be the
+   * device storing the exported graph.
+   * @param ipc_handle IPC handle returned by export_graph_ipc_handle.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  attached_graph_t(raft::handle_t const& handle,
+                   graph_ipc_handle_t<vertex_t, edge_t> const& ipc_handle,
+                   bool do_expensive_check = false);
+
+  graph_view_t<vertex_t, edge_t, store_transposed, false> view() const { return graph_.view(); }
+
+ private:
+  // mapped allocations (shared if the offsets and indices arrays are in the same allocation),
+  // declared before graph_ to be unmapped after graph_ is destroyed
+  std::shared_ptr<void> offsets_mapping_{};
+  std::shared_ptr<void> indices_mapping_{};
+
+  graph_t<vertex_t, edge_t, store_transposed, false> graph_;
+};
+
+}  // namespace cugraph
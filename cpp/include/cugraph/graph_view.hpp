@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <cugraph/edge_property.hpp>
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
 #include <cugraph/vertex_partition_view.hpp>
 
 #include <raft/core/device_span.hpp>
@@ -31,6 +32,8 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -241,6 +244,13 @@ class partition_t {
 struct graph_properties_t {
   bool is_symmetric{false};
   bool is_multigraph{false};
+  // a hint set at graph creation: edge sources and edge destinations form two disjoint vertex sets
+  // (e.g. directed user-item graphs), so the edge source (destination) property values of the
+  // destination-only (source-only) vertices are never accessed. In multi-GPU, edge source and
+  // destination property values are stored (and communicated) only for the vertices appearing as
+  // edge sources and destinations, respectively, if this saves enough memory (see
+  // detail::bipartite_edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold).
+  bool is_bipartite{false};
 };
 
 namespace detail {
@@ -249,6 +259,13 @@ namespace detail {
 // sources/destinations) over (V / major_comm_size|minor_comm_size) is smaller than the threshold
 // value
 double constexpr edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold = 0.1;
+// the threshold value for the graphs with graph_properties_t::is_bipartite set, only one side of
+// the vertex set appears as edge sources (or destinations), so storing property values for the
+// unique edge sources (or destinations) is worth the (key, value) lookup overhead even at higher
+// fill ratios (e.g. ~0.5 for a balanced bipartite graph, this halves the edge source/destination
+// property memory and communication volume)
+double constexpr bipartite_edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold =
+  0.75;
 
 // FIXME: threshold values require tuning
 // use the hypersparse format (currently, DCSR or DCSC) for the vertices with their degrees smaller
@@ -260,6 +277,8 @@ size_t constexpr low_degree_threshold{
 size_t constexpr mid_degree_threshold{
   1024};  // belongs to the medium degree segment if the global degree is smaller than this value,
           // otherwise, belongs to the high degree segment.
+size_t constexpr min_low_degree_threshold{
+  4};  // lower bound of the low degree threshold chosen with degree_segment_policy_t::adaptive
 size_t constexpr num_sparse_segments_per_vertex_partition{3};  // high, mid, low
 
 // Common for both graph_view_t & graph_t and both single-GPU & multi-GPU versions
@@ -298,6 +317,18 @@ class graph_base_t {
   vertex_t number_of_vertices_{0};
 };
 
+// Metadata of a graph_t object requiring a pass over the edges to compute, computed on the first
+// request and shared by the views of the graph_t object. The edges of a graph_t object do not
+// change, so the cached values stay valid for the object's lifetime. The values describe the graph
+// without an edge mask; the views with an attached edge mask (whose values may change in place) do
+// not use the cache.
+template <typename edge_t>
+struct graph_metadata_cache_t {
+  std::mutex mutex{};
+  // in-degrees if !store_transposed, out-degrees otherwise
+  std::optional<rmm::device_uvector<edge_t>> minor_degrees{std::nullopt};
+};
+
 }  // namespace detail
 
 template <typename vertex_t,
@@ -351,6 +382,8 @@ struct graph_view_meta_t<vertex_t,
                      std::optional<raft::host_span<vertex_t const>>,
                      std::optional<std::byte> /* dummy */>
     local_sorted_unique_edge_dst_vertex_partition_offsets{std::nullopt};
+
+  detail::graph_metadata_cache_t<edge_t>* metadata_cache{nullptr};
 };
 
 // single-GPU version
@@ -367,6 +400,8 @@ struct graph_view_meta_t<vertex_t,
   // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered
   std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
   std::optional<std::vector<vertex_t>> hypersparse_degree_offsets{std::nullopt};
+
+  detail::graph_metadata_cache_t<edge_t>* metadata_cache{nullptr};
 };
 
 // graph_view_t is a non-owning graph class (note that graph_t is an owning graph class)
@@ -793,6 +828,28 @@ class graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if
     return edge_mask_view_;
   }
 
+  // vertex_mask_view stores one packed bool per vertex in the local vertex partition (a vertex is
+  // masked out if the bit is 0). Attaching a vertex mask does not change the graph by itself; use
+  // compute_edge_mask_from_vertex_mask to derive the edge mask excluding the edges incident to the
+  // masked out vertices (once per mask) and attach the derived edge mask.
+  void attach_vertex_mask(raft::device_span<uint32_t const> vertex_mask_view)
+  {
+    CUGRAPH_EXPECTS(
+      vertex_mask_view.size() == packed_bool_size(this->local_vertex_partition_range_size()),
+      "Invalid input argument: vertex_mask_view.size() does not match with the local vertex "
+      "partition range size.");
+    vertex_mask_view_ = vertex_mask_view;
+  }
+
+  void clear_vertex_mask() { vertex_mask_view_ = std::nullopt; }
+
+  bool has_vertex_mask() const { return vertex_mask_view_.has_value(); }
+
+  std::optional<raft::device_span<uint32_t const>> vertex_mask_view() const
+  {
+    return vertex_mask_view_;
+  }
+
  private:
   std::vector<raft::device_span<edge_t const>> edge_partition_offsets_{};
   std::vector<raft::device_span<vertex_t const>> edge_partition_indices_{};
@@ -840,6 +897,9 @@ class graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if
     local_sorted_unique_edge_dst_vertex_partition_offsets_{std::nullopt};
 
   std::optional<edge_property_view_t<edge_t, uint32_t const*, bool>> edge_mask_view_{std::nullopt};
+  std::optional<raft::device_span<uint32_t const>> vertex_mask_view_{std::nullopt};
+
+  detail::graph_metadata_cache_t<edge_t>* metadata_cache_{nullptr};
 };
 
 // single-GPU version
@@ -1108,6 +1168,28 @@ class graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if
     return edge_mask_view_;
   }
 
+  // vertex_mask_view stores one packed bool per vertex in the local vertex partition (a vertex is
+  // masked out if the bit is 0). Attaching a vertex mask does not change the graph by itself; use
+  // compute_edge_mask_from_vertex_mask to derive the edge mask excluding the edges incident to the
+  // masked out vertices (once per mask) and attach the derived edge mask.
+  void attach_vertex_mask(raft::device_span<uint32_t const> vertex_mask_view)
+  {
+    CUGRAPH_EXPECTS(
+      vertex_mask_view.size() == packed_bool_size(this->local_vertex_partition_range_size()),
+      "Invalid input argument: vertex_mask_view.size() does not match with the local vertex "
+      "partition range size.");
+    vertex_mask_view_ = vertex_mask_view;
+  }
+
+  void clear_vertex_mask() { vertex_mask_view_ = std::nullopt; }
+
+  bool has_vertex_mask() const { return vertex_mask_view_.has_value(); }
+
+  std::optional<raft::device_span<uint32_t const>> vertex_mask_view() const
+  {
+    return vertex_mask_view_;
+  }
+
  private:
   raft::device_span<edge_t const> offsets_{};
   raft::device_span<vertex_t const> indices_{};
@@ -1117,6 +1199,9 @@ class graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if
   std::optional<std::vector<vertex_t>> hypersparse_degree_offsets_{std::nullopt};
 
   std::optional<edge_property_view_t<edge_t, uint32_t const*, bool>> edge_mask_view_{std::nullopt};
+  std::optional<raft::device_span<uint32_t const>> vertex_mask_view_{std::nullopt};
+
+  detail::graph_metadata_cache_t<edge_t>* metadata_cache_{nullptr};
 };
 
 }  // namespace cugraph
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/mtmg/detail/pinned_host_buffer.hpp>
+
+#include <raft/core/host_span.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace cugraph {
+namespace mtmg {
+namespace detail {
+
+/**
+ * @brief Pinned host copy of a device array, with an event recorded after the copy
+ */
+template <typename T>
+class host_staging_t {
+ public:
+  host_staging_t(T const* d_data, size_t size, rmm::cuda_stream_view stream) : buffer_(size)
+  {
+    RAFT_CUDA_TRY(cudaEventCreateWithFlags(&copy_done_, cudaEventDisableTiming));
+    raft::update_host(buffer_.data(), d_data, size, stream.value());
+    RAFT_CUDA_TRY(cudaEventRecord(copy_done_, stream.value()));
+  }
+
+  host_staging_t(host_staging_t const&)            = delete;
+  host_staging_t& operator=(host_staging_t const&) = delete;
+
+  ~host_staging_t() { RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(copy_done_)); }
+
+  bool is_ready() const
+  {
+    auto status = cudaEventQuery(copy_done_);
+    if (status == cudaErrorNotReady) { return false; }
+    RAFT_CUDA_TRY(status);
+    return true;
+  }
+
+  void wait() const { RAFT_CUDA_TRY(cudaEventSynchronize(copy_done_)); }
+
+  T const* data() const { return buffer_.data(); }
+
+ private:
+  pinned_host_buffer_t<T> buffer_;
+  cudaEvent_t copy_done_{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Host result of an asynchronous MTMG operation
+ *
+ * The result is copied into pinned host memory on the stream of the operation, the calling
+ * thread only blocks when it asks for the values.  Several results can share one host buffer
+ * (e.g. the results of gathers batched into one collective), each result refers to its own range
+ * of that buffer.
+ */
+template <typename result_t>
+class async_host_result_t {
+  using staging_future_t = std::shared_future<std::shared_ptr<detail::host_staging_t<result_t>>>;
+
+ public:
+  async_host_result_t() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * @param staging  Future for the staging buffer, set once the operation filling the buffer has
+   *                 been issued (holds the exception of the operation if it failed)
+   * @param offset   Offset of this result in the staging buffer
+   * @param size     Number of elements in this result
+   */
+  async_host_result_t(staging_future_t staging, size_t offset, size_t size)
+    : staging_{std::move(staging)}, offset_{offset}, size_{size}
+  {
+  }
+
+  /**
+   * @brief Constructor for an operation that has already been issued
+   *
+   * @param staging  Staging buffer
+   * @param size     Number of elements in the staging buffer
+   */
+  async_host_result_t(std::shared_ptr<detail::host_staging_t<result_t>> staging, size_t size)
+    : offset_{0}, size_{size}
+  {
+    std::promise<std::shared_ptr<detail::host_staging_t<result_t>>> promise{};
+    staging_ = promise.get_future().share();
+    promise.set_value(std::move(staging));
+  }
+
+  /**
+   * @brief Check (without blocking) if the values are available on the host
+   *
+   * Rethrows the exception of the operation if it failed.
+   */
+  bool is_ready() const
+  {
+    if (staging_.wait_for(std::chrono::seconds{0}) != std::future_status::ready) { return false; }
+    return staging_.get()->is_ready();
+  }
+
+  /**
+   * @brief Block until the values are available on the host
+   *
+   * Rethrows the exception of the operation if it failed.
+   */
+  void wait() const { staging_.get()->wait(); }
+
+  /**
+   * @brief Get the values, blocking until they are available on the host
+   *
+   * @return span of the values, valid as long as this object (or a copy of it) exists
+   */
+  raft::host_span<result_t const> get() const
+  {
+    wait();
+    return raft::host_span<result_t const>{staging_.get()->data() + offset_, size_};
+  }
+
+  /**
+   * @brief Number of values
+   */
+  size_t size() const { return size_; }
+
+ private:
+  staging_future_t staging_{};
+  size_t offset_{0};
+  size_t size_{0};
+};
+
+}  // namespace mtmg
+}  // namespace cugraph
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/utilities/error.hpp>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cugraph {
+namespace mtmg {
+
+/**
+ * @brief Out-of-band communication between the processes (one per node) of a multi-node MTMG run
+ *
+ * Before NCCL communicators exist the processes need another channel to agree on the global
+ * ranks of the GPUs and to share NCCL unique ids.  Only a handful of small messages are exchanged,
+ * so any transport will do: file_bootstrap_t and tcp_bootstrap_t are provided, and a bootstrap on
+ * top of an existing launcher (e.g. MPI) only needs to implement broadcast() and allgather().
+ *
+ * Every process must make the same sequence of calls.
+ */
+class bootstrap_t {
+ public:
+  virtual ~bootstrap_t() = default;
+
+  /**
+   * @brief Rank of this process, in [0, get_num_nodes())
+   */
+  virtual int get_node_rank() const = 0;
+
+  /**
+   * @brief Number of processes
+   */
+  virtual int get_num_nodes() const = 0;
+
+  /**
+   * @brief Broadcast @p size bytes at @p data from the process of node rank 0 to every process
+   */
+  virtual void broadcast(void* data, size_t size) = 0;
+
+  /**
+   * @brief Gather @p size bytes at @p input from every process into @p output (of size
+   * get_num_nodes() * @p size, ordered by node rank) on every process
+   */
+  virtual void allgather(void const* input, void* output, size_t size) = 0;
+};
+
+/**
+ * @brief Bootstrap through a directory on a file system shared by every node
+ *
+ * Every message is written to a new file (written to a temporary name and renamed, so readers
+ * never see partial files) which the other processes poll for.  The directory should be empty
+ * (or not exist yet) at the start of the run, and can be deleted once the bootstrap is destroyed
+ * on every node.
+ */
+class file_bootstrap_t : public bootstrap_t {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param directory  Directory on a shared file system (created if it does not exist)
+   * @param node_rank  Rank of this process
+   * @param num_nodes  Number of processes
+   * @param timeout    Maximum time to wait for a message from another process
+   */
+  file_bootstrap_t(std::string directory,
+                   int node_rank,
+                   int num_nodes,
+                   std::chrono::milliseconds timeout = std::chrono::minutes{5})
+    : directory_{std::move(directory)},
+      node_rank_{node_rank},
+      num_nodes_{num_nodes},
+      timeout_{timeout}
+  {
+    CUGRAPH_EXPECTS((node_rank >= 0) && (node_rank < num_nodes), "node rank out of range");
+    std::filesystem::create_directories(directory_);
+  }
+
+  int get_node_rank() const override { return node_rank_; }
+
+  int get_num_nodes() const override { return num_nodes_; }
+
+  void broadcast(void* data, size_t size) override
+  {
+    auto tag = next_tag_++;
+    if (node_rank_ == 0) {
+      write(tag, 0, data, size);
+    } else {
+      read(tag, 0, data, size);
+    }
+  }
+
+  void allgather(void const* input, void* output, size_t size) override
+  {
+    auto tag = next_tag_++;
+    write(tag, node_rank_, input, size);
+    for (int i = 0; i < num_nodes_; ++i) {
+      read(tag, i, static_cast<char*>(output) + i * size, size);
+    }
+  }
+
+ private:
+  std::filesystem::path path(size_t tag, int rank) const
+  {
+    return std::filesystem::path(directory_) /
+           (std::to_string(tag) + "." + std::to_string(rank));
+  }
+
+  void write(size_t tag, int rank, void const* data, size_t size) const
+  {
+    auto tmp_path = path(tag, rank).string() + ".tmp";
+    {
+      std::ofstream file(tmp_path, std::ios::binary);
+      file.write(static_cast<char const*>(data), size);
+      CUGRAPH_EXPECTS(file.good(), "failed to write bootstrap file");
+    }
+    std::filesystem::rename(tmp_path, path(tag, rank));
+  }
+
+  void read(size_t tag, int rank, void* data, size_t size) const
+  {
+    auto file_path = path(tag, rank);
+    auto deadline  = std::chrono::steady_clock::now() + timeout_;
+    while (!std::filesystem::exists(file_path)) {
+      CUGRAPH_EXPECTS(std::chrono::steady_clock::now() < deadline,
+                      "timed out waiting for bootstrap file");
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
+    std::ifstream file(file_path, std::ios::binary);
+    file.read(static_cast<char*>(data), size);
+    CUGRAPH_EXPECTS(file.gcount() == static_cast<std::streamsize>(size),
+                    "bootstrap file size mismatch");
+  }
+
+  std::string directory_{};
+  int node_rank_{0};
+  int num_nodes_{1};
+  std::chrono::milliseconds timeout_{};
+  size_t next_tag_{0};
+};
+
+/**
+ * @brief Bootstrap over TCP
+ *
+ * The process of node rank 0 listens on @p port and every other process connects to it, messages
+ * are relayed by node rank 0 (the bootstrap traffic is tiny, so the star topology is not a
+ * bottleneck).
+ */
+class tcp_bootstrap_t : public bootstrap_t {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param root_host  Host name or address of the process of node rank 0
+   * @param port       TCP port the process of node rank 0 listens on
+   * @param node_rank  Rank of this process
+   * @param num_nodes  Number of processes
+   * @param timeout    Maximum time to wait for the other processes to connect
+   */
+  tcp_bootstrap_t(std::string const& root_host,
+                  uint16_t port,
+                  int node_rank,
+                  int num_nodes,
+                  std::chrono::milliseconds timeout = std::chrono::minutes{5})
+    : node_rank_{node_rank}, num_nodes_{num_nodes}
+  {
+    CUGRAPH_EXPECTS((node_rank >= 0) && (node_rank < num_nodes), "node rank out of range");
+
+    if (node_rank_ == 0) {
+      int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+      CUGRAPH_EXPECTS(listen_fd >= 0, "failed to create bootstrap socket");
+      int on{1};
+      ::setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+      sockaddr_in addr{};
+      addr.sin_family      = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_ANY);
+      addr.sin_port        = htons(port);
+      CUGRAPH_EXPECTS(
+        ::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0 &&
+          ::listen(listen_fd, num_nodes) == 0,
+        "failed to listen on the bootstrap port");
+
+      // the other processes identify themselves with their node rank after connecting
+      peer_fds_.resize(num_nodes_, -1);
+      for (int i = 1; i < num_nodes_; ++i) {
+        int fd = ::accept(listen_fd, nullptr, nullptr);
+        CUGRAPH_EXPECTS(fd >= 0, "failed to accept a bootstrap connection");
+        int peer_rank{-1};
+        recv_all(fd, &peer_rank, sizeof(peer_rank));
+        CUGRAPH_EXPECTS((peer_rank > 0) && (peer_rank < num_nodes_) && (peer_fds_[peer_rank] < 0),
+                        "invalid bootstrap peer rank");
+        peer_fds_[peer_rank] = fd;
+      }
+      ::close(listen_fd);
+    } else {
+      addrinfo hints{};
+      hints.ai_family   = AF_INET;
+      hints.ai_socktype = SOCK_STREAM;
+      addrinfo* result{nullptr};
+      CUGRAPH_EXPECTS(
+        ::getaddrinfo(root_host.c_str(), std::to_string(port).c_str(), &hints, &result) == 0,
+        "failed to resolve the bootstrap root host");
+
+      // the root process may not be listening yet
+      auto deadline = std::chrono::steady_clock::now() + timeout;
+      int fd{-1};
+      while (true) {
+        fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (::connect(fd, result->ai_addr, result->ai_addrlen) == 0) { break; }
+        ::close(fd);
+        if (std::chrono::steady_clock::now() >= deadline) {
+          ::freeaddrinfo(result);
+          CUGRAPH_FAIL("timed out connecting to the bootstrap root");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+      }
+      ::freeaddrinfo(result);
+
+      int on{1};
+      ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+      send_all(fd, &node_rank_, sizeof(node_rank_));
+      peer_fds_.push_back(fd);
+    }
+  }
+
+  tcp_bootstrap_t(tcp_bootstrap_t const&)            = delete;
+  tcp_bootstrap_t& operator=(tcp_bootstrap_t const&) = delete;
+
+  ~tcp_bootstrap_t() override
+  {
+    for (auto fd : peer_fds_) {
+      if (fd >= 0) { ::close(fd); }
+    }
+  }
+
+  int get_node_rank() const override { return node_rank_; }
+
+  int get_num_nodes() const override { return num_nodes_; }
+
+  void broadcast(void* data, size_t size) override
+  {
+    if (node_rank_ == 0) {
+      for (int i = 1; i < num_nodes_; ++i) {
+        send_all(peer_fds_[i], data, size);
+      }
+    } else {
+      recv_all(peer_fds_[0], data, size);
+    }
+  }
+
+  void allgather(void const* input, void* output, size_t size) override
+  {
+    auto output_bytes = static_cast<char*>(output);
+    if (node_rank_ == 0) {
+      std::memcpy(output_bytes, input, size);
+      for (int i = 1; i < num_nodes_; ++i) {
+        recv_all(peer_fds_[i], output_bytes + i * size, size);
+      }
+    } else {
+      send_all(peer_fds_[0], input, size);
+    }
+    broadcast(output, num_nodes_ * size);
+  }
+
+ private:
+  static void send_all(int fd, void const* data, size_t size)
+  {
+    auto bytes = static_cast<char const*>(data);
+    while (size > 0) {
+      auto ret = ::send(fd, bytes, size, MSG_NOSIGNAL);
+      CUGRAPH_EXPECTS(ret > 0, "bootstrap send failed");
+      bytes += ret;
+      size -= ret;
+    }
+  }
+
+  static void recv_all(int fd, void* data, size_t size)
+  {
+    auto bytes = static_cast<char*>(data);
+    while (size > 0) {
+      auto ret = ::recv(fd, bytes, size, 0);
+      CUGRAPH_EXPECTS(ret > 0, "bootstrap receive failed");
+      bytes += ret;
+      size -= ret;
+    }
+  }
+
+  int node_rank_{0};
+  int num_nodes_{1};
+  std::vector<int> peer_fds_{};  // indexed by node rank on node rank 0, {root} otherwise
+};
+
+}  // namespace mtmg
+}  // namespace cugraph
@@ -22,8 +22,12 @@
 // FIXME: Could use std::span once compiler supports C++20
 #include <raft/core/host_span.hpp>
 
+#include <rmm/cuda_device.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <atomic>
+#include <mutex>
+
 namespace cugraph {
 namespace mtmg {
 namespace detail {
@@ -37,6 +41,10 @@ namespace detail {
  * number of elements specified in the constructor.  When that device buffer is full
  * we will create a new buffer.
  *
+ * Concurrent append() calls reserve their slots with an atomic add on the global edge position
+ * and copy into disjoint ranges of the device buffers, so they only serialize when a new device
+ * buffer needs to be allocated (once every device_buffer_size edges).
+ *
  * When we try and use the edgelist we will consolidate the buffers, since at that
  * time we know the entire size required.
  *
@@ -74,7 +82,6 @@ class per_device_edgelist_t {
                         bool use_edge_type,
                         rmm::cuda_stream_view stream_view)
     : device_buffer_size_{device_buffer_size},
-      current_pos_{0},
       src_{},
       dst_{},
       wgt_{std::nullopt},
@@ -89,6 +96,11 @@ class per_device_edgelist_t {
       edge_type_ = std::make_optional(std::vector<rmm::device_uvector<edge_type_t>>());
     }
 
+    // No more source buffers than fit in device memory can ever be allocated, so the pointer table
+    // read by append() never needs to be reallocated
+    auto const total = rmm::available_device_memory().second;
+    buffer_pointers_.resize(total / (device_buffer_size_ * sizeof(vertex_t)) + 1);
+
     create_new_buffers(stream_view);
   }
 
@@ -99,7 +111,9 @@ class per_device_edgelist_t {
    */
   per_device_edgelist_t(per_device_edgelist_t&& other)
     : device_buffer_size_{other.device_buffer_size_},
-      current_pos_{other.current_pos_},
+      next_pos_{other.next_pos_.load()},
+      num_buffers_{other.num_buffers_.load()},
+      buffer_pointers_{std::move(other.buffer_pointers_)},
       src_{std::move(other.src_)},
       dst_{std::move(other.dst_)},
       wgt_{std::move(other.wgt_)},
@@ -125,70 +139,41 @@ class per_device_edgelist_t {
               std::optional<raft::host_span<edge_type_t const>> edge_type,
               rmm::cuda_stream_view stream_view)
   {
-    std::vector<std::tuple<size_t, size_t, size_t, size_t>> copy_positions;
+    size_t first = next_pos_.fetch_add(src.size(), std::memory_order_relaxed);
+    size_t last  = first + src.size();
 
-    {
+    size_t num_required_buffers = (last + device_buffer_size_ - 1) / device_buffer_size_;
+    if (num_buffers_.load(std::memory_order_acquire) < num_required_buffers) {
       std::lock_guard<std::mutex> lock(lock_);
-
-      size_t count = src.size();
-      size_t pos   = 0;
-
-      while (count > 0) {
-        size_t copy_count = std::min(count, (src_.back().size() - current_pos_));
-
-        copy_positions.push_back(std::make_tuple(src_.size() - 1, current_pos_, pos, copy_count));
-
-        count -= copy_count;
-        pos += copy_count;
-        current_pos_ += copy_count;
-
-        if (current_pos_ == src_.back().size()) { create_new_buffers(stream_view); }
+      while (num_buffers_.load(std::memory_order_relaxed) < num_required_buffers) {
+        create_new_buffers(stream_view);
       }
     }
 
-    std::for_each(copy_positions.begin(),
-                  copy_positions.end(),
-                  [&stream_view,
-                   &this_src = src_,
-                   &src,
-                   &this_dst = dst_,
-                   &dst,
-                   &this_wgt = wgt_,
-                   &wgt,
-                   &this_edge_id = edge_id_,
-                   &edge_id,
-                   &this_edge_type = edge_type_,
-                   &edge_type](auto tuple) {
-                    auto [buffer_idx, buffer_pos, input_pos, copy_count] = tuple;
-
-                    raft::update_device(this_src[buffer_idx].begin() + buffer_pos,
-                                        src.begin() + input_pos,
-                                        copy_count,
-                                        stream_view);
-
-                    raft::update_device(this_dst[buffer_idx].begin() + buffer_pos,
-                                        dst.begin() + input_pos,
-                                        copy_count,
-                                        stream_view);
-
-                    if (this_wgt)
-                      raft::update_device((*this_wgt)[buffer_idx].begin() + buffer_pos,
-                                          wgt->begin() + input_pos,
-                                          copy_count,
-                                          stream_view);
-
-                    if (this_edge_id)
-                      raft::update_device((*this_edge_id)[buffer_idx].begin() + buffer_pos,
-                                          edge_id->begin() + input_pos,
-                                          copy_count,
-                                          stream_view);
-
-                    if (this_edge_type)
-                      raft::update_device((*this_edge_type)[buffer_idx].begin() + buffer_pos,
-                                          edge_type->begin() + input_pos,
-                                          copy_count,
-                                          stream_view);
-                  });
+    for (size_t pos = first; pos < last;) {
+      auto const& pointers = buffer_pointers_[pos / device_buffer_size_];
+      size_t buffer_pos    = pos % device_buffer_size_;
+      size_t input_pos     = pos - first;
+      size_t copy_count    = std::min(last - pos, device_buffer_size_ - buffer_pos);
+
+      raft::update_device(
+        pointers.src + buffer_pos, src.begin() + input_pos, copy_count, stream_view);
+      raft::update_device(
+        pointers.dst + buffer_pos, dst.begin() + input_pos, copy_count, stream_view);
+      if (wgt)
+        raft::update_device(
+          pointers.wgt + buffer_pos, wgt->begin() + input_pos, copy_count, stream_view);
+      if (edge_id)
+        raft::update_device(
+          pointers.edge_id + buffer_pos, edge_id->begin() + input_pos, copy_count, stream_view);
+      if (edge_type)
+        raft::update_device(pointers.edge_type + buffer_pos,
+                            edge_type->begin() + input_pos,
+                            copy_count,
+                            stream_view);
+
+      pos += copy_count;
+    }
   }
 
   /**
@@ -198,11 +183,16 @@ class per_device_edgelist_t {
    */
   void finalize_buffer(rmm::cuda_stream_view stream_view)
   {
-    src_.back().resize(current_pos_, stream_view);
-    dst_.back().resize(current_pos_, stream_view);
-    if (wgt_) wgt_->back().resize(current_pos_, stream_view);
-    if (edge_id_) edge_id_->back().resize(current_pos_, stream_view);
-    if (edge_type_) edge_type_->back().resize(current_pos_, stream_view);
+    size_t num_edges = next_pos_.load();
+    for (size_t i = 0; i < src_.size(); ++i) {
+      size_t buffer_first = std::min(i * device_buffer_size_, num_edges);
+      size_t size         = std::min(num_edges - buffer_first, device_buffer_size_);
+      src_[i].resize(size, stream_view);
+      dst_[i].resize(size, stream_view);
+      if (wgt_) (*wgt_)[i].resize(size, stream_view);
+      if (edge_id_) (*edge_id_)[i].resize(size, stream_view);
+      if (edge_type_) (*edge_type_)[i].resize(size, stream_view);
+    }
   }
 
   bool use_weight() const { return wgt_.has_value(); }
@@ -287,8 +277,22 @@ class per_device_edgelist_t {
     buffer = std::move(new_buffer);
   }
 
+  // device pointers of a set of buffers, written once (under lock_) before the buffer is published
+  // by incrementing num_buffers_
+  struct buffer_pointers_t {
+    vertex_t* src{nullptr};
+    vertex_t* dst{nullptr};
+    weight_t* wgt{nullptr};
+    edge_t* edge_id{nullptr};
+    edge_type_t* edge_type{nullptr};
+  };
+
   void create_new_buffers(rmm::cuda_stream_view stream_view)
   {
+    auto num_buffers = num_buffers_.load(std::memory_order_relaxed);
+    CUGRAPH_EXPECTS(num_buffers < buffer_pointers_.size(),
+                    "Edge list exceeds the available device memory");
+
     src_.emplace_back(device_buffer_size_, stream_view);
     dst_.emplace_back(device_buffer_size_, stream_view);
 
@@ -298,13 +302,24 @@ class per_device_edgelist_t {
 
     if (edge_type_) { edge_type_->emplace_back(device_buffer_size_, stream_view); }
 
-    current_pos_ = 0;
+    buffer_pointers_[num_buffers] =
+      buffer_pointers_t{src_.back().data(),
+                        dst_.back().data(),
+                        wgt_ ? wgt_->back().data() : nullptr,
+                        edge_id_ ? edge_id_->back().data() : nullptr,
+                        edge_type_ ? edge_type_->back().data() : nullptr};
+
+    // other threads copy into the new buffers on their own streams
+    stream_view.synchronize();
+    num_buffers_.store(num_buffers + 1, std::memory_order_release);
   }
 
-  mutable std::mutex lock_{};
+  mutable std::mutex lock_{};  // serializes create_new_buffers() only
 
-  size_t current_pos_{0};
   size_t device_buffer_size_{0};
+  std::atomic<size_t> next_pos_{0};
+  std::atomic<size_t> num_buffers_{0};
+  std::vector<buffer_pointers_t> buffer_pointers_{};
 
   std::vector<rmm::device_uvector<vertex_t>> src_{};
   std::vector<rmm::device_uvector<vertex_t>> dst_{};
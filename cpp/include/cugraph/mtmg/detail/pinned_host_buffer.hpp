@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace cugraph {
+namespace mtmg {
+namespace detail {
+
+/**
+ * @brief Fixed size host buffer in pinned (page-locked) memory
+ *
+ * Copies between pinned host memory and GPU memory are asynchronous with respect to the host and
+ * run at the full interconnect bandwidth (copies from pageable host memory are staged through a
+ * driver buffer).  The caller is responsible for not modifying the buffer while an asynchronous
+ * copy from it is in flight.
+ */
+template <typename T>
+class pinned_host_buffer_t {
+ public:
+  pinned_host_buffer_t() = default;
+
+  /**
+   * @brief Construct a new pinned host buffer
+   *
+   * @param size  Number of elements
+   */
+  explicit pinned_host_buffer_t(size_t size) : size_{size}
+  {
+    RAFT_CUDA_TRY(
+      cudaMallocHost(reinterpret_cast<void**>(&data_), std::max(size, size_t{1}) * sizeof(T)));
+  }
+
+  pinned_host_buffer_t(pinned_host_buffer_t const&)            = delete;
+  pinned_host_buffer_t& operator=(pinned_host_buffer_t const&) = delete;
+
+  pinned_host_buffer_t(pinned_host_buffer_t&& other)
+    : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+  {
+  }
+
+  pinned_host_buffer_t& operator=(pinned_host_buffer_t&& other)
+  {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  ~pinned_host_buffer_t()
+  {
+    if (data_ != nullptr) { RAFT_CUDA_TRY_NO_THROW(cudaFreeHost(data_)); }
+  }
+
+  T* data() { return data_; }
+  T const* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  T& operator[](size_t i) { return data_[i]; }
+  T const& operator[](size_t i) const { return data_[i]; }
+
+ private:
+  T* data_{nullptr};
+  size_t size_{0};
+};
+
+}  // namespace detail
+}  // namespace mtmg
+}  // namespace cugraph
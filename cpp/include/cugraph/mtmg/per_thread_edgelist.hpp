@@ -18,6 +18,11 @@
 
 #include <cugraph/mtmg/detail/device_shared_wrapper.hpp>
 #include <cugraph/mtmg/detail/per_device_edgelist.hpp>
+#include <cugraph/mtmg/detail/pinned_host_buffer.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <array>
 
 namespace cugraph {
 namespace mtmg {
@@ -33,6 +38,10 @@ namespace mtmg {
  * Calls to the append() method will take edges (in CPU host memory) and append them to a local
  * buffer.  As the local buffer fills, the buffer will be sent to GPU memory using the flush()
  * method.  This allows the CPU to GPU transfers to be larger (and consequently more efficient).
+ *
+ * The local buffers are in pinned host memory and double-buffered: flush() starts an asynchronous
+ * copy of the current buffer on the given (per-thread) stream and switches to the other buffer,
+ * so the thread keeps appending edges while the previous copy is in flight.
  */
 template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
 class per_thread_edgelist_t {
@@ -49,21 +58,35 @@ class per_thread_edgelist_t {
   per_thread_edgelist_t(
     detail::per_device_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t>& edgelist,
     size_t thread_buffer_size)
-    : edgelist_{edgelist},
-      current_pos_{0},
-      src_(thread_buffer_size),
-      dst_(thread_buffer_size),
-      wgt_{std::nullopt},
-      edge_id_{std::nullopt},
-      edge_type_{std::nullopt}
+    : edgelist_{edgelist}, thread_buffer_size_{thread_buffer_size}, current_{0}, current_pos_{0}
   {
-    if (edgelist.use_weight()) wgt_ = std::make_optional(std::vector<weight_t>(thread_buffer_size));
+    for (auto& buffers : staging_buffers_) {
+      buffers.src = detail::pinned_host_buffer_t<vertex_t>(thread_buffer_size);
+      buffers.dst = detail::pinned_host_buffer_t<vertex_t>(thread_buffer_size);
+
+      if (edgelist.use_weight())
+        buffers.wgt =
+          std::make_optional(detail::pinned_host_buffer_t<weight_t>(thread_buffer_size));
 
-    if (edgelist.use_edge_id())
-      edge_id_ = std::make_optional(std::vector<edge_t>(thread_buffer_size));
+      if (edgelist.use_edge_id())
+        buffers.edge_id =
+          std::make_optional(detail::pinned_host_buffer_t<edge_t>(thread_buffer_size));
+
+      if (edgelist.use_edge_type())
+        buffers.edge_type =
+          std::make_optional(detail::pinned_host_buffer_t<edge_type_t>(thread_buffer_size));
+
+      RAFT_CUDA_TRY(cudaEventCreateWithFlags(&buffers.copy_done, cudaEventDisableTiming));
+    }
+  }
 
-    if (edgelist.use_edge_type())
-      edge_type_ = std::make_optional(std::vector<edge_type_t>(thread_buffer_size));
+  ~per_thread_edgelist_t()
+  {
+    // the pinned buffers can't be freed while a copy from them is in flight
+    for (auto& buffers : staging_buffers_) {
+      RAFT_CUDA_TRY_NO_THROW(cudaEventSynchronize(buffers.copy_done));
+      RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(buffers.copy_done));
+    }
   }
 
   /**
@@ -83,13 +106,15 @@ class per_thread_edgelist_t {
               std::optional<edge_type_t> edge_type,
               rmm::cuda_stream_view stream_view)
   {
-    if (current_pos_ == src_.size()) { flush(stream_view); }
+    if (current_pos_ == thread_buffer_size_) { flush(stream_view); }
 
-    src_[current_pos_] = src;
-    dst_[current_pos_] = dst;
-    if (wgt) (*wgt_)[current_pos_] = *wgt;
-    if (edge_id) (*edge_id_)[current_pos_] = *edge_id;
-    if (edge_type) (*edge_type_)[current_pos_] = *edge_type;
+    auto& buffers = staging_buffers_[current_];
+
+    buffers.src[current_pos_] = src;
+    buffers.dst[current_pos_] = dst;
+    if (wgt) (*buffers.wgt)[current_pos_] = *wgt;
+    if (edge_id) (*buffers.edge_id)[current_pos_] = *edge_id;
+    if (edge_type) (*buffers.edge_type)[current_pos_] = *edge_type;
 
     ++current_pos_;
   }
@@ -115,25 +140,31 @@ class per_thread_edgelist_t {
     size_t pos   = 0;
 
     while (count > 0) {
-      size_t copy_count = std::min(count, (src_.size() - current_pos_));
+      if (current_pos_ == thread_buffer_size_) { flush(stream_view); }
+
+      auto& buffers     = staging_buffers_[current_];
+      size_t copy_count = std::min(count, (thread_buffer_size_ - current_pos_));
 
-      std::copy(src.begin() + pos, src.begin() + pos + copy_count, src_.begin() + current_pos_);
-      std::copy(dst.begin() + pos, dst.begin() + pos + copy_count, dst_.begin() + current_pos_);
+      std::copy(
+        src.begin() + pos, src.begin() + pos + copy_count, buffers.src.data() + current_pos_);
+      std::copy(
+        dst.begin() + pos, dst.begin() + pos + copy_count, buffers.dst.data() + current_pos_);
       if (wgt)
-        std::copy(wgt.begin() + pos, wgt.begin() + pos + copy_count, wgt_->begin() + current_pos_);
+        std::copy(wgt->begin() + pos,
+                  wgt->begin() + pos + copy_count,
+                  buffers.wgt->data() + current_pos_);
       if (edge_id)
-        std::copy(edge_id.begin() + pos,
-                  edge_id.begin() + pos + copy_count,
-                  edge_id_->begin() + current_pos_);
+        std::copy(edge_id->begin() + pos,
+                  edge_id->begin() + pos + copy_count,
+                  buffers.edge_id->data() + current_pos_);
       if (edge_type)
-        std::copy(edge_type.begin() + pos,
-                  edge_type.begin() + pos + copy_count,
-                  edge_type_->begin() + current_pos_);
-
-      if (current_pos_ == src_.size()) { flush(stream_view); }
+        std::copy(edge_type->begin() + pos,
+                  edge_type->begin() + pos + copy_count,
+                  buffers.edge_type->data() + current_pos_);
 
       count -= copy_count;
       pos += copy_count;
+      current_pos_ += copy_count;
     }
   }
 
@@ -146,31 +177,46 @@ class per_thread_edgelist_t {
    */
   void flush(rmm::cuda_stream_view stream_view, bool sync = false)
   {
+    auto& buffers = staging_buffers_[current_];
+
     edgelist_.append(
-      raft::host_span<vertex_t const>{src_.data(), current_pos_},
-      raft::host_span<vertex_t const>{dst_.data(), current_pos_},
-      wgt_ ? std::make_optional(raft::host_span<weight_t const>{wgt_->data(), current_pos_})
-           : std::nullopt,
-      edge_id_ ? std::make_optional(raft::host_span<edge_t const>{edge_id_->data(), current_pos_})
-               : std::nullopt,
-      edge_type_
-        ? std::make_optional(raft::host_span<edge_type_t const>{edge_type_->data(), current_pos_})
+      raft::host_span<vertex_t const>{buffers.src.data(), current_pos_},
+      raft::host_span<vertex_t const>{buffers.dst.data(), current_pos_},
+      buffers.wgt
+        ? std::make_optional(raft::host_span<weight_t const>{buffers.wgt->data(), current_pos_})
         : std::nullopt,
+      buffers.edge_id
+        ? std::make_optional(raft::host_span<edge_t const>{buffers.edge_id->data(), current_pos_})
+        : std::nullopt,
+      buffers.edge_type ? std::make_optional(raft::host_span<edge_type_t const>{
+                            buffers.edge_type->data(), current_pos_})
+                        : std::nullopt,
       stream_view);
+    RAFT_CUDA_TRY(cudaEventRecord(buffers.copy_done, stream_view.value()));
 
+    // keep appending to the other buffer once its previous copy (if any) is complete
+    current_     = 1 - current_;
     current_pos_ = 0;
+    RAFT_CUDA_TRY(cudaEventSynchronize(staging_buffers_[current_].copy_done));
 
     if (sync) stream_view.synchronize();
   }
 
  private:
+  struct staging_buffers_t {
+    detail::pinned_host_buffer_t<vertex_t> src{};
+    detail::pinned_host_buffer_t<vertex_t> dst{};
+    std::optional<detail::pinned_host_buffer_t<weight_t>> wgt{};
+    std::optional<detail::pinned_host_buffer_t<edge_t>> edge_id{};
+    std::optional<detail::pinned_host_buffer_t<edge_type_t>> edge_type{};
+    cudaEvent_t copy_done{};  // recorded after the copies of the last flush from this buffer
+  };
+
   detail::per_device_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t>& edgelist_;
+  size_t thread_buffer_size_{0};
+  size_t current_{0};  // index of the staging buffer being filled
   size_t current_pos_{0};
-  std::vector<vertex_t> src_{};
-  std::vector<vertex_t> dst_{};
-  std::optional<std::vector<weight_t>> wgt_{};
-  std::optional<std::vector<edge_t>> edge_id_{};
-  std::optional<std::vector<edge_type_t>> edge_type_{};
+  std::array<staging_buffers_t, 2> staging_buffers_{};
 };
 
 }  // namespace mtmg
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/mtmg/handle.hpp>
+#include <cugraph/mtmg/instance_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cugraph {
+namespace mtmg {
+
+/**
+ * @brief Runs read-only queries concurrently on graphs shared by a set of instance managers
+ *
+ * Every algorithm call on a GPU issues collectives on the NCCL communicator of its handle, and
+ * collectives on one communicator must be issued in the same order by every rank, so queries
+ * using the same instance manager run one after another.  The query scheduler owns a set of
+ * "lanes", each an instance manager created (by resource_manager_t::create_instance_manager) over
+ * the same ranks with a distinct NCCL unique id, so every lane has its own communicators and
+ * streams.  Each lane has one worker thread per local GPU, and the queries submitted to a lane run
+ * in submission order on every GPU, so queries in different lanes run concurrently while small
+ * queries are not stuck behind large queries in other lanes.
+ *
+ * Objects created with one instance manager (graphs, edge properties, renumber maps) are keyed by
+ * rank and can be read with the handle of any lane, as long as no thread modifies them while
+ * queries are running.
+ *
+ * Lanes are assigned to queries in a round-robin fashion, so in a multi-node run every node needs
+ * to submit the same sequence of queries.
+ */
+class query_scheduler_t {
+ public:
+  query_scheduler_t()                                    = delete;
+  query_scheduler_t(query_scheduler_t const&)            = delete;
+  query_scheduler_t& operator=(query_scheduler_t const&) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * @param lanes  Instance managers (over the same ranks, each with its own NCCL unique id), one
+   *               for each query that can run concurrently
+   */
+  query_scheduler_t(std::vector<std::unique_ptr<instance_manager_t>>&& lanes)
+    : lanes_{std::move(lanes)}
+  {
+    CUGRAPH_EXPECTS(lanes_.size() > 0, "Query scheduler requires at least one lane");
+
+    lane_states_.reserve(lanes_.size());
+    for (size_t i = 0; i < lanes_.size(); ++i) {
+      CUGRAPH_EXPECTS(lanes_[i]->get_local_gpu_count() == lanes_[0]->get_local_gpu_count(),
+                      "Every lane should include the same GPUs");
+      lane_states_.push_back(
+        std::make_unique<lane_state_t>(static_cast<size_t>(lanes_[i]->get_local_gpu_count())));
+    }
+
+    for (size_t i = 0; i < lanes_.size(); ++i) {
+      for (int gpu_id = 0; gpu_id < lanes_[i]->get_local_gpu_count(); ++gpu_id) {
+        workers_.emplace_back([this, lane_id = i, gpu_id]() { run_worker(lane_id, gpu_id); });
+      }
+    }
+  }
+
+  /**
+   * @brief Destructor, waits for the submitted queries to complete
+   */
+  ~query_scheduler_t()
+  {
+    for (auto& lane_state : lane_states_) {
+      std::lock_guard<std::mutex> lock(lane_state->lock);
+      lane_state->stop = true;
+      lane_state->cv.notify_all();
+    }
+
+    std::for_each(workers_.begin(), workers_.end(), [](auto& t) { t.join(); });
+  }
+
+  /**
+   * @brief Submit a query
+   *
+   * The query is called once for every local GPU (concurrently, from the lane's worker thread for
+   * that GPU) with the lane's handle for that GPU.  The query should store its results in objects
+   * keyed by the handle (e.g. vertex_result_t) or otherwise synchronize access to shared state.
+   *
+   * This function is CPU thread-safe.
+   *
+   * @param query  Callable taking a handle_t const&
+   *
+   * @return a future that becomes ready once the query has completed on every local GPU (and
+   *         holds the first exception thrown by the query, if any)
+   */
+  std::future<void> submit(std::function<void(handle_t const&)> query)
+  {
+    auto task   = std::make_shared<task_t>(std::move(query), lanes_[0]->get_local_gpu_count());
+    auto future = task->done.get_future();
+
+    auto& lane_state = *lane_states_[next_lane_++ % lane_states_.size()];
+    {
+      std::lock_guard<std::mutex> lock(lane_state.lock);
+      for (auto& queue : lane_state.queues) {
+        queue.push_back(task);
+      }
+    }
+    lane_state.cv.notify_all();
+
+    return future;
+  }
+
+  /**
+   * @brief Number of queries that can run concurrently
+   */
+  size_t get_lane_count() const { return lanes_.size(); }
+
+ private:
+  struct task_t {
+    task_t(std::function<void(handle_t const&)>&& f, int num_gpus)
+      : query{std::move(f)}, num_remaining{num_gpus}
+    {
+    }
+
+    std::function<void(handle_t const&)> query;
+    std::atomic<int> num_remaining;
+    std::mutex exception_lock{};
+    std::exception_ptr exception{};
+    std::promise<void> done{};
+  };
+
+  struct lane_state_t {
+    explicit lane_state_t(size_t num_gpus) : queues(num_gpus) {}
+
+    std::mutex lock{};
+    std::condition_variable cv{};
+    std::vector<std::deque<std::shared_ptr<task_t>>> queues{};  // one per local GPU
+    bool stop{false};
+  };
+
+  void run_worker(size_t lane_id, int gpu_id)
+  {
+    auto handle      = lanes_[lane_id]->get_handle(gpu_id);
+    auto& lane_state = *lane_states_[lane_id];
+    auto& queue      = lane_state.queues[gpu_id];
+
+    while (true) {
+      std::shared_ptr<task_t> task{};
+      {
+        std::unique_lock<std::mutex> lock(lane_state.lock);
+        lane_state.cv.wait(lock, [&lane_state, &queue]() {
+          return lane_state.stop || !queue.empty();
+        });
+        if (queue.empty()) { return; }
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      try {
+        task->query(handle);
+        handle.sync_stream(handle.raft_handle().get_stream());
+        handle.sync_stream();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(task->exception_lock);
+        if (!task->exception) { task->exception = std::current_exception(); }
+      }
+
+      if (--(task->num_remaining) == 0) {
+        if (task->exception) {
+          task->done.set_exception(task->exception);
+        } else {
+          task->done.set_value();
+        }
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<instance_manager_t>> lanes_{};
+  std::vector<std::unique_ptr<lane_state_t>> lane_states_{};
+  std::vector<std::thread> workers_{};
+  std::atomic<size_t> next_lane_{0};
+};
+
+}  // namespace mtmg
+}  // namespace cugraph
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <cugraph/mtmg/bootstrap.hpp>
 #include <cugraph/mtmg/handle.hpp>
 #include <cugraph/mtmg/instance_manager.hpp>
+#include <cugraph/mtmg/query_scheduler.hpp>
 #include <cugraph/partition_manager.hpp>
 
 #include <raft/comms/std_comms.hpp>
@@ -40,8 +42,9 @@ namespace mtmg {
  *
  * Each process in a multi-GPU configuration should have an instance of this
  * class.  The resource manager object should be configured by calling
- * register_local_gpu (or register_remote_gpu once we support a multi-node
- * configuration) to allocate resources that can be used in the mtmg space.
+ * register_local_gpu and register_remote_gpu (or register_gpus, which assigns
+ * the global ranks of every node's GPUs using a bootstrap_t) to allocate
+ * resources that can be used in the mtmg space.
  *
  * Each GPU in the cluster should be given a unique global rank, an integer
  * that will be used to reference the GPU within the resource manager.  It
@@ -57,8 +60,9 @@ namespace mtmg {
  *
  * The caller is assumed to be responsible for scheduling use of the resources.
  *
- * For our first release, we will only consider a single node multi-GPU configuration, so the remote
- * GPU methods are currently disabled via ifdef.
+ * In a multi-node configuration there is one process per node, and the NCCL unique id of an
+ * instance needs to be shared by every process (e.g. by the create_instance_manager overload
+ * taking a bootstrap_t).
  */
 class resource_manager_t {
  public:
@@ -138,6 +142,46 @@ class resource_manager_t {
     remote_rank_set_.insert(global_rank);
   }
 
+  /**
+   * @brief Register the GPUs of every node
+   *
+   * Global ranks are assigned sequentially by node rank (and by the order of @p local_device_ids
+   * within a node); the GPUs of this node are registered as local GPUs and the GPUs of the other
+   * nodes as remote GPUs.  This is a collective call over @p bootstrap.
+   *
+   * @param bootstrap         Bootstrap connecting the processes of every node
+   * @param local_device_ids  Local devices to register (all the devices on this node if
+   *   std::nullopt)
+   */
+  void register_gpus(
+    bootstrap_t& bootstrap,
+    std::optional<std::vector<rmm::cuda_device_id>> local_device_ids = std::nullopt)
+  {
+    if (!local_device_ids) {
+      int num_gpus_this_node{0};
+      RAFT_CUDA_TRY(cudaGetDeviceCount(&num_gpus_this_node));
+      local_device_ids = std::vector<rmm::cuda_device_id>{};
+      for (int i = 0; i < num_gpus_this_node; ++i) {
+        local_device_ids->push_back(rmm::cuda_device_id{i});
+      }
+    }
+
+    int num_local_gpus = static_cast<int>(local_device_ids->size());
+    std::vector<int> num_gpus_per_node(bootstrap.get_num_nodes());
+    bootstrap.allgather(&num_local_gpus, num_gpus_per_node.data(), sizeof(int));
+
+    int global_rank{0};
+    for (int i = 0; i < bootstrap.get_num_nodes(); ++i) {
+      for (int j = 0; j < num_gpus_per_node[i]; ++j) {
+        if (i == bootstrap.get_node_rank()) {
+          register_local_gpu(global_rank++, (*local_device_ids)[j]);
+        } else {
+          register_remote_gpu(global_rank++);
+        }
+      }
+    }
+  }
+
   /**
    * @brief Create an instance using a subset of the registered resources
    *
@@ -227,6 +271,85 @@ class resource_manager_t {
       std::move(handles), std::move(nccl_comms), std::move(device_ids));
   }
 
+  /**
+   * @brief Create an instance using a subset of the registered resources
+   *
+   * Same as the overload above, but the process of node rank 0 creates the NCCL unique id and
+   * shares it with the other processes through @p bootstrap.  This is a collective call over
+   * @p bootstrap.
+   *
+   * @param ranks_to_use        a vector containing the ranks to include in the instance.
+   * @param bootstrap           Bootstrap connecting the processes of every node
+   * @param n_streams           The number of streams to create in a stream pool for
+   *   each GPU.  Defaults to 16.
+   *
+   * @return unique pointer to instance manager
+   */
+  std::unique_ptr<instance_manager_t> create_instance_manager(std::vector<int> ranks_to_include,
+                                                              bootstrap_t& bootstrap,
+                                                              size_t n_streams = 16) const
+  {
+    return create_instance_manager(
+      std::move(ranks_to_include), create_nccl_unique_id(bootstrap), n_streams);
+  }
+
+  /**
+   * @brief Create a query scheduler using a subset of the registered resources
+   *
+   * Creates one instance manager (see create_instance_manager) for each lane of the query
+   * scheduler, so each lane has its own NCCL communicators and stream pools.
+   *
+   * @param ranks_to_use        a vector containing the ranks to include in the instance.
+   *   Must be a subset of the entire set of available ranks.
+   * @param lane_ids            one ncclUniqueId for each lane (the number of queries that can
+   *   run concurrently).  All processes must use the same IDs in this call, it is up to the
+   *   calling code to share these IDs properly before the call.
+   * @param n_streams           The number of streams to create in a stream pool for
+   *   each GPU in each lane.  Defaults to 16.
+   *
+   * @return unique pointer to query scheduler
+   */
+  std::unique_ptr<query_scheduler_t> create_query_scheduler(
+    std::vector<int> ranks_to_include,
+    std::vector<ncclUniqueId> const& lane_ids,
+    size_t n_streams = 16) const
+  {
+    std::vector<std::unique_ptr<instance_manager_t>> lanes{};
+    lanes.reserve(lane_ids.size());
+    for (auto const& lane_id : lane_ids) {
+      lanes.push_back(create_instance_manager(ranks_to_include, lane_id, n_streams));
+    }
+
+    return std::make_unique<query_scheduler_t>(std::move(lanes));
+  }
+
+  /**
+   * @brief Create a query scheduler using a subset of the registered resources
+   *
+   * Same as the overload above, but the NCCL unique ids of the lanes are created by the process of
+   * node rank 0 and shared through @p bootstrap.  This is a collective call over @p bootstrap.
+   *
+   * @param ranks_to_use        a vector containing the ranks to include in the instance.
+   * @param bootstrap           Bootstrap connecting the processes of every node
+   * @param num_lanes           The number of queries that can run concurrently
+   * @param n_streams           The number of streams to create in a stream pool for
+   *   each GPU in each lane.  Defaults to 16.
+   *
+   * @return unique pointer to query scheduler
+   */
+  std::unique_ptr<query_scheduler_t> create_query_scheduler(std::vector<int> ranks_to_include,
+                                                            bootstrap_t& bootstrap,
+                                                            size_t num_lanes,
+                                                            size_t n_streams = 16) const
+  {
+    std::vector<ncclUniqueId> lane_ids(num_lanes);
+    for (auto& lane_id : lane_ids) {
+      lane_id = create_nccl_unique_id(bootstrap);
+    }
+
+    return create_query_scheduler(std::move(ranks_to_include), lane_ids, n_streams);
+  }
+
   /**
    * @brief Get a list of all of the currently registered ranks
    *
@@ -251,6 +374,14 @@ class resource_manager_t {
   }
 
  private:
+  static ncclUniqueId create_nccl_unique_id(bootstrap_t& bootstrap)
+  {
+    ncclUniqueId id{};
+    if (bootstrap.get_node_rank() == 0) { RAFT_NCCL_TRY(ncclGetUniqueId(&id)); }
+    bootstrap.broadcast(&id, sizeof(id));
+    return id;
+  }
+
   mutable std::mutex lock_{};
   std::map<int, rmm::cuda_device_id> local_rank_map_{};
   std::set<int> remote_rank_set_{};
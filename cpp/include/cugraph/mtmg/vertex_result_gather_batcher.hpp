@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/mtmg/async_host_result.hpp>
+#include <cugraph/mtmg/graph_view.hpp>
+#include <cugraph/mtmg/handle.hpp>
+#include <cugraph/mtmg/renumber_map_view.hpp>
+#include <cugraph/mtmg/vertex_result_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/host_span.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace cugraph {
+namespace mtmg {
+
+/**
+ * @brief Combine the vertex result gathers of several threads per GPU into one collective
+ *
+ * vertex_result_view_t::gather issues collectives on the communicator of the GPU, so concurrent
+ * calls from several threads sharing a GPU would interleave their collectives.  The batcher
+ * collects the vertices requested by @p num_threads_per_gpu calls on each GPU, the call completing
+ * a batch issues a single gather for the whole batch (blocking that thread until the collective
+ * has been issued), and every call returns immediately with an async_host_result_t referring to
+ * its range of the batch result.
+ *
+ * Every GPU issues one collective per batch, so each of the @p num_threads_per_gpu threads of
+ * every GPU (on every node) must call gather the same number of times (with an empty span if the
+ * thread has no vertices to look up).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename result_t,
+          bool store_transposed,
+          bool multi_gpu>
+class vertex_result_gather_batcher_t {
+ public:
+  vertex_result_gather_batcher_t(vertex_result_gather_batcher_t const&)            = delete;
+  vertex_result_gather_batcher_t& operator=(vertex_result_gather_batcher_t const&) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * The referenced objects must outlive the batcher.
+   *
+   * @param result_view        View of the vertex result to gather from
+   * @param graph_view         Graph view the result was computed on
+   * @param renumber_map_view  Renumber map view of the graph (if renumbered)
+   * @param num_threads_per_gpu  Number of threads per GPU participating in each batch
+   * @param default_value      Value returned for vertices not in the graph
+   */
+  vertex_result_gather_batcher_t(
+    vertex_result_view_t<result_t>& result_view,
+    graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+    std::optional<renumber_map_view_t<vertex_t>>& renumber_map_view,
+    int num_threads_per_gpu,
+    result_t default_value = 0)
+    : result_view_{result_view},
+      graph_view_{graph_view},
+      renumber_map_view_{renumber_map_view},
+      num_threads_per_gpu_{num_threads_per_gpu},
+      default_value_{default_value}
+  {
+    CUGRAPH_EXPECTS(num_threads_per_gpu > 0, "num_threads_per_gpu should be positive");
+  }
+
+  /**
+   * @brief Gather results from specified vertices into pinned host memory
+   *
+   * This function is CPU thread-safe.
+   *
+   * @param handle    Handle of the calling thread
+   * @param vertices  Vertices to look up (copied, may be reused once the call returns)
+   *
+   * @return the results, in the order of @p vertices
+   */
+  async_host_result_t<result_t> gather(handle_t const& handle,
+                                       raft::host_span<vertex_t const> vertices)
+  {
+    std::unique_ptr<batch_t> full_batch{};
+    async_host_result_t<result_t> result{};
+
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+
+      auto& batch = batches_[handle.get_rank()];
+      if (!batch) { batch = std::make_unique<batch_t>(); }
+
+      result =
+        async_host_result_t<result_t>(batch->future, batch->vertices.size(), vertices.size());
+      batch->vertices.insert(batch->vertices.end(), vertices.begin(), vertices.end());
+
+      if (++(batch->num_requests) == num_threads_per_gpu_) { full_batch = std::move(batch); }
+    }
+
+    if (full_batch) { run_batch(handle, *full_batch); }
+
+    return result;
+  }
+
+ private:
+  using staging_ptr_t = std::shared_ptr<detail::host_staging_t<result_t>>;
+
+  struct batch_t {
+    std::vector<vertex_t> vertices{};
+    int num_requests{0};
+    std::promise<staging_ptr_t> promise{};
+    std::shared_future<staging_ptr_t> future{promise.get_future().share()};
+  };
+
+  void run_batch(handle_t const& handle, batch_t& batch)
+  {
+    try {
+      auto stream = handle.raft_handle().get_stream();
+
+      rmm::device_uvector<vertex_t> d_vertices(batch.vertices.size(), stream);
+      raft::update_device(d_vertices.data(), batch.vertices.data(), batch.vertices.size(), stream);
+
+      auto d_results = result_view_.gather(
+        handle,
+        raft::device_span<vertex_t const>{d_vertices.data(), d_vertices.size()},
+        graph_view_.get_vertex_partition_range_lasts(handle),
+        graph_view_.get_vertex_partition_view(handle),
+        renumber_map_view_,
+        default_value_);
+
+      // d_results is freed in stream order, after the copy
+      batch.promise.set_value(std::make_shared<detail::host_staging_t<result_t>>(
+        d_results.data(), d_results.size(), stream));
+    } catch (...) {
+      batch.promise.set_exception(std::current_exception());
+    }
+  }
+
+  vertex_result_view_t<result_t>& result_view_;
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view_;
+  std::optional<renumber_map_view_t<vertex_t>>& renumber_map_view_;
+  int num_threads_per_gpu_;
+  result_t default_value_;
+
+  std::mutex lock_{};
+  std::map<int, std::unique_ptr<batch_t>> batches_{};  // pending batch of each GPU rank
+};
+
+}  // namespace mtmg
+}  // namespace cugraph
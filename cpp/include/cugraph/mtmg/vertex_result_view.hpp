@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <cugraph/mtmg/async_host_result.hpp>
 #include <cugraph/mtmg/detail/device_shared_device_span.hpp>
 #include <cugraph/mtmg/graph_view.hpp>
 #include <cugraph/mtmg/handle.hpp>
 #include <cugraph/mtmg/renumber_map.hpp>
 
+#include <memory>
 #include <optional>
 
 namespace cugraph {
@@ -47,6 +49,37 @@ class vertex_result_view_t : public detail::device_shared_device_span_t<result_t
     cugraph::vertex_partition_view_t<vertex_t, multi_gpu> vertex_partition_view,
     std::optional<cugraph::mtmg::renumber_map_view_t<vertex_t>>& renumber_map_view,
     result_t default_value = 0);
+
+  /**
+   * @brief Gather results from specified vertices into pinned host memory
+   *
+   * Same as gather, but the results are copied to the host asynchronously, the calling thread
+   * only blocks (on the returned object) when it needs the values.  Only one thread per GPU
+   * should call this function at a time, use vertex_result_gather_batcher_t to combine the
+   * gathers of several threads per GPU into one collective.
+   */
+  template <typename vertex_t, bool multi_gpu>
+  async_host_result_t<result_t> gather_async(
+    handle_t const& handle,
+    raft::device_span<vertex_t const> vertices,
+    std::vector<vertex_t> const& vertex_partition_range_lasts,
+    cugraph::vertex_partition_view_t<vertex_t, multi_gpu> vertex_partition_view,
+    std::optional<cugraph::mtmg::renumber_map_view_t<vertex_t>>& renumber_map_view,
+    result_t default_value = 0)
+  {
+    auto result = gather(handle,
+                         vertices,
+                         vertex_partition_range_lasts,
+                         vertex_partition_view,
+                         renumber_map_view,
+                         default_value);
+
+    // result is freed in stream order, after the copy
+    return async_host_result_t<result_t>(
+      std::make_shared<detail::host_staging_t<result_t>>(
+        result.data(), result.size(), handle.raft_handle().get_stream()),
+      result.size());
+  }
 };
 
 }  // namespace mtmg
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <optional>
+
+namespace cugraph {
+
+/**
+ * @brief Owning graph class supporting batched edge insertions and deletions.
+ *
+ * mutable_graph_t wraps a graph_t object (and its optional edge weights) and applies edge updates
+ * without going through create_graph_from_edgelist again.
+ *
+ * Deleted edges are flagged in an edge mask (attached to the graph views returned by view()), so
+ * deletions do not touch the compressed graph structure. Inserted edges are appended to a per-GPU
+ * delta buffer, and the pending insertions are merged into the compressed graph (CSR/CSC or the
+ * CSR + DCSR/CSC + DCSC hybrid) on the next view() call (graph views cannot read the delta
+ * buffer) or earlier once the buffer exceeds @p compaction_threshold of the edges. Merging
+ * recompresses the local edge partitions in place, which costs time and temporary memory
+ * proportional to the number of local edges regardless of the batch size; batch insertions between
+ * view() calls to amortize this cost. Vertex IDs and the vertex partitioning are kept (so edge
+ * property values indexed by vertex remain valid), and no renumbering or edge shuffling is
+ * performed. The masked out edges are physically removed once they exceed @p compaction_threshold
+ * of the edges (or whenever pending insertions are merged).
+ *
+ * Edge endpoints passed to insert_edges and delete_edges are internal (i.e. renumbered) vertex IDs
+ * and new vertices cannot be added. If the graph is symmetric, the caller should insert and delete
+ * both (u, v) and (v, u). As vertices are not renumbered, merging recomputes only the degree
+ * based segment boundaries the graph algorithms rely on for correctness (the first vertex of the
+ * zero-degree segment and, if the graph has a hypersparse segment, the degree 1 vertex range);
+ * the other vertices stay in the high, mid, and low degree segments they were assigned at graph
+ * creation even if their degrees drift away from the segment's degree range (this affects
+ * performance only). Recreate the graph with create_graph_from_edgelist if the degree
+ * distribution changes significantly.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+class mutable_graph_t {
+ public:
+  using vertex_type                           = vertex_t;
+  using edge_type                             = edge_t;
+  using weight_type                           = weight_t;
+  static constexpr bool is_storage_transposed = store_transposed;
+  static constexpr bool is_multi_gpu          = multi_gpu;
+
+  using graph_type      = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+  using graph_view_type = graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+
+  /**
+   * @brief Construct a mutable graph object.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param graph Graph object to be updated (moved into this object). The graph should not have an
+   * edge mask attached to its views.
+   * @param edge_weights Optional edge weights of @p graph (moved into this object).
+   * @param compaction_threshold Masked out (deleted) edges are physically removed, and pending
+   * insertions are merged into the compressed graph without waiting for the next view() call, once
+   * their count exceeds @p compaction_threshold times the number of edges in the compressed graph.
+   * view() merges every pending insertion regardless of this threshold.
+   */
+  mutable_graph_t(raft::handle_t const& handle,
+                  graph_type&& graph,
+                  std::optional<edge_property_t<graph_view_type, weight_t>>&& edge_weights,
+                  double compaction_threshold = 0.1);
+
+  /**
+   * @brief Insert a batch of edges.
+   *
+   * The edges are appended to the delta buffer and become visible in the graph view returned by
+   * the next view() call. If the graph is not a multigraph, the caller should not insert edges
+   * that already exist in the graph.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param edge_srcs Sources of the edges to insert. If multi-GPU, the edges are shuffled to their
+   * owning GPUs inside this function (so this function has to be called on every GPU).
+   * @param edge_dsts Destinations of the edges to insert.
+   * @param edge_weights Weights of the edges to insert. Should be valid if and only if this graph
+   * is weighted.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void insert_edges(raft::handle_t const& handle,
+                    raft::device_span<vertex_t const> edge_srcs,
+                    raft::device_span<vertex_t const> edge_dsts,
+                    std::optional<raft::device_span<weight_t const>> edge_weights,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Delete a batch of edges.
+   *
+   * Edges in the compressed graph are masked out and pending insertions are dropped from the delta
+   * buffer. Every edge between the source and the destination is deleted if the graph is a
+   * multigraph. Edges that do not exist are ignored.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param edge_srcs Sources of the edges to delete. If multi-GPU, the edges are shuffled to their
+   * owning GPUs inside this function (so this function has to be called on every GPU).
+   * @param edge_dsts Destinations of the edges to delete.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void delete_edges(raft::handle_t const& handle,
+                    raft::device_span<vertex_t const> edge_srcs,
+                    raft::device_span<vertex_t const> edge_dsts,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Merge the pending insertions and physically remove the deleted edges.
+   *
+   * This function has to be called on every GPU in multi-GPU.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   */
+  void compact(raft::handle_t const& handle);
+
+  /**
+   * @brief Return a graph view reflecting every insertion and deletion so far.
+   *
+   * Pending insertions, if any, are merged first (recompressing the local edge partitions, this
+   * function has to be called on every GPU in multi-GPU). Deleted edges that are not physically
+   * removed yet are masked out by an edge mask attached to the returned view; invoking
+   * attach_edge_mask on the returned view replaces this mask.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @return Graph view object.
+   */
+  graph_view_type view(raft::handle_t const& handle);
+
+  /**
+   * @brief Return the edge weight view for the graph view returned by view().
+   *
+   * This is valid only until the next insert_edges, delete_edges, compact, or view call.
+   */
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view() const
+  {
+    return edge_weights_ ? std::make_optional((*edge_weights_).view()) : std::nullopt;
+  }
+
+  /**
+   * @brief Return the number of pending (not yet merged) insertions in this GPU.
+   */
+  size_t number_of_local_pending_insertions() const { return delta_srcs_.size(); }
+
+  /**
+   * @brief Return the number of deleted edges (in this GPU) that are masked out but not
+   * physically removed yet.
+   */
+  edge_t number_of_local_masked_edges() const { return num_local_masked_edges_; }
+
+ private:
+  void merge(raft::handle_t const& handle);
+
+  graph_type graph_;
+  std::optional<edge_property_t<graph_view_type, weight_t>> edge_weights_{std::nullopt};
+  std::optional<edge_property_t<graph_view_type, bool>> edge_mask_{std::nullopt};
+
+  rmm::device_uvector<vertex_t> delta_srcs_;
+  rmm::device_uvector<vertex_t> delta_dsts_;
+  std::optional<rmm::device_uvector<weight_t>> delta_weights_{std::nullopt};
+
+  edge_t num_local_masked_edges_{0};
+  double compaction_threshold_{0.1};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/sampling_functions.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Pipelined homogeneous uniform neighbor sampler.
+ *
+ * Seed batches (minibatches) are queued with enqueue() and the sampled and post-processed
+ * minibatches are retrieved (in the enqueue order) with next(). Sampling (with
+ * homogeneous_uniform_neighbor_sample) and post-processing (with
+ * renumber_and_compress_sampled_edgelist) run in two worker threads on two different streams from
+ * the handle's stream pool, so sampling of minibatch i overlaps with post-processing of minibatch
+ * i - 1 and with the caller's consumption of the previously returned minibatches (the number of
+ * finished minibatches waiting to be retrieved is bounded by @p max_ready_minibatches).
+ *
+ * This class is single-GPU only (as renumber_and_compress_sampled_edgelist is). The graph and the
+ * edge property objects should outlive this object and should not be modified while this object
+ * is alive.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+class neighbor_sampler_t {
+ public:
+  /**
+   * @brief Sampled and post-processed minibatch (see renumber_and_compress_sampled_edgelist for
+   * the description of each field). The buffers are associated with the handle's stream.
+   */
+  struct minibatch_t {
+    size_t minibatch_id{};
+    std::optional<rmm::device_uvector<vertex_t>> majors{std::nullopt};
+    rmm::device_uvector<size_t> major_offsets;
+    rmm::device_uvector<vertex_t> minors;
+    std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+    std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+    std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+    std::optional<rmm::device_uvector<size_t>> hop_offsets{std::nullopt};
+    rmm::device_uvector<vertex_t> renumber_map;
+  };
+
+  /**
+   * @brief Construct a sampler and launch the worker threads.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms. The handle should have a stream
+   * pool with two or more streams to overlap sampling and post-processing.
+   * @param graph_view Graph View object to sample.
+   * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+   * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+   * @param edge_type_view Optional view object holding edge types for @p graph_view.
+   * @param fan_out Branching out (fan-out) degree per source vertex for each level.
+   * @param sampling_flags A set of flags indicating which sampling features should be used. Hops
+   * are returned if @p fan_out.size() > 1 regardless of sampling_flags.return_hops.
+   * @param seed Seed of the random number generator used in sampling.
+   * @param compress_per_hop A flag to determine whether to compress edges with different hop
+   * numbers separately (if true) or altogether (if false).
+   * @param doubly_compress A flag to determine whether to compress to the CSR/CSC format (if
+   * false) or the DCSR/DCSC format (if true).
+   * @param max_ready_minibatches Maximum number of finished minibatches waiting to be retrieved
+   * with next(). Post-processing stalls if this limit is reached.
+   */
+  neighbor_sampler_t(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+    std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+    std::vector<int32_t> const& fan_out,
+    sampling_flags_t sampling_flags,
+    uint64_t seed,
+    bool compress_per_hop        = false,
+    bool doubly_compress         = false,
+    size_t max_ready_minibatches = 2);
+
+  neighbor_sampler_t(neighbor_sampler_t const&)            = delete;
+  neighbor_sampler_t& operator=(neighbor_sampler_t const&) = delete;
+
+  // cancels the minibatches not yet retrieved and joins the worker threads
+  ~neighbor_sampler_t();
+
+  /**
+   * @brief Queue a seed batch.
+   *
+   * @param seeds Seed vertices of the minibatch. The buffer should be ready to use (the work to
+   * produce the seed vertices should be completed or synchronized) as it is consumed by the
+   * sampling stream.
+   * @return Minibatch ID (assigned in the enqueue order starting from 0).
+   */
+  size_t enqueue(rmm::device_uvector<vertex_t>&& seeds);
+
+  /**
+   * @brief Mark that no more seed batches will be queued. next() returns std::nullopt after
+   * returning all the queued minibatches.
+   */
+  void close();
+
+  /**
+   * @brief Retrieve the next finished minibatch (blocks until it is available). Re-throws the
+   * exception if sampling or post-processing has failed.
+   *
+   * @return The next minibatch (in the enqueue order) or std::nullopt if close() has been called
+   * and all the queued minibatches have been retrieved.
+   */
+  std::optional<minibatch_t> next();
+
+ private:
+  struct sampled_edgelist_t {
+    size_t minibatch_id{};
+    rmm::device_uvector<vertex_t> seeds;
+    rmm::device_uvector<vertex_t> srcs;
+    rmm::device_uvector<vertex_t> dsts;
+    std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+    std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+    std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> hops{std::nullopt};
+  };
+
+  void run_sampling();
+  void run_post_processing();
+  void set_exception(std::exception_ptr exception);
+
+  raft::handle_t const& handle_;
+  graph_view_t<vertex_t, edge_t, false, false> graph_view_;
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view_{};
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view_{};
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view_{};
+  std::vector<int32_t> fan_out_{};
+  sampling_flags_t sampling_flags_{};
+  raft::random::RngState rng_state_;
+  bool compress_per_hop_{false};
+  bool doubly_compress_{false};
+  size_t max_ready_minibatches_{2};
+
+  rmm::cuda_stream_view sampling_stream_{};
+  rmm::cuda_stream_view post_processing_stream_{};
+
+  std::mutex mutex_{};
+  std::condition_variable cv_{};
+  std::deque<std::tuple<size_t, rmm::device_uvector<vertex_t>>> seed_queue_{};
+  std::optional<sampled_edgelist_t> staged_edgelist_{};  // double buffering between the stages
+  std::deque<minibatch_t> ready_queue_{};
+  size_t num_enqueued_{0};
+  bool closed_{false};
+  bool cancelled_{false};
+  bool sampling_done_{false};
+  bool post_processing_done_{false};
+  std::exception_ptr exception_{};
+
+  std::thread sampling_thread_{};
+  std::thread post_processing_thread_{};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/sampling_functions.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// adjacency lists (in CSR) of the highest degree vertices replicated on every GPU
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename bias_t>
+struct hot_vertex_cache_t {
+  rmm::device_uvector<vertex_t> vertices;  // sorted
+  rmm::device_uvector<edge_t> offsets;     // size = vertices.size() + 1
+  rmm::device_uvector<vertex_t> indices;
+  std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+  std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+  std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+  std::optional<rmm::device_uvector<bias_t>> bias_inclusive_sums{
+    std::nullopt};  // per-vertex inclusive sums of the edge bias values
+};
+
+}  // namespace detail
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Reusable neighbor sampling state.
+ *
+ * homogeneous/heterogeneous_uniform/biased_neighbor_sample re-build the per edge type edge masks
+ * (for heterogeneous sampling) and re-validate the edge bias values (if do_expensive_check is
+ * true) in every call. This class computes these graph invariant data once at construction and
+ * reuses them in every sample() call, which is beneficial if the same graph is sampled many times
+ * with small seed batches (e.g. GNN training). For homogeneous biased sampling, this class also
+ * pre-computes per-vertex inclusive sums of the edge bias values (this requires additional memory
+ * for one bias value per edge) and biased sampling with replacement draws each sample with a
+ * binary search on the pre-computed inclusive sums.
+ *
+ * Sampling is heterogeneous if @p num_edge_types > 1 (fan-out values are specified per hop and
+ * edge type, see heterogeneous_uniform_neighbor_sample) and homogeneous otherwise. Sampling is
+ * biased if the edge bias view is provided and uniform otherwise.
+ *
+ * The graph and the edge property objects should outlive this object and should not be modified
+ * while this object is alive.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights (and edge bias values). Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+class neighbor_sampling_state_t {
+ public:
+  /**
+   * @brief Construct the sampling state.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param graph_view Graph View object to sample.
+   * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+   * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+   * @param edge_type_view Optional view object holding edge types for @p graph_view. Should be
+   * provided if @p num_edge_types > 1.
+   * @param edge_bias_view Optional view object holding edge bias values for @p graph_view. Biased
+   * sampling is performed if provided.
+   * @param num_edge_types Number of edge types where a value of 1 translates to homogeneous
+   * neighbor sampling.
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`). The checks are run once here and skipped in sample().
+   */
+  neighbor_sampling_state_t(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+    std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_bias_view,
+    edge_type_t num_edge_types = edge_type_t{1},
+    bool do_expensive_check    = false);
+
+  /**
+   * @brief Sample the neighborhood of the starting vertices.
+   *
+   * See homogeneous_uniform_neighbor_sample and heterogeneous_uniform_neighbor_sample for the
+   * description of the parameters and the return value.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+   * @param starting_vertices Device span of starting vertex IDs for the sampling.
+   * @param starting_vertex_labels Optional device span of labels associated with each starting
+   * vertex for the sampling.
+   * @param label_to_output_comm_rank Optional device span identifying which rank should get each
+   * vertex label.
+   * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+   * level (and for each edge type if num_edge_types > 1).
+   * @param sampling_flags A set of flags indicating which sampling features should be used.
+   * @return tuple device vectors (vertex_t source_vertex, vertex_t destination_vertex,
+   * optional weight_t weight, optional edge_t edge id, optional edge_type_t edge type,
+   * optional int32_t hop, optional size_t offsets)
+   */
+  std::tuple<rmm::device_uvector<vertex_t>,
+             rmm::device_uvector<vertex_t>,
+             std::optional<rmm::device_uvector<weight_t>>,
+             std::optional<rmm::device_uvector<edge_t>>,
+             std::optional<rmm::device_uvector<edge_type_t>>,
+             std::optional<rmm::device_uvector<int32_t>>,
+             std::optional<rmm::device_uvector<size_t>>>
+  sample(raft::handle_t const& handle,
+         raft::random::RngState& rng_state,
+         raft::device_span<vertex_t const> starting_vertices,
+         std::optional<raft::device_span<int32_t const>> starting_vertex_labels,
+         std::optional<raft::device_span<int32_t const>> label_to_output_comm_rank,
+         raft::host_span<int32_t const> fan_out,
+         sampling_flags_t sampling_flags) const;
+
+  /**
+   * @brief Replicate the adjacency lists of the highest out-degree vertices on every GPU.
+   *
+   * In multi-GPU sampling, every frontier vertex is shuffled to the GPU owning the vertex to be
+   * sampled, and the sampled edges are shuffled back. High degree vertices appear in nearly every
+   * minibatch. After this call, frontier vertices found in the cache are sampled on the GPU they
+   * reside in, which cuts the per hop communication volume. Replicating the adjacency lists
+   * requires memory for the cached edges (and their properties) on every GPU.
+   *
+   * The cache is used in homogeneous sampling with the default prior_sources_behavior and without
+   * dedupe_sources (the frontier of each hop is then just the destinations of the previous hop).
+   * Biased sampling uses the cache only if sampling with replacement. Other calls sample as if
+   * there were no cache. This function has no effect in single-GPU or if num_edge_types() > 1.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param num_hot_vertices Number of (the highest out-degree) vertices to cache. Vertices without
+   * any outgoing edge are never cached. 0 drops the existing cache.
+   */
+  void cache_hot_vertices(raft::handle_t const& handle, size_t num_hot_vertices);
+
+  /**
+   * @brief Return the number of vertices in the hot vertex cache.
+   */
+  size_t number_of_cached_hot_vertices() const
+  {
+    return hot_vertex_cache_ ? (*hot_vertex_cache_).vertices.size() : size_t{0};
+  }
+
+  edge_type_t num_edge_types() const { return num_edge_types_; }
+
+ private:
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> graph_view_;
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view_{};
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view_{};
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view_{};
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_bias_view_{};
+  edge_type_t num_edge_types_{1};
+
+  // edge masks (and their views) selecting the edges of each edge type (empty if
+  // num_edge_types_ == 1)
+  std::vector<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool>>
+    edge_type_masks_{};
+  std::vector<edge_property_view_t<edge_t, uint32_t const*, bool>> edge_type_mask_views_{};
+
+  // per-vertex inclusive sums of the edge bias values (computed for homogeneous biased sampling of
+  // a graph without an edge mask, used in sampling with replacement)
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>
+    edge_bias_inclusive_sums_{std::nullopt};
+
+  // adjacency lists of the highest out-degree vertices (see cache_hot_vertices)
+  std::optional<detail::hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, weight_t>>
+    hot_vertex_cache_{std::nullopt};
+};
+
+}  // namespace cugraph
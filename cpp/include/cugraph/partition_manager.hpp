@@ -16,16 +16,32 @@
 
 #pragma once
 
+#include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/core/comms.hpp>
 #include <raft/core/handle.hpp>
 
+#include <cmath>
 #include <string>
 
 namespace cugraph {
 
+/**
+ * @brief Policy to decide the shape of the 2D GPU partitioning.
+ *
+ * square: gpu_row_comm_size * gpu_col_comm_size with gpu_row_comm_size the largest divisor of
+ * the comm size not larger than its square root (as square as possible, minimizes the total
+ * sub-communicator sizes).
+ * gpu_row_comm_per_node: gpu_row_comm_size = the number of GPUs per node. GPUs in the same GPU row
+ * communicator have consecutive process IDs, so if the processes of each node have consecutive
+ * process IDs (the usual launcher behavior), the GPU row communicator (the major sub-communicator
+ * with the default mapping) stays inside a node and its traffic stays on the intra-node
+ * interconnect. This can be faster on bandwidth-limited multi-node clusters.
+ */
+enum class partition_shape_t { square, gpu_row_comm_per_node };
+
 /**
  * managed the mapping between graph partitioning and GPU partitioning
  */
@@ -153,6 +169,41 @@ class partition_manager {
                                  vertex_partition_range_offsets.end());
   }
 
+  /**
+   * @brief Compute the GPU row communicator size for the given partition shape policy.
+   *
+   * @param comm_size Number of GPUs.
+   * @param shape Partition shape policy.
+   * @param num_gpus_per_node Number of GPUs per node, relevant only if @p shape is
+   * partition_shape_t::gpu_row_comm_per_node.
+   * @return The GPU row communicator size (a divisor of @p comm_size).
+   */
+  static int compute_gpu_row_comm_size(int comm_size,
+                                       partition_shape_t shape,
+                                       int num_gpus_per_node = 1)
+  {
+    if (shape == partition_shape_t::gpu_row_comm_per_node) {
+      CUGRAPH_EXPECTS((num_gpus_per_node > 0) && (comm_size % num_gpus_per_node == 0),
+                      "Invalid input argument: comm_size should be a multiple of "
+                      "num_gpus_per_node.");
+      return num_gpus_per_node;
+    }
+
+    auto gpu_row_comm_size = static_cast<int>(std::sqrt(static_cast<double>(comm_size)));
+    while (comm_size % gpu_row_comm_size != 0) {
+      --gpu_row_comm_size;
+    }
+    return gpu_row_comm_size;
+  }
+
+  static void init_subcomm(raft::handle_t& handle,
+                           partition_shape_t shape,
+                           int num_gpus_per_node = 1)
+  {
+    auto comm_size = handle.get_comms().get_size();
+    init_subcomm(handle, compute_gpu_row_comm_size(comm_size, shape, num_gpus_per_node));
+  }
+
   static void init_subcomm(raft::handle_t& handle, int gpu_row_comm_size)
   {
     auto& comm = handle.get_comms();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+/**
+ * @file prims.cuh
+ * @brief Graph primitives for writing custom (single-GPU or multi-GPU) graph algorithms.
+ *
+ * Link against the cugraph::cugraph_prims target to use this header. The primitives are header
+ * only and should be compiled by nvcc with --expt-extended-lambda and --expt-relaxed-constexpr (as
+ * cuGraph does). The headers implementing the primitives are installed under
+ * include/cugraph/internal and should not be included directly, only the interfaces listed below
+ * are kept stable (source compatible) across releases.
+ *
+ * Stable interfaces:
+ *
+ * - cugraph::vertex_frontier_t and cugraph::key_bucket_t: sets of (optionally tagged) vertices
+ *   organized in buckets. A key_bucket_t stores the local keys of this GPU, an algorithm typically
+ *   iterates by building the next frontier from the current bucket.
+ *
+ * - cugraph::fill_edge_src_property, cugraph::fill_edge_dst_property,
+ *   cugraph::update_edge_src_property, and cugraph::update_edge_dst_property: fill or update the
+ *   edge source/destination property caches (edge_src_property_t, edge_dst_property_t) from a
+ *   scalar or from local vertex property values. In multi-GPU, these perform the communication
+ *   required to make the values of remote vertices visible to the local edge partitions.
+ *
+ * - cugraph::per_v_transform_reduce_incoming_e and cugraph::per_v_transform_reduce_outgoing_e:
+ *   for every local vertex (or every key in a key bucket), apply an edge operator to the incoming
+ *   (or outgoing) edges and reduce the results with one of the reduction operators in
+ *   cugraph::reduce_op. The edge operator takes (src, dst, src value, dst value, edge value)
+ *   and should be side-effect free.
+ *
+ * - cugraph::transform_reduce_v_frontier_outgoing_e_by_dst: apply an edge operator to the
+ *   outgoing edges of the keys in a frontier bucket and reduce the (optional) payloads by the
+ *   destination vertex, returning the (locally owned) destinations and the reduced payloads.
+ *
+ * - cugraph::update_v_frontier: apply a vertex operator to (key, payload) pairs to update
+ *   vertex property values and assign the keys to the frontier buckets for the next iteration.
+ *
+ * - cugraph::reduce_op: pre-defined reduction operators (any, minimum, maximum, plus, ...).
+ *
+ * Every primitive takes a raft::handle_t (with comms initialized in multi-GPU) and a
+ * graph_view_t, expects the same call to be made on every GPU in multi-GPU, and reports invalid
+ * input arguments by throwing cugraph::logic_error (if do_expensive_check is true, the inputs are
+ * validated more thoroughly). See the documentation of each primitive for the detailed contract.
+ */
+
+#include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/update_v_frontier.cuh"
+#include "prims/vertex_frontier.cuh"
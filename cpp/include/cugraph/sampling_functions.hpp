@@ -306,7 +306,12 @@ struct sampling_flags_t {
  * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers. If the
+ * generator type is raft::random::GenPhilox, @p flags.with_replacement is true, and
+ * @p starting_vertex_labels is provided, the random numbers are generated on the fly from (seed,
+ * vertex, label, hop, draw index) without materializing random number arrays, and the random
+ * numbers drawn for a (vertex, label) pair do not depend on the other seeds in the batch or on how
+ * the seeds are distributed over the GPUs (use the same seed on every GPU).
  * @param graph_view Graph View object to generate NBR Sampling on.
  * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
  * @param edge_id_view Optional view object holding edge ids for @p graph_view.
@@ -600,6 +605,133 @@ heterogeneous_biased_neighbor_sample(
   sampling_flags_t sampling_flags,
   bool do_expensive_check = false);
 
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Heterogeneous Uniform Temporal Neighborhood Sampling.
+ *
+ * Same as heterogeneous_uniform_neighbor_sample except that every starting vertex has a time bound
+ * and only the edges with the edge time values earlier than the time bound of the starting vertex
+ * (and no earlier than the time bound - @p time_window if @p time_window is provided) are sampled
+ * in every hop of the starting vertex's sampling tree. The constraint is applied while sampling
+ * (every eligible edge is selected with the same probability), so there is no need to over-sample
+ * and filter the sampled edges after the fact.
+ *
+ * If the same vertex is reached from multiple starting vertices, the vertex is sampled separately
+ * for each starting vertex (as the time bounds can differ); @p sampling_flags.dedupe_sources and
+ * prior_sources_behavior_t::EXCLUDE are applied per starting vertex.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time values. Needs to be an arithmetic type.
+ * @tparam store_transposed Flag indicating whether sources (if false) or destinations (if
+ * true) are major indices
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param graph_view Graph View object to generate NBR Sampling on.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param edge_time_view View object holding edge time values for @p graph_view.
+ * @param starting_vertices Device span of starting vertex IDs for the sampling.
+ * In a multi-gpu context the starting vertices should be local to this GPU.
+ * @param starting_vertex_time_bounds Device span of time bounds for the starting vertices (size
+ * should coincide with the size of @p starting_vertices).
+ * @param time_window Optional time window size (should be positive). If provided, edges with the
+ * edge time values earlier than the time bound - @p time_window are not sampled.
+ * @param starting_vertex_labels Optional device span of labels associated with each starting
+ * vertex for the sampling.
+ * @param label_to_output_comm_rank Optional device span identifying which rank should get sampling
+ * outputs of each vertex label.  This should be the same on each rank.
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+ * level. The fanout value at hop x is given by the expression 'fanout[x*num_edge_types +
+ * edge_type_id]'. Negative values (gathering all the neighbors) are not supported.
+ * @param num_edge_types Number of edge types where a value of 1 translates to homogeneous neighbor
+ * sample whereas a value greater than 1 translates to heterogeneous neighbor sample.
+ * @param flags A set of flags indicating which sampling features should be used.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple device vectors (vertex_t source_vertex, vertex_t destination_vertex,
+ * optional weight_t weight, optional edge_t edge id, optional edge_type_t edge type,
+ * optional int32_t hop, optional size_t offsets)
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<int32_t>>,
+           std::optional<rmm::device_uvector<size_t>>>
+heterogeneous_uniform_temporal_neighbor_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::device_span<edge_time_t const> starting_vertex_time_bounds,
+  std::optional<edge_time_t> time_window,
+  std::optional<raft::device_span<int32_t const>> starting_vertex_labels,
+  std::optional<raft::device_span<int32_t const>> label_to_output_comm_rank,
+  raft::host_span<int32_t const> fan_out,
+  edge_type_t num_edge_types,
+  sampling_flags_t sampling_flags,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Compute a label_to_output_comm_rank mapping balancing the estimated sampling output size.
+ *
+ * Neighbor sampling draws the samples of each frontier vertex on the GPU owning the vertex, and
+ * then shuffles the sampling outputs of each label to the rank given by label_to_output_comm_rank
+ * (e.g. for post-processing and training). If the labels are assigned to the ranks that generated
+ * the seed batches, uneven seed batches across ranks or seed batches clustered around high degree
+ * vertices leave some ranks with most of the post-processing work. This function estimates the
+ * sampling output size of each label (from the out-degrees of its seeds and @p fan_out) and
+ * assigns the labels to ranks to balance the estimated output sizes (largest label first, to the
+ * least loaded rank).
+ *
+ * The output can be passed as label_to_output_comm_rank to homogeneous_uniform_neighbor_sample,
+ * homogeneous_biased_neighbor_sample, and neighbor_sampling_state_t::sample. Callers that need
+ * the (post-processed) outputs of a label on the rank that generated the label can send them back
+ * based on the returned mapping.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate neighbor sampling on.
+ * @param starting_vertices Device span of starting vertex IDs for the sampling. In a multi-gpu
+ * context the starting vertices should be local to this GPU.
+ * @param starting_vertex_labels Device span of labels associated with each starting vertex. Labels
+ * should be non-negative.
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each level
+ * (homogeneous sampling).
+ * @return Device vector mapping each label in [0, number of labels) to the output rank (identical
+ * on every rank; the number of labels is the maximum label over all ranks + 1). Every label is
+ * mapped to rank 0 in single-GPU.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<int32_t> compute_balanced_label_to_output_comm_rank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::device_span<int32_t const> starting_vertex_labels,
+  raft::host_span<int32_t const> fan_out);
+
 /**
  * @ingroup sampling_functions_cpp
  * @brief renumber sampled edge list and compress to the (D)CSR|(D)CSC format.
@@ -1038,6 +1170,103 @@ sort_sampled_edgelist(raft::handle_t const& handle,
                       size_t num_hops,
                       bool src_is_major       = true,
                       bool do_expensive_check = false);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Bit-pack a sampling output array (e.g. majors, minors, offsets, or renumber map) to reduce
+ * the size of host or inter-GPU transfers.
+ *
+ * Each value is first encoded as a non-negative integer: the difference from the minimum value in
+ * @p values (frame-of-reference) or, if @p delta_segment_offsets.has_value() is true, the
+ * difference from the previous value in the same segment (the first value in each segment is
+ * encoded as the difference from the minimum value). The encoded values are then packed using the
+ * minimum number of bits required to represent the largest encoded value. Renumbered sampling
+ * outputs span small ranges, and delta encoding per (label, hop) segment is effective for sorted
+ * majors and offsets.
+ *
+ * @tparam value_t Type of the values to pack. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param values Values to pack.
+ * @param delta_segment_offsets Optional segment offsets (size = # segments + 1, the first offset
+ * should be 0 and the last offset should be @p values.size()). If provided, values are
+ * delta-encoded within each segment, and values should be non-decreasing within each segment.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the packed 32 bit words (size = ceil(@p values.size() * bit width / 32)), the
+ * bit width of each encoded value, and the base (minimum) value. These should be passed (with
+ * @p values.size() and @p delta_segment_offsets) to bit_unpack_sampled_values to recover the
+ * values.
+ */
+template <typename value_t>
+std::tuple<rmm::device_uvector<uint32_t>, int32_t, value_t> bit_pack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<value_t const> values,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Recover the values packed by bit_pack_sampled_values.
+ *
+ * @tparam value_t Type of the packed values. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param packed_words Packed 32 bit words returned by bit_pack_sampled_values.
+ * @param num_values Number of packed values.
+ * @param bit_width Bit width of each encoded value returned by bit_pack_sampled_values.
+ * @param base Base value returned by bit_pack_sampled_values.
+ * @param delta_segment_offsets Segment offsets passed to bit_pack_sampled_values (std::nullopt if
+ * the values were not delta-encoded).
+ * @return Unpacked values (size = @p num_values).
+ */
+template <typename value_t>
+rmm::device_uvector<value_t> bit_unpack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<uint32_t const> packed_words,
+  size_t num_values,
+  int32_t bit_width,
+  value_t base,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Gather the vertex feature rows of the sampled vertices.
+ *
+ * This function gathers the rows of a dense vertex feature matrix (keyed by internal vertex ID)
+ * for the vertices in a renumber map returned by renumber_and_compress_sampled_edgelist or
+ * renumber_and_sort_sampled_edgelist (or any other vertex list). The output rows are stored
+ * contiguously in the renumber map order, so the rows of the vertices renumbered to [0, n) in a
+ * label are stored consecutively if the renumber map is (label-)segmented.
+ *
+ * In multi-GPU, the feature matrix is partitioned like the vertices (each GPU stores the feature
+ * rows of its local vertex partition range). The required rows are fetched from the owning GPUs
+ * with an all-to-all exchange (each distinct vertex in @p renumber_map is requested only once).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam feature_t Type of vertex features. Needs to be an arithmetic type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object (used to find the vertex partitioning).
+ * @param vertex_features Row-major feature matrix of the local vertices (size =
+ * graph_view.local_vertex_partition_range_size() * @p feature_dim).
+ * @param feature_dim Number of features per vertex.
+ * @param renumber_map Device span of the (internal) vertex IDs to gather the feature rows for.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Row-major feature matrix of the vertices in @p renumber_map (size = @p
+ * renumber_map.size() * @p feature_dim).
+ */
+template <typename vertex_t, typename edge_t, typename feature_t, bool multi_gpu>
+rmm::device_uvector<feature_t> gather_sampled_vertex_features(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<feature_t const> vertex_features,
+  size_t feature_dim,
+  raft::device_span<vertex_t const> renumber_map,
+  bool do_expensive_check = false);
+
 /**
  * @ingroup sampling_functions_cpp
  * @brief Build map to lookup source and destination using edge id and type
@@ -1159,7 +1388,9 @@ lookup_endpoints_from_edge_ids_and_types(
  * @param remove_duplicates If true, remove duplicate samples
  * @param remove_existing_edges If true, remove samples that are actually edges in the graph
  * @param exact_number_of_samples If true, repeat generation until we get the exact number of
- * negative samples
+ * negative samples.  Each repetition oversamples based on the acceptance ratio observed so far and
+ * the surplus is discarded; an exception is thrown if the exact number cannot be reached within a
+ * bounded number of repetitions (e.g. if the graph is too dense)
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
  *
  * @return tuple containing source vertex ids and destination vertex ids for the negative samples
@@ -1181,4 +1412,89 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> negativ
   bool exact_number_of_samples,
   bool do_expensive_check);
 
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Cluster-based subgraph sampling (ClusterGCN).
+ *
+ * The clusters (e.g. the output of Louvain or Leiden) are randomly permuted and grouped into
+ * subgraphs of @p clusters_per_subgraph clusters (the last subgraph may have fewer clusters), and
+ * the subgraph induced by the vertices of each group is extracted. One call covers every vertex
+ * once (one epoch of ClusterGCN minibatches).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state RNG state
+ * @param graph_view Graph View object to sample subgraphs from.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param clustering Cluster ID of each local vertex (size = @p
+ * graph_view.local_vertex_partition_range_size()). Cluster IDs need not be consecutive.
+ * @param clusters_per_subgraph Number of clusters to combine into each subgraph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Quadruplet of edge source vertices, edge destination vertices, edge weights (if @p
+ * edge_weight_view.has_value() is true), and edge offsets for each subgraph (size == # subgraphs +
+ * 1). The output can be passed to the sampling post processing functions with the subgraph offsets
+ * as the label offsets.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+cluster_subgraph_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> clustering,
+  size_t clusters_per_subgraph,
+  bool do_expensive_check = false);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Vertex and random walk based subgraph sampling (GraphSAINT).
+ *
+ * For each subgraph, @p num_roots_per_subgraph root vertices are selected uniformly at random
+ * (without replacement). If @p walk_length is 0, the subgraph induced by the roots is extracted
+ * (GraphSAINT node sampler). Otherwise, a uniform random walk of @p walk_length steps is started
+ * from each root, and the subgraph induced by the visited vertices is extracted (GraphSAINT random
+ * walk sampler).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param rng_state RNG state
+ * @param graph_view Graph View object to sample subgraphs from.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param num_subgraphs Number of subgraphs to sample.
+ * @param num_roots_per_subgraph Number of root vertices (in the entire graph) for each subgraph.
+ * @param walk_length Number of random walk steps from each root vertex.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Quadruplet of edge source vertices, edge destination vertices, edge weights (if @p
+ * edge_weight_view.has_value() is true), and edge offsets for each subgraph (size == @p
+ * num_subgraphs + 1).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+random_vertex_subgraph_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_subgraphs,
+  size_t num_roots_per_subgraph,
+  size_t walk_length,
+  bool do_expensive_check = false);
+
 }  // namespace cugraph
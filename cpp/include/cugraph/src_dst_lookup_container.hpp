@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,9 @@
 
 #include <thrust/tuple.h>
 
+#include <chrono>
+#include <memory>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -73,6 +76,69 @@ class lookup_container_t {
     raft::device_span<edge_id_t const> edge_ids_to_lookup,
     raft::device_span<edge_type_t const> edge_types_to_lookup,
     bool multi_gpu) const;
+
+  /**
+   * @brief Replicate the (edge ID, value) maps of the given edge types on every GPU.
+   *
+   * Lookups of a replicated edge type are served from the local replica and skip the edge ID
+   * shuffle. This is useful for small, frequently queried edge types. In multi-GPU, this is a
+   * collective call and @p types should be identical in every GPU.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param types Edge types to replicate (edge types that are already replicated are ignored).
+   * @param multi_gpu Flag indicating whether this container is distributed over multiple GPUs.
+   */
+  void replicate(raft::handle_t const& handle, std::vector<edge_type_t> types, bool multi_gpu);
+
+  bool is_replicated(edge_type_t type) const;
+};
+
+/**
+ * @brief Coalesce edge ID lookups issued concurrently by multiple host threads.
+ *
+ * Requests arriving within @p window (or until @p max_batch_size edge IDs are pending) are
+ * concatenated and served by a single lookup_container_t::lookup_from_edge_ids_and_types call on a
+ * worker thread, amortizing the host-to-device copies and the kernel launches over many small
+ * queries. @p handle is used by the worker thread only and should not be used by any other thread
+ * while this object is alive. As multi-GPU lookups are collective, in multi-GPU, every edge type
+ * queried through this object should be replicated (see lookup_container_t::replicate) and is
+ * served locally.
+ */
+template <typename edge_id_t,
+          typename edge_type_t,
+          typename vertex_t,
+          typename value_t = thrust::tuple<vertex_t, vertex_t>>
+class lookup_batcher_t {
+  template <typename _edge_id_t, typename _edge_type_t, typename _vertex_t, typename _value_t>
+  struct lookup_batcher_impl;
+  std::unique_ptr<lookup_batcher_impl<edge_id_t, edge_type_t, vertex_t, value_t>> pimpl;
+
+ public:
+  static_assert(std::is_same_v<value_t, thrust::tuple<vertex_t, vertex_t>>);
+
+  ~lookup_batcher_t();
+  lookup_batcher_t(raft::handle_t const& handle,
+                   lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t> const& container,
+                   std::chrono::microseconds window,
+                   size_t max_batch_size,
+                   bool multi_gpu);
+
+  lookup_batcher_t(lookup_batcher_t const&)            = delete;
+  lookup_batcher_t& operator=(lookup_batcher_t const&) = delete;
+
+  /**
+   * @brief Look up the (source, destination) pairs of the given (edge ID, edge type) pairs.
+   *
+   * This function is thread-safe and blocks till the batch including this request is served.
+   *
+   * @param edge_ids_to_lookup Edge IDs to look up.
+   * @param edge_types_to_lookup Edge types of the edge IDs to look up.
+   * @return Tuple of source and destination vertex IDs (invalid vertex IDs if not found).
+   */
+  std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> lookup(
+    std::vector<edge_id_t> const& edge_ids_to_lookup,
+    std::vector<edge_type_t> const& edge_types_to_lookup);
 };
 
 }  // namespace cugraph
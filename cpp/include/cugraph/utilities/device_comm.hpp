@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.hpp>
 
 #include <raft/core/handle.hpp>
@@ -30,7 +31,9 @@
 #include <thrust/memory.h>
 #include <thrust/tuple.h>
 
+#include <array>
 #include <type_traits>
+#include <utility>
 
 namespace cugraph {
 
@@ -548,6 +551,26 @@ struct device_reduce_tuple_iterator_element_impl<InputIterator, OutputIterator,
   }
 };
 
+template <typename InputIterator, typename OutputIterator, size_t... Is>
+void device_reduce_tuple_iterator_elements_impl(raft::comms::comms_t const& comm,
+                                                InputIterator input_first,
+                                                OutputIterator output_first,
+                                                size_t count,
+                                                std::array<raft::comms::op_t, sizeof...(Is)> ops,
+                                                int root,
+                                                rmm::cuda_stream_view stream_view,
+                                                std::index_sequence<Is...>)
+{
+  (device_reduce_impl(comm,
+                      thrust::get<Is>(input_first.get_iterator_tuple()),
+                      thrust::get<Is>(output_first.get_iterator_tuple()),
+                      count,
+                      ops[Is],
+                      root,
+                      stream_view),
+   ...);
+}
+
 template <typename InputIterator, typename OutputIterator>
 std::enable_if_t<thrust::detail::is_discard_iterator<OutputIterator>::value, void>
 device_allgather_impl(raft::comms::comms_t const& comm,
@@ -838,6 +861,7 @@ device_sendrecv(raft::comms::comms_t const& comm,
                 int src,
                 rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_sendrecv_impl<InputIterator, OutputIterator>(
     comm, input_first, tx_count, dst, output_first, rx_count, src, stream_view);
 }
@@ -856,6 +880,7 @@ device_sendrecv(raft::comms::comms_t const& comm,
                 int src,
                 rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -885,6 +910,7 @@ device_multicast_sendrecv(raft::comms::comms_t const& comm,
                           std::vector<int> const& rx_src_ranks,
                           rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_multicast_sendrecv_impl<InputIterator, OutputIterator>(comm,
                                                                         input_first,
                                                                         tx_counts,
@@ -913,6 +939,7 @@ device_multicast_sendrecv(raft::comms::comms_t const& comm,
                           std::vector<int> const& rx_src_ranks,
                           rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -947,6 +974,7 @@ device_bcast(raft::comms::comms_t const& comm,
              int root,
              rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_bcast_impl(comm, input_first, output_first, count, root, stream_view);
 }
 
@@ -962,6 +990,7 @@ device_bcast(raft::comms::comms_t const& comm,
              int root,
              rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -985,6 +1014,7 @@ device_allreduce(raft::comms::comms_t const& comm,
                  raft::comms::op_t op,
                  rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_allreduce_impl(comm, input_first, output_first, count, op, stream_view);
 }
 
@@ -1000,6 +1030,7 @@ device_allreduce(raft::comms::comms_t const& comm,
                  raft::comms::op_t op,
                  rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1026,6 +1057,7 @@ device_reduce(raft::comms::comms_t const& comm,
               int root,
               rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_reduce_impl(comm, input_first, output_first, count, op, root, stream_view);
 }
 
@@ -1042,6 +1074,7 @@ device_reduce(raft::comms::comms_t const& comm,
               int root,
               rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1056,6 +1089,30 @@ device_reduce(raft::comms::comms_t const& comm,
     .run(comm, input_first, output_first, count, op, root, stream_view);
 }
 
+// reduce each tuple element with a different op (ops[i] is used for the i-th tuple element)
+template <typename InputIterator, typename OutputIterator, size_t N>
+std::enable_if_t<
+  is_thrust_tuple_of_arithmetic<typename std::iterator_traits<InputIterator>::value_type>::value &&
+    is_thrust_tuple<typename std::iterator_traits<OutputIterator>::value_type>::value,
+  void>
+device_reduce(raft::comms::comms_t const& comm,
+              InputIterator input_first,
+              OutputIterator output_first,
+              size_t count,
+              std::array<raft::comms::op_t, N> const& ops,
+              int root,
+              rmm::cuda_stream_view stream_view)
+{
+  comm_profile_range_t comm_range(stream_view);
+  static_assert(
+    thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value == N);
+  static_assert(
+    thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value == N);
+
+  detail::device_reduce_tuple_iterator_elements_impl(
+    comm, input_first, output_first, count, ops, root, stream_view, std::make_index_sequence<N>());
+}
+
 template <typename InputIterator, typename OutputIterator>
 std::enable_if_t<
   std::is_arithmetic<typename std::iterator_traits<InputIterator>::value_type>::value,
@@ -1066,6 +1123,7 @@ device_allgather(raft::comms::comms_t const& comm,
                  size_t sendcount,
                  rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_allgather_impl(comm, input_first, output_first, sendcount, stream_view);
 }
 
@@ -1080,6 +1138,7 @@ device_allgather(raft::comms::comms_t const& comm,
                  size_t sendcount,
                  rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1105,6 +1164,7 @@ device_allgatherv(raft::comms::comms_t const& comm,
                   std::vector<size_t> const& displacements,
                   rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_allgatherv_impl(
     comm, input_first, output_first, recvcounts, displacements, stream_view);
 }
@@ -1121,6 +1181,7 @@ device_allgatherv(raft::comms::comms_t const& comm,
                   std::vector<size_t> const& displacements,
                   rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
@@ -1148,6 +1209,7 @@ device_gatherv(raft::comms::comms_t const& comm,
                int root,
                rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   detail::device_gatherv_impl(
     comm, input_first, output_first, sendcount, recvcounts, displacements, root, stream_view);
 }
@@ -1166,6 +1228,7 @@ device_gatherv(raft::comms::comms_t const& comm,
                int root,
                rmm::cuda_stream_view stream_view)
 {
+  comm_profile_range_t comm_range(stream_view);
   static_assert(
     thrust::tuple_size<typename thrust::iterator_traits<InputIterator>::value_type>::value ==
     thrust::tuple_size<typename thrust::iterator_traits<OutputIterator>::value_type>::value);
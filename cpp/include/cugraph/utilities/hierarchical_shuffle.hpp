@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/handle.hpp>
+
+#include <string>
+
+namespace cugraph {
+
+inline std::string node_local_comm_name() { return std::string("node_local_comm"); }
+
+inline std::string node_cross_comm_name() { return std::string("node_cross_comm"); }
+
+/**
+ * @brief Enable or disable the two-level (intra-node first, then inter-node) shuffle for the
+ * shuffles in edge list shuffling (shuffle_external_edges) and graph construction.
+ *
+ * If enabled, this function creates two sub-communicators in @p handle: node_local_comm_name()
+ * (GPUs in the same node) and node_cross_comm_name() (GPUs with the same local rank in different
+ * nodes). The two-level shuffle is enabled only if there are multiple nodes, multiple GPUs per
+ * node, and every node has the same number of GPUs; otherwise, the flat shuffle is used. This is a
+ * collective call.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param enable Flag to enable or disable the two-level shuffle.
+ * @return true if the two-level shuffle is enabled for @p handle after this call, false otherwise.
+ */
+bool enable_hierarchical_shuffle(raft::handle_t& handle, bool enable);
+
+/**
+ * @brief Query whether the two-level shuffle is enabled for @p handle.
+ */
+bool is_hierarchical_shuffle_enabled(raft::handle_t const& handle);
+
+}  // namespace cugraph
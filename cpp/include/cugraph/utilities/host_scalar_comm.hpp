@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.hpp>
 
 #include <raft/core/handle.hpp>
@@ -26,6 +27,8 @@
 
 #include <numeric>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -121,12 +124,55 @@ struct host_reduce_tuple_scalar_element_impl<TupleType, I, I> {
   }
 };
 
+template <typename TupleType, size_t... Is>
+constexpr bool is_thrust_tuple_of_same_type(std::index_sequence<Is...>)
+{
+  return (std::is_same_v<typename thrust::tuple_element<0, TupleType>::type,
+                         typename thrust::tuple_element<Is, TupleType>::type> &&
+          ...);
+}
+
+template <typename TupleType, size_t... Is>
+std::vector<typename thrust::tuple_element<0, TupleType>::type> thrust_tuple_to_vector(
+  TupleType const& tuple, std::index_sequence<Is...>)
+{
+  return std::vector<typename thrust::tuple_element<0, TupleType>::type>{
+    thrust::get<Is>(tuple)...};
+}
+
+template <typename TupleType, size_t... Is>
+TupleType vector_to_thrust_tuple(
+  std::vector<typename thrust::tuple_element<0, TupleType>::type> const& elements,
+  std::index_sequence<Is...>)
+{
+  return thrust::make_tuple(elements[Is]...);
+}
+
+// reduce the inputs element-wise with a single collective call
+template <typename T>
+std::vector<T> host_scalars_allreduce(raft::comms::comms_t const& comm,
+                                      std::vector<T> const& inputs,
+                                      raft::comms::op_t op,
+                                      cudaStream_t stream)
+{
+  comm_profile_range_t comm_range(stream);
+  rmm::device_uvector<T> d_inputs(inputs.size(), stream);
+  raft::update_device(d_inputs.data(), inputs.data(), inputs.size(), stream);
+  comm.allreduce(d_inputs.data(), d_inputs.data(), d_inputs.size(), op, stream);
+  std::vector<T> h_outputs(inputs.size());
+  raft::update_host(h_outputs.data(), d_inputs.data(), d_inputs.size(), stream);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+  return h_outputs;
+}
+
 }  // namespace detail
 
 template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_allreduce(
   raft::comms::comms_t const& comm, T input, raft::comms::op_t op, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   rmm::device_uvector<T> d_input(1, stream);
   raft::update_device(d_input.data(), &input, 1, stream);
   comm.allreduce(d_input.data(), d_input.data(), 1, op, stream);
@@ -141,7 +187,20 @@ template <typename T>
 std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scalar_allreduce(
   raft::comms::comms_t const& comm, T input, raft::comms::op_t op, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
+
+  // the elements of a homogeneous tuple (e.g. a pair of counts) are reduced in a single call
+  if constexpr (detail::is_thrust_tuple_of_same_type<T>(std::make_index_sequence<tuple_size>())) {
+    return detail::vector_to_thrust_tuple<T>(
+      detail::host_scalars_allreduce(
+        comm,
+        detail::thrust_tuple_to_vector(input, std::make_index_sequence<tuple_size>()),
+        op,
+        stream),
+      std::make_index_sequence<tuple_size>());
+  }
+
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_tuple_scalar_elements(tuple_size, stream);
   T ret{};
@@ -162,11 +221,58 @@ std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scala
   return ret;
 }
 
+/**
+ * @brief Accumulate scalars to reduce over all the GPUs and reduce them in a single collective
+ * call.
+ *
+ * Every host_scalar_allreduce call launches a collective and synchronizes the stream; code reducing
+ * several independent scalars in a row (e.g. multiple frontier sizes) can add them to a batch and
+ * flush the batch once instead. Every GPU should add the same number of scalars in the same order.
+ *
+ * @tparam T Type of the scalars, needs to be an arithmetic type.
+ */
+template <typename T>
+class host_scalar_allreduce_batch_t {
+  static_assert(std::is_arithmetic_v<T>);
+
+ public:
+  host_scalar_allreduce_batch_t(raft::comms::comms_t const& comm,
+                                raft::comms::op_t op,
+                                cudaStream_t stream)
+    : comm_(comm), op_(op), stream_(stream)
+  {
+  }
+
+  // returns the position of the reduced value in the flush() output
+  size_t add(T input)
+  {
+    inputs_.push_back(input);
+    return inputs_.size() - 1;
+  }
+
+  // reduce the added scalars (in the order they were added) and clear the batch
+  std::vector<T> flush()
+  {
+    auto outputs = inputs_.size() > 0
+                     ? detail::host_scalars_allreduce(comm_, inputs_, op_, stream_)
+                     : std::vector<T>{};
+    inputs_.clear();
+    return outputs;
+  }
+
+ private:
+  raft::comms::comms_t const& comm_;
+  raft::comms::op_t op_{};
+  cudaStream_t stream_{};
+  std::vector<T> inputs_{};
+};
+
 // Return value is valid only in root (return value may better be std::optional in C++17 or later)
 template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_reduce(
   raft::comms::comms_t const& comm, T input, raft::comms::op_t op, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   rmm::device_uvector<T> d_input(1, stream);
   raft::update_device(d_input.data(), &input, 1, stream);
   comm.reduce(d_input.data(), d_input.data(), 1, op, stream);
@@ -182,6 +288,7 @@ template <typename T>
 std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scalar_reduce(
   raft::comms::comms_t const& comm, T input, raft::comms::op_t op, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_tuple_scalar_elements(tuple_size, stream);
@@ -211,6 +318,7 @@ template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_bcast(
   raft::comms::comms_t const& comm, T input, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   rmm::device_uvector<T> d_input(1, stream);
   if (comm.get_rank() == root) { raft::update_device(d_input.data(), &input, 1, stream); }
   comm.bcast(d_input.data(), 1, root, stream);
@@ -225,6 +333,7 @@ template <typename T>
 std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scalar_bcast(
   raft::comms::comms_t const& comm, T input, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_tuple_scalar_elements(tuple_size, stream);
@@ -255,6 +364,7 @@ template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_allgather(
   raft::comms::comms_t const& comm, T input, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   rmm::device_uvector<T> d_outputs(comm.get_size(), stream);
   raft::update_device(d_outputs.data() + comm.get_rank(), &input, 1, stream);
   comm.allgather(d_outputs.data() + comm.get_rank(), d_outputs.data(), size_t{1}, stream);
@@ -269,6 +379,7 @@ template <typename T>
 std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, std::vector<T>>
 host_scalar_allgather(raft::comms::comms_t const& comm, T input, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_allgathered_tuple_scalar_elements(comm.get_size() * tuple_size,
@@ -311,6 +422,7 @@ std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_scatter(
   int root,
   cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   CUGRAPH_EXPECTS(
     ((comm.get_rank() == root) && (inputs.size() == static_cast<size_t>(comm.get_size()))) ||
       ((comm.get_rank() != root) && (inputs.size() == 0)),
@@ -334,6 +446,7 @@ std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, T> host_scala
   int root,
   cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   CUGRAPH_EXPECTS(
     ((comm.get_rank() == root) && (inputs.size() == static_cast<size_t>(comm.get_size()))) ||
       ((comm.get_rank() != root) && (inputs.size() == 0)),
@@ -374,6 +487,7 @@ template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_gather(
   raft::comms::comms_t const& comm, T input, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   rmm::device_uvector<T> d_outputs(comm.get_rank() == root ? comm.get_size() : int{1}, stream);
   raft::update_device(
     comm.get_rank() == root ? d_outputs.data() + comm.get_rank() : d_outputs.data(),
@@ -399,6 +513,7 @@ template <typename T>
 std::enable_if_t<cugraph::is_thrust_tuple_of_arithmetic<T>::value, std::vector<T>>
 host_scalar_gather(raft::comms::comms_t const& comm, T input, int root, cudaStream_t stream)
 {
+  comm_profile_range_t comm_range(stream);
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   std::vector<int64_t> h_tuple_scalar_elements(tuple_size);
   rmm::device_uvector<int64_t> d_gathered_tuple_scalar_elements(
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/handle.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Per-GPU wall time of a profiled phase (an instrumented primitive or algorithm iteration,
+ * see prim_profile_range_t).
+ */
+struct phase_load_imbalance_record_t {
+  std::string name{};
+  std::vector<double> elapsed_seconds{};    // per rank
+  std::vector<double> comm_wait_seconds{};  // per rank, time in collective communication
+
+  // local compute time (elapsed_seconds - comm_wait_seconds) of rank i
+  double compute_seconds(size_t i) const;
+
+  // the rank with the longest local compute time, the other GPUs wait for this rank in the
+  // collective communication
+  int straggler_rank() const;
+
+  // maximum over mean of the local compute times (1.0 if perfectly balanced)
+  double compute_imbalance() const;
+};
+
+/**
+ * @brief Per-GPU load statistics of a multi-GPU algorithm call.
+ */
+struct load_imbalance_report_t {
+  std::vector<size_t> num_local_vertices{};  // per rank
+  std::vector<size_t> num_local_edges{};     // per rank
+  std::vector<phase_load_imbalance_record_t> phases{};  // sorted by name
+
+  // maximum over mean of the local vertex (edge) counts (1.0 if perfectly balanced)
+  double vertex_imbalance() const;
+  double edge_imbalance() const;
+};
+
+/**
+ * @brief Aggregate the per-GPU profile records and partition sizes into a load-imbalance report.
+ *
+ * This gathers the records of the process-wide prim_profiler_t from every GPU, so enable
+ * profiling and clear the profiler before the algorithm call to report on. The per-phase time in
+ * collective communication (comm_wait_seconds) includes the time waiting for the slower GPUs, so
+ * a GPU with a long local compute time and a short communication time is a straggler. This is a
+ * collective call, every GPU should have recorded the same phases (this is the case if the GPUs
+ * run the same algorithm calls with profiling enabled). Reports only the local GPU if @p handle
+ * has no communicator.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param num_local_vertices Number of vertices in the local vertex partition.
+ * @param num_local_edges Number of edges in the local edge partitions.
+ * @param clear_profiler If true, clear the profiler records after gathering them.
+ * @return Load-imbalance report (identical in every GPU).
+ */
+load_imbalance_report_t build_load_imbalance_report(raft::handle_t const& handle,
+                                                    size_t num_local_vertices,
+                                                    size_t num_local_edges,
+                                                    bool clear_profiler = true);
+
+/**
+ * @brief Aggregate the per-GPU profile records and the partition sizes of @p graph_view into a
+ * load-imbalance report.
+ *
+ * See build_load_imbalance_report above.
+ *
+ * @tparam GraphViewType Type of the passed graph view object.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph the algorithm ran on.
+ * @param clear_profiler If true, clear the profiler records after gathering them.
+ * @return Load-imbalance report (identical in every GPU).
+ */
+template <typename GraphViewType>
+std::enable_if_t<!std::is_arithmetic_v<GraphViewType>, load_imbalance_report_t>
+build_load_imbalance_report(raft::handle_t const& handle,
+                            GraphViewType const& graph_view,
+                            bool clear_profiler = true)
+{
+  size_t num_local_edges{0};
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    num_local_edges +=
+      static_cast<size_t>(graph_view.local_edge_partition_view(i).number_of_edges());
+  }
+  return build_load_imbalance_report(
+    handle,
+    static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    num_local_edges,
+    clear_profiler);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/host_span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cugraph {
+
+/**
+ * @brief Estimated device memory usage (per rank) of a graph construction or algorithm call.
+ *
+ * The estimates follow the buffer allocation sequence of the corresponding implementation assuming
+ * evenly distributed vertices and edges (every rank holds number_of_vertices / P vertices and
+ * number_of_edges / P edges, P = major_comm_size * minor_comm_size). They do not include memory
+ * resource overhead (e.g. pool fragmentation and allocation alignment) and the temporary storage
+ * of CUB/Thrust primitives beyond the double buffering of sorts, so leave some headroom when
+ * sizing clusters.
+ */
+struct memory_estimate_t {
+  size_t persistent_bytes{0};  // device memory held by the outputs after the call returns
+  size_t peak_bytes{0};  // peak device memory usage during the call (see each function for the
+                         // buffers included)
+};
+
+/**
+ * @brief Estimate the device memory usage of renumber_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param number_of_vertices Number of vertices in the (global) graph.
+ * @param number_of_edges Number of edges in the (global) graph.
+ * @param major_comm_size Size of the major communicator (1 in single-GPU).
+ * @param minor_comm_size Size of the minor communicator (1 in single-GPU).
+ * @return Estimated device memory usage per rank. The peak includes the input edge list (which is
+ * renumbered in-place); the persistent bytes cover the returned renumber map.
+ */
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_renumber_edgelist_memory(size_t number_of_vertices,
+                                                    size_t number_of_edges,
+                                                    int major_comm_size = 1,
+                                                    int minor_comm_size = 1);
+
+/**
+ * @brief Estimate the device memory usage of create_graph_from_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param number_of_vertices Number of vertices in the (global) graph.
+ * @param number_of_edges Number of edges in the (global) graph.
+ * @param edge_property_bytes Total size (in bytes) of the edge properties (weights, edge IDs, edge
+ * types, and edge times) of an edge.
+ * @param renumber Flag indicating whether to renumber vertices or not.
+ * @param major_comm_size Size of the major communicator (1 in single-GPU).
+ * @param minor_comm_size Size of the minor communicator (1 in single-GPU).
+ * @return Estimated device memory usage per rank. The peak includes the input (pre-shuffled in
+ * multi-GPU) edge list; the persistent bytes cover the returned graph, edge properties, and
+ * renumber map.
+ */
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_create_graph_from_edgelist_memory(size_t number_of_vertices,
+                                                             size_t number_of_edges,
+                                                             size_t edge_property_bytes,
+                                                             bool renumber,
+                                                             int major_comm_size = 1,
+                                                             int minor_comm_size = 1);
+
+/**
+ * @brief Estimate the device memory usage of neighbor sampling (homogeneous_uniform_neighbor_sample
+ * and homogeneous_biased_neighbor_sample).
+ *
+ * Every frontier vertex is assumed to have at least fan_out[i] neighbors (so every hop samples the
+ * maximum number of edges), this gives an upper bound for graphs with small degree vertices.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param number_of_seeds_per_rank Number of seed vertices per rank.
+ * @param fan_out Number of edges to sample per frontier vertex in each hop.
+ * @param edge_property_bytes Total size (in bytes) of the edge properties gathered for each sampled
+ * edge (weights, edge IDs, edge types, and edge times).
+ * @param return_hops Flag indicating whether to return the hop of each sampled edge.
+ * @param major_comm_size Size of the major communicator (1 in single-GPU).
+ * @param minor_comm_size Size of the minor communicator (1 in single-GPU).
+ * @return Estimated device memory usage per rank excluding the input graph. The persistent bytes
+ * cover the returned sampled edges.
+ */
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_neighbor_sample_memory(size_t number_of_seeds_per_rank,
+                                                  raft::host_span<int32_t const> fan_out,
+                                                  size_t edge_property_bytes,
+                                                  bool return_hops,
+                                                  int major_comm_size = 1,
+                                                  int minor_comm_size = 1);
+
+/**
+ * @brief Estimate the device memory usage of louvain (and leiden).
+ *
+ * The first level dominates as coarsening shrinks the graph in every level.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param number_of_vertices Number of vertices in the (global) graph.
+ * @param number_of_edges Number of edges in the (global) graph.
+ * @param major_comm_size Size of the major communicator (1 in single-GPU).
+ * @param minor_comm_size Size of the minor communicator (1 in single-GPU).
+ * @return Estimated device memory usage per rank excluding the input graph and edge weights. The
+ * persistent bytes cover the returned clustering.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+memory_estimate_t estimate_louvain_memory(size_t number_of_vertices,
+                                          size_t number_of_edges,
+                                          int major_comm_size = 1,
+                                          int minor_comm_size = 1);
+
+}  // namespace cugraph
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <optional>
+
+namespace cugraph {
+
+/**
+ * @brief Memory usage classes that can be mapped to different memory resources.
+ */
+enum class memory_usage_t {
+  persistent /* long-lived graph storage (edge partition offsets, indices, and edge properties) */,
+  scratch /* temporary buffers in sort/renumber/intersection/sampling peaks */
+};
+
+/**
+ * @brief Set the memory resource to allocate the buffers of the given usage class from in the
+ * calls using @p handle.
+ *
+ * By default, every buffer is allocated from the current device resource. Mapping scratch buffers
+ * to a separate resource (e.g. an rmm::mr::arena_memory_resource) keeps short-lived peaks from
+ * fragmenting the pool holding graph storage in long-running processes. Only the code paths that
+ * have been updated to use the hints (graph creation, renumbering, neighbor intersection, and
+ * sampling frontier updates) honor them; other buffers are still allocated from the current device
+ * resource. The memory resource should outlive every object allocated from it.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param usage Memory usage class.
+ * @param mr Memory resource to allocate the buffers of @p usage from, std::nullopt to use the
+ * current device resource.
+ */
+void set_memory_resource_hint(raft::handle_t const& handle,
+                              memory_usage_t usage,
+                              std::optional<rmm::device_async_resource_ref> mr);
+
+/**
+ * @brief Get the memory resource set by set_memory_resource_hint (std::nullopt if not set).
+ */
+std::optional<rmm::device_async_resource_ref> get_memory_resource_hint(
+  raft::handle_t const& handle, memory_usage_t usage);
+
+/**
+ * @brief Get the memory resource for scratch buffers (the current device resource if not set).
+ */
+inline rmm::device_async_resource_ref get_scratch_memory_resource(raft::handle_t const& handle)
+{
+  auto mr = get_memory_resource_hint(handle, memory_usage_t::scratch);
+  return mr ? *mr : rmm::device_async_resource_ref{rmm::mr::get_current_device_resource()};
+}
+
+namespace detail {
+
+// Copy buffer to memory allocated from mr (and release the input buffer) if buffer is allocated
+// from a different memory resource.
+template <typename T>
+rmm::device_uvector<T> move_to_memory_resource(rmm::device_uvector<T>&& buffer,
+                                               rmm::device_async_resource_ref mr,
+                                               rmm::cuda_stream_view stream_view)
+{
+  auto input = std::move(buffer);
+  if (input.memory_resource() == mr) { return input; }
+  rmm::device_uvector<T> ret(input.size(), stream_view, mr);
+  raft::copy(ret.data(), input.data(), input.size(), stream_view);
+  return ret;
+}
+
+}  // namespace detail
+
+}  // namespace cugraph
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/nvtx.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Aggregated runtime statistics of a primitive.
+ */
+struct prim_profile_record_t {
+  std::string name{};
+  size_t num_calls{0};
+  double elapsed_seconds{0.0};  // wall time including nested instrumented primitives
+  size_t bytes_communicated{0};  // bytes sent to the other GPUs
+  size_t edges_touched{0};  // local edges in the edge partitions scanned (an upper bound as edge
+                            // masks & frontiers are ignored, 0 if not tracked by the primitive)
+  size_t host_syncs{0};  // device to host read-backs used for control flow decisions (recorded by
+                         // the instrumented algorithm iterations, excludes the ones in primitives)
+  double comm_wait_seconds{0.0};  // wall time in collective communication (included in
+                                  // elapsed_seconds, see comm_profile_range_t)
+};
+
+/**
+ * @brief Process-wide collector of per-primitive runtime statistics.
+ *
+ * Profiling is disabled by default. If disabled, the instrumented primitives only push & pop NVTX
+ * ranges. If enabled, the instrumented primitives synchronize the stream at entry and exit to
+ * measure wall time, so enable profiling only for performance analysis.
+ */
+class prim_profiler_t {
+ public:
+  static prim_profiler_t& instance();
+
+  void enable(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+  bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void record(char const* name,
+              double elapsed_seconds,
+              size_t bytes_communicated,
+              size_t edges_touched,
+              size_t host_syncs        = 0,
+              double comm_wait_seconds = 0.0);
+
+  // records sorted by name
+  std::vector<prim_profile_record_t> report() const;
+
+  void clear();
+
+  // per-thread state of the collective communication instrumentation (see comm_profile_range_t)
+  struct thread_comm_state_t {
+    double comm_wait_seconds{0.0};  // accumulated over the lifetime of the thread
+    bool in_comm{false};
+  };
+
+  static thread_comm_state_t& thread_comm_state();
+
+ private:
+  prim_profiler_t() = default;
+
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex mutex_{};
+  std::map<std::string, prim_profile_record_t> records_{};
+};
+
+/**
+ * @brief RAII object to instrument a primitive invocation (an NVTX range and a prim_profiler_t
+ * record if profiling is enabled).
+ *
+ * Algorithms also use this to instrument each iteration of their main loops (e.g. "bfs
+ * iteration"), and report the host synchronizations the iteration needs to decide what to launch
+ * next with add_host_syncs (host_syncs / num_calls gives the per-iteration sync count).
+ */
+class prim_profile_range_t {
+ public:
+  prim_profile_range_t(rmm::cuda_stream_view stream_view, char const* name)
+    : stream_view_(stream_view), name_(name), enabled_(prim_profiler_t::instance().is_enabled())
+  {
+    raft::common::nvtx::push_range(name_);
+    if (enabled_) {
+      stream_view_.synchronize_no_throw();
+      start_time_              = std::chrono::steady_clock::now();
+      start_comm_wait_seconds_ = prim_profiler_t::thread_comm_state().comm_wait_seconds;
+    }
+  }
+
+  prim_profile_range_t(prim_profile_range_t const&)            = delete;
+  prim_profile_range_t& operator=(prim_profile_range_t const&) = delete;
+
+  ~prim_profile_range_t()
+  {
+    if (enabled_) {
+      stream_view_.synchronize_no_throw();
+      std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start_time_;
+      prim_profiler_t::instance().record(
+        name_,
+        diff.count(),
+        bytes_communicated_,
+        edges_touched_,
+        host_syncs_,
+        prim_profiler_t::thread_comm_state().comm_wait_seconds - start_comm_wait_seconds_);
+    }
+    raft::common::nvtx::pop_range();
+  }
+
+  bool is_enabled() const { return enabled_; }
+
+  void add_bytes_communicated(size_t bytes) { bytes_communicated_ += bytes; }
+  void add_edges_touched(size_t edges) { edges_touched_ += edges; }
+  void add_host_syncs(size_t syncs) { host_syncs_ += syncs; }
+
+ private:
+  rmm::cuda_stream_view stream_view_{};
+  char const* name_{nullptr};
+  bool enabled_{false};
+  std::chrono::steady_clock::time_point start_time_{};
+  double start_comm_wait_seconds_{0.0};
+  size_t bytes_communicated_{0};
+  size_t edges_touched_{0};
+  size_t host_syncs_{0};
+};
+
+/**
+ * @brief RAII object to instrument a collective communication call.
+ *
+ * If profiling is enabled, this synchronizes the stream at entry (so the time to complete the
+ * local work is not attributed to the communication) and exit, and adds the elapsed time to the
+ * comm_wait_seconds of the enclosing prim_profile_range_t objects. In multi-GPU, this includes the
+ * time waiting for the slower GPUs to reach the collective call, so comparing comm_wait_seconds
+ * across GPUs identifies the GPUs setting the pace (the ones waiting the least). Nested ranges are
+ * timed by the outermost range.
+ */
+class comm_profile_range_t {
+ public:
+  comm_profile_range_t(rmm::cuda_stream_view stream_view) : stream_view_(stream_view)
+  {
+    if (prim_profiler_t::instance().is_enabled()) {
+      auto& state = prim_profiler_t::thread_comm_state();
+      if (!state.in_comm) {
+        state.in_comm = true;
+        enabled_      = true;
+        stream_view_.synchronize_no_throw();
+        start_time_ = std::chrono::steady_clock::now();
+      }
+    }
+  }
+
+  comm_profile_range_t(comm_profile_range_t const&)            = delete;
+  comm_profile_range_t& operator=(comm_profile_range_t const&) = delete;
+
+  ~comm_profile_range_t()
+  {
+    if (enabled_) {
+      stream_view_.synchronize_no_throw();
+      std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start_time_;
+      auto& state                        = prim_profiler_t::thread_comm_state();
+      state.comm_wait_seconds += diff.count();
+      state.in_comm = false;
+    }
+  }
+
+ private:
+  rmm::cuda_stream_view stream_view_{};
+  bool enabled_{false};
+  std::chrono::steady_clock::time_point start_time_{};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/handle.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace cugraph {
+
+/**
+ * @brief Metrics of a completed iteration passed to the progress callback.
+ *
+ * Louvain and Leiden report every completed level (@p iteration is the number of completed
+ * levels, @p frontier_size is the number of vertices in the coarsened graph). PageRank reports
+ * every iteration (@p residual is the sum of the PageRank value changes, NaN in the iterations
+ * skipping the convergence check). Betweenness centrality reports every batch of sources
+ * (@p iteration is the number of processed sources, @p frontier_size is the number of sources
+ * still to process). Metrics an algorithm does not track are NaN (or 0 for @p frontier_size).
+ */
+struct iteration_progress_t {
+  char const* algorithm{nullptr};
+  size_t iteration{0};
+  double modularity{std::numeric_limits<double>::quiet_NaN()};
+  double residual{std::numeric_limits<double>::quiet_NaN()};
+  size_t frontier_size{0};
+};
+
+/**
+ * @brief Type of the progress callback, returning true requests early termination.
+ */
+using progress_callback_t = std::function<bool(iteration_progress_t const&)>;
+
+/**
+ * @brief Set the callback receiving the per-iteration progress of the algorithms called with
+ * @p handle.
+ *
+ * The callback is invoked on the host after every reported iteration (see iteration_progress_t)
+ * and can stop the algorithm by returning true. A stopped algorithm returns the results of the
+ * completed iterations: Louvain and Leiden return the clustering of the completed levels (as if
+ * max_level were reached), PageRank returns the current values and reports that it did not
+ * converge, and betweenness centrality returns the centralities estimated from the processed
+ * sources. In multi-GPU, the callback should be set on every GPU (it is invoked on every GPU), and
+ * the algorithm stops if the callback on any GPU returns true.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param callback Progress callback, an empty function to remove the callback.
+ */
+void set_progress_callback(raft::handle_t const& handle, progress_callback_t callback);
+
+namespace detail {
+
+// Invoke the progress callback set for handle (if any) and return whether to stop. In multi-GPU,
+// this is a collective call if the callback is set.
+bool report_progress(raft::handle_t const& handle,
+                     iteration_progress_t const& progress,
+                     bool multi_gpu);
+
+}  // namespace detail
+
+}  // namespace cugraph
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuda_bf16.h>
+#include <cuda_fp16.h>
+
+#include <cstdint>
+
+namespace cugraph {
+
+/**
+ * @brief 16 bit floating point formats for edge weight storage.
+ *
+ * Edge properties should have arithmetic value types, so 16 bit edge weights are stored as raw
+ * bits in an edge property of type uint16_t and decoded to float (with @ref
+ * half_edge_weight_decoder_t) before accumulation.
+ */
+enum class half_precision_t { float16, bfloat16 };
+
+/**
+ * @brief Decode a 16 bit edge weight (stored as raw bits) to float.
+ */
+struct half_edge_weight_decoder_t {
+  half_precision_t precision{half_precision_t::float16};
+
+  __host__ __device__ float operator()(uint16_t bits) const
+  {
+    if (precision == half_precision_t::float16) {
+      __half_raw raw{};
+      raw.x = bits;
+      return __half2float(__half(raw));
+    } else {
+      __nv_bfloat16_raw raw{};
+      raw.x = bits;
+      return __bfloat162float(__nv_bfloat16(raw));
+    }
+  }
+};
+
+/**
+ * @brief Decode a uint8 quantized edge weight to float (@p offset + @p q * @p scale).
+ */
+struct uint8_edge_weight_decoder_t {
+  float scale{1.0};
+  float offset{0.0};
+
+  __host__ __device__ float operator()(uint8_t q) const
+  {
+    return offset + static_cast<float>(q) * scale;
+  }
+};
+
+}  // namespace cugraph
@@ -17,7 +17,10 @@
 
 #include <cugraph/utilities/dataframe_buffer.hpp>
 #include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 
+#include <raft/core/device_span.hpp>
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
@@ -31,6 +34,8 @@
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
@@ -754,6 +759,67 @@ void mem_frugal_groupby(
   }
 }
 
+// # elements sent to the other GPUs (excluding the elements "sent" to self)
+inline size_t count_remote_tx_elements(int comm_rank,
+                                       std::vector<size_t> const& tx_counts,
+                                       std::vector<int> const& tx_dst_ranks)
+{
+  size_t ret{0};
+  for (size_t i = 0; i < tx_counts.size(); ++i) {
+    if (tx_dst_ranks[i] != comm_rank) { ret += tx_counts[i]; }
+  }
+  return ret;
+}
+
+// copy the segments of [value_first, value_first + sum(segment_counts)) (segment i starts at
+// segment_offsets[i]) to a new buffer in the order of segment_order
+template <typename ValueIterator>
+dataframe_buffer_type_t<typename thrust::iterator_traits<ValueIterator>::value_type>
+permute_segments(ValueIterator value_first,
+                 std::vector<size_t> const& segment_offsets,
+                 std::vector<size_t> const& segment_counts,
+                 std::vector<size_t> const& segment_order,
+                 rmm::cuda_stream_view stream_view)
+{
+  using value_t = typename thrust::iterator_traits<ValueIterator>::value_type;
+
+  std::vector<size_t> h_output_offsets(segment_order.size() + 1, size_t{0});
+  std::vector<size_t> h_input_offsets(segment_order.size());
+  for (size_t i = 0; i < segment_order.size(); ++i) {
+    h_output_offsets[i + 1] = h_output_offsets[i] + segment_counts[segment_order[i]];
+    h_input_offsets[i]      = segment_offsets[segment_order[i]];
+  }
+
+  rmm::device_uvector<size_t> d_output_offsets(h_output_offsets.size(), stream_view);
+  rmm::device_uvector<size_t> d_input_offsets(h_input_offsets.size(), stream_view);
+  raft::update_device(
+    d_output_offsets.data(), h_output_offsets.data(), h_output_offsets.size(), stream_view);
+  raft::update_device(
+    d_input_offsets.data(), h_input_offsets.data(), h_input_offsets.size(), stream_view);
+
+  auto ret = allocate_dataframe_buffer<value_t>(h_output_offsets.back(), stream_view);
+  auto input_index_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(size_t{0}),
+    cuda::proclaim_return_type<size_t>(
+      [output_offsets = raft::device_span<size_t const>(d_output_offsets.data(),
+                                                        d_output_offsets.size()),
+       input_offsets  = raft::device_span<size_t const>(
+         d_input_offsets.data(), d_input_offsets.size())] __device__(size_t i) {
+        auto idx = static_cast<size_t>(thrust::distance(
+                     output_offsets.begin() + 1,
+                     thrust::upper_bound(
+                       thrust::seq, output_offsets.begin() + 1, output_offsets.end(), i)));
+        return input_offsets[idx] + (i - output_offsets[idx]);
+      }));
+  thrust::gather(rmm::exec_policy_nosync(stream_view),
+                 input_index_first,
+                 input_index_first + h_output_offsets.back(),
+                 value_first,
+                 get_dataframe_buffer_begin(ret));
+
+  return ret;
+}
+
 }  // namespace detail
 
 template <typename ValueIterator, typename ValueToGroupIdOp>
@@ -831,6 +897,8 @@ auto shuffle_values(raft::comms::comms_t const& comm,
 {
   using value_t = typename thrust::iterator_traits<TxValueIterator>::value_type;
 
+  prim_profile_range_t profile_range(stream_view, "shuffle_values");
+
   auto const comm_size = comm.get_size();
 
   rmm::device_uvector<size_t> d_tx_value_counts(comm_size, stream_view);
@@ -845,6 +913,10 @@ auto shuffle_values(raft::comms::comms_t const& comm,
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
     detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, true, stream_view);
+  if (profile_range.is_enabled()) {
+    profile_range.add_bytes_communicated(
+      detail::count_remote_tx_elements(comm.get_rank(), tx_counts, tx_dst_ranks) * sizeof(value_t));
+  }
 
   auto rx_value_buffer = allocate_dataframe_buffer<value_t>(
     rx_offsets.size() > 0 ? rx_offsets.back() + rx_counts.back() : size_t{0}, stream_view);
@@ -873,6 +945,157 @@ auto shuffle_values(raft::comms::comms_t const& comm,
   return std::make_tuple(std::move(rx_value_buffer), rx_counts);
 }
 
+// Two-level variant of shuffle_values for multi-node clusters. Values are first exchanged inside a
+// node (node_local_comm) to the local GPU with the same local rank as the final destination, and
+// then exchanged between the GPUs with the same local rank (node_cross_comm), so every GPU sends
+// one fused message per remote node instead of one message per remote GPU. node_local_comm and
+// node_cross_comm should be created by enable_hierarchical_shuffle(). The return value is identical
+// to shuffle_values (received values are grouped by the source rank in comm).
+template <typename TxValueIterator>
+auto hierarchical_shuffle_values(raft::comms::comms_t const& comm,
+                                 raft::comms::comms_t const& node_local_comm,
+                                 raft::comms::comms_t const& node_cross_comm,
+                                 TxValueIterator tx_value_first,
+                                 std::vector<size_t> const& tx_value_counts,
+                                 rmm::cuda_stream_view stream_view)
+{
+  prim_profile_range_t profile_range(stream_view, "hierarchical_shuffle_values");
+
+  auto const comm_size  = comm.get_size();
+  auto const local_size = node_local_comm.get_size();
+  auto const num_nodes  = node_cross_comm.get_size();
+  CUGRAPH_EXPECTS(comm_size == local_size * num_nodes,
+                  "Invalid input arguments: comm_size should coincide with the product of "
+                  "node_local_comm size and node_cross_comm size.");
+
+  // comm rank => (node, local rank) and (node, local rank) => comm rank
+
+  auto node_local_ids =
+    host_scalar_allgather(comm,
+                          node_cross_comm.get_rank() * local_size + node_local_comm.get_rank(),
+                          stream_view.value());
+  std::vector<int> comm_ranks(comm_size);
+  for (int r = 0; r < comm_size; ++r) {
+    comm_ranks[node_local_ids[r]] = r;
+  }
+
+  std::vector<size_t> tx_value_displacements(comm_size);
+  std::exclusive_scan(
+    tx_value_counts.begin(), tx_value_counts.end(), tx_value_displacements.begin(), size_t{0});
+
+  // 1. exchange inside the node, destination (node b, local rank j) goes to local rank j
+
+  std::vector<size_t> tx_order(comm_size);
+  std::vector<size_t> tx_local_counts(local_size, size_t{0});
+  std::vector<size_t> tx_local_node_counts(comm_size);
+  for (int j = 0; j < local_size; ++j) {
+    for (int b = 0; b < num_nodes; ++b) {
+      auto r                                  = comm_ranks[b * local_size + j];
+      tx_order[j * num_nodes + b]             = r;
+      tx_local_node_counts[j * num_nodes + b] = tx_value_counts[r];
+      tx_local_counts[j] += tx_value_counts[r];
+    }
+  }
+  auto tx_local_values = detail::permute_segments(
+    tx_value_first, tx_value_displacements, tx_value_counts, tx_order, stream_view);
+
+  rmm::device_uvector<size_t> d_tx_local_node_counts(tx_local_node_counts.size(), stream_view);
+  raft::update_device(d_tx_local_node_counts.data(),
+                      tx_local_node_counts.data(),
+                      tx_local_node_counts.size(),
+                      stream_view);
+  auto [d_rx_local_node_counts, rx_local_node_count_sizes] =
+    shuffle_values(node_local_comm,
+                   d_tx_local_node_counts.begin(),
+                   std::vector<size_t>(local_size, static_cast<size_t>(num_nodes)),
+                   stream_view);
+  std::vector<size_t> rx_local_node_counts(d_rx_local_node_counts.size());
+  raft::update_host(rx_local_node_counts.data(),
+                    d_rx_local_node_counts.data(),
+                    d_rx_local_node_counts.size(),
+                    stream_view);
+
+  auto [rx_local_values, rx_local_counts] = shuffle_values(
+    node_local_comm, get_dataframe_buffer_begin(tx_local_values), tx_local_counts, stream_view);
+  resize_dataframe_buffer(tx_local_values, 0, stream_view);
+  shrink_to_fit_dataframe_buffer(tx_local_values, stream_view);
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view));
+
+  // 2. exchange between the nodes, (local source i, destination node b) segments are grouped by b
+
+  std::vector<size_t> rx_local_offsets(local_size * num_nodes);
+  std::exclusive_scan(rx_local_node_counts.begin(),
+                      rx_local_node_counts.end(),
+                      rx_local_offsets.begin(),
+                      size_t{0});
+  std::vector<size_t> tx_cross_order(local_size * num_nodes);
+  std::vector<size_t> tx_cross_counts(num_nodes, size_t{0});
+  std::vector<size_t> tx_cross_local_counts(local_size * num_nodes);
+  for (int b = 0; b < num_nodes; ++b) {
+    for (int i = 0; i < local_size; ++i) {
+      tx_cross_order[b * local_size + i]        = i * num_nodes + b;
+      tx_cross_local_counts[b * local_size + i] = rx_local_node_counts[i * num_nodes + b];
+      tx_cross_counts[b] += rx_local_node_counts[i * num_nodes + b];
+    }
+  }
+  auto tx_cross_values = detail::permute_segments(get_dataframe_buffer_begin(rx_local_values),
+                                                  rx_local_offsets,
+                                                  rx_local_node_counts,
+                                                  tx_cross_order,
+                                                  stream_view);
+  resize_dataframe_buffer(rx_local_values, 0, stream_view);
+  shrink_to_fit_dataframe_buffer(rx_local_values, stream_view);
+
+  rmm::device_uvector<size_t> d_tx_cross_local_counts(tx_cross_local_counts.size(), stream_view);
+  raft::update_device(d_tx_cross_local_counts.data(),
+                      tx_cross_local_counts.data(),
+                      tx_cross_local_counts.size(),
+                      stream_view);
+  auto [d_rx_cross_local_counts, rx_cross_local_count_sizes] =
+    shuffle_values(node_cross_comm,
+                   d_tx_cross_local_counts.begin(),
+                   std::vector<size_t>(num_nodes, static_cast<size_t>(local_size)),
+                   stream_view);
+  std::vector<size_t> rx_cross_local_counts(d_rx_cross_local_counts.size());
+  raft::update_host(rx_cross_local_counts.data(),
+                    d_rx_cross_local_counts.data(),
+                    d_rx_cross_local_counts.size(),
+                    stream_view);
+
+  auto [rx_values, rx_cross_counts] = shuffle_values(
+    node_cross_comm, get_dataframe_buffer_begin(tx_cross_values), tx_cross_counts, stream_view);
+  resize_dataframe_buffer(tx_cross_values, 0, stream_view);
+  shrink_to_fit_dataframe_buffer(tx_cross_values, stream_view);
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view));
+
+  // 3. received values are grouped by (source node, source local rank), re-group by comm rank
+
+  std::vector<size_t> rx_counts(comm_size);
+  bool node_major_ranks{true};
+  for (int r = 0; r < comm_size; ++r) {
+    rx_counts[r] = rx_cross_local_counts[node_local_ids[r]];
+    if (node_local_ids[r] != r) { node_major_ranks = false; }
+  }
+  if (!node_major_ranks) {
+    std::vector<size_t> rx_offsets(comm_size);
+    std::exclusive_scan(rx_cross_local_counts.begin(),
+                        rx_cross_local_counts.end(),
+                        rx_offsets.begin(),
+                        size_t{0});
+    std::vector<size_t> rx_order(comm_size);
+    for (int r = 0; r < comm_size; ++r) {
+      rx_order[r] = node_local_ids[r];
+    }
+    rx_values = detail::permute_segments(get_dataframe_buffer_begin(rx_values),
+                                         rx_offsets,
+                                         rx_cross_local_counts,
+                                         rx_order,
+                                         stream_view);
+  }
+
+  return std::make_tuple(std::move(rx_values), rx_counts);
+}
+
 // Add gaps in the receive buffer to enforce that the sent data offset and the received data offset
 // have the same alignment for every rank. This is faster assuming that @p alignment ensures cache
 // line alignment in both send & receive buffer (tested with NCCL 2.23.4)
@@ -887,6 +1110,8 @@ auto shuffle_values(
 {
   using value_t = typename thrust::iterator_traits<TxValueIterator>::value_type;
 
+  prim_profile_range_t profile_range(stream_view, "shuffle_values");
+
   auto const comm_size = comm.get_size();
 
   std::vector<size_t> tx_value_displacements(tx_value_counts.size());
@@ -914,6 +1139,12 @@ auto shuffle_values(
     tx_aligned_counts[i]        = tx_value_counts[i] - tx_unaligned_counts[i];
     tx_aligned_displacements[i] = tx_value_displacements[i] + tx_unaligned_counts[i];
   }
+  if (profile_range.is_enabled()) {
+    profile_range.add_bytes_communicated(
+      (std::reduce(tx_value_counts.begin(), tx_value_counts.end()) -
+       tx_value_counts[comm.get_rank()]) *
+      sizeof(value_t));
+  }
 
   rmm::device_uvector<size_t> d_tx_unaligned_counts(tx_unaligned_counts.size(), stream_view);
   rmm::device_uvector<size_t> d_tx_aligned_counts(tx_aligned_counts.size(), stream_view);
@@ -1110,6 +1341,8 @@ auto groupby_gpu_id_and_shuffle_values(raft::comms::comms_t const& comm,
                                        ValueToGPUIdOp value_to_gpu_id_op,
                                        rmm::cuda_stream_view stream_view)
 {
+  prim_profile_range_t profile_range(stream_view, "groupby_gpu_id_and_shuffle_values");
+
   auto const comm_size = comm.get_size();
 
   auto d_tx_value_counts = groupby_and_count(tx_value_first,
@@ -1127,6 +1360,11 @@ auto groupby_gpu_id_and_shuffle_values(raft::comms::comms_t const& comm,
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
     detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, true, stream_view);
+  if (profile_range.is_enabled()) {
+    profile_range.add_bytes_communicated(
+      detail::count_remote_tx_elements(comm.get_rank(), tx_counts, tx_dst_ranks) *
+      sizeof(typename thrust::iterator_traits<ValueIterator>::value_type));
+  }
 
   auto rx_value_buffer =
     allocate_dataframe_buffer<typename thrust::iterator_traits<ValueIterator>::value_type>(
@@ -1163,6 +1401,8 @@ auto groupby_gpu_id_and_shuffle_kv_pairs(raft::comms::comms_t const& comm,
                                          KeyToGPUIdOp key_to_gpu_id_op,
                                          rmm::cuda_stream_view stream_view)
 {
+  prim_profile_range_t profile_range(stream_view, "groupby_gpu_id_and_shuffle_kv_pairs");
+
   auto const comm_size = comm.get_size();
 
   auto d_tx_value_counts = groupby_and_count(tx_key_first,
@@ -1181,6 +1421,12 @@ auto groupby_gpu_id_and_shuffle_kv_pairs(raft::comms::comms_t const& comm,
   std::vector<int> rx_src_ranks{};
   std::tie(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks) =
     detail::compute_tx_rx_counts_offsets_ranks(comm, d_tx_value_counts, true, stream_view);
+  if (profile_range.is_enabled()) {
+    profile_range.add_bytes_communicated(
+      detail::count_remote_tx_elements(comm.get_rank(), tx_counts, tx_dst_ranks) *
+      (sizeof(typename thrust::iterator_traits<VertexIterator>::value_type) +
+       sizeof(typename thrust::iterator_traits<ValueIterator>::value_type)));
+  }
 
   rmm::device_uvector<typename thrust::iterator_traits<VertexIterator>::value_type> rx_keys(
     rx_offsets.size() > 0 ? rx_offsets.back() + rx_counts.back() : size_t{0}, stream_view);
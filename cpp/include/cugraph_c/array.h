@@ -330,6 +330,81 @@ cugraph_error_code_t cugraph_type_erased_device_array_view_copy(
   const cugraph_type_erased_device_array_view_t* src,
   cugraph_error_t** error);
 
+/*
+ * Zero-copy interoperability with other libraries (e.g. through DLPack or
+ * __cuda_array_interface__).  Streams are passed as integers following the
+ * __cuda_array_interface__ convention: 0 means no synchronization is required, 1 is the legacy
+ * default stream, 2 is the per-thread default stream and any other value is a cudaStream_t.
+ */
+
+/**
+ * @brief    Create a type erased device array view of memory produced on another stream
+ *
+ * No data is copied, the caller retains ownership of @p pointer.  Work issued on the stream of
+ * @p handle is ordered after the work already issued on @p stream, so the view can be used
+ * without synchronizing the host.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  pointer     Pointer to the device memory
+ * @param [in]  n_elems     The number of elements in the array
+ * @param [in]  dtype       The type of the array
+ * @param [in]  stream      Stream the memory was produced on
+ * @param [out] view        Pointer to the location to store the pointer to the view
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_view_create_from_stream(
+  const cugraph_resource_handle_t* handle,
+  void* pointer,
+  size_t n_elems,
+  cugraph_data_type_id_t dtype,
+  uintptr_t stream,
+  cugraph_type_erased_device_array_view_t** view,
+  cugraph_error_t** error);
+
+/**
+ * @brief    Make a type erased device array view consumable on another stream
+ *
+ * Work issued on @p stream is ordered after the work already issued on the stream of @p handle
+ * (which produced the data of @p view), so the memory of the view can be wrapped by the consumer
+ * (e.g. exported as a DLPack tensor) instead of being copied into a consumer-owned array.  The
+ * array owning the memory must outlive the consumer's use, freeing it with
+ * cugraph_type_erased_device_array_free_on_stream is safe while work on @p stream is pending.
+ * If @p stream is 0 the stream of @p handle is synchronized instead.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  view        Type erased device array view
+ * @param [in]  stream      Stream the consumer will access the memory on
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_view_export_to_stream(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* view,
+  uintptr_t stream,
+  cugraph_error_t** error);
+
+/**
+ * @brief    Destroy a type erased device array after the work issued on another stream
+ *
+ * The memory is released in the order of the stream of @p handle, after the work already issued
+ * on @p stream.  Intended for the deleter of an exported array.
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  array       Pointer to the type erased device array
+ * @param [in]  stream      Stream the consumer accessed the memory on
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_free_on_stream(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  uintptr_t stream,
+  cugraph_error_t** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -332,6 +332,41 @@ cugraph_error_code_t cugraph_eigenvector_centrality(const cugraph_resource_handl
                                                     cugraph_centrality_result_t** result,
                                                     cugraph_error_t** error);
 
+/**
+ * @brief     Compute eigenvector centrality starting from an initial guess (warm start)
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  graph       Pointer to graph
+ * @param [in]  initial_guess_vertices
+ *                          Optional device array of vertices to warm start from their
+ *                          centralities (e.g. the result of a previous call on a graph with a
+ *                          different renumbering). Vertices not listed start from 0. If NULL,
+ *                          every vertex starts from the same value.
+ * @param [in]  initial_guess_values
+ *                          Optional device array of the initial centralities of
+ *                          initial_guess_vertices (NULL if initial_guess_vertices is NULL)
+ * @param [in]  epsilon     Error tolerance to check convergence. Convergence is measured
+ *                          comparing the L1 norm until it is less than epsilon
+ * @param [in]  max_iterations Maximum number of power iterations, will not exceed this number
+ *                          of iterations even if we haven't converged
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result      Opaque pointer to eigenvector centrality results
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_eigenvector_centrality_with_initial_guess(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_guess_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_guess_values,
+  double epsilon,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_centrality_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Compute katz centrality
  *
@@ -368,6 +403,49 @@ cugraph_error_code_t cugraph_katz_centrality(const cugraph_resource_handle_t* ha
                                              cugraph_centrality_result_t** result,
                                              cugraph_error_t** error);
 
+/**
+ * @brief     Compute katz centrality starting from an initial guess (warm start)
+ *
+ * @param [in]  handle      Handle for accessing resources
+ * @param [in]  graph       Pointer to graph
+ * @param [in]  betas       Optionally send in a device array holding values to be added to
+ *                          each vertex's new Katz Centrality score in every iteration.
+ *                          If set to NULL then @p beta is used for all vertices.
+ * @param [in]  initial_guess_vertices
+ *                          Optional device array of vertices to warm start from their
+ *                          centralities (e.g. the result of a previous call on a graph with a
+ *                          different renumbering). Vertices not listed start from 0. If NULL,
+ *                          every vertex starts from 0.
+ * @param [in]  initial_guess_values
+ *                          Optional device array of the initial centralities of
+ *                          initial_guess_vertices (NULL if initial_guess_vertices is NULL)
+ * @param [in]  alpha       Katz centrality attenuation factor.
+ * @param [in]  beta        Constant value to be added to each vertex's new Katz
+ *                          Centrality score in every iteration.  Relevant only when
+ *                          @p betas is NULL
+ * @param [in]  epsilon     Error tolerance to check convergence.
+ * @param [in]  max_iterations Maximum number of Katz Centrality iterations.
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result      Opaque pointer to katz centrality results
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_katz_centrality_with_initial_guess(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* betas,
+  const cugraph_type_erased_device_array_view_t* initial_guess_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_guess_values,
+  double alpha,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_centrality_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Compute betweenness centrality
  *
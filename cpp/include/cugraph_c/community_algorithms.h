@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cugraph_c/error.h>
 #include <cugraph_c/graph.h>
 #include <cugraph_c/graph_functions.h>
+#include <cugraph_c/labeling_algorithms.h>
 #include <cugraph_c/random.h>
 #include <cugraph_c/resource_handle.h>
 
@@ -115,6 +116,43 @@ cugraph_error_code_t cugraph_louvain(const cugraph_resource_handle_t* handle,
                                      cugraph_hierarchical_clustering_result_t** result,
                                      cugraph_error_t** error);
 
+/**
+ * @brief     Compute Louvain starting from an initial clustering (warm start)
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  initial_cluster_vertices
+ *                           Optional device array of vertices to warm start from their clusters
+ *                           (e.g. the result of a previous call on a graph with a different
+ *                           renumbering). Vertices not listed start in singleton clusters. If
+ *                           NULL, every vertex starts in a singleton cluster.
+ * @param [in]  initial_clusters
+ *                           Optional device array of the initial cluster IDs of
+ *                           initial_cluster_vertices (NULL if initial_cluster_vertices is NULL).
+ *                           Cluster IDs can be arbitrary values of the vertex type.
+ * @param [in]  max_level    Maximum level in hierarchy
+ * @param [in]  threshold    Threshold parameter, defines convergence at each level of hierarchy
+ * @param [in]  resolution   Resolution parameter (gamma) in modularity formula.
+ * @param [in]  do_expensive_check
+ *                           A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] result       Output from the Louvain call
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_louvain_with_initial_clustering(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_cluster_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_clusters,
+  size_t max_level,
+  double threshold,
+  double resolution,
+  bool_t do_expensive_check,
+  cugraph_hierarchical_clustering_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Compute Leiden
  *
@@ -148,6 +186,46 @@ cugraph_error_code_t cugraph_leiden(const cugraph_resource_handle_t* handle,
                                     cugraph_hierarchical_clustering_result_t** result,
                                     cugraph_error_t** error);
 
+/**
+ * @brief     Compute Leiden starting from an initial clustering (warm start)
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in,out] rng_state State of the random number generator, updated with each call
+ * @param [in]  graph        Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                           needs to be transposed
+ * @param [in]  initial_cluster_vertices
+ *                           Optional device array of vertices to warm start from their clusters
+ *                           (e.g. the result of a previous call on a graph with a different
+ *                           renumbering). Vertices not listed start in singleton clusters. If
+ *                           NULL, every vertex starts in a singleton cluster.
+ * @param [in]  initial_clusters
+ *                           Optional device array of the initial cluster IDs of
+ *                           initial_cluster_vertices (NULL if initial_cluster_vertices is NULL).
+ *                           Cluster IDs can be arbitrary values of the vertex type.
+ * @param [in]  max_level    Maximum level in hierarchy
+ * @param [in]  resolution   Resolution parameter (gamma) in modularity formula.
+ * @param [in]  theta        The value of the parameter to scale modularity gain in Leiden
+ *                           refinement phase.
+ * @param [in]  do_expensive_check
+ *                           A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] result       Output from the Leiden call
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_leiden_with_initial_clustering(
+  const cugraph_resource_handle_t* handle,
+  cugraph_rng_state_t* rng_state,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_cluster_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_clusters,
+  size_t max_level,
+  double resolution,
+  double theta,
+  bool_t do_expensive_check,
+  cugraph_hierarchical_clustering_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @ingroup community
  * @brief     Get hierarchical clustering vertices
@@ -212,6 +290,46 @@ cugraph_error_code_t cugraph_ecg(const cugraph_resource_handle_t* handle,
                                  cugraph_hierarchical_clustering_result_t** result,
                                  cugraph_error_t** error);
 
+/**
+ * @brief     Compute label propagation clustering
+ *
+ * Every vertex repeatedly adopts the label with the largest sum of edge weights among its
+ * neighbors' labels till no vertex changes its label. The graph should be symmetric.
+ *
+ * @param [in]  handle        Handle for accessing resources
+ * @param [in,out] rng_state  State of the random number generator, updated with each call
+ * @param [in]  graph         Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                            needs to be transposed
+ * @param [in]  initial_label_vertices
+ *                            Optional device array of vertices to warm start from their labels
+ *                            (e.g. the result of a previous call). Should list every vertex if
+ *                            set. If NULL, every vertex starts with its own label.
+ * @param [in]  initial_labels
+ *                            Optional device array of the initial labels of
+ *                            initial_label_vertices (NULL if initial_label_vertices is NULL)
+ * @param [in]  semi_synchronous
+ *                            If true, update one color class of a vertex coloring at a time (more
+ *                            stable), otherwise update all the vertices at once
+ * @param [in]  max_iterations Maximum number of sweeps over the vertices
+ * @param [in]  do_expensive_check
+ *                            A flag to run expensive checks for input arguments (if set to true)
+ * @param [out] result        Opaque object containing the vertex labels
+ * @param [out] error         Pointer to an error object storing details of any error.  Will
+ *                            be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_label_propagation(
+  const cugraph_resource_handle_t* handle,
+  cugraph_rng_state_t* rng_state,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_label_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_labels,
+  bool_t semi_synchronous,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_labeling_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief   Extract ego graphs
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -134,6 +134,45 @@ cugraph_error_code_t cugraph_graph_create_sg_from_csr(
   cugraph_graph_t** graph,
   cugraph_error_t** error);
 
+/**
+ * @brief     Construct an SG graph referencing a caller-owned CSR without copying it
+ *
+ * Unlike cugraph_graph_create_sg_from_csr, the offsets and indices are neither copied nor
+ * renumbered: the graph references the caller's device memory, which must remain valid and
+ * unmodified until the graph is freed.  The vertices must be 0 to the number of offsets - 2.
+ * The edge weights (if any) are still copied.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  properties     Properties of the constructed graph
+ * @param [in]  offsets        Device array containing the CSR offsets array
+ * @param [in]  indices        Device array containing the destination vertex ids
+ * @param [in]  weights        Device array containing the edge weights.  Note that an unweighted
+ *                             graph can be created by passing weights == NULL.
+ * @param [in]  store_transposed If true the arrays are a CSC (offsets over destinations, indices
+ *                             are source vertex ids)
+ * @param [in]  sorted_by_degree If true the vertices are sorted by degree (non-ascending), as
+ *    cuGraph's renumbering would order them, which enables the degree-segmented kernels of the
+ *    graph primitives.
+ * @param [in]  do_expensive_check    If true, do expensive checks to validate the input data
+ *    is consistent with software assumptions.  If false bypass these checks.
+ * @param [out] graph          A pointer to the graph object
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not CUGRAPH_SUCCESS
+ *
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_create_sg_view_from_csr(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_graph_properties_t* properties,
+  const cugraph_type_erased_device_array_view_t* offsets,
+  const cugraph_type_erased_device_array_view_t* indices,
+  const cugraph_type_erased_device_array_view_t* weights,
+  bool_t store_transposed,
+  bool_t sorted_by_degree,
+  bool_t do_expensive_check,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error);
+
 /**
  * @brief     Construct an MG graph
  *
@@ -200,10 +239,41 @@ cugraph_error_code_t cugraph_graph_create_mg(
 /**
  * @brief     Destroy an graph
  *
+ * Graphs are read-only once created, so multiple host threads can run algorithms (e.g. BFS or
+ * sampling) concurrently on the same graph, each with its own resource handle (see
+ * cugraph_resource_handle_clone).  The exception is the conversion of the storage format (see
+ * cugraph_graph_set_cache_transposed_storage), which changes the graph, so concurrent calls on
+ * the same graph should all require the storage format the graph is currently in.  The graph
+ * should not be freed while calls using it are in flight.
+ *
  * @param [in]  graph  A pointer to the graph object to destroy
  */
 void cugraph_graph_free(cugraph_graph_t* graph);
 
+/**
+ * @brief     Keep both storage formats of a graph
+ *
+ * Algorithms require the graph to be stored either by source (e.g. BFS, sampling) or by
+ * destination (e.g. PageRank, Katz, HITS), and convert the storage of the graph when it does not
+ * match.  By default the conversion replaces the graph, so a workload mixing both kinds of
+ * algorithms converts the graph back and forth.  If caching is enabled, the first conversion keeps
+ * the original storage alongside the converted one, and every later conversion is free.  This
+ * doubles the memory footprint of the graph.
+ *
+ * Not supported for graphs with edge ids or edge types.
+ *
+ * @param [in]  graph  A pointer to the graph object
+ * @param [in]  cache_transposed_storage  If true, keep both storage formats once the graph has
+ *                                        been converted.  If false, release the cached storage
+ *                                        format (if any)
+ * @param [out] error  Pointer to an error object storing details of any error.  Will
+ *                     be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_set_cache_transposed_storage(cugraph_graph_t* graph,
+                                                               bool_t cache_transposed_storage,
+                                                               cugraph_error_t** error);
+
 /**
  * @brief     Create a data mask
  *
@@ -218,6 +218,28 @@ cugraph_error_code_t cugraph_extract_induced_subgraph(
   cugraph_induced_subgraph_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief      Find the edges of a minimum spanning forest
+ *
+ * Runs Borůvka's algorithm on a symmetric weighted graph. Each undirected edge of the forest is
+ * returned once. The result uses the induced subgraph result type with a single subgraph.
+ *
+ * @param [in]  handle            Handle for accessing resources
+ * @param [in]  graph             Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                                needs to be transposed
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result            Opaque pointer to the minimum spanning forest edges
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_minimum_spanning_forest(const cugraph_resource_handle_t* handle,
+                                                     cugraph_graph_t* graph,
+                                                     bool_t do_expensive_check,
+                                                     cugraph_induced_subgraph_result_t** result,
+                                                     cugraph_error_t** error);
+
 // FIXME: Rename the return type
 /**
  * @brief      Gather edgelist
@@ -245,6 +267,76 @@ cugraph_error_code_t cugraph_allgather(const cugraph_resource_handle_t* handle,
                                        cugraph_induced_subgraph_result_t** result,
                                        cugraph_error_t** error);
 
+/**
+ * @brief      Compute the size of an array gathered from all ranks
+ *
+ * Use this to size the output buffer of cugraph_allgather_to_buffer and cugraph_gather_to_buffer.
+ *
+ * @param [in]  handle            Handle for accessing resources.
+ * @param [in]  input             Device array to gather (the local part on this rank).
+ * @param [out] gathered_size     Sum of the @p input sizes over the ranks.
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_allgather_size(const cugraph_resource_handle_t* handle,
+                                            const cugraph_type_erased_device_array_view_t* input,
+                                            size_t* gathered_size,
+                                            cugraph_error_t** error);
+
+/**
+ * @brief      Gather an array from all ranks into a caller-provided buffer on every rank
+ *
+ * Unlike cugraph_allgather, the combined array is not materialized in device memory. The array is
+ * gathered in rounds of up to @p max_chunk_size elements per rank through a device staging buffer
+ * and copied to @p output, so @p output can be host memory (pinned host memory is recommended).
+ * The function returns after the copies to @p output are complete. Supports INT32, INT64, FLOAT32
+ * and FLOAT64 arrays.
+ *
+ * @param [in]  handle            Handle for accessing resources.
+ * @param [in]  input             Device array to gather (the local part on this rank).
+ * @param [in]  max_chunk_size    Maximum number of elements gathered from each rank in a round.
+ * @param [out] output            Device or host buffer of the @p input type to store the gathered
+ *                                array (in rank order).
+ * @param [in]  output_size       Number of elements @p output can hold, should be at least the
+ *                                size returned by cugraph_allgather_size.
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_allgather_to_buffer(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* input,
+  size_t max_chunk_size,
+  void* output,
+  size_t output_size,
+  cugraph_error_t** error);
+
+/**
+ * @brief      Gather an array from all ranks into a caller-provided buffer on the root rank
+ *
+ * Same as cugraph_allgather_to_buffer, but only @p root receives the gathered array.
+ *
+ * @param [in]  handle            Handle for accessing resources.
+ * @param [in]  input             Device array to gather (the local part on this rank).
+ * @param [in]  root              Rank receiving the gathered array.
+ * @param [in]  max_chunk_size    Maximum number of elements gathered from each rank in a round.
+ * @param [out] output            Device or host buffer of the @p input type to store the gathered
+ *                                array (in rank order). Ignored (can be NULL) on the other ranks.
+ * @param [in]  output_size       Number of elements @p output can hold, should be at least the
+ *                                size returned by cugraph_allgather_size on @p root.
+ * @param [out] error             Pointer to an error object storing details of any error.  Will
+ *                                be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_gather_to_buffer(const cugraph_resource_handle_t* handle,
+                                              const cugraph_type_erased_device_array_view_t* input,
+                                              int root,
+                                              size_t max_chunk_size,
+                                              void* output,
+                                              size_t output_size,
+                                              cugraph_error_t** error);
+
 /**
  * @brief      Count multi_edges
  *
@@ -377,6 +469,106 @@ cugraph_type_erased_device_array_view_t* cugraph_degrees_result_get_out_degrees(
  */
 void cugraph_degrees_result_free(cugraph_degrees_result_t* degrees_result);
 
+/**
+ * @brief       Opaque runtime-compiled edge operator result type
+ */
+typedef struct {
+  int32_t align_;
+} cugraph_jit_edge_op_result_t;
+
+/**
+ * @brief      Sum a user-defined edge operator over the outgoing edges of every vertex
+ *
+ * The edge operator is CUDA C++ source defining
+ *
+ *   __device__ double edge_op(long long src, long long dst, double weight);
+ *
+ * The source is compiled at runtime (with NVRTC) on the first call and the compiled kernel is
+ * cached (by the source and the vertex, edge, and weight types of the graph) for the later calls.
+ * src and dst are the internal (renumbered) vertex ids of the edge, and weight is 1.0 if the graph
+ * is unweighted. The source is compiled without any header, the edge operator should be a
+ * side-effect free function of its arguments.
+ *
+ * See cugraph_jit_reduce_outgoing_edge_op for other reduction operators and
+ * cugraph_jit_transform_edge_op for per-edge outputs. Frontier expansion is not runtime-compiled.
+ *
+ * @param [in]  handle              Handle for accessing resources.
+ * @param [in]  graph               Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                                  needs to be transposed
+ * @param [in]  edge_op_source      Null terminated CUDA C++ source defining edge_op
+ * @param [in]  do_expensive_check  A flag to run expensive checks for input arguments (if set to
+ * true)
+ * @param [out] result              Opaque pointer to the result
+ * @param [out] error               Pointer to an error object storing details of any error.  Will
+ *                                  be populated if error code is not CUGRAPH_SUCCESS (including
+ *                                  the compiler log if the source does not compile)
+ * @return error code
+ */
+cugraph_error_code_t cugraph_jit_sum_outgoing_edge_op(const cugraph_resource_handle_t* handle,
+                                                      cugraph_graph_t* graph,
+                                                      const char* edge_op_source,
+                                                      bool_t do_expensive_check,
+                                                      cugraph_jit_edge_op_result_t** result,
+                                                      cugraph_error_t** error);
+
+/**
+ * @brief      Reduce a user-defined edge operator over the outgoing edges of every vertex with a
+ *             user-defined reduction operator
+ *
+ * Same as cugraph_jit_sum_outgoing_edge_op, but the source also defines
+ *
+ *   __device__ double reduce_op(double a, double b);
+ *
+ * which should be associative and commutative (the reduction order is not specified).  Vertices
+ * without an outgoing edge get @p init.
+ *
+ * @param [in]  handle              Handle for accessing resources.
+ * @param [in]  graph               Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                                  needs to be transposed
+ * @param [in]  edge_op_source      Null terminated CUDA C++ source defining edge_op and reduce_op
+ * @param [in]  init                Identity element of reduce_op (e.g. 0 for a sum, -infinity for
+ *                                  a maximum)
+ * @param [in]  do_expensive_check  A flag to run expensive checks for input arguments (if set to
+ * true)
+ * @param [out] result              Opaque pointer to the result
+ * @param [out] error               Pointer to an error object storing details of any error.  Will
+ *                                  be populated if error code is not CUGRAPH_SUCCESS (including
+ *                                  the compiler log if the source does not compile)
+ * @return error code
+ */
+cugraph_error_code_t cugraph_jit_reduce_outgoing_edge_op(const cugraph_resource_handle_t* handle,
+                                                         cugraph_graph_t* graph,
+                                                         const char* edge_op_source,
+                                                         double init,
+                                                         bool_t do_expensive_check,
+                                                         cugraph_jit_edge_op_result_t** result,
+                                                         cugraph_error_t** error);
+
+/**
+ * @brief       Get the vertex ids
+ *
+ * @param [in]     result   Opaque pointer to the edge operator result
+ * @return type erased array view of vertex ids
+ */
+cugraph_type_erased_device_array_view_t* cugraph_jit_edge_op_result_get_vertices(
+  cugraph_jit_edge_op_result_t* result);
+
+/**
+ * @brief       Get the sums of the edge operator outputs (FLOAT64)
+ *
+ * @param [in]     result   Opaque pointer to the edge operator result
+ * @return type erased array view of the sums
+ */
+cugraph_type_erased_device_array_view_t* cugraph_jit_edge_op_result_get_values(
+  cugraph_jit_edge_op_result_t* result);
+
+/**
+ * @brief     Free the edge operator result
+ *
+ * @param [in]    result   Opaque pointer to the edge operator result
+ */
+void cugraph_jit_edge_op_result_free(cugraph_jit_edge_op_result_t* result);
+
 /**
  * @brief       Opaque edgelist type
  *
@@ -463,6 +655,33 @@ cugraph_error_code_t cugraph_decompress_to_edgelist(const cugraph_resource_handl
                                                     cugraph_edgelist_t** result,
                                                     cugraph_error_t** error);
 
+/**
+ * @brief      Evaluate a user-defined edge operator on every edge
+ *
+ * The edge operator source is the same as in cugraph_jit_sum_outgoing_edge_op (and is compiled
+ * and cached the same way).  The result is the edge list of the graph (as in
+ * cugraph_decompress_to_edgelist) with edge_op(src, dst, weight) in place of the edge weights
+ * (FLOAT64, use cugraph_edgelist_get_edge_weights to access them).
+ *
+ * @param [in]  handle              Handle for accessing resources.
+ * @param [in]  graph               Pointer to graph.  NOTE: Graph might be modified if the storage
+ *                                  needs to be transposed
+ * @param [in]  edge_op_source      Null terminated CUDA C++ source defining edge_op
+ * @param [in]  do_expensive_check  A flag to run expensive checks for input arguments (if set to
+ * true)
+ * @param [out] result              Opaque pointer to the edge list
+ * @param [out] error               Pointer to an error object storing details of any error.  Will
+ *                                  be populated if error code is not CUGRAPH_SUCCESS (including
+ *                                  the compiler log if the source does not compile)
+ * @return error code
+ */
+cugraph_error_code_t cugraph_jit_transform_edge_op(const cugraph_resource_handle_t* handle,
+                                                   cugraph_graph_t* graph,
+                                                   const char* edge_op_source,
+                                                   bool_t do_expensive_check,
+                                                   cugraph_edgelist_t** result,
+                                                   cugraph_error_t** error);
+
 /**
  * @brief     Renumber arbitrary edgelist
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,6 +75,294 @@ int cugraph_resource_handle_get_rank(const cugraph_resource_handle_t* handle);
  */
 void cugraph_free_resource_handle(cugraph_resource_handle_t* handle);
 
+/**
+ * @brief     Make calls using the resource handle stream-ordered on a caller-provided stream
+ *
+ * Subsequent calls using this resource handle enqueue their device work on @p stream, and
+ * the device results they return become valid once @p stream reaches them, so the caller can
+ * overlap them with other work.  Calls only block the host where they need device values on the
+ * host (e.g. to size an output), and cugraph_type_erased_device_array_view_copy_to_host does not
+ * synchronize @p stream, the caller needs to synchronize it before reading the host array.
+ *
+ * If the resource handle was created from a caller-provided raft handle, the stream of that raft
+ * handle is changed as well.  Passing 0 restores the original stream and the default behavior.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  stream          cudaStream_t (cast to an integer) to order the calls on, or 0
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_set_stream(cugraph_resource_handle_t* handle,
+                                                        uintptr_t stream,
+                                                        cugraph_error_t** error);
+
+/**
+ * @brief     Create a resource handle sharing the resources of another resource handle but
+ * running on its own stream
+ *
+ * The clone shares the device resources (e.g. the memory resource, the stream pool and the
+ * communicators) of @p handle, but calls using the clone run on @p stream (or on a new stream
+ * created for the clone and destroyed with it).  This waits for the work already enqueued on the
+ * stream of @p handle (e.g. creating the graph), later work on the two streams is not ordered.  A
+ * resource handle (like cugraph_resource_handle_set_stream) serves one caller at a time, so
+ * concurrent calls from multiple host threads should use one clone per thread.  Concurrent calls
+ * using different clones can share the same graph (see cugraph_graph_free for the thread safety of
+ * graphs).  The clone does not inherit the progress callback of @p handle, and should be freed
+ * (with cugraph_free_resource_handle) before @p handle.
+ *
+ * Multi-GPU clones share the communicators of @p handle, and collective calls on a communicator
+ * should be issued in the same order on every rank, so multi-GPU algorithms should not run
+ * concurrently on clones of the same handle.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  stream          cudaStream_t (cast to an integer) the clone runs on, or 0 to
+ *                              create a stream for the clone
+ * @param [out] clone           Pointer to the cloned resource handle
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_clone(const cugraph_resource_handle_t* handle,
+                                                   uintptr_t stream,
+                                                   cugraph_resource_handle_t** clone,
+                                                   cugraph_error_t** error);
+
+/**
+ * @brief     Shape of the 2D GPU partitioning
+ *
+ * CUGRAPH_PARTITION_SHAPE_SQUARE makes the GPU grid as square as possible.
+ * CUGRAPH_PARTITION_SHAPE_GPU_ROW_COMM_PER_NODE makes each GPU row (a set of consecutive ranks)
+ * consist of the GPUs of one node, which keeps the GPU row communication on the intra-node
+ * interconnect if the ranks of each node are consecutive.
+ */
+typedef enum cugraph_partition_shape_ {
+  CUGRAPH_PARTITION_SHAPE_SQUARE = 0,
+  CUGRAPH_PARTITION_SHAPE_GPU_ROW_COMM_PER_NODE
+} cugraph_partition_shape_t;
+
+/**
+ * @brief     (Re-)create the 2D partitioning sub-communicators of a multi-GPU resource handle
+ *
+ * Multi-GPU graphs are partitioned based on the sub-communicators of the resource handle, so this
+ * should be called before creating graphs (graphs created with the previous sub-communicators
+ * should not be used afterwards). This is a collective call.
+ *
+ * @param [in]  handle             Handle for accessing resources
+ * @param [in]  shape              Partition shape policy
+ * @param [in]  num_gpus_per_node  Number of GPUs per node (relevant only if @p shape is
+ *                                 CUGRAPH_PARTITION_SHAPE_GPU_ROW_COMM_PER_NODE, the comm size
+ *                                 should be a multiple of this value)
+ * @param [out] error              Pointer to an error object storing details of any error.  Will
+ *                                 be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_init_subcomms(const cugraph_resource_handle_t* handle,
+                                                           cugraph_partition_shape_t shape,
+                                                           int num_gpus_per_node,
+                                                           cugraph_error_t** error);
+
+/**
+ * @brief     Metrics of a completed iteration passed to the progress callback
+ *
+ * Louvain and Leiden report every completed level (iteration is the number of completed levels,
+ * frontier_size is the number of vertices in the coarsened graph). PageRank reports every
+ * iteration (residual is the sum of the PageRank value changes). Betweenness centrality reports
+ * every batch of sources (iteration is the number of processed sources, frontier_size is the
+ * number of sources still to process). Metrics an algorithm does not track are NaN (or 0 for
+ * frontier_size).
+ */
+typedef struct {
+  const char* algorithm;
+  size_t iteration;
+  double modularity;
+  double residual;
+  size_t frontier_size;
+} cugraph_progress_t;
+
+/**
+ * @brief     Progress callback type, returning TRUE requests early termination
+ */
+typedef bool_t (*cugraph_progress_callback_t)(const cugraph_progress_t* progress, void* user_data);
+
+/**
+ * @brief     Set the callback receiving the per-iteration progress of the algorithms called with
+ * the resource handle
+ *
+ * The callback is invoked on the host after every reported iteration (see cugraph_progress_t) and
+ * can stop the algorithm by returning TRUE. A stopped algorithm returns the results of the
+ * completed iterations: Louvain and Leiden return the clustering of the completed levels,
+ * PageRank returns the current values (and fails if it is required to converge), and betweenness
+ * centrality returns the centralities estimated from the processed sources.  In multi-GPU, the
+ * callback should be set on every rank, and the algorithm stops if the callback on any rank
+ * returns TRUE.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  callback        Progress callback, NULL to remove the callback
+ * @param [in]  user_data       Pointer passed to every invocation of @p callback
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_set_progress_callback(
+  const cugraph_resource_handle_t* handle,
+  cugraph_progress_callback_t callback,
+  void* user_data,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Opaque primitive profile report type
+ */
+typedef struct {
+  int32_t align_;
+} cugraph_prim_profile_report_t;
+
+/**
+ * @brief     Enable or disable per-primitive profiling
+ *
+ * If enabled, the instrumented graph primitives (and shuffles) record their number of calls, wall
+ * time, bytes sent to the other GPUs, and edges visited. Measuring wall time requires
+ * synchronizing the stream at every primitive entry and exit, so this should be enabled only for
+ * performance analysis. The statistics are collected per process (i.e. they are shared by every
+ * resource handle in the process).
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  enable          If TRUE, enable profiling, if FALSE, disable profiling
+ */
+void cugraph_resource_handle_enable_prim_profiling(const cugraph_resource_handle_t* handle,
+                                                   bool_t enable);
+
+/**
+ * @brief     Enable or disable the two-level shuffle
+ *
+ * If enabled, edge list shuffles (e.g. in graph creation) first exchange data inside each node and
+ * then send one fused message per remote node instead of exchanging data directly between every
+ * pair of GPUs. This reduces the number of inter-node messages on multi-node clusters. The
+ * two-level shuffle is used only if there are multiple nodes and every node has the same number
+ * (greater than one) of GPUs. This is a collective call.
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  enable          If TRUE, enable the two-level shuffle, if FALSE, disable it
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_enable_hierarchical_shuffle(
+  const cugraph_resource_handle_t* handle, bool_t enable, cugraph_error_t** error);
+
+/**
+ * @brief     Get the per-primitive profile report collected so far
+ *
+ * @param [in]  handle          Handle for accessing resources
+ * @param [in]  clear           If TRUE, clear the collected statistics after building the report
+ * @param [out] report          Opaque pointer to the profile report
+ * @param [out] error           Pointer to an error object storing details of any error.  Will
+ *                              be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_resource_handle_get_prim_profile_report(
+  const cugraph_resource_handle_t* handle,
+  bool_t clear,
+  cugraph_prim_profile_report_t** report,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Get the number of primitives in the profile report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @return number of primitives (records are sorted by primitive name)
+ */
+size_t cugraph_prim_profile_report_get_size(const cugraph_prim_profile_report_t* report);
+
+/**
+ * @brief     Get the name of the i'th primitive in the profile report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return primitive name (valid until the report is freed)
+ */
+const char* cugraph_prim_profile_report_get_name(const cugraph_prim_profile_report_t* report,
+                                                 size_t i);
+
+/**
+ * @brief     Get the number of calls of the i'th primitive in the profile report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return number of calls
+ */
+size_t cugraph_prim_profile_report_get_num_calls(const cugraph_prim_profile_report_t* report,
+                                                 size_t i);
+
+/**
+ * @brief     Get the accumulated wall time (in seconds) of the i'th primitive in the profile
+ * report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return wall time in seconds (including the time spent in nested instrumented primitives)
+ */
+double cugraph_prim_profile_report_get_elapsed_seconds(const cugraph_prim_profile_report_t* report,
+                                                       size_t i);
+
+/**
+ * @brief     Get the accumulated bytes sent to the other GPUs by the i'th primitive in the profile
+ * report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return bytes communicated
+ */
+size_t cugraph_prim_profile_report_get_bytes_communicated(
+  const cugraph_prim_profile_report_t* report, size_t i);
+
+/**
+ * @brief     Get the accumulated number of edges visited by the i'th primitive in the profile
+ * report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return edges touched (0 if the primitive does not track visited edges)
+ */
+size_t cugraph_prim_profile_report_get_edges_touched(const cugraph_prim_profile_report_t* report,
+                                                     size_t i);
+
+/**
+ * @brief     Get the accumulated number of host synchronizations of the i'th record in the profile
+ * report
+ *
+ * Algorithms record each iteration of their main loops (e.g. "bfs iteration") along with the
+ * device to host read-backs the iteration needs to decide what to launch next, dividing by the
+ * number of calls gives the per-iteration sync count.
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return host synchronizations (0 for the primitive records)
+ */
+size_t cugraph_prim_profile_report_get_host_syncs(const cugraph_prim_profile_report_t* report,
+                                                  size_t i);
+
+/**
+ * @brief     Get the accumulated wall time in collective communication of the i'th record in the
+ * profile report
+ *
+ * Included in the elapsed time.  In multi-GPU, this includes the time waiting for the slower GPUs
+ * to reach the collective calls, so the GPUs with the shortest communication time set the pace.
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ * @param [in]  i               Record index
+ * @return communication time in seconds
+ */
+double cugraph_prim_profile_report_get_comm_wait_seconds(
+  const cugraph_prim_profile_report_t* report, size_t i);
+
+/**
+ * @brief     Free a profile report
+ *
+ * @param [in]  report          Opaque pointer to the profile report
+ */
+void cugraph_prim_profile_report_free(cugraph_prim_profile_report_t* report);
+
 #ifdef __cplusplus
 }
 #endif
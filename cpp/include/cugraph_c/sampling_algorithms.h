@@ -234,8 +234,12 @@ typedef enum cugraph_compression_type_t {
                is compressed into a column pointer. */
   DCSR,    /** Compresses in DCSR format.  This outputs an additional index
               that avoids empty entries in the row pointer. */
-  DCSC     /** Compresses in DCSC format.  This outputs an additional index
+  DCSC,    /** Compresses in DCSC format.  This outputs an additional index
                that avoid empty entries in the col pointer. */
+  COO_DST_MAJOR /** Outputs in COO format with the edges sorted by destination (and
+                    renumbered with destinations first), the edge order of CSC.  This
+                    matches the layout PyG and DGL message passing expects without
+                    re-sorting the output. */
 } cugraph_compression_type_t;
 
 /**
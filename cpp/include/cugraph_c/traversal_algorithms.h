@@ -117,6 +117,114 @@ cugraph_error_code_t cugraph_bfs(
   cugraph_paths_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief     Opaque breadth first search options type
+ */
+typedef struct {
+  int32_t align_;
+} cugraph_bfs_options_t;
+
+/**
+ * @ingroup traversal
+ * @brief   Create breadth first search options object
+ *
+ * Direction optimizing and auto-tuning are disabled, the push/pull switch thresholds are set to
+ * the library defaults.
+ *
+ * @param [out] options Opaque pointer to the breadth first search options
+ * @param [out] error   Pointer to an error object storing details of any error.  Will
+ *                      be populated if error code is not CUGRAPH_SUCCESS
+ */
+cugraph_error_code_t cugraph_bfs_options_create(cugraph_bfs_options_t** options,
+                                                cugraph_error_t** error);
+
+/**
+ * @ingroup traversal
+ * @brief   Set flag to switch between push and pull based breadth first search (valid only for
+ *          symmetric graphs)
+ *
+ * @param options - opaque pointer to the breadth first search options
+ * @param value - Boolean value to assign to the option
+ */
+void cugraph_bfs_options_set_direction_optimizing(cugraph_bfs_options_t* options, bool_t value);
+
+/**
+ * @ingroup traversal
+ * @brief   Set the push to pull switch threshold (alpha)
+ *
+ * The search switches to pull if (the number of edges to check from the frontier) * alpha exceeds
+ * the number of edges to check from the unvisited vertices.
+ *
+ * @param options - opaque pointer to the breadth first search options
+ * @param value - Threshold value, should be positive
+ */
+void cugraph_bfs_options_set_alpha(cugraph_bfs_options_t* options, double value);
+
+/**
+ * @ingroup traversal
+ * @brief   Set the pull to push switch threshold (beta)
+ *
+ * The search switches back to push if (the frontier size) * beta is smaller than the number of
+ * unvisited vertices.
+ *
+ * @param options - opaque pointer to the breadth first search options
+ * @param value - Threshold value, should be positive
+ */
+void cugraph_bfs_options_set_beta(cugraph_bfs_options_t* options, double value);
+
+/**
+ * @ingroup traversal
+ * @brief   Set flag to re-compute the switch thresholds from the measured per-edge cost of the
+ *          push and pull steps in the first few iterations
+ *
+ * @param options - opaque pointer to the breadth first search options
+ * @param value - Boolean value to assign to the option
+ * @param num_levels - Maximum number of push iterations to sample
+ */
+void cugraph_bfs_options_set_auto_tune(cugraph_bfs_options_t* options,
+                                       bool_t value,
+                                       size_t num_levels);
+
+/**
+ * @ingroup traversal
+ * @brief     Free breadth first search options object
+ *
+ * @param [in]   options   Opaque pointer to the breadth first search options
+ */
+void cugraph_bfs_options_free(cugraph_bfs_options_t* options);
+
+/**
+ * @brief     Perform a breadth first search from a set of seed vertices with the direction
+ *            optimizing behavior configured through an options object.
+ *
+ * Identical to cugraph_bfs except that @p options replaces the direction_optimizing flag.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in,out]  sources  Array of source vertices.  NOTE: Array might be modified if
+ *                           renumbering is enabled for the graph
+ * @param [in]  options      Opaque pointer to the breadth first search options
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from @p source_vertex will be marked as unreachable.
+ * @param [in] compute_predecessors A flag to indicate whether to compute the predecessors in the
+ * result
+ * @param [in] do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_bfs_with_options(const cugraph_resource_handle_t* handle,
+                                              cugraph_graph_t* graph,
+                                              cugraph_type_erased_device_array_view_t* sources,
+                                              const cugraph_bfs_options_t* options,
+                                              size_t depth_limit,
+                                              bool_t compute_predecessors,
+                                              bool_t do_expensive_check,
+                                              cugraph_paths_result_t** result,
+                                              cugraph_error_t** error);
+
 /**
  * @brief     Perform single-source shortest-path to compute the minimum distances
  *            (and predecessors) from the source vertex.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,11 +15,21 @@
  */
 #pragma once
 
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
 #include <cudf/column/column.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <raft/core/handle.hpp>
 
+#include <rmm/device_uvector.hpp>
+
+#include <memory>
+#include <optional>
+#include <tuple>
+
 namespace cugraph {
 namespace etl {
 
@@ -53,5 +63,118 @@ std::
                        cudf::table_view const& dst_table,
                        cudf::type_id dtype);
 
+/**
+ * @brief     Renumber a pair of cudf tables with arbitrary (e.g. string or multi-column) keys
+ *
+ * Given a src table and a dst table, each corresponding entry represents an
+ * edge in a graph.  Each vertex is identified by a row of the table, rows
+ * are compared column by column (so strings and multi-column keys are
+ * supported directly and hash collisions never merge distinct vertices).
+ * Unique vertices are found by hashing the rows on device, and are assigned
+ * integers of the range [0, number_of_unique_vertices) in an unspecified
+ * order.  Null values compare equal to each other.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @param src_table   each row of the table identifies the source vertex
+ *                    for the graph
+ * @param dst_table   each row of the table identifies the destination vertex
+ *                    for the graph, should have the same number of rows and
+ *                    the same column types as src_table
+ * @param dtype       the data type of the returned vertex ids, should be INT32
+ *                    or INT64.
+ *
+ * @return tuple with the following three values:
+ *    1) column (of type dtype) with the source vertices represented as integers
+ *    2) column (of type dtype) with the destination vertices represented as integers
+ *    3) lookup table with the vertex id (of type dtype) as the first column
+ *       followed by the key columns of the corresponding vertex
+ *
+ */
+std::
+  tuple<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>, std::unique_ptr<cudf::table>>
+  renumber_cudf_key_tables(raft::handle_t const& handle,
+                           cudf::table_view const& src_table,
+                           cudf::table_view const& dst_table,
+                           cudf::type_id dtype);
+
+/**
+ * @brief     Create a graph from an edge list stored in a cudf table
+ *
+ * The table (e.g. read from Parquet files with cudf::io::read_parquet) holds
+ * one edge per row.  Vertex IDs are external IDs, they are renumbered by
+ * create_graph_from_edgelist.  If multi-GPU, every GPU passes its own part of
+ * the edge list (any edge can be stored in any GPU), and the edges are
+ * shuffled to their owning GPUs in chunks of @p shuffle_memory_budget bytes.
+ *
+ * The table is consumed column by column: each column is moved into a device
+ * vector and released right away, so the peak memory use is about one column
+ * larger than the edge list itself.
+ *
+ * @throws                 cugraph::logic_error when an error occurs.
+ *
+ * @param edgelist                 table storing the edge list, consumed by this
+ *                                 function; the columns should not have nulls
+ * @param src_column               index of the source vertex column (of type
+ *                                 vertex_t)
+ * @param dst_column               index of the destination vertex column (of
+ *                                 type vertex_t)
+ * @param weight_column            optional index of the weight column (of type
+ *                                 weight_t)
+ * @param edge_id_column           optional index of the edge ID column (of type
+ *                                 edge_t)
+ * @param edge_type_column         optional index of the edge type column (of
+ *                                 type int32_t)
+ * @param edge_start_time_column   optional index of the edge start time column
+ *                                 (of type edge_time_t)
+ * @param edge_end_time_column     optional index of the edge end time column (of
+ *                                 type edge_time_t)
+ * @param graph_properties         properties of the graph
+ * @param shuffle_memory_budget    temporary memory (in bytes) used to shuffle
+ *                                 each chunk of edges (multi-GPU only)
+ * @param do_expensive_check       run expensive checks for input arguments
+ *
+ * @return tuple of the generated graph, optional edge properties (weights, IDs,
+ *         types, start times, and end times; valid if the corresponding column
+ *         index is provided), and the renumber map
+ *
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    weight_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    int32_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_time_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_time_t>>,
+  rmm::device_uvector<vertex_t>>
+create_graph_from_cudf_edgelist(raft::handle_t const& handle,
+                                std::unique_ptr<cudf::table>&& edgelist,
+                                cudf::size_type src_column,
+                                cudf::size_type dst_column,
+                                std::optional<cudf::size_type> weight_column,
+                                std::optional<cudf::size_type> edge_id_column,
+                                std::optional<cudf::size_type> edge_type_column,
+                                std::optional<cudf::size_type> edge_start_time_column,
+                                std::optional<cudf::size_type> edge_end_time_column,
+                                cugraph::graph_properties_t graph_properties,
+                                size_t shuffle_memory_budget = size_t{1} << 30,
+                                bool do_expensive_check      = false);
+
 }  // namespace etl
 }  // namespace cugraph
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph_etl/functions.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace etl {
+
+namespace {
+
+// copy the column into a device vector and free the column's memory right away to bound the peak
+// memory use (rmm::device_uvector cannot adopt a cudf column's rmm::device_buffer)
+template <typename T>
+rmm::device_uvector<T> release_column(raft::handle_t const& handle,
+                                      std::vector<std::unique_ptr<cudf::column>>& columns,
+                                      cudf::size_type column_index)
+{
+  auto& column = columns[column_index];
+  CUGRAPH_EXPECTS(column->type().id() == cudf::type_to_id<T>(),
+                  "Invalid input arguments: column type does not match the template type.");
+  CUGRAPH_EXPECTS(!column->has_nulls(), "Invalid input arguments: columns should not have nulls.");
+
+  rmm::device_uvector<T> values(column->size(), handle.get_stream());
+  raft::copy(values.data(), column->view().template data<T>(), values.size(), handle.get_stream());
+  handle.sync_stream();  // the column may be freed on a different stream
+  column.reset();
+
+  return values;
+}
+
+template <typename T>
+std::optional<rmm::device_uvector<T>> release_optional_column(
+  raft::handle_t const& handle,
+  std::vector<std::unique_ptr<cudf::column>>& columns,
+  std::optional<cudf::size_type> column_index)
+{
+  return column_index ? std::make_optional(release_column<T>(handle, columns, *column_index))
+                      : std::nullopt;
+}
+
+template <typename T>
+std::optional<std::vector<rmm::device_uvector<T>>> to_single_chunk(
+  std::optional<rmm::device_uvector<T>>&& values)
+{
+  if (!values) { return std::nullopt; }
+  std::vector<rmm::device_uvector<T>> chunks{};
+  chunks.push_back(std::move(*values));
+  return std::make_optional(std::move(chunks));
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    weight_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    int32_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_time_t>>,
+  std::optional<cugraph::edge_property_t<
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    edge_time_t>>,
+  rmm::device_uvector<vertex_t>>
+create_graph_from_cudf_edgelist(raft::handle_t const& handle,
+                                std::unique_ptr<cudf::table>&& edgelist,
+                                cudf::size_type src_column,
+                                cudf::size_type dst_column,
+                                std::optional<cudf::size_type> weight_column,
+                                std::optional<cudf::size_type> edge_id_column,
+                                std::optional<cudf::size_type> edge_type_column,
+                                std::optional<cudf::size_type> edge_start_time_column,
+                                std::optional<cudf::size_type> edge_end_time_column,
+                                cugraph::graph_properties_t graph_properties,
+                                size_t shuffle_memory_budget,
+                                bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(edgelist != nullptr, "Invalid input arguments: edgelist should not be nullptr.");
+
+  std::vector<cudf::size_type> column_indices{src_column, dst_column};
+  for (auto column_index : {weight_column,
+                            edge_id_column,
+                            edge_type_column,
+                            edge_start_time_column,
+                            edge_end_time_column}) {
+    if (column_index) { column_indices.push_back(*column_index); }
+  }
+  CUGRAPH_EXPECTS(std::all_of(column_indices.begin(),
+                              column_indices.end(),
+                              [num_columns = edgelist->num_columns()](auto i) {
+                                return (i >= 0) && (i < num_columns);
+                              }),
+                  "Invalid input arguments: column indices should be in [0, # columns).");
+  std::sort(column_indices.begin(), column_indices.end());
+  CUGRAPH_EXPECTS(
+    std::adjacent_find(column_indices.begin(), column_indices.end()) == column_indices.end(),
+    "Invalid input arguments: column indices should be distinct.");
+
+  auto columns = edgelist->release();
+  edgelist.reset();
+
+  // free the columns not used as edge data before allocating any device vector
+  {
+    std::vector<bool> used(columns.size(), false);
+    for (auto i : column_indices) {
+      used[i] = true;
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (!used[i]) { columns[i].reset(); }
+    }
+  }
+
+  auto srcs        = release_column<vertex_t>(handle, columns, src_column);
+  auto dsts        = release_column<vertex_t>(handle, columns, dst_column);
+  auto weights     = release_optional_column<weight_t>(handle, columns, weight_column);
+  auto edge_ids    = release_optional_column<edge_t>(handle, columns, edge_id_column);
+  auto edge_types  = release_optional_column<int32_t>(handle, columns, edge_type_column);
+  auto start_times = release_optional_column<edge_time_t>(handle, columns, edge_start_time_column);
+  auto end_times   = release_optional_column<edge_time_t>(handle, columns, edge_end_time_column);
+
+  std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+  std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> weight_chunks{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<edge_t>>> edge_id_chunks{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<int32_t>>> edge_type_chunks{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<edge_time_t>>> start_time_chunks{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<edge_time_t>>> end_time_chunks{std::nullopt};
+  if constexpr (multi_gpu) {
+    // shuffle_external_edges_in_chunks treats the first vertex list as majors
+    if constexpr (store_transposed) { std::swap(srcs, dsts); }
+    std::tie(src_chunks,
+             dst_chunks,
+             weight_chunks,
+             edge_id_chunks,
+             edge_type_chunks,
+             start_time_chunks,
+             end_time_chunks) =
+      cugraph::shuffle_external_edges_in_chunks<vertex_t, edge_t, weight_t, int32_t, edge_time_t>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::move(weights),
+        std::move(edge_ids),
+        std::move(edge_types),
+        std::move(start_times),
+        std::move(end_times),
+        shuffle_memory_budget);
+    if constexpr (store_transposed) { std::swap(src_chunks, dst_chunks); }
+  } else {
+    src_chunks.push_back(std::move(srcs));
+    dst_chunks.push_back(std::move(dsts));
+    weight_chunks     = to_single_chunk(std::move(weights));
+    edge_id_chunks    = to_single_chunk(std::move(edge_ids));
+    edge_type_chunks  = to_single_chunk(std::move(edge_types));
+    start_time_chunks = to_single_chunk(std::move(start_times));
+    end_time_chunks   = to_single_chunk(std::move(end_times));
+  }
+
+  auto [graph,
+        edge_weights,
+        edge_id_property,
+        edge_type_property,
+        edge_start_times,
+        edge_end_times,
+        renumber_map] = cugraph::create_graph_from_edgelist<vertex_t,
+                                                            edge_t,
+                                                            weight_t,
+                                                            int32_t,
+                                                            edge_time_t,
+                                                            store_transposed,
+                                                            multi_gpu>(handle,
+                                                                       std::nullopt,
+                                                                       std::move(src_chunks),
+                                                                       std::move(dst_chunks),
+                                                                       std::move(weight_chunks),
+                                                                       std::move(edge_id_chunks),
+                                                                       std::move(edge_type_chunks),
+                                                                       std::move(start_time_chunks),
+                                                                       std::move(end_time_chunks),
+                                                                       graph_properties,
+                                                                       true /* renumber */,
+                                                                       do_expensive_check);
+
+  return std::make_tuple(std::move(graph),
+                         std::move(edge_weights),
+                         std::move(edge_id_property),
+                         std::move(edge_type_property),
+                         std::move(edge_start_times),
+                         std::move(edge_end_times),
+                         std::move(*renumber_map));
+}
+
+}  // namespace etl
+}  // namespace cugraph
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "graph_creation_impl.cuh"
+
+namespace cugraph {
+namespace etl {
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, float, int32_t, false, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, float, int32_t, true, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int64_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, float, int64_t, false, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int64_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, float, int64_t, true, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, double, int32_t, false, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, double, int32_t, true, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int64_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, double, int64_t, false, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int64_t>>,
+  rmm::device_uvector<int32_t>>
+create_graph_from_cudf_edgelist<int32_t, int32_t, double, int64_t, true, true>(
+  raft::handle_t const& handle,
+  std::unique_ptr<cudf::table>&& edgelist,
+  cudf::size_type src_column,
+  cudf::size_type dst_column,
+  std::optional<cudf::size_type> weight_column,
+  std::optional<cudf::size_type> edge_id_column,
+  std::optional<cudf::size_type> edge_type_column,
+  std::optional<cudf::size_type> edge_start_time_column,
+  std::optional<cudf::size_type> edge_end_time_column,
+  cugraph::graph_properties_t graph_properties,
+  size_t shuffle_memory_budget,
+  bool do_expensive_check);
+
+}  // namespace etl
+}  // namespace cugraph
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cugraph/utilities/error.hpp>
+#include <cugraph_etl/functions.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace etl {
+
+namespace {
+
+template <typename id_t>
+struct cast_to_id_t {
+  __device__ id_t operator()(cudf::size_type i) const { return static_cast<id_t>(i); }
+};
+
+// every row of keys has exactly one match in the unique keys (the build table of
+// unique_key_join), the matching unique key's row index is the vertex id
+template <typename id_t>
+std::unique_ptr<cudf::column> lookup_vertex_ids(raft::handle_t const& handle,
+                                                cudf::hash_join const& unique_key_join,
+                                                cudf::table_view const& keys)
+{
+  auto [probe_indices, build_indices] =
+    unique_key_join.inner_join(keys, std::nullopt, handle.get_stream());
+  CUGRAPH_EXPECTS(probe_indices->size() == static_cast<size_t>(keys.num_rows()),
+                  "Invalid input arguments: every key should match exactly one unique key.");
+
+  auto ids = cudf::make_numeric_column(cudf::data_type{cudf::type_to_id<id_t>()},
+                                       keys.num_rows(),
+                                       cudf::mask_state::UNALLOCATED,
+                                       handle.get_stream());
+  thrust::scatter(handle.get_thrust_policy(),
+                  thrust::make_transform_iterator(build_indices->begin(), cast_to_id_t<id_t>{}),
+                  thrust::make_transform_iterator(build_indices->end(), cast_to_id_t<id_t>{}),
+                  probe_indices->begin(),
+                  ids->mutable_view().begin<id_t>());
+  return ids;
+}
+
+template <typename id_t>
+std::
+  tuple<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>, std::unique_ptr<cudf::table>>
+  renumber_key_tables(raft::handle_t const& handle,
+                      cudf::table_view const& src_table,
+                      cudf::table_view const& dst_table)
+{
+  // 1. find unique keys (hash-based, rows are compared column by column)
+
+  std::unique_ptr<cudf::table> unique_keys{};
+  {
+    std::vector<cudf::table_view> tables{src_table, dst_table};
+    auto all_keys = cudf::concatenate(tables, handle.get_stream());
+    std::vector<cudf::size_type> key_columns(src_table.num_columns());
+    std::iota(key_columns.begin(), key_columns.end(), cudf::size_type{0});
+    unique_keys = cudf::distinct(all_keys->view(),
+                                 key_columns,
+                                 cudf::duplicate_keep_option::KEEP_ANY,
+                                 cudf::null_equality::EQUAL,
+                                 cudf::nan_equality::ALL_EQUAL,
+                                 handle.get_stream());
+  }
+  auto num_unique_keys = unique_keys->num_rows();
+  CUGRAPH_EXPECTS(static_cast<int64_t>(num_unique_keys) <=
+                    static_cast<int64_t>(std::numeric_limits<id_t>::max()),
+                  "Invalid input arguments: too many unique vertices for dtype, use INT64.");
+
+  // 2. map keys to the row indices of the unique keys
+
+  std::unique_ptr<cudf::column> src_ids{};
+  std::unique_ptr<cudf::column> dst_ids{};
+  {
+    cudf::hash_join unique_key_join(
+      unique_keys->view(), cudf::null_equality::EQUAL, handle.get_stream());
+    src_ids = lookup_vertex_ids<id_t>(handle, unique_key_join, src_table);
+    dst_ids = lookup_vertex_ids<id_t>(handle, unique_key_join, dst_table);
+  }
+
+  // 3. build the lookup table (vertex id, key columns)
+
+  auto lookup_columns = unique_keys->release();
+  lookup_columns.insert(
+    lookup_columns.begin(),
+    cudf::sequence(num_unique_keys,
+                   cudf::numeric_scalar<id_t>(id_t{0}, true, handle.get_stream()),
+                   handle.get_stream()));
+
+  return std::make_tuple(std::move(src_ids),
+                         std::move(dst_ids),
+                         std::make_unique<cudf::table>(std::move(lookup_columns)));
+}
+
+}  // namespace
+
+std::
+  tuple<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>, std::unique_ptr<cudf::table>>
+  renumber_cudf_key_tables(raft::handle_t const& handle,
+                           cudf::table_view const& src_table,
+                           cudf::table_view const& dst_table,
+                           cudf::type_id dtype)
+{
+  CUGRAPH_EXPECTS((dtype == cudf::type_id::INT32) || (dtype == cudf::type_id::INT64),
+                  "Invalid input arguments: dtype should be INT32 or INT64.");
+  CUGRAPH_EXPECTS(src_table.num_columns() > 0,
+                  "Invalid input arguments: src_table should have at least one column.");
+  CUGRAPH_EXPECTS(src_table.num_columns() == dst_table.num_columns(),
+                  "Invalid input arguments: src_table and dst_table should have the same number "
+                  "of columns.");
+  CUGRAPH_EXPECTS(src_table.num_rows() == dst_table.num_rows(),
+                  "Invalid input arguments: src_table and dst_table should have the same number "
+                  "of rows.");
+  for (cudf::size_type i = 0; i < src_table.num_columns(); ++i) {
+    CUGRAPH_EXPECTS(src_table.column(i).type() == dst_table.column(i).type(),
+                    "Invalid input arguments: src_table and dst_table column types should match.");
+  }
+  CUGRAPH_EXPECTS(
+    static_cast<int64_t>(src_table.num_rows()) * 2 <=
+      static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+    "Invalid input arguments: the number of edges should be smaller than half the cudf row limit.");
+
+  return dtype == cudf::type_id::INT32
+           ? renumber_key_tables<int32_t>(handle, src_table, dst_table)
+           : renumber_key_tables<int64_t>(handle, src_table, dst_table);
+}
+
+}  // namespace etl
+}  // namespace cugraph
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph_etl/functions.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct GraphCreation_Usecase {
+  bool test_weighted{false};
+  bool sparse_vertex_ids{false};  // map vertex i to 3 * i + 1 to exercise renumbering
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ETLGraphCreation
+  : public ::testing::TestWithParam<std::tuple<GraphCreation_Usecase, input_usecase_t>> {
+ public:
+  Tests_ETLGraphCreation() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(GraphCreation_Usecase const& graph_creation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+    using edge_time_t = int32_t;
+
+    raft::handle_t handle{};
+
+    // 1. create the input edge list
+
+    auto [src_chunks, dst_chunks, weight_chunks, d_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        handle, graph_creation_usecase.test_weighted, false, false);
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    auto h_weights = weight_chunks ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+    for (size_t i = 0; i < src_chunks.size(); ++i) {
+      auto h_src_chunk = cugraph::test::to_host(handle, src_chunks[i]);
+      auto h_dst_chunk = cugraph::test::to_host(handle, dst_chunks[i]);
+      h_srcs.insert(h_srcs.end(), h_src_chunk.begin(), h_src_chunk.end());
+      h_dsts.insert(h_dsts.end(), h_dst_chunk.begin(), h_dst_chunk.end());
+      if (h_weights) {
+        auto h_weight_chunk = cugraph::test::to_host(handle, (*weight_chunks)[i]);
+        (*h_weights).insert((*h_weights).end(), h_weight_chunk.begin(), h_weight_chunk.end());
+      }
+    }
+    if (graph_creation_usecase.sparse_vertex_ids) {
+      auto sparse_id = [](vertex_t v) { return v * 3 + 1; };
+      std::transform(h_srcs.begin(), h_srcs.end(), h_srcs.begin(), sparse_id);
+      std::transform(h_dsts.begin(), h_dsts.end(), h_dsts.begin(), sparse_id);
+    }
+
+    // 2. create a graph from the cuDF table (the edge list columns are intentionally out of order
+    // and the table has a column that is not used as edge data)
+
+    std::vector<std::unique_ptr<cudf::column>> columns{};
+    columns.push_back(std::make_unique<cudf::column>(
+      cugraph::test::to_device(handle, h_dsts), rmm::device_buffer{}, 0));
+    columns.push_back(std::make_unique<cudf::column>(
+      cugraph::test::to_device(handle, std::vector<int32_t>(h_srcs.size(), int32_t{1})),
+      rmm::device_buffer{},
+      0));
+    columns.push_back(std::make_unique<cudf::column>(
+      cugraph::test::to_device(handle, h_srcs), rmm::device_buffer{}, 0));
+    if (h_weights) {
+      columns.push_back(std::make_unique<cudf::column>(
+        cugraph::test::to_device(handle, *h_weights), rmm::device_buffer{}, 0));
+    }
+    auto table = std::make_unique<cudf::table>(std::move(columns));
+
+    auto [graph, edge_weights, edge_ids, edge_types, start_times, end_times, renumber_map] =
+      cugraph::etl::
+        create_graph_from_cudf_edgelist<vertex_t, edge_t, weight_t, edge_time_t, false, false>(
+          handle,
+          std::move(table),
+          2,
+          0,
+          h_weights ? std::make_optional<cudf::size_type>(3) : std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cugraph::graph_properties_t{false, true},
+          size_t{1} << 30,
+          true);
+    auto graph_view = graph.view();
+
+    ASSERT_TRUE(table == nullptr) << "The input table should be released.";
+    ASSERT_EQ(edge_weights.has_value(), h_weights.has_value());
+    ASSERT_FALSE(edge_ids.has_value() || edge_types.has_value() || start_times.has_value() ||
+                 end_times.has_value());
+
+    if (graph_creation_usecase.check_correctness) {
+      // 3. create a graph from the same edge list with create_graph_from_edgelist
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> ref_graph(handle);
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+        ref_edge_weights{std::nullopt};
+      std::optional<rmm::device_uvector<vertex_t>> ref_renumber_map{std::nullopt};
+      std::tie(ref_graph,
+               ref_edge_weights,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               ref_renumber_map) =
+        cugraph::create_graph_from_edgelist<vertex_t,
+                                            edge_t,
+                                            weight_t,
+                                            edge_type_t,
+                                            edge_time_t,
+                                            false,
+                                            false>(
+          handle,
+          std::nullopt,
+          cugraph::test::to_device(handle, h_srcs),
+          cugraph::test::to_device(handle, h_dsts),
+          h_weights ? std::make_optional(cugraph::test::to_device(handle, *h_weights))
+                    : std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cugraph::graph_properties_t{false, true},
+          true);
+      auto ref_graph_view = ref_graph.view();
+
+      ASSERT_EQ(graph_view.number_of_vertices(), ref_graph_view.number_of_vertices());
+      ASSERT_EQ(graph_view.compute_number_of_edges(handle),
+                ref_graph_view.compute_number_of_edges(handle));
+
+      // 4. the renumber map should hold every (and only) vertex in the edge list
+
+      auto h_renumber_map = cugraph::test::to_host(handle, renumber_map);
+      std::sort(h_renumber_map.begin(), h_renumber_map.end());
+      std::vector<vertex_t> h_unique_vertices(h_srcs);
+      h_unique_vertices.insert(h_unique_vertices.end(), h_dsts.begin(), h_dsts.end());
+      std::sort(h_unique_vertices.begin(), h_unique_vertices.end());
+      h_unique_vertices.erase(std::unique(h_unique_vertices.begin(), h_unique_vertices.end()),
+                              h_unique_vertices.end());
+      ASSERT_TRUE(h_renumber_map == h_unique_vertices)
+        << "The renumber map does not match the vertices in the edge list.";
+
+      // 5. compare the edges (in the external vertex IDs)
+
+      auto [h_graph_srcs, h_graph_dsts, h_graph_weights] = cugraph::test::graph_to_host_coo(
+        handle,
+        graph_view,
+        edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt,
+        std::make_optional<raft::device_span<vertex_t const>>(renumber_map.data(),
+                                                              renumber_map.size()));
+      auto [h_ref_srcs, h_ref_dsts, h_ref_weights] = cugraph::test::graph_to_host_coo(
+        handle,
+        ref_graph_view,
+        ref_edge_weights ? std::make_optional((*ref_edge_weights).view()) : std::nullopt,
+        std::make_optional<raft::device_span<vertex_t const>>((*ref_renumber_map).data(),
+                                                              (*ref_renumber_map).size()));
+
+      auto to_sorted_edges = [](auto const& srcs, auto const& dsts, auto const& weights) {
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(srcs.size());
+        for (size_t i = 0; i < edges.size(); ++i) {
+          edges[i] = std::make_tuple(srcs[i], dsts[i], weights ? (*weights)[i] : weight_t{1.0});
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+      };
+
+      ASSERT_TRUE(to_sorted_edges(h_graph_srcs, h_graph_dsts, h_graph_weights) ==
+                  to_sorted_edges(h_ref_srcs, h_ref_dsts, h_ref_weights))
+        << "The graph created from the cuDF table does not match the graph created from the edge "
+           "list.";
+    }
+  }
+};
+
+using Tests_ETLGraphCreation_Rmat = Tests_ETLGraphCreation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ETLGraphCreation_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ETLGraphCreation_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ETLGraphCreation_Rmat,
+  ::testing::Combine(::testing::Values(GraphCreation_Usecase{false, false},
+                                       GraphCreation_Usecase{true, false},
+                                       GraphCreation_Usecase{false, true},
+                                       GraphCreation_Usecase{true, true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ETLGraphCreation_Rmat,
+  ::testing::Combine(
+    ::testing::Values(GraphCreation_Usecase{true, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_renumbering_validate.hpp"
+
+#include "utilities/conversion_utilities.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <raft/core/device_span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cugraph {
+namespace test {
+
+namespace {
+
+constexpr int64_t pair_key_divisor{1000};
+
+std::vector<int64_t> integer_column_to_host(raft::handle_t const& handle,
+                                            cudf::column_view const& column)
+{
+  std::vector<int64_t> h_values(column.size());
+  if (column.type().id() == cudf::type_id::INT32) {
+    auto h_int32_values = to_host(
+      handle, raft::device_span<int32_t const>(column.data<int32_t>(), column.size()));
+    std::copy(h_int32_values.begin(), h_int32_values.end(), h_values.begin());
+  } else {
+    EXPECT_EQ(column.type().id(), cudf::type_id::INT64);
+    h_values =
+      to_host(handle, raft::device_span<int64_t const>(column.data<int64_t>(), column.size()));
+  }
+  return h_values;
+}
+
+std::vector<int64_t> string_column_to_host(raft::handle_t const& handle,
+                                           cudf::column_view const& column)
+{
+  auto integers = cudf::strings::to_integers(cudf::strings_column_view(column),
+                                             cudf::data_type{cudf::type_id::INT64},
+                                             handle.get_stream());
+  return integer_column_to_host(handle, integers->view());
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::table> make_key_table(raft::handle_t const& handle,
+                                            std::vector<int64_t> const& h_keys,
+                                            key_kind_t key_kind)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns{};
+  if (key_kind == key_kind_t::int32_string_pair) {
+    std::vector<int32_t> h_quotients(h_keys.size());
+    std::vector<int64_t> h_remainders(h_keys.size());
+    std::transform(h_keys.begin(), h_keys.end(), h_quotients.begin(), [](auto key) {
+      return static_cast<int32_t>(key / pair_key_divisor);
+    });
+    std::transform(h_keys.begin(), h_keys.end(), h_remainders.begin(), [](auto key) {
+      return key % pair_key_divisor;
+    });
+    columns.push_back(std::make_unique<cudf::column>(
+      to_device(handle, h_quotients), rmm::device_buffer{}, 0));
+    cudf::column remainders(to_device(handle, h_remainders), rmm::device_buffer{}, 0);
+    columns.push_back(cudf::strings::from_integers(remainders.view(), handle.get_stream()));
+  } else {
+    auto keys = std::make_unique<cudf::column>(to_device(handle, h_keys), rmm::device_buffer{}, 0);
+    if (key_kind == key_kind_t::string) {
+      columns.push_back(cudf::strings::from_integers(keys->view(), handle.get_stream()));
+    } else {
+      columns.push_back(std::move(keys));
+    }
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+std::vector<int64_t> key_table_to_host(raft::handle_t const& handle,
+                                       cudf::table_view const& keys,
+                                       key_kind_t key_kind)
+{
+  if (key_kind == key_kind_t::int32_string_pair) {
+    auto h_keys       = integer_column_to_host(handle, keys.column(0));
+    auto h_remainders = string_column_to_host(handle, keys.column(1));
+    for (size_t i = 0; i < h_keys.size(); ++i) {
+      h_keys[i] = h_keys[i] * pair_key_divisor + h_remainders[i];
+    }
+    return h_keys;
+  } else if (key_kind == key_kind_t::string) {
+    return string_column_to_host(handle, keys.column(0));
+  } else {
+    return integer_column_to_host(handle, keys.column(0));
+  }
+}
+
+void key_renumbering_validate(raft::handle_t const& handle,
+                              std::vector<int64_t> const& h_src_keys,
+                              std::vector<int64_t> const& h_dst_keys,
+                              key_kind_t key_kind,
+                              cudf::type_id dtype,
+                              cudf::column_view const& src_ids,
+                              cudf::column_view const& dst_ids,
+                              cudf::table_view const& lookup_table)
+{
+  auto num_key_columns = (key_kind == key_kind_t::int32_string_pair) ? 2 : 1;
+
+  ASSERT_EQ(src_ids.type().id(), dtype);
+  ASSERT_EQ(dst_ids.type().id(), dtype);
+  ASSERT_EQ(src_ids.size(), static_cast<cudf::size_type>(h_src_keys.size()));
+  ASSERT_EQ(dst_ids.size(), static_cast<cudf::size_type>(h_dst_keys.size()));
+  ASSERT_EQ(src_ids.null_count(), 0);
+  ASSERT_EQ(dst_ids.null_count(), 0);
+  ASSERT_EQ(lookup_table.num_columns(), 1 + num_key_columns);
+  ASSERT_EQ(lookup_table.column(0).type().id(), dtype);
+
+  // 1. the lookup table holds every (and only) distinct key exactly once, the input keys are
+  // non-contiguous and repeated, so this also checks that duplicates are merged
+
+  std::vector<int64_t> h_unique_keys(h_src_keys);
+  h_unique_keys.insert(h_unique_keys.end(), h_dst_keys.begin(), h_dst_keys.end());
+  std::sort(h_unique_keys.begin(), h_unique_keys.end());
+  h_unique_keys.erase(std::unique(h_unique_keys.begin(), h_unique_keys.end()),
+                      h_unique_keys.end());
+
+  std::vector<cudf::size_type> key_column_indices(num_key_columns);
+  std::iota(key_column_indices.begin(), key_column_indices.end(), cudf::size_type{1});
+  auto lookup_keys = lookup_table.select(key_column_indices);
+
+  auto h_lookup_keys = key_table_to_host(handle, lookup_keys, key_kind);
+  std::sort(h_lookup_keys.begin(), h_lookup_keys.end());
+  ASSERT_TRUE(h_lookup_keys == h_unique_keys)
+    << "The lookup table keys do not match the distinct input keys.";
+
+  // 2. the IDs are [0, number of distinct keys) and the lookup table is in ID order (so gathering
+  // the lookup table with the IDs unrenumbers them)
+
+  auto h_lookup_ids = integer_column_to_host(handle, lookup_table.column(0));
+  std::vector<int64_t> h_sequence(h_unique_keys.size());
+  std::iota(h_sequence.begin(), h_sequence.end(), int64_t{0});
+  ASSERT_TRUE(h_lookup_ids == h_sequence)
+    << "The lookup table IDs are not a sequence starting from 0.";
+
+  auto h_src_ids = integer_column_to_host(handle, src_ids);
+  auto h_dst_ids = integer_column_to_host(handle, dst_ids);
+
+  auto is_valid_id = [num_unique_keys = static_cast<int64_t>(h_unique_keys.size())](auto id) {
+    return (id >= 0) && (id < num_unique_keys);
+  };
+  ASSERT_TRUE(std::all_of(h_src_ids.begin(), h_src_ids.end(), is_valid_id))
+    << "Source IDs out of range.";
+  ASSERT_TRUE(std::all_of(h_dst_ids.begin(), h_dst_ids.end(), is_valid_id))
+    << "Destination IDs out of range.";
+
+  // 3. renumber -> unrenumber round trip, as the lookup table keys are unique, this also checks
+  // that equal keys (in both src and dst) are assigned the same ID
+
+  auto unrenumbered_srcs = cudf::gather(
+    lookup_keys, src_ids, cudf::out_of_bounds_policy::DONT_CHECK, handle.get_stream());
+  auto unrenumbered_dsts = cudf::gather(
+    lookup_keys, dst_ids, cudf::out_of_bounds_policy::DONT_CHECK, handle.get_stream());
+
+  ASSERT_TRUE(key_table_to_host(handle, unrenumbered_srcs->view(), key_kind) == h_src_keys)
+    << "Unrenumbered source keys do not match the input source keys.";
+  ASSERT_TRUE(key_table_to_host(handle, unrenumbered_dsts->view(), key_kind) == h_dst_keys)
+    << "Unrenumbered destination keys do not match the input destination keys.";
+}
+
+}  // namespace test
+}  // namespace cugraph
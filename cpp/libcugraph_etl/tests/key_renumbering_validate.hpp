@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cugraph {
+namespace test {
+
+// key types to renumber, every key is built from (and can be mapped back to) an integer
+enum class key_kind_t {
+  int64,             // a single INT64 column
+  string,            // a single STRING column (the decimal representation of the integer)
+  int32_string_pair  // an INT32 column (integer / 1000) and a STRING column (integer % 1000)
+};
+
+std::unique_ptr<cudf::table> make_key_table(raft::handle_t const& handle,
+                                            std::vector<int64_t> const& h_keys,
+                                            key_kind_t key_kind);
+
+std::vector<int64_t> key_table_to_host(raft::handle_t const& handle,
+                                       cudf::table_view const& keys,
+                                       key_kind_t key_kind);
+
+// check renumber_cudf_key_tables's output for the (src, dst) keys built with make_key_table
+void key_renumbering_validate(raft::handle_t const& handle,
+                              std::vector<int64_t> const& h_src_keys,
+                              std::vector<int64_t> const& h_dst_keys,
+                              key_kind_t key_kind,
+                              cudf::type_id dtype,
+                              cudf::column_view const& src_ids,
+                              cudf::column_view const& dst_ids,
+                              cudf::table_view const& lookup_table);
+
+}  // namespace test
+}  // namespace cugraph
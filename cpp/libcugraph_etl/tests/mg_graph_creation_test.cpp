@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph_etl/functions.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct GraphCreation_Usecase {
+  bool test_weighted{false};
+  bool sparse_vertex_ids{false};  // map vertex i to 3 * i + 1 to exercise renumbering
+  size_t shuffle_memory_budget{size_t{1} << 30};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGETLGraphCreation
+  : public ::testing::TestWithParam<std::tuple<GraphCreation_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGETLGraphCreation() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(GraphCreation_Usecase const& graph_creation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+    using edge_time_t = int32_t;
+
+    // 1. create this GPU's (unshuffled) part of the input edge list
+
+    auto [src_chunks, dst_chunks, weight_chunks, d_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        *handle_, graph_creation_usecase.test_weighted, false, true, false);
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    auto h_weights = weight_chunks ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+    for (size_t i = 0; i < src_chunks.size(); ++i) {
+      auto h_src_chunk = cugraph::test::to_host(*handle_, src_chunks[i]);
+      auto h_dst_chunk = cugraph::test::to_host(*handle_, dst_chunks[i]);
+      h_srcs.insert(h_srcs.end(), h_src_chunk.begin(), h_src_chunk.end());
+      h_dsts.insert(h_dsts.end(), h_dst_chunk.begin(), h_dst_chunk.end());
+      if (h_weights) {
+        auto h_weight_chunk = cugraph::test::to_host(*handle_, (*weight_chunks)[i]);
+        (*h_weights).insert((*h_weights).end(), h_weight_chunk.begin(), h_weight_chunk.end());
+      }
+    }
+    if (graph_creation_usecase.sparse_vertex_ids) {
+      auto sparse_id = [](vertex_t v) { return v * 3 + 1; };
+      std::transform(h_srcs.begin(), h_srcs.end(), h_srcs.begin(), sparse_id);
+      std::transform(h_dsts.begin(), h_dsts.end(), h_dsts.begin(), sparse_id);
+    }
+
+    // 2. create a graph from the cuDF tables (each GPU holds a part of the edge list)
+
+    std::vector<std::unique_ptr<cudf::column>> columns{};
+    columns.push_back(std::make_unique<cudf::column>(
+      cugraph::test::to_device(*handle_, h_srcs), rmm::device_buffer{}, 0));
+    columns.push_back(std::make_unique<cudf::column>(
+      cugraph::test::to_device(*handle_, h_dsts), rmm::device_buffer{}, 0));
+    if (h_weights) {
+      columns.push_back(std::make_unique<cudf::column>(
+        cugraph::test::to_device(*handle_, *h_weights), rmm::device_buffer{}, 0));
+    }
+    auto table = std::make_unique<cudf::table>(std::move(columns));
+
+    auto [mg_graph, mg_edge_weights, edge_ids, edge_types, start_times, end_times, renumber_map] =
+      cugraph::etl::
+        create_graph_from_cudf_edgelist<vertex_t, edge_t, weight_t, edge_time_t, false, true>(
+          *handle_,
+          std::move(table),
+          0,
+          1,
+          h_weights ? std::make_optional<cudf::size_type>(2) : std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cugraph::graph_properties_t{false, true},
+          graph_creation_usecase.shuffle_memory_budget,
+          true);
+    auto mg_graph_view = mg_graph.view();
+
+    ASSERT_EQ(mg_edge_weights.has_value(), h_weights.has_value());
+
+    if (graph_creation_usecase.check_correctness) {
+      // 3. create a graph from the same edge list with shuffle_external_edges &
+      // create_graph_from_edgelist
+
+      rmm::device_uvector<vertex_t> d_ref_srcs(0, handle_->get_stream());
+      rmm::device_uvector<vertex_t> d_ref_dsts(0, handle_->get_stream());
+      std::optional<rmm::device_uvector<weight_t>> d_ref_weights{std::nullopt};
+      std::tie(d_ref_srcs,
+               d_ref_dsts,
+               d_ref_weights,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore) =
+        cugraph::shuffle_external_edges<vertex_t, edge_t, weight_t, edge_type_t, edge_time_t>(
+          *handle_,
+          cugraph::test::to_device(*handle_, h_srcs),
+          cugraph::test::to_device(*handle_, h_dsts),
+          h_weights ? std::make_optional(cugraph::test::to_device(*handle_, *h_weights))
+                    : std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt);
+
+      cugraph::graph_t<vertex_t, edge_t, false, true> ref_graph(*handle_);
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, true>, weight_t>>
+        ref_edge_weights{std::nullopt};
+      std::optional<rmm::device_uvector<vertex_t>> ref_renumber_map{std::nullopt};
+      std::tie(ref_graph,
+               ref_edge_weights,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               ref_renumber_map) =
+        cugraph::create_graph_from_edgelist<vertex_t,
+                                            edge_t,
+                                            weight_t,
+                                            edge_type_t,
+                                            edge_time_t,
+                                            false,
+                                            true>(*handle_,
+                                                  std::nullopt,
+                                                  std::move(d_ref_srcs),
+                                                  std::move(d_ref_dsts),
+                                                  std::move(d_ref_weights),
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  cugraph::graph_properties_t{false, true},
+                                                  true);
+      auto ref_graph_view = ref_graph.view();
+
+      ASSERT_EQ(mg_graph_view.number_of_vertices(), ref_graph_view.number_of_vertices());
+      ASSERT_EQ(mg_graph_view.compute_number_of_edges(*handle_),
+                ref_graph_view.compute_number_of_edges(*handle_));
+
+      // 4. gather the renumber map & the input edge list and the edges of both graphs (in the
+      // external vertex IDs) to rank 0
+
+      auto d_mg_aggregate_renumber_map = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(renumber_map.data(), renumber_map.size()));
+      auto d_input_srcs = cugraph::test::to_device(*handle_, h_srcs);
+      auto d_input_dsts = cugraph::test::to_device(*handle_, h_dsts);
+      auto d_aggregate_input_srcs = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(d_input_srcs.data(), d_input_srcs.size()));
+      auto d_aggregate_input_dsts = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(d_input_dsts.data(), d_input_dsts.size()));
+
+      auto [h_mg_srcs, h_mg_dsts, h_mg_weights] = cugraph::test::graph_to_host_coo(
+        *handle_,
+        mg_graph_view,
+        mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt,
+        std::make_optional<raft::device_span<vertex_t const>>(renumber_map.data(),
+                                                              renumber_map.size()));
+      auto [h_ref_srcs, h_ref_dsts, h_ref_weights] = cugraph::test::graph_to_host_coo(
+        *handle_,
+        ref_graph_view,
+        ref_edge_weights ? std::make_optional((*ref_edge_weights).view()) : std::nullopt,
+        std::make_optional<raft::device_span<vertex_t const>>((*ref_renumber_map).data(),
+                                                              (*ref_renumber_map).size()));
+
+      if (handle_->get_comms().get_rank() == int{0}) {
+        // 5. the renumber map should hold every (and only) vertex in the edge list
+
+        auto h_mg_aggregate_renumber_map =
+          cugraph::test::to_host(*handle_, d_mg_aggregate_renumber_map);
+        std::sort(h_mg_aggregate_renumber_map.begin(), h_mg_aggregate_renumber_map.end());
+        auto h_unique_vertices = cugraph::test::to_host(*handle_, d_aggregate_input_srcs);
+        auto h_aggregate_input_dsts = cugraph::test::to_host(*handle_, d_aggregate_input_dsts);
+        h_unique_vertices.insert(
+          h_unique_vertices.end(), h_aggregate_input_dsts.begin(), h_aggregate_input_dsts.end());
+        std::sort(h_unique_vertices.begin(), h_unique_vertices.end());
+        h_unique_vertices.erase(std::unique(h_unique_vertices.begin(), h_unique_vertices.end()),
+                                h_unique_vertices.end());
+        ASSERT_TRUE(h_mg_aggregate_renumber_map == h_unique_vertices)
+          << "The renumber map does not match the vertices in the edge list.";
+
+        // 6. compare the edges
+
+        auto to_sorted_edges = [](auto const& srcs, auto const& dsts, auto const& weights) {
+          std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(srcs.size());
+          for (size_t i = 0; i < edges.size(); ++i) {
+            edges[i] = std::make_tuple(srcs[i], dsts[i], weights ? (*weights)[i] : weight_t{1.0});
+          }
+          std::sort(edges.begin(), edges.end());
+          return edges;
+        };
+
+        ASSERT_TRUE(to_sorted_edges(h_mg_srcs, h_mg_dsts, h_mg_weights) ==
+                    to_sorted_edges(h_ref_srcs, h_ref_dsts, h_ref_weights))
+          << "The graph created from the cuDF tables does not match the graph created from the "
+             "edge list.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGETLGraphCreation<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGETLGraphCreation_Rmat = Tests_MGETLGraphCreation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGETLGraphCreation_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGETLGraphCreation_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGETLGraphCreation_Rmat,
+  ::testing::Combine(
+    // a small shuffle memory budget forces shuffling the edges in multiple chunks
+    ::testing::Values(GraphCreation_Usecase{false, false},
+                      GraphCreation_Usecase{true, false},
+                      GraphCreation_Usecase{false, true},
+                      GraphCreation_Usecase{true, true},
+                      GraphCreation_Usecase{true, true, size_t{1} << 14}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGETLGraphCreation_Rmat,
+  ::testing::Combine(
+    ::testing::Values(GraphCreation_Usecase{true, true, size_t{1} << 30, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
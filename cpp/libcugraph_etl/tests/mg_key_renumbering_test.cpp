@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_renumbering_validate.hpp"
+#include "utilities/base_fixture.hpp"
+#include "utilities/mg_utilities.hpp"
+
+#include <cugraph_etl/functions.hpp>
+
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+struct KeyRenumbering_Usecase {
+  cugraph::test::key_kind_t key_kind{cugraph::test::key_kind_t::int64};
+  size_t num_edges{0};  // per GPU
+  size_t num_keys{0};   // keys are drawn (with repetition) from num_keys non-contiguous values
+  uint64_t seed{0};
+  bool check_correctness{true};
+};
+
+// renumber_cudf_key_tables renumbers the keys local to each GPU (IDs are not unique across GPUs),
+// so every GPU renumbers its own part of the edge list (with keys shared with the other GPUs) and
+// validates the result locally
+class Tests_MGETLKeyRenumbering : public ::testing::TestWithParam<KeyRenumbering_Usecase> {
+ public:
+  Tests_MGETLKeyRenumbering() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void run_current_test(KeyRenumbering_Usecase const& key_renumbering_usecase,
+                        cudf::type_id dtype)
+  {
+    auto const comm_rank = handle_->get_comms().get_rank();
+
+    // 1. create this GPU's (src, dst) keys, key i is i * 100003 + 17 (so the keys are
+    // non-contiguous and do not start from 0) and each key appears multiple times (both within
+    // this GPU and across GPUs) if num_edges > num_keys
+
+    std::mt19937_64 gen(key_renumbering_usecase.seed + comm_rank);
+    std::uniform_int_distribution<int64_t> distribution(
+      0, static_cast<int64_t>(key_renumbering_usecase.num_keys) - 1);
+    auto random_key = [&gen, &distribution]() { return distribution(gen) * 100003 + 17; };
+
+    std::vector<int64_t> h_src_keys(key_renumbering_usecase.num_edges);
+    std::vector<int64_t> h_dst_keys(key_renumbering_usecase.num_edges);
+    std::generate(h_src_keys.begin(), h_src_keys.end(), random_key);
+    std::generate(h_dst_keys.begin(), h_dst_keys.end(), random_key);
+
+    auto src_table =
+      cugraph::test::make_key_table(*handle_, h_src_keys, key_renumbering_usecase.key_kind);
+    auto dst_table =
+      cugraph::test::make_key_table(*handle_, h_dst_keys, key_renumbering_usecase.key_kind);
+
+    // 2. renumber
+
+    auto [src_ids, dst_ids, lookup_table] = cugraph::etl::renumber_cudf_key_tables(
+      *handle_, src_table->view(), dst_table->view(), dtype);
+
+    // 3. validate
+
+    if (key_renumbering_usecase.check_correctness) {
+      cugraph::test::key_renumbering_validate(*handle_,
+                                              h_src_keys,
+                                              h_dst_keys,
+                                              key_renumbering_usecase.key_kind,
+                                              dtype,
+                                              src_ids->view(),
+                                              dst_ids->view(),
+                                              lookup_table->view());
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+std::unique_ptr<raft::handle_t> Tests_MGETLKeyRenumbering::handle_ = nullptr;
+
+TEST_P(Tests_MGETLKeyRenumbering, CheckInt32)
+{
+  run_current_test(GetParam(), cudf::type_id::INT32);
+}
+
+TEST_P(Tests_MGETLKeyRenumbering, CheckInt64)
+{
+  run_current_test(GetParam(), cudf::type_id::INT64);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MGETLKeyRenumbering,
+  ::testing::Values(
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::int64, 1024, 128, 0},
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::int64, 16384, 65536, 1},
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::string, 1024, 128, 0},
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::string, 16384, 65536, 1},
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::int32_string_pair, 1024, 128, 0},
+    KeyRenumbering_Usecase{cugraph::test::key_kind_t::int32_string_pair, 16384, 65536, 1}));
+
+INSTANTIATE_TEST_SUITE_P(
+  benchmark_test,
+  Tests_MGETLKeyRenumbering,
+  ::testing::Values(KeyRenumbering_Usecase{
+    cugraph::test::key_kind_t::string, size_t{1} << 24, size_t{1} << 22, 0, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
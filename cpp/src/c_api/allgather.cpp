@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,10 +28,16 @@
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <optional>
 
 namespace {
 
 struct create_allgather_functor : public cugraph::c_api::abstract_functor {
+  // only copies and gathers arrays, so any type combination is supported
+  static constexpr bool dispatch_all_type_combinations{true};
+
   raft::handle_t const& handle_;
   cugraph::c_api::cugraph_type_erased_device_array_view_t const* src_;
   cugraph::c_api::cugraph_type_erased_device_array_view_t const* dst_;
@@ -173,6 +179,77 @@ struct create_allgather_functor : public cugraph::c_api::abstract_functor {
   }
 };
 
+template <typename T>
+void gather_to_buffer(raft::handle_t const& handle,
+                      cugraph::c_api::cugraph_type_erased_device_array_view_t const* input,
+                      void* output,
+                      size_t output_size,
+                      size_t max_chunk_size,
+                      std::optional<int> root)
+{
+  cugraph::detail::device_gatherv_to_buffer(
+    handle,
+    handle.get_comms(),
+    raft::device_span<T const>(input->as_type<T>(), input->size_),
+    static_cast<T*>(output),
+    output_size,
+    max_chunk_size,
+    root);
+  handle.sync_stream();
+}
+
+cugraph_error_code_t gather_to_buffer(const cugraph_resource_handle_t* handle,
+                                      const cugraph_type_erased_device_array_view_t* input,
+                                      void* output,
+                                      size_t output_size,
+                                      size_t max_chunk_size,
+                                      std::optional<int> root,
+                                      cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto& local_handle{
+    *reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_};
+  auto p_input =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(input);
+
+  CAPI_EXPECTS(input != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: input should not be NULL.",
+               *error);
+  CAPI_EXPECTS(max_chunk_size > 0,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: max_chunk_size should be a positive integer.",
+               *error);
+
+  try {
+    switch (p_input->type_) {
+      case cugraph_data_type_id_t::INT32:
+        gather_to_buffer<int32_t>(local_handle, p_input, output, output_size, max_chunk_size, root);
+        break;
+      case cugraph_data_type_id_t::INT64:
+        gather_to_buffer<int64_t>(local_handle, p_input, output, output_size, max_chunk_size, root);
+        break;
+      case cugraph_data_type_id_t::FLOAT32:
+        gather_to_buffer<float>(local_handle, p_input, output, output_size, max_chunk_size, root);
+        break;
+      case cugraph_data_type_id_t::FLOAT64:
+        gather_to_buffer<double>(local_handle, p_input, output, output_size, max_chunk_size, root);
+        break;
+      default: {
+        *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t(
+          "Only INT32, INT64, FLOAT32 and FLOAT64 arrays are supported"));
+        return CUGRAPH_INVALID_INPUT;
+      }
+    }
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
 }  // namespace
 
 extern "C" cugraph_error_code_t cugraph_allgather(
@@ -280,3 +357,59 @@ extern "C" cugraph_error_code_t cugraph_allgather(
 
   return CUGRAPH_SUCCESS;
 }
+
+extern "C" cugraph_error_code_t cugraph_allgather_size(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* input,
+  size_t* gathered_size,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto& local_handle{
+    *reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_};
+  auto p_input =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(input);
+
+  CAPI_EXPECTS(input != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: input should not be NULL.",
+               *error);
+
+  try {
+    *gathered_size = cugraph::host_scalar_allreduce(local_handle.get_comms(),
+                                                    p_input->size_,
+                                                    raft::comms::op_t::SUM,
+                                                    local_handle.get_stream());
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_allgather_to_buffer(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* input,
+  size_t max_chunk_size,
+  void* output,
+  size_t output_size,
+  cugraph_error_t** error)
+{
+  return ::gather_to_buffer(
+    handle, input, output, output_size, max_chunk_size, std::nullopt, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_gather_to_buffer(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* input,
+  int root,
+  size_t max_chunk_size,
+  void* output,
+  size_t output_size,
+  cugraph_error_t** error)
+{
+  return ::gather_to_buffer(
+    handle, input, output, output_size, max_chunk_size, std::make_optional(root), error);
+}
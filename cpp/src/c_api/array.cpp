@@ -19,12 +19,41 @@
 #include "c_api/error.hpp"
 #include "c_api/resource_handle.hpp"
 
+#include <raft/util/cudart_utils.hpp>
+
+#include <cuda_runtime_api.h>
+
 namespace cugraph {
 namespace c_api {
 
 // FIXME: This is paired with type definition... better solution coming in 24.12 release.
 size_t data_type_sz[] = {1, 2, 4, 8, 1, 2, 4, 8, 4, 8, 8, 1};
 
+namespace {
+
+// Streams follow the __cuda_array_interface__ convention (see cugraph_c/array.h)
+cudaStream_t to_cuda_stream(uintptr_t stream)
+{
+  if (stream == 1) { return cudaStreamLegacy; }
+  if (stream == 2) { return cudaStreamPerThread; }
+  return reinterpret_cast<cudaStream_t>(stream);
+}
+
+// Order the work issued on consumer after the work already issued on producer, without blocking
+// the host
+void stream_wait(cudaStream_t consumer, cudaStream_t producer)
+{
+  if (consumer == producer) { return; }
+
+  cudaEvent_t event{};
+  RAFT_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  RAFT_CUDA_TRY(cudaEventRecord(event, producer));
+  RAFT_CUDA_TRY(cudaStreamWaitEvent(consumer, event, 0));
+  RAFT_CUDA_TRY(cudaEventDestroy(event));
+}
+
+}  // namespace
+
 }  // namespace c_api
 }  // namespace cugraph
 
@@ -358,7 +387,7 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_view_copy_to_ho
                       reinterpret_cast<byte_t const*>(internal_pointer->data_),
                       internal_pointer->num_bytes(),
                       p_handle->handle_->get_stream());
-    p_handle->handle_->sync_stream();
+    if (!p_handle->is_stream_ordered()) { p_handle->handle_->sync_stream(); }
 
     return CUGRAPH_SUCCESS;
   } catch (std::exception const& ex) {
@@ -432,3 +461,100 @@ extern "C" cugraph_error_code_t cugraph_type_erased_device_array_view_as_type(
     return CUGRAPH_INVALID_INPUT;
   }
 }
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_view_create_from_stream(
+  const cugraph_resource_handle_t* handle,
+  void* pointer,
+  size_t n_elems,
+  cugraph_data_type_id_t dtype,
+  uintptr_t stream,
+  cugraph_type_erased_device_array_view_t** view,
+  cugraph_error_t** error)
+{
+  *view  = nullptr;
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+
+    if (stream != 0) {
+      cugraph::c_api::stream_wait(p_handle->handle_->get_stream().value(),
+                                  cugraph::c_api::to_cuda_stream(stream));
+    }
+
+    *view = cugraph_type_erased_device_array_view_create(pointer, n_elems, dtype);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_view_export_to_stream(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_device_array_view_t* view,
+  uintptr_t stream,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+
+    if (stream != 0) {
+      cugraph::c_api::stream_wait(cugraph::c_api::to_cuda_stream(stream),
+                                  p_handle->handle_->get_stream().value());
+    } else {
+      p_handle->handle_->sync_stream();
+    }
+
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_free_on_stream(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  uintptr_t stream,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal_pointer =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(array);
+
+    // the device buffer is released in the order of the stream it was allocated on
+    if (stream != 0) {
+      cugraph::c_api::stream_wait(internal_pointer->data_.stream().value(),
+                                  cugraph::c_api::to_cuda_stream(stream));
+    }
+
+    delete internal_pointer;
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
@@ -30,11 +30,15 @@
 namespace cugraph {
 namespace c_api {
 
+struct cugraph_bfs_options_t {
+  cugraph::bfs_options_t options_{};
+};
+
 struct bfs_functor : public abstract_functor {
   raft::handle_t const& handle_;
   cugraph_graph_t* graph_;
   cugraph_type_erased_device_array_view_t* sources_;
-  bool direction_optimizing_;
+  cugraph::bfs_options_t options_;
   size_t depth_limit_;
   bool compute_predecessors_;
   bool do_expensive_check_;
@@ -43,7 +47,7 @@ struct bfs_functor : public abstract_functor {
   bfs_functor(::cugraph_resource_handle_t const* handle,
               ::cugraph_graph_t* graph,
               ::cugraph_type_erased_device_array_view_t* sources,
-              bool direction_optimizing,
+              cugraph::bfs_options_t const& options,
               size_t depth_limit,
               bool compute_predecessors,
               bool do_expensive_check)
@@ -51,7 +55,7 @@ struct bfs_functor : public abstract_functor {
       handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
       sources_(reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t*>(sources)),
-      direction_optimizing_(direction_optimizing),
+      options_(options),
       depth_limit_(depth_limit),
       compute_predecessors_(compute_predecessors),
       do_expensive_check_(do_expensive_check)
@@ -135,7 +139,7 @@ struct bfs_functor : public abstract_functor {
         compute_predecessors_ ? predecessors.data() : nullptr,
         sources.data(),
         sources.size(),
-        direction_optimizing_,
+        options_,
         static_cast<vertex_t>(depth_limit_),
         do_expensive_check_);
 
@@ -217,13 +221,90 @@ extern "C" cugraph_error_code_t cugraph_bfs(const cugraph_resource_handle_t* han
     "vertex type of graph and sources must match",
     *error);
 
-  cugraph::c_api::bfs_functor functor(handle,
-                                      graph,
-                                      sources,
-                                      direction_optimizing,
-                                      depth_limit,
-                                      compute_predecessors,
-                                      do_expensive_check);
+  cugraph::bfs_options_t options{};
+  options.direction_optimizing = direction_optimizing;
+
+  cugraph::c_api::bfs_functor functor(
+    handle, graph, sources, options, depth_limit, compute_predecessors, do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_bfs_options_create(cugraph_bfs_options_t** options,
+                                                           cugraph_error_t** error)
+{
+  *options = reinterpret_cast<cugraph_bfs_options_t*>(new cugraph::c_api::cugraph_bfs_options_t());
+  if (*options == nullptr) {
+    *error = reinterpret_cast<cugraph_error_t*>(
+      new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+    return CUGRAPH_INVALID_HANDLE;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" void cugraph_bfs_options_set_direction_optimizing(cugraph_bfs_options_t* options,
+                                                             bool_t value)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t*>(options);
+  internal_pointer->options_.direction_optimizing = (value == TRUE);
+}
+
+extern "C" void cugraph_bfs_options_set_alpha(cugraph_bfs_options_t* options, double value)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t*>(options);
+  internal_pointer->options_.alpha = value;
+}
+
+extern "C" void cugraph_bfs_options_set_beta(cugraph_bfs_options_t* options, double value)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t*>(options);
+  internal_pointer->options_.beta = value;
+}
+
+extern "C" void cugraph_bfs_options_set_auto_tune(cugraph_bfs_options_t* options,
+                                                  bool_t value,
+                                                  size_t num_levels)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t*>(options);
+  internal_pointer->options_.auto_tune        = (value == TRUE);
+  internal_pointer->options_.auto_tune_levels = num_levels;
+}
+
+extern "C" void cugraph_bfs_options_free(cugraph_bfs_options_t* options)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t*>(options);
+  delete internal_pointer;
+}
+
+extern "C" cugraph_error_code_t cugraph_bfs_with_options(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  cugraph_type_erased_device_array_view_t* sources,
+  const cugraph_bfs_options_t* options,
+  size_t depth_limit,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS(
+    reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(sources)
+        ->type_,
+    CUGRAPH_INVALID_INPUT,
+    "vertex type of graph and sources must match",
+    *error);
+  CAPI_EXPECTS(options != nullptr, CUGRAPH_INVALID_INPUT, "options must not be null", *error);
+
+  cugraph::c_api::bfs_functor functor(
+    handle,
+    graph,
+    sources,
+    reinterpret_cast<cugraph::c_api::cugraph_bfs_options_t const*>(options)->options_,
+    depth_limit,
+    compute_predecessors,
+    do_expensive_check);
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
@@ -18,10 +18,16 @@
 #include "structure/detail/structure_utils.cuh"
 
 #include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph.hpp>
 #include <cugraph/utilities/misc_utils.cuh>
 
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/replace.h>
 #include <thrust/sort.h>
+#include <thrust/tabulate.h>
 
 namespace cugraph {
 namespace c_api {
@@ -172,6 +178,114 @@ reorder_extracted_egonets(raft::handle_t const& handle,
                           rmm::device_uvector<int64_t>&& edge_dsts,
                           std::optional<rmm::device_uvector<double>>&& edge_weights);
 
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<edge_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<vertex_t>&& paths,
+                                      std::optional<rmm::device_uvector<weight_t>>&& weights,
+                                      size_t num_paths,
+                                      vertex_t padding_vertex,
+                                      bool compress_result)
+{
+  auto max_length = num_paths > 0 ? (paths.size() / num_paths - 1) : size_t{0};
+
+  rmm::device_uvector<edge_t> sizes(num_paths, handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    sizes.begin(),
+    sizes.end(),
+    [paths = paths.data(), max_length] __device__(size_t i) {
+      auto first = paths + i * (max_length + 1);
+      return static_cast<edge_t>(
+        thrust::count_if(thrust::seq, first, first + (max_length + 1), [](auto v) {
+          return v != invalid_vertex_id<vertex_t>::value;
+        }));
+    });
+
+  auto is_padded_weight = [paths = paths.data(), max_length] __device__(size_t i) {
+    return paths[(i / max_length) * (max_length + 1) + (i % max_length) + 1] ==
+           invalid_vertex_id<vertex_t>::value;
+  };
+
+  if (!weights) {
+    weights = rmm::device_uvector<weight_t>(num_paths * max_length, handle.get_stream());
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      (*weights).begin(),
+      (*weights).end(),
+      [is_padded_weight] __device__(size_t i) {
+        return is_padded_weight(i) ? weight_t{0} : weight_t{1};
+      });
+  }
+
+  if (compress_result) {
+    (*weights).resize(
+      thrust::distance((*weights).begin(),
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         (*weights).begin(),
+                                         (*weights).end(),
+                                         thrust::make_counting_iterator(size_t{0}),
+                                         is_padded_weight)),
+      handle.get_stream());
+    paths.resize(thrust::distance(paths.begin(),
+                                  thrust::remove(handle.get_thrust_policy(),
+                                                 paths.begin(),
+                                                 paths.end(),
+                                                 invalid_vertex_id<vertex_t>::value)),
+                 handle.get_stream());
+  } else {
+    thrust::replace(handle.get_thrust_policy(),
+                    paths.begin(),
+                    paths.end(),
+                    invalid_vertex_id<vertex_t>::value,
+                    padding_vertex);
+  }
+
+  return std::make_tuple(std::move(paths), std::move(*weights), std::move(sizes));
+}
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<int32_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<int32_t>&& paths,
+                                      std::optional<rmm::device_uvector<float>>&& weights,
+                                      size_t num_paths,
+                                      int32_t padding_vertex,
+                                      bool compress_result);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<int32_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<int32_t>&& paths,
+                                      std::optional<rmm::device_uvector<double>>&& weights,
+                                      size_t num_paths,
+                                      int32_t padding_vertex,
+                                      bool compress_result);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<int64_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<int64_t>&& paths,
+                                      std::optional<rmm::device_uvector<float>>&& weights,
+                                      size_t num_paths,
+                                      int64_t padding_vertex,
+                                      bool compress_result);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<int64_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<int64_t>&& paths,
+                                      std::optional<rmm::device_uvector<double>>&& weights,
+                                      size_t num_paths,
+                                      int64_t padding_vertex,
+                                      bool compress_result);
+
 }  // namespace detail
 }  // namespace c_api
 }  // namespace cugraph
@@ -20,6 +20,7 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
 #include <tuple>
 
 namespace cugraph {
@@ -49,6 +50,21 @@ reorder_extracted_egonets(raft::handle_t const& handle,
                           rmm::device_uvector<vertex_t>&& edge_dsts,
                           std::optional<rmm::device_uvector<weight_t>>&& edge_weights);
 
+// Convert the random walk output (num_paths x (max_length + 1) vertex paths padded with invalid
+// vertex IDs and optional num_paths x max_length edge weights) to the legacy random walk output
+// format (vertex paths padded with padding_vertex or compressed, edge weights of 1 for unweighted
+// graphs, and path sizes)
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<edge_t>>
+convert_random_walks_to_legacy_format(raft::handle_t const& handle,
+                                      rmm::device_uvector<vertex_t>&& paths,
+                                      std::optional<rmm::device_uvector<weight_t>>&& weights,
+                                      size_t num_paths,
+                                      vertex_t padding_vertex,
+                                      bool compress_result);
+
 }  // namespace detail
 }  // namespace c_api
 }  // namespace cugraph
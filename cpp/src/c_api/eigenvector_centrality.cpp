@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <cugraph_c/algorithms.h>
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
@@ -33,19 +34,30 @@ namespace {
 struct eigenvector_centrality_functor : public cugraph::c_api::abstract_functor {
   raft::handle_t const& handle_;
   cugraph::c_api::cugraph_graph_t* graph_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_guess_vertices_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_guess_values_{};
   double epsilon_{};
   size_t max_iterations_{};
   bool do_expensive_check_{};
   cugraph::c_api::cugraph_centrality_result_t* result_{};
 
-  eigenvector_centrality_functor(cugraph_resource_handle_t const* handle,
-                                 cugraph_graph_t* graph,
-                                 double epsilon,
-                                 size_t max_iterations,
-                                 bool do_expensive_check)
+  eigenvector_centrality_functor(
+    cugraph_resource_handle_t const* handle,
+    cugraph_graph_t* graph,
+    cugraph_type_erased_device_array_view_t const* initial_guess_vertices,
+    cugraph_type_erased_device_array_view_t const* initial_guess_values,
+    double epsilon,
+    size_t max_iterations,
+    bool do_expensive_check)
     : abstract_functor(),
       handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      initial_guess_vertices_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_guess_vertices)),
+      initial_guess_values_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_guess_values)),
       epsilon_(epsilon),
       max_iterations_(max_iterations),
       do_expensive_check_(do_expensive_check)
@@ -83,11 +95,42 @@ struct eigenvector_centrality_functor : public cugraph::c_api::abstract_functor
 
       auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
 
+      std::optional<rmm::device_uvector<weight_t>> initial_centralities{std::nullopt};
+      if (initial_guess_values_ != nullptr) {
+        rmm::device_uvector<vertex_t> initial_guess_vertices(initial_guess_vertices_->size_,
+                                                             handle_.get_stream());
+        rmm::device_uvector<weight_t> initial_guess_values(initial_guess_values_->size_,
+                                                           handle_.get_stream());
+
+        raft::copy(initial_guess_vertices.data(),
+                   initial_guess_vertices_->as_type<vertex_t>(),
+                   initial_guess_vertices.size(),
+                   handle_.get_stream());
+
+        raft::copy(initial_guess_values.data(),
+                   initial_guess_values_->as_type<weight_t>(),
+                   initial_guess_values.size(),
+                   handle_.get_stream());
+
+        initial_centralities = cugraph::detail::
+          collect_local_vertex_values_from_ext_vertex_value_pairs<vertex_t, weight_t, multi_gpu>(
+            handle_,
+            std::move(initial_guess_vertices),
+            std::move(initial_guess_values),
+            *number_map,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            weight_t{0},
+            do_expensive_check_);
+      }
+
       auto centralities = cugraph::eigenvector_centrality<vertex_t, edge_t, weight_t, multi_gpu>(
         handle_,
         graph_view,
         (edge_weights != nullptr) ? std::make_optional(edge_weights->view()) : std::nullopt,
-        std::optional<raft::device_span<weight_t>>{},
+        initial_centralities ? std::make_optional(raft::device_span<weight_t const>{
+                                 (*initial_centralities).data(), (*initial_centralities).size()})
+                             : std::nullopt,
         static_cast<weight_t>(epsilon_),
         max_iterations_,
         do_expensive_check_);
@@ -115,7 +158,50 @@ extern "C" cugraph_error_code_t cugraph_eigenvector_centrality(
   cugraph_error_t** error)
 {
   eigenvector_centrality_functor functor(
-    handle, graph, epsilon, max_iterations, do_expensive_check);
+    handle, graph, nullptr, nullptr, epsilon, max_iterations, do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_eigenvector_centrality_with_initial_guess(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_guess_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_guess_values,
+  double epsilon,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_centrality_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS((initial_guess_vertices == nullptr) == (initial_guess_values == nullptr),
+               CUGRAPH_INVALID_INPUT,
+               "initial_guess_vertices and initial_guess_values should be both set or both NULL",
+               *error);
+  if (initial_guess_vertices != nullptr) {
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_guess_vertices)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_guess_vertices must match",
+                 *error);
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->weight_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_guess_values)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "weight type of graph and initial_guess_values must match",
+                 *error);
+  }
+
+  eigenvector_centrality_functor functor(handle,
+                                         graph,
+                                         initial_guess_vertices,
+                                         initial_guess_values,
+                                         epsilon,
+                                         max_iterations,
+                                         do_expensive_check);
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
@@ -18,7 +18,10 @@
 
 #include <cugraph_c/resource_handle.h>
 
+#include <cugraph/utilities/graph_traits.hpp>
+
 #include <sstream>
+#include <type_traits>
 
 namespace cugraph {
 namespace c_api {
@@ -75,6 +78,29 @@ constexpr decltype(auto) multi_gpu_dispatcher(bool multi_gpu, functor_t& functor
   }
 }
 
+// Functors are only instantiated for the type combinations the library is instantiated for
+// (cugraph::is_candidate), the other combinations call functor.unsupported().  Without this
+// filter every functor would be instantiated for every vertex/edge/weight type combination only
+// to discard the body of the unsupported ones, which costs compile time and library size.
+// Functors that only move data around (and so support any combination) opt out by defining
+//   static constexpr bool dispatch_all_type_combinations{true};
+//
+template <typename functor_t, typename = void>
+struct dispatches_all_type_combinations : std::false_type {};
+
+template <typename functor_t>
+struct dispatches_all_type_combinations<
+  functor_t,
+  std::void_t<decltype(functor_t::dispatch_all_type_combinations)>>
+  : std::bool_constant<functor_t::dispatch_all_type_combinations> {};
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename functor_t>
+constexpr bool is_dispatched_type_combination()
+{
+  return dispatches_all_type_combinations<functor_t>::value ||
+         cugraph::is_candidate<vertex_t, edge_t, weight_t>::value;
+}
+
 // transpose bool dispatcher:
 // resolves bool `store_transpose`
 // and using template arguments vertex_t, edge_t, weight_t
@@ -112,8 +138,12 @@ constexpr decltype(auto) edge_type_type_dispatcher(cugraph_data_type_id_t edge_t
   switch (edge_type_type) {
     case cugraph_data_type_id_t::INT32: {
       using edge_type_t = int32_t;
-      return transpose_dispatcher<vertex_t, edge_t, weight_t, edge_type_t>(
-        store_transposed, multi_gpu, functor);
+      if constexpr (is_dispatched_type_combination<vertex_t, edge_t, weight_t, functor_t>()) {
+        return transpose_dispatcher<vertex_t, edge_t, weight_t, edge_type_t>(
+          store_transposed, multi_gpu, functor);
+      } else {
+        return functor.unsupported();
+      }
     }
     case cugraph_data_type_id_t::INT64: {
       throw std::runtime_error(
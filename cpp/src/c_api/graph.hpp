@@ -24,6 +24,9 @@
 #include <cugraph/graph_functions.hpp>
 
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 
 namespace cugraph {
 namespace c_api {
@@ -53,6 +56,27 @@ struct cugraph_graph_t {
   void* edge_end_times_;    // edge_property_t<
                             //    graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
                             //    edge_time_t>*
+
+  // If cache_transposed_storage_ is set, transpose_storage keeps the graph in the other storage
+  // format (with its own number map and edge weights) instead of discarding it, so algorithms
+  // requiring different storage formats can alternate on the same graph without conversions.
+  bool cache_transposed_storage_{false};
+  void* transposed_graph_{nullptr};         // graph_t<..., !store_transposed, multi_gpu>*
+  void* transposed_number_map_{nullptr};    // rmm::device_uvector<vertex_t>*
+  void* transposed_edge_weights_{nullptr};  // edge_property_t<
+                                            //    graph_view_t<vertex_t, edge_t,
+                                            //                 !store_transposed, multi_gpu>,
+                                            //    weight_t>*
+
+  // Sums of the out-going edge weights of the local vertices in the current storage format,
+  // computed on the first request (e.g. by PageRank) and reused by the later calls on this graph.
+  // The edges and edge weights of a graph do not change, but the vertices may be renumbered when
+  // the storage format changes, so transpose_storage discards the cached sums.
+  void* vertex_out_weight_sums_{nullptr};  // rmm::device_uvector<weight_t>*
+
+  // Algorithms only read the graph, but concurrent calls on the same graph may race on the lazy
+  // updates above (storage conversion and cached sums), mutex_ serializes these updates.
+  std::mutex mutex_{};
 };
 
 template <typename vertex_t,
@@ -64,6 +88,8 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
                                        cugraph_graph_t* graph,
                                        cugraph_error_t* error)
 {
+  std::lock_guard<std::mutex> lock(graph->mutex_);
+
   if (store_transposed == graph->store_transposed_) {
     if ((graph->edge_ids_ != nullptr) || (graph->edge_types_ != nullptr)) {
       error->error_message_ =
@@ -71,12 +97,61 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
       return CUGRAPH_NOT_IMPLEMENTED;
     }
 
+    if (graph->vertex_out_weight_sums_ != nullptr) {
+      delete reinterpret_cast<rmm::device_uvector<weight_t>*>(graph->vertex_out_weight_sums_);
+      graph->vertex_out_weight_sums_ = nullptr;
+    }
+
+    if (graph->transposed_graph_ != nullptr) {
+      // the other storage format is cached, swap
+      std::swap(graph->graph_, graph->transposed_graph_);
+      std::swap(graph->number_map_, graph->transposed_number_map_);
+      std::swap(graph->edge_weights_, graph->transposed_edge_weights_);
+      graph->store_transposed_ = !store_transposed;
+
+      return CUGRAPH_SUCCESS;
+    }
+
     auto p_graph =
       reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu>*>(
         graph->graph_);
 
     auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->number_map_);
 
+    if (graph->cache_transposed_storage_) {
+      auto edge_weights = reinterpret_cast<
+        edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>*>(
+        graph->edge_weights_);
+
+      auto [graph_transposed, new_optional_edge_weights, new_number_map] =
+        cugraph::transpose_graph_storage(
+          handle,
+          p_graph->view(),
+          edge_weights ? std::make_optional(edge_weights->view()) : std::nullopt,
+          std::make_optional<raft::device_span<vertex_t const>>(number_map->data(),
+                                                                number_map->size()));
+      // the later calls (possibly using other streams) read the new storage without stream
+      // ordering
+      handle.sync_stream();
+
+      graph->transposed_graph_        = graph->graph_;
+      graph->transposed_number_map_   = graph->number_map_;
+      graph->transposed_edge_weights_ = graph->edge_weights_;
+
+      graph->graph_ = new cugraph::graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>(
+        std::move(graph_transposed));
+      graph->number_map_   = new rmm::device_uvector<vertex_t>(std::move(*new_number_map));
+      graph->edge_weights_ = nullptr;
+      if (new_optional_edge_weights) {
+        graph->edge_weights_ = new cugraph::edge_property_t<
+          cugraph::graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+          weight_t>(std::move(*new_optional_edge_weights));
+      }
+      graph->store_transposed_ = !store_transposed;
+
+      return CUGRAPH_SUCCESS;
+    }
+
     auto optional_edge_weights = std::optional<
       edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>(
       std::nullopt);
@@ -106,6 +181,8 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
         std::make_optional<rmm::device_uvector<vertex_t>>(std::move(*number_map)));
 
     *number_map = std::move(new_number_map.value());
+    // the later calls (possibly using other streams) read the new storage without stream ordering
+    handle.sync_stream();
 
     delete p_graph;
 
@@ -29,6 +29,8 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <algorithm>
+
 namespace {
 
 struct create_vertex_pairs_functor : public cugraph::c_api::abstract_functor {
@@ -180,11 +182,13 @@ struct two_hop_neighbors_functor : public cugraph::c_api::abstract_functor {
                                        graph_view.local_vertex_partition_range_first());
       }
 
-      auto [offsets, dst] = cugraph::k_hop_nbrs(
+      // bound the intermediate (start vertex, neighbor) pairs held at a time by the number of
+      // edges in the graph (hub-adjacent start vertices would otherwise exhaust device memory)
+      auto [offsets, dst] = cugraph::two_hop_nbrs(
         handle_,
         graph_view,
         raft::device_span<vertex_t const>{start_vertices.data(), start_vertices.size()},
-        size_t{2},
+        std::max(static_cast<size_t>(graph_view.compute_number_of_edges(handle_)), size_t{1}),
         do_expensive_check_);
 
       auto src = cugraph::c_api::expand_sparse_offsets(
@@ -28,6 +28,7 @@
 #include <cugraph/graph_functions.hpp>
 
 #include <limits>
+#include <mutex>
 
 namespace {
 
@@ -546,21 +547,122 @@ struct create_graph_csr_functor : public cugraph::c_api::abstract_functor {
   }
 };
 
+struct create_graph_csr_view_functor : public cugraph::c_api::abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_properties_t const* properties_;
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* offsets_;
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* indices_;
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* weights_;
+  bool_t sorted_by_degree_;
+  bool_t do_expensive_check_;
+  cugraph::c_api::cugraph_graph_t* result_{};
+
+  create_graph_csr_view_functor(
+    raft::handle_t const& handle,
+    cugraph_graph_properties_t const* properties,
+    cugraph::c_api::cugraph_type_erased_device_array_view_t const* offsets,
+    cugraph::c_api::cugraph_type_erased_device_array_view_t const* indices,
+    cugraph::c_api::cugraph_type_erased_device_array_view_t const* weights,
+    bool_t sorted_by_degree,
+    bool_t do_expensive_check)
+    : abstract_functor(),
+      handle_(handle),
+      properties_(properties),
+      offsets_(offsets),
+      indices_(indices),
+      weights_(weights),
+      sorted_by_degree_(sorted_by_degree),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      raft::device_span<edge_t const> offsets{offsets_->as_type<edge_t>(), offsets_->size_};
+      raft::device_span<vertex_t const> indices{indices_->as_type<vertex_t>(), indices_->size_};
+
+      cugraph::graph_meta_t<vertex_t, edge_t, multi_gpu> meta{
+        static_cast<vertex_t>(offsets_->size_ - 1),
+        cugraph::graph_properties_t{properties_->is_symmetric, properties_->is_multigraph},
+        std::nullopt,
+        std::nullopt};
+      if (sorted_by_degree_) {
+        meta.segment_offsets = cugraph::compute_sorted_degree_segment_offsets<vertex_t, edge_t>(
+          handle_, offsets, do_expensive_check_);
+      }
+
+      auto graph = new cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(
+        handle_, offsets, indices, meta, do_expensive_check_);
+
+      // the vertices are not renumbered
+      auto number_map = new rmm::device_uvector<vertex_t>(meta.number_of_vertices,
+                                                          handle_.get_stream());
+      cugraph::detail::sequence_fill(
+        handle_.get_stream(), number_map->data(), number_map->size(), vertex_t{0});
+
+      cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+                               weight_t>* edge_weights{nullptr};
+      if (weights_) {
+        // FIXME: edge properties always own their buffers, so the weights are still copied
+        std::vector<rmm::device_uvector<weight_t>> buffers{};
+        buffers.emplace_back(weights_->size_, handle_.get_stream());
+        raft::copy(
+          buffers[0].data(), weights_->as_type<weight_t>(), weights_->size_, handle_.get_stream());
+        edge_weights = new cugraph::edge_property_t<
+          cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+          weight_t>(std::move(buffers));
+      }
+
+      auto result = new cugraph::c_api::cugraph_graph_t{
+        indices_->type_,
+        offsets_->type_,
+        weights_ ? weights_->type_ : cugraph_data_type_id_t::FLOAT32,
+        cugraph_data_type_id_t::INT32,
+        store_transposed,
+        multi_gpu,
+        graph,
+        number_map,
+        edge_weights,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr};
+
+      result_ = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(result);
+    }
+  }
+};
+
 struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
   void* graph_;
   void* number_map_;
   void* edge_weights_;
   void* edge_ids_;
   void* edge_types_;
-
-  destroy_graph_functor(
-    void* graph, void* number_map, void* edge_weights, void* edge_ids, void* edge_types)
+  void* vertex_out_weight_sums_;
+
+  destroy_graph_functor(void* graph,
+                        void* number_map,
+                        void* edge_weights,
+                        void* edge_ids,
+                        void* edge_types,
+                        void* vertex_out_weight_sums = nullptr)
     : abstract_functor(),
       graph_(graph),
       number_map_(number_map),
       edge_weights_(edge_weights),
       edge_ids_(edge_ids),
-      edge_types_(edge_types)
+      edge_types_(edge_types),
+      vertex_out_weight_sums_(vertex_out_weight_sums)
   {
   }
 
@@ -596,9 +698,36 @@ struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
       cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>,
                                edge_type_t>*>(edge_types_);
     if (internal_edge_type_pointer) { delete internal_edge_type_pointer; }
+
+    auto internal_vertex_out_weight_sums_pointer =
+      reinterpret_cast<rmm::device_uvector<weight_t>*>(vertex_out_weight_sums_);
+    if (internal_vertex_out_weight_sums_pointer) { delete internal_vertex_out_weight_sums_pointer; }
   }
 };
 
+void free_transposed_storage(cugraph::c_api::cugraph_graph_t* graph)
+{
+  if (graph->transposed_graph_ != nullptr) {
+    destroy_graph_functor functor(graph->transposed_graph_,
+                                  graph->transposed_number_map_,
+                                  graph->transposed_edge_weights_,
+                                  nullptr,
+                                  nullptr);
+
+    cugraph::c_api::vertex_dispatcher(graph->vertex_type_,
+                                      graph->edge_type_,
+                                      graph->weight_type_,
+                                      graph->edge_type_id_type_,
+                                      !graph->store_transposed_,
+                                      graph->multi_gpu_,
+                                      functor);
+
+    graph->transposed_graph_        = nullptr;
+    graph->transposed_number_map_   = nullptr;
+    graph->transposed_edge_weights_ = nullptr;
+  }
+}
+
 }  // namespace
 
 extern "C" cugraph_error_code_t cugraph_graph_create_sg(
@@ -845,16 +974,88 @@ cugraph_error_code_t cugraph_graph_create_sg_from_csr(
   return CUGRAPH_SUCCESS;
 }
 
+extern "C" cugraph_error_code_t cugraph_graph_create_sg_view_from_csr(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_graph_properties_t* properties,
+  const cugraph_type_erased_device_array_view_t* offsets,
+  const cugraph_type_erased_device_array_view_t* indices,
+  const cugraph_type_erased_device_array_view_t* weights,
+  bool_t store_transposed,
+  bool_t sorted_by_degree,
+  bool_t do_expensive_check,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error)
+{
+  constexpr bool multi_gpu = false;
+
+  *graph = nullptr;
+  *error = nullptr;
+
+  auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+  auto p_offsets =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(offsets);
+  auto p_indices =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(indices);
+  auto p_weights =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(weights);
+
+  CAPI_EXPECTS(p_offsets->size_ > 0,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: offsets should not be empty.",
+               *error);
+
+  CAPI_EXPECTS((weights == nullptr) || (p_weights->size_ == p_indices->size_),
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: indices size != weights size.",
+               *error);
+
+  cugraph_data_type_id_t weight_type =
+    (weights != nullptr) ? p_weights->type_ : cugraph_data_type_id_t::FLOAT32;
+
+  ::create_graph_csr_view_functor functor(*p_handle->handle_,
+                                          properties,
+                                          p_offsets,
+                                          p_indices,
+                                          p_weights,
+                                          sorted_by_degree,
+                                          do_expensive_check);
+
+  try {
+    cugraph::c_api::vertex_dispatcher(p_indices->type_,
+                                      p_offsets->type_,
+                                      weight_type,
+                                      cugraph_data_type_id_t::INT32,
+                                      store_transposed,
+                                      multi_gpu,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *graph = reinterpret_cast<cugraph_graph_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
 extern "C" void cugraph_graph_free(cugraph_graph_t* ptr_graph)
 {
   if (ptr_graph != NULL) {
     auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(ptr_graph);
 
+    free_transposed_storage(internal_pointer);
+
     destroy_graph_functor functor(internal_pointer->graph_,
                                   internal_pointer->number_map_,
                                   internal_pointer->edge_weights_,
                                   internal_pointer->edge_ids_,
-                                  internal_pointer->edge_types_);
+                                  internal_pointer->edge_types_,
+                                  internal_pointer->vertex_out_weight_sums_);
 
     cugraph::c_api::vertex_dispatcher(internal_pointer->vertex_type_,
                                       internal_pointer->edge_type_,
@@ -867,3 +1068,22 @@ extern "C" void cugraph_graph_free(cugraph_graph_t* ptr_graph)
     delete internal_pointer;
   }
 }
+
+extern "C" cugraph_error_code_t cugraph_graph_set_cache_transposed_storage(
+  cugraph_graph_t* graph, bool_t cache_transposed_storage, cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+  try {
+    std::lock_guard<std::mutex> lock(internal_pointer->mutex_);
+    internal_pointer->cache_transposed_storage_ = cache_transposed_storage;
+    if (!cache_transposed_storage) { free_transposed_storage(internal_pointer); }
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
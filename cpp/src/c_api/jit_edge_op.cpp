@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_api/abstract_functor.hpp"
+#include "c_api/edgelist.hpp"
+#include "c_api/graph.hpp"
+#include "c_api/resource_handle.hpp"
+#include "c_api/utils.hpp"
+#include "jit/jit_edge_op.hpp"
+
+#include <cugraph_c/graph_functions.h>
+
+#include <cugraph/graph_functions.hpp>
+
+#include <optional>
+#include <string>
+
+namespace cugraph {
+namespace c_api {
+
+struct cugraph_jit_edge_op_result_t {
+  cugraph_type_erased_device_array_t* vertex_ids_{};
+  cugraph_type_erased_device_array_t* values_{};
+};
+
+}  // namespace c_api
+}  // namespace cugraph
+
+namespace {
+
+// reduces with + if init is std::nullopt and with the user-defined reduce_op otherwise
+struct jit_reduce_outgoing_edge_op_functor : public cugraph::c_api::abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph::c_api::cugraph_graph_t* graph_{};
+  std::string edge_op_source_{};
+  std::optional<double> init_{};
+  bool do_expensive_check_{};
+  cugraph::c_api::cugraph_jit_edge_op_result_t* result_{};
+
+  jit_reduce_outgoing_edge_op_functor(cugraph_resource_handle_t const* handle,
+                                      cugraph_graph_t* graph,
+                                      char const* edge_op_source,
+                                      std::optional<double> init,
+                                      bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      edge_op_source_(edge_op_source),
+      init_(init),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // the outgoing edges are reduced by the major, expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>*>(graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto edge_weights = reinterpret_cast<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                                 weight_t>*>(graph_->edge_weights_);
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      auto edge_weight_view =
+        (edge_weights != nullptr) ? std::make_optional(edge_weights->view()) : std::nullopt;
+      auto values =
+        init_ ? cugraph::jit::reduce_outgoing_edge_op<vertex_t, edge_t, weight_t, multi_gpu>(
+                  handle_, graph_view, edge_weight_view, edge_op_source_, *init_)
+              : cugraph::jit::sum_outgoing_edge_op<vertex_t, edge_t, weight_t, multi_gpu>(
+                  handle_, graph_view, edge_weight_view, edge_op_source_);
+
+      rmm::device_uvector<vertex_t> vertex_ids(graph_view.local_vertex_partition_range_size(),
+                                               handle_.get_stream());
+      raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
+
+      result_ = new cugraph::c_api::cugraph_jit_edge_op_result_t{
+        new cugraph::c_api::cugraph_type_erased_device_array_t(vertex_ids, graph_->vertex_type_),
+        new cugraph::c_api::cugraph_type_erased_device_array_t(values, FLOAT64)};
+    }
+  }
+};
+
+struct jit_transform_edge_op_functor : public cugraph::c_api::abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph::c_api::cugraph_graph_t* graph_{};
+  std::string edge_op_source_{};
+  bool do_expensive_check_{};
+  cugraph::c_api::cugraph_edgelist_t* result_{};
+
+  jit_transform_edge_op_functor(cugraph_resource_handle_t const* handle,
+                                cugraph_graph_t* graph,
+                                char const* edge_op_source,
+                                bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      edge_op_source_(edge_op_source),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // the edge operator takes (major, minor) as (src, dst), expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>*>(graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto edge_weights = reinterpret_cast<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                                 weight_t>*>(graph_->edge_weights_);
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      auto edge_values = cugraph::jit::transform_edge_op<vertex_t, edge_t, weight_t, multi_gpu>(
+        handle_,
+        graph_view,
+        (edge_weights != nullptr) ? std::make_optional(edge_weights->view()) : std::nullopt,
+        edge_op_source_);
+
+      auto [result_src, result_dst, result_values, result_edge_id, result_edge_type] =
+        cugraph::decompress_to_edgelist<vertex_t, edge_t, double, int32_t, false, multi_gpu>(
+          handle_,
+          graph_view,
+          std::make_optional(edge_values.view()),
+          std::nullopt,
+          std::nullopt,
+          (number_map != nullptr) ? std::make_optional<raft::device_span<vertex_t const>>(
+                                      number_map->data(), number_map->size())
+                                  : std::nullopt,
+          do_expensive_check_);
+
+      result_ = new cugraph::c_api::cugraph_edgelist_t{
+        new cugraph::c_api::cugraph_type_erased_device_array_t(result_src, graph_->vertex_type_),
+        new cugraph::c_api::cugraph_type_erased_device_array_t(result_dst, graph_->vertex_type_),
+        new cugraph::c_api::cugraph_type_erased_device_array_t(*result_values, FLOAT64),
+        NULL,
+        NULL,
+        NULL};
+    }
+  }
+};
+
+}  // namespace
+
+extern "C" cugraph_error_code_t cugraph_jit_sum_outgoing_edge_op(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const char* edge_op_source,
+  bool_t do_expensive_check,
+  cugraph_jit_edge_op_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS(edge_op_source != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: edge_op_source should not be NULL.",
+               *error);
+
+  jit_reduce_outgoing_edge_op_functor functor(
+    handle, graph, edge_op_source, std::nullopt, do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_jit_reduce_outgoing_edge_op(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const char* edge_op_source,
+  double init,
+  bool_t do_expensive_check,
+  cugraph_jit_edge_op_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS(edge_op_source != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: edge_op_source should not be NULL.",
+               *error);
+
+  jit_reduce_outgoing_edge_op_functor functor(
+    handle, graph, edge_op_source, std::make_optional(init), do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_jit_transform_edge_op(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const char* edge_op_source,
+  bool_t do_expensive_check,
+  cugraph_edgelist_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS(edge_op_source != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: edge_op_source should not be NULL.",
+               *error);
+
+  jit_transform_edge_op_functor functor(handle, graph, edge_op_source, do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_type_erased_device_array_view_t* cugraph_jit_edge_op_result_get_vertices(
+  cugraph_jit_edge_op_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_jit_edge_op_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_view_t*>(
+    internal_pointer->vertex_ids_->view());
+}
+
+extern "C" cugraph_type_erased_device_array_view_t* cugraph_jit_edge_op_result_get_values(
+  cugraph_jit_edge_op_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_jit_edge_op_result_t*>(result);
+  return reinterpret_cast<cugraph_type_erased_device_array_view_t*>(
+    internal_pointer->values_->view());
+}
+
+extern "C" void cugraph_jit_edge_op_result_free(cugraph_jit_edge_op_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_jit_edge_op_result_t*>(result);
+  delete internal_pointer->vertex_ids_;
+  delete internal_pointer->values_;
+  delete internal_pointer;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,6 +35,8 @@ struct katz_functor : public cugraph::c_api::abstract_functor {
   raft::handle_t const& handle_;
   cugraph::c_api::cugraph_graph_t* graph_{};
   cugraph::c_api::cugraph_type_erased_device_array_view_t const* betas_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_guess_vertices_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_guess_values_{};
   double alpha_{};
   double beta_{};
   double epsilon_{};
@@ -45,6 +47,8 @@ struct katz_functor : public cugraph::c_api::abstract_functor {
   katz_functor(cugraph_resource_handle_t const* handle,
                cugraph_graph_t* graph,
                cugraph_type_erased_device_array_view_t const* betas,
+               cugraph_type_erased_device_array_view_t const* initial_guess_vertices,
+               cugraph_type_erased_device_array_view_t const* initial_guess_values,
                double alpha,
                double beta,
                double epsilon,
@@ -55,6 +59,12 @@ struct katz_functor : public cugraph::c_api::abstract_functor {
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
       betas_(
         reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(betas)),
+      initial_guess_vertices_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_guess_vertices)),
+      initial_guess_values_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_guess_values)),
       alpha_(alpha),
       beta_(beta),
       epsilon_(epsilon),
@@ -121,6 +131,34 @@ struct katz_functor : public cugraph::c_api::abstract_functor {
             do_expensive_check_);
       }
 
+      if (initial_guess_values_ != nullptr) {
+        rmm::device_uvector<vertex_t> initial_guess_vertices(initial_guess_vertices_->size_,
+                                                             handle_.get_stream());
+        rmm::device_uvector<weight_t> initial_guess_values(initial_guess_values_->size_,
+                                                           handle_.get_stream());
+
+        raft::copy(initial_guess_vertices.data(),
+                   initial_guess_vertices_->as_type<vertex_t>(),
+                   initial_guess_vertices.size(),
+                   handle_.get_stream());
+
+        raft::copy(initial_guess_values.data(),
+                   initial_guess_values_->as_type<weight_t>(),
+                   initial_guess_values.size(),
+                   handle_.get_stream());
+
+        centralities = cugraph::detail::
+          collect_local_vertex_values_from_ext_vertex_value_pairs<vertex_t, weight_t, multi_gpu>(
+            handle_,
+            std::move(initial_guess_vertices),
+            std::move(initial_guess_values),
+            *number_map,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            weight_t{0},
+            do_expensive_check_);
+      }
+
       cugraph::katz_centrality<vertex_t, edge_t, weight_t, weight_t, multi_gpu>(
         handle_,
         graph_view,
@@ -131,7 +169,7 @@ struct katz_functor : public cugraph::c_api::abstract_functor {
         static_cast<weight_t>(beta_),
         static_cast<weight_t>(epsilon_),
         max_iterations_,
-        false,
+        initial_guess_values_ != nullptr,
         true,
         do_expensive_check_);
 
@@ -160,8 +198,65 @@ extern "C" cugraph_error_code_t cugraph_katz_centrality(
   cugraph_centrality_result_t** result,
   cugraph_error_t** error)
 {
-  katz_functor functor(
-    handle, graph, nullptr, alpha, beta, epsilon, max_iterations, do_expensive_check);
+  katz_functor functor(handle,
+                       graph,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       alpha,
+                       beta,
+                       epsilon,
+                       max_iterations,
+                       do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_katz_centrality_with_initial_guess(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* betas,
+  const cugraph_type_erased_device_array_view_t* initial_guess_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_guess_values,
+  double alpha,
+  double beta,
+  double epsilon,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_centrality_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS((initial_guess_vertices == nullptr) == (initial_guess_values == nullptr),
+               CUGRAPH_INVALID_INPUT,
+               "initial_guess_vertices and initial_guess_values should be both set or both NULL",
+               *error);
+  if (initial_guess_vertices != nullptr) {
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_guess_vertices)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_guess_vertices must match",
+                 *error);
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->weight_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_guess_values)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "weight type of graph and initial_guess_values must match",
+                 *error);
+  }
+
+  katz_functor functor(handle,
+                       graph,
+                       betas,
+                       initial_guess_vertices,
+                       initial_guess_values,
+                       alpha,
+                       beta,
+                       epsilon,
+                       max_iterations,
+                       do_expensive_check);
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_api/abstract_functor.hpp"
+#include "c_api/graph.hpp"
+#include "c_api/labeling_result.hpp"
+#include "c_api/random.hpp"
+#include "c_api/resource_handle.hpp"
+#include "c_api/utils.hpp"
+
+#include <cugraph_c/community_algorithms.h>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_functions.hpp>
+
+#include <optional>
+
+namespace {
+
+struct label_propagation_functor : public cugraph::c_api::abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph::c_api::cugraph_rng_state_t* rng_state_{nullptr};
+  cugraph::c_api::cugraph_graph_t* graph_{nullptr};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_label_vertices_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_labels_{};
+  bool semi_synchronous_{false};
+  size_t max_iterations_{100};
+  bool do_expensive_check_{false};
+  cugraph::c_api::cugraph_labeling_result_t* result_{};
+
+  label_propagation_functor(::cugraph_resource_handle_t const* handle,
+                            ::cugraph_rng_state_t* rng_state,
+                            ::cugraph_graph_t* graph,
+                            ::cugraph_type_erased_device_array_view_t const* initial_label_vertices,
+                            ::cugraph_type_erased_device_array_view_t const* initial_labels,
+                            bool semi_synchronous,
+                            size_t max_iterations,
+                            bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      rng_state_(reinterpret_cast<cugraph::c_api::cugraph_rng_state_t*>(rng_state)),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      initial_label_vertices_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_label_vertices)),
+      initial_labels_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_labels)),
+      semi_synchronous_(semi_synchronous),
+      max_iterations_(max_iterations),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      // label propagation expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>*>(graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto edge_weights = reinterpret_cast<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                                 weight_t>*>(graph_->edge_weights_);
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      rmm::device_uvector<vertex_t> labels(graph_view.local_vertex_partition_range_size(),
+                                           handle_.get_stream());
+
+      if (initial_labels_ != nullptr) {
+        rmm::device_uvector<vertex_t> initial_label_vertices(initial_label_vertices_->size_,
+                                                             handle_.get_stream());
+        rmm::device_uvector<vertex_t> initial_labels(initial_labels_->size_,
+                                                     handle_.get_stream());
+
+        raft::copy(initial_label_vertices.data(),
+                   initial_label_vertices_->as_type<vertex_t>(),
+                   initial_label_vertices.size(),
+                   handle_.get_stream());
+
+        raft::copy(initial_labels.data(),
+                   initial_labels_->as_type<vertex_t>(),
+                   initial_labels.size(),
+                   handle_.get_stream());
+
+        // the vertices missing in initial_label_vertices get invalid_vertex_id (and fail the
+        // expensive check)
+        labels = cugraph::detail::
+          collect_local_vertex_values_from_ext_vertex_value_pairs<vertex_t, vertex_t, multi_gpu>(
+            handle_,
+            std::move(initial_label_vertices),
+            std::move(initial_labels),
+            *number_map,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            cugraph::invalid_vertex_id<vertex_t>::value,
+            do_expensive_check_);
+      }
+
+      cugraph::label_propagation<vertex_t, edge_t, weight_t, multi_gpu>(
+        handle_,
+        rng_state_->rng_state_,
+        graph_view,
+        (edge_weights != nullptr) ? std::make_optional(edge_weights->view()) : std::nullopt,
+        raft::device_span<vertex_t>{labels.data(), labels.size()},
+        initial_labels_ != nullptr,
+        semi_synchronous_,
+        max_iterations_,
+        do_expensive_check_);
+
+      rmm::device_uvector<vertex_t> vertex_ids(graph_view.local_vertex_partition_range_size(),
+                                               handle_.get_stream());
+      raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
+
+      result_ = new cugraph::c_api::cugraph_labeling_result_t{
+        new cugraph::c_api::cugraph_type_erased_device_array_t(vertex_ids, graph_->vertex_type_),
+        new cugraph::c_api::cugraph_type_erased_device_array_t(labels, graph_->vertex_type_)};
+    }
+  }
+};
+
+}  // namespace
+
+extern "C" cugraph_error_code_t cugraph_label_propagation(
+  const cugraph_resource_handle_t* handle,
+  cugraph_rng_state_t* rng_state,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_label_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_labels,
+  bool_t semi_synchronous,
+  size_t max_iterations,
+  bool_t do_expensive_check,
+  cugraph_labeling_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS((initial_label_vertices == nullptr) == (initial_labels == nullptr),
+               CUGRAPH_INVALID_INPUT,
+               "initial_label_vertices and initial_labels should be both set or both NULL",
+               *error);
+  if (initial_labels != nullptr) {
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_label_vertices)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_label_vertices must match",
+                 *error);
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_labels)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_labels must match",
+                 *error);
+  }
+
+  label_propagation_functor functor(handle,
+                                    rng_state,
+                                    graph,
+                                    initial_label_vertices,
+                                    initial_labels,
+                                    semi_synchronous,
+                                    max_iterations,
+                                    do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
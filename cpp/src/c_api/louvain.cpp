@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,6 +35,8 @@ namespace {
 struct louvain_functor : public cugraph::c_api::abstract_functor {
   raft::handle_t const& handle_;
   cugraph::c_api::cugraph_graph_t* graph_;
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_cluster_vertices_{};
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* initial_clusters_{};
   size_t max_level_;
   double threshold_;
   double resolution_;
@@ -43,6 +45,8 @@ struct louvain_functor : public cugraph::c_api::abstract_functor {
 
   louvain_functor(::cugraph_resource_handle_t const* handle,
                   ::cugraph_graph_t* graph,
+                  ::cugraph_type_erased_device_array_view_t const* initial_cluster_vertices,
+                  ::cugraph_type_erased_device_array_view_t const* initial_clusters,
                   size_t max_level,
                   double threshold,
                   double resolution,
@@ -50,6 +54,12 @@ struct louvain_functor : public cugraph::c_api::abstract_functor {
     : abstract_functor(),
       handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      initial_cluster_vertices_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_cluster_vertices)),
+      initial_clusters_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          initial_clusters)),
       max_level_(max_level),
       threshold_(threshold),
       resolution_(resolution),
@@ -95,19 +105,69 @@ struct louvain_functor : public cugraph::c_api::abstract_functor {
       // could add support in Louvain for std::nullopt as the edge weights behaving
       // as desired and only instantiating a real edge_property_view_t for the
       // coarsened graphs.
-      auto [level, modularity] = cugraph::louvain(
-        handle_,
-        std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
-        graph_view,
-        (edge_weights != nullptr)
-          ? std::make_optional(edge_weights->view())
-          : std::make_optional(
-              cugraph::c_api::create_constant_edge_property(handle_, graph_view, weight_t{1})
-                .view()),
-        clusters.data(),
-        max_level_,
-        static_cast<weight_t>(threshold_),
-        static_cast<weight_t>(resolution_));
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                                 weight_t>>
+        constant_edge_weights{std::nullopt};
+      if (edge_weights == nullptr) {
+        constant_edge_weights =
+          cugraph::c_api::create_constant_edge_property(handle_, graph_view, weight_t{1});
+      }
+      auto edge_weight_view = std::make_optional(
+        (edge_weights != nullptr) ? edge_weights->view() : constant_edge_weights->view());
+
+      std::optional<rmm::device_uvector<vertex_t>> initial_clusters{std::nullopt};
+      if (initial_clusters_ != nullptr) {
+        rmm::device_uvector<vertex_t> initial_cluster_vertices(initial_cluster_vertices_->size_,
+                                                               handle_.get_stream());
+        rmm::device_uvector<vertex_t> initial_cluster_values(initial_clusters_->size_,
+                                                             handle_.get_stream());
+
+        raft::copy(initial_cluster_vertices.data(),
+                   initial_cluster_vertices_->as_type<vertex_t>(),
+                   initial_cluster_vertices.size(),
+                   handle_.get_stream());
+
+        raft::copy(initial_cluster_values.data(),
+                   initial_clusters_->as_type<vertex_t>(),
+                   initial_cluster_values.size(),
+                   handle_.get_stream());
+
+        // the vertices missing in initial_cluster_vertices start in singleton clusters
+        initial_clusters = cugraph::detail::
+          collect_local_vertex_values_from_ext_vertex_value_pairs<vertex_t, vertex_t, multi_gpu>(
+            handle_,
+            std::move(initial_cluster_vertices),
+            std::move(initial_cluster_values),
+            *number_map,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            cugraph::invalid_vertex_id<vertex_t>::value,
+            do_expensive_check_);
+      }
+
+      auto [level, modularity] =
+        initial_clusters
+          ? cugraph::louvain(
+              handle_,
+              std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+              graph_view,
+              edge_weight_view,
+              raft::device_span<vertex_t const>{(*initial_clusters).data(),
+                                                (*initial_clusters).size()},
+              clusters.data(),
+              max_level_,
+              static_cast<weight_t>(threshold_),
+              static_cast<weight_t>(resolution_))
+          : cugraph::louvain(
+              handle_,
+              std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+              graph_view,
+              edge_weight_view,
+              clusters.data(),
+              max_level_,
+              static_cast<weight_t>(threshold_),
+              static_cast<weight_t>(resolution_));
 
       rmm::device_uvector<vertex_t> vertices(graph_view.local_vertex_partition_range_size(),
                                              handle_.get_stream());
@@ -132,7 +192,53 @@ extern "C" cugraph_error_code_t cugraph_louvain(const cugraph_resource_handle_t*
                                                 cugraph_hierarchical_clustering_result_t** result,
                                                 cugraph_error_t** error)
 {
-  louvain_functor functor(handle, graph, max_level, threshold, resolution, do_expensive_check);
+  louvain_functor functor(
+    handle, graph, nullptr, nullptr, max_level, threshold, resolution, do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_louvain_with_initial_clustering(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* initial_cluster_vertices,
+  const cugraph_type_erased_device_array_view_t* initial_clusters,
+  size_t max_level,
+  double threshold,
+  double resolution,
+  bool_t do_expensive_check,
+  cugraph_hierarchical_clustering_result_t** result,
+  cugraph_error_t** error)
+{
+  CAPI_EXPECTS((initial_cluster_vertices == nullptr) == (initial_clusters == nullptr),
+               CUGRAPH_INVALID_INPUT,
+               "initial_cluster_vertices and initial_clusters should be both set or both NULL",
+               *error);
+  if (initial_clusters != nullptr) {
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_cluster_vertices)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_cluster_vertices must match",
+                 *error);
+    CAPI_EXPECTS(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
+                   reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+                     initial_clusters)
+                     ->type_,
+                 CUGRAPH_INVALID_INPUT,
+                 "vertex type of graph and initial_clusters must match",
+                 *error);
+  }
+
+  louvain_functor functor(handle,
+                          graph,
+                          initial_cluster_vertices,
+                          initial_clusters,
+                          max_level,
+                          threshold,
+                          resolution,
+                          do_expensive_check);
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
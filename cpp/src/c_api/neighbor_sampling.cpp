@@ -265,9 +265,11 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
       bool src_is_major = (options_.compression_type_ == cugraph_compression_type_t::CSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::DCSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::COO);
+      bool is_coo = (options_.compression_type_ == cugraph_compression_type_t::COO) ||
+                    (options_.compression_type_ == cugraph_compression_type_t::COO_DST_MAJOR);
 
       if (options_.renumber_results_) {
-        if (options_.compression_type_ == cugraph_compression_type_t::COO) {
+        if (is_coo) {
           // COO
 
           rmm::device_uvector<vertex_t> output_majors(0, handle_.get_stream());
@@ -355,7 +357,7 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
         hop.reset();
         offsets.reset();
       } else {
-        if (options_.compression_type_ != cugraph_compression_type_t::COO) {
+        if (!is_coo) {
           CUGRAPH_FAIL("Can only use COO format if not renumbering");
         }
 
@@ -619,9 +621,11 @@ struct biased_neighbor_sampling_functor : public cugraph::c_api::abstract_functo
       bool src_is_major = (options_.compression_type_ == cugraph_compression_type_t::CSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::DCSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::COO);
+      bool is_coo = (options_.compression_type_ == cugraph_compression_type_t::COO) ||
+                    (options_.compression_type_ == cugraph_compression_type_t::COO_DST_MAJOR);
 
       if (options_.renumber_results_) {
-        if (options_.compression_type_ == cugraph_compression_type_t::COO) {
+        if (is_coo) {
           // COO
 
           rmm::device_uvector<vertex_t> output_majors(0, handle_.get_stream());
@@ -709,7 +713,7 @@ struct biased_neighbor_sampling_functor : public cugraph::c_api::abstract_functo
         hop.reset();
         offsets.reset();
       } else {
-        if (options_.compression_type_ != cugraph_compression_type_t::COO) {
+        if (!is_coo) {
           CUGRAPH_FAIL("Can only use COO format if not renumbering");
         }
 
@@ -1126,6 +1130,8 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
       bool src_is_major = (options_.compression_type_ == cugraph_compression_type_t::CSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::DCSR) ||
                           (options_.compression_type_ == cugraph_compression_type_t::COO);
+      bool is_coo = (options_.compression_type_ == cugraph_compression_type_t::COO) ||
+                    (options_.compression_type_ == cugraph_compression_type_t::COO_DST_MAJOR);
 
       // Extract the edge_label from the offsets
       if (offsets) {
@@ -1138,7 +1144,7 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
       if (options_.renumber_results_) {
         if (src.size() > 0) {          // Only renumber if there are edgelist to renumber
           if (num_edge_types_ == 1) {  // homogeneous renumbering
-            if (options_.compression_type_ == cugraph_compression_type_t::COO) {
+            if (is_coo) {
               // COO
 
               rmm::device_uvector<vertex_t> output_majors(0, handle_.get_stream());
@@ -1314,7 +1320,7 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
         }
 
       } else {
-        if (options_.compression_type_ != cugraph_compression_type_t::COO) {
+        if (!is_coo) {
           CUGRAPH_FAIL("Can only use COO format if not renumbering");
         }
 
@@ -1448,6 +1454,9 @@ extern "C" void cugraph_sampling_set_compression_type(cugraph_sampling_options_t
     case CSC: internal_pointer->compression_type_ = cugraph_compression_type_t::CSC; break;
     case DCSR: internal_pointer->compression_type_ = cugraph_compression_type_t::DCSR; break;
     case DCSC: internal_pointer->compression_type_ = cugraph_compression_type_t::DCSC; break;
+    case COO_DST_MAJOR:
+      internal_pointer->compression_type_ = cugraph_compression_type_t::COO_DST_MAJOR;
+      break;
     default: CUGRAPH_FAIL("Invalid compression type");
   }
 }
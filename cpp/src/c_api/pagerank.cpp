@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,8 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <memory>
+#include <mutex>
 #include <optional>
 
 namespace {
@@ -183,6 +185,24 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
             do_expensive_check_);
       }
 
+      // without user provided sums, the sums of the out-going edge weights are computed once per
+      // graph and reused by the later calls
+      std::optional<raft::device_span<weight_t const>> cached_vertex_out_weight_sums{std::nullopt};
+      if ((precomputed_vertex_out_weight_sums_ == nullptr) && (edge_weights != nullptr)) {
+        std::lock_guard<std::mutex> lock(graph_->mutex_);
+        if (graph_->vertex_out_weight_sums_ == nullptr) {
+          auto sums = std::make_unique<rmm::device_uvector<weight_t>>(
+            cugraph::compute_out_weight_sums(handle_, graph_view, edge_weights->view()));
+          // the later calls may read the sums on other streams
+          handle_.sync_stream();
+          graph_->vertex_out_weight_sums_ = sums.release();
+        }
+        auto sums =
+          reinterpret_cast<rmm::device_uvector<weight_t>*>(graph_->vertex_out_weight_sums_);
+        cached_vertex_out_weight_sums =
+          raft::device_span<weight_t const>{sums->data(), sums->size()};
+      }
+
       if (initial_guess_values_ != nullptr) {
         rmm::device_uvector<vertex_t> initial_guess_vertices(initial_guess_vertices_->size_,
                                                              handle_.get_stream());
@@ -220,7 +240,7 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
             ? std::make_optional(
                 raft::device_span<weight_t const>{precomputed_vertex_out_weight_sums.data(),
                                                   precomputed_vertex_out_weight_sums.size()})
-            : std::nullopt,
+            : cached_vertex_out_weight_sums,
           personalization_vertices_
             ? std::make_optional(
                 std::make_tuple(raft::device_span<vertex_t const>{personalization_vertices.data(),
@@ -15,6 +15,7 @@
  */
 
 #include "c_api/abstract_functor.hpp"
+#include "c_api/capi_helper.hpp"
 #include "c_api/graph.hpp"
 #include "c_api/random.hpp"
 #include "c_api/resource_handle.hpp"
@@ -26,6 +27,8 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <algorithm>
+
 namespace cugraph {
 namespace c_api {
 
@@ -78,8 +81,6 @@ struct node2vec_functor : public abstract_functor {
     // FIXME: Think about how to handle SG vice MG
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
-    } else if constexpr (multi_gpu) {
-      unsupported();
     } else {
       // node2vec expects store_transposed == false
       if constexpr (store_transposed) {
@@ -117,32 +118,45 @@ struct node2vec_functor : public abstract_functor {
                                                  graph_view.local_vertex_partition_range_last(),
                                                  false);
 
-      // FIXME:  Forcing this to edge_t for now.  What should it really be?
-      // Seems like it should be the smallest size that can accommodate
-      // max_length_ * start_vertices_->size_
-      auto [paths, weights, sizes] = cugraph::random_walks(
+      // The legacy API counts vertices (not steps) in max_length_
+      raft::random::RngState rng_state(0);
+      auto [paths, weights] = cugraph::node2vec_random_walks(
         handle_,
+        rng_state,
         graph_view,
         (edge_weights != nullptr) ? std::make_optional(edge_weights->view()) : std::nullopt,
-        start_vertices.data(),
-        static_cast<edge_t>(start_vertices.size()),
-        static_cast<edge_t>(max_length_),
-        !compress_result_,
-        // std::make_unique<sampling_params_t>(2, p_, q_, false));
-        std::make_unique<sampling_params_t>(cugraph::sampling_strategy_t::NODE2VEC, p_, q_));
+        raft::device_span<vertex_t const>{start_vertices.data(), start_vertices.size()},
+        std::max(max_length_, size_t{1}) - 1,
+        static_cast<weight_t>(p_),
+        static_cast<weight_t>(q_));
 
       //
       // Need to unrenumber the vertices in the resulting paths
       //
-      unrenumber_local_int_vertices<vertex_t>(
-        handle_, paths.data(), paths.size(), number_map->data(), 0, paths.size() - 1, false);
+      unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                   paths.data(),
+                                                   paths.size(),
+                                                   number_map->data(),
+                                                   graph_view.vertex_partition_range_lasts(),
+                                                   false);
+
+      rmm::device_uvector<weight_t> path_weights(0, handle_.get_stream());
+      rmm::device_uvector<edge_t> sizes(0, handle_.get_stream());
+      std::tie(paths, path_weights, sizes) =
+        detail::convert_random_walks_to_legacy_format<vertex_t, edge_t, weight_t>(
+          handle_,
+          std::move(paths),
+          std::move(weights),
+          start_vertices.size(),
+          graph_view.number_of_vertices(),
+          compress_result_);
 
       result_ = new cugraph_random_walk_result_t{
         compress_result_,
         max_length_,
         new cugraph_type_erased_device_array_t(paths, graph_->vertex_type_),
-        new cugraph_type_erased_device_array_t(weights, graph_->weight_type_),
-        new cugraph_type_erased_device_array_t(sizes, graph_->vertex_type_)};
+        new cugraph_type_erased_device_array_t(path_weights, graph_->weight_type_),
+        new cugraph_type_erased_device_array_t(sizes, graph_->edge_type_)};
     }
   }
 };
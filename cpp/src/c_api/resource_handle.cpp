@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,8 +16,30 @@
 
 #include "c_api/resource_handle.hpp"
 
+#include "c_api/error.hpp"
+
 #include <cugraph_c/resource_handle.h>
 
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/hierarchical_shuffle.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
+
+#include <raft/core/resource/cuda_stream.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+
+struct cugraph_prim_profile_report_t {
+  std::vector<cugraph::prim_profile_record_t> records_{};
+};
+
+}  // namespace c_api
+}  // namespace cugraph
+
 extern "C" cugraph_resource_handle_t* cugraph_create_resource_handle(void* raft_handle)
 {
   try {
@@ -31,10 +53,89 @@ extern "C" cugraph_resource_handle_t* cugraph_create_resource_handle(void* raft_
 extern "C" void cugraph_free_resource_handle(cugraph_resource_handle_t* handle)
 {
   auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t*>(handle);
+  cugraph::set_progress_callback(*(internal->handle_), cugraph::progress_callback_t{});
   if (internal->allocated_) delete internal->handle_;
   delete internal;
 }
 
+extern "C" cugraph_error_code_t cugraph_resource_handle_set_stream(
+  cugraph_resource_handle_t* handle, uintptr_t stream, cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t*>(handle);
+
+    if (stream != 0) {
+      if (!internal->original_stream_) {
+        internal->original_stream_ = internal->handle_->get_stream();
+      }
+      raft::resource::set_cuda_stream(
+        *(internal->handle_), rmm::cuda_stream_view{reinterpret_cast<cudaStream_t>(stream)});
+    } else if (internal->original_stream_) {
+      raft::resource::set_cuda_stream(*(internal->handle_), *(internal->original_stream_));
+      internal->original_stream_ = std::nullopt;
+    }
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_resource_handle_clone(
+  const cugraph_resource_handle_t* handle,
+  uintptr_t stream,
+  cugraph_resource_handle_t** clone,
+  cugraph_error_t** error)
+{
+  *clone = nullptr;
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+
+    // the clone's stream is not ordered with the stream of the original handle, complete the work
+    // (e.g. graph creation) already enqueued on the original handle's stream
+    internal->handle_->sync_stream();
+
+    // the copy shares the resources of the original handle, but setting the stream of the copy
+    // does not affect the original handle
+    auto raft_handle = std::make_unique<raft::handle_t>(*(internal->handle_));
+    std::unique_ptr<rmm::cuda_stream> owned_stream{};
+    if (stream != 0) {
+      raft::resource::set_cuda_stream(
+        *raft_handle, rmm::cuda_stream_view{reinterpret_cast<cudaStream_t>(stream)});
+    } else {
+      owned_stream = std::make_unique<rmm::cuda_stream>();
+      raft::resource::set_cuda_stream(*raft_handle, owned_stream->view());
+    }
+
+    auto cloned =
+      std::make_unique<cugraph::c_api::cugraph_resource_handle_t>(raft_handle.release());
+    cloned->allocated_    = true;
+    cloned->owned_stream_ = std::move(owned_stream);
+
+    *clone = reinterpret_cast<cugraph_resource_handle_t*>(cloned.release());
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
 extern "C" int cugraph_resource_handle_get_rank(const cugraph_resource_handle_t* handle)
 {
   auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
@@ -48,3 +149,191 @@ extern "C" int cugraph_resource_handle_get_comm_size(const cugraph_resource_hand
   auto& comm    = internal->handle_->get_comms();
   return static_cast<int>(comm.get_size());
 }
+
+extern "C" void cugraph_resource_handle_enable_prim_profiling(
+  const cugraph_resource_handle_t* handle, bool_t enable)
+{
+  cugraph::prim_profiler_t::instance().enable(enable == TRUE);
+}
+
+extern "C" cugraph_error_code_t cugraph_resource_handle_enable_hierarchical_shuffle(
+  const cugraph_resource_handle_t* handle, bool_t enable, cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    if (internal->handle_->comms_initialized()) {
+      cugraph::enable_hierarchical_shuffle(*(internal->handle_), enable == TRUE);
+    }
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_resource_handle_init_subcomms(
+  const cugraph_resource_handle_t* handle,
+  cugraph_partition_shape_t shape,
+  int num_gpus_per_node,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    if (!internal->handle_->comms_initialized()) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"resource handle is not configured for multi-gpu"});
+      return CUGRAPH_INVALID_INPUT;
+    }
+    cugraph::partition_manager::init_subcomm(*(internal->handle_),
+                                             shape == CUGRAPH_PARTITION_SHAPE_GPU_ROW_COMM_PER_NODE
+                                               ? cugraph::partition_shape_t::gpu_row_comm_per_node
+                                               : cugraph::partition_shape_t::square,
+                                             num_gpus_per_node);
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_resource_handle_set_progress_callback(
+  const cugraph_resource_handle_t* handle,
+  cugraph_progress_callback_t callback,
+  void* user_data,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto internal = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    if (callback == nullptr) {
+      cugraph::set_progress_callback(*(internal->handle_), cugraph::progress_callback_t{});
+    } else {
+      cugraph::set_progress_callback(
+        *(internal->handle_), [callback, user_data](cugraph::iteration_progress_t const& progress) {
+          cugraph_progress_t c_progress{progress.algorithm,
+                                        progress.iteration,
+                                        progress.modularity,
+                                        progress.residual,
+                                        progress.frontier_size};
+          return callback(&c_progress, user_data) == TRUE;
+        });
+    }
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_resource_handle_get_prim_profile_report(
+  const cugraph_resource_handle_t* handle,
+  bool_t clear,
+  cugraph_prim_profile_report_t** report,
+  cugraph_error_t** error)
+{
+  *report = nullptr;
+  *error  = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto& profiler = cugraph::prim_profiler_t::instance();
+    auto records   = profiler.report();
+    if (clear == TRUE) { profiler.clear(); }
+
+    *report = reinterpret_cast<cugraph_prim_profile_report_t*>(
+      new cugraph::c_api::cugraph_prim_profile_report_t{std::move(records)});
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" size_t cugraph_prim_profile_report_get_size(const cugraph_prim_profile_report_t* report)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_.size();
+}
+
+extern "C" const char* cugraph_prim_profile_report_get_name(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].name.c_str();
+}
+
+extern "C" size_t cugraph_prim_profile_report_get_num_calls(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].num_calls;
+}
+
+extern "C" double cugraph_prim_profile_report_get_elapsed_seconds(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].elapsed_seconds;
+}
+
+extern "C" size_t cugraph_prim_profile_report_get_bytes_communicated(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].bytes_communicated;
+}
+
+extern "C" size_t cugraph_prim_profile_report_get_edges_touched(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].edges_touched;
+}
+
+extern "C" size_t cugraph_prim_profile_report_get_host_syncs(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].host_syncs;
+}
+
+extern "C" double cugraph_prim_profile_report_get_comm_wait_seconds(
+  const cugraph_prim_profile_report_t* report, size_t i)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t const*>(report);
+  return internal->records_[i].comm_wait_seconds;
+}
+
+extern "C" void cugraph_prim_profile_report_free(cugraph_prim_profile_report_t* report)
+{
+  auto internal = reinterpret_cast<cugraph::c_api::cugraph_prim_profile_report_t*>(report);
+  delete internal;
+}
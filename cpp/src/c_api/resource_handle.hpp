@@ -17,12 +17,25 @@
 
 #include <raft/core/handle.hpp>
 
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <optional>
+
 namespace cugraph {
 namespace c_api {
 
 struct cugraph_resource_handle_t {
   raft::handle_t* handle_{nullptr};
   bool allocated_{false};
+  // stream of handle_ before cugraph_resource_handle_set_stream, set while stream-ordered
+  std::optional<rmm::cuda_stream_view> original_stream_{std::nullopt};
+  // stream created for a clone (cugraph_resource_handle_clone without a caller-provided stream),
+  // destroyed after handle_
+  std::unique_ptr<rmm::cuda_stream> owned_stream_{};
+
+  bool is_stream_ordered() const { return original_stream_.has_value(); }
 
   cugraph_resource_handle_t(void* raft_handle)
   {
@@ -57,44 +57,28 @@ struct scc_functor : public cugraph::c_api::abstract_functor {
   {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
-    } else if constexpr (multi_gpu) {
-      error_code_ = CUGRAPH_NOT_IMPLEMENTED;
-      error_->error_message_ =
-        "strongly connected components not currently implemented for multi-GPU";
-
-    } else if constexpr (!std::is_same_v<vertex_t, edge_t>) {
-      unsupported();
-    } else if constexpr (std::is_same_v<weight_t, double>) {
-      unsupported();
     } else {
       // SCC expects store_transposed == false
       if constexpr (store_transposed) {
-        error_code_ =
-          cugraph::c_api::transpose_storage<vertex_t, edge_t, weight_t, store_transposed, false>(
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
             handle_, graph_, error_.get());
         if (error_code_ != CUGRAPH_SUCCESS) return;
       }
 
       auto graph =
-        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, false>*>(graph_->graph_);
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>*>(graph_->graph_);
 
-      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+      auto graph_view = graph->view();
 
-      auto graph_view          = graph->view();
-      auto edge_partition_view = graph_view.local_edge_partition_view();
-
-      cugraph::legacy::GraphCSRView<vertex_t, edge_t, weight_t> legacy_graph_view(
-        const_cast<edge_t*>(edge_partition_view.offsets().data()),
-        const_cast<vertex_t*>(edge_partition_view.indices().data()),
-        nullptr,
-        edge_partition_view.offsets().size() - 1,
-        edge_partition_view.indices().size());
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
 
-      rmm::device_uvector<vertex_t> components(graph_view.number_of_vertices(),
+      rmm::device_uvector<vertex_t> components(graph_view.local_vertex_partition_range_size(),
                                                handle_.get_stream());
 
-      cugraph::connected_components(
-        legacy_graph_view, cugraph::cugraph_cc_t::CUGRAPH_STRONG, components.data());
+      cugraph::strongly_connected_components<vertex_t, edge_t, multi_gpu>(
+        handle_, graph_view, components.data(), do_expensive_check_);
+
       rmm::device_uvector<vertex_t> vertex_ids(graph_view.local_vertex_partition_range_size(),
                                                handle_.get_stream());
       raft::copy(vertex_ids.data(), number_map->data(), vertex_ids.size(), handle_.get_stream());
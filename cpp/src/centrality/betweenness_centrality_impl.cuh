@@ -30,15 +30,32 @@
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
 #include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
 
+#include <cuda/atomic>
 #include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
 
 //
 // The formula for BC(v) is the sum over all (s,t) where s != v != t of
@@ -83,6 +100,173 @@ struct extract_edge_e_op_t {
 namespace cugraph {
 namespace detail {
 
+// report the progress after processing num_processed_sources of num_sources sources, returns true
+// if the progress callback requests early termination
+inline bool report_betweenness_progress(raft::handle_t const& handle,
+                                        size_t num_processed_sources,
+                                        size_t num_sources,
+                                        bool multi_gpu)
+{
+  iteration_progress_t progress{};
+  progress.algorithm     = "betweenness_centrality";
+  progress.iteration     = num_processed_sources;
+  progress.frontier_size = num_sources - num_processed_sources;
+  return report_progress(handle, progress, multi_gpu);
+}
+
+// Batched Brandes (single-GPU): B sources are processed at once, the distances, sigmas, and deltas
+// are stored as [V x B] tiles (row major, so the B values of a vertex are contiguous). Thread
+// (v, b) handles vertex v for the b'th source; consecutive threads visit the same edges for
+// different sources, so the edge traversal is shared across the batch.
+
+template <typename vertex_t>
+struct batched_brandes_level_pred_t {
+  raft::device_span<vertex_t const> distances{};
+  size_t batch_size{};
+  vertex_t level{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    for (size_t b = 0; b < batch_size; ++b) {
+      if (distances[static_cast<size_t>(v) * batch_size + b] == level) { return true; }
+    }
+    return false;
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct batched_brandes_bfs_op_t {
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition{};
+  cuda::std::optional<edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>
+    edge_partition_e_mask{};
+  raft::device_span<vertex_t const> frontier{};
+  raft::device_span<vertex_t> distances{};
+  raft::device_span<edge_t> sigmas{};
+  size_t batch_size{};
+  vertex_t hop{};
+
+  __device__ void operator()(size_t i) const
+  {
+    constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+
+    auto v     = frontier[i / batch_size];
+    auto b     = i % batch_size;
+    auto v_idx = static_cast<size_t>(v) * batch_size + b;
+    if (distances[v_idx] != hop) { return; }
+    auto sigma_v = sigmas[v_idx];
+
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(v);
+    for (edge_t j = 0; j < local_degree; ++j) {
+      if (edge_partition_e_mask && !((*edge_partition_e_mask).get(edge_offset + j))) { continue; }
+      auto w_idx = static_cast<size_t>(indices[j]) * batch_size + b;
+      cuda::atomic_ref<vertex_t, cuda::thread_scope_device> distance_w(distances[w_idx]);
+      auto old_distance = invalid_distance;
+      distance_w.compare_exchange_strong(old_distance, hop + 1, cuda::std::memory_order_relaxed);
+      if ((old_distance == invalid_distance) || (old_distance == hop + 1)) {
+        cuda::atomic_ref<edge_t, cuda::thread_scope_device> sigma_w(sigmas[w_idx]);
+        sigma_w.fetch_add(sigma_v, cuda::std::memory_order_relaxed);
+      }
+    }
+  }
+};
+
+// delta(v) = sum over the successors w of v of (sigma(v) / sigma(w)) * (1 + delta(w)), the edge
+// (v, w) is credited with the same term if edge_centralities is set
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct batched_brandes_accumulate_op_t {
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition{};
+  cuda::std::optional<edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>
+    edge_partition_e_mask{};
+  raft::device_span<vertex_t const> frontier{};
+  raft::device_span<vertex_t const> distances{};
+  raft::device_span<edge_t const> sigmas{};
+  raft::device_span<weight_t> deltas{};
+  weight_t* edge_centralities{nullptr};
+  size_t batch_size{};
+  vertex_t d{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v     = frontier[i / batch_size];
+    auto b     = i % batch_size;
+    auto v_idx = static_cast<size_t>(v) * batch_size + b;
+    if (distances[v_idx] != (d - 1)) { return; }
+    auto sigma_v = static_cast<weight_t>(sigmas[v_idx]);
+
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(v);
+    weight_t delta{0};
+    for (edge_t j = 0; j < local_degree; ++j) {
+      if (edge_partition_e_mask && !((*edge_partition_e_mask).get(edge_offset + j))) { continue; }
+      auto w_idx = static_cast<size_t>(indices[j]) * batch_size + b;
+      if (distances[w_idx] == d) {
+        auto c = (sigma_v / static_cast<weight_t>(sigmas[w_idx])) * (1 + deltas[w_idx]);
+        delta += c;
+        if (edge_centralities != nullptr) {
+          cuda::atomic_ref<weight_t, cuda::thread_scope_device> edge_centrality(
+            edge_centralities[edge_offset + j]);
+          edge_centrality.fetch_add(c, cuda::std::memory_order_relaxed);
+        }
+      }
+    }
+    deltas[v_idx] = delta;
+  }
+};
+
+template <typename vertex_t>
+struct batched_brandes_count_reached_op_t {
+  raft::device_span<vertex_t const> distances{};
+  raft::device_span<vertex_t> counts{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+    if (distances[i] != invalid_distance) {
+      cuda::atomic_ref<vertex_t, cuda::thread_scope_device> count(counts[i % batch_size]);
+      count.fetch_add(vertex_t{1}, cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+// the sum of squares of the per-source dependencies (excluding the endpoint terms) is used to
+// estimate the variance in adaptive sampling
+template <typename vertex_t, typename weight_t>
+struct batched_brandes_vertex_centrality_op_t {
+  raft::device_span<vertex_t const> distances{};
+  raft::device_span<weight_t const> deltas{};
+  cuda::std::optional<raft::device_span<vertex_t const>> reached_counts{};  // set if with endpoints
+  raft::device_span<weight_t> centralities{};
+  cuda::std::optional<raft::device_span<weight_t>> centrality_squares{};
+  size_t batch_size{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+    weight_t centrality{0};
+    weight_t square{0};
+    for (size_t b = 0; b < batch_size; ++b) {
+      auto v_idx = static_cast<size_t>(v) * batch_size + b;
+      auto d     = distances[v_idx];
+      if (d == invalid_distance) { continue; }
+      if (d == vertex_t{0}) {
+        if (reached_counts) { centrality += static_cast<weight_t>((*reached_counts)[b] - 1); }
+      } else {
+        centrality += deltas[v_idx];
+        square += deltas[v_idx] * deltas[v_idx];
+        if (reached_counts) { centrality += weight_t{1}; }
+      }
+    }
+    centralities[v] += centrality;
+    if (centrality_squares) { (*centrality_squares)[v] += square; }
+  }
+};
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<edge_t>> brandes_bfs(
   raft::handle_t const& handle,
@@ -427,6 +611,155 @@ void accumulate_edge_results(
   }
 }
 
+// the [V x B] tiles of the batched Brandes algorithm are limited to this many elements each
+constexpr size_t brandes_max_tile_size{size_t{1} << 27};
+constexpr size_t brandes_max_batch_size{256};
+
+template <typename vertex_t>
+size_t brandes_batch_size(vertex_t num_vertices, size_t num_sources)
+{
+  auto batch_size = std::min(brandes_max_batch_size,
+                             brandes_max_tile_size / std::max(static_cast<size_t>(num_vertices),
+                                                              size_t{1}));
+  return std::max(std::min(batch_size, num_sources), size_t{1});
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void batched_brandes(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+                     raft::device_span<vertex_t const> sources,
+                     std::optional<raft::device_span<weight_t>> vertex_centralities,
+                     bool with_endpoints,
+                     std::optional<edge_property_view_t<edge_t, weight_t*>> edge_centralities_view,
+                     std::optional<raft::device_span<weight_t>> vertex_centrality_squares =
+                       std::nullopt)
+{
+  constexpr vertex_t invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  auto batch_size = sources.size();
+  auto tile_size  = static_cast<size_t>(graph_view.number_of_vertices()) * batch_size;
+
+  rmm::device_uvector<vertex_t> distances(tile_size, handle.get_stream());
+  rmm::device_uvector<edge_t> sigmas(tile_size, handle.get_stream());
+  rmm::device_uvector<weight_t> deltas(tile_size, handle.get_stream());
+  detail::scalar_fill(handle, distances.data(), distances.size(), invalid_distance);
+  detail::scalar_fill(handle, sigmas.data(), sigmas.size(), edge_t{0});
+  detail::scalar_fill(handle, deltas.data(), deltas.size(), weight_t{0});
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(batch_size),
+                   [sources,
+                    distances = raft::device_span<vertex_t>(distances.data(), distances.size()),
+                    sigmas    = raft::device_span<edge_t>(sigmas.data(), sigmas.size()),
+                    batch_size] __device__(size_t b) {
+                     auto idx       = static_cast<size_t>(sources[b]) * batch_size + b;
+                     distances[idx] = vertex_t{0};
+                     sigmas[idx]    = edge_t{1};
+                   });
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+  auto edge_mask_view = graph_view.edge_mask_view();
+  auto edge_partition_e_mask =
+    edge_mask_view
+      ? cuda::std::make_optional<
+          detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>(
+          *edge_mask_view, 0)
+      : cuda::std::nullopt;
+
+  rmm::device_uvector<vertex_t> frontier(graph_view.number_of_vertices(), handle.get_stream());
+  auto extract_level = [&](vertex_t level) {
+    auto last = thrust::copy_if(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(graph_view.number_of_vertices()),
+      frontier.begin(),
+      batched_brandes_level_pred_t<vertex_t>{
+        raft::device_span<vertex_t const>(distances.data(), distances.size()), batch_size, level});
+    return static_cast<size_t>(thrust::distance(frontier.begin(), last));
+  };
+
+  // 1. BFS from every source in the batch
+
+  vertex_t hop{0};
+  while (true) {
+    auto frontier_size = extract_level(hop);
+    if (frontier_size == 0) { break; }
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(frontier_size * batch_size),
+      batched_brandes_bfs_op_t<vertex_t, edge_t>{
+        edge_partition,
+        edge_partition_e_mask,
+        raft::device_span<vertex_t const>(frontier.data(), frontier_size),
+        raft::device_span<vertex_t>(distances.data(), distances.size()),
+        raft::device_span<edge_t>(sigmas.data(), sigmas.size()),
+        batch_size,
+        hop});
+    ++hop;
+  }
+  auto diameter = hop > vertex_t{0} ? hop - 1 : vertex_t{0};
+
+  // 2. back-propagate the dependencies in non-increasing distance order
+
+  auto edge_centralities =
+    edge_centralities_view ? (*edge_centralities_view).value_firsts()[0] : nullptr;
+  for (vertex_t d = diameter; d > 0; --d) {
+    if (!edge_centralities && (d == vertex_t{1})) { break; }  // sources' deltas are not needed
+    auto frontier_size = extract_level(d - 1);
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(frontier_size * batch_size),
+      batched_brandes_accumulate_op_t<vertex_t, edge_t, weight_t>{
+        edge_partition,
+        edge_partition_e_mask,
+        raft::device_span<vertex_t const>(frontier.data(), frontier_size),
+        raft::device_span<vertex_t const>(distances.data(), distances.size()),
+        raft::device_span<edge_t const>(sigmas.data(), sigmas.size()),
+        raft::device_span<weight_t>(deltas.data(), deltas.size()),
+        edge_centralities,
+        batch_size,
+        d});
+  }
+
+  // 3. accumulate the vertex centralities over the batch
+
+  if (vertex_centralities) {
+    std::optional<rmm::device_uvector<vertex_t>> reached_counts{std::nullopt};
+    if (with_endpoints) {
+      reached_counts = rmm::device_uvector<vertex_t>(batch_size, handle.get_stream());
+      detail::scalar_fill(
+        handle, (*reached_counts).data(), (*reached_counts).size(), vertex_t{0});
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(tile_size),
+                       batched_brandes_count_reached_op_t<vertex_t>{
+                         raft::device_span<vertex_t const>(distances.data(), distances.size()),
+                         raft::device_span<vertex_t>((*reached_counts).data(),
+                                                     (*reached_counts).size()),
+                         batch_size});
+    }
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(graph_view.number_of_vertices()),
+      batched_brandes_vertex_centrality_op_t<vertex_t, weight_t>{
+        raft::device_span<vertex_t const>(distances.data(), distances.size()),
+        raft::device_span<weight_t const>(deltas.data(), deltas.size()),
+        reached_counts ? cuda::std::make_optional(raft::device_span<vertex_t const>(
+                           (*reached_counts).data(), (*reached_counts).size()))
+                       : cuda::std::nullopt,
+        *vertex_centralities,
+        vertex_centrality_squares ? cuda::std::make_optional(*vertex_centrality_squares)
+                                  : cuda::std::nullopt,
+        batch_size});
+  }
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -483,44 +816,70 @@ rmm::device_uvector<weight_t> betweenness_centrality(
     my_rank = handle.get_comms().get_rank();
   }
 
-  //
-  // FIXME: This could be more efficient using something akin to the
-  // technique in WCC.  Take the entire set of sources, insert them into
-  // a tagged frontier (tagging each source with itself).  Then we can
-  // expand from multiple sources concurrently. The challenge is managing
-  // the memory explosion.
-  //
-  for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
+  if constexpr (!multi_gpu) {
+    auto batch_size = brandes_batch_size(graph_view.number_of_vertices(), num_sources);
+    rmm::device_uvector<vertex_t> batch_sources(batch_size, handle.get_stream());
+    for (size_t source_first = 0; source_first < num_sources; source_first += batch_size) {
+      auto this_batch_size = std::min(batch_size, num_sources - source_first);
+      thrust::copy(handle.get_thrust_policy(),
+                   vertices_begin + source_first,
+                   vertices_begin + (source_first + this_batch_size),
+                   batch_sources.begin());
+      batched_brandes(
+        handle,
+        graph_view,
+        raft::device_span<vertex_t const>(batch_sources.data(), this_batch_size),
+        std::make_optional(raft::device_span<weight_t>{centralities.data(), centralities.size()}),
+        include_endpoints,
+        std::optional<edge_property_view_t<edge_t, weight_t*>>{std::nullopt});
+      if (report_betweenness_progress(handle, source_first + this_batch_size, num_sources, false)) {
+        num_sources = source_first + this_batch_size;  // scale by the processed sources
+        break;
+      }
+    }
+  } else {
     //
-    //  BFS
+    // FIXME: The batched Brandes algorithm (used in single-GPU) stores [V x B] tiles that
+    // update_edge_src_property/update_edge_dst_property cannot handle yet, so multi-GPU still
+    // processes one source at a time.
     //
-    constexpr size_t bucket_idx_cur = 0;
-    constexpr size_t num_buckets    = 2;
-
-    vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+    for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
+      //
+      //  BFS
+      //
+      constexpr size_t bucket_idx_cur = 0;
+      constexpr size_t num_buckets    = 2;
+
+      vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+
+      if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
+        vertex_frontier.bucket(bucket_idx_cur)
+          .insert(vertices_begin + (source_idx - source_offsets[my_rank]),
+                  vertices_begin + (source_idx - source_offsets[my_rank]) + 1);
+      }
 
-    if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
-      vertex_frontier.bucket(bucket_idx_cur)
-        .insert(vertices_begin + (source_idx - source_offsets[my_rank]),
-                vertices_begin + (source_idx - source_offsets[my_rank]) + 1);
+      //
+      //  Now we need to do modified BFS
+      //
+      // FIXME:  This has an inefficiency in early iterations, as it doesn't have enough work to
+      //         keep the GPUs busy.  But we can't run too many at once or we will run out of
+      //         memory. Need to investigate options to improve this performance
+      auto [distances, sigmas] =
+        brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
+      accumulate_vertex_results(
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<weight_t>{centralities.data(), centralities.size()},
+        std::move(distances),
+        std::move(sigmas),
+        include_endpoints,
+        do_expensive_check);
+      if (report_betweenness_progress(handle, source_idx + 1, num_sources, multi_gpu)) {
+        num_sources = source_idx + 1;  // scale by the processed sources
+        break;
+      }
     }
-
-    //
-    //  Now we need to do modified BFS
-    //
-    // FIXME:  This has an inefficiency in early iterations, as it doesn't have enough work to
-    //         keep the GPUs busy.  But we can't run too many at once or we will run out of
-    //         memory. Need to investigate options to improve this performance
-    auto [distances, sigmas] =
-      brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
-    accumulate_vertex_results(handle,
-                              graph_view,
-                              edge_weight_view,
-                              raft::device_span<weight_t>{centralities.data(), centralities.size()},
-                              std::move(distances),
-                              std::move(sigmas),
-                              include_endpoints,
-                              do_expensive_check);
   }
 
   std::optional<weight_t> scale_factor{std::nullopt};
@@ -617,43 +976,68 @@ edge_betweenness_centrality(
     my_rank = handle.get_comms().get_rank();
   }
 
-  //
-  // FIXME: This could be more efficient using something akin to the
-  // technique in WCC.  Take the entire set of sources, insert them into
-  // a tagged frontier (tagging each source with itself).  Then we can
-  // expand from multiple sources concurrently. The challenge is managing
-  // the memory explosion.
-  //
-  for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
+  if constexpr (!multi_gpu) {
+    auto batch_size = brandes_batch_size(graph_view.number_of_vertices(), num_sources);
+    rmm::device_uvector<vertex_t> batch_sources(batch_size, handle.get_stream());
+    for (size_t source_first = 0; source_first < num_sources; source_first += batch_size) {
+      auto this_batch_size = std::min(batch_size, num_sources - source_first);
+      thrust::copy(handle.get_thrust_policy(),
+                   vertices_begin + source_first,
+                   vertices_begin + (source_first + this_batch_size),
+                   batch_sources.begin());
+      batched_brandes(
+        handle,
+        graph_view,
+        raft::device_span<vertex_t const>(batch_sources.data(), this_batch_size),
+        std::optional<raft::device_span<weight_t>>{std::nullopt},
+        false,
+        std::make_optional(centralities.mutable_view()));
+      if (report_betweenness_progress(handle, source_first + this_batch_size, num_sources, false)) {
+        num_sources = source_first + this_batch_size;  // scale by the processed sources
+        break;
+      }
+    }
+  } else {
     //
-    //  BFS
+    // FIXME: The batched Brandes algorithm (used in single-GPU) stores [V x B] tiles that
+    // update_edge_src_property/update_edge_dst_property cannot handle yet, so multi-GPU still
+    // processes one source at a time.
     //
-    constexpr size_t bucket_idx_cur = 0;
-    constexpr size_t num_buckets    = 2;
-
-    vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+    for (size_t source_idx = 0; source_idx < num_sources; ++source_idx) {
+      //
+      //  BFS
+      //
+      constexpr size_t bucket_idx_cur = 0;
+      constexpr size_t num_buckets    = 2;
+
+      vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+
+      if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
+        vertex_frontier.bucket(bucket_idx_cur)
+          .insert(vertices_begin + (source_idx - source_offsets[my_rank]),
+                  vertices_begin + (source_idx - source_offsets[my_rank]) + 1);
+      }
 
-    if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
-      vertex_frontier.bucket(bucket_idx_cur)
-        .insert(vertices_begin + (source_idx - source_offsets[my_rank]),
-                vertices_begin + (source_idx - source_offsets[my_rank]) + 1);
+      //
+      //  Now we need to do modified BFS
+      //
+      // FIXME:  This has an inefficiency in early iterations, as it doesn't have enough work to
+      //         keep the GPUs busy.  But we can't run too many at once or we will run out of
+      //         memory. Need to investigate options to improve this performance
+      auto [distances, sigmas] =
+        brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
+      accumulate_edge_results(handle,
+                              graph_view,
+                              edge_weight_view,
+                              centralities.mutable_view(),
+                              std::move(distances),
+                              std::move(sigmas),
+                              do_expensive_check);
+      if (report_betweenness_progress(handle, source_idx + 1, num_sources, multi_gpu)) {
+        num_sources = source_idx + 1;  // scale by the processed sources
+        break;
+      }
     }
-
-    //
-    //  Now we need to do modified BFS
-    //
-    // FIXME:  This has an inefficiency in early iterations, as it doesn't have enough work to
-    //         keep the GPUs busy.  But we can't run too many at once or we will run out of
-    //         memory. Need to investigate options to improve this performance
-    auto [distances, sigmas] =
-      brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
-    accumulate_edge_results(handle,
-                            graph_view,
-                            edge_weight_view,
-                            centralities.mutable_view(),
-                            std::move(distances),
-                            std::move(sigmas),
-                            do_expensive_check);
   }
 
   std::optional<weight_t> scale_factor{std::nullopt};
@@ -688,6 +1072,195 @@ edge_betweenness_centrality(
   return centralities;
 }
 
+// delta_s(v) summed over the (local) sampled sources, and the sum of their squares
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void accumulate_sampled_dependencies(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<weight_t> dependency_sums,
+  raft::device_span<weight_t> dependency_squares,
+  bool do_expensive_check)
+{
+  if constexpr (!multi_gpu) {
+    auto batch_size = brandes_batch_size(graph_view.number_of_vertices(), sources.size());
+    for (size_t source_first = 0; source_first < sources.size(); source_first += batch_size) {
+      batched_brandes(
+        handle,
+        graph_view,
+        raft::device_span<vertex_t const>(sources.data() + source_first,
+                                          std::min(batch_size, sources.size() - source_first)),
+        std::make_optional(dependency_sums),
+        false,
+        std::optional<edge_property_view_t<edge_t, weight_t*>>{std::nullopt},
+        std::make_optional(dependency_squares));
+    }
+  } else {
+    auto source_counts =
+      host_scalar_allgather(handle.get_comms(), sources.size(), handle.get_stream());
+    std::vector<size_t> source_offsets(source_counts.size() + 1, 0);
+    std::inclusive_scan(source_counts.begin(), source_counts.end(), source_offsets.begin() + 1);
+    auto my_rank = handle.get_comms().get_rank();
+
+    rmm::device_uvector<weight_t> dependencies(graph_view.local_vertex_partition_range_size(),
+                                               handle.get_stream());
+    for (size_t source_idx = 0; source_idx < source_offsets.back(); ++source_idx) {
+      constexpr size_t bucket_idx_cur = 0;
+      constexpr size_t num_buckets    = 2;
+
+      vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+
+      if ((source_idx >= source_offsets[my_rank]) && (source_idx < source_offsets[my_rank + 1])) {
+        vertex_frontier.bucket(bucket_idx_cur)
+          .insert(sources.begin() + (source_idx - source_offsets[my_rank]),
+                  sources.begin() + (source_idx - source_offsets[my_rank]) + 1);
+      }
+
+      auto [distances, sigmas] =
+        brandes_bfs(handle, graph_view, edge_weight_view, vertex_frontier, do_expensive_check);
+      detail::scalar_fill(handle, dependencies.data(), dependencies.size(), weight_t{0});
+      accumulate_vertex_results(
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<weight_t>{dependencies.data(), dependencies.size()},
+        std::move(distances),
+        std::move(sigmas),
+        false,
+        do_expensive_check);
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(dependencies.size()),
+                       [dependencies = raft::device_span<weight_t const>(dependencies.data(),
+                                                                         dependencies.size()),
+                        dependency_sums,
+                        dependency_squares] __device__(size_t i) {
+                         dependency_sums[i] += dependencies[i];
+                         dependency_squares[i] += dependencies[i] * dependencies[i];
+                       });
+    }
+  }
+}
+
+// empirical Bernstein bound (Maurer & Pontil) on the deviation of the sample mean of k samples in
+// [0, range] with the given sample variance, holds with probability 1 - confidence
+template <typename weight_t>
+struct empirical_bernstein_bound_t {
+  weight_t scale{};  // dependency => sample
+  weight_t range{};
+  weight_t log_term{};  // log(2 / confidence)
+  size_t num_samples{};
+
+  __device__ weight_t operator()(thrust::tuple<weight_t, weight_t> sum_and_square) const
+  {
+    auto k        = static_cast<weight_t>(num_samples);
+    auto sum      = thrust::get<0>(sum_and_square) * scale;
+    auto square   = thrust::get<1>(sum_and_square) * scale * scale;
+    auto variance = (square - sum * sum / k) / (k - weight_t{1});
+    variance      = variance > weight_t{0} ? variance : weight_t{0};
+    return sqrt(weight_t{2} * variance * log_term / k) +
+           weight_t{7} * range * log_term / (weight_t{3} * (k - weight_t{1}));
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, weight_t, size_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  weight_t epsilon,
+  weight_t delta,
+  size_t initial_num_sources,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((epsilon > weight_t{0}) && (epsilon < weight_t{1}),
+                  "Invalid input argument: epsilon should be in (0, 1).");
+  CUGRAPH_EXPECTS((delta > weight_t{0}) && (delta < weight_t{1}),
+                  "Invalid input argument: delta should be in (0, 1).");
+  CUGRAPH_EXPECTS(initial_num_sources > 1,
+                  "Invalid input argument: initial_num_sources should be larger than 1.");
+
+  rmm::device_uvector<weight_t> centralities(graph_view.local_vertex_partition_range_size(),
+                                             handle.get_stream());
+  detail::scalar_fill(handle, centralities.data(), centralities.size(), weight_t{0});
+
+  auto n = static_cast<weight_t>(graph_view.number_of_vertices());
+  if (graph_view.number_of_vertices() <= vertex_t{2}) {
+    return std::make_tuple(std::move(centralities), weight_t{0}, size_t{0});
+  }
+
+  // the normalized betweenness of v (as in betweenness_centrality with normalized = true and
+  // include_endpoints = false) is the expectation of scale * delta_s(v) over a uniformly random
+  // source s, and scale * delta_s(v) is in [0, range]
+  auto scale = n / ((n - weight_t{1}) * (n - weight_t{2}));
+  auto range = n / (n - weight_t{1});
+
+  // the Hoeffding bound (with a union bound over the vertices) caps the number of sources
+  auto max_num_sources = static_cast<size_t>(std::ceil(
+    range * range * std::log(weight_t{2} * n / delta) / (weight_t{2} * epsilon * epsilon)));
+  max_num_sources = std::max(max_num_sources, size_t{2});
+
+  rmm::device_uvector<weight_t> dependency_squares(centralities.size(), handle.get_stream());
+  detail::scalar_fill(handle, dependency_squares.data(), dependency_squares.size(), weight_t{0});
+
+  size_t num_sources{0};
+  auto next_num_sources = std::min(initial_num_sources, max_num_sources);
+  auto bound            = std::numeric_limits<weight_t>::max();
+  for (size_t round = 0; true; ++round) {
+    auto sources = select_random_vertices(
+      handle,
+      graph_view,
+      std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+      rng_state,
+      next_num_sources - num_sources,
+      true,
+      false);
+    accumulate_sampled_dependencies(
+      handle,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t const>(sources.data(), sources.size()),
+      raft::device_span<weight_t>(centralities.data(), centralities.size()),
+      raft::device_span<weight_t>(dependency_squares.data(), dependency_squares.size()),
+      do_expensive_check);
+    num_sources = next_num_sources;
+
+    // the stopping test in round i uses confidence delta / 2^(i + 1) (so the failure probabilities
+    // sum to at most delta over all the rounds), or delta / (2^(i + 1) * n) per vertex
+
+    auto log_term = std::log(weight_t{2}) * static_cast<weight_t>(round + 2) + std::log(n / delta);
+    auto max_bernstein_bound = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(centralities.begin(), dependency_squares.begin()),
+      thrust::make_zip_iterator(centralities.end(), dependency_squares.end()),
+      empirical_bernstein_bound_t<weight_t>{scale, range, log_term, num_sources},
+      weight_t{0},
+      thrust::maximum<weight_t>{});
+    if constexpr (multi_gpu) {
+      max_bernstein_bound = host_scalar_allreduce(
+        handle.get_comms(), max_bernstein_bound, raft::comms::op_t::MAX, handle.get_stream());
+    }
+    auto hoeffding_bound =
+      range * std::sqrt(log_term / (weight_t{2} * static_cast<weight_t>(num_sources)));
+    bound = std::min(max_bernstein_bound, hoeffding_bound);
+
+    if ((bound <= epsilon) || (num_sources >= max_num_sources)) { break; }
+    next_num_sources = std::min(num_sources * 2, max_num_sources);
+  }
+
+  thrust::transform(handle.get_thrust_policy(),
+                    centralities.begin(),
+                    centralities.end(),
+                    centralities.begin(),
+                    [sf = scale / static_cast<weight_t>(num_sources)] __device__(auto dependency) {
+                      return dependency * sf;
+                    });
+
+  return std::make_tuple(std::move(centralities), bound, num_sources);
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -752,4 +1325,25 @@ edge_betweenness_centrality(
   }
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, weight_t, size_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  weight_t epsilon,
+  weight_t delta,
+  size_t initial_num_sources,
+  bool do_expensive_check)
+{
+  return detail::adaptive_betweenness_centrality(handle,
+                                                 rng_state,
+                                                 graph_view,
+                                                 edge_weight_view,
+                                                 epsilon,
+                                                 delta,
+                                                 initial_num_sources,
+                                                 do_expensive_check);
+}
+
 }  // namespace cugraph
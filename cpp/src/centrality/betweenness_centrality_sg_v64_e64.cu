@@ -55,4 +55,24 @@ edge_betweenness_centrality(
   bool const normalized,
   bool const do_expensive_check);
 
+template std::tuple<rmm::device_uvector<float>, float, size_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  float epsilon,
+  float delta,
+  size_t initial_num_sources,
+  bool const do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, double, size_t> adaptive_betweenness_centrality(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  double epsilon,
+  double delta,
+  size_t initial_num_sources,
+  bool const do_expensive_check);
+
 }  // namespace cugraph
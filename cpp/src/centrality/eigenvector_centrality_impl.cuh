@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "detail/lanczos_eigensolver.cuh"
 #include "prims/count_if_e.cuh"
 #include "prims/count_if_v.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
@@ -35,6 +36,7 @@
 
 #include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
@@ -43,6 +45,54 @@
 namespace cugraph {
 namespace detail {
 
+// y = (A^T + I) x, the iteration operator of the power method
+template <typename GraphViewType, typename weight_t>
+struct eigenvector_centrality_operator_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  raft::handle_t const& handle;
+  GraphViewType const& pull_graph_view;
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view;
+  edge_src_property_t<GraphViewType, weight_t>& edge_src_values;
+
+  void operator()(raft::device_span<weight_t const> x, raft::device_span<weight_t> y) const
+  {
+    update_edge_src_property(handle, pull_graph_view, x.begin(), edge_src_values.mutable_view());
+
+    if (edge_weight_view) {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        edge_src_values.view(),
+        edge_dst_dummy_property_t{}.view(),
+        *edge_weight_view,
+        [] __device__(vertex_t, vertex_t, auto src_val, auto, weight_t w) { return src_val * w; },
+        weight_t{0},
+        reduce_op::plus<weight_t>{},
+        y.begin());
+    } else {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        edge_src_values.view(),
+        edge_dst_dummy_property_t{}.view(),
+        edge_dummy_property_t{}.view(),
+        [] __device__(vertex_t, vertex_t, auto src_val, auto, auto) { return src_val; },
+        weight_t{0},
+        reduce_op::plus<weight_t>{},
+        y.begin());
+    }
+
+    thrust::transform(handle.get_thrust_policy(),
+                      y.begin(),
+                      y.end(),
+                      x.begin(),
+                      y.begin(),
+                      thrust::plus<weight_t>());
+  }
+};
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 rmm::device_uvector<weight_t> eigenvector_centrality(
   raft::handle_t const& handle,
@@ -51,7 +101,9 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
   std::optional<raft::device_span<weight_t const>> initial_centralities,
   weight_t epsilon,
   size_t max_iterations,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule,
+  centrality_eigensolver_t solver)
 {
   using GraphViewType     = graph_view_t<vertex_t, edge_t, true, multi_gpu>;
   auto const num_vertices = pull_graph_view.number_of_vertices();
@@ -85,6 +137,34 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
                  weight_t{1.0} / static_cast<weight_t>(num_vertices));
   }
 
+  if (solver == centrality_eigensolver_t::lanczos) {
+    edge_src_property_t<GraphViewType, weight_t> edge_src_values(handle, pull_graph_view);
+    auto tolerance = std::sqrt(static_cast<weight_t>(num_vertices)) * epsilon;
+    auto [eigenvalue, relative_residual, num_products] = lanczos_largest_eigenpair(
+      handle,
+      pull_graph_view,
+      eigenvector_centrality_operator_t<GraphViewType, weight_t>{
+        handle, pull_graph_view, edge_weight_view, edge_src_values},
+      raft::device_span<weight_t>(centralities.data(), centralities.size()),
+      tolerance,
+      max_iterations);
+    if (relative_residual > tolerance) {
+      CUGRAPH_FAIL("Eigenvector Centrality failed to converge.");
+    }
+
+    // the eigenvector is determined up to its sign, the centralities are non-negative
+    auto sum = reduce_v(handle, pull_graph_view, centralities.begin(), weight_t{0.0});
+    if (sum < weight_t{0.0}) {
+      thrust::transform(handle.get_thrust_policy(),
+                        centralities.begin(),
+                        centralities.end(),
+                        centralities.begin(),
+                        thrust::negate<weight_t>());
+    }
+
+    return centralities;
+  }
+
   // Power iteration
   rmm::device_uvector<weight_t> old_centralities(centralities.size(), handle.get_stream());
 
@@ -92,6 +172,9 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
 
   size_t iter{0};
   while (true) {
+    auto check_convergence = ((iter + 1) % schedule.convergence_check_interval == 0) ||
+                             (iter + 1 >= max_iterations);
+
     thrust::copy(handle.get_thrust_policy(),
                  centralities.begin(),
                  centralities.end(),
@@ -145,20 +228,21 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
                       centralities.begin(),
                       [hypotenuse] __device__(auto val) { return val / hypotenuse; });
 
-    auto diff_sum = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(centralities.begin(), old_centralities.data())),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      weight_t{0.0});
-
     iter++;
 
-    if (diff_sum < (pull_graph_view.number_of_vertices() * epsilon)) {
-      break;
-    } else if (iter >= max_iterations) {
-      CUGRAPH_FAIL("Eigenvector Centrality failed to converge.");
+    if (check_convergence) {
+      auto diff_sum = transform_reduce_v(
+        handle,
+        pull_graph_view,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(centralities.begin(), old_centralities.data())),
+        [] __device__(auto, auto val) {
+          return std::abs(thrust::get<0>(val) - thrust::get<1>(val));
+        },
+        weight_t{0.0});
+      if (diff_sum < (pull_graph_view.number_of_vertices() * epsilon)) { break; }
     }
+    if (iter >= max_iterations) { CUGRAPH_FAIL("Eigenvector Centrality failed to converge."); }
   }
 
   return centralities;
@@ -174,7 +258,9 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
   std::optional<raft::device_span<weight_t const>> initial_centralities,
   weight_t epsilon,
   size_t max_iterations,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule,
+  centrality_eigensolver_t solver)
 {
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
@@ -182,6 +268,20 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
                 "weight_t should be a floating-point type.");
 
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(schedule.num_blocks == 1,
+                  "Invalid input argument: block Gauss-Seidel updates are not supported by the "
+                  "power method, schedule.num_blocks should be 1.");
+  CUGRAPH_EXPECTS(
+    schedule.convergence_check_interval > 0,
+    "Invalid input argument: schedule.convergence_check_interval should be positive.");
+  CUGRAPH_EXPECTS(!schedule.message_precision.has_value(),
+                  "Invalid input argument: schedule.message_precision is supported by PageRank "
+                  "only.");
+  CUGRAPH_EXPECTS(!schedule.use_cuda_graph,
+                  "Invalid input argument: schedule.use_cuda_graph is supported by batched "
+                  "personalized PageRank and batched Katz Centrality only.");
+  CUGRAPH_EXPECTS((solver != centrality_eigensolver_t::lanczos) || graph_view.is_symmetric(),
+                  "Invalid input argument: the Lanczos method requires a symmetric graph.");
   if (initial_centralities)
     CUGRAPH_EXPECTS(initial_centralities->size() ==
                       static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
@@ -193,7 +293,9 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
                                         initial_centralities,
                                         epsilon,
                                         max_iterations,
-                                        do_expensive_check);
+                                        do_expensive_check,
+                                        schedule,
+                                        solver);
 }
 
 }  // namespace cugraph
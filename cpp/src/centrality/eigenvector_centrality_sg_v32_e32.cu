@@ -26,7 +26,9 @@ template rmm::device_uvector<float> eigenvector_centrality(
   std::optional<raft::device_span<float const>> initial_centralities,
   float epsilon,
   size_t max_iterations,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule,
+  centrality_eigensolver_t solver);
 
 template rmm::device_uvector<double> eigenvector_centrality(
   raft::handle_t const& handle,
@@ -35,6 +37,8 @@ template rmm::device_uvector<double> eigenvector_centrality(
   std::optional<raft::device_span<double const>> initial_centralities,
   double epsilon,
   size_t max_iterations,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule,
+  centrality_eigensolver_t solver);
 
 }  // namespace cugraph
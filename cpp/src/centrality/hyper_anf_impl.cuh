@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// HyperLogLog registers are 8 bit wide and 8 registers are packed in a 64 bit word, registers are
+// stored word-major (the w'th words of all the local vertices are contiguous) so a single word can
+// be exchanged and reduced with the existing primitives.
+size_t constexpr hyper_anf_registers_per_word{8};
+
+__device__ inline uint64_t hyper_anf_register_wise_max(uint64_t lhs, uint64_t rhs)
+{
+  auto lo = __vmaxu4(static_cast<uint32_t>(lhs), static_cast<uint32_t>(rhs));
+  auto hi = __vmaxu4(static_cast<uint32_t>(lhs >> 32), static_cast<uint32_t>(rhs >> 32));
+  return (static_cast<uint64_t>(hi) << 32) | static_cast<uint64_t>(lo);
+}
+
+struct hyper_anf_register_wise_max_t {
+  using value_type                              = uint64_t;
+  static constexpr bool pure_function           = true;  // this can be called in any process
+  inline static uint64_t const identity_element = uint64_t{0};
+
+  __device__ uint64_t operator()(uint64_t lhs, uint64_t rhs) const
+  {
+    return hyper_anf_register_wise_max(lhs, rhs);
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_hyper_anf_dst_word_t {
+  __device__ uint64_t operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, uint64_t dst_word, cuda::std::nullopt_t) const
+  {
+    return dst_word;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_hyper_anf_dst_flag_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, bool dst_flag, cuda::std::nullopt_t) const
+  {
+    return dst_flag;
+  }
+};
+
+// HyperLogLog cardinality estimate of the set represented by the registers of a single vertex
+// (with the small range correction of Flajolet et al.)
+template <typename vertex_t>
+struct hyper_anf_estimate_op_t {
+  uint64_t const* registers{};
+  vertex_t num_local_vertices{};
+  size_t num_words{};
+  double alpha{};
+
+  __device__ double operator()(vertex_t v_offset) const
+  {
+    auto m = static_cast<double>(num_words * hyper_anf_registers_per_word);
+    double inverse_sum{0.0};
+    size_t num_zeros{0};
+    for (size_t w = 0; w < num_words; ++w) {
+      auto word = registers[w * static_cast<size_t>(num_local_vertices) + v_offset];
+      for (size_t i = 0; i < hyper_anf_registers_per_word; ++i) {
+        auto rank = static_cast<int>((word >> (8 * i)) & uint64_t{0xff});
+        inverse_sum += ldexp(1.0, -rank);
+        if (rank == 0) { ++num_zeros; }
+      }
+    }
+    auto estimate = alpha * m * m / inverse_sum;
+    if ((estimate <= 2.5 * m) && (num_zeros > 0)) {
+      estimate = m * log(m / static_cast<double>(num_zeros));
+    }
+    return estimate;
+  }
+};
+
+template <typename GraphViewType>
+std::tuple<std::vector<double>, rmm::device_uvector<double>, rmm::device_uvector<double>, double>
+hyper_anf(raft::handle_t const& handle,
+          GraphViewType const& graph_view,
+          size_t log2_num_registers,
+          size_t max_distance,
+          double effective_diameter_fraction,
+          bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((log2_num_registers >= 4) && (log2_num_registers <= 16),
+                  "Invalid input argument: log2_num_registers should be in [4, 16].");
+  CUGRAPH_EXPECTS((effective_diameter_fraction > 0.0) && (effective_diameter_fraction <= 1.0),
+                  "Invalid input argument: effective_diameter_fraction should be in (0.0, 1.0].");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto const v_first            = graph_view.local_vertex_partition_range_first();
+  auto const num_local_vertices = graph_view.local_vertex_partition_range_size();
+  auto const num_registers      = size_t{1} << log2_num_registers;
+  auto const num_words          = num_registers / hyper_anf_registers_per_word;
+
+  double alpha{};
+  if (num_registers == 16) {
+    alpha = 0.673;
+  } else if (num_registers == 32) {
+    alpha = 0.697;
+  } else if (num_registers == 64) {
+    alpha = 0.709;
+  } else {
+    alpha = 0.7213 / (1.0 + 1.079 / static_cast<double>(num_registers));
+  }
+
+  // 2. initialize the registers of every vertex to represent the ball of radius 0 (the vertex
+  // itself)
+
+  rmm::device_uvector<uint64_t> registers(num_words * static_cast<size_t>(num_local_vertices),
+                                          handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), registers.begin(), registers.end(), uint64_t{0});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(num_local_vertices),
+    [registers = registers.data(),
+     num_local_vertices,
+     log2_num_registers,
+     v_first] __device__(vertex_t v_offset) {
+      cuco::murmurhash3_32<vertex_t> hi_hash_func{0};
+      cuco::murmurhash3_32<vertex_t> lo_hash_func{1};
+      auto v    = v_first + v_offset;
+      auto hash = (static_cast<uint64_t>(hi_hash_func(v)) << 32) |
+                  static_cast<uint64_t>(lo_hash_func(v));
+      auto idx  = static_cast<size_t>(hash >> (64 - log2_num_registers));
+      auto rest = hash << log2_num_registers;
+      auto rank = (rest == 0) ? static_cast<uint64_t>(64 - log2_num_registers + 1)
+                              : static_cast<uint64_t>(__clzll(rest) + 1);
+      registers[(idx / hyper_anf_registers_per_word) * static_cast<size_t>(num_local_vertices) +
+                v_offset] = rank << (8 * (idx % hyper_anf_registers_per_word));
+    });
+
+  hyper_anf_estimate_op_t<vertex_t> estimate_op{
+    registers.data(), num_local_vertices, num_words, alpha};
+
+  rmm::device_uvector<double> estimates(num_local_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_local_vertices),
+                    estimates.begin(),
+                    estimate_op);
+
+  auto sum_estimates = [&handle](rmm::device_uvector<double> const& vals) {
+    auto sum = thrust::reduce(handle.get_thrust_policy(), vals.begin(), vals.end(), double{0.0});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      sum = host_scalar_allreduce(
+        handle.get_comms(), sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    return sum;
+  };
+
+  std::vector<double> neighborhood_function{sum_estimates(estimates)};
+
+  rmm::device_uvector<double> harmonic_centralities(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<double> distance_sums(num_local_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               harmonic_centralities.begin(),
+               harmonic_centralities.end(),
+               double{0.0});
+  thrust::fill(handle.get_thrust_policy(), distance_sums.begin(), distance_sums.end(), double{0.0});
+
+  // 3. B(v, t) = B(v, t - 1) U (U_{(v, u) in E} B(u, t - 1)), a register-wise max along the edges
+
+  edge_dst_property_t<GraphViewType, uint64_t> dst_words(handle);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    dst_words = edge_dst_property_t<GraphViewType, uint64_t>(handle, graph_view);
+  }
+
+  rmm::device_uvector<uint64_t> new_words(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<bool> changed_flags(num_local_vertices, handle.get_stream());
+  std::optional<rmm::device_uvector<vertex_t>> changed_vertices{std::nullopt};
+
+  for (size_t t = 1; t <= max_distance; ++t) {
+    // edges to a destination that did not change in the previous iteration do not bring anything
+    // new (skip if the caller already attached an edge mask)
+
+    auto iter_graph_view = graph_view;
+    edge_property_t<GraphViewType, bool> iter_edge_mask(handle);
+    if (changed_vertices && !graph_view.has_edge_mask()) {
+      edge_dst_property_t<GraphViewType, bool> dst_changed_flags(handle, graph_view);
+      fill_edge_dst_property(handle, graph_view, dst_changed_flags.mutable_view(), false);
+      fill_edge_dst_property(handle,
+                             graph_view,
+                             (*changed_vertices).begin(),
+                             (*changed_vertices).end(),
+                             dst_changed_flags.mutable_view(),
+                             true);
+      iter_edge_mask = edge_property_t<GraphViewType, bool>(handle, graph_view);
+      transform_e(handle,
+                  graph_view,
+                  edge_src_dummy_property_t{}.view(),
+                  dst_changed_flags.view(),
+                  edge_dummy_property_t{}.view(),
+                  return_hyper_anf_dst_flag_t<vertex_t>{},
+                  iter_edge_mask.mutable_view());
+      iter_graph_view.attach_edge_mask(iter_edge_mask.view());
+    }
+
+    thrust::fill(handle.get_thrust_policy(), changed_flags.begin(), changed_flags.end(), false);
+
+    for (size_t w = 0; w < num_words; ++w) {
+      auto words = registers.data() + w * static_cast<size_t>(num_local_vertices);
+      if constexpr (GraphViewType::is_multi_gpu) {
+        update_edge_dst_property(handle, graph_view, words, dst_words.mutable_view());
+      }
+
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        iter_graph_view,
+        edge_src_dummy_property_t{}.view(),
+        GraphViewType::is_multi_gpu
+          ? dst_words.view()
+          : detail::edge_minor_property_view_t<vertex_t, uint64_t const*>(words, vertex_t{0}),
+        edge_dummy_property_t{}.view(),
+        return_hyper_anf_dst_word_t<vertex_t>{},
+        uint64_t{0},
+        hyper_anf_register_wise_max_t{},
+        new_words.begin());
+
+      // the registers are independent, so updating word w in place does not affect the other
+      // words of this iteration
+
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(vertex_t{0}),
+                       thrust::make_counting_iterator(num_local_vertices),
+                       [words,
+                        new_words     = new_words.data(),
+                        changed_flags = changed_flags.data()] __device__(vertex_t v_offset) {
+                         auto old_word = words[v_offset];
+                         auto word     = hyper_anf_register_wise_max(old_word, new_words[v_offset]);
+                         if (word != old_word) {
+                           words[v_offset]         = word;
+                           changed_flags[v_offset] = true;
+                         }
+                       });
+    }
+
+    rmm::device_uvector<vertex_t> tmp_changed_vertices(num_local_vertices, handle.get_stream());
+    tmp_changed_vertices.resize(
+      thrust::distance(
+        tmp_changed_vertices.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(v_first),
+                        thrust::make_counting_iterator(v_first + num_local_vertices),
+                        tmp_changed_vertices.begin(),
+                        [changed_flags = changed_flags.data(), v_first] __device__(vertex_t v) {
+                          return changed_flags[v - v_first];
+                        })),
+      handle.get_stream());
+    auto num_changed = tmp_changed_vertices.size();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_changed = host_scalar_allreduce(
+        handle.get_comms(), num_changed, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_changed == 0) { break; }
+    changed_vertices = std::move(tmp_changed_vertices);
+
+    // the estimated number of vertices at distance t is |B(v, t)| - |B(v, t - 1)| (clamped as the
+    // estimates are not exact)
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      (*changed_vertices).begin(),
+      (*changed_vertices).end(),
+      [estimate_op,
+       estimates             = estimates.data(),
+       harmonic_centralities = harmonic_centralities.data(),
+       distance_sums         = distance_sums.data(),
+       distance              = static_cast<double>(t),
+       v_first] __device__(vertex_t v) {
+        auto v_offset = v - v_first;
+        auto estimate = estimate_op(v_offset);
+        auto delta    = estimate - estimates[v_offset];
+        if (delta > 0.0) {
+          harmonic_centralities[v_offset] += delta / distance;
+          distance_sums[v_offset] += delta * distance;
+          estimates[v_offset] = estimate;
+        }
+      });
+
+    neighborhood_function.push_back(sum_estimates(estimates));
+  }
+
+  // 4. closeness (among the reachable vertices) and effective diameter
+
+  rmm::device_uvector<double> closeness_centralities(num_local_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    estimates.begin(),
+                    estimates.end(),
+                    distance_sums.begin(),
+                    closeness_centralities.begin(),
+                    [] __device__(double estimate, double distance_sum) {
+                      return ((distance_sum > 0.0) && (estimate > 1.0))
+                               ? (estimate - 1.0) / distance_sum
+                               : 0.0;
+                    });
+
+  double effective_diameter{0.0};
+  auto threshold = effective_diameter_fraction * neighborhood_function.back();
+  for (size_t t = 0; t < neighborhood_function.size(); ++t) {
+    if (neighborhood_function[t] >= threshold) {
+      if (t > 0) {
+        auto prev          = neighborhood_function[t - 1];
+        effective_diameter = static_cast<double>(t - 1) +
+                             (threshold - prev) / (neighborhood_function[t] - prev);
+      }
+      break;
+    }
+  }
+
+  return std::make_tuple(std::move(neighborhood_function),
+                         std::move(harmonic_centralities),
+                         std::move(closeness_centralities),
+                         effective_diameter);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<std::vector<double>, rmm::device_uvector<double>, rmm::device_uvector<double>, double>
+hyper_anf(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+          size_t log2_num_registers,
+          size_t max_distance,
+          double effective_diameter_fraction,
+          bool do_expensive_check)
+{
+  return detail::hyper_anf(handle,
+                           graph_view,
+                           log2_num_registers,
+                           max_distance,
+                           effective_diameter_fraction,
+                           do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "centrality/hyper_anf_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::
+  tuple<std::vector<double>, rmm::device_uvector<double>, rmm::device_uvector<double>, double>
+  hyper_anf(raft::handle_t const& handle,
+            graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+            size_t log2_num_registers,
+            size_t max_distance,
+            double effective_diameter_fraction,
+            bool do_expensive_check);
+
+}  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,23 +20,40 @@
 #include "prims/reduce_op.cuh"
 #include "prims/transform_reduce_v.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+#include "utilities/cuda_graph_utils.cuh"
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/error.hpp>
 
 #include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
 
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/atomic>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <vector>
+
 namespace cugraph {
 namespace detail {
 
@@ -54,7 +71,8 @@ void katz_centrality(
   size_t max_iterations,
   bool has_initial_guess,
   bool normalize,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
 {
   using vertex_t = typename GraphViewType::vertex_type;
 
@@ -73,6 +91,17 @@ void katz_centrality(
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(schedule.num_blocks > 0,
+                  "Invalid input argument: schedule.num_blocks should be positive.");
+  CUGRAPH_EXPECTS(
+    schedule.convergence_check_interval > 0,
+    "Invalid input argument: schedule.convergence_check_interval should be positive.");
+  CUGRAPH_EXPECTS(!schedule.message_precision.has_value(),
+                  "Invalid input argument: schedule.message_precision is supported by PageRank "
+                  "only.");
+  CUGRAPH_EXPECTS(!schedule.use_cuda_graph,
+                  "Invalid input argument: schedule.use_cuda_graph is supported by batched "
+                  "personalized PageRank and batched Katz Centrality only.");
 
   if (do_expensive_check) {
     if (has_initial_guess) {
@@ -102,68 +131,147 @@ void katz_centrality(
   edge_src_property_t<GraphViewType, result_t> edge_src_katz_centralities(handle, pull_graph_view);
   auto new_katz_centralities = katz_centralities;
   auto old_katz_centralities = tmp_katz_centralities.data();
+
+  // block Gauss-Seidel iteration: the blocks are updated (in place) one after another, and the
+  // values of a block are pushed to edge_src_katz_centralities right after the block is updated
+  std::optional<rmm::device_uvector<vertex_t>> local_vertices{std::nullopt};
+  if (schedule.num_blocks > 1) {
+    local_vertices = rmm::device_uvector<vertex_t>(
+      pull_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    detail::sequence_fill(handle.get_stream(),
+                          local_vertices->data(),
+                          local_vertices->size(),
+                          pull_graph_view.local_vertex_partition_range_first());
+    update_edge_src_property(
+      handle, pull_graph_view, katz_centralities, edge_src_katz_centralities.mutable_view());
+  }
+
   size_t iter{0};
   while (true) {
-    std::swap(new_katz_centralities, old_katz_centralities);
+    auto check_convergence = ((iter + 1) % schedule.convergence_check_interval == 0) ||
+                             (iter + 1 >= max_iterations);
 
-    update_edge_src_property(
-      handle, pull_graph_view, old_katz_centralities, edge_src_katz_centralities.mutable_view());
+    if (!local_vertices) {
+      std::swap(new_katz_centralities, old_katz_centralities);
 
-    if (edge_weight_view) {
-      per_v_transform_reduce_incoming_e(
-        handle,
-        pull_graph_view,
-        edge_src_katz_centralities.view(),
-        edge_dst_dummy_property_t{}.view(),
-        *edge_weight_view,
-        [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, weight_t w) {
-          return static_cast<result_t>(alpha * src_val * w);
-        },
-        betas != nullptr ? result_t{0.0} : beta,
-        reduce_op::plus<result_t>{},
-        new_katz_centralities);
-    } else {
-      per_v_transform_reduce_incoming_e(
-        handle,
-        pull_graph_view,
-        edge_src_katz_centralities.view(),
-        edge_dst_dummy_property_t{}.view(),
-        edge_dummy_property_t{}.view(),
-        [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
-          return static_cast<result_t>(alpha * src_val * 1.0);
-        },
-        betas != nullptr ? result_t{0.0} : beta,
-        reduce_op::plus<result_t>{},
-        new_katz_centralities);
+      update_edge_src_property(
+        handle, pull_graph_view, old_katz_centralities, edge_src_katz_centralities.mutable_view());
+    } else if (check_convergence) {
+      thrust::copy(handle.get_thrust_policy(),
+                   new_katz_centralities,
+                   new_katz_centralities + pull_graph_view.local_vertex_partition_range_size(),
+                   old_katz_centralities);
     }
 
-    if (betas != nullptr) {
-      auto val_first = thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, betas));
-      thrust::transform(handle.get_thrust_policy(),
-                        val_first,
-                        val_first + pull_graph_view.local_vertex_partition_range_size(),
-                        new_katz_centralities,
-                        [] __device__(auto val) {
-                          auto const katz_centrality = thrust::get<0>(val);
-                          auto const beta            = thrust::get<1>(val);
-                          return katz_centrality + beta;
-                        });
-    }
+    for (size_t i = 0; i < schedule.num_blocks; ++i) {
+      auto num_local_vertices =
+        static_cast<size_t>(pull_graph_view.local_vertex_partition_range_size());
+      auto block_first = (num_local_vertices * i) / schedule.num_blocks;
+      auto block_last  = (num_local_vertices * (i + 1)) / schedule.num_blocks;
 
-    auto diff_sum = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
+      if (!local_vertices) {
+        if (edge_weight_view) {
+          per_v_transform_reduce_incoming_e(
+            handle,
+            pull_graph_view,
+            edge_src_katz_centralities.view(),
+            edge_dst_dummy_property_t{}.view(),
+            *edge_weight_view,
+            [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, weight_t w) {
+              return static_cast<result_t>(alpha * src_val * w);
+            },
+            betas != nullptr ? result_t{0.0} : beta,
+            reduce_op::plus<result_t>{},
+            new_katz_centralities);
+        } else {
+          per_v_transform_reduce_incoming_e(
+            handle,
+            pull_graph_view,
+            edge_src_katz_centralities.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_dummy_property_t{}.view(),
+            [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
+              return static_cast<result_t>(alpha * src_val * 1.0);
+            },
+            betas != nullptr ? result_t{0.0} : beta,
+            reduce_op::plus<result_t>{},
+            new_katz_centralities);
+        }
+      } else {
+        key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> block(
+          handle,
+          raft::device_span<vertex_t const>(local_vertices->data() + block_first,
+                                            block_last - block_first));
+        if (edge_weight_view) {
+          per_v_transform_reduce_incoming_e(
+            handle,
+            pull_graph_view,
+            block,
+            edge_src_katz_centralities.view(),
+            edge_dst_dummy_property_t{}.view(),
+            *edge_weight_view,
+            [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, weight_t w) {
+              return static_cast<result_t>(alpha * src_val * w);
+            },
+            betas != nullptr ? result_t{0.0} : beta,
+            reduce_op::plus<result_t>{},
+            new_katz_centralities + block_first);
+        } else {
+          per_v_transform_reduce_incoming_e(
+            handle,
+            pull_graph_view,
+            block,
+            edge_src_katz_centralities.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_dummy_property_t{}.view(),
+            [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
+              return static_cast<result_t>(alpha * src_val * 1.0);
+            },
+            betas != nullptr ? result_t{0.0} : beta,
+            reduce_op::plus<result_t>{},
+            new_katz_centralities + block_first);
+        }
+      }
+
+      if (betas != nullptr) {
+        auto val_first = thrust::make_zip_iterator(
+          thrust::make_tuple(new_katz_centralities + block_first, betas + block_first));
+        thrust::transform(handle.get_thrust_policy(),
+                          val_first,
+                          val_first + (block_last - block_first),
+                          new_katz_centralities + block_first,
+                          [] __device__(auto val) {
+                            auto const katz_centrality = thrust::get<0>(val);
+                            auto const beta            = thrust::get<1>(val);
+                            return katz_centrality + beta;
+                          });
+      }
+
+      if (local_vertices) {
+        update_edge_src_property(handle,
+                                 pull_graph_view,
+                                 local_vertices->begin() + block_first,
+                                 local_vertices->begin() + block_last,
+                                 new_katz_centralities,
+                                 edge_src_katz_centralities.mutable_view());
+      }
+    }
 
     iter++;
 
-    if (diff_sum < epsilon) {
-      break;
-    } else if (iter >= max_iterations) {
-      CUGRAPH_FAIL("Katz Centrality failed to converge.");
+    if (check_convergence) {
+      auto diff_sum = transform_reduce_v(
+        handle,
+        pull_graph_view,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
+        [] __device__(auto, auto val) {
+          return std::abs(thrust::get<0>(val) - thrust::get<1>(val));
+        },
+        result_t{0.0});
+      if (diff_sum < epsilon) { break; }
     }
+    if (iter >= max_iterations) { CUGRAPH_FAIL("Katz Centrality failed to converge."); }
   }
 
   if (new_katz_centralities != katz_centralities) {
@@ -191,6 +299,337 @@ void katz_centrality(
   }
 }
 
+// next iterate of column k (of the [V x K] row-major scores) at vertex v, pulled over the
+// in-coming edges of v, the scores of the converged columns are carried over
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+struct batched_katz_spmm_op_t {
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition{};
+  weight_t const* edge_weights{nullptr};
+  raft::device_span<result_t const> alphas{};
+  raft::device_span<result_t const> betas{};
+  raft::device_span<result_t const> katz_centralities{};
+  raft::device_span<result_t> new_katz_centralities{};
+  raft::device_span<bool const> converged{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = i % batch_size;
+    if (converged[k]) {
+      new_katz_centralities[i] = katz_centralities[i];
+      return;
+    }
+
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) =
+      edge_partition.local_edges(static_cast<vertex_t>(i / batch_size));
+    result_t sum{0.0};
+    for (edge_t j = 0; j < local_degree; ++j) {
+      auto w = edge_weights != nullptr ? static_cast<result_t>(edge_weights[edge_offset + j])
+                                       : result_t{1.0};
+      sum += katz_centralities[static_cast<size_t>(indices[j]) * batch_size + k] * w;
+    }
+    new_katz_centralities[i] = alphas[k] * sum + betas[k];
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct batched_katz_personalization_op_t {
+  raft::device_span<vertex_t const> vertices{};
+  raft::device_span<result_t const> values{};
+  raft::device_span<size_t const> columns{};
+  raft::device_span<bool const> converged{};
+  raft::device_span<result_t> new_katz_centralities{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = columns[i];
+    if (converged[k]) { return; }
+    // a personalization vector may list a vertex more than once
+    cuda::atomic_ref<result_t, cuda::thread_scope_device> katz_centrality(
+      new_katz_centralities[static_cast<size_t>(vertices[i]) * batch_size + k]);
+    katz_centrality.fetch_add(values[i], cuda::std::memory_order_relaxed);
+  }
+};
+
+template <typename result_t>
+struct batched_katz_diff_sum_op_t {
+  raft::device_span<result_t const> katz_centralities{};
+  raft::device_span<result_t const> new_katz_centralities{};
+  raft::device_span<bool const> converged{};
+  raft::device_span<result_t> diff_sums{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = i % batch_size;
+    if (converged[k]) { return; }
+    cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(diff_sums[k]);
+    sum.fetch_add(std::abs(new_katz_centralities[i] - katz_centralities[i]),
+                  cuda::std::memory_order_relaxed);
+  }
+};
+
+template <typename result_t>
+struct batched_katz_update_converged_op_t {
+  result_t epsilon{};
+
+  __device__ bool operator()(bool c, result_t diff_sum) const
+  {
+    return c || (diff_sum < epsilon);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> batched_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<result_t const> alphas,
+  raft::device_span<result_t const> betas,
+  std::optional<std::tuple<raft::device_span<size_t const>,
+                           raft::device_span<vertex_t const>,
+                           raft::device_span<result_t const>>> personalization,
+  result_t epsilon,
+  size_t max_iterations,
+  bool normalize,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
+{
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS((schedule.num_blocks == 1) && !schedule.message_precision, "unimplemented.");
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(alphas.size() > 0,
+                  "Invalid input argument: there should be at least one (alpha, beta) pair.");
+  CUGRAPH_EXPECTS(alphas.size() == betas.size(),
+                  "Invalid input argument: the size of alphas and betas should match.");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(
+    schedule.convergence_check_interval > 0,
+    "Invalid input argument: schedule.convergence_check_interval should be positive.");
+
+  auto const batch_size = alphas.size();
+
+  CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                   alphas.begin(),
+                                   alphas.end(),
+                                   [] __device__(auto alpha) {
+                                     return !((alpha >= 0.0) && (alpha <= 1.0));
+                                   }) == 0,
+                  "Invalid input argument: alphas should be in [0.0, 1.0].");
+
+  if (personalization) {
+    auto [offsets, vertices, values] = *personalization;
+    CUGRAPH_EXPECTS(offsets.size() == batch_size + 1,
+                    "Invalid input argument: the size of personalization offsets should be the "
+                    "number of (alpha, beta) pairs + 1.");
+    CUGRAPH_EXPECTS(vertices.size() == values.size(),
+                    "Invalid input argument: the size of personalization vertices and values "
+                    "should match.");
+
+    std::vector<size_t> h_offset_bounds(2);
+    raft::update_host(h_offset_bounds.data(), offsets.data(), 1, handle.get_stream());
+    raft::update_host(
+      h_offset_bounds.data() + 1, offsets.data() + batch_size, 1, handle.get_stream());
+    handle.sync_stream();
+    CUGRAPH_EXPECTS((h_offset_bounds[0] == 0) && (h_offset_bounds[1] == vertices.size()),
+                    "Invalid input argument: personalization offsets should start at 0 and end at "
+                    "the number of personalization vertices.");
+
+    if (do_expensive_check) {
+      CUGRAPH_EXPECTS(
+        thrust::is_sorted(handle.get_thrust_policy(), offsets.begin(), offsets.end()),
+        "Invalid input argument: personalization offsets should be sorted.");
+      auto num_invalid_vertices = thrust::count_if(
+        handle.get_thrust_policy(),
+        vertices.begin(),
+        vertices.end(),
+        [num_vertices] __device__(auto v) { return (v < 0) || (v >= num_vertices); });
+      CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                      "Invalid input argument: personalization vertices have invalid vertex IDs.");
+    }
+  }
+
+  rmm::device_uvector<result_t> katz_centralities(0, handle.get_stream());
+  if (num_vertices == 0) {
+    return std::make_tuple(std::move(katz_centralities), centrality_algorithm_metadata_t{0, true});
+  }
+
+  // 2. map the personalization values to their columns
+
+  std::optional<rmm::device_uvector<size_t>> personalization_columns{std::nullopt};
+  if (personalization) {
+    auto [offsets, vertices, values] = *personalization;
+    personalization_columns = rmm::device_uvector<size_t>(vertices.size(), handle.get_stream());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        offsets.begin() + 1,
+                        offsets.end(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(vertices.size()),
+                        personalization_columns->begin());
+  }
+
+  // 3. katz centrality iteration, the K columns are updated together until they converge
+
+  auto const num_elements = static_cast<size_t>(num_vertices) * batch_size;
+
+  katz_centralities.resize(num_elements, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), katz_centralities.begin(), katz_centralities.end(), result_t{0.0});
+  rmm::device_uvector<result_t> new_katz_centralities(num_elements, handle.get_stream());
+
+  rmm::device_uvector<bool> converged(batch_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), converged.begin(), converged.end(), false);
+  rmm::device_uvector<result_t> diff_sums(batch_size, handle.get_stream());
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+
+  // an iteration neither synchronizes the stream nor allocates memory (so it can be captured in a
+  // CUDA graph), the columns converged in an iteration are carried over in the next iterations
+
+  auto run_iteration = [&](rmm::cuda_stream_view stream_view,
+                           raft::device_span<result_t const> old_scores,
+                           raft::device_span<result_t> new_scores) {
+    thrust::for_each(rmm::exec_policy_nosync(stream_view),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_elements),
+                     batched_katz_spmm_op_t<vertex_t, edge_t, weight_t, result_t>{
+                       edge_partition,
+                       edge_weight_view ? (*edge_weight_view).value_firsts()[0] : nullptr,
+                       alphas,
+                       betas,
+                       old_scores,
+                       new_scores,
+                       raft::device_span<bool const>{converged.data(), converged.size()},
+                       batch_size});
+
+    if (personalization) {
+      thrust::for_each(
+        rmm::exec_policy_nosync(stream_view),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(personalization_columns->size()),
+        batched_katz_personalization_op_t<vertex_t, result_t>{
+          std::get<1>(*personalization),
+          std::get<2>(*personalization),
+          raft::device_span<size_t const>{personalization_columns->data(),
+                                          personalization_columns->size()},
+          raft::device_span<bool const>{converged.data(), converged.size()},
+          new_scores,
+          batch_size});
+    }
+
+    thrust::fill(rmm::exec_policy_nosync(stream_view), diff_sums.begin(), diff_sums.end(), 0.0);
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_elements),
+      batched_katz_diff_sum_op_t<result_t>{
+        old_scores,
+        new_scores,
+        raft::device_span<bool const>{converged.data(), converged.size()},
+        raft::device_span<result_t>{diff_sums.data(), diff_sums.size()},
+        batch_size});
+
+    thrust::transform(rmm::exec_policy_nosync(stream_view),
+                      converged.begin(),
+                      converged.end(),
+                      diff_sums.begin(),
+                      converged.begin(),
+                      batched_katz_update_converged_op_t<result_t>{epsilon});
+  };
+
+  // scores[curr] holds the latest scores, with use_cuda_graph, an even number of iterations (so the
+  // latest scores end in the starting buffer) between two convergence checks are captured once per
+  // starting buffer and replayed with a single launch, the remaining iteration runs eagerly
+
+  std::array<result_t*, 2> scores{katz_centralities.data(), new_katz_centralities.data()};
+  size_t curr{0};
+  auto run_iterations = [&](rmm::cuda_stream_view stream_view, size_t num_iterations) {
+    for (size_t i = 0; i < num_iterations; ++i) {
+      run_iteration(stream_view,
+                    raft::device_span<result_t const>{scores[curr], num_elements},
+                    raft::device_span<result_t>{scores[1 - curr], num_elements});
+      curr = 1 - curr;
+    }
+  };
+  auto const num_graph_iterations =
+    schedule.use_cuda_graph ? (schedule.convergence_check_interval / 2) * 2 : size_t{0};
+  std::array<std::optional<cuda_graph_t>, 2> graphs{};
+
+  size_t iter{0};
+  size_t num_unconverged{batch_size};
+  while ((num_unconverged > 0) && (iter < max_iterations)) {
+    auto num_iterations = std::min(schedule.convergence_check_interval, max_iterations - iter);
+    auto num_replayed_iterations =
+      ((num_graph_iterations > 0) && (num_iterations >= num_graph_iterations))
+        ? num_graph_iterations
+        : size_t{0};
+    if (num_replayed_iterations > 0) {
+      if (!graphs[curr]) {
+        graphs[curr].emplace(handle.get_stream(), [&](rmm::cuda_stream_view stream_view) {
+          run_iterations(stream_view, num_graph_iterations);
+        });
+      }
+      graphs[curr]->launch(handle.get_stream());
+    }
+    run_iterations(handle.get_stream(), num_iterations - num_replayed_iterations);
+    iter += num_iterations;
+
+    num_unconverged = static_cast<size_t>(
+      thrust::count(handle.get_thrust_policy(), converged.begin(), converged.end(), false));
+  }
+
+  if (curr != 0) { katz_centralities.swap(new_katz_centralities); }
+
+  // 4. normalize every column to the unit L2 norm
+
+  if (normalize) {
+    auto& l2_norms = diff_sums;
+    thrust::fill(handle.get_thrust_policy(), l2_norms.begin(), l2_norms.end(), result_t{0.0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_elements),
+                     [katz_centralities = katz_centralities.data(),
+                      l2_norms          = l2_norms.data(),
+                      batch_size] __device__(size_t i) {
+                       cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(
+                         l2_norms[i % batch_size]);
+                       sum.fetch_add(katz_centralities[i] * katz_centralities[i],
+                                     cuda::std::memory_order_relaxed);
+                     });
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     l2_norms.begin(),
+                                     l2_norms.end(),
+                                     [] __device__(auto sum) { return !(sum > 0.0); }) == 0,
+                    "L2 norm of the computed Katz Centrality values of every column should be "
+                    "positive.");
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_elements),
+      katz_centralities.begin(),
+      [katz_centralities = katz_centralities.data(),
+       l2_norms          = l2_norms.data(),
+       batch_size] __device__(size_t i) {
+        return katz_centralities[i] / std::sqrt(l2_norms[i % batch_size]);
+      });
+  }
+
+  return std::make_tuple(std::move(katz_centralities),
+                         centrality_algorithm_metadata_t{iter, num_unconverged == 0});
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
@@ -205,7 +644,8 @@ void katz_centrality(raft::handle_t const& handle,
                      size_t max_iterations,
                      bool has_initial_guess,
                      bool normalize,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     centrality_iteration_schedule_t schedule)
 {
   detail::katz_centrality(handle,
                           graph_view,
@@ -218,7 +658,37 @@ void katz_centrality(raft::handle_t const& handle,
                           max_iterations,
                           has_initial_guess,
                           normalize,
-                          do_expensive_check);
+                          do_expensive_check,
+                          schedule);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> batched_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<result_t const> alphas,
+  raft::device_span<result_t const> betas,
+  std::optional<std::tuple<raft::device_span<size_t const>,
+                           raft::device_span<vertex_t const>,
+                           raft::device_span<result_t const>>> personalization,
+  result_t epsilon,
+  size_t max_iterations,
+  bool normalize,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
+{
+  return detail::batched_katz_centrality(handle,
+                                         graph_view,
+                                         edge_weight_view,
+                                         alphas,
+                                         betas,
+                                         personalization,
+                                         epsilon,
+                                         max_iterations,
+                                         normalize,
+                                         do_expensive_check,
+                                         schedule);
 }
 
 }  // namespace cugraph
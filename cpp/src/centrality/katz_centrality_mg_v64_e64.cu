@@ -31,7 +31,8 @@ template void katz_centrality(
   size_t max_iterations,
   bool has_initial_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
 
 template void katz_centrality(
   raft::handle_t const& handle,
@@ -45,6 +46,7 @@ template void katz_centrality(
   size_t max_iterations,
   bool has_initial_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
 
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,7 +31,8 @@ template void katz_centrality(
   size_t max_iterations,
   bool has_initial_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
 
 template void katz_centrality(
   raft::handle_t const& handle,
@@ -45,6 +46,39 @@ template void katz_centrality(
   size_t max_iterations,
   bool has_initial_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t>
+batched_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::device_span<float const> alphas,
+  raft::device_span<float const> betas,
+  std::optional<std::tuple<raft::device_span<size_t const>,
+                           raft::device_span<int32_t const>,
+                           raft::device_span<float const>>> personalization,
+  float epsilon,
+  size_t max_iterations,
+  bool normalize,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t>
+batched_katz_centrality(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::device_span<double const> alphas,
+  raft::device_span<double const> betas,
+  std::optional<std::tuple<raft::device_span<size_t const>,
+                           raft::device_span<int32_t const>,
+                           raft::device_span<double const>>> personalization,
+  double epsilon,
+  size_t max_iterations,
+  bool normalize,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
 
 }  // namespace cugraph
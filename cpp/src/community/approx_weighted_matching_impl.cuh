@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "detail/residual_subgraph.cuh"
 #include "prims/fill_edge_property.cuh"
 #include "prims/reduce_op.cuh"
 #include "prims/transform_e.cuh"
@@ -28,7 +29,10 @@
 
 #include <raft/core/handle.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
 
 namespace cugraph {
 
@@ -75,6 +79,8 @@ std::tuple<rmm::device_uvector<vertex_t>, weight_t> approximate_weighted_matchin
   if (current_graph_view.has_edge_mask()) current_graph_view.clear_edge_mask();
   current_graph_view.attach_edge_mask(edge_masks_even.view());
 
+  auto const num_edges = static_cast<size_t>(current_graph_view.compute_number_of_edges(handle));
+
   auto constexpr invalid_partner = invalid_vertex_id<vertex_t>::value;
   rmm::device_uvector<weight_t> offers_from_partners(
     current_graph_view.local_vertex_partition_range_size(), handle.get_stream());
@@ -109,6 +115,8 @@ std::tuple<rmm::device_uvector<vertex_t>, weight_t> approximate_weighted_matchin
     dst_match_flags = cugraph::edge_dst_property_t<graph_view_t, bool>(handle, current_graph_view);
   }
 
+  weight_t tail_matched_edge_weights{0.0};
+
   vertex_t loop_counter = 0;
   while (true) {
     //
@@ -297,8 +305,6 @@ std::tuple<rmm::device_uvector<vertex_t>, weight_t> approximate_weighted_matchin
         }
       });
 
-    if (current_graph_view.compute_number_of_edges(handle) == 0) { break; }
-
     if constexpr (graph_view_t::is_multi_gpu) {
       cugraph::update_edge_src_property(
         handle, current_graph_view, is_vertex_matched.begin(), src_match_flags.mutable_view());
@@ -373,6 +379,78 @@ std::tuple<rmm::device_uvector<vertex_t>, weight_t> approximate_weighted_matchin
     }
 
     loop_counter++;
+
+    auto num_residual_edges =
+      static_cast<size_t>(current_graph_view.compute_number_of_edges(handle));
+    if (num_residual_edges == 0) { break; }
+
+    if (switch_to_tail(num_residual_edges, num_edges)) {
+      // The residual graph (unmatched vertices with unmatched neighbors) is small, match it on a
+      // single GPU
+      auto residual_degrees = current_graph_view.compute_out_degrees(handle);
+      rmm::device_uvector<vertex_t> residual_vertices(residual_degrees.size(),
+                                                      handle.get_stream());
+      residual_vertices.resize(
+        thrust::distance(
+          residual_vertices.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          local_vertices.begin(),
+                          local_vertices.end(),
+                          residual_degrees.begin(),
+                          residual_vertices.begin(),
+                          [] __device__(edge_t degree) { return degree > 0; })),
+        handle.get_stream());
+
+      auto residual_graph = gather_induced_subgraph(
+        handle,
+        current_graph_view,
+        std::make_optional(edge_weight_view),
+        raft::device_span<vertex_t const>(residual_vertices.data(), residual_vertices.size()));
+
+      rmm::device_uvector<vertex_t> tail_vertices(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> tail_partners(0, handle.get_stream());
+      if (residual_graph) {
+        auto& [subgraph, subgraph_weights, renumber_map] = *residual_graph;
+        auto [subgraph_partners, subgraph_matched_edge_weights] =
+          approximate_weighted_matching<vertex_t, edge_t, weight_t, false>(
+            handle, subgraph.view(), (*subgraph_weights).view());
+        tail_matched_edge_weights = subgraph_matched_edge_weights;
+
+        tail_partners.resize(subgraph_partners.size(), handle.get_stream());
+        thrust::transform(handle.get_thrust_policy(),
+                          subgraph_partners.begin(),
+                          subgraph_partners.end(),
+                          tail_partners.begin(),
+                          [renumber_map = renumber_map.data()] __device__(vertex_t partner) {
+                            return partner != invalid_partner ? renumber_map[partner]
+                                                              : invalid_partner;
+                          });
+        tail_vertices = std::move(renumber_map);
+      }
+
+      std::tie(tail_vertices, tail_partners) =
+        scatter_from_root<vertex_t, vertex_t, graph_view_t::is_multi_gpu>(
+          handle,
+          std::move(tail_vertices),
+          std::move(tail_partners),
+          current_graph_view.vertex_partition_range_lasts());
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(tail_vertices.begin(), tail_partners.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(tail_vertices.end(), tail_partners.end())),
+        [partners = partners.begin(),
+         v_first  = current_graph_view.local_vertex_partition_range_first()] __device__(auto pair) {
+          auto partner = thrust::get<1>(pair);
+          if (partner != invalid_partner) { partners[thrust::get<0>(pair) - v_first] = partner; }
+        });
+
+      if constexpr (graph_view_t::is_multi_gpu) {
+        tail_matched_edge_weights = host_scalar_bcast(
+          handle.get_comms(), tail_matched_edge_weights, int{0}, handle.get_stream());
+      }
+      break;
+    }
   }
 
   weight_t sum_matched_edge_weights = thrust::reduce(
@@ -383,7 +461,8 @@ std::tuple<rmm::device_uvector<vertex_t>, weight_t> approximate_weighted_matchin
       handle.get_comms(), sum_matched_edge_weights, raft::comms::op_t::SUM, handle.get_stream());
   }
 
-  return std::make_tuple(std::move(partners), sum_matched_edge_weights / 2.0);
+  return std::make_tuple(std::move(partners),
+                         sum_matched_edge_weights / 2.0 + tail_matched_edge_weights);
 }
 }  // namespace detail
 
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/algorithms.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace cugraph {
+
+namespace {
+
+// cluster placement hints per handle (process-wide)
+std::mutex cluster_placement_hint_mutex{};
+std::map<raft::handle_t const*, cluster_placement_t> cluster_placement_hints{};
+
+}  // namespace
+
+void set_cluster_placement_hint(raft::handle_t const& handle, cluster_placement_t placement)
+{
+  std::lock_guard<std::mutex> lock(cluster_placement_hint_mutex);
+  if (placement == cluster_placement_t::hash) {
+    cluster_placement_hints.erase(&handle);
+  } else {
+    cluster_placement_hints.insert_or_assign(&handle, placement);
+  }
+}
+
+cluster_placement_t get_cluster_placement_hint(raft::handle_t const& handle)
+{
+  std::lock_guard<std::mutex> lock(cluster_placement_hint_mutex);
+  auto it = cluster_placement_hints.find(&handle);
+  return it != cluster_placement_hints.end() ? it->second : cluster_placement_t::hash;
+}
+
+}  // namespace cugraph
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "prims/per_v_random_select_transform_outgoing_e.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+namespace {
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct non_self_loop_degree_e_op_t {
+  __device__ edge_t operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t)
+    const
+  {
+    return src != dst ? edge_t{1} : edge_t{0};
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct sampled_wedge_endpoint_e_op_t {
+  __device__ vertex_t operator()(
+    vertex_t, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t)
+    const
+  {
+    return dst;
+  }
+};
+
+template <typename edge_t>
+__host__ __device__ double wedge_count(edge_t degree)
+{
+  return static_cast<double>(degree) * static_cast<double>(degree - 1) * 0.5;
+}
+
+// local vertices' degrees excluding self-loops (the graph is symmetric and not a multi-graph, so
+// this is the number of distinct neighbors)
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::edge_type> compute_non_self_loop_degrees(
+  raft::handle_t const& handle, GraphViewType const& graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  rmm::device_uvector<edge_t> degrees(graph_view.local_vertex_partition_range_size(),
+                                      handle.get_stream());
+  per_v_transform_reduce_outgoing_e(handle,
+                                    graph_view,
+                                    edge_src_dummy_property_t{}.view(),
+                                    edge_dst_dummy_property_t{}.view(),
+                                    edge_dummy_property_t{}.view(),
+                                    non_self_loop_degree_e_op_t<vertex_t, edge_t>{},
+                                    edge_t{0},
+                                    reduce_op::plus<edge_t>{},
+                                    degrees.begin());
+  return degrees;
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<double>, double, double> clustering_coefficient(
+  raft::handle_t const& handle, GraphViewType const& graph_view, bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: clustering_coefficient currently supports undirected "
+                  "graphs only.");
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: clustering_coefficient currently does not support "
+                  "multi-graphs.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  // 2. triangle counts and degrees
+
+  rmm::device_uvector<edge_t> triangle_counts(graph_view.local_vertex_partition_range_size(),
+                                              handle.get_stream());
+  triangle_count(handle,
+                 graph_view,
+                 std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+                 raft::device_span<edge_t>(triangle_counts.data(), triangle_counts.size()),
+                 do_expensive_check);
+
+  auto degrees = compute_non_self_loop_degrees(handle, graph_view);
+
+  // 3. local clustering coefficients, and the global sums (sum_v triangles(v) = 3 x the number of
+  // triangles)
+
+  rmm::device_uvector<double> coefficients(triangle_counts.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    triangle_counts.begin(),
+                    triangle_counts.end(),
+                    degrees.begin(),
+                    coefficients.begin(),
+                    [] __device__(edge_t num_triangles, edge_t degree) {
+                      return degree >= edge_t{2}
+                               ? static_cast<double>(num_triangles) / wedge_count(degree)
+                               : 0.0;
+                    });
+
+  auto pair_first = thrust::make_zip_iterator(triangle_counts.begin(), degrees.begin());
+  auto sums       = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + triangle_counts.size(),
+    [] __device__(auto pair) {
+      return thrust::make_tuple(static_cast<double>(thrust::get<0>(pair)),
+                                wedge_count(thrust::get<1>(pair)));
+    },
+    thrust::make_tuple(0.0, 0.0),
+    reduce_op::plus<thrust::tuple<double, double>>{});
+  auto coefficient_sum =
+    thrust::reduce(handle.get_thrust_policy(), coefficients.begin(), coefficients.end(), 0.0);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    sums            = host_scalar_allreduce(
+      handle.get_comms(), sums, raft::comms::op_t::SUM, handle.get_stream());
+    coefficient_sum = host_scalar_allreduce(
+      handle.get_comms(), coefficient_sum, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  auto transitivity =
+    thrust::get<1>(sums) > 0.0 ? thrust::get<0>(sums) / thrust::get<1>(sums) : 0.0;
+  auto average_coefficient =
+    graph_view.number_of_vertices() > 0
+      ? coefficient_sum / static_cast<double>(graph_view.number_of_vertices())
+      : 0.0;
+
+  return std::make_tuple(std::move(coefficients), transitivity, average_coefficient);
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>, double, double>
+approximate_clustering_coefficient(raft::handle_t const& handle,
+                                   raft::random::RngState& rng_state,
+                                   GraphViewType const& graph_view,
+                                   size_t num_wedge_samples_per_vertex,
+                                   bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: approximate_clustering_coefficient currently supports "
+                  "undirected graphs only.");
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: approximate_clustering_coefficient currently does not "
+                  "support multi-graphs.");
+  CUGRAPH_EXPECTS(num_wedge_samples_per_vertex > 0,
+                  "Invalid input argument: num_wedge_samples_per_vertex should be positive.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto const v_first = graph_view.local_vertex_partition_range_first();
+
+  auto degrees = compute_non_self_loop_degrees(handle, graph_view);
+
+  // 2. sample the wedge endpoints (pairs of neighbors, with replacement) of every vertex with two
+  // or more neighbors
+
+  rmm::device_uvector<vertex_t> centers(degrees.size(), handle.get_stream());
+  centers.resize(
+    thrust::distance(centers.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(v_first),
+                                     thrust::make_counting_iterator(
+                                       graph_view.local_vertex_partition_range_last()),
+                                     centers.begin(),
+                                     [degrees = degrees.data(), v_first] __device__(vertex_t v) {
+                                       return degrees[v - v_first] >= edge_t{2};
+                                     })),
+    handle.get_stream());
+
+  key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> center_bucket(
+    handle, raft::device_span<vertex_t const>(centers.data(), centers.size()));
+  auto [sample_offsets, endpoints] = per_v_random_select_transform_outgoing_e(
+    handle,
+    graph_view,
+    center_bucket,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_dummy_property_t{}.view(),
+    edge_dummy_property_t{}.view(),
+    sampled_wedge_endpoint_e_op_t<vertex_t>{},
+    rng_state,
+    num_wedge_samples_per_vertex * 2,
+    true,
+    std::make_optional(invalid_vertex_id<vertex_t>::value));
+
+  // 3. a sampled pair is a uniformly drawn wedge if the endpoints are distinct and differ from the
+  // center (discarding the others keeps the remaining samples uniform), check if the wedges are
+  // closed
+
+  auto const num_pairs = centers.size() * num_wedge_samples_per_vertex;
+  rmm::device_uvector<vertex_t> edge_srcs(num_pairs, handle.get_stream());
+  rmm::device_uvector<vertex_t> edge_dsts(num_pairs, handle.get_stream());
+  rmm::device_uvector<size_t> pair_positions(num_pairs, handle.get_stream());
+  {
+    auto triplet_first =
+      thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin(), pair_positions.begin());
+    auto input_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(size_t{0}),
+      [endpoints = endpoints.data()] __device__(size_t i) {
+        return thrust::make_tuple(endpoints[2 * i], endpoints[2 * i + 1], i);
+      });
+    auto last = thrust::copy_if(
+      handle.get_thrust_policy(),
+      input_first,
+      input_first + num_pairs,
+      triplet_first,
+      [centers = centers.data(), num_wedge_samples_per_vertex] __device__(auto triplet) {
+        auto center = centers[thrust::get<2>(triplet) / num_wedge_samples_per_vertex];
+        auto u      = thrust::get<0>(triplet);
+        auto w      = thrust::get<1>(triplet);
+        return (u != w) && (u != center) && (w != center);
+      });
+    auto num_valid_pairs = static_cast<size_t>(thrust::distance(triplet_first, last));
+    edge_srcs.resize(num_valid_pairs, handle.get_stream());
+    edge_dsts.resize(num_valid_pairs, handle.get_stream());
+    pair_positions.resize(num_valid_pairs, handle.get_stream());
+  }
+  endpoints.resize(0, handle.get_stream());
+  endpoints.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<bool> edge_flags(0, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_rank       = comm.get_rank();
+    auto const comm_size       = comm.get_size();
+    auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    rmm::device_uvector<vertex_t> vertex_partition_range_lasts(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device(vertex_partition_range_lasts.data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+
+    rmm::device_uvector<int> origin_ranks(pair_positions.size(), handle.get_stream());
+    detail::scalar_fill(handle, origin_ranks.data(), origin_ranks.size(), comm_rank);
+
+    std::forward_as_tuple(std::tie(edge_srcs, edge_dsts, pair_positions, origin_ranks),
+                          std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(
+          edge_srcs.begin(), edge_dsts.begin(), pair_positions.begin(), origin_ranks.begin()),
+        thrust::make_zip_iterator(
+          edge_srcs.end(), edge_dsts.end(), pair_positions.end(), origin_ranks.end()),
+        [key_func =
+           detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+             raft::device_span<vertex_t const>(vertex_partition_range_lasts.data(),
+                                               vertex_partition_range_lasts.size()),
+             comm_size,
+             major_comm_size,
+             minor_comm_size}] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+
+    edge_flags = graph_view.has_edge(
+      handle,
+      raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+      raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
+
+    std::forward_as_tuple(std::tie(edge_flags, pair_positions, origin_ranks), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(edge_flags.begin(), pair_positions.begin(), origin_ranks.begin()),
+        thrust::make_zip_iterator(edge_flags.end(), pair_positions.end(), origin_ranks.end()),
+        [] __device__(auto val) { return thrust::get<2>(val); },
+        handle.get_stream());
+  } else {
+    edge_flags = graph_view.has_edge(
+      handle,
+      raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+      raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
+  }
+
+  // 4. per-vertex estimates (the fraction of the sampled wedges that are closed) and their
+  // standard errors
+
+  rmm::device_uvector<uint32_t> valid_counts(centers.size(), handle.get_stream());
+  rmm::device_uvector<uint32_t> closed_counts(centers.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), valid_counts.begin(), valid_counts.end(), uint32_t{0});
+  thrust::fill(handle.get_thrust_policy(), closed_counts.begin(), closed_counts.end(), uint32_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_zip_iterator(edge_flags.begin(), pair_positions.begin()),
+                   thrust::make_zip_iterator(edge_flags.end(), pair_positions.end()),
+                   [valid_counts  = valid_counts.data(),
+                    closed_counts = closed_counts.data(),
+                    num_wedge_samples_per_vertex] __device__(auto pair) {
+                     auto center_idx = thrust::get<1>(pair) / num_wedge_samples_per_vertex;
+                     atomicAdd(valid_counts + center_idx, uint32_t{1});
+                     if (thrust::get<0>(pair)) {
+                       atomicAdd(closed_counts + center_idx, uint32_t{1});
+                     }
+                   });
+
+  rmm::device_uvector<double> coefficients(degrees.size(), handle.get_stream());
+  rmm::device_uvector<double> standard_errors(degrees.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), coefficients.begin(), coefficients.end(), 0.0);
+  thrust::fill(handle.get_thrust_policy(), standard_errors.begin(), standard_errors.end(), 0.0);
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(centers.size()),
+                   [centers         = centers.data(),
+                    valid_counts    = valid_counts.data(),
+                    closed_counts   = closed_counts.data(),
+                    coefficients    = coefficients.data(),
+                    standard_errors = standard_errors.data(),
+                    v_first] __device__(size_t i) {
+                     if (valid_counts[i] == 0) { return; }
+                     auto n        = static_cast<double>(valid_counts[i]);
+                     auto p        = static_cast<double>(closed_counts[i]) / n;
+                     auto v_offset = centers[i] - v_first;
+                     coefficients[v_offset]    = p;
+                     standard_errors[v_offset] = sqrt(p * (1.0 - p) / n);
+                   });
+
+  // 5. transitivity is the wedge count weighted average of the local coefficients (stratified
+  // sampling with a stratum per vertex)
+
+  auto triplet_first =
+    thrust::make_zip_iterator(degrees.begin(), coefficients.begin(), standard_errors.begin());
+  auto sums = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    triplet_first,
+    triplet_first + degrees.size(),
+    [] __device__(auto triplet) {
+      auto w = wedge_count(thrust::get<0>(triplet));
+      auto e = thrust::get<2>(triplet);
+      return thrust::make_tuple(w * thrust::get<1>(triplet), w, w * w * e * e);
+    },
+    thrust::make_tuple(0.0, 0.0, 0.0),
+    reduce_op::plus<thrust::tuple<double, double, double>>{});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    sums =
+      host_scalar_allreduce(handle.get_comms(), sums, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  auto transitivity{0.0};
+  auto transitivity_standard_error{0.0};
+  if (thrust::get<1>(sums) > 0.0) {
+    transitivity                = thrust::get<0>(sums) / thrust::get<1>(sums);
+    transitivity_standard_error = std::sqrt(thrust::get<2>(sums)) / thrust::get<1>(sums);
+  }
+
+  return std::make_tuple(std::move(coefficients),
+                         std::move(standard_errors),
+                         transitivity,
+                         transitivity_standard_error);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, double, double> clustering_coefficient(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check)
+{
+  return detail::clustering_coefficient(handle, graph_view, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>, double, double>
+approximate_clustering_coefficient(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t num_wedge_samples_per_vertex,
+  bool do_expensive_check)
+{
+  return detail::approximate_clustering_coefficient(
+    handle, rng_state, graph_view, num_wedge_samples_per_vertex, do_expensive_check);
+}
+
+}  // namespace cugraph
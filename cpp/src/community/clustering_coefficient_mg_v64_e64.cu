@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "community/clustering_coefficient_impl.cuh"
+
+namespace cugraph {
+
+template std::tuple<rmm::device_uvector<double>, double, double> clustering_coefficient(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>, double, double>
+approximate_clustering_coefficient(raft::handle_t const& handle,
+                                   raft::random::RngState& rng_state,
+                                   graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+                                   size_t num_wedge_samples_per_vertex,
+                                   bool do_expensive_check);
+
+}  // namespace cugraph
@@ -18,28 +18,49 @@
 #include "common_methods.hpp"
 #include "detail/graph_partition_utils.cuh"
 #include "prims/kv_store.cuh"
+#include "prims/fill_edge_src_dst_property.cuh"
 #include "prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
 #include "prims/reduce_op.cuh"
+#include "prims/transform_e.cuh"
 #include "prims/transform_reduce_e.cuh"
 #include "prims/transform_reduce_e_by_src_dst_key.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
 #include "utilities/collect_comm.cuh"
 
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <cuda/functional>
 #include <cuda/std/optional>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/sequence.h>
+#include <thrust/set_operations.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 
 CUCO_DECLARE_BITWISE_COMPARABLE(float)
 CUCO_DECLARE_BITWISE_COMPARABLE(double)
@@ -136,6 +157,47 @@ struct cluster_update_op_t {
   }
 };
 
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct positive_gain_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, weight_t> p) const
+  {
+    return thrust::get<1>(p) > weight_t{0};
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct is_moved_t {
+  bool up_down{};
+  __device__ bool operator()(thrust::tuple<vertex_t, thrust::tuple<vertex_t, weight_t>> p) const
+  {
+    vertex_t old_cluster = thrust::get<0>(p);
+    return cluster_update_op_t<vertex_t, weight_t>{up_down}(old_cluster, thrust::get<1>(p)) !=
+           old_cluster;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_src_flag_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, bool src_flag, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return src_flag;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_valid_t {
+  __device__ cuda::std::optional<std::byte> operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return std::byte{0};
+  }
+};
+
 // FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
 template <typename vertex_t, typename weight_t>
 struct return_edge_weight_t {
@@ -215,20 +277,269 @@ weight_t compute_modularity(
 }
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-std::tuple<
-  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>,
-  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>>
-graph_contraction(raft::handle_t const& handle,
-                  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-                  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weights_view,
-                  raft::device_span<vertex_t> labels)
+std::tuple<rmm::device_uvector<weight_t>, rmm::device_uvector<weight_t>>
+compute_cluster_sum_and_subtract(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  rmm::device_uvector<vertex_t> const& next_clusters_v,
+  edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
+    src_clusters_cache,
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
+    dst_clusters_cache)
 {
-  auto [new_graph, new_edge_weights, numbering_map] =
-    coarsen_graph(handle, graph_view, edge_weights_view, labels.data(), true);
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted.");
+
+  rmm::device_uvector<weight_t> old_cluster_sum_v(graph_view.local_vertex_partition_range_size(),
+                                                  handle.get_stream());
+  rmm::device_uvector<weight_t> cluster_subtract_v(graph_view.local_vertex_partition_range_size(),
+                                                   handle.get_stream());
+
+  per_v_transform_reduce_outgoing_e(
+    handle,
+    graph_view,
+    multi_gpu
+      ? src_clusters_cache.view()
+      : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(next_clusters_v.data()),
+    multi_gpu ? dst_clusters_cache.view()
+              : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(
+                  next_clusters_v.data(), vertex_t{0}),
+    *edge_weight_view,
+    [] __device__(auto src, auto dst, auto src_cluster, auto nbr_cluster, weight_t wt) {
+      weight_t sum{0};
+      weight_t subtract{0};
+
+      if (src == dst)
+        subtract = wt;
+      else if (src_cluster == nbr_cluster)
+        sum = wt;
+
+      return thrust::make_tuple(sum, subtract);
+    },
+    thrust::make_tuple(weight_t{0}, weight_t{0}),
+    reduce_op::plus<thrust::tuple<weight_t, weight_t>>{},
+    thrust::make_zip_iterator(
+      thrust::make_tuple(old_cluster_sum_v.begin(), cluster_subtract_v.begin())));
 
-  auto new_graph_view = new_graph.view();
+  return std::make_tuple(std::move(old_cluster_sum_v), std::move(cluster_subtract_v));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+weight_t compute_modularity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  rmm::device_uvector<weight_t> const& old_cluster_sum_v,
+  rmm::device_uvector<weight_t> const& cluster_subtract_v,
+  rmm::device_uvector<weight_t> const& cluster_weights,
+  weight_t total_edge_weight,
+  weight_t resolution)
+{
+  CUGRAPH_EXPECTS((old_cluster_sum_v.size() ==
+                   static_cast<size_t>(graph_view.local_vertex_partition_range_size())) &&
+                    (cluster_subtract_v.size() == old_cluster_sum_v.size()),
+                  "Invalid input argument: old_cluster_sum_v and cluster_subtract_v should have "
+                  "one entry per local vertex.");
 
-  rmm::device_uvector<vertex_t> numbering_indices((*numbering_map).size(), handle.get_stream());
+  //
+  // Sum(Sigma_tot_c^2), over all clusters c
+  //
+  weight_t sum_degree_squared = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    cluster_weights.begin(),
+    cluster_weights.end(),
+    cuda::proclaim_return_type<weight_t>([] __device__(weight_t p) -> weight_t { return p * p; }),
+    weight_t{0},
+    thrust::plus<weight_t>());
+
+  // Sum(Sigma_in_c), over all clusters c (a self-loop is internal to its vertex's cluster)
+  weight_t sum_internal = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(old_cluster_sum_v.begin(), cluster_subtract_v.begin())),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(old_cluster_sum_v.end(), cluster_subtract_v.end())),
+    cuda::proclaim_return_type<weight_t>(
+      [] __device__(thrust::tuple<weight_t, weight_t> p) -> weight_t {
+        return thrust::get<0>(p) + thrust::get<1>(p);
+      }),
+    weight_t{0},
+    thrust::plus<weight_t>());
+
+  if constexpr (multi_gpu) {
+    auto sums = host_scalar_allreduce(handle.get_comms(),
+                                      thrust::make_tuple(sum_degree_squared, sum_internal),
+                                      raft::comms::op_t::SUM,
+                                      handle.get_stream());
+    sum_degree_squared = thrust::get<0>(sums);
+    sum_internal       = thrust::get<1>(sums);
+  }
+
+  weight_t Q = sum_internal / total_edge_weight -
+               (resolution * sum_degree_squared) / (total_edge_weight * total_edge_weight);
+
+  return Q;
+}
+
+template <typename vertex_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+relabel_clusters_to_majority_gpus(raft::handle_t const& handle,
+                                  raft::device_span<vertex_t> labels)
+{
+  static_assert(multi_gpu, "relabel_clusters_to_majority_gpus is for multi-GPU only.");
+
+  auto& comm                 = handle.get_comms();
+  auto const comm_size       = comm.get_size();
+  auto const comm_rank       = comm.get_rank();
+  auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+  auto const major_comm_size = major_comm.get_size();
+  auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+  auto const minor_comm_size = minor_comm.get_size();
+
+  cugraph::detail::compute_gpu_id_from_ext_vertex_t<vertex_t> vertex_to_gpu_id_op{
+    comm_size, major_comm_size, minor_comm_size};
+
+  // 1. count the local members of each cluster
+
+  rmm::device_uvector<vertex_t> clusters(labels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> member_counts(labels.size(), handle.get_stream());
+  {
+    rmm::device_uvector<vertex_t> sorted_labels(labels.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), sorted_labels.begin());
+    thrust::sort(handle.get_thrust_policy(), sorted_labels.begin(), sorted_labels.end());
+    auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                      sorted_labels.begin(),
+                                      sorted_labels.end(),
+                                      thrust::make_constant_iterator(vertex_t{1}),
+                                      clusters.begin(),
+                                      member_counts.begin());
+    clusters.resize(thrust::distance(clusters.begin(), last.first), handle.get_stream());
+    member_counts.resize(clusters.size(), handle.get_stream());
+  }
+  clusters.shrink_to_fit(handle.get_stream());
+  member_counts.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<int> ranks(clusters.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), ranks.begin(), ranks.end(), comm_rank);
+
+  // 2. pick the GPU holding the most members of each cluster (in the GPU currently owning the
+  // cluster ID)
+
+  std::forward_as_tuple(std::tie(clusters, member_counts, ranks), std::ignore) =
+    groupby_gpu_id_and_shuffle_values(
+      comm,
+      thrust::make_zip_iterator(clusters.begin(), member_counts.begin(), ranks.begin()),
+      thrust::make_zip_iterator(clusters.end(), member_counts.end(), ranks.end()),
+      [vertex_to_gpu_id_op] __device__(auto val) {
+        return vertex_to_gpu_id_op(thrust::get<0>(val));
+      },
+      handle.get_stream());
+
+  auto triplet_first =
+    thrust::make_zip_iterator(clusters.begin(), member_counts.begin(), ranks.begin());
+  thrust::sort(handle.get_thrust_policy(),
+               triplet_first,
+               triplet_first + clusters.size(),
+               [] __device__(auto lhs, auto rhs) {
+                 if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+                   return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+                 } else if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+                   return thrust::get<1>(lhs) > thrust::get<1>(rhs);  // most members first
+                 } else {
+                   return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+                 }
+               });
+  clusters.resize(
+    thrust::distance(
+      clusters.begin(),
+      thrust::get<0>(thrust::unique_by_key(
+        handle.get_thrust_policy(), clusters.begin(), clusters.end(), ranks.begin()))),
+    handle.get_stream());
+  ranks.resize(clusters.size(), handle.get_stream());
+  member_counts.resize(0, handle.get_stream());
+  member_counts.shrink_to_fit(handle.get_stream());
+
+  // 3. send each cluster to its majority GPU
+
+  std::forward_as_tuple(std::tie(clusters, ranks), std::ignore) =
+    groupby_gpu_id_and_shuffle_values(
+      comm,
+      thrust::make_zip_iterator(clusters.begin(), ranks.begin()),
+      thrust::make_zip_iterator(clusters.end(), ranks.end()),
+      [] __device__(auto val) { return thrust::get<1>(val); },
+      handle.get_stream());
+  ranks.resize(0, handle.get_stream());
+  ranks.shrink_to_fit(handle.get_stream());
+
+  // 4. draw new cluster IDs owned by this GPU (scanning [0, ...) for the IDs hashed to this GPU,
+  // the new IDs are unique across the GPUs as every ID is owned by a single GPU)
+
+  // every GPU scans about comm_size * (# clusters) IDs, skip relabeling (in every GPU) if this
+  // may not fit in vertex_t
+  auto max_num_clusters = host_scalar_allreduce(
+    comm, clusters.size(), raft::comms::op_t::MAX, handle.get_stream());
+  if (static_cast<double>(max_num_clusters) * static_cast<double>(comm_size) * 4.0 >
+      static_cast<double>(std::numeric_limits<vertex_t>::max())) {
+    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+                           rmm::device_uvector<vertex_t>(0, handle.get_stream()));
+  }
+
+  rmm::device_uvector<vertex_t> new_clusters(clusters.size(), handle.get_stream());
+  {
+    auto is_owned = [vertex_to_gpu_id_op, comm_rank] __device__(vertex_t v) {
+      return vertex_to_gpu_id_op(v) == comm_rank;
+    };
+    vertex_t candidate_first{0};
+    size_t num_found{0};
+    while (num_found < new_clusters.size()) {
+      auto num_candidates = std::min(
+        (new_clusters.size() - num_found) * static_cast<size_t>(comm_size) * 2,
+        static_cast<size_t>(std::numeric_limits<vertex_t>::max() - candidate_first));
+      CUGRAPH_EXPECTS(num_candidates > 0, "Insufficient vertex_t range to relabel clusters.");
+      auto candidate_last = candidate_first + static_cast<vertex_t>(num_candidates);
+      rmm::device_uvector<vertex_t> owned_ids(
+        thrust::count_if(handle.get_thrust_policy(),
+                         thrust::make_counting_iterator(candidate_first),
+                         thrust::make_counting_iterator(candidate_last),
+                         is_owned),
+        handle.get_stream());
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(candidate_first),
+                      thrust::make_counting_iterator(candidate_last),
+                      owned_ids.begin(),
+                      is_owned);
+      auto num_to_copy = std::min(owned_ids.size(), new_clusters.size() - num_found);
+      thrust::copy(handle.get_thrust_policy(),
+                   owned_ids.begin(),
+                   owned_ids.begin() + num_to_copy,
+                   new_clusters.begin() + num_found);
+      num_found += num_to_copy;
+      candidate_first = candidate_last;
+    }
+  }
+
+  // 5. relabel (every cluster is relabeled, so a new ID never collides with an old ID)
+
+  relabel<vertex_t, multi_gpu>(
+    handle,
+    std::make_tuple(static_cast<vertex_t const*>(clusters.data()),
+                    static_cast<vertex_t const*>(new_clusters.data())),
+    static_cast<vertex_t>(clusters.size()),
+    labels.data(),
+    static_cast<vertex_t>(labels.size()),
+    false);
+
+  return std::make_tuple(std::move(clusters), std::move(new_clusters));
+}
+
+// relabel the (coarsen_graph input) labels to the vertex IDs of the contracted graph
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void relabel_to_contracted_graph_vertices(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& new_graph_view,
+  rmm::device_uvector<vertex_t> const& numbering_map,
+  raft::device_span<vertex_t> labels)
+{
+  rmm::device_uvector<vertex_t> numbering_indices(numbering_map.size(), handle.get_stream());
   detail::sequence_fill(handle.get_stream(),
                         numbering_indices.data(),
                         numbering_indices.size(),
@@ -236,18 +547,69 @@ graph_contraction(raft::handle_t const& handle,
 
   relabel<vertex_t, multi_gpu>(
     handle,
-    std::make_tuple(static_cast<vertex_t const*>((*numbering_map).begin()),
+    std::make_tuple(static_cast<vertex_t const*>(numbering_map.begin()),
                     static_cast<vertex_t const*>(numbering_indices.begin())),
     new_graph_view.local_vertex_partition_range_size(),
     labels.data(),
     labels.size(),
     false);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>>
+graph_contraction(raft::handle_t const& handle,
+                  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weights_view,
+                  raft::device_span<vertex_t> labels)
+{
+  if constexpr (multi_gpu) {
+    // the coarsened graph places each coarse vertex in the GPU owning its cluster ID
+    if (get_cluster_placement_hint(handle) == cluster_placement_t::majority) {
+      relabel_clusters_to_majority_gpus<vertex_t, multi_gpu>(handle, labels);
+    }
+  }
+
+  auto [new_graph, new_edge_weights, numbering_map] =
+    coarsen_graph(handle, graph_view, edge_weights_view, labels.data(), true);
+
+  relabel_to_contracted_graph_vertices<vertex_t, edge_t, multi_gpu>(
+    handle, new_graph.view(), *numbering_map, labels);
 
   return std::make_tuple(std::move(new_graph), std::move(new_edge_weights));
 }
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
+std::tuple<
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>>
+graph_contraction(
+  raft::handle_t const& handle,
+  cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>&& graph,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>&&
+    edge_weights,
+  raft::device_span<vertex_t> labels)
+{
+  if constexpr (multi_gpu) {
+    // the coarsened graph places each coarse vertex in the GPU owning its cluster ID
+    if (get_cluster_placement_hint(handle) == cluster_placement_t::majority) {
+      relabel_clusters_to_majority_gpus<vertex_t, multi_gpu>(handle, labels);
+    }
+  }
+
+  auto [new_graph, new_edge_weights, numbering_map] =
+    coarsen_graph(handle, std::move(graph), std::move(edge_weights), labels.data(), true);
+
+  relabel_to_contracted_graph_vertices<vertex_t, edge_t, multi_gpu>(
+    handle, new_graph.view(), *numbering_map, labels);
+
+  return std::make_tuple(std::move(new_graph), std::move(new_edge_weights));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<vertex_t>>>
+update_clustering_by_delta_modularity(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
@@ -257,13 +619,16 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
   rmm::device_uvector<vertex_t>&& cluster_keys_v,
   rmm::device_uvector<weight_t>&& cluster_weights_v,
   rmm::device_uvector<vertex_t>&& next_clusters_v,
+  rmm::device_uvector<weight_t>&& old_cluster_sum_v,
+  rmm::device_uvector<weight_t>&& cluster_subtract_v,
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t> const&
     src_vertex_weights_cache,
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
     src_clusters_cache,
   edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
     dst_clusters_cache,
-  bool up_down)
+  bool up_down,
+  std::optional<rmm::device_uvector<vertex_t>>&& active_vertices)
 {
   CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted.");
 
@@ -325,36 +690,11 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
                       });
   }
 
-  rmm::device_uvector<weight_t> old_cluster_sum_v(graph_view.local_vertex_partition_range_size(),
-                                                  handle.get_stream());
-  rmm::device_uvector<weight_t> cluster_subtract_v(graph_view.local_vertex_partition_range_size(),
-                                                   handle.get_stream());
-
-  per_v_transform_reduce_outgoing_e(
-    handle,
-    graph_view,
-    multi_gpu
-      ? src_clusters_cache.view()
-      : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(next_clusters_v.data()),
-    multi_gpu ? dst_clusters_cache.view()
-              : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(
-                  next_clusters_v.data(), vertex_t{0}),
-    *edge_weight_view,
-    [] __device__(auto src, auto dst, auto src_cluster, auto nbr_cluster, weight_t wt) {
-      weight_t sum{0};
-      weight_t subtract{0};
-
-      if (src == dst)
-        subtract = wt;
-      else if (src_cluster == nbr_cluster)
-        sum = wt;
-
-      return thrust::make_tuple(sum, subtract);
-    },
-    thrust::make_tuple(weight_t{0}, weight_t{0}),
-    reduce_op::plus<thrust::tuple<weight_t, weight_t>>{},
-    thrust::make_zip_iterator(
-      thrust::make_tuple(old_cluster_sum_v.begin(), cluster_subtract_v.begin())));
+  CUGRAPH_EXPECTS((old_cluster_sum_v.size() ==
+                   static_cast<size_t>(graph_view.local_vertex_partition_range_size())) &&
+                    (cluster_subtract_v.size() == old_cluster_sum_v.size()),
+                  "Invalid input argument: old_cluster_sum_v and cluster_subtract_v should have "
+                  "one entry per local vertex.");
 
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>,
                       thrust::tuple<weight_t, weight_t>>
@@ -395,6 +735,33 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
                                              decltype(cluster_old_sum_subtract_pair_first)>(
             cluster_old_sum_subtract_pair_first));
 
+  // Only the out-going edges of the active vertices take part in the key aggregation, the others
+  // are masked out and their vertices keep the identity element (and their current cluster).
+  auto key_aggregation_graph_view = graph_view;
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool> active_edge_mask(handle);
+  if (active_vertices) {
+    edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool> src_active_flags(
+      handle, graph_view);
+    fill_edge_src_property(handle, graph_view, src_active_flags.mutable_view(), false);
+    fill_edge_src_property(handle,
+                           graph_view,
+                           (*active_vertices).begin(),
+                           (*active_vertices).end(),
+                           src_active_flags.mutable_view(),
+                           true);
+
+    active_edge_mask =
+      edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool>(handle, graph_view);
+    transform_e(handle,
+                graph_view,
+                src_active_flags.view(),
+                edge_dst_dummy_property_t{}.view(),
+                edge_dummy_property_t{}.view(),
+                detail::return_src_flag_t<vertex_t>{},
+                active_edge_mask.mutable_view());
+    key_aggregation_graph_view.attach_edge_mask(active_edge_mask.view());
+  }
+
   kv_store_t<vertex_t, weight_t, false> cluster_key_weight_map(
     cluster_keys_v.begin(),
     cluster_keys_v.begin() + cluster_keys_v.size(),
@@ -404,7 +771,7 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
     handle.get_stream());
   per_v_transform_reduce_dst_key_aggregated_outgoing_e(
     handle,
-    graph_view,
+    key_aggregation_graph_view,
     zipped_src_device_view,
     *edge_weight_view,
     multi_gpu ? dst_clusters_cache.view()
@@ -431,6 +798,41 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
 
   if (nr_moves == 0) { up_down = !up_down; }
 
+  // The vertices to re-evaluate in the next iteration: the vertices with a positive gain (moved or
+  // held back by up_down) and the neighbors of the moved vertices. The gains of the other vertices
+  // can change only through the cluster weights and are not re-evaluated.
+  std::optional<rmm::device_uvector<vertex_t>> next_active_vertices{std::nullopt};
+  rmm::device_uvector<vertex_t> moved_vertices(0, handle.get_stream());
+  if (active_vertices) {
+    next_active_vertices = rmm::device_uvector<vertex_t>(
+      graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    (*next_active_vertices)
+      .resize(thrust::distance(
+                (*next_active_vertices).begin(),
+                thrust::copy_if(
+                  handle.get_thrust_policy(),
+                  thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+                  thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+                  cugraph::get_dataframe_buffer_begin(output_buffer),
+                  (*next_active_vertices).begin(),
+                  detail::positive_gain_t<vertex_t, weight_t>{})),
+              handle.get_stream());
+
+    moved_vertices.resize((*next_active_vertices).size(), handle.get_stream());
+    moved_vertices.resize(
+      thrust::distance(
+        moved_vertices.begin(),
+        thrust::copy_if(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+          thrust::make_zip_iterator(thrust::make_tuple(
+            next_clusters_v.begin(), cugraph::get_dataframe_buffer_begin(output_buffer))),
+          moved_vertices.begin(),
+          detail::is_moved_t<vertex_t, weight_t>{up_down})),
+      handle.get_stream());
+  }
+
   thrust::transform(handle.get_thrust_policy(),
                     next_clusters_v.begin(),
                     next_clusters_v.end(),
@@ -438,7 +840,34 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
                     next_clusters_v.begin(),
                     detail::cluster_update_op_t<vertex_t, weight_t>{up_down});
 
-  return std::move(next_clusters_v);
+  if (active_vertices) {
+    key_bucket_t<vertex_t, void, multi_gpu, true> moved_vertex_bucket(
+      handle, raft::device_span<vertex_t const>(moved_vertices.data(), moved_vertices.size()));
+    auto moved_vertex_nbrs =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    graph_view,
+                                                    moved_vertex_bucket,
+                                                    edge_src_dummy_property_t{}.view(),
+                                                    edge_dst_dummy_property_t{}.view(),
+                                                    edge_dummy_property_t{}.view(),
+                                                    detail::return_valid_t<vertex_t>{},
+                                                    reduce_op::null());
+
+    rmm::device_uvector<vertex_t> merged_active_vertices(
+      (*next_active_vertices).size() + moved_vertex_nbrs.size(), handle.get_stream());
+    merged_active_vertices.resize(
+      thrust::distance(merged_active_vertices.begin(),
+                       thrust::set_union(handle.get_thrust_policy(),
+                                         (*next_active_vertices).begin(),
+                                         (*next_active_vertices).end(),
+                                         moved_vertex_nbrs.begin(),
+                                         moved_vertex_nbrs.end(),
+                                         merged_active_vertices.begin())),
+      handle.get_stream());
+    *next_active_vertices = std::move(merged_active_vertices);
+  }
+
+  return std::make_tuple(std::move(next_clusters_v), std::move(next_active_vertices));
 }
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -469,5 +898,87 @@ compute_cluster_keys_and_values(
   return std::make_tuple(std::move(cluster_keys), std::move(cluster_values));
 }
 
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> normalize_initial_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> initial_clustering)
+{
+  CUGRAPH_EXPECTS(
+    initial_clustering.size() ==
+      static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input argument: initial_clustering size does not match the local vertex partition "
+    "range size.");
+
+  auto local_vertex_first = graph_view.local_vertex_partition_range_first();
+
+  // (cluster ID, smallest member vertex ID) pairs
+  rmm::device_uvector<vertex_t> cluster_ids(initial_clustering.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> min_vertices(initial_clustering.size(), handle.get_stream());
+  auto input_first = thrust::make_zip_iterator(initial_clustering.begin(),
+                                               thrust::make_counting_iterator(local_vertex_first));
+  auto output_first = thrust::make_zip_iterator(cluster_ids.begin(), min_vertices.begin());
+  cluster_ids.resize(
+    thrust::distance(output_first,
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     input_first,
+                                     input_first + initial_clustering.size(),
+                                     output_first,
+                                     [] __device__(auto pair) {
+                                       return thrust::get<0>(pair) !=
+                                              invalid_vertex_id<vertex_t>::value;
+                                     })),
+    handle.get_stream());
+  min_vertices.resize(cluster_ids.size(), handle.get_stream());
+
+  auto reduce_min_by_cluster = [&handle](rmm::device_uvector<vertex_t>& keys,
+                                         rmm::device_uvector<vertex_t>& values) {
+    thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+    auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                      keys.begin(),
+                                      keys.end(),
+                                      values.begin(),
+                                      keys.begin(),
+                                      values.begin(),
+                                      thrust::equal_to<vertex_t>{},
+                                      thrust::minimum<vertex_t>{});
+    keys.resize(thrust::distance(keys.begin(), last.first), handle.get_stream());
+    values.resize(keys.size(), handle.get_stream());
+  };
+
+  reduce_min_by_cluster(cluster_ids, min_vertices);
+  if constexpr (multi_gpu) {
+    std::tie(cluster_ids, min_vertices) =
+      shuffle_ext_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+        handle, std::move(cluster_ids), std::move(min_vertices));
+    reduce_min_by_cluster(cluster_ids, min_vertices);
+  }
+
+  rmm::device_uvector<vertex_t> clustering(initial_clustering.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               initial_clustering.begin(),
+               initial_clustering.end(),
+               clustering.begin());
+  relabel<vertex_t, multi_gpu>(
+    handle,
+    std::make_tuple(static_cast<vertex_t const*>(cluster_ids.data()),
+                    static_cast<vertex_t const*>(min_vertices.data())),
+    static_cast<vertex_t>(cluster_ids.size()),
+    clustering.data(),
+    static_cast<vertex_t>(clustering.size()),
+    true);
+
+  thrust::transform(handle.get_thrust_policy(),
+                    clustering.begin(),
+                    clustering.end(),
+                    thrust::make_counting_iterator(local_vertex_first),
+                    clustering.begin(),
+                    [] __device__(auto c, auto v) {
+                      return c == invalid_vertex_id<vertex_t>::value ? v : c;
+                    });
+
+  return clustering;
+}
+
 }  // namespace detail
 }  // namespace cugraph
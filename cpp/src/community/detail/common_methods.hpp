@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <cugraph/utilities/high_res_timer.hpp>
 #endif
 
+#include <raft/core/device_span.hpp>
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
@@ -84,6 +85,41 @@ weight_t compute_modularity(
   weight_t total_edge_weight,
   weight_t resolution);
 
+// Per local vertex, the weight of the edges to the other vertices in the same cluster and the
+// self-loop weight. These are the inputs of both the modularity computation below and the vertex
+// moves in update_clustering_by_delta_modularity, so a single edge pass serves both.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<weight_t>, rmm::device_uvector<weight_t>>
+compute_cluster_sum_and_subtract(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  rmm::device_uvector<vertex_t> const& next_clusters_v,
+  edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
+    src_clusters_cache,
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
+    dst_clusters_cache);
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+weight_t compute_modularity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  rmm::device_uvector<weight_t> const& old_cluster_sum_v,
+  rmm::device_uvector<weight_t> const& cluster_subtract_v,
+  rmm::device_uvector<weight_t> const& cluster_weights,
+  weight_t total_edge_weight,
+  weight_t resolution);
+
+// Relabel the clusters in labels (a multi-GPU collective call) so that every cluster ID is owned
+// (see compute_gpu_id_from_ext_vertex_t) by the GPU holding the most members of the cluster (ties
+// go to the lower rank). Returns the (old cluster ID, new cluster ID) pairs, each pair is stored
+// in the GPU owning the new cluster ID. Returns empty pairs (and leaves labels unchanged in every
+// GPU) if vertex_t is too narrow to find enough cluster IDs owned by each GPU.
+template <typename vertex_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+relabel_clusters_to_majority_gpus(raft::handle_t const& handle,
+                                  raft::device_span<vertex_t> labels);
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::tuple<
   graph_t<vertex_t, edge_t, false, multi_gpu>,
@@ -93,8 +129,24 @@ graph_contraction(raft::handle_t const& handle,
                   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weights,
                   raft::device_span<vertex_t> labels);
 
+// Same as above, but consumes graph and edge_weights, which are released before the contracted
+// graph is created (so the two graphs do not co-exist).
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
+std::tuple<
+  graph_t<vertex_t, edge_t, false, multi_gpu>,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>>
+graph_contraction(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, false, multi_gpu>&& graph,
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>&&
+    edge_weights,
+  raft::device_span<vertex_t> labels);
+
+// If @p active_vertices is set, only the listed (sorted) local vertices are re-evaluated and the
+// vertices to re-evaluate in the next iteration are returned along with the new clustering.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<vertex_t>>>
+update_clustering_by_delta_modularity(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
@@ -104,13 +156,16 @@ rmm::device_uvector<vertex_t> update_clustering_by_delta_modularity(
   rmm::device_uvector<vertex_t>&& cluster_keys_v,
   rmm::device_uvector<weight_t>&& cluster_weights_v,
   rmm::device_uvector<vertex_t>&& next_clusters_v,
+  rmm::device_uvector<weight_t>&& old_cluster_sum_v,
+  rmm::device_uvector<weight_t>&& cluster_subtract_v,
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t> const&
     src_vertex_weights_cache,
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
     src_clusters_cache,
   edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
     dst_clusters_cache,
-  bool up_down);
+  bool up_down,
+  std::optional<rmm::device_uvector<vertex_t>>&& active_vertices);
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
@@ -122,5 +177,15 @@ compute_cluster_keys_and_values(
   edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, vertex_t> const&
     src_clusters_cache);
 
+// Relabel an initial clustering of the local vertices (cluster IDs can be arbitrary vertex_t
+// values, e.g. the output of a previous run on a differently renumbered graph) to use the smallest
+// member vertex ID of each cluster as the cluster ID. Vertices with
+// invalid_vertex_id<vertex_t>::value form singleton clusters.
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> normalize_initial_clustering(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> initial_clustering);
+
 }  // namespace detail
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,6 +44,46 @@ template double compute_modularity(
   double total_edge_weight,
   double resolution);
 
+template std::tuple<rmm::device_uvector<float>, rmm::device_uvector<float>>
+compute_cluster_sum_and_subtract(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  rmm::device_uvector<int32_t> const& next_clusters_v,
+  edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
+    src_clusters_cache,
+  edge_dst_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
+    dst_clusters_cache);
+
+template std::tuple<rmm::device_uvector<double>, rmm::device_uvector<double>>
+compute_cluster_sum_and_subtract(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  rmm::device_uvector<int32_t> const& next_clusters_v,
+  edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
+    src_clusters_cache,
+  edge_dst_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
+    dst_clusters_cache);
+
+template float compute_modularity(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  rmm::device_uvector<float> const& old_cluster_sum_v,
+  rmm::device_uvector<float> const& cluster_subtract_v,
+  rmm::device_uvector<float> const& cluster_weights,
+  float total_edge_weight,
+  float resolution);
+
+template double compute_modularity(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  rmm::device_uvector<double> const& old_cluster_sum_v,
+  rmm::device_uvector<double> const& cluster_subtract_v,
+  rmm::device_uvector<double> const& cluster_weights,
+  double total_edge_weight,
+  double resolution);
+
 template std::tuple<
   cugraph::graph_t<int32_t, int32_t, false, false>,
   std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>>
@@ -52,6 +92,16 @@ graph_contraction(raft::handle_t const& handle,
                   std::optional<edge_property_view_t<int32_t, float const*>> edge_weights,
                   raft::device_span<int32_t> labels);
 
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>>
+graph_contraction(
+  raft::handle_t const& handle,
+  cugraph::graph_t<int32_t, int32_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>&&
+    edge_weights,
+  raft::device_span<int32_t> labels);
+
 template std::tuple<
   cugraph::graph_t<int32_t, int32_t, false, false>,
   std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>>
@@ -60,7 +110,18 @@ graph_contraction(raft::handle_t const& handle,
                   std::optional<edge_property_view_t<int32_t, double const*>> edge_weights,
                   raft::device_span<int32_t> labels);
 
-template rmm::device_uvector<int32_t> update_clustering_by_delta_modularity(
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>>
+graph_contraction(
+  raft::handle_t const& handle,
+  cugraph::graph_t<int32_t, int32_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>&&
+    edge_weights,
+  raft::device_span<int32_t> labels);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<int32_t>>>
+update_clustering_by_delta_modularity(
   raft::handle_t const& handle,
   cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
   std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
@@ -70,15 +131,19 @@ template rmm::device_uvector<int32_t> update_clustering_by_delta_modularity(
   rmm::device_uvector<int32_t>&& cluster_keys_v,
   rmm::device_uvector<float>&& cluster_weights_v,
   rmm::device_uvector<int32_t>&& next_clusters_v,
+  rmm::device_uvector<float>&& old_cluster_sum_v,
+  rmm::device_uvector<float>&& cluster_subtract_v,
   edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, float> const&
     src_vertex_weights_cache,
   edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
     src_clusters_cache,
   edge_dst_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
     dst_clusters_cache,
-  bool up_down);
+  bool up_down,
+  std::optional<rmm::device_uvector<int32_t>>&& active_vertices);
 
-template rmm::device_uvector<int32_t> update_clustering_by_delta_modularity(
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<int32_t>>>
+update_clustering_by_delta_modularity(
   raft::handle_t const& handle,
   cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
   std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
@@ -88,13 +153,16 @@ template rmm::device_uvector<int32_t> update_clustering_by_delta_modularity(
   rmm::device_uvector<int32_t>&& cluster_keys_v,
   rmm::device_uvector<double>&& cluster_weights_v,
   rmm::device_uvector<int32_t>&& next_clusters_v,
+  rmm::device_uvector<double>&& old_cluster_sum_v,
+  rmm::device_uvector<double>&& cluster_subtract_v,
   edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, double> const&
     src_vertex_weights_cache,
   edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
     src_clusters_cache,
   edge_dst_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
     dst_clusters_cache,
-  bool up_down);
+  bool up_down,
+  std::optional<rmm::device_uvector<int32_t>>&& active_vertices);
 
 template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>>
 compute_cluster_keys_and_values(
@@ -114,5 +182,10 @@ compute_cluster_keys_and_values(
   edge_src_property_t<cugraph::graph_view_t<int32_t, int32_t, false, false>, int32_t> const&
     src_clusters_cache);
 
+template rmm::device_uvector<int32_t> normalize_initial_clustering(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  raft::device_span<int32_t const> initial_clustering);
+
 }  // namespace detail
 }  // namespace cugraph
@@ -21,11 +21,13 @@
 #include "prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
 #include "prims/reduce_op.cuh"
+#include "prims/transform_e.cuh"
 #include "prims/transform_reduce_e.cuh"
 #include "prims/transform_reduce_e_by_src_dst_key.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
 #include "utilities/collect_comm.cuh"
 
+#include <cugraph/algorithms.hpp>
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
@@ -39,6 +41,7 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/random.h>
+#include <thrust/reduce.h>
 #include <thrust/sequence.h>
 #include <thrust/shuffle.h>
 #include <thrust/sort.h>
@@ -151,7 +154,8 @@ refine_clustering(
   edge_src_property_t<GraphViewType, typename GraphViewType::vertex_type> const&
     src_louvain_assignment_cache,
   edge_dst_property_t<GraphViewType, typename GraphViewType::vertex_type> const&
-    dst_louvain_assignment_cache)
+    dst_louvain_assignment_cache,
+  leiden_refinement_method_t refinement_method)
 {
   const weight_t POSITIVE_GAIN = 1e-6;
   using vertex_t               = typename GraphViewType::vertex_type;
@@ -312,6 +316,52 @@ refine_clustering(
     invalid_vertex_id<vertex_t>::value,
     handle.get_stream());
 
+  //
+  // With color_classes, color the subgraph of the edges within the Louvain clusters once. A vertex
+  // can only move to the Leiden cluster of a neighbor in the same Louvain cluster, so the vertices
+  // of a color class can move together (none of them is adjacent to another, so none of them is
+  // the target of another's move), and every round moves the next color class with a positive
+  // gain move (Gauss-Seidel style), instead of a maximal independent set of a decision graph built
+  // every round.
+  //
+
+  std::optional<rmm::device_uvector<vertex_t>> colors{std::nullopt};
+  vertex_t num_colors{0};
+  vertex_t next_color{0};
+  if (refinement_method == leiden_refinement_method_t::color_classes) {
+    edge_property_t<GraphViewType, bool> intra_cluster_edge_mask(handle, graph_view);
+    transform_e(
+      handle,
+      graph_view,
+      GraphViewType::is_multi_gpu ? src_louvain_assignment_cache.view()
+                                  : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(
+                                      louvain_assignment_of_vertices.data()),
+      GraphViewType::is_multi_gpu ? dst_louvain_assignment_cache.view()
+                                  : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(
+                                      louvain_assignment_of_vertices.data(), vertex_t{0}),
+      edge_dummy_property_t{}.view(),
+      [] __device__(auto src, auto dst, auto src_cluster, auto dst_cluster, auto) {
+        return (src != dst) && (src_cluster == dst_cluster);
+      },
+      intra_cluster_edge_mask.mutable_view());
+
+    auto intra_cluster_graph_view = graph_view;
+    intra_cluster_graph_view.attach_edge_mask(intra_cluster_edge_mask.view());
+    colors = vertex_coloring(
+      handle, intra_cluster_graph_view, rng_state, vertex_coloring_method_t::speculative_first_fit);
+
+    num_colors = thrust::reduce(handle.get_thrust_policy(),
+                                colors->begin(),
+                                colors->end(),
+                                vertex_t{0},
+                                thrust::maximum<vertex_t>{}) +
+                 vertex_t{1};
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_colors = host_scalar_allreduce(
+        handle.get_comms(), num_colors, raft::comms::op_t::MAX, handle.get_stream());
+    }
+  }
+
   while (true) {
     vertex_t nr_remaining_active_vertices =
       thrust::count_if(handle.get_thrust_policy(),
@@ -587,122 +637,174 @@ refine_clustering(
       break;
     }
 
-    rmm::device_uvector<vertex_t> d_srcs(nr_valid_tuples, handle.get_stream());
-    rmm::device_uvector<vertex_t> d_dsts(nr_valid_tuples, handle.get_stream());
-    std::optional<rmm::device_uvector<weight_t>> d_weights =
-      std::make_optional(rmm::device_uvector<weight_t>(nr_valid_tuples, handle.get_stream()));
-
-    auto d_src_dst_gain_iterator = thrust::make_zip_iterator(
-      thrust::make_tuple(d_srcs.begin(), d_dsts.begin(), (*d_weights).begin()));
-
-    // edge (src, dst, gain)
-    auto edge_begin = thrust::make_zip_iterator(
-      thrust::make_tuple(vertex_begin,
-                         thrust::get<1>(gain_and_dst_first.get_iterator_tuple()),
-                         thrust::get<0>(gain_and_dst_first.get_iterator_tuple())));
-    auto edge_end = thrust::make_zip_iterator(
-      thrust::make_tuple(vertex_end,
-                         thrust::get<1>(gain_and_dst_last.get_iterator_tuple()),
-                         thrust::get<0>(gain_and_dst_last.get_iterator_tuple())));
-
-    thrust::copy_if(handle.get_thrust_policy(),
-                    edge_begin,
-                    edge_end,
-                    d_src_dst_gain_iterator,
-                    [] __device__(thrust::tuple<vertex_t, vertex_t, weight_t> src_dst_gain) {
-                      vertex_t src  = thrust::get<0>(src_dst_gain);
-                      vertex_t dst  = thrust::get<1>(src_dst_gain);
-                      weight_t gain = thrust::get<2>(src_dst_gain);
-
-                      return (gain > POSITIVE_GAIN) && (dst >= 0);
-                    });
-
-    //
-    // Create decision graph from edgelist
-    //
-    constexpr bool store_transposed = false;
-    constexpr bool multi_gpu        = GraphViewType::is_multi_gpu;
-    using DecisionGraphViewType     = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
-
-    cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu> decision_graph(handle);
-
-    std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
-    std::optional<edge_property_t<DecisionGraphViewType, weight_t>> coarse_edge_weights{
-      std::nullopt};
-
-    if constexpr (multi_gpu) {
-      std::tie(store_transposed ? d_dsts : d_srcs,
-               store_transposed ? d_srcs : d_dsts,
-               d_weights,
-               std::ignore,
-               std::ignore,
-               std::ignore,
-               std::ignore,
-               std::ignore) =
-        cugraph::detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<
-          vertex_t,
-          vertex_t,
-          weight_t,
-          int32_t,
-          int32_t>(handle,
-                   store_transposed ? std::move(d_dsts) : std::move(d_srcs),
-                   store_transposed ? std::move(d_srcs) : std::move(d_dsts),
-                   std::move(d_weights),
-                   std::nullopt,
-                   std::nullopt,
-                   std::nullopt,
-                   std::nullopt);
-    }
+    rmm::device_uvector<vertex_t> vertices_in_mis(0, handle.get_stream());
+    if (colors) {
+      //
+      // Move the vertices of the next color class (cyclically) with a positive gain move
+      //
+
+      auto gain_dst_and_color_first =
+        thrust::make_zip_iterator(thrust::make_tuple(gain_and_dst_first, colors->begin()));
+      auto color_distance = thrust::transform_reduce(
+        handle.get_thrust_policy(),
+        gain_dst_and_color_first,
+        gain_dst_and_color_first + colors->size(),
+        cuda::proclaim_return_type<vertex_t>(
+          [next_color, num_colors] __device__(auto gain_dst_and_color) {
+            auto gain  = thrust::get<0>(thrust::get<0>(gain_dst_and_color));
+            auto dst   = thrust::get<1>(thrust::get<0>(gain_dst_and_color));
+            auto color = thrust::get<1>(gain_dst_and_color);
+            return ((gain > POSITIVE_GAIN) && (dst >= 0))
+                     ? (color + num_colors - next_color) % num_colors
+                     : num_colors;
+          }),
+        num_colors,
+        thrust::minimum<vertex_t>{});
+      if constexpr (GraphViewType::is_multi_gpu) {
+        color_distance = host_scalar_allreduce(
+          handle.get_comms(), color_distance, raft::comms::op_t::MIN, handle.get_stream());
+      }
+      auto color = (next_color + color_distance) % num_colors;
+      next_color = (color + 1) % num_colors;
+
+      vertices_in_mis.resize(nr_valid_tuples, handle.get_stream());
+      vertices_in_mis.resize(
+        thrust::distance(
+          vertices_in_mis.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          vertex_begin,
+                          vertex_end,
+                          gain_dst_and_color_first,
+                          vertices_in_mis.begin(),
+                          [color] __device__(auto gain_dst_and_color) {
+                            auto gain = thrust::get<0>(thrust::get<0>(gain_dst_and_color));
+                            auto dst  = thrust::get<1>(thrust::get<0>(gain_dst_and_color));
+                            return (gain > POSITIVE_GAIN) && (dst >= 0) &&
+                                   (thrust::get<1>(gain_dst_and_color) == color);
+                          })),
+        handle.get_stream());
+    } else {
+      rmm::device_uvector<vertex_t> d_srcs(nr_valid_tuples, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_dsts(nr_valid_tuples, handle.get_stream());
+      std::optional<rmm::device_uvector<weight_t>> d_weights =
+        std::make_optional(rmm::device_uvector<weight_t>(nr_valid_tuples, handle.get_stream()));
+
+      auto d_src_dst_gain_iterator = thrust::make_zip_iterator(
+        thrust::make_tuple(d_srcs.begin(), d_dsts.begin(), (*d_weights).begin()));
+
+      // edge (src, dst, gain)
+      auto edge_begin = thrust::make_zip_iterator(
+        thrust::make_tuple(vertex_begin,
+                           thrust::get<1>(gain_and_dst_first.get_iterator_tuple()),
+                           thrust::get<0>(gain_and_dst_first.get_iterator_tuple())));
+      auto edge_end = thrust::make_zip_iterator(
+        thrust::make_tuple(vertex_end,
+                           thrust::get<1>(gain_and_dst_last.get_iterator_tuple()),
+                           thrust::get<0>(gain_and_dst_last.get_iterator_tuple())));
+
+      thrust::copy_if(handle.get_thrust_policy(),
+                      edge_begin,
+                      edge_end,
+                      d_src_dst_gain_iterator,
+                      [] __device__(thrust::tuple<vertex_t, vertex_t, weight_t> src_dst_gain) {
+                        vertex_t src  = thrust::get<0>(src_dst_gain);
+                        vertex_t dst  = thrust::get<1>(src_dst_gain);
+                        weight_t gain = thrust::get<2>(src_dst_gain);
+
+                        return (gain > POSITIVE_GAIN) && (dst >= 0);
+                      });
+
+      //
+      // Create decision graph from edgelist
+      //
+      constexpr bool store_transposed = false;
+      constexpr bool multi_gpu        = GraphViewType::is_multi_gpu;
+      using DecisionGraphViewType     = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+      cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu> decision_graph(handle);
+
+      std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+      std::optional<edge_property_t<DecisionGraphViewType, weight_t>> coarse_edge_weights{
+        std::nullopt};
+
+      if constexpr (multi_gpu) {
+        std::tie(store_transposed ? d_dsts : d_srcs,
+                 store_transposed ? d_srcs : d_dsts,
+                 d_weights,
+                 std::ignore,
+                 std::ignore,
+                 std::ignore,
+                 std::ignore,
+                 std::ignore) =
+          cugraph::detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<
+            vertex_t,
+            vertex_t,
+            weight_t,
+            int32_t,
+            int32_t>(handle,
+                     store_transposed ? std::move(d_dsts) : std::move(d_srcs),
+                     store_transposed ? std::move(d_srcs) : std::move(d_dsts),
+                     std::move(d_weights),
+                     std::nullopt,
+                     std::nullopt,
+                     std::nullopt,
+                     std::nullopt);
+      }
 
-    std::tie(decision_graph, coarse_edge_weights, std::ignore, std::ignore, renumber_map) =
-      create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, store_transposed, multi_gpu>(
+      std::tie(decision_graph, coarse_edge_weights, std::ignore, std::ignore, renumber_map) =
+        create_graph_from_edgelist<vertex_t,
+                                   edge_t,
+                                   weight_t,
+                                   int32_t,
+                                   store_transposed,
+                                   multi_gpu>(handle,
+                                              std::nullopt,
+                                              std::move(d_srcs),
+                                              std::move(d_dsts),
+                                              std::move(d_weights),
+                                              std::nullopt,
+                                              std::nullopt,
+                                              cugraph::graph_properties_t{false, false},
+                                              true,
+                                              false);
+
+      auto decision_graph_view = decision_graph.view();
+
+      //
+      // Determine a set of moves using MIS of the decision_graph
+      //
+
+      vertices_in_mis = maximal_independent_moves<vertex_t, edge_t, multi_gpu>(
+        handle, decision_graph_view, rng_state);
+
+      rmm::device_uvector<vertex_t> numbering_indices((*renumber_map).size(), handle.get_stream());
+      detail::sequence_fill(handle.get_stream(),
+                            numbering_indices.data(),
+                            numbering_indices.size(),
+                            decision_graph_view.local_vertex_partition_range_first());
+
+      //
+      // Apply Renumber map to get original vertex ids
+      //
+      relabel<vertex_t, multi_gpu>(
         handle,
-        std::nullopt,
-        std::move(d_srcs),
-        std::move(d_dsts),
-        std::move(d_weights),
-        std::nullopt,
-        std::nullopt,
-        cugraph::graph_properties_t{false, false},
-        true,
+        std::make_tuple(static_cast<vertex_t const*>(numbering_indices.begin()),
+                        static_cast<vertex_t const*>((*renumber_map).begin())),
+        decision_graph_view.local_vertex_partition_range_size(),
+        vertices_in_mis.data(),
+        vertices_in_mis.size(),
         false);
 
-    auto decision_graph_view = decision_graph.view();
-
-    //
-    // Determine a set of moves using MIS of the decision_graph
-    //
+      numbering_indices.resize(0, handle.get_stream());
+      numbering_indices.shrink_to_fit(handle.get_stream());
 
-    auto vertices_in_mis = maximal_independent_moves<vertex_t, edge_t, multi_gpu>(
-      handle, decision_graph_view, rng_state);
+      (*renumber_map).resize(0, handle.get_stream());
+      (*renumber_map).shrink_to_fit(handle.get_stream());
 
-    rmm::device_uvector<vertex_t> numbering_indices((*renumber_map).size(), handle.get_stream());
-    detail::sequence_fill(handle.get_stream(),
-                          numbering_indices.data(),
-                          numbering_indices.size(),
-                          decision_graph_view.local_vertex_partition_range_first());
-
-    //
-    // Apply Renumber map to get original vertex ids
-    //
-    relabel<vertex_t, multi_gpu>(
-      handle,
-      std::make_tuple(static_cast<vertex_t const*>(numbering_indices.begin()),
-                      static_cast<vertex_t const*>((*renumber_map).begin())),
-      decision_graph_view.local_vertex_partition_range_size(),
-      vertices_in_mis.data(),
-      vertices_in_mis.size(),
-      false);
-
-    numbering_indices.resize(0, handle.get_stream());
-    numbering_indices.shrink_to_fit(handle.get_stream());
-
-    (*renumber_map).resize(0, handle.get_stream());
-    (*renumber_map).shrink_to_fit(handle.get_stream());
-
-    if (GraphViewType::is_multi_gpu) {
-      vertices_in_mis = cugraph::detail::shuffle_int_vertices_to_local_gpu_by_vertex_partitioning(
-        handle, std::move(vertices_in_mis), graph_view.vertex_partition_range_lasts());
+      if (GraphViewType::is_multi_gpu) {
+        vertices_in_mis = cugraph::detail::shuffle_int_vertices_to_local_gpu_by_vertex_partitioning(
+          handle, std::move(vertices_in_mis), graph_view.vertex_partition_range_lasts());
+      }
     }
 
     //
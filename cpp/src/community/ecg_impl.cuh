@@ -28,11 +28,18 @@
 
 #include <raft/core/handle.hpp>
 #include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
 
 #include <rmm/device_uvector.hpp>
 
 #include <cuda/std/optional>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
 namespace cugraph {
 
 namespace detail {
@@ -70,37 +77,110 @@ std::tuple<rmm::device_uvector<vertex_t>, size_t, weight_t> ecg(
     handle, graph_view, modified_edge_weights.mutable_view(), weight_t{0});
 
   weight_t modularity = -1.0;
-  rmm::device_uvector<vertex_t> cluster_assignments(graph_view.local_vertex_partition_range_size(),
-                                                    handle.get_stream());
-
-  for (size_t i = 0; i < ensemble_size; i++) {
-    std::tie(std::ignore, modularity) = cugraph::louvain(
-      handle,
-      std::make_optional(std::reference_wrapper<raft::random::RngState>(rng_state)),
-      graph_view,
-      edge_weight_view,
-      cluster_assignments.data(),
-      size_t{1},
-      threshold,
-      resolution);
 
-    cugraph::update_edge_src_property(
-      handle, graph_view, cluster_assignments.begin(), src_cluster_assignments.mutable_view());
-    cugraph::update_edge_dst_property(
-      handle, graph_view, cluster_assignments.begin(), dst_cluster_assignments.mutable_view());
+  // The ensemble runs are independent. In SG, up to stream pool size runs are executed
+  // concurrently, each on its own host thread and stream (a run performs many host
+  // synchronizations, so issuing the runs from a single host thread would serialize them). In MG,
+  // the runs are executed one after another as every run issues collective communications.
+
+  size_t num_concurrent_runs{1};
+  if constexpr (!multi_gpu) {
+    if (handle.is_stream_pool_initialized()) {
+      num_concurrent_runs = std::clamp(handle.get_stream_pool_size(), size_t{1}, ensemble_size);
+    }
+  }
+
+  std::vector<rmm::device_uvector<vertex_t>> run_cluster_assignments{};
+  run_cluster_assignments.reserve(num_concurrent_runs);
+  for (size_t i = 0; i < num_concurrent_runs; ++i) {
+    run_cluster_assignments.emplace_back(graph_view.local_vertex_partition_range_size(),
+                                         handle.get_stream());
+  }
+
+  for (size_t run_first = 0; run_first < ensemble_size; run_first += num_concurrent_runs) {
+    auto num_runs = std::min(num_concurrent_runs, ensemble_size - run_first);
+
+    if (num_runs == 1) {
+      std::tie(std::ignore, modularity) = cugraph::louvain(
+        handle,
+        std::make_optional(std::reference_wrapper<raft::random::RngState>(rng_state)),
+        graph_view,
+        edge_weight_view,
+        run_cluster_assignments[0].data(),
+        size_t{1},
+        threshold,
+        resolution);
+    } else {
+      // every run draws random numbers from its own subsequences
+      std::vector<raft::random::RngState> run_rng_states{};
+      run_rng_states.reserve(num_runs);
+      for (size_t i = 0; i < num_runs; ++i) {
+        run_rng_states.push_back(rng_state);
+        rng_state.advance(static_cast<uint64_t>(graph_view.number_of_vertices()));
+      }
+
+      int device_id{};
+      RAFT_CUDA_TRY(cudaGetDevice(&device_id));
+      handle.sync_stream();
 
-    cugraph::transform_e(
-      handle,
-      graph_view,
-      src_cluster_assignments.view(),
-      dst_cluster_assignments.view(),
-      modified_edge_weights.view(),
-      [] __device__(auto, auto, auto src_property, auto dst_property, auto edge_property) {
-        return edge_property + (src_property == dst_property);
-      },
-      modified_edge_weights.mutable_view());
+      std::vector<std::exception_ptr> run_exceptions(num_runs, nullptr);
+      std::vector<std::thread> run_threads{};
+      run_threads.reserve(num_runs);
+      for (size_t i = 0; i < num_runs; ++i) {
+        run_threads.emplace_back([&, i]() {
+          try {
+            RAFT_CUDA_TRY(cudaSetDevice(device_id));
+            raft::handle_t light_handle(handle.get_next_usable_stream(i));
+            cugraph::louvain(
+              light_handle,
+              std::make_optional(std::reference_wrapper<raft::random::RngState>(run_rng_states[i])),
+              graph_view,
+              edge_weight_view,
+              run_cluster_assignments[i].data(),
+              size_t{1},
+              threshold,
+              resolution);
+          } catch (...) {
+            run_exceptions[i] = std::current_exception();
+          }
+        });
+      }
+      for (auto& run_thread : run_threads) {
+        run_thread.join();
+      }
+      handle.sync_stream_pool();
+
+      for (auto& run_exception : run_exceptions) {
+        if (run_exception) { std::rethrow_exception(run_exception); }
+      }
+    }
+
+    for (size_t i = 0; i < num_runs; ++i) {
+      cugraph::update_edge_src_property(handle,
+                                        graph_view,
+                                        run_cluster_assignments[i].begin(),
+                                        src_cluster_assignments.mutable_view());
+      cugraph::update_edge_dst_property(handle,
+                                        graph_view,
+                                        run_cluster_assignments[i].begin(),
+                                        dst_cluster_assignments.mutable_view());
+
+      cugraph::transform_e(
+        handle,
+        graph_view,
+        src_cluster_assignments.view(),
+        dst_cluster_assignments.view(),
+        modified_edge_weights.view(),
+        [] __device__(auto, auto, auto src_property, auto dst_property, auto edge_property) {
+          return edge_property + (src_property == dst_property);
+        },
+        modified_edge_weights.mutable_view());
+    }
   }
 
+  auto cluster_assignments = std::move(run_cluster_assignments[0]);
+  run_cluster_assignments.clear();
+
   cugraph::transform_e(
     handle,
     graph_view,
@@ -17,12 +17,22 @@
 
 // #define TIMING
 
+#include "detail/graph_partition_utils.cuh"
+#include "prims/extract_transform_v_frontier_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/vertex_frontier.cuh"
+
 #include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
 #ifdef TIMING
 #include <cugraph/utilities/high_res_timer.hpp>
 #endif
@@ -31,12 +41,24 @@
 #include <rmm/device_vector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
 #include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
 
 #include <cstddef>
 #include <ctime>
@@ -210,6 +232,445 @@ extract(raft::handle_t const& handle,
     do_expensive_check);
 }
 
+// Batched variant: a single breadth-first search over (vertex, seed index) pairs reaches every
+// ego network at once (the frontier of each iteration holds the newly reached pairs for all the
+// seeds), and the edges of all the ego networks are extracted from one edge scan over the reached
+// pairs. An edge shared by multiple ego networks is stored once and the ego networks refer to it
+// by index.
+
+template <typename vertex_t>
+struct ego_bfs_e_op_t {
+  __device__ cuda::std::optional<size_t> operator()(thrust::tuple<vertex_t, size_t> tagged_src,
+                                                    vertex_t,
+                                                    cuda::std::nullopt_t,
+                                                    cuda::std::nullopt_t,
+                                                    cuda::std::nullopt_t) const
+  {
+    return thrust::get<1>(tagged_src);
+  }
+};
+
+// extracted edges are (src, dst, seed index) or (src, dst, weight, seed index) tuples, the seed
+// index always comes last
+
+template <typename vertex_t>
+struct ego_unweighted_edge_op_t {
+  __device__ cuda::std::optional<thrust::tuple<vertex_t, vertex_t, size_t>> operator()(
+    thrust::tuple<vertex_t, size_t> tagged_src,
+    vertex_t dst,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t) const
+  {
+    return thrust::make_tuple(thrust::get<0>(tagged_src), dst, thrust::get<1>(tagged_src));
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct ego_weighted_edge_op_t {
+  __device__ cuda::std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, size_t>> operator()(
+    thrust::tuple<vertex_t, size_t> tagged_src,
+    vertex_t dst,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t,
+    weight_t wgt) const
+  {
+    return thrust::make_tuple(thrust::get<0>(tagged_src), dst, wgt, thrust::get<1>(tagged_src));
+  }
+};
+
+// (vertex, seed index) pairs reached so far, sorted
+template <typename vertex_t>
+struct is_reached_t {
+  raft::device_span<vertex_t const> reached_vertices{};
+  raft::device_span<size_t const> reached_seeds{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, size_t> pair) const
+  {
+    auto first = thrust::make_zip_iterator(reached_vertices.begin(), reached_seeds.begin());
+    return thrust::binary_search(thrust::seq, first, first + reached_vertices.size(), pair);
+  }
+};
+
+template <typename vertex_t, typename edge_tuple_t>
+struct is_not_ego_edge_t {
+  is_reached_t<vertex_t> is_reached{};
+
+  __device__ bool operator()(edge_tuple_t e) const
+  {
+    return !is_reached(thrust::make_tuple(
+      thrust::get<1>(e), thrust::get<thrust::tuple_size<edge_tuple_t>::value - 1>(e)));
+  }
+};
+
+struct seed_to_gpu_id_t {
+  raft::device_span<size_t const> seed_lasts{};
+
+  __device__ int operator()(size_t seed) const
+  {
+    return static_cast<int>(thrust::distance(
+      seed_lasts.begin(),
+      thrust::upper_bound(thrust::seq, seed_lasts.begin(), seed_lasts.end(), seed)));
+  }
+};
+
+// returns i if the i'th edge starts a new run of (src, dst[, weight]) (or (src, dst[, weight],
+// seed index) if include_seed is true) in the sorted edge list and 0 otherwise
+template <typename EdgeTupleIterator>
+struct ego_edge_run_first_t {
+  EdgeTupleIterator edge_first{};
+  bool include_seed{false};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    using edge_tuple_t = typename thrust::iterator_traits<EdgeTupleIterator>::value_type;
+    constexpr size_t seed_field = thrust::tuple_size<edge_tuple_t>::value - 1;
+
+    if (i == 0) { return size_t{0}; }
+    edge_tuple_t cur  = *(edge_first + i);
+    edge_tuple_t prev = *(edge_first + (i - 1));
+    bool same = (thrust::get<0>(cur) == thrust::get<0>(prev)) &&
+                (thrust::get<1>(cur) == thrust::get<1>(prev));
+    if constexpr (seed_field == 3) { same = same && (thrust::get<2>(cur) == thrust::get<2>(prev)); }
+    if (include_seed) {
+      same = same && (thrust::get<seed_field>(cur) == thrust::get<seed_field>(prev));
+    }
+    return same ? size_t{0} : i;
+  }
+};
+
+// Drop the extracted edges whose destination is outside the tagged ego network (the source is
+// inside by construction), then store every remaining edge once and map each ego network to the
+// indices of its edges.
+template <typename vertex_t, typename edge_t, bool multi_gpu, typename EdgeTupleBuffer>
+std::tuple<EdgeTupleBuffer, rmm::device_uvector<size_t>, rmm::device_uvector<size_t>>
+deduplicate_ego_edges(raft::handle_t const& handle,
+                      cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                      EdgeTupleBuffer&& edges,
+                      is_reached_t<vertex_t> is_reached,
+                      raft::device_span<size_t const> seed_lasts,
+                      size_t seed_first,
+                      size_t num_local_seeds)
+{
+  using edge_tuple_t = typename thrust::iterator_traits<decltype(
+    cugraph::get_dataframe_buffer_begin(edges))>::value_type;
+  constexpr size_t seed_field = thrust::tuple_size<edge_tuple_t>::value - 1;
+
+  if constexpr (multi_gpu) {
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+      vertex_partition_range_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        vertex_partition_range_lasts.data(),
+                        vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+    auto key_func = cugraph::detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+      raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                        d_vertex_partition_range_lasts.size()),
+      handle.get_subcomm(cugraph::partition_manager::major_comm_name()).get_size(),
+      handle.get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size()};
+    std::tie(edges, std::ignore) = cugraph::groupby_gpu_id_and_shuffle_values(
+      handle.get_comms(),
+      cugraph::get_dataframe_buffer_begin(edges),
+      cugraph::get_dataframe_buffer_end(edges),
+      [key_func] __device__(auto e) { return key_func(thrust::get<1>(e)); },
+      handle.get_stream());
+  }
+
+  auto edge_last = thrust::remove_if(handle.get_thrust_policy(),
+                                     cugraph::get_dataframe_buffer_begin(edges),
+                                     cugraph::get_dataframe_buffer_end(edges),
+                                     is_not_ego_edge_t<vertex_t, edge_tuple_t>{is_reached});
+  cugraph::resize_dataframe_buffer(
+    edges,
+    static_cast<size_t>(thrust::distance(cugraph::get_dataframe_buffer_begin(edges), edge_last)),
+    handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    std::tie(edges, std::ignore) = cugraph::groupby_gpu_id_and_shuffle_values(
+      handle.get_comms(),
+      cugraph::get_dataframe_buffer_begin(edges),
+      cugraph::get_dataframe_buffer_end(edges),
+      [key_func = seed_to_gpu_id_t{seed_lasts}] __device__(auto e) {
+        return key_func(thrust::get<seed_field>(e));
+      },
+      handle.get_stream());
+  }
+
+  // An edge is extracted once for every ego network containing it. After sorting, the copies
+  // tagged with the smallest seed index become the shared edges, and the r'th copy of a parallel
+  // edge in a run of (src, dst[, weight], seed index) maps to the r'th shared copy.
+
+  thrust::sort(handle.get_thrust_policy(),
+               cugraph::get_dataframe_buffer_begin(edges),
+               cugraph::get_dataframe_buffer_end(edges));
+  auto num_edges = cugraph::size_dataframe_buffer(edges);
+
+  rmm::device_uvector<size_t> group_firsts(num_edges, handle.get_stream());
+  rmm::device_uvector<size_t> run_firsts(num_edges, handle.get_stream());
+  thrust::transform_inclusive_scan(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    group_firsts.begin(),
+    ego_edge_run_first_t<decltype(cugraph::get_dataframe_buffer_begin(edges))>{
+      cugraph::get_dataframe_buffer_begin(edges), false},
+    thrust::maximum<size_t>{});
+  thrust::transform_inclusive_scan(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    run_firsts.begin(),
+    ego_edge_run_first_t<decltype(cugraph::get_dataframe_buffer_begin(edges))>{
+      cugraph::get_dataframe_buffer_begin(edges), true},
+    thrust::maximum<size_t>{});
+
+  rmm::device_uvector<size_t> shared_positions(num_edges, handle.get_stream());
+  thrust::transform_exclusive_scan(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(group_firsts.begin(), run_firsts.begin()),
+    thrust::make_zip_iterator(group_firsts.end(), run_firsts.end()),
+    shared_positions.begin(),
+    [] __device__(auto firsts) {
+      return thrust::get<0>(firsts) == thrust::get<1>(firsts) ? size_t{1} : size_t{0};
+    },
+    size_t{0},
+    thrust::plus<size_t>{});
+
+  rmm::device_uvector<size_t> edge_indices(num_edges, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    edge_indices.begin(),
+    [group_firsts     = raft::device_span<size_t const>(group_firsts.data(), group_firsts.size()),
+     run_firsts       = raft::device_span<size_t const>(run_firsts.data(), run_firsts.size()),
+     shared_positions = raft::device_span<size_t const>(
+       shared_positions.data(), shared_positions.size())] __device__(size_t i) {
+      return shared_positions[group_firsts[i]] + (i - run_firsts[i]);
+    });
+  shared_positions.resize(0, handle.get_stream());
+  shared_positions.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> ego_seeds(num_edges, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    std::get<seed_field>(edges).begin(),
+                    std::get<seed_field>(edges).end(),
+                    ego_seeds.begin(),
+                    cugraph::shift_left_t<size_t>{seed_first});
+
+  edge_last = thrust::remove_if(
+    handle.get_thrust_policy(),
+    cugraph::get_dataframe_buffer_begin(edges),
+    cugraph::get_dataframe_buffer_end(edges),
+    thrust::make_zip_iterator(group_firsts.begin(), run_firsts.begin()),
+    [] __device__(auto firsts) { return thrust::get<0>(firsts) != thrust::get<1>(firsts); });
+  cugraph::resize_dataframe_buffer(
+    edges,
+    static_cast<size_t>(thrust::distance(cugraph::get_dataframe_buffer_begin(edges), edge_last)),
+    handle.get_stream());
+  cugraph::shrink_to_fit_dataframe_buffer(edges, handle.get_stream());
+  group_firsts.resize(0, handle.get_stream());
+  group_firsts.shrink_to_fit(handle.get_stream());
+  run_firsts.resize(0, handle.get_stream());
+  run_firsts.shrink_to_fit(handle.get_stream());
+
+  thrust::sort(handle.get_thrust_policy(),
+               thrust::make_zip_iterator(ego_seeds.begin(), edge_indices.begin()),
+               thrust::make_zip_iterator(ego_seeds.end(), edge_indices.end()));
+  rmm::device_uvector<size_t> ego_offsets(num_local_seeds + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      ego_seeds.begin(),
+                      ego_seeds.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_seeds + 1),
+                      ego_offsets.begin());
+
+  return std::make_tuple(std::move(edges), std::move(ego_offsets), std::move(edge_indices));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<size_t>>
+extract_batched(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> source_vertices,
+  vertex_t radius,
+  bool do_expensive_check)
+{
+  if (do_expensive_check) {
+    auto vertex_partition = cugraph::vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.local_vertex_partition_view());
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       source_vertices.begin(),
+                       source_vertices.end(),
+                       [vertex_partition] __device__(auto val) {
+                         return !(vertex_partition.is_valid_vertex(val) &&
+                                  vertex_partition.in_local_vertex_partition_range_nocheck(val));
+                       });
+    if constexpr (multi_gpu) {
+      num_invalid_vertices = cugraph::host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: source_vertices have invalid vertex IDs.");
+  }
+
+  // 1. seed indices are global (source_vertices.size() per GPU, in rank order)
+
+  std::vector<size_t> h_seed_lasts{source_vertices.size()};
+  size_t seed_first{0};
+  if constexpr (multi_gpu) {
+    h_seed_lasts = cugraph::host_scalar_allgather(
+      handle.get_comms(), source_vertices.size(), handle.get_stream());
+    std::inclusive_scan(h_seed_lasts.begin(), h_seed_lasts.end(), h_seed_lasts.begin());
+    seed_first = h_seed_lasts[handle.get_comms().get_rank()] - source_vertices.size();
+  }
+  rmm::device_uvector<size_t> seed_lasts(h_seed_lasts.size(), handle.get_stream());
+  raft::update_device(
+    seed_lasts.data(), h_seed_lasts.data(), h_seed_lasts.size(), handle.get_stream());
+
+  // 2. shared breadth-first search over (vertex, seed index) pairs
+
+  cugraph::vertex_frontier_t<vertex_t, size_t, multi_gpu, false> frontier(handle, 1);
+
+  rmm::device_uvector<vertex_t> reached_vertices(source_vertices.size(), handle.get_stream());
+  rmm::device_uvector<size_t> reached_seeds(source_vertices.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               source_vertices.begin(),
+               source_vertices.end(),
+               reached_vertices.begin());
+  thrust::sequence(
+    handle.get_thrust_policy(), reached_seeds.begin(), reached_seeds.end(), seed_first);
+  thrust::sort(handle.get_thrust_policy(),
+               thrust::make_zip_iterator(reached_vertices.begin(), reached_seeds.begin()),
+               thrust::make_zip_iterator(reached_vertices.end(), reached_seeds.end()));
+  frontier.bucket(0).insert(
+    thrust::make_zip_iterator(reached_vertices.begin(), reached_seeds.begin()),
+    thrust::make_zip_iterator(reached_vertices.end(), reached_seeds.end()));
+
+  for (vertex_t depth = 0; depth < radius; ++depth) {
+    auto frontier_size = frontier.bucket(0).aggregate_size();
+    if (frontier_size == 0) { break; }
+
+    auto [new_vertices, new_seeds] = cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
+      handle,
+      graph_view,
+      frontier.bucket(0),
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      ego_bfs_e_op_t<vertex_t>{},
+      cugraph::reduce_op::null{},
+      do_expensive_check);
+
+    auto new_pair_first = thrust::make_zip_iterator(new_vertices.begin(), new_seeds.begin());
+    auto new_pair_last  = thrust::remove_if(
+      handle.get_thrust_policy(),
+      new_pair_first,
+      new_pair_first + new_vertices.size(),
+      is_reached_t<vertex_t>{
+        raft::device_span<vertex_t const>(reached_vertices.data(), reached_vertices.size()),
+        raft::device_span<size_t const>(reached_seeds.data(), reached_seeds.size())});
+    thrust::sort(handle.get_thrust_policy(), new_pair_first, new_pair_last);
+    new_pair_last = thrust::unique(handle.get_thrust_policy(), new_pair_first, new_pair_last);
+    auto num_new_pairs = static_cast<size_t>(thrust::distance(new_pair_first, new_pair_last));
+    new_vertices.resize(num_new_pairs, handle.get_stream());
+    new_seeds.resize(num_new_pairs, handle.get_stream());
+
+    rmm::device_uvector<vertex_t> merged_vertices(reached_vertices.size() + num_new_pairs,
+                                                  handle.get_stream());
+    rmm::device_uvector<size_t> merged_seeds(merged_vertices.size(), handle.get_stream());
+    thrust::merge(handle.get_thrust_policy(),
+                  thrust::make_zip_iterator(reached_vertices.begin(), reached_seeds.begin()),
+                  thrust::make_zip_iterator(reached_vertices.end(), reached_seeds.end()),
+                  new_pair_first,
+                  new_pair_first + num_new_pairs,
+                  thrust::make_zip_iterator(merged_vertices.begin(), merged_seeds.begin()));
+    reached_vertices = std::move(merged_vertices);
+    reached_seeds    = std::move(merged_seeds);
+
+    frontier.bucket(0).clear();
+    frontier.bucket(0).insert(new_pair_first, new_pair_first + num_new_pairs);
+    frontier.bucket(0).shrink_to_fit();
+  }
+
+  // 3. one edge scan over the reached pairs extracts the edges of every ego network
+
+  frontier.bucket(0).clear();
+  frontier.bucket(0).insert(
+    thrust::make_zip_iterator(reached_vertices.begin(), reached_seeds.begin()),
+    thrust::make_zip_iterator(reached_vertices.end(), reached_seeds.end()));
+
+  auto is_reached = is_reached_t<vertex_t>{
+    raft::device_span<vertex_t const>(reached_vertices.data(), reached_vertices.size()),
+    raft::device_span<size_t const>(reached_seeds.data(), reached_seeds.size())};
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+  rmm::device_uvector<size_t> ego_offsets(0, handle.get_stream());
+  rmm::device_uvector<size_t> ego_edge_indices(0, handle.get_stream());
+  if (edge_weight_view) {
+    auto edges = cugraph::extract_transform_v_frontier_outgoing_e(
+      handle,
+      graph_view,
+      frontier.bucket(0),
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      *edge_weight_view,
+      ego_weighted_edge_op_t<vertex_t, weight_t>{},
+      do_expensive_check);
+    frontier.bucket(0).clear();
+    frontier.bucket(0).shrink_to_fit();
+    std::tie(edges, ego_offsets, ego_edge_indices) = deduplicate_ego_edges(
+      handle,
+      graph_view,
+      std::move(edges),
+      is_reached,
+      raft::device_span<size_t const>(seed_lasts.data(), seed_lasts.size()),
+      seed_first,
+      source_vertices.size());
+    srcs    = std::move(std::get<0>(edges));
+    dsts    = std::move(std::get<1>(edges));
+    weights = std::move(std::get<2>(edges));
+  } else {
+    auto edges = cugraph::extract_transform_v_frontier_outgoing_e(
+      handle,
+      graph_view,
+      frontier.bucket(0),
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      ego_unweighted_edge_op_t<vertex_t>{},
+      do_expensive_check);
+    frontier.bucket(0).clear();
+    frontier.bucket(0).shrink_to_fit();
+    std::tie(edges, ego_offsets, ego_edge_indices) = deduplicate_ego_edges(
+      handle,
+      graph_view,
+      std::move(edges),
+      is_reached,
+      raft::device_span<size_t const>(seed_lasts.data(), seed_lasts.size()),
+      seed_first,
+      source_vertices.size());
+    srcs = std::move(std::get<0>(edges));
+    dsts = std::move(std::get<1>(edges));
+  }
+
+  return std::make_tuple(std::move(srcs),
+                         std::move(dsts),
+                         std::move(weights),
+                         std::move(ego_offsets),
+                         std::move(ego_edge_indices));
+}
+
 }  // namespace
 
 namespace cugraph {
@@ -263,4 +724,24 @@ extract_ego(raft::handle_t const& handle,
   return extract(handle, graph_view, edge_weight_view, source_vertex, radius, do_expensive_check);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<size_t>>
+extract_ego_batched(raft::handle_t const& handle,
+                    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                    raft::device_span<vertex_t const> source_vertices,
+                    vertex_t radius,
+                    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(radius > 0, "Radius should be at least 1");
+  CUGRAPH_EXPECTS(radius < graph_view.number_of_vertices(), "radius is too large");
+
+  return extract_batched(
+    handle, graph_view, edge_weight_view, source_vertices, radius, do_expensive_check);
+}
+
 }  // namespace cugraph
@@ -65,4 +65,28 @@ extract_ego(raft::handle_t const& handle,
             int64_t radius,
             bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<size_t>>
+extract_ego_batched(raft::handle_t const& handle,
+                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                    std::optional<edge_property_view_t<int64_t, float const*>>,
+                    raft::device_span<int64_t const> source_vertices,
+                    int64_t radius,
+                    bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    rmm::device_uvector<size_t>,
+                    rmm::device_uvector<size_t>>
+extract_ego_batched(raft::handle_t const& handle,
+                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                    std::optional<edge_property_view_t<int64_t, double const*>>,
+                    raft::device_span<int64_t const> source_vertices,
+                    int64_t radius,
+                    bool do_expensive_check);
+
 }  // namespace cugraph
@@ -23,10 +23,36 @@
 
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/iterator/counting_iterator.h>
+#include <tuple>
 
 namespace cugraph {
 
+// Relabel @p d_partition (cluster IDs in the level @p level vertex ID space) with the clustering of
+// the level, folding the levels one at a time from level 0 reproduces partition_at_level.
+template <typename vertex_t, bool multi_gpu>
+void fold_level_into_partition(raft::handle_t const& handle,
+                               Dendrogram<vertex_t> const& dendrogram,
+                               size_t level,
+                               vertex_t* d_partition,
+                               vertex_t local_num_verts)
+{
+  rmm::device_uvector<vertex_t> level_vertex_ids_v(dendrogram.get_level_size_nocheck(level),
+                                                   handle.get_stream());
+  detail::sequence_fill(handle.get_stream(),
+                        level_vertex_ids_v.begin(),
+                        level_vertex_ids_v.size(),
+                        dendrogram.get_level_first_index_nocheck(level));
+
+  cugraph::relabel<vertex_t, multi_gpu>(
+    handle,
+    std::tuple<vertex_t const*, vertex_t const*>(level_vertex_ids_v.data(),
+                                                 dendrogram.get_level_ptr_nocheck(level)),
+    dendrogram.get_level_size_nocheck(level),
+    d_partition,
+    local_num_verts,
+    false);
+}
+
 template <typename vertex_t, bool multi_gpu>
 void partition_at_level(raft::handle_t const& handle,
                         Dendrogram<vertex_t> const& dendrogram,
@@ -35,29 +61,13 @@ void partition_at_level(raft::handle_t const& handle,
                         size_t level)
 {
   vertex_t local_num_verts = dendrogram.get_level_size_nocheck(0);
-  rmm::device_uvector<vertex_t> local_vertex_ids_v(local_num_verts, handle.get_stream());
 
   raft::copy(d_partition, d_vertex_ids, local_num_verts, handle.get_stream());
 
-  std::for_each(
-    thrust::make_counting_iterator<size_t>(0),
-    thrust::make_counting_iterator<size_t>(level),
-    [&handle, &dendrogram, &local_vertex_ids_v, d_vertex_ids, &d_partition, local_num_verts](
-      size_t l) {
-      detail::sequence_fill(handle.get_stream(),
-                            local_vertex_ids_v.begin(),
-                            dendrogram.get_level_size_nocheck(l),
-                            dendrogram.get_level_first_index_nocheck(l));
-
-      cugraph::relabel<vertex_t, multi_gpu>(
-        handle,
-        std::tuple<vertex_t const*, vertex_t const*>(local_vertex_ids_v.data(),
-                                                     dendrogram.get_level_ptr_nocheck(l)),
-        dendrogram.get_level_size_nocheck(l),
-        d_partition,
-        local_num_verts,
-        false);
-    });
+  for (size_t l = 0; l < level; ++l) {
+    fold_level_into_partition<vertex_t, multi_gpu>(
+      handle, dendrogram, l, d_partition, local_num_verts);
+  }
 }
 
 }  // namespace cugraph
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "community/k_clique_count_impl.cuh"
+#include "detail/graph_partition_utils.cuh"
+#include "prims/extract_transform_e.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <array>
+#include <tuple>
+
+namespace cugraph {
+
+namespace {
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct non_self_loop_count_e_op_t {
+  __device__ edge_t operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t)
+    const
+  {
+    return src != dst ? edge_t{1} : edge_t{0};
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct extract_non_self_loop_edge_t {
+  using return_type = cuda::std::optional<thrust::tuple<vertex_t, edge_t, vertex_t>>;
+
+  __device__ return_type operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, edge_t dst_degree, cuda::std::nullopt_t) const
+  {
+    return src != dst ? return_type{thrust::make_tuple(src, dst_degree, dst)} : cuda::std::nullopt;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct three_path_center_e_op_t {
+  __device__ size_t operator()(
+    vertex_t src, vertex_t dst, edge_t src_degree, edge_t dst_degree, cuda::std::nullopt_t) const
+  {
+    return src != dst
+             ? static_cast<size_t>(src_degree - 1) * static_cast<size_t>(dst_degree - 1)
+             : size_t{0};
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct triangle_pair_e_op_t {
+  __device__ size_t operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, edge_t num_triangles)
+    const
+  {
+    return ((src != dst) && (num_triangles > edge_t{1}))
+             ? static_cast<size_t>(num_triangles) * static_cast<size_t>(num_triangles - 1) / 2
+             : size_t{0};
+  }
+};
+
+// Every 4-cycle has a unique highest ranked vertex u (ranked by (degree, vertex ID)) and a unique
+// vertex w opposite to u. Let c(u, w) be the number of wedges u - v - w with rank(v) < rank(u) and
+// rank(w) < rank(u), the number of 4-cycles is the sum of c(u, w) choose 2 over every (u, w) pair.
+// The wedges are enumerated from their centers v; the neighbor list of every local v (sorted by
+// rank) is gathered on the GPU owning v, and a neighbor u with rank(u) > rank(v) at position p
+// forms such a wedge with the p lower ranked neighbors preceding u. The total wedge count is
+// bounded by O(arboricity x number of edges) (Chiba & Nishizeki).
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+size_t count_four_cycles(raft::handle_t const& handle,
+                         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                         raft::device_span<edge_t const> degrees)
+{
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> edge_dst_degrees(
+    handle, graph_view);
+  update_edge_dst_property(handle, graph_view, degrees.begin(), edge_dst_degrees.mutable_view());
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<edge_t> dst_degrees(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  std::tie(srcs, dst_degrees, dsts) =
+    extract_transform_e(handle,
+                        graph_view,
+                        edge_src_dummy_property_t{}.view(),
+                        edge_dst_degrees.view(),
+                        edge_dummy_property_t{}.view(),
+                        extract_non_self_loop_edge_t<vertex_t, edge_t>{});
+
+  std::optional<rmm::device_uvector<vertex_t>> d_vertex_partition_range_lasts{std::nullopt};
+  if constexpr (multi_gpu) {
+    auto& comm       = handle.get_comms();
+    auto& major_comm = handle.get_subcomm(partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(partition_manager::minor_comm_name());
+
+    d_vertex_partition_range_lasts = rmm::device_uvector<vertex_t>(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device((*d_vertex_partition_range_lasts).data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+
+    std::forward_as_tuple(std::tie(srcs, dst_degrees, dsts), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(srcs.begin(), dst_degrees.begin(), dsts.begin()),
+        thrust::make_zip_iterator(srcs.end(), dst_degrees.end(), dsts.end()),
+        [key_func =
+           detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+             raft::device_span<vertex_t const>((*d_vertex_partition_range_lasts).data(),
+                                               (*d_vertex_partition_range_lasts).size()),
+             major_comm.get_size(),
+             minor_comm.get_size()}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream());
+  }
+
+  // sort by (center, neighbor rank)
+  auto edge_first = thrust::make_zip_iterator(srcs.begin(), dst_degrees.begin(), dsts.begin());
+  thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + srcs.size());
+
+  // the number of wedges emitted by every edge (v, u): the position of u in v's rank sorted
+  // neighbor list if rank(v) < rank(u) and 0 otherwise
+  rmm::device_uvector<size_t> wedge_counts(srcs.size(), handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    wedge_counts.begin(),
+    wedge_counts.end(),
+    [srcs        = raft::device_span<vertex_t const>(srcs.data(), srcs.size()),
+     dst_degrees = raft::device_span<edge_t const>(dst_degrees.data(), dst_degrees.size()),
+     dsts        = raft::device_span<vertex_t const>(dsts.data(), dsts.size()),
+     degrees,
+     v_first = graph_view.local_vertex_partition_range_first()] __device__(size_t i) {
+      auto v          = srcs[i];
+      auto v_degree   = degrees[v - v_first];
+      auto u_degree   = dst_degrees[i];
+      auto start      = static_cast<size_t>(thrust::distance(
+        srcs.begin(), thrust::lower_bound(thrust::seq, srcs.begin(), srcs.end(), v)));
+      bool v_is_lower = (v_degree < u_degree) || ((v_degree == u_degree) && (v < dsts[i]));
+      return v_is_lower ? (i - start) : size_t{0};
+    });
+
+  auto total_wedge_count =
+    thrust::reduce(handle.get_thrust_policy(), wedge_counts.begin(), wedge_counts.end());
+  if constexpr (multi_gpu) {
+    total_wedge_count = host_scalar_allreduce(
+      handle.get_comms(), total_wedge_count, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  // process the wedges in groups (by u % num_groups) to cap the peak memory usage; every (u, w)
+  // pair is confined to a single group
+
+  size_t wedges_per_group =
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 18);
+  if constexpr (multi_gpu) {
+    wedges_per_group *= static_cast<size_t>(handle.get_comms().get_size());
+  }
+  auto num_groups = std::max(raft::div_rounding_up_safe(total_wedge_count, wedges_per_group),
+                             size_t{1});
+
+  size_t num_cycles{0};
+  rmm::device_uvector<size_t> wedge_offsets(srcs.size() + 1, handle.get_stream());
+  for (size_t i = 0; i < num_groups; ++i) {
+    auto group_count_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(size_t{0}),
+      [wedge_counts = wedge_counts.data(), dsts = dsts.data(), num_groups, i] __device__(
+        size_t j) {
+        return (static_cast<size_t>(dsts[j]) % num_groups == i) ? wedge_counts[j] : size_t{0};
+      });
+    wedge_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           group_count_first,
+                           group_count_first + srcs.size(),
+                           wedge_offsets.begin() + 1);
+    auto num_wedges = wedge_offsets.back_element(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> us(num_wedges, handle.get_stream());
+    rmm::device_uvector<vertex_t> ws(num_wedges, handle.get_stream());
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(us.begin(), ws.begin()),
+      thrust::make_zip_iterator(us.end(), ws.end()),
+      [wedge_offsets = raft::device_span<size_t const>(wedge_offsets.data(), wedge_offsets.size()),
+       srcs          = raft::device_span<vertex_t const>(srcs.data(), srcs.size()),
+       dsts          = dsts.data()] __device__(size_t j) {
+        auto idx   = static_cast<size_t>(thrust::distance(
+          wedge_offsets.begin() + 1,
+          thrust::upper_bound(thrust::seq, wedge_offsets.begin() + 1, wedge_offsets.end(), j)));
+        auto start = static_cast<size_t>(thrust::distance(
+          srcs.begin(), thrust::lower_bound(thrust::seq, srcs.begin(), srcs.end(), srcs[idx])));
+        return thrust::make_tuple(dsts[idx], dsts[start + (j - wedge_offsets[idx])]);
+      });
+
+    if constexpr (multi_gpu) {
+      auto& major_comm = handle.get_subcomm(partition_manager::major_comm_name());
+      auto& minor_comm = handle.get_subcomm(partition_manager::minor_comm_name());
+      std::forward_as_tuple(std::tie(us, ws), std::ignore) = groupby_gpu_id_and_shuffle_values(
+        handle.get_comms(),
+        thrust::make_zip_iterator(us.begin(), ws.begin()),
+        thrust::make_zip_iterator(us.end(), ws.end()),
+        [key_func =
+           detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+             raft::device_span<vertex_t const>((*d_vertex_partition_range_lasts).data(),
+                                               (*d_vertex_partition_range_lasts).size()),
+             major_comm.get_size(),
+             minor_comm.get_size()}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream());
+    }
+
+    auto pair_first = thrust::make_zip_iterator(us.begin(), ws.begin());
+    thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + us.size());
+    rmm::device_uvector<size_t> pair_counts(us.size(), handle.get_stream());
+    auto num_unique_pairs = static_cast<size_t>(thrust::distance(
+      pair_counts.begin(),
+      thrust::get<1>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           pair_first,
+                                           pair_first + us.size(),
+                                           thrust::make_constant_iterator(size_t{1}),
+                                           thrust::make_discard_iterator(),
+                                           pair_counts.begin()))));
+    num_cycles += thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      pair_counts.begin(),
+      pair_counts.begin() + num_unique_pairs,
+      [] __device__(size_t c) { return c * (c - 1) / 2; },
+      size_t{0},
+      thrust::plus<size_t>{});
+  }
+
+  if constexpr (multi_gpu) {
+    num_cycles = host_scalar_allreduce(
+      handle.get_comms(), num_cycles, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  return num_cycles;
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::array<size_t, static_cast<size_t>(four_node_graphlet_t::NUM_TYPES)> four_node_graphlet_count(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool induced,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: four_node_graphlet_count currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input arguments: four_node_graphlet_count currently does not support multi-graphs.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  // 2. degrees (excluding self-loops), per-vertex & per-edge triangle counts, and 4-clique counts
+
+  rmm::device_uvector<edge_t> degrees(graph_view.local_vertex_partition_range_size(),
+                                      handle.get_stream());
+  per_v_transform_reduce_outgoing_e(handle,
+                                    graph_view,
+                                    edge_src_dummy_property_t{}.view(),
+                                    edge_dst_dummy_property_t{}.view(),
+                                    edge_dummy_property_t{}.view(),
+                                    non_self_loop_count_e_op_t<vertex_t, edge_t>{},
+                                    edge_t{0},
+                                    reduce_op::plus<edge_t>{},
+                                    degrees.begin());
+
+  auto [num_triangles, vertex_triangle_counts, edge_triangle_counts] =
+    k_clique_count(handle, graph_view, size_t{3}, true, true, do_expensive_check);
+  auto num_four_cliques = std::get<0>(
+    k_clique_count(handle, graph_view, size_t{4}, false, false, do_expensive_check));
+
+  // 3. non-induced counts
+
+  std::array<size_t, static_cast<size_t>(four_node_graphlet_t::NUM_TYPES)> counts{};
+
+  auto pair_first = thrust::make_zip_iterator(degrees.begin(), (*vertex_triangle_counts).begin());
+  auto star_and_tailed_triangle_counts = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + degrees.size(),
+    [] __device__(auto pair) {
+      auto d = static_cast<size_t>(thrust::get<0>(pair));
+      auto t = static_cast<size_t>(thrust::get<1>(pair));
+      return thrust::make_tuple(d >= 3 ? d * (d - 1) * (d - 2) / 6 : size_t{0},
+                                t > 0 ? t * (d - 2) : size_t{0});
+    },
+    thrust::make_tuple(size_t{0}, size_t{0}),
+    reduce_op::plus<thrust::tuple<size_t, size_t>>{});
+  if constexpr (multi_gpu) {
+    star_and_tailed_triangle_counts = host_scalar_allreduce(handle.get_comms(),
+                                                            star_and_tailed_triangle_counts,
+                                                            raft::comms::op_t::SUM,
+                                                            handle.get_stream());
+  }
+  auto num_stars            = thrust::get<0>(star_and_tailed_triangle_counts);
+  auto num_tailed_triangles = thrust::get<1>(star_and_tailed_triangle_counts);
+
+  edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> edge_src_degrees(
+    handle, graph_view);
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> edge_dst_degrees(
+    handle, graph_view);
+  update_edge_src_property(handle, graph_view, degrees.begin(), edge_src_degrees.mutable_view());
+  update_edge_dst_property(handle, graph_view, degrees.begin(), edge_dst_degrees.mutable_view());
+
+  // every undirected edge appears twice in a symmetric graph
+  auto num_paths = transform_reduce_e(handle,
+                                      graph_view,
+                                      edge_src_degrees.view(),
+                                      edge_dst_degrees.view(),
+                                      edge_dummy_property_t{}.view(),
+                                      three_path_center_e_op_t<vertex_t, edge_t>{},
+                                      size_t{0}) /
+                     2 -
+                   3 * num_triangles;
+  auto num_diamonds = transform_reduce_e(handle,
+                                         graph_view,
+                                         edge_src_dummy_property_t{}.view(),
+                                         edge_dst_dummy_property_t{}.view(),
+                                         (*edge_triangle_counts).view(),
+                                         triangle_pair_e_op_t<vertex_t, edge_t>{},
+                                         size_t{0}) /
+                      2;
+
+  auto num_cycles = count_four_cycles(
+    handle, graph_view, raft::device_span<edge_t const>(degrees.data(), degrees.size()));
+
+  counts[static_cast<size_t>(four_node_graphlet_t::PATH)]            = num_paths;
+  counts[static_cast<size_t>(four_node_graphlet_t::STAR)]            = num_stars;
+  counts[static_cast<size_t>(four_node_graphlet_t::CYCLE)]           = num_cycles;
+  counts[static_cast<size_t>(four_node_graphlet_t::TAILED_TRIANGLE)] = num_tailed_triangles;
+  counts[static_cast<size_t>(four_node_graphlet_t::DIAMOND)]         = num_diamonds;
+  counts[static_cast<size_t>(four_node_graphlet_t::CLIQUE)]          = num_four_cliques;
+
+  // 4. induced counts (subtract the copies of every graphlet embedded in the denser graphlets)
+
+  if (induced) {
+    auto k4      = num_four_cliques;
+    auto diamond = num_diamonds - 6 * k4;
+    auto cycle   = num_cycles - diamond - 3 * k4;
+    auto tailed  = num_tailed_triangles - 4 * diamond - 12 * k4;
+    auto star    = num_stars - tailed - 2 * diamond - 4 * k4;
+    auto path    = num_paths - 2 * tailed - 4 * cycle - 6 * diamond - 12 * k4;
+
+    counts[static_cast<size_t>(four_node_graphlet_t::PATH)]            = path;
+    counts[static_cast<size_t>(four_node_graphlet_t::STAR)]            = star;
+    counts[static_cast<size_t>(four_node_graphlet_t::CYCLE)]           = cycle;
+    counts[static_cast<size_t>(four_node_graphlet_t::TAILED_TRIANGLE)] = tailed;
+    counts[static_cast<size_t>(four_node_graphlet_t::DIAMOND)]         = diamond;
+  }
+
+  return counts;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::array<size_t, static_cast<size_t>(four_node_graphlet_t::NUM_TYPES)> four_node_graphlet_count(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool induced,
+  bool do_expensive_check)
+{
+  return detail::four_node_graphlet_count(handle, graph_view, induced, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,690 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "prims/fill_edge_property.cuh"
+#include "prims/per_v_pair_dst_nbr_intersection.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct is_low_to_high_degree_edge_t {
+  __device__ bool operator()(
+    vertex_t src, vertex_t dst, edge_t src_out_degree, edge_t dst_out_degree, cuda::std::nullopt_t)
+    const
+  {
+    return (src_out_degree < dst_out_degree) ||
+           ((src_out_degree == dst_out_degree) && (src < dst) /* tie-breaking using vertex ID */);
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct edge_count_lookup_t {
+  raft::device_span<vertex_t const> sorted_srcs{};
+  raft::device_span<vertex_t const> sorted_dsts{};
+  raft::device_span<edge_t const> counts{};
+
+  __device__ edge_t operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t)
+    const
+  {
+    auto pair_first = thrust::make_zip_iterator(sorted_srcs.begin(), sorted_dsts.begin());
+    auto pair_last  = pair_first + sorted_srcs.size();
+    auto it = thrust::lower_bound(thrust::seq, pair_first, pair_last, thrust::make_tuple(src, dst));
+    return ((it != pair_last) && (*it == thrust::make_tuple(src, dst)))
+             ? counts[thrust::distance(pair_first, it)]
+             : edge_t{0};
+  }
+};
+
+// For every input pair i and every vertex x in the intersection of the two vertices' destination
+// neighbor lists, return (i, x). In multi-GPU, the pairs are shuffled to the GPUs owning the
+// (first, second) edge partition before the intersection and the results are shuffled back.
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<typename GraphViewType::vertex_type>>
+dst_nbr_intersection_of_vertex_pairs(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> firsts,
+  raft::device_span<typename GraphViewType::vertex_type const> seconds,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_uvector<vertex_t> pair_firsts(firsts.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> pair_seconds(seconds.size(), handle.get_stream());
+  rmm::device_uvector<size_t> pair_indices(firsts.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), firsts.begin(), firsts.end(), pair_firsts.begin());
+  thrust::copy(handle.get_thrust_policy(), seconds.begin(), seconds.end(), pair_seconds.begin());
+  thrust::sequence(handle.get_thrust_policy(), pair_indices.begin(), pair_indices.end(), size_t{0});
+
+  [[maybe_unused]] rmm::device_uvector<int> origin_ranks(0, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    rmm::device_uvector<vertex_t> vertex_partition_range_lasts(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device(vertex_partition_range_lasts.data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+
+    origin_ranks.resize(pair_indices.size(), handle.get_stream());
+    scalar_fill(handle, origin_ranks.data(), origin_ranks.size(), comm.get_rank());
+
+    std::forward_as_tuple(std::tie(pair_firsts, pair_seconds, pair_indices, origin_ranks),
+                          std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(
+          pair_firsts.begin(), pair_seconds.begin(), pair_indices.begin(), origin_ranks.begin()),
+        thrust::make_zip_iterator(
+          pair_firsts.end(), pair_seconds.end(), pair_indices.end(), origin_ranks.end()),
+        [key_func =
+           compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+             raft::device_span<vertex_t const>(vertex_partition_range_lasts.data(),
+                                               vertex_partition_range_lasts.size()),
+             comm_size,
+             major_comm_size,
+             minor_comm_size}] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(pair_firsts.begin(), pair_seconds.begin()),
+      thrust::make_zip_iterator(pair_firsts.end(), pair_seconds.end()),
+      thrust::make_zip_iterator(pair_indices.begin(), origin_ranks.begin()));
+  } else {
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        thrust::make_zip_iterator(pair_firsts.begin(), pair_seconds.begin()),
+                        thrust::make_zip_iterator(pair_firsts.end(), pair_seconds.end()),
+                        pair_indices.begin());
+  }
+
+  auto pair_first = thrust::make_zip_iterator(pair_firsts.begin(), pair_seconds.begin());
+  auto [intersection_offsets, intersection_indices] = per_v_pair_dst_nbr_intersection(
+    handle, graph_view, pair_first, pair_first + pair_firsts.size(), do_expensive_check);
+  pair_firsts.resize(0, handle.get_stream());
+  pair_seconds.resize(0, handle.get_stream());
+  pair_firsts.shrink_to_fit(handle.get_stream());
+  pair_seconds.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> output_pair_indices(intersection_indices.size(),
+                                                  handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    output_pair_indices.begin(),
+    output_pair_indices.end(),
+    [intersection_offsets = raft::device_span<size_t const>(intersection_offsets.data(),
+                                                            intersection_offsets.size()),
+     pair_indices         = pair_indices.data()] __device__(size_t i) {
+      auto idx = thrust::distance(
+        intersection_offsets.begin() + 1,
+        thrust::upper_bound(
+          thrust::seq, intersection_offsets.begin() + 1, intersection_offsets.end(), i));
+      return pair_indices[idx];
+    });
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<int> output_ranks(intersection_indices.size(), handle.get_stream());
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      output_ranks.begin(),
+      output_ranks.end(),
+      [intersection_offsets = raft::device_span<size_t const>(intersection_offsets.data(),
+                                                              intersection_offsets.size()),
+       origin_ranks         = origin_ranks.data()] __device__(size_t i) {
+        auto idx = thrust::distance(
+          intersection_offsets.begin() + 1,
+          thrust::upper_bound(
+            thrust::seq, intersection_offsets.begin() + 1, intersection_offsets.end(), i));
+        return origin_ranks[idx];
+      });
+
+    std::forward_as_tuple(std::tie(output_pair_indices, intersection_indices, output_ranks),
+                          std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        handle.get_comms(),
+        thrust::make_zip_iterator(
+          output_pair_indices.begin(), intersection_indices.begin(), output_ranks.begin()),
+        thrust::make_zip_iterator(
+          output_pair_indices.end(), intersection_indices.end(), output_ranks.end()),
+        [] __device__(auto val) { return thrust::get<2>(val); },
+        handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(output_pair_indices), std::move(intersection_indices));
+}
+
+// Return a flag per input (src, dst) pair (in the input order) indicating whether the edge exists.
+// In multi-GPU, the pairs are shuffled to the GPUs owning the corresponding edge partitions before
+// querying and the flags are shuffled back.
+template <typename GraphViewType>
+rmm::device_uvector<bool> check_edge_existence(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  edge_existence_filter_t const& filter,
+  raft::device_span<typename GraphViewType::vertex_type const> srcs,
+  raft::device_span<typename GraphViewType::vertex_type const> dsts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    rmm::device_uvector<vertex_t> vertex_partition_range_lasts(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device(vertex_partition_range_lasts.data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+
+    rmm::device_uvector<vertex_t> edge_srcs(srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> edge_dsts(dsts.size(), handle.get_stream());
+    rmm::device_uvector<size_t> positions(srcs.size(), handle.get_stream());
+    rmm::device_uvector<int> origin_ranks(srcs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), srcs.begin(), srcs.end(), edge_srcs.begin());
+    thrust::copy(handle.get_thrust_policy(), dsts.begin(), dsts.end(), edge_dsts.begin());
+    thrust::sequence(handle.get_thrust_policy(), positions.begin(), positions.end(), size_t{0});
+    scalar_fill(handle, origin_ranks.data(), origin_ranks.size(), comm.get_rank());
+
+    std::forward_as_tuple(std::tie(edge_srcs, edge_dsts, positions, origin_ranks), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(
+          edge_srcs.begin(), edge_dsts.begin(), positions.begin(), origin_ranks.begin()),
+        thrust::make_zip_iterator(
+          edge_srcs.end(), edge_dsts.end(), positions.end(), origin_ranks.end()),
+        [key_func =
+           compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+             raft::device_span<vertex_t const>(vertex_partition_range_lasts.data(),
+                                               vertex_partition_range_lasts.size()),
+             comm_size,
+             major_comm_size,
+             minor_comm_size}] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+
+    auto edge_flags =
+      has_edges(handle,
+                graph_view,
+                filter,
+                raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+                raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
+
+    std::forward_as_tuple(std::tie(edge_flags, positions, origin_ranks), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(edge_flags.begin(), positions.begin(), origin_ranks.begin()),
+        thrust::make_zip_iterator(edge_flags.end(), positions.end(), origin_ranks.end()),
+        [] __device__(auto val) { return thrust::get<2>(val); },
+        handle.get_stream());
+
+    rmm::device_uvector<bool> flags(srcs.size(), handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    edge_flags.begin(),
+                    edge_flags.end(),
+                    positions.begin(),
+                    flags.begin());
+    return flags;
+  } else {
+    return has_edges(handle, graph_view, filter, srcs, dsts);
+  }
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<size_t,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>>>
+k_clique_count(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+               size_t k,
+               bool compute_vertex_counts,
+               bool compute_edge_counts,
+               bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: k_clique_count currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input arguments: k_clique_count currently does not support multi-graphs.");
+  CUGRAPH_EXPECTS(k >= 3, "Invalid input arguments: k should be 3 or larger.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto const v_first = graph_view.local_vertex_partition_range_first();
+
+  std::optional<rmm::device_uvector<vertex_t>> d_vertex_partition_range_lasts{std::nullopt};
+  if constexpr (multi_gpu) {
+    d_vertex_partition_range_lasts = rmm::device_uvector<vertex_t>(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device((*d_vertex_partition_range_lasts).data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+  }
+
+  // 2. orient the edges from a low-degree vertex to a high-degree vertex (this also excludes
+  // self-loops); every k-clique is enumerated exactly once from its lowest ranked vertex
+
+  auto dag_graph_view = graph_view;
+
+  auto unmasked_graph_view = graph_view;
+  if (unmasked_graph_view.has_edge_mask()) { unmasked_graph_view.clear_edge_mask(); }
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool> dag_edge_mask(
+    handle, graph_view);
+  {
+    fill_edge_property(handle, unmasked_graph_view, dag_edge_mask.mutable_view(), false);
+
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+
+    edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>
+      edge_src_out_degrees(handle, graph_view);
+    edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>
+      edge_dst_out_degrees(handle, graph_view);
+    update_edge_src_property(
+      handle, graph_view, out_degrees.begin(), edge_src_out_degrees.mutable_view());
+    update_edge_dst_property(
+      handle, graph_view, out_degrees.begin(), edge_dst_out_degrees.mutable_view());
+
+    transform_e(handle,
+                graph_view,
+                edge_src_out_degrees.view(),
+                edge_dst_out_degrees.view(),
+                edge_dummy_property_t{}.view(),
+                is_low_to_high_degree_edge_t<vertex_t, edge_t>{},
+                dag_edge_mask.mutable_view());
+
+    if (dag_graph_view.has_edge_mask()) { dag_graph_view.clear_edge_mask(); }
+    dag_graph_view.attach_edge_mask(dag_edge_mask.view());
+  }
+
+  // most candidate vertices are not out-neighbors of the remaining clique vertices, the filter
+  // rejects most of them without searching the adjacency lists
+  std::optional<edge_existence_filter_t> dag_edge_filter{std::nullopt};
+  if (k > 3) { dag_edge_filter = build_edge_existence_filter(handle, dag_graph_view); }
+
+  rmm::device_uvector<vertex_t> dag_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dag_dsts(0, handle.get_stream());
+  std::tie(dag_srcs, dag_dsts, std::ignore, std::ignore, std::ignore) =
+    decompress_to_edgelist<vertex_t, edge_t, float, int32_t>(
+      handle, dag_graph_view, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+
+  // 3. output buffers
+
+  std::optional<rmm::device_uvector<edge_t>> vertex_counts{std::nullopt};
+  if (compute_vertex_counts) {
+    vertex_counts = rmm::device_uvector<edge_t>(graph_view.local_vertex_partition_range_size(),
+                                                handle.get_stream());
+    thrust::fill(
+      handle.get_thrust_policy(), (*vertex_counts).begin(), (*vertex_counts).end(), edge_t{0});
+  }
+
+  std::optional<rmm::device_uvector<vertex_t>> sorted_edge_srcs{std::nullopt};
+  std::optional<rmm::device_uvector<vertex_t>> sorted_edge_dsts{std::nullopt};
+  std::optional<rmm::device_uvector<edge_t>> local_edge_counts{std::nullopt};
+  if (compute_edge_counts) {
+    sorted_edge_srcs = rmm::device_uvector<vertex_t>(0, handle.get_stream());
+    sorted_edge_dsts = rmm::device_uvector<vertex_t>(0, handle.get_stream());
+    std::tie(*sorted_edge_srcs, *sorted_edge_dsts, std::ignore, std::ignore, std::ignore) =
+      decompress_to_edgelist<vertex_t, edge_t, float, int32_t>(
+        handle, graph_view, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+    thrust::sort(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator((*sorted_edge_srcs).begin(), (*sorted_edge_dsts).begin()),
+      thrust::make_zip_iterator((*sorted_edge_srcs).end(), (*sorted_edge_dsts).end()));
+    local_edge_counts =
+      rmm::device_uvector<edge_t>((*sorted_edge_srcs).size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 (*local_edge_counts).begin(),
+                 (*local_edge_counts).end(),
+                 edge_t{0});
+  }
+
+  // 4. grow the cliques of every DAG edge chunk one vertex at a time (a candidate vertex should be
+  // in the intersection of the last two clique vertices' out-neighbor lists and should be an
+  // out-neighbor of every other clique vertex), process the edges in chunks to cap the peak memory
+  // usage (the number of partial cliques can grow quickly with k)
+
+  size_t num_cliques{0};
+
+  size_t edges_per_chunk =
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 14);
+  auto num_chunks = raft::div_rounding_up_safe(dag_srcs.size(), edges_per_chunk);
+  if constexpr (multi_gpu) {
+    num_chunks = host_scalar_allreduce(
+      handle.get_comms(), num_chunks, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto chunk_start = std::min(i * edges_per_chunk, dag_srcs.size());
+    auto chunk_size  = std::min(edges_per_chunk, dag_srcs.size() - chunk_start);
+
+    std::vector<rmm::device_uvector<vertex_t>> cliques{};
+    cliques.reserve(k);
+    cliques.emplace_back(chunk_size, handle.get_stream());
+    cliques.emplace_back(chunk_size, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 dag_srcs.begin() + chunk_start,
+                 dag_srcs.begin() + chunk_start + chunk_size,
+                 cliques[0].begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 dag_dsts.begin() + chunk_start,
+                 dag_dsts.begin() + chunk_start + chunk_size,
+                 cliques[1].begin());
+
+    for (size_t l = 2; l < k; ++l) {
+      auto [clique_indices, candidates] = dst_nbr_intersection_of_vertex_pairs(
+        handle,
+        dag_graph_view,
+        raft::device_span<vertex_t const>(cliques[l - 2].data(), cliques[l - 2].size()),
+        raft::device_span<vertex_t const>(cliques[l - 1].data(), cliques[l - 1].size()),
+        do_expensive_check);
+
+      for (size_t j = 0; j + 2 < l; ++j) {
+        rmm::device_uvector<vertex_t> srcs(clique_indices.size(), handle.get_stream());
+        thrust::gather(handle.get_thrust_policy(),
+                       clique_indices.begin(),
+                       clique_indices.end(),
+                       cliques[j].begin(),
+                       srcs.begin());
+        auto flags = check_edge_existence(
+          handle,
+          dag_graph_view,
+          *dag_edge_filter,
+          raft::device_span<vertex_t const>(srcs.data(), srcs.size()),
+          raft::device_span<vertex_t const>(candidates.data(), candidates.size()));
+        auto pair_first    = thrust::make_zip_iterator(clique_indices.begin(), candidates.begin());
+        auto num_remaining = static_cast<size_t>(thrust::distance(
+          pair_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            pair_first,
+                            pair_first + clique_indices.size(),
+                            flags.begin(),
+                            thrust::logical_not<bool>{})));
+        clique_indices.resize(num_remaining, handle.get_stream());
+        candidates.resize(num_remaining, handle.get_stream());
+      }
+
+      std::vector<rmm::device_uvector<vertex_t>> new_cliques{};
+      new_cliques.reserve(k);
+      for (size_t j = 0; j < l; ++j) {
+        new_cliques.emplace_back(clique_indices.size(), handle.get_stream());
+        thrust::gather(handle.get_thrust_policy(),
+                       clique_indices.begin(),
+                       clique_indices.end(),
+                       cliques[j].begin(),
+                       new_cliques.back().begin());
+      }
+      new_cliques.push_back(std::move(candidates));
+      cliques = std::move(new_cliques);
+    }
+
+    auto num_chunk_cliques = cliques[0].size();
+    num_cliques += num_chunk_cliques;
+
+    if (vertex_counts) {
+      rmm::device_uvector<vertex_t> members(num_chunk_cliques * k, handle.get_stream());
+      for (size_t j = 0; j < k; ++j) {
+        thrust::copy(handle.get_thrust_policy(),
+                     cliques[j].begin(),
+                     cliques[j].end(),
+                     members.begin() + j * num_chunk_cliques);
+      }
+      thrust::sort(handle.get_thrust_policy(), members.begin(), members.end());
+      rmm::device_uvector<vertex_t> unique_members(members.size(), handle.get_stream());
+      rmm::device_uvector<edge_t> member_counts(members.size(), handle.get_stream());
+      auto num_uniques = static_cast<size_t>(thrust::distance(
+        unique_members.begin(),
+        thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             members.begin(),
+                                             members.end(),
+                                             thrust::make_constant_iterator(edge_t{1}),
+                                             unique_members.begin(),
+                                             member_counts.begin()))));
+      unique_members.resize(num_uniques, handle.get_stream());
+      member_counts.resize(num_uniques, handle.get_stream());
+      members.resize(0, handle.get_stream());
+      members.shrink_to_fit(handle.get_stream());
+
+      if constexpr (multi_gpu) {
+        auto& major_comm = handle.get_subcomm(partition_manager::major_comm_name());
+        auto& minor_comm = handle.get_subcomm(partition_manager::minor_comm_name());
+        std::tie(unique_members, member_counts, std::ignore) =
+          groupby_gpu_id_and_shuffle_kv_pairs(
+            handle.get_comms(),
+            unique_members.begin(),
+            unique_members.end(),
+            member_counts.begin(),
+            compute_gpu_id_from_int_vertex_t<vertex_t>{
+              raft::device_span<vertex_t const>((*d_vertex_partition_range_lasts).data(),
+                                                (*d_vertex_partition_range_lasts).size()),
+              major_comm.get_size(),
+              minor_comm.get_size()},
+            handle.get_stream());
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(unique_members.begin(), member_counts.begin()),
+        thrust::make_zip_iterator(unique_members.end(), member_counts.end()),
+        [counts = raft::device_span<edge_t>((*vertex_counts).data(), (*vertex_counts).size()),
+         v_first] __device__(auto pair) {
+          cuda::atomic_ref<edge_t, cuda::thread_scope_device> counter(
+            counts[thrust::get<0>(pair) - v_first]);
+          counter.fetch_add(thrust::get<1>(pair), cuda::std::memory_order_relaxed);
+        });
+    }
+
+    if (local_edge_counts) {
+      auto num_clique_edges = k * (k - 1);  // both directions
+      rmm::device_uvector<vertex_t> edge_srcs(num_chunk_cliques * num_clique_edges,
+                                              handle.get_stream());
+      rmm::device_uvector<vertex_t> edge_dsts(edge_srcs.size(), handle.get_stream());
+      size_t offset{0};
+      for (size_t j0 = 0; j0 < k; ++j0) {
+        for (size_t j1 = 0; j1 < k; ++j1) {
+          if (j0 == j1) { continue; }
+          thrust::copy(handle.get_thrust_policy(),
+                       cliques[j0].begin(),
+                       cliques[j0].end(),
+                       edge_srcs.begin() + offset);
+          thrust::copy(handle.get_thrust_policy(),
+                       cliques[j1].begin(),
+                       cliques[j1].end(),
+                       edge_dsts.begin() + offset);
+          offset += num_chunk_cliques;
+        }
+      }
+      auto pair_first = thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin());
+      thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + edge_srcs.size());
+      rmm::device_uvector<vertex_t> unique_srcs(edge_srcs.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> unique_dsts(edge_dsts.size(), handle.get_stream());
+      rmm::device_uvector<edge_t> pair_counts(edge_srcs.size(), handle.get_stream());
+      auto unique_pair_first = thrust::make_zip_iterator(unique_srcs.begin(), unique_dsts.begin());
+      auto num_uniques       = static_cast<size_t>(thrust::distance(
+        unique_pair_first,
+        thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             pair_first,
+                                             pair_first + edge_srcs.size(),
+                                             thrust::make_constant_iterator(edge_t{1}),
+                                             unique_pair_first,
+                                             pair_counts.begin()))));
+      unique_srcs.resize(num_uniques, handle.get_stream());
+      unique_dsts.resize(num_uniques, handle.get_stream());
+      pair_counts.resize(num_uniques, handle.get_stream());
+      edge_srcs.resize(0, handle.get_stream());
+      edge_dsts.resize(0, handle.get_stream());
+      edge_srcs.shrink_to_fit(handle.get_stream());
+      edge_dsts.shrink_to_fit(handle.get_stream());
+
+      if constexpr (multi_gpu) {
+        auto& comm       = handle.get_comms();
+        auto& major_comm = handle.get_subcomm(partition_manager::major_comm_name());
+        auto& minor_comm = handle.get_subcomm(partition_manager::minor_comm_name());
+        std::forward_as_tuple(std::tie(unique_srcs, unique_dsts, pair_counts), std::ignore) =
+          groupby_gpu_id_and_shuffle_values(
+            comm,
+            thrust::make_zip_iterator(
+              unique_srcs.begin(), unique_dsts.begin(), pair_counts.begin()),
+            thrust::make_zip_iterator(unique_srcs.end(), unique_dsts.end(), pair_counts.end()),
+            [key_func =
+               compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+                 raft::device_span<vertex_t const>((*d_vertex_partition_range_lasts).data(),
+                                                   (*d_vertex_partition_range_lasts).size()),
+                 comm.get_size(),
+                 major_comm.get_size(),
+                 minor_comm.get_size()}] __device__(auto val) {
+              return key_func(thrust::get<0>(val), thrust::get<1>(val));
+            },
+            handle.get_stream());
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(unique_srcs.begin(), unique_dsts.begin(), pair_counts.begin()),
+        thrust::make_zip_iterator(unique_srcs.end(), unique_dsts.end(), pair_counts.end()),
+        [sorted_edge_first = thrust::make_zip_iterator((*sorted_edge_srcs).begin(),
+                                                       (*sorted_edge_dsts).begin()),
+         num_edges         = (*sorted_edge_srcs).size(),
+         counts = raft::device_span<edge_t>((*local_edge_counts).data(),
+                                            (*local_edge_counts).size())] __device__(auto triplet) {
+          auto pair = thrust::make_tuple(thrust::get<0>(triplet), thrust::get<1>(triplet));
+          auto it   = thrust::lower_bound(
+            thrust::seq, sorted_edge_first, sorted_edge_first + num_edges, pair);
+          assert(*it == pair);
+          cuda::atomic_ref<edge_t, cuda::thread_scope_device> counter(
+            counts[thrust::distance(sorted_edge_first, it)]);
+          counter.fetch_add(thrust::get<2>(triplet), cuda::std::memory_order_relaxed);
+        });
+    }
+  }
+
+  if constexpr (multi_gpu) {
+    num_cliques = host_scalar_allreduce(
+      handle.get_comms(), num_cliques, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  // 5. move the per-edge counts to an edge property
+
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>>
+    edge_counts{std::nullopt};
+  if (local_edge_counts) {
+    edge_counts =
+      edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>(handle, graph_view);
+    fill_edge_property(handle, unmasked_graph_view, (*edge_counts).mutable_view(), edge_t{0});
+    transform_e(handle,
+                graph_view,
+                edge_src_dummy_property_t{}.view(),
+                edge_dst_dummy_property_t{}.view(),
+                edge_dummy_property_t{}.view(),
+                edge_count_lookup_t<vertex_t, edge_t>{
+                  raft::device_span<vertex_t const>((*sorted_edge_srcs).data(),
+                                                    (*sorted_edge_srcs).size()),
+                  raft::device_span<vertex_t const>((*sorted_edge_dsts).data(),
+                                                    (*sorted_edge_dsts).size()),
+                  raft::device_span<edge_t const>((*local_edge_counts).data(),
+                                                  (*local_edge_counts).size())},
+                (*edge_counts).mutable_view());
+  }
+
+  return std::make_tuple(num_cliques, std::move(vertex_counts), std::move(edge_counts));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<size_t,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>>>
+k_clique_count(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+               size_t k,
+               bool compute_vertex_counts,
+               bool compute_edge_counts,
+               bool do_expensive_check)
+{
+  return detail::k_clique_count(
+    handle, graph_view, k, compute_vertex_counts, compute_edge_counts, do_expensive_check);
+}
+
+}  // namespace cugraph
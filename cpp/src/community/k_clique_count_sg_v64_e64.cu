@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "community/k_clique_count_impl.cuh"
+
+namespace cugraph {
+
+template std::tuple<
+  size_t,
+  std::optional<rmm::device_uvector<int64_t>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int64_t>>>
+k_clique_count(raft::handle_t const& handle,
+               graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+               size_t k,
+               bool compute_vertex_counts,
+               bool compute_edge_counts,
+               bool do_expensive_check);
+
+}  // namespace cugraph
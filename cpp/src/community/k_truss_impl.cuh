@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "prims/count_if_e.cuh"
 #include "prims/edge_bucket.cuh"
 #include "prims/extract_transform_e.cuh"
 #include "prims/extract_transform_v_frontier_outgoing_e.cuh"
@@ -26,6 +27,7 @@
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/collect_comm_wrapper.hpp>
+#include <cugraph/edge_property.hpp>
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/error.hpp>
@@ -159,8 +161,481 @@ struct extract_low_to_high_degree_edges_from_endpoints_t {
   }
 };
 
+template <typename vertex_t, typename edge_t>
+struct assign_truss_number_t {
+  edge_t k{};
+
+  __device__ edge_t operator()(vertex_t,
+                               vertex_t,
+                               cuda::std::nullopt_t,
+                               cuda::std::nullopt_t,
+                               thrust::tuple<edge_t, edge_t> count_and_truss_number) const
+  {
+    auto count        = thrust::get<0>(count_and_truss_number);
+    auto truss_number = thrust::get<1>(count_and_truss_number);
+    // an edge not in the k-truss (but in the (k-1)-truss) has the truss number of k - 1
+    return ((truss_number == edge_t{0}) && (count < k - 2)) ? k - 1 : truss_number;
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_unassigned_truss_number_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, edge_t truss_number) const
+  {
+    return truss_number == edge_t{0};
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct extract_reversed_edges_with_truss_numbers_t {
+  __device__ cuda::std::optional<thrust::tuple<vertex_t, vertex_t, edge_t>> operator()(
+    vertex_t src,
+    vertex_t dst,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t,
+    edge_t truss_number) const
+  {
+    return thrust::make_tuple(dst, src, truss_number);
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct lookup_truss_number_t {
+  raft::device_span<vertex_t const> sorted_srcs{};
+  raft::device_span<vertex_t const> sorted_dsts{};
+  raft::device_span<edge_t const> truss_numbers{};
+
+  __device__ edge_t operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t)
+    const
+  {
+    auto pair_first = thrust::make_zip_iterator(sorted_srcs.begin(), sorted_dsts.begin());
+    auto it         = thrust::lower_bound(
+      thrust::seq, pair_first, pair_first + sorted_srcs.size(), thrust::make_tuple(src, dst));
+    return truss_numbers[thrust::distance(pair_first, it)];
+  }
+};
+
 }  // namespace
 
+namespace detail {
+
+// Remove the edges with less than k - 2 triangles from the undirected graph (weak_edges_mask) until
+// no more edge can be removed. The triangle counts of the remaining edges in the DODG (dodg_mask)
+// are updated incrementally: when an edge is removed, only the counts of the other two edges of
+// each triangle the edge belongs to are decremented. cur_graph_view should have dodg_mask attached
+// on entry and has dodg_mask attached on exit.
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void peel_weak_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu>& cur_graph_view,
+  edge_src_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> const&
+    edge_src_out_degrees,
+  edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> const&
+    edge_dst_out_degrees,
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool>& weak_edges_mask,
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bool>& dodg_mask,
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t>& edge_triangle_counts,
+  edge_t k,
+  bool do_expensive_check)
+{
+  using weight_t = float;  // dummy
+
+  cugraph::edge_bucket_t<vertex_t, void, true, multi_gpu, true> edgelist_weak(handle);
+  cugraph::edge_bucket_t<vertex_t, void, true, multi_gpu, true> edges_to_decrement_count(handle);
+  size_t prev_chunk_size = 0;  // FIXME: Add support for chunking
+
+  while (true) {
+    // Extract weak edges
+    auto [weak_edgelist_srcs, weak_edgelist_dsts] =
+      extract_transform_e(handle,
+                          cur_graph_view,
+                          edge_src_dummy_property_t{}.view(),
+                          edge_dst_dummy_property_t{}.view(),
+                          edge_triangle_counts.view(),
+                          extract_weak_edges<vertex_t, edge_t>{k});
+
+    auto weak_edgelist_first =
+      thrust::make_zip_iterator(weak_edgelist_srcs.begin(), weak_edgelist_dsts.begin());
+    auto weak_edgelist_last =
+      thrust::make_zip_iterator(weak_edgelist_srcs.end(), weak_edgelist_dsts.end());
+
+    thrust::sort(handle.get_thrust_policy(), weak_edgelist_first, weak_edgelist_last);
+
+    // Perform nbr_intersection of the weak edges from the undirected
+    // graph view
+    cur_graph_view.clear_edge_mask();
+
+    // Attach the weak edge mask
+    cur_graph_view.attach_edge_mask(weak_edges_mask.view());
+
+    auto [intersection_offsets, intersection_indices] = per_v_pair_dst_nbr_intersection(
+      handle, cur_graph_view, weak_edgelist_first, weak_edgelist_last, do_expensive_check);
+
+    // This array stores (p, q, r) which are endpoints for the triangles with weak edges
+
+    auto triangles_endpoints =
+      allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t, vertex_t>>(
+        intersection_indices.size(), handle.get_stream());
+
+    // Extract endpoints for triangles with weak edges
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      get_dataframe_buffer_begin(triangles_endpoints),
+      get_dataframe_buffer_end(triangles_endpoints),
+      extract_triangles_endpoints<vertex_t, edge_t>{
+        prev_chunk_size,
+        raft::device_span<size_t const>(intersection_offsets.data(), intersection_offsets.size()),
+        raft::device_span<vertex_t const>(intersection_indices.data(),
+                                          intersection_indices.size()),
+        raft::device_span<vertex_t const>(weak_edgelist_srcs.data(), weak_edgelist_srcs.size()),
+        raft::device_span<vertex_t const>(weak_edgelist_dsts.data(), weak_edgelist_dsts.size())});
+
+    thrust::sort(handle.get_thrust_policy(),
+                 get_dataframe_buffer_begin(triangles_endpoints),
+                 get_dataframe_buffer_end(triangles_endpoints));
+
+    auto unique_triangle_end = thrust::unique(handle.get_thrust_policy(),
+                                              get_dataframe_buffer_begin(triangles_endpoints),
+                                              get_dataframe_buffer_end(triangles_endpoints));
+
+    auto num_unique_triangles = thrust::distance(  // Triangles are represented by their endpoints
+      get_dataframe_buffer_begin(triangles_endpoints),
+      unique_triangle_end);
+
+    resize_dataframe_buffer(triangles_endpoints, num_unique_triangles, handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      auto& comm           = handle.get_comms();
+      auto const comm_size = comm.get_size();
+      auto& major_comm     = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      auto const minor_comm_size = minor_comm.get_size();
+
+      auto vertex_partition_range_lasts = cur_graph_view.vertex_partition_range_lasts();
+
+      rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+        vertex_partition_range_lasts.size(), handle.get_stream());
+
+      raft::update_device(d_vertex_partition_range_lasts.data(),
+                          vertex_partition_range_lasts.data(),
+                          vertex_partition_range_lasts.size(),
+                          handle.get_stream());
+
+      // Shuffle the edges with respect to the undirected graph view to the GPU
+      // owning edge (p, q). Remember that the triplet (p, q, r) is ordered based on the
+      // vertex ID and not the degree so (p, q) might not be an edge in the DODG but is
+      // surely an edge in the undirected graph
+      std::tie(triangles_endpoints, std::ignore) = groupby_gpu_id_and_shuffle_values(
+        handle.get_comms(),
+        get_dataframe_buffer_begin(triangles_endpoints),
+        get_dataframe_buffer_end(triangles_endpoints),
+
+        [key_func =
+           cugraph::detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+             raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                               d_vertex_partition_range_lasts.size()),
+             comm_size,
+             major_comm_size,
+             minor_comm_size}] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+
+      thrust::sort(handle.get_thrust_policy(),
+                   get_dataframe_buffer_begin(triangles_endpoints),
+                   get_dataframe_buffer_end(triangles_endpoints));
+
+      unique_triangle_end = thrust::unique(handle.get_thrust_policy(),
+                                           get_dataframe_buffer_begin(triangles_endpoints),
+                                           get_dataframe_buffer_end(triangles_endpoints));
+
+      num_unique_triangles =
+        thrust::distance(get_dataframe_buffer_begin(triangles_endpoints), unique_triangle_end);
+      resize_dataframe_buffer(triangles_endpoints, num_unique_triangles, handle.get_stream());
+    }
+
+    auto edgelist_to_update_count = allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t>>(
+      3 * num_unique_triangles, handle.get_stream());
+
+    // The order no longer matters since duplicated triangles have been removed
+    // Flatten the endpoints to a list of egdes.
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator<edge_t>(0),
+      thrust::make_counting_iterator<edge_t>(size_dataframe_buffer(edgelist_to_update_count)),
+      get_dataframe_buffer_begin(edgelist_to_update_count),
+      [num_unique_triangles,
+       triangles_endpoints =
+         get_dataframe_buffer_begin(triangles_endpoints)] __device__(auto idx) {
+        auto idx_triangle           = idx % num_unique_triangles;
+        auto idx_vertex_in_triangle = idx / num_unique_triangles;
+        auto triangle               = (triangles_endpoints + idx_triangle).get_iterator_tuple();
+        vertex_t src;
+        vertex_t dst;
+
+        if (idx_vertex_in_triangle == 0) {
+          src = *(thrust::get<0>(triangle));
+          dst = *(thrust::get<1>(triangle));
+        }
+
+        if (idx_vertex_in_triangle == 1) {
+          src = *(thrust::get<0>(triangle));
+          dst = *(thrust::get<2>(triangle));
+        }
+
+        if (idx_vertex_in_triangle == 2) {
+          src = *(thrust::get<1>(triangle));
+          dst = *(thrust::get<2>(triangle));
+        }
+
+        return thrust::make_tuple(src, dst);
+      });
+
+    if constexpr (multi_gpu) {
+      std::tie(std::get<0>(edgelist_to_update_count),
+               std::get<1>(edgelist_to_update_count),
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore) =
+        detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                       edge_t,
+                                                                                       weight_t,
+                                                                                       int32_t,
+                                                                                       int32_t>(
+          handle,
+          std::move(std::get<0>(edgelist_to_update_count)),
+          std::move(std::get<1>(edgelist_to_update_count)),
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cur_graph_view.vertex_partition_range_lasts());
+    }
+
+    thrust::sort(handle.get_thrust_policy(),
+                 get_dataframe_buffer_begin(edgelist_to_update_count),
+                 get_dataframe_buffer_end(edgelist_to_update_count));
+
+    auto unique_pair_count =
+      thrust::unique_count(handle.get_thrust_policy(),
+                           get_dataframe_buffer_begin(edgelist_to_update_count),
+                           get_dataframe_buffer_end(edgelist_to_update_count));
+
+    auto vertex_pair_buffer_unique = allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t>>(
+      unique_pair_count, handle.get_stream());
+
+    rmm::device_uvector<edge_t> decrease_count(unique_pair_count, handle.get_stream());
+
+    thrust::reduce_by_key(handle.get_thrust_policy(),
+                          get_dataframe_buffer_begin(edgelist_to_update_count),
+                          get_dataframe_buffer_end(edgelist_to_update_count),
+                          thrust::make_constant_iterator(size_t{1}),
+                          get_dataframe_buffer_begin(vertex_pair_buffer_unique),
+                          decrease_count.begin(),
+                          thrust::equal_to<thrust::tuple<vertex_t, vertex_t>>{});
+
+    std::tie(std::get<0>(vertex_pair_buffer_unique),
+             std::get<1>(vertex_pair_buffer_unique),
+             decrease_count) =
+      extract_transform_e(
+        handle,
+        cur_graph_view,
+        edge_src_out_degrees.view(),
+        edge_dst_out_degrees.view(),
+        edge_dummy_property_t{}.view(),
+        extract_low_to_high_degree_edges_from_endpoints_t<vertex_t, edge_t>{
+          raft::device_span<vertex_t const>(std::get<0>(vertex_pair_buffer_unique).data(),
+                                            std::get<0>(vertex_pair_buffer_unique).size()),
+          raft::device_span<vertex_t const>(std::get<1>(vertex_pair_buffer_unique).data(),
+                                            std::get<1>(vertex_pair_buffer_unique).size()),
+          raft::device_span<edge_t const>(decrease_count.data(), decrease_count.size())});
+
+    if constexpr (multi_gpu) {
+      auto& comm           = handle.get_comms();
+      auto const comm_size = comm.get_size();
+      auto& major_comm     = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      auto const minor_comm_size        = minor_comm.get_size();
+      auto vertex_partition_range_lasts = cur_graph_view.vertex_partition_range_lasts();
+
+      rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+        vertex_partition_range_lasts.size(), handle.get_stream());
+      raft::update_device(d_vertex_partition_range_lasts.data(),
+                          vertex_partition_range_lasts.data(),
+                          vertex_partition_range_lasts.size(),
+                          handle.get_stream());
+
+      std::forward_as_tuple(std::tie(std::get<0>(vertex_pair_buffer_unique),
+                                     std::get<1>(vertex_pair_buffer_unique),
+                                     decrease_count),
+                            std::ignore) =
+        groupby_gpu_id_and_shuffle_values(
+          handle.get_comms(),
+          thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).begin(),
+                                    std::get<1>(vertex_pair_buffer_unique).begin(),
+                                    decrease_count.begin()),
+          thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).end(),
+                                    std::get<1>(vertex_pair_buffer_unique).end(),
+                                    decrease_count.end()),
+          [key_func =
+             cugraph::detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+               raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                                 d_vertex_partition_range_lasts.size()),
+               comm_size,
+               major_comm_size,
+               minor_comm_size}] __device__(auto val) {
+            return key_func(thrust::get<0>(val), thrust::get<1>(val));
+          },
+          handle.get_stream());
+    }
+
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        get_dataframe_buffer_begin(vertex_pair_buffer_unique),
+                        get_dataframe_buffer_end(vertex_pair_buffer_unique),
+                        decrease_count.begin());
+
+    // Update count of weak edges
+    edges_to_decrement_count.clear();
+
+    edges_to_decrement_count.insert(std::get<0>(vertex_pair_buffer_unique).begin(),
+                                    std::get<0>(vertex_pair_buffer_unique).end(),
+                                    std::get<1>(vertex_pair_buffer_unique).begin());
+
+    cur_graph_view.clear_edge_mask();
+    // Check for edge existance on the directed graph view
+    cur_graph_view.attach_edge_mask(dodg_mask.view());
+
+    // Update count of weak edges from the DODG view
+    cugraph::transform_e(
+      handle,
+      cur_graph_view,
+      edges_to_decrement_count,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      edge_triangle_counts.view(),
+      [edge_buffer_first =
+         thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).begin(),
+                                   std::get<1>(vertex_pair_buffer_unique).begin()),
+       edge_buffer_last = thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).end(),
+                                                    std::get<1>(vertex_pair_buffer_unique).end()),
+       decrease_count   = raft::device_span<edge_t>(
+         decrease_count.data(), decrease_count.size())] __device__(auto src,
+                                                                   auto dst,
+                                                                   cuda::std::nullopt_t,
+                                                                   cuda::std::nullopt_t,
+                                                                   edge_t count) {
+        auto itr_pair = thrust::lower_bound(
+          thrust::seq, edge_buffer_first, edge_buffer_last, thrust::make_tuple(src, dst));
+        auto idx_pair = thrust::distance(edge_buffer_first, itr_pair);
+        count -= decrease_count[idx_pair];
+
+        return count;
+      },
+      edge_triangle_counts.mutable_view(),
+      do_expensive_check);
+
+    edgelist_weak.clear();
+
+    thrust::sort(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(weak_edgelist_srcs.begin(), weak_edgelist_dsts.begin()),
+      thrust::make_zip_iterator(weak_edgelist_srcs.end(), weak_edgelist_dsts.end()));
+
+    edgelist_weak.insert(
+      weak_edgelist_srcs.begin(), weak_edgelist_srcs.end(), weak_edgelist_dsts.begin());
+
+    // Get undirected graph view
+    cur_graph_view.clear_edge_mask();
+    cur_graph_view.attach_edge_mask(weak_edges_mask.view());
+
+    auto prev_number_of_edges = cur_graph_view.compute_number_of_edges(handle);
+
+    cugraph::transform_e(
+      handle,
+      cur_graph_view,
+      edgelist_weak,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      [] __device__(
+        auto src, auto dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) {
+        return false;
+      },
+      weak_edges_mask.mutable_view(),
+      do_expensive_check);
+
+    edgelist_weak.clear();
+
+    // shuffle the edges if multi_gpu
+    if constexpr (multi_gpu) {
+      std::tie(weak_edgelist_dsts,
+               weak_edgelist_srcs,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore) =
+        detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                       edge_t,
+                                                                                       weight_t,
+                                                                                       int32_t,
+                                                                                       int32_t>(
+          handle,
+          std::move(weak_edgelist_dsts),
+          std::move(weak_edgelist_srcs),
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cur_graph_view.vertex_partition_range_lasts());
+    }
+
+    thrust::sort(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(weak_edgelist_dsts.begin(), weak_edgelist_srcs.begin()),
+      thrust::make_zip_iterator(weak_edgelist_dsts.end(), weak_edgelist_srcs.end()));
+
+    edgelist_weak.insert(
+      weak_edgelist_dsts.begin(), weak_edgelist_dsts.end(), weak_edgelist_srcs.begin());
+
+    cugraph::transform_e(
+      handle,
+      cur_graph_view,
+      edgelist_weak,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      [] __device__(
+        auto src, auto dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) {
+        return false;
+      },
+      weak_edges_mask.mutable_view(),
+      do_expensive_check);
+
+    cur_graph_view.attach_edge_mask(weak_edges_mask.view());
+
+    if (prev_number_of_edges == cur_graph_view.compute_number_of_edges(handle)) { break; }
+
+    cur_graph_view.clear_edge_mask();
+    cur_graph_view.attach_edge_mask(dodg_mask.view());
+  }
+
+  cur_graph_view.clear_edge_mask();
+  cur_graph_view.attach_edge_mask(dodg_mask.view());
+}
+
+}  // namespace detail
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -268,6 +743,31 @@ k_truss(raft::handle_t const& handle,
     }
   }
 
+  // 2.3 If most edges are masked out, build a compacted graph (the following steps scan every
+  // edge of the graph many times)
+
+  std::optional<graph_t<vertex_t, edge_t, false, multi_gpu>> compacted_graph{std::nullopt};
+  std::optional<edge_property_t<decltype(cur_graph_view), weight_t>> compacted_edge_weights{
+    std::nullopt};
+  {
+    auto compacted = compact_graph_if_sparse(handle, cur_graph_view, edge_weight_view);
+    if (compacted) {
+      compacted_graph        = std::move(std::get<0>(*compacted));
+      compacted_edge_weights = std::move(std::get<1>(*compacted));
+
+      cur_graph_view          = (*compacted_graph).view();
+      unmasked_cur_graph_view = cur_graph_view;
+      edge_weight_view        = compacted_edge_weights
+                                  ? std::make_optional((*compacted_edge_weights).view())
+                                  : std::nullopt;
+
+      undirected_mask = edge_property_t<decltype(cur_graph_view), bool>(handle, cur_graph_view);
+      cugraph::fill_edge_property(
+        handle, unmasked_cur_graph_view, undirected_mask.mutable_view(), true);
+      cur_graph_view.attach_edge_mask(undirected_mask.view());
+    }
+  }
+
   // 3. Keep only the edges from a low-degree vertex to a high-degree vertex.
 
   edge_src_property_t<decltype(cur_graph_view), edge_t> edge_src_out_degrees(handle,
@@ -316,396 +816,15 @@ k_truss(raft::handle_t const& handle,
     auto edge_triangle_counts =
       edge_triangle_count<vertex_t, edge_t, multi_gpu>(handle, cur_graph_view, false);
 
-    cugraph::edge_bucket_t<vertex_t, void, true, multi_gpu, true> edgelist_weak(handle);
-    cugraph::edge_bucket_t<vertex_t, void, true, multi_gpu, true> edges_to_decrement_count(handle);
-    size_t prev_chunk_size = 0;  // FIXME: Add support for chunking
-
-    while (true) {
-      // Extract weak edges
-      auto [weak_edgelist_srcs, weak_edgelist_dsts] =
-        extract_transform_e(handle,
+    detail::peel_weak_edges(handle,
                             cur_graph_view,
-                            edge_src_dummy_property_t{}.view(),
-                            edge_dst_dummy_property_t{}.view(),
-                            edge_triangle_counts.view(),
-                            extract_weak_edges<vertex_t, edge_t>{k});
-
-      auto weak_edgelist_first =
-        thrust::make_zip_iterator(weak_edgelist_srcs.begin(), weak_edgelist_dsts.begin());
-      auto weak_edgelist_last =
-        thrust::make_zip_iterator(weak_edgelist_srcs.end(), weak_edgelist_dsts.end());
-
-      thrust::sort(handle.get_thrust_policy(), weak_edgelist_first, weak_edgelist_last);
-
-      // Perform nbr_intersection of the weak edges from the undirected
-      // graph view
-      cur_graph_view.clear_edge_mask();
-
-      // Attach the weak edge mask
-      cur_graph_view.attach_edge_mask(weak_edges_mask.view());
-
-      auto [intersection_offsets, intersection_indices] = per_v_pair_dst_nbr_intersection(
-        handle, cur_graph_view, weak_edgelist_first, weak_edgelist_last, do_expensive_check);
-
-      // This array stores (p, q, r) which are endpoints for the triangles with weak edges
-
-      auto triangles_endpoints =
-        allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t, vertex_t>>(
-          intersection_indices.size(), handle.get_stream());
-
-      // Extract endpoints for triangles with weak edges
-      thrust::tabulate(
-        handle.get_thrust_policy(),
-        get_dataframe_buffer_begin(triangles_endpoints),
-        get_dataframe_buffer_end(triangles_endpoints),
-        extract_triangles_endpoints<vertex_t, edge_t>{
-          prev_chunk_size,
-          raft::device_span<size_t const>(intersection_offsets.data(), intersection_offsets.size()),
-          raft::device_span<vertex_t const>(intersection_indices.data(),
-                                            intersection_indices.size()),
-          raft::device_span<vertex_t const>(weak_edgelist_srcs.data(), weak_edgelist_srcs.size()),
-          raft::device_span<vertex_t const>(weak_edgelist_dsts.data(), weak_edgelist_dsts.size())});
-
-      thrust::sort(handle.get_thrust_policy(),
-                   get_dataframe_buffer_begin(triangles_endpoints),
-                   get_dataframe_buffer_end(triangles_endpoints));
-
-      auto unique_triangle_end = thrust::unique(handle.get_thrust_policy(),
-                                                get_dataframe_buffer_begin(triangles_endpoints),
-                                                get_dataframe_buffer_end(triangles_endpoints));
-
-      auto num_unique_triangles = thrust::distance(  // Triangles are represented by their endpoints
-        get_dataframe_buffer_begin(triangles_endpoints),
-        unique_triangle_end);
-
-      resize_dataframe_buffer(triangles_endpoints, num_unique_triangles, handle.get_stream());
-
-      if constexpr (multi_gpu) {
-        auto& comm           = handle.get_comms();
-        auto const comm_size = comm.get_size();
-        auto& major_comm     = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
-        auto const major_comm_size = major_comm.get_size();
-        auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
-        auto const minor_comm_size = minor_comm.get_size();
-
-        auto vertex_partition_range_lasts = cur_graph_view.vertex_partition_range_lasts();
-
-        rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
-          vertex_partition_range_lasts.size(), handle.get_stream());
-
-        raft::update_device(d_vertex_partition_range_lasts.data(),
-                            vertex_partition_range_lasts.data(),
-                            vertex_partition_range_lasts.size(),
-                            handle.get_stream());
-
-        // Shuffle the edges with respect to the undirected graph view to the GPU
-        // owning edge (p, q). Remember that the triplet (p, q, r) is ordered based on the
-        // vertex ID and not the degree so (p, q) might not be an edge in the DODG but is
-        // surely an edge in the undirected graph
-        std::tie(triangles_endpoints, std::ignore) = groupby_gpu_id_and_shuffle_values(
-          handle.get_comms(),
-          get_dataframe_buffer_begin(triangles_endpoints),
-          get_dataframe_buffer_end(triangles_endpoints),
-
-          [key_func =
-             cugraph::detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
-               raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
-                                                 d_vertex_partition_range_lasts.size()),
-               comm_size,
-               major_comm_size,
-               minor_comm_size}] __device__(auto val) {
-            return key_func(thrust::get<0>(val), thrust::get<1>(val));
-          },
-          handle.get_stream());
-
-        thrust::sort(handle.get_thrust_policy(),
-                     get_dataframe_buffer_begin(triangles_endpoints),
-                     get_dataframe_buffer_end(triangles_endpoints));
-
-        unique_triangle_end = thrust::unique(handle.get_thrust_policy(),
-                                             get_dataframe_buffer_begin(triangles_endpoints),
-                                             get_dataframe_buffer_end(triangles_endpoints));
-
-        num_unique_triangles =
-          thrust::distance(get_dataframe_buffer_begin(triangles_endpoints), unique_triangle_end);
-        resize_dataframe_buffer(triangles_endpoints, num_unique_triangles, handle.get_stream());
-      }
-
-      auto edgelist_to_update_count = allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t>>(
-        3 * num_unique_triangles, handle.get_stream());
-
-      // The order no longer matters since duplicated triangles have been removed
-      // Flatten the endpoints to a list of egdes.
-      thrust::transform(
-        handle.get_thrust_policy(),
-        thrust::make_counting_iterator<edge_t>(0),
-        thrust::make_counting_iterator<edge_t>(size_dataframe_buffer(edgelist_to_update_count)),
-        get_dataframe_buffer_begin(edgelist_to_update_count),
-        [num_unique_triangles,
-         triangles_endpoints =
-           get_dataframe_buffer_begin(triangles_endpoints)] __device__(auto idx) {
-          auto idx_triangle           = idx % num_unique_triangles;
-          auto idx_vertex_in_triangle = idx / num_unique_triangles;
-          auto triangle               = (triangles_endpoints + idx_triangle).get_iterator_tuple();
-          vertex_t src;
-          vertex_t dst;
-
-          if (idx_vertex_in_triangle == 0) {
-            src = *(thrust::get<0>(triangle));
-            dst = *(thrust::get<1>(triangle));
-          }
-
-          if (idx_vertex_in_triangle == 1) {
-            src = *(thrust::get<0>(triangle));
-            dst = *(thrust::get<2>(triangle));
-          }
-
-          if (idx_vertex_in_triangle == 2) {
-            src = *(thrust::get<1>(triangle));
-            dst = *(thrust::get<2>(triangle));
-          }
-
-          return thrust::make_tuple(src, dst);
-        });
-
-      if constexpr (multi_gpu) {
-        std::tie(std::get<0>(edgelist_to_update_count),
-                 std::get<1>(edgelist_to_update_count),
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore) =
-          detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
-                                                                                         edge_t,
-                                                                                         weight_t,
-                                                                                         int32_t,
-                                                                                         int32_t>(
-            handle,
-            std::move(std::get<0>(edgelist_to_update_count)),
-            std::move(std::get<1>(edgelist_to_update_count)),
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            cur_graph_view.vertex_partition_range_lasts());
-      }
-
-      thrust::sort(handle.get_thrust_policy(),
-                   get_dataframe_buffer_begin(edgelist_to_update_count),
-                   get_dataframe_buffer_end(edgelist_to_update_count));
-
-      auto unique_pair_count =
-        thrust::unique_count(handle.get_thrust_policy(),
-                             get_dataframe_buffer_begin(edgelist_to_update_count),
-                             get_dataframe_buffer_end(edgelist_to_update_count));
-
-      auto vertex_pair_buffer_unique = allocate_dataframe_buffer<thrust::tuple<vertex_t, vertex_t>>(
-        unique_pair_count, handle.get_stream());
-
-      rmm::device_uvector<edge_t> decrease_count(unique_pair_count, handle.get_stream());
-
-      thrust::reduce_by_key(handle.get_thrust_policy(),
-                            get_dataframe_buffer_begin(edgelist_to_update_count),
-                            get_dataframe_buffer_end(edgelist_to_update_count),
-                            thrust::make_constant_iterator(size_t{1}),
-                            get_dataframe_buffer_begin(vertex_pair_buffer_unique),
-                            decrease_count.begin(),
-                            thrust::equal_to<thrust::tuple<vertex_t, vertex_t>>{});
-
-      std::tie(std::get<0>(vertex_pair_buffer_unique),
-               std::get<1>(vertex_pair_buffer_unique),
-               decrease_count) =
-        extract_transform_e(
-          handle,
-          cur_graph_view,
-          edge_src_out_degrees.view(),
-          edge_dst_out_degrees.view(),
-          edge_dummy_property_t{}.view(),
-          extract_low_to_high_degree_edges_from_endpoints_t<vertex_t, edge_t>{
-            raft::device_span<vertex_t const>(std::get<0>(vertex_pair_buffer_unique).data(),
-                                              std::get<0>(vertex_pair_buffer_unique).size()),
-            raft::device_span<vertex_t const>(std::get<1>(vertex_pair_buffer_unique).data(),
-                                              std::get<1>(vertex_pair_buffer_unique).size()),
-            raft::device_span<edge_t const>(decrease_count.data(), decrease_count.size())});
-
-      if constexpr (multi_gpu) {
-        auto& comm           = handle.get_comms();
-        auto const comm_size = comm.get_size();
-        auto& major_comm     = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
-        auto const major_comm_size = major_comm.get_size();
-        auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
-        auto const minor_comm_size        = minor_comm.get_size();
-        auto vertex_partition_range_lasts = cur_graph_view.vertex_partition_range_lasts();
-
-        rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
-          vertex_partition_range_lasts.size(), handle.get_stream());
-        raft::update_device(d_vertex_partition_range_lasts.data(),
-                            vertex_partition_range_lasts.data(),
-                            vertex_partition_range_lasts.size(),
-                            handle.get_stream());
-
-        std::forward_as_tuple(std::tie(std::get<0>(vertex_pair_buffer_unique),
-                                       std::get<1>(vertex_pair_buffer_unique),
-                                       decrease_count),
-                              std::ignore) =
-          groupby_gpu_id_and_shuffle_values(
-            handle.get_comms(),
-            thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).begin(),
-                                      std::get<1>(vertex_pair_buffer_unique).begin(),
-                                      decrease_count.begin()),
-            thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).end(),
-                                      std::get<1>(vertex_pair_buffer_unique).end(),
-                                      decrease_count.end()),
-            [key_func =
-               cugraph::detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
-                 raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
-                                                   d_vertex_partition_range_lasts.size()),
-                 comm_size,
-                 major_comm_size,
-                 minor_comm_size}] __device__(auto val) {
-              return key_func(thrust::get<0>(val), thrust::get<1>(val));
-            },
-            handle.get_stream());
-      }
-
-      thrust::sort_by_key(handle.get_thrust_policy(),
-                          get_dataframe_buffer_begin(vertex_pair_buffer_unique),
-                          get_dataframe_buffer_end(vertex_pair_buffer_unique),
-                          decrease_count.begin());
-
-      // Update count of weak edges
-      edges_to_decrement_count.clear();
-
-      edges_to_decrement_count.insert(std::get<0>(vertex_pair_buffer_unique).begin(),
-                                      std::get<0>(vertex_pair_buffer_unique).end(),
-                                      std::get<1>(vertex_pair_buffer_unique).begin());
-
-      cur_graph_view.clear_edge_mask();
-      // Check for edge existance on the directed graph view
-      cur_graph_view.attach_edge_mask(dodg_mask.view());
-
-      // Update count of weak edges from the DODG view
-      cugraph::transform_e(
-        handle,
-        cur_graph_view,
-        edges_to_decrement_count,
-        cugraph::edge_src_dummy_property_t{}.view(),
-        cugraph::edge_dst_dummy_property_t{}.view(),
-        edge_triangle_counts.view(),
-        [edge_buffer_first =
-           thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).begin(),
-                                     std::get<1>(vertex_pair_buffer_unique).begin()),
-         edge_buffer_last = thrust::make_zip_iterator(std::get<0>(vertex_pair_buffer_unique).end(),
-                                                      std::get<1>(vertex_pair_buffer_unique).end()),
-         decrease_count   = raft::device_span<edge_t>(
-           decrease_count.data(), decrease_count.size())] __device__(auto src,
-                                                                     auto dst,
-                                                                     cuda::std::nullopt_t,
-                                                                     cuda::std::nullopt_t,
-                                                                     edge_t count) {
-          auto itr_pair = thrust::lower_bound(
-            thrust::seq, edge_buffer_first, edge_buffer_last, thrust::make_tuple(src, dst));
-          auto idx_pair = thrust::distance(edge_buffer_first, itr_pair);
-          count -= decrease_count[idx_pair];
-
-          return count;
-        },
-        edge_triangle_counts.mutable_view(),
-        do_expensive_check);
-
-      edgelist_weak.clear();
-
-      thrust::sort(
-        handle.get_thrust_policy(),
-        thrust::make_zip_iterator(weak_edgelist_srcs.begin(), weak_edgelist_dsts.begin()),
-        thrust::make_zip_iterator(weak_edgelist_srcs.end(), weak_edgelist_dsts.end()));
-
-      edgelist_weak.insert(
-        weak_edgelist_srcs.begin(), weak_edgelist_srcs.end(), weak_edgelist_dsts.begin());
-
-      // Get undirected graph view
-      cur_graph_view.clear_edge_mask();
-      cur_graph_view.attach_edge_mask(weak_edges_mask.view());
-
-      auto prev_number_of_edges = cur_graph_view.compute_number_of_edges(handle);
-
-      cugraph::transform_e(
-        handle,
-        cur_graph_view,
-        edgelist_weak,
-        cugraph::edge_src_dummy_property_t{}.view(),
-        cugraph::edge_dst_dummy_property_t{}.view(),
-        cugraph::edge_dummy_property_t{}.view(),
-        [] __device__(
-          auto src, auto dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) {
-          return false;
-        },
-        weak_edges_mask.mutable_view(),
-        do_expensive_check);
-
-      edgelist_weak.clear();
-
-      // shuffle the edges if multi_gpu
-      if constexpr (multi_gpu) {
-        std::tie(weak_edgelist_dsts,
-                 weak_edgelist_srcs,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore,
-                 std::ignore) =
-          detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
-                                                                                         edge_t,
-                                                                                         weight_t,
-                                                                                         int32_t,
-                                                                                         int32_t>(
-            handle,
-            std::move(weak_edgelist_dsts),
-            std::move(weak_edgelist_srcs),
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            cur_graph_view.vertex_partition_range_lasts());
-      }
-
-      thrust::sort(
-        handle.get_thrust_policy(),
-        thrust::make_zip_iterator(weak_edgelist_dsts.begin(), weak_edgelist_srcs.begin()),
-        thrust::make_zip_iterator(weak_edgelist_dsts.end(), weak_edgelist_srcs.end()));
-
-      edgelist_weak.insert(
-        weak_edgelist_dsts.begin(), weak_edgelist_dsts.end(), weak_edgelist_srcs.begin());
-
-      cugraph::transform_e(
-        handle,
-        cur_graph_view,
-        edgelist_weak,
-        cugraph::edge_src_dummy_property_t{}.view(),
-        cugraph::edge_dst_dummy_property_t{}.view(),
-        cugraph::edge_dummy_property_t{}.view(),
-        [] __device__(
-          auto src, auto dst, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) {
-          return false;
-        },
-        weak_edges_mask.mutable_view(),
-        do_expensive_check);
-
-      cur_graph_view.attach_edge_mask(weak_edges_mask.view());
-
-      if (prev_number_of_edges == cur_graph_view.compute_number_of_edges(handle)) { break; }
-
-      cur_graph_view.clear_edge_mask();
-      cur_graph_view.attach_edge_mask(dodg_mask.view());
-    }
-
-    cur_graph_view.clear_edge_mask();
-    cur_graph_view.attach_edge_mask(dodg_mask.view());
+                            edge_src_out_degrees,
+                            edge_dst_out_degrees,
+                            weak_edges_mask,
+                            dodg_mask,
+                            edge_triangle_counts,
+                            k,
+                            do_expensive_check);
 
     cugraph::transform_e(
       handle,
@@ -754,4 +873,196 @@ k_truss(raft::handle_t const& handle,
       std::move(edgelist_srcs), std::move(edgelist_dsts), std::move(edgelist_wgts));
   }
 }
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> truss_number(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check)
+{
+  using weight_t = float;  // dummy
+
+  // 1. Check input arguments.
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: truss_number currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input arguments: truss_number currently does not support multi-graphs.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  auto cur_graph_view          = graph_view;
+  auto unmasked_cur_graph_view = cur_graph_view;
+  if (unmasked_cur_graph_view.has_edge_mask()) { unmasked_cur_graph_view.clear_edge_mask(); }
+
+  edge_property_t<decltype(cur_graph_view), edge_t> truss_numbers(handle, cur_graph_view);
+  cugraph::fill_edge_property(
+    handle, unmasked_cur_graph_view, truss_numbers.mutable_view(), edge_t{0});
+
+  // 2. Exclude self-loops (self-loops have the truss number of 0)
+
+  cugraph::edge_property_t<decltype(cur_graph_view), bool> weak_edges_mask(handle, cur_graph_view);
+  {
+    cugraph::fill_edge_property(
+      handle, unmasked_cur_graph_view, weak_edges_mask.mutable_view(), false);
+
+    transform_e(
+      handle,
+      cur_graph_view,
+      edge_src_dummy_property_t{}.view(),
+      edge_dst_dummy_property_t{}.view(),
+      edge_dummy_property_t{}.view(),
+      [] __device__(auto src, auto dst, auto, auto, auto) { return src != dst; },
+      weak_edges_mask.mutable_view());
+
+    if (cur_graph_view.has_edge_mask()) { cur_graph_view.clear_edge_mask(); }
+    cur_graph_view.attach_edge_mask(weak_edges_mask.view());
+  }
+
+  // 3. Keep only the edges from a low-degree vertex to a high-degree vertex.
+
+  edge_src_property_t<decltype(cur_graph_view), edge_t> edge_src_out_degrees(handle,
+                                                                             cur_graph_view);
+  edge_dst_property_t<decltype(cur_graph_view), edge_t> edge_dst_out_degrees(handle,
+                                                                             cur_graph_view);
+
+  cugraph::edge_property_t<decltype(cur_graph_view), bool> dodg_mask(handle, cur_graph_view);
+  {
+    auto out_degrees = cur_graph_view.compute_out_degrees(handle);
+    update_edge_src_property(
+      handle, cur_graph_view, out_degrees.begin(), edge_src_out_degrees.mutable_view());
+    update_edge_dst_property(
+      handle, cur_graph_view, out_degrees.begin(), edge_dst_out_degrees.mutable_view());
+
+    cugraph::fill_edge_property(
+      handle, unmasked_cur_graph_view, dodg_mask.mutable_view(), bool{false});
+
+    cugraph::transform_e(
+      handle,
+      cur_graph_view,
+      edge_src_out_degrees.view(),
+      edge_dst_out_degrees.view(),
+      edge_dummy_property_t{}.view(),
+      [] __device__(auto src, auto dst, auto src_out_degree, auto dst_out_degree, auto) {
+        return (src_out_degree < dst_out_degree) ? true
+               : ((src_out_degree == dst_out_degree) &&
+                  (src < dst) /* tie-breaking using vertex ID */)
+                 ? true
+                 : false;
+      },
+      dodg_mask.mutable_view(),
+      do_expensive_check);
+
+    if (cur_graph_view.has_edge_mask()) { cur_graph_view.clear_edge_mask(); }
+    cur_graph_view.attach_edge_mask(dodg_mask.view());
+  }
+
+  // 4. Compute the triangle counts once and peel the graph for k = 3, 4, ...; the DODG edges
+  // removed while peeling for k have the truss number of k - 1.
+
+  {
+    auto edge_triangle_counts =
+      edge_triangle_count<vertex_t, edge_t, multi_gpu>(handle, cur_graph_view, false);
+
+    for (edge_t k = 3;; ++k) {
+      detail::peel_weak_edges(handle,
+                              cur_graph_view,
+                              edge_src_out_degrees,
+                              edge_dst_out_degrees,
+                              weak_edges_mask,
+                              dodg_mask,
+                              edge_triangle_counts,
+                              k,
+                              do_expensive_check);
+
+      cugraph::transform_e(handle,
+                           cur_graph_view,
+                           cugraph::edge_src_dummy_property_t{}.view(),
+                           cugraph::edge_dst_dummy_property_t{}.view(),
+                           view_concat(edge_triangle_counts.view(), truss_numbers.view()),
+                           assign_truss_number_t<vertex_t, edge_t>{k},
+                           truss_numbers.mutable_view(),
+                           do_expensive_check);
+
+      auto num_unassigned_edges = count_if_e(handle,
+                                             cur_graph_view,
+                                             cugraph::edge_src_dummy_property_t{}.view(),
+                                             cugraph::edge_dst_dummy_property_t{}.view(),
+                                             truss_numbers.view(),
+                                             is_unassigned_truss_number_t<vertex_t, edge_t>{},
+                                             do_expensive_check);
+      if (num_unassigned_edges == 0) { break; }
+    }
+  }
+
+  // 5. Copy the DODG edge truss numbers to the reversed edges
+
+  {
+    auto [reversed_srcs, reversed_dsts, reversed_truss_numbers] =
+      extract_transform_e(handle,
+                          cur_graph_view,
+                          cugraph::edge_src_dummy_property_t{}.view(),
+                          cugraph::edge_dst_dummy_property_t{}.view(),
+                          truss_numbers.view(),
+                          extract_reversed_edges_with_truss_numbers_t<vertex_t, edge_t>{});
+
+    if constexpr (multi_gpu) {
+      std::optional<rmm::device_uvector<edge_t>> tmp_truss_numbers{std::nullopt};
+      std::tie(reversed_srcs,
+               reversed_dsts,
+               std::ignore,
+               tmp_truss_numbers,
+               std::ignore,
+               std::ignore,
+               std::ignore,
+               std::ignore) =
+        detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                       edge_t,
+                                                                                       weight_t,
+                                                                                       int32_t,
+                                                                                       int32_t>(
+          handle,
+          std::move(reversed_srcs),
+          std::move(reversed_dsts),
+          std::nullopt,
+          std::make_optional(std::move(reversed_truss_numbers)),
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cur_graph_view.vertex_partition_range_lasts());
+      reversed_truss_numbers = std::move(*tmp_truss_numbers);
+    }
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(reversed_srcs.begin(), reversed_dsts.begin()),
+      thrust::make_zip_iterator(reversed_srcs.end(), reversed_dsts.end()),
+      reversed_truss_numbers.begin());
+
+    cugraph::edge_bucket_t<vertex_t, void, true, multi_gpu, true> reversed_edges(handle);
+    reversed_edges.insert(reversed_srcs.begin(), reversed_srcs.end(), reversed_dsts.begin());
+
+    cugraph::transform_e(
+      handle,
+      graph_view,
+      reversed_edges,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      lookup_truss_number_t<vertex_t, edge_t>{
+        raft::device_span<vertex_t const>(reversed_srcs.data(), reversed_srcs.size()),
+        raft::device_span<vertex_t const>(reversed_dsts.data(), reversed_dsts.size()),
+        raft::device_span<edge_t const>(reversed_truss_numbers.data(),
+                                        reversed_truss_numbers.size())},
+      truss_numbers.mutable_view(),
+      do_expensive_check);
+  }
+
+  return truss_numbers;
+}
+
 }  // namespace cugraph
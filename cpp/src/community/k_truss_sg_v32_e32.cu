@@ -38,4 +38,9 @@ k_truss(raft::handle_t const& handle,
         int32_t k,
         bool do_expensive_check);
 
+template edge_property_t<graph_view_t<int32_t, int32_t, false, false>, int32_t> truss_number(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  bool do_expensive_check);
+
 }  // namespace cugraph
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/fill_edge_property.cuh"
+#include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/kv_store.cuh"
+#include "prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// (label, aggregated edge weight, label size (0 for the vertex's current label), priority)
+template <typename vertex_t, typename weight_t>
+using label_score_t = thrust::tuple<vertex_t, weight_t, vertex_t, uint32_t>;
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct label_score_op_t {
+  uint32_t seed{};
+
+  __device__ label_score_t<vertex_t, weight_t> operator()(
+    vertex_t src, vertex_t label, vertex_t src_label, vertex_t label_size, weight_t weight) const
+  {
+    // pseudo-random priority (differs per vertex and per step) to break the remaining ties
+    cuco::murmurhash3_32<vertex_t> src_hash_func{seed};
+    cuco::murmurhash3_32<vertex_t> label_hash_func{src_hash_func(src)};
+    return thrust::make_tuple(label,
+                              weight,
+                              label == src_label ? vertex_t{0} : label_size,
+                              static_cast<uint32_t>(label_hash_func(label)));
+  }
+};
+
+// Select the label with the largest aggregated edge weight. Ties are broken in favor of the
+// vertex's current label (to avoid needless oscillation), then the smaller label (to slow down the
+// growth of a few dominant labels), then the larger pseudo-random priority.
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct label_select_op_t {
+  using type                          = label_score_t<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;  // this can be called from any process
+  inline static type const identity_element =
+    thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                       std::numeric_limits<weight_t>::lowest(),
+                       std::numeric_limits<vertex_t>::max(),
+                       uint32_t{0});
+
+  __device__ type operator()(type lhs, type rhs) const
+  {
+    if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs) ? lhs : rhs;
+    }
+    if (thrust::get<2>(lhs) != thrust::get<2>(rhs)) {
+      return thrust::get<2>(lhs) < thrust::get<2>(rhs) ? lhs : rhs;
+    }
+    if (thrust::get<3>(lhs) != thrust::get<3>(rhs)) {
+      return thrust::get<3>(lhs) > thrust::get<3>(rhs) ? lhs : rhs;
+    }
+    return thrust::get<0>(lhs) <= thrust::get<0>(rhs) ? lhs : rhs;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_label_propagation_src_flag_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, bool src_flag, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return src_flag;
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct return_label_propagation_nbr_t {
+  __device__ cuda::std::optional<std::byte> operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return std::byte{0};
+  }
+};
+
+// the number of vertices per label, (label, size) pairs are stored in the GPU that owns the label
+// (the label is mapped to a GPU in the same way as an external vertex ID) in multi-GPU
+template <typename vertex_t, bool multi_gpu>
+kv_store_t<vertex_t, vertex_t, true> compute_label_sizes(raft::handle_t const& handle,
+                                                         raft::device_span<vertex_t const> labels)
+{
+  rmm::device_uvector<vertex_t> keys(labels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> sizes(labels.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), keys.begin());
+
+  auto reduce_by_label = [&handle](rmm::device_uvector<vertex_t>& keys,
+                                   rmm::device_uvector<vertex_t>& sizes,
+                                   bool initial) {
+    rmm::device_uvector<vertex_t> tmp_keys(keys.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> tmp_sizes(keys.size(), handle.get_stream());
+    size_t num_uniques{};
+    if (initial) {
+      thrust::sort(handle.get_thrust_policy(), keys.begin(), keys.end());
+      auto last   = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                          keys.begin(),
+                                          keys.end(),
+                                          thrust::make_constant_iterator(vertex_t{1}),
+                                          tmp_keys.begin(),
+                                          tmp_sizes.begin());
+      num_uniques = static_cast<size_t>(thrust::distance(tmp_keys.begin(), last.first));
+    } else {
+      thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), sizes.begin());
+      auto last   = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                          keys.begin(),
+                                          keys.end(),
+                                          sizes.begin(),
+                                          tmp_keys.begin(),
+                                          tmp_sizes.begin());
+      num_uniques = static_cast<size_t>(thrust::distance(tmp_keys.begin(), last.first));
+    }
+    tmp_keys.resize(num_uniques, handle.get_stream());
+    tmp_sizes.resize(num_uniques, handle.get_stream());
+    keys  = std::move(tmp_keys);
+    sizes = std::move(tmp_sizes);
+  };
+
+  reduce_by_label(keys, sizes, true);
+  if constexpr (multi_gpu) {
+    std::tie(keys, sizes) =
+      shuffle_ext_vertex_value_pairs_to_local_gpu_by_vertex_partitioning<vertex_t, vertex_t>(
+        handle, std::move(keys), std::move(sizes));
+    reduce_by_label(keys, sizes, false);
+  }
+
+  return kv_store_t<vertex_t, vertex_t, true>(std::move(keys),
+                                              std::move(sizes),
+                                              invalid_vertex_id<vertex_t>::value,
+                                              true,
+                                              handle.get_stream());
+}
+
+// Every sweep updates the active vertices one color class at a time (only a single class that
+// covers every vertex in the synchronous mode), a vertex is (re-)activated when one of its
+// neighbors changes its label.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t> labels,
+  bool warm_start,
+  bool semi_synchronous,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: label propagation requires a symmetric graph.");
+  CUGRAPH_EXPECTS(
+    labels.size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input argument: labels.size() should coincide with the local vertex partition range "
+    "size.");
+
+  if (warm_start && do_expensive_check) {
+    auto num_invalids = static_cast<size_t>(thrust::count(handle.get_thrust_policy(),
+                                                          labels.begin(),
+                                                          labels.end(),
+                                                          invalid_vertex_id<vertex_t>::value));
+    if constexpr (multi_gpu) {
+      num_invalids = host_scalar_allreduce(
+        handle.get_comms(), num_invalids, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input argument: labels should not include invalid_vertex_id.");
+  }
+
+  auto const v_first = graph_view.local_vertex_partition_range_first();
+
+  if (!warm_start) {
+    thrust::sequence(handle.get_thrust_policy(), labels.begin(), labels.end(), v_first);
+  }
+
+  edge_property_t<GraphViewType, weight_t> unit_edge_weights(handle);
+  if (!edge_weight_view) {
+    unit_edge_weights = edge_property_t<GraphViewType, weight_t>(handle, graph_view);
+    fill_edge_property(handle, graph_view, unit_edge_weights.mutable_view(), weight_t{1});
+  }
+  auto weight_view = edge_weight_view ? *edge_weight_view : unit_edge_weights.view();
+
+  // 1. the color classes to update one at a time
+
+  std::optional<rmm::device_uvector<vertex_t>> colors{std::nullopt};
+  vertex_t num_colors{1};
+  if (semi_synchronous) {
+    colors = vertex_coloring(
+      handle, graph_view, rng_state, vertex_coloring_method_t::speculative_first_fit);
+    num_colors = thrust::reduce(handle.get_thrust_policy(),
+                                (*colors).begin(),
+                                (*colors).end(),
+                                vertex_t{0},
+                                thrust::maximum<vertex_t>{}) +
+                 vertex_t{1};
+    if constexpr (multi_gpu) {
+      num_colors = host_scalar_allreduce(
+        handle.get_comms(), num_colors, raft::comms::op_t::MAX, handle.get_stream());
+    }
+  }
+
+  // 2. label caches for the edge sources (the vertex's current label) and destinations (keys)
+
+  edge_src_property_t<GraphViewType, vertex_t> src_labels(handle);
+  edge_dst_property_t<GraphViewType, vertex_t> dst_labels(handle);
+  if constexpr (multi_gpu) {
+    src_labels = edge_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    dst_labels = edge_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    update_edge_src_property(handle, graph_view, labels.begin(), src_labels.mutable_view());
+    update_edge_dst_property(handle, graph_view, labels.begin(), dst_labels.mutable_view());
+  }
+
+  rmm::device_uvector<int32_t> d_seed(1, handle.get_stream());
+  detail::uniform_random_fill(handle.get_stream(),
+                              d_seed.data(),
+                              d_seed.size(),
+                              int32_t{0},
+                              std::numeric_limits<int32_t>::max(),
+                              rng_state);
+  int32_t base_seed{};
+  raft::update_host(&base_seed, d_seed.data(), size_t{1}, handle.get_stream());
+  handle.sync_stream();
+
+  // 3. iterate till no vertex changes its label (or max_iterations sweeps)
+
+  rmm::device_uvector<bool> active_flags(labels.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), active_flags.begin(), active_flags.end(), true);
+
+  auto output_buffer = allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(
+    labels.size(), handle.get_stream());
+
+  size_t iter{0};
+  size_t step{0};
+  while (iter < max_iterations) {
+    auto num_active = static_cast<size_t>(
+      thrust::count(handle.get_thrust_policy(), active_flags.begin(), active_flags.end(), true));
+    if constexpr (multi_gpu) {
+      num_active = host_scalar_allreduce(
+        handle.get_comms(), num_active, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_active == 0) { break; }
+
+    for (vertex_t color = 0; color < num_colors; ++color) {
+      rmm::device_uvector<vertex_t> step_vertices(labels.size(), handle.get_stream());
+      step_vertices.resize(
+        thrust::distance(
+          step_vertices.begin(),
+          thrust::copy_if(
+            handle.get_thrust_policy(),
+            thrust::make_counting_iterator(v_first),
+            thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+            step_vertices.begin(),
+            [active_flags  = active_flags.data(),
+             vertex_colors = colors ? (*colors).data() : static_cast<vertex_t const*>(nullptr),
+             color,
+             v_first] __device__(vertex_t v) {
+              auto v_offset = v - v_first;
+              return active_flags[v_offset] &&
+                     ((vertex_colors == nullptr) || (vertex_colors[v_offset] == color));
+            })),
+        handle.get_stream());
+      auto num_step_vertices = step_vertices.size();
+      if constexpr (multi_gpu) {
+        num_step_vertices = host_scalar_allreduce(
+          handle.get_comms(), num_step_vertices, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_step_vertices == 0) { continue; }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        step_vertices.begin(),
+        step_vertices.end(),
+        [active_flags = active_flags.data(), v_first] __device__(vertex_t v) {
+          active_flags[v - v_first] = false;
+        });
+
+      // only the out-going edges of this step's vertices take part in the key aggregation
+
+      auto step_graph_view = graph_view;
+      edge_property_t<GraphViewType, bool> step_edge_mask(handle);
+      if (num_step_vertices < static_cast<size_t>(graph_view.number_of_vertices())) {
+        edge_src_property_t<GraphViewType, bool> src_step_flags(handle, graph_view);
+        fill_edge_src_property(handle, graph_view, src_step_flags.mutable_view(), false);
+        fill_edge_src_property(handle,
+                               graph_view,
+                               step_vertices.begin(),
+                               step_vertices.end(),
+                               src_step_flags.mutable_view(),
+                               true);
+        step_edge_mask = edge_property_t<GraphViewType, bool>(handle, graph_view);
+        transform_e(handle,
+                    graph_view,
+                    src_step_flags.view(),
+                    edge_dst_dummy_property_t{}.view(),
+                    edge_dummy_property_t{}.view(),
+                    return_label_propagation_src_flag_t<vertex_t>{},
+                    step_edge_mask.mutable_view());
+        step_graph_view.attach_edge_mask(step_edge_mask.view());
+      }
+
+      auto label_sizes = compute_label_sizes<vertex_t, multi_gpu>(
+        handle, raft::device_span<vertex_t const>(labels.data(), labels.size()));
+
+      per_v_transform_reduce_dst_key_aggregated_outgoing_e(
+        handle,
+        step_graph_view,
+        multi_gpu
+          ? src_labels.view()
+          : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(labels.data()),
+        weight_view,
+        multi_gpu ? dst_labels.view()
+                  : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(labels.data(),
+                                                                                  vertex_t{0}),
+        label_sizes.view(),
+        label_score_op_t<vertex_t, weight_t>{
+          static_cast<uint32_t>(base_seed) ^ static_cast<uint32_t>(step)},
+        label_select_op_t<vertex_t, weight_t>::identity_element,
+        label_select_op_t<vertex_t, weight_t>{},
+        get_dataframe_buffer_begin(output_buffer));
+      ++step;
+
+      // vertices without (unmasked) out-going edges get the identity element and keep their labels
+
+      rmm::device_uvector<vertex_t> changed_vertices(step_vertices.size(), handle.get_stream());
+      changed_vertices.resize(
+        thrust::distance(
+          changed_vertices.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          step_vertices.begin(),
+                          step_vertices.end(),
+                          changed_vertices.begin(),
+                          [labels        = labels.data(),
+                           output_labels = std::get<0>(output_buffer).data(),
+                           v_first] __device__(vertex_t v) {
+                            auto new_label = output_labels[v - v_first];
+                            return (new_label != invalid_vertex_id<vertex_t>::value) &&
+                                   (new_label != labels[v - v_first]);
+                          })),
+        handle.get_stream());
+      thrust::for_each(handle.get_thrust_policy(),
+                       changed_vertices.begin(),
+                       changed_vertices.end(),
+                       [labels        = labels.data(),
+                        output_labels = std::get<0>(output_buffer).data(),
+                        v_first] __device__(vertex_t v) {
+                         labels[v - v_first] = output_labels[v - v_first];
+                       });
+
+      auto num_changed = changed_vertices.size();
+      if constexpr (multi_gpu) {
+        num_changed = host_scalar_allreduce(
+          handle.get_comms(), num_changed, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_changed == 0) { continue; }
+
+      if constexpr (multi_gpu) {
+        update_edge_src_property(handle,
+                                 graph_view,
+                                 changed_vertices.begin(),
+                                 changed_vertices.end(),
+                                 labels.begin(),
+                                 src_labels.mutable_view());
+        update_edge_dst_property(handle,
+                                 graph_view,
+                                 changed_vertices.begin(),
+                                 changed_vertices.end(),
+                                 labels.begin(),
+                                 dst_labels.mutable_view());
+      }
+
+      key_bucket_t<vertex_t, void, multi_gpu, true> changed_vertex_bucket(
+        handle,
+        raft::device_span<vertex_t const>(changed_vertices.data(), changed_vertices.size()));
+      auto changed_vertex_nbrs =
+        transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                      graph_view,
+                                                      changed_vertex_bucket,
+                                                      edge_src_dummy_property_t{}.view(),
+                                                      edge_dst_dummy_property_t{}.view(),
+                                                      edge_dummy_property_t{}.view(),
+                                                      return_label_propagation_nbr_t<vertex_t>{},
+                                                      reduce_op::null());
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        changed_vertex_nbrs.begin(),
+        changed_vertex_nbrs.end(),
+        [active_flags = active_flags.data(), v_first] __device__(vertex_t v) {
+          active_flags[v - v_first] = true;
+        });
+    }
+
+    ++iter;
+  }
+
+  return iter;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t> labels,
+  bool warm_start,
+  bool semi_synchronous,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::label_propagation(handle,
+                                   rng_state,
+                                   graph_view,
+                                   edge_weight_view,
+                                   labels,
+                                   warm_start,
+                                   semi_synchronous,
+                                   max_iterations,
+                                   do_expensive_check);
+}
+
+}  // namespace cugraph
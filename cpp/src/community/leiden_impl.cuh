@@ -19,14 +19,21 @@
 #include "community/detail/refine.hpp"
 #include "community/flatten_dendrogram.hpp"
 #include "prims/update_edge_src_dst_property.cuh"
+#include "utilities/collect_comm.cuh"
 
+#include <cugraph/algorithms.hpp>
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph.hpp>
+#include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
 
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/gather.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
 #include <thrust/sort.h>
 #include <thrust/unique.h>
 
@@ -84,7 +91,15 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   size_t max_level,
   weight_t resolution,
-  weight_t theta = 1.0)
+  weight_t theta               = 1.0,
+  bool prune_inactive_vertices = false,
+  std::optional<raft::device_span<vertex_t>> flattened_clustering = std::nullopt,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options =
+    clustering_checkpoint_options_t<vertex_t, weight_t>{},
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state = std::nullopt,
+  std::optional<raft::device_span<vertex_t const>> initial_clustering          = std::nullopt,
+  leiden_refinement_method_t refinement_method =
+    leiden_refinement_method_t::maximal_independent_moves)
 {
   using graph_t      = cugraph::graph_t<vertex_t, edge_t, store_transposed, multi_gpu>;
   using graph_view_t = cugraph::graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
@@ -109,7 +124,106 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
 
   rmm::device_uvector<vertex_t> louvain_of_refined_graph(0, handle.get_stream());  // #V
 
-  while (dendrogram->num_levels() < max_level) {
+  CUGRAPH_EXPECTS(!resume_state || !initial_clustering,
+                  "Invalid input argument: resume_state and initial_clustering are exclusive.");
+
+  // An initial clustering (warm start) seeds the Louvain clustering of the first level
+  if (initial_clustering) {
+    louvain_of_refined_graph =
+      detail::normalize_initial_clustering(handle, graph_view, *initial_clustering);
+  }
+
+  // If flattened_clustering is set, each level is folded into the level-0 labels once it is final
+  // and its device memory is released. The folded labels (mapping the input graph vertices to the
+  // current graph vertices) and the Louvain clustering of the current graph are the state
+  // checkpointed after each level.
+  size_t num_resumed_levels{0};
+  if (flattened_clustering) {
+    if (resume_state) {
+      raft::copy((*flattened_clustering).data(),
+                 (*resume_state).clustering.data(),
+                 (*resume_state).clustering.size(),
+                 handle.get_stream());
+      rmm::device_uvector<vertex_t> louvain_of_vertices((*resume_state).louvain_clustering->size(),
+                                                        handle.get_stream());
+      raft::copy(louvain_of_vertices.data(),
+                 (*resume_state).louvain_clustering->data(),
+                 (*resume_state).louvain_clustering->size(),
+                 handle.get_stream());
+
+      // re-derive the checkpointed level's graph and relabel both clusterings to its vertex IDs
+      std::optional<rmm::device_uvector<vertex_t>> numbering_map{std::nullopt};
+      std::tie(coarse_graph, coarsen_graph_edge_weight, numbering_map) =
+        coarsen_graph(handle,
+                      current_graph_view,
+                      current_edge_weight_view,
+                      (*flattened_clustering).data(),
+                      true);
+      current_graph_view = coarse_graph.view();
+
+      current_edge_weight_view = std::make_optional<edge_property_view_t<edge_t, weight_t const*>>(
+        (*coarsen_graph_edge_weight).view());
+
+      rmm::device_uvector<vertex_t> numeric_sequence(
+        current_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+      detail::sequence_fill(handle.get_stream(),
+                            numeric_sequence.data(),
+                            numeric_sequence.size(),
+                            current_graph_view.local_vertex_partition_range_first());
+      relabel<vertex_t, multi_gpu>(
+        handle,
+        std::make_tuple(static_cast<vertex_t const*>((*numbering_map).begin()),
+                        static_cast<vertex_t const*>(numeric_sequence.begin())),
+        (*numbering_map).size(),
+        (*flattened_clustering).data(),
+        (*flattened_clustering).size(),
+        false);
+      relabel<vertex_t, multi_gpu>(
+        handle,
+        std::make_tuple(static_cast<vertex_t const*>((*numbering_map).begin()),
+                        static_cast<vertex_t const*>(numeric_sequence.begin())),
+        (*numbering_map).size(),
+        louvain_of_vertices.data(),
+        louvain_of_vertices.size(),
+        false);
+
+      // every input graph vertex in a coarsened graph vertex carries the same Louvain cluster
+      rmm::device_uvector<vertex_t> coarse_vertices((*flattened_clustering).size(),
+                                                    handle.get_stream());
+      raft::copy(coarse_vertices.data(),
+                 (*flattened_clustering).data(),
+                 (*flattened_clustering).size(),
+                 handle.get_stream());
+      if constexpr (multi_gpu) {
+        std::tie(coarse_vertices, louvain_of_vertices) =
+          shuffle_int_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+            handle,
+            std::move(coarse_vertices),
+            std::move(louvain_of_vertices),
+            current_graph_view.vertex_partition_range_lasts());
+      }
+      louvain_of_refined_graph.resize(current_graph_view.local_vertex_partition_range_size(),
+                                      handle.get_stream());
+      thrust::scatter(
+        handle.get_thrust_policy(),
+        louvain_of_vertices.begin(),
+        louvain_of_vertices.end(),
+        thrust::make_transform_iterator(
+          coarse_vertices.begin(),
+          shift_left_t<vertex_t>{current_graph_view.local_vertex_partition_range_first()}),
+        louvain_of_refined_graph.begin());
+
+      final_Q            = (*resume_state).modularity;
+      num_resumed_levels = (*resume_state).num_levels;
+    } else {
+      detail::sequence_fill(handle.get_stream(),
+                            (*flattened_clustering).data(),
+                            (*flattened_clustering).size(),
+                            graph_view.local_vertex_partition_range_first());
+    }
+  }
+
+  while (num_resumed_levels + dendrogram->num_levels() < max_level) {
     //
     //  Initialize every cluster to reference each vertex to itself
     //
@@ -131,7 +245,7 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
     rmm::device_uvector<vertex_t> cluster_keys(0, handle.get_stream());
     rmm::device_uvector<weight_t> cluster_weights(0, handle.get_stream());
 
-    if (dendrogram->num_levels() == 1) {
+    if ((dendrogram->num_levels() == 1) && (num_resumed_levels == 0) && !initial_clustering) {
       cluster_keys.resize(vertex_weights.size(), handle.get_stream());
       cluster_weights.resize(vertex_weights.size(), handle.get_stream());
 
@@ -277,12 +391,20 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
                                dst_louvain_assignment_cache.mutable_view());
     }
 
+    // The per-vertex intra-cluster weight sums serve both the modularity of the current clustering
+    // and the next round of vertex moves, so each inner iteration needs only one such edge pass.
+    auto [old_cluster_sum_v, cluster_subtract_v] =
+      detail::compute_cluster_sum_and_subtract(handle,
+                                               current_graph_view,
+                                               current_edge_weight_view,
+                                               louvain_assignment_for_vertices,
+                                               src_louvain_assignment_cache,
+                                               dst_louvain_assignment_cache);
+
     weight_t new_Q = detail::compute_modularity(handle,
                                                 current_graph_view,
-                                                current_edge_weight_view,
-                                                src_louvain_assignment_cache,
-                                                dst_louvain_assignment_cache,
-                                                louvain_assignment_for_vertices,
+                                                old_cluster_sum_v,
+                                                cluster_subtract_v,
                                                 cluster_weights,
                                                 total_edge_weight,
                                                 resolution);
@@ -292,6 +414,19 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
     // we will only allow vertices to move up (true) or down (false)
     // during each iteration of the loop
     bool up_down = true;
+
+    // With pruning, only the vertices whose neighborhood changed are re-evaluated (every vertex is
+    // active in the first iteration of each level)
+    std::optional<rmm::device_uvector<vertex_t>> active_vertices{std::nullopt};
+    if (prune_inactive_vertices) {
+      active_vertices = rmm::device_uvector<vertex_t>(
+        current_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+      detail::sequence_fill(handle.get_stream(),
+                            (*active_vertices).begin(),
+                            (*active_vertices).size(),
+                            current_graph_view.local_vertex_partition_range_first());
+    }
+
     while (new_Q > (cur_Q + 1e-4)) {
       cur_Q = new_Q;
 
@@ -312,7 +447,7 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
       // IMPORTANT NOTE: Need to think which vertices are considered first
       //
 
-      louvain_assignment_for_vertices =
+      std::tie(louvain_assignment_for_vertices, active_vertices) =
         detail::update_clustering_by_delta_modularity(handle,
                                                       current_graph_view,
                                                       current_edge_weight_view,
@@ -322,10 +457,13 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
                                                       std::move(cluster_keys),
                                                       std::move(cluster_weights),
                                                       std::move(louvain_assignment_for_vertices),
+                                                      std::move(old_cluster_sum_v),
+                                                      std::move(cluster_subtract_v),
                                                       src_vertex_weights_cache,
                                                       src_louvain_assignment_cache,
                                                       dst_louvain_assignment_cache,
-                                                      up_down);
+                                                      up_down,
+                                                      std::move(active_vertices));
 
       if constexpr (graph_view_t::is_multi_gpu) {
         update_edge_src_property(handle,
@@ -347,12 +485,18 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
 
       up_down = !up_down;
 
+      std::tie(old_cluster_sum_v, cluster_subtract_v) =
+        detail::compute_cluster_sum_and_subtract(handle,
+                                                 current_graph_view,
+                                                 current_edge_weight_view,
+                                                 louvain_assignment_for_vertices,
+                                                 src_louvain_assignment_cache,
+                                                 dst_louvain_assignment_cache);
+
       new_Q = detail::compute_modularity(handle,
                                          current_graph_view,
-                                         current_edge_weight_view,
-                                         src_louvain_assignment_cache,
-                                         dst_louvain_assignment_cache,
-                                         louvain_assignment_for_vertices,
+                                         old_cluster_sum_v,
+                                         cluster_subtract_v,
                                          cluster_weights,
                                          total_edge_weight,
                                          resolution);
@@ -423,7 +567,8 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
                                   std::move(louvain_assignment_for_vertices),
                                   src_vertex_weights_cache,
                                   src_louvain_assignment_cache,
-                                  dst_louvain_assignment_cache);
+                                  dst_louvain_assignment_cache,
+                                  refinement_method);
     }
 
     // Clear buffer and contract the graph
@@ -462,6 +607,25 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
       terminate = terminate || (nr_unique_leiden == current_graph_view.number_of_vertices());
 
       if (nr_unique_leiden < current_graph_view.number_of_vertices()) {
+        if constexpr (multi_gpu) {
+          // the coarsened graph places each coarse vertex in the GPU owning its cluster ID
+          if (get_cluster_placement_hint(handle) == cluster_placement_t::majority) {
+            auto [old_clusters, new_clusters] =
+              relabel_clusters_to_majority_gpus<vertex_t, multi_gpu>(
+                handle,
+                raft::device_span<vertex_t>(refined_leiden_partition.data(),
+                                            refined_leiden_partition.size()));
+            relabel<vertex_t, multi_gpu>(
+              handle,
+              std::make_tuple(static_cast<vertex_t const*>(old_clusters.data()),
+                              static_cast<vertex_t const*>(new_clusters.data())),
+              static_cast<vertex_t>(old_clusters.size()),
+              leiden_to_louvain_map.first.data(),
+              static_cast<vertex_t>(leiden_to_louvain_map.first.size()),
+              true);
+          }
+        }
+
         // Create aggregate graph based on refined (leiden) partition
         std::optional<rmm::device_uvector<vertex_t>> numbering_map{std::nullopt};
         std::tie(coarse_graph, coarsen_graph_edge_weight, numbering_map) =
@@ -583,6 +747,55 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
     copied_louvain_partition.resize(0, handle.get_stream());
     copied_louvain_partition.shrink_to_fit(handle.get_stream());
 
+    if (flattened_clustering) {
+      fold_level_into_partition<vertex_t, multi_gpu>(
+        handle,
+        *dendrogram,
+        dendrogram->current_level(),
+        (*flattened_clustering).data(),
+        static_cast<vertex_t>((*flattened_clustering).size()));
+      dendrogram->release_level(dendrogram->current_level(), handle.get_stream());
+
+      auto num_levels = num_resumed_levels + dendrogram->num_levels();
+      if (!terminate && checkpoint_options.callback &&
+          (num_levels % checkpoint_options.level_interval == 0)) {
+        rmm::device_uvector<vertex_t> louvain_of_vertices((*flattened_clustering).size(),
+                                                          handle.get_stream());
+        if constexpr (multi_gpu) {
+          louvain_of_vertices = collect_values_for_int_vertices(
+            handle.get_comms(),
+            (*flattened_clustering).begin(),
+            (*flattened_clustering).end(),
+            louvain_of_refined_graph.begin(),
+            current_graph_view.vertex_partition_range_lasts(),
+            current_graph_view.local_vertex_partition_range_first(),
+            handle.get_stream());
+        } else {
+          thrust::gather(handle.get_thrust_policy(),
+                         (*flattened_clustering).begin(),
+                         (*flattened_clustering).end(),
+                         louvain_of_refined_graph.begin(),
+                         louvain_of_vertices.begin());
+        }
+        checkpoint_options.callback(clustering_checkpoint_view_t<vertex_t, weight_t>{
+          num_levels,
+          final_Q,
+          raft::device_span<vertex_t const>{(*flattened_clustering).data(),
+                                            (*flattened_clustering).size()},
+          std::make_optional<raft::device_span<vertex_t const>>(louvain_of_vertices.data(),
+                                                                louvain_of_vertices.size())});
+      }
+    }
+
+    if (!terminate) {
+      iteration_progress_t progress{};
+      progress.algorithm     = "leiden";
+      progress.iteration     = num_resumed_levels + dendrogram->num_levels();
+      progress.modularity    = static_cast<double>(final_Q);
+      progress.frontier_size = static_cast<size_t>(current_graph_view.number_of_vertices());
+      terminate              = detail::report_progress(handle, progress, multi_gpu);
+    }
+
     if (terminate) { break; }
 
 #ifdef TIMING
@@ -664,12 +877,19 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> leiden(
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   size_t max_level,
   weight_t resolution,
-  weight_t theta = 1.0)
+  weight_t theta               = 1.0,
+  bool prune_inactive_vertices = false)
 {
   CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
 
-  return detail::leiden(
-    handle, rng_state, graph_view, edge_weight_view, max_level, resolution, theta);
+  return detail::leiden(handle,
+                        rng_state,
+                        graph_view,
+                        edge_weight_view,
+                        max_level,
+                        resolution,
+                        theta,
+                        prune_inactive_vertices);
 }
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -692,7 +912,8 @@ std::pair<size_t, weight_t> leiden(
   vertex_t* clustering,
   size_t max_level,
   weight_t resolution,
-  weight_t theta = 1.0)
+  weight_t theta               = 1.0,
+  bool prune_inactive_vertices = false)
 {
   CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
 
@@ -702,8 +923,14 @@ std::pair<size_t, weight_t> leiden(
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
   weight_t modularity;
 
-  std::tie(dendrogram, modularity) =
-    detail::leiden(handle, rng_state, graph_view, edge_weight_view, max_level, resolution, theta);
+  std::tie(dendrogram, modularity) = detail::leiden(handle,
+                                                    rng_state,
+                                                    graph_view,
+                                                    edge_weight_view,
+                                                    max_level,
+                                                    resolution,
+                                                    theta,
+                                                    prune_inactive_vertices);
 
   detail::flatten_leiden_dendrogram(handle, graph_view, *dendrogram, clustering);
 
@@ -721,4 +948,171 @@ std::pair<size_t, weight_t> leiden(
   return std::make_pair(dendrogram->num_levels(), modularity);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> leiden(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t resolution,
+  weight_t theta,
+  bool prune_inactive_vertices,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options,
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  detail::check_clustering(graph_view, clustering);
+  CUGRAPH_EXPECTS(
+    !checkpoint_options.callback || (checkpoint_options.level_interval > 0),
+    "Invalid input argument: checkpoint_options.level_interval should be positive.");
+
+  size_t local_num_verts = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+  if (resume_state) {
+    CUGRAPH_EXPECTS((*resume_state).louvain_clustering.has_value(),
+                    "Invalid input argument: resume_state.louvain_clustering should be set.");
+    CUGRAPH_EXPECTS(((*resume_state).clustering.size() == local_num_verts) &&
+                      ((*resume_state).louvain_clustering->size() == local_num_verts),
+                    "Invalid input argument: resume_state clustering sizes do not match with the "
+                    "local vertex partition range size.");
+  }
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) =
+    detail::leiden(handle,
+                   rng_state,
+                   graph_view,
+                   edge_weight_view,
+                   max_level,
+                   resolution,
+                   theta,
+                   prune_inactive_vertices,
+                   std::make_optional<raft::device_span<vertex_t>>(clustering, local_num_verts),
+                   checkpoint_options,
+                   resume_state);
+
+  rmm::device_uvector<vertex_t> unique_cluster_ids(local_num_verts, handle.get_stream());
+
+  thrust::copy(handle.get_thrust_policy(),
+               clustering,
+               clustering + local_num_verts,
+               unique_cluster_ids.begin());
+
+  detail::relabel_cluster_ids<vertex_t, multi_gpu>(
+    handle, unique_cluster_ids, clustering, local_num_verts);
+
+  return std::make_pair((resume_state ? (*resume_state).num_levels : size_t{0}) +
+                          dendrogram->num_levels(),
+                        modularity);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> leiden(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> initial_clustering,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t resolution,
+  weight_t theta,
+  bool prune_inactive_vertices)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  detail::check_clustering(graph_view, clustering);
+
+  size_t local_num_verts = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) =
+    detail::leiden(handle,
+                   rng_state,
+                   graph_view,
+                   edge_weight_view,
+                   max_level,
+                   resolution,
+                   theta,
+                   prune_inactive_vertices,
+                   std::make_optional<raft::device_span<vertex_t>>(clustering, local_num_verts),
+                   clustering_checkpoint_options_t<vertex_t, weight_t>{},
+                   std::nullopt,
+                   std::make_optional(initial_clustering));
+
+  rmm::device_uvector<vertex_t> unique_cluster_ids(local_num_verts, handle.get_stream());
+
+  thrust::copy(handle.get_thrust_policy(),
+               clustering,
+               clustering + local_num_verts,
+               unique_cluster_ids.begin());
+
+  detail::relabel_cluster_ids<vertex_t, multi_gpu>(
+    handle, unique_cluster_ids, clustering, local_num_verts);
+
+  return std::make_pair(dendrogram->num_levels(), modularity);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> leiden(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t resolution,
+  weight_t theta,
+  bool prune_inactive_vertices,
+  leiden_refinement_method_t refinement_method)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  detail::check_clustering(graph_view, clustering);
+  CUGRAPH_EXPECTS((refinement_method != leiden_refinement_method_t::color_classes) ||
+                    graph_view.is_symmetric(),
+                  "Invalid input argument: color_classes refinement requires a symmetric graph.");
+
+  size_t local_num_verts = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) =
+    detail::leiden(handle,
+                   rng_state,
+                   graph_view,
+                   edge_weight_view,
+                   max_level,
+                   resolution,
+                   theta,
+                   prune_inactive_vertices,
+                   std::make_optional<raft::device_span<vertex_t>>(clustering, local_num_verts),
+                   clustering_checkpoint_options_t<vertex_t, weight_t>{},
+                   std::nullopt,
+                   std::nullopt,
+                   refinement_method);
+
+  rmm::device_uvector<vertex_t> unique_cluster_ids(local_num_verts, handle.get_stream());
+
+  thrust::copy(handle.get_thrust_policy(),
+               clustering,
+               clustering + local_num_verts,
+               unique_cluster_ids.begin());
+
+  detail::relabel_cluster_ids<vertex_t, multi_gpu>(
+    handle, unique_cluster_ids, clustering, local_num_verts);
+
+  return std::make_pair(dendrogram->num_levels(), modularity);
+}
+
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,7 +27,8 @@ template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> leiden(
   std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
   size_t max_level,
   float resolution,
-  float theta);
+  float theta,
+  bool prune_inactive_vertices);
 
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> leiden(
   raft::handle_t const& handle,
@@ -36,7 +37,8 @@ template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> leiden(
   std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
   size_t max_level,
   double resolution,
-  double theta);
+  double theta,
+  bool prune_inactive_vertices);
 
 template std::pair<size_t, float> leiden(raft::handle_t const&,
                                          raft::random::RngState&,
@@ -45,7 +47,78 @@ template std::pair<size_t, float> leiden(raft::handle_t const&,
                                          int32_t*,
                                          size_t,
                                          float,
-                                         float);
+                                         float,
+                                         bool);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  int32_t*,
+  size_t,
+  double,
+  double,
+  bool);
+
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  int32_t*,
+  size_t,
+  float,
+  float,
+  bool,
+  clustering_checkpoint_options_t<int32_t, float> const&,
+  std::optional<clustering_checkpoint_view_t<int32_t, float>>);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  int32_t*,
+  size_t,
+  double,
+  double,
+  bool,
+  clustering_checkpoint_options_t<int32_t, double> const&,
+  std::optional<clustering_checkpoint_view_t<int32_t, double>>);
+
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  raft::device_span<int32_t const>,
+  int32_t*,
+  size_t,
+  float,
+  float,
+  bool);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  raft::device_span<int32_t const>,
+  int32_t*,
+  size_t,
+  double,
+  double,
+  bool);
+
+template std::pair<size_t, float> leiden(
+  raft::handle_t const&,
+  raft::random::RngState&,
+  graph_view_t<int32_t, int32_t, false, false> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  int32_t*,
+  size_t,
+  float,
+  float,
+  bool,
+  leiden_refinement_method_t);
 template std::pair<size_t, double> leiden(
   raft::handle_t const&,
   raft::random::RngState&,
@@ -54,5 +127,8 @@ template std::pair<size_t, double> leiden(
   int32_t*,
   size_t,
   double,
-  double);
+  double,
+  bool,
+  leiden_refinement_method_t);
+
 }  // namespace cugraph
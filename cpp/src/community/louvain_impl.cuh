@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
 
 #include <raft/random/rng_state.hpp>
 
@@ -53,12 +54,20 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   size_t max_level,
   weight_t threshold,
-  weight_t resolution)
+  weight_t resolution,
+  bool prune_inactive_vertices,
+  std::optional<raft::device_span<vertex_t>> flattened_clustering = std::nullopt,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options =
+    clustering_checkpoint_options_t<vertex_t, weight_t>{},
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state = std::nullopt,
+  std::optional<raft::device_span<vertex_t const>> initial_clustering          = std::nullopt)
 {
   using graph_t      = cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>;
   using graph_view_t = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
 
   CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  CUGRAPH_EXPECTS(!resume_state || !initial_clustering,
+                  "Invalid input argument: resume_state and initial_clustering are exclusive.");
 
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram = std::make_unique<Dendrogram<vertex_t>>();
   graph_t current_graph(handle);
@@ -66,6 +75,7 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   std::optional<edge_property_t<graph_view_t, weight_t>> current_edge_weights(handle);
   std::optional<edge_property_view_t<edge_t, weight_t const*>> current_edge_weight_view(
     edge_weight_view);
+  bool owns_current_graph{false};  // false while current_graph_view is graph_view
 
   weight_t best_modularity = weight_t{-1};
   weight_t total_edge_weight =
@@ -79,7 +89,44 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   edge_src_property_t<graph_view_t, vertex_t> src_clusters_cache(handle);
   edge_dst_property_t<graph_view_t, vertex_t> dst_clusters_cache(handle);
 
-  while (dendrogram->num_levels() < max_level) {
+  // If flattened_clustering is set, each level is folded into the level-0 labels as soon as its
+  // clustering is final and its device memory is released after the graph contraction, so only
+  // the current level is alive at any time.
+  size_t num_resumed_levels{0};
+  if (flattened_clustering) {
+    if (resume_state) {
+      raft::copy((*flattened_clustering).data(),
+                 (*resume_state).clustering.data(),
+                 (*resume_state).clustering.size(),
+                 handle.get_stream());
+
+      // re-derive the checkpointed level's graph (graph_contraction relabels the labels to the
+      // vertex IDs of the contracted graph)
+      std::tie(current_graph, current_edge_weights) = cugraph::detail::graph_contraction(
+        handle, current_graph_view, current_edge_weight_view, *flattened_clustering);
+      current_graph_view       = current_graph.view();
+      current_edge_weight_view = std::make_optional<edge_property_view_t<edge_t, weight_t const*>>(
+        (*current_edge_weights).view());
+      owns_current_graph       = true;
+
+      best_modularity    = (*resume_state).modularity;
+      num_resumed_levels = (*resume_state).num_levels;
+    } else {
+      detail::sequence_fill(handle.get_stream(),
+                            (*flattened_clustering).data(),
+                            (*flattened_clustering).size(),
+                            graph_view.local_vertex_partition_range_first());
+    }
+  }
+
+  // An initial clustering (warm start) replaces the singleton clusters of the first level
+  std::optional<rmm::device_uvector<vertex_t>> normalized_initial_clustering{std::nullopt};
+  if (initial_clustering) {
+    normalized_initial_clustering =
+      detail::normalize_initial_clustering(handle, graph_view, *initial_clustering);
+  }
+
+  while (num_resumed_levels + dendrogram->num_levels() < max_level) {
     //
     //  Initialize every cluster to reference each vertex to itself
     //
@@ -87,7 +134,14 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
                           current_graph_view.local_vertex_partition_range_size(),
                           handle.get_stream());
 
-    if (rng_state) {
+    bool warm_start = normalized_initial_clustering.has_value();
+    if (warm_start) {
+      raft::copy(dendrogram->current_level_begin(),
+                 (*normalized_initial_clustering).begin(),
+                 (*normalized_initial_clustering).size(),
+                 handle.get_stream());
+      normalized_initial_clustering = std::nullopt;
+    } else if (rng_state) {
       auto random_cluster_assignments = cugraph::detail::permute_range<vertex_t>(
         handle,
         *rng_state,
@@ -118,24 +172,29 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
 
     vertex_weights_v =
       compute_out_weight_sums(handle, current_graph_view, *current_edge_weight_view);
-    cluster_keys_v.resize(vertex_weights_v.size(), handle.get_stream());
-    cluster_weights_v.resize(vertex_weights_v.size(), handle.get_stream());
+    // with a warm start, the cluster weights are computed once the cluster caches are updated
+    if (!warm_start) {
+      cluster_keys_v.resize(vertex_weights_v.size(), handle.get_stream());
+      cluster_weights_v.resize(vertex_weights_v.size(), handle.get_stream());
 
-    detail::sequence_fill(handle.get_stream(),
-                          cluster_keys_v.begin(),
-                          cluster_keys_v.size(),
-                          current_graph_view.local_vertex_partition_range_first());
+      detail::sequence_fill(handle.get_stream(),
+                            cluster_keys_v.begin(),
+                            cluster_keys_v.size(),
+                            current_graph_view.local_vertex_partition_range_first());
 
-    raft::copy(cluster_weights_v.begin(),
-               vertex_weights_v.begin(),
-               vertex_weights_v.size(),
-               handle.get_stream());
+      raft::copy(cluster_weights_v.begin(),
+                 vertex_weights_v.begin(),
+                 vertex_weights_v.size(),
+                 handle.get_stream());
 
-    if constexpr (graph_view_t::is_multi_gpu) {
-      std::tie(cluster_keys_v, cluster_weights_v) =
-        detail::shuffle_ext_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
-          handle, std::move(cluster_keys_v), std::move(cluster_weights_v));
+      if constexpr (graph_view_t::is_multi_gpu) {
+        std::tie(cluster_keys_v, cluster_weights_v) =
+          detail::shuffle_ext_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+            handle, std::move(cluster_keys_v), std::move(cluster_weights_v));
+      }
+    }
 
+    if constexpr (graph_view_t::is_multi_gpu) {
       src_vertex_weights_cache =
         edge_src_property_t<graph_view_t, weight_t>(handle, current_graph_view);
       update_edge_src_property(handle,
@@ -175,12 +234,29 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
         handle, current_graph_view, next_clusters_v.begin(), dst_clusters_cache.mutable_view());
     }
 
-    weight_t new_Q = detail::compute_modularity(handle,
+    if (warm_start) {
+      std::tie(cluster_keys_v, cluster_weights_v) =
+        detail::compute_cluster_keys_and_values(handle,
                                                 current_graph_view,
                                                 current_edge_weight_view,
-                                                src_clusters_cache,
-                                                dst_clusters_cache,
                                                 next_clusters_v,
+                                                src_clusters_cache);
+    }
+
+    // The per-vertex intra-cluster weight sums serve both the modularity of the current clustering
+    // and the next round of vertex moves, so each inner iteration needs only one such edge pass.
+    auto [old_cluster_sum_v, cluster_subtract_v] =
+      detail::compute_cluster_sum_and_subtract(handle,
+                                               current_graph_view,
+                                               current_edge_weight_view,
+                                               next_clusters_v,
+                                               src_clusters_cache,
+                                               dst_clusters_cache);
+
+    weight_t new_Q = detail::compute_modularity(handle,
+                                                current_graph_view,
+                                                old_cluster_sum_v,
+                                                cluster_subtract_v,
                                                 cluster_weights_v,
                                                 total_edge_weight,
                                                 resolution);
@@ -191,22 +267,38 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
     // during each iteration of the loop
     bool up_down = true;
 
+    // With pruning, only the vertices whose neighborhood changed are re-evaluated (every vertex is
+    // active in the first iteration of each level)
+    std::optional<rmm::device_uvector<vertex_t>> active_vertices{std::nullopt};
+    if (prune_inactive_vertices) {
+      active_vertices = rmm::device_uvector<vertex_t>(
+        current_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+      detail::sequence_fill(handle.get_stream(),
+                            (*active_vertices).begin(),
+                            (*active_vertices).size(),
+                            current_graph_view.local_vertex_partition_range_first());
+    }
+
     while (new_Q > (cur_Q + threshold)) {
       cur_Q = new_Q;
 
-      next_clusters_v = detail::update_clustering_by_delta_modularity(handle,
-                                                                      current_graph_view,
-                                                                      current_edge_weight_view,
-                                                                      total_edge_weight,
-                                                                      resolution,
-                                                                      vertex_weights_v,
-                                                                      std::move(cluster_keys_v),
-                                                                      std::move(cluster_weights_v),
-                                                                      std::move(next_clusters_v),
-                                                                      src_vertex_weights_cache,
-                                                                      src_clusters_cache,
-                                                                      dst_clusters_cache,
-                                                                      up_down);
+      std::tie(next_clusters_v, active_vertices) =
+        detail::update_clustering_by_delta_modularity(handle,
+                                                      current_graph_view,
+                                                      current_edge_weight_view,
+                                                      total_edge_weight,
+                                                      resolution,
+                                                      vertex_weights_v,
+                                                      std::move(cluster_keys_v),
+                                                      std::move(cluster_weights_v),
+                                                      std::move(next_clusters_v),
+                                                      std::move(old_cluster_sum_v),
+                                                      std::move(cluster_subtract_v),
+                                                      src_vertex_weights_cache,
+                                                      src_clusters_cache,
+                                                      dst_clusters_cache,
+                                                      up_down,
+                                                      std::move(active_vertices));
 
       if constexpr (graph_view_t::is_multi_gpu) {
         update_edge_src_property(
@@ -220,12 +312,18 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
 
       up_down = !up_down;
 
+      std::tie(old_cluster_sum_v, cluster_subtract_v) =
+        detail::compute_cluster_sum_and_subtract(handle,
+                                                 current_graph_view,
+                                                 current_edge_weight_view,
+                                                 next_clusters_v,
+                                                 src_clusters_cache,
+                                                 dst_clusters_cache);
+
       new_Q = detail::compute_modularity(handle,
                                          current_graph_view,
-                                         current_edge_weight_view,
-                                         src_clusters_cache,
-                                         dst_clusters_cache,
-                                         next_clusters_v,
+                                         old_cluster_sum_v,
+                                         cluster_subtract_v,
                                          cluster_weights_v,
                                          total_edge_weight,
                                          resolution);
@@ -242,7 +340,17 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
     detail::timer_stop<graph_view_t::is_multi_gpu>(handle, hr_timer);
 #endif
 
-    if (cur_Q <= best_modularity) { break; }
+    if (cur_Q <= best_modularity) {
+      if (flattened_clustering) {
+        fold_level_into_partition<vertex_t, multi_gpu>(
+          handle,
+          *dendrogram,
+          dendrogram->current_level(),
+          (*flattened_clustering).data(),
+          static_cast<vertex_t>((*flattened_clustering).size()));
+      }
+      break;
+    }
 
     best_modularity = cur_Q;
 
@@ -266,19 +374,56 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
     src_clusters_cache.clear(handle);
     dst_clusters_cache.clear(handle);
 
-    std::tie(current_graph, current_edge_weights) = cugraph::detail::graph_contraction(
-      handle,
-      current_graph_view,
-      current_edge_weight_view,
-      raft::device_span<vertex_t>{dendrogram->current_level_begin(),
-                                  dendrogram->current_level_size()});
+    // the first level's graph is the input graph (owned by the caller), later levels' graphs are
+    // owned here and are released before the contracted graph is created
+    auto level_labels = raft::device_span<vertex_t>{dendrogram->current_level_begin(),
+                                                    dendrogram->current_level_size()};
+    if (owns_current_graph) {
+      std::tie(current_graph, current_edge_weights) = cugraph::detail::graph_contraction(
+        handle, std::move(current_graph), std::move(current_edge_weights), level_labels);
+    } else {
+      std::tie(current_graph, current_edge_weights) = cugraph::detail::graph_contraction(
+        handle, current_graph_view, current_edge_weight_view, level_labels);
+      owns_current_graph = true;
+    }
     current_graph_view       = current_graph.view();
     current_edge_weight_view = std::make_optional<edge_property_view_t<edge_t, weight_t const*>>(
       (*current_edge_weights).view());
 
+    if (flattened_clustering) {
+      // fold after graph_contraction, graph_contraction relabels this level's clusters to the
+      // coarsened graph's vertex IDs (which are the vertices the next level clusters)
+      fold_level_into_partition<vertex_t, multi_gpu>(
+        handle,
+        *dendrogram,
+        dendrogram->current_level(),
+        (*flattened_clustering).data(),
+        static_cast<vertex_t>((*flattened_clustering).size()));
+      dendrogram->release_level(dendrogram->current_level(), handle.get_stream());
+
+      // the folded labels map the input graph vertices to the current graph vertices, which is
+      // the state to resume from
+      auto num_levels = num_resumed_levels + dendrogram->num_levels();
+      if (checkpoint_options.callback && (num_levels % checkpoint_options.level_interval == 0)) {
+        checkpoint_options.callback(clustering_checkpoint_view_t<vertex_t, weight_t>{
+          num_levels,
+          best_modularity,
+          raft::device_span<vertex_t const>{(*flattened_clustering).data(),
+                                            (*flattened_clustering).size()},
+          std::nullopt});
+      }
+    }
+
 #ifdef TIMING
     detail::timer_stop<graph_view_t::is_multi_gpu>(handle, hr_timer);
 #endif
+
+    iteration_progress_t progress{};
+    progress.algorithm     = "louvain";
+    progress.iteration     = num_resumed_levels + dendrogram->num_levels();
+    progress.modularity    = static_cast<double>(best_modularity);
+    progress.frontier_size = static_cast<size_t>(current_graph_view.number_of_vertices());
+    if (detail::report_progress(handle, progress, multi_gpu)) { break; }
   }
 
 #ifdef TIMING
@@ -316,14 +461,21 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
   size_t max_level,
   weight_t threshold,
-  weight_t resolution)
+  weight_t resolution,
+  bool prune_inactive_vertices)
 {
   CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
 
   CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
 
-  return detail::louvain(
-    handle, rng_state, graph_view, edge_weight_view, max_level, threshold, resolution);
+  return detail::louvain(handle,
+                         rng_state,
+                         graph_view,
+                         edge_weight_view,
+                         max_level,
+                         threshold,
+                         resolution,
+                         prune_inactive_vertices);
 }
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -346,7 +498,8 @@ std::pair<size_t, weight_t> louvain(
   vertex_t* clustering,
   size_t max_level,
   weight_t threshold,
-  weight_t resolution)
+  weight_t resolution,
+  bool prune_inactive_vertices)
 {
   CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
 
@@ -356,10 +509,107 @@ std::pair<size_t, weight_t> louvain(
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
   weight_t modularity;
 
+  // fold each level into clustering as it completes instead of keeping every level alive until a
+  // final flatten_dendrogram
   std::tie(dendrogram, modularity) = detail::louvain(
-    handle, rng_state, graph_view, edge_weight_view, max_level, threshold, resolution);
+    handle,
+    rng_state,
+    graph_view,
+    edge_weight_view,
+    max_level,
+    threshold,
+    resolution,
+    prune_inactive_vertices,
+    std::make_optional<raft::device_span<vertex_t>>(
+      clustering, static_cast<size_t>(graph_view.local_vertex_partition_range_size())));
 
-  detail::flatten_dendrogram(handle, graph_view, *dendrogram, clustering);
+  return std::make_pair(dendrogram->num_levels(), modularity);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> louvain(
+  raft::handle_t const& handle,
+  std::optional<std::reference_wrapper<raft::random::RngState>> rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t threshold,
+  weight_t resolution,
+  bool prune_inactive_vertices,
+  clustering_checkpoint_options_t<vertex_t, weight_t> const& checkpoint_options,
+  std::optional<clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  detail::check_clustering(graph_view, clustering);
+  CUGRAPH_EXPECTS(
+    !checkpoint_options.callback || (checkpoint_options.level_interval > 0),
+    "Invalid input argument: checkpoint_options.level_interval should be positive.");
+  CUGRAPH_EXPECTS(!resume_state || ((*resume_state).clustering.size() ==
+                                    static_cast<size_t>(
+                                      graph_view.local_vertex_partition_range_size())),
+                  "Invalid input argument: resume_state.clustering size does not match with the "
+                  "local vertex partition range size.");
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) = detail::louvain(
+    handle,
+    rng_state,
+    graph_view,
+    edge_weight_view,
+    max_level,
+    threshold,
+    resolution,
+    prune_inactive_vertices,
+    std::make_optional<raft::device_span<vertex_t>>(
+      clustering, static_cast<size_t>(graph_view.local_vertex_partition_range_size())),
+    checkpoint_options,
+    resume_state);
+
+  return std::make_pair((resume_state ? (*resume_state).num_levels : size_t{0}) +
+                          dendrogram->num_levels(),
+                        modularity);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> louvain(
+  raft::handle_t const& handle,
+  std::optional<std::reference_wrapper<raft::random::RngState>> rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> initial_clustering,
+  vertex_t* clustering,
+  size_t max_level,
+  weight_t threshold,
+  weight_t resolution,
+  bool prune_inactive_vertices)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  CUGRAPH_EXPECTS(edge_weight_view.has_value(), "Graph must be weighted");
+  detail::check_clustering(graph_view, clustering);
+
+  std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
+  weight_t modularity;
+
+  std::tie(dendrogram, modularity) = detail::louvain(
+    handle,
+    rng_state,
+    graph_view,
+    edge_weight_view,
+    max_level,
+    threshold,
+    resolution,
+    prune_inactive_vertices,
+    std::make_optional<raft::device_span<vertex_t>>(
+      clustering, static_cast<size_t>(graph_view.local_vertex_partition_range_size())),
+    clustering_checkpoint_options_t<vertex_t, weight_t>{},
+    std::nullopt,
+    std::make_optional(initial_clustering));
 
   return std::make_pair(dendrogram->num_levels(), modularity);
 }
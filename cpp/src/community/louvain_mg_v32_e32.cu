@@ -27,7 +27,8 @@ template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   std::optional<edge_property_view_t<int32_t, float const*>>,
   size_t,
   float,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const&,
   std::optional<std::reference_wrapper<raft::random::RngState>>,
@@ -35,23 +36,74 @@ template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   std::optional<edge_property_view_t<int32_t, double const*>>,
   size_t,
   double,
-  double);
+  double,
+  bool);
+template std::pair<size_t, float> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int32_t, int32_t, false, true> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  int32_t*,
+  size_t,
+  float,
+  float,
+  bool);
+template std::pair<size_t, double> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int32_t, int32_t, false, true> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  int32_t*,
+  size_t,
+  double,
+  double,
+  bool);
+
+template std::pair<size_t, float> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int32_t, int32_t, false, true> const&,
+  std::optional<edge_property_view_t<int32_t, float const*>>,
+  int32_t*,
+  size_t,
+  float,
+  float,
+  bool,
+  clustering_checkpoint_options_t<int32_t, float> const&,
+  std::optional<clustering_checkpoint_view_t<int32_t, float>>);
+template std::pair<size_t, double> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int32_t, int32_t, false, true> const&,
+  std::optional<edge_property_view_t<int32_t, double const*>>,
+  int32_t*,
+  size_t,
+  double,
+  double,
+  bool,
+  clustering_checkpoint_options_t<int32_t, double> const&,
+  std::optional<clustering_checkpoint_view_t<int32_t, double>>);
+
 template std::pair<size_t, float> louvain(
   raft::handle_t const&,
   std::optional<std::reference_wrapper<raft::random::RngState>>,
   graph_view_t<int32_t, int32_t, false, true> const&,
   std::optional<edge_property_view_t<int32_t, float const*>>,
+  raft::device_span<int32_t const>,
   int32_t*,
   size_t,
   float,
-  float);
+  float,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const&,
   std::optional<std::reference_wrapper<raft::random::RngState>>,
   graph_view_t<int32_t, int32_t, false, true> const&,
   std::optional<edge_property_view_t<int32_t, double const*>>,
+  raft::device_span<int32_t const>,
   int32_t*,
   size_t,
   double,
-  double);
+  double,
+  bool);
 }  // namespace cugraph
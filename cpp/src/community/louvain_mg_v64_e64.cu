@@ -27,7 +27,8 @@ template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
   std::optional<edge_property_view_t<int64_t, float const*>>,
   size_t,
   float,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
   raft::handle_t const&,
   std::optional<std::reference_wrapper<raft::random::RngState>>,
@@ -35,7 +36,8 @@ template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
   std::optional<edge_property_view_t<int64_t, double const*>>,
   size_t,
   double,
-  double);
+  double,
+  bool);
 
 template std::pair<size_t, float> louvain(
   raft::handle_t const&,
@@ -45,7 +47,8 @@ template std::pair<size_t, float> louvain(
   int64_t*,
   size_t,
   float,
-  float);
+  float,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const&,
   std::optional<std::reference_wrapper<raft::random::RngState>>,
@@ -54,6 +57,54 @@ template std::pair<size_t, double> louvain(
   int64_t*,
   size_t,
   double,
-  double);
+  double,
+  bool);
 
+template std::pair<size_t, float> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int64_t, int64_t, false, true> const&,
+  std::optional<edge_property_view_t<int64_t, float const*>>,
+  int64_t*,
+  size_t,
+  float,
+  float,
+  bool,
+  clustering_checkpoint_options_t<int64_t, float> const&,
+  std::optional<clustering_checkpoint_view_t<int64_t, float>>);
+template std::pair<size_t, double> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int64_t, int64_t, false, true> const&,
+  std::optional<edge_property_view_t<int64_t, double const*>>,
+  int64_t*,
+  size_t,
+  double,
+  double,
+  bool,
+  clustering_checkpoint_options_t<int64_t, double> const&,
+  std::optional<clustering_checkpoint_view_t<int64_t, double>>);
+
+template std::pair<size_t, float> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int64_t, int64_t, false, true> const&,
+  std::optional<edge_property_view_t<int64_t, float const*>>,
+  raft::device_span<int64_t const>,
+  int64_t*,
+  size_t,
+  float,
+  float,
+  bool);
+template std::pair<size_t, double> louvain(
+  raft::handle_t const&,
+  std::optional<std::reference_wrapper<raft::random::RngState>>,
+  graph_view_t<int64_t, int64_t, false, true> const&,
+  std::optional<edge_property_view_t<int64_t, double const*>>,
+  raft::device_span<int64_t const>,
+  int64_t*,
+  size_t,
+  double,
+  double,
+  bool);
 }  // namespace cugraph
@@ -0,0 +1,868 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "community/detail/common_methods.hpp"
+#include "detail/graph_partition_utils.cuh"
+#include "prims/fill_edge_property.cuh"
+#include "prims/kv_store.cuh"
+#include "prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/transform_reduce_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuda/functional>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// the graph is coarsened till it has at most this many vertices per partition
+size_t constexpr multilevel_partition_coarsest_vertices_per_partition{32};
+// coarsening stops if a level does not reduce the number of vertices by at least 5%
+double constexpr multilevel_partition_min_coarsening_ratio{0.05};
+size_t constexpr multilevel_partition_max_levels{32};
+
+// (target partition, aggregated edge weight to the target partition, aggregated edge weight to the
+// vertex's current partition, priority)
+template <typename vertex_t, typename weight_t>
+using partition_move_t = thrust::tuple<vertex_t, weight_t, weight_t, uint32_t>;
+
+// Heavy-edge matching is restricted to the edges whose endpoints are light enough to be merged, so
+// no coarse vertex becomes too heavy to move between partitions.
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_matchable_edge_t {
+  vertex_t max_coarse_vertex_weight{};
+
+  __device__ bool operator()(
+    vertex_t, vertex_t, vertex_t src_weight, vertex_t dst_weight, cuda::std::nullopt_t) const
+  {
+    return (src_weight + dst_weight) <= max_coarse_vertex_weight;
+  }
+};
+
+// Only the partitions on one side (larger or smaller partition IDs than the vertex's current
+// partition) are considered in a single refinement step, this keeps two adjacent vertices from
+// swapping their partitions back and forth.
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct partition_move_score_op_t {
+  vertex_t max_partition_weight{};
+  bool toward_larger_partition_ids{};
+  uint32_t seed{};
+
+  __device__ partition_move_t<vertex_t, weight_t> operator()(vertex_t src,
+                                                             vertex_t partition,
+                                                             vertex_t src_partition,
+                                                             vertex_t partition_weight,
+                                                             weight_t weight) const
+  {
+    if (partition == src_partition) {
+      return thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                                std::numeric_limits<weight_t>::lowest(),
+                                weight,
+                                uint32_t{0});
+    }
+    if ((partition_weight >= max_partition_weight) ||
+        ((partition > src_partition) != toward_larger_partition_ids)) {
+      return thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                                std::numeric_limits<weight_t>::lowest(),
+                                weight_t{0},
+                                uint32_t{0});
+    }
+    cuco::murmurhash3_32<vertex_t> src_hash_func{seed};
+    cuco::murmurhash3_32<vertex_t> partition_hash_func{src_hash_func(src)};
+    return thrust::make_tuple(
+      partition, weight, weight_t{0}, static_cast<uint32_t>(partition_hash_func(partition)));
+  }
+};
+
+// Select the target partition with the largest aggregated edge weight (ties are broken by the
+// pseudo-random priority and then the smaller partition ID) while accumulating the aggregated edge
+// weight to the vertex's current partition.
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct partition_move_select_op_t {
+  using type                          = partition_move_t<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;  // this can be called from any process
+  inline static type const identity_element =
+    thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                       std::numeric_limits<weight_t>::lowest(),
+                       weight_t{0},
+                       uint32_t{0});
+
+  __device__ type operator()(type lhs, type rhs) const
+  {
+    bool lhs_wins{};
+    if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      lhs_wins = thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    } else if (thrust::get<3>(lhs) != thrust::get<3>(rhs)) {
+      lhs_wins = thrust::get<3>(lhs) > thrust::get<3>(rhs);
+    } else {
+      lhs_wins = thrust::get<0>(lhs) <= thrust::get<0>(rhs);
+    }
+    auto const& winner = lhs_wins ? lhs : rhs;
+    return thrust::make_tuple(thrust::get<0>(winner),
+                              thrust::get<1>(winner),
+                              thrust::get<2>(lhs) + thrust::get<2>(rhs),
+                              thrust::get<3>(winner));
+  }
+};
+
+// FIXME: a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct cut_edge_weight_t {
+  __device__ weight_t operator()(
+    vertex_t, vertex_t, vertex_t src_partition, vertex_t dst_partition, weight_t weight) const
+  {
+    return src_partition != dst_partition ? weight : weight_t{0};
+  }
+};
+
+// the total vertex weight of every partition (replicated in every GPU in multi-GPU)
+template <typename vertex_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> compute_partition_weights(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> partitions,
+  raft::device_span<vertex_t const> vertex_weights,
+  size_t num_partitions)
+{
+  rmm::device_uvector<vertex_t> keys(partitions.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> values(vertex_weights.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), partitions.begin(), partitions.end(), keys.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), vertex_weights.begin(), vertex_weights.end(), values.begin());
+  thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+
+  rmm::device_uvector<vertex_t> unique_keys(keys.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> key_weights(keys.size(), handle.get_stream());
+  auto last        = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                    keys.begin(),
+                                    keys.end(),
+                                    values.begin(),
+                                    unique_keys.begin(),
+                                    key_weights.begin());
+  auto num_uniques = static_cast<size_t>(thrust::distance(unique_keys.begin(), last.first));
+
+  rmm::device_uvector<vertex_t> partition_weights(num_partitions, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), partition_weights.begin(), partition_weights.end(), vertex_t{0});
+  thrust::scatter(handle.get_thrust_policy(),
+                  key_weights.begin(),
+                  key_weights.begin() + num_uniques,
+                  unique_keys.begin(),
+                  partition_weights.begin());
+
+  if constexpr (multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     partition_weights.data(),
+                     partition_weights.data(),
+                     partition_weights.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+
+  return partition_weights;
+}
+
+// (partition, partition weight) pairs are stored in the GPU that owns the partition ID (the
+// partition ID is mapped to a GPU in the same way as an external vertex ID) in multi-GPU
+template <typename vertex_t, bool multi_gpu>
+kv_store_t<vertex_t, vertex_t, true> build_partition_weight_store(
+  raft::handle_t const& handle, raft::device_span<vertex_t const> partition_weights)
+{
+  rmm::device_uvector<vertex_t> keys(partition_weights.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), keys.begin(), keys.end(), vertex_t{0});
+  if constexpr (multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+    keys.resize(
+      thrust::distance(
+        keys.begin(),
+        thrust::remove_if(handle.get_thrust_policy(),
+                          keys.begin(),
+                          keys.end(),
+                          [key_func =
+                             compute_gpu_id_from_ext_vertex_t<vertex_t>{
+                               comm_size, major_comm_size, minor_comm_size},
+                           comm_rank] __device__(auto key) { return key_func(key) != comm_rank; })),
+      handle.get_stream());
+  }
+  rmm::device_uvector<vertex_t> values(keys.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 keys.begin(),
+                 keys.end(),
+                 partition_weights.begin(),
+                 values.begin());
+
+  return kv_store_t<vertex_t, vertex_t, true>(std::move(keys),
+                                              std::move(values),
+                                              invalid_vertex_id<vertex_t>::value,
+                                              true,
+                                              handle.get_stream());
+}
+
+// Greedy graph growing on the coarsest graph: the partitions are grown one at a time from a seed
+// vertex, adding the unassigned vertex with the largest connectivity to the partition till the
+// partition reaches its share of the remaining vertex weight (the remaining vertices form the last
+// partition). The coarsest graph is small, so this runs on the host (replicated in every GPU in
+// multi-GPU; the outcome is deterministic, so every GPU computes the same partitioning).
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> grow_initial_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> vertex_weights,
+  size_t num_partitions,
+  vertex_t max_partition_weight)
+{
+  auto [d_srcs, d_dsts, d_weights, d_ids, d_types] =
+    decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t>(
+      handle,
+      graph_view,
+      std::make_optional(edge_weight_view),
+      std::optional<edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+      std::optional<edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+      std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+  rmm::device_uvector<vertex_t> d_vertex_weights(vertex_weights.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               vertex_weights.begin(),
+               vertex_weights.end(),
+               d_vertex_weights.begin());
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    d_srcs     = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()));
+    d_dsts = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()));
+    *d_weights = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<weight_t const>((*d_weights).data(), (*d_weights).size()));
+    // vertex partition ranges are contiguous and ordered by rank
+    d_vertex_weights = cugraph::device_allgatherv(
+      handle,
+      comm,
+      raft::device_span<vertex_t const>(d_vertex_weights.data(), d_vertex_weights.size()));
+  }
+
+  auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+  std::vector<vertex_t> h_srcs(d_srcs.size());
+  std::vector<vertex_t> h_dsts(d_dsts.size());
+  std::vector<weight_t> h_weights((*d_weights).size());
+  std::vector<vertex_t> h_vertex_weights(d_vertex_weights.size());
+  raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+  raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+  raft::update_host(
+    h_weights.data(), (*d_weights).data(), (*d_weights).size(), handle.get_stream());
+  raft::update_host(h_vertex_weights.data(),
+                    d_vertex_weights.data(),
+                    d_vertex_weights.size(),
+                    handle.get_stream());
+  handle.sync_stream();
+
+  std::vector<size_t> h_offsets(num_vertices + 1, 0);
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    ++h_offsets[h_srcs[i] + 1];
+  }
+  std::partial_sum(h_offsets.begin(), h_offsets.end(), h_offsets.begin());
+  std::vector<vertex_t> h_nbrs(h_srcs.size());
+  std::vector<weight_t> h_nbr_weights(h_srcs.size());
+  {
+    auto insert_positions = h_offsets;
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      auto pos           = insert_positions[h_srcs[i]]++;
+      h_nbrs[pos]        = h_dsts[i];
+      h_nbr_weights[pos] = h_weights[i];
+    }
+  }
+
+  auto remaining_weight =
+    std::accumulate(h_vertex_weights.begin(), h_vertex_weights.end(), vertex_t{0});
+  std::vector<vertex_t> h_partitions(num_vertices, invalid_vertex_id<vertex_t>::value);
+  std::vector<weight_t> h_connectivities(num_vertices, weight_t{0});
+  for (size_t p = 0; p < num_partitions; ++p) {
+    if (p == num_partitions - 1) {
+      std::replace(h_partitions.begin(),
+                   h_partitions.end(),
+                   invalid_vertex_id<vertex_t>::value,
+                   static_cast<vertex_t>(p));
+      break;
+    }
+
+    auto target_weight = std::min(static_cast<vertex_t>((remaining_weight + (num_partitions - p) -
+                                                         1) /
+                                                        (num_partitions - p)),
+                                  max_partition_weight);
+    std::fill(h_connectivities.begin(), h_connectivities.end(), weight_t{0});
+    std::priority_queue<std::pair<weight_t, vertex_t>> queue{};
+    size_t seed_cursor{0};
+    vertex_t partition_weight{0};
+    while (partition_weight < target_weight) {
+      if (queue.empty()) {  // (re-)seed, the partition may span multiple connected components
+        while ((seed_cursor < num_vertices) &&
+               (h_partitions[seed_cursor] != invalid_vertex_id<vertex_t>::value)) {
+          ++seed_cursor;
+        }
+        if (seed_cursor == num_vertices) { break; }
+        queue.push(std::make_pair(weight_t{0}, static_cast<vertex_t>(seed_cursor++)));
+      }
+      auto [connectivity, v] = queue.top();
+      queue.pop();
+      if ((h_partitions[v] != invalid_vertex_id<vertex_t>::value) ||
+          (connectivity != h_connectivities[v])) {
+        continue;  // already assigned or a stale entry
+      }
+      if ((partition_weight > vertex_t{0}) &&
+          (partition_weight + h_vertex_weights[v] > max_partition_weight)) {
+        continue;
+      }
+      h_partitions[v] = static_cast<vertex_t>(p);
+      partition_weight += h_vertex_weights[v];
+      for (size_t i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+        auto nbr = h_nbrs[i];
+        if ((nbr != v) && (h_partitions[nbr] == invalid_vertex_id<vertex_t>::value)) {
+          h_connectivities[nbr] += h_nbr_weights[i];
+          queue.push(std::make_pair(h_connectivities[nbr], nbr));
+        }
+      }
+    }
+    remaining_weight -= partition_weight;
+  }
+
+  rmm::device_uvector<vertex_t> partitions(graph_view.local_vertex_partition_range_size(),
+                                           handle.get_stream());
+  raft::update_device(partitions.data(),
+                      h_partitions.data() + graph_view.local_vertex_partition_range_first(),
+                      partitions.size(),
+                      handle.get_stream());
+
+  return partitions;
+}
+
+// Label-propagation-style refinement under the balance constraint: every vertex computes its best
+// target partition (on alternating sides in consecutive steps), moves with a positive gain (or
+// moves out of an overweight partition) become candidates, and the candidates are accepted in the
+// order of decreasing gain till the target partitions reach @p max_partition_weight (in multi-GPU,
+// the remaining capacity of a partition is shared by the GPUs in proportion to their demand).
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void refine_partitions(raft::handle_t const& handle,
+                       graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                       edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                       raft::device_span<vertex_t const> vertex_weights,
+                       raft::device_span<vertex_t> partitions,
+                       size_t num_partitions,
+                       vertex_t max_partition_weight,
+                       size_t max_iterations)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  auto const v_first = graph_view.local_vertex_partition_range_first();
+
+  edge_src_property_t<GraphViewType, vertex_t> src_partitions(handle);
+  edge_dst_property_t<GraphViewType, vertex_t> dst_partitions(handle);
+  if constexpr (multi_gpu) {
+    src_partitions = edge_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    dst_partitions = edge_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+  }
+
+  auto output_buffer = allocate_dataframe_buffer<partition_move_t<vertex_t, weight_t>>(
+    partitions.size(), handle.get_stream());
+
+  size_t num_idle_iterations{0};  // stop once no vertex moves in both directions
+  for (size_t iter = 0; (iter < max_iterations) && (num_idle_iterations < 2); ++iter) {
+    auto partition_weights = compute_partition_weights<vertex_t, multi_gpu>(
+      handle,
+      raft::device_span<vertex_t const>(partitions.data(), partitions.size()),
+      vertex_weights,
+      num_partitions);
+    auto partition_weight_store = build_partition_weight_store<vertex_t, multi_gpu>(
+      handle,
+      raft::device_span<vertex_t const>(partition_weights.data(), partition_weights.size()));
+
+    if constexpr (multi_gpu) {
+      update_edge_src_property(
+        handle, graph_view, partitions.begin(), src_partitions.mutable_view());
+      update_edge_dst_property(
+        handle, graph_view, partitions.begin(), dst_partitions.mutable_view());
+    }
+
+    per_v_transform_reduce_dst_key_aggregated_outgoing_e(
+      handle,
+      graph_view,
+      multi_gpu
+        ? src_partitions.view()
+        : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(partitions.data()),
+      edge_weight_view,
+      multi_gpu ? dst_partitions.view()
+                : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(partitions.data(),
+                                                                                vertex_t{0}),
+      partition_weight_store.view(),
+      partition_move_score_op_t<vertex_t, weight_t>{
+        max_partition_weight, (iter % 2) == 0, static_cast<uint32_t>(iter)},
+      partition_move_select_op_t<vertex_t, weight_t>::identity_element,
+      partition_move_select_op_t<vertex_t, weight_t>{},
+      get_dataframe_buffer_begin(output_buffer));
+
+    // 1. candidate moves
+
+    rmm::device_uvector<vertex_t> candidates(partitions.size(), handle.get_stream());
+    candidates.resize(
+      thrust::distance(
+        candidates.begin(),
+        thrust::copy_if(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(v_first),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+          candidates.begin(),
+          [partitions        = partitions.data(),
+           vertex_weights    = vertex_weights.data(),
+           partition_weights = partition_weights.data(),
+           targets           = std::get<0>(output_buffer).data(),
+           target_weights    = std::get<1>(output_buffer).data(),
+           internal_weights  = std::get<2>(output_buffer).data(),
+           max_partition_weight,
+           v_first] __device__(vertex_t v) {
+            auto v_offset = v - v_first;
+            auto target   = targets[v_offset];
+            if (target == invalid_vertex_id<vertex_t>::value) { return false; }
+            auto source_weight = partition_weights[partitions[v_offset]];
+            if (source_weight > max_partition_weight) { return true; }  // rebalance
+            auto gain = target_weights[v_offset] - internal_weights[v_offset];
+            return (gain > weight_t{0}) ||
+                   ((gain == weight_t{0}) &&
+                    (partition_weights[target] + vertex_weights[v_offset] < source_weight));
+          })),
+      handle.get_stream());
+
+    // 2. accept the candidates in the order of decreasing gain per target partition
+
+    rmm::device_uvector<vertex_t> candidate_targets(candidates.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> candidate_losses(candidates.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      candidates.begin(),
+      candidates.end(),
+      thrust::make_zip_iterator(candidate_targets.begin(), candidate_losses.begin()),
+      [targets          = std::get<0>(output_buffer).data(),
+       target_weights   = std::get<1>(output_buffer).data(),
+       internal_weights = std::get<2>(output_buffer).data(),
+       v_first] __device__(vertex_t v) {
+        auto v_offset = v - v_first;
+        return thrust::make_tuple(targets[v_offset],
+                                  internal_weights[v_offset] - target_weights[v_offset]);
+      });
+    thrust::sort_by_key(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(candidate_targets.begin(), candidate_losses.begin()),
+      thrust::make_zip_iterator(candidate_targets.end(), candidate_losses.end()),
+      candidates.begin());
+    candidate_losses.resize(0, handle.get_stream());
+    candidate_losses.shrink_to_fit(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> candidate_weight_prefix_sums(candidates.size(),
+                                                               handle.get_stream());
+    auto candidate_weight_first = thrust::make_transform_iterator(
+      candidates.begin(),
+      cuda::proclaim_return_type<vertex_t>(
+        [vertex_weights = vertex_weights.data(), v_first] __device__(vertex_t v) {
+          return vertex_weights[v - v_first];
+        }));
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  candidate_targets.begin(),
+                                  candidate_targets.end(),
+                                  candidate_weight_first,
+                                  candidate_weight_prefix_sums.begin());
+
+    rmm::device_uvector<vertex_t> local_demands(num_partitions, handle.get_stream());
+    thrust::fill(
+      handle.get_thrust_policy(), local_demands.begin(), local_demands.end(), vertex_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(candidates.size()),
+                     [candidate_targets = candidate_targets.data(),
+                      prefix_sums       = candidate_weight_prefix_sums.data(),
+                      num_candidates    = candidates.size(),
+                      local_demands     = local_demands.data()] __device__(size_t i) {
+                       if ((i == num_candidates - 1) ||
+                           (candidate_targets[i] != candidate_targets[i + 1])) {
+                         local_demands[candidate_targets[i]] = prefix_sums[i];
+                       }
+                     });
+    rmm::device_uvector<vertex_t> total_demands(local_demands.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 local_demands.begin(),
+                 local_demands.end(),
+                 total_demands.begin());
+    if constexpr (multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       total_demands.data(),
+                       total_demands.data(),
+                       total_demands.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    auto candidate_first = thrust::make_zip_iterator(
+      candidates.begin(), candidate_targets.begin(), candidate_weight_prefix_sums.begin());
+    auto num_moves = static_cast<size_t>(thrust::distance(
+      candidate_first,
+      thrust::remove_if(
+        handle.get_thrust_policy(),
+        candidate_first,
+        candidate_first + candidates.size(),
+        [partition_weights = partition_weights.data(),
+         local_demands     = local_demands.data(),
+         total_demands     = total_demands.data(),
+         max_partition_weight] __device__(auto candidate) {
+          auto target   = thrust::get<1>(candidate);
+          auto capacity = max_partition_weight - partition_weights[target];
+          if (total_demands[target] > capacity) {
+            capacity = static_cast<vertex_t>(static_cast<double>(capacity) *
+                                             local_demands[target] / total_demands[target]);
+          }
+          return thrust::get<2>(candidate) > capacity;
+        })));
+    thrust::for_each(handle.get_thrust_policy(),
+                     candidate_first,
+                     candidate_first + num_moves,
+                     [partitions = partitions.data(), v_first] __device__(auto candidate) {
+                       partitions[thrust::get<0>(candidate) - v_first] = thrust::get<1>(candidate);
+                     });
+    if constexpr (multi_gpu) {
+      num_moves = host_scalar_allreduce(
+        handle.get_comms(), num_moves, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    num_idle_iterations = (num_moves == 0) ? (num_idle_iterations + 1) : size_t{0};
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> multilevel_partition(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_partitions,
+  double imbalance_tolerance,
+  size_t max_refinement_iterations,
+  bool do_expensive_check)
+{
+  using graph_t       = cugraph::graph_t<vertex_t, edge_t, false, multi_gpu>;
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: multilevel partitioning requires a symmetric graph.");
+  CUGRAPH_EXPECTS(num_partitions >= 1, "Invalid input argument: num_partitions should be >= 1.");
+  CUGRAPH_EXPECTS(
+    num_partitions <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input argument: num_partitions should fit in vertex_t.");
+  CUGRAPH_EXPECTS(imbalance_tolerance >= 0.0,
+                  "Invalid input argument: imbalance_tolerance should be non-negative.");
+
+  edge_property_t<GraphViewType, weight_t> unit_edge_weights(handle);
+  if (!edge_weight_view) {
+    unit_edge_weights = edge_property_t<GraphViewType, weight_t>(handle, graph_view);
+    fill_edge_property(handle, graph_view, unit_edge_weights.mutable_view(), weight_t{1});
+  }
+  auto weight_view = edge_weight_view ? *edge_weight_view : unit_edge_weights.view();
+
+  auto const total_vertex_weight = graph_view.number_of_vertices();
+  auto const max_partition_weight =
+    std::max(static_cast<vertex_t>(
+               std::ceil((1.0 + imbalance_tolerance) * static_cast<double>(total_vertex_weight) /
+                         static_cast<double>(num_partitions))),
+             vertex_t{1});
+
+  // 1. coarsen (heavy-edge matching & contraction) till the graph is small enough
+
+  auto const coarsest_num_vertices = static_cast<vertex_t>(
+    std::min(num_partitions * multilevel_partition_coarsest_vertices_per_partition,
+             static_cast<size_t>(std::numeric_limits<vertex_t>::max())));
+  auto const max_coarse_vertex_weight = std::max(
+    static_cast<vertex_t>(1.5 * static_cast<double>(total_vertex_weight) / coarsest_num_vertices),
+    vertex_t{1});
+
+  std::vector<graph_t> coarse_graphs{};
+  std::vector<edge_property_t<GraphViewType, weight_t>> coarse_edge_weights{};
+  coarse_graphs.reserve(multilevel_partition_max_levels);
+  coarse_edge_weights.reserve(multilevel_partition_max_levels);
+  std::vector<GraphViewType> level_graph_views{graph_view};
+  std::vector<edge_property_view_t<edge_t, weight_t const*>> level_edge_weight_views{weight_view};
+  std::vector<rmm::device_uvector<vertex_t>> level_vertex_weights{};
+  std::vector<rmm::device_uvector<vertex_t>> level_coarse_labels{};  // to the next level vertices
+
+  level_vertex_weights.emplace_back(graph_view.local_vertex_partition_range_size(),
+                                    handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               level_vertex_weights.back().begin(),
+               level_vertex_weights.back().end(),
+               vertex_t{1});
+
+  while ((level_graph_views.size() < multilevel_partition_max_levels) &&
+         (level_graph_views.back().number_of_vertices() > coarsest_num_vertices)) {
+    auto current_graph_view       = level_graph_views.back();
+    auto current_edge_weight_view = level_edge_weight_views.back();
+    auto const& current_vertex_weights = level_vertex_weights.back();
+
+    edge_src_property_t<GraphViewType, vertex_t> src_vertex_weights(handle, current_graph_view);
+    edge_dst_property_t<GraphViewType, vertex_t> dst_vertex_weights(handle, current_graph_view);
+    update_edge_src_property(handle,
+                             current_graph_view,
+                             current_vertex_weights.begin(),
+                             src_vertex_weights.mutable_view());
+    update_edge_dst_property(handle,
+                             current_graph_view,
+                             current_vertex_weights.begin(),
+                             dst_vertex_weights.mutable_view());
+    edge_property_t<GraphViewType, bool> matchable_edge_mask(handle, current_graph_view);
+    transform_e(handle,
+                current_graph_view,
+                src_vertex_weights.view(),
+                dst_vertex_weights.view(),
+                edge_dummy_property_t{}.view(),
+                is_matchable_edge_t<vertex_t>{max_coarse_vertex_weight},
+                matchable_edge_mask.mutable_view());
+    auto matching_graph_view = current_graph_view;
+    matching_graph_view.attach_edge_mask(matchable_edge_mask.view());
+
+    auto partners = std::get<0>(
+      approximate_weighted_matching(handle, matching_graph_view, current_edge_weight_view));
+
+    rmm::device_uvector<vertex_t> labels(partners.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(current_graph_view.local_vertex_partition_range_first()),
+      thrust::make_counting_iterator(current_graph_view.local_vertex_partition_range_last()),
+      partners.begin(),
+      labels.begin(),
+      [] __device__(vertex_t v, vertex_t partner) {
+        return ((partner == invalid_vertex_id<vertex_t>::value) || (v < partner)) ? v : partner;
+      });
+
+    auto [coarse_graph, coarse_weights] = graph_contraction(
+      handle,
+      current_graph_view,
+      std::make_optional(current_edge_weight_view),
+      raft::device_span<vertex_t>(labels.data(), labels.size()));
+    auto coarse_graph_view = coarse_graph.view();
+    if (coarse_graph_view.number_of_vertices() == current_graph_view.number_of_vertices()) {
+      break;
+    }
+
+    // the weight of a coarse vertex is the sum of the weights of the vertices it contracts
+
+    rmm::device_uvector<vertex_t> coarse_vertex_weights(
+      coarse_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    {
+      rmm::device_uvector<vertex_t> keys(labels.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> values(current_vertex_weights.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), keys.begin());
+      thrust::copy(handle.get_thrust_policy(),
+                   current_vertex_weights.begin(),
+                   current_vertex_weights.end(),
+                   values.begin());
+      if constexpr (multi_gpu) {
+        std::tie(keys, values) =
+          shuffle_int_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+            handle,
+            std::move(keys),
+            std::move(values),
+            coarse_graph_view.vertex_partition_range_lasts());
+      }
+      thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+      // every coarse vertex contracts at least one vertex
+      thrust::reduce_by_key(handle.get_thrust_policy(),
+                            keys.begin(),
+                            keys.end(),
+                            values.begin(),
+                            thrust::make_discard_iterator(),
+                            coarse_vertex_weights.begin());
+    }
+
+    auto num_vertices        = current_graph_view.number_of_vertices();
+    auto num_coarse_vertices = coarse_graph_view.number_of_vertices();
+
+    level_coarse_labels.push_back(std::move(labels));
+    coarse_graphs.push_back(std::move(coarse_graph));
+    coarse_edge_weights.push_back(std::move(*coarse_weights));
+    level_graph_views.push_back(coarse_graphs.back().view());
+    level_edge_weight_views.push_back(coarse_edge_weights.back().view());
+    level_vertex_weights.push_back(std::move(coarse_vertex_weights));
+
+    if (static_cast<double>(num_coarse_vertices) >
+        (1.0 - multilevel_partition_min_coarsening_ratio) * static_cast<double>(num_vertices)) {
+      break;
+    }
+  }
+
+  // 2. initial partitioning of the coarsest graph
+
+  auto partitions = grow_initial_partitions(
+    handle,
+    level_graph_views.back(),
+    level_edge_weight_views.back(),
+    raft::device_span<vertex_t const>(level_vertex_weights.back().data(),
+                                      level_vertex_weights.back().size()),
+    num_partitions,
+    max_partition_weight);
+
+  // 3. refine and project back to the finer graphs
+
+  for (size_t level = level_graph_views.size() - 1;; --level) {
+    refine_partitions(handle,
+                      level_graph_views[level],
+                      level_edge_weight_views[level],
+                      raft::device_span<vertex_t const>(level_vertex_weights[level].data(),
+                                                        level_vertex_weights[level].size()),
+                      raft::device_span<vertex_t>(partitions.data(), partitions.size()),
+                      num_partitions,
+                      max_partition_weight,
+                      max_refinement_iterations);
+    if (level == 0) { break; }
+
+    auto const& labels = level_coarse_labels[level - 1];
+    if constexpr (multi_gpu) {
+      partitions = collect_values_for_int_vertices(
+        handle.get_comms(),
+        labels.begin(),
+        labels.end(),
+        partitions.begin(),
+        level_graph_views[level].vertex_partition_range_lasts(),
+        level_graph_views[level].local_vertex_partition_range_first(),
+        handle.get_stream());
+    } else {
+      rmm::device_uvector<vertex_t> fine_partitions(labels.size(), handle.get_stream());
+      thrust::gather(handle.get_thrust_policy(),
+                     labels.begin(),
+                     labels.end(),
+                     partitions.begin(),
+                     fine_partitions.begin());
+      partitions = std::move(fine_partitions);
+    }
+
+    // the coarser levels are no longer necessary
+    coarse_graphs.pop_back();
+    coarse_edge_weights.pop_back();
+    level_graph_views.pop_back();
+    level_edge_weight_views.pop_back();
+    level_vertex_weights.pop_back();
+    level_coarse_labels.pop_back();
+  }
+
+  // 4. edge cut (every undirected edge is stored in both directions)
+
+  edge_src_property_t<GraphViewType, vertex_t> src_partitions(handle);
+  edge_dst_property_t<GraphViewType, vertex_t> dst_partitions(handle);
+  if constexpr (multi_gpu) {
+    src_partitions = edge_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    dst_partitions = edge_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    update_edge_src_property(handle, graph_view, partitions.begin(), src_partitions.mutable_view());
+    update_edge_dst_property(handle, graph_view, partitions.begin(), dst_partitions.mutable_view());
+  }
+  auto edge_cut =
+    transform_reduce_e(
+      handle,
+      graph_view,
+      multi_gpu
+        ? src_partitions.view()
+        : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(partitions.data()),
+      multi_gpu ? dst_partitions.view()
+                : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(partitions.data(),
+                                                                                vertex_t{0}),
+      weight_view,
+      cut_edge_weight_t<vertex_t, weight_t>{},
+      weight_t{0}) /
+    weight_t{2};
+
+  return std::make_tuple(std::move(partitions), edge_cut);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> multilevel_partition(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_partitions,
+  double imbalance_tolerance,
+  size_t max_refinement_iterations,
+  bool do_expensive_check)
+{
+  return detail::multilevel_partition(handle,
+                                      graph_view,
+                                      edge_weight_view,
+                                      num_partitions,
+                                      imbalance_tolerance,
+                                      max_refinement_iterations,
+                                      do_expensive_check);
+}
+
+}  // namespace cugraph
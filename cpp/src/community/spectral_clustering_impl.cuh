@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/lanczos_eigensolver.cuh"
+#include "prims/count_if_e.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// y = (I + D^{-1/2} A D^{-1/2}) x = (2I - L) x for the normalized Laplacian
+// L = I - D^{-1/2} A D^{-1/2}, the smallest eigenvalues of L are the largest eigenvalues of the
+// operator (which lie in [0, 2]); inverse_sqrt_degrees holds D^{-1/2} (0 for isolated vertices)
+template <typename GraphViewType, typename weight_t>
+struct spectral_clustering_operator_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  raft::handle_t const& handle;
+  GraphViewType const& graph_view;
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view;
+  raft::device_span<weight_t const> inverse_sqrt_degrees;
+  rmm::device_uvector<weight_t>& scaled_x;
+  edge_dst_property_t<GraphViewType, weight_t>& edge_dst_values;
+
+  void operator()(raft::device_span<weight_t const> x, raft::device_span<weight_t> y) const
+  {
+    thrust::transform(handle.get_thrust_policy(),
+                      x.begin(),
+                      x.end(),
+                      inverse_sqrt_degrees.begin(),
+                      scaled_x.begin(),
+                      thrust::multiplies<weight_t>());
+    update_edge_dst_property(handle, graph_view, scaled_x.begin(), edge_dst_values.mutable_view());
+
+    if (edge_weight_view) {
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_values.view(),
+        *edge_weight_view,
+        [] __device__(vertex_t, vertex_t, auto, auto dst_val, weight_t w) { return dst_val * w; },
+        weight_t{0},
+        reduce_op::plus<weight_t>{},
+        y.begin());
+    } else {
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_values.view(),
+        edge_dummy_property_t{}.view(),
+        [] __device__(vertex_t, vertex_t, auto, auto dst_val, auto) { return dst_val; },
+        weight_t{0},
+        reduce_op::plus<weight_t>{},
+        y.begin());
+    }
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(y.size()),
+      [x, y, inverse_sqrt_degrees = inverse_sqrt_degrees] __device__(size_t i) {
+        y[i] = x[i] + inverse_sqrt_degrees[i] * y[i];
+      });
+  }
+};
+
+// squared Euclidean distance from the i'th (local) embedding row to the nearest centroid and the
+// centroid index, the embedding is stored column-major (dimension vectors of size n) and the
+// centroids row-major (num_clusters x dimension)
+template <typename vertex_t, typename weight_t>
+struct kmeans_assign_t {
+  weight_t const* embedding{nullptr};
+  size_t n{};
+  size_t dimension{};
+  weight_t const* centroids{nullptr};
+  size_t num_clusters{};
+  vertex_t* labels{nullptr};
+  weight_t* distances{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    vertex_t nearest{0};
+    auto nearest_distance = std::numeric_limits<weight_t>::max();
+    for (size_t c = 0; c < num_clusters; ++c) {
+      weight_t distance{0.0};
+      for (size_t j = 0; j < dimension; ++j) {
+        auto diff = embedding[j * n + i] - centroids[c * dimension + j];
+        distance += diff * diff;
+      }
+      if (distance < nearest_distance) {
+        nearest          = static_cast<vertex_t>(c);
+        nearest_distance = distance;
+      }
+    }
+    labels[i]    = nearest;
+    distances[i] = nearest_distance;
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct kmeans_accumulate_t {
+  weight_t const* embedding{nullptr};
+  size_t n{};
+  size_t dimension{};
+  vertex_t const* labels{nullptr};
+  weight_t* centroid_sums{nullptr};
+  vertex_t* cluster_sizes{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto c = static_cast<size_t>(labels[i]);
+    for (size_t j = 0; j < dimension; ++j) {
+      cuda::atomic_ref<weight_t, cuda::thread_scope_device> sum(centroid_sums[c * dimension + j]);
+      sum.fetch_add(embedding[j * n + i], cuda::std::memory_order_relaxed);
+    }
+    cuda::atomic_ref<vertex_t, cuda::thread_scope_device> size(cluster_sizes[c]);
+    size.fetch_add(vertex_t{1}, cuda::std::memory_order_relaxed);
+  }
+};
+
+// k-means++ seeding: the first centroid is a uniformly random vertex and every next centroid is a
+// random vertex picked with probability proportional to its squared distance to the nearest
+// centroid picked so far. The pick is a global prefix sum search, every GPU draws the same random
+// number (broadcast from rank 0) and only the GPU owning the picked vertex contributes its row.
+template <typename GraphViewType, typename weight_t>
+rmm::device_uvector<weight_t> kmeans_plus_plus_centroids(raft::handle_t const& handle,
+                                                         raft::random::RngState& rng_state,
+                                                         weight_t const* embedding,
+                                                         size_t n,
+                                                         size_t dimension,
+                                                         size_t num_clusters)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_uvector<weight_t> centroids(num_clusters * dimension, handle.get_stream());
+  rmm::device_uvector<weight_t> min_distances(n, handle.get_stream());
+  rmm::device_uvector<weight_t> distances(n, handle.get_stream());
+  rmm::device_uvector<vertex_t> labels(n, handle.get_stream());
+  rmm::device_uvector<weight_t> d_random(1, handle.get_stream());
+
+  thrust::fill(handle.get_thrust_policy(), min_distances.begin(), min_distances.end(), weight_t{1});
+
+  int comm_rank{0};
+  std::vector<size_t> local_sizes{n};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    comm_rank   = handle.get_comms().get_rank();
+    local_sizes = host_scalar_allgather(handle.get_comms(), n, handle.get_stream());
+  }
+
+  for (size_t c = 0; c < num_clusters; ++c) {
+    weight_t local_sum =
+      thrust::reduce(handle.get_thrust_policy(), min_distances.begin(), min_distances.end());
+    std::vector<weight_t> local_sums{local_sum};
+    if constexpr (GraphViewType::is_multi_gpu) {
+      local_sums = host_scalar_allgather(handle.get_comms(), local_sum, handle.get_stream());
+    }
+
+    detail::uniform_random_fill(
+      handle.get_stream(), d_random.data(), 1, weight_t{0}, weight_t{1}, rng_state);
+    weight_t random{};
+    raft::update_host(&random, d_random.data(), 1, handle.get_stream());
+    handle.sync_stream();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      random = host_scalar_bcast(handle.get_comms(), random, int{0}, handle.get_stream());
+    }
+
+    // every picked vertex has distance 0 to the centroids if the total is 0, pick any vertex then
+    auto total  = std::reduce(local_sums.begin(), local_sums.end());
+    auto target = random * total;
+    int owner{-1};
+    weight_t owner_prefix{0};
+    weight_t prefix{0};
+    for (size_t r = 0; r < local_sums.size(); ++r) {
+      if (local_sizes[r] == 0) { continue; }
+      if ((total > weight_t{0}) && (local_sums[r] == weight_t{0})) { continue; }
+      owner        = static_cast<int>(r);
+      owner_prefix = prefix;
+      if (target < prefix + local_sums[r]) { break; }
+      prefix += local_sums[r];
+    }
+    target -= owner_prefix;
+
+    thrust::fill(handle.get_thrust_policy(),
+                 centroids.begin() + c * dimension,
+                 centroids.begin() + (c + 1) * dimension,
+                 weight_t{0});
+    if (owner == comm_rank) {
+      thrust::inclusive_scan(
+        handle.get_thrust_policy(), min_distances.begin(), min_distances.end(), distances.begin());
+      auto picked = static_cast<size_t>(thrust::distance(
+        distances.begin(),
+        thrust::upper_bound(
+          handle.get_thrust_policy(), distances.begin(), distances.end(), target)));
+      picked = std::min(picked, n - 1);
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(dimension),
+        [embedding, n, picked, centroid = centroids.data() + c * dimension] __device__(size_t j) {
+          centroid[j] = embedding[j * n + picked];
+        });
+    }
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       centroids.data() + c * dimension,
+                       centroids.data() + c * dimension,
+                       dimension,
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    if (c + 1 < num_clusters) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(n),
+                       kmeans_assign_t<vertex_t, weight_t>{embedding,
+                                                           n,
+                                                           dimension,
+                                                           centroids.data() + c * dimension,
+                                                           size_t{1},
+                                                           labels.data(),
+                                                           distances.data()});
+      if (c == 0) {
+        thrust::copy(
+          handle.get_thrust_policy(), distances.begin(), distances.end(), min_distances.begin());
+      } else {
+        thrust::transform(handle.get_thrust_policy(),
+                          distances.begin(),
+                          distances.end(),
+                          min_distances.begin(),
+                          min_distances.begin(),
+                          thrust::minimum<weight_t>());
+      }
+    }
+  }
+
+  return centroids;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> spectral_clustering(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t eigenvalue_tolerance,
+  size_t max_eigensolver_operator_applications,
+  weight_t kmeans_tolerance,
+  size_t max_kmeans_iterations,
+  bool do_expensive_check)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: spectral clustering requires a symmetric graph.");
+  CUGRAPH_EXPECTS((num_clusters > 0) && (num_eigenvectors > 0) &&
+                    (num_clusters <= static_cast<size_t>(graph_view.number_of_vertices())) &&
+                    (num_eigenvectors <= static_cast<size_t>(graph_view.number_of_vertices())),
+                  "Invalid input argument: num_clusters and num_eigenvectors should be in "
+                  "[1, graph_view.number_of_vertices()].");
+
+  if (do_expensive_check) {
+    if (edge_weight_view) {
+      auto num_negative_edge_weights =
+        count_if_e(handle,
+                   graph_view,
+                   edge_src_dummy_property_t{}.view(),
+                   edge_dst_dummy_property_t{}.view(),
+                   *edge_weight_view,
+                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                      "Invalid input argument: input edge weights should be non-negative.");
+    }
+  }
+
+  auto const n = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  // 1. D^{-1/2}
+
+  rmm::device_uvector<weight_t> inverse_sqrt_degrees(n, handle.get_stream());
+  if (edge_weight_view) {
+    inverse_sqrt_degrees = compute_out_weight_sums(handle, graph_view, *edge_weight_view);
+  } else {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    thrust::transform(handle.get_thrust_policy(),
+                      degrees.begin(),
+                      degrees.end(),
+                      inverse_sqrt_degrees.begin(),
+                      [] __device__(edge_t d) { return static_cast<weight_t>(d); });
+  }
+  thrust::transform(
+    handle.get_thrust_policy(),
+    inverse_sqrt_degrees.begin(),
+    inverse_sqrt_degrees.end(),
+    inverse_sqrt_degrees.begin(),
+    [] __device__(weight_t d) { return d > weight_t{0} ? weight_t{1} / sqrt(d) : weight_t{0}; });
+
+  // 2. embedding: the eigenvectors of the num_eigenvectors smallest normalized Laplacian
+  // eigenvalues (computed with Lanczos on the implicit operator, the Laplacian is never
+  // materialized), with the rows normalized to unit length (Ng, Jordan & Weiss)
+
+  rmm::device_uvector<weight_t> embedding(num_eigenvectors * n, handle.get_stream());
+  detail::uniform_random_fill(handle.get_stream(),
+                              embedding.data(),
+                              embedding.size(),
+                              weight_t{-1},
+                              weight_t{1},
+                              rng_state);
+  {
+    rmm::device_uvector<weight_t> scaled_x(n, handle.get_stream());
+    edge_dst_property_t<GraphViewType, weight_t> edge_dst_values(handle, graph_view);
+    lanczos_largest_eigenpairs(
+      handle,
+      graph_view,
+      spectral_clustering_operator_t<GraphViewType, weight_t>{
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<weight_t const>(inverse_sqrt_degrees.data(), n),
+        scaled_x,
+        edge_dst_values},
+      raft::device_span<weight_t>(embedding.data(), embedding.size()),
+      num_eigenvectors,
+      eigenvalue_tolerance,
+      max_eigensolver_operator_applications,
+      std::max(size_t{32}, 2 * num_eigenvectors));
+  }
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(n),
+                   [embedding = embedding.data(), n, num_eigenvectors] __device__(size_t i) {
+                     weight_t norm{0.0};
+                     for (size_t j = 0; j < num_eigenvectors; ++j) {
+                       norm += embedding[j * n + i] * embedding[j * n + i];
+                     }
+                     if (norm > weight_t{0}) {
+                       norm = sqrt(norm);
+                       for (size_t j = 0; j < num_eigenvectors; ++j) {
+                         embedding[j * n + i] /= norm;
+                       }
+                     }
+                   });
+
+  // 3. k-means (Lloyd iterations, the local embedding rows stay on their GPU and only the
+  // num_clusters x num_eigenvectors centroid sums are allreduced)
+
+  auto centroids = kmeans_plus_plus_centroids<GraphViewType>(
+    handle, rng_state, embedding.data(), n, num_eigenvectors, num_clusters);
+
+  rmm::device_uvector<vertex_t> labels(n, handle.get_stream());
+  rmm::device_uvector<weight_t> distances(n, handle.get_stream());
+  rmm::device_uvector<weight_t> centroid_sums(centroids.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> cluster_sizes(num_clusters, handle.get_stream());
+
+  auto previous_inertia = std::numeric_limits<weight_t>::max();
+  for (size_t iter = 0; iter < max_kmeans_iterations; ++iter) {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(n),
+                     kmeans_assign_t<vertex_t, weight_t>{embedding.data(),
+                                                         n,
+                                                         num_eigenvectors,
+                                                         centroids.data(),
+                                                         num_clusters,
+                                                         labels.data(),
+                                                         distances.data()});
+    auto inertia = thrust::reduce(handle.get_thrust_policy(), distances.begin(), distances.end());
+    if constexpr (multi_gpu) {
+      inertia = host_scalar_allreduce(
+        handle.get_comms(), inertia, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (previous_inertia - inertia <= kmeans_tolerance * inertia) { break; }
+    previous_inertia = inertia;
+
+    thrust::fill(
+      handle.get_thrust_policy(), centroid_sums.begin(), centroid_sums.end(), weight_t{0});
+    thrust::fill(
+      handle.get_thrust_policy(), cluster_sizes.begin(), cluster_sizes.end(), vertex_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(n),
+                     kmeans_accumulate_t<vertex_t, weight_t>{embedding.data(),
+                                                             n,
+                                                             num_eigenvectors,
+                                                             labels.data(),
+                                                             centroid_sums.data(),
+                                                             cluster_sizes.data()});
+    if constexpr (multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       centroid_sums.data(),
+                       centroid_sums.data(),
+                       centroid_sums.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       cluster_sizes.data(),
+                       cluster_sizes.data(),
+                       cluster_sizes.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    // an empty cluster keeps its centroid
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(centroids.size()),
+                     [centroids     = centroids.data(),
+                      centroid_sums = centroid_sums.data(),
+                      cluster_sizes = cluster_sizes.data(),
+                      num_eigenvectors] __device__(size_t i) {
+                       auto size = cluster_sizes[i / num_eigenvectors];
+                       if (size > 0) {
+                         centroids[i] = centroid_sums[i] / static_cast<weight_t>(size);
+                       }
+                     });
+  }
+
+  return labels;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> spectral_clustering(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  weight_t eigenvalue_tolerance,
+  size_t max_eigensolver_operator_applications,
+  weight_t kmeans_tolerance,
+  size_t max_kmeans_iterations,
+  bool do_expensive_check)
+{
+  return detail::spectral_clustering(handle,
+                                     rng_state,
+                                     graph_view,
+                                     edge_weight_view,
+                                     num_clusters,
+                                     num_eigenvectors,
+                                     eigenvalue_tolerance,
+                                     max_eigensolver_operator_applications,
+                                     kmeans_tolerance,
+                                     max_kmeans_iterations,
+                                     do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "community/spectral_clustering_impl.cuh"
+
+namespace cugraph {
+
+// Explicit template instantations
+
+template rmm::device_uvector<int64_t> spectral_clustering(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  float eigenvalue_tolerance,
+  size_t max_eigensolver_operator_applications,
+  float kmeans_tolerance,
+  size_t max_kmeans_iterations,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int64_t> spectral_clustering(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  size_t num_clusters,
+  size_t num_eigenvectors,
+  double eigenvalue_tolerance,
+  size_t max_eigensolver_operator_applications,
+  double kmeans_tolerance,
+  size_t max_kmeans_iterations,
+  bool do_expensive_check);
+
+}  // namespace cugraph
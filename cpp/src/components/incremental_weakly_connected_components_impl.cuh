@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// Concurrent union-find over [0, # elements) (parents[i] == i for roots). Roots are always hooked
+// under smaller roots (so the final root of a set is its smallest element regardless of the order
+// the unions are applied) and find compresses the traversed paths by path halving.
+template <typename index_t>
+struct union_find_t {
+  index_t* parents{};
+
+  __device__ index_t find(index_t i) const
+  {
+    while (true) {
+      auto p = cuda::atomic_ref<index_t, cuda::thread_scope_device>(parents[i]).load(
+        cuda::std::memory_order_relaxed);
+      if (p == i) { return i; }
+      auto gp = cuda::atomic_ref<index_t, cuda::thread_scope_device>(parents[p]).load(
+        cuda::std::memory_order_relaxed);
+      if (gp != p) {
+        cuda::atomic_ref<index_t, cuda::thread_scope_device>(parents[i]).compare_exchange_strong(
+          p, gp, cuda::std::memory_order_relaxed);
+      }
+      i = gp;
+    }
+  }
+
+  __device__ void operator()(thrust::tuple<index_t, index_t> pair) const
+  {
+    auto u = find(thrust::get<0>(pair));
+    auto v = find(thrust::get<1>(pair));
+    while (u != v) {
+      if (u < v) {
+        auto tmp = u;
+        u        = v;
+        v        = tmp;
+      }
+      auto expected = u;
+      if (cuda::atomic_ref<index_t, cuda::thread_scope_device>(parents[u]).compare_exchange_strong(
+            expected, v, cuda::std::memory_order_relaxed)) {
+        break;
+      }
+      u = find(u);
+      v = find(v);
+    }
+  }
+};
+
+template <typename index_t>
+struct union_find_root_t {
+  union_find_t<index_t> union_find{};
+
+  __device__ index_t operator()(index_t i) const { return union_find.find(i); }
+};
+
+template <typename vertex_t>
+struct link_components_t {
+  raft::device_span<vertex_t const> sorted_unique_components{};
+  raft::device_span<vertex_t const> roots{};
+
+  __device__ vertex_t operator()(vertex_t c) const
+  {
+    auto it = thrust::lower_bound(
+      thrust::seq, sorted_unique_components.begin(), sorted_unique_components.end(), c);
+    if ((it == sorted_unique_components.end()) || (*it != c)) { return c; }
+    return sorted_unique_components[roots[thrust::distance(sorted_unique_components.begin(), it)]];
+  }
+};
+
+template <typename GraphViewType>
+void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> new_edge_srcs,
+  raft::device_span<typename GraphViewType::vertex_type const> new_edge_dsts,
+  raft::device_span<typename GraphViewType::vertex_type> components,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const local_size   = graph_view.local_vertex_partition_range_size();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(new_edge_srcs.size() == new_edge_dsts.size(),
+                  "Invalid input argument: new_edge_srcs and new_edge_dsts should have the same "
+                  "size.");
+  CUGRAPH_EXPECTS(components.size() == static_cast<size_t>(local_size),
+                  "Invalid input argument: components size should match the local vertex "
+                  "partition range size.");
+
+  if (do_expensive_check) {
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(new_edge_srcs.begin(), new_edge_dsts.begin()));
+    auto num_invalid_edges =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_first,
+                       edge_first + new_edge_srcs.size(),
+                       [num_vertices] __device__(auto e) {
+                         auto src = thrust::get<0>(e);
+                         auto dst = thrust::get<1>(e);
+                         return (src < 0) || (src >= num_vertices) || (dst < 0) ||
+                                (dst >= num_vertices);
+                       });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_edges = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_edges, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid input argument: new edges have invalid vertex IDs.");
+  }
+
+  if (num_vertices == 0) { return; }
+
+  // 2. find the component IDs of the new edge end points
+
+  rmm::device_uvector<vertex_t> src_components(new_edge_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dst_components(new_edge_dsts.size(), handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                          = handle.get_comms();
+    auto h_vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    src_components =
+      collect_values_for_int_vertices(comm,
+                                      new_edge_srcs.begin(),
+                                      new_edge_srcs.end(),
+                                      components.begin(),
+                                      h_vertex_partition_range_lasts,
+                                      graph_view.local_vertex_partition_range_first(),
+                                      handle.get_stream());
+    dst_components =
+      collect_values_for_int_vertices(comm,
+                                      new_edge_dsts.begin(),
+                                      new_edge_dsts.end(),
+                                      components.begin(),
+                                      h_vertex_partition_range_lasts,
+                                      graph_view.local_vertex_partition_range_first(),
+                                      handle.get_stream());
+  } else {
+    thrust::gather(handle.get_thrust_policy(),
+                   new_edge_srcs.begin(),
+                   new_edge_srcs.end(),
+                   components.begin(),
+                   src_components.begin());
+    thrust::gather(handle.get_thrust_policy(),
+                   new_edge_dsts.begin(),
+                   new_edge_dsts.end(),
+                   components.begin(),
+                   dst_components.begin());
+  }
+
+  // 3. keep only the new edges linking two different components (as unique pairs in the lower
+  // triangular part), these are typically far fewer than the new edges
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(src_components.begin(), dst_components.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    pair_first,
+                    pair_first + src_components.size(),
+                    pair_first,
+                    [] __device__(auto pair) {
+                      auto c0 = thrust::get<0>(pair);
+                      auto c1 = thrust::get<1>(pair);
+                      return c0 >= c1 ? thrust::make_tuple(c0, c1) : thrust::make_tuple(c1, c0);
+                    });
+  src_components.resize(
+    thrust::distance(pair_first,
+                     thrust::remove_if(handle.get_thrust_policy(),
+                                       pair_first,
+                                       pair_first + src_components.size(),
+                                       [] __device__(auto pair) {
+                                         return thrust::get<0>(pair) == thrust::get<1>(pair);
+                                       })),
+    handle.get_stream());
+  dst_components.resize(src_components.size(), handle.get_stream());
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + src_components.size());
+  src_components.resize(
+    thrust::distance(
+      pair_first,
+      thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + src_components.size())),
+    handle.get_stream());
+  dst_components.resize(src_components.size(), handle.get_stream());
+
+  // 4. every GPU runs union-find on the (replicated) component links; the union-find is
+  // deterministic in its output, so every GPU computes the same component ID mapping and no
+  // additional communication is necessary to relabel
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm     = handle.get_comms();
+    src_components = cugraph::device_allgatherv(
+      handle,
+      comm,
+      raft::device_span<vertex_t const>(src_components.data(), src_components.size()));
+    dst_components = cugraph::device_allgatherv(
+      handle,
+      comm,
+      raft::device_span<vertex_t const>(dst_components.data(), dst_components.size()));
+  }
+  if (src_components.size() == 0) { return; }
+
+  rmm::device_uvector<vertex_t> sorted_unique_components(src_components.size() * 2,
+                                                         handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               src_components.begin(),
+               src_components.end(),
+               sorted_unique_components.begin());
+  thrust::copy(handle.get_thrust_policy(),
+               dst_components.begin(),
+               dst_components.end(),
+               sorted_unique_components.begin() + src_components.size());
+  thrust::sort(
+    handle.get_thrust_policy(), sorted_unique_components.begin(), sorted_unique_components.end());
+  sorted_unique_components.resize(
+    thrust::distance(sorted_unique_components.begin(),
+                     thrust::unique(handle.get_thrust_policy(),
+                                    sorted_unique_components.begin(),
+                                    sorted_unique_components.end())),
+    handle.get_stream());
+
+  // convert the component IDs to indices in sorted_unique_components
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      sorted_unique_components.begin(),
+                      sorted_unique_components.end(),
+                      src_components.begin(),
+                      src_components.end(),
+                      src_components.begin());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      sorted_unique_components.begin(),
+                      sorted_unique_components.end(),
+                      dst_components.begin(),
+                      dst_components.end(),
+                      dst_components.begin());
+
+  rmm::device_uvector<vertex_t> parents(sorted_unique_components.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), parents.begin(), parents.end(), vertex_t{0});
+  union_find_t<vertex_t> union_find{parents.data()};
+  pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(src_components.begin(), dst_components.begin()));
+  thrust::for_each(
+    handle.get_thrust_policy(), pair_first, pair_first + src_components.size(), union_find);
+  src_components.resize(0, handle.get_stream());
+  dst_components.resize(0, handle.get_stream());
+  src_components.shrink_to_fit(handle.get_stream());
+  dst_components.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> roots(parents.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(static_cast<vertex_t>(parents.size())),
+                    roots.begin(),
+                    union_find_root_t<vertex_t>{union_find});
+
+  // 5. relabel
+
+  thrust::transform(handle.get_thrust_policy(),
+                    components.begin(),
+                    components.end(),
+                    components.begin(),
+                    link_components_t<vertex_t>{
+                      raft::device_span<vertex_t const>(sorted_unique_components.data(),
+                                                        sorted_unique_components.size()),
+                      raft::device_span<vertex_t const>(roots.data(), roots.size())});
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void incremental_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> new_edge_srcs,
+  raft::device_span<vertex_t const> new_edge_dsts,
+  raft::device_span<vertex_t> components,
+  bool do_expensive_check)
+{
+  detail::incremental_weakly_connected_components(
+    handle, graph_view, new_edge_srcs, new_edge_dsts, components, do_expensive_check);
+}
+
+}  // namespace cugraph
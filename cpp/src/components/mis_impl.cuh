@@ -16,11 +16,13 @@
  */
 #pragma once
 
+#include "detail/residual_subgraph.cuh"
 #include "prims/fill_edge_src_dst_property.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/edge_property.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_functions.hpp>
@@ -297,6 +299,115 @@ rmm::device_uvector<vertex_t> maximal_independent_set(
     }
 
     if (nr_remaining_vertices_to_check == 0) { break; }
+
+    if (switch_to_tail(static_cast<size_t>(nr_remaining_vertices_to_check),
+                       static_cast<size_t>(graph_view.number_of_vertices()))) {
+      //
+      // Few vertices remain, discard the ones with a neighbor in MIS and find a MIS of the
+      // subgraph induced by the rest on a single GPU
+      //
+
+      edge_src_property_t<GraphViewType, vertex_t> src_rank_cache(handle);
+      edge_dst_property_t<GraphViewType, vertex_t> dst_rank_cache(handle);
+      if constexpr (multi_gpu) {
+        src_rank_cache = edge_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+        dst_rank_cache = edge_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+        update_edge_src_property(handle, graph_view, ranks.begin(), src_rank_cache.mutable_view());
+        update_edge_dst_property(handle, graph_view, ranks.begin(), dst_rank_cache.mutable_view());
+      }
+
+      rmm::device_uvector<vertex_t> max_neighbor_ranks(local_vtx_partitoin_size,
+                                                       handle.get_stream());
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        multi_gpu ? src_rank_cache.view()
+                  : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(ranks.data()),
+        multi_gpu ? dst_rank_cache.view()
+                  : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(ranks.data(),
+                                                                                  vertex_t{0}),
+        edge_dummy_property_t{}.view(),
+        [] __device__(auto src, auto dst, auto src_rank, auto dst_rank, auto wt) {
+          return dst_rank;
+        },
+        std::numeric_limits<vertex_t>::lowest(),
+        cugraph::reduce_op::maximum<vertex_t>{},
+        max_neighbor_ranks.begin());
+
+      rmm::device_uvector<vertex_t> max_incoming_ranks(local_vtx_partitoin_size,
+                                                       handle.get_stream());
+      per_v_transform_reduce_incoming_e(
+        handle,
+        graph_view,
+        multi_gpu ? src_rank_cache.view()
+                  : detail::edge_major_property_view_t<vertex_t, vertex_t const*>(ranks.data()),
+        multi_gpu ? dst_rank_cache.view()
+                  : detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(ranks.data(),
+                                                                                  vertex_t{0}),
+        edge_dummy_property_t{}.view(),
+        [] __device__(auto src, auto dst, auto src_rank, auto dst_rank, auto wt) {
+          return src_rank;
+        },
+        std::numeric_limits<vertex_t>::lowest(),
+        cugraph::reduce_op::maximum<vertex_t>{},
+        max_incoming_ranks.begin());
+
+      thrust::transform(handle.get_thrust_policy(),
+                        max_incoming_ranks.begin(),
+                        max_incoming_ranks.end(),
+                        max_neighbor_ranks.begin(),
+                        max_neighbor_ranks.begin(),
+                        thrust::maximum<vertex_t>());
+
+      remaining_vertices.resize(
+        thrust::distance(
+          remaining_vertices.begin(),
+          thrust::remove_if(
+            handle.get_thrust_policy(),
+            remaining_vertices.begin(),
+            remaining_vertices.end(),
+            [max_neighbor_ranks =
+               raft::device_span<vertex_t const>(max_neighbor_ranks.data(),
+                                                 max_neighbor_ranks.size()),
+             v_first = graph_view.local_vertex_partition_range_first()] __device__(auto v) {
+              return max_neighbor_ranks[v - v_first] >= std::numeric_limits<vertex_t>::max();
+            })),
+        handle.get_stream());
+
+      auto residual_graph = gather_induced_subgraph<vertex_t, edge_t, float, multi_gpu>(
+        handle,
+        graph_view,
+        std::nullopt,
+        raft::device_span<vertex_t const>(remaining_vertices.data(), remaining_vertices.size()));
+
+      rmm::device_uvector<vertex_t> tail_mis(0, handle.get_stream());
+      if (residual_graph) {
+        auto& [subgraph, subgraph_weights, renumber_map] = *residual_graph;
+        tail_mis = maximal_independent_set<vertex_t, edge_t, false>(
+          handle, subgraph.view(), rng_state);
+        thrust::transform(handle.get_thrust_policy(),
+                          tail_mis.begin(),
+                          tail_mis.end(),
+                          tail_mis.begin(),
+                          [renumber_map = renumber_map.data()] __device__(vertex_t v) {
+                            return renumber_map[v];
+                          });
+      }
+      if constexpr (multi_gpu) {
+        tail_mis = shuffle_int_vertices_to_local_gpu_by_vertex_partitioning(
+          handle, std::move(tail_mis), graph_view.vertex_partition_range_lasts());
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        tail_mis.begin(),
+        tail_mis.end(),
+        [ranks   = raft::device_span<vertex_t>(ranks.data(), ranks.size()),
+         v_first = graph_view.local_vertex_partition_range_first()] __device__(auto v) {
+          ranks[v - v_first] = std::numeric_limits<vertex_t>::max();
+        });
+      break;
+    }
   }
 
   // Count number of vertices included in MIS
@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/per_v_transform_reduce_if_incoming_outgoing_e.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/update_v_frontier.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace {
+
+// colors of the vertices already assigned to a component are set to invalid_vertex_id
+template <typename vertex_t, typename edge_t>
+struct active_edge_count_e_op_t {
+  __device__ edge_t operator()(
+    vertex_t src, vertex_t dst, vertex_t src_color, vertex_t dst_color, cuda::std::nullopt_t) const
+  {
+    return ((src != dst) && (src_color != invalid_vertex_id<vertex_t>::value) &&
+            (dst_color != invalid_vertex_id<vertex_t>::value))
+             ? edge_t{1}
+             : edge_t{0};
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_trimmable_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, edge_t, edge_t> color_out_in_degree) const
+  {
+    return (thrust::get<0>(color_out_in_degree) != invalid_vertex_id<vertex_t>::value) &&
+           ((thrust::get<1>(color_out_in_degree) == edge_t{0}) ||
+            (thrust::get<2>(color_out_in_degree) == edge_t{0}));
+  }
+};
+
+template <typename vertex_t, typename component_t>
+struct component_to_color_t {
+  __device__ vertex_t operator()(vertex_t v, component_t c) const
+  {
+    return c == invalid_component_id<component_t>::value ? v : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct forward_color_e_op_t {
+  __device__ cuda::std::optional<vertex_t> operator()(
+    vertex_t src, vertex_t dst, vertex_t src_color, vertex_t dst_color, cuda::std::nullopt_t) const
+  {
+    // dst_color can be stale (smaller than the current value), this only results in redundant
+    // pushes that are filtered out in update_v_frontier
+    return ((dst_color != invalid_vertex_id<vertex_t>::value) && (src_color > dst_color))
+             ? cuda::std::optional<vertex_t>{src_color}
+             : cuda::std::nullopt;
+  }
+};
+
+template <typename vertex_t>
+struct backward_reach_e_op_t {
+  __device__ vertex_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 vertex_t src_color,
+                                 vertex_t dst_component,
+                                 cuda::std::nullopt_t) const
+  {
+    return src_color;
+  }
+};
+
+template <typename vertex_t>
+struct backward_reach_pred_op_t {
+  __device__ bool operator()(vertex_t src,
+                             vertex_t dst,
+                             vertex_t src_color,
+                             vertex_t dst_component,
+                             cuda::std::nullopt_t) const
+  {
+    return dst_component == src_color;
+  }
+};
+
+template <typename GraphViewType, typename vertex_t = typename GraphViewType::vertex_type>
+void reset_colors(raft::handle_t const& handle,
+                  GraphViewType const& graph_view,
+                  vertex_t const* components,
+                  raft::device_span<vertex_t> colors,
+                  edge_src_property_t<GraphViewType, vertex_t>& edge_src_colors,
+                  edge_dst_property_t<GraphViewType, vertex_t>& edge_dst_colors)
+{
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+                    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+                    components,
+                    colors.begin(),
+                    component_to_color_t<vertex_t, vertex_t>{});
+  update_edge_src_property(handle, graph_view, colors.begin(), edge_src_colors.mutable_view());
+  update_edge_dst_property(handle, graph_view, colors.begin(), edge_dst_colors.mutable_view());
+}
+
+template <typename GraphViewType>
+void strongly_connected_components_impl(raft::handle_t const& handle,
+                                        GraphViewType const& graph_view,
+                                        typename GraphViewType::vertex_type* components,
+                                        bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // implements the coloring based method (with trimming) in
+  // S. Orzan, "On distributed verification and verified distribution," 2004 and
+  // S. Hong, N. C. Rodia, and K. Olukotun, "On fast parallel detection of strongly connected
+  // components (SCC) in small-world graphs," 2013.
+
+  auto constexpr invalid_component = invalid_component_id<vertex_t>::value;
+  auto constexpr invalid_color     = invalid_vertex_id<vertex_t>::value;
+
+  // 1. check input arguments
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. initialize components
+
+  thrust::fill(handle.get_thrust_policy(),
+               components,
+               components + graph_view.local_vertex_partition_range_size(),
+               invalid_component);
+
+  if (graph_view.number_of_vertices() == 0) { return; }
+
+  rmm::device_uvector<vertex_t> colors(graph_view.local_vertex_partition_range_size(),
+                                       handle.get_stream());
+
+  edge_src_property_t<GraphViewType, vertex_t> edge_src_colors(handle, graph_view);
+  edge_dst_property_t<GraphViewType, vertex_t> edge_dst_colors(handle, graph_view);
+  edge_dst_property_t<GraphViewType, vertex_t> edge_dst_components(handle, graph_view);
+
+  auto aggregate_count = [&](vertex_t local_count) {
+    if constexpr (GraphViewType::is_multi_gpu) {
+      local_count = host_scalar_allreduce(
+        handle.get_comms(), local_count, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    return local_count;
+  };
+
+  auto aggregate_num_active_vertices = graph_view.number_of_vertices();
+
+  constexpr size_t bucket_idx_cur  = 0;
+  constexpr size_t bucket_idx_next = 1;
+  constexpr size_t num_buckets     = 2;
+
+  while (aggregate_num_active_vertices > 0) {
+    // 3. trim vertices with no active incoming or outgoing edges (each of these vertices forms a
+    // singleton component), repeat while trimming removes a meaningful fraction of the remaining
+    // vertices (the remainders are still correctly handled by the coloring step)
+
+    while (true) {
+      reset_colors(handle,
+                   graph_view,
+                   components,
+                   raft::device_span<vertex_t>(colors.data(), colors.size()),
+                   edge_src_colors,
+                   edge_dst_colors);
+
+      rmm::device_uvector<edge_t> out_degrees(graph_view.local_vertex_partition_range_size(),
+                                              handle.get_stream());
+      rmm::device_uvector<edge_t> in_degrees(graph_view.local_vertex_partition_range_size(),
+                                             handle.get_stream());
+      per_v_transform_reduce_outgoing_e(handle,
+                                        graph_view,
+                                        edge_src_colors.view(),
+                                        edge_dst_colors.view(),
+                                        edge_dummy_property_t{}.view(),
+                                        active_edge_count_e_op_t<vertex_t, edge_t>{},
+                                        edge_t{0},
+                                        reduce_op::plus<edge_t>{},
+                                        out_degrees.begin());
+      per_v_transform_reduce_incoming_e(handle,
+                                        graph_view,
+                                        edge_src_colors.view(),
+                                        edge_dst_colors.view(),
+                                        edge_dummy_property_t{}.view(),
+                                        active_edge_count_e_op_t<vertex_t, edge_t>{},
+                                        edge_t{0},
+                                        reduce_op::plus<edge_t>{},
+                                        in_degrees.begin());
+
+      auto num_trimmed = static_cast<vertex_t>(thrust::count_if(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(colors.begin(), out_degrees.begin(), in_degrees.begin()),
+        thrust::make_zip_iterator(colors.end(), out_degrees.end(), in_degrees.end()),
+        is_trimmable_t<vertex_t, edge_t>{}));
+      thrust::transform_if(
+        handle.get_thrust_policy(),
+        colors.begin(),
+        colors.end(),
+        thrust::make_zip_iterator(colors.begin(), out_degrees.begin(), in_degrees.begin()),
+        components,
+        thrust::identity<vertex_t>{},
+        is_trimmable_t<vertex_t, edge_t>{});
+
+      auto aggregate_num_trimmed = aggregate_count(num_trimmed);
+      aggregate_num_active_vertices -= aggregate_num_trimmed;
+      if ((aggregate_num_trimmed == 0) ||
+          (aggregate_num_trimmed * vertex_t{20} /* tuning parameter */ <
+           aggregate_num_active_vertices)) {
+        break;
+      }
+    }
+    if (aggregate_num_active_vertices == 0) { break; }
+
+    reset_colors(handle,
+                 graph_view,
+                 components,
+                 raft::device_span<vertex_t>(colors.data(), colors.size()),
+                 edge_src_colors,
+                 edge_dst_colors);
+
+    // 4. forward coloring, color of a vertex becomes the largest vertex ID of the active vertices
+    // that can reach the vertex
+
+    {
+      vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(
+        handle, num_buckets);
+      {
+        rmm::device_uvector<vertex_t> active_vertices(colors.size(), handle.get_stream());
+        active_vertices.resize(
+          thrust::distance(active_vertices.begin(),
+                           thrust::copy_if(handle.get_thrust_policy(),
+                                           colors.begin(),
+                                           colors.end(),
+                                           active_vertices.begin(),
+                                           detail::is_not_equal_t<vertex_t>{invalid_color})),
+          handle.get_stream());
+        vertex_frontier.bucket(bucket_idx_cur) =
+          key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
+            handle, std::move(active_vertices));
+      }
+
+      while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+        auto [new_frontier_vertex_buffer, color_buffer] =
+          cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(bucket_idx_cur),
+            edge_src_colors.view(),
+            edge_dst_colors.view(),
+            edge_dummy_property_t{}.view(),
+            forward_color_e_op_t<vertex_t>{},
+            reduce_op::maximum<vertex_t>());
+
+        update_v_frontier(handle,
+                          graph_view,
+                          std::move(new_frontier_vertex_buffer),
+                          std::move(color_buffer),
+                          vertex_frontier,
+                          std::vector<size_t>{bucket_idx_next},
+                          colors.begin(),
+                          colors.begin(),
+                          [] __device__(auto v, auto v_val, auto pushed_val) {
+                            auto update = (v_val != invalid_color) && (pushed_val > v_val);
+                            return thrust::make_tuple(
+                              update ? cuda::std::optional<size_t>{bucket_idx_next}
+                                     : cuda::std::nullopt,
+                              update ? cuda::std::optional<vertex_t>{pushed_val}
+                                     : cuda::std::nullopt);
+                          });
+
+        vertex_frontier.bucket(bucket_idx_cur).clear();
+        vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+        vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+
+        update_edge_src_property(handle,
+                                 graph_view,
+                                 vertex_frontier.bucket(bucket_idx_cur).begin(),
+                                 vertex_frontier.bucket(bucket_idx_cur).end(),
+                                 colors.begin(),
+                                 edge_src_colors.mutable_view());
+        update_edge_dst_property(handle,
+                                 graph_view,
+                                 vertex_frontier.bucket(bucket_idx_cur).begin(),
+                                 vertex_frontier.bucket(bucket_idx_cur).end(),
+                                 colors.begin(),
+                                 edge_dst_colors.mutable_view());
+      }
+    }
+
+    // 5. backward reachability, a vertex with color c belongs to the component rooted at the vertex
+    // c (whose color is c by construction) if the vertex can reach c; the vertices on any path
+    // from the vertex to c also have color c, so we only need to traverse the vertices with color c
+
+    rmm::device_uvector<vertex_t> candidates(colors.size(), handle.get_stream());
+    {
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+        colors.begin());
+      thrust::transform_if(
+        handle.get_thrust_policy(),
+        colors.begin(),
+        colors.end(),
+        pair_first,
+        components,
+        thrust::identity<vertex_t>{},
+        [] __device__(auto pair) { return thrust::get<0>(pair) == thrust::get<1>(pair); });
+      candidates.resize(
+        thrust::distance(
+          candidates.begin(),
+          thrust::copy_if(
+            handle.get_thrust_policy(),
+            thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+            thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+            pair_first,
+            candidates.begin(),
+            [] __device__(auto pair) {
+              return (thrust::get<1>(pair) != invalid_color) &&
+                     (thrust::get<0>(pair) != thrust::get<1>(pair));
+            })),
+        handle.get_stream());
+    }
+    auto aggregate_num_roots =
+      aggregate_num_active_vertices - aggregate_count(static_cast<vertex_t>(candidates.size()));
+    aggregate_num_active_vertices -= aggregate_num_roots;
+
+    update_edge_src_property(handle, graph_view, colors.begin(), edge_src_colors.mutable_view());
+    update_edge_dst_property(handle, graph_view, components, edge_dst_components.mutable_view());
+
+    while (true) {
+      rmm::device_uvector<vertex_t> reached_colors(candidates.size(), handle.get_stream());
+      {
+        key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> candidate_bucket(
+          handle, raft::device_span<vertex_t const>(candidates.data(), candidates.size()));
+        per_v_transform_reduce_if_outgoing_e(handle,
+                                             graph_view,
+                                             candidate_bucket,
+                                             edge_src_colors.view(),
+                                             edge_dst_components.view(),
+                                             edge_dummy_property_t{}.view(),
+                                             backward_reach_e_op_t<vertex_t>{},
+                                             invalid_color,
+                                             reduce_op::any<vertex_t>(),
+                                             backward_reach_pred_op_t<vertex_t>{},
+                                             reached_colors.begin());
+      }
+
+      thrust::scatter_if(
+        handle.get_thrust_policy(),
+        reached_colors.begin(),
+        reached_colors.end(),
+        thrust::make_transform_iterator(
+          candidates.begin(),
+          detail::shift_left_t<vertex_t>{graph_view.local_vertex_partition_range_first()}),
+        reached_colors.begin(),
+        components,
+        detail::is_not_equal_t<vertex_t>{invalid_color});
+
+      rmm::device_uvector<vertex_t> new_members(candidates.size(), handle.get_stream());
+      new_members.resize(
+        thrust::distance(new_members.begin(),
+                         thrust::copy_if(handle.get_thrust_policy(),
+                                         candidates.begin(),
+                                         candidates.end(),
+                                         reached_colors.begin(),
+                                         new_members.begin(),
+                                         detail::is_not_equal_t<vertex_t>{invalid_color})),
+        handle.get_stream());
+      candidates.resize(
+        thrust::distance(
+          thrust::make_zip_iterator(candidates.begin(), reached_colors.begin()),
+          thrust::remove_if(
+            handle.get_thrust_policy(),
+            thrust::make_zip_iterator(candidates.begin(), reached_colors.begin()),
+            thrust::make_zip_iterator(candidates.end(), reached_colors.end()),
+            [] __device__(auto pair) { return thrust::get<1>(pair) != invalid_color; })),
+        handle.get_stream());
+
+      auto aggregate_num_new_members = aggregate_count(static_cast<vertex_t>(new_members.size()));
+      aggregate_num_active_vertices -= aggregate_num_new_members;
+      if (aggregate_num_new_members == 0) { break; }
+
+      update_edge_dst_property(handle,
+                               graph_view,
+                               new_members.begin(),
+                               new_members.end(),
+                               components,
+                               edge_dst_components.mutable_view());
+    }
+  }
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  vertex_t* components,
+  bool do_expensive_check)
+{
+  strongly_connected_components_impl(handle, graph_view, components, do_expensive_check);
+}
+
+}  // namespace cugraph
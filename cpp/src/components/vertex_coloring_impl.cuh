@@ -15,27 +15,278 @@
  */
 #pragma once
 
+#include "detail/residual_subgraph.cuh"
 #include "prims/fill_edge_property.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
 #include "prims/transform_e.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
 
 #include <raft/core/handle.hpp>
 #include <raft/random/rng_state.hpp>
 
+#include <cuco/hash_functions.cuh>
 #include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/replace.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
 
 namespace cugraph {
 
 namespace detail {
 
+// conflict resolution priority of a vertex in speculative coloring: a hash of the vertex ID (to
+// break ties pseudo-randomly) in the lower 32 bits and, for largest-first, the degree in the upper
+// 32 bits
+template <typename vertex_t, typename edge_t>
+struct speculative_coloring_priority_t {
+  bool largest_first{false};
+
+  __device__ uint64_t operator()(thrust::tuple<vertex_t, edge_t> vertex_degree) const
+  {
+    cuco::murmurhash3_32<vertex_t> hash_func{};
+    auto priority = static_cast<uint64_t>(hash_func(thrust::get<0>(vertex_degree)));
+    if (largest_first) {
+      auto degree = cuda::std::min(static_cast<uint64_t>(thrust::get<1>(vertex_degree)),
+                                   uint64_t{std::numeric_limits<uint32_t>::max()});
+      priority |= degree << 32;
+    }
+    return priority;
+  }
+};
+
+// bitmap of the neighbor colors in [color_base, color_base + 64)
+template <typename vertex_t>
+struct forbidden_colors_e_op_t {
+  vertex_t color_base{};
+
+  __device__ uint64_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 cuda::std::nullopt_t,
+                                 thrust::tuple<vertex_t, uint64_t> dst_color_priority,
+                                 cuda::std::nullopt_t) const
+  {
+    auto color = thrust::get<0>(dst_color_priority);
+    return ((src != dst) && (color >= color_base) && (color - color_base < vertex_t{64}))
+             ? (uint64_t{1} << (color - color_base))
+             : uint64_t{0};
+  }
+};
+
+// 1 if the source has the same (tentative) color as the destination and loses the conflict
+template <typename vertex_t>
+struct coloring_conflict_e_op_t {
+  __device__ uint8_t operator()(vertex_t src,
+                                vertex_t dst,
+                                thrust::tuple<vertex_t, uint64_t> src_color_priority,
+                                thrust::tuple<vertex_t, uint64_t> dst_color_priority,
+                                cuda::std::nullopt_t) const
+  {
+    if ((src == dst) ||
+        (thrust::get<0>(src_color_priority) != thrust::get<0>(dst_color_priority))) {
+      return uint8_t{0};
+    }
+    auto src_priority = thrust::get<1>(src_color_priority);
+    auto dst_priority = thrust::get<1>(dst_color_priority);
+    return ((src_priority < dst_priority) || ((src_priority == dst_priority) && (src < dst)))
+             ? uint8_t{1}
+             : uint8_t{0};
+  }
+};
+
+// Every round tentatively colors all the uncolored vertices at once with the smallest color not
+// used by their (already colored) neighbors, found with a per-vertex bitmap of the forbidden colors
+// in a 64 color window (the vertices with a full window retry with the next window). Adjacent
+// vertices colored in the same round may pick the same color, the lower priority endpoint of
+// every such edge is uncolored for the next round.
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> speculative_vertex_coloring(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool largest_first)
+{
+  using GraphViewType = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: speculative vertex coloring requires a symmetric "
+                  "graph.");
+
+  auto constexpr uncolored = std::numeric_limits<vertex_t>::max();
+  vertex_t constexpr window_size{64};
+
+  auto const v_first = graph_view.local_vertex_partition_range_first();
+
+  rmm::device_uvector<vertex_t> colors(graph_view.local_vertex_partition_range_size(),
+                                       handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), colors.begin(), colors.end(), uncolored);
+
+  rmm::device_uvector<uint64_t> priorities(colors.size(), handle.get_stream());
+  {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_counting_iterator(v_first), degrees.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+        degrees.end())),
+      priorities.begin(),
+      speculative_coloring_priority_t<vertex_t, edge_t>{largest_first});
+  }
+
+  edge_src_property_t<GraphViewType, thrust::tuple<vertex_t, uint64_t>> edge_src_colors(
+    handle, graph_view);
+  edge_dst_property_t<GraphViewType, thrust::tuple<vertex_t, uint64_t>> edge_dst_colors(
+    handle, graph_view);
+  auto color_priority_first =
+    thrust::make_zip_iterator(thrust::make_tuple(colors.begin(), priorities.begin()));
+  update_edge_src_property(
+    handle, graph_view, color_priority_first, edge_src_colors.mutable_view());
+  update_edge_dst_property(
+    handle, graph_view, color_priority_first, edge_dst_colors.mutable_view());
+
+  rmm::device_uvector<vertex_t> worklist(colors.size(), handle.get_stream());
+  detail::sequence_fill(handle.get_stream(), worklist.begin(), worklist.size(), v_first);
+
+  while (true) {
+    auto num_uncolored = worklist.size();
+    if constexpr (multi_gpu) {
+      num_uncolored = host_scalar_allreduce(
+        handle.get_comms(), num_uncolored, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_uncolored == 0) { break; }
+
+    // 1. tentative first-fit coloring
+
+    rmm::device_uvector<vertex_t> pending(worklist.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), worklist.begin(), worklist.end(), pending.begin());
+    vertex_t color_base{0};
+    while (true) {
+      auto num_pending = pending.size();
+      if constexpr (multi_gpu) {
+        num_pending = host_scalar_allreduce(
+          handle.get_comms(), num_pending, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_pending == 0) { break; }
+
+      key_bucket_t<vertex_t, void, multi_gpu, true> pending_bucket(
+        handle, raft::device_span<vertex_t const>(pending.data(), pending.size()));
+      rmm::device_uvector<uint64_t> forbidden_colors(pending.size(), handle.get_stream());
+      per_v_transform_reduce_outgoing_e(handle,
+                                        graph_view,
+                                        pending_bucket,
+                                        edge_src_dummy_property_t{}.view(),
+                                        edge_dst_colors.view(),
+                                        edge_dummy_property_t{}.view(),
+                                        forbidden_colors_e_op_t<vertex_t>{color_base},
+                                        uint64_t{0},
+                                        reduce_op::bitwise_or<uint64_t>{},
+                                        forbidden_colors.begin());
+
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(pending.begin(), forbidden_colors.begin()));
+      thrust::for_each(handle.get_thrust_policy(),
+                       pair_first,
+                       pair_first + pending.size(),
+                       [colors = colors.data(), v_first, color_base] __device__(auto pair) {
+                         auto free_colors = ~thrust::get<1>(pair);
+                         if (free_colors != uint64_t{0}) {
+                           auto first_free = __ffsll(static_cast<long long>(free_colors)) - 1;
+                           colors[thrust::get<0>(pair) - v_first] =
+                             color_base + static_cast<vertex_t>(first_free);
+                         }
+                       });
+      pending.resize(
+        thrust::distance(pair_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           pair_first,
+                                           pair_first + pending.size(),
+                                           [] __device__(auto pair) {
+                                             return ~thrust::get<1>(pair) != uint64_t{0};
+                                           })),
+        handle.get_stream());
+      color_base += window_size;
+    }
+
+    // 2. conflict resolution
+
+    update_edge_src_property(handle,
+                             graph_view,
+                             worklist.begin(),
+                             worklist.end(),
+                             color_priority_first,
+                             edge_src_colors.mutable_view());
+    update_edge_dst_property(handle,
+                             graph_view,
+                             worklist.begin(),
+                             worklist.end(),
+                             color_priority_first,
+                             edge_dst_colors.mutable_view());
+
+    key_bucket_t<vertex_t, void, multi_gpu, true> worklist_bucket(
+      handle, raft::device_span<vertex_t const>(worklist.data(), worklist.size()));
+    rmm::device_uvector<uint8_t> conflicts(worklist.size(), handle.get_stream());
+    per_v_transform_reduce_outgoing_e(handle,
+                                      graph_view,
+                                      worklist_bucket,
+                                      edge_src_colors.view(),
+                                      edge_dst_colors.view(),
+                                      edge_dummy_property_t{}.view(),
+                                      coloring_conflict_e_op_t<vertex_t>{},
+                                      uint8_t{0},
+                                      reduce_op::maximum<uint8_t>{},
+                                      conflicts.begin());
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(worklist.begin(), conflicts.begin()));
+    worklist.resize(
+      thrust::distance(
+        pair_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          pair_first,
+                          pair_first + worklist.size(),
+                          [] __device__(auto pair) { return thrust::get<1>(pair) == uint8_t{0}; })),
+      handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      worklist.begin(),
+      worklist.end(),
+      [colors = colors.data(), v_first] __device__(auto v) { colors[v - v_first] = uncolored; });
+    update_edge_dst_property(handle,
+                             graph_view,
+                             worklist.begin(),
+                             worklist.end(),
+                             color_priority_first,
+                             edge_dst_colors.mutable_view());
+  }
+
+  return colors;
+}
+
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 rmm::device_uvector<vertex_t> vertex_coloring(
   raft::handle_t const& handle,
   cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-  raft::random::RngState& rng_state)
+  raft::random::RngState& rng_state,
+  vertex_coloring_method_t method)
 {
+  if (method != vertex_coloring_method_t::maximal_independent_set) {
+    return speculative_vertex_coloring(
+      handle, graph_view, method == vertex_coloring_method_t::speculative_largest_first);
+  }
+
   using graph_view_t = cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>;
   graph_view_t current_graph_view(graph_view);
 
@@ -68,6 +319,9 @@ rmm::device_uvector<vertex_t> vertex_coloring(
   thrust::fill(
     handle.get_thrust_policy(), colors.begin(), colors.end(), std::numeric_limits<vertex_t>::max());
 
+  auto const num_edges   = static_cast<size_t>(current_graph_view.compute_number_of_edges(handle));
+  auto num_residual_edges = num_edges;
+
   vertex_t color_id = 0;
   while (true) {
     auto mis = cugraph::maximal_independent_set<vertex_t, edge_t, multi_gpu>(
@@ -92,7 +346,7 @@ rmm::device_uvector<vertex_t> vertex_coloring(
         colors[v_offset]           = (color_id < initial_color_id) ? color_id : initial_color_id;
       });
 
-    if (current_graph_view.compute_number_of_edges(handle) == 0) { break; }
+    if (num_residual_edges == 0) { break; }
 
     cugraph::edge_src_property_t<graph_view_t, flag_t> src_mis_flags(handle);
     cugraph::edge_dst_property_t<graph_view_t, flag_t> dst_mis_flags(handle);
@@ -155,6 +409,76 @@ rmm::device_uvector<vertex_t> vertex_coloring(
     }
 
     color_id++;
+
+    num_residual_edges = static_cast<size_t>(current_graph_view.compute_number_of_edges(handle));
+    if (switch_to_tail(num_residual_edges, num_edges)) {
+      //
+      // Few edges remain, color the uncolored vertices with uncolored neighbors on a single GPU
+      // (with colors starting from color_id), the other uncolored vertices get color_id
+      //
+
+      auto out_degrees = current_graph_view.compute_out_degrees(handle);
+      auto in_degrees  = current_graph_view.compute_in_degrees(handle);
+
+      rmm::device_uvector<vertex_t> residual_vertices(colors.size(), handle.get_stream());
+      residual_vertices.resize(
+        thrust::distance(
+          residual_vertices.begin(),
+          thrust::copy_if(
+            handle.get_thrust_policy(),
+            thrust::make_counting_iterator(current_graph_view.local_vertex_partition_range_first()),
+            thrust::make_counting_iterator(current_graph_view.local_vertex_partition_range_last()),
+            thrust::make_zip_iterator(
+              thrust::make_tuple(colors.begin(), out_degrees.begin(), in_degrees.begin())),
+            residual_vertices.begin(),
+            [] __device__(auto triplet) {
+              return (thrust::get<0>(triplet) == std::numeric_limits<vertex_t>::max()) &&
+                     ((thrust::get<1>(triplet) > 0) || (thrust::get<2>(triplet) > 0));
+            })),
+        handle.get_stream());
+
+      thrust::replace(handle.get_thrust_policy(),
+                      colors.begin(),
+                      colors.end(),
+                      std::numeric_limits<vertex_t>::max(),
+                      color_id);
+
+      auto residual_graph = gather_induced_subgraph<vertex_t, edge_t, float, multi_gpu>(
+        handle,
+        current_graph_view,
+        std::nullopt,
+        raft::device_span<vertex_t const>(residual_vertices.data(), residual_vertices.size()));
+
+      rmm::device_uvector<vertex_t> tail_vertices(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> tail_colors(0, handle.get_stream());
+      if (residual_graph) {
+        auto& [subgraph, subgraph_weights, renumber_map] = *residual_graph;
+        tail_colors = vertex_coloring<vertex_t, edge_t, false>(
+          handle, subgraph.view(), rng_state, vertex_coloring_method_t::maximal_independent_set);
+        thrust::transform(handle.get_thrust_policy(),
+                          tail_colors.begin(),
+                          tail_colors.end(),
+                          tail_colors.begin(),
+                          [color_id] __device__(vertex_t c) { return color_id + c; });
+        tail_vertices = std::move(renumber_map);
+      }
+
+      std::tie(tail_vertices, tail_colors) = scatter_from_root<vertex_t, vertex_t, multi_gpu>(
+        handle,
+        std::move(tail_vertices),
+        std::move(tail_colors),
+        current_graph_view.vertex_partition_range_lasts());
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(tail_vertices.begin(), tail_colors.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(tail_vertices.end(), tail_colors.end())),
+        [colors  = colors.data(),
+         v_first = current_graph_view.local_vertex_partition_range_first()] __device__(auto pair) {
+          colors[thrust::get<0>(pair) - v_first] = thrust::get<1>(pair);
+        });
+      break;
+    }
   }
   return colors;
 }
@@ -164,9 +488,10 @@ template <typename vertex_t, typename edge_t, bool multi_gpu>
 rmm::device_uvector<vertex_t> vertex_coloring(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
-  raft::random::RngState& rng_state)
+  raft::random::RngState& rng_state,
+  vertex_coloring_method_t method)
 {
-  return detail::vertex_coloring(handle, graph_view, rng_state);
+  return detail::vertex_coloring(handle, graph_view, rng_state, method);
 }
 
 }  // namespace cugraph
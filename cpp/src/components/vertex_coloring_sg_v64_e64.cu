@@ -20,6 +20,7 @@ namespace cugraph {
 template rmm::device_uvector<int64_t> vertex_coloring(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, false, false> const& graph_view,
-  raft::random::RngState& rng_state);
+  raft::random::RngState& rng_state,
+  vertex_coloring_method_t method);
 
 }  // namespace cugraph
@@ -15,7 +15,10 @@
  */
 #pragma once
 
+#include "detail/graph_partition_utils.cuh"
+#include "prims/extract_transform_v_frontier_outgoing_e.cuh"
 #include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/per_v_random_select_transform_outgoing_e.cuh"
 #include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
 #include "prims/update_v_frontier.cuh"
@@ -28,9 +31,11 @@
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
 
 #include <rmm/device_uvector.hpp>
 
@@ -39,6 +44,7 @@
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
+#include <thrust/extrema.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -48,6 +54,8 @@
 #include <thrust/merge.h>
 #include <thrust/partition.h>
 #include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
 #include <thrust/shuffle.h>
@@ -60,6 +68,7 @@
 #include <algorithm>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -484,6 +493,8 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
     // FIXME: we can use cuda::atomic instead but currently on a system with x86 + GPU, this
     // requires placing the atomic variable on managed memory and this adds additional complication.
     rmm::device_scalar<size_t> num_edge_inserts(size_t{0}, handle.get_stream());
+    size_t h_num_edge_inserts{0};  // host copy of num_edge_inserts, kept up-to-date to avoid
+                                   // reading back the values already known on the host
 
     auto edge_dst_components =
       GraphViewType::is_multi_gpu
@@ -500,6 +511,8 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
 
     size_t iter{0};
     while (true) {
+      prim_profile_range_t iteration_range(handle.get_stream(),
+                                           "weakly_connected_components iteration");
       if ((edge_count < degree_sum_threshold) &&
           (next_candidate_offset < static_cast<vertex_t>(new_root_candidates.size()))) {
         auto [new_roots, num_scanned, degree_sum] = accumulate_new_roots<GraphViewType>(
@@ -529,6 +542,7 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
         vertex_frontier.bucket(bucket_idx_cur).insert(pair_first, pair_first + new_roots.size());
       }
 
+      if constexpr (GraphViewType::is_multi_gpu) { iteration_range.add_host_syncs(1); }
       if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
 
       if constexpr (GraphViewType::is_multi_gpu) {
@@ -549,7 +563,7 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
       // FIXME: if we use cuco::static_map (no duplicates, ideally we need static_set), edge_buffer
       // size cannot exceed (# roots)^2 and we can avoid additional sort & unique (but resizing the
       // buffer may be more expensive).
-      auto old_num_edge_inserts = num_edge_inserts.value(handle.get_stream());
+      auto old_num_edge_inserts = h_num_edge_inserts;
       resize_dataframe_buffer(edge_buffer, old_num_edge_inserts + max_pushes, handle.get_stream());
 
       auto new_frontier_tagged_vertex_buffer =
@@ -588,8 +602,11 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
                                               bucket_idx_next,
                                               bucket_idx_conflict});
 
+      // the vertex operator inserts edges on conflicts, read back the number of inserted edges
+      auto new_num_edge_inserts = num_edge_inserts.value(handle.get_stream());
+      iteration_range.add_host_syncs(1);
       if (GraphViewType::is_multi_gpu) {
-        auto cur_num_edge_inserts = num_edge_inserts.value(handle.get_stream());
+        auto cur_num_edge_inserts = new_num_edge_inserts;
         auto& conflict_bucket     = vertex_frontier.bucket(bucket_idx_conflict);
         resize_dataframe_buffer(
           edge_buffer, cur_num_edge_inserts + conflict_bucket.size(), handle.get_stream());
@@ -612,12 +629,13 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
             *(edge_buffer_first + edge_idx) =
               tag >= old ? thrust::make_tuple(tag, old) : thrust::make_tuple(old, tag);
           });
+        new_num_edge_inserts += conflict_bucket.size();  // one edge per conflict
         conflict_bucket.clear();
       }
 
       // maintain the list of sorted unique edges (we can avoid this if we use cuco::static_map(no
       // duplicates, ideally we need static_set)).
-      auto new_num_edge_inserts = num_edge_inserts.value(handle.get_stream());
+      h_num_edge_inserts = new_num_edge_inserts;
       if (new_num_edge_inserts > old_num_edge_inserts) {
         auto edge_first = get_dataframe_buffer_begin(edge_buffer);
         thrust::sort(handle.get_thrust_policy(),
@@ -640,6 +658,7 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
           thrust::unique(handle.get_thrust_policy(), edge_first, edge_first + new_num_edge_inserts);
         auto num_unique_edges = static_cast<size_t>(thrust::distance(edge_first, unique_edge_last));
         num_edge_inserts.set_value_async(num_unique_edges, handle.get_stream());
+        h_num_edge_inserts = num_unique_edges;
       }
 
       vertex_frontier.bucket(bucket_idx_cur).clear();
@@ -655,13 +674,14 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
           }),
         edge_t{0},
         thrust::plus<edge_t>());
+      iteration_range.add_host_syncs(1);
 
       ++iter;
     }
 
     // 2-5. construct the next level graph from the edges emitted on conflicts
 
-    auto num_inserts           = num_edge_inserts.value(handle.get_stream());
+    auto num_inserts           = h_num_edge_inserts;
     auto aggregate_num_inserts = num_inserts;
     if (GraphViewType::is_multi_gpu) {
       auto& comm = handle.get_comms();
@@ -765,17 +785,390 @@ void weakly_connected_components_impl(raft::handle_t const& handle,
   }
 }
 
+template <typename vertex_t>
+struct sampled_edge_e_op_t {
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(vertex_t src,
+                                                          vertex_t dst,
+                                                          cuda::std::nullopt_t,
+                                                          cuda::std::nullopt_t,
+                                                          cuda::std::nullopt_t) const
+  {
+    return thrust::make_tuple(src, dst);
+  }
+};
+
+template <typename vertex_t>
+struct component_link_e_op_t {
+  __device__ cuda::std::optional<thrust::tuple<vertex_t, vertex_t>> operator()(
+    vertex_t, vertex_t, vertex_t src_component, vertex_t dst_component, cuda::std::nullopt_t) const
+  {
+    // keep only the links in the lower triangular part
+    return src_component > dst_component
+             ? cuda::std::optional<thrust::tuple<vertex_t, vertex_t>>{thrust::make_tuple(
+                 src_component, dst_component)}
+           : src_component < dst_component
+             ? cuda::std::optional<thrust::tuple<vertex_t, vertex_t>>{thrust::make_tuple(
+                 dst_component, src_component)}
+             : cuda::std::nullopt;
+  }
+};
+
+// merge the component IDs connected by the (component ID, component ID) pairs in (srcs, dsts);
+// components of the local vertices are updated to the (arbitrary) representative component IDs of
+// the merged components
+template <typename GraphViewType>
+void merge_linked_components(raft::handle_t const& handle,
+                             rmm::device_uvector<typename GraphViewType::vertex_type>&& srcs,
+                             rmm::device_uvector<typename GraphViewType::vertex_type>&& dsts,
+                             typename GraphViewType::vertex_type* components,
+                             typename GraphViewType::vertex_type num_local_vertices)
+{
+  using vertex_t    = typename GraphViewType::vertex_type;
+  using edge_t      = typename GraphViewType::edge_type;
+  using weight_t    = float;  // dummy
+  using edge_type_t = int32_t;
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  auto num_links  = static_cast<size_t>(thrust::distance(
+    edge_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      edge_first,
+                      edge_first + srcs.size(),
+                      [] __device__(auto e) { return thrust::get<0>(e) == thrust::get<1>(e); })));
+
+  auto aggregate_num_links = num_links;
+  if constexpr (GraphViewType::is_multi_gpu) {
+    aggregate_num_links = host_scalar_allreduce(
+      handle.get_comms(), num_links, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (aggregate_num_links == 0) { return; }
+
+  srcs.resize(num_links * 2, handle.get_stream());
+  dsts.resize(srcs.size(), handle.get_stream());
+  edge_first        = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  auto output_first = thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), srcs.begin()));
+  thrust::copy(
+    handle.get_thrust_policy(), edge_first, edge_first + num_links, output_first + num_links);
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    std::tie(srcs,
+             dsts,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore) =
+      detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                     edge_t,
+                                                                                     weight_t,
+                                                                                     edge_type_t,
+                                                                                     int32_t>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
+  }
+  edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + srcs.size());
+  srcs.resize(
+    thrust::distance(
+      edge_first,
+      thrust::unique(handle.get_thrust_policy(), edge_first, edge_first + srcs.size())),
+    handle.get_stream());
+  dsts.resize(srcs.size(), handle.get_stream());
+
+  graph_t<vertex_t, edge_t, false, GraphViewType::is_multi_gpu> link_graph(handle);
+  std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+  std::tie(link_graph, std::ignore, std::ignore, std::ignore, renumber_map) =
+    create_graph_from_edgelist<vertex_t,
+                               edge_t,
+                               weight_t,
+                               edge_type_t,
+                               false,
+                               GraphViewType::is_multi_gpu>(handle,
+                                                            std::nullopt,
+                                                            std::move(srcs),
+                                                            std::move(dsts),
+                                                            std::nullopt,
+                                                            std::nullopt,
+                                                            std::nullopt,
+                                                            graph_properties_t{true, false},
+                                                            true);
+  auto link_graph_view = link_graph.view();
+
+  rmm::device_uvector<vertex_t> link_components(link_graph_view.local_vertex_partition_range_size(),
+                                                handle.get_stream());
+  weakly_connected_components_impl(handle, link_graph_view, link_components.data(), false);
+
+  // map the link graph component IDs back to the input component IDs and relabel
+  rmm::device_uvector<vertex_t> link_local_vertices((*renumber_map).size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   link_local_vertices.begin(),
+                   link_local_vertices.end(),
+                   link_graph_view.local_vertex_partition_range_first());
+  relabel<vertex_t, GraphViewType::is_multi_gpu>(
+    handle,
+    std::make_tuple(link_local_vertices.data(), (*renumber_map).data()),
+    link_local_vertices.size(),
+    link_components.data(),
+    link_components.size(),
+    false);
+  relabel<vertex_t, GraphViewType::is_multi_gpu>(
+    handle,
+    std::make_tuple((*renumber_map).data(), link_components.data()),
+    (*renumber_map).size(),
+    components,
+    num_local_vertices,
+    true);
+}
+
+// returns the component ID shared by the largest number of vertices (the smallest such component ID
+// on ties)
+template <typename vertex_t, bool multi_gpu>
+vertex_t find_largest_component(raft::handle_t const& handle,
+                                vertex_t const* components,
+                                vertex_t num_local_vertices)
+{
+  rmm::device_uvector<vertex_t> sorted_components(num_local_vertices, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               components,
+               components + num_local_vertices,
+               sorted_components.begin());
+  thrust::sort(handle.get_thrust_policy(), sorted_components.begin(), sorted_components.end());
+
+  rmm::device_uvector<vertex_t> unique_components(sorted_components.size(), handle.get_stream());
+  rmm::device_uvector<size_t> counts(sorted_components.size(), handle.get_stream());
+  unique_components.resize(
+    thrust::distance(unique_components.begin(),
+                     thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                                          sorted_components.begin(),
+                                                          sorted_components.end(),
+                                                          thrust::make_constant_iterator(size_t{1}),
+                                                          unique_components.begin(),
+                                                          counts.begin()))),
+    handle.get_stream());
+  counts.resize(unique_components.size(), handle.get_stream());
+  sorted_components.resize(0, handle.get_stream());
+  sorted_components.shrink_to_fit(handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    std::tie(unique_components, counts, std::ignore) = groupby_gpu_id_and_shuffle_kv_pairs(
+      comm,
+      unique_components.begin(),
+      unique_components.end(),
+      counts.begin(),
+      detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+        comm_size, major_comm_size, minor_comm_size},
+      handle.get_stream());
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        unique_components.begin(),
+                        unique_components.end(),
+                        counts.begin());
+    rmm::device_uvector<vertex_t> tmp_unique_components(unique_components.size(),
+                                                        handle.get_stream());
+    rmm::device_uvector<size_t> tmp_counts(tmp_unique_components.size(), handle.get_stream());
+    auto num_uniques = thrust::distance(
+      tmp_unique_components.begin(),
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           unique_components.begin(),
+                                           unique_components.end(),
+                                           counts.begin(),
+                                           tmp_unique_components.begin(),
+                                           tmp_counts.begin())));
+    tmp_unique_components.resize(num_uniques, handle.get_stream());
+    tmp_counts.resize(num_uniques, handle.get_stream());
+    unique_components = std::move(tmp_unique_components);
+    counts            = std::move(tmp_counts);
+  }
+
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(counts.begin(),
+                                                                 unique_components.begin()));
+  auto max_idx    = static_cast<size_t>(thrust::distance(
+    pair_first,
+    thrust::max_element(handle.get_thrust_policy(),
+                        pair_first,
+                        pair_first + counts.size(),
+                        [] __device__(auto lhs, auto rhs) {
+                          return (thrust::get<0>(lhs) < thrust::get<0>(rhs)) ||
+                                 ((thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+                                  (thrust::get<1>(lhs) > thrust::get<1>(rhs)));
+                        })));
+
+  size_t max_count{0};
+  auto largest_component = invalid_component_id<vertex_t>::value;
+  if (max_idx < counts.size()) {
+    raft::update_host(&max_count, counts.data() + max_idx, size_t{1}, handle.get_stream());
+    raft::update_host(
+      &largest_component, unique_components.data() + max_idx, size_t{1}, handle.get_stream());
+  }
+  handle.sync_stream();
+
+  if constexpr (multi_gpu) {
+    auto max_counts = host_scalar_allgather(handle.get_comms(), max_count, handle.get_stream());
+    auto largest_components =
+      host_scalar_allgather(handle.get_comms(), largest_component, handle.get_stream());
+    max_count = 0;
+    for (size_t i = 0; i < max_counts.size(); ++i) {
+      if ((max_counts[i] > max_count) ||
+          ((max_counts[i] == max_count) && (max_counts[i] > 0) &&
+           (largest_components[i] < largest_component))) {
+        max_count         = max_counts[i];
+        largest_component = largest_components[i];
+      }
+    }
+  }
+
+  return largest_component;
+}
+
+// Afforest-style (Sutton et al., "Optimizing Parallel Graph Connectivity Computation via Subgraph
+// Sampling") variant: components are first linked along up to num_sampled_neighbors randomly
+// sampled neighbors per vertex. This typically places most vertices of the largest component under
+// a single component ID already, and the remaining links are found by processing only the edges of
+// the vertices outside the largest component (as the input graph is symmetric, an edge between a
+// vertex in the largest component and a vertex outside is visited from the latter).
+template <typename GraphViewType>
+void weakly_connected_components_sampling_impl(raft::handle_t const& handle,
+                                               GraphViewType const& push_graph_view,
+                                               typename GraphViewType::vertex_type* components,
+                                               size_t num_sampled_neighbors,
+                                               bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    push_graph_view.is_symmetric(),
+    "Invalid input argument: input graph should be symmetric for weakly connected components.");
+  CUGRAPH_EXPECTS(num_sampled_neighbors > 0,
+                  "Invalid input argument: num_sampled_neighbors should be positive.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  auto num_local_vertices = push_graph_view.local_vertex_partition_range_size();
+  thrust::sequence(handle.get_thrust_policy(),
+                   components,
+                   components + num_local_vertices,
+                   push_graph_view.local_vertex_partition_range_first());
+
+  // 2. link components along the sampled neighbors
+
+  {
+    rmm::device_uvector<vertex_t> local_vertices(num_local_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     local_vertices.begin(),
+                     local_vertices.end(),
+                     push_graph_view.local_vertex_partition_range_first());
+    key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_bucket(
+      handle, raft::device_span<vertex_t const>(local_vertices.data(), local_vertices.size()));
+
+    raft::random::RngState rng_state(
+      GraphViewType::is_multi_gpu ? static_cast<uint64_t>(handle.get_comms().get_rank()) : 0);
+    auto [sample_offsets, sampled_edges] = per_v_random_select_transform_outgoing_e(
+      handle,
+      push_graph_view,
+      vertex_bucket,
+      edge_src_dummy_property_t{}.view(),
+      edge_dst_dummy_property_t{}.view(),
+      edge_dummy_property_t{}.view(),
+      sampled_edge_e_op_t<vertex_t>{},
+      rng_state,
+      num_sampled_neighbors,
+      false,
+      std::optional<thrust::tuple<vertex_t, vertex_t>>{std::nullopt});
+    sample_offsets = std::nullopt;
+
+    merge_linked_components<GraphViewType>(handle,
+                                           std::move(std::get<0>(sampled_edges)),
+                                           std::move(std::get<1>(sampled_edges)),
+                                           components,
+                                           num_local_vertices);
+  }
+
+  // 3. find the largest component and link the remaining components along the edges of the
+  // vertices outside the largest component
+
+  auto largest_component = find_largest_component<vertex_t, GraphViewType::is_multi_gpu>(
+    handle, components, num_local_vertices);
+
+  rmm::device_uvector<vertex_t> remaining_vertices(num_local_vertices, handle.get_stream());
+  remaining_vertices.resize(
+    thrust::distance(
+      remaining_vertices.begin(),
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(push_graph_view.local_vertex_partition_range_first()),
+        thrust::make_counting_iterator(push_graph_view.local_vertex_partition_range_last()),
+        components,
+        remaining_vertices.begin(),
+        [largest_component] __device__(auto c) { return c != largest_component; })),
+    handle.get_stream());
+  key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> remaining_bucket(
+    handle,
+    raft::device_span<vertex_t const>(remaining_vertices.data(), remaining_vertices.size()));
+
+  edge_src_property_t<GraphViewType, vertex_t> edge_src_components(handle, push_graph_view);
+  edge_dst_property_t<GraphViewType, vertex_t> edge_dst_components(handle, push_graph_view);
+  update_edge_src_property(
+    handle, push_graph_view, components, edge_src_components.mutable_view());
+  update_edge_dst_property(
+    handle, push_graph_view, components, edge_dst_components.mutable_view());
+
+  auto [link_srcs, link_dsts] =
+    extract_transform_v_frontier_outgoing_e(handle,
+                                            push_graph_view,
+                                            remaining_bucket,
+                                            edge_src_components.view(),
+                                            edge_dst_components.view(),
+                                            edge_dummy_property_t{}.view(),
+                                            component_link_e_op_t<vertex_t>{});
+  edge_src_components.clear(handle);
+  edge_dst_components.clear(handle);
+
+  merge_linked_components<GraphViewType>(
+    handle, std::move(link_srcs), std::move(link_dsts), components, num_local_vertices);
+}
+
 }  // namespace
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 void weakly_connected_components(raft::handle_t const& handle,
                                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
                                  vertex_t* components,
-                                 bool do_expensive_check)
+                                 bool do_expensive_check,
+                                 std::optional<size_t> num_sampled_neighbors)
 {
   CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
 
-  weakly_connected_components_impl(handle, graph_view, components, do_expensive_check);
+  if (num_sampled_neighbors) {
+    weakly_connected_components_sampling_impl(
+      handle, graph_view, components, *num_sampled_neighbors, do_expensive_check);
+  } else {
+    weakly_connected_components_impl(handle, graph_view, components, do_expensive_check);
+  }
 }
 
 }  // namespace cugraph
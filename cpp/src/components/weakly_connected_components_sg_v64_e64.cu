@@ -24,6 +24,7 @@ template void weakly_connected_components(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, false, false> const& graph_view,
   int64_t* components,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  std::optional<size_t> num_sampled_neighbors);
 
 }  // namespace cugraph
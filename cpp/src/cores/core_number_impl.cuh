@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "prims/detail/multi_stream_utils.cuh"
 #include "prims/reduce_v.cuh"
 #include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
@@ -24,10 +25,14 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 
 #include <raft/core/handle.hpp>
 
+#include <rmm/device_scalar.hpp>
+
 #include <cuda/std/optional>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
@@ -40,9 +45,13 @@
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <cstddef>
+#include <limits>
+#include <numeric>
+#include <vector>
 
 namespace cugraph {
 
@@ -75,6 +84,77 @@ struct mult_degree_by_two_t {
   __device__ edge_t operator()(edge_t d) const { return d * edge_t{2}; }
 };
 
+// the iteration (k) a vertex with the core number value of c is peeled in (if c does not change
+// till then)
+template <typename edge_t>
+struct core_number_to_peel_k_t {
+  size_t k_first{};  // first iteration
+  size_t delta{};
+
+  __device__ size_t operator()(edge_t c) const
+  {
+    auto c_ = static_cast<size_t>(c);
+    return c_ < k_first ? k_first : k_first + ((c_ - k_first) / delta + 1) * delta;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct far_to_open_bucket_idx_t {
+  edge_t const* core_numbers{nullptr};
+  vertex_t v_first{0};
+  core_number_to_peel_k_t<edge_t> to_peel_k{};
+  size_t k{};  // open bucket 0's iteration
+  size_t num_open_buckets{};
+  size_t bucket_idx_open_first{};
+  size_t bucket_idx_far{};
+
+  __device__ cuda::std::optional<size_t> operator()(vertex_t v) const
+  {
+    auto peel_k = to_peel_k(core_numbers[v - v_first]);
+    if (peel_k < k) { return cuda::std::nullopt; }  // already peeled
+    auto open_bucket_offset = (peel_k - k) / to_peel_k.delta;
+    return open_bucket_offset < num_open_buckets
+             ? cuda::std::optional<size_t>{bucket_idx_open_first + open_bucket_offset}
+             : cuda::std::optional<size_t>{bucket_idx_far};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct next_to_open_bucket_idx_t {
+  edge_t const* core_numbers{nullptr};
+  vertex_t v_first{0};
+  core_number_to_peel_k_t<edge_t> to_peel_k{};
+  size_t k{};             // current iteration
+  size_t open_k_first{};  // open bucket 0's iteration
+  size_t num_open_buckets{};
+  size_t bucket_idx_open_first{};
+  size_t bucket_idx_next{};
+
+  __device__ cuda::std::optional<size_t> operator()(vertex_t v) const
+  {
+    auto c = core_numbers[v - v_first];
+    if (static_cast<size_t>(c) < k) { return bucket_idx_next; }
+    // vertices outside the open bucket range are already in the far bucket
+    auto open_bucket_offset = (to_peel_k(c) - open_k_first) / to_peel_k.delta;
+    return open_bucket_offset < num_open_buckets
+             ? cuda::std::optional<size_t>{bucket_idx_open_first + open_bucket_offset}
+             : cuda::std::nullopt;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename edge_t>
+struct is_not_peeled_in_k_t {
+  edge_t const* core_numbers{nullptr};
+  vertex_t v_first{0};
+  core_number_to_peel_k_t<edge_t> to_peel_k{};
+  size_t k{};
+
+  __device__ bool operator()(vertex_t v) const { return to_peel_k(core_numbers[v - v_first]) != k; }
+};
+
 }  // namespace
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -169,11 +249,28 @@ void core_number(raft::handle_t const& handle,
 
   // start iteration
 
-  constexpr size_t bucket_idx_cur  = 0;
-  constexpr size_t bucket_idx_next = 1;
-  constexpr size_t num_buckets     = 2;
+  // Vertices are binned by the iteration they will be peeled in (with their current core number
+  // values). Only the vertices in the lowest non-empty bin are visited in each iteration.
+  // num_open_buckets bins cover the next num_open_buckets iterations and the far bucket holds the
+  // remaining vertices (these are re-binned once the open buckets are exhausted). A vertex with
+  // decreasing core number value can appear in multiple bins, the stale entries are filtered out
+  // when a bin is visited.
+
+  constexpr size_t bucket_idx_cur        = 0;
+  constexpr size_t bucket_idx_next       = 1;
+  constexpr size_t bucket_idx_far        = 2;
+  constexpr size_t bucket_idx_open_first = 3;
+  constexpr size_t num_open_buckets      = 16;
+  constexpr size_t num_buckets           = bucket_idx_open_first + num_open_buckets;
 
   vertex_frontier_t<vertex_t, void, multi_gpu, true> vertex_frontier(handle, num_buckets);
+  vertex_frontier.bucket(bucket_idx_far)
+    .insert(remaining_vertices.begin(), remaining_vertices.end());
+  remaining_vertices.resize(0, handle.get_stream());
+  remaining_vertices.shrink_to_fit(handle.get_stream());
+
+  std::vector<size_t> bucket_indices_open(num_open_buckets);
+  std::iota(bucket_indices_open.begin(), bucket_indices_open.end(), bucket_idx_open_first);
 
   edge_dst_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, edge_t> dst_core_numbers(
     handle, graph_view);
@@ -184,144 +281,155 @@ void core_number(raft::handle_t const& handle,
       ((k % 2) == 1)) {  // core numbers are always even numbers if symmetric and INOUT
     ++k;
   }
+  auto delta = (graph_view.is_symmetric() && (degree_type == k_core_degree_type_t::INOUT))
+                 ? edge_t{2}
+                 : edge_t{1};
+  core_number_to_peel_k_t<edge_t> to_peel_k{k, static_cast<size_t>(delta)};
+
+  auto open_k_first = k;
+  auto open_k_last  = k;  // exclusive, no open bucket yet
   while (k <= k_last) {
-    size_t aggregate_num_remaining_vertices{0};
-    if constexpr (multi_gpu) {
-      auto& comm                       = handle.get_comms();
-      aggregate_num_remaining_vertices = host_scalar_allreduce(
-        comm, remaining_vertices.size(), raft::comms::op_t::SUM, handle.get_stream());
-    } else {
-      aggregate_num_remaining_vertices = remaining_vertices.size();
+    if (k >= open_k_last) {  // re-bin the far bucket
+      prim_profile_range_t rebin_range(handle.get_stream(), "core_number far bucket re-bin");
+      auto far_peel_k_first = thrust::make_transform_iterator(
+        thrust::make_transform_iterator(
+          vertex_frontier.bucket(bucket_idx_far).begin(),
+          v_to_core_number_t<vertex_t, edge_t>{core_numbers,
+                                               graph_view.local_vertex_partition_range_first()}),
+        to_peel_k);
+      // reduce (and allreduce in multi-GPU) on device to read back the minimum only once
+      auto far_candidate_peel_k_first = thrust::make_transform_iterator(
+        far_peel_k_first, cuda::proclaim_return_type<size_t>([k] __device__(auto peel_k) {
+          return peel_k >= k ? peel_k : std::numeric_limits<size_t>::max();
+        }));
+      rmm::device_scalar<size_t> d_min_peel_k(handle.get_stream());
+      detail::min_nosync(
+        far_candidate_peel_k_first,
+        far_candidate_peel_k_first + vertex_frontier.bucket(bucket_idx_far).size(),
+        raft::device_span<size_t>(d_min_peel_k.data(), size_t{1}),
+        handle.get_stream());
+      if constexpr (multi_gpu) {
+        device_allreduce(handle.get_comms(),
+                         d_min_peel_k.data(),
+                         d_min_peel_k.data(),
+                         size_t{1},
+                         raft::comms::op_t::MIN,
+                         handle.get_stream());
+      }
+      auto min_peel_k = d_min_peel_k.value(handle.get_stream());
+      rebin_range.add_host_syncs(1);
+      if (min_peel_k == std::numeric_limits<size_t>::max()) { break; }  // no remaining vertex
+
+      k = std::max(k, min_peel_k);
+      if (k > k_last) { break; }
+      open_k_first = k;
+      open_k_last  = k + num_open_buckets * delta;
+
+      vertex_frontier.split_bucket(
+        bucket_idx_far,
+        bucket_indices_open,
+        far_to_open_bucket_idx_t<vertex_t, edge_t>{core_numbers,
+                                                   graph_view.local_vertex_partition_range_first(),
+                                                   to_peel_k,
+                                                   k,
+                                                   num_open_buckets,
+                                                   bucket_idx_open_first,
+                                                   bucket_idx_far});
     }
-    if (aggregate_num_remaining_vertices == 0) { break; }
 
-    // FIXME: scanning the remaining vertices can add significant overhead if the number of distinct
-    // core numbers in [k_first, std::min(max_degree, k_last)] is large and there are many high core
-    // number vertices (so the number of remaining vertices remains large for many iterations). Need
-    // more tuning (e.g. Possibly use a logarithmic binning) if we encounter such use cases.
-    auto less_than_k_first = thrust::stable_partition(
-      handle.get_thrust_policy(),
-      remaining_vertices.begin(),
-      remaining_vertices.end(),
-      [core_numbers, k, v_first = graph_view.local_vertex_partition_range_first()] __device__(
-        auto v) { return core_numbers[v - v_first] >= k; });
-    vertex_frontier.bucket(bucket_idx_cur).insert(less_than_k_first, remaining_vertices.end());
-    remaining_vertices.resize(thrust::distance(remaining_vertices.begin(), less_than_k_first),
-                              handle.get_stream());
-
-    auto delta = (graph_view.is_symmetric() && (degree_type == k_core_degree_type_t::INOUT))
-                   ? edge_t{2}
-                   : edge_t{1};
-    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
-      do {
-        // FIXME: If most vertices have core numbers less than k, (dst_val >= k) will be mostly
-        // false leading to too many unnecessary edge traversals (this is especially problematic if
-        // the number of distinct core numbers in [k_first, std::min(max_degree, k_last)] is large).
-        // There are two potential solutions: 1) extract a sub-graph and work on the sub-graph & 2)
-        // mask-out/delete edges.
-        if (graph_view.is_symmetric() || ((degree_type == k_core_degree_type_t::IN) ||
-                                          (degree_type == k_core_degree_type_t::INOUT))) {
-          auto [new_frontier_vertex_buffer, delta_buffer] =
-            cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
-              handle,
-              graph_view,
-              vertex_frontier.bucket(bucket_idx_cur),
-              edge_src_dummy_property_t{}.view(),
-              dst_core_numbers.view(),
-              edge_dummy_property_t{}.view(),
-              e_op_t<vertex_t, edge_t>{k, delta},
-              reduce_op::plus<edge_t>());
-
-          update_v_frontier(
+    vertex_frontier.swap_buckets(bucket_idx_cur,
+                                 bucket_idx_open_first + (k - open_k_first) / delta);
+    vertex_frontier.bucket(bucket_idx_cur)
+      .resize(static_cast<size_t>(thrust::distance(
+        vertex_frontier.bucket(bucket_idx_cur).begin(),
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          vertex_frontier.bucket(bucket_idx_cur).begin(),
+          vertex_frontier.bucket(bucket_idx_cur).end(),
+          is_not_peeled_in_k_t<vertex_t, edge_t>{
+            core_numbers, graph_view.local_vertex_partition_range_first(), to_peel_k, k}))));
+
+    while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+      prim_profile_range_t iteration_range(handle.get_stream(), "core_number iteration");
+      if constexpr (multi_gpu) {
+        iteration_range.add_host_syncs(1);  // the aggregate frontier size in the loop condition
+      }
+      // FIXME: If most vertices have core numbers less than k, (dst_val >= k) will be mostly
+      // false leading to too many unnecessary edge traversals (this is especially problematic if
+      // the number of distinct core numbers in [k_first, std::min(max_degree, k_last)] is large).
+      // There are two potential solutions: 1) extract a sub-graph and work on the sub-graph & 2)
+      // mask-out/delete edges.
+      if (graph_view.is_symmetric() || ((degree_type == k_core_degree_type_t::IN) ||
+                                        (degree_type == k_core_degree_type_t::INOUT))) {
+        auto [new_frontier_vertex_buffer, delta_buffer] =
+          cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
             handle,
             graph_view,
-            std::move(new_frontier_vertex_buffer),
-            std::move(delta_buffer),
-            vertex_frontier,
-            std::vector<size_t>{bucket_idx_next},
-            core_numbers,
-            core_numbers,
-            [k_first,
-             k,
-             delta,
-             v_first =
-               graph_view.local_vertex_partition_range_first()] __device__(auto v,
-                                                                           auto v_val,
-                                                                           auto pushed_val) {
-              auto new_core_number = v_val >= pushed_val ? v_val - pushed_val : edge_t{0};
-              new_core_number      = new_core_number < (k - delta) ? (k - delta) : new_core_number;
-              new_core_number      = new_core_number < k_first ? edge_t{0} : new_core_number;
-              return thrust::make_tuple(cuda::std::optional<size_t>{bucket_idx_next},
-                                        cuda::std::optional<edge_t>{new_core_number});
-            });
-        }
-
-        if (!graph_view.is_symmetric() && ((degree_type == k_core_degree_type_t::OUT) ||
-                                           (degree_type == k_core_degree_type_t::INOUT))) {
-          // FIXME: we can create a transposed copy of the input graph (note that currently,
-          // transpose works only on graph_t (and does not work on graph_view_t)).
-          CUGRAPH_FAIL("unimplemented.");
-        }
-
-        update_edge_dst_property(handle,
-                                 graph_view,
-                                 vertex_frontier.bucket(bucket_idx_next).begin(),
-                                 vertex_frontier.bucket(bucket_idx_next).end(),
-                                 core_numbers,
-                                 dst_core_numbers.mutable_view());
-
-        vertex_frontier.bucket(bucket_idx_next)
-          .resize(static_cast<size_t>(thrust::distance(
-            vertex_frontier.bucket(bucket_idx_next).begin(),
-            thrust::remove_if(
-              handle.get_thrust_policy(),
-              vertex_frontier.bucket(bucket_idx_next).begin(),
-              vertex_frontier.bucket(bucket_idx_next).end(),
-              [core_numbers,
-               k,
-               v_first = graph_view.local_vertex_partition_range_first()] __device__(auto v) {
-                return core_numbers[v - v_first] >= k;
-              }))));
-        vertex_frontier.bucket(bucket_idx_next).shrink_to_fit();
-
-        vertex_frontier.bucket(bucket_idx_cur).clear();
-        vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
-        vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
-      } while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0);
-
-      // FIXME: scanning the remaining vertices can add significant overhead if the number of
-      // distinct core numbers in [k_first, std::min(max_degree, k_last)] is large and there are
-      // many high core number vertices (so the number of remaining vertices remains large for many
-      // iterations). Need more tuning (e.g. Possibly use a logarithmic binning) if we encounter
-      // such use cases.
-      remaining_vertices.resize(
-        thrust::distance(
-          remaining_vertices.begin(),
-          thrust::remove_if(
-            handle.get_thrust_policy(),
-            remaining_vertices.begin(),
-            remaining_vertices.end(),
-            [core_numbers, k, v_first = graph_view.local_vertex_partition_range_first()] __device__(
-              auto v) { return core_numbers[v - v_first] < k; })),
-        handle.get_stream());
-      k += delta;
-    } else {
-      auto remaining_vertex_core_number_first = thrust::make_transform_iterator(
-        remaining_vertices.begin(),
-        v_to_core_number_t<vertex_t, edge_t>{core_numbers,
-                                             graph_view.local_vertex_partition_range_first()});
-      auto min_core_number =
-        thrust::reduce(handle.get_thrust_policy(),
-                       remaining_vertex_core_number_first,
-                       remaining_vertex_core_number_first + remaining_vertices.size(),
-                       std::numeric_limits<edge_t>::max(),
-                       thrust::minimum<edge_t>{});
-      if constexpr (multi_gpu) {
-        min_core_number = host_scalar_allreduce(
-          handle.get_comms(), min_core_number, raft::comms::op_t::MIN, handle.get_stream());
+            vertex_frontier.bucket(bucket_idx_cur),
+            edge_src_dummy_property_t{}.view(),
+            dst_core_numbers.view(),
+            edge_dummy_property_t{}.view(),
+            e_op_t<vertex_t, edge_t>{k, delta},
+            reduce_op::plus<edge_t>());
+
+        update_v_frontier(
+          handle,
+          graph_view,
+          std::move(new_frontier_vertex_buffer),
+          std::move(delta_buffer),
+          vertex_frontier,
+          std::vector<size_t>{bucket_idx_next},
+          core_numbers,
+          core_numbers,
+          [k_first,
+           k,
+           delta,
+           v_first =
+             graph_view.local_vertex_partition_range_first()] __device__(auto v,
+                                                                         auto v_val,
+                                                                         auto pushed_val) {
+            auto new_core_number = v_val >= pushed_val ? v_val - pushed_val : edge_t{0};
+            new_core_number      = new_core_number < (k - delta) ? (k - delta) : new_core_number;
+            new_core_number      = new_core_number < k_first ? edge_t{0} : new_core_number;
+            return thrust::make_tuple(cuda::std::optional<size_t>{bucket_idx_next},
+                                      cuda::std::optional<edge_t>{new_core_number});
+          });
+      }
+
+      if (!graph_view.is_symmetric() && ((degree_type == k_core_degree_type_t::OUT) ||
+                                         (degree_type == k_core_degree_type_t::INOUT))) {
+        // FIXME: we can create a transposed copy of the input graph (note that currently,
+        // transpose works only on graph_t (and does not work on graph_view_t)).
+        CUGRAPH_FAIL("unimplemented.");
       }
-      k = std::max(k + delta, static_cast<size_t>(min_core_number + edge_t{delta}));
+
+      update_edge_dst_property(handle,
+                               graph_view,
+                               vertex_frontier.bucket(bucket_idx_next).begin(),
+                               vertex_frontier.bucket(bucket_idx_next).end(),
+                               core_numbers,
+                               dst_core_numbers.mutable_view());
+
+      // vertices to be peeled in this iteration stay in the next bucket, the other vertices with
+      // decreased core number values move to the open bucket for their new values
+      vertex_frontier.split_bucket(
+        bucket_idx_next,
+        bucket_indices_open,
+        next_to_open_bucket_idx_t<vertex_t, edge_t>{core_numbers,
+                                                    graph_view.local_vertex_partition_range_first(),
+                                                    to_peel_k,
+                                                    k,
+                                                    open_k_first,
+                                                    num_open_buckets,
+                                                    bucket_idx_open_first,
+                                                    bucket_idx_next});
+
+      vertex_frontier.bucket(bucket_idx_cur).clear();
+      vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+      vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
     }
+
+    k += delta;
   }
 }
 
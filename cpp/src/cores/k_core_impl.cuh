@@ -37,16 +37,36 @@ k_core(raft::handle_t const& handle,
        std::optional<raft::device_span<edge_t const>> core_numbers,
        bool do_expensive_check)
 {
+  // core_number and extract_induced_subgraphs scan every edge (including the masked out edges),
+  // build a compacted graph first if most edges are masked out
+
+  auto cur_graph_view = graph_view;
+  std::optional<graph_t<vertex_t, edge_t, false, multi_gpu>> compacted_graph{std::nullopt};
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>>
+    compacted_edge_weights{std::nullopt};
+  {
+    auto compacted =
+      compact_graph_if_sparse(handle, graph_view, edge_weight_view, 0.5, do_expensive_check);
+    if (compacted) {
+      compacted_graph        = std::move(std::get<0>(*compacted));
+      compacted_edge_weights = std::move(std::get<1>(*compacted));
+      cur_graph_view         = (*compacted_graph).view();
+      edge_weight_view       = compacted_edge_weights
+                                 ? std::make_optional((*compacted_edge_weights).view())
+                                 : std::nullopt;
+    }
+  }
+
   rmm::device_uvector<edge_t> computed_core_numbers(0, handle.get_stream());
 
   if (!core_numbers) {
     CUGRAPH_EXPECTS(degree_type.has_value(),
                     "If core_numbers is not specified then degree_type must be specified");
 
-    computed_core_numbers.resize(graph_view.local_vertex_partition_range_size(),
+    computed_core_numbers.resize(cur_graph_view.local_vertex_partition_range_size(),
                                  handle.get_stream());
     core_number(handle,
-                graph_view,
+                cur_graph_view,
                 computed_core_numbers.data(),
                 *degree_type,
                 size_t{0},
@@ -61,10 +81,10 @@ k_core(raft::handle_t const& handle,
   auto iter_end = thrust::copy_if(
     handle.get_thrust_policy(),
     thrust::make_zip_iterator(
-      thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+      thrust::make_counting_iterator(cur_graph_view.local_vertex_partition_range_first()),
       core_numbers->begin()),
     thrust::make_zip_iterator(
-      thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+      thrust::make_counting_iterator(cur_graph_view.local_vertex_partition_range_last()),
       core_numbers->end()),
     thrust::make_zip_iterator(subgraph_vertices.begin(), thrust::make_discard_iterator()),
     [k] __device__(auto tuple) { return (k <= thrust::get<1>(tuple)); });
@@ -85,7 +105,7 @@ k_core(raft::handle_t const& handle,
 
   auto [src, dst, wgt, offsets] = extract_induced_subgraphs(
     handle,
-    graph_view,
+    cur_graph_view,
     edge_weight_view,
     raft::device_span<size_t const>{subgraph_offsets.data(), subgraph_offsets.size()},
     raft::device_span<vertex_t const>{subgraph_vertices.data(), subgraph_vertices.size()},
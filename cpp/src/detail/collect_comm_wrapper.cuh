@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,11 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
 namespace cugraph {
 namespace detail {
 
@@ -39,5 +44,79 @@ rmm::device_uvector<T> device_allgatherv(raft::handle_t const& handle,
   return gathered_v;
 }
 
+template <typename T>
+size_t device_gatherv_to_buffer(raft::handle_t const& handle,
+                                raft::comms::comms_t const& comm,
+                                raft::device_span<T const> d_input,
+                                T* output,
+                                size_t output_size,
+                                size_t max_chunk_size,
+                                std::optional<int> root)
+{
+  auto const comm_rank = comm.get_rank();
+  auto const comm_size = comm.get_size();
+
+  CUGRAPH_EXPECTS(max_chunk_size > 0,
+                  "Invalid input argument: max_chunk_size should be a positive integer.");
+  CUGRAPH_EXPECTS(!root || ((*root >= 0) && (*root < comm_size)),
+                  "Invalid input argument: root should be a valid rank.");
+
+  auto rx_sizes = cugraph::host_scalar_allgather(comm, d_input.size(), handle.get_stream());
+  std::vector<size_t> rx_displs(rx_sizes.size(), size_t{0});
+  std::partial_sum(rx_sizes.begin(), rx_sizes.end() - 1, rx_displs.begin() + 1);
+  auto gathered_size = std::reduce(rx_sizes.begin(), rx_sizes.end());
+
+  bool receive = !root || (*root == comm_rank);
+  CUGRAPH_EXPECTS(!receive || (output_size >= gathered_size),
+                  "Invalid input argument: output_size is smaller than the gathered size.");
+
+  auto max_rx_size = *std::max_element(rx_sizes.begin(), rx_sizes.end());
+  auto num_rounds  = (max_rx_size + max_chunk_size - 1) / max_chunk_size;
+
+  rmm::device_uvector<T> staging(
+    receive ? std::min(max_rx_size, max_chunk_size) * static_cast<size_t>(comm_size) : size_t{0},
+    handle.get_stream());
+
+  std::vector<size_t> round_rx_sizes(rx_sizes.size());
+  std::vector<size_t> round_rx_displs(rx_sizes.size());
+  for (size_t r = 0; r < num_rounds; ++r) {
+    auto round_first = r * max_chunk_size;
+    for (size_t i = 0; i < rx_sizes.size(); ++i) {
+      round_rx_sizes[i] =
+        rx_sizes[i] > round_first ? std::min(rx_sizes[i] - round_first, max_chunk_size) : size_t{0};
+    }
+    std::exclusive_scan(
+      round_rx_sizes.begin(), round_rx_sizes.end(), round_rx_displs.begin(), size_t{0});
+
+    auto input_first = d_input.data() + std::min(round_first, d_input.size());
+    if (root) {
+      cugraph::device_gatherv(comm,
+                              input_first,
+                              staging.data(),
+                              round_rx_sizes[comm_rank],
+                              round_rx_sizes,
+                              round_rx_displs,
+                              *root,
+                              handle.get_stream());
+    } else {
+      cugraph::device_allgatherv(
+        comm, input_first, staging.data(), round_rx_sizes, round_rx_displs, handle.get_stream());
+    }
+
+    if (receive) {
+      for (size_t i = 0; i < rx_sizes.size(); ++i) {
+        if (round_rx_sizes[i] > 0) {
+          raft::copy(output + rx_displs[i] + round_first,
+                     staging.data() + round_rx_displs[i],
+                     round_rx_sizes[i],
+                     handle.get_stream());
+        }
+      }
+    }
+  }
+
+  return gathered_size;
+}
+
 }  // namespace detail
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,5 +36,21 @@ template rmm::device_uvector<float> device_allgatherv(raft::handle_t const& hand
                                                       raft::comms::comms_t const& comm,
                                                       raft::device_span<float const> d_input);
 
+template size_t device_gatherv_to_buffer(raft::handle_t const& handle,
+                                         raft::comms::comms_t const& comm,
+                                         raft::device_span<int32_t const> d_input,
+                                         int32_t* output,
+                                         size_t output_size,
+                                         size_t max_chunk_size,
+                                         std::optional<int> root);
+
+template size_t device_gatherv_to_buffer(raft::handle_t const& handle,
+                                         raft::comms::comms_t const& comm,
+                                         raft::device_span<float const> d_input,
+                                         float* output,
+                                         size_t output_size,
+                                         size_t max_chunk_size,
+                                         std::optional<int> root);
+
 }  // namespace detail
 }  // namespace cugraph
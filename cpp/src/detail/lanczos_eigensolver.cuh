@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "prims/transform_reduce_v.cuh"
+
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// eigenvalues and eigenvectors (the columns of the returned row-major n x n matrix) of a small
+// dense symmetric (row-major n x n) matrix, computed with cyclic Jacobi rotations
+template <typename T>
+std::tuple<std::vector<T>, std::vector<T>> host_symmetric_eigen(std::vector<T> a, size_t n)
+{
+  std::vector<T> v(n * n, T{0.0});
+  for (size_t i = 0; i < n; ++i) {
+    v[i * n + i] = T{1.0};
+  }
+
+  T total{0.0};
+  for (auto val : a) {
+    total += val * val;
+  }
+
+  size_t constexpr max_sweeps{100};
+  for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+    T off{0.0};
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        off += a[p * n + q] * a[p * n + q];
+      }
+    }
+    if (off <= std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * total) {
+      break;
+    }
+
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        if (a[p * n + q] == T{0.0}) { continue; }
+        auto theta = (a[q * n + q] - a[p * n + p]) / (T{2.0} * a[p * n + q]);
+        auto t     = (theta >= T{0.0} ? T{1.0} : T{-1.0}) /
+                 (std::abs(theta) + std::sqrt(theta * theta + T{1.0}));
+        auto c = T{1.0} / std::sqrt(t * t + T{1.0});
+        auto s = t * c;
+        for (size_t k = 0; k < n; ++k) {
+          auto akp     = a[k * n + p];
+          auto akq     = a[k * n + q];
+          a[k * n + p] = c * akp - s * akq;
+          a[k * n + q] = s * akp + c * akq;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto apk     = a[p * n + k];
+          auto aqk     = a[q * n + k];
+          a[p * n + k] = c * apk - s * aqk;
+          a[q * n + k] = s * apk + c * aqk;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto vkp     = v[k * n + p];
+          auto vkq     = v[k * n + q];
+          v[k * n + p] = c * vkp - s * vkq;
+          v[k * n + q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  std::vector<T> eigenvalues(n);
+  for (size_t i = 0; i < n; ++i) {
+    eigenvalues[i] = a[i * n + i];
+  }
+
+  return std::make_tuple(std::move(eigenvalues), std::move(v));
+}
+
+// x[i] = sum_j basis[j * n + i] * coefficients[j] (or x[i] -= sum_j ... if subtract is true) over
+// the first num_coefficients basis vectors
+template <typename T>
+void combine_basis_vectors(raft::handle_t const& handle,
+                           T const* basis,
+                           size_t n,
+                           T const* coefficients,
+                           size_t num_coefficients,
+                           T* x,
+                           bool subtract)
+{
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(n),
+                   [basis, n, coefficients, num_coefficients, x, subtract] __device__(size_t i) {
+                     T sum{0.0};
+                     for (size_t j = 0; j < num_coefficients; ++j) {
+                       sum += basis[j * n + i] * coefficients[j];
+                     }
+                     x[i] = subtract ? x[i] - sum : sum;
+                   });
+}
+
+template <typename T>
+struct basis_times_vector_t {
+  T const* basis{nullptr};
+  T const* w{nullptr};
+  size_t n{};
+
+  __device__ T operator()(size_t i) const { return basis[i] * w[i % n]; }
+};
+
+// coefficients = V^T w over the first k basis vectors (one reduction and, in multi-GPU, one
+// allreduce), then w -= V coefficients; returns the coefficients
+template <typename GraphViewType, typename T>
+std::vector<T> orthogonalize_against_basis(raft::handle_t const& handle,
+                                           T const* basis,
+                                           size_t n,
+                                           size_t k,
+                                           T* w,
+                                           raft::device_span<T> coefficients)
+{
+  thrust::fill(handle.get_thrust_policy(), coefficients.begin(), coefficients.begin() + k, T{0.0});
+  thrust::reduce_by_key(
+    handle.get_thrust_policy(),
+    thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                    divider_t<size_t>{n}),
+    thrust::make_transform_iterator(thrust::make_counting_iterator(k * n), divider_t<size_t>{n}),
+    thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                    basis_times_vector_t<T>{basis, w, n}),
+    thrust::make_discard_iterator(),
+    coefficients.begin());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     coefficients.data(),
+                     coefficients.data(),
+                     k,
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  combine_basis_vectors(handle, basis, n, coefficients.data(), k, w, true);
+
+  std::vector<T> h_coefficients(k);
+  raft::update_host(h_coefficients.data(), coefficients.data(), k, handle.get_stream());
+  handle.sync_stream();
+  return h_coefficients;
+}
+
+template <typename GraphViewType, typename T>
+T vertex_l2_norm(raft::handle_t const& handle, GraphViewType const& graph_view, T const* v)
+{
+  return std::sqrt(transform_reduce_v(
+    handle, graph_view, v, [] __device__(auto, auto val) { return val * val; }, T{0.0}));
+}
+
+/**
+ * Compute the largest (algebraic) eigenvalue and the corresponding eigenvector of a symmetric
+ * linear operator over the vertices of a graph with the explicitly restarted Lanczos method.
+ *
+ * Every restart cycle builds a Krylov basis of (up to) krylov_dimension vectors (with full
+ * reorthogonalization, so the basis takes krylov_dimension local vertex partition sized vectors),
+ * the Ritz vector of the largest Ritz value of the cycle starts the next cycle. The iteration stops
+ * once the residual norm ||A x - theta x|| of the (L2 normalized) Ritz vector x is at most
+ * tolerance * |theta|.
+ *
+ * @param linear_operator  Callable computing y = A x for local vertex partition sized device spans
+ *                         x and y (called as linear_operator(x, y) on every GPU)
+ * @param x                Starting vector (should not be orthogonal to the eigenvector),
+ *                         overwritten with the L2 normalized eigenvector
+ * @param max_operator_applications  Maximum number of linear_operator calls
+ * @param deflation_basis  Optional pointer to deflation_basis_size orthonormal (local vertex
+ *                         partition sized) eigenvectors of the operator, the search is restricted
+ *                         to their orthogonal complement (so the next largest eigenpair is found)
+ *
+ * @return tuple of the eigenvalue, the relative residual norm and the number of linear_operator
+ * calls
+ */
+template <typename GraphViewType, typename LinearOperator, typename T>
+std::tuple<T, T, size_t> lanczos_largest_eigenpair(raft::handle_t const& handle,
+                                                   GraphViewType const& graph_view,
+                                                   LinearOperator linear_operator,
+                                                   raft::device_span<T> x,
+                                                   T tolerance,
+                                                   size_t max_operator_applications,
+                                                   size_t krylov_dimension     = 16,
+                                                   T const* deflation_basis    = nullptr,
+                                                   size_t deflation_basis_size = 0)
+{
+  CUGRAPH_EXPECTS(krylov_dimension >= 2,
+                  "Invalid input argument: krylov_dimension should be at least 2.");
+
+  auto const n = x.size();
+
+  rmm::device_uvector<T> basis(krylov_dimension * n, handle.get_stream());
+  rmm::device_uvector<T> w(n, handle.get_stream());
+  rmm::device_uvector<T> coefficients(std::max(krylov_dimension, deflation_basis_size),
+                                      handle.get_stream());
+
+  auto deflate = [&](T* v) {
+    for (size_t pass = 0; pass < 2; ++pass) {
+      orthogonalize_against_basis<GraphViewType>(
+        handle,
+        deflation_basis,
+        n,
+        deflation_basis_size,
+        v,
+        raft::device_span<T>(coefficients.data(), coefficients.size()));
+    }
+  };
+
+  if (deflation_basis_size > 0) { deflate(x.data()); }
+  auto x_norm = vertex_l2_norm(handle, graph_view, x.data());
+  CUGRAPH_EXPECTS(x_norm > T{0.0},
+                  "Invalid input argument: the starting vector should be nonzero (after "
+                  "deflation).");
+
+  T theta{0.0};
+  T relative_residual{std::numeric_limits<T>::max()};
+  size_t num_operator_applications{0};
+  while (num_operator_applications < max_operator_applications) {
+    thrust::transform(handle.get_thrust_policy(),
+                      x.begin(),
+                      x.end(),
+                      basis.begin(),
+                      [x_norm] __device__(auto val) { return val / x_norm; });
+
+    // tridiagonal matrix of the cycle
+    std::vector<T> alphas{};
+    std::vector<T> betas{};
+    auto cycle_dimension =
+      std::min(krylov_dimension, max_operator_applications - num_operator_applications);
+    for (size_t k = 0; k < cycle_dimension; ++k) {
+      linear_operator(raft::device_span<T const>(basis.data() + k * n, n),
+                      raft::device_span<T>(w.data(), n));
+      ++num_operator_applications;
+      if (deflation_basis_size > 0) { deflate(w.data()); }
+
+      auto alpha = orthogonalize_against_basis<GraphViewType>(
+        handle,
+        basis.data(),
+        n,
+        k + 1,
+        w.data(),
+        raft::device_span<T>(coefficients.data(), coefficients.size()))[k];
+      // the second pass restores the orthogonality lost to rounding
+      alpha += orthogonalize_against_basis<GraphViewType>(
+        handle,
+        basis.data(),
+        n,
+        k + 1,
+        w.data(),
+        raft::device_span<T>(coefficients.data(), coefficients.size()))[k];
+      alphas.push_back(alpha);
+
+      auto beta = vertex_l2_norm(handle, graph_view, w.data());
+      betas.push_back(beta);
+      if ((k + 1 == cycle_dimension) ||
+          (beta <= std::numeric_limits<T>::epsilon() * std::abs(alpha))) {
+        break;  // the Krylov subspace is invariant if beta is (numerically) 0
+      }
+      thrust::transform(handle.get_thrust_policy(),
+                        w.begin(),
+                        w.end(),
+                        basis.begin() + (k + 1) * n,
+                        [beta] __device__(auto val) { return val / beta; });
+    }
+
+    auto m = alphas.size();
+    std::vector<T> tridiagonal(m * m, T{0.0});
+    for (size_t i = 0; i < m; ++i) {
+      tridiagonal[i * m + i] = alphas[i];
+      if (i + 1 < m) {
+        tridiagonal[i * m + i + 1] = betas[i];
+        tridiagonal[(i + 1) * m + i] = betas[i];
+      }
+    }
+    auto [ritz_values, ritz_vectors] = host_symmetric_eigen(std::move(tridiagonal), m);
+    auto largest =
+      static_cast<size_t>(std::distance(ritz_values.begin(),
+                                        std::max_element(ritz_values.begin(), ritz_values.end())));
+    theta = ritz_values[largest];
+
+    // x = V s, ||A x - theta x|| = beta_m |s_m| with full reorthogonalization
+    std::vector<T> s(m);
+    for (size_t i = 0; i < m; ++i) {
+      s[i] = ritz_vectors[i * m + largest];
+    }
+    raft::update_device(coefficients.data(), s.data(), m, handle.get_stream());
+    combine_basis_vectors(handle, basis.data(), n, coefficients.data(), m, x.data(), false);
+    x_norm = vertex_l2_norm(handle, graph_view, x.data());
+
+    relative_residual = theta != T{0.0} ? betas.back() * std::abs(s.back()) / std::abs(theta)
+                                        : std::numeric_limits<T>::max();
+    if (relative_residual <= tolerance) { break; }
+  }
+
+  thrust::transform(handle.get_thrust_policy(),
+                    x.begin(),
+                    x.end(),
+                    x.begin(),
+                    [x_norm] __device__(auto val) { return val / x_norm; });
+
+  return std::make_tuple(theta, relative_residual, num_operator_applications);
+}
+
+/**
+ * Compute the num_eigenpairs largest (algebraic) eigenvalues and the corresponding eigenvectors of
+ * a symmetric linear operator over the vertices of a graph with deflation: the eigenpairs are
+ * computed one at a time by lanczos_largest_eigenpair restricted to the orthogonal complement of
+ * the previously computed eigenvectors. The operator application budget is split evenly among
+ * the eigenpairs yet to compute (so budget unused by an eigenpair goes to the remaining ones).
+ *
+ * @param linear_operator  Callable computing y = A x for local vertex partition sized device spans
+ *                         x and y (called as linear_operator(x, y) on every GPU)
+ * @param eigenvectors     Starting vectors (num_eigenpairs local vertex partition sized vectors
+ *                         stored one after another), overwritten with the L2 normalized
+ *                         eigenvectors
+ * @param max_operator_applications  Maximum number of linear_operator calls (over all eigenpairs)
+ *
+ * @return tuple of the eigenvalues, the largest relative residual norm and the number of
+ * linear_operator calls
+ */
+template <typename GraphViewType, typename LinearOperator, typename T>
+std::tuple<std::vector<T>, T, size_t> lanczos_largest_eigenpairs(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  LinearOperator linear_operator,
+  raft::device_span<T> eigenvectors,
+  size_t num_eigenpairs,
+  T tolerance,
+  size_t max_operator_applications,
+  size_t krylov_dimension = 16)
+{
+  CUGRAPH_EXPECTS((num_eigenpairs > 0) && (eigenvectors.size() % num_eigenpairs == 0),
+                  "Invalid input argument: eigenvectors.size() should be a multiple of "
+                  "num_eigenpairs.");
+
+  auto const n = eigenvectors.size() / num_eigenpairs;
+
+  std::vector<T> eigenvalues(num_eigenpairs);
+  T max_relative_residual{0.0};
+  size_t num_operator_applications{0};
+  for (size_t i = 0; i < num_eigenpairs; ++i) {
+    auto budget = (max_operator_applications - num_operator_applications) / (num_eigenpairs - i);
+    auto [eigenvalue, relative_residual, num_applications] =
+      lanczos_largest_eigenpair(handle,
+                                graph_view,
+                                linear_operator,
+                                raft::device_span<T>(eigenvectors.data() + i * n, n),
+                                tolerance,
+                                budget,
+                                krylov_dimension,
+                                static_cast<T const*>(eigenvectors.data()),
+                                i);
+    eigenvalues[i]        = eigenvalue;
+    max_relative_residual = std::max(max_relative_residual, relative_residual);
+    num_operator_applications += num_applications;
+  }
+
+  return std::make_tuple(std::move(eigenvalues), max_relative_residual, num_operator_applications);
+}
+
+}  // namespace detail
+}  // namespace cugraph
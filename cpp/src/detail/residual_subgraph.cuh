@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// The iterative algorithms that settle a subset of the vertices per round (approximate weighted
+// matching, maximal independent set, vertex coloring) have a long tail of rounds settling only a
+// handful of vertices, every such round still runs over the whole (masked) graph and, in multi-GPU,
+// pays for the collective communication. Once the residual problem is small enough, it is extracted
+// (as an induced subgraph), gathered to GPU 0 and finished there with the single-GPU algorithm.
+size_t constexpr tail_switch_max_residual_size{size_t{1} << 20};
+size_t constexpr tail_switch_min_size_ratio{32};
+
+// true if a residual problem of residual_size (vertices or edges) out of total_size should be
+// finished on a single GPU, the ratio bound makes the (single-GPU) recursion on the residual
+// problem shrink geometrically
+inline bool switch_to_tail(size_t residual_size, size_t total_size)
+{
+  return (residual_size > 0) && (residual_size <= tail_switch_max_residual_size) &&
+         (residual_size * tail_switch_min_size_ratio <= total_size);
+}
+
+template <typename T>
+rmm::device_uvector<T> gather_to_root(raft::handle_t const& handle, rmm::device_uvector<T>&& values)
+{
+  auto& comm           = handle.get_comms();
+  auto const comm_rank = comm.get_rank();
+
+  auto rx_counts = host_scalar_gather(comm, values.size(), int{0}, handle.get_stream());
+  std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+  if (comm_rank == 0) {
+    std::exclusive_scan(rx_counts.begin(), rx_counts.end(), displacements.begin(), size_t{0});
+  }
+
+  rmm::device_uvector<T> gathered_values(
+    comm_rank == 0 ? std::reduce(rx_counts.begin(), rx_counts.end()) : size_t{0},
+    handle.get_stream());
+  device_gatherv(comm,
+                 values.begin(),
+                 gathered_values.begin(),
+                 values.size(),
+                 rx_counts,
+                 displacements,
+                 int{0},
+                 handle.get_stream());
+
+  return gathered_values;
+}
+
+/**
+ * Extract the subgraph induced by @p vertices and gather it to GPU 0 as a renumbered single-GPU
+ * graph.
+ *
+ * @param vertices  Sorted local (to this GPU's vertex partition) vertices inducing the subgraph.
+ * @return On GPU 0 (or in single-GPU), tuple of the subgraph, the optional subgraph edge weights
+ * and the renumber map (mapping the subgraph vertices to the @p graph_view vertices),
+ * std::nullopt on the other GPUs.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::optional<
+  std::tuple<graph_t<vertex_t, edge_t, false, false>,
+             std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, false>, weight_t>>,
+             rmm::device_uvector<vertex_t>>>
+gather_induced_subgraph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> vertices)
+{
+  std::vector<size_t> h_subgraph_offsets{0, vertices.size()};
+  rmm::device_uvector<size_t> subgraph_offsets(h_subgraph_offsets.size(), handle.get_stream());
+  raft::update_device(subgraph_offsets.data(),
+                      h_subgraph_offsets.data(),
+                      h_subgraph_offsets.size(),
+                      handle.get_stream());
+
+  auto [srcs, dsts, weights, edge_offsets] = extract_induced_subgraphs(
+    handle,
+    graph_view,
+    edge_weight_view,
+    raft::device_span<size_t const>(subgraph_offsets.data(), subgraph_offsets.size()),
+    vertices);
+
+  rmm::device_uvector<vertex_t> subgraph_vertices(vertices.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), vertices.begin(), vertices.end(), subgraph_vertices.begin());
+
+  if constexpr (multi_gpu) {
+    subgraph_vertices = gather_to_root(handle, std::move(subgraph_vertices));
+    srcs              = gather_to_root(handle, std::move(srcs));
+    dsts              = gather_to_root(handle, std::move(dsts));
+    if (weights) { *weights = gather_to_root(handle, std::move(*weights)); }
+    if (handle.get_comms().get_rank() != 0) { return std::nullopt; }
+  }
+
+  graph_t<vertex_t, edge_t, false, false> subgraph(handle);
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+    subgraph_weights{std::nullopt};
+  std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+  std::tie(subgraph, subgraph_weights, std::ignore, std::ignore, renumber_map) =
+    create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, false, false>(
+      handle,
+      std::make_optional(std::move(subgraph_vertices)),
+      std::move(srcs),
+      std::move(dsts),
+      std::move(weights),
+      std::nullopt,
+      std::nullopt,
+      graph_properties_t{graph_view.is_symmetric(), graph_view.is_multigraph()},
+      true);
+
+  return std::make_tuple(
+    std::move(subgraph), std::move(subgraph_weights), std::move(*renumber_map));
+}
+
+// send the (vertex, value) pairs computed on GPU 0 (for the gathered residual problem) back to the
+// GPUs owning the vertices
+template <typename vertex_t, typename value_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<value_t>> scatter_from_root(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& vertices,
+  rmm::device_uvector<value_t>&& values,
+  std::vector<vertex_t> const& vertex_partition_range_lasts)
+{
+  if constexpr (multi_gpu) {
+    std::tie(vertices, values) =
+      shuffle_int_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+        handle, std::move(vertices), std::move(values), vertex_partition_range_lasts);
+  }
+  return std::make_tuple(std::move(vertices), std::move(values));
+}
+
+}  // namespace detail
+}  // namespace cugraph
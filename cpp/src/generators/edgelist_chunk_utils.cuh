@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+
+#include <cugraph/partition_manager.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// returns true if an (src, dst) pair belongs to a 2D edge partition other than this GPU's
+template <typename vertex_t>
+struct is_not_local_edge_t {
+  compute_gpu_id_from_ext_edge_endpoints_t<vertex_t> key_func{};
+  int comm_rank{0};
+  bool store_transposed{false};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> pair /* src, dst */) const
+  {
+    return store_transposed ? (key_func(thrust::get<1>(pair), thrust::get<0>(pair)) != comm_rank)
+                            : (key_func(thrust::get<0>(pair), thrust::get<1>(pair)) != comm_rank);
+  }
+};
+
+template <typename vertex_t>
+is_not_local_edge_t<vertex_t> make_is_not_local_edge(raft::handle_t const& handle,
+                                                     bool store_transposed)
+{
+  auto& comm       = handle.get_comms();
+  auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+  auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+  return is_not_local_edge_t<vertex_t>{
+    compute_gpu_id_from_ext_edge_endpoints_t<vertex_t>{
+      comm.get_size(), major_comm.get_size(), minor_comm.get_size()},
+    comm.get_rank(),
+    store_transposed};
+}
+
+// append [pair_first, pair_first + num_pairs) to (src_chunks, dst_chunks), every chunk (except for
+// the last one) holds max_chunk_size edges
+template <typename vertex_t, typename PairIterator>
+void append_to_edgelist_chunks(raft::handle_t const& handle,
+                               PairIterator pair_first,
+                               size_t num_pairs,
+                               std::vector<rmm::device_uvector<vertex_t>>& src_chunks,
+                               std::vector<rmm::device_uvector<vertex_t>>& dst_chunks,
+                               size_t max_chunk_size)
+{
+  size_t offset{0};
+  while (offset < num_pairs) {
+    if (src_chunks.empty() || (src_chunks.back().size() == max_chunk_size)) {
+      src_chunks.emplace_back(0, handle.get_stream());
+      dst_chunks.emplace_back(0, handle.get_stream());
+      src_chunks.back().reserve(max_chunk_size, handle.get_stream());
+      dst_chunks.back().reserve(max_chunk_size, handle.get_stream());
+    }
+    auto& srcs       = src_chunks.back();
+    auto& dsts       = dst_chunks.back();
+    auto cur_size    = srcs.size();
+    auto num_to_copy = std::min(num_pairs - offset, max_chunk_size - cur_size);
+    srcs.resize(cur_size + num_to_copy, handle.get_stream());
+    dsts.resize(cur_size + num_to_copy, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 pair_first + offset,
+                 pair_first + (offset + num_to_copy),
+                 thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())) +
+                   cur_size);
+    offset += num_to_copy;
+  }
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "generators/edgelist_chunk_utils.cuh"
+
 #include <cugraph/graph_generators.hpp>
 #include <cugraph/utilities/error.hpp>
 
@@ -28,8 +30,13 @@
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/random.h>
+#include <thrust/remove.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 namespace cugraph {
 
 template <typename vertex_t>
@@ -84,6 +91,85 @@ generate_erdos_renyi_graph_edgelist_gnp(raft::handle_t const& handle,
   return std::make_tuple(std::move(src_v), std::move(dst_v));
 }
 
+template <typename vertex_t, bool multi_gpu>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>, std::vector<rmm::device_uvector<vertex_t>>>
+generate_erdos_renyi_graph_edgelist_gnp_for_local_partition(raft::handle_t const& handle,
+                                                            vertex_t num_vertices,
+                                                            float p,
+                                                            vertex_t base_vertex_id,
+                                                            uint64_t seed,
+                                                            bool store_transposed,
+                                                            size_t max_chunk_size)
+{
+  CUGRAPH_EXPECTS(num_vertices < std::numeric_limits<int32_t>::max(),
+                  "Implementation cannot support specified value");
+  CUGRAPH_EXPECTS(max_chunk_size > 0, "Invalid input argument: max_chunk_size should be positive.");
+
+  size_t max_num_edges = static_cast<size_t>(num_vertices) * num_vertices;
+
+  auto generate_random_value = cuda::proclaim_return_type<float>([seed] __device__(size_t index) {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_real_distribution<float> dist(0.0, 1.0);
+    rng.discard(index);
+    return dist(rng);
+  });
+
+  // to limit memory footprint (1024 is a tuning parameter)
+  auto max_candidates_per_iteration =
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * 1024;
+  rmm::device_uvector<vertex_t> tmp_srcs(std::min(max_num_edges, max_candidates_per_iteration),
+                                         handle.get_stream());
+  rmm::device_uvector<vertex_t> tmp_dsts(tmp_srcs.size(), handle.get_stream());
+
+  std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+  std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+
+  // every GPU visits every candidate edge (the random value of a candidate is a function of seed
+  // and its index) and keeps only the edges in its own 2D edge partition
+  size_t num_candidates_visited{0};
+  while (num_candidates_visited < max_num_edges) {
+    auto num_candidates =
+      std::min(max_num_edges - num_candidates_visited, max_candidates_per_iteration);
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tmp_srcs.begin(), tmp_dsts.begin()));
+    auto pair_last = thrust::copy_if(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(num_candidates_visited),
+      thrust::make_counting_iterator(num_candidates_visited + num_candidates),
+      thrust::make_transform_output_iterator(
+        pair_first,
+        cuda::proclaim_return_type<thrust::tuple<vertex_t, vertex_t>>(
+          [num_vertices, base_vertex_id] __device__(size_t index) {
+            return thrust::make_tuple(
+              base_vertex_id + static_cast<vertex_t>(index / num_vertices),
+              base_vertex_id + static_cast<vertex_t>(index % num_vertices));
+          })),
+      [generate_random_value, p] __device__(size_t index) {
+        return generate_random_value(index) < p;
+      });
+    auto num_local_edges = static_cast<size_t>(thrust::distance(pair_first, pair_last.base()));
+    if constexpr (multi_gpu) {
+      num_local_edges = static_cast<size_t>(thrust::distance(
+        pair_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          pair_first,
+                          pair_first + num_local_edges,
+                          detail::make_is_not_local_edge<vertex_t>(handle, store_transposed))));
+    }
+    detail::append_to_edgelist_chunks(
+      handle, pair_first, num_local_edges, src_chunks, dst_chunks, max_chunk_size);
+
+    num_candidates_visited += num_candidates;
+  }
+
+  if (!src_chunks.empty()) {
+    src_chunks.back().shrink_to_fit(handle.get_stream());
+    dst_chunks.back().shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(src_chunks), std::move(dst_chunks));
+}
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
 generate_erdos_renyi_graph_edgelist_gnm(raft::handle_t const& handle,
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "generators/erdos_renyi_generator.cuh"
+
+#include <cugraph/graph_generators.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>>
+generate_erdos_renyi_graph_edgelist_gnp_for_local_partition<int64_t, true>(
+  raft::handle_t const& handle,
+  int64_t num_vertices,
+  float p,
+  int64_t base_vertex_id,
+  uint64_t seed,
+  bool store_transposed,
+  size_t max_chunk_size);
+
+}  // namespace cugraph
@@ -46,4 +46,15 @@ generate_erdos_renyi_graph_edgelist_gnm(raft::handle_t const& handle,
                                         int32_t base_vertex_id,
                                         uint64_t seed);
 
+template std::tuple<std::vector<rmm::device_uvector<int32_t>>,
+                    std::vector<rmm::device_uvector<int32_t>>>
+generate_erdos_renyi_graph_edgelist_gnp_for_local_partition<int32_t, false>(
+  raft::handle_t const& handle,
+  int32_t num_vertices,
+  float p,
+  int32_t base_vertex_id,
+  uint64_t seed,
+  bool store_transposed,
+  size_t max_chunk_size);
+
 }  // namespace cugraph
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 #pragma once
+
+#include "generators/edgelist_chunk_utils.cuh"
+#include "generators/scramble.cuh"
+
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_generators.hpp>
 #include <cugraph/utilities/error.hpp>
@@ -26,13 +30,64 @@
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <tuple>
+#include <vector>
 
 namespace cugraph {
 
+namespace detail {
+
+// compute the i'th R-mat edge from 2 * scale uniform random numbers in [0, 1)
+template <typename vertex_t>
+struct rmat_edge_t {
+  size_t scale{};
+  bool clip_and_flip{};
+  float const* rands{nullptr};
+  double a_plus_b{};
+  double a_norm{};
+  double c_norm{};
+
+  // if a + b == 0.0, a_norm is irrelevant, if (1.0 - (a+b)) == 0.0, c_norm is irrelevant
+  rmat_edge_t(size_t scale, bool clip_and_flip, float const* rands, double a, double b, double c)
+    : scale(scale),
+      clip_and_flip(clip_and_flip),
+      rands(rands),
+      a_plus_b(a + b),
+      a_norm((a + b) > 0.0 ? a / (a + b) : 0.0),
+      c_norm((1.0 - (a + b)) > 0.0 ? c / (1.0 - (a + b)) : 0.0)
+  {
+  }
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(size_t i) const
+  {
+    vertex_t src{0};
+    vertex_t dst{0};
+    for (int bit = static_cast<int>(scale) - 1; bit >= 0; --bit) {
+      auto r0          = rands[i * 2 * scale + 2 * bit];
+      auto r1          = rands[i * 2 * scale + 2 * bit + 1];
+      auto src_bit_set = r0 > a_plus_b;
+      auto dst_bit_set = r1 > (src_bit_set ? c_norm : a_norm);
+      if (clip_and_flip) {
+        if (src == dst) {
+          if (!src_bit_set && dst_bit_set) {
+            src_bit_set = !src_bit_set;
+            dst_bit_set = !dst_bit_set;
+          }
+        }
+      }
+      src += src_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
+      dst += dst_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
+    }
+    return thrust::make_tuple(src, dst);
+  }
+};
+
+}  // namespace detail
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generate_rmat_edgelist(
   raft::handle_t const& handle,
@@ -75,33 +130,7 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generat
       thrust::make_counting_iterator(size_t{0}),
       thrust::make_counting_iterator(num_edges_to_generate),
       pair_first,
-      // if a + b == 0.0, a_norm is irrelevant, if (1.0 - (a+b)) == 0.0, c_norm is irrelevant
-      [scale,
-       clip_and_flip,
-       rands    = rands.data(),
-       a_plus_b = a + b,
-       a_norm   = (a + b) > 0.0 ? a / (a + b) : 0.0,
-       c_norm   = (1.0 - (a + b)) > 0.0 ? c / (1.0 - (a + b)) : 0.0] __device__(auto i) {
-        vertex_t src{0};
-        vertex_t dst{0};
-        for (int bit = static_cast<int>(scale) - 1; bit >= 0; --bit) {
-          auto r0          = rands[i * 2 * scale + 2 * bit];
-          auto r1          = rands[i * 2 * scale + 2 * bit + 1];
-          auto src_bit_set = r0 > a_plus_b;
-          auto dst_bit_set = r1 > (src_bit_set ? c_norm : a_norm);
-          if (clip_and_flip) {
-            if (src == dst) {
-              if (!src_bit_set && dst_bit_set) {
-                src_bit_set = !src_bit_set;
-                dst_bit_set = !dst_bit_set;
-              }
-            }
-          }
-          src += src_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
-          dst += dst_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : 0;
-        }
-        return thrust::make_tuple(src, dst);
-      });
+      detail::rmat_edge_t<vertex_t>{scale, clip_and_flip, rands.data(), a, b, c});
     num_edges_generated += num_edges_to_generate;
   }
 
@@ -112,6 +141,91 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generat
   }
 }
 
+template <typename vertex_t, bool multi_gpu>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>, std::vector<rmm::device_uvector<vertex_t>>>
+generate_rmat_edgelist_for_local_partition(raft::handle_t const& handle,
+                                           raft::random::RngState& rng_state,
+                                           size_t scale,
+                                           size_t num_edges,
+                                           double a,
+                                           double b,
+                                           double c,
+                                           bool clip_and_flip,
+                                           bool scramble_vertex_ids,
+                                           bool store_transposed,
+                                           size_t max_chunk_size)
+{
+  CUGRAPH_EXPECTS((size_t{1} << scale) <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+                  "Invalid input argument: scale too large for vertex_t.");
+  CUGRAPH_EXPECTS((a >= 0.0) && (b >= 0.0) && (c >= 0.0) && (a + b + c <= 1.0),
+                  "Invalid input argument: a, b, c should be non-negative and a + b + c should not "
+                  "be larger than 1.0.");
+  CUGRAPH_EXPECTS(max_chunk_size > 0, "Invalid input argument: max_chunk_size should be positive.");
+
+  // to limit memory footprint (1024 is a tuning parameter)
+  auto max_edges_to_generate_per_iteration =
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * 1024;
+  rmm::device_uvector<float> rands(
+    std::min(num_edges, max_edges_to_generate_per_iteration) * 2 * scale, handle.get_stream());
+  rmm::device_uvector<vertex_t> tmp_srcs(std::min(num_edges, max_edges_to_generate_per_iteration),
+                                         handle.get_stream());
+  rmm::device_uvector<vertex_t> tmp_dsts(tmp_srcs.size(), handle.get_stream());
+
+  std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+  std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+
+  // every GPU generates the same edge stream (rng_state should be identical in every GPU) and keeps
+  // only the edges in its own 2D edge partition; this trades redundant (but cheap) edge generation
+  // for never materializing (or shuffling) the global edge list
+  size_t num_edges_generated{0};
+  while (num_edges_generated < num_edges) {
+    auto num_edges_to_generate =
+      std::min(num_edges - num_edges_generated, max_edges_to_generate_per_iteration);
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tmp_srcs.begin(), tmp_dsts.begin()));
+
+    detail::uniform_random_fill(
+      handle.get_stream(), rands.data(), num_edges_to_generate * 2 * scale, 0.0f, 1.0f, rng_state);
+
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_edges_to_generate),
+                      pair_first,
+                      detail::rmat_edge_t<vertex_t>{scale, clip_and_flip, rands.data(), a, b, c});
+    if (scramble_vertex_ids) {
+      thrust::transform(handle.get_thrust_policy(),
+                        pair_first,
+                        pair_first + num_edges_to_generate,
+                        pair_first,
+                        [scale] __device__(auto pair) {
+                          return thrust::make_tuple(detail::scramble(thrust::get<0>(pair), scale),
+                                                    detail::scramble(thrust::get<1>(pair), scale));
+                        });
+    }
+
+    auto num_local_edges = num_edges_to_generate;
+    if constexpr (multi_gpu) {
+      num_local_edges = static_cast<size_t>(thrust::distance(
+        pair_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          pair_first,
+                          pair_first + num_edges_to_generate,
+                          detail::make_is_not_local_edge<vertex_t>(handle, store_transposed))));
+    }
+    detail::append_to_edgelist_chunks(
+      handle, pair_first, num_local_edges, src_chunks, dst_chunks, max_chunk_size);
+
+    num_edges_generated += num_edges_to_generate;
+  }
+
+  if (!src_chunks.empty()) {
+    src_chunks.back().shrink_to_fit(handle.get_stream());
+    dst_chunks.back().shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(src_chunks), std::move(dst_chunks));
+}
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> generate_rmat_edgelist(
   raft::handle_t const& handle,
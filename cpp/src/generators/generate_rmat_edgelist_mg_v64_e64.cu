@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "generate_rmat_edgelist.cuh"
+
+#include <cugraph/graph_generators.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng.cuh>
+
+#include <rmm/device_uvector.hpp>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>>
+generate_rmat_edgelist_for_local_partition<int64_t, true>(raft::handle_t const& handle,
+                                                          raft::random::RngState& rng_state,
+                                                          size_t scale,
+                                                          size_t num_edges,
+                                                          double a,
+                                                          double b,
+                                                          double c,
+                                                          bool clip_and_flip,
+                                                          bool scramble_vertex_ids,
+                                                          bool store_transposed,
+                                                          size_t max_chunk_size);
+
+}  // namespace cugraph
@@ -81,4 +81,18 @@ generate_rmat_edgelists<int64_t>(raft::handle_t const& handle,
                                  bool clip_and_flip,
                                  bool scramble_vertex_ids);
 
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>>
+generate_rmat_edgelist_for_local_partition<int64_t, false>(raft::handle_t const& handle,
+                                                           raft::random::RngState& rng_state,
+                                                           size_t scale,
+                                                           size_t num_edges,
+                                                           double a,
+                                                           double b,
+                                                           double c,
+                                                           bool clip_and_flip,
+                                                           bool scramble_vertex_ids,
+                                                           bool store_transposed,
+                                                           size_t max_chunk_size);
+
 }  // namespace cugraph
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <optional>
+#include <string>
+
+namespace cugraph {
+namespace jit {
+
+/**
+ * @brief Sum a runtime-compiled edge operator over the outgoing edges of every local vertex.
+ *
+ * @p edge_op_source is CUDA C++ source (compiled with NVRTC on the first call and cached by the
+ * source hash and the vertex, edge, and weight types) defining
+ *
+ *   __device__ double edge_op(long long src, long long dst, double weight);
+ *
+ * src and dst are internal (renumbered) vertex IDs, weight is 1.0 if @p edge_weight_view is
+ * std::nullopt. Masked out edges (if an edge mask is attached to @p graph_view) are skipped.
+ *
+ * The primitives (e.g. transform_e, per_v_transform_reduce_e, and the frontier expansion
+ * primitives) are not instantiated at runtime (they depend on headers NVRTC cannot compile), the
+ * generated kernels read the edge partitions directly. Frontier expansion is not runtime-compiled.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (in the non-transposed storage).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_op_source CUDA C++ source defining the edge operator.
+ * @return Sums of the edge operator outputs for the local vertices.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<double> sum_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+/**
+ * @brief Reduce a runtime-compiled edge operator over the outgoing edges of every local vertex
+ * with a runtime-compiled reduction operator.
+ *
+ * Same as sum_outgoing_edge_op, but @p edge_op_source also defines
+ *
+ *   __device__ double reduce_op(double a, double b);
+ *
+ * which should be associative and commutative (the reduction order is not specified), and @p init
+ * should be its identity element (e.g. 0.0 for a sum or -infinity for a maximum). Vertices without
+ * an outgoing edge get @p init. This is the runtime-compiled counterpart of
+ * per_v_transform_reduce_outgoing_e with a user reduction operator; in multi-GPU, the partial
+ * reductions of each edge partition are gathered to the GPU owning the vertices and folded there
+ * with reduce_op.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (in the non-transposed storage).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_op_source CUDA C++ source defining the edge and the reduction operators.
+ * @param init Identity element of reduce_op.
+ * @return Reductions of the edge operator outputs for the local vertices.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<double> reduce_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source,
+  double init);
+
+/**
+ * @brief Evaluate a runtime-compiled edge operator on every local edge.
+ *
+ * @p edge_op_source defines edge_op as in sum_outgoing_edge_op. This is the runtime-compiled
+ * counterpart of transform_e: the output edge property holds edge_op(src, dst, weight) for every
+ * edge. The values of the masked out edges (if an edge mask is attached to @p graph_view) are left
+ * undefined.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (in the non-transposed storage).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_op_source CUDA C++ source defining the edge operator.
+ * @return Edge property holding the edge operator outputs.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, double> transform_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+}  // namespace jit
+}  // namespace cugraph
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "jit/jit_edge_op.hpp"
+#include "jit/jit_kernel_cache.hpp"
+
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <thrust/fill.h>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace jit {
+
+namespace detail {
+
+template <typename T>
+constexpr char const* jit_type_name()
+{
+  if constexpr (std::is_same_v<T, int32_t>) {
+    return "int";
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return "long long";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "float";
+  } else {
+    static_assert(std::is_same_v<T, double>, "unsupported type.");
+    return "double";
+  }
+}
+
+constexpr char sum_outgoing_edge_op_kernel_name[]    = "cugraph_jit_sum_outgoing_edge_op";
+constexpr char reduce_outgoing_edge_op_kernel_name[] = "cugraph_jit_reduce_outgoing_edge_op";
+constexpr char fold_partial_reductions_kernel_name[] = "cugraph_jit_fold_partial_reductions";
+constexpr char transform_edge_op_kernel_name[]       = "cugraph_jit_transform_edge_op";
+
+// appended to the user source to define the reduction operator of the reduction kernels
+constexpr char sum_reduce_op_source[] = R"(
+__device__ double cugraph_jit_reduce_op(double a, double b) { return a + b; }
+)";
+
+constexpr char user_reduce_op_source[] = R"(
+__device__ double cugraph_jit_reduce_op(double a, double b) { return reduce_op(a, b); }
+)";
+
+// One warp per major (the offsets array covers the majors in [major_range_first,
+// major_hypersparse_first) and then the majors in dcs_nzd_vertices if the edge partition uses the
+// CSR + DCSR hybrid format). CUGRAPH_JIT_KERNEL_NAME is defined in program_source().
+constexpr char reduce_outgoing_edge_op_kernel_source[] = R"(
+extern "C" __global__ void CUGRAPH_JIT_KERNEL_NAME(
+  cugraph_jit_edge_t const* offsets,
+  cugraph_jit_vertex_t const* indices,
+  cugraph_jit_weight_t const* weights,
+  unsigned int const* edge_mask,
+  cugraph_jit_vertex_t const* dcs_nzd_vertices,
+  cugraph_jit_vertex_t major_range_first,
+  cugraph_jit_vertex_t major_hypersparse_first,
+  cugraph_jit_vertex_t num_major_idxs,
+  double init,
+  double* major_outputs)
+{
+  int const lane_id          = threadIdx.x % 32;
+  auto major_hypersparse_idx = major_hypersparse_first - major_range_first;
+  for (long long idx = (static_cast<long long>(blockIdx.x) * blockDim.x + threadIdx.x) / 32;
+       idx < num_major_idxs;
+       idx += (static_cast<long long>(gridDim.x) * blockDim.x) / 32) {
+    auto major = ((dcs_nzd_vertices != nullptr) && (idx >= major_hypersparse_idx))
+                   ? dcs_nzd_vertices[idx - major_hypersparse_idx]
+                   : static_cast<cugraph_jit_vertex_t>(major_range_first + idx);
+    double acc = init;
+    for (auto e = offsets[idx] + lane_id; e < offsets[idx + 1]; e += 32) {
+      if ((edge_mask != nullptr) && (((edge_mask[e / 32] >> (e % 32)) & 1u) == 0)) { continue; }
+      acc = cugraph_jit_reduce_op(
+        acc,
+        edge_op(static_cast<long long>(major),
+                static_cast<long long>(indices[e]),
+                (weights != nullptr) ? static_cast<double>(weights[e]) : 1.0));
+    }
+    for (int offset = 16; offset > 0; offset /= 2) {
+      acc = cugraph_jit_reduce_op(acc, __shfl_down_sync(0xffffffff, acc, offset));
+    }
+    if (lane_id == 0) { major_outputs[major - major_range_first] = acc; }
+  }
+}
+)";
+
+// partials holds num_partials arrays of size num_outputs (one per GPU in minor_comm)
+constexpr char fold_partial_reductions_kernel_source[] = R"(
+extern "C" __global__ void CUGRAPH_JIT_KERNEL_NAME(double const* partials,
+                                                   long long num_partials,
+                                                   long long num_outputs,
+                                                   double* outputs)
+{
+  for (long long i = static_cast<long long>(blockIdx.x) * blockDim.x + threadIdx.x;
+       i < num_outputs;
+       i += static_cast<long long>(gridDim.x) * blockDim.x) {
+    double acc = partials[i];
+    for (long long j = 1; j < num_partials; ++j) {
+      acc = cugraph_jit_reduce_op(acc, partials[j * num_outputs + i]);
+    }
+    outputs[i] = acc;
+  }
+}
+)";
+
+// One warp per major, the outputs are stored in the edge partition's edge order.
+constexpr char transform_edge_op_kernel_source[] = R"(
+extern "C" __global__ void CUGRAPH_JIT_KERNEL_NAME(
+  cugraph_jit_edge_t const* offsets,
+  cugraph_jit_vertex_t const* indices,
+  cugraph_jit_weight_t const* weights,
+  unsigned int const* edge_mask,
+  cugraph_jit_vertex_t const* dcs_nzd_vertices,
+  cugraph_jit_vertex_t major_range_first,
+  cugraph_jit_vertex_t major_hypersparse_first,
+  cugraph_jit_vertex_t num_major_idxs,
+  double* edge_outputs)
+{
+  int const lane_id          = threadIdx.x % 32;
+  auto major_hypersparse_idx = major_hypersparse_first - major_range_first;
+  for (long long idx = (static_cast<long long>(blockIdx.x) * blockDim.x + threadIdx.x) / 32;
+       idx < num_major_idxs;
+       idx += (static_cast<long long>(gridDim.x) * blockDim.x) / 32) {
+    auto major = ((dcs_nzd_vertices != nullptr) && (idx >= major_hypersparse_idx))
+                   ? dcs_nzd_vertices[idx - major_hypersparse_idx]
+                   : static_cast<cugraph_jit_vertex_t>(major_range_first + idx);
+    for (auto e = offsets[idx] + lane_id; e < offsets[idx + 1]; e += 32) {
+      if ((edge_mask != nullptr) && (((edge_mask[e / 32] >> (e % 32)) & 1u) == 0)) { continue; }
+      edge_outputs[e] = edge_op(static_cast<long long>(major),
+                                static_cast<long long>(indices[e]),
+                                (weights != nullptr) ? static_cast<double>(weights[e]) : 1.0);
+    }
+  }
+}
+)";
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::string type_tuple()
+{
+  return std::string("vertex_t=") + jit_type_name<vertex_t>() + ",edge_t=" +
+         jit_type_name<edge_t>() + ",weight_t=" + jit_type_name<weight_t>();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::string program_source(std::string const& edge_op_source,
+                           char const* op_source,
+                           char const* kernel_name,
+                           char const* kernel_source)
+{
+  return std::string("typedef ") + jit_type_name<vertex_t>() + " cugraph_jit_vertex_t;\n" +
+         "typedef " + jit_type_name<edge_t>() + " cugraph_jit_edge_t;\n" + "typedef " +
+         jit_type_name<weight_t>() + " cugraph_jit_weight_t;\n" +
+         "#define CUGRAPH_JIT_KERNEL_NAME " + kernel_name + "\n" + "#line 1 \"edge_op_source\"\n" +
+         edge_op_source + "\n" + op_source + kernel_source;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+CUfunction get_kernel(std::string const& edge_op_source,
+                      char const* op_source,
+                      char const* kernel_name,
+                      char const* kernel_source)
+{
+  return jit_kernel_cache_t::instance().get_kernel(
+    edge_op_source,
+    type_tuple<vertex_t, edge_t, weight_t>(),
+    kernel_name,
+    [&edge_op_source, op_source, kernel_name, kernel_source]() {
+      return program_source<vertex_t, edge_t, weight_t>(
+        edge_op_source, op_source, kernel_name, kernel_source);
+    });
+}
+
+// reduce_op is + if user_reduce_op is false
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<double> reduce_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source,
+  bool user_reduce_op,
+  double init)
+{
+  CUGRAPH_EXPECTS(!edge_op_source.empty(),
+                  "Invalid input argument: edge_op_source should not be empty.");
+
+  auto op_source = user_reduce_op ? user_reduce_op_source : sum_reduce_op_source;
+  auto kernel    = get_kernel<vertex_t, edge_t, weight_t>(
+    edge_op_source,
+    op_source,
+    user_reduce_op ? reduce_outgoing_edge_op_kernel_name : sum_outgoing_edge_op_kernel_name,
+    reduce_outgoing_edge_op_kernel_source);
+
+  rmm::device_uvector<double> outputs(graph_view.local_vertex_partition_range_size(),
+                                      handle.get_stream());
+
+  auto edge_mask_view = graph_view.edge_mask_view();
+
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = graph_view.local_edge_partition_view(i);
+
+    auto major_range_first = edge_partition.major_range_first();
+    auto major_range_size  = edge_partition.major_range_last() - major_range_first;
+
+    // in multi-GPU, the partial reductions of the majors in this edge partition are reduced to the
+    // GPU owning the majors (minor_comm rank i)
+    rmm::device_uvector<double> major_outputs(multi_gpu ? major_range_size : vertex_t{0},
+                                              handle.get_stream());
+    auto major_output_first = multi_gpu ? major_outputs.data() : outputs.data();
+    thrust::fill(
+      handle.get_thrust_policy(), major_output_first, major_output_first + major_range_size, init);
+
+    auto offsets = edge_partition.offsets().data();
+    auto indices = edge_partition.indices().data();
+    weight_t const* weights =
+      edge_weight_view ? (*edge_weight_view).value_firsts()[i] : static_cast<weight_t*>(nullptr);
+    uint32_t const* edge_mask =
+      edge_mask_view ? (*edge_mask_view).value_firsts()[i] : static_cast<uint32_t*>(nullptr);
+    vertex_t const* dcs_nzd_vertices = edge_partition.dcs_nzd_vertices()
+                                         ? (*(edge_partition.dcs_nzd_vertices())).data()
+                                         : static_cast<vertex_t*>(nullptr);
+    auto major_hypersparse_first =
+      edge_partition.major_hypersparse_first().value_or(edge_partition.major_range_last());
+    auto num_major_idxs = static_cast<vertex_t>(edge_partition.offsets().size() - 1);
+
+    void* args[] = {&offsets,
+                    &indices,
+                    &weights,
+                    &edge_mask,
+                    &dcs_nzd_vertices,
+                    &major_range_first,
+                    &major_hypersparse_first,
+                    &num_major_idxs,
+                    &init,
+                    &major_output_first};
+    launch_jit_kernel(
+      kernel, static_cast<size_t>(num_major_idxs) * size_t{32}, args, handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      if (user_reduce_op) {
+        // NCCL reductions support only the built-in operators, gather the partial reductions to
+        // minor_comm rank i and fold them there
+        auto minor_comm_rank = minor_comm.get_rank();
+        auto minor_comm_size = minor_comm.get_size();
+        rmm::device_uvector<double> partials(
+          (minor_comm_rank == static_cast<int>(i))
+            ? static_cast<size_t>(major_range_size) * static_cast<size_t>(minor_comm_size)
+            : size_t{0},
+          handle.get_stream());
+        std::vector<size_t> recvcounts(minor_comm_size, static_cast<size_t>(major_range_size));
+        std::vector<size_t> displacements(minor_comm_size, size_t{0});
+        std::exclusive_scan(
+          recvcounts.begin(), recvcounts.end(), displacements.begin(), size_t{0});
+        device_gatherv(minor_comm,
+                       major_outputs.begin(),
+                       partials.begin(),
+                       major_outputs.size(),
+                       recvcounts,
+                       displacements,
+                       static_cast<int>(i),
+                       handle.get_stream());
+        if (minor_comm_rank == static_cast<int>(i)) {
+          auto fold_kernel = get_kernel<vertex_t, edge_t, weight_t>(
+            edge_op_source,
+            op_source,
+            fold_partial_reductions_kernel_name,
+            fold_partial_reductions_kernel_source);
+          auto partial_first = partials.data();
+          auto num_partials  = static_cast<long long>(minor_comm_size);
+          auto num_outputs   = static_cast<long long>(major_range_size);
+          auto output_first  = outputs.data();
+          void* fold_args[]  = {&partial_first, &num_partials, &num_outputs, &output_first};
+          launch_jit_kernel(
+            fold_kernel, static_cast<size_t>(major_range_size), fold_args, handle.get_stream());
+        }
+      } else {
+        device_reduce(minor_comm,
+                      major_outputs.begin(),
+                      outputs.begin(),
+                      major_outputs.size(),
+                      raft::comms::op_t::SUM,
+                      static_cast<int>(i),
+                      handle.get_stream());
+      }
+    }
+  }
+
+  return outputs;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<double> sum_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source)
+{
+  return detail::reduce_outgoing_edge_op(
+    handle, graph_view, edge_weight_view, edge_op_source, false, double{0.0});
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<double> reduce_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source,
+  double init)
+{
+  return detail::reduce_outgoing_edge_op(
+    handle, graph_view, edge_weight_view, edge_op_source, true, init);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, double> transform_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::string const& edge_op_source)
+{
+  CUGRAPH_EXPECTS(!edge_op_source.empty(),
+                  "Invalid input argument: edge_op_source should not be empty.");
+
+  auto kernel = detail::get_kernel<vertex_t, edge_t, weight_t>(
+    edge_op_source,
+    "",
+    detail::transform_edge_op_kernel_name,
+    detail::transform_edge_op_kernel_source);
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, double> edge_outputs(
+    handle, graph_view);
+
+  auto edge_mask_view = graph_view.edge_mask_view();
+
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = graph_view.local_edge_partition_view(i);
+
+    auto major_range_first = edge_partition.major_range_first();
+    auto offsets           = edge_partition.offsets().data();
+    auto indices           = edge_partition.indices().data();
+    weight_t const* weights =
+      edge_weight_view ? (*edge_weight_view).value_firsts()[i] : static_cast<weight_t*>(nullptr);
+    uint32_t const* edge_mask =
+      edge_mask_view ? (*edge_mask_view).value_firsts()[i] : static_cast<uint32_t*>(nullptr);
+    vertex_t const* dcs_nzd_vertices = edge_partition.dcs_nzd_vertices()
+                                         ? (*(edge_partition.dcs_nzd_vertices())).data()
+                                         : static_cast<vertex_t*>(nullptr);
+    auto major_hypersparse_first =
+      edge_partition.major_hypersparse_first().value_or(edge_partition.major_range_last());
+    auto num_major_idxs    = static_cast<vertex_t>(edge_partition.offsets().size() - 1);
+    auto edge_output_first = edge_outputs.mutable_view().value_firsts()[i];
+
+    void* args[] = {&offsets,
+                    &indices,
+                    &weights,
+                    &edge_mask,
+                    &dcs_nzd_vertices,
+                    &major_range_first,
+                    &major_hypersparse_first,
+                    &num_major_idxs,
+                    &edge_output_first};
+    detail::launch_jit_kernel(
+      kernel, static_cast<size_t>(num_major_idxs) * size_t{32}, args, handle.get_stream());
+  }
+
+  return edge_outputs;
+}
+
+}  // namespace jit
+}  // namespace cugraph
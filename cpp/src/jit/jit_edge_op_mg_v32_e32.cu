@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "jit/jit_edge_op_impl.cuh"
+
+namespace cugraph {
+namespace jit {
+
+// MG instantiation
+
+template rmm::device_uvector<double> sum_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+template rmm::device_uvector<double> sum_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+template rmm::device_uvector<double> reduce_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::string const& edge_op_source,
+  double init);
+
+template rmm::device_uvector<double> reduce_outgoing_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::string const& edge_op_source,
+  double init);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, true>, double> transform_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, true>, double> transform_edge_op(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::string const& edge_op_source);
+
+}  // namespace jit
+}  // namespace cugraph
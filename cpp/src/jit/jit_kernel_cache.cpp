@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/jit_kernel_cache.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <cuda_runtime_api.h>
+#include <nvrtc.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cugraph {
+namespace jit {
+namespace detail {
+
+namespace {
+
+void check_cu_result(CUresult result, char const* call)
+{
+  if (result != CUDA_SUCCESS) {
+    char const* msg{nullptr};
+    cuGetErrorString(result, &msg);
+    CUGRAPH_FAIL("%s failed (%s).", call, msg != nullptr ? msg : "unknown error");
+  }
+}
+
+void check_nvrtc_result(nvrtcResult result, char const* call)
+{
+  CUGRAPH_EXPECTS(result == NVRTC_SUCCESS, "%s failed (%s).", call, nvrtcGetErrorString(result));
+}
+
+std::vector<char> compile_to_cubin(std::string const& program_source,
+                                   std::string const& kernel_name,
+                                   int device)
+{
+  int cc_major{};
+  int cc_minor{};
+  RAFT_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  RAFT_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  auto arch_option = std::string("--gpu-architecture=sm_") + std::to_string(cc_major) +
+                     std::to_string(cc_minor);
+  std::vector<char const*> options{arch_option.c_str(), "--std=c++17"};
+
+  nvrtcProgram program{};
+  check_nvrtc_result(nvrtcCreateProgram(
+                       &program, program_source.c_str(), kernel_name.c_str(), 0, nullptr, nullptr),
+                     "nvrtcCreateProgram");
+
+  auto compile_result =
+    nvrtcCompileProgram(program, static_cast<int>(options.size()), options.data());
+  if (compile_result != NVRTC_SUCCESS) {
+    size_t log_size{0};
+    nvrtcGetProgramLogSize(program, &log_size);
+    std::string log(log_size, '\0');
+    if (log_size > 0) { nvrtcGetProgramLog(program, log.data()); }
+    nvrtcDestroyProgram(&program);
+    CUGRAPH_FAIL("Invalid input argument: failed to compile the edge operator source, %s",
+                 log.c_str());
+  }
+
+  size_t cubin_size{0};
+  check_nvrtc_result(nvrtcGetCUBINSize(program, &cubin_size), "nvrtcGetCUBINSize");
+  std::vector<char> cubin(cubin_size);
+  check_nvrtc_result(nvrtcGetCUBIN(program, cubin.data()), "nvrtcGetCUBIN");
+  nvrtcDestroyProgram(&program);
+
+  return cubin;
+}
+
+}  // namespace
+
+size_t jit_kernel_key_hash_t::operator()(jit_kernel_key_t const& key) const
+{
+  auto h = std::hash<std::string>{}(key.edge_op_source);
+  for (auto v : {std::hash<std::string>{}(key.type_tuple),
+                 std::hash<std::string>{}(key.kernel_name),
+                 std::hash<int>{}(key.device)}) {
+    h ^= v + size_t{0x9e3779b97f4a7c15} + (h << 6) + (h >> 2);
+  }
+  return h;
+}
+
+jit_kernel_cache_t& jit_kernel_cache_t::instance()
+{
+  // defined in a translation unit (instead of an inline function in the header) to have a single
+  // instance per process
+  static jit_kernel_cache_t cache{};
+  return cache;
+}
+
+CUfunction jit_kernel_cache_t::get_kernel(std::string const& edge_op_source,
+                                          std::string const& type_tuple,
+                                          std::string const& kernel_name,
+                                          std::function<std::string()> const& program_source)
+{
+  int device{};
+  RAFT_CUDA_TRY(cudaGetDevice(&device));
+
+  jit_kernel_key_t key{edge_op_source, type_tuple, kernel_name, device};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = kernels_.find(key);
+  if (it != kernels_.end()) { return it->second; }
+
+  auto cubin = compile_to_cubin(program_source(), kernel_name, device);
+
+  // make the primary context (used by the CUDA runtime) current before loading the module
+  check_cu_result(cuInit(0), "cuInit");
+  RAFT_CUDA_TRY(cudaFree(nullptr));
+
+  CUmodule module{};
+  check_cu_result(cuModuleLoadData(&module, cubin.data()), "cuModuleLoadData");
+  CUfunction kernel{};
+  check_cu_result(cuModuleGetFunction(&kernel, module, kernel_name.c_str()),
+                  "cuModuleGetFunction");
+
+  kernels_.emplace(std::move(key), kernel);
+
+  return kernel;
+}
+
+size_t jit_kernel_cache_t::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return kernels_.size();
+}
+
+void launch_jit_kernel(CUfunction kernel,
+                       size_t num_threads,
+                       void** args,
+                       rmm::cuda_stream_view stream_view)
+{
+  if (num_threads == 0) { return; }
+
+  constexpr unsigned int block_size = 512;
+  constexpr size_t max_grid_size    = size_t{1} << 20;  // the kernels use grid-stride loops
+
+  auto grid_size = static_cast<unsigned int>(
+    std::min((num_threads + block_size - 1) / block_size, max_grid_size));
+  check_cu_result(cuLaunchKernel(kernel,
+                                 grid_size,
+                                 1,
+                                 1,
+                                 block_size,
+                                 1,
+                                 1,
+                                 0,
+                                 static_cast<CUstream>(stream_view.value()),
+                                 args,
+                                 nullptr),
+                  "cuLaunchKernel");
+}
+
+}  // namespace detail
+}  // namespace jit
+}  // namespace cugraph
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda.h>
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cugraph {
+namespace jit {
+namespace detail {
+
+struct jit_kernel_key_t {
+  std::string edge_op_source{};
+  std::string type_tuple{};  // e.g. "vertex_t=int,edge_t=int,weight_t=float"
+  std::string kernel_name{};
+  int device{};
+
+  bool operator==(jit_kernel_key_t const& other) const
+  {
+    return (device == other.device) && (kernel_name == other.kernel_name) &&
+           (type_tuple == other.type_tuple) && (edge_op_source == other.edge_op_source);
+  }
+};
+
+struct jit_kernel_key_hash_t {
+  size_t operator()(jit_kernel_key_t const& key) const;
+};
+
+/**
+ * @brief Process-wide cache of the kernels compiled (with NVRTC) from user supplied edge operator
+ * sources.
+ *
+ * Kernels are keyed by the hash of the edge operator source, the type tuple the kernel is
+ * instantiated for, the kernel name, and the device (modules are loaded per CUDA context). A
+ * source is compiled only on the first request; the later requests reuse the loaded module.
+ */
+class jit_kernel_cache_t {
+ public:
+  static jit_kernel_cache_t& instance();
+
+  /**
+   * @brief Return the kernel @p kernel_name compiled for the current device, compiling @p
+   * program_source() (which should embed @p edge_op_source) with NVRTC if not cached yet.
+   *
+   * Throws cugraph::logic_error (with the NVRTC log) if the program does not compile.
+   */
+  CUfunction get_kernel(std::string const& edge_op_source,
+                        std::string const& type_tuple,
+                        std::string const& kernel_name,
+                        std::function<std::string()> const& program_source);
+
+  size_t size() const;
+
+ private:
+  jit_kernel_cache_t() = default;
+
+  // The loaded modules are not unloaded, the CUDA contexts may be destroyed before this (static)
+  // object at process exit.
+  mutable std::mutex mutex_{};
+  std::unordered_map<jit_kernel_key_t, CUfunction, jit_kernel_key_hash_t> kernels_{};
+};
+
+/**
+ * @brief Launch a JIT compiled kernel with a 1D grid on @p stream_view.
+ */
+void launch_jit_kernel(CUfunction kernel,
+                       size_t num_threads,
+                       void** args,
+                       rmm::cuda_stream_view stream_view);
+
+}  // namespace detail
+}  // namespace jit
+}  // namespace cugraph
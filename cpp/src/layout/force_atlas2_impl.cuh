@@ -0,0 +1,816 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/fill_edge_property.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// quadtree depth is capped to bound the size of the cell aggregates reduced over the GPUs in every
+// iteration (4^9 leaf cells)
+constexpr int fa2_max_quadtree_depth = 9;
+constexpr int fa2_traversal_stack_size =
+  3 * fa2_max_quadtree_depth + 4;  // each visited cell pushes at most 4 children
+
+// a coarsening level is added only if matching shrinks the graph by at least this fraction
+constexpr double fa2_min_coarsening_ratio = 0.1;
+
+struct fa2_parameters_t {
+  size_t max_iterations{};
+  bool outbound_attraction_distribution{};
+  bool lin_log_mode{};
+  float edge_weight_influence{};
+  float jitter_tolerance{};
+  float barnes_hut_theta{};
+  float scaling_ratio{};
+  bool strong_gravity_mode{};
+  float gravity{};
+  bool verbose{};
+};
+
+__host__ __device__ inline size_t quadtree_level_offset(int level)
+{
+  return ((size_t{1} << (2 * level)) - 1) / 3;
+}
+
+template <typename weight_t>
+struct fa2_attraction_e_op_t {
+  bool lin_log_mode{};
+  float edge_weight_influence{};
+
+  template <typename vertex_t>
+  __device__ thrust::tuple<float, float> operator()(vertex_t,
+                                                    vertex_t,
+                                                    thrust::tuple<float, float> src_position,
+                                                    thrust::tuple<float, float> dst_position,
+                                                    weight_t w) const
+  {
+    auto x_dist = thrust::get<0>(src_position) - thrust::get<0>(dst_position);
+    auto y_dist = thrust::get<1>(src_position) - thrust::get<1>(dst_position);
+    auto factor = static_cast<float>(pow(static_cast<float>(w), edge_weight_influence));
+    if (lin_log_mode) {
+      auto distance = sqrt(x_dist * x_dist + y_dist * y_dist + FLT_EPSILON);
+      factor *= log(1 + distance) / distance;
+    }
+    return thrust::make_tuple(x_dist * factor, y_dist * factor);
+  }
+};
+
+// cells are indexed level by level (root first), and (cx, cy) is stored at cy * 2^level + cx
+// inside a level
+struct fa2_quadtree_t {
+  raft::device_span<float> cell_masses{};
+  raft::device_span<float> cell_x_moments{};  // sum of mass * x
+  raft::device_span<float> cell_y_moments{};  // sum of mass * y
+  float min_x{};
+  float min_y{};
+  float width{};
+  int depth{};
+
+  __device__ thrust::tuple<int, int> leaf_cell(float x, float y) const
+  {
+    auto num_cells = 1 << depth;
+    auto cx        = static_cast<int>((x - min_x) / width * num_cells);
+    auto cy        = static_cast<int>((y - min_y) / width * num_cells);
+    return thrust::make_tuple(cuda::std::max(cuda::std::min(cx, num_cells - 1), 0),
+                              cuda::std::max(cuda::std::min(cy, num_cells - 1), 0));
+  }
+
+  __device__ size_t cell_index(int level, int cx, int cy) const
+  {
+    return quadtree_level_offset(level) + (static_cast<size_t>(cy) << level) + cx;
+  }
+};
+
+struct fa2_insert_to_quadtree_t {
+  fa2_quadtree_t quadtree{};
+
+  __device__ void operator()(thrust::tuple<float, float, float> position_mass) const
+  {
+    auto x        = thrust::get<0>(position_mass);
+    auto y        = thrust::get<1>(position_mass);
+    auto m        = thrust::get<2>(position_mass);
+    auto leaf     = quadtree.leaf_cell(x, y);
+    auto idx      = quadtree.cell_index(quadtree.depth, thrust::get<0>(leaf), thrust::get<1>(leaf));
+    atomicAdd(&quadtree.cell_masses[idx], m);
+    atomicAdd(&quadtree.cell_x_moments[idx], m * x);
+    atomicAdd(&quadtree.cell_y_moments[idx], m * y);
+  }
+};
+
+struct fa2_aggregate_quadtree_level_t {
+  fa2_quadtree_t quadtree{};
+  int level{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto cx  = static_cast<int>(i % (size_t{1} << level));
+    auto cy  = static_cast<int>(i >> level);
+    auto idx = quadtree.cell_index(level, cx, cy);
+    float m{0.0};
+    float x_moment{0.0};
+    float y_moment{0.0};
+    for (int j = 0; j < 4; ++j) {
+      auto child = quadtree.cell_index(level + 1, 2 * cx + (j % 2), 2 * cy + (j / 2));
+      m += quadtree.cell_masses[child];
+      x_moment += quadtree.cell_x_moments[child];
+      y_moment += quadtree.cell_y_moments[child];
+    }
+    quadtree.cell_masses[idx]    = m;
+    quadtree.cell_x_moments[idx] = x_moment;
+    quadtree.cell_y_moments[idx] = y_moment;
+  }
+};
+
+// Barnes-Hut traversal: a cell far enough from the vertex (cell width / distance < theta) is
+// approximated by its center of mass; leaf cells are always approximated (excluding the vertex
+// itself from its own leaf cell)
+struct fa2_quadtree_repulsion_t {
+  fa2_quadtree_t quadtree{};
+  float theta{};
+  float scaling_ratio{};
+
+  __device__ thrust::tuple<float, float> operator()(
+    thrust::tuple<float, float, float> position_mass) const
+  {
+    auto x       = thrust::get<0>(position_mass);
+    auto y       = thrust::get<1>(position_mass);
+    auto m       = thrust::get<2>(position_mass);
+    auto leaf    = quadtree.leaf_cell(x, y);
+    auto leaf_cx = thrust::get<0>(leaf);
+    auto leaf_cy = thrust::get<1>(leaf);
+
+    int levels[fa2_traversal_stack_size];
+    int cxs[fa2_traversal_stack_size];
+    int cys[fa2_traversal_stack_size];
+    int top   = 1;
+    levels[0] = 0;
+    cxs[0]    = 0;
+    cys[0]    = 0;
+    float fx{0.0};
+    float fy{0.0};
+    while (top > 0) {
+      --top;
+      auto level = levels[top];
+      auto cx    = cxs[top];
+      auto cy    = cys[top];
+      auto idx   = quadtree.cell_index(level, cx, cy);
+
+      auto cell_mass     = quadtree.cell_masses[idx];
+      auto x_moment      = quadtree.cell_x_moments[idx];
+      auto y_moment      = quadtree.cell_y_moments[idx];
+      auto contains_self = ((leaf_cx >> (quadtree.depth - level)) == cx) &&
+                           ((leaf_cy >> (quadtree.depth - level)) == cy);
+      if ((level == quadtree.depth) && contains_self) {
+        cell_mass -= m;
+        x_moment -= m * x;
+        y_moment -= m * y;
+      }
+      if (cell_mass < 0.5) { continue; }  // vertex masses are degree + 1 >= 1
+
+      auto x_dist     = x - x_moment / cell_mass;
+      auto y_dist     = y - y_moment / cell_mass;
+      auto distance   = x_dist * x_dist + y_dist * y_dist + FLT_EPSILON;
+      auto cell_width = quadtree.width / static_cast<float>(1 << level);
+      if ((level == quadtree.depth) ||
+          (!contains_self && (cell_width * cell_width < theta * theta * distance))) {
+        auto factor = scaling_ratio * m * cell_mass / distance;
+        fx += x_dist * factor;
+        fy += y_dist * factor;
+      } else {
+        for (int j = 0; j < 4; ++j) {
+          levels[top] = level + 1;
+          cxs[top]    = 2 * cx + (j % 2);
+          cys[top]    = 2 * cy + (j / 2);
+          ++top;
+        }
+      }
+    }
+
+    return thrust::make_tuple(fx, fy);
+  }
+};
+
+inline void fa2_adapt_speed(float jitter_tolerance,
+                            float& jt,
+                            float& speed,
+                            float& speed_efficiency,
+                            float s,
+                            float t,
+                            double n)
+{
+  float estimated_jt         = 0.05 * std::sqrt(n);
+  float min_jt               = std::sqrt(estimated_jt);
+  float max_jt               = 10;
+  float min_speed_efficiency = 0.05;
+  float const max_rise       = 0.5;
+
+  jt = jitter_tolerance *
+       std::max(min_jt, std::min(max_jt, static_cast<float>(estimated_jt * t / (n * n))));
+
+  if (s / t > 2.0) {
+    if (speed_efficiency > min_speed_efficiency) { speed_efficiency *= 0.5; }
+    jt = std::max(jt, jitter_tolerance);
+  }
+
+  float target_speed = (s == 0) ? FLT_MAX : (jt * speed_efficiency * t) / s;
+
+  if (s > jt * t) {
+    if (speed_efficiency > min_speed_efficiency) { speed_efficiency *= .7; }
+  } else if (speed < 1000) {
+    speed_efficiency *= 1.3;
+  }
+
+  speed = speed + std::min(target_speed - speed, max_rise * speed);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2_single_level(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<float> x_positions,
+  raft::device_span<float> y_positions,
+  fa2_parameters_t const& params)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  auto const local_size = graph_view.local_vertex_partition_range_size();
+  auto const n          = static_cast<double>(graph_view.number_of_vertices());
+
+  auto position_first =
+    thrust::make_zip_iterator(thrust::make_tuple(x_positions.begin(), y_positions.begin()));
+
+  // 1. mass = degree + 1
+
+  rmm::device_uvector<float> masses(local_size, handle.get_stream());
+  {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    thrust::transform(handle.get_thrust_policy(),
+                      degrees.begin(),
+                      degrees.end(),
+                      masses.begin(),
+                      [] __device__(auto d) { return static_cast<float>(d + 1); });
+  }
+  auto position_mass_first = thrust::make_zip_iterator(
+    thrust::make_tuple(x_positions.begin(), y_positions.begin(), masses.begin()));
+
+  float outbound_att_compensation{1.0};
+  if (params.outbound_attraction_distribution) {
+    auto mass_sum =
+      thrust::reduce(handle.get_thrust_policy(), masses.begin(), masses.end(), double{0.0});
+    if constexpr (multi_gpu) {
+      mass_sum = host_scalar_allreduce(
+        handle.get_comms(), mass_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    outbound_att_compensation = static_cast<float>(mass_sum / n);
+  }
+
+  // 2. iterate
+
+  auto depth = std::clamp(
+    static_cast<int>(std::ceil(std::log2(std::max(n, 2.0)) / 2.0)), 1, fa2_max_quadtree_depth);
+  auto num_cells      = quadtree_level_offset(depth + 1);
+  auto num_leaf_cells = num_cells - quadtree_level_offset(depth);
+
+  rmm::device_uvector<float> cell_masses(num_cells, handle.get_stream());
+  rmm::device_uvector<float> cell_x_moments(num_cells, handle.get_stream());
+  rmm::device_uvector<float> cell_y_moments(num_cells, handle.get_stream());
+
+  rmm::device_uvector<float> repel_x(local_size, handle.get_stream());
+  rmm::device_uvector<float> repel_y(local_size, handle.get_stream());
+  rmm::device_uvector<float> attract_x(local_size, handle.get_stream());
+  rmm::device_uvector<float> attract_y(local_size, handle.get_stream());
+  rmm::device_uvector<float> old_dx(local_size, handle.get_stream());
+  rmm::device_uvector<float> old_dy(local_size, handle.get_stream());
+  rmm::device_uvector<float> swinging(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), old_dx.begin(), old_dx.end(), float{0.0});
+  thrust::fill(handle.get_thrust_policy(), old_dy.begin(), old_dy.end(), float{0.0});
+
+  edge_src_property_t<GraphViewType, thrust::tuple<float, float>> edge_src_positions(handle,
+                                                                                    graph_view);
+  edge_dst_property_t<GraphViewType, thrust::tuple<float, float>> edge_dst_positions(handle,
+                                                                                    graph_view);
+
+  float speed{1.0};
+  float speed_efficiency{1.0};
+  float jt{0.0};
+
+  for (size_t iter = 0; iter < params.max_iterations; ++iter) {
+    // 2-1. repulsion, approximated with a quadtree over the bounding box of all the vertices (each
+    // GPU inserts its local vertices and the leaf cell aggregates are reduced over the GPUs)
+
+    auto bounds = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      position_first,
+      position_first + local_size,
+      [] __device__(auto p) {
+        return thrust::make_tuple(
+          thrust::get<0>(p), thrust::get<1>(p), -thrust::get<0>(p), -thrust::get<1>(p));
+      },
+      thrust::make_tuple(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX),
+      [] __device__(auto lhs, auto rhs) {
+        return thrust::make_tuple(cuda::std::min(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                                  cuda::std::min(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                                  cuda::std::min(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+                                  cuda::std::min(thrust::get<3>(lhs), thrust::get<3>(rhs)));
+      });
+    if constexpr (multi_gpu) {
+      bounds = host_scalar_allreduce(
+        handle.get_comms(), bounds, raft::comms::op_t::MIN, handle.get_stream());
+    }
+    auto min_x = thrust::get<0>(bounds);
+    auto min_y = thrust::get<1>(bounds);
+    auto width = std::max(-thrust::get<2>(bounds) - min_x, -thrust::get<3>(bounds) - min_y);
+    width      = std::max(width * (1.0f + FLT_EPSILON), FLT_EPSILON);
+
+    fa2_quadtree_t quadtree{raft::device_span<float>(cell_masses.data(), cell_masses.size()),
+                            raft::device_span<float>(cell_x_moments.data(), cell_x_moments.size()),
+                            raft::device_span<float>(cell_y_moments.data(), cell_y_moments.size()),
+                            min_x,
+                            min_y,
+                            width,
+                            depth};
+
+    thrust::fill(handle.get_thrust_policy(), cell_masses.begin(), cell_masses.end(), float{0.0});
+    thrust::fill(
+      handle.get_thrust_policy(), cell_x_moments.begin(), cell_x_moments.end(), float{0.0});
+    thrust::fill(
+      handle.get_thrust_policy(), cell_y_moments.begin(), cell_y_moments.end(), float{0.0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     position_mass_first,
+                     position_mass_first + local_size,
+                     fa2_insert_to_quadtree_t{quadtree});
+    if constexpr (multi_gpu) {
+      auto leaf_offset = quadtree_level_offset(depth);
+      for (auto cell_values : {cell_masses.data(), cell_x_moments.data(), cell_y_moments.data()}) {
+        device_allreduce(handle.get_comms(),
+                         cell_values + leaf_offset,
+                         cell_values + leaf_offset,
+                         num_leaf_cells,
+                         raft::comms::op_t::SUM,
+                         handle.get_stream());
+      }
+    }
+    for (int level = depth - 1; level >= 0; --level) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(size_t{1} << (2 * level)),
+                       fa2_aggregate_quadtree_level_t{quadtree, level});
+    }
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      position_mass_first,
+      position_mass_first + local_size,
+      thrust::make_zip_iterator(thrust::make_tuple(repel_x.begin(), repel_y.begin())),
+      fa2_quadtree_repulsion_t{quadtree, params.barnes_hut_theta, params.scaling_ratio});
+
+    // 2-2. attraction along the edges
+
+    update_edge_src_property(handle, graph_view, position_first, edge_src_positions.mutable_view());
+    update_edge_dst_property(handle, graph_view, position_first, edge_dst_positions.mutable_view());
+
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      edge_src_positions.view(),
+      edge_dst_positions.view(),
+      edge_weight_view,
+      fa2_attraction_e_op_t<weight_t>{params.lin_log_mode, params.edge_weight_influence},
+      thrust::make_tuple(float{0.0}, float{0.0}),
+      reduce_op::plus<thrust::tuple<float, float>>{},
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.begin(), attract_y.begin())));
+
+    // 2-3. scale the attraction and add gravity
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(x_positions.begin(),
+                                                   y_positions.begin(),
+                                                   masses.begin(),
+                                                   attract_x.begin(),
+                                                   attract_y.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(x_positions.end(),
+                                                   y_positions.end(),
+                                                   masses.end(),
+                                                   attract_x.end(),
+                                                   attract_y.end())),
+      thrust::make_zip_iterator(thrust::make_tuple(attract_x.begin(), attract_y.begin())),
+      [coef                             = outbound_att_compensation,
+       outbound_attraction_distribution = params.outbound_attraction_distribution,
+       strong_gravity_mode              = params.strong_gravity_mode,
+       gravity                          = params.gravity,
+       scaling_ratio                    = params.scaling_ratio] __device__(auto t) {
+        auto x      = thrust::get<0>(t);
+        auto y      = thrust::get<1>(t);
+        auto m      = thrust::get<2>(t);
+        auto factor = -coef;
+        if (outbound_attraction_distribution) { factor /= m; }
+        auto gravity_factor = strong_gravity_mode
+                                ? scaling_ratio * m * gravity
+                                : m * gravity / sqrt(x * x + y * y + FLT_EPSILON);
+        return thrust::make_tuple(thrust::get<3>(t) * factor - x * gravity_factor,
+                                  thrust::get<4>(t) * factor - y * gravity_factor);
+      });
+
+    // 2-4. adapt the global speed
+
+    auto force_first = thrust::make_zip_iterator(thrust::make_tuple(repel_x.begin(),
+                                                                    repel_y.begin(),
+                                                                    attract_x.begin(),
+                                                                    attract_y.begin(),
+                                                                    old_dx.begin(),
+                                                                    old_dy.begin(),
+                                                                    masses.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      force_first,
+                      force_first + local_size,
+                      swinging.begin(),
+                      [] __device__(auto t) {
+                        auto dx = thrust::get<0>(t) + thrust::get<2>(t);
+                        auto dy = thrust::get<1>(t) + thrust::get<3>(t);
+                        auto sx = thrust::get<4>(t) - dx;
+                        auto sy = thrust::get<5>(t) - dy;
+                        return thrust::get<6>(t) * sqrt(sx * sx + sy * sy);
+                      });
+    auto s =
+      thrust::reduce(handle.get_thrust_policy(), swinging.begin(), swinging.end(), float{0.0});
+    auto t = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      force_first,
+      force_first + local_size,
+      [] __device__(auto t) {
+        auto dx = thrust::get<0>(t) + thrust::get<2>(t);
+        auto dy = thrust::get<1>(t) + thrust::get<3>(t);
+        auto tx = thrust::get<4>(t) + dx;
+        auto ty = thrust::get<5>(t) + dy;
+        return 0.5f * thrust::get<6>(t) * sqrt(tx * tx + ty * ty);
+      },
+      float{0.0},
+      thrust::plus<float>{});
+    if constexpr (multi_gpu) {
+      auto st = host_scalar_allreduce(
+        handle.get_comms(), thrust::make_tuple(s, t), raft::comms::op_t::SUM, handle.get_stream());
+      s = thrust::get<0>(st);
+      t = thrust::get<1>(st);
+    }
+
+    fa2_adapt_speed(params.jitter_tolerance, jt, speed, speed_efficiency, s, t, n);
+
+    // 2-5. move the vertices
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(local_size),
+      [x_positions,
+       y_positions,
+       repel_x   = repel_x.data(),
+       repel_y   = repel_y.data(),
+       attract_x = attract_x.data(),
+       attract_y = attract_y.data(),
+       old_dx    = old_dx.data(),
+       old_dy    = old_dy.data(),
+       swinging  = swinging.data(),
+       speed] __device__(auto i) {
+        auto factor = speed / (1.0f + sqrt(speed * swinging[i]));
+        auto dx     = repel_x[i] + attract_x[i];
+        auto dy     = repel_y[i] + attract_y[i];
+        x_positions[i] += dx * factor;
+        y_positions[i] += dy * factor;
+        old_dx[i] = dx;
+        old_dy[i] = dy;
+      });
+
+    if (params.verbose) {
+      std::cout << "iteration: " << iter + 1 << ", speed: " << speed
+                << ", speed_efficiency: " << speed_efficiency << ", jt: " << jt
+                << ", swinging: " << s << ", traction: " << t << "\n";
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2_multi_level(raft::handle_t const& handle,
+                              raft::random::RngState& rng_state,
+                              graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                              edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                              raft::device_span<float> x_positions,
+                              raft::device_span<float> y_positions,
+                              bool initialize_positions,
+                              size_t num_coarsening_levels,
+                              fa2_parameters_t const& params)
+{
+  auto const local_size = graph_view.local_vertex_partition_range_size();
+
+  if (initialize_positions) {
+    // 1. coarsen the graph by collapsing the vertex pairs in a matching (pairs connected by heavy
+    // edges are preferred), lay out the coarsened graph, and place each vertex at the position of
+    // its coarsened vertex (with a small perturbation to separate the two vertices of a pair)
+
+    bool coarsened{false};
+    if (num_coarsening_levels > 0) {
+      auto [partners, matched_weight] =
+        approximate_weighted_matching(handle, graph_view, edge_weight_view);
+      auto num_matched = static_cast<vertex_t>(thrust::count_if(
+        handle.get_thrust_policy(), partners.begin(), partners.end(), [] __device__(auto p) {
+          return p != invalid_vertex_id<vertex_t>::value;
+        }));
+      if constexpr (multi_gpu) {
+        num_matched = host_scalar_allreduce(
+          handle.get_comms(), num_matched, raft::comms::op_t::SUM, handle.get_stream());
+      }
+
+      if (num_matched / 2 >=
+          static_cast<vertex_t>(fa2_min_coarsening_ratio * graph_view.number_of_vertices())) {
+        rmm::device_uvector<vertex_t> labels(local_size, handle.get_stream());
+        thrust::transform(
+          handle.get_thrust_policy(),
+          partners.begin(),
+          partners.end(),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+          labels.begin(),
+          [] __device__(auto p, auto v) {
+            return (p == invalid_vertex_id<vertex_t>::value) ? v : cuda::std::min(p, v);
+          });
+        partners.resize(0, handle.get_stream());
+        partners.shrink_to_fit(handle.get_stream());
+
+        auto [coarse_graph, coarse_edge_weights, renumber_map] = coarsen_graph(
+          handle, graph_view, std::make_optional(edge_weight_view), labels.data(), true);
+        auto coarse_graph_view = coarse_graph.view();
+
+        rmm::device_uvector<vertex_t> coarse_vertices(
+          coarse_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+        thrust::sequence(handle.get_thrust_policy(),
+                         coarse_vertices.begin(),
+                         coarse_vertices.end(),
+                         coarse_graph_view.local_vertex_partition_range_first());
+        relabel<vertex_t, multi_gpu>(
+          handle,
+          std::make_tuple(static_cast<vertex_t const*>((*renumber_map).data()),
+                          static_cast<vertex_t const*>(coarse_vertices.data())),
+          coarse_vertices.size(),
+          labels.data(),
+          labels.size(),
+          false);
+        renumber_map = std::nullopt;
+
+        rmm::device_uvector<float> coarse_x_positions(coarse_vertices.size(), handle.get_stream());
+        rmm::device_uvector<float> coarse_y_positions(coarse_vertices.size(), handle.get_stream());
+        force_atlas2_multi_level(
+          handle,
+          rng_state,
+          coarse_graph_view,
+          (*coarse_edge_weights).view(),
+          raft::device_span<float>(coarse_x_positions.data(), coarse_x_positions.size()),
+          raft::device_span<float>(coarse_y_positions.data(), coarse_y_positions.size()),
+          true,
+          num_coarsening_levels - 1,
+          params);
+
+        auto coarse_position_first = thrust::make_zip_iterator(
+          thrust::make_tuple(coarse_x_positions.begin(), coarse_y_positions.begin()));
+        auto position_first =
+          thrust::make_zip_iterator(thrust::make_tuple(x_positions.begin(), y_positions.begin()));
+        if constexpr (multi_gpu) {
+          auto fine_positions = collect_values_for_int_vertices(
+            handle.get_comms(),
+            labels.begin(),
+            labels.end(),
+            coarse_position_first,
+            coarse_graph_view.vertex_partition_range_lasts(),
+            coarse_graph_view.local_vertex_partition_range_first(),
+            handle.get_stream());
+          thrust::copy(handle.get_thrust_policy(),
+                       get_dataframe_buffer_begin(fine_positions),
+                       get_dataframe_buffer_end(fine_positions),
+                       position_first);
+        } else {
+          thrust::gather(handle.get_thrust_policy(),
+                         labels.begin(),
+                         labels.end(),
+                         coarse_position_first,
+                         position_first);
+        }
+
+        rmm::device_uvector<float> perturbations(local_size * 2, handle.get_stream());
+        detail::uniform_random_fill(handle.get_stream(),
+                                    perturbations.data(),
+                                    perturbations.size(),
+                                    float{-1.0},
+                                    float{1.0},
+                                    rng_state);
+        thrust::transform(handle.get_thrust_policy(),
+                          x_positions.begin(),
+                          x_positions.end(),
+                          perturbations.begin(),
+                          x_positions.begin(),
+                          thrust::plus<float>{});
+        thrust::transform(handle.get_thrust_policy(),
+                          y_positions.begin(),
+                          y_positions.end(),
+                          perturbations.begin() + local_size,
+                          y_positions.begin(),
+                          thrust::plus<float>{});
+        coarsened = true;
+      }
+    }
+
+    if (!coarsened) {
+      detail::uniform_random_fill(handle.get_stream(),
+                                  x_positions.data(),
+                                  x_positions.size(),
+                                  float{-100.0},
+                                  float{100.0},
+                                  rng_state);
+      detail::uniform_random_fill(handle.get_stream(),
+                                  y_positions.data(),
+                                  y_positions.size(),
+                                  float{-100.0},
+                                  float{100.0},
+                                  rng_state);
+    }
+  }
+
+  // 2. refine
+
+  force_atlas2_single_level(handle, graph_view, edge_weight_view, x_positions, y_positions, params);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2(raft::handle_t const& handle,
+                  raft::random::RngState& rng_state,
+                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                  raft::device_span<float> x_positions,
+                  raft::device_span<float> y_positions,
+                  bool initialize_positions,
+                  size_t max_iterations,
+                  size_t num_coarsening_levels,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  float edge_weight_influence,
+                  float jitter_tolerance,
+                  float barnes_hut_theta,
+                  float scaling_ratio,
+                  bool strong_gravity_mode,
+                  float gravity,
+                  bool verbose,
+                  bool do_expensive_check)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: input graph should be symmetric for force atlas 2.");
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(
+    (x_positions.size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size())) &&
+      (y_positions.size() == x_positions.size()),
+    "Invalid input argument: x_positions and y_positions should have "
+    "graph_view.local_vertex_partition_range_size() elements.");
+  CUGRAPH_EXPECTS((barnes_hut_theta >= 0.0) && (scaling_ratio > 0.0),
+                  "Invalid input argument: barnes_hut_theta should be non-negative and "
+                  "scaling_ratio should be positive.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  if (graph_view.number_of_vertices() == 0) { return; }
+
+  // 2. an unweighted graph is laid out with unit edge weights (this also gives the coarsened
+  // graphs edge weights counting the collapsed edges)
+
+  std::optional<edge_property_t<GraphViewType, weight_t>> unit_edge_weights{std::nullopt};
+  if (!edge_weight_view) {
+    unit_edge_weights = edge_property_t<GraphViewType, weight_t>(handle, graph_view);
+    fill_edge_property(handle, graph_view, (*unit_edge_weights).mutable_view(), weight_t{1.0});
+  }
+
+  force_atlas2_multi_level(
+    handle,
+    rng_state,
+    graph_view,
+    edge_weight_view ? *edge_weight_view : (*unit_edge_weights).view(),
+    x_positions,
+    y_positions,
+    initialize_positions,
+    num_coarsening_levels,
+    fa2_parameters_t{max_iterations,
+                     outbound_attraction_distribution,
+                     lin_log_mode,
+                     edge_weight_influence,
+                     jitter_tolerance,
+                     barnes_hut_theta,
+                     scaling_ratio,
+                     strong_gravity_mode,
+                     gravity,
+                     verbose});
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void force_atlas2(raft::handle_t const& handle,
+                  raft::random::RngState& rng_state,
+                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                  raft::device_span<float> x_positions,
+                  raft::device_span<float> y_positions,
+                  bool initialize_positions,
+                  size_t max_iterations,
+                  size_t num_coarsening_levels,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  float edge_weight_influence,
+                  float jitter_tolerance,
+                  float barnes_hut_theta,
+                  float scaling_ratio,
+                  bool strong_gravity_mode,
+                  float gravity,
+                  bool verbose,
+                  bool do_expensive_check)
+{
+  detail::force_atlas2(handle,
+                       rng_state,
+                       graph_view,
+                       edge_weight_view,
+                       x_positions,
+                       y_positions,
+                       initialize_positions,
+                       max_iterations,
+                       num_coarsening_levels,
+                       outbound_attraction_distribution,
+                       lin_log_mode,
+                       edge_weight_influence,
+                       jitter_tolerance,
+                       barnes_hut_theta,
+                       scaling_ratio,
+                       strong_gravity_mode,
+                       gravity,
+                       verbose,
+                       do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "layout/force_atlas2_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template void force_atlas2(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  raft::device_span<float> x_positions,
+  raft::device_span<float> y_positions,
+  bool initialize_positions,
+  size_t max_iterations,
+  size_t num_coarsening_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool do_expensive_check);
+
+template void force_atlas2(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  raft::device_span<float> x_positions,
+  raft::device_span<float> y_positions,
+  bool initialize_positions,
+  size_t max_iterations,
+  size_t num_coarsening_levels,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  float edge_weight_influence,
+  float jitter_tolerance,
+  float barnes_hut_theta,
+  float scaling_ratio,
+  bool strong_gravity_mode,
+  float gravity,
+  bool verbose,
+  bool do_expensive_check);
+
+}  // namespace cugraph
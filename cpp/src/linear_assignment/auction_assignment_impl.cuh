@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "prims/count_if_e.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// (best value, best job, cost of the best job, second best value) of a worker, the value of a job
+// is -(cost + price)
+template <typename vertex_t, typename weight_t>
+using auction_top_two_t = thrust::tuple<weight_t, vertex_t, weight_t, weight_t>;
+
+// marks the workers that cannot be assigned (invalid_vertex_id_v is -1 for signed vertex_t, so this
+// differs from any valid vertex ID)
+template <typename vertex_t>
+inline constexpr vertex_t auction_dropped_worker_v = invalid_vertex_id_v<vertex_t> - 1;
+
+template <typename vertex_t, typename weight_t>
+struct auction_top_two_op_t {
+  using value_type                    = auction_top_two_t<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;  // this can be called in any process
+  inline static value_type const identity_element =
+    thrust::make_tuple(std::numeric_limits<weight_t>::lowest(),
+                       invalid_vertex_id<vertex_t>::value,
+                       weight_t{0.0},
+                       std::numeric_limits<weight_t>::lowest());
+
+  __host__ __device__ value_type operator()(value_type const& lhs, value_type const& rhs) const
+  {
+    // ties are broken by the job ID for deterministic results
+    auto lhs_first = (thrust::get<0>(lhs) > thrust::get<0>(rhs)) ||
+                     ((thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+                      (thrust::get<1>(lhs) < thrust::get<1>(rhs)));
+    auto const& first  = lhs_first ? lhs : rhs;
+    auto const& second = lhs_first ? rhs : lhs;
+    return thrust::make_tuple(thrust::get<0>(first),
+                              thrust::get<1>(first),
+                              thrust::get<2>(first),
+                              thrust::get<3>(first) < thrust::get<0>(second)
+                                ? thrust::get<0>(second)
+                                : thrust::get<3>(first));
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct auction_job_value_e_op_t {
+  __device__ auction_top_two_t<vertex_t, weight_t> operator()(
+    vertex_t, vertex_t dst, cuda::std::nullopt_t, weight_t dst_price, weight_t cost) const
+  {
+    return thrust::make_tuple(
+      -(cost + dst_price), dst, cost, std::numeric_limits<weight_t>::lowest());
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct auction_cost_range_e_op_t {
+  __device__ thrust::tuple<weight_t, weight_t> operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, weight_t cost) const
+  {
+    return thrust::make_tuple(cost, -cost);
+  }
+};
+
+// emits (bid, worker, cost) for the edge to the job the worker bids for
+template <typename vertex_t, typename weight_t>
+struct auction_bid_e_op_t {
+  __device__ cuda::std::optional<thrust::tuple<weight_t, vertex_t, weight_t>> operator()(
+    vertex_t src,
+    vertex_t dst,
+    thrust::tuple<vertex_t, weight_t, weight_t> src_bid,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t) const
+  {
+    return (dst == thrust::get<0>(src_bid))
+             ? cuda::std::optional<thrust::tuple<weight_t, vertex_t, weight_t>>{thrust::make_tuple(
+                 thrust::get<1>(src_bid), src, thrust::get<2>(src_bid))}
+             : cuda::std::nullopt;
+  }
+};
+
+template <typename vertex_t>
+struct is_worker_to_worker_edge_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, bool src_is_worker, bool dst_is_worker, cuda::std::nullopt_t) const
+  {
+    return src_is_worker && dst_is_worker;
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> workers,
+  std::optional<weight_t> epsilon,
+  weight_t epsilon_scaling_factor,
+  bool do_expensive_check)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+  using bid_t         = thrust::tuple<weight_t, vertex_t, weight_t>;
+
+  auto const local_first = graph_view.local_vertex_partition_range_first();
+  auto const local_size  = graph_view.local_vertex_partition_range_size();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(!epsilon || (*epsilon > weight_t{0.0}),
+                  "Invalid input argument: epsilon should be positive.");
+  CUGRAPH_EXPECTS(epsilon_scaling_factor > weight_t{1.0},
+                  "Invalid input argument: epsilon_scaling_factor should be larger than 1.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, multi_gpu>(
+      graph_view.local_vertex_partition_view());
+    auto num_invalid_workers = thrust::count_if(
+      handle.get_thrust_policy(), workers.begin(), workers.end(), [vertex_partition] __device__(
+        auto v) {
+        return !(vertex_partition.is_valid_vertex(v) &&
+                 vertex_partition.in_local_vertex_partition_range_nocheck(v));
+      });
+    if constexpr (multi_gpu) {
+      num_invalid_workers = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_workers, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_workers == 0,
+                    "Invalid input argument: workers should be valid vertices local to this GPU.");
+  }
+
+  // 2. sort the workers and mark them
+
+  rmm::device_uvector<vertex_t> active_workers(workers.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), workers.begin(), workers.end(), active_workers.begin());
+  thrust::sort(handle.get_thrust_policy(), active_workers.begin(), active_workers.end());
+  active_workers.resize(
+    thrust::distance(active_workers.begin(),
+                     thrust::unique(
+                       handle.get_thrust_policy(), active_workers.begin(), active_workers.end())),
+    handle.get_stream());
+
+  vertex_t num_workers = static_cast<vertex_t>(active_workers.size());
+  if constexpr (multi_gpu) {
+    num_workers = host_scalar_allreduce(
+      handle.get_comms(), num_workers, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  if (do_expensive_check) {
+    rmm::device_uvector<bool> is_worker(local_size, handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), is_worker.begin(), is_worker.end(), false);
+    thrust::for_each(handle.get_thrust_policy(),
+                     active_workers.begin(),
+                     active_workers.end(),
+                     [is_worker = is_worker.data(), local_first] __device__(auto v) {
+                       is_worker[v - local_first] = true;
+                     });
+    edge_src_property_t<GraphViewType, bool> edge_src_is_worker(handle, graph_view);
+    edge_dst_property_t<GraphViewType, bool> edge_dst_is_worker(handle, graph_view);
+    update_edge_src_property(
+      handle, graph_view, is_worker.begin(), edge_src_is_worker.mutable_view());
+    update_edge_dst_property(
+      handle, graph_view, is_worker.begin(), edge_dst_is_worker.mutable_view());
+    auto num_worker_to_worker_edges = count_if_e(handle,
+                                                 graph_view,
+                                                 edge_src_is_worker.view(),
+                                                 edge_dst_is_worker.view(),
+                                                 edge_dummy_property_t{}.view(),
+                                                 is_worker_to_worker_edge_t<vertex_t>{});
+    CUGRAPH_EXPECTS(num_worker_to_worker_edges == 0,
+                    "Invalid input argument: there should be no edge between two workers.");
+  }
+
+  // 3. find the range of the costs to set the initial epsilon and the price bound (if a worker's
+  // best job costs more than the bound, the worker cannot be assigned in any feasible assignment
+  // of the remaining workers and drops out)
+
+  auto cost_bounds = thrust::make_tuple(std::numeric_limits<weight_t>::lowest(),
+                                        std::numeric_limits<weight_t>::lowest());
+  {
+    key_bucket_t<vertex_t, void, multi_gpu, true> worker_bucket(
+      handle, raft::device_span<vertex_t const>(active_workers.data(), active_workers.size()));
+    rmm::device_uvector<weight_t> max_costs(active_workers.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> neg_min_costs(active_workers.size(), handle.get_stream());
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      worker_bucket,
+      edge_src_dummy_property_t{}.view(),
+      edge_dst_dummy_property_t{}.view(),
+      edge_weight_view,
+      auction_cost_range_e_op_t<vertex_t, weight_t>{},
+      reduce_op::elementwise_maximum<thrust::tuple<weight_t, weight_t>>::identity_element,
+      reduce_op::elementwise_maximum<thrust::tuple<weight_t, weight_t>>{},
+      thrust::make_zip_iterator(thrust::make_tuple(max_costs.begin(), neg_min_costs.begin())));
+    auto first =
+      thrust::make_zip_iterator(thrust::make_tuple(max_costs.begin(), neg_min_costs.begin()));
+    cost_bounds =
+      thrust::reduce(handle.get_thrust_policy(),
+                     first,
+                     first + max_costs.size(),
+                     cost_bounds,
+                     reduce_op::elementwise_maximum<thrust::tuple<weight_t, weight_t>>{});
+    if constexpr (multi_gpu) {
+      cost_bounds = host_scalar_allreduce(
+        handle.get_comms(), cost_bounds, raft::comms::op_t::MAX, handle.get_stream());
+    }
+  }
+
+  rmm::device_uvector<vertex_t> worker_jobs(local_size, handle.get_stream());
+  rmm::device_uvector<weight_t> worker_costs(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               worker_jobs.begin(),
+               worker_jobs.end(),
+               invalid_vertex_id<vertex_t>::value);
+
+  // if no worker has an edge, every worker drops out in the first round
+  auto has_edges  = thrust::get<0>(cost_bounds) != std::numeric_limits<weight_t>::lowest();
+  auto max_cost   = has_edges ? thrust::get<0>(cost_bounds) : weight_t{0.0};
+  auto min_cost   = has_edges ? -thrust::get<1>(cost_bounds) : weight_t{0.0};
+  auto cost_range = max_cost - min_cost;
+
+  auto final_epsilon =
+    epsilon ? *epsilon : weight_t{1.0} / static_cast<weight_t>(num_workers + 1);
+  auto current_epsilon = std::max(cost_range / epsilon_scaling_factor, final_epsilon);
+  auto price_bound     = std::max(std::abs(max_cost), std::abs(min_cost)) +
+                     weight_t{2.0} * static_cast<weight_t>(num_workers) *
+                       (cost_range + current_epsilon);
+
+  // 4. epsilon scaling phases
+
+  rmm::device_uvector<weight_t> prices(local_size, handle.get_stream());
+  rmm::device_uvector<vertex_t> job_owners(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), prices.begin(), prices.end(), weight_t{0.0});
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(0, handle.get_stream());
+  if constexpr (multi_gpu) {
+    auto h_vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    d_vertex_partition_range_lasts.resize(h_vertex_partition_range_lasts.size(),
+                                          handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+  }
+
+  edge_dst_property_t<GraphViewType, weight_t> edge_dst_prices(handle, graph_view);
+  edge_src_property_t<GraphViewType, thrust::tuple<vertex_t, weight_t, weight_t>> edge_src_bids(
+    handle, graph_view);
+
+  rmm::device_uvector<vertex_t> bid_jobs(local_size, handle.get_stream());
+  rmm::device_uvector<weight_t> bid_values(local_size, handle.get_stream());
+  rmm::device_uvector<weight_t> bid_costs(local_size, handle.get_stream());
+
+  while (true) {
+    thrust::fill(handle.get_thrust_policy(),
+                 worker_jobs.begin(),
+                 worker_jobs.end(),
+                 invalid_vertex_id<vertex_t>::value);
+    thrust::fill(handle.get_thrust_policy(),
+                 job_owners.begin(),
+                 job_owners.end(),
+                 invalid_vertex_id<vertex_t>::value);
+
+    while (true) {
+      // 4-1. unassigned workers find their best and second best jobs
+
+      rmm::device_uvector<vertex_t> bidders(active_workers.size(), handle.get_stream());
+      bidders.resize(
+        thrust::distance(
+          bidders.begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          active_workers.begin(),
+                          active_workers.end(),
+                          bidders.begin(),
+                          [worker_jobs = worker_jobs.data(), local_first] __device__(auto v) {
+                            return worker_jobs[v - local_first] ==
+                                   invalid_vertex_id<vertex_t>::value;
+                          })),
+        handle.get_stream());
+
+      auto num_bidders = bidders.size();
+      if constexpr (multi_gpu) {
+        num_bidders = host_scalar_allreduce(
+          handle.get_comms(), num_bidders, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_bidders == 0) { break; }
+
+      update_edge_dst_property(handle, graph_view, prices.begin(), edge_dst_prices.mutable_view());
+
+      key_bucket_t<vertex_t, void, multi_gpu, true> bidder_bucket(
+        handle, raft::device_span<vertex_t const>(bidders.data(), bidders.size()));
+      auto top_twos = allocate_dataframe_buffer<auction_top_two_t<vertex_t, weight_t>>(
+        bidders.size(), handle.get_stream());
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        bidder_bucket,
+        edge_src_dummy_property_t{}.view(),
+        edge_dst_prices.view(),
+        edge_weight_view,
+        auction_job_value_e_op_t<vertex_t, weight_t>{},
+        auction_top_two_op_t<vertex_t, weight_t>::identity_element,
+        auction_top_two_op_t<vertex_t, weight_t>{},
+        get_dataframe_buffer_begin(top_twos));
+
+      // 4-2. compute the bids (bidding the best job's price + the margin over the second best job
+      // + epsilon), workers that cannot be assigned drop out
+
+      thrust::fill(handle.get_thrust_policy(),
+                   bid_jobs.begin(),
+                   bid_jobs.end(),
+                   invalid_vertex_id<vertex_t>::value);
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(bidders.size()),
+        [bidders     = bidders.data(),
+         top_twos    = get_dataframe_buffer_begin(top_twos),
+         bid_jobs    = bid_jobs.data(),
+         bid_values  = bid_values.data(),
+         bid_costs   = bid_costs.data(),
+         worker_jobs = worker_jobs.data(),
+         local_first,
+         cost_range,
+         current_epsilon,
+         price_bound] __device__(auto i) {
+          auto offset = bidders[i] - local_first;
+          auto t      = *(top_twos + i);
+          auto v1     = thrust::get<0>(t);
+          if ((v1 == std::numeric_limits<weight_t>::lowest()) || (-v1 > price_bound)) {
+            worker_jobs[offset] = auction_dropped_worker_v<vertex_t>;
+            return;
+          }
+          auto v2 = thrust::get<3>(t);
+          if (v2 == std::numeric_limits<weight_t>::lowest()) { v2 = v1 - cost_range; }
+          bid_jobs[offset]  = thrust::get<1>(t);
+          bid_costs[offset] = thrust::get<2>(t);
+          // the bid should raise the price even if epsilon is below the floating point precision
+          // of the price
+          auto price         = -v1 - thrust::get<2>(t);
+          auto min_bid       = nextafter(price, std::numeric_limits<weight_t>::max());
+          bid_values[offset] = cuda::std::max(-thrust::get<2>(t) - v2 + current_epsilon, min_bid);
+        });
+
+      update_edge_src_property(
+        handle,
+        graph_view,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(bid_jobs.begin(), bid_values.begin(), bid_costs.begin())),
+        edge_src_bids.mutable_view());
+
+      // 4-3. each job accepts the highest bid, and the previous owner becomes unassigned
+
+      auto [jobs, winning_bids] =
+        transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                      graph_view,
+                                                      bidder_bucket,
+                                                      edge_src_bids.view(),
+                                                      edge_dst_dummy_property_t{}.view(),
+                                                      edge_dummy_property_t{}.view(),
+                                                      auction_bid_e_op_t<vertex_t, weight_t>{},
+                                                      reduce_op::maximum<bid_t>());
+
+      rmm::device_uvector<vertex_t> notified_workers(jobs.size() * 2, handle.get_stream());
+      rmm::device_uvector<vertex_t> notified_jobs(notified_workers.size(), handle.get_stream());
+      rmm::device_uvector<weight_t> notified_costs(notified_workers.size(), handle.get_stream());
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(jobs.size()),
+        [jobs             = jobs.data(),
+         winning_bids     = get_dataframe_buffer_begin(winning_bids),
+         prices           = prices.data(),
+         job_owners       = job_owners.data(),
+         notified_workers = notified_workers.data(),
+         notified_jobs    = notified_jobs.data(),
+         notified_costs   = notified_costs.data(),
+         num_jobs         = jobs.size(),
+         local_first] __device__(auto i) {
+          auto offset            = jobs[i] - local_first;
+          auto bid               = *(winning_bids + i);
+          notified_workers[i]    = thrust::get<1>(bid);
+          notified_jobs[i]       = jobs[i];
+          notified_costs[i]      = thrust::get<2>(bid);
+          notified_workers[num_jobs + i] = job_owners[offset];  // may be invalid
+          notified_jobs[num_jobs + i]    = invalid_vertex_id<vertex_t>::value;
+          notified_costs[num_jobs + i]   = weight_t{0.0};
+          prices[offset]                 = thrust::get<0>(bid);
+          job_owners[offset]             = thrust::get<1>(bid);
+        });
+
+      auto notification_first = thrust::make_zip_iterator(thrust::make_tuple(
+        notified_workers.begin(), notified_jobs.begin(), notified_costs.begin()));
+      notified_workers.resize(
+        thrust::distance(notification_first,
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           notification_first,
+                                           notification_first + notified_workers.size(),
+                                           [] __device__(auto n) {
+                                             return thrust::get<0>(n) ==
+                                                    invalid_vertex_id<vertex_t>::value;
+                                           })),
+        handle.get_stream());
+      notified_jobs.resize(notified_workers.size(), handle.get_stream());
+      notified_costs.resize(notified_workers.size(), handle.get_stream());
+
+      if constexpr (multi_gpu) {
+        auto& comm                 = handle.get_comms();
+        auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+        auto const major_comm_size = major_comm.get_size();
+        auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+        auto const minor_comm_size = minor_comm.get_size();
+
+        std::forward_as_tuple(
+          notified_workers, std::tie(notified_jobs, notified_costs), std::ignore) =
+          groupby_gpu_id_and_shuffle_kv_pairs(
+            comm,
+            notified_workers.begin(),
+            notified_workers.end(),
+            thrust::make_zip_iterator(
+              thrust::make_tuple(notified_jobs.begin(), notified_costs.begin())),
+            compute_gpu_id_from_int_vertex_t<vertex_t>{
+              raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                                d_vertex_partition_range_lasts.size()),
+              major_comm_size,
+              minor_comm_size},
+            handle.get_stream());
+      }
+
+      // a worker wins at most one job in a round and bidders are not evicted in the same round
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(notified_workers.size()),
+                       [notified_workers = notified_workers.data(),
+                        notified_jobs    = notified_jobs.data(),
+                        notified_costs   = notified_costs.data(),
+                        worker_jobs      = worker_jobs.data(),
+                        worker_costs     = worker_costs.data(),
+                        local_first] __device__(auto i) {
+                         auto offset          = notified_workers[i] - local_first;
+                         worker_jobs[offset]  = notified_jobs[i];
+                         worker_costs[offset] = notified_costs[i];
+                       });
+
+      // remove the dropped workers from the active worker list
+      active_workers.resize(
+        thrust::distance(
+          active_workers.begin(),
+          thrust::remove_if(handle.get_thrust_policy(),
+                            active_workers.begin(),
+                            active_workers.end(),
+                            [worker_jobs = worker_jobs.data(), local_first] __device__(auto v) {
+                              return worker_jobs[v - local_first] ==
+                                     auction_dropped_worker_v<vertex_t>;
+                            })),
+        handle.get_stream());
+    }
+
+    if (current_epsilon <= final_epsilon) { break; }
+    current_epsilon = std::max(current_epsilon / epsilon_scaling_factor, final_epsilon);
+  }
+
+  // 5. collect the assignments in the input worker order
+
+  rmm::device_uvector<vertex_t> assignments(workers.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    workers.begin(),
+                    workers.end(),
+                    assignments.begin(),
+                    [worker_jobs = worker_jobs.data(), local_first] __device__(auto v) {
+                      auto job = worker_jobs[v - local_first];
+                      return (job == auction_dropped_worker_v<vertex_t>)
+                               ? invalid_vertex_id<vertex_t>::value
+                               : job;
+                    });
+
+  auto total_cost = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    active_workers.begin(),
+    active_workers.end(),
+    [worker_costs = worker_costs.data(), local_first] __device__(auto v) {
+      return worker_costs[v - local_first];
+    },
+    weight_t{0.0},
+    thrust::plus<weight_t>{});
+  if constexpr (multi_gpu) {
+    total_cost = host_scalar_allreduce(
+      handle.get_comms(), total_cost, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(assignments), total_cost);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, weight_t> auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> workers,
+  std::optional<weight_t> epsilon,
+  weight_t epsilon_scaling_factor,
+  bool do_expensive_check)
+{
+  return detail::auction_assignment(handle,
+                                    graph_view,
+                                    edge_weight_view,
+                                    workers,
+                                    epsilon,
+                                    epsilon_scaling_factor,
+                                    do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "linear_assignment/auction_assignment_impl.cuh"
+
+namespace cugraph {
+
+// MG instantiation
+
+template std::tuple<rmm::device_uvector<int64_t>, float> auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  raft::device_span<int64_t const> workers,
+  std::optional<float> epsilon,
+  float epsilon_scaling_factor,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>, double> auction_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  raft::device_span<int64_t const> workers,
+  std::optional<double> epsilon,
+  double epsilon_scaling_factor,
+  bool do_expensive_check);
+
+}  // namespace cugraph
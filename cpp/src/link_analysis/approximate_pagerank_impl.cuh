@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/update_v_frontier.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// a vertex is pushed while its residual is at least epsilon times its out-going edge weight sum
+// (or epsilon, if the vertex has no out-going edge)
+template <typename result_t, typename weight_t>
+__device__ result_t push_threshold(result_t epsilon, weight_t out_weight_sum)
+{
+  return out_weight_sum > weight_t{0.0} ? epsilon * static_cast<result_t>(out_weight_sum)
+                                        : epsilon;
+}
+
+template <typename vertex_t, typename result_t>
+struct push_residual_e_op_t {
+  template <typename EdgeWeight>
+  __device__ cuda::std::optional<result_t> operator()(
+    vertex_t, vertex_t, result_t src_val, cuda::std::nullopt_t, EdgeWeight w) const
+  {
+    if constexpr (std::is_same_v<EdgeWeight, cuda::std::nullopt_t>) {
+      return src_val;
+    } else {
+      return src_val * static_cast<result_t>(w);
+    }
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename result_t, bool multi_gpu>
+struct add_residual_v_op_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  result_t epsilon{};
+  size_t next_bucket_idx{};
+
+  __device__ thrust::tuple<cuda::std::optional<size_t>, cuda::std::optional<result_t>> operator()(
+    vertex_t v, result_t residual, result_t pushed_residual) const
+  {
+    auto new_residual = residual + pushed_residual;
+    auto out_weight_sum =
+      vertex_out_weight_sums[vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v)];
+    // vertices at or above the threshold before this update are in the current frontier (and
+    // their residual is 0), so a vertex is inserted at most once
+    return thrust::make_tuple(
+      new_residual >= push_threshold(epsilon, out_weight_sum)
+        ? cuda::std::optional<size_t>{next_bucket_idx}
+        : cuda::std::nullopt,
+      cuda::std::optional<result_t>{new_residual});
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  std::tuple<raft::device_span<typename GraphViewType::vertex_type const>,
+             raft::device_span<result_t const>> personalization,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto [personalization_vertices, personalization_values] = personalization;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(!push_graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(personalization_vertices.size() == personalization_values.size(),
+                  "Invalid input argument: the size of personalization vertices and values "
+                  "should match.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.local_vertex_partition_view());
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       personalization_vertices.begin(),
+                       personalization_vertices.end(),
+                       [vertex_partition] __device__(auto val) {
+                         return !(vertex_partition.is_valid_vertex(val) &&
+                                  vertex_partition.in_local_vertex_partition_range_nocheck(val));
+                       });
+    auto num_negative_values = thrust::count_if(handle.get_thrust_policy(),
+                                                personalization_values.begin(),
+                                                personalization_values.end(),
+                                                [] __device__(auto val) { return val < 0.0; });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+      num_negative_values = host_scalar_allreduce(
+        handle.get_comms(), num_negative_values, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: personalization vertices have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: personalization values should be non-negative.");
+  }
+
+  auto personalization_sum = thrust::reduce(handle.get_thrust_policy(),
+                                            personalization_values.begin(),
+                                            personalization_values.end(),
+                                            result_t{0.0});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    personalization_sum = host_scalar_allreduce(
+      handle.get_comms(), personalization_sum, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(personalization_sum > 0.0,
+                  "Invalid input argument: sum of personalization values should be positive.");
+
+  // 2. compute the sums of the out-going edge weights (if not provided)
+
+  std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
+  if (!precomputed_vertex_out_weight_sums) {
+    if (edge_weight_view) {
+      tmp_vertex_out_weight_sums =
+        compute_out_weight_sums(handle, push_graph_view, *edge_weight_view);
+    } else {
+      auto tmp_vertex_out_degrees = push_graph_view.compute_out_degrees(handle);
+      tmp_vertex_out_weight_sums =
+        rmm::device_uvector<weight_t>(tmp_vertex_out_degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        tmp_vertex_out_degrees.begin(),
+                        tmp_vertex_out_degrees.end(),
+                        (*tmp_vertex_out_weight_sums).begin(),
+                        detail::typecast_t<edge_t, weight_t>{});
+    }
+  }
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                  ? (*precomputed_vertex_out_weight_sums).data()
+                                  : (*tmp_vertex_out_weight_sums).data();
+
+  // 3. initialize the residuals to the (normalized) personalization vector, the personalization
+  // vertices at or above the push threshold form the initial frontier
+
+  auto const local_size = push_graph_view.local_vertex_partition_range_size();
+
+  rmm::device_uvector<result_t> pageranks(local_size, handle.get_stream());
+  rmm::device_uvector<result_t> residuals(local_size, handle.get_stream());
+  rmm::device_uvector<result_t> push_values(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), pageranks.begin(), pageranks.end(), result_t{0.0});
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(personalization_vertices.begin(), personalization_values.begin()),
+    thrust::make_zip_iterator(personalization_vertices.end(), personalization_values.end()),
+    [vertex_partition, residuals = residuals.data(), personalization_sum] __device__(auto pair) {
+      auto v_offset =
+        vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(thrust::get<0>(pair));
+      residuals[v_offset] = thrust::get<1>(pair) / personalization_sum;
+    });
+
+  constexpr size_t bucket_idx_cur  = 0;
+  constexpr size_t bucket_idx_next = 1;
+  constexpr size_t num_buckets     = 2;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
+                                                                                       num_buckets);
+
+  {
+    rmm::device_uvector<vertex_t> initial_frontier(personalization_vertices.size(),
+                                                   handle.get_stream());
+    initial_frontier.resize(
+      thrust::distance(
+        initial_frontier.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        personalization_vertices.begin(),
+                        personalization_vertices.end(),
+                        initial_frontier.begin(),
+                        [vertex_partition,
+                         residuals = residuals.data(),
+                         vertex_out_weight_sums,
+                         epsilon] __device__(auto v) {
+                          auto v_offset =
+                            vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+                          return residuals[v_offset] >=
+                                 push_threshold(epsilon, vertex_out_weight_sums[v_offset]);
+                        })),
+      handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), initial_frontier.begin(), initial_frontier.end());
+    vertex_frontier.bucket(bucket_idx_cur).insert(initial_frontier.begin(),
+                                                  initial_frontier.end());
+  }
+
+  // 4. push iteration, only the vertices with a residual at or above the push threshold are
+  // touched
+
+  auto edge_src_push_values = GraphViewType::is_multi_gpu
+                                ? edge_src_property_t<GraphViewType, result_t>(handle,
+                                                                               push_graph_view)
+                                : edge_src_property_t<GraphViewType, result_t>(handle);
+
+  rmm::device_scalar<result_t> dangling_sum(result_t{0.0}, handle.get_stream());
+
+  size_t iter{0};
+  while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+    if (iter >= max_iterations) { break; }
+
+    // settle (1 - alpha) of the residual of every frontier vertex, the rest is pushed to the
+    // out-going neighbors (or to the personalization vertices, if the vertex is dangling)
+    dangling_sum.set_value_to_zero_async(handle.get_stream());
+    thrust::for_each(handle.get_thrust_policy(),
+                     vertex_frontier.bucket(bucket_idx_cur).begin(),
+                     vertex_frontier.bucket(bucket_idx_cur).end(),
+                     [vertex_partition,
+                      pageranks    = pageranks.data(),
+                      residuals    = residuals.data(),
+                      push_values  = push_values.data(),
+                      dangling_sum = dangling_sum.data(),
+                      vertex_out_weight_sums,
+                      alpha] __device__(auto v) {
+                       auto v_offset =
+                         vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+                       auto residual       = residuals[v_offset];
+                       auto out_weight_sum = vertex_out_weight_sums[v_offset];
+                       pageranks[v_offset] += (result_t{1.0} - alpha) * residual;
+                       if (out_weight_sum > weight_t{0.0}) {
+                         push_values[v_offset] =
+                           alpha * residual / static_cast<result_t>(out_weight_sum);
+                       } else {
+                         cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(*dangling_sum);
+                         sum.fetch_add(alpha * residual, cuda::std::memory_order_relaxed);
+                       }
+                       residuals[v_offset] = result_t{0.0};
+                     });
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_src_property(handle,
+                               push_graph_view,
+                               vertex_frontier.bucket(bucket_idx_cur).begin(),
+                               vertex_frontier.bucket(bucket_idx_cur).end(),
+                               push_values.data(),
+                               edge_src_push_values.mutable_view());
+    }
+
+    auto push = [&](auto edge_value_view) {
+      return transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        push_graph_view,
+        vertex_frontier.bucket(bucket_idx_cur),
+        GraphViewType::is_multi_gpu
+          ? edge_src_push_values.view()
+          : detail::edge_major_property_view_t<vertex_t, result_t const*>(push_values.data()),
+        edge_dst_dummy_property_t{}.view(),
+        edge_value_view,
+        push_residual_e_op_t<vertex_t, result_t>{},
+        reduce_op::plus<result_t>());
+    };
+    auto [pushed_vertices, pushed_residuals] =
+      edge_weight_view ? push(*edge_weight_view) : push(edge_dummy_property_t{}.view());
+
+    // the residual pushed from the dangling vertices goes to the personalization vertices (as in
+    // PageRank)
+    auto aggregate_dangling_sum = dangling_sum.value(handle.get_stream());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      aggregate_dangling_sum = host_scalar_allreduce(
+        handle.get_comms(), aggregate_dangling_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if ((aggregate_dangling_sum > 0.0) && (personalization_vertices.size() > 0)) {
+      auto old_size = pushed_vertices.size();
+      pushed_vertices.resize(old_size + personalization_vertices.size(), handle.get_stream());
+      pushed_residuals.resize(pushed_vertices.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   personalization_vertices.begin(),
+                   personalization_vertices.end(),
+                   pushed_vertices.begin() + old_size);
+      thrust::transform(handle.get_thrust_policy(),
+                        personalization_values.begin(),
+                        personalization_values.end(),
+                        pushed_residuals.begin() + old_size,
+                        [aggregate_dangling_sum, personalization_sum] __device__(auto val) {
+                          return aggregate_dangling_sum * (val / personalization_sum);
+                        });
+
+      thrust::sort_by_key(handle.get_thrust_policy(),
+                          pushed_vertices.begin(),
+                          pushed_vertices.end(),
+                          pushed_residuals.begin());
+      auto num_uniques = thrust::distance(
+        pushed_vertices.begin(),
+        thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                             pushed_vertices.begin(),
+                                             pushed_vertices.end(),
+                                             pushed_residuals.begin(),
+                                             pushed_vertices.begin(),
+                                             pushed_residuals.begin())));
+      pushed_vertices.resize(num_uniques, handle.get_stream());
+      pushed_residuals.resize(num_uniques, handle.get_stream());
+    }
+
+    update_v_frontier(
+      handle,
+      push_graph_view,
+      std::move(pushed_vertices),
+      std::move(pushed_residuals),
+      vertex_frontier,
+      std::vector<size_t>{bucket_idx_next},
+      residuals.data(),
+      residuals.data(),
+      add_residual_v_op_t<vertex_t, weight_t, result_t, GraphViewType::is_multi_gpu>{
+        vertex_partition, vertex_out_weight_sums, epsilon, bucket_idx_next});
+
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+
+    iter++;
+  }
+
+  auto converged = vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0;
+
+  return std::make_tuple(std::move(pageranks), centrality_algorithm_metadata_t{iter, converged});
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+approximate_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>
+    personalization,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::approximate_personalized_pagerank(handle,
+                                                   graph_view,
+                                                   edge_weight_view,
+                                                   precomputed_vertex_out_weight_sums,
+                                                   personalization,
+                                                   alpha,
+                                                   epsilon,
+                                                   max_iterations,
+                                                   do_expensive_check);
+}
+
+}  // namespace cugraph
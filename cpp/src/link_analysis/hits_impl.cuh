@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "detail/lanczos_eigensolver.cuh"
 #include "prims/count_if_v.cuh"
 #include "prims/fill_edge_src_dst_property.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
@@ -54,6 +55,129 @@ void normalize(raft::handle_t const& handle,
                     thrust::divides<result_t>());
 }
 
+// hubs = A authorities (pushed through the edge destination authorities)
+template <typename GraphViewType, typename result_t>
+void compute_hubs_from_authorities(raft::handle_t const& handle,
+                                   GraphViewType const& graph_view,
+                                   result_t const* authorities,
+                                   edge_dst_property_t<GraphViewType, result_t>& dst_auth,
+                                   result_t* hubs)
+{
+  update_edge_dst_property(handle, graph_view, authorities, dst_auth.mutable_view());
+  per_v_transform_reduce_outgoing_e(
+    handle,
+    graph_view,
+    edge_src_dummy_property_t{}.view(),
+    dst_auth.view(),
+    edge_dummy_property_t{}.view(),
+    [] __device__(auto, auto, auto, auto dst_auth_value, auto) { return dst_auth_value; },
+    result_t{0},
+    reduce_op::plus<result_t>{},
+    hubs);
+}
+
+// authorities = A^T hubs (pulled through the edge source hubs)
+template <typename GraphViewType, typename result_t>
+void compute_authorities_from_hubs(raft::handle_t const& handle,
+                                   GraphViewType const& graph_view,
+                                   result_t const* hubs,
+                                   edge_src_property_t<GraphViewType, result_t>& src_hubs,
+                                   result_t* authorities)
+{
+  update_edge_src_property(handle, graph_view, hubs, src_hubs.mutable_view());
+  per_v_transform_reduce_incoming_e(
+    handle,
+    graph_view,
+    src_hubs.view(),
+    edge_dst_dummy_property_t{}.view(),
+    edge_dummy_property_t{}.view(),
+    [] __device__(auto, auto, auto src_hub_value, auto, auto) { return src_hub_value; },
+    result_t{0},
+    reduce_op::plus<result_t>{},
+    authorities);
+}
+
+// y = A^T A x, the authorities are the dominant eigenvector of A^T A
+template <typename GraphViewType, typename result_t>
+struct hits_authority_operator_t {
+  raft::handle_t const& handle;
+  GraphViewType const& graph_view;
+  edge_src_property_t<GraphViewType, result_t>& src_hubs;
+  edge_dst_property_t<GraphViewType, result_t>& dst_auth;
+  rmm::device_uvector<result_t>& hubs;
+
+  void operator()(raft::device_span<result_t const> x, raft::device_span<result_t> y) const
+  {
+    compute_hubs_from_authorities(handle, graph_view, x.data(), dst_auth, hubs.data());
+    compute_authorities_from_hubs(handle, graph_view, hubs.data(), src_hubs, y.data());
+  }
+};
+
+template <typename GraphViewType, typename result_t>
+std::tuple<result_t, size_t> hits_lanczos(raft::handle_t const& handle,
+                                          GraphViewType const& graph_view,
+                                          result_t* const hubs,
+                                          result_t* const authorities,
+                                          result_t epsilon,
+                                          size_t max_iterations,
+                                          bool has_initial_hubs_guess,
+                                          bool normalize)
+{
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const local_size   = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  edge_src_property_t<GraphViewType, result_t> src_hubs(handle, graph_view);
+  edge_dst_property_t<GraphViewType, result_t> dst_auth(handle, graph_view);
+  rmm::device_uvector<result_t> temp_hubs(local_size, handle.get_stream());
+
+  // start from the authorities of the initial hubs
+  if (!has_initial_hubs_guess) {
+    thrust::fill(
+      handle.get_thrust_policy(), hubs, hubs + local_size, result_t{1.0} / num_vertices);
+  }
+  compute_authorities_from_hubs(handle, graph_view, hubs, src_hubs, authorities);
+
+  auto tolerance = std::sqrt(static_cast<result_t>(num_vertices)) * epsilon;
+  auto [eigenvalue, relative_residual, num_products] = lanczos_largest_eigenpair(
+    handle,
+    graph_view,
+    hits_authority_operator_t<GraphViewType, result_t>{
+      handle, graph_view, src_hubs, dst_auth, temp_hubs},
+    raft::device_span<result_t>(authorities, local_size),
+    tolerance,
+    max_iterations);
+  if (relative_residual > tolerance) { CUGRAPH_FAIL("HITS failed to converge."); }
+
+  // the eigenvector is determined up to its sign, the scores are non-negative
+  auto sum = reduce_v(handle, graph_view, authorities, result_t{0.0});
+  if (sum < result_t{0.0}) {
+    thrust::transform(handle.get_thrust_policy(),
+                      authorities,
+                      authorities + local_size,
+                      authorities,
+                      thrust::negate<result_t>());
+  }
+  compute_hubs_from_authorities(handle, graph_view, authorities, dst_auth, hubs);
+
+  detail::normalize(handle,
+                    graph_view,
+                    hubs,
+                    std::numeric_limits<result_t>::lowest(),
+                    reduce_op::maximum<result_t>{});
+  detail::normalize(handle,
+                    graph_view,
+                    authorities,
+                    std::numeric_limits<result_t>::lowest(),
+                    reduce_op::maximum<result_t>{});
+  if (normalize) {
+    detail::normalize(handle, graph_view, hubs, result_t{0.0}, reduce_op::plus<result_t>{});
+    detail::normalize(handle, graph_view, authorities, result_t{0.0}, reduce_op::plus<result_t>{});
+  }
+
+  return std::make_tuple(std::sqrt(static_cast<result_t>(num_vertices)) * relative_residual,
+                         num_products);
+}
+
 template <typename GraphViewType, typename result_t>
 std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                                   GraphViewType const& graph_view,
@@ -63,7 +187,8 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                                   size_t max_iterations,
                                   bool has_initial_hubs_guess,
                                   bool normalize,
-                                  bool do_expensive_check)
+                                  bool do_expensive_check,
+                                  centrality_eigensolver_t solver)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   static_assert(std::is_integral<vertex_t>::value,
@@ -94,6 +219,17 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
     detail::normalize(handle, graph_view, hubs, result_t{0.0}, reduce_op::plus<result_t>{});
   }
 
+  if (solver == centrality_eigensolver_t::lanczos) {
+    return hits_lanczos(handle,
+                        graph_view,
+                        hubs,
+                        authorities,
+                        epsilon,
+                        max_iterations,
+                        has_initial_hubs_guess,
+                        normalize);
+  }
+
   // Property wrappers
   edge_src_property_t<GraphViewType, result_t> prev_src_hubs(handle, graph_view);
   edge_dst_property_t<GraphViewType, result_t> curr_dst_auth(handle, graph_view);
@@ -208,7 +344,8 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                                   size_t max_iterations,
                                   bool has_initial_hubs_guess,
                                   bool normalize,
-                                  bool do_expensive_check)
+                                  bool do_expensive_check,
+                                  centrality_eigensolver_t solver)
 {
   return detail::hits(handle,
                       graph_view,
@@ -218,7 +355,8 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                       max_iterations,
                       has_initial_hubs_guess,
                       normalize,
-                      do_expensive_check);
+                      do_expensive_check,
+                      solver);
 }
 
 }  // namespace cugraph
@@ -28,7 +28,8 @@ template std::tuple<float, size_t> hits(
   size_t max_iterations,
   bool has_initial_hubs_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_eigensolver_t solver);
 
 template std::tuple<double, size_t> hits(
   raft::handle_t const& handle,
@@ -39,6 +40,7 @@ template std::tuple<double, size_t> hits(
   size_t max_iterations,
   bool has_initial_hubs_guess,
   bool normalize,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_eigensolver_t solver);
 
 }  // namespace cugraph
@@ -0,0 +1,541 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/fill_edge_property.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <cmath>
+#include <tuple>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct is_unchanged_e_op_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, bool changed) const
+  {
+    return !changed;
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct push_e_op_t {
+  __device__ cuda::std::optional<result_t> operator()(
+    vertex_t, vertex_t, result_t src_val, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return src_val;
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct weighted_push_e_op_t {
+  __device__ cuda::std::optional<result_t> operator()(
+    vertex_t, vertex_t, result_t src_val, cuda::std::nullopt_t, weight_t w) const
+  {
+    return src_val * static_cast<result_t>(w);
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct is_above_tolerance_t {
+  raft::device_span<result_t const> residuals{};
+  result_t uniform_residual{};
+  result_t tolerance{};
+  vertex_t v_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return std::abs(residuals[v - v_first] + uniform_residual) > tolerance;
+  }
+};
+
+// v's contribution to each outgoing neighbor per unit edge weight (sign * alpha * value / out
+// weight sum), 0 for dangling vertices (their contributions are spread uniformly)
+template <typename vertex_t, typename weight_t, typename result_t>
+struct scaled_contribution_t {
+  raft::device_span<result_t const> values{};
+  raft::device_span<weight_t const> out_weight_sums{};
+  result_t scale{};
+  vertex_t v_first{};
+
+  __device__ result_t operator()(vertex_t v) const
+  {
+    auto v_offset = v - v_first;
+    auto w_sum    = out_weight_sums[v_offset];
+    return w_sum > weight_t{0.0} ? scale * values[v_offset] / static_cast<result_t>(w_sum)
+                                 : result_t{0.0};
+  }
+};
+
+// value of v if v is dangling in the current graph but not in the previous graph (positive), value
+// of v if v is dangling in the previous graph but not in the current graph (negative), 0 otherwise
+template <typename vertex_t, typename weight_t, typename result_t>
+struct dangling_change_t {
+  raft::device_span<result_t const> values{};
+  raft::device_span<weight_t const> out_weight_sums{};
+  raft::device_span<weight_t const> prev_out_weight_sums{};
+  vertex_t v_first{};
+
+  __device__ result_t operator()(vertex_t v) const
+  {
+    auto v_offset      = v - v_first;
+    auto dangling      = out_weight_sums[v_offset] == weight_t{0.0};
+    auto prev_dangling = prev_out_weight_sums[v_offset] == weight_t{0.0};
+    return (dangling == prev_dangling) ? result_t{0.0}
+                                       : (dangling ? values[v_offset] : -values[v_offset]);
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct dangling_residual_t {
+  raft::device_span<result_t const> residuals{};
+  raft::device_span<weight_t const> out_weight_sums{};
+  result_t uniform_residual{};
+  vertex_t v_first{};
+
+  __device__ result_t operator()(vertex_t v) const
+  {
+    auto v_offset = v - v_first;
+    return out_weight_sums[v_offset] == weight_t{0.0} ? residuals[v_offset] + uniform_residual
+                                                      : result_t{0.0};
+  }
+};
+
+// moves the residual of a frontier vertex to its PageRank value and computes the contribution to
+// push to its outgoing neighbors
+template <typename vertex_t, typename weight_t, typename result_t>
+struct settle_residual_t {
+  raft::device_span<result_t> pageranks{};
+  raft::device_span<result_t> residuals{};
+  raft::device_span<result_t> contributions{};
+  raft::device_span<weight_t const> out_weight_sums{};
+  result_t uniform_residual{};
+  result_t alpha{};
+  vertex_t v_first{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto v_offset = v - v_first;
+    auto r        = residuals[v_offset] + uniform_residual;
+    auto w_sum    = out_weight_sums[v_offset];
+    pageranks[v_offset] += r;
+    residuals[v_offset] = -uniform_residual;
+    contributions[v_offset] =
+      w_sum > weight_t{0.0} ? alpha * r / static_cast<result_t>(w_sum) : result_t{0.0};
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct accumulate_residual_t {
+  vertex_t const* keys{};
+  result_t const* values{};
+  raft::device_span<result_t> residuals{};
+  vertex_t v_first{};
+
+  __device__ void operator()(size_t i) const { residuals[keys[i] - v_first] += values[i]; }
+};
+
+// push the edge source contributions of the frontier vertices to their outgoing neighbors (keys
+// returned by transform_reduce_v_frontier_outgoing_e_by_dst are unique, so no atomics needed)
+template <typename GraphViewType, typename weight_t, typename result_t>
+void push_residuals(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view,
+  key_bucket_t<typename GraphViewType::vertex_type, void, GraphViewType::is_multi_gpu, true> const&
+    frontier,
+  edge_src_property_t<GraphViewType, result_t> const& edge_src_contributions,
+  raft::device_span<result_t> residuals)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_uvector<vertex_t> keys(0, handle.get_stream());
+  rmm::device_uvector<result_t> values(0, handle.get_stream());
+  if (edge_weight_view) {
+    std::tie(keys, values) = transform_reduce_v_frontier_outgoing_e_by_dst(
+      handle,
+      graph_view,
+      frontier,
+      edge_src_contributions.view(),
+      edge_dst_dummy_property_t{}.view(),
+      *edge_weight_view,
+      weighted_push_e_op_t<vertex_t, weight_t, result_t>{},
+      reduce_op::plus<result_t>());
+  } else {
+    std::tie(keys, values) = transform_reduce_v_frontier_outgoing_e_by_dst(
+      handle,
+      graph_view,
+      frontier,
+      edge_src_contributions.view(),
+      edge_dst_dummy_property_t{}.view(),
+      edge_dummy_property_t{}.view(),
+      push_e_op_t<vertex_t, result_t>{},
+      reduce_op::plus<result_t>());
+  }
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(keys.size()),
+                   accumulate_residual_t<vertex_t, result_t>{
+                     keys.data(),
+                     values.data(),
+                     residuals,
+                     graph_view.local_vertex_partition_range_first()});
+}
+
+template <typename GraphViewType, typename weight_t>
+rmm::device_uvector<weight_t> compute_vertex_out_weight_sums(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view)
+{
+  using edge_t = typename GraphViewType::edge_type;
+
+  if (edge_weight_view) {
+    return compute_out_weight_sums(handle, graph_view, *edge_weight_view);
+  } else {
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+    rmm::device_uvector<weight_t> out_weight_sums(out_degrees.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      out_degrees.begin(),
+                      out_degrees.end(),
+                      out_weight_sums.begin(),
+                      detail::typecast_t<edge_t, weight_t>{});
+    return out_weight_sums;
+  }
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> incremental_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view,
+  edge_property_view_t<typename GraphViewType::edge_type, uint32_t const*, bool> edge_mask_delta,
+  raft::device_span<result_t const> previous_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const v_first      = graph_view.local_vertex_partition_range_first();
+  auto const local_size   = graph_view.local_vertex_partition_range_size();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(previous_pageranks.size() == static_cast<size_t>(local_size),
+                  "Invalid input argument: previous_pageranks size should match the local vertex "
+                  "partition range size.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  if (do_expensive_check) {
+    auto num_negative_values = thrust::count_if(handle.get_thrust_policy(),
+                                                previous_pageranks.begin(),
+                                                previous_pageranks.end(),
+                                                [] __device__(auto val) { return val < 0.0; });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_negative_values = host_scalar_allreduce(
+        handle.get_comms(), num_negative_values, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: previous PageRank values should be non-negative.");
+  }
+
+  rmm::device_uvector<result_t> pageranks(local_size, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               previous_pageranks.begin(),
+               previous_pageranks.end(),
+               pageranks.begin());
+  if (num_vertices == 0) {
+    return std::make_tuple(std::move(pageranks), centrality_algorithm_metadata_t{0, true});
+  }
+
+  // 2. reconstruct the previous graph (previous edge mask = current edge mask XOR delta)
+
+  auto unmasked_graph_view = graph_view;
+  unmasked_graph_view.clear_edge_mask();
+
+  edge_property_t<GraphViewType, bool> prev_edge_mask(handle, unmasked_graph_view);
+  fill_edge_property(handle, unmasked_graph_view, prev_edge_mask.mutable_view(), false);
+  transform_e(handle,
+              graph_view,
+              edge_src_dummy_property_t{}.view(),
+              edge_dst_dummy_property_t{}.view(),
+              edge_mask_delta,
+              is_unchanged_e_op_t<vertex_t>{},
+              prev_edge_mask.mutable_view());  // edges in the current graph
+  auto delta_graph_view = unmasked_graph_view;
+  delta_graph_view.attach_edge_mask(edge_mask_delta);
+  if (graph_view.has_edge_mask()) {
+    transform_e(handle,
+                delta_graph_view,
+                edge_src_dummy_property_t{}.view(),
+                edge_dst_dummy_property_t{}.view(),
+                *(graph_view.edge_mask_view()),
+                is_unchanged_e_op_t<vertex_t>{},
+                prev_edge_mask.mutable_view());  // deleted edges
+  }
+  auto prev_graph_view = unmasked_graph_view;
+  prev_graph_view.attach_edge_mask(prev_edge_mask.view());
+
+  auto out_weight_sums = compute_vertex_out_weight_sums(handle, graph_view, edge_weight_view);
+  auto prev_out_weight_sums =
+    compute_vertex_out_weight_sums(handle, prev_graph_view, edge_weight_view);
+
+  // 3. find the vertices with changed outgoing edges
+
+  rmm::device_uvector<vertex_t> touched_vertices(local_size, handle.get_stream());
+  {
+    auto delta_out_degrees = delta_graph_view.compute_out_degrees(handle);
+    touched_vertices.resize(
+      thrust::distance(touched_vertices.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(v_first),
+                                       thrust::make_counting_iterator(v_first + local_size),
+                                       delta_out_degrees.begin(),
+                                       touched_vertices.begin(),
+                                       detail::is_not_equal_t<edge_t>{edge_t{0}})),
+      handle.get_stream());
+  }
+
+  // 4. compute the initial residuals, the previous PageRank values satisfy the previous graph's
+  // PageRank equation, so the residuals are non-zero only around the changed edges (and a uniform
+  // term if vertices become or stop being dangling)
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
+                                                                                       num_buckets);
+  vertex_frontier.bucket(bucket_idx_cur).insert(touched_vertices.begin(), touched_vertices.end());
+
+  rmm::device_uvector<result_t> residuals(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), residuals.begin(), residuals.end(), result_t{0.0});
+  rmm::device_uvector<result_t> contributions(local_size, handle.get_stream());
+  edge_src_property_t<GraphViewType, result_t> edge_src_contributions(handle, graph_view);
+
+  for (auto prev : {false, true}) {
+    thrust::transform(handle.get_thrust_policy(),
+                      touched_vertices.begin(),
+                      touched_vertices.end(),
+                      thrust::make_permutation_iterator(
+                        contributions.begin(),
+                        thrust::make_transform_iterator(touched_vertices.begin(),
+                                                        detail::shift_left_t<vertex_t>{v_first})),
+                      scaled_contribution_t<vertex_t, weight_t, result_t>{
+                        raft::device_span<result_t const>(pageranks.data(), pageranks.size()),
+                        prev ? raft::device_span<weight_t const>(prev_out_weight_sums.data(),
+                                                                 prev_out_weight_sums.size())
+                             : raft::device_span<weight_t const>(out_weight_sums.data(),
+                                                                 out_weight_sums.size()),
+                        prev ? -alpha : alpha,
+                        v_first});
+    update_edge_src_property(handle,
+                             graph_view,
+                             touched_vertices.begin(),
+                             touched_vertices.end(),
+                             contributions.begin(),
+                             edge_src_contributions.mutable_view());
+    push_residuals(handle,
+                   prev ? prev_graph_view : graph_view,
+                   edge_weight_view,
+                   vertex_frontier.bucket(bucket_idx_cur),
+                   edge_src_contributions,
+                   raft::device_span<result_t>(residuals.data(), residuals.size()));
+  }
+
+  auto dangling_change = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    touched_vertices.begin(),
+    touched_vertices.end(),
+    dangling_change_t<vertex_t, weight_t, result_t>{
+      raft::device_span<result_t const>(pageranks.data(), pageranks.size()),
+      raft::device_span<weight_t const>(out_weight_sums.data(), out_weight_sums.size()),
+      raft::device_span<weight_t const>(prev_out_weight_sums.data(), prev_out_weight_sums.size()),
+      v_first},
+    result_t{0.0},
+    thrust::plus<result_t>{});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    dangling_change = host_scalar_allreduce(
+      handle.get_comms(), dangling_change, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  // pending residual shared by every vertex (from the dangling vertex contributions)
+  auto uniform_residual = alpha * dangling_change / static_cast<result_t>(num_vertices);
+
+  touched_vertices.resize(0, handle.get_stream());
+  touched_vertices.shrink_to_fit(handle.get_stream());
+  prev_out_weight_sums.resize(0, handle.get_stream());
+  prev_out_weight_sums.shrink_to_fit(handle.get_stream());
+
+  // 5. push iterations, every vertex with a residual above the tolerance moves its residual to its
+  // PageRank value and pushes alpha * residual to its outgoing neighbors; this stops once every
+  // residual falls below epsilon / V (so the sum of the residuals falls below epsilon)
+
+  auto tolerance = epsilon / static_cast<result_t>(num_vertices);
+
+  size_t iter{0};
+  bool converged{false};
+  while (true) {
+    {
+      rmm::device_uvector<vertex_t> frontier_vertices(local_size, handle.get_stream());
+      frontier_vertices.resize(
+        thrust::distance(frontier_vertices.begin(),
+                         thrust::copy_if(handle.get_thrust_policy(),
+                                         thrust::make_counting_iterator(v_first),
+                                         thrust::make_counting_iterator(v_first + local_size),
+                                         frontier_vertices.begin(),
+                                         is_above_tolerance_t<vertex_t, result_t>{
+                                           raft::device_span<result_t const>(residuals.data(),
+                                                                             residuals.size()),
+                                           uniform_residual,
+                                           tolerance,
+                                           v_first})),
+        handle.get_stream());
+      vertex_frontier.bucket(bucket_idx_cur) =
+        key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
+          handle, std::move(frontier_vertices));
+    }
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) {
+      converged = true;
+      break;
+    }
+    if (iter >= max_iterations) { break; }
+
+    auto dangling_residual_sum = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      vertex_frontier.bucket(bucket_idx_cur).begin(),
+      vertex_frontier.bucket(bucket_idx_cur).end(),
+      dangling_residual_t<vertex_t, weight_t, result_t>{
+        raft::device_span<result_t const>(residuals.data(), residuals.size()),
+        raft::device_span<weight_t const>(out_weight_sums.data(), out_weight_sums.size()),
+        uniform_residual,
+        v_first},
+      result_t{0.0},
+      thrust::plus<result_t>{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      dangling_residual_sum = host_scalar_allreduce(
+        handle.get_comms(), dangling_residual_sum, raft::comms::op_t::SUM, handle.get_stream());
+    }
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      vertex_frontier.bucket(bucket_idx_cur).begin(),
+      vertex_frontier.bucket(bucket_idx_cur).end(),
+      settle_residual_t<vertex_t, weight_t, result_t>{
+        raft::device_span<result_t>(pageranks.data(), pageranks.size()),
+        raft::device_span<result_t>(residuals.data(), residuals.size()),
+        raft::device_span<result_t>(contributions.data(), contributions.size()),
+        raft::device_span<weight_t const>(out_weight_sums.data(), out_weight_sums.size()),
+        uniform_residual,
+        alpha,
+        v_first});
+    update_edge_src_property(handle,
+                             graph_view,
+                             vertex_frontier.bucket(bucket_idx_cur).begin(),
+                             vertex_frontier.bucket(bucket_idx_cur).end(),
+                             contributions.begin(),
+                             edge_src_contributions.mutable_view());
+    push_residuals(handle,
+                   graph_view,
+                   edge_weight_view,
+                   vertex_frontier.bucket(bucket_idx_cur),
+                   edge_src_contributions,
+                   raft::device_span<result_t>(residuals.data(), residuals.size()));
+    uniform_residual += alpha * dangling_residual_sum / static_cast<result_t>(num_vertices);
+
+    ++iter;
+  }
+
+  return std::make_tuple(std::move(pageranks), centrality_algorithm_metadata_t{iter, converged});
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  edge_property_view_t<edge_t, uint32_t const*, bool> edge_mask_delta,
+  raft::device_span<result_t const> previous_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::incremental_pagerank(handle,
+                                      graph_view,
+                                      edge_weight_view,
+                                      edge_mask_delta,
+                                      previous_pageranks,
+                                      alpha,
+                                      epsilon,
+                                      max_iterations,
+                                      do_expensive_check);
+}
+
+}  // namespace cugraph
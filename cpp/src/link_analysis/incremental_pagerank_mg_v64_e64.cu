@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "link_analysis/incremental_pagerank_impl.cuh"
+
+namespace cugraph {
+
+// MG instantiation
+
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t>
+incremental_pagerank(raft::handle_t const& handle,
+                     graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+                     std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+                     edge_property_view_t<int64_t, uint32_t const*, bool> edge_mask_delta,
+                     raft::device_span<float const> previous_pageranks,
+                     float alpha,
+                     float epsilon,
+                     size_t max_iterations,
+                     bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t>
+incremental_pagerank(raft::handle_t const& handle,
+                     graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+                     std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+                     edge_property_view_t<int64_t, uint32_t const*, bool> edge_mask_delta,
+                     raft::device_span<double const> previous_pageranks,
+                     double alpha,
+                     double epsilon,
+                     size_t max_iterations,
+                     bool do_expensive_check);
+
+}  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,37 +22,185 @@
 #include "prims/reduce_v.cuh"
 #include "prims/transform_reduce_v.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+#include "utilities/cuda_graph_utils.cuh"
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
+#include <cugraph/utilities/reduced_precision_weights.hpp>
 
 #include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
 
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/atomic>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
 namespace cugraph {
 namespace detail {
 
-template <typename GraphViewType, typename weight_t, typename result_t>
+// largest scaled PageRank value sent as a reduced precision message, leaves headroom below the
+// largest finite FP16 value for values growing within a block Gauss-Seidel iteration
+template <typename result_t>
+constexpr result_t max_half_pagerank_message{16384.0};
+
+template <typename result_t>
+struct encode_half_pagerank_message_t {
+  half_precision_t precision{half_precision_t::float16};
+  result_t scale{1.0};
+
+  __device__ uint16_t operator()(result_t val) const
+  {
+    auto f = static_cast<float>(val * scale);
+    if (precision == half_precision_t::float16) {
+      return static_cast<__half_raw>(__float2half_rn(fminf(f, 65504.0f))).x;
+    } else {
+      return static_cast<__nv_bfloat16_raw>(__float2bfloat16_rn(f)).x;
+    }
+  }
+};
+
+template <typename result_t>
+struct decode_half_pagerank_message_t {
+  half_edge_weight_decoder_t decoder{};
+  result_t inv_scale{1.0};
+
+  __device__ result_t operator()(uint16_t bits) const
+  {
+    return static_cast<result_t>(decoder(bits)) * inv_scale;
+  }
+};
+
+// accumulate the PageRank contributions of the in-coming edges of the vertices in block_vertices
+// (or of all the local vertices), SrcValueDecoder converts the cached edge source values to
+// result_t
+template <typename GraphViewType,
+          typename EdgeSrcValueInputWrapper,
+          typename SrcValueDecoder,
+          typename edge_weight_storage_t,
+          typename EdgeWeightDecoder,
+          typename result_t>
+void pagerank_pull(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  std::optional<raft::device_span<typename GraphViewType::vertex_type const>> block_vertices,
+  EdgeSrcValueInputWrapper edge_src_value_input,
+  SrcValueDecoder src_value_decoder,
+  std::optional<
+    edge_property_view_t<typename GraphViewType::edge_type, edge_weight_storage_t const*>>
+    edge_weight_view,
+  EdgeWeightDecoder edge_weight_decoder,
+  result_t alpha,
+  result_t unvarying_part,
+  result_t* output_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  if (!block_vertices) {
+    if (edge_weight_view) {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        edge_src_value_input,
+        edge_dst_dummy_property_t{}.view(),
+        *edge_weight_view,
+        [alpha, src_value_decoder, edge_weight_decoder] __device__(
+          vertex_t, vertex_t, auto src_val, auto, edge_weight_storage_t w) {
+          return src_value_decoder(src_val) * static_cast<result_t>(edge_weight_decoder(w)) * alpha;
+        },
+        unvarying_part,
+        reduce_op::plus<result_t>{},
+        output_first);
+    } else {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        edge_src_value_input,
+        edge_dst_dummy_property_t{}.view(),
+        edge_dummy_property_t{}.view(),
+        [alpha, src_value_decoder] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
+          return src_value_decoder(src_val) * alpha;
+        },
+        unvarying_part,
+        reduce_op::plus<result_t>{},
+        output_first);
+    }
+  } else {
+    key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true> block(handle,
+                                                                          *block_vertices);
+    if (edge_weight_view) {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        block,
+        edge_src_value_input,
+        edge_dst_dummy_property_t{}.view(),
+        *edge_weight_view,
+        [alpha, src_value_decoder, edge_weight_decoder] __device__(
+          vertex_t, vertex_t, auto src_val, auto, edge_weight_storage_t w) {
+          return src_value_decoder(src_val) * static_cast<result_t>(edge_weight_decoder(w)) * alpha;
+        },
+        unvarying_part,
+        reduce_op::plus<result_t>{},
+        output_first);
+    } else {
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        block,
+        edge_src_value_input,
+        edge_dst_dummy_property_t{}.view(),
+        edge_dummy_property_t{}.view(),
+        [alpha, src_value_decoder] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
+          return src_value_decoder(src_val) * alpha;
+        },
+        unvarying_part,
+        reduce_op::plus<result_t>{},
+        output_first);
+    }
+  }
+}
+
+// EdgeWeightDecoder converts the stored edge weights (edge_weight_storage_t, possibly a reduced
+// precision encoding) to weight_t; the PageRank values are accumulated in result_t.
+template <typename GraphViewType,
+          typename edge_weight_storage_t,
+          typename EdgeWeightDecoder,
+          typename weight_t,
+          typename result_t>
 centrality_algorithm_metadata_t pagerank(
   raft::handle_t const& handle,
   GraphViewType const& pull_graph_view,
-  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+  std::optional<
+    edge_property_view_t<typename GraphViewType::edge_type, edge_weight_storage_t const*>>
     edge_weight_view,
+  EdgeWeightDecoder edge_weight_decoder,
   std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
   std::optional<std::tuple<raft::device_span<typename GraphViewType::vertex_type const>,
                            raft::device_span<result_t const>>> personalization,
@@ -60,7 +208,11 @@ centrality_algorithm_metadata_t pagerank(
   result_t alpha,
   result_t epsilon,
   size_t max_iterations,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule = centrality_iteration_schedule_t{},
+  size_t num_resumed_iterations            = 0,
+  pagerank_checkpoint_options_t<result_t> const& checkpoint_options =
+    pagerank_checkpoint_options_t<result_t>{})
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -97,6 +249,20 @@ centrality_algorithm_metadata_t pagerank(
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(schedule.num_blocks > 0,
+                  "Invalid input argument: schedule.num_blocks should be positive.");
+  CUGRAPH_EXPECTS(
+    schedule.convergence_check_interval > 0,
+    "Invalid input argument: schedule.convergence_check_interval should be positive.");
+  CUGRAPH_EXPECTS(!schedule.use_cuda_graph,
+                  "Invalid input argument: schedule.use_cuda_graph is supported by batched "
+                  "personalized PageRank only.");
+  CUGRAPH_EXPECTS((num_resumed_iterations == 0) || (num_resumed_iterations < max_iterations),
+                  "Invalid input argument: num_resumed_iterations should be smaller than "
+                  "max_iterations.");
+  CUGRAPH_EXPECTS(
+    !checkpoint_options.callback || (checkpoint_options.iteration_interval > 0),
+    "Invalid input argument: checkpoint_options.iteration_interval should be positive.");
 
   if (do_expensive_check) {
     if (precomputed_vertex_out_weight_sums) {
@@ -117,7 +283,10 @@ centrality_algorithm_metadata_t pagerank(
                    edge_src_dummy_property_t{}.view(),
                    edge_dst_dummy_property_t{}.view(),
                    *edge_weight_view,
-                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+                   [edge_weight_decoder] __device__(
+                     vertex_t, vertex_t, auto, auto, edge_weight_storage_t w) {
+                     return edge_weight_decoder(w) < 0.0;
+                   });
       CUGRAPH_EXPECTS(
         num_negative_edge_weights == 0,
         "Invalid input argument: input edge weights should have non-negative values.");
@@ -191,8 +360,26 @@ centrality_algorithm_metadata_t pagerank(
   std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
   if (!precomputed_vertex_out_weight_sums) {
     if (edge_weight_view) {
-      tmp_vertex_out_weight_sums =
-        compute_out_weight_sums(handle, pull_graph_view, *edge_weight_view);
+      if constexpr (std::is_same_v<edge_weight_storage_t, weight_t>) {
+        tmp_vertex_out_weight_sums =
+          compute_out_weight_sums(handle, pull_graph_view, *edge_weight_view);
+      } else {
+        tmp_vertex_out_weight_sums = rmm::device_uvector<weight_t>(
+          pull_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+        per_v_transform_reduce_outgoing_e(
+          handle,
+          pull_graph_view,
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
+          *edge_weight_view,
+          [edge_weight_decoder] __device__(
+            vertex_t, vertex_t, auto, auto, edge_weight_storage_t w) {
+            return static_cast<weight_t>(edge_weight_decoder(w));
+          },
+          weight_t{0.0},
+          reduce_op::plus<weight_t>{},
+          (*tmp_vertex_out_weight_sums).data());
+      }
     } else {
       auto tmp_vertex_out_degrees = pull_graph_view.compute_out_degrees(handle);
       tmp_vertex_out_weight_sums =
@@ -230,112 +417,679 @@ centrality_algorithm_metadata_t pagerank(
   // old PageRank values
   rmm::device_uvector<result_t> old_pageranks(pull_graph_view.local_vertex_partition_range_size(),
                                               handle.get_stream());
-  edge_src_property_t<GraphViewType, result_t> edge_src_pageranks(handle, pull_graph_view);
-  size_t iter{0};
+
+  auto scale_op = [] __device__(auto val) {
+    auto const pagerank       = thrust::get<0>(val);
+    auto const out_weight_sum = thrust::get<1>(val);
+    auto const divisor = out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
+    return pagerank / divisor;
+  };
+
+  // with reduced precision messages, the scaled PageRank values are multiplied by message_scale (a
+  // power of two keeping the largest value at max_half_pagerank_message) and cached in
+  // edge_src_half_pageranks, until the iteration stops improving at that precision
+  bool low_precision = schedule.message_precision.has_value();
+  edge_src_property_t<GraphViewType, result_t> edge_src_pageranks(handle);
+  edge_src_property_t<GraphViewType, uint16_t> edge_src_half_pageranks(handle);
+  std::optional<rmm::device_uvector<uint16_t>> half_scaled_pageranks{std::nullopt};
+  result_t message_scale{0.0};
+  auto low_precision_tolerance =
+    schedule.message_precision
+      ? (*(schedule.message_precision) == half_precision_t::float16 ? result_t{1.0 / 2048.0}
+                                                                     : result_t{1.0 / 256.0})
+      : result_t{0.0};
+  auto last_low_precision_diff_sum = std::numeric_limits<result_t>::max();
+  if (low_precision) {
+    edge_src_half_pageranks = edge_src_property_t<GraphViewType, uint16_t>(handle, pull_graph_view);
+    half_scaled_pageranks =
+      rmm::device_uvector<uint16_t>(pageranks.size(), handle.get_stream());
+  } else {
+    edge_src_pageranks = edge_src_property_t<GraphViewType, result_t>(handle, pull_graph_view);
+  }
+
+  // block Gauss-Seidel iteration: the blocks are updated one after another, and the scaled PageRank
+  // values of a block are pushed to the edge source values right after the block is updated
+  std::optional<rmm::device_uvector<vertex_t>> local_vertices{std::nullopt};
+  std::optional<rmm::device_uvector<result_t>> scaled_pageranks{std::nullopt};
+  if (schedule.num_blocks > 1) {
+    local_vertices = rmm::device_uvector<vertex_t>(
+      pull_graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    detail::sequence_fill(handle.get_stream(),
+                          local_vertices->data(),
+                          local_vertices->size(),
+                          pull_graph_view.local_vertex_partition_range_first());
+    scaled_pageranks =
+      rmm::device_uvector<result_t>(local_vertices->size(), handle.get_stream());
+  }
+  bool edge_src_stale{true};  // whether the edge source values should be pushed for every vertex
+
+  // the dangling sum of the next iteration is reduced together with the convergence check's
+  // difference sum (both from the updated PageRank values) in a single collective call
+  std::optional<result_t> next_dangling_sum{std::nullopt};
+
+  // a resumed run continues the iteration count of the checkpointed run (pageranks holds the
+  // checkpointed values)
+  size_t iter{num_resumed_iterations};
+  bool stopped_early{false};  // by the progress callback
   while (true) {
-    thrust::copy(
-      handle.get_thrust_policy(), pageranks.begin(), pageranks.end(), old_pageranks.data());
-
-    auto dangling_sum = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
-      [] __device__(auto, auto val) {
-        auto const pagerank       = thrust::get<0>(val);
-        auto const out_weight_sum = thrust::get<1>(val);
-        return out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0};
-      },
-      result_t{0.0});
-
-    thrust::transform(
-      handle.get_thrust_policy(),
-      thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
-      thrust::make_zip_iterator(
-        pageranks.end(),
-        vertex_out_weight_sums + pull_graph_view.local_vertex_partition_range_size()),
-      pageranks.begin(),
-      [] __device__(auto val) {
-        auto const pagerank       = thrust::get<0>(val);
-        auto const out_weight_sum = thrust::get<1>(val);
-        auto const divisor = out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
-        return pagerank / divisor;
-      });
-
-    update_edge_src_property(
-      handle, pull_graph_view, pageranks.data(), edge_src_pageranks.mutable_view());
+    auto check_convergence = ((iter + 1) % schedule.convergence_check_interval == 0) ||
+                             (iter + 1 >= max_iterations);
+    if (check_convergence) {
+      thrust::copy(
+        handle.get_thrust_policy(), pageranks.begin(), pageranks.end(), old_pageranks.data());
+    }
+
+    auto dangling_sum = next_dangling_sum
+                          ? *next_dangling_sum
+                          : transform_reduce_v(
+                              handle,
+                              pull_graph_view,
+                              thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
+                              [] __device__(auto, auto val) {
+                                auto const pagerank       = thrust::get<0>(val);
+                                auto const out_weight_sum = thrust::get<1>(val);
+                                return out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0};
+                              },
+                              result_t{0.0});
+    next_dangling_sum = std::nullopt;
+
+    if (low_precision) {
+      auto max_scaled_pagerank =
+        transform_reduce_v(handle,
+                           pull_graph_view,
+                           thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
+                           [scale_op] __device__(auto, auto val) { return scale_op(val); },
+                           result_t{0.0},
+                           reduce_op::maximum<result_t>{});
+      auto new_message_scale =
+        max_scaled_pagerank > result_t{0.0}
+          ? std::exp2(std::floor(
+              std::log2(max_half_pagerank_message<result_t> / max_scaled_pagerank)))
+          : result_t{1.0};
+      if (new_message_scale != message_scale) {
+        message_scale  = new_message_scale;
+        edge_src_stale = true;
+      }
+    }
+
+    if (!local_vertices || edge_src_stale) {
+      if (low_precision) {
+        auto encode_op = encode_half_pagerank_message_t<result_t>{*(schedule.message_precision),
+                                                                  message_scale};
+        thrust::transform(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
+          thrust::make_zip_iterator(pageranks.end(), vertex_out_weight_sums + pageranks.size()),
+          half_scaled_pageranks->begin(),
+          [scale_op, encode_op] __device__(auto val) { return encode_op(scale_op(val)); });
+        update_edge_src_property(handle,
+                                 pull_graph_view,
+                                 half_scaled_pageranks->data(),
+                                 edge_src_half_pageranks.mutable_view());
+      } else {
+        // in the Jacobi iteration, the PageRank values are scaled in place (the values are
+        // overwritten by the update)
+        auto scaled_first = local_vertices ? scaled_pageranks->data() : pageranks.data();
+        thrust::transform(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(pageranks.begin(), vertex_out_weight_sums),
+          thrust::make_zip_iterator(pageranks.end(), vertex_out_weight_sums + pageranks.size()),
+          scaled_first,
+          scale_op);
+        update_edge_src_property(
+          handle, pull_graph_view, scaled_first, edge_src_pageranks.mutable_view());
+      }
+      edge_src_stale = false;
+    }
 
     auto unvarying_part = aggregate_personalization_vector_size == 0
                             ? (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
                                 static_cast<result_t>(num_vertices)
                             : result_t{0.0};
 
-    if (edge_weight_view) {
-      per_v_transform_reduce_incoming_e(
-        handle,
-        pull_graph_view,
-        edge_src_pageranks.view(),
-        edge_dst_dummy_property_t{}.view(),
-        *edge_weight_view,
-        [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, weight_t w) {
-          return src_val * w * alpha;
-        },
-        unvarying_part,
-        reduce_op::plus<result_t>{},
-        pageranks.begin());
-    } else {
-      per_v_transform_reduce_incoming_e(
+    for (size_t i = 0; i < schedule.num_blocks; ++i) {
+      auto block_first = (pageranks.size() * i) / schedule.num_blocks;
+      auto block_last  = (pageranks.size() * (i + 1)) / schedule.num_blocks;
+
+      auto block_vertices =
+        local_vertices ? std::make_optional(raft::device_span<vertex_t const>(
+                           local_vertices->data() + block_first, block_last - block_first))
+                       : std::nullopt;
+      if (low_precision) {
+        pagerank_pull(handle,
+                      pull_graph_view,
+                      block_vertices,
+                      edge_src_half_pageranks.view(),
+                      decode_half_pagerank_message_t<result_t>{
+                        half_edge_weight_decoder_t{*(schedule.message_precision)},
+                        result_t{1.0} / message_scale},
+                      edge_weight_view,
+                      edge_weight_decoder,
+                      alpha,
+                      unvarying_part,
+                      pageranks.data() + block_first);
+      } else {
+        pagerank_pull(handle,
+                      pull_graph_view,
+                      block_vertices,
+                      edge_src_pageranks.view(),
+                      detail::typecast_t<result_t, result_t>{},
+                      edge_weight_view,
+                      edge_weight_decoder,
+                      alpha,
+                      unvarying_part,
+                      pageranks.data() + block_first);
+      }
+
+      if (aggregate_personalization_vector_size > 0) {
+        auto vertex_partition =
+          vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+            pull_graph_view.local_vertex_partition_view());
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(thrust::make_tuple(std::get<0>(*personalization).begin(),
+                                                       std::get<1>(*personalization).begin())),
+          thrust::make_zip_iterator(thrust::make_tuple(std::get<0>(*personalization).end(),
+                                                       std::get<1>(*personalization).end())),
+          [vertex_partition,
+           pageranks = pageranks.data(),
+           dangling_sum,
+           personalization_sum,
+           alpha,
+           block_first,
+           block_last] __device__(auto val) {
+            auto v      = thrust::get<0>(val);
+            auto value  = thrust::get<1>(val);
+            auto offset = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+            if ((static_cast<size_t>(offset) >= block_first) &&
+                (static_cast<size_t>(offset) < block_last)) {
+              *(pageranks + offset) += (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
+                                       (value / personalization_sum);
+            }
+          });
+      }
+
+      if (local_vertices) {
+        auto pagerank_first = thrust::make_zip_iterator(pageranks.begin() + block_first,
+                                                        vertex_out_weight_sums + block_first);
+        auto pagerank_last  = thrust::make_zip_iterator(pageranks.begin() + block_last,
+                                                       vertex_out_weight_sums + block_last);
+        if (low_precision) {
+          auto encode_op = encode_half_pagerank_message_t<result_t>{*(schedule.message_precision),
+                                                                    message_scale};
+          thrust::transform(
+            handle.get_thrust_policy(),
+            pagerank_first,
+            pagerank_last,
+            half_scaled_pageranks->begin() + block_first,
+            [scale_op, encode_op] __device__(auto val) { return encode_op(scale_op(val)); });
+          update_edge_src_property(handle,
+                                   pull_graph_view,
+                                   local_vertices->begin() + block_first,
+                                   local_vertices->begin() + block_last,
+                                   half_scaled_pageranks->data(),
+                                   edge_src_half_pageranks.mutable_view());
+        } else {
+          thrust::transform(handle.get_thrust_policy(),
+                            pagerank_first,
+                            pagerank_last,
+                            scaled_pageranks->begin() + block_first,
+                            scale_op);
+          update_edge_src_property(handle,
+                                   pull_graph_view,
+                                   local_vertices->begin() + block_first,
+                                   local_vertices->begin() + block_last,
+                                   scaled_pageranks->data(),
+                                   edge_src_pageranks.mutable_view());
+        }
+      }
+    }
+
+    iter++;
+
+    if (checkpoint_options.callback && (iter % checkpoint_options.iteration_interval == 0)) {
+      checkpoint_options.callback(
+        iter, raft::device_span<result_t const>{pageranks.data(), pageranks.size()});
+    }
+
+    iteration_progress_t progress{};
+    progress.algorithm = "pagerank";
+    if (check_convergence) {
+      auto sums = transform_reduce_v(
         handle,
         pull_graph_view,
-        edge_src_pageranks.view(),
-        edge_dst_dummy_property_t{}.view(),
-        edge_dummy_property_t{}.view(),
-        [alpha] __device__(vertex_t, vertex_t, auto src_val, auto, auto) {
-          return src_val * alpha;
+        thrust::make_zip_iterator(pageranks.begin(), old_pageranks.begin(), vertex_out_weight_sums),
+        [] __device__(auto, auto val) {
+          auto const pagerank       = thrust::get<0>(val);
+          auto const out_weight_sum = thrust::get<2>(val);
+          return thrust::make_tuple(std::abs(pagerank - thrust::get<1>(val)),
+                                    out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0});
         },
-        unvarying_part,
-        reduce_op::plus<result_t>{},
-        pageranks.begin());
+        thrust::make_tuple(result_t{0.0}, result_t{0.0}));
+      auto diff_sum     = thrust::get<0>(sums);
+      next_dangling_sum = thrust::get<1>(sums);
+      progress.residual = static_cast<double>(diff_sum);
+      if (low_precision) {
+        // switch to full precision once the differences reach the rounding error of the messages
+        // or stop decreasing
+        if ((diff_sum < std::max(epsilon, low_precision_tolerance)) ||
+            (diff_sum >= last_low_precision_diff_sum)) {
+          low_precision           = false;
+          edge_src_half_pageranks = edge_src_property_t<GraphViewType, uint16_t>(handle);
+          half_scaled_pageranks   = std::nullopt;
+          edge_src_pageranks =
+            edge_src_property_t<GraphViewType, result_t>(handle, pull_graph_view);
+          edge_src_stale = true;
+        }
+        last_low_precision_diff_sum = diff_sum;
+      } else if (diff_sum < epsilon) {
+        break;
+      }
     }
+    if (iter >= max_iterations) { break; }
 
-    if (aggregate_personalization_vector_size > 0) {
-      auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-        pull_graph_view.local_vertex_partition_view());
-      thrust::for_each(
-        handle.get_thrust_policy(),
-        thrust::make_zip_iterator(thrust::make_tuple(std::get<0>(*personalization).begin(),
-                                                     std::get<1>(*personalization).begin())),
-        thrust::make_zip_iterator(thrust::make_tuple(std::get<0>(*personalization).end(),
-                                                     std::get<1>(*personalization).end())),
-        [vertex_partition,
-         pageranks = pageranks.data(),
-         dangling_sum,
-         personalization_sum,
-         alpha] __device__(auto val) {
-          auto v     = thrust::get<0>(val);
-          auto value = thrust::get<1>(val);
-          *(pageranks + vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v)) +=
-            (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
-            (value / personalization_sum);
-        });
+    progress.iteration = iter;
+    if (detail::report_progress(handle, progress, GraphViewType::is_multi_gpu)) {
+      stopped_early = true;
+      break;
     }
+  }
 
-    auto diff_sum = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(pageranks.begin(), old_pageranks.begin())),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
+  return centrality_algorithm_metadata_t{iter, !stopped_early && (iter < max_iterations)};
+}
 
-    iter++;
+// next iterate of column k (of the [V x K] row-major scores) at vertex v, pulled over the
+// in-coming edges of v, the scores of the converged columns are carried over
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+struct batched_pagerank_spmm_op_t {
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition{};
+  weight_t const* edge_weights{nullptr};
+  raft::device_span<result_t const> inv_out_weight_sums{};
+  raft::device_span<result_t const> pageranks{};
+  raft::device_span<result_t> new_pageranks{};
+  raft::device_span<bool const> converged{};
+  size_t batch_size{};
+  result_t alpha{};
 
-    if (diff_sum < epsilon) {
-      break;
-    } else if (iter >= max_iterations) {
-      break;
+  __device__ void operator()(size_t i) const
+  {
+    auto k = i % batch_size;
+    if (converged[k]) {
+      new_pageranks[i] = pageranks[i];
+      return;
+    }
+
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) =
+      edge_partition.local_edges(static_cast<vertex_t>(i / batch_size));
+    result_t sum{0.0};
+    for (edge_t j = 0; j < local_degree; ++j) {
+      auto u = indices[j];
+      auto w = edge_weights != nullptr ? static_cast<result_t>(edge_weights[edge_offset + j])
+                                       : result_t{1.0};
+      sum += pageranks[static_cast<size_t>(u) * batch_size + k] * inv_out_weight_sums[u] * w;
+    }
+    new_pageranks[i] = sum * alpha;
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct batched_pagerank_dangling_sum_op_t {
+  raft::device_span<vertex_t const> dangling_vertices{};
+  raft::device_span<result_t const> pageranks{};
+  raft::device_span<bool const> converged{};
+  raft::device_span<result_t> dangling_sums{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = i % batch_size;
+    if (converged[k]) { return; }
+    auto v = dangling_vertices[i / batch_size];
+    cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(dangling_sums[k]);
+    sum.fetch_add(pageranks[static_cast<size_t>(v) * batch_size + k],
+                  cuda::std::memory_order_relaxed);
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct batched_pagerank_personalization_op_t {
+  raft::device_span<vertex_t const> vertices{};
+  raft::device_span<result_t const> values{};
+  raft::device_span<size_t const> columns{};
+  raft::device_span<result_t const> sums{};
+  raft::device_span<bool const> converged{};
+  raft::device_span<result_t const> dangling_sums{};
+  raft::device_span<result_t> new_pageranks{};
+  size_t batch_size{};
+  result_t alpha{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = columns[i];
+    if (converged[k]) { return; }
+    new_pageranks[static_cast<size_t>(vertices[i]) * batch_size + k] +=
+      (dangling_sums[k] * alpha + static_cast<result_t>(1.0 - alpha)) * (values[i] / sums[k]);
+  }
+};
+
+template <typename result_t>
+struct batched_pagerank_diff_sum_op_t {
+  raft::device_span<result_t const> pageranks{};
+  raft::device_span<result_t const> new_pageranks{};
+  raft::device_span<bool const> converged{};
+  raft::device_span<result_t> diff_sums{};
+  size_t batch_size{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto k = i % batch_size;
+    if (converged[k]) { return; }
+    cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(diff_sums[k]);
+    sum.fetch_add(std::abs(new_pageranks[i] - pageranks[i]), cuda::std::memory_order_relaxed);
+  }
+};
+
+template <typename result_t>
+struct batched_pagerank_update_converged_op_t {
+  result_t epsilon{};
+
+  __device__ bool operator()(bool c, result_t diff_sum) const
+  {
+    return c || (diff_sum < epsilon);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<vertex_t const> personalization_vertices,
+  raft::device_span<result_t const> personalization_values,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
+{
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS((schedule.num_blocks == 1) && !schedule.message_precision, "unimplemented.");
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(personalization_offsets.size() >= 2,
+                  "Invalid input argument: there should be at least one personalization vector.");
+  CUGRAPH_EXPECTS(personalization_vertices.size() == personalization_values.size(),
+                  "Invalid input argument: the size of personalization vertices and values "
+                  "should match.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(
+    schedule.convergence_check_interval > 0,
+    "Invalid input argument: schedule.convergence_check_interval should be positive.");
+
+  auto const batch_size = personalization_offsets.size() - 1;
+
+  std::vector<size_t> h_offset_bounds(2);
+  raft::update_host(
+    h_offset_bounds.data(), personalization_offsets.data(), 1, handle.get_stream());
+  raft::update_host(h_offset_bounds.data() + 1,
+                    personalization_offsets.data() + batch_size,
+                    1,
+                    handle.get_stream());
+  handle.sync_stream();
+  CUGRAPH_EXPECTS(
+    (h_offset_bounds[0] == 0) && (h_offset_bounds[1] == personalization_vertices.size()),
+    "Invalid input argument: personalization offsets should start at 0 and end at the number of "
+    "personalization vertices.");
+
+  rmm::device_uvector<result_t> pageranks(0, handle.get_stream());
+  if (num_vertices == 0) {
+    return std::make_tuple(std::move(pageranks), centrality_algorithm_metadata_t{0, true});
+  }
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(),
+                                      personalization_offsets.begin(),
+                                      personalization_offsets.end()),
+                    "Invalid input argument: personalization offsets should be sorted.");
+    auto num_invalid_vertices = thrust::count_if(
+      handle.get_thrust_policy(),
+      personalization_vertices.begin(),
+      personalization_vertices.end(),
+      [num_vertices] __device__(auto v) { return (v < 0) || (v >= num_vertices); });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: personalization vertices have invalid vertex IDs.");
+    auto num_negative_values = thrust::count_if(handle.get_thrust_policy(),
+                                                personalization_values.begin(),
+                                                personalization_values.end(),
+                                                [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: personalization values should be non-negative.");
+  }
+
+  // 2. compute the inverses of the sums of the out-going edge weights
+
+  std::optional<rmm::device_uvector<weight_t>> tmp_vertex_out_weight_sums{std::nullopt};
+  if (!precomputed_vertex_out_weight_sums) {
+    if (edge_weight_view) {
+      tmp_vertex_out_weight_sums = compute_out_weight_sums(handle, graph_view, *edge_weight_view);
+    } else {
+      auto tmp_vertex_out_degrees = graph_view.compute_out_degrees(handle);
+      tmp_vertex_out_weight_sums =
+        rmm::device_uvector<weight_t>(tmp_vertex_out_degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        tmp_vertex_out_degrees.begin(),
+                        tmp_vertex_out_degrees.end(),
+                        (*tmp_vertex_out_weight_sums).begin(),
+                        detail::typecast_t<edge_t, weight_t>{});
+    }
+  }
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums
+                                  ? (*precomputed_vertex_out_weight_sums).data()
+                                  : (*tmp_vertex_out_weight_sums).data();
+
+  rmm::device_uvector<result_t> inv_out_weight_sums(num_vertices, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    vertex_out_weight_sums,
+                    vertex_out_weight_sums + num_vertices,
+                    inv_out_weight_sums.begin(),
+                    [] __device__(auto val) {
+                      return val == weight_t{0.0} ? result_t{1.0}
+                                                  : result_t{1.0} / static_cast<result_t>(val);
+                    });
+
+  rmm::device_uvector<vertex_t> dangling_vertices(num_vertices, handle.get_stream());
+  dangling_vertices.resize(
+    thrust::distance(dangling_vertices.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(vertex_t{0}),
+                                     thrust::make_counting_iterator(num_vertices),
+                                     dangling_vertices.begin(),
+                                     [vertex_out_weight_sums] __device__(auto v) {
+                                       return vertex_out_weight_sums[v] == weight_t{0.0};
+                                     })),
+    handle.get_stream());
+
+  // 3. sum the values of each personalization vector
+
+  rmm::device_uvector<size_t> personalization_columns(personalization_vertices.size(),
+                                                      handle.get_stream());
+  thrust::upper_bound(handle.get_thrust_policy(),
+                      personalization_offsets.begin() + 1,
+                      personalization_offsets.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(personalization_vertices.size()),
+                      personalization_columns.begin());
+
+  rmm::device_uvector<result_t> personalization_sums(batch_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               personalization_sums.begin(),
+               personalization_sums.end(),
+               result_t{0.0});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(personalization_values.size()),
+    [columns = personalization_columns.data(),
+     values  = personalization_values.data(),
+     sums    = personalization_sums.data()] __device__(size_t i) {
+      cuda::atomic_ref<result_t, cuda::thread_scope_device> sum(sums[columns[i]]);
+      sum.fetch_add(values[i], cuda::std::memory_order_relaxed);
+    });
+  CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                   personalization_sums.begin(),
+                                   personalization_sums.end(),
+                                   [] __device__(auto sum) { return !(sum > 0.0); }) == 0,
+                  "Invalid input argument: sum of the values of every personalization vector "
+                  "should be positive.");
+
+  // 4. pagerank iteration, the K columns are updated together until they converge
+
+  auto const num_elements = static_cast<size_t>(num_vertices) * batch_size;
+
+  pageranks.resize(num_elements, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               pageranks.begin(),
+               pageranks.end(),
+               result_t{1.0} / static_cast<result_t>(num_vertices));
+  rmm::device_uvector<result_t> new_pageranks(num_elements, handle.get_stream());
+
+  rmm::device_uvector<bool> converged(batch_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), converged.begin(), converged.end(), false);
+  rmm::device_uvector<result_t> dangling_sums(batch_size, handle.get_stream());
+  rmm::device_uvector<result_t> diff_sums(batch_size, handle.get_stream());
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+
+  // an iteration neither synchronizes the stream nor allocates memory (so it can be captured in a
+  // CUDA graph), the columns converged in an iteration are carried over in the next iterations
+
+  auto run_iteration = [&](rmm::cuda_stream_view stream_view,
+                           raft::device_span<result_t const> old_scores,
+                           raft::device_span<result_t> new_scores) {
+    thrust::fill(
+      rmm::exec_policy_nosync(stream_view), dangling_sums.begin(), dangling_sums.end(), 0.0);
+    thrust::for_each(rmm::exec_policy_nosync(stream_view),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(dangling_vertices.size() * batch_size),
+                     batched_pagerank_dangling_sum_op_t<vertex_t, result_t>{
+                       raft::device_span<vertex_t const>{dangling_vertices.data(),
+                                                         dangling_vertices.size()},
+                       old_scores,
+                       raft::device_span<bool const>{converged.data(), converged.size()},
+                       raft::device_span<result_t>{dangling_sums.data(), dangling_sums.size()},
+                       batch_size});
+
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_elements),
+      batched_pagerank_spmm_op_t<vertex_t, edge_t, weight_t, result_t>{
+        edge_partition,
+        edge_weight_view ? (*edge_weight_view).value_firsts()[0] : nullptr,
+        raft::device_span<result_t const>{inv_out_weight_sums.data(), inv_out_weight_sums.size()},
+        old_scores,
+        new_scores,
+        raft::device_span<bool const>{converged.data(), converged.size()},
+        batch_size,
+        alpha});
+
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(personalization_vertices.size()),
+      batched_pagerank_personalization_op_t<vertex_t, result_t>{
+        personalization_vertices,
+        personalization_values,
+        raft::device_span<size_t const>{personalization_columns.data(),
+                                        personalization_columns.size()},
+        raft::device_span<result_t const>{personalization_sums.data(),
+                                          personalization_sums.size()},
+        raft::device_span<bool const>{converged.data(), converged.size()},
+        raft::device_span<result_t const>{dangling_sums.data(), dangling_sums.size()},
+        new_scores,
+        batch_size,
+        alpha});
+
+    thrust::fill(rmm::exec_policy_nosync(stream_view), diff_sums.begin(), diff_sums.end(), 0.0);
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_elements),
+      batched_pagerank_diff_sum_op_t<result_t>{
+        old_scores,
+        new_scores,
+        raft::device_span<bool const>{converged.data(), converged.size()},
+        raft::device_span<result_t>{diff_sums.data(), diff_sums.size()},
+        batch_size});
+
+    thrust::transform(rmm::exec_policy_nosync(stream_view),
+                      converged.begin(),
+                      converged.end(),
+                      diff_sums.begin(),
+                      converged.begin(),
+                      batched_pagerank_update_converged_op_t<result_t>{epsilon});
+  };
+
+  // scores[curr] holds the latest scores, with use_cuda_graph, an even number of iterations (so the
+  // latest scores end in the starting buffer) between two convergence checks are captured once per
+  // starting buffer and replayed with a single launch, the remaining iteration runs eagerly
+
+  std::array<result_t*, 2> scores{pageranks.data(), new_pageranks.data()};
+  size_t curr{0};
+  auto run_iterations = [&](rmm::cuda_stream_view stream_view, size_t num_iterations) {
+    for (size_t i = 0; i < num_iterations; ++i) {
+      run_iteration(stream_view,
+                    raft::device_span<result_t const>{scores[curr], num_elements},
+                    raft::device_span<result_t>{scores[1 - curr], num_elements});
+      curr = 1 - curr;
+    }
+  };
+  auto const num_graph_iterations =
+    schedule.use_cuda_graph ? (schedule.convergence_check_interval / 2) * 2 : size_t{0};
+  std::array<std::optional<cuda_graph_t>, 2> graphs{};
+
+  size_t iter{0};
+  size_t num_unconverged{batch_size};
+  while ((num_unconverged > 0) && (iter < max_iterations)) {
+    auto num_iterations = std::min(schedule.convergence_check_interval, max_iterations - iter);
+    auto num_replayed_iterations =
+      ((num_graph_iterations > 0) && (num_iterations >= num_graph_iterations))
+        ? num_graph_iterations
+        : size_t{0};
+    if (num_replayed_iterations > 0) {
+      if (!graphs[curr]) {
+        graphs[curr].emplace(handle.get_stream(), [&](rmm::cuda_stream_view stream_view) {
+          run_iterations(stream_view, num_graph_iterations);
+        });
+      }
+      graphs[curr]->launch(handle.get_stream());
     }
+    run_iterations(handle.get_stream(), num_iterations - num_replayed_iterations);
+    iter += num_iterations;
+
+    num_unconverged = static_cast<size_t>(
+      thrust::count(handle.get_thrust_policy(), converged.begin(), converged.end(), false));
   }
 
-  return centrality_algorithm_metadata_t{iter, (iter < max_iterations)};
+  if (curr != 0) { pageranks.swap(new_pageranks); }
+
+  return std::make_tuple(std::move(pageranks),
+                         centrality_algorithm_metadata_t{iter, num_unconverged == 0});
 }
 
 }  // namespace detail
@@ -390,6 +1144,7 @@ void pagerank(raft::handle_t const& handle,
     handle,
     graph_view,
     edge_weight_view,
+    detail::typecast_t<weight_t, weight_t>{},
     precomputed_vertex_out_weight_sums
       ? std::make_optional(raft::device_span<weight_t const>{
           *precomputed_vertex_out_weight_sums,
@@ -424,8 +1179,45 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
   result_t alpha,
   result_t epsilon,
   size_t max_iterations,
-  bool do_expensive_check)
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
+{
+  return pagerank(handle,
+                  graph_view,
+                  edge_weight_view,
+                  precomputed_vertex_out_weight_sums,
+                  personalization,
+                  initial_pageranks,
+                  alpha,
+                  epsilon,
+                  max_iterations,
+                  pagerank_checkpoint_options_t<result_t>{},
+                  size_t{0},
+                  do_expensive_check,
+                  schedule);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>>
+    personalization,
+  std::optional<raft::device_span<result_t const>> initial_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  pagerank_checkpoint_options_t<result_t> const& checkpoint_options,
+  size_t num_resumed_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
 {
+  CUGRAPH_EXPECTS((num_resumed_iterations == 0) || initial_pageranks.has_value(),
+                  "Invalid input argument: initial_pageranks should be set (to the checkpointed "
+                  "values) if num_resumed_iterations > 0.");
+
   rmm::device_uvector<result_t> local_pageranks(graph_view.local_vertex_partition_range_size(),
                                                 handle.get_stream());
   if (!initial_pageranks) {
@@ -444,6 +1236,60 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
     detail::pagerank(handle,
                      graph_view,
                      edge_weight_view,
+                     detail::typecast_t<weight_t, weight_t>{},
+                     precomputed_vertex_out_weight_sums,
+                     personalization,
+                     raft::device_span<result_t>{local_pageranks.data(), local_pageranks.size()},
+                     alpha,
+                     epsilon,
+                     max_iterations,
+                     do_expensive_check,
+                     schedule,
+                     num_resumed_iterations,
+                     checkpoint_options);
+
+  return std::make_tuple(std::move(local_pageranks), metadata);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_weight_storage_t,
+          typename EdgeWeightDecoder,
+          typename result_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_weight_storage_t const*> encoded_edge_weight_view,
+  EdgeWeightDecoder edge_weight_decoder,
+  std::optional<raft::device_span<result_t const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<vertex_t const>, raft::device_span<result_t const>>>
+    personalization,
+  std::optional<raft::device_span<result_t const>> initial_pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  rmm::device_uvector<result_t> local_pageranks(graph_view.local_vertex_partition_range_size(),
+                                                handle.get_stream());
+  if (!initial_pageranks) {
+    thrust::fill(handle.get_thrust_policy(),
+                 local_pageranks.begin(),
+                 local_pageranks.end(),
+                 result_t{1.0} / graph_view.number_of_vertices());
+  } else {
+    thrust::copy(handle.get_thrust_policy(),
+                 initial_pageranks->begin(),
+                 initial_pageranks->end(),
+                 local_pageranks.begin());
+  }
+
+  auto metadata =
+    detail::pagerank(handle,
+                     graph_view,
+                     std::make_optional(encoded_edge_weight_view),
+                     edge_weight_decoder,
                      precomputed_vertex_out_weight_sums,
                      personalization,
                      raft::device_span<result_t>{local_pageranks.data(), local_pageranks.size()},
@@ -455,4 +1301,34 @@ std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t> pager
   return std::make_tuple(std::move(local_pageranks), metadata);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::tuple<rmm::device_uvector<result_t>, centrality_algorithm_metadata_t>
+batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<weight_t const>> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<vertex_t const> personalization_vertices,
+  raft::device_span<result_t const> personalization_values,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule)
+{
+  return detail::batched_personalized_pagerank(handle,
+                                               graph_view,
+                                               edge_weight_view,
+                                               precomputed_vertex_out_weight_sums,
+                                               personalization_offsets,
+                                               personalization_vertices,
+                                               personalization_values,
+                                               alpha,
+                                               epsilon,
+                                               max_iterations,
+                                               do_expensive_check,
+                                               schedule);
+}
+
 }  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -57,7 +57,38 @@ template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t>
   float alpha,
   float epsilon,
   size_t max_iterations,
-  bool do_expensive_check);
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<float const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<int32_t const>, raft::device_span<float const>>>
+    personalization,
+  std::optional<raft::device_span<float const>> initial_pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  pagerank_checkpoint_options_t<float> const& checkpoint_options,
+  size_t num_resumed_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<double const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<int32_t const>, raft::device_span<double const>>>
+    personalization,
+  std::optional<raft::device_span<double const>> initial_pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
 
 template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t> pagerank(
   raft::handle_t const& handle,
@@ -70,6 +101,67 @@ template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t
   double alpha,
   double epsilon,
   size_t max_iterations,
+  pagerank_checkpoint_options_t<double> const& checkpoint_options,
+  size_t num_resumed_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_view_t<int32_t, uint16_t const*> encoded_edge_weight_view,
+  half_edge_weight_decoder_t edge_weight_decoder,
+  std::optional<raft::device_span<float const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<int32_t const>, raft::device_span<float const>>>
+    personalization,
+  std::optional<raft::device_span<float const>> initial_pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t> pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  edge_property_view_t<int32_t, uint8_t const*> encoded_edge_weight_view,
+  uint8_edge_weight_decoder_t edge_weight_decoder,
+  std::optional<raft::device_span<float const>> precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<raft::device_span<int32_t const>, raft::device_span<float const>>>
+    personalization,
+  std::optional<raft::device_span<float const>> initial_pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<float>, centrality_algorithm_metadata_t>
+batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<float const>> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<int32_t const> personalization_vertices,
+  raft::device_span<float const> personalization_values,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
+template std::tuple<rmm::device_uvector<double>, centrality_algorithm_metadata_t>
+batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<double const>> precomputed_vertex_out_weight_sums,
+  raft::device_span<size_t const> personalization_offsets,
+  raft::device_span<int32_t const> personalization_vertices,
+  raft::device_span<double const> personalization_values,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check,
+  centrality_iteration_schedule_t schedule);
+
 }  // namespace cugraph
@@ -0,0 +1,795 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "link_prediction/similarity_impl.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/misc_utils.cuh>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// the hash table of a seed item has this many slots per unit of its two-hop degree (an upper bound
+// of the number of its distinct two-hop neighbors) to keep the probe sequences short
+constexpr size_t bipartite_projection_hash_table_size_multiplier = 2;
+
+template <typename vertex_t>
+__device__ size_t bipartite_projection_hash(vertex_t v, size_t capacity)
+{
+  auto h = static_cast<uint64_t>(v) * uint64_t{0x9e3779b97f4a7c15};
+  return static_cast<size_t>(h ^ (h >> 32)) % capacity;
+}
+
+template <typename vertex_t, typename edge_t>
+struct bipartite_projection_local_degree_t {
+  raft::device_span<edge_t const> offsets{};  // local vertex partition range size + 1
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ size_t operator()(vertex_t v) const
+  {
+    auto idx = v - local_vertex_partition_range_first;
+    return static_cast<size_t>(offsets[idx + 1] - offsets[idx]);
+  }
+};
+
+// sum of the neighbor degrees of every local vertex, this is the number of (seed, two-hop
+// neighbor) contributions of a seed (with multiplicity, self contributions included)
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<size_t> compute_bipartite_projection_two_hop_degrees(
+  raft::handle_t const& handle, graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  auto degrees = graph_view.compute_out_degrees(handle);
+
+  edge_dst_property_t<GraphViewType, edge_t> edge_dst_degrees(handle, graph_view);
+  update_edge_dst_property(handle, graph_view, degrees.begin(), edge_dst_degrees.mutable_view());
+
+  rmm::device_uvector<size_t> two_hop_degrees(graph_view.local_vertex_partition_range_size(),
+                                              handle.get_stream());
+  per_v_transform_reduce_outgoing_e(
+    handle,
+    graph_view,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_degrees.view(),
+    edge_dummy_property_t{}.view(),
+    [] __device__(vertex_t, vertex_t, auto, auto dst_degree, auto) {
+      return static_cast<size_t>(dst_degree);
+    },
+    size_t{0},
+    reduce_op::plus<size_t>{},
+    two_hop_degrees.begin());
+
+  return two_hop_degrees;
+}
+
+// in multi-GPU, the local edge partitions hold only the edges of the local minor range, the full
+// neighbor lists of the local vertices are gathered (one extra copy of the local edges) so a user
+// can pair every item in its neighbor list
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<edge_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+build_bipartite_projection_local_adjacency(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view)
+{
+  auto& comm                 = handle.get_comms();
+  auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+  auto const major_comm_size = major_comm.get_size();
+  auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+  auto const minor_comm_size = minor_comm.get_size();
+
+  auto [srcs, dsts, wgts, ids, types] =
+    decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t, false, true>(
+      handle, graph_view, edge_weight_view, std::nullopt, std::nullopt, std::nullopt);
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+    graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+  raft::update_device(d_vertex_partition_range_lasts.data(),
+                      graph_view.vertex_partition_range_lasts().data(),
+                      graph_view.vertex_partition_range_lasts().size(),
+                      handle.get_stream());
+  auto key_func = compute_gpu_id_from_int_vertex_t<vertex_t>{
+    raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                      d_vertex_partition_range_lasts.size()),
+    major_comm_size,
+    minor_comm_size};
+
+  if (wgts) {
+    std::forward_as_tuple(std::tie(srcs, dsts, *wgts), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        thrust::make_zip_iterator(srcs.begin(), dsts.begin(), (*wgts).begin()),
+        thrust::make_zip_iterator(srcs.end(), dsts.end(), (*wgts).end()),
+        [key_func] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream());
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        srcs.begin(),
+                        srcs.end(),
+                        thrust::make_zip_iterator(dsts.begin(), (*wgts).begin()));
+  } else {
+    std::forward_as_tuple(std::tie(srcs, dsts), std::ignore) = groupby_gpu_id_and_shuffle_values(
+      comm,
+      thrust::make_zip_iterator(srcs.begin(), dsts.begin()),
+      thrust::make_zip_iterator(srcs.end(), dsts.end()),
+      [key_func] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+      handle.get_stream());
+    thrust::sort_by_key(handle.get_thrust_policy(), srcs.begin(), srcs.end(), dsts.begin());
+  }
+
+  rmm::device_uvector<edge_t> offsets(graph_view.local_vertex_partition_range_size() + 1,
+                                      handle.get_stream());
+  thrust::lower_bound(
+    handle.get_thrust_policy(),
+    srcs.begin(),
+    srcs.end(),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last() + 1),
+    offsets.begin());
+
+  return std::make_tuple(std::move(offsets), std::move(dsts), std::move(wgts));
+}
+
+// Sparse A^T A over the user-item adjacency: the seed items are processed in batches of bounded
+// two-hop degree sums (aligned to the seed boundaries, so a seed's row is complete within a batch).
+// For every batch, (user, item) pairs are sent to the users' owners, every user pairs the item with
+// its neighbor list, and the (item, neighbor) contributions are sent back to the items' owners and
+// accumulated in per-item open addressing hash tables.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+bipartite_projection_similarity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> items,
+  std::optional<size_t> topk_per_item,
+  coefficient_t coeff,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: similarity algorithms require an undirected graph.");
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph(),
+                  "Invalid input argument: bipartite projection does not support multi-graphs.");
+  CUGRAPH_EXPECTS(!topk_per_item || (*topk_per_item > 0),
+                  "Invalid input argument: topk_per_item should be a positive integer.");
+
+  if (do_expensive_check) {
+    check_all_pairs_similarity_input(
+      handle, graph_view, edge_weight_view, std::make_optional(items));
+  }
+
+  auto local_vertex_partition_range_first = graph_view.local_vertex_partition_range_first();
+
+  // 1. neighbor lists of the local vertices
+
+  std::optional<rmm::device_uvector<edge_t>> mg_offsets{std::nullopt};
+  std::optional<rmm::device_uvector<vertex_t>> mg_indices{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> mg_weights{std::nullopt};
+
+  raft::device_span<edge_t const> adj_offsets{};
+  raft::device_span<vertex_t const> adj_indices{};
+  raft::device_span<weight_t const> adj_weights{};  // empty if unweighted
+  if constexpr (multi_gpu) {
+    std::tie(mg_offsets, mg_indices, mg_weights) =
+      build_bipartite_projection_local_adjacency(handle, graph_view, edge_weight_view);
+    adj_offsets = raft::device_span<edge_t const>((*mg_offsets).data(), (*mg_offsets).size());
+    adj_indices = raft::device_span<vertex_t const>((*mg_indices).data(), (*mg_indices).size());
+    if (mg_weights) {
+      adj_weights = raft::device_span<weight_t const>((*mg_weights).data(), (*mg_weights).size());
+    }
+  } else {
+    auto edge_partition = graph_view.local_edge_partition_view(0);
+    adj_offsets         = edge_partition.offsets();
+    adj_indices         = edge_partition.indices();
+    if (edge_weight_view) {
+      adj_weights = raft::device_span<weight_t const>(edge_weight_view->value_firsts()[0],
+                                                      edge_weight_view->edge_counts()[0]);
+    }
+  }
+  bool accumulate_norms = (adj_weights.size() > 0) && (coeff == coefficient_t::COSINE);
+
+  auto local_degree_op = bipartite_projection_local_degree_t<vertex_t, edge_t>{
+    adj_offsets, local_vertex_partition_range_first};
+
+  // 2. split the seed items into batches
+
+  //   FIXME: Experiment with this and adjust as necessary
+  size_t const MAX_PAIRS_PER_BATCH{
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 15)};
+
+  rmm::device_uvector<size_t> two_hop_degree_offsets(items.size() + 1, handle.get_stream());
+  {
+    auto two_hop_degrees = compute_bipartite_projection_two_hop_degrees(handle, graph_view);
+    two_hop_degree_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(
+      handle.get_thrust_policy(),
+      thrust::make_permutation_iterator(
+        two_hop_degrees.begin(),
+        thrust::make_transform_iterator(
+          items.begin(), shift_left_t<vertex_t>{local_vertex_partition_range_first})),
+      thrust::make_permutation_iterator(
+        two_hop_degrees.begin(),
+        thrust::make_transform_iterator(
+          items.end(), shift_left_t<vertex_t>{local_vertex_partition_range_first})),
+      two_hop_degree_offsets.begin() + 1);
+  }
+  auto sum_two_hop_degrees = two_hop_degree_offsets.back_element(handle.get_stream());
+
+  auto [batch_offsets, batch_two_hop_degree_offsets] = compute_offset_aligned_element_chunks(
+    handle,
+    raft::device_span<size_t const>{two_hop_degree_offsets.data(), two_hop_degree_offsets.size()},
+    sum_two_hop_degrees,
+    MAX_PAIRS_PER_BATCH / bipartite_projection_hash_table_size_multiplier);
+
+  size_t num_batches = batch_offsets.size() - 1;
+  if constexpr (multi_gpu) {
+    num_batches = cugraph::host_scalar_allreduce(
+      handle.get_comms(), num_batches, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  rmm::device_uvector<weight_t> vertex_weight_sums(0, handle.get_stream());
+  if (coeff == coefficient_t::JACCARD) {
+    if (edge_weight_view) {
+      vertex_weight_sums = compute_out_weight_sums(handle, graph_view, *edge_weight_view);
+    } else {
+      auto degrees = graph_view.compute_out_degrees(handle);
+      vertex_weight_sums.resize(degrees.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        degrees.begin(),
+                        degrees.end(),
+                        vertex_weight_sums.begin(),
+                        typecast_t<edge_t, weight_t>{});
+    }
+  }
+
+  std::optional<rmm::device_uvector<vertex_t>> d_vertex_partition_range_lasts{std::nullopt};
+  std::optional<compute_gpu_id_from_int_vertex_t<vertex_t>> key_func{std::nullopt};
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(partition_manager::minor_comm_name());
+    d_vertex_partition_range_lasts = rmm::device_uvector<vertex_t>(
+      graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+    raft::update_device((*d_vertex_partition_range_lasts).data(),
+                        graph_view.vertex_partition_range_lasts().data(),
+                        graph_view.vertex_partition_range_lasts().size(),
+                        handle.get_stream());
+    key_func = compute_gpu_id_from_int_vertex_t<vertex_t>{
+      raft::device_span<vertex_t const>((*d_vertex_partition_range_lasts).data(),
+                                        (*d_vertex_partition_range_lasts).size()),
+      major_comm.get_size(),
+      minor_comm.get_size()};
+  }
+
+  rmm::device_uvector<vertex_t> top_v1(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> top_v2(0, handle.get_stream());
+  rmm::device_uvector<weight_t> top_score(0, handle.get_stream());
+
+  for (size_t batch_number = 0; batch_number < num_batches; ++batch_number) {
+    raft::device_span<vertex_t const> batch_items{items.data(), size_t{0}};
+    raft::device_span<size_t const> batch_two_hop_degree_offsets_span{
+      two_hop_degree_offsets.data(), size_t{1}};
+    size_t batch_two_hop_degree_first{0};
+    size_t batch_two_hop_degree_last{0};
+    if ((batch_number + 1) < batch_offsets.size()) {
+      batch_items = raft::device_span<vertex_t const>{
+        items.data() + batch_offsets[batch_number],
+        batch_offsets[batch_number + 1] - batch_offsets[batch_number]};
+      batch_two_hop_degree_offsets_span = raft::device_span<size_t const>{
+        two_hop_degree_offsets.data() + batch_offsets[batch_number], batch_items.size() + 1};
+      batch_two_hop_degree_first = batch_two_hop_degree_offsets[batch_number];
+      batch_two_hop_degree_last  = batch_two_hop_degree_offsets[batch_number + 1];
+    }
+
+    // 2-1. (user, item, item row in the batch, edge weight) for the users of the batch items
+
+    rmm::device_uvector<size_t> item_nbr_offsets(batch_items.size() + 1, handle.get_stream());
+    item_nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           thrust::make_transform_iterator(batch_items.begin(), local_degree_op),
+                           thrust::make_transform_iterator(batch_items.end(), local_degree_op),
+                           item_nbr_offsets.begin() + 1);
+    auto num_item_user_pairs = item_nbr_offsets.back_element(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> pair_users(num_item_user_pairs, handle.get_stream());
+    rmm::device_uvector<vertex_t> pair_items(num_item_user_pairs, handle.get_stream());
+    rmm::device_uvector<vertex_t> pair_rows(num_item_user_pairs, handle.get_stream());
+    rmm::device_uvector<weight_t> pair_weights(num_item_user_pairs, handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_item_user_pairs),
+      [offsets = raft::device_span<size_t const>(item_nbr_offsets.data(), item_nbr_offsets.size()),
+       batch_items,
+       adj_offsets,
+       adj_indices,
+       adj_weights,
+       local_vertex_partition_range_first,
+       pair_users   = pair_users.data(),
+       pair_items   = pair_items.data(),
+       pair_rows    = pair_rows.data(),
+       pair_weights = pair_weights.data()] __device__(size_t k) {
+        auto row = static_cast<size_t>(thrust::distance(
+          offsets.begin() + 1,
+          thrust::upper_bound(thrust::seq, offsets.begin() + 1, offsets.end(), k)));
+        auto item = batch_items[row];
+        auto e =
+          static_cast<size_t>(adj_offsets[item - local_vertex_partition_range_first]) +
+          (k - offsets[row]);
+        pair_users[k]   = adj_indices[e];
+        pair_items[k]   = item;
+        pair_rows[k]    = static_cast<vertex_t>(row);
+        pair_weights[k] = adj_weights.size() > 0 ? adj_weights[e] : weight_t{1};
+      });
+    item_nbr_offsets.resize(0, handle.get_stream());
+    item_nbr_offsets.shrink_to_fit(handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      std::forward_as_tuple(std::tie(pair_users, pair_items, pair_rows, pair_weights),
+                            std::ignore) =
+        groupby_gpu_id_and_shuffle_values(
+          handle.get_comms(),
+          thrust::make_zip_iterator(
+            pair_users.begin(), pair_items.begin(), pair_rows.begin(), pair_weights.begin()),
+          thrust::make_zip_iterator(
+            pair_users.end(), pair_items.end(), pair_rows.end(), pair_weights.end()),
+          [key_func = *key_func] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+          handle.get_stream());
+    }
+
+    // 2-2. every user pairs the item with its neighbors, (item, item row, neighbor, product,
+    // squared item edge weight, squared neighbor edge weight)
+
+    rmm::device_uvector<size_t> user_nbr_offsets(pair_users.size() + 1, handle.get_stream());
+    user_nbr_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           thrust::make_transform_iterator(pair_users.begin(), local_degree_op),
+                           thrust::make_transform_iterator(pair_users.end(), local_degree_op),
+                           user_nbr_offsets.begin() + 1);
+    auto num_contributions = user_nbr_offsets.back_element(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> contribution_items(num_contributions, handle.get_stream());
+    rmm::device_uvector<vertex_t> contribution_rows(num_contributions, handle.get_stream());
+    rmm::device_uvector<vertex_t> contribution_nbrs(num_contributions, handle.get_stream());
+    rmm::device_uvector<weight_t> contribution_products(num_contributions, handle.get_stream());
+    rmm::device_uvector<weight_t> contribution_norms_a(accumulate_norms ? num_contributions : 0,
+                                                       handle.get_stream());
+    rmm::device_uvector<weight_t> contribution_norms_b(accumulate_norms ? num_contributions : 0,
+                                                       handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_contributions),
+      [offsets = raft::device_span<size_t const>(user_nbr_offsets.data(), user_nbr_offsets.size()),
+       pair_users   = pair_users.data(),
+       pair_items   = pair_items.data(),
+       pair_rows    = pair_rows.data(),
+       pair_weights = pair_weights.data(),
+       adj_offsets,
+       adj_indices,
+       adj_weights,
+       local_vertex_partition_range_first,
+       coeff,
+       items    = contribution_items.data(),
+       rows     = contribution_rows.data(),
+       nbrs     = contribution_nbrs.data(),
+       products = contribution_products.data(),
+       norms_a  = raft::device_span<weight_t>(contribution_norms_a.data(),
+                                             contribution_norms_a.size()),
+       norms_b  = raft::device_span<weight_t>(contribution_norms_b.data(),
+                                             contribution_norms_b.size())] __device__(size_t k) {
+        auto i = static_cast<size_t>(thrust::distance(
+          offsets.begin() + 1,
+          thrust::upper_bound(thrust::seq, offsets.begin() + 1, offsets.end(), k)));
+        auto e = static_cast<size_t>(
+                   adj_offsets[pair_users[i] - local_vertex_partition_range_first]) +
+                 (k - offsets[i]);
+        auto w_a = pair_weights[i];
+        auto w_b = adj_weights.size() > 0 ? adj_weights[e] : weight_t{1};
+        items[k] = pair_items[i];
+        rows[k]  = pair_rows[i];
+        nbrs[k]  = adj_indices[e];
+        products[k] = coeff == coefficient_t::JACCARD ? (w_a < w_b ? w_a : w_b) : w_a * w_b;
+        if (norms_a.size() > 0) {
+          norms_a[k] = w_a * w_a;
+          norms_b[k] = w_b * w_b;
+        }
+      });
+    user_nbr_offsets.resize(0, handle.get_stream());
+    user_nbr_offsets.shrink_to_fit(handle.get_stream());
+    pair_users.resize(0, handle.get_stream());
+    pair_users.shrink_to_fit(handle.get_stream());
+    pair_items.resize(0, handle.get_stream());
+    pair_items.shrink_to_fit(handle.get_stream());
+    pair_rows.resize(0, handle.get_stream());
+    pair_rows.shrink_to_fit(handle.get_stream());
+    pair_weights.resize(0, handle.get_stream());
+    pair_weights.shrink_to_fit(handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      if (accumulate_norms) {
+        std::forward_as_tuple(std::tie(contribution_items,
+                                       contribution_rows,
+                                       contribution_nbrs,
+                                       contribution_products,
+                                       contribution_norms_a,
+                                       contribution_norms_b),
+                              std::ignore) =
+          groupby_gpu_id_and_shuffle_values(
+            handle.get_comms(),
+            thrust::make_zip_iterator(contribution_items.begin(),
+                                      contribution_rows.begin(),
+                                      contribution_nbrs.begin(),
+                                      contribution_products.begin(),
+                                      contribution_norms_a.begin(),
+                                      contribution_norms_b.begin()),
+            thrust::make_zip_iterator(contribution_items.end(),
+                                      contribution_rows.end(),
+                                      contribution_nbrs.end(),
+                                      contribution_products.end(),
+                                      contribution_norms_a.end(),
+                                      contribution_norms_b.end()),
+            [key_func = *key_func] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+            handle.get_stream());
+      } else {
+        std::forward_as_tuple(
+          std::tie(contribution_items, contribution_rows, contribution_nbrs, contribution_products),
+          std::ignore) =
+          groupby_gpu_id_and_shuffle_values(
+            handle.get_comms(),
+            thrust::make_zip_iterator(contribution_items.begin(),
+                                      contribution_rows.begin(),
+                                      contribution_nbrs.begin(),
+                                      contribution_products.begin()),
+            thrust::make_zip_iterator(contribution_items.end(),
+                                      contribution_rows.end(),
+                                      contribution_nbrs.end(),
+                                      contribution_products.end()),
+            [key_func = *key_func] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+            handle.get_stream());
+      }
+    }
+
+    // 2-3. accumulate the contributions in the hash tables of the batch items (the two-hop degree
+    // of a seed bounds the number of its distinct two-hop neighbors)
+
+    auto table_size = (batch_two_hop_degree_last - batch_two_hop_degree_first) *
+                      bipartite_projection_hash_table_size_multiplier;
+    rmm::device_uvector<vertex_t> table_keys(table_size, handle.get_stream());
+    rmm::device_uvector<weight_t> table_products(table_size, handle.get_stream());
+    rmm::device_uvector<weight_t> table_norms_a(accumulate_norms ? table_size : 0,
+                                                handle.get_stream());
+    rmm::device_uvector<weight_t> table_norms_b(accumulate_norms ? table_size : 0,
+                                                handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 table_keys.begin(),
+                 table_keys.end(),
+                 invalid_vertex_id_v<vertex_t>);
+    thrust::fill(
+      handle.get_thrust_policy(), table_products.begin(), table_products.end(), weight_t{0});
+    thrust::fill(
+      handle.get_thrust_policy(), table_norms_a.begin(), table_norms_a.end(), weight_t{0});
+    thrust::fill(
+      handle.get_thrust_policy(), table_norms_b.begin(), table_norms_b.end(), weight_t{0});
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(contribution_items.size()),
+      [two_hop_degree_offsets = batch_two_hop_degree_offsets_span,
+       batch_two_hop_degree_first,
+       items          = contribution_items.data(),
+       rows           = contribution_rows.data(),
+       nbrs           = contribution_nbrs.data(),
+       products       = contribution_products.data(),
+       norms_a        = contribution_norms_a.data(),
+       norms_b        = contribution_norms_b.data(),
+       accumulate_norms,
+       table_keys     = table_keys.data(),
+       table_products = table_products.data(),
+       table_norms_a  = table_norms_a.data(),
+       table_norms_b  = table_norms_b.data()] __device__(size_t k) {
+        auto nbr = nbrs[k];
+        if (nbr == items[k]) { return; }
+        auto row   = rows[k];
+        auto first = (two_hop_degree_offsets[row] - batch_two_hop_degree_first) *
+                     bipartite_projection_hash_table_size_multiplier;
+        auto capacity = (two_hop_degree_offsets[row + 1] - two_hop_degree_offsets[row]) *
+                        bipartite_projection_hash_table_size_multiplier;
+        auto slot = bipartite_projection_hash(nbr, capacity);
+        while (true) {
+          cuda::atomic_ref<vertex_t, cuda::thread_scope_device> key(table_keys[first + slot]);
+          auto expected = invalid_vertex_id_v<vertex_t>;
+          if (key.compare_exchange_strong(expected, nbr, cuda::std::memory_order_relaxed) ||
+              (expected == nbr)) {
+            break;
+          }
+          slot = (slot + 1) % capacity;
+        }
+        cuda::atomic_ref<weight_t, cuda::thread_scope_device>(table_products[first + slot])
+          .fetch_add(products[k], cuda::std::memory_order_relaxed);
+        if (accumulate_norms) {
+          cuda::atomic_ref<weight_t, cuda::thread_scope_device>(table_norms_a[first + slot])
+            .fetch_add(norms_a[k], cuda::std::memory_order_relaxed);
+          cuda::atomic_ref<weight_t, cuda::thread_scope_device>(table_norms_b[first + slot])
+            .fetch_add(norms_b[k], cuda::std::memory_order_relaxed);
+        }
+      });
+    contribution_items.resize(0, handle.get_stream());
+    contribution_items.shrink_to_fit(handle.get_stream());
+    contribution_rows.resize(0, handle.get_stream());
+    contribution_rows.shrink_to_fit(handle.get_stream());
+    contribution_nbrs.resize(0, handle.get_stream());
+    contribution_nbrs.shrink_to_fit(handle.get_stream());
+    contribution_products.resize(0, handle.get_stream());
+    contribution_products.shrink_to_fit(handle.get_stream());
+    contribution_norms_a.resize(0, handle.get_stream());
+    contribution_norms_a.shrink_to_fit(handle.get_stream());
+    contribution_norms_b.resize(0, handle.get_stream());
+    contribution_norms_b.shrink_to_fit(handle.get_stream());
+
+    // 2-4. cosine scores only need the accumulated values, the score overwrites the product
+
+    if (coeff == coefficient_t::COSINE) {
+      thrust::transform(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(table_size),
+        table_products.begin(),
+        [table_products = table_products.data(),
+         table_norms_a  = table_norms_a.data(),
+         table_norms_b  = table_norms_b.data(),
+         accumulate_norms] __device__(size_t s) {
+          auto product = table_products[s];
+          if (!accumulate_norms) { return product > weight_t{0} ? weight_t{1} : weight_t{0}; }
+          auto norm = static_cast<weight_t>(sqrt(table_norms_a[s])) *
+                      static_cast<weight_t>(sqrt(table_norms_b[s]));
+          return norm > weight_t{0} ? product / norm : weight_t{0};
+        });
+    }
+    table_norms_a.resize(0, handle.get_stream());
+    table_norms_a.shrink_to_fit(handle.get_stream());
+    table_norms_b.resize(0, handle.get_stream());
+    table_norms_b.shrink_to_fit(handle.get_stream());
+
+    // 2-5. compact the occupied slots to (item, two-hop neighbor, score) triplets
+
+    auto num_pairs = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(),
+      table_keys.begin(),
+      table_keys.end(),
+      [] __device__(vertex_t key) { return key != invalid_vertex_id_v<vertex_t>; }));
+
+    rmm::device_uvector<vertex_t> v1(num_pairs, handle.get_stream());
+    rmm::device_uvector<vertex_t> v2(num_pairs, handle.get_stream());
+    rmm::device_uvector<weight_t> score(num_pairs, handle.get_stream());
+    auto slot_first = thrust::make_zip_iterator(
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        cuda::proclaim_return_type<vertex_t>(
+          [two_hop_degree_offsets = batch_two_hop_degree_offsets_span,
+           batch_two_hop_degree_first,
+           batch_items] __device__(size_t s) {
+            auto row = thrust::distance(
+              two_hop_degree_offsets.begin() + 1,
+              thrust::upper_bound(thrust::seq,
+                                  two_hop_degree_offsets.begin() + 1,
+                                  two_hop_degree_offsets.end(),
+                                  batch_two_hop_degree_first +
+                                    s / bipartite_projection_hash_table_size_multiplier));
+            return batch_items[row];
+          })),
+      table_keys.begin(),
+      table_products.begin());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      slot_first,
+      slot_first + table_size,
+      table_keys.begin(),
+      thrust::make_zip_iterator(v1.begin(), v2.begin(), score.begin()),
+      [] __device__(vertex_t key) { return key != invalid_vertex_id_v<vertex_t>; });
+    table_keys.resize(0, handle.get_stream());
+    table_keys.shrink_to_fit(handle.get_stream());
+    table_products.resize(0, handle.get_stream());
+    table_products.shrink_to_fit(handle.get_stream());
+
+    // 2-6. Jaccard scores need the weight sums of both end points (the sum of the minimum weights
+    // of the intersection over the sum of the maximum weights of the union)
+
+    if (coeff == coefficient_t::JACCARD) {
+      rmm::device_uvector<weight_t> v2_weight_sums(0, handle.get_stream());
+      if constexpr (multi_gpu) {
+        v2_weight_sums = collect_values_for_int_vertices(handle.get_comms(),
+                                                         v2.begin(),
+                                                         v2.end(),
+                                                         vertex_weight_sums.begin(),
+                                                         graph_view.vertex_partition_range_lasts(),
+                                                         local_vertex_partition_range_first,
+                                                         handle.get_stream());
+      } else {
+        v2_weight_sums.resize(v2.size(), handle.get_stream());
+        thrust::gather(handle.get_thrust_policy(),
+                       v2.begin(),
+                       v2.end(),
+                       vertex_weight_sums.begin(),
+                       v2_weight_sums.begin());
+      }
+
+      thrust::transform(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(v1.begin(), score.begin(), v2_weight_sums.begin()),
+        thrust::make_zip_iterator(v1.end(), score.end(), v2_weight_sums.end()),
+        score.begin(),
+        [vertex_weight_sums = vertex_weight_sums.data(),
+         local_vertex_partition_range_first] __device__(auto triplet) {
+          auto intersection = thrust::get<1>(triplet);
+          auto weight_union =
+            vertex_weight_sums[thrust::get<0>(triplet) - local_vertex_partition_range_first] +
+            thrust::get<2>(triplet) - intersection;
+          return weight_union <= std::numeric_limits<weight_t>::min()
+                   ? weight_t{0}
+                   : intersection / weight_union;
+        });
+    }
+
+    // 2-7. rank the two-hop neighbors of each item (by score, ties are broken by v2) and keep the
+    // top topk_per_item neighbors
+
+    if (topk_per_item) {
+      auto triplet_first = thrust::make_zip_iterator(v1.begin(), score.begin(), v2.begin());
+      thrust::sort(handle.get_thrust_policy(),
+                   triplet_first,
+                   triplet_first + v1.size(),
+                   [] __device__(auto lhs, auto rhs) {
+                     if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+                       return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+                     }
+                     if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+                       return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+                     }
+                     return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+                   });
+
+      auto is_top_candidate =
+        [sorted_v1 = raft::device_span<vertex_t const>(v1.data(), v1.size()),
+         topk = *topk_per_item] __device__(size_t i) {
+          auto segment_first = thrust::lower_bound(
+            thrust::seq, sorted_v1.begin(), sorted_v1.begin() + i, sorted_v1[i]);
+          return static_cast<size_t>(thrust::distance(segment_first, sorted_v1.begin() + i)) <
+                 topk;
+        };
+
+      auto num_top_candidates = thrust::count_if(handle.get_thrust_policy(),
+                                                 thrust::make_counting_iterator(size_t{0}),
+                                                 thrust::make_counting_iterator(v1.size()),
+                                                 is_top_candidate);
+
+      auto old_size = top_v1.size();
+      top_v1.resize(old_size + num_top_candidates, handle.get_stream());
+      top_v2.resize(top_v1.size(), handle.get_stream());
+      top_score.resize(top_v1.size(), handle.get_stream());
+
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        triplet_first,
+        triplet_first + v1.size(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_zip_iterator(top_v1.begin(), top_score.begin(), top_v2.begin()) + old_size,
+        is_top_candidate);
+    } else {
+      auto old_size = top_v1.size();
+      top_v1.resize(old_size + v1.size(), handle.get_stream());
+      top_v2.resize(top_v1.size(), handle.get_stream());
+      top_score.resize(top_v1.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   thrust::make_zip_iterator(v1.begin(), v2.begin(), score.begin()),
+                   thrust::make_zip_iterator(v1.end(), v2.end(), score.end()),
+                   thrust::make_zip_iterator(top_v1.begin(), top_v2.begin(), top_score.begin()) +
+                     old_size);
+    }
+  }
+
+  return std::make_tuple(std::move(top_v1), std::move(top_v2), std::move(top_score));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  jaccard_bipartite_projection_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> items,
+    std::optional<size_t> topk_per_item,
+    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  return detail::bipartite_projection_similarity(handle,
+                                                 graph_view,
+                                                 edge_weight_view,
+                                                 items,
+                                                 topk_per_item,
+                                                 detail::coefficient_t::JACCARD,
+                                                 do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  cosine_bipartite_projection_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> items,
+    std::optional<size_t> topk_per_item,
+    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  return detail::bipartite_projection_similarity(handle,
+                                                 graph_view,
+                                                 edge_weight_view,
+                                                 items,
+                                                 topk_per_item,
+                                                 detail::coefficient_t::COSINE,
+                                                 do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -51,4 +51,24 @@ template std::
     std::optional<size_t> topk,
     bool do_expensive_check);
 
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<float>>
+  cosine_similarity_per_vertex_topk_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+    std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+    std::optional<raft::device_span<int64_t const>> vertices,
+    size_t topk_per_vertex,
+    bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<double>>
+  cosine_similarity_per_vertex_topk_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+    std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+    std::optional<raft::device_span<int64_t const>> vertices,
+    size_t topk_per_vertex,
+    bool do_expensive_check);
+
 }  // namespace cugraph
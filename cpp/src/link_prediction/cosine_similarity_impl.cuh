@@ -79,4 +79,27 @@ std::
                                       do_expensive_check);
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  cosine_similarity_per_vertex_topk_coefficients(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    size_t topk_per_vertex,
+    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  return detail::per_vertex_topk_similarity(handle,
+                                            graph_view,
+                                            edge_weight_view,
+                                            vertices,
+                                            topk_per_vertex,
+                                            detail::cosine_functor_t<weight_t>{},
+                                            detail::coefficient_t::COSINE,
+                                            do_expensive_check);
+}
+
 }  // namespace cugraph
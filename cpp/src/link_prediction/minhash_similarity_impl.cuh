@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "sampling/gather_sampled_vertex_features_impl.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// marks a sketch bin that no neighbor has been hashed into
+constexpr uint64_t minhash_empty_bin = std::numeric_limits<uint64_t>::max();
+
+// splitmix64 finalizer, a neighbor's hash value is never minhash_empty_bin
+template <typename vertex_t>
+__host__ __device__ uint64_t minhash_hash(vertex_t v, uint64_t seed)
+{
+  uint64_t h = static_cast<uint64_t>(v) + seed + uint64_t{0x9e3779b97f4a7c15};
+  h          = (h ^ (h >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  h          = (h ^ (h >> 27)) * uint64_t{0x94d049bb133111eb};
+  h          = h ^ (h >> 31);
+  return h != minhash_empty_bin ? h : minhash_empty_bin - 1;
+}
+
+// one permutation hashing: a neighbor hashes into a single bin and each bin keeps the minimum hash
+// value
+template <typename vertex_t>
+__device__ void minhash_insert(raft::device_span<uint64_t> sketches,
+                               size_t sketch_size,
+                               size_t row,
+                               vertex_t nbr,
+                               uint64_t seed)
+{
+  auto h = minhash_hash(nbr, seed);
+  cuda::atomic_ref<uint64_t, cuda::thread_scope_device> bin(
+    sketches[row * sketch_size + static_cast<size_t>(h % sketch_size)]);
+  bin.fetch_min(h, cuda::std::memory_order_relaxed);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct minhash_insert_local_edge_t {
+  edge_partition_device_view_t<vertex_t, edge_t, multi_gpu> edge_partition{};
+  cuda::std::optional<edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>
+    edge_partition_e_mask{};
+  raft::device_span<uint64_t> sketches{};  // major range size X sketch_size
+  size_t sketch_size{};
+  uint64_t seed{};
+
+  __device__ void operator()(edge_t e) const
+  {
+    if (edge_partition_e_mask && !((*edge_partition_e_mask).get(e))) { return; }
+    auto major_idx = edge_partition.major_idx_from_local_edge_idx_nocheck(e);
+    auto major_offset = edge_partition.major_offset_from_major_nocheck(
+      edge_partition.major_from_major_idx_nocheck(major_idx));
+    minhash_insert(sketches,
+                   sketch_size,
+                   static_cast<size_t>(major_offset),
+                   *(edge_partition.indices() + e),
+                   seed);
+  }
+};
+
+template <typename vertex_t>
+struct minhash_insert_edge_t {
+  raft::device_span<uint64_t> sketches{};  // local vertex partition range size X sketch_size
+  size_t sketch_size{};
+  uint64_t seed{};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    minhash_insert(
+      sketches,
+      sketch_size,
+      static_cast<size_t>(thrust::get<0>(e) - local_vertex_partition_range_first),
+      thrust::get<1>(e),
+      seed);
+  }
+};
+
+// J(A, B) ~= (# bins holding the same minimum) / (# bins not empty in both sketches)
+template <typename weight_t>
+struct minhash_jaccard_t {
+  raft::device_span<uint64_t const> sketches1{};
+  raft::device_span<uint64_t const> sketches2{};
+  size_t sketch_size{};
+
+  __device__ weight_t operator()(size_t i) const
+  {
+    size_t num_matches{0};
+    size_t num_bins{0};
+    for (size_t j = 0; j < sketch_size; ++j) {
+      auto h1 = sketches1[i * sketch_size + j];
+      auto h2 = sketches2[i * sketch_size + j];
+      if ((h1 != minhash_empty_bin) || (h2 != minhash_empty_bin)) {
+        ++num_bins;
+        if (h1 == h2) { ++num_matches; }
+      }
+    }
+    return num_bins > 0 ? static_cast<weight_t>(num_matches) / static_cast<weight_t>(num_bins)
+                        : weight_t{0};
+  }
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void check_minhash_sketches(graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                            size_t num_sketch_elements,
+                            size_t sketch_size)
+{
+  CUGRAPH_EXPECTS(sketch_size > 0, "Invalid input argument: sketch_size should be positive.");
+  CUGRAPH_EXPECTS(
+    num_sketch_elements ==
+      static_cast<size_t>(graph_view.local_vertex_partition_range_size()) * sketch_size,
+    "Invalid input argument: sketches size should coincide with the local vertex partition "
+    "range size times sketch_size.");
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> approx_jaccard_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<vertex_t const>> vertex_pairs,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: similarity algorithms require an undirected graph.");
+  CUGRAPH_EXPECTS(std::get<0>(vertex_pairs).size() == std::get<1>(vertex_pairs).size(),
+                  "Invalid input argument: vertex_pairs[0] and vertex_pairs[1] should have the "
+                  "same size.");
+  check_minhash_sketches(graph_view, sketches.size(), sketch_size);
+
+  // the sketches of the pair end points may live on other GPUs in multi-GPU, gather them (an O(k)
+  // row per vertex) instead of shuffling the pairs back and forth
+
+  auto sketches1 = gather_sampled_vertex_features(
+    handle, graph_view, sketches, sketch_size, std::get<0>(vertex_pairs), do_expensive_check);
+  auto sketches2 = gather_sampled_vertex_features(
+    handle, graph_view, sketches, sketch_size, std::get<1>(vertex_pairs), do_expensive_check);
+
+  rmm::device_uvector<weight_t> scores(std::get<0>(vertex_pairs).size(), handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(scores.size()),
+    scores.begin(),
+    minhash_jaccard_t<weight_t>{
+      raft::device_span<uint64_t const>(sketches1.data(), sketches1.size()),
+      raft::device_span<uint64_t const>(sketches2.data(), sketches2.size()),
+      sketch_size});
+
+  return scores;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<uint64_t> compute_minhash_sketches(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  size_t sketch_size,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(sketch_size > 0, "Invalid input argument: sketch_size should be positive.");
+
+  rmm::device_uvector<uint64_t> sketches(
+    static_cast<size_t>(graph_view.local_vertex_partition_range_size()) * sketch_size,
+    handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), sketches.begin(), sketches.end(), detail::minhash_empty_bin);
+
+  auto edge_mask_view = graph_view.edge_mask_view();
+
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(
+      graph_view.local_edge_partition_view(i));
+    auto edge_partition_e_mask =
+      edge_mask_view
+        ? cuda::std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>(
+            *edge_mask_view, i)
+        : cuda::std::nullopt;
+
+    // in multi-GPU, the majors of the i'th local edge partition are owned by the i'th GPU in the
+    // minor communicator, build partial sketches and min-reduce them to the owner (sketches are
+    // mergeable with an element-wise min)
+
+    std::optional<rmm::device_uvector<uint64_t>> partial_sketches{std::nullopt};
+    if constexpr (multi_gpu) {
+      partial_sketches = rmm::device_uvector<uint64_t>(
+        static_cast<size_t>(edge_partition.major_range_size()) * sketch_size, handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(),
+                   (*partial_sketches).begin(),
+                   (*partial_sketches).end(),
+                   detail::minhash_empty_bin);
+    }
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(edge_partition.number_of_edges()),
+      detail::minhash_insert_local_edge_t<vertex_t, edge_t, multi_gpu>{
+        edge_partition,
+        edge_partition_e_mask,
+        partial_sketches
+          ? raft::device_span<uint64_t>((*partial_sketches).data(), (*partial_sketches).size())
+          : raft::device_span<uint64_t>(sketches.data(), sketches.size()),
+        sketch_size,
+        seed});
+
+    if constexpr (multi_gpu) {
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      device_reduce(minor_comm,
+                    (*partial_sketches).data(),
+                    sketches.data(),
+                    (*partial_sketches).size(),
+                    raft::comms::op_t::MIN,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    }
+  }
+
+  return sketches;
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void update_minhash_sketches(raft::handle_t const& handle,
+                             graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                             raft::device_span<uint64_t> sketches,
+                             size_t sketch_size,
+                             uint64_t seed,
+                             raft::device_span<vertex_t const> edge_srcs,
+                             raft::device_span<vertex_t const> edge_dsts,
+                             bool do_expensive_check)
+{
+  detail::check_minhash_sketches(graph_view, sketches.size(), sketch_size);
+  CUGRAPH_EXPECTS(edge_srcs.size() == edge_dsts.size(),
+                  "Invalid input argument: edge_srcs and edge_dsts should have the same size.");
+
+  if (do_expensive_check) {
+    auto num_invalids = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin()),
+      thrust::make_zip_iterator(edge_srcs.end(), edge_dsts.end()),
+      [num_vertices = graph_view.number_of_vertices()] __device__(auto e) {
+        auto src = thrust::get<0>(e);
+        auto dst = thrust::get<1>(e);
+        return (src < vertex_t{0}) || (src >= num_vertices) || (dst < vertex_t{0}) ||
+               (dst >= num_vertices);
+      });
+    if constexpr (multi_gpu) {
+      num_invalids = host_scalar_allreduce(
+        handle.get_comms(), num_invalids, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input argument: edge_srcs and edge_dsts have invalid vertex IDs.");
+  }
+
+  detail::minhash_insert_edge_t<vertex_t> insert_op{
+    sketches, sketch_size, seed, graph_view.local_vertex_partition_range_first()};
+
+  if constexpr (multi_gpu) {
+    rmm::device_uvector<vertex_t> srcs(edge_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> dsts(edge_dsts.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), edge_srcs.begin(), edge_srcs.end(), srcs.begin());
+    thrust::copy(handle.get_thrust_policy(), edge_dsts.begin(), edge_dsts.end(), dsts.begin());
+    std::tie(srcs, dsts) =
+      detail::shuffle_int_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+        handle, std::move(srcs), std::move(dsts), graph_view.vertex_partition_range_lasts());
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_zip_iterator(srcs.begin(), dsts.begin()),
+                     thrust::make_zip_iterator(srcs.end(), dsts.end()),
+                     insert_op);
+  } else {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin()),
+                     thrust::make_zip_iterator(edge_srcs.end(), edge_dsts.end()),
+                     insert_op);
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> approx_jaccard_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<vertex_t const>> vertex_pairs,
+  bool do_expensive_check)
+{
+  return detail::approx_jaccard_coefficients<vertex_t, edge_t, weight_t, multi_gpu>(
+    handle, graph_view, sketches, sketch_size, vertex_pairs, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> approx_sorensen_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<vertex_t const>, raft::device_span<vertex_t const>> vertex_pairs,
+  bool do_expensive_check)
+{
+  auto scores = detail::approx_jaccard_coefficients<vertex_t, edge_t, weight_t, multi_gpu>(
+    handle, graph_view, sketches, sketch_size, vertex_pairs, do_expensive_check);
+
+  // S = 2|A ^ B| / (|A| + |B|) = 2J / (1 + J)
+  thrust::transform(handle.get_thrust_policy(),
+                    scores.begin(),
+                    scores.end(),
+                    scores.begin(),
+                    [] __device__(weight_t j) { return (weight_t{2} * j) / (weight_t{1} + j); });
+
+  return scores;
+}
+
+}  // namespace cugraph
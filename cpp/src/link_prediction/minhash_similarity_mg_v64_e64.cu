@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "link_prediction/minhash_similarity_impl.cuh"
+
+namespace cugraph {
+
+template rmm::device_uvector<uint64_t> compute_minhash_sketches(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  size_t sketch_size,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template void update_minhash_sketches(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  raft::device_span<uint64_t> sketches,
+  size_t sketch_size,
+  uint64_t seed,
+  raft::device_span<int64_t const> edge_srcs,
+  raft::device_span<int64_t const> edge_dsts,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> approx_jaccard_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<int64_t const>, raft::device_span<int64_t const>> vertex_pairs,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> approx_jaccard_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<int64_t const>, raft::device_span<int64_t const>> vertex_pairs,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> approx_sorensen_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<int64_t const>, raft::device_span<int64_t const>> vertex_pairs,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> approx_sorensen_coefficients(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  raft::device_span<uint64_t const> sketches,
+  size_t sketch_size,
+  std::tuple<raft::device_span<int64_t const>, raft::device_span<int64_t const>> vertex_pairs,
+  bool do_expensive_check);
+
+}  // namespace cugraph
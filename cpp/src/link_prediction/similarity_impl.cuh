@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "detail/graph_partition_utils.cuh"
 #include "prims/count_if_e.cuh"
 #include "prims/per_v_pair_transform_dst_nbr_intersection.cuh"
 #include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
@@ -24,6 +25,7 @@
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/core/device_span.hpp>
 #include <raft/core/handle.hpp>
@@ -201,6 +203,170 @@ rmm::device_uvector<weight_t> similarity(
   }
 }
 
+// Upper bounds of the two-hop neighborhood sizes of the seed vertices (@p vertices if specified,
+// the local vertex partition range otherwise); one extra element is allocated at the end to hold
+// the total after an exclusive scan
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<size_t> compute_two_hop_degree_upper_bounds(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<raft::device_span<vertex_t const>> vertices)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  rmm::device_uvector<edge_t> degrees = graph_view.compute_out_degrees(handle);
+  rmm::device_uvector<size_t> two_hop_degrees(degrees.size() + 1, handle.get_stream());
+
+  // FIXME: If vertices is specified, this could be done on a subset of the vertices
+  //
+  edge_dst_property_t<GraphViewType, edge_t> edge_dst_degrees(handle, graph_view);
+  update_edge_dst_property(handle, graph_view, degrees.begin(), edge_dst_degrees.mutable_view());
+
+  per_v_transform_reduce_incoming_e(
+    handle,
+    graph_view,
+    edge_src_dummy_property_t{}.view(),
+    edge_dst_degrees.view(),
+    edge_dummy_property_t{}.view(),
+    [] __device__(vertex_t, vertex_t, auto, auto dst_degree, auto) {
+      return static_cast<size_t>(dst_degree);
+    },
+    size_t{0},
+    reduce_op::plus<size_t>{},
+    two_hop_degrees.begin());
+
+  if (vertices) {
+    rmm::device_uvector<size_t> gathered_two_hop_degrees((*vertices).size() + 1,
+                                                         handle.get_stream());
+
+    thrust::gather(
+      handle.get_thrust_policy(),
+      thrust::make_transform_iterator(
+        (*vertices).begin(),
+        cugraph::detail::shift_left_t<vertex_t>{graph_view.local_vertex_partition_range_first()}),
+      thrust::make_transform_iterator(
+        (*vertices).end(),
+        cugraph::detail::shift_left_t<vertex_t>{graph_view.local_vertex_partition_range_first()}),
+      two_hop_degrees.begin(),
+      gathered_two_hop_degrees.begin());
+
+    two_hop_degrees = std::move(gathered_two_hop_degrees);
+  }
+
+  return two_hop_degrees;
+}
+
+// (v1, v2) pairs of the seed vertices (v1) and their two hop neighbors (v2) excluding self pairs;
+// in multi-GPU, the pairs are shuffled to the GPUs owning the (v1, v2) edge partitions
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+compute_two_hop_vertex_pairs(raft::handle_t const& handle,
+                             graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                             raft::device_span<vertex_t const> seeds,
+                             bool do_expensive_check)
+{
+  auto [offsets, v2] = k_hop_nbrs(handle, graph_view, seeds, 2, do_expensive_check);
+
+  auto v1 = cugraph::detail::expand_sparse_offsets(
+    raft::device_span<size_t const>{offsets.data(), offsets.size()},
+    vertex_t{0},
+    handle.get_stream());
+
+  cugraph::unrenumber_local_int_vertices(handle,
+                                         v1.data(),
+                                         v1.size(),
+                                         seeds.data(),
+                                         vertex_t{0},
+                                         static_cast<vertex_t>(seeds.size()),
+                                         do_expensive_check);
+
+  auto new_size = thrust::distance(
+    thrust::make_zip_iterator(v1.begin(), v2.begin()),
+    thrust::remove_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(v1.begin(), v2.begin()),
+      thrust::make_zip_iterator(v1.end(), v2.end()),
+      [] __device__(auto tuple) { return thrust::get<0>(tuple) == thrust::get<1>(tuple); }));
+
+  v1.resize(new_size, handle.get_stream());
+  v2.resize(new_size, handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    // shuffle vertex pairs
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+
+    std::tie(v1, v2, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore) =
+      detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                     edge_t,
+                                                                                     weight_t,
+                                                                                     int32_t,
+                                                                                     int32_t>(
+        handle,
+        std::move(v1),
+        std::move(v2),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        vertex_partition_range_lasts);
+  }
+
+  return std::make_tuple(std::move(v1), std::move(v2));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void check_all_pairs_similarity_input(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<vertex_t const>> vertices)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+
+  if (vertices) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      graph_view.local_vertex_partition_view());
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       vertices->begin(),
+                       vertices->end(),
+                       [vertex_partition] __device__(auto val) {
+                         return !(vertex_partition.is_valid_vertex(val) &&
+                                  vertex_partition.in_local_vertex_partition_range_nocheck(val));
+                       });
+
+    if constexpr (multi_gpu) {
+      num_invalid_vertices = cugraph::host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input arguments: there are invalid input vertices.");
+  }
+
+  if (edge_weight_view) {
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 *edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+
+    if constexpr (multi_gpu) {
+      num_negative_edge_weights = cugraph::host_scalar_allreduce(handle.get_comms(),
+                                                                 num_negative_edge_weights,
+                                                                 raft::comms::op_t::SUM,
+                                                                 handle.get_stream());
+    }
+
+    CUGRAPH_EXPECTS(
+      num_negative_edge_weights == 0,
+      "Invalid input argument: input edge weights should have non-negative values.");
+  }
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu, typename functor_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -214,8 +380,6 @@ all_pairs_similarity(raft::handle_t const& handle,
                      coefficient_t coeff,
                      bool do_expensive_check = false)
 {
-  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
-
   CUGRAPH_EXPECTS(graph_view.is_symmetric(),
                   "similarity algorithms require an undirected(symmetric) graph");
 
@@ -225,47 +389,7 @@ all_pairs_similarity(raft::handle_t const& handle,
                   "Weighted implementation currently fails on multi-graph");
 
   if (do_expensive_check) {
-    if (vertices) {
-      auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-        graph_view.local_vertex_partition_view());
-      auto num_invalid_vertices =
-        thrust::count_if(handle.get_thrust_policy(),
-                         vertices->begin(),
-                         vertices->end(),
-                         [vertex_partition] __device__(auto val) {
-                           return !(vertex_partition.is_valid_vertex(val) &&
-                                    vertex_partition.in_local_vertex_partition_range_nocheck(val));
-                         });
-
-      if constexpr (multi_gpu) {
-        num_invalid_vertices = cugraph::host_scalar_allreduce(
-          handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
-      }
-
-      CUGRAPH_EXPECTS(num_invalid_vertices == 0,
-                      "Invalid input arguments: there are invalid input vertices.");
-    }
-
-    if (edge_weight_view) {
-      auto num_negative_edge_weights =
-        count_if_e(handle,
-                   graph_view,
-                   edge_src_dummy_property_t{}.view(),
-                   edge_dst_dummy_property_t{}.view(),
-                   *edge_weight_view,
-                   [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
-
-      if constexpr (multi_gpu) {
-        num_negative_edge_weights = cugraph::host_scalar_allreduce(handle.get_comms(),
-                                                                   num_negative_edge_weights,
-                                                                   raft::comms::op_t::SUM,
-                                                                   handle.get_stream());
-      }
-
-      CUGRAPH_EXPECTS(
-        num_negative_edge_weights == 0,
-        "Invalid input argument: input edge weights should have non-negative values.");
-    }
+    check_all_pairs_similarity_input(handle, graph_view, edge_weight_view, vertices);
   }
 
   if (topk) {
@@ -290,45 +414,8 @@ all_pairs_similarity(raft::handle_t const& handle,
     size_t const MAX_PAIRS_PER_BATCH{
       static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 15)};
 
-    rmm::device_uvector<edge_t> degrees = graph_view.compute_out_degrees(handle);
-    rmm::device_uvector<size_t> two_hop_degrees(degrees.size() + 1, handle.get_stream());
-
     // Let's compute the maximum size of the 2-hop neighborhood of each vertex
-    // FIXME: If vertices is specified, this could be done on a subset of the vertices
-    //
-    edge_dst_property_t<GraphViewType, edge_t> edge_dst_degrees(handle, graph_view);
-    update_edge_dst_property(handle, graph_view, degrees.begin(), edge_dst_degrees.mutable_view());
-
-    per_v_transform_reduce_incoming_e(
-      handle,
-      graph_view,
-      edge_src_dummy_property_t{}.view(),
-      edge_dst_degrees.view(),
-      edge_dummy_property_t{}.view(),
-      [] __device__(vertex_t, vertex_t, auto, auto dst_degree, auto) {
-        return static_cast<size_t>(dst_degree);
-      },
-      size_t{0},
-      reduce_op::plus<size_t>{},
-      two_hop_degrees.begin());
-
-    if (vertices) {
-      rmm::device_uvector<size_t> gathered_two_hop_degrees(tmp_vertices.size() + 1,
-                                                           handle.get_stream());
-
-      thrust::gather(
-        handle.get_thrust_policy(),
-        thrust::make_transform_iterator(
-          tmp_vertices.begin(),
-          cugraph::detail::shift_left_t<vertex_t>{graph_view.local_vertex_partition_range_first()}),
-        thrust::make_transform_iterator(
-          tmp_vertices.end(),
-          cugraph::detail::shift_left_t<vertex_t>{graph_view.local_vertex_partition_range_first()}),
-        two_hop_degrees.begin(),
-        gathered_two_hop_degrees.begin());
-
-      two_hop_degrees = std::move(gathered_two_hop_degrees);
-    }
+    auto two_hop_degrees = compute_two_hop_degree_upper_bounds(handle, graph_view, vertices);
 
     thrust::sort_by_key(handle.get_thrust_policy(),
                         two_hop_degrees.begin(),
@@ -390,54 +477,8 @@ all_pairs_similarity(raft::handle_t const& handle,
           batch_offsets[batch_number + 1] - batch_offsets[batch_number]};
       }
 
-      auto [offsets, v2] = k_hop_nbrs(handle, graph_view, batch_seeds, 2, do_expensive_check);
-
-      auto v1 = cugraph::detail::expand_sparse_offsets(
-        raft::device_span<size_t const>{offsets.data(), offsets.size()},
-        vertex_t{0},
-        handle.get_stream());
-
-      cugraph::unrenumber_local_int_vertices(
-        handle,
-        v1.data(),
-        v1.size(),
-        tmp_vertices.data() + batch_offsets[batch_number],
-        vertex_t{0},
-        static_cast<vertex_t>(batch_offsets[batch_number + 1] - batch_offsets[batch_number]),
-        do_expensive_check);
-
-      auto new_size = thrust::distance(
-        thrust::make_zip_iterator(v1.begin(), v2.begin()),
-        thrust::remove_if(
-          handle.get_thrust_policy(),
-          thrust::make_zip_iterator(v1.begin(), v2.begin()),
-          thrust::make_zip_iterator(v1.end(), v2.end()),
-          [] __device__(auto tuple) { return thrust::get<0>(tuple) == thrust::get<1>(tuple); }));
-
-      v1.resize(new_size, handle.get_stream());
-      v2.resize(new_size, handle.get_stream());
-
-      if constexpr (multi_gpu) {
-        // shuffle vertex pairs
-        auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
-
-        std::tie(
-          v1, v2, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore) =
-          detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
-                                                                                         edge_t,
-                                                                                         weight_t,
-                                                                                         int32_t,
-                                                                                         int32_t>(
-            handle,
-            std::move(v1),
-            std::move(v2),
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            vertex_partition_range_lasts);
-      }
+      auto [v1, v2] = compute_two_hop_vertex_pairs<vertex_t, edge_t, weight_t, multi_gpu>(
+        handle, graph_view, batch_seeds, do_expensive_check);
 
       auto score =
         similarity(handle,
@@ -450,7 +491,7 @@ all_pairs_similarity(raft::handle_t const& handle,
                    do_expensive_check);
 
       // Add a remove_if to remove items that are less than the last topk element
-      new_size = thrust::distance(
+      auto new_size = thrust::distance(
         thrust::make_zip_iterator(score.begin(), v1.begin(), v2.begin()),
         thrust::remove_if(handle.get_thrust_policy(),
                           thrust::make_zip_iterator(score.begin(), v1.begin(), v2.begin()),
@@ -581,54 +622,116 @@ all_pairs_similarity(raft::handle_t const& handle,
       vertices_span = raft::device_span<vertex_t const>{tmp_vertices.data(), tmp_vertices.size()};
     }
 
-    auto [offsets, v2] = k_hop_nbrs(handle, graph_view, vertices_span, 2, do_expensive_check);
+    auto [v1, v2] = compute_two_hop_vertex_pairs<vertex_t, edge_t, weight_t, multi_gpu>(
+      handle, graph_view, vertices_span, do_expensive_check);
 
-    auto v1 = cugraph::detail::expand_sparse_offsets(
-      raft::device_span<size_t const>{offsets.data(), offsets.size()},
-      vertex_t{0},
-      handle.get_stream());
+    auto score =
+      similarity(handle,
+                 graph_view,
+                 edge_weight_view,
+                 std::make_tuple(raft::device_span<vertex_t const>{v1.data(), v1.size()},
+                                 raft::device_span<vertex_t const>{v2.data(), v2.size()}),
+                 functor,
+                 coeff,
+                 do_expensive_check);
 
-    cugraph::unrenumber_local_int_vertices(handle,
-                                           v1.data(),
-                                           v1.size(),
-                                           vertices_span.data(),
-                                           vertex_t{0},
-                                           static_cast<vertex_t>(vertices_span.size()),
-                                           do_expensive_check);
+    return std::make_tuple(std::move(v1), std::move(v2), std::move(score));
+  }
+}
 
-    auto new_size = thrust::distance(
-      thrust::make_zip_iterator(v1.begin(), v2.begin()),
-      thrust::remove_if(
-        handle.get_thrust_policy(),
-        thrust::make_zip_iterator(v1.begin(), v2.begin()),
-        thrust::make_zip_iterator(v1.end(), v2.end()),
-        [] __device__(auto tuple) { return thrust::get<0>(tuple) == thrust::get<1>(tuple); }));
+// Seed vertices are processed in chunks of bounded two-hop neighborhood sizes, and the chunks are
+// aligned to the seed vertex boundaries, so all the (v1, v2) candidate pairs of a seed vertex v1
+// are scored in the same chunk. Only the top @p topk_per_vertex pairs of each seed vertex are kept,
+// so the memory footprint is bounded by the chunk size plus the number of seeds times
+// @p topk_per_vertex.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu, typename functor_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+per_vertex_topk_similarity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<vertex_t const>> vertices,
+  size_t topk_per_vertex,
+  functor_t functor,
+  coefficient_t coeff,
+  bool do_expensive_check = false)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "similarity algorithms require an undirected(symmetric) graph");
+  CUGRAPH_EXPECTS(topk_per_vertex > 0,
+                  "Invalid input argument: topk_per_vertex should be a positive integer.");
 
-    v1.resize(new_size, handle.get_stream());
-    v2.resize(new_size, handle.get_stream());
+  // FIXME: See https://github.com/rapidsai/cugraph/issues/4132
+  //   Once that issue is resolved we can drop this check
+  CUGRAPH_EXPECTS(!graph_view.is_multigraph() || !edge_weight_view,
+                  "Weighted implementation currently fails on multi-graph");
 
-    if constexpr (multi_gpu) {
-      // shuffle vertex pairs
-      auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
-
-      std::tie(
-        v1, v2, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore) =
-        detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
-                                                                                       edge_t,
-                                                                                       weight_t,
-                                                                                       int32_t,
-                                                                                       int32_t>(
-          handle,
-          std::move(v1),
-          std::move(v2),
-          std::nullopt,
-          std::nullopt,
-          std::nullopt,
-          std::nullopt,
-          std::nullopt,
-          vertex_partition_range_lasts);
+  if (do_expensive_check) {
+    check_all_pairs_similarity_input(handle, graph_view, edge_weight_view, vertices);
+  }
+
+  rmm::device_uvector<vertex_t> tmp_vertices(0, handle.get_stream());
+  raft::device_span<vertex_t const> vertices_span{nullptr, size_t{0}};
+
+  if (vertices) {
+    vertices_span = raft::device_span<vertex_t const>{vertices->data(), vertices->size()};
+  } else {
+    tmp_vertices.resize(graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     tmp_vertices.begin(),
+                     tmp_vertices.end(),
+                     graph_view.local_vertex_partition_range_first());
+    vertices_span = raft::device_span<vertex_t const>{tmp_vertices.data(), tmp_vertices.size()};
+  }
+
+  //   FIXME: Experiment with this and adjust as necessary
+  size_t const MAX_PAIRS_PER_BATCH{
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 15)};
+
+  auto two_hop_degree_offsets = compute_two_hop_degree_upper_bounds(handle, graph_view, vertices);
+  thrust::exclusive_scan(handle.get_thrust_policy(),
+                         two_hop_degree_offsets.begin(),
+                         two_hop_degree_offsets.end(),
+                         two_hop_degree_offsets.begin());
+
+  auto sum_two_hop_degrees = two_hop_degree_offsets.back_element(handle.get_stream());
+
+  std::vector<size_t> batch_offsets;
+  std::tie(batch_offsets, std::ignore) = compute_offset_aligned_element_chunks(
+    handle,
+    raft::device_span<size_t const>{two_hop_degree_offsets.data(), two_hop_degree_offsets.size()},
+    sum_two_hop_degrees,
+    MAX_PAIRS_PER_BATCH);
+  batch_offsets.resize(std::distance(batch_offsets.begin(),
+                                     std::unique(batch_offsets.begin(), batch_offsets.end())));
+
+  size_t num_batches = batch_offsets.size() - 1;
+  if constexpr (multi_gpu) {
+    num_batches = cugraph::host_scalar_allreduce(
+      handle.get_comms(), num_batches, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  rmm::device_uvector<vertex_t> top_v1(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> top_v2(0, handle.get_stream());
+  rmm::device_uvector<weight_t> top_score(0, handle.get_stream());
+
+  for (size_t batch_number = 0; batch_number < num_batches; ++batch_number) {
+    raft::device_span<vertex_t const> batch_seeds{vertices_span.data(), size_t{0}};
+
+    if (((batch_number + 1) < batch_offsets.size()) &&
+        (batch_offsets[batch_number + 1] > batch_offsets[batch_number])) {
+      batch_seeds = raft::device_span<vertex_t const>{
+        vertices_span.data() + batch_offsets[batch_number],
+        batch_offsets[batch_number + 1] - batch_offsets[batch_number]};
     }
 
+    rmm::device_uvector<vertex_t> v1(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> v2(0, handle.get_stream());
+    std::tie(v1, v2) = compute_two_hop_vertex_pairs<vertex_t, edge_t, weight_t, multi_gpu>(
+      handle, graph_view, batch_seeds, do_expensive_check);
+
     auto score =
       similarity(handle,
                  graph_view,
@@ -639,8 +742,81 @@ all_pairs_similarity(raft::handle_t const& handle,
                  coeff,
                  do_expensive_check);
 
-    return std::make_tuple(std::move(v1), std::move(v2), std::move(score));
+    if constexpr (multi_gpu) {
+      // return the scores to the GPUs owning v1
+      auto& comm                 = handle.get_comms();
+      auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+      auto const minor_comm_size = minor_comm.get_size();
+
+      rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+        graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+      raft::update_device(d_vertex_partition_range_lasts.data(),
+                          graph_view.vertex_partition_range_lasts().data(),
+                          graph_view.vertex_partition_range_lasts().size(),
+                          handle.get_stream());
+
+      std::forward_as_tuple(std::tie(v1, v2, score), std::ignore) =
+        groupby_gpu_id_and_shuffle_values(
+          comm,
+          thrust::make_zip_iterator(v1.begin(), v2.begin(), score.begin()),
+          thrust::make_zip_iterator(v1.end(), v2.end(), score.end()),
+          [key_func =
+             cugraph::detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+               raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                                 d_vertex_partition_range_lasts.size()),
+               major_comm_size,
+               minor_comm_size}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+          handle.get_stream());
+    }
+
+    // rank the candidates of each seed vertex (by score, ties are broken by v2) and keep the top
+    // topk_per_vertex candidates
+
+    auto triplet_first = thrust::make_zip_iterator(v1.begin(), score.begin(), v2.begin());
+    thrust::sort(handle.get_thrust_policy(),
+                 triplet_first,
+                 triplet_first + v1.size(),
+                 [] __device__(auto lhs, auto rhs) {
+                   if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+                     return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+                   }
+                   if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+                     return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+                   }
+                   return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+                 });
+
+    auto is_top_candidate =
+      [sorted_v1 = raft::device_span<vertex_t const>(v1.data(), v1.size()),
+       topk_per_vertex] __device__(size_t i) {
+        auto segment_first =
+          thrust::lower_bound(thrust::seq, sorted_v1.begin(), sorted_v1.begin() + i, sorted_v1[i]);
+        return static_cast<size_t>(thrust::distance(segment_first, sorted_v1.begin() + i)) <
+               topk_per_vertex;
+      };
+
+    auto num_top_candidates = thrust::count_if(handle.get_thrust_policy(),
+                                               thrust::make_counting_iterator(size_t{0}),
+                                               thrust::make_counting_iterator(v1.size()),
+                                               is_top_candidate);
+
+    auto old_size = top_v1.size();
+    top_v1.resize(old_size + num_top_candidates, handle.get_stream());
+    top_v2.resize(top_v1.size(), handle.get_stream());
+    top_score.resize(top_v1.size(), handle.get_stream());
+
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      triplet_first,
+      triplet_first + v1.size(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_zip_iterator(top_v1.begin(), top_score.begin(), top_v2.begin()) + old_size,
+      is_top_candidate);
   }
+
+  return std::make_tuple(std::move(top_v1), std::move(top_v2), std::move(top_score));
 }
 
 }  // namespace detail
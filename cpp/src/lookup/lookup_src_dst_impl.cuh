@@ -31,6 +31,15 @@
 
 #include <cuda/std/optional>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
 namespace cugraph {
 
 template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
@@ -108,7 +117,13 @@ struct lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup_con
       kv_store_object = &(edge_type_to_kv_store.find(empty_type_)->second);
     }
 
-    if (multi_gpu) {
+    // the set of replicated edge types is identical in every GPU, so every GPU skips the
+    // (collective) shuffle below for the same edge types
+    auto replicated_itr = replicated_edge_type_to_kv_store.find(edge_type_to_lookup);
+    bool replicated     = replicated_itr != replicated_edge_type_to_kv_store.end();
+    if (replicated) { kv_store_object = &(replicated_itr->second); }
+
+    if (multi_gpu && !replicated) {
       auto& comm           = handle.get_comms();
       auto const comm_size = comm.get_size();
       auto& major_comm     = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
@@ -282,12 +297,76 @@ struct lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup_con
                            std::move(std::get<1>(output_value_buffer)));
   }
 
+  void replicate(raft::handle_t const& handle, std::vector<edge_type_t> types, bool multi_gpu)
+  {
+    auto invalid_vertex_id = cugraph::invalid_vertex_id<edge_id_t>::value;
+    auto invalid_value = thrust::tuple<vertex_t, vertex_t>(invalid_vertex_id, invalid_vertex_id);
+
+    std::sort(types.begin(), types.end());
+    types.erase(std::unique(types.begin(), types.end()), types.end());
+
+    for (auto typ : types) {
+      if (replicated_edge_type_to_kv_store.find(typ) != replicated_edge_type_to_kv_store.end()) {
+        continue;
+      }
+      CUGRAPH_EXPECTS(typ != empty_type_,
+                      "Invalid input argument: types includes a reserved edge type value.");
+
+      // in multi-GPU, an edge type may have no (edge ID, value) pair in this GPU
+      auto itr = edge_type_to_kv_store.find(typ);
+      auto [keys, values] =
+        (itr != edge_type_to_kv_store.end())
+          ? itr->second.retrieve_all(handle.get_stream())
+          : std::make_tuple(rmm::device_uvector<edge_id_t>(0, handle.get_stream()),
+                            cugraph::allocate_dataframe_buffer<value_t>(0, handle.get_stream()));
+
+      if (multi_gpu) {
+        auto& comm     = handle.get_comms();
+        auto rx_counts = host_scalar_allgather(comm, keys.size(), handle.get_stream());
+        std::vector<size_t> rx_displacements(rx_counts.size());
+        std::exclusive_scan(
+          rx_counts.begin(), rx_counts.end(), rx_displacements.begin(), size_t{0});
+        auto rx_size = rx_displacements.back() + rx_counts.back();
+
+        rmm::device_uvector<edge_id_t> rx_keys(rx_size, handle.get_stream());
+        auto rx_values = cugraph::allocate_dataframe_buffer<value_t>(rx_size, handle.get_stream());
+        device_allgatherv(comm,
+                          keys.begin(),
+                          rx_keys.begin(),
+                          rx_counts,
+                          rx_displacements,
+                          handle.get_stream());
+        device_allgatherv(comm,
+                          cugraph::get_dataframe_buffer_begin(values),
+                          cugraph::get_dataframe_buffer_begin(rx_values),
+                          rx_counts,
+                          rx_displacements,
+                          handle.get_stream());
+        keys   = std::move(rx_keys);
+        values = std::move(rx_values);
+      }
+
+      store_t replica(keys.size(), invalid_vertex_id, invalid_value, handle.get_stream());
+      replica.insert(keys.begin(),
+                     keys.end(),
+                     cugraph::get_dataframe_buffer_begin(values),
+                     handle.get_stream());
+      replicated_edge_type_to_kv_store.insert({typ, std::move(replica)});
+    }
+  }
+
+  bool is_replicated(edge_type_t type) const
+  {
+    return replicated_edge_type_to_kv_store.find(type) != replicated_edge_type_to_kv_store.end();
+  }
+
  private:
   using container_t =
     std::unordered_map<edge_type_t,
                        cugraph::kv_store_t<edge_id_t, value_t, false /*use_binary_search*/>>;
   using store_t = typename container_t::mapped_type;
   container_t edge_type_to_kv_store;
+  container_t replicated_edge_type_to_kv_store{};
   edge_type_t empty_type_ = std::numeric_limits<edge_type_t>::max() - 1;
 };
 
@@ -360,6 +439,201 @@ lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup_from_edge_
     handle, edge_ids_to_lookup, edge_types_to_lookup, multi_gpu);
 }
 
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+void lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>::replicate(
+  raft::handle_t const& handle, std::vector<edge_type_t> types, bool multi_gpu)
+{
+  pimpl->replicate(handle, std::move(types), multi_gpu);
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+bool lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>::is_replicated(
+  edge_type_t type) const
+{
+  return pimpl->is_replicated(type);
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+template <typename _edge_id_t, typename _edge_type_t, typename _vertex_t, typename _value_t>
+struct lookup_batcher_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup_batcher_impl {
+  using container_t = lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t>;
+  using result_t    = std::tuple<std::vector<vertex_t>, std::vector<vertex_t>>;
+
+  struct request_t {
+    std::vector<edge_id_t> edge_ids{};
+    std::vector<edge_type_t> edge_types{};
+    std::promise<result_t> result{};
+  };
+
+  lookup_batcher_impl(raft::handle_t const& handle,
+                      container_t const& container,
+                      std::chrono::microseconds window,
+                      size_t max_batch_size,
+                      bool multi_gpu)
+    : handle_(handle),
+      container_(container),
+      window_(window),
+      max_batch_size_(std::max(max_batch_size, size_t{1})),
+      multi_gpu_(multi_gpu)
+  {
+    worker_ = std::thread([this] { run(); });
+  }
+
+  ~lookup_batcher_impl()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  result_t lookup(std::vector<edge_id_t> const& edge_ids_to_lookup,
+                  std::vector<edge_type_t> const& edge_types_to_lookup)
+  {
+    CUGRAPH_EXPECTS(edge_ids_to_lookup.size() == edge_types_to_lookup.size(),
+                    "Invalid input arguments: edge_ids_to_lookup.size() != "
+                    "edge_types_to_lookup.size().");
+    if (multi_gpu_) {
+      CUGRAPH_EXPECTS(
+        std::all_of(edge_types_to_lookup.begin(),
+                    edge_types_to_lookup.end(),
+                    [this](auto typ) { return container_.is_replicated(typ); }),
+        "Invalid input argument: in multi-GPU, every edge type to look up should be replicated.");
+    }
+
+    request_t request{edge_ids_to_lookup, edge_types_to_lookup, std::promise<result_t>{}};
+    auto result = request.result.get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_size_ += request.edge_ids.size();
+      pending_.push_back(std::move(request));
+    }
+    cv_.notify_all();
+
+    return result.get();
+  }
+
+ private:
+  void run()
+  {
+    while (true) {
+      std::vector<request_t> batch{};
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) { break; }
+        cv_.wait_until(lock, std::chrono::steady_clock::now() + window_, [this] {
+          return stop_ || (pending_size_ >= max_batch_size_);
+        });
+        batch.assign(std::make_move_iterator(pending_.begin()),
+                     std::make_move_iterator(pending_.end()));
+        pending_.clear();
+        pending_size_ = 0;
+      }
+      serve(batch);
+    }
+  }
+
+  void serve(std::vector<request_t>& batch)
+  {
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    try {
+      size_t num_edges{0};
+      for (auto const& request : batch) {
+        num_edges += request.edge_ids.size();
+      }
+      std::vector<edge_id_t> h_edge_ids{};
+      std::vector<edge_type_t> h_edge_types{};
+      h_edge_ids.reserve(num_edges);
+      h_edge_types.reserve(num_edges);
+      for (auto const& request : batch) {
+        h_edge_ids.insert(h_edge_ids.end(), request.edge_ids.begin(), request.edge_ids.end());
+        h_edge_types.insert(
+          h_edge_types.end(), request.edge_types.begin(), request.edge_types.end());
+      }
+
+      rmm::device_uvector<edge_id_t> d_edge_ids(num_edges, handle_.get_stream());
+      rmm::device_uvector<edge_type_t> d_edge_types(num_edges, handle_.get_stream());
+      raft::update_device(d_edge_ids.data(), h_edge_ids.data(), num_edges, handle_.get_stream());
+      raft::update_device(
+        d_edge_types.data(), h_edge_types.data(), num_edges, handle_.get_stream());
+
+      // every edge type is local (single-GPU or replicated), so no GPU-to-GPU communication
+      auto values = container_.lookup_from_edge_ids_and_types(
+        handle_,
+        raft::device_span<edge_id_t const>{d_edge_ids.data(), d_edge_ids.size()},
+        raft::device_span<edge_type_t const>{d_edge_types.data(), d_edge_types.size()},
+        false);
+
+      h_srcs.resize(num_edges);
+      h_dsts.resize(num_edges);
+      raft::update_host(
+        h_srcs.data(), std::get<0>(values).data(), num_edges, handle_.get_stream());
+      raft::update_host(
+        h_dsts.data(), std::get<1>(values).data(), num_edges, handle_.get_stream());
+      handle_.sync_stream();
+    } catch (...) {
+      for (auto& request : batch) {
+        request.result.set_exception(std::current_exception());
+      }
+      return;
+    }
+
+    size_t offset{0};
+    for (auto& request : batch) {
+      auto first = offset;
+      auto last  = offset + request.edge_ids.size();
+      request.result.set_value(
+        std::make_tuple(std::vector<vertex_t>(h_srcs.begin() + first, h_srcs.begin() + last),
+                        std::vector<vertex_t>(h_dsts.begin() + first, h_dsts.begin() + last)));
+      offset = last;
+    }
+  }
+
+  raft::handle_t const& handle_;
+  container_t const& container_;
+  std::chrono::microseconds window_{};
+  size_t max_batch_size_{};
+  bool multi_gpu_{};
+
+  std::mutex mutex_{};
+  std::condition_variable cv_{};
+  std::vector<request_t> pending_{};
+  size_t pending_size_{0};
+  bool stop_{false};
+  std::thread worker_{};
+};
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+lookup_batcher_t<edge_id_t, edge_type_t, vertex_t, value_t>::~lookup_batcher_t()
+{
+  pimpl.reset();
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+lookup_batcher_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup_batcher_t(
+  raft::handle_t const& handle,
+  lookup_container_t<edge_id_t, edge_type_t, vertex_t, value_t> const& container,
+  std::chrono::microseconds window,
+  size_t max_batch_size,
+  bool multi_gpu)
+  : pimpl{std::make_unique<lookup_batcher_impl<edge_id_t, edge_type_t, vertex_t, value_t>>(
+      handle, container, window, max_batch_size, multi_gpu)}
+{
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t, typename value_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>>
+lookup_batcher_t<edge_id_t, edge_type_t, vertex_t, value_t>::lookup(
+  std::vector<edge_id_t> const& edge_ids_to_lookup,
+  std::vector<edge_type_t> const& edge_types_to_lookup)
+{
+  return pimpl->lookup(edge_ids_to_lookup, edge_types_to_lookup);
+}
+
 namespace detail {
 
 template <typename GraphViewType,
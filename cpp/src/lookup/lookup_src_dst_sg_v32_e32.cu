@@ -20,6 +20,8 @@ namespace cugraph {
 
 template class lookup_container_t<int32_t, int32_t, int32_t>;
 
+template class lookup_batcher_t<int32_t, int32_t, int32_t>;
+
 template lookup_container_t<int32_t, int32_t, int32_t> build_edge_id_and_type_to_src_dst_lookup_map(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, false, false> const& graph_view,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,15 +18,20 @@
 #include <cugraph/edge_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
 #include <raft/util/integer_utils.hpp>
 
+#include <rmm/cuda_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <cub/cub.cuh>
 
+#include <algorithm>
+#include <deque>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace cugraph {
@@ -54,6 +59,66 @@ inline std::vector<size_t> init_stream_pool_indices(size_t max_tmp_buffer_size,
   return stream_pool_indices;
 }
 
+// Runs asynchronous operations (e.g. collectives) on a dedicated stream to overlap them with the
+// computation enqueued afterwards on the other streams. Up to pipeline_depth operations can be in
+// flight, and the buffers read by an operation are kept alive until the operation completes.
+template <typename BufferType>
+class async_op_pipeline_t {
+ public:
+  async_op_pipeline_t(size_t pipeline_depth) : depth_(std::max(pipeline_depth, size_t{1})) {}
+
+  async_op_pipeline_t(async_op_pipeline_t const&)            = delete;
+  async_op_pipeline_t& operator=(async_op_pipeline_t const&) = delete;
+
+  ~async_op_pipeline_t() { drain(); }
+
+  rmm::cuda_stream_view stream() const { return stream_.view(); }
+
+  // the operations enqueued on stream() afterwards wait for the work enqueued on stream_view so far
+  void wait(rmm::cuda_stream_view stream_view) const
+  {
+    cudaEvent_t event{};
+    RAFT_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    RAFT_CUDA_TRY(cudaEventRecord(event, stream_view.value()));
+    RAFT_CUDA_TRY(cudaStreamWaitEvent(stream_.value(), event, 0));
+    RAFT_CUDA_TRY(cudaEventDestroy(event));
+  }
+
+  // mark the end of an operation enqueued on stream(), buffers are released once the operation
+  // completes (this blocks the host if pipeline_depth operations are already in flight)
+  void push(std::vector<BufferType>&& buffers)
+  {
+    cudaEvent_t event{};
+    RAFT_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    RAFT_CUDA_TRY(cudaEventRecord(event, stream_.value()));
+    in_flight_.emplace_back(event, std::move(buffers));
+    while (in_flight_.size() > depth_) {
+      pop();
+    }
+  }
+
+  // block the host till every in-flight operation completes
+  void drain() noexcept
+  {
+    while (!in_flight_.empty()) {
+      pop();
+    }
+  }
+
+ private:
+  void pop() noexcept
+  {
+    auto& [event, buffers] = in_flight_.front();
+    RAFT_CUDA_TRY_NO_THROW(cudaEventSynchronize(event));
+    RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(event));
+    in_flight_.pop_front();
+  }
+
+  rmm::cuda_stream stream_{};
+  size_t depth_{1};
+  std::deque<std::pair<cudaEvent_t, std::vector<BufferType>>> in_flight_{};
+};
+
 // this assumes that the caller already knows how many items will be copied.
 template <typename InputIterator, typename FlagIterator, typename OutputIterator>
 void copy_if_nosync(InputIterator input_first,
@@ -151,6 +216,35 @@ void sum_nosync(
     d_tmp_storage.data(), tmp_storage_bytes, input_first, sum.data(), input_size, stream_view);
 }
 
+template <typename InputIterator>
+void min_nosync(
+  InputIterator input_first,
+  InputIterator input_last,
+  raft::device_span<typename thrust::iterator_traits<InputIterator>::value_type> min /* size = 1 */,
+  rmm::cuda_stream_view stream_view)
+{
+  CUGRAPH_EXPECTS(
+    static_cast<size_t>(thrust::distance(input_first, input_last)) <=
+      static_cast<size_t>(std::numeric_limits<int>::max()),
+    "cugraph::detail::min_nosync relies on cub::DeviceReduce::Min which uses int for input size, "
+    "but thrust::distance(input_first, input_last) exceeds std::numeric_limits<int>::max().");
+
+  size_t tmp_storage_bytes{0};
+  size_t input_size = static_cast<int>(thrust::distance(input_first, input_last));
+
+  cub::DeviceReduce::Min(static_cast<void*>(nullptr),
+                         tmp_storage_bytes,
+                         input_first,
+                         min.data(),
+                         input_size,
+                         stream_view);
+
+  auto d_tmp_storage = rmm::device_uvector<std::byte>(tmp_storage_bytes, stream_view);
+
+  cub::DeviceReduce::Min(
+    d_tmp_storage.data(), tmp_storage_bytes, input_first, min.data(), input_size, stream_view);
+}
+
 }  // namespace detail
 
 }  // namespace cugraph
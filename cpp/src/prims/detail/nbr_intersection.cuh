@@ -27,6 +27,7 @@
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/mask_utils.cuh>
+#include <cugraph/utilities/memory_resource_hints.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/utilities/thrust_tuple_utils.hpp>
 
@@ -34,6 +35,7 @@
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
 #include <cuda/std/optional>
@@ -321,6 +323,109 @@ struct pick_min_degree_t {
   }
 };
 
+// if one neighbor list is longer than the other by more than this factor, iterate over the shorter
+// list and binary search the longer list instead of merging the two lists
+int32_t constexpr skewed_set_intersection_size_ratio = 32;
+
+// if one neighbor list is longer than the other by more than this factor (but not more than
+// skewed_set_intersection_size_ratio), iterate over the shorter list and galloping search the
+// longer list; the matches are expected to be close to each other in the longer list, and
+// galloping search takes O(log(distance to the match)) instead of O(log(remaining long list size))
+int32_t constexpr galloping_set_intersection_size_ratio = 4;
+
+// find the first position in [first, last) whose key is not less than @p key by doubling the step
+// size from @p first until the key is passed and then binary searching the last step
+template <typename KeyIterator, typename key_t, typename edge_t>
+__device__ edge_t galloping_lower_bound(KeyIterator key_first, edge_t first, edge_t last, key_t key)
+{
+  auto lo = first;
+  auto hi = first;
+  edge_t step{1};
+  while ((hi < last) && (*(key_first + hi) < key)) {
+    lo = hi + 1;
+    hi += step;
+    step *= 2;
+  }
+  hi = thrust::minimum<edge_t>{}(hi, last);
+  return static_cast<edge_t>(thrust::distance(
+    key_first, thrust::lower_bound(thrust::seq, key_first + lo, key_first + hi, key)));
+}
+
+// intersect a short list with a long list by searching every short list element in the remaining
+// part of the long list (binary search if use_galloping is false, galloping search otherwise), this
+// takes O(short_size * log(long_size)) instead of O(short_size + long_size)
+template <bool check_edge_mask,
+          typename ShortKeyIterator,
+          typename LongKeyIterator,
+          typename ShortValueIterator,  // should be void* if invalid
+          typename LongValueIterator,   // should be void* if invalid
+          typename MaskIterator,        // should be packed bool
+          typename OutputKeyIterator,
+          typename OutputShortValueIterator,
+          typename OutputLongValueIterator,
+          typename edge_t>
+__device__ edge_t skewed_set_intersection_by_key_with_mask(
+  ShortKeyIterator short_key_first,
+  LongKeyIterator long_key_first,
+  ShortValueIterator short_value_first,
+  LongValueIterator long_value_first,
+  MaskIterator mask_first,
+  OutputKeyIterator output_key_first,
+  OutputShortValueIterator output_short_value_first,
+  OutputLongValueIterator output_long_value_first,
+  edge_t short_start_offset,
+  edge_t short_size,
+  bool apply_short_mask,
+  edge_t long_start_offset,
+  edge_t long_size,
+  bool apply_long_mask,
+  size_t output_start_offset,
+  bool use_galloping)
+{
+  check_bit_set_t<MaskIterator, edge_t> check_bit_set{mask_first, edge_t{0}};
+
+  auto long_idx   = long_start_offset;
+  auto long_last  = long_start_offset + long_size;
+  auto output_idx = output_start_offset;
+  for (auto short_idx = short_start_offset;
+       (short_idx < (short_start_offset + short_size)) && (long_idx < long_last);
+       ++short_idx) {
+    if constexpr (check_edge_mask) {
+      if (apply_short_mask && !check_bit_set(short_idx)) { continue; }
+    }
+
+    auto key = *(short_key_first + short_idx);
+    if (use_galloping) {
+      long_idx = galloping_lower_bound(long_key_first, long_idx, long_last, key);
+    } else {
+      long_idx = static_cast<edge_t>(thrust::distance(
+        long_key_first,
+        thrust::lower_bound(
+          thrust::seq, long_key_first + long_idx, long_key_first + long_last, key)));
+    }
+    if constexpr (check_edge_mask) {
+      if (apply_long_mask) {
+        while ((long_idx < long_last) && (*(long_key_first + long_idx) == key) &&
+               !check_bit_set(long_idx)) {
+          ++long_idx;
+        }
+      }
+    }
+
+    if ((long_idx < long_last) && (*(long_key_first + long_idx) == key)) {
+      *(output_key_first + output_idx) = key;
+      if constexpr (!std::is_same_v<ShortValueIterator, void*>) {
+        *(output_short_value_first + output_idx) = *(short_value_first + short_idx);
+        *(output_long_value_first + output_idx)  = *(long_value_first + long_idx);
+      }
+      ++long_idx;
+      ++output_idx;
+    }
+  }
+
+  return (output_idx - output_start_offset);
+}
+
 template <bool check_edge_mask,
           typename InputKeyIterator0,
           typename InputKeyIterator1,
@@ -352,6 +457,48 @@ __device__ edge_t set_intersection_by_key_with_mask(InputKeyIterator0 input_key_
   static_assert(std::is_same_v<InputValueIterator0, void*> ==
                 std::is_same_v<InputValueIterator1, void*>);
 
+  auto use_galloping =
+    static_cast<size_t>(thrust::maximum<edge_t>{}(input_size0, input_size1)) <=
+    static_cast<size_t>(thrust::minimum<edge_t>{}(input_size0, input_size1)) *
+      skewed_set_intersection_size_ratio;
+  if (static_cast<size_t>(input_size1) >
+      static_cast<size_t>(input_size0) * galloping_set_intersection_size_ratio) {
+    return skewed_set_intersection_by_key_with_mask<check_edge_mask>(input_key_first0,
+                                                                     input_key_first1,
+                                                                     input_value_first0,
+                                                                     input_value_first1,
+                                                                     mask_first,
+                                                                     output_key_first,
+                                                                     output_value_first0,
+                                                                     output_value_first1,
+                                                                     input_start_offset0,
+                                                                     input_size0,
+                                                                     apply_mask0,
+                                                                     input_start_offset1,
+                                                                     input_size1,
+                                                                     apply_mask1,
+                                                                     output_start_offset,
+                                                                     use_galloping);
+  } else if (static_cast<size_t>(input_size0) >
+             static_cast<size_t>(input_size1) * galloping_set_intersection_size_ratio) {
+    return skewed_set_intersection_by_key_with_mask<check_edge_mask>(input_key_first1,
+                                                                     input_key_first0,
+                                                                     input_value_first1,
+                                                                     input_value_first0,
+                                                                     mask_first,
+                                                                     output_key_first,
+                                                                     output_value_first1,
+                                                                     output_value_first0,
+                                                                     input_start_offset1,
+                                                                     input_size1,
+                                                                     apply_mask1,
+                                                                     input_start_offset0,
+                                                                     input_size0,
+                                                                     apply_mask0,
+                                                                     output_start_offset,
+                                                                     use_galloping);
+  }
+
   check_bit_set_t<MaskIterator, edge_t> check_bit_set{mask_first, edge_t{0}};
 
   auto idx0       = input_start_offset0;
@@ -759,9 +906,13 @@ nbr_intersection(raft::handle_t const& handle,
       auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
       auto const minor_comm_size = minor_comm.get_size();
 
+      // the major neighbor lists collected below are temporary, allocate from the scratch memory
+      // resource (if set)
+      auto scratch_mr = get_scratch_memory_resource(handle);
+
       // 2.1 Find unique second pair element majors
 
-      rmm::device_uvector<vertex_t> unique_majors(input_size, handle.get_stream());
+      rmm::device_uvector<vertex_t> unique_majors(input_size, handle.get_stream(), scratch_mr);
       {
         auto second_element_first = thrust::make_transform_iterator(
           vertex_pair_first, thrust_tuple_get<thrust::tuple<vertex_t, vertex_t>, size_t{1}>{});
@@ -770,7 +921,9 @@ nbr_intersection(raft::handle_t const& handle,
                      second_element_first + input_size,
                      unique_majors.begin());
 
-        thrust::sort(handle.get_thrust_policy(), unique_majors.begin(), unique_majors.end());
+        thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                     unique_majors.begin(),
+                     unique_majors.end());
         unique_majors.resize(
           thrust::distance(
             unique_majors.begin(),
@@ -788,8 +941,8 @@ nbr_intersection(raft::handle_t const& handle,
           std::vector<size_t> rx_displacements(rx_counts.size());
           std::exclusive_scan(
             rx_counts.begin(), rx_counts.end(), rx_displacements.begin(), size_t{0});
-          rmm::device_uvector<vertex_t> rx_unique_majors(rx_displacements.back() + rx_counts.back(),
-                                                         handle.get_stream());
+          rmm::device_uvector<vertex_t> rx_unique_majors(
+            rx_displacements.back() + rx_counts.back(), handle.get_stream(), scratch_mr);
           device_allgatherv(minor_comm,
                             unique_majors.begin(),
                             rx_unique_majors.begin(),
@@ -798,7 +951,9 @@ nbr_intersection(raft::handle_t const& handle,
                             handle.get_stream());
           unique_majors = std::move(rx_unique_majors);
 
-          thrust::sort(handle.get_thrust_policy(), unique_majors.begin(), unique_majors.end());
+          thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                       unique_majors.begin(),
+                       unique_majors.end());
           unique_majors.resize(thrust::distance(unique_majors.begin(),
                                                 thrust::unique(handle.get_thrust_policy(),
                                                                unique_majors.begin(),
@@ -861,7 +1016,8 @@ nbr_intersection(raft::handle_t const& handle,
       // 2.3. Enumerate degrees and neighbors for the received majors
 
       rmm::device_uvector<edge_t> local_degrees_for_rx_majors(size_t{0}, handle.get_stream());
-      rmm::device_uvector<vertex_t> local_nbrs_for_rx_majors(size_t{0}, handle.get_stream());
+      rmm::device_uvector<vertex_t> local_nbrs_for_rx_majors(
+        size_t{0}, handle.get_stream(), scratch_mr);
 
       [[maybe_unused]] auto local_e_property_values_for_rx_majors =
         cugraph::detail::allocate_optional_dataframe_buffer<optional_property_buffer_value_type>(
@@ -936,7 +1092,7 @@ nbr_intersection(raft::handle_t const& handle,
         }
 
         rmm::device_uvector<size_t> local_nbr_offsets_for_rx_majors(
-          local_degrees_for_rx_majors.size() + 1, handle.get_stream());
+          local_degrees_for_rx_majors.size() + 1, handle.get_stream(), scratch_mr);
         local_nbr_offsets_for_rx_majors.set_element_to_zero_async(size_t{0}, handle.get_stream());
         auto degree_first = thrust::make_transform_iterator(local_degrees_for_rx_majors.begin(),
                                                             detail::typecast_t<edge_t, size_t>{});
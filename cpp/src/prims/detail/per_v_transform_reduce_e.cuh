@@ -29,6 +29,7 @@
 #include <cugraph/edge_partition_edge_property_device_view.cuh>
 #include <cugraph/edge_partition_endpoint_property_device_view.cuh>
 #include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/dataframe_buffer.hpp>
@@ -36,6 +37,7 @@
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/packed_bool_utils.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.hpp>
 
 #include <raft/core/handle.hpp>
@@ -47,6 +49,7 @@
 #include <cub/cub.cuh>
 #include <cuda/functional>
 #include <cuda/std/optional>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
@@ -54,7 +57,10 @@
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
 #include <thrust/scatter.h>
 #include <thrust/set_operations.h>
 #include <thrust/transform_reduce.h>
@@ -72,6 +78,20 @@ namespace detail {
 int32_t constexpr per_v_transform_reduce_e_kernel_block_size                        = 256;
 int32_t constexpr per_v_transform_reduce_e_kernel_high_degree_reduce_any_block_size = 128;
 
+// sub-warp size for the mid degree segment if its average degree is small (this happens only with
+// degree_segment_policy_t::adaptive)
+int32_t constexpr per_v_transform_reduce_e_sub_warp_size = 8;
+
+// high-degree segment vertices with more than this many local edges ("hub" vertices) have their
+// edges split to multiple thread blocks (each block processes one chunk of this many edges) instead
+// of being processed by a single thread block
+size_t constexpr per_v_transform_reduce_e_hub_chunk_size =
+  size_t{per_v_transform_reduce_e_kernel_block_size} * 64;  // tuning parameter
+
+// maximum number of in-flight minor_comm reductions overlapping with the computation of the
+// following edge partitions (in multi-GPU, update_major == true, ReduceOp != reduce_op::any)
+size_t constexpr per_v_transform_reduce_e_reduce_pipeline_depth = 2;  // tuning parameter
+
 template <typename Iterator, typename default_t, typename Enable = void>
 struct iterator_value_type_or_default_t;
 
@@ -273,9 +293,9 @@ __global__ static void per_v_transform_reduce_e_hypersparse(
   PredOp pred_op)
 {
   constexpr bool use_input_key = !std::is_same_v<OptionalKeyIterator, void*>;
-  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_v<
+  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_or_ops_v<
                                   ReduceOp>);  // atomic_reduce is defined only when
-                                               // has_compatible_raft_comms_op_t<ReduceOp> is true
+                                               // ReduceOp has compatible raft comms op(s)
   static_assert(update_major || !use_input_key);
 
   using vertex_t = typename GraphViewType::vertex_type;
@@ -409,9 +429,9 @@ __global__ static void per_v_transform_reduce_e_low_degree(
   ReduceOp reduce_op,
   PredOp pred_op)
 {
-  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_v<
+  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_or_ops_v<
                                   ReduceOp>);  // atomic_reduce is defined only when
-                                               // has_compatible_raft_comms_op_t<ReduceOp> is true
+                                               // ReduceOp has compatible raft comms op(s)
 
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -490,6 +510,7 @@ __global__ static void per_v_transform_reduce_e_low_degree(
 
 template <bool update_major,
           typename GraphViewType,
+          int32_t sub_warp_size /* a power of two no larger than raft::warp_size() */,
           typename KeyIterator,
           typename EdgePartitionSrcValueInputWrapper,
           typename EdgePartitionDstValueInputWrapper,
@@ -520,9 +541,9 @@ __global__ static void per_v_transform_reduce_e_mid_degree(
   ReduceOp reduce_op,
   PredOp pred_op)
 {
-  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_v<
+  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_or_ops_v<
                                   ReduceOp>);  // atomic_reduce is defined only when
-                                               // has_compatible_raft_comms_op_t<ReduceOp> is true
+                                               // ReduceOp has compatible raft comms op(s)
 
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -530,15 +551,24 @@ __global__ static void per_v_transform_reduce_e_mid_degree(
   using key_t         = typename thrust::iterator_traits<KeyIterator>::value_type;
 
   auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  static_assert((sub_warp_size <= raft::warp_size()) && (raft::warp_size() % sub_warp_size == 0));
   static_assert(per_v_transform_reduce_e_kernel_block_size % raft::warp_size() == 0);
-  auto const lane_id = tid % raft::warp_size();
-  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+  auto const lane_id = tid % sub_warp_size;
+  auto idx           = static_cast<size_t>(tid / sub_warp_size);
+
+  // lanes of the (sub-)warp processing the same key (different sub-warps in a warp may diverge)
+  [[maybe_unused]] auto const sub_warp_mask =
+    (sub_warp_size == raft::warp_size())
+      ? raft::warp_full_mask()
+      : (((uint32_t{1} << sub_warp_size) - 1)
+         << ((threadIdx.x % raft::warp_size()) / sub_warp_size) * sub_warp_size);
 
   using WarpReduce = cub::WarpReduce<
-    std::conditional_t<std::is_same_v<ReduceOp, reduce_op::any<T>>, int32_t, e_op_result_t>>;
+    std::conditional_t<std::is_same_v<ReduceOp, reduce_op::any<T>>, int32_t, e_op_result_t>,
+    sub_warp_size>;
   [[maybe_unused]] __shared__
     std::conditional_t<update_major, typename WarpReduce::TempStorage, std::byte /* dummy */>
-      temp_storage[update_major ? (per_v_transform_reduce_e_kernel_block_size / raft::warp_size())
+      temp_storage[update_major ? (per_v_transform_reduce_e_kernel_block_size / sub_warp_size)
                                 : int32_t{1} /* dummy */];
 
   while (idx < static_cast<size_t>(thrust::distance(key_first, key_last))) {
@@ -586,29 +616,30 @@ __global__ static void per_v_transform_reduce_e_mid_degree(
       reduced_e_op_result =
         (lane_id == 0) ? init : identity_element;  // init == identity_element for reduce_op::any<T>
       if constexpr (std::is_same_v<ReduceOp, reduce_op::any<T>>) {
-        first_valid_lane_id = raft::warp_size();
+        first_valid_lane_id = sub_warp_size;
       }
     }
 
     if (edge_partition_e_mask) {
       if constexpr (update_major && std::is_same_v<ReduceOp, reduce_op::any<T>>) {
         auto rounded_up_local_degree =
-          ((static_cast<size_t>(local_degree) + (raft::warp_size() - 1)) / raft::warp_size()) *
-          raft::warp_size();
-        for (size_t i = lane_id; i < rounded_up_local_degree; i += raft::warp_size()) {
+          ((static_cast<size_t>(local_degree) + (sub_warp_size - 1)) / sub_warp_size) *
+          sub_warp_size;
+        for (size_t i = lane_id; i < rounded_up_local_degree; i += sub_warp_size) {
           cuda::std::optional<T> e_op_result{cuda::std::nullopt};
           if ((i < static_cast<size_t>(local_degree)) &&
               (*edge_partition_e_mask).get(edge_offset + i) && call_pred_op(i)) {
             e_op_result = call_e_op(i);
           }
-          first_valid_lane_id = WarpReduce(temp_storage[threadIdx.x / raft::warp_size()])
-                                  .Reduce(e_op_result ? lane_id : raft::warp_size(), cub::Min());
-          first_valid_lane_id = __shfl_sync(raft::warp_full_mask(), first_valid_lane_id, int{0});
+          first_valid_lane_id = WarpReduce(temp_storage[threadIdx.x / sub_warp_size])
+                                  .Reduce(e_op_result ? lane_id : sub_warp_size, cub::Min());
+          first_valid_lane_id =
+            __shfl_sync(sub_warp_mask, first_valid_lane_id, int{0}, sub_warp_size);
           if (lane_id == first_valid_lane_id) { reduced_e_op_result = *e_op_result; }
-          if (first_valid_lane_id != raft::warp_size()) { break; }
+          if (first_valid_lane_id != sub_warp_size) { break; }
         }
       } else {
-        for (edge_t i = lane_id; i < local_degree; i += raft::warp_size()) {
+        for (edge_t i = lane_id; i < local_degree; i += sub_warp_size) {
           if ((*edge_partition_e_mask).get(edge_offset + i) & call_pred_op(i)) {
             auto e_op_result = call_e_op(i);
             if constexpr (update_major) {
@@ -627,21 +658,22 @@ __global__ static void per_v_transform_reduce_e_mid_degree(
     } else {
       if constexpr (update_major && std::is_same_v<ReduceOp, reduce_op::any<T>>) {
         auto rounded_up_local_degree =
-          ((static_cast<size_t>(local_degree) + (raft::warp_size() - 1)) / raft::warp_size()) *
-          raft::warp_size();
-        for (size_t i = lane_id; i < rounded_up_local_degree; i += raft::warp_size()) {
+          ((static_cast<size_t>(local_degree) + (sub_warp_size - 1)) / sub_warp_size) *
+          sub_warp_size;
+        for (size_t i = lane_id; i < rounded_up_local_degree; i += sub_warp_size) {
           cuda::std::optional<T> e_op_result{cuda::std::nullopt};
           if (i < static_cast<size_t>(local_degree) && call_pred_op(i)) {
             e_op_result = call_e_op(i);
           }
-          first_valid_lane_id = WarpReduce(temp_storage[threadIdx.x / raft::warp_size()])
-                                  .Reduce(e_op_result ? lane_id : raft::warp_size(), cub::Min());
-          first_valid_lane_id = __shfl_sync(raft::warp_full_mask(), first_valid_lane_id, int{0});
+          first_valid_lane_id = WarpReduce(temp_storage[threadIdx.x / sub_warp_size])
+                                  .Reduce(e_op_result ? lane_id : sub_warp_size, cub::Min());
+          first_valid_lane_id =
+            __shfl_sync(sub_warp_mask, first_valid_lane_id, int{0}, sub_warp_size);
           if (lane_id == first_valid_lane_id) { reduced_e_op_result = *e_op_result; }
-          if (first_valid_lane_id != raft::warp_size()) { break; }
+          if (first_valid_lane_id != sub_warp_size) { break; }
         }
       } else {
-        for (edge_t i = lane_id; i < local_degree; i += raft::warp_size()) {
+        for (edge_t i = lane_id; i < local_degree; i += sub_warp_size) {
           if (call_pred_op(i)) {
             auto e_op_result = call_e_op(i);
             if constexpr (update_major) {
@@ -661,17 +693,17 @@ __global__ static void per_v_transform_reduce_e_mid_degree(
 
     if constexpr (update_major) {
       if constexpr (std::is_same_v<ReduceOp, reduce_op::any<T>>) {
-        if (lane_id == ((first_valid_lane_id == raft::warp_size()) ? 0 : first_valid_lane_id)) {
+        if (lane_id == ((first_valid_lane_id == sub_warp_size) ? 0 : first_valid_lane_id)) {
           *(result_value_output + idx) = reduced_e_op_result;
         }
       } else {
-        reduced_e_op_result = WarpReduce(temp_storage[threadIdx.x / raft::warp_size()])
+        reduced_e_op_result = WarpReduce(temp_storage[threadIdx.x / sub_warp_size])
                                 .Reduce(reduced_e_op_result, reduce_op);
         if (lane_id == 0) { *(result_value_output + idx) = reduced_e_op_result; }
       }
     }
 
-    idx += gridDim.x * (blockDim.x / raft::warp_size());
+    idx += gridDim.x * (blockDim.x / sub_warp_size);
   }
 }
 
@@ -707,9 +739,9 @@ __global__ static void per_v_transform_reduce_e_high_degree(
   ReduceOp reduce_op,
   PredOp pred_op)
 {
-  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_v<
+  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_or_ops_v<
                                   ReduceOp>);  // atomic_reduce is defined only when
-                                               // has_compatible_raft_comms_op_t<ReduceOp> is true
+                                               // ReduceOp has compatible raft comms op(s)
 
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -891,6 +923,166 @@ __global__ static void per_v_transform_reduce_e_high_degree(
   }
 }
 
+template <typename GraphViewType, typename KeyIterator>
+struct compute_hub_chunk_count_t {
+  edge_partition_device_view_t<typename GraphViewType::vertex_type,
+                               typename GraphViewType::edge_type,
+                               GraphViewType::is_multi_gpu>
+    edge_partition{};
+  KeyIterator key_first{};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    using key_t       = typename thrust::iterator_traits<KeyIterator>::value_type;
+    auto major        = thrust_tuple_get_or_identity<key_t, 0>(*(key_first + i));
+    auto local_degree = static_cast<size_t>(
+      edge_partition.local_degree(edge_partition.major_offset_from_major_nocheck(major)));
+    return std::max(
+      (local_degree + (per_v_transform_reduce_e_hub_chunk_size - 1)) /
+        per_v_transform_reduce_e_hub_chunk_size,
+      size_t{1});  // at least one chunk per key to store init for zero local degree keys
+  }
+};
+
+struct chunk_to_key_idx_t {
+  raft::device_span<size_t const> chunk_offsets{};  // size = # keys + 1
+
+  __device__ size_t operator()(size_t i) const
+  {
+    return static_cast<size_t>(thrust::distance(
+             chunk_offsets.begin() + 1,
+             thrust::upper_bound(thrust::seq, chunk_offsets.begin() + 1, chunk_offsets.end(), i)));
+  }
+};
+
+// process high-degree segment keys with edges split to fixed size chunks (one thread block per
+// chunk), if update_major == true, each chunk's reduction result is stored in
+// result_value_output[chunk index] (the first chunk of each key includes init) and should be
+// further reduced by key
+template <bool update_major,
+          typename GraphViewType,
+          typename KeyIterator,
+          typename EdgePartitionSrcValueInputWrapper,
+          typename EdgePartitionDstValueInputWrapper,
+          typename EdgePartitionEdgeValueInputWrapper,
+          typename EdgePartitionEdgeMaskWrapper,
+          typename ResultValueOutputIteratorOrWrapper /* chunk reduction output if update_major,
+                                                         wrapper if GraphViewType::is_multi_gpu,
+                                                         iterator otherwise */
+          ,
+          typename EdgeOp,
+          typename ReduceOp,
+          typename PredOp,
+          typename T>
+__global__ static void per_v_transform_reduce_e_hub(
+  edge_partition_device_view_t<typename GraphViewType::vertex_type,
+                               typename GraphViewType::edge_type,
+                               GraphViewType::is_multi_gpu> edge_partition,
+  KeyIterator key_first,
+  raft::device_span<size_t const> chunk_offsets /* size = # keys + 1 */,
+  EdgePartitionSrcValueInputWrapper edge_partition_src_value_input,
+  EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
+  EdgePartitionEdgeValueInputWrapper edge_partition_e_value_input,
+  cuda::std::optional<EdgePartitionEdgeMaskWrapper> edge_partition_e_mask,
+  ResultValueOutputIteratorOrWrapper result_value_output,
+  EdgeOp e_op,
+  T init /* relevant only if update_major == true */,
+  T identity_element /* relevant only if update_major == true */,
+  ReduceOp reduce_op,
+  PredOp pred_op)
+{
+  static_assert(!std::is_same_v<ReduceOp, reduce_op::any<T>>);
+  static_assert(update_major || reduce_op::has_compatible_raft_comms_op_or_ops_v<
+                                  ReduceOp>);  // atomic_reduce is defined only when
+                                               // ReduceOp has compatible raft comms op(s)
+
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using e_op_result_t = T;
+  using key_t         = typename thrust::iterator_traits<KeyIterator>::value_type;
+
+  auto idx = static_cast<size_t>(blockIdx.x);
+
+  using BlockReduce = cub::BlockReduce<e_op_result_t, per_v_transform_reduce_e_kernel_block_size>;
+  [[maybe_unused]] __shared__
+    std::conditional_t<update_major, typename BlockReduce::TempStorage, std::byte /* dummy */>
+      temp_storage;
+
+  auto num_chunks = chunk_offsets.back();
+  while (idx < num_chunks) {
+    auto key_idx      = chunk_to_key_idx_t{chunk_offsets}(idx);
+    auto chunk_in_key = idx - chunk_offsets[key_idx];
+    auto key          = *(key_first + key_idx);
+    auto major        = thrust_tuple_get_or_identity<key_t, 0>(key);
+
+    auto major_offset = edge_partition.major_offset_from_major_nocheck(major);
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(major_offset);
+    auto chunk_first = static_cast<edge_t>(chunk_in_key * per_v_transform_reduce_e_hub_chunk_size);
+    auto chunk_last  = static_cast<edge_t>(std::min(
+      static_cast<size_t>(local_degree),
+      (chunk_in_key + 1) * per_v_transform_reduce_e_hub_chunk_size));
+
+    auto call_e_op = call_e_op_t<GraphViewType,
+                                 key_t,
+                                 EdgePartitionSrcValueInputWrapper,
+                                 EdgePartitionDstValueInputWrapper,
+                                 EdgePartitionEdgeValueInputWrapper,
+                                 EdgeOp>{edge_partition,
+                                         edge_partition_src_value_input,
+                                         edge_partition_dst_value_input,
+                                         edge_partition_e_value_input,
+                                         e_op,
+                                         key,
+                                         major_offset,
+                                         indices,
+                                         edge_offset};
+
+    auto call_pred_op = init_pred_op<GraphViewType>(edge_partition,
+                                                    edge_partition_src_value_input,
+                                                    edge_partition_dst_value_input,
+                                                    edge_partition_e_value_input,
+                                                    pred_op,
+                                                    key,
+                                                    major_offset,
+                                                    indices,
+                                                    edge_offset);
+
+    [[maybe_unused]] std::conditional_t<update_major, T, std::byte /* dummy */>
+      reduced_e_op_result{};
+    if constexpr (update_major) {
+      reduced_e_op_result = ((chunk_in_key == 0) && (threadIdx.x == 0)) ? init : identity_element;
+    }
+
+    for (edge_t i = chunk_first + threadIdx.x; i < chunk_last; i += blockDim.x) {
+      if ((!edge_partition_e_mask || (*edge_partition_e_mask).get(edge_offset + i)) &&
+          call_pred_op(i)) {
+        auto e_op_result = call_e_op(i);
+        if constexpr (update_major) {
+          reduced_e_op_result = reduce_op(reduced_e_op_result, e_op_result);
+        } else {
+          auto minor_offset = edge_partition.minor_offset_from_minor_nocheck(indices[i]);
+          if constexpr (GraphViewType::is_multi_gpu) {
+            reduce_op::atomic_reduce<ReduceOp>(result_value_output, minor_offset, e_op_result);
+          } else {
+            reduce_op::atomic_reduce<ReduceOp>(result_value_output + minor_offset, e_op_result);
+          }
+        }
+      }
+    }
+
+    if constexpr (update_major) {
+      reduced_e_op_result = BlockReduce(temp_storage).Reduce(reduced_e_op_result, reduce_op);
+      if (threadIdx.x == 0) { *(result_value_output + idx) = reduced_e_op_result; }
+      __syncthreads();  // temp_storage is reused in the next iteration
+    }
+
+    idx += gridDim.x;
+  }
+}
+
 template <typename vertex_t, typename priority_t, typename ValueIterator>
 void compute_priorities(
   raft::comms::comms_t const& comm,
@@ -1254,9 +1446,7 @@ void per_v_transform_reduce_e_edge_partition(
                            ? handle.get_stream_from_stream_pool(
                                (*edge_partition_stream_pool_indices)[2 % stream_pool_size])
                            : handle.get_stream();
-      raft::grid_1d_warp_t update_grid((*key_segment_offsets)[2] - (*key_segment_offsets)[1],
-                                       detail::per_v_transform_reduce_e_kernel_block_size,
-                                       handle.get_device_properties().maxGridSize[0]);
+      auto segment_size          = (*key_segment_offsets)[2] - (*key_segment_offsets)[1];
       auto segment_output_buffer = output_buffer;
       if constexpr (update_major) { segment_output_buffer += (*key_segment_offsets)[1]; }
       std::optional<segment_key_iterator_t>
@@ -1268,21 +1458,67 @@ void per_v_transform_reduce_e_edge_partition(
         segment_key_first = thrust::make_counting_iterator(edge_partition.major_range_first());
       }
       *segment_key_first += (*key_segment_offsets)[1];
-      detail::per_v_transform_reduce_e_mid_degree<update_major, GraphViewType>
-        <<<update_grid.num_blocks, update_grid.block_size, 0, exec_stream>>>(
-          edge_partition,
+
+      // with degree_segment_policy_t::adaptive, the mid degree segment may start well below
+      // raft::warp_size(), use sub-warps if a warp per key leaves more than half the lanes idle
+      bool use_sub_warp{false};
+      if (get_degree_segment_policy_hint(handle) == degree_segment_policy_t::adaptive) {
+        auto degree_sum = thrust::transform_reduce(
+          handle.get_thrust_policy(),
           *segment_key_first,
-          *segment_key_first + ((*key_segment_offsets)[2] - (*key_segment_offsets)[1]),
-          edge_partition_src_value_input,
-          edge_partition_dst_value_input,
-          edge_partition_e_value_input,
-          edge_partition_e_mask,
-          segment_output_buffer,
-          e_op,
-          major_init,
-          major_identity_element,
-          reduce_op,
-          pred_op);
+          *segment_key_first + segment_size,
+          cuda::proclaim_return_type<size_t>([edge_partition] __device__(auto key) {
+            auto major = thrust_tuple_get_or_identity<decltype(key), 0>(key);
+            return static_cast<size_t>(
+              edge_partition.local_degree(edge_partition.major_offset_from_major_nocheck(major)));
+          }),
+          size_t{0},
+          thrust::plus<size_t>{});
+        use_sub_warp = degree_sum < segment_size * (raft::warp_size() / 2);
+      }
+
+      if (use_sub_warp) {
+        raft::grid_1d_thread_t update_grid(
+          segment_size * detail::per_v_transform_reduce_e_sub_warp_size,
+          detail::per_v_transform_reduce_e_kernel_block_size,
+          handle.get_device_properties().maxGridSize[0]);
+        detail::per_v_transform_reduce_e_mid_degree<update_major,
+                                                     GraphViewType,
+                                                     detail::per_v_transform_reduce_e_sub_warp_size>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, exec_stream>>>(
+            edge_partition,
+            *segment_key_first,
+            *segment_key_first + segment_size,
+            edge_partition_src_value_input,
+            edge_partition_dst_value_input,
+            edge_partition_e_value_input,
+            edge_partition_e_mask,
+            segment_output_buffer,
+            e_op,
+            major_init,
+            major_identity_element,
+            reduce_op,
+            pred_op);
+      } else {
+        raft::grid_1d_warp_t update_grid(segment_size,
+                                         detail::per_v_transform_reduce_e_kernel_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+        detail::per_v_transform_reduce_e_mid_degree<update_major, GraphViewType, raft::warp_size()>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, exec_stream>>>(
+            edge_partition,
+            *segment_key_first,
+            *segment_key_first + segment_size,
+            edge_partition_src_value_input,
+            edge_partition_dst_value_input,
+            edge_partition_e_value_input,
+            edge_partition_e_mask,
+            segment_output_buffer,
+            e_op,
+            major_init,
+            major_identity_element,
+            reduce_op,
+            pred_op);
+      }
     }
     if ((*key_segment_offsets)[1] > 0) {
       auto exec_stream = edge_partition_stream_pool_indices
@@ -1303,21 +1539,112 @@ void per_v_transform_reduce_e_edge_partition(
       } else {
         segment_key_first = thrust::make_counting_iterator(edge_partition.major_range_first());
       }
-      detail::per_v_transform_reduce_e_high_degree<update_major, GraphViewType>
-        <<<update_grid.num_blocks, update_grid.block_size, 0, exec_stream>>>(
-          edge_partition,
-          *segment_key_first,
-          *segment_key_first + (*key_segment_offsets)[1],
-          edge_partition_src_value_input,
-          edge_partition_dst_value_input,
-          edge_partition_e_value_input,
-          edge_partition_e_mask,
-          output_buffer,
-          e_op,
-          major_init,
-          major_identity_element,
-          reduce_op,
-          pred_op);
+
+      // split the edges of hub vertices (vertices with more than
+      // per_v_transform_reduce_e_hub_chunk_size local edges) to multiple thread blocks to avoid a
+      // few extreme-degree vertices serializing the entire high-degree segment
+
+      bool hub_processed{false};
+      if constexpr (!std::is_same_v<ReduceOp, reduce_op::any<T>>) {
+        if (static_cast<size_t>(edge_partition.number_of_edges()) >
+            detail::per_v_transform_reduce_e_hub_chunk_size) {
+          auto num_keys = (*key_segment_offsets)[1];
+          // the keys are unique, so the number of chunks is bounded by num_keys + (# edges /
+          // chunk size); the exact number of chunks stays in device memory (the kernel strides
+          // over the chunks), this avoids a device to host copy (and a stream synchronization)
+          // per call
+          auto max_num_chunks = num_keys + static_cast<size_t>(edge_partition.number_of_edges()) /
+                                             detail::per_v_transform_reduce_e_hub_chunk_size;
+          rmm::device_uvector<size_t> chunk_offsets(num_keys + 1, exec_stream);
+          chunk_offsets.set_element_to_zero_async(0, exec_stream);
+          auto chunk_count_first = thrust::make_transform_iterator(
+            thrust::make_counting_iterator(size_t{0}),
+            detail::compute_hub_chunk_count_t<GraphViewType, segment_key_iterator_t>{
+              edge_partition, *segment_key_first});
+          thrust::inclusive_scan(rmm::exec_policy_nosync(exec_stream),
+                                 chunk_count_first,
+                                 chunk_count_first + num_keys,
+                                 chunk_offsets.begin() + 1);
+          raft::grid_1d_block_t hub_grid(max_num_chunks,
+                                         detail::per_v_transform_reduce_e_kernel_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+          if constexpr (update_major) {
+            auto chunk_reduction_buffer = allocate_dataframe_buffer<T>(max_num_chunks, exec_stream);
+            detail::per_v_transform_reduce_e_hub<update_major, GraphViewType>
+              <<<hub_grid.num_blocks, hub_grid.block_size, 0, exec_stream>>>(
+                edge_partition,
+                *segment_key_first,
+                raft::device_span<size_t const>(chunk_offsets.data(), chunk_offsets.size()),
+                edge_partition_src_value_input,
+                edge_partition_dst_value_input,
+                edge_partition_e_value_input,
+                edge_partition_e_mask,
+                get_dataframe_buffer_begin(chunk_reduction_buffer),
+                e_op,
+                major_init,
+                major_identity_element,
+                reduce_op,
+                pred_op);
+            // the chunks past the exact number of chunks map to key index num_keys (their
+            // reduction results are not set and discarded)
+            auto key_reduction_buffer = allocate_dataframe_buffer<T>(num_keys + 1, exec_stream);
+            thrust::reduce_by_key(
+              rmm::exec_policy_nosync(exec_stream),
+              thrust::make_transform_iterator(
+                thrust::make_counting_iterator(size_t{0}),
+                detail::chunk_to_key_idx_t{
+                  raft::device_span<size_t const>(chunk_offsets.data(), chunk_offsets.size())}),
+              thrust::make_transform_iterator(
+                thrust::make_counting_iterator(max_num_chunks),
+                detail::chunk_to_key_idx_t{
+                  raft::device_span<size_t const>(chunk_offsets.data(), chunk_offsets.size())}),
+              get_dataframe_buffer_begin(chunk_reduction_buffer),
+              thrust::make_discard_iterator(),
+              get_dataframe_buffer_begin(key_reduction_buffer),
+              thrust::equal_to<size_t>{},
+              reduce_op);
+            thrust::copy(rmm::exec_policy_nosync(exec_stream),
+                         get_dataframe_buffer_begin(key_reduction_buffer),
+                         get_dataframe_buffer_begin(key_reduction_buffer) + num_keys,
+                         output_buffer);
+          } else {
+            detail::per_v_transform_reduce_e_hub<update_major, GraphViewType>
+              <<<hub_grid.num_blocks, hub_grid.block_size, 0, exec_stream>>>(
+                edge_partition,
+                *segment_key_first,
+                raft::device_span<size_t const>(chunk_offsets.data(), chunk_offsets.size()),
+                edge_partition_src_value_input,
+                edge_partition_dst_value_input,
+                edge_partition_e_value_input,
+                edge_partition_e_mask,
+                output_buffer,
+                e_op,
+                major_init,
+                major_identity_element,
+                reduce_op,
+                pred_op);
+          }
+          hub_processed = true;
+        }
+      }
+
+      if (!hub_processed) {
+        detail::per_v_transform_reduce_e_high_degree<update_major, GraphViewType>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, exec_stream>>>(
+            edge_partition,
+            *segment_key_first,
+            *segment_key_first + (*key_segment_offsets)[1],
+            edge_partition_src_value_input,
+            edge_partition_dst_value_input,
+            edge_partition_e_value_input,
+            edge_partition_e_mask,
+            output_buffer,
+            e_op,
+            major_init,
+            major_identity_element,
+            reduce_op,
+            pred_op);
+      }
     }
   } else {
     auto exec_stream = edge_partition_stream_pool_indices
@@ -1388,6 +1715,14 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                               PredOp pred_op,
                               VertexValueOutputIterator vertex_value_output_first)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "per_v_transform_reduce_e");
+  if (profile_range.is_enabled()) {
+    for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+      profile_range.add_edges_touched(
+        static_cast<size_t>(graph_view.local_edge_partition_view(i).number_of_edges()));
+    }
+  }
+
   constexpr bool update_major  = (incoming == GraphViewType::is_storage_transposed);
   constexpr bool use_input_key = !std::is_same_v<OptionalKeyIterator, void*>;
   static_assert(update_major || !use_input_key);
@@ -1402,7 +1737,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
 
   static_assert(
     ReduceOp::pure_function &&
-    ((reduce_op::has_compatible_raft_comms_op_v<ReduceOp> &&
+    ((reduce_op::has_compatible_raft_comms_op_or_ops_v<ReduceOp> &&
       reduce_op::has_identity_element_v<ReduceOp>) ||
      (update_major &&
       std::is_same_v<ReduceOp, reduce_op::any<T>>)));  // current restriction, to support general
@@ -2061,6 +2396,18 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
 
   // 9. process local edge partitions
 
+  [[maybe_unused]] std::conditional_t<
+    GraphViewType::is_multi_gpu && update_major && !std::is_same_v<ReduceOp, reduce_op::any<T>>,
+    std::optional<async_op_pipeline_t<dataframe_buffer_type_t<T>>>,
+    std::byte /* dummy */>
+    reduce_pipeline{};
+  if constexpr (GraphViewType::is_multi_gpu && update_major &&
+                !std::is_same_v<ReduceOp, reduce_op::any<T>>) {
+    if (graph_view.number_of_local_edge_partitions() > num_concurrent_loops) {
+      reduce_pipeline.emplace(per_v_transform_reduce_e_reduce_pipeline_depth);
+    }
+  }
+
   for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); i += num_concurrent_loops) {
     auto loop_count =
       std::min(num_concurrent_loops, graph_view.number_of_local_edge_partitions() - i);
@@ -4261,6 +4608,10 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
         }
         handle.sync_stream();
       } else {
+        // if reduce_pipeline is valid, the reductions run on a separate stream and overlap with the
+        // next iterations' computation
+        auto reduce_stream = reduce_pipeline ? reduce_pipeline->stream() : handle.get_stream();
+        if (reduce_pipeline) { reduce_pipeline->wait(handle.get_stream()); }
         device_group_start(minor_comm);
         for (size_t j = 0; j < loop_count; ++j) {
           auto partition_idx = i + j;
@@ -4269,15 +4620,24 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                         get_dataframe_buffer_begin(edge_partition_major_output_buffers[j]),
                         tmp_vertex_value_output_first,
                         size_dataframe_buffer(edge_partition_major_output_buffers[j]),
-                        ReduceOp::compatible_raft_comms_op,
+                        reduce_op::get_compatible_raft_comms_ops<ReduceOp>(),
                         static_cast<int>(partition_idx),
-                        handle.get_stream());
+                        reduce_stream);
         }
         device_group_end(minor_comm);
-        if (loop_stream_pool_indices) { handle.sync_stream(); }
+        if (reduce_pipeline) {
+          // edge_partition_major_output_buffers are released once the reductions complete
+          reduce_pipeline->push(std::move(edge_partition_major_output_buffers));
+        } else if (loop_stream_pool_indices) {
+          handle.sync_stream();
+        }
       }
     }
   }
+  if constexpr (GraphViewType::is_multi_gpu && update_major &&
+                !std::is_same_v<ReduceOp, reduce_op::any<T>>) {
+    if (reduce_pipeline) { reduce_pipeline->drain(); }
+  }
 
   // 10. communication
 
@@ -4340,7 +4700,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                       tmp_vertex_value_output_first,
                       static_cast<size_t>(
                         graph_view.vertex_partition_range_size(this_segment_vertex_partition_id)),
-                      ReduceOp::compatible_raft_comms_op,
+                      reduce_op::get_compatible_raft_comms_ops<ReduceOp>(),
                       i,
                       handle.get_stream());
       }
@@ -4361,7 +4721,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                       tmp_vertex_value_output_first,
                       static_cast<size_t>(
                         graph_view.vertex_partition_range_size(this_segment_vertex_partition_id)),
-                      ReduceOp::compatible_raft_comms_op,
+                      reduce_op::get_compatible_raft_comms_ops<ReduceOp>(),
                       i,
                       handle.get_stream());
       }
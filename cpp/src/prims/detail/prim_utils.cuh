@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 
@@ -22,6 +23,11 @@ namespace cugraph {
 
 namespace detail {
 
+// aggregate vertex list size (over major_comm) at or below which fill_edge_src|dst_property &
+// update_edge_src|dst_property (the versions taking a vertex list) use a single allgatherv
+// (latency-optimized, e.g. for sparse frontiers) instead of per-partition broadcasts
+size_t constexpr small_v_list_allgatherv_threshold = 8192;  // tuning parameter
+
 template <typename vertex_t, typename priority_t>
 __host__ __device__ priority_t
 rank_to_priority(int rank,
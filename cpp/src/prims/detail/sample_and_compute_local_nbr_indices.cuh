@@ -33,16 +33,19 @@
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/random/rng.cuh>
+#include <raft/random/rng_device.cuh>
 
 #include <cub/cub.cuh>
 #include <cuda/atomic>
 #include <cuda/functional>
 #include <cuda/std/optional>
 #include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/remove.h>
 #include <thrust/sort.h>
 #include <thrust/tabulate.h>
@@ -51,6 +54,7 @@
 
 #include <optional>
 #include <tuple>
+#include <type_traits>
 
 namespace cugraph {
 
@@ -58,6 +62,10 @@ namespace detail {
 
 int32_t constexpr sample_and_compute_local_nbr_indices_block_size = 256;
 
+// maximum K to use Floyd's algorithm in sampling without replacement from high-degree vertices
+size_t constexpr floyd_sampling_K_threshold =
+  static_cast<size_t>(raft::warp_size()) * size_t{4} /* tuning parameter */;
+
 size_t constexpr compute_valid_local_nbr_count_inclusive_sum_local_degree_threshold =
   packed_bools_per_word() *
   size_t{4} /* tuning parameter */;  // minimum local degree to compute inclusive sums of valid
@@ -642,6 +650,73 @@ compute_valid_local_nbr_count_inclusive_sums(raft::handle_t const& handle,
   return local_frontier_valid_local_nbr_count_inclusive_sums;
 }
 
+__device__ inline uint64_t mix_counter_based_rng_key(uint64_t x)  // splitmix64 finalizer
+{
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+// the Philox subsequence of a (tagged-)vertex key in the counter'th sampling call
+template <typename key_t>
+__device__ uint64_t counter_based_rng_subsequence(key_t key, uint64_t counter)
+{
+  auto h = mix_counter_based_rng_key(counter);
+  if constexpr (std::is_arithmetic_v<key_t>) {
+    h = mix_counter_based_rng_key(h ^ static_cast<uint64_t>(key));
+  } else {
+    h = mix_counter_based_rng_key(h ^ static_cast<uint64_t>(thrust::get<0>(key)));
+    h = mix_counter_based_rng_key(h ^ static_cast<uint64_t>(thrust::get<1>(key)));
+  }
+  return h;
+}
+
+// counter-based alternative to sample_nbr_index_with_replacement (used for tagged-vertex keys if
+// rng_state.type is raft::random::GenPhilox), the k'th random number of a key is generated on the fly from the
+// Philox generator keyed by (rng_state.seed, key, call counter, k). This does not materialize
+// random numbers and the sampled neighbor indices of a key do not depend on the key's position in
+// the frontier (so on the number of keys or how they are distributed over the GPUs). The call
+// counter is rng_state.base_subsequence and is advanced by one per call (every GPU should call
+// this function the same number of times with the same seed).
+template <typename edge_t, typename KeyIterator>
+void counter_based_sample_nbr_index_with_replacement(
+  raft::handle_t const& handle,
+  KeyIterator frontier_key_first,
+  raft::device_span<edge_t const> frontier_degrees,
+  raft::device_span<edge_t> nbr_indices /* [OUT] */,
+  raft::random::RngState& rng_state,
+  size_t K)
+{
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(frontier_degrees.size()),
+    [frontier_key_first,
+     frontier_degrees,
+     nbr_indices,
+     K,
+     seed        = rng_state.seed,
+     counter     = rng_state.base_subsequence,
+     invalid_idx = cugraph::invalid_edge_id_v<edge_t>] __device__(size_t i) {
+      auto degree = frontier_degrees[i];
+      if (degree == 0) {
+        for (size_t k = 0; k < K; ++k) {
+          nbr_indices[i * K + k] = invalid_idx;
+        }
+        return;
+      }
+      raft::random::PhiloxGenerator gen(
+        seed, counter_based_rng_subsequence(*(frontier_key_first + i), counter), uint64_t{0});
+      for (size_t k = 0; k < K; ++k) {
+        double r{};
+        gen.next(r);
+        nbr_indices[i * K + k] =
+          cuda::std::min(static_cast<edge_t>(r * static_cast<double>(degree)), degree - 1);
+      }
+    });
+  rng_state.advance(1);
+}
+
 template <typename edge_t, typename bias_t>
 void sample_nbr_index_with_replacement(
   raft::handle_t const& handle,
@@ -1060,6 +1135,51 @@ void sample_nbr_index_without_replacement(
   }
 }
 
+// Floyd's algorithm (one CUDA warp per key), the lanes in a warp cooperatively check whether a
+// newly drawn neighbor index has been already selected; the cost is O(K^2 / warp size) per key
+// (independent of the degree), so this is effective when K << degree and K is small
+template <typename edge_t>
+__global__ static void sample_nbr_index_without_replacement_floyd(
+  raft::device_span<edge_t const> frontier_degrees,
+  raft::device_span<size_t const> frontier_indices,
+  raft::device_span<edge_t> nbr_indices,
+  raft::random::DeviceState<raft::random::PCGenerator> device_state,
+  size_t K)
+{
+  static_assert(sample_and_compute_local_nbr_indices_block_size % raft::warp_size() == 0);
+
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = tid % raft::warp_size();
+
+  auto idx = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < frontier_indices.size()) {
+    auto frontier_idx = frontier_indices[idx];
+    auto degree       = frontier_degrees[frontier_idx];
+    assert(static_cast<size_t>(degree) > K);
+    auto samples = nbr_indices.data() + frontier_idx * K;
+
+    // every lane in a warp generates the same random number sequence
+    raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(frontier_idx));
+    for (size_t k = 0; k < K; ++k) {
+      auto j = static_cast<edge_t>(degree - K + k);
+      double r{};
+      gen.next(r);
+      auto nbr_idx = static_cast<edge_t>(r * static_cast<double>(j + 1));
+      if (nbr_idx > j) { nbr_idx = j; }  // to guard against floating point rounding
+      bool selected{false};
+      for (size_t l = lane_id; l < k; l += raft::warp_size()) {
+        if (samples[l] == nbr_idx) { selected = true; }
+      }
+      if (__any_sync(raft::warp_full_mask(), selected)) { nbr_idx = j; }
+      if (lane_id == 0) { samples[k] = nbr_idx; }
+      __syncwarp();
+    }
+
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
 template <typename edge_t>
 rmm::device_uvector<edge_t> compute_homogeneous_uniform_sampling_index_without_replacement(
   raft::handle_t const& handle,
@@ -1069,9 +1189,13 @@ rmm::device_uvector<edge_t> compute_homogeneous_uniform_sampling_index_without_r
 {
   using bias_t = double;
 
+  rmm::device_uvector<edge_t> nbr_indices(frontier_degrees.size() * K, handle.get_stream());
+  if (K == 0) { return nbr_indices; }
+
+  edge_t copy_partition_degree_range_last = static_cast<edge_t>(K + 1);  // exclusive
   edge_t low_partition_degree_range_last =
     static_cast<edge_t>(K * 10);  // exclusive, tuning parameter
-  assert(low_partition_degree_range_last >= K);
+  assert(low_partition_degree_range_last >= copy_partition_degree_range_last);
   size_t high_partition_oversampling_K = std::max(K * 2, K + 16);  // tuning parameter
   assert(high_partition_oversampling_K > K);
 
@@ -1079,24 +1203,64 @@ rmm::device_uvector<edge_t> compute_homogeneous_uniform_sampling_index_without_r
     partition_v_frontier(handle,
                          frontier_degrees.begin(),
                          frontier_degrees.end(),
-                         std::vector<edge_t>{low_partition_degree_range_last});
+                         std::vector<edge_t>{copy_partition_degree_range_last,
+                                             low_partition_degree_range_last});
 
-  rmm::device_uvector<edge_t> nbr_indices(frontier_degrees.size() * K, handle.get_stream());
+  // degree <= K, every neighbor is selected (no random number generation is necessary)
 
-  auto low_partition_size = frontier_partition_offsets[1];
+  auto copy_partition_size = frontier_partition_offsets[1];
+  if (copy_partition_size > 0) {
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(copy_partition_size * K),
+      [K,
+       frontier_degrees,
+       frontier_indices = frontier_indices.begin(),
+       nbr_indices      = raft::device_span<edge_t>(nbr_indices.data(), nbr_indices.size()),
+       invalid_idx      = cugraph::invalid_edge_id_v<edge_t>] __device__(size_t i) {
+        auto key_idx    = *(frontier_indices + i / K);
+        auto sample_idx = static_cast<edge_t>(i % K);
+        nbr_indices[key_idx * K + sample_idx] =
+          sample_idx < frontier_degrees[key_idx] ? sample_idx : invalid_idx;
+      });
+  }
+
+  // K < degree < K * 10, reservoir sampling (no sort)
+
+  auto low_partition_size = frontier_partition_offsets[2] - frontier_partition_offsets[1];
   if (low_partition_size > 0) {
     sample_nbr_index_without_replacement<edge_t, bias_t>(
       handle,
       frontier_degrees,
-      std::make_optional<raft::device_span<size_t const>>(frontier_indices.data(),
-                                                          low_partition_size),
+      std::make_optional<raft::device_span<size_t const>>(
+        frontier_indices.data() + frontier_partition_offsets[1], low_partition_size),
       raft::device_span<edge_t>(nbr_indices.data(), nbr_indices.size()),
       rng_state,
       K);
   }
 
-  auto high_partition_size = frontier_partition_offsets[2] - frontier_partition_offsets[1];
-  if (high_partition_size > 0) {
+  // degree >= K * 10, Floyd's algorithm if K is small enough, over-sample with replacement and
+  // take the first K unique samples (this requires segmented sorts) otherwise
+
+  auto high_partition_size = frontier_partition_offsets[3] - frontier_partition_offsets[2];
+  if ((high_partition_size > 0) && (K <= floyd_sampling_K_threshold)) {
+    raft::grid_1d_warp_t update_grid(high_partition_size,
+                                     sample_and_compute_local_nbr_indices_block_size,
+                                     handle.get_device_properties().maxGridSize[0]);
+    raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+    sample_nbr_index_without_replacement_floyd<<<update_grid.num_blocks,
+                                                 update_grid.block_size,
+                                                 0,
+                                                 handle.get_stream()>>>(
+      frontier_degrees,
+      raft::device_span<size_t const>(frontier_indices.data() + frontier_partition_offsets[2],
+                                      high_partition_size),
+      raft::device_span<edge_t>(nbr_indices.data(), nbr_indices.size()),
+      device_state,
+      K);
+    rng_state.advance(static_cast<uint64_t>(frontier_degrees.size()));
+  } else if (high_partition_size > 0) {
     // to limit memory footprint ((1 << 20) is a tuning parameter), std::max for forward progress
     // guarantee when high_partition_oversampling_K is exorbitantly large
     auto keys_to_sort_per_iteration =
@@ -1132,7 +1296,7 @@ rmm::device_uvector<edge_t> compute_homogeneous_uniform_sampling_index_without_r
       std::optional<rmm::device_uvector<size_t>> retry_segment_indices{std::nullopt};
 
       auto segment_frontier_index_first =
-        frontier_indices.begin() + frontier_partition_offsets[1] + keys_to_sort_per_iteration * i;
+        frontier_indices.begin() + frontier_partition_offsets[2] + keys_to_sort_per_iteration * i;
       auto segment_frontier_degree_first = thrust::make_transform_iterator(
         segment_frontier_index_first,
         indirection_t<size_t, decltype(frontier_degrees.begin())>{frontier_degrees.begin()});
@@ -1427,7 +1591,7 @@ rmm::device_uvector<edge_t> compute_homogeneous_uniform_sampling_index_without_r
         thrust::make_counting_iterator(num_segments * K),
         [K,
          high_partition_oversampling_K,
-         frontier_indices = frontier_indices.begin() + frontier_partition_offsets[1] +
+         frontier_indices = frontier_indices.begin() + frontier_partition_offsets[2] +
                             keys_to_sort_per_iteration * i,
          tmp_nbr_indices =
            raft::device_span<edge_t const>(tmp_nbr_indices.data(), tmp_nbr_indices.size()),
@@ -2803,6 +2967,29 @@ compute_aggregate_local_frontier_bias_type_pairs(
                          std::move(aggregate_local_frontier_local_degree_offsets));
 }
 
+// check whether the values are already in non-decreasing order in every segment; edge types are
+// often sorted within each neighbor list (e.g. if vertices are renumbered by vertex type and edge
+// types are determined by the destination vertex types), and segmented sorting can be skipped then
+template <typename value_t>
+bool are_segmented_values_sorted(raft::handle_t const& handle,
+                                 raft::device_span<value_t const> values,
+                                 raft::device_span<size_t const> segment_offsets)
+{
+  if (values.size() <= 1) { return true; }
+  return !thrust::any_of(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(size_t{1}),
+    thrust::make_counting_iterator(values.size()),
+    [values, segment_offsets] __device__(size_t i) {
+      if (values[i - 1] <= values[i]) { return false; }
+      return !thrust::binary_search(
+        thrust::seq,
+        segment_offsets.begin(),
+        segment_offsets.end(),
+        i);  // a decrease at a segment boundary does not matter
+    });
+}
+
 // return (edge types, segment offsets) pairs for each key in the aggregate local frontier
 template <typename GraphViewType, typename KeyIterator, typename EdgeTypeInputWrapper>
 std::tuple<rmm::device_uvector<typename EdgeTypeInputWrapper::value_type>,
@@ -5033,9 +5220,11 @@ homogeneous_uniform_sample_and_compute_local_nbr_indices(
   using key_t    = typename thrust::iterator_traits<KeyIterator>::value_type;
   using bias_t   = double;
 
+  int minor_comm_rank{0};
   int minor_comm_size{1};
   if constexpr (GraphViewType::is_multi_gpu) {
     auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    minor_comm_rank  = minor_comm.get_rank();
     minor_comm_size  = minor_comm.get_size();
   }
   assert(minor_comm_size == graph_view.number_of_local_edge_partitions());
@@ -5073,7 +5262,19 @@ homogeneous_uniform_sample_and_compute_local_nbr_indices(
 
   rmm::device_uvector<edge_t> nbr_indices(0, handle.get_stream());
 
-  if (with_replacement) {
+  // counter-based random number generation is used only for tagged-vertex keys (as identical keys
+  // draw identical samples, tags are necessary to distinguish duplicate vertices in the frontier)
+  if (!std::is_same_v<key_t, vertex_t> && with_replacement &&
+      (rng_state.type == raft::random::GenPhilox)) {
+    nbr_indices.resize(frontier_degrees.size() * K, handle.get_stream());
+    counter_based_sample_nbr_index_with_replacement(
+      handle,
+      aggregate_local_frontier_key_first + local_frontier_offsets[minor_comm_rank],
+      raft::device_span<edge_t const>(frontier_degrees.data(), frontier_degrees.size()),
+      raft::device_span<edge_t>(nbr_indices.data(), nbr_indices.size()),
+      rng_state,
+      K);
+  } else if (with_replacement) {
     if (frontier_degrees.size() > 0) {
       nbr_indices.resize(frontier_degrees.size() * K, handle.get_stream());
       sample_nbr_index_with_replacement<edge_t, bias_t>(
@@ -5198,12 +5399,32 @@ heterogeneous_uniform_sample_and_compute_local_nbr_indices(
       raft::host_span<size_t const>(local_frontier_unique_key_offsets.data(),
                                     local_frontier_unique_key_offsets.size()));
 
-  // 2. Segment-sort (index, type) pairs on types (1 segment per key)
+  // 2. Segment-sort (index, type) pairs on types (1 segment per key, skipped if the types are
+  // already sorted in every segment)
 
   rmm::device_uvector<edge_t> aggregate_local_frontier_unique_key_org_indices(
     aggregate_local_frontier_unique_key_edge_types.size(), handle.get_stream());
 
-  {
+  if (are_segmented_values_sorted(
+        handle,
+        raft::device_span<edge_type_t const>(aggregate_local_frontier_unique_key_edge_types.data(),
+                                             aggregate_local_frontier_unique_key_edge_types.size()),
+        raft::device_span<size_t const>(
+          aggregate_local_frontier_unique_key_local_degree_offsets.data(),
+          aggregate_local_frontier_unique_key_local_degree_offsets.size()))) {
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      aggregate_local_frontier_unique_key_org_indices.begin(),
+      aggregate_local_frontier_unique_key_org_indices.end(),
+      [offsets = raft::device_span<size_t const>(
+         aggregate_local_frontier_unique_key_local_degree_offsets.data(),
+         aggregate_local_frontier_unique_key_local_degree_offsets.size())] __device__(size_t i) {
+        auto idx = thrust::distance(
+          offsets.begin() + 1,
+          thrust::upper_bound(thrust::seq, offsets.begin() + 1, offsets.end(), i));
+        return static_cast<edge_t>(i - offsets[idx]);
+      });
+  } else {
     // to limit memory footprint ((1 << 20) is a tuning parameter)
     auto approx_nbrs_to_sort_per_iteration =
       static_cast<size_t>(handle.get_device_properties().multiProcessorCount * (1 << 20));
@@ -5662,6 +5883,193 @@ homogeneous_biased_sample_and_compute_local_nbr_indices(
     std::move(local_nbr_indices), std::move(key_indices), std::move(local_frontier_sample_offsets));
 }
 
+// biased sampling with replacement using pre-computed per-vertex inclusive sums of the edge bias
+// values (see compute_edge_bias_inclusive_sums), this skips collecting and scanning the frontier
+// vertices' neighbor bias values and each sample is drawn with a binary search on the pre-computed
+// inclusive sums (O(log(local degree)) per sample), the graph should not have an edge mask
+template <typename GraphViewType, typename KeyIterator, typename bias_t>
+std::tuple<rmm::device_uvector<typename GraphViewType::edge_type>,
+           std::optional<rmm::device_uvector<size_t>>,
+           std::vector<size_t>>
+homogeneous_biased_sample_with_replacement_and_compute_local_nbr_indices(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  KeyIterator aggregate_local_frontier_key_first,
+  edge_property_view_t<typename GraphViewType::edge_type, bias_t const*>
+    edge_bias_inclusive_sum_view,
+  raft::host_span<size_t const> local_frontier_offsets,
+  raft::random::RngState& rng_state,
+  size_t K)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  int minor_comm_rank{0};
+  int minor_comm_size{1};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    minor_comm_rank  = minor_comm.get_rank();
+    minor_comm_size  = minor_comm.get_size();
+  }
+  assert(minor_comm_size == graph_view.number_of_local_edge_partitions());
+
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(),
+                  "Invalid input argument: pre-computed edge bias inclusive sums cannot be used "
+                  "if the graph has an attached edge mask.");
+
+  auto aggregate_local_frontier_major_first =
+    thrust_tuple_get_or_identity<KeyIterator, 0>(aggregate_local_frontier_key_first);
+
+  // 1. collect local bias sums (the last inclusive sum values of the local neighbors)
+
+  rmm::device_uvector<bias_t> aggregate_local_frontier_bias_local_sums(
+    local_frontier_offsets.back(), handle.get_stream());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+        graph_view.local_edge_partition_view(i));
+    auto edge_partition_bias_inclusive_sums =
+      edge_partition_edge_property_device_view_t<edge_t, bias_t const*>(
+        edge_bias_inclusive_sum_view, i);
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      aggregate_local_frontier_major_first + local_frontier_offsets[i],
+      aggregate_local_frontier_major_first + local_frontier_offsets[i + 1],
+      aggregate_local_frontier_bias_local_sums.begin() + local_frontier_offsets[i],
+      cuda::proclaim_return_type<bias_t>(
+        [edge_partition, edge_partition_bias_inclusive_sums] __device__(auto major) {
+          auto major_idx = edge_partition.major_idx_from_major_nocheck(major);
+          if (major_idx) {
+            auto edge_offset  = edge_partition.local_offset(*major_idx);
+            auto local_degree = edge_partition.local_degree(*major_idx);
+            if (local_degree > 0) {
+              return edge_partition_bias_inclusive_sums.get(edge_offset + local_degree - 1);
+            }
+          }
+          return bias_t{0.0};
+        }));
+  }
+
+  rmm::device_uvector<bias_t> frontier_bias_sums(0, handle.get_stream());
+  std::optional<rmm::device_uvector<bias_t>> frontier_partitioned_bias_local_sum_displacements{
+    std::nullopt};
+  if (minor_comm_size > 1) {
+    std::tie(frontier_bias_sums, frontier_partitioned_bias_local_sum_displacements) =
+      compute_frontier_value_sums_and_partitioned_local_value_sum_displacements(
+        handle,
+        raft::device_span<bias_t const>(aggregate_local_frontier_bias_local_sums.data(),
+                                        aggregate_local_frontier_bias_local_sums.size()),
+        local_frontier_offsets,
+        size_t{1});
+    aggregate_local_frontier_bias_local_sums.resize(0, handle.get_stream());
+    aggregate_local_frontier_bias_local_sums.shrink_to_fit(handle.get_stream());
+  } else {
+    frontier_bias_sums = std::move(aggregate_local_frontier_bias_local_sums);
+  }
+
+  // 2. generate & shuffle random numbers
+
+  rmm::device_uvector<bias_t> sample_random_numbers(
+    (local_frontier_offsets[minor_comm_rank + 1] - local_frontier_offsets[minor_comm_rank]) * K,
+    handle.get_stream());
+  cugraph::detail::uniform_random_fill(handle.get_stream(),
+                                       sample_random_numbers.data(),
+                                       sample_random_numbers.size(),
+                                       bias_t{0.0},
+                                       bias_t{1.0},
+                                       rng_state);
+  thrust::transform(
+    handle.get_thrust_policy(),
+    sample_random_numbers.begin(),
+    sample_random_numbers.end(),
+    thrust::make_counting_iterator(size_t{0}),
+    sample_random_numbers.begin(),
+    cuda::proclaim_return_type<bias_t>(
+      [frontier_bias_sums =
+         raft::device_span<bias_t const>(frontier_bias_sums.data(), frontier_bias_sums.size()),
+       K,
+       invalid_value = std::numeric_limits<bias_t>::infinity()] __device__(bias_t r, size_t i) {
+        // bias_sum will be 0 if degree is 0 or all the edges have 0 bias
+        auto bias_sum = frontier_bias_sums[i / K];
+        return bias_sum > 0.0 ? r * bias_sum : invalid_value;
+      }));
+
+  rmm::device_uvector<bias_t> sample_local_random_numbers(0, handle.get_stream());
+  std::optional<rmm::device_uvector<size_t>> key_indices{std::nullopt};
+  std::vector<size_t> local_frontier_sample_offsets{};
+  if (minor_comm_size > 1) {
+    std::tie(sample_local_random_numbers, key_indices, local_frontier_sample_offsets) =
+      shuffle_and_compute_local_nbr_values<bias_t>(
+        handle,
+        std::move(sample_random_numbers),
+        raft::device_span<bias_t const>(
+          (*frontier_partitioned_bias_local_sum_displacements).data(),
+          (*frontier_partitioned_bias_local_sum_displacements).size()),
+        K,
+        std::numeric_limits<bias_t>::infinity());
+  } else {
+    sample_local_random_numbers   = std::move(sample_random_numbers);
+    local_frontier_sample_offsets = {size_t{0}, sample_local_random_numbers.size()};
+  }
+
+  // 3. find the local neighbor indices with a binary search on the inclusive sums
+
+  rmm::device_uvector<edge_t> local_nbr_indices(sample_local_random_numbers.size(),
+                                                handle.get_stream());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+        graph_view.local_edge_partition_view(i));
+    auto edge_partition_bias_inclusive_sums =
+      edge_partition_edge_property_device_view_t<edge_t, bias_t const*>(
+        edge_bias_inclusive_sum_view, i);
+
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      local_nbr_indices.begin() + local_frontier_sample_offsets[i],
+      local_nbr_indices.begin() + local_frontier_sample_offsets[i + 1],
+      [sample_local_random_numbers = raft::device_span<bias_t const>(
+         sample_local_random_numbers.data() + local_frontier_sample_offsets[i],
+         local_frontier_sample_offsets[i + 1] - local_frontier_sample_offsets[i]),
+       key_indices                 = key_indices
+                                       ? cuda::std::make_optional<raft::device_span<size_t const>>(
+                           (*key_indices).data() + local_frontier_sample_offsets[i],
+                           local_frontier_sample_offsets[i + 1] - local_frontier_sample_offsets[i])
+                                       : cuda::std::nullopt,
+       edge_partition_frontier_major_first =
+         aggregate_local_frontier_major_first + local_frontier_offsets[i],
+       edge_partition,
+       edge_partition_bias_inclusive_sums,
+       K,
+       invalid_random_number = std::numeric_limits<bias_t>::infinity(),
+       invalid_idx           = cugraph::invalid_edge_id_v<edge_t>] __device__(size_t i) {
+        auto local_random_number = sample_local_random_numbers[i];
+        if (local_random_number != invalid_random_number) {
+          auto key_idx   = key_indices ? (*key_indices)[i] : (i / K);
+          auto major     = *(edge_partition_frontier_major_first + key_idx);
+          auto major_idx = edge_partition.major_idx_from_major_nocheck(major);
+          assert(major_idx.has_value());  // local bias sum is 0 otherwise
+          auto edge_offset         = edge_partition.local_offset(*major_idx);
+          auto local_degree        = edge_partition.local_degree(*major_idx);
+          auto inclusive_sum_first = edge_partition_bias_inclusive_sums.value_first() + edge_offset;
+          auto local_nbr_idx       = static_cast<edge_t>(thrust::distance(
+            inclusive_sum_first,
+            thrust::upper_bound(thrust::seq,
+                                inclusive_sum_first,
+                                inclusive_sum_first + local_degree,
+                                local_random_number)));
+          return cuda::std::min(local_nbr_idx, local_degree - 1);
+        } else {
+          return invalid_idx;
+        }
+      });
+  }
+
+  return std::make_tuple(
+    std::move(local_nbr_indices), std::move(key_indices), std::move(local_frontier_sample_offsets));
+}
+
 template <typename GraphViewType,
           typename KeyIterator,
           typename EdgeSrcValueInputWrapper,
@@ -5736,9 +6144,16 @@ heterogeneous_biased_sample_and_compute_local_nbr_indices(
                                     local_frontier_unique_key_offsets.size()),
       do_expensive_check);
 
-  // 2. Segmented-sort (index, bias, type) triplets based on types (1 segment per key)
+  // 2. Segmented-sort (index, bias, type) triplets based on types (1 segment per key, skipped if
+  // the types are already sorted in every segment)
 
-  {
+  if (!are_segmented_values_sorted(
+        handle,
+        raft::device_span<edge_type_t const>(aggregate_local_frontier_unique_key_edge_types.data(),
+                                             aggregate_local_frontier_unique_key_edge_types.size()),
+        raft::device_span<size_t const>(
+          aggregate_local_frontier_unique_key_local_degree_offsets.data(),
+          aggregate_local_frontier_unique_key_local_degree_offsets.size()))) {
     // to limit memory footprint ((1 << 20) is a tuning parameter)
     auto approx_nbrs_to_sort_per_iteration =
       static_cast<size_t>(handle.get_device_properties().multiProcessorCount * (1 << 20));
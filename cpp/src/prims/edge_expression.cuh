@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/transform_reduce_e.cuh"
+
+#include <raft/core/handle.hpp>
+
+namespace cugraph {
+
+namespace detail {
+
+// evaluates first_op and feeds its output to second_op as the edge property value
+template <typename FirstEdgeOp, typename SecondEdgeOp>
+struct chained_e_op_t {
+  FirstEdgeOp first_op{};
+  SecondEdgeOp second_op{};
+
+  template <typename key_t,
+            typename vertex_t,
+            typename src_value_t,
+            typename dst_value_t,
+            typename e_value_t>
+  __device__ auto operator()(
+    key_t src, vertex_t dst, src_value_t src_val, dst_value_t dst_val, e_value_t e_val) const
+  {
+    return second_op(src, dst, src_val, dst_val, first_op(src, dst, src_val, dst_val, e_val));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lazily evaluated edge expression.
+ *
+ * An edge expression bundles the edge source, destination, and edge property inputs with a quinary
+ * edge operator. Expressions are composed with then() (no edge pass is executed), and the composed
+ * operator is evaluated in a single pass over the edges when the expression is passed to
+ * transform_reduce_e, per_v_transform_reduce_incoming_e, or per_v_transform_reduce_outgoing_e. This
+ * replaces a transform_e call materializing an intermediate edge property followed by another edge
+ * pass consuming it. Use transform_e to materialize an expression when the values are reused.
+ *
+ * @tparam EdgeSrcValueInputWrapper Type of the wrapper for input edge source property values.
+ * @tparam EdgeDstValueInputWrapper Type of the wrapper for input edge destination property values.
+ * @tparam EdgeValueInputWrapper Type of the wrapper for input edge property values.
+ * @tparam EdgeOp Type of the quinary edge operator.
+ */
+template <typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp>
+class edge_expression_t {
+ public:
+  edge_expression_t(EdgeSrcValueInputWrapper edge_src_value_input,
+                    EdgeDstValueInputWrapper edge_dst_value_input,
+                    EdgeValueInputWrapper edge_value_input,
+                    EdgeOp e_op)
+    : edge_src_value_input_(edge_src_value_input),
+      edge_dst_value_input_(edge_dst_value_input),
+      edge_value_input_(edge_value_input),
+      e_op_(e_op)
+  {
+  }
+
+  /**
+   * @brief Compose this expression with another quinary edge operator.
+   *
+   * @tparam NextEdgeOp Type of the quinary edge operator to apply next.
+   * @param next_e_op Quinary operator takes edge source, edge destination, property values for the
+   * source and destination (the same inputs of this expression), and the output of this
+   * expression's edge operator (in place of the edge property value).
+   * @return edge_expression_t A new expression evaluating @p next_e_op on this expression's output.
+   */
+  template <typename NextEdgeOp>
+  auto then(NextEdgeOp next_e_op) const
+  {
+    return edge_expression_t<EdgeSrcValueInputWrapper,
+                             EdgeDstValueInputWrapper,
+                             EdgeValueInputWrapper,
+                             detail::chained_e_op_t<EdgeOp, NextEdgeOp>>(
+      edge_src_value_input_,
+      edge_dst_value_input_,
+      edge_value_input_,
+      detail::chained_e_op_t<EdgeOp, NextEdgeOp>{e_op_, next_e_op});
+  }
+
+  EdgeSrcValueInputWrapper edge_src_value_input() const { return edge_src_value_input_; }
+  EdgeDstValueInputWrapper edge_dst_value_input() const { return edge_dst_value_input_; }
+  EdgeValueInputWrapper edge_value_input() const { return edge_value_input_; }
+  EdgeOp e_op() const { return e_op_; }
+
+ private:
+  EdgeSrcValueInputWrapper edge_src_value_input_;
+  EdgeDstValueInputWrapper edge_dst_value_input_;
+  EdgeValueInputWrapper edge_value_input_;
+  EdgeOp e_op_;
+};
+
+/**
+ * @brief Create an edge expression.
+ *
+ * @param edge_src_value_input Wrapper used to access source input property values (for the edge
+ * sources assigned to this process in multi-GPU). Use either cugraph::edge_src_property_t::view()
+ * or cugraph::edge_src_dummy_property_t::view().
+ * @param edge_dst_value_input Wrapper used to access destination input property values (for the
+ * edge destinations assigned to this process in multi-GPU). Use either
+ * cugraph::edge_dst_property_t::view() or cugraph::edge_dst_dummy_property_t::view().
+ * @param edge_value_input Wrapper used to access edge input property values (for the edges assigned
+ * to this process in multi-GPU). Use either cugraph::edge_property_t::view() or
+ * cugraph::edge_dummy_property_t::view().
+ * @param e_op Quinary operator takes edge source, edge destination, property values for the source,
+ * destination, and edge and returns the value of the expression.
+ * @return edge_expression_t The edge expression (not evaluated yet).
+ */
+template <typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp>
+auto make_edge_expression(EdgeSrcValueInputWrapper edge_src_value_input,
+                          EdgeDstValueInputWrapper edge_dst_value_input,
+                          EdgeValueInputWrapper edge_value_input,
+                          EdgeOp e_op)
+{
+  return edge_expression_t<EdgeSrcValueInputWrapper,
+                           EdgeDstValueInputWrapper,
+                           EdgeValueInputWrapper,
+                           EdgeOp>(
+    edge_src_value_input, edge_dst_value_input, edge_value_input, e_op);
+}
+
+/**
+ * @brief Evaluate an edge expression and store the values in an edge property (materialize).
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param expression Edge expression to evaluate.
+ * @param edge_value_output Wrapper used to store edge output property values (for the edges
+ * assigned to this process in multi-GPU). Use cugraph::edge_property_t::mutable_view().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename GraphViewType,
+          typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename EdgeValueOutputWrapper>
+void transform_e(raft::handle_t const& handle,
+                 GraphViewType const& graph_view,
+                 edge_expression_t<EdgeSrcValueInputWrapper,
+                                   EdgeDstValueInputWrapper,
+                                   EdgeValueInputWrapper,
+                                   EdgeOp> const& expression,
+                 EdgeValueOutputWrapper edge_value_output,
+                 bool do_expensive_check = false)
+{
+  transform_e(handle,
+              graph_view,
+              expression.edge_src_value_input(),
+              expression.edge_dst_value_input(),
+              expression.edge_value_input(),
+              expression.e_op(),
+              edge_value_output,
+              do_expensive_check);
+}
+
+/**
+ * @brief Evaluate an edge expression over the entire set of edges and reduce the values.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param expression Edge expression to evaluate.
+ * @param init Initial value to be added to the reduced expression values.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return T Transform-reduced expression values.
+ */
+template <typename GraphViewType,
+          typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     edge_expression_t<EdgeSrcValueInputWrapper,
+                                       EdgeDstValueInputWrapper,
+                                       EdgeValueInputWrapper,
+                                       EdgeOp> const& expression,
+                     T init,
+                     bool do_expensive_check = false)
+{
+  return transform_reduce_e(handle,
+                            graph_view,
+                            expression.edge_src_value_input(),
+                            expression.edge_dst_value_input(),
+                            expression.edge_value_input(),
+                            expression.e_op(),
+                            init,
+                            do_expensive_check);
+}
+
+/**
+ * @brief Evaluate an edge expression over the incoming edges and reduce the values per destination.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param expression Edge expression to evaluate.
+ * @param init Initial value to be reduced with the reduced expression values for each vertex.
+ * @param reduce_op Binary operator that takes two input arguments and reduce the two values to one.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename GraphViewType,
+          typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void per_v_transform_reduce_incoming_e(raft::handle_t const& handle,
+                                       GraphViewType const& graph_view,
+                                       edge_expression_t<EdgeSrcValueInputWrapper,
+                                                         EdgeDstValueInputWrapper,
+                                                         EdgeValueInputWrapper,
+                                                         EdgeOp> const& expression,
+                                       T init,
+                                       ReduceOp reduce_op,
+                                       VertexValueOutputIterator vertex_value_output_first,
+                                       bool do_expensive_check = false)
+{
+  per_v_transform_reduce_incoming_e(handle,
+                                    graph_view,
+                                    expression.edge_src_value_input(),
+                                    expression.edge_dst_value_input(),
+                                    expression.edge_value_input(),
+                                    expression.e_op(),
+                                    init,
+                                    reduce_op,
+                                    vertex_value_output_first,
+                                    do_expensive_check);
+}
+
+/**
+ * @brief Evaluate an edge expression over the outgoing edges and reduce the values per source.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param expression Edge expression to evaluate.
+ * @param init Initial value to be reduced with the reduced expression values for each vertex.
+ * @param reduce_op Binary operator that takes two input arguments and reduce the two values to one.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename GraphViewType,
+          typename EdgeSrcValueInputWrapper,
+          typename EdgeDstValueInputWrapper,
+          typename EdgeValueInputWrapper,
+          typename EdgeOp,
+          typename ReduceOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void per_v_transform_reduce_outgoing_e(raft::handle_t const& handle,
+                                       GraphViewType const& graph_view,
+                                       edge_expression_t<EdgeSrcValueInputWrapper,
+                                                         EdgeDstValueInputWrapper,
+                                                         EdgeValueInputWrapper,
+                                                         EdgeOp> const& expression,
+                                       T init,
+                                       ReduceOp reduce_op,
+                                       VertexValueOutputIterator vertex_value_output_first,
+                                       bool do_expensive_check = false)
+{
+  per_v_transform_reduce_outgoing_e(handle,
+                                    graph_view,
+                                    expression.edge_src_value_input(),
+                                    expression.edge_dst_value_input(),
+                                    expression.edge_value_input(),
+                                    expression.e_op(),
+                                    init,
+                                    reduce_op,
+                                    vertex_value_output_first,
+                                    do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "prims/detail/prim_utils.cuh"
 #include "prims/vertex_frontier.cuh"
 
 #include <cugraph/edge_partition_device_view.cuh>
@@ -22,20 +23,26 @@
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/atomic_ops.cuh>
+#include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/packed_bool_utils.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 
 #include <raft/core/handle.hpp>
 
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/count.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 
 #include <cstddef>
+#include <numeric>
 #include <utility>
+#include <vector>
 
 namespace cugraph {
 
@@ -402,6 +409,58 @@ void fill_edge_minor_property(raft::handle_t const& handle,
 
     auto edge_partition_keys = edge_minor_property_output.keys();
 
+    size_t aggregate_v_list_size{0};
+    for (int i = 0; i < major_comm_size; ++i) {
+      aggregate_v_list_size += static_cast<size_t>(local_v_list_sizes[i]);
+    }
+    if (aggregate_v_list_size <= small_v_list_allgatherv_threshold) {
+      // latency-optimized path: collect every vertex list in major_comm with a single allgatherv
+      // (skipping the bitmap/compressed vertex list setup, stream pool setup, and per-partition
+      // broadcasts) and update the values with a single kernel
+      std::vector<size_t> rx_counts(major_comm_size);
+      std::vector<size_t> rx_displacements(major_comm_size);
+      for (int i = 0; i < major_comm_size; ++i) {
+        rx_counts[i] = static_cast<size_t>(local_v_list_sizes[i]);
+      }
+      std::exclusive_scan(rx_counts.begin(), rx_counts.end(), rx_displacements.begin(), size_t{0});
+      rmm::device_uvector<vertex_t> rx_vertices(aggregate_v_list_size, handle.get_stream());
+      device_allgatherv(major_comm,
+                        sorted_unique_vertex_first,
+                        rx_vertices.begin(),
+                        rx_counts,
+                        rx_displacements,
+                        handle.get_stream());
+
+      // keys (if valid) are sorted over the entire minor range (key_offsets split the keys by
+      // vertex partition)
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        rx_vertices.begin(),
+        rx_vertices.end(),
+        [key_first = edge_partition_keys ? (*edge_partition_keys).begin()
+                                         : static_cast<vertex_t const*>(nullptr),
+         key_last  = edge_partition_keys ? (*edge_partition_keys).end()
+                                         : static_cast<vertex_t const*>(nullptr),
+         minor_range_first,
+         input,
+         output_value_first = edge_partition_value_first] __device__(auto minor) {
+          vertex_t minor_offset{};
+          if (key_first != nullptr) {
+            auto it = thrust::lower_bound(thrust::seq, key_first, key_last, minor);
+            if ((it == key_last) || (*it != minor)) { return; }
+            minor_offset = static_cast<vertex_t>(thrust::distance(key_first, it));
+          } else {
+            minor_offset = minor - minor_range_first;
+          }
+          if constexpr (contains_packed_bool_element) {
+            fill_scalar_or_thrust_tuple(output_value_first, minor_offset, input);
+          } else {
+            *(output_value_first + minor_offset) = input;
+          }
+        });
+      return;
+    }
+
     std::optional<rmm::device_uvector<uint32_t>> v_list_bitmap{std::nullopt};
     std::optional<rmm::device_uvector<uint32_t>> compressed_v_list{std::nullopt};
     if (major_comm_size > 1) {
@@ -579,8 +638,6 @@ void fill_edge_minor_property(raft::handle_t const& handle,
     }
 
     for (size_t i = 0; i < static_cast<size_t>(major_comm_size); i += num_concurrent_bcasts) {
-      RAFT_CUDA_TRY(cudaDeviceSynchronize());
-      auto sub0       = std::chrono::steady_clock::now();
       auto loop_count = std::min(num_concurrent_bcasts, static_cast<size_t>(major_comm_size) - i);
 
       if (is_packed_bool<typename EdgeMinorPropertyOutputWrapper::value_iterator,
@@ -1019,6 +1076,10 @@ void fill_edge_src_property(raft::handle_t const& handle,
                             T input,
                             bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "fill_edge_src_property");
+  CUGRAPH_EXPECTS(!edge_src_property_output.default_value(),
+                  "Invalid input argument: sparse edge source property values are read-only "
+                  "(re-create them with create_sparse_edge_src_property).");
   static_assert(std::is_same_v<T, typename EdgeSrcValueOutputWrapper::value_type>);
   if (do_expensive_check) {
     // currently, nothing to do
@@ -1067,6 +1128,10 @@ void fill_edge_src_property(raft::handle_t const& handle,
                             T input,
                             bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "fill_edge_src_property");
+  CUGRAPH_EXPECTS(!edge_src_property_output.default_value(),
+                  "Invalid input argument: sparse edge source property values are read-only "
+                  "(re-create them with create_sparse_edge_src_property).");
   static_assert(std::is_same_v<T, typename EdgeSrcValueOutputWrapper::value_type>);
   if (do_expensive_check) {
     auto num_invalids = thrust::count_if(
@@ -1130,6 +1195,10 @@ void fill_edge_dst_property(raft::handle_t const& handle,
                             T input,
                             bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "fill_edge_dst_property");
+  CUGRAPH_EXPECTS(!edge_dst_property_output.default_value(),
+                  "Invalid input argument: sparse edge destination property values are read-only "
+                  "(re-create them with create_sparse_edge_dst_property).");
   static_assert(std::is_same_v<T, typename EdgeDstValueOutputWrapper::value_type>);
   if (do_expensive_check) {
     // currently, nothing to do
@@ -1179,6 +1248,10 @@ void fill_edge_dst_property(raft::handle_t const& handle,
                             T input,
                             bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "fill_edge_dst_property");
+  CUGRAPH_EXPECTS(!edge_dst_property_output.default_value(),
+                  "Invalid input argument: sparse edge destination property values are read-only "
+                  "(re-create them with create_sparse_edge_dst_property).");
   static_assert(std::is_same_v<T, typename EdgeDstValueOutputWrapper::value_type>);
   if (do_expensive_check) {
     auto num_invalids = thrust::count_if(
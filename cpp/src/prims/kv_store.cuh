@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@
 #include <cugraph/utilities/dataframe_buffer.hpp>
 #include <cugraph/utilities/device_functors.cuh>
 
+#include <raft/util/cudart_utils.hpp>
+
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
@@ -33,13 +35,16 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
 #include <thrust/remove.h>
 #include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/unique.h>
 
 #include <cuco/static_map.cuh>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <type_traits>
@@ -55,6 +60,94 @@ namespace detail {
 
 using cuco_storage_type = cuco::storage<1>;  ///< cuco window storage type
 
+// lookups use the linear model if the search range (2 * max_error + 1) is at most
+// 1 / kv_linear_model_min_range_reduction_ratio of the number of keys
+size_t constexpr kv_linear_model_min_range_reduction_ratio{16};
+
+// a linear model predicting the position of a key in the sorted store keys (a single segment
+// learned index), a stored key is within max_error of the predicted position, so lookups can binary
+// search this narrower range instead of the entire key array (this is effective for near-contiguous
+// keys, e.g. renumber maps)
+template <typename key_t>
+struct kv_linear_model_t {
+  key_t min_key{};
+  double slope{0.0};
+  size_t max_error{std::numeric_limits<size_t>::max()};  // max() if the model is not used
+
+  __host__ __device__ bool is_valid() const
+  {
+    return max_error != std::numeric_limits<size_t>::max();
+  }
+
+  __host__ __device__ size_t predict(key_t key, size_t num_keys) const
+  {
+    if (key <= min_key) { return size_t{0}; }
+    auto pos = (static_cast<double>(key) - static_cast<double>(min_key)) * slope;
+    return pos < static_cast<double>(num_keys - 1) ? static_cast<size_t>(pos) : num_keys - 1;
+  }
+};
+
+template <typename KeyIterator, typename key_t>
+__device__ KeyIterator kv_lower_bound(KeyIterator store_key_first,
+                                      KeyIterator store_key_last,
+                                      key_t key,
+                                      kv_linear_model_t<key_t> model)
+{
+  if (!model.is_valid()) {
+    return thrust::lower_bound(thrust::seq, store_key_first, store_key_last, key);
+  }
+  auto num_keys = static_cast<size_t>(thrust::distance(store_key_first, store_key_last));
+  auto pos      = model.predict(key, num_keys);
+  auto first    = pos > model.max_error ? pos - model.max_error : size_t{0};
+  auto last     = (num_keys - pos > model.max_error + 1) ? pos + model.max_error + 1 : num_keys;
+  auto it = thrust::lower_bound(thrust::seq, store_key_first + first, store_key_first + last, key);
+  return (it == store_key_first + last) ? store_key_last : it;
+}
+
+template <typename key_t>
+struct kv_linear_model_error_t {
+  key_t const* store_key_first{};
+  size_t num_keys{};
+  kv_linear_model_t<key_t> model{};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto pos = model.predict(store_key_first[i], num_keys);
+    return pos > i ? pos - i : i - pos;
+  }
+};
+
+// the keys should be sorted
+template <typename key_t>
+kv_linear_model_t<key_t> build_kv_linear_model(key_t const* store_key_first,
+                                               size_t num_keys,
+                                               rmm::cuda_stream_view stream)
+{
+  kv_linear_model_t<key_t> model{};
+  if constexpr (std::is_integral_v<key_t>) {
+    if (num_keys < kv_linear_model_min_range_reduction_ratio) { return model; }
+    key_t min_max[2]{};
+    raft::update_host(min_max, store_key_first, 1, stream);
+    raft::update_host(min_max + 1, store_key_first + (num_keys - 1), 1, stream);
+    stream.synchronize();
+    if (min_max[1] == min_max[0]) { return model; }
+    model.min_key = min_max[0];
+    model.slope   = static_cast<double>(num_keys - 1) /
+                  (static_cast<double>(min_max[1]) - static_cast<double>(min_max[0]));
+    model.max_error = thrust::transform_reduce(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_keys),
+      kv_linear_model_error_t<key_t>{store_key_first, num_keys, model},
+      size_t{0},
+      thrust::maximum<size_t>{});
+    if ((2 * model.max_error + 1) * kv_linear_model_min_range_reduction_ratio > num_keys) {
+      model.max_error = std::numeric_limits<size_t>::max();
+    }
+  }
+  return model;
+}
+
 template <typename KeyIterator, typename ValueIterator>
 struct kv_binary_search_find_op_t {
   using key_type   = typename thrust::iterator_traits<KeyIterator>::value_type;
@@ -65,10 +158,11 @@ struct kv_binary_search_find_op_t {
   ValueIterator store_value_first{};
 
   value_type invalid_value{};
+  kv_linear_model_t<key_type> model{};
 
   __device__ value_type operator()(key_type key) const
   {
-    auto it = thrust::lower_bound(thrust::seq, store_key_first, store_key_last, key);
+    auto it = kv_lower_bound(store_key_first, store_key_last, key, model);
     if (it != store_key_last && *it == key) {
       return *(store_value_first + thrust::distance(store_key_first, it));
     } else {
@@ -83,10 +177,12 @@ struct kv_binary_search_contains_op_t {
 
   KeyIterator store_key_first{};
   KeyIterator store_key_last{};
+  kv_linear_model_t<key_type> model{};
 
   __device__ bool operator()(key_type key) const
   {
-    return thrust::binary_search(thrust::seq, store_key_first, store_key_last, key);
+    auto it = kv_lower_bound(store_key_first, store_key_last, key, model);
+    return (it != store_key_last) && (*it == key);
   }
 };
 
@@ -168,13 +264,14 @@ struct kv_binary_search_store_device_view_t {
     : store_key_first(view.store_key_first()),
       store_key_last(view.store_key_last()),
       store_value_first(view.store_value_first()),
-      invalid_value(view.invalid_value())
+      invalid_value(view.invalid_value()),
+      model(view.linear_model())
   {
   }
 
   __device__ value_type find(key_type key) const
   {
-    auto it = thrust::lower_bound(thrust::seq, store_key_first, store_key_last, key);
+    auto it = kv_lower_bound(store_key_first, store_key_last, key, model);
     if (it != store_key_last && *it == key) {
       return *(store_value_first + thrust::distance(store_key_first, it));
     } else {
@@ -187,6 +284,7 @@ struct kv_binary_search_store_device_view_t {
   typename ViewType::value_iterator store_value_first{};
 
   value_type invalid_value{};
+  kv_linear_model_t<key_type> model{};
 };
 
 template <typename ViewType>
@@ -245,11 +343,13 @@ class kv_binary_search_store_view_t {
   kv_binary_search_store_view_t(KeyIterator key_first,
                                 KeyIterator key_last,
                                 ValueIterator value_first,
-                                value_type invalid_value)
+                                value_type invalid_value,
+                                kv_linear_model_t<key_type> model = kv_linear_model_t<key_type>{})
     : store_key_first_(key_first),
       store_key_last_(key_last),
       store_value_first_(value_first),
-      invalid_value_(invalid_value)
+      invalid_value_(invalid_value),
+      model_(model)
   {
   }
 
@@ -263,8 +363,11 @@ class kv_binary_search_store_view_t {
                       key_first,
                       key_last,
                       value_first,
-                      kv_binary_search_find_op_t<KeyIterator, ValueIterator>{
-                        store_key_first_, store_key_last_, store_value_first_, invalid_value_});
+                      kv_binary_search_find_op_t<KeyIterator, ValueIterator>{store_key_first_,
+                                                                             store_key_last_,
+                                                                             store_value_first_,
+                                                                             invalid_value_,
+                                                                             model_});
   }
 
   template <typename QueryKeyIterator, typename ResultValueIterator>
@@ -278,7 +381,7 @@ class kv_binary_search_store_view_t {
       key_first,
       key_last,
       value_first,
-      kv_binary_search_contains_op_t<KeyIterator>{store_key_first_, store_key_last_});
+      kv_binary_search_contains_op_t<KeyIterator>{store_key_first_, store_key_last_, model_});
   }
 
   KeyIterator store_key_first() const { return store_key_first_; }
@@ -289,12 +392,15 @@ class kv_binary_search_store_view_t {
 
   value_type invalid_value() const { return invalid_value_; }
 
+  kv_linear_model_t<key_type> linear_model() const { return model_; }
+
  private:
   KeyIterator store_key_first_{};
   KeyIterator store_key_last_{};
   ValueIterator store_value_first_{};
 
   value_type invalid_value_{};
+  kv_linear_model_t<key_type> model_{};
 };
 
 template <typename key_t, typename ValueIterator>
@@ -429,6 +535,7 @@ class kv_binary_search_store_t {
                           store_keys_.end(),
                           get_dataframe_buffer_begin(store_values_));
     }
+    model_ = build_kv_linear_model(store_keys_.data(), store_keys_.size(), stream);
   }
 
   kv_binary_search_store_t(
@@ -447,9 +554,72 @@ class kv_binary_search_store_t {
                           store_keys_.end(),
                           get_dataframe_buffer_begin(store_values_));
     }
+    model_ = build_kv_linear_model(store_keys_.data(), store_keys_.size(), stream);
   }
 
-  auto retrieve_all(rmm::cuda_stream_view stream)
+  // bulk insert by sorting the inserted pairs and merging them with the (sorted) stored pairs, this
+  // is cheaper than hashing each key for large batches, keys already in the store (or duplicate
+  // keys in the inserted pairs) keep the existing (or the first) value
+  template <typename KeyIterator, typename ValueIterator>
+  void insert(KeyIterator key_first,
+              KeyIterator key_last,
+              ValueIterator value_first,
+              bool key_sorted /* if set to true, assume that the input data is sorted and skip
+                                 sorting */
+              ,
+              rmm::cuda_stream_view stream)
+  {
+    auto num_keys = static_cast<size_t>(thrust::distance(key_first, key_last));
+    if (num_keys == 0) return;
+
+    rmm::device_uvector<key_t> new_keys(num_keys, stream);
+    auto new_values = allocate_dataframe_buffer<value_t>(num_keys, stream);
+    thrust::copy(rmm::exec_policy(stream), key_first, key_last, new_keys.begin());
+    thrust::copy(rmm::exec_policy(stream),
+                 value_first,
+                 value_first + num_keys,
+                 get_dataframe_buffer_begin(new_values));
+    if (!key_sorted) {
+      thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                                 new_keys.begin(),
+                                 new_keys.end(),
+                                 get_dataframe_buffer_begin(new_values));
+    }
+
+    rmm::device_uvector<key_t> merged_keys(store_keys_.size() + num_keys, stream);
+    auto merged_values = allocate_dataframe_buffer<value_t>(merged_keys.size(), stream);
+    thrust::merge_by_key(rmm::exec_policy(stream),
+                         store_keys_.begin(),
+                         store_keys_.end(),
+                         new_keys.begin(),
+                         new_keys.end(),
+                         get_dataframe_buffer_begin(store_values_),
+                         get_dataframe_buffer_begin(new_values),
+                         merged_keys.begin(),
+                         get_dataframe_buffer_begin(merged_values));
+    new_keys.resize(0, stream);
+    new_keys.shrink_to_fit(stream);
+    resize_dataframe_buffer(new_values, 0, stream);
+    shrink_to_fit_dataframe_buffer(new_values, stream);
+
+    auto num_unique_keys = static_cast<size_t>(
+      thrust::distance(merged_keys.begin(),
+                       thrust::get<0>(thrust::unique_by_key(rmm::exec_policy(stream),
+                                                            merged_keys.begin(),
+                                                            merged_keys.end(),
+                                                            get_dataframe_buffer_begin(
+                                                              merged_values)))));
+    merged_keys.resize(num_unique_keys, stream);
+    merged_keys.shrink_to_fit(stream);
+    resize_dataframe_buffer(merged_values, num_unique_keys, stream);
+    shrink_to_fit_dataframe_buffer(merged_values, stream);
+
+    store_keys_   = std::move(merged_keys);
+    store_values_ = std::move(merged_values);
+    model_        = build_kv_linear_model(store_keys_.data(), store_keys_.size(), stream);
+  }
+
+  auto retrieve_all(rmm::cuda_stream_view stream) const
   {
     rmm::device_uvector<key_t> tmp_store_keys(store_keys_.size(), stream);
     auto tmp_store_values =
@@ -457,8 +627,8 @@ class kv_binary_search_store_t {
     thrust::copy(
       rmm::exec_policy(stream), store_keys_.begin(), store_keys_.end(), tmp_store_keys.begin());
     thrust::copy(rmm::exec_policy(stream),
-                 get_dataframe_buffer_begin(store_values_),
-                 get_dataframe_buffer_end(store_values_),
+                 get_dataframe_buffer_cbegin(store_values_),
+                 get_dataframe_buffer_cend(store_values_),
                  get_dataframe_buffer_begin(tmp_store_values));
     return std::make_tuple(std::move(tmp_store_keys), std::move(tmp_store_values));
   }
@@ -469,6 +639,7 @@ class kv_binary_search_store_t {
     auto tmp_store_values = std::move(store_values_);
     store_keys_           = rmm::device_uvector<key_t>(0, stream);
     store_values_         = allocate_dataframe_buffer<value_t>(0, stream);
+    model_                = kv_linear_model_t<key_t>{};
     return std::make_tuple(std::move(tmp_store_keys), std::move(tmp_store_values));
   }
 
@@ -480,15 +651,23 @@ class kv_binary_search_store_t {
 
   value_t invalid_value() const { return invalid_value_; }
 
+  kv_linear_model_t<key_t> linear_model() const { return model_; }
+
   size_t size() const { return store_keys_.size(); }
 
   size_t capacity() const { return store_keys_.size(); }
 
+  size_t memory_footprint() const
+  {
+    return store_keys_.size() * (sizeof(key_t) + sizeof(value_t));
+  }
+
  private:
   rmm::device_uvector<key_t> store_keys_;
   decltype(allocate_dataframe_buffer<value_t>(0, rmm::cuda_stream_view{})) store_values_;
 
   value_t invalid_value_{};
+  kv_linear_model_t<key_t> model_{};
 };
 
 template <typename key_t, typename value_t>
@@ -568,6 +747,8 @@ class kv_cuco_store_t {
     auto num_keys = static_cast<size_t>(thrust::distance(key_first, key_last));
     if (num_keys == 0) return;
 
+    reserve_for_insert(num_keys, stream);
+
     if constexpr (std::is_arithmetic_v<value_t>) {
       auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(key_first, value_first));
       size_ += cuco_store_->insert(pair_first, pair_first + num_keys, stream.value());
@@ -612,6 +793,8 @@ class kv_cuco_store_t {
     auto num_keys = static_cast<size_t>(thrust::distance(key_first, key_last));
     if (num_keys == 0) return;
 
+    reserve_for_insert(num_keys, stream);
+
     if constexpr (std::is_arithmetic_v<value_t>) {
       auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(key_first, value_first));
       size_ += cuco_store_->insert_if(
@@ -662,6 +845,8 @@ class kv_cuco_store_t {
     auto num_keys = static_cast<size_t>(thrust::distance(key_first, key_last));
     if (num_keys == 0) return;
 
+    reserve_for_insert(num_keys, stream);
+
     if constexpr (std::is_arithmetic_v<value_t>) {
       auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(key_first, value_first));
       // FIXME: a temporary solution till insert_and_assign is added to
@@ -750,7 +935,7 @@ class kv_cuco_store_t {
     }
   }
 
-  auto retrieve_all(rmm::cuda_stream_view stream)
+  auto retrieve_all(rmm::cuda_stream_view stream) const
   {
     rmm::device_uvector<key_t> keys(size_, stream);
     auto values = allocate_dataframe_buffer<value_t>(0, stream);
@@ -770,7 +955,7 @@ class kv_cuco_store_t {
       thrust::gather(rmm::exec_policy(stream),
                      indices.begin(),
                      indices.end(),
-                     get_optional_dataframe_buffer_begin<value_t>(store_values_),
+                     get_optional_dataframe_buffer_cbegin<value_t>(store_values_),
                      get_dataframe_buffer_begin(values));
     }
     return std::make_tuple(std::move(keys), std::move(values));
@@ -809,7 +994,56 @@ class kv_cuco_store_t {
 
   size_t capacity() const { return capacity_; }
 
+  // grow the store (and rehash the stored pairs) if new_capacity is larger than the current
+  // capacity, views (and device references) obtained before this call are invalidated
+  void reserve(size_t new_capacity, rmm::cuda_stream_view stream)
+  {
+    if (new_capacity <= capacity_) { return; }
+
+    auto [keys, values]    = retrieve_all(stream);
+    auto old_invalid_key   = invalid_key();
+    auto old_invalid_value = invalid_value();
+    if constexpr (!std::is_arithmetic_v<value_t>) {
+      resize_optional_dataframe_buffer<value_t>(store_values_, 0, stream);
+    }
+    allocate(new_capacity, old_invalid_key, old_invalid_value, stream);
+    capacity_ = new_capacity;
+    size_     = 0;
+    insert(keys.begin(), keys.end(), get_dataframe_buffer_begin(values), stream);
+  }
+
+  size_t memory_footprint() const
+  {
+    if (!cuco_store_) { return size_t{0}; }
+    return cuco_store_->capacity() *
+             (sizeof(key_t) + sizeof(typename cuco_map_type::mapped_type)) +
+           size_optional_dataframe_buffer<value_t>(store_values_) * sizeof(value_t);
+  }
+
+  double load_factor() const
+  {
+    if (!cuco_store_ || (cuco_store_->capacity() == 0)) { return 0.0; }
+    return static_cast<double>(size_) / static_cast<double>(cuco_store_->capacity());
+  }
+
+  // expected number of slots to probe for a successful lookup (Knuth's estimate for linear probing
+  // with CG size 1)
+  double expected_probe_length() const
+  {
+    auto alpha = std::min(load_factor(), 0.99);
+    return 0.5 * (1.0 + 1.0 / (1.0 - alpha));
+  }
+
  private:
+  // grow geometrically (at least doubling the capacity) if inserting num_keys more keys can exceed
+  // the capacity, so repeated inserts of unknown sizes cost amortized O(1) rehashes per key
+  void reserve_for_insert(size_t num_keys, rmm::cuda_stream_view stream)
+  {
+    if (size_ + num_keys > capacity_) {
+      reserve(std::max(size_ + num_keys, capacity_ * 2), stream);
+    }
+  }
+
   void allocate(size_t num_keys,
                 key_t invalid_key,
                 value_t invalid_value,
@@ -946,7 +1180,8 @@ class kv_store_t {
   {
   }
 
-  /* when use binary_search = false, this requires that the capacity is large enough */
+  /* when use binary_search = false, the store grows if the capacity is not large enough (views
+   * obtained before this call are invalidated if the store grows) */
   template <typename KeyIterator, typename ValueIterator, bool binary_search = use_binary_search>
   std::enable_if_t<!binary_search, void> insert(KeyIterator key_first,
                                                 KeyIterator key_last,
@@ -956,7 +1191,21 @@ class kv_store_t {
     store_.insert(key_first, key_last, value_first, stream);
   }
 
-  /* when use binary_search = false, this requires that the capacity is large enough */
+  /* when use binary_search = true, the inserted pairs are sorted and merged with the stored pairs
+   * (keys already in the store keep the existing values), views obtained before this call are
+   * invalidated */
+  template <typename KeyIterator, typename ValueIterator, bool binary_search = use_binary_search>
+  std::enable_if_t<binary_search, void> insert(
+    KeyIterator key_first,
+    KeyIterator key_last,
+    ValueIterator value_first,
+    bool key_sorted /* if set to true, assume that the input data is sorted and skip sorting */,
+    rmm::cuda_stream_view stream)
+  {
+    store_.insert(key_first, key_last, value_first, key_sorted, stream);
+  }
+
+  /* when use binary_search = false, the store grows if the capacity is not large enough */
   template <typename KeyIterator,
             typename ValueIterator,
             typename StencilIterator,
@@ -972,7 +1221,7 @@ class kv_store_t {
     store_.insert_if(key_first, key_last, value_first, stencil_first, pred_op, stream);
   }
 
-  /* when use binary_search = false, this requires that the capacity is large enough */
+  /* when use binary_search = false, the store grows if the capacity is not large enough */
   template <typename KeyIterator, typename ValueIterator, bool binary_search = use_binary_search>
   std::enable_if_t<!binary_search, void> insert_and_assign(KeyIterator key_first,
                                                            KeyIterator key_last,
@@ -993,7 +1242,8 @@ class kv_store_t {
       return detail::kv_binary_search_store_view_t(store_.store_key_first(),
                                                    store_.store_key_last(),
                                                    store_.store_value_first(),
-                                                   store_.invalid_value());
+                                                   store_.invalid_value(),
+                                                   store_.linear_model());
     } else {
       if constexpr (std::is_arithmetic_v<value_t>) {
         return detail::kv_cuco_store_view_t<key_t, value_t const*>(store_.cuco_store_ptr());
@@ -1016,6 +1266,31 @@ class kv_store_t {
 
   size_t capacity() const { return store_.capacity(); }
 
+  /* when use_binary_search = false, views obtained before this call are invalidated if the store
+   * grows */
+  template <bool binary_search = use_binary_search>
+  std::enable_if_t<!binary_search, void> reserve(size_t new_capacity, rmm::cuda_stream_view stream)
+  {
+    store_.reserve(new_capacity, stream);
+  }
+
+  // device memory used by the store (in bytes)
+  size_t memory_footprint() const { return store_.memory_footprint(); }
+
+  /* when use_binary_search = false */
+  template <bool binary_search = use_binary_search>
+  std::enable_if_t<!binary_search, double> load_factor() const
+  {
+    return store_.load_factor();
+  }
+
+  /* when use_binary_search = false */
+  template <bool binary_search = use_binary_search>
+  std::enable_if_t<!binary_search, double> expected_probe_length() const
+  {
+    return store_.expected_probe_length();
+  }
+
  private:
   std::conditional_t<use_binary_search,
                      detail::kv_binary_search_store_t<key_t, value_t>,
@@ -215,7 +215,8 @@ template <bool incoming,
           typename EdgeValueInputWrapper,
           typename EdgeOp,
           typename EdgeTypeInputWrapper,
-          typename T>
+          typename T,
+          typename EdgeBiasInclusiveSumInputWrapper = edge_dummy_property_view_t>
 std::tuple<std::optional<rmm::device_uvector<size_t>>, dataframe_buffer_type_t<T>>
 per_v_random_select_transform_e(raft::handle_t const& handle,
                                 GraphViewType const& graph_view,
@@ -233,7 +234,9 @@ per_v_random_select_transform_e(raft::handle_t const& handle,
                                 raft::host_span<size_t const> Ks,
                                 bool with_replacement,
                                 std::optional<T> invalid_value,
-                                bool do_expensive_check)
+                                bool do_expensive_check,
+                                std::optional<EdgeBiasInclusiveSumInputWrapper>
+                                  edge_bias_inclusive_sum_input = std::nullopt)
 {
   using vertex_t     = typename GraphViewType::vertex_type;
   using edge_t       = typename GraphViewType::edge_type;
@@ -381,22 +384,43 @@ per_v_random_select_transform_e(raft::handle_t const& handle,
   } else {
     if constexpr (std::is_same_v<EdgeTypeInputWrapper,
                                  edge_dummy_property_view_t>) {  // homogeneous
-      std::tie(sample_local_nbr_indices, sample_key_indices, local_key_list_sample_offsets) =
-        homogeneous_biased_sample_and_compute_local_nbr_indices(
-          handle,
-          graph_view,
-          (minor_comm_size > 1) ? get_dataframe_buffer_cbegin(*aggregate_local_key_list)
-                                : key_list.begin(),
-          bias_edge_src_value_input,
-          bias_edge_dst_value_input,
-          bias_edge_value_input,
-          bias_e_op,
-          raft::host_span<size_t const>(local_key_list_offsets.data(),
-                                        local_key_list_offsets.size()),
-          rng_state,
-          Ks[0],
-          with_replacement,
-          do_expensive_check);
+      bool use_edge_bias_inclusive_sums{false};
+      if constexpr (!std::is_same_v<EdgeBiasInclusiveSumInputWrapper,
+                                    edge_dummy_property_view_t>) {
+        use_edge_bias_inclusive_sums =
+          edge_bias_inclusive_sum_input && with_replacement && !graph_view.has_edge_mask();
+        if (use_edge_bias_inclusive_sums) {
+          std::tie(sample_local_nbr_indices, sample_key_indices, local_key_list_sample_offsets) =
+            homogeneous_biased_sample_with_replacement_and_compute_local_nbr_indices(
+              handle,
+              graph_view,
+              (minor_comm_size > 1) ? get_dataframe_buffer_cbegin(*aggregate_local_key_list)
+                                    : key_list.begin(),
+              *edge_bias_inclusive_sum_input,
+              raft::host_span<size_t const>(local_key_list_offsets.data(),
+                                            local_key_list_offsets.size()),
+              rng_state,
+              Ks[0]);
+        }
+      }
+      if (!use_edge_bias_inclusive_sums) {
+        std::tie(sample_local_nbr_indices, sample_key_indices, local_key_list_sample_offsets) =
+          homogeneous_biased_sample_and_compute_local_nbr_indices(
+            handle,
+            graph_view,
+            (minor_comm_size > 1) ? get_dataframe_buffer_cbegin(*aggregate_local_key_list)
+                                  : key_list.begin(),
+            bias_edge_src_value_input,
+            bias_edge_dst_value_input,
+            bias_edge_value_input,
+            bias_e_op,
+            raft::host_span<size_t const>(local_key_list_offsets.data(),
+                                          local_key_list_offsets.size()),
+            rng_state,
+            Ks[0],
+            with_replacement,
+            do_expensive_check);
+      }
     } else {  // heterogeneous
       std::tie(sample_local_nbr_indices, sample_key_indices, local_key_list_sample_offsets) =
         heterogeneous_biased_sample_and_compute_local_nbr_indices(
@@ -674,6 +698,13 @@ per_v_random_select_transform_e(raft::handle_t const& handle,
  * @param e_op Quinary operator takes (tagged-)edge source, edge destination, property values for
  * the source, destination, and edge and returns a value to be collected in the output. This
  * function is called only for the selected edges.
+ * @param rng_state raft::random::RngState object to generate random numbers. If the generator type
+ * is raft::random::GenPhilox, @p with_replacement is true, and @p key_list stores tagged vertices,
+ * the random numbers are generated on the fly from (seed, tagged vertex, call counter, draw index)
+ * instead of being materialized, so the selection for a tagged vertex is independent of its
+ * position in @p key_list (and of how @p key_list is distributed over the GPUs in multi-GPU).
+ * Identical tagged vertices draw identical samples, and @p rng_state should have the same seed on
+ * every GPU in this case.
  * @param K Number of outgoing edges to select per (tagged-)vertex.
  * @param with_replacement A flag to specify whether a single outgoing edge can be selected multiple
  * times (if @p with_replacement = true) or can be selected only once (if @p with_replacement =
@@ -919,6 +950,12 @@ per_v_random_select_transform_outgoing_e(raft::handle_t const& handle,
  * invalid_value.has_value() is false, fewer than @p K values can be returned for the vertices with
  * fewer than @p K selected edges. See the return value section for additional details.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param edge_bias_inclusive_sum_input Optional pre-computed per-vertex inclusive sums of the
+ * edge bias values returned by @p bias_e_op (see detail::compute_edge_bias_inclusive_sums). If
+ * provided, biased sampling with replacement (on a graph without an attached edge mask) draws each
+ * sample with a binary search on the inclusive sums instead of collecting and scanning the bias
+ * values of the input (tagged-)vertices' outgoing edges (@p bias_e_op is not invoked). This is
+ * ignored otherwise.
  * @return std::tuple Tuple of an optional offset vector of type
  * std::optional<rmm::device_uvector<size_t>> and a dataframe buffer storing the output values of
  * type @p T from the selected edges. If @p invalid_value is std::nullopt, the offset vector is
@@ -938,24 +975,27 @@ template <typename GraphViewType,
           typename EdgeDstValueInputWrapper,
           typename EdgeValueInputWrapper,
           typename EdgeOp,
-          typename T>
+          typename T,
+          typename EdgeBiasInclusiveSumInputWrapper = edge_dummy_property_view_t>
 std::tuple<std::optional<rmm::device_uvector<size_t>>, dataframe_buffer_type_t<T>>
-per_v_random_select_transform_outgoing_e(raft::handle_t const& handle,
-                                         GraphViewType const& graph_view,
-                                         KeyBucketType const& key_list,
-                                         BiasEdgeSrcValueInputWrapper bias_edge_src_value_input,
-                                         BiasEdgeDstValueInputWrapper bias_edge_dst_value_input,
-                                         BiasEdgeValueInputWrapper bias_edge_value_input,
-                                         BiasEdgeOp bias_e_op,
-                                         EdgeSrcValueInputWrapper edge_src_value_input,
-                                         EdgeDstValueInputWrapper edge_dst_value_input,
-                                         EdgeValueInputWrapper edge_value_input,
-                                         EdgeOp e_op,
-                                         raft::random::RngState& rng_state,
-                                         size_t K,
-                                         bool with_replacement,
-                                         std::optional<T> invalid_value,
-                                         bool do_expensive_check = false)
+per_v_random_select_transform_outgoing_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  KeyBucketType const& key_list,
+  BiasEdgeSrcValueInputWrapper bias_edge_src_value_input,
+  BiasEdgeDstValueInputWrapper bias_edge_dst_value_input,
+  BiasEdgeValueInputWrapper bias_edge_value_input,
+  BiasEdgeOp bias_e_op,
+  EdgeSrcValueInputWrapper edge_src_value_input,
+  EdgeDstValueInputWrapper edge_dst_value_input,
+  EdgeValueInputWrapper edge_value_input,
+  EdgeOp e_op,
+  raft::random::RngState& rng_state,
+  size_t K,
+  bool with_replacement,
+  std::optional<T> invalid_value,
+  bool do_expensive_check                                                       = false,
+  std::optional<EdgeBiasInclusiveSumInputWrapper> edge_bias_inclusive_sum_input = std::nullopt)
 {
   return detail::per_v_random_select_transform_e<false>(
     handle,
@@ -974,7 +1014,8 @@ per_v_random_select_transform_outgoing_e(raft::handle_t const& handle,
     raft::host_span<size_t const>(&K, size_t{1}),
     with_replacement,
     invalid_value,
-    do_expensive_check);
+    do_expensive_check,
+    edge_bias_inclusive_sum_input);
 }
 
 /**
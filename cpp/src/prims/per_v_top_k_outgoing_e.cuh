@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "prims/extract_transform_e.cuh"
+
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t, typename value_t>
+struct extract_edge_with_value_t {
+  __device__ cuda::std::optional<thrust::tuple<vertex_t, vertex_t, value_t>> operator()(
+    vertex_t src, vertex_t dst, cuda::std::nullopt_t, cuda::std::nullopt_t, value_t val) const
+  {
+    return thrust::make_tuple(src, dst, val);
+  }
+};
+
+// keep (at most) k edges per source (the first k edges in the (value_comp, destination) order);
+// edges are returned sorted by (source, value, destination)
+template <typename vertex_t, typename value_t, typename ValueCompareOp>
+void segmented_top_k(raft::handle_t const& handle,
+                     rmm::device_uvector<vertex_t>& srcs,
+                     rmm::device_uvector<vertex_t>& dsts,
+                     rmm::device_uvector<value_t>& values,
+                     size_t k,
+                     ValueCompareOp value_comp)
+{
+  // three stable (radix) sorts from the least significant key
+
+  thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                             dsts.begin(),
+                             dsts.end(),
+                             thrust::make_zip_iterator(srcs.begin(), values.begin()));
+  thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                             values.begin(),
+                             values.end(),
+                             thrust::make_zip_iterator(srcs.begin(), dsts.begin()),
+                             value_comp);
+  thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                             srcs.begin(),
+                             srcs.end(),
+                             thrust::make_zip_iterator(dsts.begin(), values.begin()));
+
+  rmm::device_uvector<bool> drop_flags(srcs.size(), handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    drop_flags.begin(),
+    drop_flags.end(),
+    cuda::proclaim_return_type<bool>(
+      [srcs = raft::device_span<vertex_t const>(srcs.data(), srcs.size()), k] __device__(size_t i) {
+        auto segment_first = thrust::distance(
+          srcs.begin(), thrust::lower_bound(thrust::seq, srcs.begin(), srcs.end(), srcs[i]));
+        return (i - static_cast<size_t>(segment_first)) >= k;
+      }));
+  auto triplet_first = thrust::make_zip_iterator(srcs.begin(), dsts.begin(), values.begin());
+  auto num_remaining = static_cast<size_t>(thrust::distance(
+    triplet_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      triplet_first,
+                      triplet_first + srcs.size(),
+                      drop_flags.begin(),
+                      thrust::identity<bool>{})));
+  srcs.resize(num_remaining, handle.get_stream());
+  dsts.resize(num_remaining, handle.get_stream());
+  values.resize(num_remaining, handle.get_stream());
+  srcs.shrink_to_fit(handle.get_stream());
+  dsts.shrink_to_fit(handle.get_stream());
+  values.shrink_to_fit(handle.get_stream());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Select the top @p k outgoing edges of every vertex based on the edge property values
+ * (e.g. the top-k neighbors by edge weight).
+ *
+ * In multi-GPU, the outgoing edges of a vertex are distributed over multiple GPUs; each GPU first
+ * selects (at most) @p k edges per source vertex from its local edges, and only the selected edges
+ * are shuffled to the GPUs owning the source vertices. Ties are broken by destination vertex IDs
+ * (smaller destination vertex IDs are selected first).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam EdgeValueInputWrapper Type of the wrapper for edge property values (should wrap an
+ * arithmetic type).
+ * @tparam ValueCompareOp Type of the binary value comparison operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param edge_value_input Wrapper used to access edge input property values (for the edges assigned
+ * to this process in multi-GPU). Use cugraph::edge_property_t::view().
+ * @param k Number of outgoing edges to select per vertex.
+ * @param value_comp Binary operator returning true if the first value should precede the second
+ * value (e.g. thrust::greater<value_t> to select the edges with the largest values).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the offsets (size = @p graph_view.local_vertex_partition_range_size() + 1), the
+ * destination vertices, and the edge property values of the selected edges. The selected edges of
+ * the i'th local vertex are stored in [offsets[i], offsets[i + 1]) in the selection order.
+ */
+template <typename GraphViewType, typename EdgeValueInputWrapper, typename ValueCompareOp>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename EdgeValueInputWrapper::value_type>>
+per_v_top_k_outgoing_e(raft::handle_t const& handle,
+                       GraphViewType const& graph_view,
+                       EdgeValueInputWrapper edge_value_input,
+                       size_t k,
+                       ValueCompareOp value_comp,
+                       bool do_expensive_check = false)
+{
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+  using value_t  = typename EdgeValueInputWrapper::value_type;
+
+  static_assert(std::is_arithmetic_v<value_t>);
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  // 1. select the top-k edges per source from the local edges
+
+  auto [srcs, dsts, values] =
+    extract_transform_e(handle,
+                        graph_view,
+                        edge_src_dummy_property_t{}.view(),
+                        edge_dst_dummy_property_t{}.view(),
+                        edge_value_input,
+                        detail::extract_edge_with_value_t<vertex_t, value_t>{});
+  detail::segmented_top_k(handle, srcs, dsts, values, k, value_comp);
+
+  // 2. shuffle the candidates to the source owners and select the global top-k edges per source
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    auto h_vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+      h_vertex_partition_range_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+
+    std::forward_as_tuple(srcs, std::tie(dsts, values), std::ignore) =
+      groupby_gpu_id_and_shuffle_kv_pairs(
+        comm,
+        srcs.begin(),
+        srcs.end(),
+        thrust::make_zip_iterator(dsts.begin(), values.begin()),
+        detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+          raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                            d_vertex_partition_range_lasts.size()),
+          major_comm_size,
+          minor_comm_size},
+        handle.get_stream());
+    detail::segmented_top_k(handle, srcs, dsts, values, k, value_comp);
+  }
+
+  // 3. compute the offsets
+
+  rmm::device_uvector<size_t> offsets(graph_view.local_vertex_partition_range_size() + 1,
+                                      handle.get_stream());
+  thrust::lower_bound(
+    handle.get_thrust_policy(),
+    srcs.begin(),
+    srcs.end(),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last() + 1),
+    offsets.begin());
+
+  return std::make_tuple(std::move(offsets), std::move(dsts), std::move(values));
+}
+
+}  // namespace cugraph
@@ -35,11 +35,13 @@
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/atomic>
 #include <cuda/std/optional>
 #include <thrust/copy.h>
 #include <thrust/count.h>
@@ -51,12 +53,14 @@
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/remove.h>
 #include <thrust/scatter.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
 #include <type_traits>
 
 namespace cugraph {
@@ -195,6 +199,153 @@ struct reduce_with_init_t {
   __device__ T operator()(T val) const { return reduce_op(val, init); }
 };
 
+int32_t constexpr dst_key_aggregation_hash_block_size = 512;
+// number of shared memory hash table slots per block (should be a power of two), majors with more
+// distinct destination keys fall back to the segmented sort
+int32_t constexpr dst_key_aggregation_hash_table_size = 2048;
+
+template <typename edge_value_t>
+constexpr bool dst_key_aggregation_hash_supported_v =
+  std::is_same_v<edge_value_t, cuda::std::nullopt_t> || std::is_floating_point_v<edge_value_t> ||
+  (std::is_integral_v<edge_value_t> && (sizeof(edge_value_t) >= sizeof(int32_t)));
+
+// Aggregate the (destination key, edge value) pairs of a high-degree major in a block-local shared
+// memory hash table (one block per major). The unique keys and the aggregated values are written to
+// the front of the major's segment in the output buffers and aggregated_counts[i] is set to the
+// number of unique keys, or to invalid_edge_id_v<edge_t> if the major has too many distinct keys to
+// fit in the table (the caller sorts the segment in this case).
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_value_t,
+          typename OffsetIterator,
+          typename MinorKeyIterator,
+          typename EdgeValueIterator,
+          typename OutputEdgeValueIterator>
+__global__ static void aggregate_dst_keys_high_degree(
+  OffsetIterator offset_first,
+  vertex_t num_majors,
+  MinorKeyIterator minor_key_first,
+  EdgeValueIterator edge_value_first,
+  vertex_t* output_minor_keys,
+  OutputEdgeValueIterator output_edge_value_first,
+  edge_t* aggregated_counts)
+{
+  constexpr bool has_edge_value = !std::is_same_v<edge_value_t, cuda::std::nullopt_t>;
+  using slot_value_t            = std::conditional_t<has_edge_value, edge_value_t, int32_t>;
+
+  __shared__ vertex_t slot_keys[dst_key_aggregation_hash_table_size];
+  __shared__ slot_value_t slot_values[has_edge_value ? dst_key_aggregation_hash_table_size : 1];
+  __shared__ edge_t num_unique_keys;
+  __shared__ int32_t overflow;
+
+  auto constexpr slot_mask = static_cast<uint32_t>(dst_key_aggregation_hash_table_size - 1);
+
+  for (auto idx = static_cast<vertex_t>(blockIdx.x); idx < num_majors;
+       idx += static_cast<vertex_t>(gridDim.x)) {
+    for (int32_t i = threadIdx.x; i < dst_key_aggregation_hash_table_size; i += blockDim.x) {
+      slot_keys[i] = invalid_vertex_id_v<vertex_t>;
+      if constexpr (has_edge_value) { slot_values[i] = slot_value_t{0}; }
+    }
+    if (threadIdx.x == 0) {
+      num_unique_keys = 0;
+      overflow        = 0;
+    }
+    __syncthreads();
+
+    edge_t segment_first = *(offset_first + idx);
+    edge_t segment_last  = *(offset_first + (idx + 1));
+    for (auto e = segment_first + static_cast<edge_t>(threadIdx.x); e < segment_last;
+         e += static_cast<edge_t>(blockDim.x)) {
+      auto key  = *(minor_key_first + e);
+      auto slot = static_cast<uint32_t>(
+                    (static_cast<uint64_t>(key) * uint64_t{0x9e3779b97f4a7c15}) >> 32) &
+                  slot_mask;
+      bool inserted{false};
+      for (int32_t probe = 0; probe < dst_key_aggregation_hash_table_size; ++probe) {
+        cuda::atomic_ref<vertex_t, cuda::thread_scope_block> key_ref(slot_keys[slot]);
+        auto expected = invalid_vertex_id_v<vertex_t>;
+        if (key_ref.compare_exchange_strong(expected, key, cuda::std::memory_order_relaxed) ||
+            (expected == key)) {
+          if constexpr (has_edge_value) {
+            cuda::atomic_ref<slot_value_t, cuda::thread_scope_block> value_ref(slot_values[slot]);
+            value_ref.fetch_add(*(edge_value_first + e), cuda::std::memory_order_relaxed);
+          }
+          inserted = true;
+          break;
+        }
+        slot = (slot + 1) & slot_mask;
+      }
+      if (!inserted) { overflow = 1; }
+    }
+    __syncthreads();
+
+    if (overflow == 0) {
+      for (int32_t i = threadIdx.x; i < dst_key_aggregation_hash_table_size; i += blockDim.x) {
+        if (slot_keys[i] != invalid_vertex_id_v<vertex_t>) {
+          cuda::atomic_ref<edge_t, cuda::thread_scope_block> counter(num_unique_keys);
+          auto pos = segment_first + counter.fetch_add(edge_t{1}, cuda::std::memory_order_relaxed);
+          output_minor_keys[pos] = slot_keys[i];
+          if constexpr (has_edge_value) { *(output_edge_value_first + pos) = slot_values[i]; }
+        }
+      }
+    }
+    __syncthreads();
+
+    if (threadIdx.x == 0) {
+      aggregated_counts[idx] = (overflow == 0) ? num_unique_keys : invalid_edge_id_v<edge_t>;
+    }
+  }
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+// segments already aggregated by aggregate_dst_keys_high_degree become empty segments to sort
+template <typename vertex_t, typename edge_t, typename OffsetIterator>
+struct dst_key_sort_segment_last_t {
+  OffsetIterator offset_first{};
+  edge_t const* aggregated_counts{nullptr};
+  vertex_t num_hashed_majors{};
+
+  __device__ edge_t operator()(vertex_t i) const
+  {
+    if ((i < num_hashed_majors) && (aggregated_counts[i] != invalid_edge_id_v<edge_t>)) {
+      return *(offset_first + i);
+    }
+    return *(offset_first + (i + 1));
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+// invalidate the (unused) tail of the segments aggregated by aggregate_dst_keys_high_degree
+template <typename vertex_t, typename edge_t, typename OffsetIterator>
+struct invalidate_hash_aggregated_tail_t {
+  OffsetIterator offset_first{};
+  edge_t const* aggregated_counts{nullptr};
+  vertex_t chunk_major_first{};  // first major of the chunk
+  vertex_t num_hashed_majors{};
+
+  __device__ vertex_t operator()(thrust::tuple<edge_t, vertex_t> pair) const
+  {
+    auto e     = thrust::get<0>(pair);
+    auto major = thrust::get<1>(pair);
+    auto i     = major - chunk_major_first;
+    if ((i < num_hashed_majors) && (aggregated_counts[i] != invalid_edge_id_v<edge_t>) &&
+        (e - *(offset_first + i) >= aggregated_counts[i])) {
+      return invalid_vertex_id_v<vertex_t>;
+    }
+    return major;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct has_invalid_major_t {
+  template <typename TupleType>
+  __device__ bool operator()(TupleType tup) const
+  {
+    return thrust::get<0>(tup) == invalid_vertex_id_v<vertex_t>;
+  }
+};
+
 }  // namespace detail
 
 /**
@@ -460,6 +611,15 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
           unreduced_majors.size(), handle.get_stream());
       rmm::device_uvector<std::byte> d_tmp_storage(0, handle.get_stream());
 
+      // the majors in the high-degree segment are aggregated in a block-local shared memory hash
+      // table first, this avoids sorting their (often few distinct) destination keys; the
+      // remaining majors (and the high-degree majors overflowing the table) are sorted
+      auto num_hashed_majors =
+        (detail::dst_key_aggregation_hash_supported_v<edge_value_t> && segment_offsets)
+          ? static_cast<size_t>((*segment_offsets)[1])
+          : size_t{0};
+      rmm::device_uvector<edge_t> aggregated_counts(num_hashed_majors, handle.get_stream());
+
       size_t reduced_size{0};
       for (size_t j = 0; j < num_chunks; ++j) {
         if (edge_partition_e_mask) {
@@ -506,6 +666,46 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
           (offsets_with_mask ? (*offsets_with_mask).data() : edge_partition.offsets()) +
             h_vertex_offsets[j],
           detail::rebase_offset_t<edge_t>{h_edge_offsets[j]});
+        auto chunk_num_hashed_majors = static_cast<vertex_t>(
+          std::clamp(num_hashed_majors, h_vertex_offsets[j], h_vertex_offsets[j + 1]) -
+          h_vertex_offsets[j]);
+        if (chunk_num_hashed_majors > 0) {
+          if constexpr (detail::dst_key_aggregation_hash_supported_v<edge_value_t>) {
+            raft::grid_1d_block_t update_grid(chunk_num_hashed_majors,
+                                              detail::dst_key_aggregation_hash_block_size,
+                                              handle.get_device_properties().maxGridSize[0]);
+            if constexpr (!std::is_same_v<edge_value_t, cuda::std::nullopt_t>) {
+              detail::aggregate_dst_keys_high_degree<vertex_t, edge_t, edge_value_t>
+                <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+                  offset_first,
+                  chunk_num_hashed_majors,
+                  tmp_minor_keys.begin() + h_edge_offsets[j],
+                  (edge_partition_e_mask
+                     ? detail::get_optional_dataframe_buffer_begin<edge_value_t>(
+                         tmp_key_aggregated_edge_values)
+                     : edge_partition_e_value_input.value_first()) +
+                    h_edge_offsets[j],
+                  unreduced_minor_keys.data(),
+                  detail::get_optional_dataframe_buffer_begin<edge_value_t>(
+                    unreduced_key_aggregated_edge_values),
+                  aggregated_counts.data());
+            } else {
+              detail::aggregate_dst_keys_high_degree<vertex_t, edge_t, edge_value_t>
+                <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+                  offset_first,
+                  chunk_num_hashed_majors,
+                  tmp_minor_keys.begin() + h_edge_offsets[j],
+                  cuda::std::nullopt,
+                  unreduced_minor_keys.data(),
+                  cuda::std::nullopt,
+                  aggregated_counts.data());
+            }
+          }
+        }
+        auto offset_last = thrust::make_transform_iterator(
+          thrust::make_counting_iterator(vertex_t{0}),
+          detail::dst_key_sort_segment_last_t<vertex_t, edge_t, decltype(offset_first)>{
+            offset_first, aggregated_counts.data(), chunk_num_hashed_majors});
         if constexpr (!std::is_same_v<edge_value_t, cuda::std::nullopt_t>) {
           cub::DeviceSegmentedSort::SortPairs(
             static_cast<void*>(nullptr),
@@ -521,7 +721,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
             h_edge_offsets[j + 1] - h_edge_offsets[j],
             h_vertex_offsets[j + 1] - h_vertex_offsets[j],
             offset_first,
-            offset_first + 1,
+            offset_last,
             handle.get_stream());
         } else {
           cub::DeviceSegmentedSort::SortKeys(static_cast<void*>(nullptr),
@@ -531,7 +731,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
                                              h_edge_offsets[j + 1] - h_edge_offsets[j],
                                              h_vertex_offsets[j + 1] - h_vertex_offsets[j],
                                              offset_first,
-                                             offset_first + 1,
+                                             offset_last,
                                              handle.get_stream());
         }
         if (tmp_storage_bytes > d_tmp_storage.size()) {
@@ -552,7 +752,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
             h_edge_offsets[j + 1] - h_edge_offsets[j],
             h_vertex_offsets[j + 1] - h_vertex_offsets[j],
             offset_first,
-            offset_first + 1,
+            offset_last,
             handle.get_stream());
         } else {
           cub::DeviceSegmentedSort::SortKeys(d_tmp_storage.data(),
@@ -562,7 +762,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
                                              h_edge_offsets[j + 1] - h_edge_offsets[j],
                                              h_vertex_offsets[j + 1] - h_vertex_offsets[j],
                                              offset_first,
-                                             offset_first + 1,
+                                             offset_last,
                                              handle.get_stream());
         }
 
@@ -570,6 +770,45 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
                      tmp_majors.begin() + h_edge_offsets[j],
                      tmp_majors.begin() + h_edge_offsets[j + 1],
                      unreduced_majors.begin());
+        auto num_unreduced = static_cast<size_t>(h_edge_offsets[j + 1] - h_edge_offsets[j]);
+        if (chunk_num_hashed_majors > 0) {
+          // drop the unused tail of the hash aggregated segments
+          thrust::transform(
+            handle.get_thrust_policy(),
+            thrust::make_zip_iterator(thrust::make_counting_iterator(edge_t{0}),
+                                      unreduced_majors.begin()),
+            thrust::make_zip_iterator(thrust::make_counting_iterator(edge_t{0}),
+                                      unreduced_majors.begin()) +
+              num_unreduced,
+            unreduced_majors.begin(),
+            detail::invalidate_hash_aggregated_tail_t<vertex_t, edge_t, decltype(offset_first)>{
+              offset_first,
+              aggregated_counts.data(),
+              static_cast<vertex_t>(edge_partition.major_range_first() + h_vertex_offsets[j]),
+              chunk_num_hashed_majors});
+          if constexpr (!std::is_same_v<edge_value_t, cuda::std::nullopt_t>) {
+            auto triplet_first = thrust::make_zip_iterator(
+              unreduced_majors.begin(),
+              unreduced_minor_keys.begin(),
+              detail::get_optional_dataframe_buffer_begin<edge_value_t>(
+                unreduced_key_aggregated_edge_values));
+            num_unreduced = static_cast<size_t>(
+              thrust::distance(triplet_first,
+                               thrust::remove_if(handle.get_thrust_policy(),
+                                                 triplet_first,
+                                                 triplet_first + num_unreduced,
+                                                 detail::has_invalid_major_t<vertex_t>{})));
+          } else {
+            auto pair_first =
+              thrust::make_zip_iterator(unreduced_majors.begin(), unreduced_minor_keys.begin());
+            num_unreduced = static_cast<size_t>(
+              thrust::distance(pair_first,
+                               thrust::remove_if(handle.get_thrust_policy(),
+                                                 pair_first,
+                                                 pair_first + num_unreduced,
+                                                 detail::has_invalid_major_t<vertex_t>{})));
+          }
+        }
         auto input_key_first =
           thrust::make_zip_iterator(unreduced_majors.begin(), unreduced_minor_keys.begin());
         auto output_key_first =
@@ -580,7 +819,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
                              thrust::get<0>(thrust::reduce_by_key(
                                handle.get_thrust_policy(),
                                input_key_first,
-                               input_key_first + (h_edge_offsets[j + 1] - h_edge_offsets[j]),
+                               input_key_first + num_unreduced,
                                detail::get_optional_dataframe_buffer_begin<edge_value_t>(
                                  unreduced_key_aggregated_edge_values),
                                output_key_first + reduced_size,
@@ -593,7 +832,7 @@ void per_v_transform_reduce_dst_key_aggregated_outgoing_e(
             thrust::copy_if(
               handle.get_thrust_policy(),
               input_key_first,
-              input_key_first + (h_edge_offsets[j + 1] - h_edge_offsets[j]),
+              input_key_first + num_unreduced,
               thrust::make_counting_iterator(size_t{0}),
               output_key_first + reduced_size,
               cugraph::detail::is_first_in_run_t<decltype(input_key_first)>{input_key_first}));
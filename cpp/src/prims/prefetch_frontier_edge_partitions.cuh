@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+inline bool is_managed_memory(void const* ptr)
+{
+  if (ptr == nullptr) { return false; }
+  cudaPointerAttributes attributes{};
+  RAFT_CUDA_TRY(cudaPointerGetAttributes(&attributes, ptr));
+  return attributes.type == cudaMemoryTypeManaged;
+}
+
+inline void prefetch_managed_memory(void const* ptr,
+                                    size_t num_bytes,
+                                    int device,
+                                    rmm::cuda_stream_view stream_view)
+{
+  if ((num_bytes > 0) && is_managed_memory(ptr)) {
+    RAFT_CUDA_TRY(cudaMemPrefetchAsync(ptr, num_bytes, device, stream_view.value()));
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Check whether the edge partition indices (or edge weights) of a graph reside in managed
+ * memory (e.g. after relocate_graph_edges() with rmm::mr::managed_memory_resource). This function
+ * should be called once before the iterations of an algorithm to decide whether to call
+ * prefetch_frontier_edge_partitions() in every iteration.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam weight_t Type of edge weights.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @return true if any GPU has edge partition indices or edge weights in managed memory.
+ */
+template <typename GraphViewType, typename weight_t = float>
+bool has_managed_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view = std::nullopt)
+{
+  bool managed{false};
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    managed = managed || detail::is_managed_memory(
+                           graph_view.local_edge_partition_view(i).indices().data());
+    if (edge_weight_view) {
+      managed = managed || detail::is_managed_memory((*edge_weight_view).value_firsts()[i]);
+    }
+  }
+  if constexpr (GraphViewType::is_multi_gpu) {
+    managed = host_scalar_allreduce(
+                handle.get_comms(), int{managed}, raft::comms::op_t::MAX, handle.get_stream()) > 0;
+  }
+  return managed;
+}
+
+/**
+ * @brief Prefetch the edges of the current frontier's vertex range to the GPU.
+ *
+ * The edges of the major vertices in [min(frontier), max(frontier)] of each local edge partition
+ * are migrated (asynchronously, on the handle's stream) to the GPU if the edge partition indices or
+ * edge weights reside in managed memory. This replaces page faults in the following frontier
+ * expansion with bulk transfers. Frontiers in graph traversal are often clustered in the vertex ID
+ * space, so the prefetched range is close to the edges actually accessed. This function is a no-op
+ * for data residing in device or pinned host memory (pinned host memory is accessed directly
+ * through the interconnect).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam KeyBucketType Type of the vertex frontier bucket class which abstracts the current
+ * vertex frontier.
+ * @tparam weight_t Type of edge weights.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param frontier KeyBucketType class object for the current vertex frontier (to be expanded in the
+ * following iteration).
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ */
+template <typename GraphViewType, typename KeyBucketType, typename weight_t = float>
+void prefetch_frontier_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  KeyBucketType const& frontier,
+  std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+    edge_weight_view = std::nullopt)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_same_v<typename KeyBucketType::key_type, vertex_t>,
+                "currently, only untagged vertex frontiers are supported.");
+
+  // 1. compute the frontier vertex range
+
+  auto range = thrust::make_tuple(std::numeric_limits<vertex_t>::max(), vertex_t{0});
+  if (frontier.size() > 0) {
+    auto vertex_first = frontier.cbegin();
+    vertex_t min{};
+    vertex_t max{};
+    if constexpr (KeyBucketType::is_sorted_unique) {
+      raft::update_host(&min, vertex_first, size_t{1}, handle.get_stream());
+      raft::update_host(&max, vertex_first + (frontier.size() - 1), size_t{1}, handle.get_stream());
+    } else {
+      auto pair = thrust::minmax_element(
+        handle.get_thrust_policy(), vertex_first, vertex_first + frontier.size());
+      raft::update_host(&min, pair.first, size_t{1}, handle.get_stream());
+      raft::update_host(&max, pair.second, size_t{1}, handle.get_stream());
+    }
+    handle.sync_stream();
+    range = thrust::make_tuple(min, max);
+  }
+
+  // 2. the frontier of the i'th minor_comm rank is expanded in the i'th local edge partition
+
+  std::vector<thrust::tuple<vertex_t, vertex_t>> ranges{range};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    ranges           = host_scalar_allgather(minor_comm, range, handle.get_stream());
+  }
+
+  // 3. prefetch the edges of each local edge partition's frontier range
+
+  int device{};
+  RAFT_CUDA_TRY(cudaGetDevice(&device));
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto min = thrust::get<0>(ranges[i]);
+    auto max = thrust::get<1>(ranges[i]);
+    if (min > max) { continue; }  // empty frontier
+
+    auto edge_partition    = graph_view.local_edge_partition_view(i);
+    auto major_range_first = edge_partition.major_range_first();
+    auto offsets           = edge_partition.offsets();
+    // edges of hypersparse vertices are indexed through dcs_nzd_vertices, so the entire hypersparse
+    // segment is covered if the frontier range overlaps with the hypersparse segment
+    auto major_idx_first = static_cast<size_t>(min - major_range_first);
+    auto major_idx_last  = static_cast<size_t>(max - major_range_first) + 1;
+    if (edge_partition.major_hypersparse_first()) {
+      auto hypersparse_idx_first =
+        static_cast<size_t>(*(edge_partition.major_hypersparse_first()) - major_range_first);
+      major_idx_first = std::min(major_idx_first, hypersparse_idx_first);
+      if (major_idx_last > hypersparse_idx_first) { major_idx_last = offsets.size() - 1; }
+    }
+    major_idx_last = std::min(major_idx_last, offsets.size() - 1);
+    if (major_idx_first >= major_idx_last) { continue; }
+
+    edge_t edge_first{};
+    edge_t edge_last{};
+    raft::update_host(
+      &edge_first, offsets.data() + major_idx_first, size_t{1}, handle.get_stream());
+    raft::update_host(&edge_last, offsets.data() + major_idx_last, size_t{1}, handle.get_stream());
+    handle.sync_stream();
+
+    auto num_edges = static_cast<size_t>(edge_last - edge_first);
+    detail::prefetch_managed_memory(edge_partition.indices().data() + edge_first,
+                                    num_edges * sizeof(vertex_t),
+                                    device,
+                                    handle.get_stream());
+    if (edge_weight_view) {
+      detail::prefetch_managed_memory((*edge_weight_view).value_firsts()[i] + edge_first,
+                                      num_edges * sizeof(weight_t),
+                                      device,
+                                      handle.get_stream());
+    }
+  }
+}
+
+}  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,7 +25,10 @@
 #include <raft/core/comms.hpp>
 
 #include <thrust/functional.h>
+#include <thrust/tuple.h>
 
+#include <array>
+#include <type_traits>
 #include <utility>
 
 namespace cugraph {
@@ -223,6 +226,55 @@ struct plus {
   __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return op(lhs, rhs); }
 };
 
+// Binary reduction operator computing the bitwise OR of the two input arguments, T should be an
+// unsigned integral type (e.g. a word of a per-vertex bitmap), a compatible raft comms op does not
+// exist.
+template <typename T>
+struct bitwise_or {
+  static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>);
+
+  using value_type                       = T;
+  static constexpr bool pure_function    = true;  // this can be called in any process
+  inline static T const identity_element = T{0};
+
+  __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return lhs | rhs; }
+};
+
+// Binary reduction operator applying a (possibly different) reduction operator to each element of
+// a thrust tuple (e.g. elementwise<plus<float>, maximum<int32_t>> sums the first elements and
+// selects the maximum of the second elements). This allows computing multiple per-vertex reductions
+// (with separate output buffers, use a zip iterator) in a single pass over the edges. Every element
+// reduction operator should reduce an arithmetic type and should have a compatible raft comms op
+// and an identity element.
+template <typename... ElementReduceOps>
+struct elementwise {
+  static_assert(sizeof...(ElementReduceOps) > 0);
+  static_assert((std::is_arithmetic_v<typename ElementReduceOps::value_type> && ...));
+  static_assert((ElementReduceOps::pure_function && ...));
+
+  using value_type                    = thrust::tuple<typename ElementReduceOps::value_type...>;
+  static constexpr bool pure_function = true;  // this can be called in any process
+  static constexpr std::array<raft::comms::op_t, sizeof...(ElementReduceOps)>
+    compatible_raft_comms_ops{ElementReduceOps::compatible_raft_comms_op...};
+  inline static value_type const identity_element =
+    thrust::make_tuple(ElementReduceOps::identity_element...);
+  thrust::tuple<ElementReduceOps...> ops{};
+
+  __host__ __device__ value_type operator()(value_type const& lhs, value_type const& rhs) const
+  {
+    return reduce(lhs, rhs, std::index_sequence_for<ElementReduceOps...>());
+  }
+
+ private:
+  template <std::size_t... Is>
+  __host__ __device__ value_type reduce(value_type const& lhs,
+                                        value_type const& rhs,
+                                        std::index_sequence<Is...>) const
+  {
+    return thrust::make_tuple(thrust::get<Is>(ops)(thrust::get<Is>(lhs), thrust::get<Is>(rhs))...);
+  }
+};
+
 template <typename ReduceOp, typename = raft::comms::op_t>
 struct has_compatible_raft_comms_op : std::false_type {};
 
@@ -235,6 +287,37 @@ template <typename ReduceOp>
 inline constexpr bool has_compatible_raft_comms_op_v =
   has_compatible_raft_comms_op<ReduceOp>::value;
 
+template <typename ReduceOp, typename = void>
+struct has_compatible_raft_comms_ops : std::false_type {};
+
+template <typename ReduceOp>
+struct has_compatible_raft_comms_ops<ReduceOp,
+                                     std::void_t<decltype(ReduceOp::compatible_raft_comms_ops)>>
+  : std::true_type {};
+
+// true if ReduceOp has a compatible raft comms op per tuple element (e.g. reduce_op::elementwise)
+template <typename ReduceOp>
+inline constexpr bool has_compatible_raft_comms_ops_v =
+  has_compatible_raft_comms_ops<ReduceOp>::value;
+
+// true if values can be reduced using raft comms (and atomic_reduce is defined)
+template <typename ReduceOp>
+inline constexpr bool has_compatible_raft_comms_op_or_ops_v =
+  has_compatible_raft_comms_op_v<ReduceOp> || has_compatible_raft_comms_ops_v<ReduceOp>;
+
+// returns ReduceOp::compatible_raft_comms_op or ReduceOp::compatible_raft_comms_ops (an array of
+// raft comms ops, one per tuple element), to be passed to device_reduce
+template <typename ReduceOp>
+constexpr auto get_compatible_raft_comms_ops()
+{
+  static_assert(has_compatible_raft_comms_op_or_ops_v<ReduceOp>);
+  if constexpr (has_compatible_raft_comms_ops_v<ReduceOp>) {
+    return ReduceOp::compatible_raft_comms_ops;
+  } else {
+    return ReduceOp::compatible_raft_comms_op;
+  }
+}
+
 template <typename ReduceOp, typename = typename ReduceOp::value_type>
 struct has_identity_element : std::false_type {};
 
@@ -289,5 +372,69 @@ __device__ std::enable_if_t<has_compatible_raft_comms_op_v<ReduceOp>, void> atom
   }
 }
 
+namespace detail {
+
+template <raft::comms::op_t op, typename T>
+__device__ void atomic_reduce_element(T* ptr, T value)
+{
+  static_assert((op == raft::comms::op_t::SUM) || (op == raft::comms::op_t::MIN) ||
+                (op == raft::comms::op_t::MAX));
+
+  if constexpr (op == raft::comms::op_t::SUM) {
+    atomic_add(ptr, value);
+  } else if constexpr (op == raft::comms::op_t::MIN) {
+    elementwise_atomic_min(ptr, value);
+  } else {
+    elementwise_atomic_max(ptr, value);
+  }
+}
+
+template <typename ReduceOp>
+struct elementwise_atomic_reduce_t {
+  template <typename Iterator, std::size_t... Is>
+  __device__ void reduce(Iterator iter,
+                         typename ReduceOp::value_type const& value,
+                         std::index_sequence<Is...>) const
+  {
+    (atomic_reduce_element<ReduceOp::compatible_raft_comms_ops[Is]>(
+       &(thrust::raw_reference_cast(thrust::get<Is>(*iter))), thrust::get<Is>(value)),
+     ...);
+  }
+
+  template <typename Iterator>
+  __device__ void operator()(Iterator iter, typename ReduceOp::value_type const& value) const
+  {
+    reduce(iter,
+           value,
+           std::make_index_sequence<thrust::tuple_size<typename ReduceOp::value_type>::value>());
+  }
+};
+
+}  // namespace detail
+
+// atomic reduction applying a different atomic operation to each tuple element
+template <typename ReduceOp, typename Iterator>
+__device__ std::enable_if_t<has_compatible_raft_comms_ops_v<ReduceOp>, void> atomic_reduce(
+  Iterator iter, typename thrust::iterator_traits<Iterator>::value_type value)
+{
+  static_assert(std::is_same_v<typename ReduceOp::value_type,
+                               typename thrust::iterator_traits<Iterator>::value_type>);
+  if constexpr (!thrust::detail::is_discard_iterator<Iterator>::value) {
+    detail::elementwise_atomic_reduce_t<ReduceOp>{}(iter, value);
+  }
+}
+
+template <typename ReduceOp, typename EdgePartitionEndpointPropertyValueWrapper>
+__device__ std::enable_if_t<has_compatible_raft_comms_ops_v<ReduceOp>, void> atomic_reduce(
+  EdgePartitionEndpointPropertyValueWrapper edge_partition_endpoint_property_value,
+  typename EdgePartitionEndpointPropertyValueWrapper::vertex_type offset,
+  typename EdgePartitionEndpointPropertyValueWrapper::value_type value)
+{
+  static_assert(std::is_same_v<typename ReduceOp::value_type,
+                               typename EdgePartitionEndpointPropertyValueWrapper::value_type>);
+  edge_partition_endpoint_property_value.atomic_apply(
+    offset, value, detail::elementwise_atomic_reduce_t<ReduceOp>{});
+}
+
 }  // namespace reduce_op
 }  // namespace cugraph
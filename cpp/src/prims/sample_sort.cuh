@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// pick regular samples from the locally sorted keys, select (comm_size - 1) splitters from the
+// gathered samples, and return the number of local keys to send to each GPU
+template <typename key_t>
+std::vector<size_t> compute_sample_sort_tx_counts(raft::handle_t const& handle,
+                                                  raft::device_span<key_t const> sorted_keys,
+                                                  size_t num_samples_per_gpu)
+{
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+
+  rmm::device_uvector<key_t> samples(std::min(num_samples_per_gpu, sorted_keys.size()),
+                                     handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    samples.begin(),
+    samples.end(),
+    cuda::proclaim_return_type<key_t>(
+      [sorted_keys, num_samples = samples.size()] __device__(size_t i) {
+        return sorted_keys[((2 * i + 1) * sorted_keys.size()) / (2 * num_samples)];
+      }));
+
+  auto rx_sizes = host_scalar_allgather(comm, samples.size(), handle.get_stream());
+  std::vector<size_t> rx_displs(rx_sizes.size(), size_t{0});
+  std::exclusive_scan(rx_sizes.begin(), rx_sizes.end(), rx_displs.begin(), size_t{0});
+  rmm::device_uvector<key_t> all_samples(rx_displs.back() + rx_sizes.back(), handle.get_stream());
+  device_allgatherv(
+    comm, samples.begin(), all_samples.begin(), rx_sizes, rx_displs, handle.get_stream());
+
+  std::vector<size_t> tx_counts(comm_size, size_t{0});
+  if (all_samples.size() == 0) { return tx_counts; }  // no keys in any GPU
+
+  thrust::sort(handle.get_thrust_policy(), all_samples.begin(), all_samples.end());
+  rmm::device_uvector<key_t> splitters(comm_size - 1, handle.get_stream());
+  thrust::tabulate(handle.get_thrust_policy(),
+                   splitters.begin(),
+                   splitters.end(),
+                   cuda::proclaim_return_type<key_t>(
+                     [all_samples = raft::device_span<key_t const>(
+                        all_samples.data(), all_samples.size()),
+                      comm_size] __device__(size_t i) {
+                       return all_samples[((i + 1) * all_samples.size()) / comm_size];
+                     }));
+
+  rmm::device_uvector<size_t> d_boundaries(splitters.size(), handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      sorted_keys.begin(),
+                      sorted_keys.end(),
+                      splitters.begin(),
+                      splitters.end(),
+                      d_boundaries.begin());
+  std::vector<size_t> h_boundaries(comm_size + 1);
+  h_boundaries[0] = 0;
+  raft::update_host(
+    h_boundaries.data() + 1, d_boundaries.data(), d_boundaries.size(), handle.get_stream());
+  handle.sync_stream();
+  h_boundaries.back() = sorted_keys.size();
+  std::adjacent_difference(h_boundaries.begin() + 1, h_boundaries.end(), tx_counts.begin());
+
+  return tx_counts;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Sort (distributed) keys in the ascending order.
+ *
+ * In multi-GPU, this implements sample sort: keys are sorted locally, (comm_size - 1) splitters
+ * are selected from @p num_samples_per_gpu regular samples per GPU, and keys are shuffled by the
+ * splitters and sorted again. The i'th GPU holds the i'th range of the globally sorted keys on
+ * return (the number of keys per GPU may differ).
+ *
+ * @tparam key_t Type of the keys. Needs to be an arithmetic type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param keys Keys to sort (the local portion in multi-GPU).
+ * @param num_samples_per_gpu Number of samples per GPU to select splitters (larger values improve
+ * load balance at a higher cost).
+ * @return Sorted keys (the local portion of the globally sorted keys in multi-GPU).
+ */
+template <typename key_t, bool multi_gpu>
+rmm::device_uvector<key_t> sample_sort(raft::handle_t const& handle,
+                                       rmm::device_uvector<key_t>&& keys,
+                                       size_t num_samples_per_gpu = 128)
+{
+  static_assert(std::is_arithmetic_v<key_t>);
+
+  thrust::sort(handle.get_thrust_policy(), keys.begin(), keys.end());
+
+  if constexpr (multi_gpu) {
+    auto tx_counts = detail::compute_sample_sort_tx_counts(
+      handle, raft::device_span<key_t const>(keys.data(), keys.size()), num_samples_per_gpu);
+    std::tie(keys, std::ignore) =
+      shuffle_values(handle.get_comms(), keys.begin(), tx_counts, handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), keys.begin(), keys.end());
+  }
+
+  return std::move(keys);
+}
+
+/**
+ * @brief Sort (distributed) key, value pairs by keys in the ascending order.
+ *
+ * See sample_sort for the algorithm and the data distribution on return. Sorting is not stable.
+ *
+ * @tparam key_t Type of the keys. Needs to be an arithmetic type.
+ * @tparam value_t Type of the values. Needs to be an arithmetic type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param keys Keys to sort by (the local portion in multi-GPU).
+ * @param values Values (the local portion in multi-GPU), the size should coincide with @p keys.
+ * @param num_samples_per_gpu Number of samples per GPU to select splitters (larger values improve
+ * load balance at a higher cost).
+ * @return Tuple of the sorted keys and the values (the local portion in multi-GPU).
+ */
+template <typename key_t, typename value_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<key_t>, rmm::device_uvector<value_t>> sample_sort_by_key(
+  raft::handle_t const& handle,
+  rmm::device_uvector<key_t>&& keys,
+  rmm::device_uvector<value_t>&& values,
+  size_t num_samples_per_gpu = 128)
+{
+  static_assert(std::is_arithmetic_v<key_t>);
+  static_assert(std::is_arithmetic_v<value_t>);
+
+  CUGRAPH_EXPECTS(keys.size() == values.size(),
+                  "Invalid input arguments: keys and values should have the same size.");
+
+  thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+
+  if constexpr (multi_gpu) {
+    auto tx_counts = detail::compute_sample_sort_tx_counts(
+      handle, raft::device_span<key_t const>(keys.data(), keys.size()), num_samples_per_gpu);
+    std::forward_as_tuple(std::tie(keys, values), std::ignore) =
+      shuffle_values(handle.get_comms(),
+                     thrust::make_zip_iterator(keys.begin(), values.begin()),
+                     tx_counts,
+                     handle.get_stream());
+    thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+  }
+
+  return std::make_tuple(std::move(keys), std::move(values));
+}
+
+}  // namespace cugraph
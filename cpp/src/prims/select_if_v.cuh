@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t, typename VertexValueInputIterator, typename VertexOp>
+struct select_if_call_v_op_t {
+  vertex_t local_vertex_partition_range_first{};
+  VertexValueInputIterator vertex_value_input_first{};
+  VertexOp v_op{};
+
+  __device__ bool operator()(vertex_t i) const
+  {
+    return v_op(local_vertex_partition_range_first + i, *(vertex_value_input_first + i));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Select the local vertices (and their property values) that satisfy the given predicate.
+ *
+ * This version iterates over the entire set of graph vertices and does not communicate in
+ * multi-GPU (the selected vertices stay in the GPUs owning them), so this can be used to reduce the
+ * candidates (e.g. by thresholding algorithm outputs) before any inter-GPU data movement.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex property values.
+ * @tparam VertexOp Type of the binary predicate operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex property values for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.local_vertex_partition_range_size().
+ * @param v_op Binary operator takes vertex ID and *(@p vertex_value_input_first + i) (where i is
+ * [0, @p graph_view.local_vertex_partition_range_size())) and returns true if this vertex should be
+ * selected.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the selected local vertices (in the ascending order) and their property values.
+ */
+template <typename GraphViewType, typename VertexValueInputIterator, typename VertexOp>
+std::tuple<
+  rmm::device_uvector<typename GraphViewType::vertex_type>,
+  rmm::device_uvector<typename thrust::iterator_traits<VertexValueInputIterator>::value_type>>
+select_if_v(raft::handle_t const& handle,
+            GraphViewType const& graph_view,
+            VertexValueInputIterator vertex_value_input_first,
+            VertexOp v_op,
+            bool do_expensive_check = false)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using value_t  = typename thrust::iterator_traits<VertexValueInputIterator>::value_type;
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto pred = detail::select_if_call_v_op_t<vertex_t, VertexValueInputIterator, VertexOp>{
+    graph_view.local_vertex_partition_range_first(), vertex_value_input_first, v_op};
+
+  auto count = thrust::count_if(handle.get_thrust_policy(),
+                                thrust::make_counting_iterator(vertex_t{0}),
+                                thrust::make_counting_iterator(
+                                  graph_view.local_vertex_partition_range_size()),
+                                pred);
+
+  rmm::device_uvector<vertex_t> vertices(count, handle.get_stream());
+  rmm::device_uvector<value_t> values(count, handle.get_stream());
+  auto input_first = thrust::make_zip_iterator(
+    thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+    vertex_value_input_first);
+  thrust::copy_if(handle.get_thrust_policy(),
+                  input_first,
+                  input_first + graph_view.local_vertex_partition_range_size(),
+                  thrust::make_counting_iterator(vertex_t{0}),
+                  thrust::make_zip_iterator(vertices.begin(), values.begin()),
+                  pred);
+
+  return std::make_tuple(std::move(vertices), std::move(values));
+}
+
+}  // namespace cugraph
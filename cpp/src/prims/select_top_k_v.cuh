@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// sort by value (using value_comp) and break ties by vertex ID (in ascending order), this assumes
+// that values are arithmetic types (so stable_sort_by_key maps to radix sort)
+template <typename vertex_t, typename value_t, typename ValueCompareOp>
+void sort_by_value_and_vertex(raft::handle_t const& handle,
+                              rmm::device_uvector<vertex_t>& vertices,
+                              rmm::device_uvector<value_t>& values,
+                              ValueCompareOp value_comp,
+                              bool vertices_sorted)
+{
+  if (!vertices_sorted) {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), vertices.begin(), vertices.end(), values.begin());
+  }
+  thrust::stable_sort_by_key(
+    handle.get_thrust_policy(), values.begin(), values.end(), vertices.begin(), value_comp);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Select the top @p k vertices (over the entire set of graph vertices) based on the vertex
+ * property values.
+ *
+ * Each GPU first reduces its local vertices to (at most) @p k candidates, and only the candidates
+ * are exchanged in multi-GPU, so the communication volume is independent of the number of
+ * vertices. Ties are broken by vertex IDs (smaller vertex IDs are selected first).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex property values (should
+ * dereference to an arithmetic type).
+ * @tparam ValueCompareOp Type of the binary value comparison operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex property values for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.local_vertex_partition_range_size().
+ * @param k Number of vertices to select (if @p k is larger than the number of vertices, every
+ * vertex is selected).
+ * @param value_comp Binary operator returning true if the first value should precede the second
+ * value (e.g. thrust::greater<value_t> to select the vertices with the largest values).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the selected vertices and their property values, both in the selection order. In
+ * multi-GPU, each GPU returns the selected vertices in its local vertex partition range (so the
+ * returned vertices can be processed with the local vertex property values and renumber map).
+ */
+template <typename GraphViewType, typename VertexValueInputIterator, typename ValueCompareOp>
+std::tuple<
+  rmm::device_uvector<typename GraphViewType::vertex_type>,
+  rmm::device_uvector<typename thrust::iterator_traits<VertexValueInputIterator>::value_type>>
+select_top_k_v(raft::handle_t const& handle,
+               GraphViewType const& graph_view,
+               VertexValueInputIterator vertex_value_input_first,
+               size_t k,
+               ValueCompareOp value_comp,
+               bool do_expensive_check = false)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using value_t  = typename thrust::iterator_traits<VertexValueInputIterator>::value_type;
+
+  static_assert(std::is_arithmetic_v<value_t>);
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  // 1. reduce the local vertices to the local top-k candidates
+
+  rmm::device_uvector<vertex_t> vertices(graph_view.local_vertex_partition_range_size(),
+                                         handle.get_stream());
+  rmm::device_uvector<value_t> values(vertices.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   vertices.begin(),
+                   vertices.end(),
+                   graph_view.local_vertex_partition_range_first());
+  thrust::copy(handle.get_thrust_policy(),
+               vertex_value_input_first,
+               vertex_value_input_first + vertices.size(),
+               values.begin());
+  detail::sort_by_value_and_vertex(handle, vertices, values, value_comp, true);
+  if (vertices.size() > k) {
+    vertices.resize(k, handle.get_stream());
+    values.resize(k, handle.get_stream());
+    vertices.shrink_to_fit(handle.get_stream());
+    values.shrink_to_fit(handle.get_stream());
+  }
+
+  // 2. select the global top-k from the candidates and keep the local ones
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto rx_sizes = host_scalar_allgather(comm, vertices.size(), handle.get_stream());
+    std::vector<size_t> rx_displs(rx_sizes.size(), size_t{0});
+    std::exclusive_scan(rx_sizes.begin(), rx_sizes.end(), rx_displs.begin(), size_t{0});
+
+    rmm::device_uvector<vertex_t> candidate_vertices(rx_displs.back() + rx_sizes.back(),
+                                                     handle.get_stream());
+    rmm::device_uvector<value_t> candidate_values(candidate_vertices.size(), handle.get_stream());
+    auto candidate_pair_first =
+      thrust::make_zip_iterator(candidate_vertices.begin(), candidate_values.begin());
+    device_allgatherv(comm,
+                      thrust::make_zip_iterator(vertices.begin(), values.begin()),
+                      candidate_pair_first,
+                      rx_sizes,
+                      rx_displs,
+                      handle.get_stream());
+    detail::sort_by_value_and_vertex(
+      handle, candidate_vertices, candidate_values, value_comp, false);
+    if (candidate_vertices.size() > k) {
+      candidate_vertices.resize(k, handle.get_stream());
+      candidate_values.resize(k, handle.get_stream());
+    }
+
+    vertices.resize(candidate_vertices.size(), handle.get_stream());
+    values.resize(vertices.size(), handle.get_stream());
+    auto last = thrust::copy_if(
+      handle.get_thrust_policy(),
+      candidate_pair_first,
+      candidate_pair_first + candidate_vertices.size(),
+      candidate_vertices.begin(),
+      thrust::make_zip_iterator(vertices.begin(), values.begin()),
+      [range_first = graph_view.local_vertex_partition_range_first(),
+       range_last  = graph_view.local_vertex_partition_range_last()] __device__(auto v) {
+        return (v >= range_first) && (v < range_last);
+      });
+    vertices.resize(
+      thrust::distance(thrust::make_zip_iterator(vertices.begin(), values.begin()), last),
+      handle.get_stream());
+    values.resize(vertices.size(), handle.get_stream());
+    vertices.shrink_to_fit(handle.get_stream());
+    values.shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(vertices), std::move(values));
+}
+
+}  // namespace cugraph
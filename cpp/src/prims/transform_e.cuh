@@ -23,6 +23,7 @@
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/mask_utils.cuh>
 #include <cugraph/utilities/packed_bool_utils.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 
 #include <raft/core/handle.hpp>
 
@@ -270,6 +271,7 @@ void transform_e(raft::handle_t const& handle,
                  EdgeValueOutputWrapper edge_value_output,
                  bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "transform_e");
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
 
@@ -456,6 +458,7 @@ void transform_e(raft::handle_t const& handle,
                  EdgeValueOutputWrapper edge_value_output,
                  bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "transform_e");
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
 
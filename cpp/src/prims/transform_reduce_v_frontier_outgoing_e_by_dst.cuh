@@ -32,6 +32,8 @@
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/mask_utils.cuh>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
 
@@ -146,6 +148,43 @@ struct update_keep_flag_t {
   }
 };
 
+template <typename InputKeyIterator, typename PayloadIterator, typename key_t, typename ReduceOp>
+struct dense_reduce_t {
+  using input_key_t =
+    typename thrust::iterator_traits<InputKeyIterator>::value_type;  // uint32_t (compressed) or
+                                                                     // key_t (i.e. vertex_t)
+  using payload_t = typename thrust::iterator_traits<PayloadIterator>::value_type;
+
+  raft::device_span<uint32_t> bitmap{};
+  raft::device_span<payload_t> dense_payloads{};
+  key_t v_range_first{};
+  InputKeyIterator input_key_first{};
+  PayloadIterator payload_first{};
+  cuda::std::optional<input_key_t> invalid_input_key{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v = *(input_key_first + i);
+    if (invalid_input_key && (v == *invalid_input_key)) {
+      return;  // just discard
+    }
+    input_key_t v_offset{};
+    if constexpr ((sizeof(key_t) == 8) && std::is_same_v<input_key_t, uint32_t>) {
+      v_offset = v;
+    } else {
+      v_offset = v - v_range_first;
+    }
+    reduce_op::atomic_reduce<ReduceOp>(dense_payloads.begin() + v_offset,
+                                       *(payload_first + i));
+    cuda::atomic_ref<uint32_t, cuda::thread_scope_device> bitmap_word(
+      bitmap[packed_bool_offset(v_offset)]);
+    if ((bitmap_word.load(cuda::std::memory_order_relaxed) & packed_bool_mask(v_offset)) ==
+        packed_bool_empty_mask()) {  // avoid atomic contention on the frequently reached vertices
+      bitmap_word.fetch_or(packed_bool_mask(v_offset), cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
 template <typename priority_t, typename vertex_t, typename payload_t>
 std::tuple<rmm::device_uvector<vertex_t>, optional_dataframe_buffer_type_t<payload_t>>
 filter_buffer_elements(
@@ -375,6 +414,67 @@ sort_and_reduce_buffer_elements(
     }
   }
 
+  if constexpr (std::is_integral_v<key_t> && std::is_arithmetic_v<payload_t> &&
+                reduce_op::has_compatible_raft_comms_op_v<ReduceOp> &&
+                reduce_op::has_identity_element_v<ReduceOp>) {  // try to reduce into a dense
+                                                                // array with atomics
+    key_t range_size = std::get<1>(vertex_range) - std::get<0>(vertex_range);
+    if (static_cast<double>(size_dataframe_buffer(key_buffer)) >=
+        static_cast<double>(range_size) *
+          0.1 /* tuning parameter */) {  // the buffer is dense enough to amortize the
+                                         // O(range_size) dense array, skip sorting
+      rmm::device_uvector<uint32_t> bitmap(packed_bool_size(range_size), handle.get_stream());
+      rmm::device_uvector<payload_t> dense_payloads(range_size, handle.get_stream());
+      thrust::fill(
+        handle.get_thrust_policy(), bitmap.begin(), bitmap.end(), packed_bool_empty_mask());
+      thrust::fill(handle.get_thrust_policy(),
+                   dense_payloads.begin(),
+                   dense_payloads.end(),
+                   ReduceOp::identity_element);
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(size_dataframe_buffer(key_buffer)),
+        dense_reduce_t<decltype(get_dataframe_buffer_begin(key_buffer)),
+                       decltype(get_dataframe_buffer_begin(payload_buffer)),
+                       key_t,
+                       ReduceOp>{
+          raft::device_span<uint32_t>(bitmap.data(), bitmap.size()),
+          raft::device_span<payload_t>(dense_payloads.data(), dense_payloads.size()),
+          std::get<0>(vertex_range),
+          get_dataframe_buffer_begin(key_buffer),
+          get_dataframe_buffer_begin(payload_buffer),
+          to_thrust_optional(invalid_key)});
+      resize_dataframe_buffer(key_buffer, 0, handle.get_stream());
+      resize_dataframe_buffer(payload_buffer, 0, handle.get_stream());
+      shrink_to_fit_dataframe_buffer(key_buffer, handle.get_stream());
+      shrink_to_fit_dataframe_buffer(payload_buffer, handle.get_stream());
+
+      auto num_keys =
+        detail::count_set_bits(handle, bitmap.begin(), static_cast<size_t>(range_size));
+      auto output_key_buffer = allocate_dataframe_buffer<key_t>(num_keys, handle.get_stream());
+      auto output_payload_buffer =
+        allocate_dataframe_buffer<payload_t>(num_keys, handle.get_stream());
+      auto input_pair_first = thrust::make_zip_iterator(
+        thrust::make_counting_iterator(std::get<0>(vertex_range)), dense_payloads.begin());
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        input_pair_first,
+        input_pair_first + range_size,
+        thrust::make_counting_iterator(key_t{0}),
+        thrust::make_zip_iterator(get_dataframe_buffer_begin(output_key_buffer),
+                                  get_dataframe_buffer_begin(output_payload_buffer)),
+        cuda::proclaim_return_type<bool>(
+          [bitmap = raft::device_span<uint32_t const>(bitmap.data(), bitmap.size())] __device__(
+            key_t v_offset) {
+            return (bitmap[packed_bool_offset(v_offset)] & packed_bool_mask(v_offset)) !=
+                   packed_bool_empty_mask();
+          }));  // the output keys are sorted as the dense array is scanned in the vertex order
+
+      return std::make_tuple(std::move(output_key_buffer), std::move(output_payload_buffer));
+    }
+  }
+
   if constexpr (std::is_same_v<payload_t, void>) {
     thrust::sort(handle.get_thrust_policy(),
                  get_dataframe_buffer_begin(key_buffer),
@@ -1182,6 +1282,8 @@ transform_reduce_v_frontier_outgoing_e_by_dst(raft::handle_t const& handle,
                                               ReduceOp reduce_op,
                                               bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(),
+                                     "transform_reduce_v_frontier_outgoing_e_by_dst");
   return detail::transform_reduce_v_frontier_outgoing_e_by_dst(handle,
                                                                graph_view,
                                                                frontier,
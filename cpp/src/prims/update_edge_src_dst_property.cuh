@@ -16,6 +16,7 @@
 #pragma once
 
 #include "detail/graph_partition_utils.cuh"
+#include "prims/detail/prim_utils.cuh"
 #include "prims/vertex_frontier.cuh"
 
 #include <cugraph/edge_partition_device_view.cuh>
@@ -26,9 +27,11 @@
 #include <cugraph/utilities/atomic_ops.cuh>
 #include <cugraph/utilities/dataframe_buffer.hpp>
 #include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/packed_bool_utils.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
@@ -45,15 +48,21 @@
 #include <thrust/for_each.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scatter.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
 
 #include <algorithm>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace cugraph {
 
@@ -718,25 +727,150 @@ void update_edge_minor_property(raft::handle_t const& handle,
 
     auto v_list_size =
       static_cast<size_t>(thrust::distance(sorted_unique_vertex_first, sorted_unique_vertex_last));
-    std::array<vertex_t, 2> v_list_range = {vertex_t{0}, vertex_t{0}};
-    if (v_list_size > 0) {
-      rmm::device_uvector<vertex_t> tmps(2, handle.get_stream());
-      thrust::tabulate(handle.get_thrust_policy(),
-                       tmps.begin(),
-                       tmps.end(),
-                       [sorted_unique_vertex_first, v_list_size] __device__(size_t i) {
-                         return (i == 0) ? *sorted_unique_vertex_first
-                                         : (*(sorted_unique_vertex_first + (v_list_size - 1)) + 1);
-                       });
-      raft::update_host(v_list_range.data(), tmps.data(), 2, handle.get_stream());
+
+    std::vector<size_t> local_v_list_sizes(major_comm_size);
+    std::vector<vertex_t> local_v_list_range_firsts(major_comm_size);
+    std::vector<vertex_t> local_v_list_range_lasts(major_comm_size);
+    {
+      rmm::device_uvector<size_t> d_aggregate_tmps(major_comm_size * size_t{3},
+                                                   handle.get_stream());
+      thrust::tabulate(
+        handle.get_thrust_policy(),
+        d_aggregate_tmps.begin() + major_comm_rank * size_t{3},
+        d_aggregate_tmps.begin() + (major_comm_rank + 1) * size_t{3},
+        [sorted_unique_vertex_first, v_list_size] __device__(size_t i) {
+          if (i == 0) {
+            return v_list_size;
+          } else if (v_list_size == 0) {
+            return size_t{0};
+          } else if (i == 1) {
+            return static_cast<size_t>(*sorted_unique_vertex_first);
+          } else {
+            return static_cast<size_t>(*(sorted_unique_vertex_first + (v_list_size - 1)) + 1);
+          }
+        });
+
+      if (major_comm_size > 1) {  // allgather v_list_size, v_list_range_first (inclusive), and
+                                  // v_list_range_last (exclusive) in a single collective
+        device_allgather(major_comm,
+                         d_aggregate_tmps.data() + major_comm_rank * size_t{3},
+                         d_aggregate_tmps.data(),
+                         size_t{3},
+                         handle.get_stream());
+      }
+
+      std::vector<size_t> h_aggregate_tmps(d_aggregate_tmps.size());
+      raft::update_host(h_aggregate_tmps.data(),
+                        d_aggregate_tmps.data(),
+                        d_aggregate_tmps.size(),
+                        handle.get_stream());
       handle.sync_stream();
+      for (int i = 0; i < major_comm_size; ++i) {
+        local_v_list_sizes[i]        = h_aggregate_tmps[i * size_t{3}];
+        local_v_list_range_firsts[i] = static_cast<vertex_t>(h_aggregate_tmps[i * size_t{3} + 1]);
+        local_v_list_range_lasts[i]  = static_cast<vertex_t>(h_aggregate_tmps[i * size_t{3} + 2]);
+      }
     }
 
-    auto local_v_list_sizes = host_scalar_allgather(major_comm, v_list_size, handle.get_stream());
-    auto local_v_list_range_firsts =
-      host_scalar_allgather(major_comm, v_list_range[0], handle.get_stream());
-    auto local_v_list_range_lasts =
-      host_scalar_allgather(major_comm, v_list_range[1], handle.get_stream());
+    auto aggregate_v_list_size =
+      std::reduce(local_v_list_sizes.begin(), local_v_list_sizes.end(), size_t{0});
+    if (aggregate_v_list_size <= small_v_list_allgatherv_threshold) {
+      // latency-optimized path: collect every (vertex, value) pair in major_comm with allgatherv
+      // (instead of per-partition vertex list & value broadcasts) and update the values with a
+      // single kernel
+      using rx_value_t =
+        std::conditional_t<contains_packed_bool_element,
+                           uint8_t,
+                           typename EdgeMinorPropertyOutputWrapper::value_type>;
+
+      auto vertex_partition =
+        vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+          graph_view.local_vertex_partition_view());
+      auto tx_value_buffer =
+        allocate_dataframe_buffer<rx_value_t>(v_list_size, handle.get_stream());
+      if constexpr (contains_packed_bool_element) {
+        thrust::transform(
+          handle.get_thrust_policy(),
+          sorted_unique_vertex_first,
+          sorted_unique_vertex_last,
+          get_dataframe_buffer_begin(tx_value_buffer),
+          cuda::proclaim_return_type<uint8_t>(
+            [vertex_property_input_first, vertex_partition] __device__(auto v) {
+              auto v_offset = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+              return static_cast<uint8_t>(
+                static_cast<bool>(*(vertex_property_input_first + packed_bool_offset(v_offset)) &
+                                  packed_bool_mask(v_offset)));
+            }));
+      } else {
+        auto map_first = thrust::make_transform_iterator(
+          sorted_unique_vertex_first,
+          cuda::proclaim_return_type<vertex_t>([vertex_partition] __device__(auto v) {
+            return vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+          }));
+        thrust::gather(handle.get_thrust_policy(),
+                       map_first,
+                       map_first + v_list_size,
+                       vertex_property_input_first,
+                       get_dataframe_buffer_begin(tx_value_buffer));
+      }
+
+      std::vector<size_t> rx_displacements(major_comm_size);
+      std::exclusive_scan(local_v_list_sizes.begin(),
+                          local_v_list_sizes.end(),
+                          rx_displacements.begin(),
+                          size_t{0});
+      rmm::device_uvector<vertex_t> rx_vertices(aggregate_v_list_size, handle.get_stream());
+      auto rx_value_buffer =
+        allocate_dataframe_buffer<rx_value_t>(aggregate_v_list_size, handle.get_stream());
+      device_allgatherv(major_comm,
+                        sorted_unique_vertex_first,
+                        rx_vertices.begin(),
+                        local_v_list_sizes,
+                        rx_displacements,
+                        handle.get_stream());
+      device_allgatherv(major_comm,
+                        get_dataframe_buffer_begin(tx_value_buffer),
+                        get_dataframe_buffer_begin(rx_value_buffer),
+                        local_v_list_sizes,
+                        rx_displacements,
+                        handle.get_stream());
+
+      // keys (if valid) are sorted over the entire minor range (key_offsets split the keys by
+      // vertex partition)
+      auto edge_partition_keys = edge_minor_property_output.keys();
+      auto edge_partition =
+        edge_partition_device_view_t<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+          graph_view.local_edge_partition_view(size_t{0}));
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(aggregate_v_list_size),
+        [rx_vertex_first = rx_vertices.begin(),
+         rx_value_first  = get_dataframe_buffer_begin(rx_value_buffer),
+         key_first       = edge_partition_keys ? (*edge_partition_keys).begin()
+                                               : static_cast<vertex_t const*>(nullptr),
+         key_last        = edge_partition_keys ? (*edge_partition_keys).end()
+                                               : static_cast<vertex_t const*>(nullptr),
+         edge_partition,
+         edge_partition_value_first = edge_partition_value_first] __device__(size_t i) {
+          auto minor = *(rx_vertex_first + i);
+          vertex_t minor_offset{};
+          if (key_first != nullptr) {
+            auto it = thrust::lower_bound(thrust::seq, key_first, key_last, minor);
+            if ((it == key_last) || (*it != minor)) { return; }
+            minor_offset = static_cast<vertex_t>(thrust::distance(key_first, it));
+          } else {
+            minor_offset = edge_partition.minor_offset_from_minor_nocheck(minor);
+          }
+          if constexpr (contains_packed_bool_element) {
+            packed_bool_atomic_set(
+              edge_partition_value_first, minor_offset, static_cast<bool>(*(rx_value_first + i)));
+          } else {
+            *(edge_partition_value_first + minor_offset) = *(rx_value_first + i);
+          }
+        });
+      return;
+    }
 
     std::optional<rmm::device_uvector<uint32_t>> v_list_bitmap{std::nullopt};
     if (major_comm_size > 1) {
@@ -930,6 +1064,229 @@ void update_edge_minor_property(raft::handle_t const& handle,
   }
 }
 
+// key chunk size for the sparse edge src/dst property caches (binary search range per lookup)
+size_t constexpr sparse_edge_property_key_chunk_size = 1024;
+
+template <typename vertex_t>
+rmm::device_uvector<vertex_t> compute_key_chunk_start_offsets(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> sorted_unique_keys,
+  vertex_t range_first,
+  vertex_t range_size,
+  size_t key_chunk_size)
+{
+  auto num_chunks =
+    static_cast<size_t>((range_size + (key_chunk_size - size_t{1})) / key_chunk_size);
+  rmm::device_uvector<vertex_t> key_chunk_start_offsets(num_chunks + size_t{1},
+                                                        handle.get_stream());
+  auto chunk_start_vertex_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(vertex_t{0}),
+    multiply_and_add_t<vertex_t>{static_cast<vertex_t>(key_chunk_size), range_first});
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      sorted_unique_keys.begin(),
+                      sorted_unique_keys.end(),
+                      chunk_start_vertex_first,
+                      chunk_start_vertex_first + num_chunks,
+                      key_chunk_start_offsets.begin());
+  key_chunk_start_offsets.set_element(
+    num_chunks, static_cast<vertex_t>(sorted_unique_keys.size()), handle.get_stream());
+  return key_chunk_start_offsets;
+}
+
+template <typename T, typename ValueIterator>
+void copy_sparse_edge_property_values(raft::handle_t const& handle,
+                                      dataframe_buffer_type_t<T> const& values,
+                                      size_t offset,
+                                      size_t size,
+                                      ValueIterator output_first)
+{
+  if constexpr (std::is_same_v<T, bool>) {
+    pack_bools(
+      handle, values.begin() + offset, values.begin() + (offset + size), output_first);
+  } else {
+    thrust::copy(handle.get_thrust_policy(),
+                 get_dataframe_buffer_cbegin(values) + offset,
+                 get_dataframe_buffer_cbegin(values) + (offset + size),
+                 output_first);
+  }
+}
+
+// gather (over minor_comm in multi-GPU) the local vertices with non-default values into the major
+// ranges of the local edge partitions
+template <typename GraphViewType, typename T>
+edge_major_property_t<typename GraphViewType::vertex_type, T> create_sparse_edge_major_property(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& local_keys,
+  dataframe_buffer_type_t<T>&& local_values,
+  T default_value)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto keys   = std::move(local_keys);
+  auto values = std::move(local_values);
+  std::vector<size_t> rx_counts{keys.size()};
+  std::vector<size_t> rx_displacements{0};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    rx_counts        = host_scalar_allgather(minor_comm, keys.size(), handle.get_stream());
+    rx_displacements = std::vector<size_t>(rx_counts.size());
+    std::exclusive_scan(rx_counts.begin(), rx_counts.end(), rx_displacements.begin(), size_t{0});
+    auto num_rx = rx_displacements.back() + rx_counts.back();
+
+    rmm::device_uvector<vertex_t> rx_keys(num_rx, handle.get_stream());
+    auto rx_values = allocate_dataframe_buffer<T>(num_rx, handle.get_stream());
+    device_allgatherv(
+      minor_comm, keys.begin(), rx_keys.begin(), rx_counts, rx_displacements, handle.get_stream());
+    device_allgatherv(minor_comm,
+                      get_dataframe_buffer_cbegin(values),
+                      get_dataframe_buffer_begin(rx_values),
+                      rx_counts,
+                      rx_displacements,
+                      handle.get_stream());
+    keys   = std::move(rx_keys);
+    values = std::move(rx_values);
+  }
+
+  auto num_edge_partitions = graph_view.number_of_local_edge_partitions();
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_keys{};
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_key_chunk_start_offsets{};
+  std::vector<vertex_t> major_range_firsts(num_edge_partitions);
+  edge_partition_keys.reserve(num_edge_partitions);
+  edge_partition_key_chunk_start_offsets.reserve(num_edge_partitions);
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t,
+                                   typename GraphViewType::edge_type,
+                                   GraphViewType::is_multi_gpu>(
+        graph_view.local_edge_partition_view(i));
+    major_range_firsts[i] = edge_partition.major_range_first();
+
+    rmm::device_uvector<vertex_t> tmp_keys(rx_counts[i], handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 keys.begin() + rx_displacements[i],
+                 keys.begin() + (rx_displacements[i] + rx_counts[i]),
+                 tmp_keys.begin());
+    edge_partition_key_chunk_start_offsets.push_back(compute_key_chunk_start_offsets(
+      handle,
+      raft::device_span<vertex_t const>(tmp_keys.data(), tmp_keys.size()),
+      edge_partition.major_range_first(),
+      edge_partition.major_range_size(),
+      sparse_edge_property_key_chunk_size));
+    edge_partition_keys.push_back(std::move(tmp_keys));
+  }
+  keys.resize(0, handle.get_stream());
+  keys.shrink_to_fit(handle.get_stream());
+
+  edge_major_property_t<vertex_t, T> property(handle,
+                                              std::move(edge_partition_keys),
+                                              std::move(edge_partition_key_chunk_start_offsets),
+                                              sparse_edge_property_key_chunk_size,
+                                              major_range_firsts,
+                                              default_value);
+  auto property_view = property.mutable_view();
+  for (size_t i = 0; i < num_edge_partitions; ++i) {
+    copy_sparse_edge_property_values<T>(
+      handle, values, rx_displacements[i], rx_counts[i], property_view.value_firsts()[i]);
+  }
+
+  return property;
+}
+
+// gather (over major_comm in multi-GPU) the local vertices with non-default values into the minor
+// range of the local edge partitions
+template <typename GraphViewType, typename T>
+edge_minor_property_t<typename GraphViewType::vertex_type, T> create_sparse_edge_minor_property(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& local_keys,
+  dataframe_buffer_type_t<T>&& local_values,
+  T default_value)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto keys   = std::move(local_keys);
+  auto values = std::move(local_values);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto rx_counts   = host_scalar_allgather(major_comm, keys.size(), handle.get_stream());
+    std::vector<size_t> rx_displacements(rx_counts.size());
+    std::exclusive_scan(rx_counts.begin(), rx_counts.end(), rx_displacements.begin(), size_t{0});
+    auto num_rx = rx_displacements.back() + rx_counts.back();
+
+    // the minor range is the concatenation of the vertex partition ranges in major_comm rank
+    // order, so the received keys are sorted
+    rmm::device_uvector<vertex_t> rx_keys(num_rx, handle.get_stream());
+    auto rx_values = allocate_dataframe_buffer<T>(num_rx, handle.get_stream());
+    device_allgatherv(
+      major_comm, keys.begin(), rx_keys.begin(), rx_counts, rx_displacements, handle.get_stream());
+    device_allgatherv(major_comm,
+                      get_dataframe_buffer_cbegin(values),
+                      get_dataframe_buffer_begin(rx_values),
+                      rx_counts,
+                      rx_displacements,
+                      handle.get_stream());
+    keys   = std::move(rx_keys);
+    values = std::move(rx_values);
+  }
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t,
+                                 typename GraphViewType::edge_type,
+                                 GraphViewType::is_multi_gpu>(
+      graph_view.local_edge_partition_view(size_t{0}));
+  auto key_chunk_start_offsets = compute_key_chunk_start_offsets(
+    handle,
+    raft::device_span<vertex_t const>(keys.data(), keys.size()),
+    edge_partition.minor_range_first(),
+    edge_partition.minor_range_size(),
+    sparse_edge_property_key_chunk_size);
+  auto num_keys = keys.size();
+
+  edge_minor_property_t<vertex_t, T> property(handle,
+                                              std::move(keys),
+                                              std::move(key_chunk_start_offsets),
+                                              sparse_edge_property_key_chunk_size,
+                                              edge_partition.minor_range_first(),
+                                              default_value);
+  auto property_view = property.mutable_view();
+  copy_sparse_edge_property_values<T>(
+    handle, values, size_t{0}, num_keys, property_view.value_first());
+
+  return property;
+}
+
+template <typename GraphViewType, typename VertexPropertyInputIterator, typename T>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>, dataframe_buffer_type_t<T>>
+extract_non_default_vertex_values(raft::handle_t const& handle,
+                                  GraphViewType const& graph_view,
+                                  VertexPropertyInputIterator vertex_property_input_first,
+                                  T default_value)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto local_vertex_first = thrust::make_counting_iterator(
+    graph_view.local_vertex_partition_range_first());
+  auto pair_first = thrust::make_zip_iterator(local_vertex_first, vertex_property_input_first);
+  auto num_keys   = static_cast<size_t>(thrust::count_if(
+    handle.get_thrust_policy(),
+    vertex_property_input_first,
+    vertex_property_input_first + graph_view.local_vertex_partition_range_size(),
+    [default_value] __device__(auto val) { return val != default_value; }));
+
+  rmm::device_uvector<vertex_t> keys(num_keys, handle.get_stream());
+  auto values = allocate_dataframe_buffer<T>(num_keys, handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  pair_first,
+                  pair_first + graph_view.local_vertex_partition_range_size(),
+                  thrust::make_zip_iterator(keys.begin(), get_dataframe_buffer_begin(values)),
+                  [default_value] __device__(auto pair) {
+                    return thrust::get<1>(pair) != default_value;
+                  });
+
+  return std::make_tuple(std::move(keys), std::move(values));
+}
+
 }  // namespace detail
 
 /**
@@ -961,6 +1318,10 @@ void update_edge_src_property(raft::handle_t const& handle,
                               EdgeSrcValueOutputWrapper edge_src_property_output,
                               bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "update_edge_src_property");
+  CUGRAPH_EXPECTS(!edge_src_property_output.default_value(),
+                  "Invalid input argument: sparse edge source property values are read-only "
+                  "(re-create them with create_sparse_edge_src_property).");
   if (do_expensive_check) {
     // currently, nothing to do
   }
@@ -1014,6 +1375,10 @@ void update_edge_src_property(raft::handle_t const& handle,
                               EdgeSrcValueOutputWrapper edge_src_property_output,
                               bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "update_edge_src_property");
+  CUGRAPH_EXPECTS(!edge_src_property_output.default_value(),
+                  "Invalid input argument: sparse edge source property values are read-only "
+                  "(re-create them with create_sparse_edge_src_property).");
   if (do_expensive_check) {
     auto num_invalids = thrust::count_if(
       handle.get_thrust_policy(),
@@ -1081,6 +1446,10 @@ void update_edge_dst_property(raft::handle_t const& handle,
                               EdgeDstValueOutputWrapper edge_dst_property_output,
                               bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "update_edge_dst_property");
+  CUGRAPH_EXPECTS(!edge_dst_property_output.default_value(),
+                  "Invalid input argument: sparse edge destination property values are read-only "
+                  "(re-create them with create_sparse_edge_dst_property).");
   if (do_expensive_check) {
     // currently, nothing to do
   }
@@ -1135,6 +1504,10 @@ void update_edge_dst_property(raft::handle_t const& handle,
                               EdgeDstValueOutputWrapper edge_dst_property_output,
                               bool do_expensive_check = false)
 {
+  prim_profile_range_t profile_range(handle.get_stream(), "update_edge_dst_property");
+  CUGRAPH_EXPECTS(!edge_dst_property_output.default_value(),
+                  "Invalid input argument: sparse edge destination property values are read-only "
+                  "(re-create them with create_sparse_edge_dst_property).");
   if (do_expensive_check) {
     auto num_invalids = thrust::count_if(
       handle.get_thrust_policy(),
@@ -1172,4 +1545,104 @@ void update_edge_dst_property(raft::handle_t const& handle,
   }
 }
 
+/**
+ * @brief Create graph edge source property values storing only the vertices with non-default
+ * values.
+ *
+ * edge_src_property_t replicates the vertex property values for the entire edge source ranges
+ * (assigned to this process in multi-GPU). If most vertices share one value (e.g. a boolean flag
+ * set for a small subset of the vertices), this stores (key, value) pairs only for the vertices
+ * with values different from @p default_value; lookups of the other vertices return @p
+ * default_value. This reduces memory footprint (and communication volume) if the fraction of
+ * vertices with non-default values is smaller than sizeof(value_t) / (sizeof(vertex_t) +
+ * sizeof(value_t)) (boolean values remain bit-packed). Lookups become binary searches in key
+ * chunks. The returned property values are read-only; update_edge_src_property and
+ * fill_edge_src_property reject them.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexPropertyInputIterator Type of the iterator for vertex property values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_property_input_first Iterator pointing to the vertex property value for the first
+ * (inclusive) vertex (of the vertex partition assigned to this process in multi-GPU).
+ * `vertex_property_input_last` (exclusive) is deduced as @p vertex_property_input_first + @p
+ * graph_view.local_vertex_partition_range_size().
+ * @param default_value Value for the vertices not explicitly stored.
+ * @return edge_src_property_t class object holding the (sparse) edge source property values.
+ */
+template <typename GraphViewType, typename VertexPropertyInputIterator>
+edge_src_property_t<GraphViewType,
+                    typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type>
+create_sparse_edge_src_property(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexPropertyInputIterator vertex_property_input_first,
+  typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type default_value)
+{
+  using T = typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type;
+  prim_profile_range_t profile_range(handle.get_stream(), "create_sparse_edge_src_property");
+
+  auto [keys, values] = detail::extract_non_default_vertex_values(
+    handle, graph_view, vertex_property_input_first, default_value);
+
+  if constexpr (GraphViewType::is_storage_transposed) {
+    return edge_src_property_t<GraphViewType, T>(
+      handle,
+      detail::create_sparse_edge_minor_property<GraphViewType, T>(
+        handle, graph_view, std::move(keys), std::move(values), default_value));
+  } else {
+    return edge_src_property_t<GraphViewType, T>(
+      handle,
+      detail::create_sparse_edge_major_property<GraphViewType, T>(
+        handle, graph_view, std::move(keys), std::move(values), default_value));
+  }
+}
+
+/**
+ * @brief Create graph edge destination property values storing only the vertices with non-default
+ * values.
+ *
+ * See create_sparse_edge_src_property; the same for the edge destination ranges.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexPropertyInputIterator Type of the iterator for vertex property values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_property_input_first Iterator pointing to the vertex property value for the first
+ * (inclusive) vertex (of the vertex partition assigned to this process in multi-GPU).
+ * `vertex_property_input_last` (exclusive) is deduced as @p vertex_property_input_first + @p
+ * graph_view.local_vertex_partition_range_size().
+ * @param default_value Value for the vertices not explicitly stored.
+ * @return edge_dst_property_t class object holding the (sparse) edge destination property values.
+ */
+template <typename GraphViewType, typename VertexPropertyInputIterator>
+edge_dst_property_t<GraphViewType,
+                    typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type>
+create_sparse_edge_dst_property(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  VertexPropertyInputIterator vertex_property_input_first,
+  typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type default_value)
+{
+  using T = typename thrust::iterator_traits<VertexPropertyInputIterator>::value_type;
+  prim_profile_range_t profile_range(handle.get_stream(), "create_sparse_edge_dst_property");
+
+  auto [keys, values] = detail::extract_non_default_vertex_values(
+    handle, graph_view, vertex_property_input_first, default_value);
+
+  if constexpr (GraphViewType::is_storage_transposed) {
+    return edge_dst_property_t<GraphViewType, T>(
+      handle,
+      detail::create_sparse_edge_major_property<GraphViewType, T>(
+        handle, graph_view, std::move(keys), std::move(values), default_value));
+  } else {
+    return edge_dst_property_t<GraphViewType, T>(
+      handle,
+      detail::create_sparse_edge_minor_property<GraphViewType, T>(
+        handle, graph_view, std::move(keys), std::move(values), default_value));
+  }
+}
+
 }  // namespace cugraph
@@ -36,6 +36,7 @@
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
@@ -44,6 +45,7 @@
 #include <thrust/remove.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
@@ -503,6 +505,7 @@ class key_bucket_t {
     }
   }
 
+  // clear() keeps the current capacity, call shrink_to_fit() to release the memory.
   void clear()
   {
     CUGRAPH_EXPECTS(vertices_.index() == 0,
@@ -510,6 +513,86 @@ class key_bucket_t {
     resize(0);
   }
 
+  size_t capacity() const
+  {
+    return vertices_.index() == 0 ? std::get<0>(vertices_).capacity()
+                                  : std::get<1>(vertices_).size();
+  }
+
+  // pre-allocate memory for up to new_capacity keys to avoid re-allocation (and copying the
+  // existing keys) in the following insert() and resize() calls; this does not change the size.
+  void reserve(size_t new_capacity)
+  {
+    CUGRAPH_EXPECTS(vertices_.index() == 0,
+                    "reserve() is supported only when this bucket holds an owning container.");
+    std::get<0>(vertices_).reserve(new_capacity, handle_ptr_->get_stream());
+    if constexpr (!std::is_same_v<tag_t, void>) {
+      std::get<0>(tags_).reserve(new_capacity, handle_ptr_->get_stream());
+    }
+  }
+
+  /**
+   * @ brief replace the bucket elements with the vertices set in a bitmap
+   *
+   * A bitmap requires (vertex_range_last - vertex_range_first) / 8 bytes and is a more compact
+   * representation for dense frontiers; this converts the dense representation back to a vertex
+   * list (in the sorted unique order).
+   *
+   * @param bitmap Bitmap of the vertices in [vertex_range_first, vertex_range_last) (bit i is set
+   * if vertex_range_first + i is in the frontier).
+   * @param vertex_range_first First (inclusive) vertex of the range covered by @p bitmap.
+   * @param vertex_range_last Last (exclusive) vertex of the range covered by @p bitmap.
+   */
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  void assign_from_bitmap(raft::device_span<uint32_t const> bitmap,
+                          vertex_t vertex_range_first,
+                          vertex_t vertex_range_last)
+  {
+    CUGRAPH_EXPECTS(
+      vertices_.index() == 0,
+      "assign_from_bitmap() is supported only when this bucket holds an owning container.");
+    CUGRAPH_EXPECTS(
+      bitmap.size() >= packed_bool_size(vertex_range_last - vertex_range_first),
+      "Invalid input arguments: bitmap size should cover [vertex_range_first, vertex_range_last).");
+
+    auto count = thrust::transform_reduce(
+      handle_ptr_->get_thrust_policy(),
+      bitmap.begin(),
+      bitmap.begin() + packed_bool_size(vertex_range_last - vertex_range_first),
+      cuda::proclaim_return_type<size_t>(
+        [] __device__(uint32_t word) { return static_cast<size_t>(__popc(word)); }),
+      size_t{0},
+      thrust::plus<size_t>{});
+    std::get<0>(vertices_).resize(count, handle_ptr_->get_stream());
+    rmm::device_scalar<size_t> dummy(size_t{0}, handle_ptr_->get_stream());  // already known
+    retrieve_vertex_list_from_bitmap(bitmap,
+                                     std::get<0>(vertices_).begin(),
+                                     raft::device_span<size_t>(dummy.data(), size_t{1}),
+                                     vertex_range_first,
+                                     vertex_range_last,
+                                     handle_ptr_->get_stream());
+  }
+
+  /**
+   * @ brief compute a bitmap representation of the bucket elements
+   *
+   * @param vertex_range_first First (inclusive) vertex of the range to cover; every bucket element
+   * should be in [vertex_range_first, vertex_range_last).
+   * @param vertex_range_last Last (exclusive) vertex of the range to cover.
+   * @return Bitmap with packed_bool_size(vertex_range_last - vertex_range_first) words.
+   */
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  rmm::device_uvector<uint32_t> to_bitmap(vertex_t vertex_range_first,
+                                          vertex_t vertex_range_last) const
+  {
+    static_assert(sorted_unique, "to_bitmap() requires a sorted_unique bucket.");
+    return compute_vertex_list_bitmap_info(vertex_cbegin(),
+                                           vertex_cend(),
+                                           vertex_range_first,
+                                           vertex_range_last,
+                                           handle_ptr_->get_stream());
+  }
+
   void shrink_to_fit()
   {
     CUGRAPH_EXPECTS(
@@ -616,7 +699,11 @@ class vertex_frontier_t {
     std::conditional_t<std::is_same_v<tag_t, void>, vertex_t, thrust::tuple<vertex_t, tag_t>>;
   static size_t constexpr kInvalidBucketIdx{std::numeric_limits<size_t>::max()};
 
-  vertex_frontier_t(raft::handle_t const& handle, size_t num_buckets) : handle_ptr_(&handle)
+  // if retain_capacity is true, split_bucket() does not release the memory freed by moving elements
+  // out of a bucket; this avoids re-allocation in iterative algorithms that repeatedly grow and
+  // shrink the same buckets (use with reserve() and clear() to reuse a frontier object).
+  vertex_frontier_t(raft::handle_t const& handle, size_t num_buckets, bool retain_capacity = false)
+    : handle_ptr_(&handle), retain_capacity_(retain_capacity)
   {
     buckets_.reserve(num_buckets);
     for (size_t i = 0; i < num_buckets; ++i) {
@@ -626,6 +713,25 @@ class vertex_frontier_t {
 
   size_t num_buckets() const { return buckets_.size(); }
 
+  bool retain_capacity() const { return retain_capacity_; }
+
+  // pre-allocate memory for up to capacity keys in every bucket
+  void reserve(size_t capacity)
+  {
+    for (auto& bucket : buckets_) {
+      bucket.reserve(capacity);
+    }
+  }
+
+  // empty every bucket (keeping the capacity) to reuse this frontier object, e.g. across calls of
+  // the same algorithm on the same graph
+  void clear()
+  {
+    for (auto& bucket : buckets_) {
+      bucket.clear();
+    }
+  }
+
   key_bucket_t<vertex_t, tag_t, multi_gpu, sorted_unique_key_bucket>& bucket(size_t bucket_idx)
   {
     return buckets_[bucket_idx];
@@ -704,7 +810,7 @@ class vertex_frontier_t {
                       move_to_bucket_indices);
 
     this_bucket.resize(new_this_bucket_size);
-    this_bucket.shrink_to_fit();
+    if (!retain_capacity_) { this_bucket.shrink_to_fit(); }
   }
 
   template <typename KeyIterator>
@@ -785,6 +891,7 @@ class vertex_frontier_t {
 
  private:
   raft::handle_t const* handle_ptr_{nullptr};
+  bool retain_capacity_{false};
   std::vector<key_bucket_t<vertex_t, tag_t, multi_gpu, sorted_unique_key_bucket>> buckets_{};
 };
 
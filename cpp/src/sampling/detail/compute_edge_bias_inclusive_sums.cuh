@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <cuda/functional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+namespace cugraph {
+namespace detail {
+
+template <typename vertex_t, typename edge_t, typename bias_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bias_t>
+compute_edge_bias_inclusive_sums(raft::handle_t const& handle,
+                                 graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                                 edge_property_view_t<edge_t, bias_t const*> edge_bias_view)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(),
+                  "Invalid input argument: the graph should not have an attached edge mask.");
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bias_t> inclusive_sums(
+    handle, graph_view);
+
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(
+      graph_view.local_edge_partition_view(i));
+
+    // segmented (one segment per major) inclusive scan
+    auto major_idx_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(edge_t{0}),
+      cuda::proclaim_return_type<vertex_t>([edge_partition] __device__(edge_t i) {
+        return edge_partition.major_idx_from_local_edge_idx_nocheck(i);
+      }));
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  major_idx_first,
+                                  major_idx_first + edge_partition.number_of_edges(),
+                                  edge_bias_view.value_firsts()[i],
+                                  inclusive_sums.mutable_view().value_firsts()[i]);
+  }
+
+  return inclusive_sums;
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampling/detail/compute_edge_bias_inclusive_sums.cuh"
+
+namespace cugraph {
+namespace detail {
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, true>, float>
+compute_edge_bias_inclusive_sums(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_bias_view);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, true>, double>
+compute_edge_bias_inclusive_sums(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_bias_view);
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "sampling/detail/sampling_utils.hpp"
+
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/random/rng_device.cuh>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <optional>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+int32_t constexpr fused_multi_hop_sample_edges_kernel_block_size = 128;
+
+template <typename edge_t>
+__device__ edge_t fused_multi_hop_sample_uniform_index(raft::random::PCGenerator& gen, edge_t n)
+{
+  double r{};
+  gen.next(r);
+  auto idx = static_cast<edge_t>(r * static_cast<double>(n));
+  return idx < n ? idx : n - 1;  // to guard against floating point rounding
+}
+
+// one warp per starting vertex; the warp samples all the hops of the starting vertex's sampling
+// tree. The samples of the hop h of the i'th starting vertex are stored (as edge offsets) in
+// [hop_slot_offsets[h] + i * S_h, hop_slot_offsets[h] + (i + 1) * S_h) where S_h is the product of
+// fan_out[0], ..., fan_out[h], K (= fan_out[h]) slots for each hop h - 1 slot (= frontier vertex).
+// Slots without a sample are set to invalid_edge_id_v<edge_t>.
+template <typename vertex_t, typename edge_t>
+__global__ static void fused_multi_hop_sample_edges_kernel(
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::device_span<int32_t const> fan_out,
+  raft::device_span<size_t const> hop_slot_offsets,
+  raft::random::DeviceState<raft::random::PCGenerator> device_state,
+  bool with_replacement,
+  raft::device_span<edge_t> sampled_edge_offsets)
+{
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = tid % raft::warp_size();
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(tid));
+
+  while (idx < starting_vertices.size()) {
+    size_t num_parents{1};
+    for (size_t hop = 0; hop < fan_out.size(); ++hop) {
+      auto K            = static_cast<edge_t>(fan_out[hop]);
+      auto output_first = sampled_edge_offsets.begin() + hop_slot_offsets[hop] +
+                          idx * num_parents * static_cast<size_t>(K);
+      for (size_t p = lane_id; p < num_parents; p += raft::warp_size()) {
+        auto output = output_first + p * static_cast<size_t>(K);
+
+        auto major = invalid_vertex_id_v<vertex_t>;
+        if (hop == 0) {
+          major = starting_vertices[idx];
+        } else {
+          auto parent_edge_offset =
+            sampled_edge_offsets[hop_slot_offsets[hop - 1] + idx * num_parents + p];
+          if (parent_edge_offset != invalid_edge_id_v<edge_t>) {
+            major = edge_partition.indices()[parent_edge_offset];
+          }
+        }
+
+        edge_t edge_offset{0};
+        edge_t local_degree{0};
+        if (major != invalid_vertex_id_v<vertex_t>) {
+          auto local_edges =
+            edge_partition.local_edges(edge_partition.major_offset_from_major_nocheck(major));
+          edge_offset  = thrust::get<1>(local_edges);
+          local_degree = thrust::get<2>(local_edges);
+        }
+
+        for (edge_t k = 0; k < K; ++k) {
+          auto nbr_idx = invalid_edge_id_v<edge_t>;
+          if (with_replacement) {
+            if (local_degree > 0) {
+              nbr_idx = fused_multi_hop_sample_uniform_index(gen, local_degree);
+            }
+          } else if (local_degree <= K) {
+            if (k < local_degree) { nbr_idx = k; }
+          } else {  // Floyd's algorithm, dedupe against the neighbors already sampled
+            auto j  = local_degree - K + k;
+            nbr_idx = fused_multi_hop_sample_uniform_index(gen, j + 1);
+            for (edge_t l = 0; l < k; ++l) {
+              if (output[l] == edge_offset + nbr_idx) {
+                nbr_idx = j;
+                break;
+              }
+            }
+          }
+          output[k] = (nbr_idx != invalid_edge_id_v<edge_t>) ? (edge_offset + nbr_idx)
+                                                             : invalid_edge_id_v<edge_t>;
+        }
+      }
+      __syncwarp();  // the next hop reads the samples of the other lanes
+      num_parents *= static_cast<size_t>(K);
+    }
+    idx += (gridDim.x * blockDim.x) / raft::warp_size();
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+struct fused_multi_hop_sample_slot_t {
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition;
+  raft::device_span<vertex_t const> starting_vertices{};
+  raft::device_span<int32_t const> fan_out{};
+  raft::device_span<size_t const> hop_slot_offsets{};
+  raft::device_span<edge_t const> sampled_edge_offsets{};
+
+  __device__ int32_t hop(size_t slot) const
+  {
+    return static_cast<int32_t>(thrust::distance(
+      hop_slot_offsets.begin() + 1,
+      thrust::upper_bound(
+        thrust::seq, hop_slot_offsets.begin() + 1, hop_slot_offsets.end(), slot)));
+  }
+
+  __device__ size_t starting_vertex_idx(size_t slot) const
+  {
+    auto h = hop(slot);
+    return (slot - hop_slot_offsets[h]) /
+           ((hop_slot_offsets[h + 1] - hop_slot_offsets[h]) / starting_vertices.size());
+  }
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(size_t slot) const
+  {
+    auto h          = hop(slot);
+    auto dst        = edge_partition.indices()[sampled_edge_offsets[slot]];
+    auto parent_idx = (slot - hop_slot_offsets[h]) / static_cast<size_t>(fan_out[h]);
+    auto src =
+      (h == 0)
+        ? starting_vertices[parent_idx]
+        : edge_partition.indices()[sampled_edge_offsets[hop_slot_offsets[h - 1] + parent_idx]];
+    return thrust::make_tuple(src, dst);
+  }
+};
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<int32_t>>,
+           std::optional<rmm::device_uvector<label_t>>>
+fused_multi_hop_sample_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> starting_vertices,
+  std::optional<raft::device_span<label_t const>> starting_vertex_labels,
+  raft::host_span<int32_t const> fan_out,
+  bool return_hops,
+  bool with_replacement)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(),
+                  "Invalid input argument: fused multi-hop sampling does not support edge masks.");
+  CUGRAPH_EXPECTS(
+    is_fused_multi_hop_sampling_supported(fan_out, starting_vertices.size()),
+    "Invalid input argument: fan_out values or the number of starting vertices exceed the "
+    "fused multi-hop sampling limits.");
+
+  // 1. compute the sample slot ranges of each hop
+
+  std::vector<size_t> h_hop_slot_offsets(fan_out.size() + 1, 0);
+  size_t num_slots_per_starting_vertex{1};
+  for (size_t i = 0; i < fan_out.size(); ++i) {
+    num_slots_per_starting_vertex *= static_cast<size_t>(fan_out[i]);
+    h_hop_slot_offsets[i + 1] =
+      h_hop_slot_offsets[i] + starting_vertices.size() * num_slots_per_starting_vertex;
+  }
+
+  rmm::device_uvector<int32_t> d_fan_out(fan_out.size(), handle.get_stream());
+  rmm::device_uvector<size_t> d_hop_slot_offsets(h_hop_slot_offsets.size(), handle.get_stream());
+  raft::update_device(d_fan_out.data(), fan_out.data(), fan_out.size(), handle.get_stream());
+  raft::update_device(d_hop_slot_offsets.data(),
+                      h_hop_slot_offsets.data(),
+                      h_hop_slot_offsets.size(),
+                      handle.get_stream());
+
+  // 2. sample all the hops in a single kernel
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+
+  rmm::device_uvector<edge_t> sampled_edge_offsets(h_hop_slot_offsets.back(), handle.get_stream());
+  if (starting_vertices.size() > 0) {
+    raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+    raft::grid_1d_warp_t update_grid(starting_vertices.size(),
+                                     fused_multi_hop_sample_edges_kernel_block_size,
+                                     handle.get_device_properties().maxGridSize[0]);
+    fused_multi_hop_sample_edges_kernel<vertex_t, edge_t>
+      <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+        edge_partition,
+        starting_vertices,
+        raft::device_span<int32_t const>(d_fan_out.data(), d_fan_out.size()),
+        raft::device_span<size_t const>(d_hop_slot_offsets.data(), d_hop_slot_offsets.size()),
+        device_state,
+        with_replacement,
+        raft::device_span<edge_t>(sampled_edge_offsets.data(), sampled_edge_offsets.size()));
+    rng_state.advance(static_cast<uint64_t>(update_grid.num_blocks) * update_grid.block_size);
+  }
+
+  // 3. compact (this preserves the hop order of the samples)
+
+  rmm::device_uvector<size_t> valid_slots(sampled_edge_offsets.size(), handle.get_stream());
+  valid_slots.resize(
+    thrust::distance(valid_slots.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(size_t{0}),
+                                     thrust::make_counting_iterator(sampled_edge_offsets.size()),
+                                     sampled_edge_offsets.begin(),
+                                     valid_slots.begin(),
+                                     is_not_equal_t<edge_t>{invalid_edge_id_v<edge_t>})),
+    handle.get_stream());
+
+  // 4. gather the sampled edges and their properties
+
+  fused_multi_hop_sample_slot_t<vertex_t, edge_t> slot_op{
+    edge_partition,
+    starting_vertices,
+    raft::device_span<int32_t const>(d_fan_out.data(), d_fan_out.size()),
+    raft::device_span<size_t const>(d_hop_slot_offsets.data(), d_hop_slot_offsets.size()),
+    raft::device_span<edge_t const>(sampled_edge_offsets.data(), sampled_edge_offsets.size())};
+
+  rmm::device_uvector<vertex_t> srcs(valid_slots.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(valid_slots.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    valid_slots.begin(),
+                    valid_slots.end(),
+                    thrust::make_zip_iterator(srcs.begin(), dsts.begin()),
+                    slot_op);
+
+  auto weights = edge_weight_view
+                   ? std::make_optional<rmm::device_uvector<weight_t>>(valid_slots.size(),
+                                                                       handle.get_stream())
+                   : std::nullopt;
+  if (weights) {
+    auto edge_partition_weights =
+      edge_partition_edge_property_device_view_t<edge_t, weight_t const*>(*edge_weight_view, 0);
+    thrust::transform(handle.get_thrust_policy(),
+                      valid_slots.begin(),
+                      valid_slots.end(),
+                      (*weights).begin(),
+                      [edge_partition_weights,
+                       sampled_edge_offsets = sampled_edge_offsets.data()] __device__(size_t slot) {
+                        return edge_partition_weights.get(sampled_edge_offsets[slot]);
+                      });
+  }
+
+  auto edge_ids = edge_id_view ? std::make_optional<rmm::device_uvector<edge_t>>(
+                                   valid_slots.size(), handle.get_stream())
+                               : std::nullopt;
+  if (edge_ids) {
+    auto edge_partition_ids =
+      edge_partition_edge_property_device_view_t<edge_t, edge_t const*>(*edge_id_view, 0);
+    thrust::transform(handle.get_thrust_policy(),
+                      valid_slots.begin(),
+                      valid_slots.end(),
+                      (*edge_ids).begin(),
+                      [edge_partition_ids,
+                       sampled_edge_offsets = sampled_edge_offsets.data()] __device__(size_t slot) {
+                        return edge_partition_ids.get(sampled_edge_offsets[slot]);
+                      });
+  }
+
+  auto edge_types = edge_type_view ? std::make_optional<rmm::device_uvector<edge_type_t>>(
+                                       valid_slots.size(), handle.get_stream())
+                                   : std::nullopt;
+  if (edge_types) {
+    auto edge_partition_types =
+      edge_partition_edge_property_device_view_t<edge_t, edge_type_t const*>(*edge_type_view, 0);
+    thrust::transform(handle.get_thrust_policy(),
+                      valid_slots.begin(),
+                      valid_slots.end(),
+                      (*edge_types).begin(),
+                      [edge_partition_types,
+                       sampled_edge_offsets = sampled_edge_offsets.data()] __device__(size_t slot) {
+                        return edge_partition_types.get(sampled_edge_offsets[slot]);
+                      });
+  }
+
+  auto hops = return_hops ? std::make_optional<rmm::device_uvector<int32_t>>(valid_slots.size(),
+                                                                             handle.get_stream())
+                          : std::nullopt;
+  if (hops) {
+    thrust::transform(handle.get_thrust_policy(),
+                      valid_slots.begin(),
+                      valid_slots.end(),
+                      (*hops).begin(),
+                      [slot_op] __device__(size_t slot) { return slot_op.hop(slot); });
+  }
+
+  auto labels = starting_vertex_labels ? std::make_optional<rmm::device_uvector<label_t>>(
+                                           valid_slots.size(), handle.get_stream())
+                                       : std::nullopt;
+  if (labels) {
+    thrust::transform(
+      handle.get_thrust_policy(),
+      valid_slots.begin(),
+      valid_slots.end(),
+      (*labels).begin(),
+      [slot_op, starting_vertex_labels = *starting_vertex_labels] __device__(size_t slot) {
+        return starting_vertex_labels[slot_op.starting_vertex_idx(slot)];
+      });
+  }
+
+  return std::make_tuple(std::move(srcs),
+                         std::move(dsts),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(hops),
+                         std::move(labels));
+}
+
+}  // namespace detail
+}  // namespace cugraph
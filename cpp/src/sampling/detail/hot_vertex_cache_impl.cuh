@@ -0,0 +1,659 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "sampling/detail/sampling_utils.hpp"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/neighbor_sampling_state.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_device.cuh>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+
+namespace cugraph {
+namespace detail {
+
+// order by out-degree (descending) and then by vertex ID (ascending)
+template <typename vertex_t, typename edge_t>
+struct hot_vertex_greater_t {
+  __device__ bool operator()(thrust::tuple<edge_t, vertex_t> lhs,
+                             thrust::tuple<edge_t, vertex_t> rhs) const
+  {
+    return (thrust::get<0>(lhs) > thrust::get<0>(rhs)) ||
+           ((thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+            (thrust::get<1>(lhs) < thrust::get<1>(rhs)));
+  }
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct count_unmasked_local_edges_t {
+  edge_partition_device_view_t<vertex_t, edge_t, multi_gpu> edge_partition{};
+  cuda::std::optional<edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>
+    edge_partition_e_mask{};
+
+  __device__ edge_t operator()(vertex_t major) const
+  {
+    auto major_idx = edge_partition.major_idx_from_major_nocheck(major);
+    if (!major_idx) { return edge_t{0}; }
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(*major_idx);
+    if (!edge_partition_e_mask) { return local_degree; }
+    edge_t count{0};
+    for (edge_t i = 0; i < local_degree; ++i) {
+      if ((*edge_partition_e_mask).get(edge_offset + i)) { ++count; }
+    }
+    return count;
+  }
+};
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+struct copy_unmasked_local_edges_t {
+  edge_partition_device_view_t<vertex_t, edge_t, multi_gpu> edge_partition{};
+  cuda::std::optional<edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>
+    edge_partition_e_mask{};
+  raft::device_span<vertex_t const> majors{};
+  raft::device_span<edge_t const> output_offsets{};
+  vertex_t* output_majors{};
+  vertex_t* output_minors{};
+  edge_t* output_edge_offsets{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto major     = majors[i];
+    auto major_idx = edge_partition.major_idx_from_major_nocheck(major);
+    if (!major_idx) { return; }
+    vertex_t const* indices{nullptr};
+    edge_t edge_offset{};
+    edge_t local_degree{};
+    thrust::tie(indices, edge_offset, local_degree) = edge_partition.local_edges(*major_idx);
+    auto output_offset = output_offsets[i];
+    for (edge_t j = 0; j < local_degree; ++j) {
+      if (!edge_partition_e_mask || (*edge_partition_e_mask).get(edge_offset + j)) {
+        output_majors[output_offset]       = major;
+        output_minors[output_offset]       = indices[j];
+        output_edge_offsets[output_offset] = edge_offset + j;
+        ++output_offset;
+      }
+    }
+  }
+};
+
+template <typename vertex_t>
+struct is_not_cached_t {
+  raft::device_span<vertex_t const> cached_vertices{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return !thrust::binary_search(thrust::seq, cached_vertices.begin(), cached_vertices.end(), v);
+  }
+
+  template <typename label_t>
+  __device__ bool operator()(thrust::tuple<vertex_t, label_t> tagged_v) const
+  {
+    return (*this)(thrust::get<0>(tagged_v));
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+__device__ edge_t cached_vertex_slot(raft::device_span<vertex_t const> cached_vertices, vertex_t v)
+{
+  return static_cast<edge_t>(thrust::distance(
+    cached_vertices.begin(),
+    thrust::lower_bound(thrust::seq, cached_vertices.begin(), cached_vertices.end(), v)));
+}
+
+template <typename vertex_t, typename edge_t, typename bias_t>
+struct count_cached_samples_t {
+  raft::device_span<vertex_t const> cached_vertices{};
+  raft::device_span<edge_t const> cached_offsets{};
+  bias_t const* cached_bias_inclusive_sums{nullptr};  // nullptr if uniform sampling
+  int32_t fanout{};
+  bool with_replacement{};
+
+  __device__ size_t operator()(vertex_t v) const
+  {
+    auto slot   = cached_vertex_slot<vertex_t, edge_t>(cached_vertices, v);
+    auto degree = cached_offsets[slot + 1] - cached_offsets[slot];
+    if (fanout < 0) { return static_cast<size_t>(degree); }
+    if (degree == 0) { return size_t{0}; }
+    if (cached_bias_inclusive_sums &&
+        !(cached_bias_inclusive_sums[cached_offsets[slot + 1] - 1] > bias_t{0})) {
+      return size_t{0};
+    }
+    if (with_replacement || (degree > static_cast<edge_t>(fanout))) {
+      return static_cast<size_t>(fanout);
+    }
+    return static_cast<size_t>(degree);
+  }
+};
+
+template <typename edge_t>
+__device__ edge_t cached_sample_uniform_index(raft::random::PCGenerator& gen, edge_t n)
+{
+  double r{};
+  gen.next(r);
+  auto idx = static_cast<edge_t>(r * static_cast<double>(n));
+  return idx < n ? idx : n - 1;  // to guard against floating point rounding
+}
+
+// sampling without replacement from a vertex with more neighbors than fanout (Floyd's algorithm,
+// dedupe against the neighbors already sampled), one thread per frontier vertex
+template <typename vertex_t, typename edge_t>
+struct sample_cached_edges_without_replacement_t {
+  raft::device_span<vertex_t const> active_majors{};
+  raft::device_span<size_t const> output_offsets{};
+  raft::device_span<vertex_t const> cached_vertices{};
+  raft::device_span<edge_t const> cached_offsets{};
+  int32_t fanout{};
+  raft::random::DeviceState<raft::random::PCGenerator> device_state;
+  edge_t* output_positions{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto slot   = cached_vertex_slot<vertex_t, edge_t>(cached_vertices, active_majors[i]);
+    auto first  = cached_offsets[slot];
+    auto degree = cached_offsets[slot + 1] - first;
+    auto K      = static_cast<edge_t>(fanout);
+    if (degree <= K) { return; }
+
+    raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(output_offsets[i]));
+    auto output = output_positions + output_offsets[i];
+    for (edge_t k = 0; k < K; ++k) {
+      auto j       = degree - K + k;
+      auto nbr_idx = cached_sample_uniform_index(gen, j + 1);
+      for (edge_t l = 0; l < k; ++l) {
+        if (output[l] == first + nbr_idx) {
+          nbr_idx = j;
+          break;
+        }
+      }
+      output[k] = first + nbr_idx;
+    }
+  }
+};
+
+// one thread per sample
+template <typename vertex_t, typename edge_t, typename bias_t, typename label_t>
+struct sample_cached_edges_t {
+  raft::device_span<vertex_t const> active_majors{};
+  label_t const* active_major_labels{nullptr};
+  raft::device_span<size_t const> output_offsets{};
+  raft::device_span<vertex_t const> cached_vertices{};
+  raft::device_span<edge_t const> cached_offsets{};
+  bias_t const* cached_bias_inclusive_sums{nullptr};  // nullptr if uniform sampling
+  int32_t fanout{};
+  bool with_replacement{};
+  raft::random::DeviceState<raft::random::PCGenerator> device_state;
+  vertex_t* output_majors{};
+  label_t* output_labels{nullptr};
+  edge_t* output_positions{};
+
+  __device__ void operator()(size_t o) const
+  {
+    auto i = static_cast<size_t>(thrust::distance(
+               output_offsets.begin() + 1,
+               thrust::upper_bound(
+                 thrust::seq, output_offsets.begin() + 1, output_offsets.end(), o)));
+    output_majors[o] = active_majors[i];
+    if (output_labels) { output_labels[o] = active_major_labels[i]; }
+
+    auto slot   = cached_vertex_slot<vertex_t, edge_t>(cached_vertices, active_majors[i]);
+    auto first  = cached_offsets[slot];
+    auto degree = cached_offsets[slot + 1] - first;
+    auto j      = static_cast<edge_t>(o - output_offsets[i]);
+
+    if (with_replacement && (fanout >= 0)) {
+      raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(o));
+      if (cached_bias_inclusive_sums) {
+        auto sums_first = cached_bias_inclusive_sums + first;
+        auto sums_last  = sums_first + degree;
+        double r{};
+        gen.next(r);
+        auto target = static_cast<bias_t>(r * static_cast<double>(*(sums_last - 1)));
+        auto nbr_idx =
+          static_cast<edge_t>(thrust::distance(
+            sums_first, thrust::upper_bound(thrust::seq, sums_first, sums_last, target)));
+        output_positions[o] = first + (nbr_idx < degree ? nbr_idx : degree - 1);
+      } else {
+        output_positions[o] = first + cached_sample_uniform_index(gen, degree);
+      }
+    } else if ((fanout < 0) || (degree <= static_cast<edge_t>(fanout))) {
+      output_positions[o] = first + j;
+    }  // else sampled by sample_cached_edges_without_replacement_t
+  }
+};
+
+template <typename T, typename index_t>
+void permute_cached_values(raft::handle_t const& handle,
+                           rmm::device_uvector<index_t> const& permutation,
+                           rmm::device_uvector<T>& values)
+{
+  rmm::device_uvector<T> tmp(permutation.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 permutation.begin(),
+                 permutation.end(),
+                 values.begin(),
+                 tmp.begin());
+  values = std::move(tmp);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename bias_t,
+          bool multi_gpu>
+hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t> build_hot_vertex_cache(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<edge_property_view_t<edge_t, bias_t const*>> edge_bias_view,
+  size_t num_hot_vertices)
+{
+  // 1. select the hot vertices (the local candidates first, and then the global top
+  // num_hot_vertices from the candidates of every GPU)
+
+  auto degrees = graph_view.compute_out_degrees(handle);
+  rmm::device_uvector<vertex_t> vertices(degrees.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   vertices.begin(),
+                   vertices.end(),
+                   graph_view.local_vertex_partition_range_first());
+
+  auto select_hot_vertices = [&handle, num_hot_vertices](auto& degrees, auto& vertices) {
+    thrust::sort(handle.get_thrust_policy(),
+                 thrust::make_zip_iterator(degrees.begin(), vertices.begin()),
+                 thrust::make_zip_iterator(degrees.end(), vertices.end()),
+                 hot_vertex_greater_t<vertex_t, edge_t>{});
+    auto num_selected = std::min(
+      num_hot_vertices,
+      static_cast<size_t>(thrust::count_if(
+        handle.get_thrust_policy(), degrees.begin(), degrees.end(), is_not_equal_t<edge_t>{0})));
+    degrees.resize(num_selected, handle.get_stream());
+    vertices.resize(num_selected, handle.get_stream());
+  };
+
+  select_hot_vertices(degrees, vertices);
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    degrees    = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<edge_t const>(degrees.data(), degrees.size()));
+    vertices = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<vertex_t const>(vertices.data(), vertices.size()));
+    select_hot_vertices(degrees, vertices);
+  }
+  degrees.resize(0, handle.get_stream());
+  degrees.shrink_to_fit(handle.get_stream());
+  thrust::sort(handle.get_thrust_policy(), vertices.begin(), vertices.end());
+
+  // 2. collect the local edges of the hot vertices
+
+  rmm::device_uvector<vertex_t> majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(0, handle.get_stream());
+  auto weights = edge_weight_view
+                   ? std::make_optional(rmm::device_uvector<weight_t>(0, handle.get_stream()))
+                   : std::nullopt;
+  auto edge_ids = edge_id_view
+                    ? std::make_optional(rmm::device_uvector<edge_t>(0, handle.get_stream()))
+                    : std::nullopt;
+  auto edge_types =
+    edge_type_view ? std::make_optional(rmm::device_uvector<edge_type_t>(0, handle.get_stream()))
+                   : std::nullopt;
+  auto biases = edge_bias_view
+                  ? std::make_optional(rmm::device_uvector<bias_t>(0, handle.get_stream()))
+                  : std::nullopt;
+
+  auto edge_mask_view = graph_view.edge_mask_view();
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(
+      graph_view.local_edge_partition_view(i));
+    auto edge_partition_e_mask =
+      edge_mask_view
+        ? cuda::std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>(
+            *edge_mask_view, i)
+        : cuda::std::nullopt;
+
+    auto partition_first = static_cast<size_t>(thrust::distance(
+      vertices.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          vertices.begin(),
+                          vertices.end(),
+                          graph_view.local_edge_partition_major_range_first(i))));
+    auto partition_last  = static_cast<size_t>(thrust::distance(
+      vertices.begin(),
+      thrust::lower_bound(handle.get_thrust_policy(),
+                          vertices.begin(),
+                          vertices.end(),
+                          graph_view.local_edge_partition_major_range_last(i))));
+    auto partition_majors = raft::device_span<vertex_t const>(vertices.data() + partition_first,
+                                                              partition_last - partition_first);
+
+    rmm::device_uvector<edge_t> output_offsets(partition_majors.size() + 1, handle.get_stream());
+    output_offsets.set_element_to_zero_async(partition_majors.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      partition_majors.begin(),
+      partition_majors.end(),
+      output_offsets.begin(),
+      count_unmasked_local_edges_t<vertex_t, edge_t, multi_gpu>{edge_partition,
+                                                                edge_partition_e_mask});
+    thrust::exclusive_scan(handle.get_thrust_policy(),
+                           output_offsets.begin(),
+                           output_offsets.end(),
+                           output_offsets.begin());
+    auto num_edges = static_cast<size_t>(output_offsets.back_element(handle.get_stream()));
+
+    auto old_size = majors.size();
+    majors.resize(old_size + num_edges, handle.get_stream());
+    minors.resize(old_size + num_edges, handle.get_stream());
+    rmm::device_uvector<edge_t> edge_offsets(num_edges, handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(partition_majors.size()),
+      copy_unmasked_local_edges_t<vertex_t, edge_t, multi_gpu>{
+        edge_partition,
+        edge_partition_e_mask,
+        partition_majors,
+        raft::device_span<edge_t const>(output_offsets.data(), output_offsets.size()),
+        majors.data() + old_size,
+        minors.data() + old_size,
+        edge_offsets.data()});
+
+    auto gather_edge_values = [&handle, &edge_offsets, old_size, num_edges](auto const* first,
+                                                                            auto& values) {
+      values.resize(old_size + num_edges, handle.get_stream());
+      thrust::gather(handle.get_thrust_policy(),
+                     edge_offsets.begin(),
+                     edge_offsets.end(),
+                     first,
+                     values.begin() + old_size);
+    };
+    if (weights) { gather_edge_values(edge_weight_view->value_firsts()[i], *weights); }
+    if (edge_ids) { gather_edge_values(edge_id_view->value_firsts()[i], *edge_ids); }
+    if (edge_types) { gather_edge_values(edge_type_view->value_firsts()[i], *edge_types); }
+    if (biases) { gather_edge_values(edge_bias_view->value_firsts()[i], *biases); }
+  }
+
+  // 3. replicate the edges on every GPU
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    auto allgather = [&handle, &comm](auto& values) {
+      using value_t = typename std::remove_reference_t<decltype(values)>::value_type;
+      values        = cugraph::device_allgatherv(
+        handle, comm, raft::device_span<value_t const>(values.data(), values.size()));
+    };
+    allgather(majors);
+    allgather(minors);
+    if (weights) { allgather(*weights); }
+    if (edge_ids) { allgather(*edge_ids); }
+    if (edge_types) { allgather(*edge_types); }
+    if (biases) { allgather(*biases); }
+  }
+
+  // 4. convert to CSR
+
+  rmm::device_uvector<size_t> permutation(majors.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), permutation.begin(), permutation.end(), size_t{0});
+  thrust::stable_sort_by_key(
+    handle.get_thrust_policy(), majors.begin(), majors.end(), permutation.begin());
+  permute_cached_values(handle, permutation, minors);
+  if (weights) { permute_cached_values(handle, permutation, *weights); }
+  if (edge_ids) { permute_cached_values(handle, permutation, *edge_ids); }
+  if (edge_types) { permute_cached_values(handle, permutation, *edge_types); }
+  if (biases) { permute_cached_values(handle, permutation, *biases); }
+  permutation.resize(0, handle.get_stream());
+  permutation.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<edge_t> offsets(vertices.size() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      majors.begin(),
+                      majors.end(),
+                      vertices.begin(),
+                      vertices.end(),
+                      offsets.begin());
+  offsets.set_element(vertices.size(), static_cast<edge_t>(majors.size()), handle.get_stream());
+
+  if (biases) {
+    thrust::inclusive_scan_by_key(
+      handle.get_thrust_policy(), majors.begin(), majors.end(), biases->begin(), biases->begin());
+  }
+
+  return hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t>{std::move(vertices),
+                                                                              std::move(offsets),
+                                                                              std::move(minors),
+                                                                              std::move(weights),
+                                                                              std::move(edge_ids),
+                                                                              std::move(edge_types),
+                                                                              std::move(biases)};
+}
+
+template <typename vertex_t, typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<label_t>>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<label_t>>>
+partition_cached_vertices(raft::handle_t const& handle,
+                          raft::device_span<vertex_t const> cached_vertices,
+                          rmm::device_uvector<vertex_t>&& vertices,
+                          std::optional<rmm::device_uvector<label_t>>&& vertex_labels)
+{
+  size_t num_uncached{0};
+  if (vertex_labels) {
+    auto pair_first = thrust::make_zip_iterator(vertices.begin(), vertex_labels->begin());
+    num_uncached    = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::stable_partition(handle.get_thrust_policy(),
+                                                pair_first,
+                                                pair_first + vertices.size(),
+                                                is_not_cached_t<vertex_t>{cached_vertices})));
+  } else {
+    num_uncached = static_cast<size_t>(
+      thrust::distance(vertices.begin(),
+                       thrust::stable_partition(handle.get_thrust_policy(),
+                                                vertices.begin(),
+                                                vertices.end(),
+                                                is_not_cached_t<vertex_t>{cached_vertices})));
+  }
+
+  rmm::device_uvector<vertex_t> cached(vertices.size() - num_uncached, handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), vertices.begin() + num_uncached, vertices.end(), cached.begin());
+  vertices.resize(num_uncached, handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+
+  std::optional<rmm::device_uvector<label_t>> cached_labels{std::nullopt};
+  if (vertex_labels) {
+    cached_labels = rmm::device_uvector<label_t>(cached.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 vertex_labels->begin() + num_uncached,
+                 vertex_labels->end(),
+                 cached_labels->begin());
+    vertex_labels->resize(num_uncached, handle.get_stream());
+    vertex_labels->shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(
+    std::move(vertices), std::move(vertex_labels), std::move(cached), std::move(cached_labels));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename bias_t,
+          typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<label_t>>>
+sample_cached_edges(
+  raft::handle_t const& handle,
+  hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t> const& hot_vertex_cache,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> active_majors,
+  std::optional<raft::device_span<label_t const>> active_major_labels,
+  int32_t fanout,
+  bool with_replacement,
+  bool biased)
+{
+  CUGRAPH_EXPECTS(!biased || (with_replacement && hot_vertex_cache.bias_inclusive_sums),
+                  "Invalid input argument: biased sampling from the hot vertex cache requires "
+                  "sampling with replacement and cached bias values.");
+
+  auto cached_vertices = raft::device_span<vertex_t const>(hot_vertex_cache.vertices.data(),
+                                                           hot_vertex_cache.vertices.size());
+  auto cached_offsets  = raft::device_span<edge_t const>(hot_vertex_cache.offsets.data(),
+                                                        hot_vertex_cache.offsets.size());
+  auto cached_bias_inclusive_sums =
+    biased ? static_cast<bias_t const*>(hot_vertex_cache.bias_inclusive_sums->data()) : nullptr;
+
+  // 1. compute the output offsets
+
+  rmm::device_uvector<size_t> output_offsets(active_majors.size() + 1, handle.get_stream());
+  output_offsets.set_element_to_zero_async(active_majors.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    active_majors.begin(),
+                    active_majors.end(),
+                    output_offsets.begin(),
+                    count_cached_samples_t<vertex_t, edge_t, bias_t>{cached_vertices,
+                                                                     cached_offsets,
+                                                                     cached_bias_inclusive_sums,
+                                                                     fanout,
+                                                                     with_replacement});
+  thrust::exclusive_scan(handle.get_thrust_policy(),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+  auto num_samples = output_offsets.back_element(handle.get_stream());
+
+  // 2. sample (positions in the cached adjacency lists)
+
+  rmm::device_uvector<vertex_t> majors(num_samples, handle.get_stream());
+  auto labels =
+    active_major_labels
+      ? std::make_optional(rmm::device_uvector<label_t>(num_samples, handle.get_stream()))
+      : std::nullopt;
+  rmm::device_uvector<edge_t> positions(num_samples, handle.get_stream());
+
+  if (num_samples > 0) {
+    raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+    if (!with_replacement && (fanout >= 0)) {
+      thrust::for_each(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(active_majors.size()),
+                       sample_cached_edges_without_replacement_t<vertex_t, edge_t>{
+                         active_majors,
+                         raft::device_span<size_t const>(output_offsets.data(),
+                                                         output_offsets.size()),
+                         cached_vertices,
+                         cached_offsets,
+                         fanout,
+                         device_state,
+                         positions.data()});
+    }
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_samples),
+                     sample_cached_edges_t<vertex_t, edge_t, bias_t, label_t>{
+                       active_majors,
+                       active_major_labels ? active_major_labels->data() : nullptr,
+                       raft::device_span<size_t const>(output_offsets.data(),
+                                                       output_offsets.size()),
+                       cached_vertices,
+                       cached_offsets,
+                       cached_bias_inclusive_sums,
+                       fanout,
+                       with_replacement,
+                       device_state,
+                       majors.data(),
+                       labels ? labels->data() : nullptr,
+                       positions.data()});
+    rng_state.advance(static_cast<uint64_t>(num_samples));
+  }
+
+  // 3. gather the minors and the edge property values
+
+  auto gather_cached_values = [&handle, &positions](auto const& cached_values) {
+    using value_t = typename std::remove_reference_t<decltype(cached_values)>::value_type;
+    rmm::device_uvector<value_t> values(positions.size(), handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   positions.begin(),
+                   positions.end(),
+                   cached_values.begin(),
+                   values.begin());
+    return values;
+  };
+
+  auto minors  = gather_cached_values(hot_vertex_cache.indices);
+  auto weights = hot_vertex_cache.weights
+                   ? std::make_optional(gather_cached_values(*(hot_vertex_cache.weights)))
+                   : std::nullopt;
+  auto edge_ids = hot_vertex_cache.edge_ids
+                    ? std::make_optional(gather_cached_values(*(hot_vertex_cache.edge_ids)))
+                    : std::nullopt;
+  auto edge_types = hot_vertex_cache.edge_types
+                      ? std::make_optional(gather_cached_values(*(hot_vertex_cache.edge_types)))
+                      : std::nullopt;
+
+  return std::make_tuple(std::move(majors),
+                         std::move(minors),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(labels));
+}
+
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampling/detail/hot_vertex_cache_impl.cuh"
+
+namespace cugraph {
+namespace detail {
+
+template hot_vertex_cache_t<int32_t, int32_t, float, int32_t, float>
+build_hot_vertex_cache(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int32_t, int32_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int32_t, int32_t const*>> edge_type_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_bias_view,
+  size_t num_hot_vertices);
+
+template hot_vertex_cache_t<int32_t, int32_t, double, int32_t, double>
+build_hot_vertex_cache(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int32_t, int32_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int32_t, int32_t const*>> edge_type_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_bias_view,
+  size_t num_hot_vertices);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+partition_cached_vertices(raft::handle_t const& handle,
+                          raft::device_span<int32_t const> cached_vertices,
+                          rmm::device_uvector<int32_t>&& vertices,
+                          std::optional<rmm::device_uvector<int32_t>>&& vertex_labels);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+sample_cached_edges(
+  raft::handle_t const& handle,
+  hot_vertex_cache_t<int32_t, int32_t, float, int32_t, float> const& hot_vertex_cache,
+  raft::random::RngState& rng_state,
+  raft::device_span<int32_t const> active_majors,
+  std::optional<raft::device_span<int32_t const>> active_major_labels,
+  int32_t fanout,
+  bool with_replacement,
+  bool biased);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+sample_cached_edges(
+  raft::handle_t const& handle,
+  hot_vertex_cache_t<int32_t, int32_t, double, int32_t, double> const& hot_vertex_cache,
+  raft::random::RngState& rng_state,
+  raft::device_span<int32_t const> active_majors,
+  std::optional<raft::device_span<int32_t const>> active_major_labels,
+  int32_t fanout,
+  bool with_replacement,
+  bool biased);
+
+}  // namespace detail
+}  // namespace cugraph
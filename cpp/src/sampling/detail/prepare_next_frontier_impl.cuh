@@ -22,12 +22,14 @@
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/memory_resource_hints.hpp>
 #include <cugraph/utilities/thrust_tuple_utils.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
@@ -61,6 +63,9 @@ prepare_next_frontier(
 {
   vertex_partition_device_view_t<vertex_t, multi_gpu> d_vertex_partition(vertex_partition);
 
+  // sort temporary storage is allocated from the scratch memory resource (if set)
+  auto scratch_mr = get_scratch_memory_resource(handle);
+
   size_t frontier_size = sampled_dst_vertices.size();
   if (prior_sources_behavior == prior_sources_behavior_t::CARRY_OVER) {
     frontier_size += sampled_src_vertices.size();
@@ -115,9 +120,13 @@ prepare_next_frontier(
   if (frontier_vertex_labels) {
     auto begin_iter =
       thrust::make_zip_iterator(frontier_vertices.begin(), frontier_vertex_labels->begin());
-    thrust::sort(handle.get_thrust_policy(), begin_iter, begin_iter + frontier_vertices.size());
+    thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                 begin_iter,
+                 begin_iter + frontier_vertices.size());
   } else {
-    thrust::sort(handle.get_thrust_policy(), frontier_vertices.begin(), frontier_vertices.end());
+    thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                 frontier_vertices.begin(),
+                 frontier_vertices.end());
   }
 
   if (vertex_used_as_source) {
@@ -145,7 +154,8 @@ prepare_next_frontier(
 
       auto begin_iter = thrust::make_zip_iterator(verts.begin(), labels->begin());
 
-      thrust::sort(handle.get_thrust_policy(), begin_iter, begin_iter + new_verts_size);
+      thrust::sort(
+        rmm::exec_policy(handle.get_stream(), scratch_mr), begin_iter, begin_iter + new_verts_size);
 
       auto end_iter =
         thrust::unique(handle.get_thrust_policy(), begin_iter, begin_iter + new_verts_size);
@@ -153,7 +163,7 @@ prepare_next_frontier(
       verts.resize(thrust::distance(begin_iter, end_iter), handle.get_stream());
       labels->resize(thrust::distance(begin_iter, end_iter), handle.get_stream());
     } else {
-      thrust::sort(handle.get_thrust_policy(), verts.begin(), verts.end());
+      thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr), verts.begin(), verts.end());
 
       auto end_iter = thrust::unique(handle.get_thrust_policy(), verts.begin(), verts.end());
 
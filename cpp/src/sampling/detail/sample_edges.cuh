@@ -74,6 +74,40 @@ struct sample_edge_biases_op_t {
   }
 };
 
+template <typename vertex_t>
+struct temporal_sample_edges_op_t {
+  template <typename EdgeProperties>
+  auto __host__ __device__ operator()(thrust::tuple<vertex_t, int32_t> tagged_src,
+                                      vertex_t dst,
+                                      cuda::std::nullopt_t,
+                                      cuda::std::nullopt_t,
+                                      EdgeProperties edge_properties) const
+  {
+    return sample_edges_op_t<vertex_t>{}(
+      thrust::get<0>(tagged_src), dst, cuda::std::nullopt, cuda::std::nullopt, edge_properties);
+  }
+};
+
+// frontier vertices are tagged with their labels, every label has a time bound, an edge is eligible
+// if its time is earlier than the time bound (and no earlier than the time bound - time window)
+template <typename vertex_t, typename edge_time_t>
+struct temporal_sample_edge_biases_op_t {
+  raft::device_span<edge_time_t const> label_time_bounds{};
+  cuda::std::optional<edge_time_t> time_window{cuda::std::nullopt};
+
+  __device__ float operator()(thrust::tuple<vertex_t, int32_t> tagged_src,
+                              vertex_t,
+                              cuda::std::nullopt_t,
+                              cuda::std::nullopt_t,
+                              edge_time_t edge_time) const
+  {
+    auto time_bound = label_time_bounds[thrust::get<1>(tagged_src)];
+    return ((edge_time < time_bound) && (!time_window || (edge_time >= time_bound - *time_window)))
+             ? 1.0
+             : 0.0;
+  }
+};
+
 struct segmented_fill_t {
   raft::device_span<int32_t const> fill_values{};
   raft::device_span<size_t const> segment_offsets{};
@@ -88,6 +122,115 @@ struct segmented_fill_t {
   }
 };
 
+// uniform sampling with replacement using counter-based random number generation
+// (rng_state.type == raft::random::GenPhilox), the random numbers are keyed by the frontier keys,
+// so the frontier vertices are tagged with their labels to draw independent samples for the same
+// vertex in different labels
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename label_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<label_t>>>
+counter_based_uniform_sample_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> active_majors,
+  raft::device_span<label_t const> active_major_labels,
+  size_t fanout)
+{
+  static_assert(std::is_same_v<label_t, int32_t>);
+
+  cugraph::vertex_frontier_t<vertex_t, label_t, multi_gpu, false> vertex_frontier(handle, 1);
+
+  vertex_frontier.bucket(0).insert(
+    thrust::make_zip_iterator(active_majors.begin(), active_major_labels.begin()),
+    thrust::make_zip_iterator(active_majors.end(), active_major_labels.end()));
+
+  auto sample = [&](auto edge_value_view, auto invalid_value) {
+    return cugraph::per_v_random_select_transform_outgoing_e(handle,
+                                                             graph_view,
+                                                             vertex_frontier.bucket(0),
+                                                             edge_src_dummy_property_t{}.view(),
+                                                             edge_dst_dummy_property_t{}.view(),
+                                                             edge_value_view,
+                                                             temporal_sample_edges_op_t<vertex_t>{},
+                                                             rng_state,
+                                                             fanout,
+                                                             true,
+                                                             invalid_value,
+                                                             false);
+  };
+
+  rmm::device_uvector<vertex_t> majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(0, handle.get_stream());
+  std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+  std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+  std::optional<rmm::device_uvector<size_t>> sample_offsets{std::nullopt};
+
+  if (edge_weight_view && edge_id_view && edge_type_view) {
+    std::forward_as_tuple(sample_offsets,
+                          std::tie(majors, minors, weights, edge_ids, edge_types)) =
+      sample(view_concat(*edge_weight_view, *edge_id_view, *edge_type_view),
+             std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t, edge_type_t>>{
+               std::nullopt});
+  } else if (edge_weight_view && edge_id_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_ids)) =
+      sample(view_concat(*edge_weight_view, *edge_id_view),
+             std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t>>{std::nullopt});
+  } else if (edge_weight_view && edge_type_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_types)) =
+      sample(view_concat(*edge_weight_view, *edge_type_view),
+             std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_type_t>>{std::nullopt});
+  } else if (edge_weight_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights)) =
+      sample(*edge_weight_view,
+             std::optional<thrust::tuple<vertex_t, vertex_t, weight_t>>{std::nullopt});
+  } else if (edge_id_view && edge_type_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids, edge_types)) =
+      sample(view_concat(*edge_id_view, *edge_type_view),
+             std::optional<thrust::tuple<vertex_t, vertex_t, edge_t, edge_type_t>>{std::nullopt});
+  } else if (edge_id_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids)) = sample(
+      *edge_id_view, std::optional<thrust::tuple<vertex_t, vertex_t, edge_t>>{std::nullopt});
+  } else if (edge_type_view) {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_types)) = sample(
+      *edge_type_view, std::optional<thrust::tuple<vertex_t, vertex_t, edge_type_t>>{std::nullopt});
+  } else {
+    std::forward_as_tuple(sample_offsets, std::tie(majors, minors)) =
+      sample(edge_dummy_property_t{}.view(),
+             std::optional<thrust::tuple<vertex_t, vertex_t>>{std::nullopt});
+  }
+
+  rmm::device_uvector<label_t> labels((*sample_offsets).back_element(handle.get_stream()),
+                                      handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(active_majors.size()),
+                   segmented_fill_t{active_major_labels,
+                                    raft::device_span<size_t const>(sample_offsets->data(),
+                                                                    sample_offsets->size()),
+                                    raft::device_span<int32_t>(labels.data(), labels.size())});
+
+  return std::make_tuple(std::move(majors),
+                         std::move(minors),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::make_optional(std::move(labels)));
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -111,8 +254,23 @@ sample_edges(raft::handle_t const& handle,
              raft::device_span<vertex_t const> active_majors,
              std::optional<raft::device_span<label_t const>> active_major_labels,
              size_t fanout,
-             bool with_replacement)
+             bool with_replacement,
+             std::optional<edge_property_view_t<edge_t, bias_t const*>>
+               edge_bias_inclusive_sum_view)
 {
+  if ((rng_state.type == raft::random::GenPhilox) && with_replacement && !edge_bias_view &&
+      active_major_labels) {
+    return counter_based_uniform_sample_edges(handle,
+                                              graph_view,
+                                              edge_weight_view,
+                                              edge_id_view,
+                                              edge_type_view,
+                                              rng_state,
+                                              active_majors,
+                                              *active_major_labels,
+                                              fanout);
+  }
+
   using tag_t = void;
 
   cugraph::vertex_frontier_t<vertex_t, tag_t, multi_gpu, false> vertex_frontier(handle, 1);
@@ -150,7 +308,8 @@ sample_edges(raft::handle_t const& handle,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t, edge_type_t>>{
                 std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets,
                                 std::tie(majors, minors, weights, edge_ids, edge_types)) =
@@ -188,7 +347,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_ids)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -226,7 +386,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_type_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_types)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -262,7 +423,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, weight_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -302,7 +464,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, edge_t, edge_type_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids, edge_types)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -338,7 +501,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, edge_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -376,7 +540,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t, edge_type_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_types)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -412,7 +577,8 @@ sample_edges(raft::handle_t const& handle,
               fanout,
               with_replacement,
               std::optional<thrust::tuple<vertex_t, vertex_t>>{std::nullopt},
-              false);
+              false,
+              edge_bias_inclusive_sum_view);
         } else {
           std::forward_as_tuple(sample_offsets, std::tie(majors, minors)) =
             cugraph::per_v_random_select_transform_outgoing_e(
@@ -453,5 +619,241 @@ sample_edges(raft::handle_t const& handle,
                          std::move(labels));
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          typename label_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           rmm::device_uvector<label_t>>
+temporal_sample_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> active_majors,
+  raft::device_span<label_t const> active_major_labels,
+  raft::device_span<edge_time_t const> label_time_bounds,
+  std::optional<edge_time_t> time_window,
+  size_t fanout,
+  bool with_replacement)
+{
+  static_assert(std::is_same_v<label_t, int32_t>);
+
+  // the frontier vertices are tagged with their labels to look up the time bounds in the edge bias
+  // operator, edges outside the time window get 0 bias values and are never selected
+
+  cugraph::vertex_frontier_t<vertex_t, label_t, multi_gpu, false> vertex_frontier(handle, 1);
+
+  vertex_frontier.bucket(0).insert(
+    thrust::make_zip_iterator(active_majors.begin(), active_major_labels.begin()),
+    thrust::make_zip_iterator(active_majors.end(), active_major_labels.end()));
+
+  temporal_sample_edge_biases_op_t<vertex_t, edge_time_t> bias_op{
+    label_time_bounds,
+    time_window ? cuda::std::make_optional(*time_window) : cuda::std::nullopt};
+
+  rmm::device_uvector<vertex_t> majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(0, handle.get_stream());
+  std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+  std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+  std::optional<rmm::device_uvector<size_t>> sample_offsets{std::nullopt};
+
+  if (edge_weight_view) {
+    if (edge_id_view) {
+      if (edge_type_view) {
+        std::forward_as_tuple(sample_offsets,
+                              std::tie(majors, minors, weights, edge_ids, edge_types)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            view_concat(*edge_weight_view, *edge_id_view, *edge_type_view),
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t, edge_type_t>>{
+              std::nullopt},
+            false);
+      } else {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_ids)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            view_concat(*edge_weight_view, *edge_id_view),
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_t>>{std::nullopt},
+            false);
+      }
+    } else {
+      if (edge_type_view) {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights, edge_types)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            view_concat(*edge_weight_view, *edge_type_view),
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, edge_type_t>>{std::nullopt},
+            false);
+      } else {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, weights)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            *edge_weight_view,
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, weight_t>>{std::nullopt},
+            false);
+      }
+    }
+  } else {
+    if (edge_id_view) {
+      if (edge_type_view) {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids, edge_types)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            view_concat(*edge_id_view, *edge_type_view),
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, edge_t, edge_type_t>>{std::nullopt},
+            false);
+      } else {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_ids)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            *edge_id_view,
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, edge_t>>{std::nullopt},
+            false);
+      }
+    } else {
+      if (edge_type_view) {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors, edge_types)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            *edge_type_view,
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t, edge_type_t>>{std::nullopt},
+            false);
+      } else {
+        std::forward_as_tuple(sample_offsets, std::tie(majors, minors)) =
+          cugraph::per_v_random_select_transform_outgoing_e(
+            handle,
+            graph_view,
+            vertex_frontier.bucket(0),
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_time_view,
+            bias_op,
+            edge_src_dummy_property_t{}.view(),
+            edge_dst_dummy_property_t{}.view(),
+            edge_dummy_property_t{}.view(),
+            temporal_sample_edges_op_t<vertex_t>{},
+            rng_state,
+            fanout,
+            with_replacement,
+            std::optional<thrust::tuple<vertex_t, vertex_t>>{std::nullopt},
+            false);
+      }
+    }
+  }
+
+  rmm::device_uvector<label_t> labels((*sample_offsets).back_element(handle.get_stream()),
+                                      handle.get_stream());
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(active_majors.size()),
+                   segmented_fill_t{active_major_labels,
+                                    raft::device_span<size_t const>(sample_offsets->data(),
+                                                                    sample_offsets->size()),
+                                    raft::device_span<int32_t>(labels.data(), labels.size())});
+
+  return std::make_tuple(std::move(majors),
+                         std::move(minors),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(labels));
+}
+
 }  // namespace detail
 }  // namespace cugraph
@@ -35,7 +35,9 @@ sample_edges(raft::handle_t const& handle,
              raft::device_span<int64_t const> active_majors,
              std::optional<raft::device_span<int32_t const>> active_major_labels,
              size_t fanout,
-             bool with_replacement);
+             bool with_replacement,
+             std::optional<edge_property_view_t<int64_t, float const*>>
+               edge_bias_inclusive_sum_view);
 
 template std::tuple<rmm::device_uvector<int64_t>,
                     rmm::device_uvector<int64_t>,
@@ -53,7 +55,9 @@ sample_edges(raft::handle_t const& handle,
              raft::device_span<int64_t const> active_majors,
              std::optional<raft::device_span<int32_t const>> active_major_labels,
              size_t fanout,
-             bool with_replacement);
+             bool with_replacement,
+             std::optional<edge_property_view_t<int64_t, double const*>>
+               edge_bias_inclusive_sum_view);
 
 }  // namespace detail
 }  // namespace cugraph
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <cugraph/neighbor_sampling_state.hpp>
 #include <cugraph/sampling_functions.hpp>
 
+#include <raft/core/host_span.hpp>
 #include <raft/random/rng_state.hpp>
 
 #include <rmm/device_uvector.hpp>
@@ -52,6 +54,32 @@ std::tuple<size_t, size_t> check_edge_bias_values(
   graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
   edge_property_view_t<edge_t, bias_t const*> edge_bias_view);
 
+/**
+ * @brief Compute per-vertex inclusive sums of edge bias values.
+ *
+ * For every (local) vertex, compute the inclusive sums of the bias values of its outgoing edges (in
+ * the order the edges are stored in the graph). The result can be passed to sample_edges (and
+ * per_v_random_select_transform_outgoing_e) to skip collecting and scanning the bias values of the
+ * frontier vertices' outgoing edges in every biased sampling with replacement call. This function
+ * needs to be re-invoked if the graph or the edge bias values are updated.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam bias_t Type of edge bias values. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate neighbor sampling on. The graph should not have
+ * an attached edge mask.
+ * @param edge_bias_view View object holding edge bias values for @p graph_view.
+ * @return Edge property object storing the inclusive sums.
+ */
+template <typename vertex_t, typename edge_t, typename bias_t, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, false, multi_gpu>, bias_t>
+compute_edge_bias_inclusive_sums(raft::handle_t const& handle,
+                                 graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                                 edge_property_view_t<edge_t, bias_t const*> edge_bias_view);
+
 /**
  * @brief Gather edge list for specified vertices
  *
@@ -120,6 +148,9 @@ gather_one_hop_edgelist(
  * @param active_major_labels Optional device vector containing labels for each device vector
  * @param fanout How many edges to sample for each vertex
  * @param with_replacement If true sample with replacement, otherwise sample without replacement
+ * @param edge_bias_inclusive_sum_view Optional pre-computed per-vertex inclusive sums of
+ * @p edge_bias_view values (see compute_edge_bias_inclusive_sums) to accelerate biased sampling
+ * with replacement.
  * @param invalid_vertex_id Value to use for an invalid vertex
  * @return A tuple of device vectors containing the majors, minors, optional weights,
  *  optional edge ids, optional edge types and optional label
@@ -147,7 +178,301 @@ sample_edges(raft::handle_t const& handle,
              raft::device_span<vertex_t const> active_majors,
              std::optional<raft::device_span<label_t const>> active_major_labels,
              size_t fanout,
-             bool with_replacement);
+             bool with_replacement,
+             std::optional<edge_property_view_t<edge_t, bias_t const*>>
+               edge_bias_inclusive_sum_view = std::nullopt);
+
+/**
+ * @brief Temporal constraints for neighbor sampling.
+ *
+ * Frontier vertices are labeled with the (global) index of the starting vertex they are sampled
+ * from, and only the edges with the edge time values earlier than the starting vertex's time bound
+ * (and no earlier than the time bound - @p time_window if @p time_window is provided) are sampled.
+ *
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time values. Needs to be an arithmetic type.
+ * @tparam label_t Type of label. Needs to be an integral type.
+ */
+template <typename edge_t, typename edge_time_t, typename label_t>
+struct temporal_sampling_params_t {
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view;
+  raft::device_span<edge_time_t const> starting_vertex_time_bounds{};  // indexed by labels
+  std::optional<edge_time_t> time_window{std::nullopt};
+  // user provided labels of the starting vertices (indexed by labels), the output labels are
+  // replaced with these labels (or dropped if std::nullopt) before re-organizing the output
+  std::optional<raft::device_span<label_t const>> starting_vertex_labels{std::nullopt};
+};
+
+/**
+ * @brief Gather a set of edges for each active major satisfying temporal constraints.
+ *
+ * Same as sample_edges (with uniform sampling) except that only the edges with the edge time
+ * values earlier than the time bound of each active major's label (and no earlier than the time
+ * bound - @p time_window if provided) are sampled. The temporal constraint is applied while
+ * sampling (eligible edges are sampled uniformly), so there is no need to over-sample and filter.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam edge_time_t Type of edge time values. Needs to be an arithmetic type.
+ * @tparam label_t Type of label. Needs to be int32_t.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate neighbor sampling on.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param edge_time_view View object holding edge time values for @p graph_view.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param active_majors Device vector containing all the vertex id that are processed by
+ * gpus in the column communicator
+ * @param active_major_labels Device vector containing the labels of @p active_majors.
+ * @param label_time_bounds Device span of time bounds indexed by labels. In multi-GPU, this should
+ * include the time bounds of every label in @p active_major_labels.
+ * @param time_window Optional time window size.
+ * @param fanout How many edges to sample for each vertex
+ * @param with_replacement If true sample with replacement, otherwise sample without replacement
+ * @return A tuple of device vectors containing the majors, minors, optional weights,
+ *  optional edge ids, optional edge types and labels
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          typename label_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           rmm::device_uvector<label_t>>
+temporal_sample_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> active_majors,
+  raft::device_span<label_t const> active_major_labels,
+  raft::device_span<edge_time_t const> label_time_bounds,
+  std::optional<edge_time_t> time_window,
+  size_t fanout,
+  bool with_replacement);
+
+// limits of the fused multi-hop sampling fast path (see fused_multi_hop_sample_edges)
+size_t constexpr fused_multi_hop_sampling_max_fan_out{32};
+size_t constexpr fused_multi_hop_sampling_max_slots{size_t{1} << 24};
+
+/**
+ * @brief Check whether fused_multi_hop_sample_edges can be used.
+ *
+ * fused_multi_hop_sample_edges reserves one sample slot for every potential sample (i.e. the
+ * product of the fan-out values up to each hop for each starting vertex), so this is limited to
+ * small fan-out values and a small number of starting vertices.
+ *
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each level
+ * @param num_starting_vertices Number of starting vertices.
+ * @return true if the fused multi-hop sampling limits are satisfied, false otherwise.
+ */
+inline bool is_fused_multi_hop_sampling_supported(raft::host_span<int32_t const> fan_out,
+                                                  size_t num_starting_vertices)
+{
+  size_t num_slots_per_starting_vertex{1};
+  size_t num_slots{0};
+  for (size_t i = 0; i < fan_out.size(); ++i) {
+    if ((fan_out[i] <= 0) ||
+        (static_cast<size_t>(fan_out[i]) > fused_multi_hop_sampling_max_fan_out)) {
+      return false;
+    }
+    num_slots_per_starting_vertex *= static_cast<size_t>(fan_out[i]);
+    if (num_slots_per_starting_vertex > fused_multi_hop_sampling_max_slots) { return false; }
+    num_slots += num_slots_per_starting_vertex * num_starting_vertices;
+    if (num_slots > fused_multi_hop_sampling_max_slots) { return false; }
+  }
+  return fan_out.size() > 0;
+}
+
+/**
+ * @brief Sample all the hops of homogeneous uniform neighbor sampling in a single kernel (SG only).
+ *
+ * This is a fast path for neighbor_sample_impl for small fan-out values and small seed batches
+ * (see is_fused_multi_hop_sampling_supported) when the frontier of each hop is the destinations of
+ * the previous hop samples (i.e. prior_sources_behavior_t::DEFAULT and no source deduplication).
+ * Instead of sampling, gathering and sorting the frontier hop by hop, a warp samples the entire
+ * sampling tree of one starting vertex. Sampling without replacement dedupes the sampled neighbor
+ * indices of each frontier vertex in the warp (using Floyd's algorithm). The samples are returned
+ * in the hop order, but the order of the samples within a hop differs from sample_edges.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam label_t Type of label. Needs to be an integral type.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate neighbor sampling on. Should not have an edge
+ * mask.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param starting_vertices Device span of starting vertex IDs for the sampling.
+ * @param starting_vertex_labels Optional device span of labels associated with each starting
+ * vertex.
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+ * level. is_fused_multi_hop_sampling_supported(fan_out, starting_vertices.size()) should be true.
+ * @param return_hops boolean flag specifying if the hop information should be returned
+ * @param with_replacement A flag specifying whether the neighbors should be sampled with
+ * replacement (if true) or without replacement (if false).
+ * @return A tuple of device vectors containing the majors, minors, optional weights,
+ *  optional edge ids, optional edge types, optional hops and optional labels
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<int32_t>>,
+           std::optional<rmm::device_uvector<label_t>>>
+fused_multi_hop_sample_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> starting_vertices,
+  std::optional<raft::device_span<label_t const>> starting_vertex_labels,
+  raft::host_span<int32_t const> fan_out,
+  bool return_hops,
+  bool with_replacement);
+
+/**
+ * @brief Build the hot vertex cache (see neighbor_sampling_state_t::cache_hot_vertices).
+ *
+ * Select the @p num_hot_vertices highest out-degree vertices (ties are broken by vertex IDs) and
+ * replicate their (unmasked) outgoing edges and edge property values on every GPU.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam bias_t Type of bias. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate neighbor sampling on.
+ * @param edge_weight_view Optional view object holding edge weights for @p graph_view.
+ * @param edge_id_view Optional view object holding edge ids for @p graph_view.
+ * @param edge_type_view Optional view object holding edge types for @p graph_view.
+ * @param edge_bias_view Optional view object holding edge bias values for @p graph_view, the cache
+ * stores per-vertex inclusive sums of the bias values if provided.
+ * @param num_hot_vertices Number of vertices to cache.
+ * @return The hot vertex cache.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename bias_t,
+          bool multi_gpu>
+hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t> build_hot_vertex_cache(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<edge_property_view_t<edge_t, bias_t const*>> edge_bias_view,
+  size_t num_hot_vertices);
+
+/**
+ * @brief Split vertices (and their labels) to the vertices in the hot vertex cache and the others.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam label_t Type of label. Needs to be an integral type.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param cached_vertices Sorted vertices in the hot vertex cache.
+ * @param vertices Vertices to split.
+ * @param vertex_labels Optional labels of @p vertices.
+ * @return A tuple of the vertices not in the cache, their optional labels, the vertices in the
+ * cache, and their optional labels.
+ */
+template <typename vertex_t, typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<label_t>>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<label_t>>>
+partition_cached_vertices(raft::handle_t const& handle,
+                          raft::device_span<vertex_t const> cached_vertices,
+                          rmm::device_uvector<vertex_t>&& vertices,
+                          std::optional<rmm::device_uvector<label_t>>&& vertex_labels);
+
+/**
+ * @brief Sample the outgoing edges of the vertices in the hot vertex cache (locally, without any
+ * communication).
+ *
+ * Same as sample_edges (gather_one_hop_edgelist if @p fanout is negative) for uniform sampling and
+ * for biased sampling with replacement, but the order of the samples differs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam edge_type_t Type of edge type. Needs to be an integral type.
+ * @tparam bias_t Type of bias. Needs to be a floating point type.
+ * @tparam label_t Type of label. Needs to be an integral type.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param hot_vertex_cache The hot vertex cache.
+ * @param rng_state A pre-initialized raft::RngState object for generating random numbers
+ * @param active_majors Device span of the frontier vertices, every vertex should be in the cache.
+ * @param active_major_labels Optional device span of labels associated with each frontier vertex.
+ * @param fanout Number of edges to sample for each frontier vertex, gather all the outgoing edges
+ * if negative.
+ * @param with_replacement A flag specifying whether the neighbors should be sampled with
+ * replacement (if true) or without replacement (if false).
+ * @param biased A flag specifying whether to sample based on the cached bias values (requires
+ * @p with_replacement to be true).
+ * @return A tuple of device vectors containing the majors, minors, optional weights,
+ *  optional edge ids, optional edge types and optional labels
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename bias_t,
+          typename label_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<label_t>>>
+sample_cached_edges(
+  raft::handle_t const& handle,
+  hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t> const& hot_vertex_cache,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> active_majors,
+  std::optional<raft::device_span<label_t const>> active_major_labels,
+  int32_t fanout,
+  bool with_replacement,
+  bool biased);
 
 /**
  * @brief Use the sampling results from hop N to populate the new frontier for hop N+1.
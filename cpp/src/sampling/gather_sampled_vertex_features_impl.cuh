@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// out[i * feature_dim + j] = features[(vertices[i] - vertex_first) * feature_dim + j]
+template <typename vertex_t, typename feature_t>
+struct gather_feature_row_t {
+  raft::device_span<vertex_t const> vertices{};
+  raft::device_span<feature_t const> features{};
+  size_t feature_dim{};
+  vertex_t vertex_first{};
+
+  __device__ feature_t operator()(size_t i) const
+  {
+    auto v = vertices[i / feature_dim];
+    return features[static_cast<size_t>(v - vertex_first) * feature_dim + (i % feature_dim)];
+  }
+};
+
+// out[i * feature_dim + j] = features[lower_bound(sorted_unique_vertices, vertices[i]) *
+// feature_dim + j]
+template <typename vertex_t, typename feature_t>
+struct gather_feature_row_from_sorted_unique_vertices_t {
+  raft::device_span<vertex_t const> vertices{};
+  raft::device_span<vertex_t const> sorted_unique_vertices{};
+  raft::device_span<feature_t const> features{};
+  size_t feature_dim{};
+
+  __device__ feature_t operator()(size_t i) const
+  {
+    auto v   = vertices[i / feature_dim];
+    auto idx = static_cast<size_t>(thrust::distance(
+      sorted_unique_vertices.begin(),
+      thrust::lower_bound(
+        thrust::seq, sorted_unique_vertices.begin(), sorted_unique_vertices.end(), v)));
+    return features[idx * feature_dim + (i % feature_dim)];
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename feature_t, bool multi_gpu>
+rmm::device_uvector<feature_t> gather_sampled_vertex_features(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<feature_t const> vertex_features,
+  size_t feature_dim,
+  raft::device_span<vertex_t const> renumber_map,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(feature_dim > 0, "Invalid input argument: feature_dim should be positive.");
+  CUGRAPH_EXPECTS(vertex_features.size() ==
+                    static_cast<size_t>(graph_view.local_vertex_partition_range_size()) *
+                      feature_dim,
+                  "Invalid input argument: vertex_features size should coincide with the local "
+                  "vertex partition range size times feature_dim.");
+
+  if (do_expensive_check) {
+    auto num_invalids = thrust::count_if(
+      handle.get_thrust_policy(),
+      renumber_map.begin(),
+      renumber_map.end(),
+      [num_vertices = graph_view.number_of_vertices()] __device__(auto v) {
+        return (v < vertex_t{0}) || (v >= num_vertices);
+      });
+    if constexpr (multi_gpu) {
+      num_invalids = host_scalar_allreduce(
+        handle.get_comms(), num_invalids, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input argument: renumber_map has invalid vertex IDs.");
+  }
+
+  rmm::device_uvector<feature_t> gathered_features(renumber_map.size() * feature_dim,
+                                                   handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    // 1. find the unique vertices to request (a vertex can appear in multiple labels' renumber
+    // maps)
+
+    rmm::device_uvector<vertex_t> sorted_unique_vertices(renumber_map.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 renumber_map.begin(),
+                 renumber_map.end(),
+                 sorted_unique_vertices.begin());
+    thrust::sort(
+      handle.get_thrust_policy(), sorted_unique_vertices.begin(), sorted_unique_vertices.end());
+    sorted_unique_vertices.resize(
+      thrust::distance(sorted_unique_vertices.begin(),
+                       thrust::unique(handle.get_thrust_policy(),
+                                      sorted_unique_vertices.begin(),
+                                      sorted_unique_vertices.end())),
+      handle.get_stream());
+
+    // 2. send the requests to the GPUs owning the vertices
+
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    rmm::device_uvector<vertex_t> d_range_lasts(vertex_partition_range_lasts.size(),
+                                                handle.get_stream());
+    raft::update_device(d_range_lasts.data(),
+                        vertex_partition_range_lasts.data(),
+                        vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+    rmm::device_uvector<size_t> d_offsets(d_range_lasts.size() - 1, handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        sorted_unique_vertices.begin(),
+                        sorted_unique_vertices.end(),
+                        d_range_lasts.begin(),
+                        d_range_lasts.begin() + (d_range_lasts.size() - 1),
+                        d_offsets.begin());
+    std::vector<size_t> h_offsets(d_offsets.size() + 2);
+    raft::update_host(
+      h_offsets.data() + 1, d_offsets.data(), d_offsets.size(), handle.get_stream());
+    h_offsets[0]     = 0;
+    h_offsets.back() = sorted_unique_vertices.size();
+    handle.sync_stream();
+
+    std::vector<size_t> tx_counts(vertex_partition_range_lasts.size());
+    std::adjacent_difference(h_offsets.begin() + 1, h_offsets.end(), tx_counts.begin());
+
+    auto [rx_vertices, rx_counts] =
+      shuffle_values(comm, sorted_unique_vertices.begin(), tx_counts, handle.get_stream());
+
+    // 3. gather the requested feature rows and send back to the requesting GPUs (in the request
+    // order, so the rows are returned in the sorted unique vertex order)
+
+    rmm::device_uvector<feature_t> rx_features(rx_vertices.size() * feature_dim,
+                                               handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(rx_features.size()),
+                      rx_features.begin(),
+                      detail::gather_feature_row_t<vertex_t, feature_t>{
+                        raft::device_span<vertex_t const>(rx_vertices.data(), rx_vertices.size()),
+                        vertex_features,
+                        feature_dim,
+                        graph_view.local_vertex_partition_range_first()});
+    rx_vertices.resize(0, handle.get_stream());
+    rx_vertices.shrink_to_fit(handle.get_stream());
+
+    std::transform(rx_counts.begin(), rx_counts.end(), rx_counts.begin(), [feature_dim](auto c) {
+      return c * feature_dim;
+    });
+    rmm::device_uvector<feature_t> unique_vertex_features(0, handle.get_stream());
+    std::tie(unique_vertex_features, std::ignore) =
+      shuffle_values(comm, rx_features.begin(), rx_counts, handle.get_stream());
+    rx_features.resize(0, handle.get_stream());
+    rx_features.shrink_to_fit(handle.get_stream());
+
+    // 4. lay out the feature rows in the renumber map order
+
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(gathered_features.size()),
+      gathered_features.begin(),
+      detail::gather_feature_row_from_sorted_unique_vertices_t<vertex_t, feature_t>{
+        renumber_map,
+        raft::device_span<vertex_t const>(sorted_unique_vertices.data(),
+                                          sorted_unique_vertices.size()),
+        raft::device_span<feature_t const>(unique_vertex_features.data(),
+                                           unique_vertex_features.size()),
+        feature_dim});
+  } else {
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(gathered_features.size()),
+      gathered_features.begin(),
+      detail::gather_feature_row_t<vertex_t, feature_t>{
+        renumber_map, vertex_features, feature_dim, vertex_t{0}});
+  }
+
+  return gathered_features;
+}
+
+}  // namespace cugraph
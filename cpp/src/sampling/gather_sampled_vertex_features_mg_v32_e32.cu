@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gather_sampled_vertex_features_impl.cuh"
+
+#include <cugraph/sampling_functions.hpp>
+
+namespace cugraph {
+
+template rmm::device_uvector<float> gather_sampled_vertex_features(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  raft::device_span<float const> vertex_features,
+  size_t feature_dim,
+  raft::device_span<int32_t const> renumber_map,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> gather_sampled_vertex_features(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  raft::device_span<double const> vertex_features,
+  size_t feature_dim,
+  raft::device_span<int32_t const> renumber_map,
+  bool do_expensive_check);
+
+}  // namespace cugraph
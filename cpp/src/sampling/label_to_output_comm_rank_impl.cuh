@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/distance.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// estimated number of sampled edges (+ 1 for the seed itself) of a seed vertex
+template <typename vertex_t, typename edge_t>
+struct estimate_seed_sampling_cost_t {
+  raft::device_span<edge_t const> local_out_degrees{};
+  vertex_t local_vertex_partition_range_first{};
+  int32_t first_hop_fanout{};
+  double later_hop_multiplier{};  // expected frontier growth in the hops after the first hop
+  size_t num_later_hops{};
+
+  __device__ double operator()(vertex_t v) const
+  {
+    auto degree = static_cast<double>(local_out_degrees[v - local_vertex_partition_range_first]);
+    auto frontier_size = ((first_hop_fanout < 0) || (degree < first_hop_fanout))
+                           ? degree
+                           : static_cast<double>(first_hop_fanout);
+    auto cost = 1.0 + frontier_size;
+    for (size_t i = 0; i < num_later_hops; ++i) {
+      frontier_size *= later_hop_multiplier;
+      cost += frontier_size;
+    }
+    return cost;
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<int32_t> compute_balanced_label_to_output_comm_rank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::device_span<int32_t const> starting_vertex_labels,
+  raft::host_span<int32_t const> fan_out)
+{
+  CUGRAPH_EXPECTS(starting_vertices.size() == starting_vertex_labels.size(),
+                  "Invalid input argument: starting_vertices and starting_vertex_labels should "
+                  "have the same size.");
+  CUGRAPH_EXPECTS(fan_out.size() > 0, "Invalid input argument: number of levels must be non-zero.");
+
+  // 1. estimate the sampling cost of each seed
+
+  auto out_degrees = graph_view.compute_out_degrees(handle);
+
+  double later_hop_multiplier{1.0};
+  size_t num_later_hops = fan_out.size() - 1;
+  if (std::any_of(fan_out.begin() + 1, fan_out.end(), [](auto k) { return k < 0; })) {
+    auto num_edges  = static_cast<double>(graph_view.compute_number_of_edges(handle));
+    auto avg_degree = graph_view.number_of_vertices() > 0
+                        ? num_edges / static_cast<double>(graph_view.number_of_vertices())
+                        : 0.0;
+    later_hop_multiplier = 0.0;
+    for (size_t i = 1; i < fan_out.size(); ++i) {
+      later_hop_multiplier += fan_out[i] < 0 ? avg_degree : static_cast<double>(fan_out[i]);
+    }
+    later_hop_multiplier /= static_cast<double>(num_later_hops);
+  } else if (num_later_hops > 0) {
+    // geometric mean of the later hop fan-outs (so the product over the later hops is preserved)
+    double log_sum{0.0};
+    for (size_t i = 1; i < fan_out.size(); ++i) {
+      log_sum += std::log(std::max(static_cast<double>(fan_out[i]), 1.0));
+    }
+    later_hop_multiplier = std::exp(log_sum / static_cast<double>(num_later_hops));
+  }
+
+  rmm::device_uvector<int32_t> labels(starting_vertex_labels.size(), handle.get_stream());
+  raft::copy(labels.data(),
+             starting_vertex_labels.data(),
+             starting_vertex_labels.size(),
+             handle.get_stream());
+  rmm::device_uvector<double> costs(starting_vertices.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    starting_vertices.begin(),
+                    starting_vertices.end(),
+                    costs.begin(),
+                    detail::estimate_seed_sampling_cost_t<vertex_t, edge_t>{
+                      raft::device_span<edge_t const>(out_degrees.data(), out_degrees.size()),
+                      graph_view.local_vertex_partition_range_first(),
+                      fan_out[0],
+                      later_hop_multiplier,
+                      num_later_hops});
+  out_degrees.resize(0, handle.get_stream());
+  out_degrees.shrink_to_fit(handle.get_stream());
+
+  // 2. aggregate the costs per label (over every rank)
+
+  auto reduce_by_label = [&handle](rmm::device_uvector<int32_t>&& labels,
+                                   rmm::device_uvector<double>&& costs) {
+    thrust::sort_by_key(handle.get_thrust_policy(), labels.begin(), labels.end(), costs.begin());
+    rmm::device_uvector<int32_t> unique_labels(labels.size(), handle.get_stream());
+    rmm::device_uvector<double> label_costs(costs.size(), handle.get_stream());
+    auto num_unique_labels = static_cast<size_t>(
+      thrust::distance(unique_labels.begin(),
+                       thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                                            labels.begin(),
+                                                            labels.end(),
+                                                            costs.begin(),
+                                                            unique_labels.begin(),
+                                                            label_costs.begin()))));
+    unique_labels.resize(num_unique_labels, handle.get_stream());
+    label_costs.resize(num_unique_labels, handle.get_stream());
+    return std::make_tuple(std::move(unique_labels), std::move(label_costs));
+  };
+
+  std::tie(labels, costs) = reduce_by_label(std::move(labels), std::move(costs));
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    labels     = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<int32_t const>(labels.data(), labels.size()));
+    costs = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<double const>(costs.data(), costs.size()));
+    std::tie(labels, costs) = reduce_by_label(std::move(labels), std::move(costs));
+  }
+
+  std::vector<int32_t> h_labels(labels.size());
+  std::vector<double> h_costs(costs.size());
+  raft::update_host(h_labels.data(), labels.data(), labels.size(), handle.get_stream());
+  raft::update_host(h_costs.data(), costs.data(), costs.size(), handle.get_stream());
+  handle.sync_stream();
+
+  CUGRAPH_EXPECTS(h_labels.empty() || (h_labels.front() >= 0),
+                  "Invalid input argument: starting_vertex_labels should be non-negative.");
+
+  // 3. assign the labels to ranks (largest estimated cost first, to the least loaded rank, this
+  // runs on the host and is identical on every rank)
+
+  auto num_labels = h_labels.empty() ? size_t{0} : static_cast<size_t>(h_labels.back()) + 1;
+  int32_t comm_size{1};
+  if constexpr (multi_gpu) { comm_size = handle.get_comms().get_size(); }
+
+  std::vector<size_t> label_order(h_labels.size());
+  std::iota(label_order.begin(), label_order.end(), size_t{0});
+  std::stable_sort(label_order.begin(), label_order.end(), [&h_costs](auto lhs, auto rhs) {
+    return h_costs[lhs] > h_costs[rhs];
+  });
+
+  using rank_load_t = std::tuple<double, int32_t>;
+  std::priority_queue<rank_load_t, std::vector<rank_load_t>, std::greater<rank_load_t>>
+    rank_loads{};
+  for (int32_t i = 0; i < comm_size; ++i) {
+    rank_loads.push(std::make_tuple(0.0, i));
+  }
+
+  // labels without any seed are assigned in a round-robin manner
+  std::vector<int32_t> h_label_to_output_comm_rank(num_labels);
+  for (size_t i = 0; i < num_labels; ++i) {
+    h_label_to_output_comm_rank[i] = static_cast<int32_t>(i % static_cast<size_t>(comm_size));
+  }
+  for (auto i : label_order) {
+    auto [load, rank] = rank_loads.top();
+    rank_loads.pop();
+    h_label_to_output_comm_rank[h_labels[i]] = rank;
+    rank_loads.push(std::make_tuple(load + h_costs[i], rank));
+  }
+
+  rmm::device_uvector<int32_t> label_to_output_comm_rank(num_labels, handle.get_stream());
+  raft::update_device(label_to_output_comm_rank.data(),
+                      h_label_to_output_comm_rank.data(),
+                      h_label_to_output_comm_rank.size(),
+                      handle.get_stream());
+  handle.sync_stream();
+
+  return label_to_output_comm_rank;
+}
+
+}  // namespace cugraph
@@ -18,6 +18,7 @@
 
 #include "cugraph/detail/collect_comm_wrapper.hpp"
 #include "cugraph/utilities/device_comm.hpp"
+#include "prims/key_store.cuh"
 #include "prims/reduce_v.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
 #include "thrust/iterator/zip_iterator.h"
@@ -25,6 +26,7 @@
 
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/sampling_functions.hpp>
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/host_scalar_comm.hpp>
@@ -38,18 +40,80 @@
 #include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <tuple>
 
 namespace cugraph {
 
 namespace detail {
 
+// upper bound on the number of generate/reject rounds when an exact number of samples is requested
+size_t constexpr negative_sampling_max_rounds{64};
+// upper bound on the oversampling factor (inverse of the observed acceptance ratio) of a round
+size_t constexpr negative_sampling_max_oversampling_factor{64};
+// the existing edges are loaded into a hash set if the number of samples is at least
+// (number of edges / this ratio), below this, looking up the candidates is cheaper than building
+// the set
+size_t constexpr negative_sampling_edge_set_min_sample_ratio{16};
+
+template <typename vertex_t>
+struct vertex_pair_to_key_t {
+  size_t num_vertices{};
+
+  __device__ size_t operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    return static_cast<size_t>(thrust::get<0>(pair)) * num_vertices +
+           static_cast<size_t>(thrust::get<1>(pair));
+  }
+};
+
+template <typename vertex_t, typename KeySetDeviceView>
+struct is_existing_edge_t {
+  KeySetDeviceView existing_edges{};
+  vertex_pair_to_key_t<vertex_t> to_key{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    return existing_edges.contains(to_key(pair));
+  }
+};
+
+// Returns a hash set of the (src, dst) pairs of the edges stored in this GPU's edge partitions,
+// candidates are shuffled to the owning edge partitions before filtering, so a local set suffices.
+// Returns std::nullopt if (src, dst) pairs cannot be packed into a size_t key.
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+std::optional<key_store_t<size_t, false>> build_existing_edge_set(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view)
+{
+  auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+  if ((num_vertices > 0) && (num_vertices > std::numeric_limits<size_t>::max() / num_vertices)) {
+    return std::nullopt;
+  }
+
+  auto [edge_srcs, edge_dsts, edge_weights, edge_ids, edge_types] =
+    decompress_to_edgelist<vertex_t, edge_t, float, int32_t, store_transposed, multi_gpu>(
+      handle, graph_view, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+
+  key_store_t<size_t, false> edge_set(
+    std::max(edge_srcs.size(), size_t{1}), std::numeric_limits<size_t>::max(), handle.get_stream());
+  auto key_first = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin()),
+    vertex_pair_to_key_t<vertex_t>{num_vertices});
+  edge_set.insert(key_first, key_first + edge_srcs.size(), handle.get_stream());
+
+  return std::make_optional(std::move(edge_set));
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -286,7 +350,8 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> negativ
     total_samples   = std::reduce(samples_per_gpu.begin(), samples_per_gpu.end());
   }
 
-  size_t samples_in_this_batch = total_samples;
+  size_t global_batch_size{total_samples};
+  size_t samples_in_this_batch{total_samples};
 
   // Normalize the biases and (for MG) determine how the biases are
   // distributed across the GPUs.
@@ -303,14 +368,32 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> negativ
     std::tie(normalized_dst_biases, gpu_dst_biases) =
       detail::normalize_biases(handle, graph_view, *dst_biases);
 
-  while (samples_in_this_batch > 0) {
+  // With enough samples to amortize the cost, existing edges are rejected by probing a hash set of
+  // the local edges instead of searching the adjacency lists of every candidate
+  std::optional<key_store_t<size_t, false>> existing_edge_set{std::nullopt};
+  if (remove_existing_edges &&
+      (total_samples * detail::negative_sampling_edge_set_min_sample_ratio >=
+       static_cast<size_t>(graph_view.compute_number_of_edges(handle)))) {
+    existing_edge_set = detail::build_existing_edge_set(handle, graph_view);
+  }
+
+  size_t num_rounds{0};
+  size_t num_generated{0};
+  while (global_batch_size > 0) {
+    CUGRAPH_EXPECTS(num_rounds < detail::negative_sampling_max_rounds,
+                    "Failed to generate the exact number of negative samples within the maximum "
+                    "number of rounds, the graph may be too dense.");
+    ++num_rounds;
+    num_generated += global_batch_size;
+
+    samples_in_this_batch = global_batch_size;
     if constexpr (multi_gpu) {
       auto const comm_size = handle.get_comms().get_size();
       auto const comm_rank = handle.get_comms().get_rank();
 
       samples_in_this_batch =
-        (samples_in_this_batch / static_cast<size_t>(comm_size)) +
-        (static_cast<size_t>(comm_rank) < (samples_in_this_batch % static_cast<size_t>(comm_size))
+        (global_batch_size / static_cast<size_t>(comm_size)) +
+        (static_cast<size_t>(comm_rank) < (global_batch_size % static_cast<size_t>(comm_size))
            ? 1
            : 0);
     }
@@ -347,7 +430,22 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> negativ
           vertex_partition_range_lasts);
     }
 
-    if (remove_existing_edges) {
+    if (existing_edge_set) {
+      auto begin_iter = thrust::make_zip_iterator(batch_srcs.begin(), batch_dsts.begin());
+      auto new_end    = thrust::remove_if(
+        handle.get_thrust_policy(),
+        begin_iter,
+        begin_iter + batch_srcs.size(),
+        detail::is_existing_edge_t<vertex_t,
+                                   detail::key_cuco_store_contains_device_view_t<
+                                     decltype(existing_edge_set->view())>>{
+          detail::key_cuco_store_contains_device_view_t(existing_edge_set->view()),
+          detail::vertex_pair_to_key_t<vertex_t>{
+            static_cast<size_t>(graph_view.number_of_vertices())}});
+
+      batch_srcs.resize(thrust::distance(begin_iter, new_end), handle.get_stream());
+      batch_dsts.resize(thrust::distance(begin_iter, new_end), handle.get_stream());
+    } else if (remove_existing_edges) {
       auto has_edge_flags =
         graph_view.has_edge(handle,
                             raft::device_span<vertex_t const>{batch_srcs.data(), batch_srcs.size()},
@@ -427,12 +525,45 @@ std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> negativ
           handle.get_comms(), current_sample_size, raft::comms::op_t::SUM, handle.get_stream());
       }
 
-      // FIXME: We could oversample and discard the unnecessary samples
-      // to reduce the number of iterations in the outer loop, but it seems like
-      // exact_number_of_samples is an edge case not worth optimizing for at this time.
-      samples_in_this_batch = total_samples - current_sample_size;
+      // Oversample the deficit by the inverse of the acceptance ratio observed so far (the
+      // surplus is discarded below) to bound the number of rounds
+      if (current_sample_size < total_samples) {
+        auto deficit      = total_samples - current_sample_size;
+        global_batch_size = (current_sample_size > 0)
+                              ? static_cast<size_t>(std::ceil(
+                                  static_cast<double>(deficit) *
+                                  std::min(static_cast<double>(num_generated) /
+                                             static_cast<double>(current_sample_size),
+                                           static_cast<double>(
+                                             detail::negative_sampling_max_oversampling_factor))))
+                              : deficit * detail::negative_sampling_max_oversampling_factor;
+      } else {
+        global_batch_size = 0;
+      }
     } else {
-      samples_in_this_batch = 0;
+      global_batch_size = 0;
+    }
+  }
+
+  if constexpr (!multi_gpu) {
+    if (srcs.size() > total_samples) {
+      // Discard a random subset of the surplus (the samples may be sorted if duplicates were
+      // removed)
+      rmm::device_uvector<float> fractional_random_numbers(srcs.size(), handle.get_stream());
+
+      cugraph::detail::uniform_random_fill(handle.get_stream(),
+                                           fractional_random_numbers.data(),
+                                           fractional_random_numbers.size(),
+                                           float{0.0},
+                                           float{1.0},
+                                           rng_state);
+      thrust::sort_by_key(handle.get_thrust_policy(),
+                          fractional_random_numbers.begin(),
+                          fractional_random_numbers.end(),
+                          thrust::make_zip_iterator(srcs.begin(), dsts.begin()));
+
+      srcs.resize(total_samples, handle.get_stream());
+      dsts.resize(total_samples, handle.get_stream());
     }
   }
 
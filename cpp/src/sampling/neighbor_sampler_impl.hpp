@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/neighbor_sampler.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace cugraph {
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::neighbor_sampler_t(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::vector<int32_t> const& fan_out,
+  sampling_flags_t sampling_flags,
+  uint64_t seed,
+  bool compress_per_hop,
+  bool doubly_compress,
+  size_t max_ready_minibatches)
+  : handle_(handle),
+    graph_view_(graph_view),
+    edge_weight_view_(edge_weight_view),
+    edge_id_view_(edge_id_view),
+    edge_type_view_(edge_type_view),
+    fan_out_(fan_out),
+    sampling_flags_(sampling_flags),
+    rng_state_(seed),
+    compress_per_hop_(compress_per_hop),
+    doubly_compress_(doubly_compress),
+    max_ready_minibatches_(max_ready_minibatches)
+{
+  CUGRAPH_EXPECTS(fan_out_.size() > 0, "Invalid input argument: fan_out should not be empty.");
+  CUGRAPH_EXPECTS(max_ready_minibatches_ > 0,
+                  "Invalid input argument: max_ready_minibatches should be positive.");
+  CUGRAPH_EXPECTS(!compress_per_hop_ || !doubly_compress_,
+                  "Invalid input argument: compress_per_hop and doubly_compress cannot be both "
+                  "true.");
+
+  // renumber_and_compress_sampled_edgelist requires hops if there are two or more hops
+  if (fan_out_.size() > 1) { sampling_flags_.return_hops = true; }
+
+  // the two streams are identical (and sampling and post-processing are serialized on the GPU) if
+  // the handle does not have a stream pool
+  sampling_stream_        = handle_.get_next_usable_stream(size_t{0});
+  post_processing_stream_ = handle_.get_next_usable_stream(size_t{1});
+
+  sampling_thread_        = std::thread([this]() { run_sampling(); });
+  post_processing_thread_ = std::thread([this]() { run_post_processing(); });
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::~neighbor_sampler_t()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+  }
+  cv_.notify_all();
+  if (sampling_thread_.joinable()) { sampling_thread_.join(); }
+  if (post_processing_thread_.joinable()) { post_processing_thread_.join(); }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+size_t neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::enqueue(
+  rmm::device_uvector<vertex_t>&& seeds)
+{
+  size_t minibatch_id{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CUGRAPH_EXPECTS(!closed_, "Invalid operation: enqueue() is called after close().");
+    minibatch_id = num_enqueued_++;
+    seeds.set_stream(sampling_stream_);
+    seed_queue_.emplace_back(minibatch_id, std::move(seeds));
+  }
+  cv_.notify_all();
+  return minibatch_id;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+void neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::close()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  cv_.notify_all();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+std::optional<typename neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::minibatch_t>
+neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::next()
+{
+  std::optional<minibatch_t> minibatch{std::nullopt};
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() {
+      return exception_ || !ready_queue_.empty() || post_processing_done_;
+    });
+    if (exception_) { std::rethrow_exception(exception_); }
+    if (ready_queue_.empty()) { return std::nullopt; }
+    minibatch = std::move(ready_queue_.front());
+    ready_queue_.pop_front();
+  }
+  cv_.notify_all();
+  return minibatch;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+void neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::set_exception(
+  std::exception_ptr exception)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!exception_) { exception_ = exception; }
+    cancelled_ = true;
+  }
+  cv_.notify_all();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+void neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::run_sampling()
+{
+  raft::handle_t light_handle(sampling_stream_);
+
+  while (true) {
+    std::optional<std::tuple<size_t, rmm::device_uvector<vertex_t>>> seed_batch{std::nullopt};
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return cancelled_ || closed_ || !seed_queue_.empty(); });
+      if (cancelled_ || seed_queue_.empty()) { break; }
+      seed_batch = std::move(seed_queue_.front());
+      seed_queue_.pop_front();
+    }
+
+    try {
+      auto& [minibatch_id, seeds] = *seed_batch;
+
+      auto [srcs, dsts, weights, edge_ids, edge_types, hops, offsets] =
+        homogeneous_uniform_neighbor_sample(
+          light_handle,
+          rng_state_,
+          graph_view_,
+          edge_weight_view_,
+          edge_id_view_,
+          edge_type_view_,
+          raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+          std::nullopt,
+          std::nullopt,
+          raft::host_span<int32_t const>(fan_out_.data(), fan_out_.size()),
+          sampling_flags_);
+      light_handle.sync_stream();
+
+      // hand over to the post-processing stream
+      sampled_edgelist_t edgelist{minibatch_id,
+                                  std::move(seeds),
+                                  std::move(srcs),
+                                  std::move(dsts),
+                                  std::move(weights),
+                                  std::move(edge_ids),
+                                  std::move(edge_types),
+                                  std::move(hops)};
+      edgelist.seeds.set_stream(post_processing_stream_);
+      edgelist.srcs.set_stream(post_processing_stream_);
+      edgelist.dsts.set_stream(post_processing_stream_);
+      if (edgelist.weights) { (*edgelist.weights).set_stream(post_processing_stream_); }
+      if (edgelist.edge_ids) { (*edgelist.edge_ids).set_stream(post_processing_stream_); }
+      if (edgelist.edge_types) { (*edgelist.edge_types).set_stream(post_processing_stream_); }
+      if (edgelist.hops) { (*edgelist.hops).set_stream(post_processing_stream_); }
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return cancelled_ || !staged_edgelist_; });
+        if (cancelled_) { break; }
+        staged_edgelist_ = std::move(edgelist);
+      }
+      cv_.notify_all();
+    } catch (...) {
+      set_exception(std::current_exception());
+      break;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sampling_done_ = true;
+  }
+  cv_.notify_all();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+void neighbor_sampler_t<vertex_t, edge_t, weight_t, edge_type_t>::run_post_processing()
+{
+  raft::handle_t light_handle(post_processing_stream_);
+
+  while (true) {
+    std::optional<sampled_edgelist_t> edgelist{std::nullopt};
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return cancelled_ || staged_edgelist_ || sampling_done_; });
+      if (cancelled_ || !staged_edgelist_) { break; }
+      edgelist         = std::move(staged_edgelist_);
+      staged_edgelist_ = std::nullopt;
+    }
+    cv_.notify_all();  // the sampling thread can stage the next minibatch
+
+    try {
+      auto [majors,
+            major_offsets,
+            minors,
+            weights,
+            edge_ids,
+            edge_types,
+            label_hop_offsets,
+            renumber_map,
+            renumber_map_label_offsets] =
+        renumber_and_compress_sampled_edgelist<vertex_t, weight_t, edge_t, edge_type_t>(
+          light_handle,
+          std::move((*edgelist).srcs),
+          std::move((*edgelist).dsts),
+          std::move((*edgelist).weights),
+          std::move((*edgelist).edge_ids),
+          std::move((*edgelist).edge_types),
+          std::move((*edgelist).hops),
+          std::make_optional<raft::device_span<vertex_t const>>((*edgelist).seeds.data(),
+                                                                (*edgelist).seeds.size()),
+          std::nullopt,
+          std::nullopt,
+          size_t{1},
+          fan_out_.size(),
+          true,
+          compress_per_hop_,
+          doubly_compress_);
+      light_handle.sync_stream();
+
+      // hand over to the caller's stream
+      minibatch_t minibatch{(*edgelist).minibatch_id,
+                            std::move(majors),
+                            std::move(major_offsets),
+                            std::move(minors),
+                            std::move(weights),
+                            std::move(edge_ids),
+                            std::move(edge_types),
+                            std::move(label_hop_offsets),
+                            std::move(renumber_map)};
+      edgelist = std::nullopt;
+      auto stream_view = handle_.get_stream();
+      if (minibatch.majors) { (*minibatch.majors).set_stream(stream_view); }
+      minibatch.major_offsets.set_stream(stream_view);
+      minibatch.minors.set_stream(stream_view);
+      if (minibatch.weights) { (*minibatch.weights).set_stream(stream_view); }
+      if (minibatch.edge_ids) { (*minibatch.edge_ids).set_stream(stream_view); }
+      if (minibatch.edge_types) { (*minibatch.edge_types).set_stream(stream_view); }
+      if (minibatch.hop_offsets) { (*minibatch.hop_offsets).set_stream(stream_view); }
+      minibatch.renumber_map.set_stream(stream_view);
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock,
+                 [this]() { return cancelled_ || ready_queue_.size() < max_ready_minibatches_; });
+        if (cancelled_) { break; }
+        ready_queue_.push_back(std::move(minibatch));
+      }
+      cv_.notify_all();
+    } catch (...) {
+      set_exception(std::current_exception());
+      break;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    post_processing_done_ = true;
+  }
+  cv_.notify_all();
+}
+
+}  // namespace cugraph
@@ -28,15 +28,67 @@
 #include <cugraph/vertex_partition_view.hpp>
 
 #include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
 
 #include <rmm/device_uvector.hpp>
 
 #include <cuda/std/optional>
+#include <thrust/transform.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+
 namespace cugraph {
 namespace detail {
 
+// edge masks selecting the edges of each edge type (these are graph invariant, so
+// neighbor_sampling_state_t computes them once and reuses them across sampling calls)
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::vector<
+  cugraph::edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>>
+compute_edge_type_masks(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_type_t const*> edge_type_view,
+  edge_type_t num_edge_types)
+{
+  std::vector<
+    cugraph::edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>>
+    edge_masks_vector{};
+  edge_masks_vector.reserve(num_edge_types);
+
+  for (int i = 0; i < num_edge_types; i++) {
+    cugraph::edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
+      edge_mask(handle, graph_view);
+
+    cugraph::fill_edge_property(handle, graph_view, edge_mask.mutable_view(), bool{true});
+
+    cugraph::transform_e(
+      handle,
+      graph_view,
+      cugraph::edge_src_dummy_property_t{}.view(),
+      cugraph::edge_dst_dummy_property_t{}.view(),
+      edge_type_view,
+      [valid_edge_type = i] __device__(auto src,
+                                       auto dst,
+                                       cuda::std::nullopt_t,
+                                       cuda::std::nullopt_t,
+                                       /*cuda::std::nullopt_t*/ auto edge_type) {
+        return edge_type == valid_edge_type;
+      },
+      edge_mask.mutable_view(),
+      false);
+
+    edge_masks_vector.push_back(std::move(edge_mask));
+  }
+
+  return edge_masks_vector;
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -44,7 +96,8 @@ template <typename vertex_t,
           typename bias_t,
           typename label_t,
           bool store_transposed,
-          bool multi_gpu>
+          bool multi_gpu,
+          typename edge_time_t = int64_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
            std::optional<rmm::device_uvector<weight_t>>,
@@ -69,7 +122,16 @@ neighbor_sample_impl(raft::handle_t const& handle,
                      bool with_replacement,
                      prior_sources_behavior_t prior_sources_behavior,
                      bool dedupe_sources,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     std::optional<
+                       raft::host_span<edge_property_view_t<edge_t, uint32_t const*, bool> const>>
+                       edge_type_masks = std::nullopt,
+                     std::optional<edge_property_view_t<edge_t, bias_t const*>>
+                       edge_bias_inclusive_sum_view = std::nullopt,
+                     std::optional<temporal_sampling_params_t<edge_t, edge_time_t, label_t>>
+                       temporal_sampling_params = std::nullopt,
+                     hot_vertex_cache_t<vertex_t, edge_t, weight_t, edge_type_t, bias_t> const*
+                       hot_vertex_cache = nullptr)
 {
   static_assert(std::is_floating_point_v<bias_t>);
 
@@ -96,6 +158,17 @@ neighbor_sample_impl(raft::handle_t const& handle,
     }
   }
 
+  if (temporal_sampling_params) {
+    CUGRAPH_EXPECTS(starting_vertex_labels.has_value(),
+                    "Invalid input argument: temporal sampling requires frontier labels to look up "
+                    "the time bounds.");
+    CUGRAPH_EXPECTS(!edge_bias_view.has_value(),
+                    "Invalid input argument: temporal sampling does not support edge biases.");
+    CUGRAPH_EXPECTS(std::all_of(fan_out.begin(), fan_out.end(), [](auto k) { return k >= 0; }),
+                    "Invalid input argument: temporal sampling does not support negative fan_out "
+                    "values (gathering all the neighbors).");
+  }
+
   CUGRAPH_EXPECTS(fan_out.size() > 0, "Invalid input argument: number of levels must be non-zero.");
   CUGRAPH_EXPECTS(
     fan_out.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
@@ -105,37 +178,56 @@ neighbor_sample_impl(raft::handle_t const& handle,
   std::vector<
     cugraph::edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>>
     edge_masks_vector{};
-  graph_view_t<vertex_t, edge_t, false, multi_gpu> modified_graph_view = graph_view;
-  edge_masks_vector.reserve(num_edge_types);
-
+  std::vector<edge_property_view_t<edge_t, uint32_t const*, bool>> edge_mask_views{};
   if (num_edge_types > 1) {
-    for (int i = 0; i < num_edge_types; i++) {
-      cugraph::edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
-        edge_mask(handle, graph_view);
-
-      cugraph::fill_edge_property(
-        handle, modified_graph_view, edge_mask.mutable_view(), bool{true});
-
-      cugraph::transform_e(
-        handle,
-        modified_graph_view,
-        cugraph::edge_src_dummy_property_t{}.view(),
-        cugraph::edge_dst_dummy_property_t{}.view(),
-        *edge_type_view,
-        [valid_edge_type = i] __device__(auto src,
-                                         auto dst,
-                                         cuda::std::nullopt_t,
-                                         cuda::std::nullopt_t,
-                                         /*cuda::std::nullopt_t*/ auto edge_type) {
-          return edge_type == valid_edge_type;
-        },
-        edge_mask.mutable_view(),
-        false);
-
-      edge_masks_vector.push_back(std::move(edge_mask));
+    if (edge_type_masks) {
+      CUGRAPH_EXPECTS((*edge_type_masks).size() == static_cast<size_t>(num_edge_types),
+                      "Invalid input argument: edge_type_masks size does not match with "
+                      "num_edge_types.");
+      edge_mask_views.assign((*edge_type_masks).begin(), (*edge_type_masks).end());
+    } else {
+      edge_masks_vector =
+        compute_edge_type_masks(handle, graph_view, *edge_type_view, num_edge_types);
+      edge_mask_views.reserve(edge_masks_vector.size());
+      for (auto const& edge_mask : edge_masks_vector) {
+        edge_mask_views.push_back(edge_mask.view());
+      }
+    }
+  }
+  if constexpr (!multi_gpu) {
+    // fast path: sample all the hops in a single kernel if the frontier of each hop is just the
+    // destinations of the previous hop samples and the per-seed sampling trees are small
+    if (!temporal_sampling_params && (num_edge_types == 1) && !edge_bias_view &&
+        !graph_view.has_edge_mask() &&
+        (prior_sources_behavior == prior_sources_behavior_t::DEFAULT) && !dedupe_sources &&
+        is_fused_multi_hop_sampling_supported(fan_out, starting_vertices.size())) {
+      auto [srcs, dsts, weights, edge_ids, edge_types, hops, labels] =
+        fused_multi_hop_sample_edges(handle,
+                                     graph_view,
+                                     edge_weight_view,
+                                     edge_id_view,
+                                     edge_type_view,
+                                     rng_state,
+                                     starting_vertices,
+                                     starting_vertex_labels,
+                                     fan_out,
+                                     return_hops,
+                                     with_replacement);
+
+      return detail::shuffle_and_organize_output(handle,
+                                                 std::move(srcs),
+                                                 std::move(dsts),
+                                                 std::move(weights),
+                                                 std::move(edge_ids),
+                                                 std::move(edge_types),
+                                                 std::move(hops),
+                                                 std::move(labels),
+                                                 label_to_output_comm_rank);
     }
   }
 
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> modified_graph_view = graph_view;
+
   // Get the number of hop. If homogeneous neighbor sample, num_edge_types = 1.
   auto num_hops = ((fan_out.size() % num_edge_types) == 0)
                     ? (fan_out.size() / num_edge_types)
@@ -183,9 +275,49 @@ neighbor_sample_impl(raft::handle_t const& handle,
                         : std::nullopt));
   }
 
+  // frontier vertices in the hot vertex cache are sampled locally (and are not shuffled to the
+  // owning GPUs), the frontier of each hop should be just the destinations of the previous hop
+  bool use_hot_vertex_cache{false};
+  if constexpr (multi_gpu) {
+    use_hot_vertex_cache =
+      (hot_vertex_cache != nullptr) && (num_edge_types == 1) && !temporal_sampling_params &&
+      (prior_sources_behavior == prior_sources_behavior_t::DEFAULT) && !dedupe_sources &&
+      (!edge_bias_view || (with_replacement && hot_vertex_cache->bias_inclusive_sums));
+  }
+
+  rmm::device_uvector<vertex_t> cached_frontier_vertices(0, handle.get_stream());
+  std::optional<rmm::device_uvector<label_t>> cached_frontier_vertex_labels{std::nullopt};
+
+  if (use_hot_vertex_cache) {
+    frontier_vertices.resize(starting_vertices.size(), handle.get_stream());
+    raft::copy(frontier_vertices.data(),
+               starting_vertices.data(),
+               starting_vertices.size(),
+               handle.get_stream());
+    if (starting_vertex_labels) {
+      frontier_vertex_labels->resize(starting_vertex_labels->size(), handle.get_stream());
+      raft::copy(frontier_vertex_labels->data(),
+                 starting_vertex_labels->data(),
+                 starting_vertex_labels->size(),
+                 handle.get_stream());
+    }
+    std::tie(frontier_vertices,
+             frontier_vertex_labels,
+             cached_frontier_vertices,
+             cached_frontier_vertex_labels) =
+      partition_cached_vertices(
+        handle,
+        raft::device_span<vertex_t const>(hot_vertex_cache->vertices.data(),
+                                          hot_vertex_cache->vertices.size()),
+        std::move(frontier_vertices),
+        std::move(frontier_vertex_labels));
+  }
+
   std::vector<size_t> level_sizes{};
 
   for (size_t hop = 0; hop < num_hops; ++hop) {
+    auto use_starting_vertices = (hop == 0) && !use_hot_vertex_cache;
+
     rmm::device_uvector<vertex_t> level_result_src(0, handle.get_stream());
     rmm::device_uvector<vertex_t> level_result_dst(0, handle.get_stream());
 
@@ -213,10 +345,31 @@ neighbor_sample_impl(raft::handle_t const& handle,
       std::optional<rmm::device_uvector<int32_t>> labels{std::nullopt};
 
       if (num_edge_types > 1) {
-        modified_graph_view.attach_edge_mask(edge_masks_vector[edge_type].view());
+        modified_graph_view.attach_edge_mask(edge_mask_views[edge_type]);
       }
 
-      if (k_level > 0) {
+      if ((k_level > 0) && temporal_sampling_params) {
+        rmm::device_uvector<label_t> tmp_labels(0, handle.get_stream());
+        std::tie(srcs, dsts, weights, edge_ids, edge_types, tmp_labels) = temporal_sample_edges(
+          handle,
+          modified_graph_view,
+          edge_weight_view,
+          edge_id_view,
+          edge_type_view,
+          temporal_sampling_params->edge_time_view,
+          rng_state,
+          use_starting_vertices
+            ? starting_vertices
+            : raft::device_span<vertex_t const>(frontier_vertices.data(), frontier_vertices.size()),
+          use_starting_vertices ? *starting_vertex_labels
+                   : raft::device_span<label_t const>(frontier_vertex_labels->data(),
+                                                      frontier_vertex_labels->size()),
+          temporal_sampling_params->starting_vertex_time_bounds,
+          temporal_sampling_params->time_window,
+          static_cast<size_t>(k_level),
+          with_replacement);
+        labels = std::move(tmp_labels);
+      } else if (k_level > 0) {
         std::tie(srcs, dsts, weights, edge_ids, edge_types, labels) = sample_edges(
           handle,
           modified_graph_view,
@@ -225,16 +378,17 @@ neighbor_sample_impl(raft::handle_t const& handle,
           edge_type_view,
           edge_bias_view,
           rng_state,
-          hop == 0
+          use_starting_vertices
             ? starting_vertices
             : raft::device_span<vertex_t const>(frontier_vertices.data(), frontier_vertices.size()),
-          hop == 0 ? starting_vertex_labels
+          use_starting_vertices ? starting_vertex_labels
           : starting_vertex_labels
             ? std::make_optional(raft::device_span<label_t const>(frontier_vertex_labels->data(),
                                                                   frontier_vertex_labels->size()))
             : std::nullopt,
           static_cast<size_t>(k_level),
-          with_replacement);
+          with_replacement,
+          edge_bias_inclusive_sum_view);
       } else if (k_level < 0) {
         std::tie(srcs, dsts, weights, edge_ids, edge_types, labels) = gather_one_hop_edgelist(
           handle,
@@ -242,16 +396,50 @@ neighbor_sample_impl(raft::handle_t const& handle,
           edge_weight_view,
           edge_id_view,
           edge_type_view,
-          hop == 0
+          use_starting_vertices
             ? starting_vertices
             : raft::device_span<vertex_t const>(frontier_vertices.data(), frontier_vertices.size()),
-          hop == 0 ? starting_vertex_labels
+          use_starting_vertices ? starting_vertex_labels
           : starting_vertex_labels
             ? std::make_optional(raft::device_span<label_t const>(frontier_vertex_labels->data(),
                                                                   frontier_vertex_labels->size()))
             : std::nullopt);
       }
 
+      if (use_hot_vertex_cache && (k_level != 0)) {
+        auto [cached_srcs,
+              cached_dsts,
+              cached_weights,
+              cached_edge_ids,
+              cached_edge_types,
+              cached_labels] =
+          sample_cached_edges(
+            handle,
+            *hot_vertex_cache,
+            rng_state,
+            raft::device_span<vertex_t const>(cached_frontier_vertices.data(),
+                                              cached_frontier_vertices.size()),
+            cached_frontier_vertex_labels
+              ? std::make_optional(raft::device_span<label_t const>(
+                  cached_frontier_vertex_labels->data(), cached_frontier_vertex_labels->size()))
+              : std::nullopt,
+            k_level,
+            with_replacement,
+            edge_bias_view.has_value());
+
+        auto append = [&handle](auto& lhs, auto const& rhs) {
+          auto old_size = lhs.size();
+          lhs.resize(old_size + rhs.size(), handle.get_stream());
+          raft::copy(lhs.begin() + old_size, rhs.begin(), rhs.size(), handle.get_stream());
+        };
+        append(srcs, cached_srcs);
+        append(dsts, cached_dsts);
+        if (weights) { append(*weights, *cached_weights); }
+        if (edge_ids) { append(*edge_ids, *cached_edge_ids); }
+        if (edge_types) { append(*edge_types, *cached_edge_types); }
+        if (labels) { append(*labels, *cached_labels); }
+      }
+
       auto old_size = level_result_src.size();
       level_result_src.resize(old_size + srcs.size(), handle.get_stream());
       level_result_dst.resize(old_size + srcs.size(), handle.get_stream());
@@ -316,26 +504,64 @@ neighbor_sample_impl(raft::handle_t const& handle,
       (*level_result_label_vectors).push_back(std::move(*level_result_label));
     }
 
+    auto next_frontier_vertices = raft::device_span<vertex_t const>{
+      level_result_dst_vectors.back().data(), level_result_dst_vectors.back().size()};
+    auto next_frontier_vertex_labels =
+      frontier_vertex_labels
+        ? std::make_optional(raft::device_span<label_t const>(
+            level_result_label_vectors->back().data(), level_result_label_vectors->back().size()))
+        : std::nullopt;
+
+    rmm::device_uvector<vertex_t> uncached_dsts(0, handle.get_stream());
+    std::optional<rmm::device_uvector<label_t>> uncached_dst_labels{std::nullopt};
+    if (use_hot_vertex_cache) {
+      uncached_dsts.resize(next_frontier_vertices.size(), handle.get_stream());
+      raft::copy(uncached_dsts.data(),
+                 next_frontier_vertices.data(),
+                 next_frontier_vertices.size(),
+                 handle.get_stream());
+      if (next_frontier_vertex_labels) {
+        uncached_dst_labels =
+          rmm::device_uvector<label_t>(next_frontier_vertex_labels->size(), handle.get_stream());
+        raft::copy(uncached_dst_labels->data(),
+                   next_frontier_vertex_labels->data(),
+                   next_frontier_vertex_labels->size(),
+                   handle.get_stream());
+      }
+      std::tie(uncached_dsts,
+               uncached_dst_labels,
+               cached_frontier_vertices,
+               cached_frontier_vertex_labels) =
+        partition_cached_vertices(handle,
+                                  raft::device_span<vertex_t const>(
+                                    hot_vertex_cache->vertices.data(),
+                                    hot_vertex_cache->vertices.size()),
+                                  std::move(uncached_dsts),
+                                  std::move(uncached_dst_labels));
+      next_frontier_vertices =
+        raft::device_span<vertex_t const>(uncached_dsts.data(), uncached_dsts.size());
+      if (next_frontier_vertex_labels) {
+        next_frontier_vertex_labels = raft::device_span<label_t const>(
+          uncached_dst_labels->data(), uncached_dst_labels->size());
+      }
+    }
+
     // FIXME:  We should modify vertex_partition_range_lasts to return a raft::host_span
     //  rather than making a copy.
     auto vertex_partition_range_lasts = modified_graph_view.vertex_partition_range_lasts();
     std::tie(frontier_vertices, frontier_vertex_labels, vertex_used_as_source) =
       prepare_next_frontier(
         handle,
-        hop == 0
+        use_starting_vertices
           ? starting_vertices
           : raft::device_span<vertex_t const>(frontier_vertices.data(), frontier_vertices.size()),
-        hop == 0 ? starting_vertex_labels
+        use_starting_vertices ? starting_vertex_labels
         : starting_vertex_labels
           ? std::make_optional(raft::device_span<label_t const>(frontier_vertex_labels->data(),
                                                                 frontier_vertex_labels->size()))
           : std::nullopt,
-        raft::device_span<vertex_t const>{level_result_dst_vectors.back().data(),
-                                          level_result_dst_vectors.back().size()},
-        frontier_vertex_labels
-          ? std::make_optional(raft::device_span<label_t const>(
-              level_result_label_vectors->back().data(), level_result_label_vectors->back().size()))
-          : std::nullopt,
+        next_frontier_vertices,
+        next_frontier_vertex_labels,
         std::move(vertex_used_as_source),
         modified_graph_view.local_vertex_partition_view(),
         vertex_partition_range_lasts,
@@ -447,6 +673,21 @@ neighbor_sample_impl(raft::handle_t const& handle,
     level_result_label_vectors = std::nullopt;
   }
 
+  if (temporal_sampling_params) {  // replace the starting vertex indices with the user labels
+    if (temporal_sampling_params->starting_vertex_labels) {
+      thrust::transform(
+        handle.get_thrust_policy(),
+        (*result_labels).begin(),
+        (*result_labels).end(),
+        (*result_labels).begin(),
+        [user_labels = *(temporal_sampling_params->starting_vertex_labels)] __device__(label_t l) {
+          return user_labels[l];
+        });
+    } else {
+      result_labels = std::nullopt;
+    }
+  }
+
   return detail::shuffle_and_organize_output(handle,
                                              std::move(result_srcs),
                                              std::move(result_dsts),
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sampling/detail/sampling_utils.hpp"
+#include "sampling/neighbor_sampling_impl.hpp"
+
+#include <cugraph/neighbor_sampling_state.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+neighbor_sampling_state_t<vertex_t, edge_t, weight_t, edge_type_t, multi_gpu>::
+  neighbor_sampling_state_t(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+    std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_bias_view,
+    edge_type_t num_edge_types,
+    bool do_expensive_check)
+  : graph_view_(graph_view),
+    edge_weight_view_(edge_weight_view),
+    edge_id_view_(edge_id_view),
+    edge_type_view_(edge_type_view),
+    edge_bias_view_(edge_bias_view),
+    num_edge_types_(num_edge_types)
+{
+  CUGRAPH_EXPECTS(num_edge_types_ >= 1,
+                  "Invalid input argument: num_edge_types should be a positive number.");
+  CUGRAPH_EXPECTS(num_edge_types_ == 1 || edge_type_view_.has_value(),
+                  "Invalid input argument: edge_type_view should be provided if num_edge_types > "
+                  "1.");
+
+  if (do_expensive_check) {
+    if (edge_bias_view_) {
+      auto [num_negative_edge_weights, num_overflows] =
+        detail::check_edge_bias_values(handle, graph_view_, *edge_bias_view_);
+
+      CUGRAPH_EXPECTS(
+        num_negative_edge_weights == 0,
+        "Invalid input argument: input edge bias values should have non-negative values.");
+      CUGRAPH_EXPECTS(num_overflows == 0,
+                      "Invalid input argument: sum of neighboring edge bias values should not "
+                      "exceed std::numeric_limits<bias_t>::max() for any vertex.");
+    }
+  }
+
+  if (num_edge_types_ > 1) {
+    edge_type_masks_ =
+      detail::compute_edge_type_masks(handle, graph_view_, *edge_type_view_, num_edge_types_);
+    edge_type_mask_views_.reserve(edge_type_masks_.size());
+    for (auto const& edge_mask : edge_type_masks_) {
+      edge_type_mask_views_.push_back(edge_mask.view());
+    }
+  }
+
+  if (edge_bias_view_ && (num_edge_types_ == 1) && !graph_view_.has_edge_mask()) {
+    edge_bias_inclusive_sums_ =
+      detail::compute_edge_bias_inclusive_sums(handle, graph_view_, *edge_bias_view_);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<int32_t>>,
+           std::optional<rmm::device_uvector<size_t>>>
+neighbor_sampling_state_t<vertex_t, edge_t, weight_t, edge_type_t, multi_gpu>::sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  raft::device_span<vertex_t const> starting_vertices,
+  std::optional<raft::device_span<int32_t const>> starting_vertex_labels,
+  std::optional<raft::device_span<int32_t const>> label_to_output_comm_rank,
+  raft::host_span<int32_t const> fan_out,
+  sampling_flags_t sampling_flags) const
+{
+  using edge_mask_view_t = edge_property_view_t<edge_t, uint32_t const*, bool>;
+
+  auto edge_type_masks = (num_edge_types_ > 1)
+                           ? std::make_optional(raft::host_span<edge_mask_view_t const>(
+                               edge_type_mask_views_.data(), edge_type_mask_views_.size()))
+                           : std::nullopt;
+
+  auto [majors, minors, weights, edge_ids, edge_types, hops, labels, offsets] =
+    detail::neighbor_sample_impl<vertex_t, edge_t, weight_t, edge_type_t, weight_t>(
+      handle,
+      rng_state,
+      graph_view_,
+      edge_weight_view_,
+      edge_id_view_,
+      edge_type_view_,
+      edge_bias_view_,
+      starting_vertices,
+      starting_vertex_labels,
+      label_to_output_comm_rank,
+      fan_out,
+      num_edge_types_,
+      sampling_flags.return_hops,
+      sampling_flags.with_replacement,
+      sampling_flags.prior_sources_behavior,
+      sampling_flags.dedupe_sources,
+      false /* edge bias values are checked in the constructor */,
+      edge_type_masks,
+      edge_bias_inclusive_sums_ ? std::make_optional((*edge_bias_inclusive_sums_).view())
+                                : std::nullopt,
+      std::nullopt,
+      hot_vertex_cache_ ? &(*hot_vertex_cache_) : nullptr);
+
+  return std::make_tuple(std::move(majors),
+                         std::move(minors),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(hops),
+                         std::move(offsets));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+void neighbor_sampling_state_t<vertex_t, edge_t, weight_t, edge_type_t, multi_gpu>::
+  cache_hot_vertices(raft::handle_t const& handle, size_t num_hot_vertices)
+{
+  hot_vertex_cache_ = std::nullopt;
+  if constexpr (multi_gpu) {
+    if ((num_hot_vertices > 0) && (num_edge_types_ == 1)) {
+      hot_vertex_cache_ = detail::build_hot_vertex_cache(handle,
+                                                         graph_view_,
+                                                         edge_weight_view_,
+                                                         edge_id_view_,
+                                                         edge_type_view_,
+                                                         edge_bias_view_,
+                                                         num_hot_vertices);
+    }
+  }
+}
+
+}  // namespace cugraph
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_device.cuh>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cuda_utils.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace cugraph {
+
+namespace detail {
+
+int32_t constexpr skip_gram_kernel_block_size = 128;
+
+// the dot products are clamped to [-skip_gram_max_exp, skip_gram_max_exp] before applying the
+// sigmoid function (the gradients saturate beyond this range)
+float constexpr skip_gram_max_exp = 6.0;
+
+// the negative samples are drawn from the unigram distribution raised to this power (the vertex
+// frequencies in the walks are approximated by the out-degrees)
+double constexpr skip_gram_negative_sampling_exponent = 0.75;
+
+// the learning rate decays linearly to this fraction of the initial learning rate
+float constexpr skip_gram_min_learning_rate_ratio = 1e-4;
+
+// Every warp trains one center position of a walk (the walks are stored in the padded format with
+// walk_length + 1 vertices per walk). For every context vertex in the (randomly shrunk) window,
+// the context vertex is a positive sample and num_negative_samples vertices drawn from the noise
+// distribution are negative samples; the gradients of the center vertex embedding are accumulated
+// in shared memory and applied after visiting the whole window. The embedding tables are updated
+// without synchronization (Hogwild!); collisions are rare as the updates are sparse. All the lanes
+// of a warp draw the same random numbers (from the subsequence of the center position) to take the
+// same branches.
+template <typename vertex_t>
+__global__ static void skip_gram_negative_sampling_kernel(
+  raft::device_span<vertex_t const> walk_vertices,
+  size_t walk_length,
+  size_t window_size,
+  size_t num_negative_samples,
+  raft::device_span<double const> noise_inclusive_sums,
+  float learning_rate,
+  size_t dimension,
+  float* embeddings,
+  float* context_embeddings,
+  raft::random::DeviceState<raft::random::PCGenerator> device_state)
+{
+  extern __shared__ float shared_center_gradients[];
+
+  auto const lane_id    = threadIdx.x % raft::warp_size();
+  auto center_gradients = shared_center_gradients + (threadIdx.x / raft::warp_size()) * dimension;
+  auto idx = static_cast<size_t>((threadIdx.x + blockIdx.x * blockDim.x) / raft::warp_size());
+  auto const noise_sum = noise_inclusive_sums.size() > 0 ? noise_inclusive_sums.back() : 0.0;
+
+  while (idx < walk_vertices.size()) {
+    auto center = walk_vertices[idx];
+    if (center != invalid_vertex_id<vertex_t>::value) {
+      raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(idx));
+
+      auto walk_first = (idx / (walk_length + 1)) * (walk_length + 1);
+      auto position   = idx - walk_first;
+      uint32_t r{};
+      gen.next(r);
+      auto window = window_size - (r % window_size);  // in [1, window_size]
+
+      auto center_embedding = embeddings + static_cast<size_t>(center) * dimension;
+      for (size_t d = lane_id; d < dimension; d += raft::warp_size()) {
+        center_gradients[d] = 0.0;
+      }
+
+      auto context_first = position > window ? position - window : size_t{0};
+      auto context_last  = position + window < walk_length ? position + window : walk_length;
+      for (auto j = context_first; j <= context_last; ++j) {
+        if (j == position) { continue; }
+        auto context = walk_vertices[walk_first + j];
+        if (context == invalid_vertex_id<vertex_t>::value) { break; }  // the walk terminated
+
+        for (size_t k = 0; k <= num_negative_samples; ++k) {
+          auto target = context;
+          float label{1.0};
+          if (k > 0) {
+            if (noise_sum <= 0.0) { break; }
+            double u{};
+            gen.next(u);
+            auto noise_offset = static_cast<size_t>(thrust::distance(
+              noise_inclusive_sums.begin(),
+              thrust::upper_bound(thrust::seq,
+                                  noise_inclusive_sums.begin(),
+                                  noise_inclusive_sums.end(),
+                                  u * noise_sum)));
+            target = static_cast<vertex_t>(noise_offset < noise_inclusive_sums.size()
+                                             ? noise_offset
+                                             : noise_inclusive_sums.size() - 1);  // rounding guard
+            label  = 0.0;
+            if (target == context) { continue; }
+          }
+
+          auto target_embedding = context_embeddings + static_cast<size_t>(target) * dimension;
+          float dot{0.0};
+          for (size_t d = lane_id; d < dimension; d += raft::warp_size()) {
+            dot += center_embedding[d] * target_embedding[d];
+          }
+          for (int offset = raft::warp_size() / 2; offset > 0; offset /= 2) {
+            dot += __shfl_xor_sync(raft::warp_full_mask(), dot, offset);
+          }
+          dot    = fminf(fmaxf(dot, -skip_gram_max_exp), skip_gram_max_exp);
+          auto g = (label - 1.0f / (1.0f + expf(-dot))) * learning_rate;
+          for (size_t d = lane_id; d < dimension; d += raft::warp_size()) {
+            center_gradients[d] += g * target_embedding[d];
+            target_embedding[d] += g * center_embedding[d];
+          }
+        }
+      }
+
+      for (size_t d = lane_id; d < dimension; d += raft::warp_size()) {
+        center_embedding[d] += center_gradients[d];
+      }
+    }
+
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<float> node2vec_embedding_impl(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t embedding_dimension,
+  size_t num_walks_per_vertex,
+  size_t walk_length,
+  weight_t p,
+  weight_t q,
+  size_t window_size,
+  size_t num_negative_samples,
+  size_t num_epochs,
+  float learning_rate,
+  size_t walk_chunk_size)
+{
+  auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+
+  // 1. initialize the embedding tables (the vertex embeddings are drawn from
+  // [-0.5 / embedding_dimension, 0.5 / embedding_dimension) and the context embeddings are zero)
+
+  rmm::device_uvector<float> embeddings(num_vertices * embedding_dimension, handle.get_stream());
+  rmm::device_uvector<float> context_embeddings(embeddings.size(), handle.get_stream());
+  detail::uniform_random_fill(handle.get_stream(),
+                              embeddings.data(),
+                              embeddings.size(),
+                              -0.5f / static_cast<float>(embedding_dimension),
+                              0.5f / static_cast<float>(embedding_dimension),
+                              rng_state);
+  detail::scalar_fill(handle, context_embeddings.data(), context_embeddings.size(), float{0.0});
+
+  // 2. compute the noise distribution for negative sampling
+
+  rmm::device_uvector<double> noise_inclusive_sums(num_vertices, handle.get_stream());
+  {
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+    auto noise_first = thrust::make_transform_iterator(
+      out_degrees.begin(), cuda::proclaim_return_type<double>([] __device__(edge_t degree) {
+        return pow(static_cast<double>(degree), skip_gram_negative_sampling_exponent);
+      }));
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           noise_first,
+                           noise_first + out_degrees.size(),
+                           noise_inclusive_sums.begin());
+  }
+
+  // 3. generate the walks in chunks and train the embeddings with each chunk (the walks of a chunk
+  // are discarded before generating the next chunk)
+
+  auto num_walks_per_epoch = num_vertices * num_walks_per_vertex;
+  auto num_total_walks     = num_walks_per_epoch * num_epochs;
+  auto num_warps_per_block = static_cast<size_t>(skip_gram_kernel_block_size / raft::warp_size());
+  auto shared_memory_size  = num_warps_per_block * embedding_dimension * sizeof(float);
+
+  rmm::device_uvector<vertex_t> start_vertices(std::min(walk_chunk_size, num_walks_per_epoch),
+                                               handle.get_stream());
+  for (size_t epoch = 0; epoch < num_epochs; ++epoch) {
+    for (size_t chunk_first = 0; chunk_first < num_walks_per_epoch;
+         chunk_first += walk_chunk_size) {
+      auto chunk_size = std::min(walk_chunk_size, num_walks_per_epoch - chunk_first);
+
+      // the i'th walk of an epoch starts from vertex i % num_vertices
+      start_vertices.resize(chunk_size, handle.get_stream());
+      thrust::tabulate(handle.get_thrust_policy(),
+                       start_vertices.begin(),
+                       start_vertices.end(),
+                       cuda::proclaim_return_type<vertex_t>(
+                         [chunk_first, num_vertices] __device__(size_t i) {
+                           return static_cast<vertex_t>((chunk_first + i) % num_vertices);
+                         }));
+      auto start_vertex_span =
+        raft::device_span<vertex_t const>(start_vertices.data(), start_vertices.size());
+
+      rmm::device_uvector<vertex_t> walk_vertices(0, handle.get_stream());
+      if ((p != weight_t{1}) || (q != weight_t{1})) {
+        std::tie(walk_vertices, std::ignore) = node2vec_random_walks(handle,
+                                                                     rng_state,
+                                                                     graph_view,
+                                                                     edge_weight_view,
+                                                                     start_vertex_span,
+                                                                     walk_length,
+                                                                     p,
+                                                                     q);
+      } else if (edge_weight_view) {
+        std::tie(walk_vertices, std::ignore) = biased_random_walks(
+          handle, rng_state, graph_view, *edge_weight_view, start_vertex_span, walk_length);
+      } else {
+        std::tie(walk_vertices, std::ignore) =
+          uniform_random_walks(handle,
+                               rng_state,
+                               graph_view,
+                               std::optional<edge_property_view_t<edge_t, weight_t const*>>{
+                                 std::nullopt},
+                               start_vertex_span,
+                               walk_length);
+      }
+
+      auto num_processed_walks = epoch * num_walks_per_epoch + chunk_first;
+      auto chunk_learning_rate =
+        learning_rate * std::max(skip_gram_min_learning_rate_ratio,
+                                 1.0f - static_cast<float>(num_processed_walks) /
+                                          static_cast<float>(num_total_walks));
+
+      raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+      raft::grid_1d_warp_t update_grid(walk_vertices.size(),
+                                       skip_gram_kernel_block_size,
+                                       handle.get_device_properties().maxGridSize[0]);
+      skip_gram_negative_sampling_kernel<vertex_t>
+        <<<update_grid.num_blocks,
+           update_grid.block_size,
+           shared_memory_size,
+           handle.get_stream()>>>(
+          raft::device_span<vertex_t const>(walk_vertices.data(), walk_vertices.size()),
+          walk_length,
+          window_size,
+          num_negative_samples,
+          raft::device_span<double const>(noise_inclusive_sums.data(),
+                                          noise_inclusive_sums.size()),
+          chunk_learning_rate,
+          embedding_dimension,
+          embeddings.data(),
+          context_embeddings.data(),
+          device_state);
+      rng_state.advance(walk_vertices.size());
+    }
+  }
+
+  return embeddings;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<float> node2vec_embedding(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t embedding_dimension,
+  size_t num_walks_per_vertex,
+  size_t walk_length,
+  weight_t p,
+  weight_t q,
+  size_t window_size,
+  size_t num_negative_samples,
+  size_t num_epochs,
+  float learning_rate,
+  size_t walk_chunk_size,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(embedding_dimension > 0,
+                  "Invalid input argument: embedding_dimension should be positive.");
+  CUGRAPH_EXPECTS(
+    (detail::skip_gram_kernel_block_size / raft::warp_size()) * embedding_dimension *
+        sizeof(float) <=
+      static_cast<size_t>(handle.get_device_properties().sharedMemPerBlock),
+    "Invalid input argument: embedding_dimension is too large.");
+  CUGRAPH_EXPECTS((walk_length > 0) && (window_size > 0) && (walk_chunk_size > 0),
+                  "Invalid input argument: walk_length, window_size, and walk_chunk_size should "
+                  "be positive.");
+  CUGRAPH_EXPECTS((p > weight_t{0}) && (q > weight_t{0}),
+                  "Invalid input argument: p and q should be positive.");
+  CUGRAPH_EXPECTS(learning_rate > 0.0f,
+                  "Invalid input argument: learning_rate should be positive.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  return detail::node2vec_embedding_impl(handle,
+                                         rng_state,
+                                         graph_view,
+                                         edge_weight_view,
+                                         embedding_dimension,
+                                         num_walks_per_vertex,
+                                         walk_length,
+                                         p,
+                                         q,
+                                         window_size,
+                                         num_negative_samples,
+                                         num_epochs,
+                                         learning_rate,
+                                         walk_chunk_size);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampling/node2vec_embedding_impl.cuh"
+
+#include <cugraph/algorithms.hpp>
+
+namespace cugraph {
+
+template rmm::device_uvector<float> node2vec_embedding(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  size_t embedding_dimension,
+  size_t num_walks_per_vertex,
+  size_t walk_length,
+  float p,
+  float q,
+  size_t window_size,
+  size_t num_negative_samples,
+  size_t num_epochs,
+  float learning_rate,
+  size_t walk_chunk_size,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> node2vec_embedding(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  size_t embedding_dimension,
+  size_t num_walks_per_vertex,
+  size_t walk_length,
+  double p,
+  double q,
+  size_t window_size,
+  size_t num_negative_samples,
+  size_t num_epochs,
+  float learning_rate,
+  size_t walk_chunk_size,
+  bool do_expensive_check);
+
+}  // namespace cugraph
@@ -17,7 +17,7 @@
 #pragma once
 
 #include "detail/graph_partition_utils.cuh"
-#include "prims/detail/nbr_intersection.cuh"
+#include "prims/kv_store.cuh"
 #include "prims/per_v_random_select_transform_outgoing_e.cuh"
 #include "prims/property_op_utils.cuh"
 #include "prims/update_edge_src_dst_property.cuh"
@@ -26,6 +26,8 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_type_index_device_view.cuh>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
@@ -35,12 +37,28 @@
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
 #include <raft/random/rng.cuh>
+#include <raft/random/rng_device.cuh>
+#include <raft/util/cudart_utils.hpp>
 
 #include <rmm/device_uvector.hpp>
 
+#include <cuda/functional>
 #include <cuda/std/optional>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <limits>
 #include <numeric>
@@ -85,92 +103,40 @@ struct biased_sample_edges_op_t {
   }
 };
 
-template <typename vertex_t, typename bias_t, typename weight_t>
-struct node2vec_random_walk_e_bias_op_t {
-  bias_t p_{};
-  bias_t q_{};
-  raft::device_span<size_t const> intersection_offsets_{};
-  raft::device_span<vertex_t const> intersection_indices_{};
-  raft::device_span<vertex_t const> current_vertices_{};
-  raft::device_span<vertex_t const> prev_vertices_{};
-
-  // Unweighted Bias Operator
-  template <typename W = weight_t>
-  __device__ std::enable_if_t<std::is_same_v<W, void>, bias_t> operator()(
-    thrust::tuple<vertex_t, vertex_t> tagged_src,
-    vertex_t dst,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t) const
-  {
-    //  Check tag (prev vert) for destination
-    if (dst == thrust::get<1>(tagged_src)) { return 1.0 / p_; }
-    //  Search zipped vertices for tagged src
-    auto lower_itr = thrust::lower_bound(
-      thrust::seq,
-      thrust::make_zip_iterator(current_vertices_.begin(), prev_vertices_.begin()),
-      thrust::make_zip_iterator(current_vertices_.end(), prev_vertices_.end()),
-      tagged_src);
-    auto low_idx = thrust::distance(
-      thrust::make_zip_iterator(current_vertices_.begin(), prev_vertices_.begin()), lower_itr);
-    auto intersection_index_first = intersection_indices_.begin() + intersection_offsets_[low_idx];
-    auto intersection_index_last =
-      intersection_indices_.begin() + intersection_offsets_[low_idx + 1];
-    auto itr =
-      thrust::lower_bound(thrust::seq, intersection_index_first, intersection_index_last, dst);
-    return (itr != intersection_index_last && *itr == dst) ? 1.0 : 1.0 / q_;
-  }
-
-  //  Weighted Bias Operator
-  template <typename W = weight_t>
-  __device__ std::enable_if_t<!std::is_same_v<W, void>, bias_t> operator()(
-    thrust::tuple<vertex_t, vertex_t> tagged_src,
-    vertex_t dst,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t,
-    W) const
-  {
-    //  Check tag (prev vert) for destination
-    if (dst == thrust::get<1>(tagged_src)) { return 1.0 / p_; }
-    //  Search zipped vertices for tagged src
-    auto lower_itr = thrust::lower_bound(
-      thrust::seq,
-      thrust::make_zip_iterator(current_vertices_.begin(), prev_vertices_.begin()),
-      thrust::make_zip_iterator(current_vertices_.end(), prev_vertices_.end()),
-      tagged_src);
-    auto low_idx = thrust::distance(
-      thrust::make_zip_iterator(current_vertices_.begin(), prev_vertices_.begin()), lower_itr);
-    auto intersection_index_first = intersection_indices_.begin() + intersection_offsets_[low_idx];
-    auto intersection_index_last =
-      intersection_indices_.begin() + intersection_offsets_[low_idx + 1];
-    auto itr =
-      thrust::lower_bound(thrust::seq, intersection_index_first, intersection_index_last, dst);
-    return (itr != intersection_index_last && *itr == dst) ? 1.0 : 1.0 / q_;
-  }
-};
+// node2vec rejection sampling decisions
+constexpr uint8_t node2vec_rejected{0};
+constexpr uint8_t node2vec_accepted{1};
+constexpr uint8_t node2vec_undecided{2};  // requires an edge (previous, candidate) membership test
 
+// The node2vec bias alpha of a candidate step (t -> v -> x) is 1/p if x == t, 1 if x is a neighbor
+// of t, and 1/q otherwise. A candidate drawn uniformly from the neighbors of v is accepted if u <
+// alpha (u is drawn uniformly from [0, max_alpha)). u alone decides the candidate unless u falls
+// between 1 and 1/q.
 template <typename vertex_t, typename weight_t>
-struct node2vec_sample_edges_op_t {
-  template <typename W = weight_t>
-  __device__ std::enable_if_t<std::is_same_v<W, void>, vertex_t> operator()(
-    thrust::tuple<vertex_t, vertex_t> tagged_src,
-    vertex_t dst,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t) const
-  {
-    return dst;
-  }
-
-  template <typename W = weight_t>
-  __device__ std::enable_if_t<!std::is_same_v<W, void>, thrust::tuple<vertex_t, W>> operator()(
-    thrust::tuple<vertex_t, vertex_t> tagged_src,
-    vertex_t dst,
-    cuda::std::nullopt_t,
-    cuda::std::nullopt_t,
-    W w) const
+struct node2vec_accept_op_t {
+  raft::device_span<size_t const> pending_indices{};
+  raft::device_span<vertex_t const> current_vertices{};
+  raft::device_span<vertex_t const> previous_vertices{};
+  raft::device_span<vertex_t const> candidates{};
+  raft::device_span<weight_t const> uniform_randoms{};
+  weight_t return_threshold{};  // 1/p
+  weight_t accept_threshold{};  // min(1, 1/q)
+  weight_t reject_threshold{};  // max(1, 1/q)
+
+  __device__ uint8_t operator()(size_t i) const
   {
-    return thrust::make_tuple(dst, w);
+    auto idx = pending_indices[i];
+    auto v   = current_vertices[idx];
+    auto t   = previous_vertices[idx];
+    auto x   = candidates[i];
+    auto u   = uniform_randoms[i];
+
+    // a dead end or the first step (the previous vertex of a starting vertex is itself)
+    if ((x == invalid_vertex_id<vertex_t>::value) || (t == v)) { return node2vec_accepted; }
+    if (x == t) { return (u < return_threshold) ? node2vec_accepted : node2vec_rejected; }
+    if (u < accept_threshold) { return node2vec_accepted; }
+    if (u >= reject_threshold) { return node2vec_rejected; }
+    return node2vec_undecided;
   }
 };
 
@@ -321,159 +287,282 @@ struct node2vec_selector {
     rmm::device_uvector<typename GraphViewType::vertex_type>&& current_vertices,
     std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>>&& previous_vertices)
   {
-    //  Create vertex frontier
     using vertex_t = typename GraphViewType::vertex_type;
 
-    using tag_t = vertex_t;
+    // Rejection sampling: propose a neighbor uniformly and accept it with probability alpha /
+    // max_alpha (see node2vec_accept_op_t). This avoids computing the biased transition
+    // distribution (which requires intersecting the neighbor lists of the previous and the current
+    // vertices) and only tests edge membership for the proposals u alone cannot decide.
 
-    //  Zip previous and current vertices for nbr_intersection()
-    auto intersection_pairs =
-      thrust::make_zip_iterator(current_vertices.begin(), (*previous_vertices).begin());
+    auto max_alpha = std::max({weight_t{1} / p_, weight_t{1}, weight_t{1} / q_});
 
-    auto [intersection_offsets, intersection_indices] =
-      detail::nbr_intersection(handle,
-                               graph_view,
-                               cugraph::edge_dummy_property_t{}.view(),
-                               intersection_pairs,
-                               intersection_pairs + current_vertices.size(),
-                               std::array<bool, 2>{true, true},
-                               false);
+    rmm::device_uvector<vertex_t> minors(current_vertices.size(), handle.get_stream());
+    detail::scalar_fill(
+      handle, minors.data(), minors.size(), cugraph::invalid_vertex_id<vertex_t>::value);
+    auto weights = edge_weight_view ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                        current_vertices.size(), handle.get_stream())
+                                    : std::nullopt;
+    if (weights) { detail::scalar_fill(handle, weights->data(), weights->size(), weight_t{0}); }
 
-    rmm::device_uvector<size_t> intersection_counts(size_t{0}, handle.get_stream());
-    rmm::device_uvector<size_t> aggregate_offsets(size_t{0}, handle.get_stream());
-    rmm::device_uvector<vertex_t> aggregate_currents(size_t{0}, handle.get_stream());
-    rmm::device_uvector<vertex_t> aggregate_previous(size_t{0}, handle.get_stream());
-    rmm::device_uvector<vertex_t> aggregate_indices(size_t{0}, handle.get_stream());
+    rmm::device_uvector<size_t> pending_indices(current_vertices.size(), handle.get_stream());
+    detail::sequence_fill(
+      handle.get_stream(), pending_indices.data(), pending_indices.size(), size_t{0});
 
-    //  Aggregate intersection data across minor comm
+    rmm::device_uvector<vertex_t> vertex_partition_range_lasts(0, handle.get_stream());
     if constexpr (GraphViewType::is_multi_gpu) {
-      intersection_counts.resize(intersection_offsets.size(), handle.get_stream());
-      thrust::adjacent_difference(handle.get_thrust_policy(),
-                                  intersection_offsets.begin(),
-                                  intersection_offsets.end(),
-                                  intersection_counts.begin());
-
-      auto recv_counts = cugraph::host_scalar_allgather(
-        handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-        current_vertices.size(),
-        handle.get_stream());
+      vertex_partition_range_lasts.resize(graph_view.vertex_partition_range_lasts().size(),
+                                          handle.get_stream());
+      raft::update_device(vertex_partition_range_lasts.data(),
+                          graph_view.vertex_partition_range_lasts().data(),
+                          graph_view.vertex_partition_range_lasts().size(),
+                          handle.get_stream());
+    }
 
-      std::vector<size_t> displacements(recv_counts.size());
-      std::exclusive_scan(recv_counts.begin(), recv_counts.end(), displacements.begin(), size_t{0});
-
-      aggregate_offsets.resize(displacements.back() + recv_counts.back() + 1, handle.get_stream());
-      aggregate_offsets.set_element_to_zero_async(aggregate_offsets.size() - 1,
-                                                  handle.get_stream());
-
-      cugraph::device_allgatherv(handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-                                 intersection_counts.begin() + 1,
-                                 aggregate_offsets.begin(),
-                                 recv_counts,
-                                 displacements,
-                                 handle.get_stream());
-
-      thrust::exclusive_scan(handle.get_thrust_policy(),
-                             aggregate_offsets.begin(),
-                             aggregate_offsets.end(),
-                             aggregate_offsets.begin());
-
-      aggregate_currents.resize(displacements.back() + recv_counts.back(), handle.get_stream());
-
-      cugraph::device_allgatherv(handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-                                 current_vertices.begin(),
-                                 aggregate_currents.begin(),
-                                 recv_counts,
-                                 displacements,
-                                 handle.get_stream());
-
-      aggregate_previous.resize(displacements.back() + recv_counts.back(), handle.get_stream());
-
-      cugraph::device_allgatherv(handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-                                 (*previous_vertices).begin(),
-                                 aggregate_previous.begin(),
-                                 recv_counts,
-                                 displacements,
-                                 handle.get_stream());
-
-      recv_counts = cugraph::host_scalar_allgather(
-        handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-        intersection_offsets.back_element(handle.get_stream()),
-        handle.get_stream());
+    while (true) {
+      auto num_pending = pending_indices.size();
+      if constexpr (GraphViewType::is_multi_gpu) {
+        num_pending = host_scalar_allreduce(
+          handle.get_comms(), num_pending, raft::comms::op_t::SUM, handle.get_stream());
+      }
+      if (num_pending == 0) { break; }
+
+      // 1. propose a candidate for every pending walker
+
+      rmm::device_uvector<vertex_t> pending_vertices(pending_indices.size(), handle.get_stream());
+      thrust::gather(handle.get_thrust_policy(),
+                     pending_indices.begin(),
+                     pending_indices.end(),
+                     current_vertices.begin(),
+                     pending_vertices.begin());
+
+      rmm::device_uvector<vertex_t> candidates(0, handle.get_stream());
+      std::optional<rmm::device_uvector<weight_t>> candidate_weights{std::nullopt};
+      std::tie(candidates, std::ignore, candidate_weights) =
+        uniform_selector<weight_t>{rng_state_}.follow_random_edge(
+          handle,
+          graph_view,
+          edge_weight_view,
+          std::move(pending_vertices),
+          std::optional<rmm::device_uvector<vertex_t>>{std::nullopt});
+
+      rmm::device_uvector<weight_t> uniform_randoms(candidates.size(), handle.get_stream());
+      detail::uniform_random_fill(handle.get_stream(),
+                                  uniform_randoms.data(),
+                                  uniform_randoms.size(),
+                                  weight_t{0},
+                                  max_alpha,
+                                  rng_state_);
+
+      // 2. accept or reject the candidates
+
+      rmm::device_uvector<uint8_t> decisions(candidates.size(), handle.get_stream());
+      thrust::transform(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(candidates.size()),
+        decisions.begin(),
+        node2vec_accept_op_t<vertex_t, weight_t>{
+          raft::device_span<size_t const>(pending_indices.data(), pending_indices.size()),
+          raft::device_span<vertex_t const>(current_vertices.data(), current_vertices.size()),
+          raft::device_span<vertex_t const>((*previous_vertices).data(),
+                                            (*previous_vertices).size()),
+          raft::device_span<vertex_t const>(candidates.data(), candidates.size()),
+          raft::device_span<weight_t const>(uniform_randoms.data(), uniform_randoms.size()),
+          weight_t{1} / p_,
+          std::min(weight_t{1}, weight_t{1} / q_),
+          std::max(weight_t{1}, weight_t{1} / q_)});
+
+      // 3. decide the rest by testing whether (previous vertex, candidate) is an edge
+
+      if (q_ != weight_t{1}) {
+        rmm::device_uvector<size_t> undecided_positions(candidates.size(), handle.get_stream());
+        undecided_positions.resize(
+          thrust::distance(undecided_positions.begin(),
+                           thrust::copy_if(handle.get_thrust_policy(),
+                                           thrust::make_counting_iterator(size_t{0}),
+                                           thrust::make_counting_iterator(candidates.size()),
+                                           decisions.begin(),
+                                           undecided_positions.begin(),
+                                           [] __device__(auto decision) {
+                                             return decision == node2vec_undecided;
+                                           })),
+          handle.get_stream());
+
+        rmm::device_uvector<vertex_t> edge_srcs(undecided_positions.size(), handle.get_stream());
+        rmm::device_uvector<vertex_t> edge_dsts(undecided_positions.size(), handle.get_stream());
+        thrust::transform(
+          handle.get_thrust_policy(),
+          undecided_positions.begin(),
+          undecided_positions.end(),
+          thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin()),
+          [pending_indices   = pending_indices.data(),
+           previous_vertices = (*previous_vertices).data(),
+           candidates        = candidates.data()] __device__(size_t i) {
+            return thrust::make_tuple(previous_vertices[pending_indices[i]], candidates[i]);
+          });
+
+        rmm::device_uvector<bool> edge_flags(0, handle.get_stream());
+        if constexpr (GraphViewType::is_multi_gpu) {
+          auto& comm                 = handle.get_comms();
+          auto const comm_rank       = comm.get_rank();
+          auto const comm_size       = comm.get_size();
+          auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+          auto const major_comm_size = major_comm.get_size();
+          auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+          auto const minor_comm_size = minor_comm.get_size();
+
+          rmm::device_uvector<int> origin_ranks(undecided_positions.size(), handle.get_stream());
+          detail::scalar_fill(handle, origin_ranks.data(), origin_ranks.size(), comm_rank);
+
+          std::forward_as_tuple(std::tie(edge_srcs, edge_dsts, undecided_positions, origin_ranks),
+                                std::ignore) =
+            groupby_gpu_id_and_shuffle_values(
+              comm,
+              thrust::make_zip_iterator(edge_srcs.begin(),
+                                        edge_dsts.begin(),
+                                        undecided_positions.begin(),
+                                        origin_ranks.begin()),
+              thrust::make_zip_iterator(
+                edge_srcs.end(), edge_dsts.end(), undecided_positions.end(), origin_ranks.end()),
+              [key_func =
+                 detail::compute_gpu_id_from_int_edge_endpoints_t<vertex_t>{
+                   raft::device_span<vertex_t const>(vertex_partition_range_lasts.data(),
+                                                     vertex_partition_range_lasts.size()),
+                   comm_size,
+                   major_comm_size,
+                   minor_comm_size}] __device__(auto val) {
+                return key_func(thrust::get<0>(val), thrust::get<1>(val));
+              },
+              handle.get_stream());
 
-      displacements.resize(recv_counts.size());
-      std::exclusive_scan(recv_counts.begin(), recv_counts.end(), displacements.begin(), size_t{0});
+          edge_flags = graph_view.has_edge(
+            handle,
+            raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+            raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
 
-      aggregate_indices.resize(displacements.back() + recv_counts.back(), handle.get_stream());
+          std::forward_as_tuple(std::tie(edge_flags, undecided_positions, origin_ranks),
+                                std::ignore) =
+            groupby_gpu_id_and_shuffle_values(
+              comm,
+              thrust::make_zip_iterator(
+                edge_flags.begin(), undecided_positions.begin(), origin_ranks.begin()),
+              thrust::make_zip_iterator(
+                edge_flags.end(), undecided_positions.end(), origin_ranks.end()),
+              [] __device__(auto val) { return thrust::get<2>(val); },
+              handle.get_stream());
+        } else {
+          edge_flags = graph_view.has_edge(
+            handle,
+            raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+            raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
+        }
+
+        // alpha = 1 for an edge and 1/q otherwise, and u lies in between
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(edge_flags.begin(), undecided_positions.begin()),
+          thrust::make_zip_iterator(edge_flags.end(), undecided_positions.end()),
+          [decisions = decisions.data(), q_greater_than_one = (q_ > weight_t{1})] __device__(
+            auto pair) {
+            decisions[thrust::get<1>(pair)] = (thrust::get<0>(pair) == q_greater_than_one)
+                                                ? node2vec_accepted
+                                                : node2vec_rejected;
+          });
+      }
+
+      // 4. record the accepted candidates, the rejected walkers propose again
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(candidates.size()),
+        [pending_indices   = pending_indices.data(),
+         decisions         = decisions.data(),
+         candidates        = candidates.data(),
+         candidate_weights = candidate_weights ? candidate_weights->data() : nullptr,
+         minors            = minors.data(),
+         weights           = weights ? weights->data() : nullptr] __device__(size_t i) {
+          if (decisions[i] == node2vec_accepted) {
+            minors[pending_indices[i]] = candidates[i];
+            if (weights != nullptr) { weights[pending_indices[i]] = candidate_weights[i]; }
+          }
+        });
 
-      cugraph::device_allgatherv(handle.get_subcomm(cugraph::partition_manager::minor_comm_name()),
-                                 intersection_indices.begin(),
-                                 aggregate_indices.begin(),
-                                 recv_counts,
-                                 displacements,
-                                 handle.get_stream());
+      pending_indices.resize(
+        thrust::distance(pending_indices.begin(),
+                         thrust::remove_if(handle.get_thrust_policy(),
+                                           pending_indices.begin(),
+                                           pending_indices.end(),
+                                           decisions.begin(),
+                                           [] __device__(auto decision) {
+                                             return decision == node2vec_accepted;
+                                           })),
+        handle.get_stream());
     }
 
+    *previous_vertices = std::move(current_vertices);
+
+    return std::make_tuple(std::move(minors), std::move(previous_vertices), std::move(weights));
+  }
+};
+
+// All the walkers advance in lockstep in random_walk_impl, so the i'th call to follow_random_edge
+// computes the i'th step of every walk. This samples one outgoing edge of type metapath_[i] per
+// walker using per-type (heterogeneous) sampling with K = 1 for the required type and 0 for the
+// others (the edges of the other types are never selected).
+template <typename edge_t, typename weight_t, typename edge_type_t>
+struct metapath_selector {
+  raft::random::RngState& rng_state_;
+  edge_property_view_t<edge_t, edge_type_t const*> edge_type_view_;
+  std::vector<edge_type_t> metapath_;
+  size_t num_edge_types_;
+  size_t step_{0};
+  static constexpr bool is_second_order_ = false;
+
+  template <typename GraphViewType>
+  std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+             std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>>,
+             std::optional<rmm::device_uvector<weight_t>>>
+  follow_random_edge(
+    raft::handle_t const& handle,
+    GraphViewType const& graph_view,
+    std::optional<edge_property_view_t<typename GraphViewType::edge_type, weight_t const*>>
+      edge_weight_view,
+    rmm::device_uvector<typename GraphViewType::vertex_type>&& current_vertices,
+    std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>>&& previous_vertices)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    using tag_t = void;
+
+    std::vector<size_t> Ks(num_edge_types_, size_t{0});
+    Ks[metapath_[step_]] = size_t{1};
+    ++step_;
+
     cugraph::vertex_frontier_t<vertex_t, tag_t, GraphViewType::is_multi_gpu, false> vertex_frontier(
       handle, 1);
-    vertex_frontier.bucket(0).insert(
-      thrust::make_zip_iterator(current_vertices.begin(), (*previous_vertices).begin()),
-      thrust::make_zip_iterator(current_vertices.end(), (*previous_vertices).end()));
 
-    // Create data structs for results
+    vertex_frontier.bucket(0).insert(current_vertices.begin(), current_vertices.end());
+
     rmm::device_uvector<vertex_t> minors(0, handle.get_stream());
     std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
-
     if (edge_weight_view) {
       auto [sample_offsets, sample_e_op_results] =
         cugraph::per_v_random_select_transform_outgoing_e(
           handle,
           graph_view,
           vertex_frontier.bucket(0),
-          cugraph::edge_src_dummy_property_t{}.view(),
-          cugraph::edge_dst_dummy_property_t{}.view(),
-          *edge_weight_view,
-          GraphViewType::is_multi_gpu
-            ? node2vec_random_walk_e_bias_op_t<vertex_t,
-                                               weight_t,
-                                               weight_t>{p_,
-                                                         q_,
-                                                         raft::device_span<size_t const>(
-                                                           aggregate_offsets.data(),
-                                                           aggregate_offsets.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_indices.data(),
-                                                           aggregate_indices.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_currents.data(),
-                                                           aggregate_currents.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_previous.data(),
-                                                           aggregate_previous.size())}
-            : node2vec_random_walk_e_bias_op_t<vertex_t,
-                                               weight_t,
-                                               weight_t>{p_,
-                                                         q_,
-                                                         raft::device_span<size_t const>(
-                                                           intersection_offsets.data(),
-                                                           intersection_offsets.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           intersection_indices.data(),
-                                                           intersection_indices.size()),
-                                                         raft::device_span<
-                                                           vertex_t const>(current_vertices.data(),
-                                                                           current_vertices.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           (*previous_vertices).data(),
-                                                           (*previous_vertices).size())},
-          cugraph::edge_src_dummy_property_t{}.view(),
-          cugraph::edge_dst_dummy_property_t{}.view(),
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
           *edge_weight_view,
-          node2vec_sample_edges_op_t<vertex_t, weight_t>{},
+          sample_edges_op_t<vertex_t, weight_t>{},
+          edge_type_view_,
           rng_state_,
-          size_t{1},
+          raft::host_span<size_t const>(Ks.data(), Ks.size()),
           true,
-          std::make_optional(thrust::make_tuple(
-            vertex_t{cugraph::invalid_vertex_id<vertex_t>::value}, weight_t{0.0})));
+          std::make_optional(
+            thrust::make_tuple(cugraph::invalid_vertex_id<vertex_t>::value, weight_t{0.0})));
+
       minors  = std::move(std::get<0>(sample_e_op_results));
       weights = std::move(std::get<1>(sample_e_op_results));
     } else {
@@ -482,55 +571,18 @@ struct node2vec_selector {
           handle,
           graph_view,
           vertex_frontier.bucket(0),
-          cugraph::edge_src_dummy_property_t{}.view(),
-          cugraph::edge_dst_dummy_property_t{}.view(),
-          cugraph::edge_dummy_property_t{}.view(),
-          GraphViewType::is_multi_gpu
-            ? node2vec_random_walk_e_bias_op_t<vertex_t,
-                                               weight_t,
-                                               weight_t>{p_,
-                                                         q_,
-                                                         raft::device_span<size_t const>(
-                                                           aggregate_offsets.data(),
-                                                           aggregate_offsets.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_indices.data(),
-                                                           aggregate_indices.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_currents.data(),
-                                                           aggregate_currents.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           aggregate_previous.data(),
-                                                           aggregate_previous.size())}
-            : node2vec_random_walk_e_bias_op_t<vertex_t,
-                                               weight_t,
-                                               weight_t>{p_,
-                                                         q_,
-                                                         raft::device_span<size_t const>(
-                                                           intersection_offsets.data(),
-                                                           intersection_offsets.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           intersection_indices.data(),
-                                                           intersection_indices.size()),
-                                                         raft::device_span<
-                                                           vertex_t const>(current_vertices.data(),
-                                                                           current_vertices.size()),
-                                                         raft::device_span<vertex_t const>(
-                                                           (*previous_vertices).data(),
-                                                           (*previous_vertices).size())},
-          cugraph::edge_src_dummy_property_t{}.view(),
-          cugraph::edge_dst_dummy_property_t{}.view(),
-          cugraph::edge_dummy_property_t{}.view(),
-          node2vec_sample_edges_op_t<vertex_t, void>{},
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
+          edge_dummy_property_t{}.view(),
+          sample_edges_op_t<vertex_t, void>{},
+          edge_type_view_,
           rng_state_,
-          size_t{1},
+          raft::host_span<size_t const>(Ks.data(), Ks.size()),
           true,
           std::make_optional(vertex_t{cugraph::invalid_vertex_id<vertex_t>::value}));
+
       minors = std::move(sample_e_op_results);
     }
-
-    *previous_vertices = std::move(current_vertices);
-
     return std::make_tuple(std::move(minors), std::move(previous_vertices), std::move(weights));
   }
 };
@@ -652,28 +704,6 @@ random_walk_impl(raft::handle_t const& handle,
       }
     }
 
-    //  Sort for nbr_intersection, must sort all together
-    if (previous_vertices) {
-      if constexpr (multi_gpu) {
-        thrust::sort(handle.get_thrust_policy(),
-                     thrust::make_zip_iterator(current_vertices.begin(),
-                                               (*previous_vertices).begin(),
-                                               current_position.begin(),
-                                               current_gpu.begin()),
-                     thrust::make_zip_iterator(current_vertices.end(),
-                                               (*previous_vertices).end(),
-                                               current_position.end(),
-                                               current_gpu.end()));
-      } else {
-        thrust::sort(
-          handle.get_thrust_policy(),
-          thrust::make_zip_iterator(
-            current_vertices.begin(), (*previous_vertices).begin(), current_position.begin()),
-          thrust::make_zip_iterator(
-            current_vertices.end(), (*previous_vertices).end(), current_position.end()));
-      }
-    }
-
     std::tie(current_vertices, previous_vertices, new_weights) =
       random_selector.follow_random_edge(handle,
                                          graph_view,
@@ -930,6 +960,573 @@ random_walk_impl(raft::handle_t const& handle,
   return std::make_tuple(std::move(result_vertices), std::move(result_weights));
 }
 
+int32_t constexpr compacted_random_walks_kernel_block_size = 128;
+
+// every thread advances a walker max_length steps (or until the walker reaches a vertex without
+// an outgoing edge) in a single kernel launch. The random numbers of the i'th walker are drawn from
+// the i'th subsequence, so the same paths are visited if the kernel is launched again with the same
+// device state; this is used to first compute the path lengths (compute_path_lengths = true) and
+// then to store the paths in the compacted (CSR-like) output (compute_path_lengths = false).
+template <bool compute_path_lengths, typename vertex_t, typename edge_t, typename weight_t>
+__global__ static void compacted_uniform_random_walks_kernel(
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition,
+  weight_t const* edge_weights /* nullptr if unweighted */,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length,
+  raft::random::DeviceState<raft::random::PCGenerator> device_state,
+  raft::device_span<size_t> path_offsets /* path lengths if compute_path_lengths is true */,
+  vertex_t* path_vertices,
+  weight_t* path_weights)
+{
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  while (idx < start_vertices.size()) {
+    raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(idx));
+
+    auto v = start_vertices[idx];
+    size_t vertex_first{0};
+    size_t weight_first{0};
+    if constexpr (!compute_path_lengths) {
+      vertex_first                = path_offsets[idx];
+      weight_first                = vertex_first - idx;  // # edges = # vertices - 1 in each path
+      path_vertices[vertex_first] = v;
+    }
+
+    size_t length{1};
+    while (length <= max_length) {
+      auto local_edges =
+        edge_partition.local_edges(edge_partition.major_offset_from_major_nocheck(v));
+      auto indices      = thrust::get<0>(local_edges);
+      auto edge_offset  = thrust::get<1>(local_edges);
+      auto local_degree = thrust::get<2>(local_edges);
+      if (local_degree == 0) { break; }
+      double r{};
+      gen.next(r);
+      auto nbr_idx = static_cast<edge_t>(r * static_cast<double>(local_degree));
+      nbr_idx      = nbr_idx < local_degree ? nbr_idx : local_degree - 1;  // rounding guard
+      v            = indices[nbr_idx];
+      if constexpr (!compute_path_lengths) {
+        path_vertices[vertex_first + length] = v;
+        if (edge_weights != nullptr) {
+          path_weights[weight_first + (length - 1)] = edge_weights[edge_offset + nbr_idx];
+        }
+      }
+      ++length;
+    }
+    if constexpr (compute_path_lengths) { path_offsets[idx] = length; }
+
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_uniform_random_walk_impl(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length)
+{
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+  weight_t const* edge_weights = edge_weight_view ? (*edge_weight_view).value_firsts()[0] : nullptr;
+
+  rmm::device_uvector<size_t> path_offsets(start_vertices.size() + 1, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_vertices(0, handle.get_stream());
+  auto path_weights = edge_weight_view
+                        ? std::make_optional<rmm::device_uvector<weight_t>>(0, handle.get_stream())
+                        : std::nullopt;
+
+  if (start_vertices.size() == 0) {
+    detail::scalar_fill(handle, path_offsets.data(), path_offsets.size(), size_t{0});
+    return std::make_tuple(
+      std::move(path_offsets), std::move(path_vertices), std::move(path_weights));
+  }
+
+  raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+  raft::grid_1d_thread_t update_grid(start_vertices.size(),
+                                     compacted_random_walks_kernel_block_size,
+                                     handle.get_device_properties().maxGridSize[0]);
+
+  // 1. compute the path lengths
+
+  compacted_uniform_random_walks_kernel<true, vertex_t, edge_t, weight_t>
+    <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+      edge_partition,
+      edge_weights,
+      start_vertices,
+      max_length,
+      device_state,
+      raft::device_span<size_t>(path_offsets.data() + 1, start_vertices.size()),
+      static_cast<vertex_t*>(nullptr),
+      static_cast<weight_t*>(nullptr));
+  path_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         path_offsets.begin() + 1,
+                         path_offsets.end(),
+                         path_offsets.begin() + 1);
+
+  // 2. re-walk the same paths and store the visited vertices (and the weights of the traversed
+  // edges)
+
+  auto num_path_vertices = path_offsets.back_element(handle.get_stream());
+  path_vertices.resize(num_path_vertices, handle.get_stream());
+  if (path_weights) {
+    (*path_weights).resize(num_path_vertices - start_vertices.size(), handle.get_stream());
+  }
+
+  compacted_uniform_random_walks_kernel<false, vertex_t, edge_t, weight_t>
+    <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+      edge_partition,
+      edge_weights,
+      start_vertices,
+      max_length,
+      device_state,
+      raft::device_span<size_t>(path_offsets.data(), path_offsets.size()),
+      path_vertices.data(),
+      path_weights ? (*path_weights).data() : static_cast<weight_t*>(nullptr));
+
+  rng_state.advance(start_vertices.size());
+
+  return std::make_tuple(
+    std::move(path_offsets), std::move(path_vertices), std::move(path_weights));
+}
+
+// compacted_uniform_random_walks_kernel restricted to the outgoing edges of type metapath[k] in the
+// k'th step, the candidate edges are read from the edge type index
+template <bool compute_path_lengths,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t>
+__global__ static void compacted_metapath_random_walks_kernel(
+  edge_partition_device_view_t<vertex_t, edge_t, false> edge_partition,
+  edge_partition_edge_type_index_device_view_t<vertex_t, edge_t, edge_type_t> edge_type_index,
+  weight_t const* edge_weights /* nullptr if unweighted */,
+  raft::device_span<vertex_t const> start_vertices,
+  raft::device_span<edge_type_t const> metapath,
+  raft::random::DeviceState<raft::random::PCGenerator> device_state,
+  raft::device_span<size_t> path_offsets /* path lengths if compute_path_lengths is true */,
+  vertex_t* path_vertices,
+  weight_t* path_weights)
+{
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  while (idx < start_vertices.size()) {
+    raft::random::PCGenerator gen(device_state, static_cast<uint64_t>(idx));
+
+    auto v = start_vertices[idx];
+    size_t vertex_first{0};
+    size_t weight_first{0};
+    if constexpr (!compute_path_lengths) {
+      vertex_first                = path_offsets[idx];
+      weight_first                = vertex_first - idx;  // # edges = # vertices - 1 in each path
+      path_vertices[vertex_first] = v;
+    }
+
+    size_t length{1};
+    while (length <= metapath.size()) {
+      auto local_edges = edge_type_index.local_edges(
+        edge_partition.major_offset_from_major_nocheck(v), metapath[length - 1]);
+      auto edge_indices = thrust::get<0>(local_edges);
+      auto local_degree = thrust::get<1>(local_edges);
+      if (local_degree == 0) { break; }
+      double r{};
+      gen.next(r);
+      auto nbr_idx = static_cast<edge_t>(r * static_cast<double>(local_degree));
+      nbr_idx      = nbr_idx < local_degree ? nbr_idx : local_degree - 1;  // rounding guard
+      auto local_edge_idx = edge_indices[nbr_idx];
+      v                   = edge_partition.indices()[local_edge_idx];
+      if constexpr (!compute_path_lengths) {
+        path_vertices[vertex_first + length] = v;
+        if (edge_weights != nullptr) {
+          path_weights[weight_first + (length - 1)] = edge_weights[local_edge_idx];
+        }
+      }
+      ++length;
+    }
+    if constexpr (compute_path_lengths) { path_offsets[idx] = length; }
+
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+template <typename edge_type_t>
+struct is_invalid_metapath_edge_type_t {
+  edge_type_t num_edge_types{};
+
+  __device__ bool operator()(edge_type_t type) const
+  {
+    return (type < edge_type_t{0}) || (type >= num_edge_types);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_metapath_random_walk_impl(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t> edge_type_index_view,
+  raft::device_span<vertex_t const> start_vertices,
+  raft::device_span<edge_type_t const> metapath)
+{
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, false>(graph_view.local_edge_partition_view(0));
+  weight_t const* edge_weights = edge_weight_view ? (*edge_weight_view).value_firsts()[0] : nullptr;
+
+  CUGRAPH_EXPECTS(
+    (edge_type_index_view.number_of_edges() == edge_partition.number_of_edges()) &&
+      (edge_type_index_view.type_offsets().size() ==
+       static_cast<size_t>(graph_view.local_vertex_partition_range_size()) *
+           static_cast<size_t>(edge_type_index_view.number_of_edge_types()) +
+         1),
+    "Invalid input argument: edge_type_index_view does not match with graph_view.");
+  CUGRAPH_EXPECTS(
+    thrust::count_if(
+      handle.get_thrust_policy(),
+      metapath.begin(),
+      metapath.end(),
+      is_invalid_metapath_edge_type_t<edge_type_t>{edge_type_index_view.number_of_edge_types()}) ==
+      0,
+    "Invalid input argument: metapath edge types should be in [0, number_of_edge_types()).");
+
+  rmm::device_uvector<size_t> path_offsets(start_vertices.size() + 1, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_vertices(0, handle.get_stream());
+  auto path_weights = edge_weight_view
+                        ? std::make_optional<rmm::device_uvector<weight_t>>(0, handle.get_stream())
+                        : std::nullopt;
+
+  if (start_vertices.size() == 0) {
+    detail::scalar_fill(handle, path_offsets.data(), path_offsets.size(), size_t{0});
+    return std::make_tuple(
+      std::move(path_offsets), std::move(path_vertices), std::move(path_weights));
+  }
+
+  edge_partition_edge_type_index_device_view_t<vertex_t, edge_t, edge_type_t> edge_type_index(
+    edge_type_index_view);
+
+  raft::random::DeviceState<raft::random::PCGenerator> device_state(rng_state);
+  raft::grid_1d_thread_t update_grid(start_vertices.size(),
+                                     compacted_random_walks_kernel_block_size,
+                                     handle.get_device_properties().maxGridSize[0]);
+
+  // 1. compute the path lengths
+
+  compacted_metapath_random_walks_kernel<true, vertex_t, edge_t, weight_t, edge_type_t>
+    <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+      edge_partition,
+      edge_type_index,
+      edge_weights,
+      start_vertices,
+      metapath,
+      device_state,
+      raft::device_span<size_t>(path_offsets.data() + 1, start_vertices.size()),
+      static_cast<vertex_t*>(nullptr),
+      static_cast<weight_t*>(nullptr));
+  path_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         path_offsets.begin() + 1,
+                         path_offsets.end(),
+                         path_offsets.begin() + 1);
+
+  // 2. re-walk the same paths and store the visited vertices (and the weights of the traversed
+  // edges)
+
+  auto num_path_vertices = path_offsets.back_element(handle.get_stream());
+  path_vertices.resize(num_path_vertices, handle.get_stream());
+  if (path_weights) {
+    (*path_weights).resize(num_path_vertices - start_vertices.size(), handle.get_stream());
+  }
+
+  compacted_metapath_random_walks_kernel<false, vertex_t, edge_t, weight_t, edge_type_t>
+    <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+      edge_partition,
+      edge_type_index,
+      edge_weights,
+      start_vertices,
+      metapath,
+      device_state,
+      raft::device_span<size_t>(path_offsets.data(), path_offsets.size()),
+      path_vertices.data(),
+      path_weights ? (*path_weights).data() : static_cast<weight_t*>(nullptr));
+
+  rng_state.advance(start_vertices.size());
+
+  return std::make_tuple(
+    std::move(path_offsets), std::move(path_vertices), std::move(path_weights));
+}
+
+// Merge the visits of one step (one (seed index, vertex) key per walker) into the visit counts
+inline void accumulate_visit_counts(raft::handle_t const& handle,
+                                    rmm::device_uvector<size_t>&& keys,
+                                    kv_store_t<size_t, size_t, false>& visit_counts)
+{
+  thrust::sort(handle.get_thrust_policy(), keys.begin(), keys.end());
+
+  rmm::device_uvector<size_t> unique_keys(keys.size(), handle.get_stream());
+  rmm::device_uvector<size_t> counts(keys.size(), handle.get_stream());
+  auto pair_last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                         keys.begin(),
+                                         keys.end(),
+                                         thrust::make_constant_iterator(size_t{1}),
+                                         unique_keys.begin(),
+                                         counts.begin());
+  auto num_unique_keys =
+    static_cast<size_t>(thrust::distance(unique_keys.begin(), pair_last.first));
+  keys.resize(0, handle.get_stream());
+  keys.shrink_to_fit(handle.get_stream());
+  unique_keys.resize(num_unique_keys, handle.get_stream());
+  counts.resize(num_unique_keys, handle.get_stream());
+
+  if (visit_counts.size() + num_unique_keys > visit_counts.capacity()) {
+    auto new_capacity =
+      std::max(visit_counts.capacity() * 2, visit_counts.size() + num_unique_keys);
+    auto invalid_key            = visit_counts.invalid_key();
+    auto [old_keys, old_counts] = visit_counts.release(handle.get_stream());
+    visit_counts                = kv_store_t<size_t, size_t, false>(
+      new_capacity, invalid_key, visit_counts.invalid_value(), handle.get_stream());
+    visit_counts.insert(old_keys.begin(), old_keys.end(), old_counts.begin(), handle.get_stream());
+  }
+
+  // missing keys return the invalid value (0)
+  rmm::device_uvector<size_t> old_counts(num_unique_keys, handle.get_stream());
+  visit_counts.view().find(
+    unique_keys.begin(), unique_keys.end(), old_counts.begin(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    counts.begin(),
+                    counts.end(),
+                    old_counts.begin(),
+                    counts.begin(),
+                    thrust::plus<size_t>{});
+  visit_counts.insert_and_assign(
+    unique_keys.begin(), unique_keys.end(), counts.begin(), handle.get_stream());
+}
+
+// Walkers are (current vertex, seed vertex, global seed index) triplets. Visits are keyed by seed
+// index * V + vertex; in multi-GPU, walkers are shuffled to the owner of their current vertex
+// before each step, so every key is counted on a single GPU.
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu,
+          typename random_selector_t>
+std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  monte_carlo_personalized_pagerank_impl(
+    raft::handle_t const& handle,
+    raft::random::RngState& rng_state,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> seeds,
+    size_t num_walks_per_seed,
+    weight_t alpha,
+    size_t max_length,
+    random_selector_t random_selector)
+{
+  auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+
+  std::vector<size_t> h_seed_displacements{0, seeds.size()};
+  if constexpr (multi_gpu) {
+    auto seed_counts =
+      host_scalar_allgather(handle.get_comms(), seeds.size(), handle.get_stream());
+    h_seed_displacements.resize(seed_counts.size() + 1);
+    std::inclusive_scan(
+      seed_counts.begin(), seed_counts.end(), h_seed_displacements.begin() + 1);
+  }
+  size_t seed_first{0};  // global index of seeds[0]
+  if constexpr (multi_gpu) { seed_first = h_seed_displacements[handle.get_comms().get_rank()]; }
+  auto num_global_seeds = h_seed_displacements.back();
+
+  CUGRAPH_EXPECTS(
+    (num_global_seeds == 0) ||
+      (num_vertices < (std::numeric_limits<size_t>::max() - 1) / num_global_seeds),
+    "Invalid input argument: too many seeds, (seed, vertex) pairs overflow size_t.");
+
+  auto num_walkers = seeds.size() * num_walks_per_seed;
+  rmm::device_uvector<vertex_t> current_vertices(num_walkers, handle.get_stream());
+  rmm::device_uvector<vertex_t> seed_vertices(num_walkers, handle.get_stream());
+  rmm::device_uvector<size_t> seed_indices(num_walkers, handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(seed_vertices.begin(), seed_indices.begin()),
+    thrust::make_zip_iterator(seed_vertices.end(), seed_indices.end()),
+    [seeds, num_walks_per_seed, seed_first] __device__(size_t i) {
+      auto idx = i / num_walks_per_seed;
+      return thrust::make_tuple(seeds[idx], seed_first + idx);
+    });
+  raft::copy(
+    current_vertices.data(), seed_vertices.data(), seed_vertices.size(), handle.get_stream());
+
+  // counts are never 0, so 0 can be the invalid value
+  kv_store_t<size_t, size_t, false> visit_counts(
+    num_walkers, std::numeric_limits<size_t>::max(), size_t{0}, handle.get_stream());
+
+  rmm::device_uvector<vertex_t> vertex_partition_range_lasts(
+    graph_view.vertex_partition_range_lasts().size(), handle.get_stream());
+  raft::update_device(vertex_partition_range_lasts.data(),
+                      graph_view.vertex_partition_range_lasts().data(),
+                      graph_view.vertex_partition_range_lasts().size(),
+                      handle.get_stream());
+
+  for (size_t level = 0; true; ++level) {
+    if constexpr (multi_gpu) {
+      auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      auto const minor_comm_size = minor_comm.get_size();
+
+      std::forward_as_tuple(std::tie(current_vertices, seed_vertices, seed_indices),
+                            std::ignore) =
+        cugraph::groupby_gpu_id_and_shuffle_values(
+          handle.get_comms(),
+          thrust::make_zip_iterator(
+            current_vertices.begin(), seed_vertices.begin(), seed_indices.begin()),
+          thrust::make_zip_iterator(
+            current_vertices.end(), seed_vertices.end(), seed_indices.end()),
+          [key_func =
+             cugraph::detail::compute_gpu_id_from_int_vertex_t<vertex_t>{
+               {vertex_partition_range_lasts.begin(), vertex_partition_range_lasts.size()},
+               major_comm_size,
+               minor_comm_size}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+          handle.get_stream());
+    }
+
+    rmm::device_uvector<size_t> keys(current_vertices.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      current_vertices.begin(),
+                      current_vertices.end(),
+                      seed_indices.begin(),
+                      keys.begin(),
+                      [num_vertices] __device__(vertex_t v, size_t seed_idx) {
+                        return seed_idx * num_vertices + static_cast<size_t>(v);
+                      });
+    accumulate_visit_counts(handle, std::move(keys), visit_counts);
+
+    if (level == max_length) { break; }
+
+    // stop with probability 1 - alpha
+    rmm::device_uvector<weight_t> randoms(current_vertices.size(), handle.get_stream());
+    detail::uniform_random_fill(handle.get_stream(),
+                                randoms.data(),
+                                randoms.size(),
+                                weight_t{0},
+                                weight_t{1},
+                                rng_state);
+    auto walker_first = thrust::make_zip_iterator(
+      current_vertices.begin(), seed_vertices.begin(), seed_indices.begin());
+    auto num_active_walkers = static_cast<size_t>(thrust::distance(
+      walker_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        walker_first,
+                        walker_first + current_vertices.size(),
+                        randoms.begin(),
+                        [alpha] __device__(weight_t r) { return r >= alpha; })));
+    randoms.resize(0, handle.get_stream());
+    randoms.shrink_to_fit(handle.get_stream());
+    current_vertices.resize(num_active_walkers, handle.get_stream());
+    seed_vertices.resize(num_active_walkers, handle.get_stream());
+    seed_indices.resize(num_active_walkers, handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      num_active_walkers = host_scalar_allreduce(
+        handle.get_comms(), num_active_walkers, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_active_walkers == 0) { break; }
+
+    current_vertices = std::get<0>(random_selector.follow_random_edge(
+      handle,
+      graph_view,
+      edge_weight_view,
+      std::move(current_vertices),
+      std::optional<rmm::device_uvector<vertex_t>>{std::nullopt}));
+
+    // a walker at a vertex without out-going edges jumps back to its seed
+    thrust::transform(handle.get_thrust_policy(),
+                      current_vertices.begin(),
+                      current_vertices.end(),
+                      seed_vertices.begin(),
+                      current_vertices.begin(),
+                      [] __device__(vertex_t v, vertex_t seed) {
+                        return (v == cugraph::invalid_vertex_id<vertex_t>::value) ? seed : v;
+                      });
+  }
+
+  current_vertices.resize(0, handle.get_stream());
+  current_vertices.shrink_to_fit(handle.get_stream());
+  seed_vertices.resize(0, handle.get_stream());
+  seed_vertices.shrink_to_fit(handle.get_stream());
+  seed_indices.resize(0, handle.get_stream());
+  seed_indices.shrink_to_fit(handle.get_stream());
+
+  auto [keys, counts] = visit_counts.release(handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    // send the counts back to the GPU of their seed
+    rmm::device_uvector<size_t> d_seed_displacements(h_seed_displacements.size(),
+                                                     handle.get_stream());
+    raft::update_device(d_seed_displacements.data(),
+                        h_seed_displacements.data(),
+                        h_seed_displacements.size(),
+                        handle.get_stream());
+
+    std::forward_as_tuple(std::tie(keys, counts), std::ignore) =
+      cugraph::groupby_gpu_id_and_shuffle_values(
+        handle.get_comms(),
+        thrust::make_zip_iterator(keys.begin(), counts.begin()),
+        thrust::make_zip_iterator(keys.end(), counts.end()),
+        [displacements = raft::device_span<size_t const>(d_seed_displacements.data(),
+                                                         d_seed_displacements.size()),
+         num_vertices] __device__(auto val) {
+          auto seed_idx = thrust::get<0>(val) / num_vertices;
+          return static_cast<int>(thrust::distance(
+            displacements.begin() + 1,
+            thrust::upper_bound(
+              thrust::seq, displacements.begin() + 1, displacements.end(), seed_idx)));
+        },
+        handle.get_stream());
+  }
+
+  thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), counts.begin());
+
+  rmm::device_uvector<size_t> offsets(seeds.size() + 1, handle.get_stream());
+  thrust::lower_bound(
+    handle.get_thrust_policy(),
+    keys.begin(),
+    keys.end(),
+    thrust::make_transform_iterator(
+      thrust::make_counting_iterator(seed_first),
+      cuda::proclaim_return_type<size_t>(
+        [num_vertices] __device__(size_t seed_idx) { return seed_idx * num_vertices; })),
+    thrust::make_transform_iterator(
+      thrust::make_counting_iterator(seed_first + offsets.size()),
+      cuda::proclaim_return_type<size_t>(
+        [num_vertices] __device__(size_t seed_idx) { return seed_idx * num_vertices; })),
+    offsets.begin());
+
+  rmm::device_uvector<vertex_t> vertices(keys.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> scores(keys.size(), handle.get_stream());
+  auto scale = (weight_t{1} - alpha) / static_cast<weight_t>(num_walks_per_seed);
+  thrust::transform(handle.get_thrust_policy(),
+                    thrust::make_zip_iterator(keys.begin(), counts.begin()),
+                    thrust::make_zip_iterator(keys.end(), counts.end()),
+                    thrust::make_zip_iterator(vertices.begin(), scores.begin()),
+                    [num_vertices, scale] __device__(auto pair) {
+                      return thrust::make_tuple(
+                        static_cast<vertex_t>(thrust::get<0>(pair) % num_vertices),
+                        static_cast<weight_t>(thrust::get<1>(pair)) * scale);
+                    });
+
+  return std::make_tuple(std::move(offsets), std::move(vertices), std::move(scores));
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -992,4 +1589,128 @@ node2vec_random_walks(raft::handle_t const& handle,
                                   detail::node2vec_selector<weight_t>{p, q, rng_state});
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+metapath_random_walks(raft::handle_t const& handle,
+                      raft::random::RngState& rng_state,
+                      graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                      std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                      edge_property_view_t<edge_t, edge_type_t const*> edge_type_view,
+                      edge_type_t num_edge_types,
+                      raft::device_span<vertex_t const> start_vertices,
+                      raft::device_span<edge_type_t const> metapath)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS(num_edge_types > edge_type_t{0},
+                  "Invalid input argument: num_edge_types should be positive.");
+  CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                   metapath.begin(),
+                                   metapath.end(),
+                                   detail::is_invalid_metapath_edge_type_t<edge_type_t>{
+                                     num_edge_types}) == 0,
+                  "Invalid input argument: metapath edge types should be in [0, num_edge_types).");
+
+  std::vector<edge_type_t> h_metapath(metapath.size());
+  raft::update_host(h_metapath.data(), metapath.data(), metapath.size(), handle.get_stream());
+  handle.sync_stream();
+
+  auto max_length = h_metapath.size();
+  return detail::random_walk_impl(
+    handle,
+    graph_view,
+    edge_weight_view,
+    start_vertices,
+    max_length,
+    detail::metapath_selector<edge_t, weight_t, edge_type_t>{
+      rng_state, edge_type_view, std::move(h_metapath), static_cast<size_t>(num_edge_types)});
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_uniform_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_length)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  return detail::compacted_uniform_random_walk_impl(
+    handle, rng_state, graph_view, edge_weight_view, start_vertices, max_length);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_type_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+compacted_metapath_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  edge_partition_edge_type_index_view_t<vertex_t, edge_t, edge_type_t> edge_type_index_view,
+  raft::device_span<vertex_t const> start_vertices,
+  raft::device_span<edge_type_t const> metapath)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  return detail::compacted_metapath_random_walk_impl(handle,
+                                                     rng_state,
+                                                     graph_view,
+                                                     edge_weight_view,
+                                                     edge_type_index_view,
+                                                     start_vertices,
+                                                     metapath);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
+  monte_carlo_personalized_pagerank(
+    raft::handle_t const& handle,
+    raft::random::RngState& rng_state,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    raft::device_span<vertex_t const> seeds,
+    size_t num_walks_per_seed,
+    weight_t alpha,
+    size_t max_length)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha < 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0).");
+
+  if (edge_weight_view) {
+    return detail::monte_carlo_personalized_pagerank_impl(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      seeds,
+      num_walks_per_seed,
+      alpha,
+      max_length,
+      detail::biased_selector<weight_t>{rng_state});
+  } else {
+    return detail::monte_carlo_personalized_pagerank_impl(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      seeds,
+      num_walks_per_seed,
+      alpha,
+      max_length,
+      detail::uniform_selector<weight_t>{rng_state});
+  }
+}
+
 }  // namespace cugraph
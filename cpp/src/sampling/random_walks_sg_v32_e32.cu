@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -72,4 +72,94 @@ node2vec_random_walks(raft::handle_t const& handle,
                       double p,
                       double q);
 
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<float>>>
+metapath_random_walks(raft::handle_t const& handle,
+                      raft::random::RngState& rng_state,
+                      graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                      std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+                      edge_property_view_t<int32_t, int32_t const*> edge_type_view,
+                      int32_t num_edge_types,
+                      raft::device_span<int32_t const> start_vertices,
+                      raft::device_span<int32_t const> metapath);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<double>>>
+metapath_random_walks(raft::handle_t const& handle,
+                      raft::random::RngState& rng_state,
+                      graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                      std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+                      edge_property_view_t<int32_t, int32_t const*> edge_type_view,
+                      int32_t num_edge_types,
+                      raft::device_span<int32_t const> start_vertices,
+                      raft::device_span<int32_t const> metapath);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>>
+compacted_uniform_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>>
+compacted_uniform_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_length);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>>
+compacted_metapath_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  edge_partition_edge_type_index_view_t<int32_t, int32_t, int32_t> edge_type_index_view,
+  raft::device_span<int32_t const> start_vertices,
+  raft::device_span<int32_t const> metapath);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>>
+compacted_metapath_random_walks(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  edge_partition_edge_type_index_view_t<int32_t, int32_t, int32_t> edge_type_index_view,
+  raft::device_span<int32_t const> start_vertices,
+  raft::device_span<int32_t const> metapath);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<float>>
+  monte_carlo_personalized_pagerank(
+    raft::handle_t const& handle,
+    raft::random::RngState& rng_state,
+    graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+    std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+    raft::device_span<int32_t const> seeds,
+    size_t num_walks_per_seed,
+    float alpha,
+    size_t max_length);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+  monte_carlo_personalized_pagerank(
+    raft::handle_t const& handle,
+    raft::random::RngState& rng_state,
+    graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+    std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+    raft::device_span<int32_t const> seeds,
+    size_t num_walks_per_seed,
+    double alpha,
+    size_t max_length);
+
 }  // namespace cugraph
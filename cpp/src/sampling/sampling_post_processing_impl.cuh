@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "prims/key_store.cuh"
 #include "prims/kv_store.cuh"
 
 #include <cugraph/sampling_functions.hpp>
@@ -28,6 +29,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/atomic>
 #include <cuda/functional>
 #include <cuda/std/optional>
 #include <thrust/binary_search.h>
@@ -37,6 +39,7 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/merge.h>
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
@@ -44,6 +47,7 @@
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
+#include <limits>
 #include <optional>
 
 namespace cugraph {
@@ -157,6 +161,61 @@ struct optionally_compute_label_index_t {
   }
 };
 
+// hash based alternative to sorting every (key, hop) pair: the unique keys are collected in a hash
+// set, only the unique keys are sorted, and the minimum hop of each unique key (if @p hops is
+// valid) is reduced with atomics; returns the sorted unique keys and their minimum hops
+template <typename key_t, typename KeyIterator>
+std::tuple<rmm::device_uvector<key_t>, std::optional<rmm::device_uvector<int32_t>>>
+hash_based_unique_keys_and_min_hops(raft::handle_t const& handle,
+                                    KeyIterator key_first,
+                                    size_t num_keys,
+                                    std::optional<raft::device_span<int32_t const>> hops)
+{
+  auto constexpr invalid_key = std::numeric_limits<key_t>::max();
+  auto invalid_key_found     = thrust::any_of(handle.get_thrust_policy(),
+                                          key_first,
+                                          key_first + num_keys,
+                                          detail::is_equal_t<key_t>{invalid_key});
+  key_store_t<key_t, false> store(num_keys, invalid_key, handle.get_stream());
+  store.insert_if(key_first,
+                  key_first + num_keys,
+                  key_first,
+                  detail::is_not_equal_t<key_t>{invalid_key},
+                  handle.get_stream());
+  auto unique_keys = store.release(handle.get_stream());
+  if (invalid_key_found) {
+    unique_keys.resize(unique_keys.size() + 1, handle.get_stream());
+    unique_keys.set_element(unique_keys.size() - 1, invalid_key, handle.get_stream());
+  }
+  thrust::sort(handle.get_thrust_policy(), unique_keys.begin(), unique_keys.end());
+
+  std::optional<rmm::device_uvector<int32_t>> min_hops{std::nullopt};
+  if (hops) {
+    min_hops = rmm::device_uvector<int32_t>(unique_keys.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 (*min_hops).begin(),
+                 (*min_hops).end(),
+                 std::numeric_limits<int32_t>::max());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_keys),
+      [key_first,
+       hops        = *hops,
+       unique_keys = raft::device_span<key_t const>(unique_keys.data(), unique_keys.size()),
+       min_hops    = raft::device_span<int32_t>((*min_hops).data(),
+                                             (*min_hops).size())] __device__(size_t i) {
+        auto it = thrust::lower_bound(
+          thrust::seq, unique_keys.begin(), unique_keys.end(), *(key_first + i));
+        cuda::atomic_ref<int32_t, cuda::thread_scope_device> min_hop(
+          min_hops[thrust::distance(unique_keys.begin(), it)]);
+        min_hop.fetch_min(hops[i], cuda::std::memory_order_relaxed);
+      });
+  }
+
+  return std::make_tuple(std::move(unique_keys), std::move(min_hops));
+}
+
 template <typename label_index_t,
           typename vertex_t,
           typename vertex_type_t,
@@ -549,157 +608,192 @@ compute_min_hop_for_unique_label_vertex_pairs(
     rmm::device_uvector<vertex_t> tmp_vertices(0, handle.get_stream());
     std::optional<rmm::device_uvector<int32_t>> tmp_hops{std::nullopt};
 
-    auto [h_label_offsets, h_edge_offsets] =
-      detail::compute_offset_aligned_element_chunks(handle,
-                                                    *edgelist_label_offsets,
-                                                    edgelist_vertices.size(),
-                                                    approx_items_to_sort_per_iteration);
-    auto num_chunks = h_label_offsets.size() - 1;
-
-    if (edgelist_hops) {
-      rmm::device_uvector<size_t> tmp_indices(edgelist_vertices.size(), handle.get_stream());
-      thrust::sequence(
-        handle.get_thrust_policy(), tmp_indices.begin(), tmp_indices.end(), size_t{0});
-
-      // cub::DeviceSegmentedSort currently does not suuport thrust::tuple type keys, sorting in
-      // chunks still helps in limiting the binary search range and improving memory locality
-      for (size_t i = 0; i < num_chunks; ++i) {
-        thrust::sort(
-          handle.get_thrust_policy(),
-          tmp_indices.begin() + h_edge_offsets[i],
-          tmp_indices.begin() + h_edge_offsets[i + 1],
-          [edgelist_label_offsets =
-             raft::device_span<size_t const>((*edgelist_label_offsets).data() + h_label_offsets[i],
-                                             (h_label_offsets[i + 1] - h_label_offsets[i]) + 1),
-           edgelist_vertices,
-           edgelist_hops = *edgelist_hops] __device__(size_t l_idx, size_t r_idx) {
-            auto l_it = thrust::upper_bound(
-              thrust::seq, edgelist_label_offsets.begin() + 1, edgelist_label_offsets.end(), l_idx);
-            auto r_it = thrust::upper_bound(
-              thrust::seq, edgelist_label_offsets.begin() + 1, edgelist_label_offsets.end(), r_idx);
-            if (l_it != r_it) { return l_it < r_it; }
-
-            auto l_vertex = edgelist_vertices[l_idx];
-            auto r_vertex = edgelist_vertices[r_idx];
-            if (l_vertex != r_vertex) { return l_vertex < r_vertex; }
+    if constexpr (sizeof(vertex_t) == 4) {  // a (label index, vertex) pair fits in a 64 bit key
+      auto key_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        cuda::proclaim_return_type<uint64_t>(
+          [label_index_op = compute_label_index_t<label_index_t>{*edgelist_label_offsets},
+           edgelist_vertices] __device__(size_t i) {
+            return (static_cast<uint64_t>(label_index_op(i)) << 32) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(edgelist_vertices[i]));
+          }));
+      rmm::device_uvector<uint64_t> unique_keys(0, handle.get_stream());
+      std::tie(unique_keys, tmp_hops) = hash_based_unique_keys_and_min_hops<uint64_t>(
+        handle, key_first, edgelist_vertices.size(), edgelist_hops);
 
-            auto l_hop = edgelist_hops[l_idx];
-            auto r_hop = edgelist_hops[r_idx];
-            return l_hop < r_hop;
-          });
-      }
+      tmp_label_indices.resize(unique_keys.size(), handle.get_stream());
+      tmp_vertices.resize(unique_keys.size(), handle.get_stream());
+      thrust::transform(
+        handle.get_thrust_policy(),
+        unique_keys.begin(),
+        unique_keys.end(),
+        thrust::make_zip_iterator(tmp_label_indices.begin(), tmp_vertices.begin()),
+        cuda::proclaim_return_type<thrust::tuple<label_index_t, vertex_t>>(
+          [] __device__(uint64_t key) {
+            return thrust::make_tuple(static_cast<label_index_t>(key >> 32),
+                                      static_cast<vertex_t>(static_cast<uint32_t>(key)));
+          }));
+    } else {
+      auto [h_label_offsets, h_edge_offsets] =
+        detail::compute_offset_aligned_element_chunks(handle,
+                                                      *edgelist_label_offsets,
+                                                      edgelist_vertices.size(),
+                                                      approx_items_to_sort_per_iteration);
+      auto num_chunks = h_label_offsets.size() - 1;
 
-      tmp_indices.resize(
-        thrust::distance(tmp_indices.begin(),
-                         thrust::unique(handle.get_thrust_policy(),
-                                        tmp_indices.begin(),
-                                        tmp_indices.end(),
-                                        [edgelist_label_offsets = *edgelist_label_offsets,
-                                         edgelist_vertices] __device__(size_t l_idx, size_t r_idx) {
-                                          auto l_it =
-                                            thrust::upper_bound(thrust::seq,
-                                                                edgelist_label_offsets.begin() + 1,
-                                                                edgelist_label_offsets.end(),
-                                                                l_idx);
-                                          auto r_it =
-                                            thrust::upper_bound(thrust::seq,
-                                                                edgelist_label_offsets.begin() + 1,
-                                                                edgelist_label_offsets.end(),
-                                                                r_idx);
-                                          if (l_it != r_it) { return false; }
-
-                                          auto l_vertex = edgelist_vertices[l_idx];
-                                          auto r_vertex = edgelist_vertices[r_idx];
-                                          return l_vertex == r_vertex;
-                                        })),
-        handle.get_stream());
+      if (edgelist_hops) {
+        rmm::device_uvector<size_t> tmp_indices(edgelist_vertices.size(), handle.get_stream());
+        thrust::sequence(
+          handle.get_thrust_policy(), tmp_indices.begin(), tmp_indices.end(), size_t{0});
 
-      tmp_label_indices.resize(tmp_indices.size(), handle.get_stream());
-      tmp_vertices.resize(tmp_indices.size(), handle.get_stream());
-      tmp_hops = rmm::device_uvector<int32_t>(tmp_indices.size(), handle.get_stream());
+        // cub::DeviceSegmentedSort currently does not suuport thrust::tuple type keys, sorting in
+        // chunks still helps in limiting the binary search range and improving memory locality
+        for (size_t i = 0; i < num_chunks; ++i) {
+          thrust::sort(
+            handle.get_thrust_policy(),
+            tmp_indices.begin() + h_edge_offsets[i],
+            tmp_indices.begin() + h_edge_offsets[i + 1],
+            [edgelist_label_offsets = raft::device_span<size_t const>(
+               (*edgelist_label_offsets).data() + h_label_offsets[i],
+               (h_label_offsets[i + 1] - h_label_offsets[i]) + 1),
+             edgelist_vertices,
+             edgelist_hops = *edgelist_hops] __device__(size_t l_idx, size_t r_idx) {
+              auto l_it = thrust::upper_bound(thrust::seq,
+                                              edgelist_label_offsets.begin() + 1,
+                                              edgelist_label_offsets.end(),
+                                              l_idx);
+              auto r_it = thrust::upper_bound(thrust::seq,
+                                              edgelist_label_offsets.begin() + 1,
+                                              edgelist_label_offsets.end(),
+                                              r_idx);
+              if (l_it != r_it) { return l_it < r_it; }
+
+              auto l_vertex = edgelist_vertices[l_idx];
+              auto r_vertex = edgelist_vertices[r_idx];
+              if (l_vertex != r_vertex) { return l_vertex < r_vertex; }
+
+              auto l_hop = edgelist_hops[l_idx];
+              auto r_hop = edgelist_hops[r_idx];
+              return l_hop < r_hop;
+            });
+        }
 
-      auto triplet_first = thrust::make_transform_iterator(
-        tmp_indices.begin(),
-        cuda::proclaim_return_type<thrust::tuple<label_index_t, vertex_t, int32_t>>(
-          [edgelist_label_offsets = *edgelist_label_offsets,
-           edgelist_vertices,
-           edgelist_hops = *edgelist_hops] __device__(size_t i) {
-            auto label_idx = static_cast<label_index_t>(thrust::distance(
-              edgelist_label_offsets.begin() + 1,
-              thrust::upper_bound(
-                thrust::seq, edgelist_label_offsets.begin() + 1, edgelist_label_offsets.end(), i)));
-            return thrust::make_tuple(label_idx, edgelist_vertices[i], edgelist_hops[i]);
-          }));
-      thrust::copy(handle.get_thrust_policy(),
-                   triplet_first,
-                   triplet_first + tmp_indices.size(),
-                   thrust::make_zip_iterator(
-                     tmp_label_indices.begin(), tmp_vertices.begin(), (*tmp_hops).begin()));
-    } else {
-      rmm::device_uvector<vertex_t> segment_sorted_vertices(edgelist_vertices.size(),
-                                                            handle.get_stream());
+        tmp_indices.resize(
+          thrust::distance(
+            tmp_indices.begin(),
+            thrust::unique(handle.get_thrust_policy(),
+                           tmp_indices.begin(),
+                           tmp_indices.end(),
+                           [edgelist_label_offsets = *edgelist_label_offsets,
+                            edgelist_vertices] __device__(size_t l_idx, size_t r_idx) {
+                             auto l_it = thrust::upper_bound(thrust::seq,
+                                                             edgelist_label_offsets.begin() + 1,
+                                                             edgelist_label_offsets.end(),
+                                                             l_idx);
+                             auto r_it = thrust::upper_bound(thrust::seq,
+                                                             edgelist_label_offsets.begin() + 1,
+                                                             edgelist_label_offsets.end(),
+                                                             r_idx);
+                             if (l_it != r_it) { return false; }
+
+                             auto l_vertex = edgelist_vertices[l_idx];
+                             auto r_vertex = edgelist_vertices[r_idx];
+                             return l_vertex == r_vertex;
+                           })),
+          handle.get_stream());
 
-      rmm::device_uvector<std::byte> d_tmp_storage(0, handle.get_stream());
-      for (size_t i = 0; i < num_chunks; ++i) {
-        size_t tmp_storage_bytes{0};
+        tmp_label_indices.resize(tmp_indices.size(), handle.get_stream());
+        tmp_vertices.resize(tmp_indices.size(), handle.get_stream());
+        tmp_hops = rmm::device_uvector<int32_t>(tmp_indices.size(), handle.get_stream());
+
+        auto triplet_first = thrust::make_transform_iterator(
+          tmp_indices.begin(),
+          cuda::proclaim_return_type<thrust::tuple<label_index_t, vertex_t, int32_t>>(
+            [edgelist_label_offsets = *edgelist_label_offsets,
+             edgelist_vertices,
+             edgelist_hops = *edgelist_hops] __device__(size_t i) {
+              auto label_idx = static_cast<label_index_t>(
+                thrust::distance(edgelist_label_offsets.begin() + 1,
+                                 thrust::upper_bound(thrust::seq,
+                                                     edgelist_label_offsets.begin() + 1,
+                                                     edgelist_label_offsets.end(),
+                                                     i)));
+              return thrust::make_tuple(label_idx, edgelist_vertices[i], edgelist_hops[i]);
+            }));
+        thrust::copy(handle.get_thrust_policy(),
+                     triplet_first,
+                     triplet_first + tmp_indices.size(),
+                     thrust::make_zip_iterator(
+                       tmp_label_indices.begin(), tmp_vertices.begin(), (*tmp_hops).begin()));
+      } else {
+        rmm::device_uvector<vertex_t> segment_sorted_vertices(edgelist_vertices.size(),
+                                                              handle.get_stream());
 
-        auto offset_first =
-          thrust::make_transform_iterator((*edgelist_label_offsets).data() + h_label_offsets[i],
-                                          detail::shift_left_t<size_t>{h_edge_offsets[i]});
-        cub::DeviceSegmentedSort::SortKeys(static_cast<void*>(nullptr),
-                                           tmp_storage_bytes,
-                                           edgelist_vertices.begin() + h_edge_offsets[i],
-                                           segment_sorted_vertices.begin() + h_edge_offsets[i],
-                                           h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                           h_label_offsets[i + 1] - h_label_offsets[i],
-                                           offset_first,
-                                           offset_first + 1,
-                                           handle.get_stream());
+        rmm::device_uvector<std::byte> d_tmp_storage(0, handle.get_stream());
+        for (size_t i = 0; i < num_chunks; ++i) {
+          size_t tmp_storage_bytes{0};
+
+          auto offset_first =
+            thrust::make_transform_iterator((*edgelist_label_offsets).data() + h_label_offsets[i],
+                                            detail::shift_left_t<size_t>{h_edge_offsets[i]});
+          cub::DeviceSegmentedSort::SortKeys(static_cast<void*>(nullptr),
+                                             tmp_storage_bytes,
+                                             edgelist_vertices.begin() + h_edge_offsets[i],
+                                             segment_sorted_vertices.begin() + h_edge_offsets[i],
+                                             h_edge_offsets[i + 1] - h_edge_offsets[i],
+                                             h_label_offsets[i + 1] - h_label_offsets[i],
+                                             offset_first,
+                                             offset_first + 1,
+                                             handle.get_stream());
+
+          if (tmp_storage_bytes > d_tmp_storage.size()) {
+            d_tmp_storage = rmm::device_uvector<std::byte>(tmp_storage_bytes, handle.get_stream());
+          }
 
-        if (tmp_storage_bytes > d_tmp_storage.size()) {
-          d_tmp_storage = rmm::device_uvector<std::byte>(tmp_storage_bytes, handle.get_stream());
+          cub::DeviceSegmentedSort::SortKeys(d_tmp_storage.data(),
+                                             tmp_storage_bytes,
+                                             edgelist_vertices.begin() + h_edge_offsets[i],
+                                             segment_sorted_vertices.begin() + h_edge_offsets[i],
+                                             h_edge_offsets[i + 1] - h_edge_offsets[i],
+                                             h_label_offsets[i + 1] - h_label_offsets[i],
+                                             offset_first,
+                                             offset_first + 1,
+                                             handle.get_stream());
         }
+        d_tmp_storage.resize(0, handle.get_stream());
+        d_tmp_storage.shrink_to_fit(handle.get_stream());
 
-        cub::DeviceSegmentedSort::SortKeys(d_tmp_storage.data(),
-                                           tmp_storage_bytes,
-                                           edgelist_vertices.begin() + h_edge_offsets[i],
-                                           segment_sorted_vertices.begin() + h_edge_offsets[i],
-                                           h_edge_offsets[i + 1] - h_edge_offsets[i],
-                                           h_label_offsets[i + 1] - h_label_offsets[i],
-                                           offset_first,
-                                           offset_first + 1,
-                                           handle.get_stream());
-      }
-      d_tmp_storage.resize(0, handle.get_stream());
-      d_tmp_storage.shrink_to_fit(handle.get_stream());
-
-      tmp_label_indices.resize(segment_sorted_vertices.size(), handle.get_stream());
-      tmp_vertices.resize(segment_sorted_vertices.size(), handle.get_stream());
+        tmp_label_indices.resize(segment_sorted_vertices.size(), handle.get_stream());
+        tmp_vertices.resize(segment_sorted_vertices.size(), handle.get_stream());
 
-      auto input_pair_first = thrust::make_transform_iterator(
-        thrust::make_counting_iterator(size_t{0}),
-        cuda::proclaim_return_type<thrust::tuple<label_index_t, vertex_t>>(
-          [edgelist_label_offsets = *edgelist_label_offsets,
-           edgelist_vertices      = raft::device_span<vertex_t const>(
-             segment_sorted_vertices.data(), segment_sorted_vertices.size())] __device__(size_t i) {
-            auto label_idx = static_cast<label_index_t>(thrust::distance(
-              edgelist_label_offsets.begin() + 1,
-              thrust::upper_bound(
-                thrust::seq, edgelist_label_offsets.begin() + 1, edgelist_label_offsets.end(), i)));
-            return thrust::make_tuple(label_idx, edgelist_vertices[i]);
-          }));
-      auto output_pair_first =
-        thrust::make_zip_iterator(tmp_label_indices.begin(), tmp_vertices.begin());
-      auto num_uniques =
-        thrust::distance(output_pair_first,
-                         thrust::unique_copy(handle.get_thrust_policy(),
-                                             input_pair_first,
-                                             input_pair_first + segment_sorted_vertices.size(),
-                                             output_pair_first));
-      tmp_label_indices.resize(num_uniques, handle.get_stream());
-      tmp_vertices.resize(num_uniques, handle.get_stream());
-      tmp_label_indices.shrink_to_fit(handle.get_stream());
-      tmp_vertices.shrink_to_fit(handle.get_stream());
+        auto input_pair_first = thrust::make_transform_iterator(
+          thrust::make_counting_iterator(size_t{0}),
+          cuda::proclaim_return_type<thrust::tuple<label_index_t, vertex_t>>(
+            [edgelist_label_offsets = *edgelist_label_offsets,
+             edgelist_vertices      = raft::device_span<vertex_t const>(
+               segment_sorted_vertices.data(),
+               segment_sorted_vertices.size())] __device__(size_t i) {
+              auto label_idx = static_cast<label_index_t>(
+                thrust::distance(edgelist_label_offsets.begin() + 1,
+                                 thrust::upper_bound(thrust::seq,
+                                                     edgelist_label_offsets.begin() + 1,
+                                                     edgelist_label_offsets.end(),
+                                                     i)));
+              return thrust::make_tuple(label_idx, edgelist_vertices[i]);
+            }));
+        auto output_pair_first =
+          thrust::make_zip_iterator(tmp_label_indices.begin(), tmp_vertices.begin());
+        auto num_uniques =
+          thrust::distance(output_pair_first,
+                           thrust::unique_copy(handle.get_thrust_policy(),
+                                               input_pair_first,
+                                               input_pair_first + segment_sorted_vertices.size(),
+                                               output_pair_first));
+        tmp_label_indices.resize(num_uniques, handle.get_stream());
+        tmp_vertices.resize(num_uniques, handle.get_stream());
+        tmp_label_indices.shrink_to_fit(handle.get_stream());
+        tmp_vertices.shrink_to_fit(handle.get_stream());
+      }
     }
 
     if (seed_vertices) {
@@ -901,43 +995,10 @@ compute_min_hop_for_unique_label_vertex_pairs(
                            std::move(tmp_hops),
                            std::move(tmp_label_offsets));
   } else {
-    rmm::device_uvector<vertex_t> tmp_vertices(edgelist_vertices.size(), handle.get_stream());
-    thrust::copy(handle.get_thrust_policy(),
-                 edgelist_vertices.begin(),
-                 edgelist_vertices.end(),
-                 tmp_vertices.begin());
+    rmm::device_uvector<vertex_t> tmp_vertices(0, handle.get_stream());
     std::optional<rmm::device_uvector<int32_t>> tmp_hops{std::nullopt};
-
-    if (edgelist_hops) {
-      tmp_hops = rmm::device_uvector<int32_t>((*edgelist_hops).size(), handle.get_stream());
-      thrust::copy(handle.get_thrust_policy(),
-                   (*edgelist_hops).begin(),
-                   (*edgelist_hops).end(),
-                   (*tmp_hops).begin());
-
-      auto pair_first = thrust::make_zip_iterator(
-        tmp_vertices.begin(),
-        (*tmp_hops).begin());  // vertex is a primary key, hop is a secondary key
-      thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + tmp_vertices.size());
-      tmp_vertices.resize(
-        thrust::distance(tmp_vertices.begin(),
-                         thrust::get<0>(thrust::unique_by_key(handle.get_thrust_policy(),
-                                                              tmp_vertices.begin(),
-                                                              tmp_vertices.end(),
-                                                              (*tmp_hops).begin()))),
-        handle.get_stream());
-      (*tmp_hops).resize(tmp_vertices.size(), handle.get_stream());
-      tmp_vertices.shrink_to_fit(handle.get_stream());
-      (*tmp_hops).shrink_to_fit(handle.get_stream());
-    } else {
-      thrust::sort(handle.get_thrust_policy(), tmp_vertices.begin(), tmp_vertices.end());
-      tmp_vertices.resize(
-        thrust::distance(
-          tmp_vertices.begin(),
-          thrust::unique(handle.get_thrust_policy(), tmp_vertices.begin(), tmp_vertices.end())),
-        handle.get_stream());
-      tmp_vertices.shrink_to_fit(handle.get_stream());
-    }
+    std::tie(tmp_vertices, tmp_hops) = hash_based_unique_keys_and_min_hops<vertex_t>(
+      handle, edgelist_vertices.begin(), edgelist_vertices.size(), edgelist_hops);
 
     if (seed_vertices) {
       /* sort and enumerate unique verties */
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampling_result_compression_impl.cuh"
+
+#include <cugraph/sampling_functions.hpp>
+
+namespace cugraph {
+
+template std::tuple<rmm::device_uvector<uint32_t>, int32_t, int32_t> bit_pack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> values,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<uint32_t>, int32_t, int64_t> bit_pack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<int64_t const> values,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<uint32_t>, int32_t, size_t> bit_pack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<size_t const> values,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> bit_unpack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<uint32_t const> packed_words,
+  size_t num_values,
+  int32_t bit_width,
+  int32_t base,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets);
+
+template rmm::device_uvector<int64_t> bit_unpack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<uint32_t const> packed_words,
+  size_t num_values,
+  int32_t bit_width,
+  int64_t base,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets);
+
+template rmm::device_uvector<size_t> bit_unpack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<uint32_t const> packed_words,
+  size_t num_values,
+  int32_t bit_width,
+  size_t base,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets);
+
+}  // namespace cugraph
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+__device__ inline bool is_segment_first(raft::device_span<size_t const> segment_offsets, size_t i)
+{
+  return (i == 0) ||
+         thrust::binary_search(thrust::seq, segment_offsets.begin(), segment_offsets.end(), i);
+}
+
+// values are encoded as unsigned differences (modular arithmetic in the unsigned type of the same
+// width), so the full value range is representable
+template <typename value_t>
+struct encode_sampled_value_t {
+  raft::device_span<value_t const> values{};
+  cuda::std::optional<raft::device_span<size_t const>> delta_segment_offsets{};
+  value_t base{};
+
+  __device__ uint64_t operator()(size_t i) const
+  {
+    using unsigned_t = std::make_unsigned_t<value_t>;
+    auto ref         = base;
+    if (delta_segment_offsets && !is_segment_first(*delta_segment_offsets, i)) {
+      ref = values[i - 1];
+    }
+    return static_cast<uint64_t>(
+      static_cast<unsigned_t>(static_cast<unsigned_t>(values[i]) - static_cast<unsigned_t>(ref)));
+  }
+};
+
+template <typename EncodedValueIterator>
+struct pack_word_t {
+  EncodedValueIterator encoded_value_first{};
+  size_t num_values{};
+  int32_t bit_width{};
+
+  __device__ uint32_t operator()(size_t w) const
+  {
+    uint32_t word{0};
+    auto word_bit_first = w * size_t{32};
+    auto i_first        = word_bit_first / static_cast<size_t>(bit_width);
+    auto i_last         = cuda::std::min(
+      (word_bit_first + size_t{32} + static_cast<size_t>(bit_width) - size_t{1}) /
+        static_cast<size_t>(bit_width),
+      num_values);
+    for (auto i = i_first; i < i_last; ++i) {
+      auto value     = *(encoded_value_first + i);
+      auto bit_first = i * static_cast<size_t>(bit_width);
+      if (bit_first >= word_bit_first) {
+        word |= static_cast<uint32_t>(value << (bit_first - word_bit_first));
+      } else {
+        word |= static_cast<uint32_t>(value >> (word_bit_first - bit_first));
+      }
+    }
+    return word;
+  }
+};
+
+template <typename value_t>
+struct unpack_value_t {
+  raft::device_span<uint32_t const> packed_words{};
+  int32_t bit_width{};
+
+  __device__ value_t operator()(size_t i) const
+  {
+    using unsigned_t = std::make_unsigned_t<value_t>;
+    auto bit_first   = i * static_cast<size_t>(bit_width);
+    auto w           = bit_first / size_t{32};
+    auto shift       = static_cast<int32_t>(bit_first % size_t{32});
+    uint64_t bits    = static_cast<uint64_t>(packed_words[w]) >> shift;
+    if (w + 1 < packed_words.size()) {
+      bits |= static_cast<uint64_t>(packed_words[w + 1]) << (32 - shift);
+    }
+    if ((shift + bit_width > 64) && (w + 2 < packed_words.size())) {
+      bits |= static_cast<uint64_t>(packed_words[w + 2]) << (64 - shift);
+    }
+    if (bit_width < 64) { bits &= (uint64_t{1} << bit_width) - uint64_t{1}; }
+    return static_cast<value_t>(static_cast<unsigned_t>(bits));
+  }
+};
+
+template <typename value_t>
+struct unsigned_plus_t {
+  __device__ value_t operator()(value_t lhs, value_t rhs) const
+  {
+    using unsigned_t = std::make_unsigned_t<value_t>;
+    return static_cast<value_t>(static_cast<unsigned_t>(lhs) + static_cast<unsigned_t>(rhs));
+  }
+};
+
+}  // namespace detail
+
+template <typename value_t>
+std::tuple<rmm::device_uvector<uint32_t>, int32_t, value_t> bit_pack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<value_t const> values,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral_v<value_t>);
+
+  if (delta_segment_offsets) {
+    CUGRAPH_EXPECTS((*delta_segment_offsets).size() >= 1,
+                    "Invalid input arguments: delta_segment_offsets should include at least one "
+                    "element.");
+  }
+
+  if (do_expensive_check) {
+    if (delta_segment_offsets) {
+      CUGRAPH_EXPECTS(
+        thrust::is_sorted(handle.get_thrust_policy(),
+                          (*delta_segment_offsets).begin(),
+                          (*delta_segment_offsets).end()),
+        "Invalid input arguments: delta_segment_offsets should be sorted.");
+      size_t first_last[2]{};
+      raft::update_host(first_last, (*delta_segment_offsets).data(), 1, handle.get_stream());
+      raft::update_host(first_last + 1,
+                        (*delta_segment_offsets).data() + (*delta_segment_offsets).size() - 1,
+                        1,
+                        handle.get_stream());
+      handle.sync_stream();
+      CUGRAPH_EXPECTS(
+        (first_last[0] == 0) && (first_last[1] == values.size()),
+        "Invalid input arguments: delta_segment_offsets should start with 0 and end with "
+        "values.size().");
+      CUGRAPH_EXPECTS(
+        !thrust::any_of(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(size_t{1}),
+                        thrust::make_counting_iterator(values.size()),
+                        cuda::proclaim_return_type<bool>(
+                          [values, offsets = *delta_segment_offsets] __device__(size_t i) {
+                            return !detail::is_segment_first(offsets, i) &&
+                                   (values[i] < values[i - 1]);
+                          })),
+        "Invalid input arguments: values should be non-decreasing within each segment if "
+        "delta_segment_offsets.has_value() is true.");
+    }
+  }
+
+  if (values.size() == 0) {
+    return std::make_tuple(
+      rmm::device_uvector<uint32_t>(0, handle.get_stream()), int32_t{0}, value_t{0});
+  }
+
+  auto base = thrust::reduce(handle.get_thrust_policy(),
+                             values.begin(),
+                             values.end(),
+                             std::numeric_limits<value_t>::max(),
+                             thrust::minimum<value_t>{});
+
+  auto encoded_value_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(size_t{0}),
+    detail::encode_sampled_value_t<value_t>{
+      values,
+      delta_segment_offsets ? cuda::std::make_optional(*delta_segment_offsets) : cuda::std::nullopt,
+      base});
+  auto max_encoded_value = thrust::reduce(handle.get_thrust_policy(),
+                                          encoded_value_first,
+                                          encoded_value_first + values.size(),
+                                          uint64_t{0},
+                                          thrust::maximum<uint64_t>{});
+
+  int32_t bit_width{0};
+  while ((bit_width < 64) && ((max_encoded_value >> bit_width) != uint64_t{0})) {
+    ++bit_width;
+  }
+
+  rmm::device_uvector<uint32_t> packed_words(
+    (values.size() * static_cast<size_t>(bit_width) + size_t{31}) / size_t{32},
+    handle.get_stream());
+  if (bit_width > 0) {
+    thrust::tabulate(
+      handle.get_thrust_policy(),
+      packed_words.begin(),
+      packed_words.end(),
+      detail::pack_word_t<decltype(encoded_value_first)>{
+        encoded_value_first, values.size(), bit_width});
+  }
+
+  return std::make_tuple(std::move(packed_words), bit_width, base);
+}
+
+template <typename value_t>
+rmm::device_uvector<value_t> bit_unpack_sampled_values(
+  raft::handle_t const& handle,
+  raft::device_span<uint32_t const> packed_words,
+  size_t num_values,
+  int32_t bit_width,
+  value_t base,
+  std::optional<raft::device_span<size_t const>> delta_segment_offsets)
+{
+  static_assert(std::is_integral_v<value_t>);
+
+  CUGRAPH_EXPECTS((bit_width >= 0) && (bit_width <= static_cast<int32_t>(sizeof(value_t) * 8)),
+                  "Invalid input arguments: bit_width should be in [0, sizeof(value_t) * 8].");
+  CUGRAPH_EXPECTS(
+    packed_words.size() == (num_values * static_cast<size_t>(bit_width) + size_t{31}) / size_t{32},
+    "Invalid input arguments: packed_words.size() does not match num_values and bit_width.");
+
+  rmm::device_uvector<value_t> values(num_values, handle.get_stream());
+  if (bit_width > 0) {
+    thrust::tabulate(handle.get_thrust_policy(),
+                     values.begin(),
+                     values.end(),
+                     detail::unpack_value_t<value_t>{packed_words, bit_width});
+  } else {
+    thrust::fill(handle.get_thrust_policy(), values.begin(), values.end(), value_t{0});
+  }
+
+  if (delta_segment_offsets) {
+    auto segment_idx_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(size_t{0}),
+      cuda::proclaim_return_type<size_t>(
+        [offsets = *delta_segment_offsets] __device__(size_t i) {
+          return static_cast<size_t>(thrust::distance(
+            offsets.begin() + 1,
+            thrust::upper_bound(thrust::seq, offsets.begin() + 1, offsets.end(), i)));
+        }));
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  segment_idx_first,
+                                  segment_idx_first + values.size(),
+                                  values.begin(),
+                                  values.begin(),
+                                  thrust::equal_to<size_t>{},
+                                  detail::unsigned_plus_t<value_t>{});
+  }
+
+  thrust::transform(handle.get_thrust_policy(),
+                    values.begin(),
+                    values.end(),
+                    values.begin(),
+                    cuda::proclaim_return_type<value_t>([base] __device__(value_t v) {
+                      return detail::unsigned_plus_t<value_t>{}(v, base);
+                    }));
+
+  return values;
+}
+
+}  // namespace cugraph
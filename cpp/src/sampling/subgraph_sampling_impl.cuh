@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/collect_comm_wrapper.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// subgraph_ids[i] is the subgraph ID of vertices[i], vertices should be local to this GPU
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+extract_subgraphs_from_subgraph_vertex_pairs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  rmm::device_uvector<int32_t>&& subgraph_ids,
+  rmm::device_uvector<vertex_t>&& vertices,
+  size_t num_subgraphs,
+  bool do_expensive_check)
+{
+  auto pair_first = thrust::make_zip_iterator(subgraph_ids.begin(), vertices.begin());
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + subgraph_ids.size());
+  subgraph_ids.resize(
+    static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + subgraph_ids.size()))),
+    handle.get_stream());
+  vertices.resize(subgraph_ids.size(), handle.get_stream());
+
+  rmm::device_uvector<size_t> subgraph_offsets(num_subgraphs + 1, handle.get_stream());
+  subgraph_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::upper_bound(handle.get_thrust_policy(),
+                      subgraph_ids.begin(),
+                      subgraph_ids.end(),
+                      thrust::make_counting_iterator(int32_t{0}),
+                      thrust::make_counting_iterator(static_cast<int32_t>(num_subgraphs)),
+                      subgraph_offsets.begin() + 1);
+  subgraph_ids.resize(0, handle.get_stream());
+  subgraph_ids.shrink_to_fit(handle.get_stream());
+
+  return extract_induced_subgraphs(
+    handle,
+    graph_view,
+    edge_weight_view,
+    raft::device_span<size_t const>(subgraph_offsets.data(), subgraph_offsets.size()),
+    raft::device_span<vertex_t const>(vertices.data(), vertices.size()),
+    do_expensive_check);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+cluster_subgraph_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> clustering,
+  size_t clusters_per_subgraph,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(clustering.size() == graph_view.local_vertex_partition_range_size(),
+                  "Invalid input arguments: clustering.size() should coincide with the local "
+                  "vertex partition range size.");
+  CUGRAPH_EXPECTS(clusters_per_subgraph > 0,
+                  "Invalid input arguments: clusters_per_subgraph should be positive.");
+
+  // 1. find the (global) set of cluster IDs (cluster IDs returned by clustering algorithms are not
+  // necessarily consecutive)
+
+  rmm::device_uvector<vertex_t> unique_clusters(clustering.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), clustering.begin(), clustering.end(), unique_clusters.begin());
+  thrust::sort(handle.get_thrust_policy(), unique_clusters.begin(), unique_clusters.end());
+  unique_clusters.resize(
+    static_cast<size_t>(thrust::distance(
+      unique_clusters.begin(),
+      thrust::unique(handle.get_thrust_policy(), unique_clusters.begin(), unique_clusters.end()))),
+    handle.get_stream());
+  if constexpr (multi_gpu) {
+    unique_clusters = detail::device_allgatherv(
+      handle,
+      handle.get_comms(),
+      raft::device_span<vertex_t const>(unique_clusters.data(), unique_clusters.size()));
+    thrust::sort(handle.get_thrust_policy(), unique_clusters.begin(), unique_clusters.end());
+    unique_clusters.resize(
+      static_cast<size_t>(thrust::distance(
+        unique_clusters.begin(),
+        thrust::unique(
+          handle.get_thrust_policy(), unique_clusters.begin(), unique_clusters.end()))),
+      handle.get_stream());
+  }
+  auto num_clusters  = unique_clusters.size();
+  auto num_subgraphs = (num_clusters + clusters_per_subgraph - 1) / clusters_per_subgraph;
+
+  // 2. randomly permute the clusters and assign clusters_per_subgraph clusters to each subgraph
+  // (every GPU should use the same permutation, so the permutation is broadcast from rank 0)
+
+  rmm::device_uvector<int32_t> cluster_subgraph_ids(num_clusters, handle.get_stream());
+  {
+    rmm::device_uvector<vertex_t> permutation(num_clusters, handle.get_stream());
+    thrust::sequence(
+      handle.get_thrust_policy(), permutation.begin(), permutation.end(), vertex_t{0});
+    rmm::device_uvector<float> random_numbers(num_clusters, handle.get_stream());
+    detail::uniform_random_fill(handle.get_stream(),
+                                random_numbers.data(),
+                                random_numbers.size(),
+                                float{0.0},
+                                float{1.0},
+                                rng_state);
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        random_numbers.begin(),
+                        random_numbers.end(),
+                        permutation.begin());
+    if constexpr (multi_gpu) {
+      device_bcast(handle.get_comms(),
+                   permutation.data(),
+                   permutation.data(),
+                   permutation.size(),
+                   int{0},
+                   handle.get_stream());
+    }
+    thrust::scatter(
+      handle.get_thrust_policy(),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        cuda::proclaim_return_type<int32_t>([clusters_per_subgraph] __device__(size_t i) {
+          return static_cast<int32_t>(i / clusters_per_subgraph);
+        })),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(num_clusters),
+        cuda::proclaim_return_type<int32_t>([clusters_per_subgraph] __device__(size_t i) {
+          return static_cast<int32_t>(i / clusters_per_subgraph);
+        })),
+      permutation.begin(),
+      cluster_subgraph_ids.begin());
+  }
+
+  // 3. find the subgraph ID of each local vertex
+
+  rmm::device_uvector<int32_t> subgraph_ids(clustering.size(), handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    clustering.begin(),
+    clustering.end(),
+    subgraph_ids.begin(),
+    cuda::proclaim_return_type<int32_t>(
+      [unique_clusters = raft::device_span<vertex_t const>(unique_clusters.data(),
+                                                           unique_clusters.size()),
+       cluster_subgraph_ids =
+         raft::device_span<int32_t const>(cluster_subgraph_ids.data(),
+                                          cluster_subgraph_ids.size())] __device__(vertex_t c) {
+        auto it =
+          thrust::lower_bound(thrust::seq, unique_clusters.begin(), unique_clusters.end(), c);
+        return cluster_subgraph_ids[thrust::distance(unique_clusters.begin(), it)];
+      }));
+  rmm::device_uvector<vertex_t> vertices(clustering.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   vertices.begin(),
+                   vertices.end(),
+                   graph_view.local_vertex_partition_range_first());
+
+  // 4. extract the induced subgraphs
+
+  return detail::extract_subgraphs_from_subgraph_vertex_pairs(handle,
+                                                              graph_view,
+                                                              edge_weight_view,
+                                                              std::move(subgraph_ids),
+                                                              std::move(vertices),
+                                                              num_subgraphs,
+                                                              do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<size_t>>
+random_vertex_subgraph_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  size_t num_subgraphs,
+  size_t num_roots_per_subgraph,
+  size_t walk_length,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(num_roots_per_subgraph <= static_cast<size_t>(graph_view.number_of_vertices()),
+                  "Invalid input arguments: num_roots_per_subgraph should not exceed the number "
+                  "of vertices.");
+
+  // 1. select the root vertices (roots are local to this GPU)
+
+  rmm::device_uvector<vertex_t> roots(0, handle.get_stream());
+  rmm::device_uvector<int32_t> root_subgraph_ids(0, handle.get_stream());
+  for (size_t i = 0; i < num_subgraphs; ++i) {
+    auto subgraph_roots = select_random_vertices(handle,
+                                                 graph_view,
+                                                 std::optional<raft::device_span<vertex_t const>>{
+                                                   std::nullopt},
+                                                 rng_state,
+                                                 num_roots_per_subgraph,
+                                                 false,
+                                                 false);
+    auto old_size = roots.size();
+    roots.resize(old_size + subgraph_roots.size(), handle.get_stream());
+    root_subgraph_ids.resize(roots.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 subgraph_roots.begin(),
+                 subgraph_roots.end(),
+                 roots.begin() + old_size);
+    thrust::fill(handle.get_thrust_policy(),
+                 root_subgraph_ids.begin() + old_size,
+                 root_subgraph_ids.end(),
+                 static_cast<int32_t>(i));
+  }
+
+  if (walk_length == 0) {
+    return detail::extract_subgraphs_from_subgraph_vertex_pairs(handle,
+                                                                graph_view,
+                                                                edge_weight_view,
+                                                                std::move(root_subgraph_ids),
+                                                                std::move(roots),
+                                                                num_subgraphs,
+                                                                do_expensive_check);
+  }
+
+  // 2. collect the vertices visited by the random walks from the roots
+
+  auto [paths, path_weights] = uniform_random_walks(
+    handle,
+    rng_state,
+    graph_view,
+    edge_weight_view,
+    raft::device_span<vertex_t const>(roots.data(), roots.size()),
+    walk_length);
+  if (path_weights) {
+    (*path_weights).resize(0, handle.get_stream());
+    (*path_weights).shrink_to_fit(handle.get_stream());
+  }
+
+  rmm::device_uvector<int32_t> subgraph_ids(paths.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                                 divider_t<size_t>{walk_length + 1}),
+                 thrust::make_transform_iterator(thrust::make_counting_iterator(paths.size()),
+                                                 divider_t<size_t>{walk_length + 1}),
+                 root_subgraph_ids.begin(),
+                 subgraph_ids.begin());
+  root_subgraph_ids.resize(0, handle.get_stream());
+  root_subgraph_ids.shrink_to_fit(handle.get_stream());
+  roots.resize(0, handle.get_stream());
+  roots.shrink_to_fit(handle.get_stream());
+
+  auto pair_first = thrust::make_zip_iterator(paths.begin(), subgraph_ids.begin());
+  paths.resize(
+    static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        pair_first,
+                        pair_first + paths.size(),
+                        cuda::proclaim_return_type<bool>(
+                          [invalid_vertex = invalid_vertex_id<vertex_t>::value] __device__(
+                            auto pair) { return thrust::get<0>(pair) == invalid_vertex; })))),
+    handle.get_stream());
+  subgraph_ids.resize(paths.size(), handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    std::tie(paths, subgraph_ids) =
+      detail::shuffle_int_vertex_value_pairs_to_local_gpu_by_vertex_partitioning(
+        handle,
+        std::move(paths),
+        std::move(subgraph_ids),
+        graph_view.vertex_partition_range_lasts());
+  }
+
+  // 3. extract the induced subgraphs
+
+  return detail::extract_subgraphs_from_subgraph_vertex_pairs(handle,
+                                                              graph_view,
+                                                              edge_weight_view,
+                                                              std::move(subgraph_ids),
+                                                              std::move(paths),
+                                                              num_subgraphs,
+                                                              do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "sampling/detail/sampling_utils.hpp"
+#include "sampling/neighbor_sampling_impl.hpp"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           std::optional<rmm::device_uvector<edge_t>>,
+           std::optional<rmm::device_uvector<edge_type_t>>,
+           std::optional<rmm::device_uvector<int32_t>>,
+           std::optional<rmm::device_uvector<size_t>>>
+heterogeneous_uniform_temporal_neighbor_sample(
+  raft::handle_t const& handle,
+  raft::random::RngState& rng_state,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view,
+  raft::device_span<vertex_t const> starting_vertices,
+  raft::device_span<edge_time_t const> starting_vertex_time_bounds,
+  std::optional<edge_time_t> time_window,
+  std::optional<raft::device_span<int32_t const>> starting_vertex_labels,
+  std::optional<raft::device_span<int32_t const>> label_to_output_comm_rank,
+  raft::host_span<int32_t const> fan_out,
+  edge_type_t num_edge_types,
+  sampling_flags_t sampling_flags,
+  bool do_expensive_check)
+{
+  using bias_t = weight_t;  // dummy
+
+  CUGRAPH_EXPECTS(starting_vertex_time_bounds.size() == starting_vertices.size(),
+                  "Invalid input argument: starting_vertex_time_bounds size does not match with "
+                  "starting_vertices size.");
+  CUGRAPH_EXPECTS(!starting_vertex_labels || ((*starting_vertex_labels).size() ==
+                                              starting_vertices.size()),
+                  "Invalid input argument: starting_vertex_labels size does not match with "
+                  "starting_vertices size.");
+  CUGRAPH_EXPECTS(!time_window || (*time_window > edge_time_t{0}),
+                  "Invalid input argument: time_window should be positive.");
+  CUGRAPH_EXPECTS(
+    !label_to_output_comm_rank || starting_vertex_labels,
+    "cannot specify output GPU mapping without also specifying starting_vertex_labels");
+
+  // 1. label every starting vertex with its global index (the frontier labels are used to look up
+  // the time bounds)
+
+  size_t starting_vertex_first{0};
+  size_t num_starting_vertices{starting_vertices.size()};
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    auto starting_vertex_counts =
+      host_scalar_allgather(comm, starting_vertices.size(), handle.get_stream());
+    starting_vertex_first = std::reduce(starting_vertex_counts.begin(),
+                                        starting_vertex_counts.begin() + comm.get_rank(),
+                                        size_t{0});
+    num_starting_vertices =
+      std::reduce(starting_vertex_counts.begin(), starting_vertex_counts.end(), size_t{0});
+  }
+  CUGRAPH_EXPECTS(
+    num_starting_vertices <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+    "Invalid input argument: the number of starting vertices should not overflow int32_t.");
+
+  rmm::device_uvector<int32_t> starting_vertex_indices(starting_vertices.size(),
+                                                       handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   starting_vertex_indices.begin(),
+                   starting_vertex_indices.end(),
+                   static_cast<int32_t>(starting_vertex_first));
+
+  // 2. the time bounds (and the user labels) of every starting vertex should be accessible from
+  // every GPU
+
+  std::optional<rmm::device_uvector<edge_time_t>> aggregate_time_bounds{std::nullopt};
+  std::optional<rmm::device_uvector<int32_t>> aggregate_labels{std::nullopt};
+  if constexpr (multi_gpu) {
+    aggregate_time_bounds =
+      device_allgatherv(handle, handle.get_comms(), starting_vertex_time_bounds);
+    if (starting_vertex_labels) {
+      aggregate_labels = device_allgatherv(handle, handle.get_comms(), *starting_vertex_labels);
+    }
+  }
+
+  detail::temporal_sampling_params_t<edge_t, edge_time_t, int32_t> temporal_sampling_params{
+    edge_time_view,
+    aggregate_time_bounds ? raft::device_span<edge_time_t const>((*aggregate_time_bounds).data(),
+                                                                 (*aggregate_time_bounds).size())
+                          : starting_vertex_time_bounds,
+    time_window,
+    aggregate_labels ? std::make_optional(raft::device_span<int32_t const>(
+                         (*aggregate_labels).data(), (*aggregate_labels).size()))
+                     : starting_vertex_labels};
+
+  // 3. sample
+
+  auto [majors, minors, weights, edge_ids, edge_types, hops, labels, offsets] =
+    detail::neighbor_sample_impl<vertex_t, edge_t, weight_t, edge_type_t, bias_t>(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      edge_id_view,
+      edge_type_view,
+      std::optional<edge_property_view_t<edge_t, bias_t const*>>{
+        std::nullopt},  // Optional edge_bias_view
+      starting_vertices,
+      std::make_optional(raft::device_span<int32_t const>(starting_vertex_indices.data(),
+                                                          starting_vertex_indices.size())),
+      label_to_output_comm_rank,
+      fan_out,
+      num_edge_types,
+      sampling_flags.return_hops,
+      sampling_flags.with_replacement,
+      sampling_flags.prior_sources_behavior,
+      sampling_flags.dedupe_sources,
+      do_expensive_check,
+      std::nullopt,
+      std::nullopt,
+      std::make_optional(temporal_sampling_params));
+
+  return std::make_tuple(std::move(majors),
+                         std::move(minors),
+                         std::move(weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(hops),
+                         std::move(offsets));
+}
+
+}  // namespace cugraph
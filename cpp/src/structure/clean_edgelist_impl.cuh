@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <optional>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename weight_t>
+struct reduce_edge_weight_t {
+  edge_weight_reduce_op_t op{};
+
+  __device__ weight_t operator()(weight_t lhs, weight_t rhs) const
+  {
+    switch (op) {
+      case edge_weight_reduce_op_t::sum: return lhs + rhs;
+      case edge_weight_reduce_op_t::min: return lhs < rhs ? lhs : rhs;
+      case edge_weight_reduce_op_t::max: return lhs < rhs ? rhs : lhs;
+      default: return lhs;
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t>
+size_t estimate_clean_edgelist_peak_memory(size_t num_edges, bool has_weights, bool symmetrize)
+{
+  // the edge list is doubled if symmetrize is true, shuffling (the received edges coexist with the
+  // sent edges), sorting (thrust::sort_by_key's temporary buffer is about the size of the sorted
+  // data), and reducing (the reduced edges coexist with the sorted edges) all require about twice
+  // the (doubled) edge list size
+
+  auto bytes_per_edge    = 2 * sizeof(vertex_t) + (has_weights ? sizeof(weight_t) : size_t{0});
+  auto num_working_edges = symmetrize ? num_edges * 2 : num_edges;
+  return 2 * num_working_edges * bytes_per_edge;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+clean_edgelist(raft::handle_t const& handle,
+               rmm::device_uvector<vertex_t>&& edgelist_srcs,
+               rmm::device_uvector<vertex_t>&& edgelist_dsts,
+               std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+               bool remove_self_loops,
+               bool symmetrize,
+               edge_weight_reduce_op_t reduce_op)
+{
+  CUGRAPH_EXPECTS(edgelist_srcs.size() == edgelist_dsts.size(),
+                  "Invalid input arguments: edgelist_srcs.size() != edgelist_dsts.size().");
+  CUGRAPH_EXPECTS(!edgelist_weights || (edgelist_weights->size() == edgelist_srcs.size()),
+                  "Invalid input arguments: edgelist_weights->size() != edgelist_srcs.size().");
+
+  // an arbitrary weight can differ in the two directions of a symmetrized edge, use the minimum to
+  // keep the weights symmetric
+  if (symmetrize && (reduce_op == edge_weight_reduce_op_t::any)) {
+    reduce_op = edge_weight_reduce_op_t::min;
+  }
+
+  // 1. remove self-loops (in-place)
+
+  if (remove_self_loops) {
+    auto is_self_loop = [] __device__(auto e) { return thrust::get<0>(e) == thrust::get<1>(e); };
+    size_t num_edges{};
+    if (edgelist_weights) {
+      auto edge_first = thrust::make_zip_iterator(
+        edgelist_srcs.begin(), edgelist_dsts.begin(), edgelist_weights->begin());
+      num_edges = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          edge_first,
+                          edge_first + edgelist_srcs.size(),
+                          is_self_loop)));
+      edgelist_weights->resize(num_edges, handle.get_stream());
+    } else {
+      auto edge_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+      num_edges       = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          edge_first,
+                          edge_first + edgelist_srcs.size(),
+                          is_self_loop)));
+    }
+    edgelist_srcs.resize(num_edges, handle.get_stream());
+    edgelist_dsts.resize(num_edges, handle.get_stream());
+  }
+
+  // 2. append the reversed edges (the reversed edges are reduced with the multi-edges in the same
+  // direction in step 5, so there is no separate symmetrization pass)
+
+  if (symmetrize) {
+    auto num_edges = edgelist_srcs.size();
+    edgelist_srcs.resize(num_edges * 2, handle.get_stream());
+    edgelist_dsts.resize(num_edges * 2, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 edgelist_dsts.begin(),
+                 edgelist_dsts.begin() + num_edges,
+                 edgelist_srcs.begin() + num_edges);
+    thrust::copy(handle.get_thrust_policy(),
+                 edgelist_srcs.begin(),
+                 edgelist_srcs.begin() + num_edges,
+                 edgelist_dsts.begin() + num_edges);
+    if (edgelist_weights) {
+      edgelist_weights->resize(num_edges * 2, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   edgelist_weights->begin(),
+                   edgelist_weights->begin() + num_edges,
+                   edgelist_weights->begin() + num_edges);
+    }
+  }
+
+  // 3. shuffle (once)
+
+  if constexpr (multi_gpu) {
+    std::tie(edgelist_srcs,
+             edgelist_dsts,
+             edgelist_weights,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore) =
+      detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                     edge_t,
+                                                                                     weight_t,
+                                                                                     int32_t,
+                                                                                     int32_t>(
+        handle,
+        std::move(edgelist_srcs),
+        std::move(edgelist_dsts),
+        std::move(edgelist_weights),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
+  }
+
+  // 4. sort (once)
+
+  auto pair_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+  if (edgelist_weights) {
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        pair_first,
+                        pair_first + edgelist_srcs.size(),
+                        edgelist_weights->begin());
+  } else {
+    thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + edgelist_srcs.size());
+  }
+
+  // 5. reduce multi-edges (if symmetrize is true, this also reduces each edge with the reversed
+  // copies of the edges in the opposite direction)
+
+  if (edgelist_weights) {
+    rmm::device_uvector<vertex_t> reduced_srcs(edgelist_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> reduced_dsts(edgelist_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> reduced_weights(edgelist_weights->size(), handle.get_stream());
+    auto num_edges = static_cast<size_t>(thrust::distance(
+      reduced_weights.begin(),
+      thrust::get<1>(thrust::reduce_by_key(
+        handle.get_thrust_policy(),
+        pair_first,
+        pair_first + edgelist_srcs.size(),
+        edgelist_weights->begin(),
+        thrust::make_zip_iterator(reduced_srcs.begin(), reduced_dsts.begin()),
+        reduced_weights.begin(),
+        thrust::equal_to<thrust::tuple<vertex_t, vertex_t>>{},
+        detail::reduce_edge_weight_t<weight_t>{reduce_op}))));
+    edgelist_srcs.resize(0, handle.get_stream());
+    edgelist_srcs.shrink_to_fit(handle.get_stream());
+    edgelist_dsts.resize(0, handle.get_stream());
+    edgelist_dsts.shrink_to_fit(handle.get_stream());
+    edgelist_weights->resize(0, handle.get_stream());
+    edgelist_weights->shrink_to_fit(handle.get_stream());
+    reduced_srcs.resize(num_edges, handle.get_stream());
+    reduced_srcs.shrink_to_fit(handle.get_stream());
+    reduced_dsts.resize(num_edges, handle.get_stream());
+    reduced_dsts.shrink_to_fit(handle.get_stream());
+    reduced_weights.resize(num_edges, handle.get_stream());
+    reduced_weights.shrink_to_fit(handle.get_stream());
+    edgelist_srcs     = std::move(reduced_srcs);
+    edgelist_dsts     = std::move(reduced_dsts);
+    *edgelist_weights = std::move(reduced_weights);
+  } else {
+    auto num_edges = static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + edgelist_srcs.size())));
+    edgelist_srcs.resize(num_edges, handle.get_stream());
+    edgelist_srcs.shrink_to_fit(handle.get_stream());
+    edgelist_dsts.resize(num_edges, handle.get_stream());
+    edgelist_dsts.shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(
+    std::move(edgelist_srcs), std::move(edgelist_dsts), std::move(edgelist_weights));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/clean_edgelist_impl.cuh"
+
+namespace cugraph {
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>>
+clean_edgelist<int64_t, int64_t, float, false>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  bool remove_self_loops,
+  bool symmetrize,
+  edge_weight_reduce_op_t reduce_op);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>>
+clean_edgelist<int64_t, int64_t, double, false>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  bool remove_self_loops,
+  bool symmetrize,
+  edge_weight_reduce_op_t reduce_op);
+
+template size_t estimate_clean_edgelist_peak_memory<int64_t, float>(size_t num_edges,
+                                                                    bool has_weights,
+                                                                    bool symmetrize);
+
+template size_t estimate_clean_edgelist_peak_memory<int64_t, double>(size_t num_edges,
+                                                                     bool has_weights,
+                                                                     bool symmetrize);
+
+}  // namespace cugraph
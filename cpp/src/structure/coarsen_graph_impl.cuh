@@ -34,9 +34,12 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/atomic>
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
@@ -50,7 +53,9 @@
 #include <thrust/unique.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -75,6 +80,198 @@ struct is_not_self_loop_t {
   }
 };
 
+template <typename vertex_t>
+struct count_major_bucket_size_t {
+  raft::device_span<vertex_t const> majors{};
+  vertex_t major_first{};
+  raft::device_span<size_t> bucket_sizes{};
+
+  __device__ void operator()(size_t i) const
+  {
+    cuda::atomic_ref<size_t, cuda::thread_scope_device> size(bucket_sizes[majors[i] - major_first]);
+    size.fetch_add(size_t{1}, cuda::std::memory_order_relaxed);
+  }
+};
+
+// insert the minor of every edge to the hash table of the edge's major (a bucket of twice the
+// major's edge count slots, so probing always finds a slot), the representative of a (major,
+// minor) pair is the smallest edge index with the pair
+template <typename vertex_t>
+struct insert_to_major_bucket_t {
+  raft::device_span<vertex_t const> majors{};
+  raft::device_span<vertex_t const> minors{};
+  vertex_t major_first{};
+  raft::device_span<size_t const> bucket_offsets{};
+  raft::device_span<vertex_t> slot_minors{};
+  raft::device_span<size_t> slot_representatives{};
+  raft::device_span<size_t> edge_slots{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto minor      = minors[i];
+    auto bucket_idx = majors[i] - major_first;
+    auto slot_first = bucket_offsets[bucket_idx] * 2;
+    auto num_slots  = (bucket_offsets[bucket_idx + 1] - bucket_offsets[bucket_idx]) * 2;
+    auto slot =
+      static_cast<size_t>((static_cast<uint64_t>(minor) * uint64_t{0x9e3779b97f4a7c15}) >> 32) %
+      num_slots;
+    while (true) {
+      cuda::atomic_ref<vertex_t, cuda::thread_scope_device> minor_ref(
+        slot_minors[slot_first + slot]);
+      auto expected = invalid_vertex_id_v<vertex_t>;
+      if (minor_ref.compare_exchange_strong(expected, minor, cuda::std::memory_order_relaxed) ||
+          (expected == minor)) {
+        break;
+      }
+      slot = (slot + 1) % num_slots;
+    }
+    cuda::atomic_ref<size_t, cuda::thread_scope_device> representative(
+      slot_representatives[slot_first + slot]);
+    representative.fetch_min(i, cuda::std::memory_order_relaxed);
+    edge_slots[i] = slot_first + slot;
+  }
+};
+
+template <typename weight_t>
+struct accumulate_to_representative_t {
+  raft::device_span<size_t const> representatives{};
+  raft::device_span<weight_t const> weights{};
+  raft::device_span<weight_t> weight_sums{};
+
+  __device__ void operator()(size_t i) const
+  {
+    cuda::atomic_ref<weight_t, cuda::thread_scope_device> sum(weight_sums[representatives[i]]);
+    sum.fetch_add(weights[i], cuda::std::memory_order_relaxed);
+  }
+};
+
+struct is_not_representative_t {
+  __device__ bool operator()(thrust::tuple<size_t, size_t> p) const
+  {
+    return thrust::get<0>(p) != thrust::get<1>(p);
+  }
+};
+
+// Hash-based groupby: the edges are bucketed by major, every (major, minor) pair is mapped to the
+// index of a single representative edge with the major's hash table, and multi-edge weights are
+// accumulated into the representative. This avoids sorting the edges, but the summation order of
+// multi-edge weights is not deterministic (so the coarsened edge weights may differ in the last
+// bits between runs). The output is not sorted (create_graph_from_edgelist does not require sorted
+// input). The majors should be in [major_first, major_first + num_majors).
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+hash_groupby_e_and_coarsen_edgelist(rmm::device_uvector<vertex_t>&& edgelist_majors,
+                                    rmm::device_uvector<vertex_t>&& edgelist_minors,
+                                    std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+                                    vertex_t major_first,
+                                    size_t num_majors,
+                                    rmm::cuda_stream_view stream_view)
+{
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
+
+  rmm::device_uvector<size_t> representatives(edgelist_majors.size(), stream_view);
+  {
+    rmm::device_uvector<size_t> bucket_offsets(num_majors + 1, stream_view);
+    thrust::fill(
+      rmm::exec_policy(stream_view), bucket_offsets.begin(), bucket_offsets.end(), size_t{0});
+    thrust::for_each(
+      rmm::exec_policy(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(edgelist_majors.size()),
+      count_major_bucket_size_t<vertex_t>{
+        raft::device_span<vertex_t const>(edgelist_majors.data(), edgelist_majors.size()),
+        major_first,
+        raft::device_span<size_t>(bucket_offsets.data() + 1, num_majors)});
+    thrust::inclusive_scan(rmm::exec_policy(stream_view),
+                           bucket_offsets.begin() + 1,
+                           bucket_offsets.end(),
+                           bucket_offsets.begin() + 1);
+
+    rmm::device_uvector<vertex_t> slot_minors(edgelist_majors.size() * 2, stream_view);
+    rmm::device_uvector<size_t> slot_representatives(slot_minors.size(), stream_view);
+    thrust::fill(rmm::exec_policy(stream_view),
+                 slot_minors.begin(),
+                 slot_minors.end(),
+                 invalid_vertex_id_v<vertex_t>);
+    thrust::fill(rmm::exec_policy(stream_view),
+                 slot_representatives.begin(),
+                 slot_representatives.end(),
+                 std::numeric_limits<size_t>::max());
+    thrust::for_each(
+      rmm::exec_policy(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(edgelist_majors.size()),
+      insert_to_major_bucket_t<vertex_t>{
+        raft::device_span<vertex_t const>(edgelist_majors.data(), edgelist_majors.size()),
+        raft::device_span<vertex_t const>(edgelist_minors.data(), edgelist_minors.size()),
+        major_first,
+        raft::device_span<size_t const>(bucket_offsets.data(), bucket_offsets.size()),
+        raft::device_span<vertex_t>(slot_minors.data(), slot_minors.size()),
+        raft::device_span<size_t>(slot_representatives.data(), slot_representatives.size()),
+        raft::device_span<size_t>(representatives.data(), representatives.size())});
+    thrust::transform(rmm::exec_policy(stream_view),
+                      representatives.begin(),
+                      representatives.end(),
+                      representatives.begin(),
+                      indirection_t<size_t, size_t const*>{slot_representatives.data()});
+  }
+
+  auto stencil_first = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::make_counting_iterator(size_t{0}), representatives.begin()));
+
+  if (edgelist_weights) {
+    rmm::device_uvector<weight_t> weight_sums(edgelist_majors.size(), stream_view);
+    thrust::fill(
+      rmm::exec_policy(stream_view), weight_sums.begin(), weight_sums.end(), weight_t{0});
+    thrust::for_each(
+      rmm::exec_policy(stream_view),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(edgelist_majors.size()),
+      accumulate_to_representative_t<weight_t>{
+        raft::device_span<size_t const>(representatives.data(), representatives.size()),
+        raft::device_span<weight_t const>((*edgelist_weights).data(), (*edgelist_weights).size()),
+        raft::device_span<weight_t>(weight_sums.data(), weight_sums.size())});
+    (*edgelist_weights).resize(0, stream_view);
+    (*edgelist_weights).shrink_to_fit(stream_view);
+
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin(), weight_sums.begin()));
+    auto num_uniques = static_cast<size_t>(
+      thrust::distance(edge_first,
+                       thrust::remove_if(rmm::exec_policy(stream_view),
+                                         edge_first,
+                                         edge_first + edgelist_majors.size(),
+                                         stencil_first,
+                                         is_not_representative_t{})));
+    edgelist_majors.resize(num_uniques, stream_view);
+    edgelist_majors.shrink_to_fit(stream_view);
+    edgelist_minors.resize(num_uniques, stream_view);
+    edgelist_minors.shrink_to_fit(stream_view);
+    weight_sums.resize(num_uniques, stream_view);
+    weight_sums.shrink_to_fit(stream_view);
+
+    return std::make_tuple(
+      std::move(edgelist_majors), std::move(edgelist_minors), std::move(weight_sums));
+  } else {
+    auto num_uniques = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::remove_if(rmm::exec_policy(stream_view),
+                                         pair_first,
+                                         pair_first + edgelist_majors.size(),
+                                         stencil_first,
+                                         is_not_representative_t{})));
+    edgelist_majors.resize(num_uniques, stream_view);
+    edgelist_majors.shrink_to_fit(stream_view);
+    edgelist_minors.resize(num_uniques, stream_view);
+    edgelist_minors.shrink_to_fit(stream_view);
+
+    return std::make_tuple(std::move(edgelist_majors), std::move(edgelist_minors), std::nullopt);
+  }
+}
+
 template <typename vertex_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -82,8 +279,33 @@ std::tuple<rmm::device_uvector<vertex_t>,
 groupby_e_and_coarsen_edgelist(rmm::device_uvector<vertex_t>&& edgelist_majors,
                                rmm::device_uvector<vertex_t>&& edgelist_minors,
                                std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+                               coarsen_groupby_t groupby,
                                rmm::cuda_stream_view stream_view)
 {
+  if ((groupby == coarsen_groupby_t::hash) && (edgelist_majors.size() > 0)) {
+    auto major_first = thrust::reduce(rmm::exec_policy(stream_view),
+                                      edgelist_majors.begin(),
+                                      edgelist_majors.end(),
+                                      std::numeric_limits<vertex_t>::max(),
+                                      thrust::minimum<vertex_t>{});
+    auto major_last  = thrust::reduce(rmm::exec_policy(stream_view),
+                                     edgelist_majors.begin(),
+                                     edgelist_majors.end(),
+                                     vertex_t{0},
+                                     thrust::maximum<vertex_t>{});
+    auto num_majors  = static_cast<size_t>(major_last - major_first) + size_t{1};
+    // the bucket offsets array size is proportional to the major range, fall back to sorting if
+    // the majors are too sparse
+    if (num_majors <= edgelist_majors.size()) {
+      return hash_groupby_e_and_coarsen_edgelist(std::move(edgelist_majors),
+                                                 std::move(edgelist_minors),
+                                                 std::move(edgelist_weights),
+                                                 major_first,
+                                                 num_majors,
+                                                 stream_view);
+    }
+  }
+
   auto pair_first =
     thrust::make_zip_iterator(thrust::make_tuple(edgelist_majors.begin(), edgelist_minors.begin()));
 
@@ -153,7 +375,8 @@ decompress_edge_partition_to_relabeled_and_grouped_and_coarsened_edgelist(
   vertex_t const* major_label_first,
   EdgeMinorLabelInputWrapper const minor_label_input,
   std::optional<std::vector<vertex_t>> const& segment_offsets,
-  bool lower_triangular_only)
+  bool lower_triangular_only,
+  coarsen_groupby_t groupby)
 {
   static_assert(std::is_same_v<typename EdgeMinorLabelInputWrapper::value_type, vertex_t>);
 
@@ -242,6 +465,7 @@ decompress_edge_partition_to_relabeled_and_grouped_and_coarsened_edgelist(
   return groupby_e_and_coarsen_edgelist(std::move(edgelist_majors),
                                         std::move(edgelist_minors),
                                         std::move(edgelist_weights),
+                                        groupby,
                                         handle.get_stream());
 }
 
@@ -251,11 +475,17 @@ namespace detail {
 
 // FIXME: This function needs to be updated to support edge id/type
 // multi-GPU version
+// does nothing, coarsen_graph on a graph view does not own the input graph
+struct keep_input_graph_t {
+  void operator()() const {}
+};
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
           bool store_transposed,
-          bool multi_gpu>
+          bool multi_gpu,
+          typename ReleaseInputOp>
 std::enable_if_t<
   multi_gpu,
   std::tuple<
@@ -268,7 +498,9 @@ coarsen_graph(raft::handle_t const& handle,
               std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
               vertex_t const* labels,
               bool renumber,
-              bool do_expensive_check)
+              coarsen_groupby_t groupby,
+              bool do_expensive_check,
+              ReleaseInputOp release_input)
 {
   auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
 
@@ -345,7 +577,8 @@ coarsen_graph(raft::handle_t const& handle,
         major_labels.data(),
         edge_minor_labels.view(),
         graph_view.local_edge_partition_segment_offsets(i),
-        lower_triangular_only);
+        lower_triangular_only,
+        groupby);
 
     // 1-2. globally shuffle
 
@@ -377,6 +610,7 @@ coarsen_graph(raft::handle_t const& handle,
       groupby_e_and_coarsen_edgelist(std::move(edgelist_majors),
                                      std::move(edgelist_minors),
                                      std::move(edgelist_weights),
+                                     groupby,
                                      handle.get_stream());
 
     coarsened_edgelist_majors.push_back(std::move(edgelist_majors));
@@ -437,6 +671,7 @@ coarsen_graph(raft::handle_t const& handle,
     groupby_e_and_coarsen_edgelist(std::move(concatenated_edgelist_majors),
                                    std::move(concatenated_edgelist_minors),
                                    std::move(concatenated_edgelist_weights),
+                                   groupby,
                                    handle.get_stream());
 
   if (lower_triangular_only) {
@@ -534,9 +769,16 @@ coarsen_graph(raft::handle_t const& handle,
     }
   }
 
+  // the coarsened edge list is complete, release the input graph (if owned) before creating the
+  // coarsened graph (graph_view should not be accessed afterwards)
+
+  auto is_symmetric                      = graph_view.is_symmetric();
+  auto local_vertex_partition_range_size = graph_view.local_vertex_partition_range_size();
+  release_input();
+
   // 3. find unique labels for this GPU
 
-  rmm::device_uvector<vertex_t> unique_labels(graph_view.local_vertex_partition_range_size(),
+  rmm::device_uvector<vertex_t> unique_labels(local_vertex_partition_range_size,
                                               handle.get_stream());
   thrust::copy(
     handle.get_thrust_policy(), labels, labels + unique_labels.size(), unique_labels.begin());
@@ -575,7 +817,7 @@ coarsen_graph(raft::handle_t const& handle,
       std::move(concatenated_edgelist_weights),
       std::nullopt,
       std::nullopt,
-      graph_properties_t{graph_view.is_symmetric(), false},
+      graph_properties_t{is_symmetric, false},
       true,
       do_expensive_check);
 
@@ -589,7 +831,8 @@ template <typename vertex_t,
           typename edge_t,
           typename weight_t,
           bool store_transposed,
-          bool multi_gpu>
+          bool multi_gpu,
+          typename ReleaseInputOp>
 std::enable_if_t<
   !multi_gpu,
   std::tuple<
@@ -602,7 +845,9 @@ coarsen_graph(raft::handle_t const& handle,
               std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
               vertex_t const* labels,
               bool renumber,
-              bool do_expensive_check)
+              coarsen_groupby_t groupby,
+              bool do_expensive_check,
+              ReleaseInputOp release_input)
 {
   if (do_expensive_check) {
     if (!renumber) {
@@ -639,7 +884,8 @@ coarsen_graph(raft::handle_t const& handle,
       labels,
       detail::edge_minor_property_view_t<vertex_t, vertex_t const*>(labels, vertex_t{0}),
       graph_view.local_edge_partition_segment_offsets(0),
-      lower_triangular_only);
+      lower_triangular_only,
+      groupby);
 
   if (lower_triangular_only) {
     if (coarsened_edgelist_weights) {
@@ -697,7 +943,13 @@ coarsen_graph(raft::handle_t const& handle,
     }
   }
 
+  // the coarsened edge list is complete, release the input graph (if owned) before creating the
+  // coarsened graph (graph_view should not be accessed afterwards)
+
+  auto is_symmetric = graph_view.is_symmetric();
   rmm::device_uvector<vertex_t> vertices(graph_view.number_of_vertices(), handle.get_stream());
+  release_input();
+
   if (renumber) {
     thrust::copy(handle.get_thrust_policy(), labels, labels + vertices.size(), vertices.begin());
     thrust::sort(handle.get_thrust_policy(), vertices.begin(), vertices.end());
@@ -732,7 +984,7 @@ coarsen_graph(raft::handle_t const& handle,
       std::move(coarsened_edgelist_weights),
       std::nullopt,
       std::nullopt,
-      graph_properties_t{graph_view.is_symmetric(), false},
+      graph_properties_t{is_symmetric, false},
       renumber,
       do_expensive_check);
 
@@ -759,8 +1011,78 @@ coarsen_graph(raft::handle_t const& handle,
               bool renumber,
               bool do_expensive_check)
 {
+  return detail::coarsen_graph(handle,
+                               graph_view,
+                               edge_weight_view,
+                               labels,
+                               renumber,
+                               coarsen_groupby_t::sort,
+                               do_expensive_check,
+                               detail::keep_input_graph_t{});
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+              std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+              vertex_t const* labels,
+              bool renumber,
+              coarsen_groupby_t groupby,
+              bool do_expensive_check)
+{
+  return detail::coarsen_graph(handle,
+                               graph_view,
+                               edge_weight_view,
+                               labels,
+                               renumber,
+                               groupby,
+                               do_expensive_check,
+                               detail::keep_input_graph_t{});
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>&&
+    edge_weights,
+  vertex_t const* labels,
+  bool renumber,
+  bool do_expensive_check)
+{
+  auto graph_view       = graph.view();
+  auto edge_weight_view = edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
   return detail::coarsen_graph(
-    handle, graph_view, edge_weight_view, labels, renumber, do_expensive_check);
+    handle,
+    graph_view,
+    edge_weight_view,
+    labels,
+    renumber,
+    coarsen_groupby_t::sort,
+    do_expensive_check,
+    [&handle, &graph, &edge_weights]() {
+      edge_weights = std::nullopt;
+      graph        = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(handle);
+    });
 }
 
 }  // namespace cugraph
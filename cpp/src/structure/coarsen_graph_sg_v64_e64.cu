@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -63,4 +63,103 @@ coarsen_graph(raft::handle_t const& handle,
               bool renumber,
               bool do_expensive_check);
 
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+              int64_t const* labels,
+              bool renumber,
+              coarsen_groupby_t groupby,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+              int64_t const* labels,
+              bool renumber,
+              coarsen_groupby_t groupby,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+              int64_t const* labels,
+              bool renumber,
+              coarsen_groupby_t groupby,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+              int64_t const* labels,
+              bool renumber,
+              coarsen_groupby_t groupby,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, true, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>&& edge_weights,
+  int64_t const* labels,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>&&
+    edge_weights,
+  int64_t const* labels,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, true, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>&&
+    edge_weights,
+  int64_t const* labels,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+coarsen_graph(
+  raft::handle_t const& handle,
+  graph_t<int64_t, int64_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>&&
+    edge_weights,
+  int64_t const* labels,
+  bool renumber,
+  bool do_expensive_check);
+
 }  // namespace cugraph
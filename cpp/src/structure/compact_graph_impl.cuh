@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "structure/detail/structure_utils.cuh"
+
+#include <cugraph/detail/decompress_edge_partition.cuh>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/mask_utils.cuh>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// number_of_edges is the global number of the (unmasked) edges of graph_view
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>
+compact_graph_impl(raft::handle_t const& handle,
+                   graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                   std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+                   edge_t number_of_edges)
+{
+  using graph_type      = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+  using graph_view_type = graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+
+  auto total_global_mem = handle.get_device_properties().totalGlobalMem;
+  auto element_size     = sizeof(vertex_t) * 2 + (edge_weight_view ? sizeof(weight_t) : size_t{0});
+  auto constexpr mem_frugal_ratio =
+    0.05;  // if the expected temporary buffer size exceeds the mem_frugal_ratio of the
+           // total_global_mem, switch to the memory frugal approach
+  auto mem_frugal_threshold =
+    static_cast<size_t>(static_cast<double>(total_global_mem / element_size) * mem_frugal_ratio);
+
+  // 1. decompress the (unmasked) edges of each local edge partition and recompress (using the same
+  // vertex partitioning and segment offsets) to freshly allocated buffers
+
+  std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices{};
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> edge_partition_weights{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<vertex_t>>> edge_partition_dcs_nzd_vertices{
+    std::nullopt};
+  edge_partition_offsets.reserve(graph_view.number_of_local_edge_partitions());
+  edge_partition_indices.reserve(graph_view.number_of_local_edge_partitions());
+  if (edge_weight_view) {
+    edge_partition_weights = std::vector<rmm::device_uvector<weight_t>>{};
+    (*edge_partition_weights).reserve(graph_view.number_of_local_edge_partitions());
+  }
+
+  auto edge_mask_view = graph_view.edge_mask_view();
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition_view = graph_view.local_edge_partition_view(i);
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(edge_partition_view);
+
+    auto num_edges = edge_mask_view
+                       ? detail::count_set_bits(handle,
+                                                (*edge_mask_view).value_firsts()[i],
+                                                edge_partition.number_of_edges())
+                       : edge_partition.number_of_edges();
+
+    rmm::device_uvector<vertex_t> majors(num_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> minors(num_edges, handle.get_stream());
+    auto weights = edge_weight_view ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                        num_edges, handle.get_stream())
+                                    : std::nullopt;
+
+    detail::decompress_edge_partition_to_edgelist<vertex_t, edge_t, weight_t, int32_t, multi_gpu>(
+      handle,
+      edge_partition,
+      edge_weight_view
+        ? std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, weight_t const*>>(
+            *edge_weight_view, i)
+        : std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      edge_mask_view
+        ? std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>(
+            *edge_mask_view, i)
+        : std::nullopt,
+      raft::device_span<vertex_t>(majors.data(), majors.size()),
+      raft::device_span<vertex_t>(minors.data(), minors.size()),
+      weights ? std::make_optional<raft::device_span<weight_t>>((*weights).data(), num_edges)
+              : std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      graph_view.local_edge_partition_segment_offsets(i));
+
+    rmm::device_uvector<edge_t> offsets(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> indices(0, handle.get_stream());
+    std::optional<rmm::device_uvector<vertex_t>> dcs_nzd_vertices{std::nullopt};
+    if (weights) {
+      rmm::device_uvector<weight_t> values(0, handle.get_stream());
+      std::tie(offsets, indices, values, dcs_nzd_vertices) =
+        detail::sort_and_compress_edgelist<vertex_t, edge_t, weight_t, store_transposed>(
+          std::move(store_transposed ? minors : majors),
+          std::move(store_transposed ? majors : minors),
+          std::move(*weights),
+          edge_partition_view.major_range_first(),
+          edge_partition_view.major_hypersparse_first(),
+          edge_partition_view.major_range_last(),
+          edge_partition_view.minor_range_first(),
+          edge_partition_view.minor_range_last(),
+          mem_frugal_threshold,
+          handle.get_stream());
+      (*edge_partition_weights).push_back(std::move(values));
+    } else {
+      std::tie(offsets, indices, dcs_nzd_vertices) =
+        detail::sort_and_compress_edgelist<vertex_t, edge_t, store_transposed>(
+          std::move(store_transposed ? minors : majors),
+          std::move(store_transposed ? majors : minors),
+          edge_partition_view.major_range_first(),
+          edge_partition_view.major_hypersparse_first(),
+          edge_partition_view.major_range_last(),
+          edge_partition_view.minor_range_first(),
+          edge_partition_view.minor_range_last(),
+          mem_frugal_threshold,
+          handle.get_stream());
+    }
+    edge_partition_offsets.push_back(std::move(offsets));
+    edge_partition_indices.push_back(std::move(indices));
+    if (dcs_nzd_vertices) {
+      if (!edge_partition_dcs_nzd_vertices) {
+        edge_partition_dcs_nzd_vertices = std::vector<rmm::device_uvector<vertex_t>>{};
+        (*edge_partition_dcs_nzd_vertices).reserve(graph_view.number_of_local_edge_partitions());
+      }
+      (*edge_partition_dcs_nzd_vertices).push_back(std::move(*dcs_nzd_vertices));
+    }
+  }
+
+  // 2. construct the compacted graph object (the degree based segment offsets are reused, they
+  // only affect load balancing)
+
+  graph_properties_t properties{graph_view.is_symmetric(), graph_view.is_multigraph()};
+  graph_type graph(handle);
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    std::vector<vertex_t> vertex_partition_range_offsets(vertex_partition_range_lasts.size() + 1,
+                                                         vertex_t{0});
+    std::copy(vertex_partition_range_lasts.begin(),
+              vertex_partition_range_lasts.end(),
+              vertex_partition_range_offsets.begin() + 1);
+
+    std::vector<vertex_t> edge_partition_segment_offsets{};
+    std::optional<std::vector<vertex_t>> edge_partition_hypersparse_degree_offsets{std::nullopt};
+    for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+      auto segment_offsets = graph_view.local_edge_partition_segment_offsets(i);
+      CUGRAPH_EXPECTS(segment_offsets.has_value(),
+                      "Invalid graph object: multi-GPU graphs should have segment offsets.");
+      edge_partition_segment_offsets.insert(
+        edge_partition_segment_offsets.end(), (*segment_offsets).begin(), (*segment_offsets).end());
+      auto hypersparse_degree_offsets =
+        graph_view.local_edge_partition_hypersparse_degree_offsets(i);
+      if (hypersparse_degree_offsets) {
+        if (!edge_partition_hypersparse_degree_offsets) {
+          edge_partition_hypersparse_degree_offsets = std::vector<vertex_t>{};
+        }
+        (*edge_partition_hypersparse_degree_offsets)
+          .insert((*edge_partition_hypersparse_degree_offsets).end(),
+                  (*hypersparse_degree_offsets).begin(),
+                  (*hypersparse_degree_offsets).end());
+      }
+    }
+
+    graph = graph_type(handle,
+                       std::move(edge_partition_offsets),
+                       std::move(edge_partition_indices),
+                       std::move(edge_partition_dcs_nzd_vertices),
+                       graph_meta_t<vertex_t, edge_t, multi_gpu>{
+                         graph_view.number_of_vertices(),
+                         number_of_edges,
+                         properties,
+                         partition_t<vertex_t>(vertex_partition_range_offsets,
+                                               major_comm.get_size(),
+                                               minor_comm.get_size(),
+                                               major_comm.get_rank(),
+                                               minor_comm.get_rank()),
+                         edge_partition_segment_offsets,
+                         edge_partition_hypersparse_degree_offsets});
+  } else {
+    graph = graph_type(handle,
+                       std::move(edge_partition_offsets[0]),
+                       std::move(edge_partition_indices[0]),
+                       graph_meta_t<vertex_t, edge_t, multi_gpu>{
+                         graph_view.number_of_vertices(),
+                         properties,
+                         graph_view.local_vertex_partition_segment_offsets(),
+                         graph_view.local_vertex_partition_hypersparse_degree_offsets()});
+  }
+
+  std::optional<edge_property_t<graph_view_type, weight_t>> edge_weights{std::nullopt};
+  if (edge_partition_weights) {
+    edge_weights = edge_property_t<graph_view_type, weight_t>(std::move(*edge_partition_weights));
+  }
+
+  return std::make_tuple(std::move(graph), std::move(edge_weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+              std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+              bool do_expensive_check)
+{
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  return detail::compact_graph_impl(
+    handle, graph_view, edge_weight_view, graph_view.compute_number_of_edges(handle));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::optional<std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>>
+compact_graph_if_sparse(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  double density_threshold,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(density_threshold >= 0.0,
+                  "Invalid input argument: density_threshold should be non-negative.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  if (!graph_view.has_edge_mask()) { return std::nullopt; }
+
+  // check the live edge fraction (compute_number_of_edges returns the global count, so every GPU
+  // makes the same decision)
+
+  auto unmasked_graph_view = graph_view;
+  unmasked_graph_view.clear_edge_mask();
+  auto number_of_edges = graph_view.compute_number_of_edges(handle);
+  if (static_cast<double>(number_of_edges) >=
+      density_threshold * static_cast<double>(unmasked_graph_view.number_of_edges())) {
+    return std::nullopt;
+  }
+
+  return std::make_optional(
+    detail::compact_graph_impl(handle, graph_view, edge_weight_view, number_of_edges));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/compact_graph_impl.cuh"
+
+namespace cugraph {
+
+template std::optional<std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>>>
+compact_graph_if_sparse(raft::handle_t const& handle,
+                        graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                        std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+                        double density_threshold,
+                        bool do_expensive_check);
+
+template std::optional<std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>>>
+compact_graph_if_sparse(raft::handle_t const& handle,
+                        graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+                        std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+                        double density_threshold,
+                        bool do_expensive_check);
+
+template std::optional<std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>>>
+compact_graph_if_sparse(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  double density_threshold,
+  bool do_expensive_check);
+
+template std::optional<std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>>>
+compact_graph_if_sparse(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  double density_threshold,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+              bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>>
+compact_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+              std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+              bool do_expensive_check);
+
+}  // namespace cugraph
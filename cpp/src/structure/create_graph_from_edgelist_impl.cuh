@@ -17,6 +17,7 @@
 
 #include "cugraph/edge_partition_view.hpp"
 #include "detail/graph_partition_utils.cuh"
+#include "prims/detail/multi_stream_utils.cuh"
 #include "structure/detail/structure_utils.cuh"
 
 #include <cugraph/detail/shuffle_wrappers.hpp>
@@ -29,6 +30,7 @@
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/memory_resource_hints.hpp>
 
 #include <raft/core/handle.hpp>
 
@@ -38,12 +40,16 @@
 #include <thrust/distance.h>
 #include <thrust/equal.h>
 #include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
 #include <cstdint>
+#include <limits>
 #include <numeric>
 #include <variant>
 
@@ -467,34 +473,44 @@ create_graph_from_partitioned_edgelist(
     edge_partition_edgelist_edge_end_times,
   std::vector<std::vector<edge_t>> const& edgelist_intra_partition_segment_offset_vectors,
   graph_properties_t graph_properties,
-  bool renumber)
+  bool renumber,
+  std::optional<renumber_meta_t<vertex_t, edge_t, true>>&& shared_vertex_meta = std::nullopt)
 {
   auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
   auto const major_comm_size = major_comm.get_size();
   auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
   auto const minor_comm_size = minor_comm.get_size();
 
-  // 1. renumber
+  // 1. renumber (skipped if the edge list is already renumbered with the renumber map of an
+  // existing graph, in this case, shared_vertex_meta holds the vertex partitioning of that graph)
 
-  std::vector<edge_t> edgelist_edge_counts(minor_comm_size, edge_t{0});
-  for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
-    edgelist_edge_counts[i] = static_cast<edge_t>(edge_partition_edgelist_srcs[i].size());
-  }
+  std::optional<rmm::device_uvector<vertex_t>> renumber_map_labels{std::nullopt};
+  renumber_meta_t<vertex_t, edge_t, true> meta{};
+  if (shared_vertex_meta) {
+    meta = std::move(*shared_vertex_meta);
+  } else {
+    std::vector<edge_t> edgelist_edge_counts(minor_comm_size, edge_t{0});
+    for (size_t i = 0; i < edgelist_edge_counts.size(); ++i) {
+      edgelist_edge_counts[i] = static_cast<edge_t>(edge_partition_edgelist_srcs[i].size());
+    }
 
-  std::vector<vertex_t*> src_ptrs(minor_comm_size);
-  std::vector<vertex_t*> dst_ptrs(src_ptrs.size());
-  for (int i = 0; i < minor_comm_size; ++i) {
-    src_ptrs[i] = edge_partition_edgelist_srcs[i].begin();
-    dst_ptrs[i] = edge_partition_edgelist_dsts[i].begin();
+    std::vector<vertex_t*> src_ptrs(minor_comm_size);
+    std::vector<vertex_t*> dst_ptrs(src_ptrs.size());
+    for (int i = 0; i < minor_comm_size; ++i) {
+      src_ptrs[i] = edge_partition_edgelist_srcs[i].begin();
+      dst_ptrs[i] = edge_partition_edgelist_dsts[i].begin();
+    }
+    auto [labels, renumber_meta] = cugraph::renumber_edgelist<vertex_t, edge_t, true>(
+      handle,
+      std::move(local_vertices),
+      src_ptrs,
+      dst_ptrs,
+      edgelist_edge_counts,
+      edgelist_intra_partition_segment_offset_vectors,
+      store_transposed);
+    renumber_map_labels = std::move(labels);
+    meta                = std::move(renumber_meta);
   }
-  auto [renumber_map_labels, meta] = cugraph::renumber_edgelist<vertex_t, edge_t, true>(
-    handle,
-    std::move(local_vertices),
-    src_ptrs,
-    dst_ptrs,
-    edgelist_edge_counts,
-    edgelist_intra_partition_segment_offset_vectors,
-    store_transposed);
 
   auto num_segments_per_vertex_partition =
     static_cast<size_t>(meta.edge_partition_segment_offsets.size() / minor_comm_size);
@@ -576,188 +592,292 @@ create_graph_from_partitioned_edgelist(
     (*edge_partition_dcs_nzd_vertices).reserve(edge_partition_edgelist_srcs.size());
   }
 
-  for (size_t i = 0; i < edge_partition_edgelist_srcs.size(); ++i) {
-    auto [major_range_first, major_range_last] = meta.partition.local_edge_partition_major_range(i);
-    auto [minor_range_first, minor_range_last] = meta.partition.local_edge_partition_minor_range();
-    rmm::device_uvector<edge_t> offsets(size_t{0}, handle.get_stream());
-    rmm::device_uvector<vertex_t> indices(size_t{0}, handle.get_stream());
-    std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
-    std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
-    std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
-    std::optional<rmm::device_uvector<edge_time_t>> edge_start_times{std::nullopt};
-    std::optional<rmm::device_uvector<edge_time_t>> edge_end_times{std::nullopt};
-    std::optional<rmm::device_uvector<vertex_t>> dcs_nzd_vertices{std::nullopt};
-    auto major_hypersparse_first =
-      use_dcs
-        ? std::make_optional<vertex_t>(
-            major_range_first +
-            meta.edge_partition_segment_offsets[num_segments_per_vertex_partition * i +
-                                                detail::num_sparse_segments_per_vertex_partition])
-        : std::nullopt;
+  auto persistent_mr = get_memory_resource_hint(handle, memory_usage_t::persistent);
 
-    if (edge_property_count == 0) {
-      std::tie(offsets, indices, dcs_nzd_vertices) =
-        detail::sort_and_compress_edgelist<vertex_t, edge_t, store_transposed>(
-          std::move(edge_partition_edgelist_srcs[i]),
-          std::move(edge_partition_edgelist_dsts[i]),
-          major_range_first,
-          major_hypersparse_first,
-          major_range_last,
-          minor_range_first,
-          minor_range_last,
-          mem_frugal_threshold,
-          handle.get_stream());
-    } else if (edge_property_count == 1) {
-      if (edge_partition_edgelist_weights) {
-        std::tie(offsets, indices, weights, dcs_nzd_vertices) =
-          detail::sort_and_compress_edgelist<vertex_t, edge_t, weight_t, store_transposed>(
-            std::move(edge_partition_edgelist_srcs[i]),
-            std::move(edge_partition_edgelist_dsts[i]),
-            std::move((*edge_partition_edgelist_weights)[i]),
+  // process (up to) num_concurrent_partitions edge partitions concurrently on the stream pool (if
+  // available), small edge partitions leave the GPU underutilized if processed one at a time; the
+  // number of concurrent edge partitions is limited to bound the peak temporary memory usage
+  std::optional<std::vector<size_t>> stream_pool_indices{std::nullopt};
+  if (handle.is_stream_pool_initialized() && (edge_partition_edgelist_srcs.size() > 1)) {
+    auto max_tmp_buffer_size = static_cast<size_t>(static_cast<double>(total_global_mem) * 0.2);
+    size_t max_edge_partition_edge_count{0};
+    for (size_t i = 0; i < edge_partition_edgelist_srcs.size(); ++i) {
+      max_edge_partition_edge_count =
+        std::max(max_edge_partition_edge_count, edge_partition_edgelist_srcs[i].size());
+    }
+    stream_pool_indices = detail::init_stream_pool_indices(
+      max_tmp_buffer_size,
+      max_edge_partition_edge_count * element_size * 2,  // sort output & temporary storage
+      edge_partition_edgelist_srcs.size(),
+      1,
+      handle.get_stream_pool_size());
+    if ((*stream_pool_indices).size() <= 1) { stream_pool_indices = std::nullopt; }
+  }
+  auto num_concurrent_partitions = stream_pool_indices ? (*stream_pool_indices).size() : size_t{1};
+  if (stream_pool_indices) { handle.sync_stream(); }
+
+  for (size_t i = 0; i < edge_partition_edgelist_srcs.size(); i += num_concurrent_partitions) {
+    auto loop_count = std::min(num_concurrent_partitions, edge_partition_edgelist_srcs.size() - i);
+    for (size_t j = 0; j < loop_count; ++j) {
+      auto partition_idx = i + j;
+      auto loop_stream   = stream_pool_indices
+                             ? handle.get_stream_from_stream_pool((*stream_pool_indices)[j])
+                             : handle.get_stream();
+      if (stream_pool_indices) {  // to release the input buffers on loop_stream
+        edge_partition_edgelist_srcs[partition_idx].set_stream(loop_stream);
+        edge_partition_edgelist_dsts[partition_idx].set_stream(loop_stream);
+        if (edge_partition_edgelist_weights) {
+          (*edge_partition_edgelist_weights)[partition_idx].set_stream(loop_stream);
+        }
+        if (edge_partition_edgelist_edge_ids) {
+          (*edge_partition_edgelist_edge_ids)[partition_idx].set_stream(loop_stream);
+        }
+        if (edge_partition_edgelist_edge_types) {
+          (*edge_partition_edgelist_edge_types)[partition_idx].set_stream(loop_stream);
+        }
+        if (edge_partition_edgelist_edge_start_times) {
+          (*edge_partition_edgelist_edge_start_times)[partition_idx].set_stream(loop_stream);
+        }
+        if (edge_partition_edgelist_edge_end_times) {
+          (*edge_partition_edgelist_edge_end_times)[partition_idx].set_stream(loop_stream);
+        }
+      }
+
+      auto [major_range_first, major_range_last] =
+        meta.partition.local_edge_partition_major_range(partition_idx);
+      auto [minor_range_first, minor_range_last] =
+        meta.partition.local_edge_partition_minor_range();
+      rmm::device_uvector<edge_t> offsets(size_t{0}, loop_stream);
+      rmm::device_uvector<vertex_t> indices(size_t{0}, loop_stream);
+      std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+      std::optional<rmm::device_uvector<edge_t>> edge_ids{std::nullopt};
+      std::optional<rmm::device_uvector<edge_type_t>> edge_types{std::nullopt};
+      std::optional<rmm::device_uvector<edge_time_t>> edge_start_times{std::nullopt};
+      std::optional<rmm::device_uvector<edge_time_t>> edge_end_times{std::nullopt};
+      std::optional<rmm::device_uvector<vertex_t>> dcs_nzd_vertices{std::nullopt};
+      auto hypersparse_segment_idx = num_segments_per_vertex_partition * partition_idx +
+                                     detail::num_sparse_segments_per_vertex_partition;
+      auto major_hypersparse_first =
+        use_dcs ? std::make_optional<vertex_t>(
+                    major_range_first +
+                    meta.edge_partition_segment_offsets[hypersparse_segment_idx])
+                : std::nullopt;
+
+      if (edge_property_count == 0) {
+        std::tie(offsets, indices, dcs_nzd_vertices) =
+          detail::sort_and_compress_edgelist<vertex_t, edge_t, store_transposed>(
+            std::move(edge_partition_edgelist_srcs[partition_idx]),
+            std::move(edge_partition_edgelist_dsts[partition_idx]),
             major_range_first,
             major_hypersparse_first,
             major_range_last,
             minor_range_first,
             minor_range_last,
             mem_frugal_threshold,
-            handle.get_stream());
-      } else if (edge_partition_edgelist_edge_ids) {
-        std::tie(offsets, indices, edge_ids, dcs_nzd_vertices) =
+            loop_stream);
+      } else if (edge_property_count == 1) {
+        if (edge_partition_edgelist_weights) {
+          std::tie(offsets, indices, weights, dcs_nzd_vertices) =
+            detail::sort_and_compress_edgelist<vertex_t, edge_t, weight_t, store_transposed>(
+              std::move(edge_partition_edgelist_srcs[partition_idx]),
+              std::move(edge_partition_edgelist_dsts[partition_idx]),
+              std::move((*edge_partition_edgelist_weights)[partition_idx]),
+              major_range_first,
+              major_hypersparse_first,
+              major_range_last,
+              minor_range_first,
+              minor_range_last,
+              mem_frugal_threshold,
+              loop_stream);
+        } else if (edge_partition_edgelist_edge_ids) {
+          std::tie(offsets, indices, edge_ids, dcs_nzd_vertices) =
+            detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_t, store_transposed>(
+              std::move(edge_partition_edgelist_srcs[partition_idx]),
+              std::move(edge_partition_edgelist_dsts[partition_idx]),
+              std::move((*edge_partition_edgelist_edge_ids)[partition_idx]),
+              major_range_first,
+              major_hypersparse_first,
+              major_range_last,
+              minor_range_first,
+              minor_range_last,
+              mem_frugal_threshold,
+              loop_stream);
+        } else if (edge_partition_edgelist_edge_types) {
+          std::tie(offsets, indices, edge_types, dcs_nzd_vertices) =
+            detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_type_t, store_transposed>(
+              std::move(edge_partition_edgelist_srcs[partition_idx]),
+              std::move(edge_partition_edgelist_dsts[partition_idx]),
+              std::move((*edge_partition_edgelist_edge_types)[partition_idx]),
+              major_range_first,
+              major_hypersparse_first,
+              major_range_last,
+              minor_range_first,
+              minor_range_last,
+              mem_frugal_threshold,
+              loop_stream);
+        } else if (edge_partition_edgelist_edge_start_times) {
+          std::tie(offsets, indices, edge_start_times, dcs_nzd_vertices) =
+            detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_time_t, store_transposed>(
+              std::move(edge_partition_edgelist_srcs[partition_idx]),
+              std::move(edge_partition_edgelist_dsts[partition_idx]),
+              std::move((*edge_partition_edgelist_edge_start_times)[partition_idx]),
+              major_range_first,
+              major_hypersparse_first,
+              major_range_last,
+              minor_range_first,
+              minor_range_last,
+              mem_frugal_threshold,
+              loop_stream);
+        } else if (edge_partition_edgelist_edge_end_times) {
+          std::tie(offsets, indices, edge_end_times, dcs_nzd_vertices) =
+            detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_time_t, store_transposed>(
+              std::move(edge_partition_edgelist_srcs[partition_idx]),
+              std::move(edge_partition_edgelist_dsts[partition_idx]),
+              std::move((*edge_partition_edgelist_edge_end_times)[partition_idx]),
+              major_range_first,
+              major_hypersparse_first,
+              major_range_last,
+              minor_range_first,
+              minor_range_last,
+              mem_frugal_threshold,
+              loop_stream);
+        }
+      } else {
+        rmm::device_uvector<edge_t> property_position(
+          edge_partition_edgelist_srcs[partition_idx].size(), loop_stream);
+        detail::sequence_fill(
+          loop_stream, property_position.data(), property_position.size(), edge_t{0});
+
+        std::tie(offsets, indices, property_position, dcs_nzd_vertices) =
           detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_t, store_transposed>(
-            std::move(edge_partition_edgelist_srcs[i]),
-            std::move(edge_partition_edgelist_dsts[i]),
-            std::move((*edge_partition_edgelist_edge_ids)[i]),
-            major_range_first,
-            major_hypersparse_first,
-            major_range_last,
-            minor_range_first,
-            minor_range_last,
-            mem_frugal_threshold,
-            handle.get_stream());
-      } else if (edge_partition_edgelist_edge_types) {
-        std::tie(offsets, indices, edge_types, dcs_nzd_vertices) =
-          detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_type_t, store_transposed>(
-            std::move(edge_partition_edgelist_srcs[i]),
-            std::move(edge_partition_edgelist_dsts[i]),
-            std::move((*edge_partition_edgelist_edge_types)[i]),
+            std::move(edge_partition_edgelist_srcs[partition_idx]),
+            std::move(edge_partition_edgelist_dsts[partition_idx]),
+            std::move(property_position),
             major_range_first,
             major_hypersparse_first,
             major_range_last,
             minor_range_first,
             minor_range_last,
             mem_frugal_threshold,
-            handle.get_stream());
-      } else if (edge_partition_edgelist_edge_start_times) {
-        std::tie(offsets, indices, edge_start_times, dcs_nzd_vertices) =
-          detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_time_t, store_transposed>(
-            std::move(edge_partition_edgelist_srcs[i]),
-            std::move(edge_partition_edgelist_dsts[i]),
-            std::move((*edge_partition_edgelist_edge_start_times)[i]),
-            major_range_first,
-            major_hypersparse_first,
-            major_range_last,
-            minor_range_first,
-            minor_range_last,
-            mem_frugal_threshold,
-            handle.get_stream());
-      } else if (edge_partition_edgelist_edge_end_times) {
-        std::tie(offsets, indices, edge_end_times, dcs_nzd_vertices) =
-          detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_time_t, store_transposed>(
-            std::move(edge_partition_edgelist_srcs[i]),
-            std::move(edge_partition_edgelist_dsts[i]),
-            std::move((*edge_partition_edgelist_edge_end_times)[i]),
-            major_range_first,
-            major_hypersparse_first,
-            major_range_last,
-            minor_range_first,
-            minor_range_last,
-            mem_frugal_threshold,
-            handle.get_stream());
-      }
-    } else {
-      rmm::device_uvector<edge_t> property_position(edge_partition_edgelist_srcs[i].size(),
-                                                    handle.get_stream());
-      detail::sequence_fill(
-        handle.get_stream(), property_position.data(), property_position.size(), edge_t{0});
+            loop_stream);
+
+        if (edge_partition_edgelist_weights) {
+          weights = rmm::device_uvector<weight_t>(property_position.size(), loop_stream);
+          thrust::gather(rmm::exec_policy_nosync(loop_stream),
+                         property_position.begin(),
+                         property_position.end(),
+                         (*edge_partition_edgelist_weights)[partition_idx].begin(),
+                         weights->begin());
+        }
 
-      std::tie(offsets, indices, property_position, dcs_nzd_vertices) =
-        detail::sort_and_compress_edgelist<vertex_t, edge_t, edge_t, store_transposed>(
-          std::move(edge_partition_edgelist_srcs[i]),
-          std::move(edge_partition_edgelist_dsts[i]),
-          std::move(property_position),
-          major_range_first,
-          major_hypersparse_first,
-          major_range_last,
-          minor_range_first,
-          minor_range_last,
-          mem_frugal_threshold,
-          handle.get_stream());
+        if (edge_partition_edgelist_edge_ids) {
+          edge_ids = rmm::device_uvector<edge_t>(property_position.size(), loop_stream);
+          thrust::gather(rmm::exec_policy_nosync(loop_stream),
+                         property_position.begin(),
+                         property_position.end(),
+                         (*edge_partition_edgelist_edge_ids)[partition_idx].begin(),
+                         edge_ids->begin());
+        }
 
-      if (edge_partition_edgelist_weights) {
-        weights = rmm::device_uvector<weight_t>(property_position.size(), handle.get_stream());
-        thrust::gather(handle.get_thrust_policy(),
-                       property_position.begin(),
-                       property_position.end(),
-                       (*edge_partition_edgelist_weights)[i].begin(),
-                       weights->begin());
-      }
+        if (edge_partition_edgelist_edge_types) {
+          edge_types =
+            rmm::device_uvector<edge_type_t>(property_position.size(), loop_stream);
+          thrust::gather(rmm::exec_policy_nosync(loop_stream),
+                         property_position.begin(),
+                         property_position.end(),
+                         (*edge_partition_edgelist_edge_types)[partition_idx].begin(),
+                         edge_types->begin());
+        }
 
-      if (edge_partition_edgelist_edge_ids) {
-        edge_ids = rmm::device_uvector<edge_t>(property_position.size(), handle.get_stream());
-        thrust::gather(handle.get_thrust_policy(),
-                       property_position.begin(),
-                       property_position.end(),
-                       (*edge_partition_edgelist_edge_ids)[i].begin(),
-                       edge_ids->begin());
-      }
+        if (edge_partition_edgelist_edge_start_times) {
+          edge_start_times =
+            rmm::device_uvector<edge_time_t>(property_position.size(), loop_stream);
+          thrust::gather(rmm::exec_policy_nosync(loop_stream),
+                         property_position.begin(),
+                         property_position.end(),
+                         (*edge_partition_edgelist_edge_start_times)[partition_idx].begin(),
+                         edge_start_times->begin());
+        }
 
-      if (edge_partition_edgelist_edge_types) {
-        edge_types =
-          rmm::device_uvector<edge_type_t>(property_position.size(), handle.get_stream());
-        thrust::gather(handle.get_thrust_policy(),
-                       property_position.begin(),
-                       property_position.end(),
-                       (*edge_partition_edgelist_edge_types)[i].begin(),
-                       edge_types->begin());
+        if (edge_partition_edgelist_edge_end_times) {
+          edge_end_times =
+            rmm::device_uvector<edge_time_t>(property_position.size(), loop_stream);
+          thrust::gather(rmm::exec_policy_nosync(loop_stream),
+                         property_position.begin(),
+                         property_position.end(),
+                         (*edge_partition_edgelist_edge_end_times)[partition_idx].begin(),
+                         edge_end_times->begin());
+        }
       }
 
-      if (edge_partition_edgelist_edge_start_times) {
-        edge_start_times =
-          rmm::device_uvector<edge_time_t>(property_position.size(), handle.get_stream());
-        thrust::gather(handle.get_thrust_policy(),
-                       property_position.begin(),
-                       property_position.end(),
-                       (*edge_partition_edgelist_edge_start_times)[i].begin(),
-                       edge_start_times->begin());
+      if (persistent_mr) {  // relocate one edge partition at a time to limit the peak memory usage
+        auto stream = loop_stream;
+        offsets     = detail::move_to_memory_resource(std::move(offsets), *persistent_mr, stream);
+        indices     = detail::move_to_memory_resource(std::move(indices), *persistent_mr, stream);
+        if (weights) {
+          weights = detail::move_to_memory_resource(std::move(*weights), *persistent_mr, stream);
+        }
+        if (edge_ids) {
+          edge_ids = detail::move_to_memory_resource(std::move(*edge_ids), *persistent_mr, stream);
+        }
+        if (edge_types) {
+          edge_types =
+            detail::move_to_memory_resource(std::move(*edge_types), *persistent_mr, stream);
+        }
+        if (edge_start_times) {
+          edge_start_times =
+            detail::move_to_memory_resource(std::move(*edge_start_times), *persistent_mr, stream);
+        }
+        if (edge_end_times) {
+          edge_end_times =
+            detail::move_to_memory_resource(std::move(*edge_end_times), *persistent_mr, stream);
+        }
       }
 
-      if (edge_partition_edgelist_edge_end_times) {
-        edge_end_times =
-          rmm::device_uvector<edge_time_t>(property_position.size(), handle.get_stream());
-        thrust::gather(handle.get_thrust_policy(),
-                       property_position.begin(),
-                       property_position.end(),
-                       (*edge_partition_edgelist_edge_end_times)[i].begin(),
-                       edge_end_times->begin());
+      edge_partition_offsets.push_back(std::move(offsets));
+      edge_partition_indices.push_back(std::move(indices));
+      if (edge_partition_weights) { (*edge_partition_weights).push_back(std::move(*weights)); }
+      if (edge_partition_edge_ids) { (*edge_partition_edge_ids).push_back(std::move(*edge_ids)); }
+      if (edge_partition_edge_types) {
+        (*edge_partition_edge_types).push_back(std::move(*edge_types));
+      }
+      if (edge_partition_edge_start_times) {
+        (*edge_partition_edge_start_times).push_back(std::move(*edge_start_times));
+      }
+      if (edge_partition_edge_end_times) {
+        (*edge_partition_edge_end_times).push_back(std::move(*edge_end_times));
       }
-    }
 
-    edge_partition_offsets.push_back(std::move(offsets));
-    edge_partition_indices.push_back(std::move(indices));
-    if (edge_partition_weights) { (*edge_partition_weights).push_back(std::move(*weights)); }
-    if (edge_partition_edge_ids) { (*edge_partition_edge_ids).push_back(std::move(*edge_ids)); }
-    if (edge_partition_edge_types) {
-      (*edge_partition_edge_types).push_back(std::move(*edge_types));
-    }
-    if (edge_partition_edge_start_times) {
-      (*edge_partition_edge_start_times).push_back(std::move(*edge_start_times));
-    }
-    if (edge_partition_edge_end_times) {
-      (*edge_partition_edge_end_times).push_back(std::move(*edge_end_times));
+      if (edge_partition_dcs_nzd_vertices) {
+        (*edge_partition_dcs_nzd_vertices).push_back(std::move(*dcs_nzd_vertices));
+      }
     }
 
-    if (edge_partition_dcs_nzd_vertices) {
-      (*edge_partition_dcs_nzd_vertices).push_back(std::move(*dcs_nzd_vertices));
+    if (stream_pool_indices) {
+      handle.sync_stream_pool(*stream_pool_indices);
+      for (size_t j = 0; j < loop_count; ++j) {  // the outputs are used on the handle's stream
+        auto partition_idx = i + j;
+        edge_partition_offsets[partition_idx].set_stream(handle.get_stream());
+        edge_partition_indices[partition_idx].set_stream(handle.get_stream());
+        if (edge_partition_weights) {
+          (*edge_partition_weights)[partition_idx].set_stream(handle.get_stream());
+        }
+        if (edge_partition_edge_ids) {
+          (*edge_partition_edge_ids)[partition_idx].set_stream(handle.get_stream());
+        }
+        if (edge_partition_edge_types) {
+          (*edge_partition_edge_types)[partition_idx].set_stream(handle.get_stream());
+        }
+        if (edge_partition_edge_start_times) {
+          (*edge_partition_edge_start_times)[partition_idx].set_stream(handle.get_stream());
+        }
+        if (edge_partition_edge_end_times) {
+          (*edge_partition_edge_end_times)[partition_idx].set_stream(handle.get_stream());
+        }
+        if (edge_partition_dcs_nzd_vertices) {
+          (*edge_partition_dcs_nzd_vertices)[partition_idx].set_stream(handle.get_stream());
+        }
+      }
     }
   }
 
@@ -935,7 +1055,7 @@ create_graph_from_partitioned_edgelist(
     std::move(edge_types),
     std::move(edge_start_times),
     std::move(edge_end_times),
-    std::optional<rmm::device_uvector<vertex_t>>{std::move(renumber_map_labels)});
+    std::move(renumber_map_labels));
 }
 
 template <typename vertex_t,
@@ -2001,6 +2121,26 @@ create_graph_from_edgelist_impl(
     }
   }
 
+  if (auto persistent_mr = get_memory_resource_hint(handle, memory_usage_t::persistent)) {
+    auto stream = handle.get_stream();
+    offsets     = detail::move_to_memory_resource(std::move(offsets), *persistent_mr, stream);
+    indices     = detail::move_to_memory_resource(std::move(indices), *persistent_mr, stream);
+    if (weights) {
+      weights = detail::move_to_memory_resource(std::move(*weights), *persistent_mr, stream);
+    }
+    if (ids) { ids = detail::move_to_memory_resource(std::move(*ids), *persistent_mr, stream); }
+    if (types) {
+      types = detail::move_to_memory_resource(std::move(*types), *persistent_mr, stream);
+    }
+    if (start_times) {
+      start_times =
+        detail::move_to_memory_resource(std::move(*start_times), *persistent_mr, stream);
+    }
+    if (end_times) {
+      end_times = detail::move_to_memory_resource(std::move(*end_times), *persistent_mr, stream);
+    }
+  }
+
   // 3. create a graph and an edge_property_t object.
 
   std::optional<
@@ -2322,6 +2462,224 @@ create_graph_from_edgelist_impl(
                                                     do_expensive_check);
 }
 
+template <typename T>
+std::vector<rmm::device_uvector<T>> gather_local_edge_partition_chunks(
+  raft::handle_t const& handle,
+  rmm::device_uvector<T>&& values,
+  rmm::device_uvector<size_t> const& sorted_edge_indices,
+  std::vector<size_t> const& chunk_offsets)
+{
+  std::vector<rmm::device_uvector<T>> chunks{};
+  chunks.reserve(chunk_offsets.size() - 1);
+  for (size_t i = 0; i < chunk_offsets.size() - 1; ++i) {
+    rmm::device_uvector<T> chunk(chunk_offsets[i + 1] - chunk_offsets[i], handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   sorted_edge_indices.begin() + chunk_offsets[i],
+                   sorted_edge_indices.begin() + chunk_offsets[i + 1],
+                   values.begin(),
+                   chunk.begin());
+    chunks.push_back(std::move(chunk));
+  }
+  values.resize(0, handle.get_stream());
+  values.shrink_to_fit(handle.get_stream());
+
+  return chunks;
+}
+
+// edgelist_srcs & edgelist_dsts should be already renumbered with the renumber map of
+// base_graph_view
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<
+  multi_gpu,
+  std::tuple<
+    graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+    std::optional<
+      edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+    std::optional<
+      edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+    std::optional<
+      edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>>>
+create_graph_from_edgelist_with_shared_vertices_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& base_graph_view,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check)
+{
+  auto& comm                 = handle.get_comms();
+  auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+  auto const major_comm_size = major_comm.get_size();
+  auto const major_comm_rank = major_comm.get_rank();
+  auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+  auto const minor_comm_size = minor_comm.get_size();
+  auto const minor_comm_rank = minor_comm.get_rank();
+
+  // 1. shuffle the edges to their owning GPUs (following the vertex partitioning of
+  // base_graph_view)
+
+  auto vertex_partition_range_lasts = base_graph_view.vertex_partition_range_lasts();
+
+  std::optional<rmm::device_uvector<int32_t>> edgelist_edge_start_times{std::nullopt};
+  std::optional<rmm::device_uvector<int32_t>> edgelist_edge_end_times{std::nullopt};
+  std::tie(store_transposed ? edgelist_dsts : edgelist_srcs,
+           store_transposed ? edgelist_srcs : edgelist_dsts,
+           edgelist_weights,
+           edgelist_edge_ids,
+           edgelist_edge_types,
+           edgelist_edge_start_times,
+           edgelist_edge_end_times,
+           std::ignore) =
+    detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning(
+      handle,
+      std::move(store_transposed ? edgelist_dsts : edgelist_srcs),
+      std::move(store_transposed ? edgelist_srcs : edgelist_dsts),
+      std::move(edgelist_weights),
+      std::move(edgelist_edge_ids),
+      std::move(edgelist_edge_types),
+      std::move(edgelist_edge_start_times),
+      std::move(edgelist_edge_end_times),
+      vertex_partition_range_lasts);
+
+  if (do_expensive_check && !graph_properties.is_multigraph) {
+    CUGRAPH_EXPECTS(
+      check_no_parallel_edge(
+        handle,
+        raft::device_span<vertex_t const>(edgelist_srcs.data(), edgelist_srcs.size()),
+        raft::device_span<vertex_t const>(edgelist_dsts.data(), edgelist_dsts.size())),
+      "Invalid input arguments: graph_properties.is_multigraph is false but the input edge list "
+      "has parallel edges.");
+  }
+
+  // 2. split the edges to local edge partitions
+
+  std::vector<size_t> chunk_offsets(minor_comm_size + 1, size_t{0});
+  rmm::device_uvector<size_t> sorted_edge_indices(edgelist_srcs.size(), handle.get_stream());
+  {
+    rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+      vertex_partition_range_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        vertex_partition_range_lasts.data(),
+                        vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+    rmm::device_uvector<int> partition_ids(edgelist_srcs.size(), handle.get_stream());
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(store_transposed ? edgelist_dsts.begin() : edgelist_srcs.begin(),
+                         store_transposed ? edgelist_srcs.begin() : edgelist_dsts.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      edge_first,
+      edge_first + edgelist_srcs.size(),
+      partition_ids.begin(),
+      detail::compute_local_edge_partition_id_from_int_edge_endpoints_t<vertex_t>{
+        raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                          d_vertex_partition_range_lasts.size()),
+        major_comm_size,
+        minor_comm_size});
+    thrust::sequence(handle.get_thrust_policy(),
+                     sorted_edge_indices.begin(),
+                     sorted_edge_indices.end(),
+                     size_t{0});
+    thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                               partition_ids.begin(),
+                               partition_ids.end(),
+                               sorted_edge_indices.begin());
+
+    rmm::device_uvector<size_t> d_chunk_offsets(chunk_offsets.size(), handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        partition_ids.begin(),
+                        partition_ids.end(),
+                        thrust::make_counting_iterator(int{0}),
+                        thrust::make_counting_iterator(minor_comm_size + 1),
+                        d_chunk_offsets.begin());
+    raft::update_host(
+      chunk_offsets.data(), d_chunk_offsets.data(), d_chunk_offsets.size(), handle.get_stream());
+    handle.sync_stream();
+  }
+
+  auto local_num_edges = edgelist_srcs.size();
+
+  auto edge_partition_edgelist_srcs = gather_local_edge_partition_chunks(
+    handle, std::move(edgelist_srcs), sorted_edge_indices, chunk_offsets);
+  auto edge_partition_edgelist_dsts = gather_local_edge_partition_chunks(
+    handle, std::move(edgelist_dsts), sorted_edge_indices, chunk_offsets);
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> edge_partition_edgelist_weights{};
+  if (edgelist_weights) {
+    edge_partition_edgelist_weights = gather_local_edge_partition_chunks(
+      handle, std::move(*edgelist_weights), sorted_edge_indices, chunk_offsets);
+  }
+  std::optional<std::vector<rmm::device_uvector<edge_t>>> edge_partition_edgelist_edge_ids{};
+  if (edgelist_edge_ids) {
+    edge_partition_edgelist_edge_ids = gather_local_edge_partition_chunks(
+      handle, std::move(*edgelist_edge_ids), sorted_edge_indices, chunk_offsets);
+  }
+  std::optional<std::vector<rmm::device_uvector<edge_type_t>>> edge_partition_edgelist_edge_types{};
+  if (edgelist_edge_types) {
+    edge_partition_edgelist_edge_types = gather_local_edge_partition_chunks(
+      handle, std::move(*edgelist_edge_types), sorted_edge_indices, chunk_offsets);
+  }
+  sorted_edge_indices.resize(0, handle.get_stream());
+  sorted_edge_indices.shrink_to_fit(handle.get_stream());
+
+  // 3. reuse the vertex partitioning of base_graph_view; vertices are sorted by their degrees in
+  // base_graph_view (not in this graph), so every local vertex is placed in the mid-degree segment
+  // (processed by a warp) which is valid for any vertex degree, and hypersparse (DCSR or DCSC)
+  // storage is not used.
+
+  renumber_meta_t<vertex_t, edge_t, true> meta{};
+  meta.number_of_vertices = base_graph_view.number_of_vertices();
+  meta.number_of_edges    = host_scalar_allreduce(
+    comm, static_cast<edge_t>(local_num_edges), raft::comms::op_t::SUM, handle.get_stream());
+  meta.partition = partition_t<vertex_t>(base_graph_view.vertex_partition_range_offsets(),
+                                         major_comm_size,
+                                         minor_comm_size,
+                                         major_comm_rank,
+                                         minor_comm_rank);
+  static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+  meta.edge_partition_segment_offsets.reserve(
+    minor_comm_size * (detail::num_sparse_segments_per_vertex_partition + 2));
+  for (int i = 0; i < minor_comm_size; ++i) {
+    auto major_range_size = meta.partition.local_edge_partition_major_range_size(i);
+    meta.edge_partition_segment_offsets.insert(
+      meta.edge_partition_segment_offsets.end(),
+      {vertex_t{0}, vertex_t{0}, major_range_size, major_range_size, major_range_size});
+  }
+  meta.edge_partition_hypersparse_degree_offsets = std::nullopt;
+
+  auto [graph, edge_weights, edge_ids, edge_types, edge_start_times, edge_end_times, renumber_map] =
+    create_graph_from_partitioned_edgelist<vertex_t,
+                                           edge_t,
+                                           weight_t,
+                                           edge_type_t,
+                                           int32_t,
+                                           store_transposed,
+                                           multi_gpu>(
+      handle,
+      std::nullopt,
+      std::move(edge_partition_edgelist_srcs),
+      std::move(edge_partition_edgelist_dsts),
+      std::move(edge_partition_edgelist_weights),
+      std::move(edge_partition_edgelist_edge_ids),
+      std::move(edge_partition_edgelist_edge_types),
+      std::nullopt,
+      std::nullopt,
+      std::vector<std::vector<edge_t>>{},
+      graph_properties,
+      true,
+      std::make_optional(std::move(meta)));
+
+  return std::make_tuple(
+    std::move(graph), std::move(edge_weights), std::move(edge_ids), std::move(edge_types));
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -2539,4 +2897,221 @@ create_graph_from_edgelist(
                                                     do_expensive_check);
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>>
+create_graph_from_edgelist_with_shared_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& base_graph_view,
+  raft::device_span<vertex_t const> base_renumber_map,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(base_renumber_map.size() ==
+                    static_cast<size_t>(base_graph_view.local_vertex_partition_range_size()),
+                  "Invalid input arguments: base_renumber_map.size() should match the local "
+                  "vertex partition range size of base_graph_view.");
+  CUGRAPH_EXPECTS(edgelist_srcs.size() == edgelist_dsts.size(),
+                  "Invalid input arguments: edgelist_srcs.size() != edgelist_dsts.size().");
+  CUGRAPH_EXPECTS(!edgelist_weights || (edgelist_srcs.size() == (*edgelist_weights).size()),
+                  "Invalid input arguments: edgelist_weights.has_value() is true and "
+                  "edgelist_srcs.size() != (*edgelist_weights).size().");
+  CUGRAPH_EXPECTS(!edgelist_edge_ids || (edgelist_srcs.size() == (*edgelist_edge_ids).size()),
+                  "Invalid input arguments: edgelist_edge_ids.has_value() is true and "
+                  "edgelist_srcs.size() != (*edgelist_edge_ids).size().");
+  CUGRAPH_EXPECTS(!edgelist_edge_types || (edgelist_srcs.size() == (*edgelist_edge_types).size()),
+                  "Invalid input arguments: edgelist_edge_types.has_value() is true, "
+                  "edgelist_srcs.size() != (*edgelist_edge_types).size().");
+
+  // 1. renumber the edge end points with the renumber map of base_graph_view
+
+  renumber_ext_vertices<vertex_t, multi_gpu>(handle,
+                                             edgelist_srcs.data(),
+                                             edgelist_srcs.size(),
+                                             base_renumber_map.data(),
+                                             base_graph_view.local_vertex_partition_range_first(),
+                                             base_graph_view.local_vertex_partition_range_last(),
+                                             do_expensive_check);
+  renumber_ext_vertices<vertex_t, multi_gpu>(handle,
+                                             edgelist_dsts.data(),
+                                             edgelist_dsts.size(),
+                                             base_renumber_map.data(),
+                                             base_graph_view.local_vertex_partition_range_first(),
+                                             base_graph_view.local_vertex_partition_range_last(),
+                                             do_expensive_check);
+
+  {
+    auto is_invalid = [] __device__(vertex_t v) { return v == invalid_vertex_id<vertex_t>::value; };
+    auto num_unknown =
+      static_cast<size_t>(
+        thrust::count_if(
+          handle.get_thrust_policy(), edgelist_srcs.begin(), edgelist_srcs.end(), is_invalid)) +
+      static_cast<size_t>(thrust::count_if(
+        handle.get_thrust_policy(), edgelist_dsts.begin(), edgelist_dsts.end(), is_invalid));
+    if constexpr (multi_gpu) {
+      num_unknown = host_scalar_allreduce(
+        handle.get_comms(), num_unknown, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_unknown == 0,
+                    "Invalid input arguments: edge end points should appear in base_renumber_map.");
+  }
+
+  // 2. create a graph
+
+  if constexpr (multi_gpu) {
+    return create_graph_from_edgelist_with_shared_vertices_impl(handle,
+                                                                base_graph_view,
+                                                                std::move(edgelist_srcs),
+                                                                std::move(edgelist_dsts),
+                                                                std::move(edgelist_weights),
+                                                                std::move(edgelist_edge_ids),
+                                                                std::move(edgelist_edge_types),
+                                                                graph_properties,
+                                                                do_expensive_check);
+  } else {
+    // renumbered vertex IDs are already consecutive integers starting from 0, the vertex list keeps
+    // the vertices isolated in this graph
+    rmm::device_uvector<vertex_t> vertices(base_graph_view.number_of_vertices(),
+                                           handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), vertices.begin(), vertices.end(), vertex_t{0});
+    auto [graph, edge_weights, edge_ids, edge_types, renumber_map] =
+      create_graph_from_edgelist<vertex_t,
+                                 edge_t,
+                                 weight_t,
+                                 edge_type_t,
+                                 store_transposed,
+                                 multi_gpu>(handle,
+                                            std::make_optional(std::move(vertices)),
+                                            std::move(edgelist_srcs),
+                                            std::move(edgelist_dsts),
+                                            std::move(edgelist_weights),
+                                            std::move(edgelist_edge_ids),
+                                            std::move(edgelist_edge_types),
+                                            graph_properties,
+                                            false,
+                                            do_expensive_check);
+    return std::make_tuple(
+      std::move(graph), std::move(edge_weights), std::move(edge_ids), std::move(edge_types));
+  }
+}
+
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+           edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_topology_from_edgelist(raft::handle_t const& handle,
+                                    std::optional<rmm::device_uvector<vertex_t>>&& vertices,
+                                    rmm::device_uvector<vertex_t>&& edgelist_srcs,
+                                    rmm::device_uvector<vertex_t>&& edgelist_dsts,
+                                    graph_properties_t graph_properties,
+                                    bool renumber,
+                                    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    edgelist_srcs.size() <= static_cast<size_t>(std::numeric_limits<edge_t>::max()),
+    "Invalid input arguments: the number of (local) edges should fit in edge_t to store edge "
+    "positions.");
+
+  // carry only the edge positions in the input edge list through the sort & shuffle phases, edge
+  // property values are gathered afterwards (in attach_edgelist_property)
+
+  rmm::device_uvector<edge_t> edgelist_positions(edgelist_srcs.size(), handle.get_stream());
+  thrust::sequence(
+    handle.get_thrust_policy(), edgelist_positions.begin(), edgelist_positions.end(), edge_t{0});
+
+  auto [graph, weights, edge_positions, edge_types, edge_start_times, edge_end_times, number_map] =
+    create_graph_from_edgelist_impl<vertex_t,
+                                    edge_t,
+                                    float,
+                                    int32_t,
+                                    int32_t,
+                                    store_transposed,
+                                    multi_gpu>(handle,
+                                               std::move(vertices),
+                                               std::move(edgelist_srcs),
+                                               std::move(edgelist_dsts),
+                                               std::nullopt,
+                                               std::make_optional(std::move(edgelist_positions)),
+                                               std::nullopt,
+                                               std::nullopt,
+                                               std::nullopt,
+                                               graph_properties,
+                                               renumber,
+                                               do_expensive_check);
+
+  return std::make_tuple(std::move(graph), std::move(*edge_positions), std::move(number_map));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          bool store_transposed,
+          bool multi_gpu,
+          typename T>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, T>
+attach_edgelist_property(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_t const*> edge_permutation_view,
+  raft::device_span<T const> edgelist_values,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    edge_permutation_view.value_firsts().size() == graph_view.number_of_local_edge_partitions(),
+    "Invalid input arguments: edge_permutation_view does not match with graph_view.");
+
+  if (do_expensive_check) {
+    size_t num_invalids{0};
+    for (size_t i = 0; i < edge_permutation_view.value_firsts().size(); ++i) {
+      auto first = edge_permutation_view.value_firsts()[i];
+      num_invalids += static_cast<size_t>(thrust::count_if(
+        handle.get_thrust_policy(),
+        first,
+        first + edge_permutation_view.edge_counts()[i],
+        [num_values = edgelist_values.size()] __device__(edge_t position) {
+          return (position < edge_t{0}) || (static_cast<size_t>(position) >= num_values);
+        }));
+    }
+    if constexpr (multi_gpu) {
+      num_invalids = host_scalar_allreduce(
+        handle.get_comms(), num_invalids, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input arguments: edge_permutation_view has positions out of the "
+                    "edgelist_values range.");
+  }
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, T> edge_property(
+    handle, graph_view);
+  auto mutable_view = edge_property.mutable_view();
+  for (size_t i = 0; i < edge_permutation_view.value_firsts().size(); ++i) {
+    CUGRAPH_EXPECTS(
+      edge_permutation_view.edge_counts()[i] == mutable_view.edge_counts()[i],
+      "Invalid input arguments: edge_permutation_view does not match with graph_view.");
+    auto first = edge_permutation_view.value_firsts()[i];
+    thrust::gather(handle.get_thrust_policy(),
+                   first,
+                   first + edge_permutation_view.edge_counts()[i],
+                   edgelist_values.begin(),
+                   mutable_view.value_firsts()[i]);
+  }
+
+  return edge_property;
+}
+
 }  // namespace cugraph
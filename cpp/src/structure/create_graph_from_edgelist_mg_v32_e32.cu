@@ -187,4 +187,174 @@ create_graph_from_edgelist<int32_t, int32_t, double, int32_t, true, true>(
   bool renumber,
   bool do_expensive_check);
 
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int32_t, int32_t, float, int32_t, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& base_graph_view,
+  raft::device_span<int32_t const> base_renumber_map,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int32_t, int32_t, float, int32_t, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& base_graph_view,
+  raft::device_span<int32_t const> base_renumber_map,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int32_t, int32_t, double, int32_t, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& base_graph_view,
+  raft::device_span<int32_t const> base_renumber_map,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int32_t, int32_t, double, int32_t, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& base_graph_view,
+  raft::device_span<int32_t const> base_renumber_map,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, false, true>,
+  cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>,
+  std::optional<rmm::device_uvector<int32_t>>>
+create_graph_topology_from_edgelist<int32_t, int32_t, false, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int32_t, int32_t, true, true>,
+  cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>,
+  std::optional<rmm::device_uvector<int32_t>>>
+create_graph_topology_from_edgelist<int32_t, int32_t, true, true>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int32_t>>&& vertices,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, float>
+attach_edgelist_property<int32_t, int32_t, false, true, float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<float const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, double>
+attach_edgelist_property<int32_t, int32_t, false, true, double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<double const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int32_t>
+attach_edgelist_property<int32_t, int32_t, false, true, int32_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<int32_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, false, true>, int64_t>
+attach_edgelist_property<int32_t, int32_t, false, true, int64_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<int64_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, float>
+attach_edgelist_property<int32_t, int32_t, true, true, float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<float const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, double>
+attach_edgelist_property<int32_t, int32_t, true, true, double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<double const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int32_t>
+attach_edgelist_property<int32_t, int32_t, true, true, int32_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<int32_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int32_t, int32_t, true, true>, int64_t>
+attach_edgelist_property<int32_t, int32_t, true, true, int64_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_permutation_view,
+  raft::device_span<int64_t const> edgelist_values,
+  bool do_expensive_check);
+
 }  // namespace cugraph
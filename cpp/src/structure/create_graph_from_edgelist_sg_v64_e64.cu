@@ -187,4 +187,174 @@ create_graph_from_edgelist<int64_t, int64_t, double, int32_t, true, false>(
   bool renumber,
   bool do_expensive_check);
 
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, false, false>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int64_t, int64_t, float, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& base_graph_view,
+  raft::device_span<int64_t const> base_renumber_map,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int64_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, true, false>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, float>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int64_t, int64_t, float, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& base_graph_view,
+  raft::device_span<int64_t const> base_renumber_map,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int64_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, false, false>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int64_t, int64_t, double, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& base_graph_view,
+  raft::device_span<int64_t const> base_renumber_map,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int64_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, true, false>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, double>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int64_t>>,
+  std::optional<
+    cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int32_t>>>
+create_graph_from_edgelist_with_shared_vertices<int64_t, int64_t, double, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& base_graph_view,
+  raft::device_span<int64_t const> base_renumber_map,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<int64_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<int32_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, false, false>,
+  cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int64_t>,
+  std::optional<rmm::device_uvector<int64_t>>>
+create_graph_topology_from_edgelist<int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<
+  cugraph::graph_t<int64_t, int64_t, true, false>,
+  cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int64_t>,
+  std::optional<rmm::device_uvector<int64_t>>>
+create_graph_topology_from_edgelist<int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  std::optional<rmm::device_uvector<int64_t>>&& vertices,
+  rmm::device_uvector<int64_t>&& edgelist_srcs,
+  rmm::device_uvector<int64_t>&& edgelist_dsts,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, float>
+attach_edgelist_property<int64_t, int64_t, false, false, float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<float const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, double>
+attach_edgelist_property<int64_t, int64_t, false, false, double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<double const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int32_t>
+attach_edgelist_property<int64_t, int64_t, false, false, int32_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<int32_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, false, false>, int64_t>
+attach_edgelist_property<int64_t, int64_t, false, false, int64_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<int64_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, float>
+attach_edgelist_property<int64_t, int64_t, true, false, float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<float const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, double>
+attach_edgelist_property<int64_t, int64_t, true, false, double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<double const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int32_t>
+attach_edgelist_property<int64_t, int64_t, true, false, int32_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<int32_t const> edgelist_values,
+  bool do_expensive_check);
+
+template cugraph::edge_property_t<cugraph::graph_view_t<int64_t, int64_t, true, false>, int64_t>
+attach_edgelist_property<int64_t, int64_t, true, false, int64_t>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_permutation_view,
+  raft::device_span<int64_t const> edgelist_values,
+  bool do_expensive_check);
+
 }  // namespace cugraph
@@ -21,6 +21,7 @@
 #include <cugraph/detail/decompress_edge_partition.cuh>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/mtmg/detail/pinned_host_buffer.hpp>
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/mask_utils.cuh>
@@ -30,13 +31,19 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <cuda/std/optional>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <functional>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -430,4 +437,246 @@ decompress_to_edgelist(
                                                 do_expensive_check);
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+void decompress_to_edgelist_in_chunks(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<vertex_t const>,
+                     raft::device_span<vertex_t const>,
+                     std::optional<raft::device_span<weight_t const>>,
+                     std::optional<raft::device_span<edge_t const>>,
+                     std::optional<raft::device_span<edge_type_t const>>)> const& callback,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input arguments: chunk_size should be positive.");
+  CUGRAPH_EXPECTS(
+    !renumber_map.has_value() ||
+      (*renumber_map).size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input arguments: if renumber_map.has_value() == true, (*renumber_map).size() should "
+    "match with the local vertex partition range size.");
+
+  if (do_expensive_check) { /* currently, nothing to do */
+  }
+
+  // 1. split the local edge partitions to chunks of (at most) chunk_size edges (before masking)
+
+  std::vector<std::tuple<size_t, edge_t, edge_t>> chunks{};  // (partition index, first, last)
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto num_edges = graph_view.local_edge_partition_view(i).number_of_edges();
+    for (size_t first = 0; first < static_cast<size_t>(num_edges); first += chunk_size) {
+      chunks.emplace_back(i,
+                          static_cast<edge_t>(first),
+                          static_cast<edge_t>(std::min(static_cast<size_t>(num_edges),
+                                                       first + chunk_size)));
+    }
+  }
+  auto num_chunks = chunks.size();
+  if constexpr (multi_gpu) {
+    if (renumber_map) {  // unrenumbering is a collective operation
+      num_chunks = host_scalar_allreduce(
+        handle.get_comms(), num_chunks, raft::comms::op_t::MAX, handle.get_stream());
+    }
+  }
+
+  // 2. decompress, (optionally) unrenumber, and pass every chunk to the callback reusing the same
+  // buffers
+
+  size_t buffer_size{0};
+  for (auto const& [i, first, last] : chunks) {
+    buffer_size = std::max(buffer_size, static_cast<size_t>(last - first));
+  }
+  rmm::device_uvector<vertex_t> majors(buffer_size, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(buffer_size, handle.get_stream());
+  auto weights = edge_weight_view ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                      buffer_size, handle.get_stream())
+                                  : std::nullopt;
+  auto ids =
+    edge_id_view ? std::make_optional<rmm::device_uvector<edge_t>>(buffer_size, handle.get_stream())
+                 : std::nullopt;
+  auto types = edge_type_view ? std::make_optional<rmm::device_uvector<edge_type_t>>(
+                                  buffer_size, handle.get_stream())
+                              : std::nullopt;
+  auto edge_offsets = graph_view.has_edge_mask() ? std::make_optional<rmm::device_uvector<edge_t>>(
+                                                     buffer_size, handle.get_stream())
+                                                 : std::nullopt;
+
+  for (size_t c = 0; c < num_chunks; ++c) {
+    size_t count{0};
+    if (c < chunks.size()) {
+      auto i              = std::get<0>(chunks[c]);
+      auto first          = std::get<1>(chunks[c]);
+      auto last           = std::get<2>(chunks[c]);
+      auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(
+        graph_view.local_edge_partition_view(i));
+
+      count = static_cast<size_t>(last - first);
+      if (edge_offsets) {
+        auto edge_partition_e_mask =
+          detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>(
+            *(graph_view.edge_mask_view()), i);
+        count = static_cast<size_t>(thrust::distance(
+          (*edge_offsets).begin(),
+          thrust::copy_if(handle.get_thrust_policy(),
+                          thrust::make_counting_iterator(first),
+                          thrust::make_counting_iterator(last),
+                          (*edge_offsets).begin(),
+                          [edge_partition_e_mask] __device__(edge_t e) {
+                            return edge_partition_e_mask.get(e);
+                          })));
+      }
+
+      auto weight_first = edge_weight_view
+                            ? cuda::std::make_optional((*edge_weight_view).value_firsts()[i])
+                            : cuda::std::nullopt;
+      auto id_first = edge_id_view ? cuda::std::make_optional((*edge_id_view).value_firsts()[i])
+                                   : cuda::std::nullopt;
+      auto type_first =
+        edge_type_view ? cuda::std::make_optional((*edge_type_view).value_firsts()[i])
+                       : cuda::std::nullopt;
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(count),
+        [edge_partition,
+         first,
+         edge_offsets = edge_offsets ? (*edge_offsets).data() : static_cast<edge_t const*>(nullptr),
+         weight_first,
+         id_first,
+         type_first,
+         majors  = majors.data(),
+         minors  = minors.data(),
+         weights = weights ? (*weights).data() : static_cast<weight_t*>(nullptr),
+         ids     = ids ? (*ids).data() : static_cast<edge_t*>(nullptr),
+         types   = types ? (*types).data()
+                         : static_cast<edge_type_t*>(nullptr)] __device__(size_t idx) {
+          auto e = edge_offsets ? edge_offsets[idx] : first + static_cast<edge_t>(idx);
+          majors[idx] = edge_partition.major_from_major_idx_nocheck(
+            edge_partition.major_idx_from_local_edge_idx_nocheck(e));
+          minors[idx] = edge_partition.indices()[e];
+          if (weight_first) { weights[idx] = (*weight_first)[e]; }
+          if (id_first) { ids[idx] = (*id_first)[e]; }
+          if (type_first) { types[idx] = (*type_first)[e]; }
+        });
+    }
+
+    if (renumber_map) {
+      if constexpr (multi_gpu) {
+        unrenumber_int_vertices<vertex_t, multi_gpu>(handle,
+                                                     majors.data(),
+                                                     count,
+                                                     (*renumber_map).data(),
+                                                     graph_view.vertex_partition_range_lasts());
+        unrenumber_int_vertices<vertex_t, multi_gpu>(handle,
+                                                     minors.data(),
+                                                     count,
+                                                     (*renumber_map).data(),
+                                                     graph_view.vertex_partition_range_lasts());
+      } else {
+        unrenumber_local_int_edges<vertex_t, store_transposed, multi_gpu>(
+          handle,
+          store_transposed ? minors.data() : majors.data(),
+          store_transposed ? majors.data() : minors.data(),
+          count,
+          (*renumber_map).data(),
+          (*renumber_map).size());
+      }
+    }
+
+    if (count > 0) {
+      auto srcs = store_transposed ? minors.data() : majors.data();
+      auto dsts = store_transposed ? majors.data() : minors.data();
+      callback(raft::device_span<vertex_t const>(srcs, count),
+               raft::device_span<vertex_t const>(dsts, count),
+               weights ? std::make_optional<raft::device_span<weight_t const>>((*weights).data(),
+                                                                              count)
+                       : std::nullopt,
+               ids ? std::make_optional<raft::device_span<edge_t const>>((*ids).data(), count)
+                   : std::nullopt,
+               types ? std::make_optional<raft::device_span<edge_type_t const>>((*types).data(),
+                                                                                count)
+                     : std::nullopt);
+    }
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+void decompress_to_host_edgelist_in_chunks(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<vertex_t const>,
+                     raft::host_span<vertex_t const>,
+                     std::optional<raft::host_span<weight_t const>>,
+                     std::optional<raft::host_span<edge_t const>>,
+                     std::optional<raft::host_span<edge_type_t const>>)> const& callback,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input arguments: chunk_size should be positive.");
+
+  // pinned host buffers are (re-)allocated only when a chunk does not fit
+
+  std::optional<mtmg::detail::pinned_host_buffer_t<vertex_t>> h_srcs{std::nullopt};
+  std::optional<mtmg::detail::pinned_host_buffer_t<vertex_t>> h_dsts{std::nullopt};
+  std::optional<mtmg::detail::pinned_host_buffer_t<weight_t>> h_weights{std::nullopt};
+  std::optional<mtmg::detail::pinned_host_buffer_t<edge_t>> h_ids{std::nullopt};
+  std::optional<mtmg::detail::pinned_host_buffer_t<edge_type_t>> h_types{std::nullopt};
+
+  auto copy_to_host = [&handle](auto& h_buffer, auto d_span) {
+    using value_t = std::remove_cv_t<typename decltype(d_span)::value_type>;
+    if (!h_buffer || ((*h_buffer).size() < d_span.size())) {
+      h_buffer = mtmg::detail::pinned_host_buffer_t<value_t>(d_span.size());
+    }
+    raft::update_host((*h_buffer).data(), d_span.data(), d_span.size(), handle.get_stream());
+    return raft::host_span<value_t const>((*h_buffer).data(), d_span.size());
+  };
+
+  decompress_to_edgelist_in_chunks<vertex_t,
+                                   edge_t,
+                                   weight_t,
+                                   edge_type_t,
+                                   store_transposed,
+                                   multi_gpu>(
+    handle,
+    graph_view,
+    edge_weight_view,
+    edge_id_view,
+    edge_type_view,
+    renumber_map,
+    chunk_size,
+    [&](raft::device_span<vertex_t const> srcs,
+        raft::device_span<vertex_t const> dsts,
+        std::optional<raft::device_span<weight_t const>> weights,
+        std::optional<raft::device_span<edge_t const>> ids,
+        std::optional<raft::device_span<edge_type_t const>> types) {
+      auto host_srcs = copy_to_host(h_srcs, srcs);
+      auto host_dsts = copy_to_host(h_dsts, dsts);
+      auto host_weights =
+        weights ? std::make_optional(copy_to_host(h_weights, *weights)) : std::nullopt;
+      auto host_ids   = ids ? std::make_optional(copy_to_host(h_ids, *ids)) : std::nullopt;
+      auto host_types = types ? std::make_optional(copy_to_host(h_types, *types)) : std::nullopt;
+      handle.sync_stream();
+      callback(host_srcs, host_dsts, host_weights, host_ids, host_types);
+    },
+    do_expensive_check);
+}
+
 }  // namespace cugraph
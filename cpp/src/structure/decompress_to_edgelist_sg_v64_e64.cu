@@ -75,4 +75,125 @@ decompress_to_edgelist<int64_t, int64_t, double, int32_t, true, false>(
   std::optional<raft::device_span<int64_t const>> renumber_map,
   bool do_expensive_check);
 
+template void decompress_to_edgelist_in_chunks<int64_t, int64_t, float, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<int64_t const>,
+                     raft::device_span<int64_t const>,
+                     std::optional<raft::device_span<float const>>,
+                     std::optional<raft::device_span<int64_t const>>,
+                     std::optional<raft::device_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_host_edgelist_in_chunks<int64_t, int64_t, float, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<int64_t const>,
+                     raft::host_span<int64_t const>,
+                     std::optional<raft::host_span<float const>>,
+                     std::optional<raft::host_span<int64_t const>>,
+                     std::optional<raft::host_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_edgelist_in_chunks<int64_t, int64_t, float, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<int64_t const>,
+                     raft::device_span<int64_t const>,
+                     std::optional<raft::device_span<float const>>,
+                     std::optional<raft::device_span<int64_t const>>,
+                     std::optional<raft::device_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_host_edgelist_in_chunks<int64_t, int64_t, float, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<int64_t const>,
+                     raft::host_span<int64_t const>,
+                     std::optional<raft::host_span<float const>>,
+                     std::optional<raft::host_span<int64_t const>>,
+                     std::optional<raft::host_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_edgelist_in_chunks<int64_t, int64_t, double, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<int64_t const>,
+                     raft::device_span<int64_t const>,
+                     std::optional<raft::device_span<double const>>,
+                     std::optional<raft::device_span<int64_t const>>,
+                     std::optional<raft::device_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void
+decompress_to_host_edgelist_in_chunks<int64_t, int64_t, double, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<int64_t const>,
+                     raft::host_span<int64_t const>,
+                     std::optional<raft::host_span<double const>>,
+                     std::optional<raft::host_span<int64_t const>>,
+                     std::optional<raft::host_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_edgelist_in_chunks<int64_t, int64_t, double, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::device_span<int64_t const>,
+                     raft::device_span<int64_t const>,
+                     std::optional<raft::device_span<double const>>,
+                     std::optional<raft::device_span<int64_t const>>,
+                     std::optional<raft::device_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
+template void decompress_to_host_edgelist_in_chunks<int64_t, int64_t, double, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  size_t chunk_size,
+  std::function<void(raft::host_span<int64_t const>,
+                     raft::host_span<int64_t const>,
+                     std::optional<raft::host_span<double const>>,
+                     std::optional<raft::host_span<int64_t const>>,
+                     std::optional<raft::host_span<int32_t const>>)> const& callback,
+  bool do_expensive_check);
+
 }  // namespace cugraph
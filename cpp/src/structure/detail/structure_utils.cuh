@@ -31,13 +31,16 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cub/cub.cuh>
+#include <thrust/binary_search.h>
 #include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
@@ -621,5 +624,44 @@ rmm::device_uvector<T> keep_flagged_elements(raft::handle_t const& handle,
   return result;
 }
 
+// choose the low, mid degree segment boundary with degree_segment_policy_t::adaptive, degree_scale
+// is the ratio of the (global) degrees in [sorted_degree_first, sorted_degree_last) to the local
+// degrees in the edge partitions (minor_comm_size in multi-GPU)
+template <typename DegreeIterator>
+size_t compute_adaptive_low_degree_threshold(raft::handle_t const& handle,
+                                             DegreeIterator sorted_degree_first /* non-ascending */,
+                                             DegreeIterator sorted_degree_last,
+                                             size_t mid_degree_threshold /* scaled */,
+                                             size_t degree_scale)
+{
+  using edge_t = typename thrust::iterator_traits<DegreeIterator>::value_type;
+
+  // [first, last) are the vertices with degrees in [1, mid_degree_threshold)
+  auto first = thrust::upper_bound(handle.get_thrust_policy(),
+                                   sorted_degree_first,
+                                   sorted_degree_last,
+                                   static_cast<edge_t>(mid_degree_threshold),
+                                   thrust::greater<edge_t>{});
+  auto last  = thrust::upper_bound(handle.get_thrust_policy(),
+                                   first,
+                                   sorted_degree_last,
+                                   edge_t{1},
+                                   thrust::greater<edge_t>{});
+
+  size_t threshold{low_degree_threshold};
+  auto count = static_cast<size_t>(thrust::distance(first, last));
+  if (count > 0) {
+    auto sum  = thrust::reduce(
+      handle.get_thrust_policy(), first, last, size_t{0}, thrust::plus<size_t>{});
+    auto mean = static_cast<double>(sum) / static_cast<double>(count * degree_scale);
+    threshold = min_low_degree_threshold;
+    while ((threshold < low_degree_threshold) && (static_cast<double>(threshold) < mean)) {
+      threshold *= 2;
+    }
+  }
+
+  return threshold * degree_scale;
+}
+
 }  // namespace detail
 }  // namespace cugraph
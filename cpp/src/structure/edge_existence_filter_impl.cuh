@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "utilities/error_check_utils.cuh"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace cugraph {
+
+namespace detail {
+
+// split block bloom filter, a key sets (and a query tests) one bit in each word of a single block
+size_t constexpr edge_existence_filter_words_per_block{8};
+
+__device__ inline uint64_t edge_existence_filter_hash(uint64_t src, uint64_t dst)
+{
+  // splitmix64 finalizer
+  auto h = (src * uint64_t{0x9e3779b97f4a7c15}) ^ dst;
+  h ^= h >> 30;
+  h *= uint64_t{0xbf58476d1ce4e5b9};
+  h ^= h >> 27;
+  h *= uint64_t{0x94d049bb133111eb};
+  h ^= h >> 31;
+  return h;
+}
+
+__device__ inline uint32_t edge_existence_filter_word_mask(uint32_t h, size_t word)
+{
+  constexpr uint32_t salts[edge_existence_filter_words_per_block] = {0x47b6137bU,
+                                                                      0x44974d91U,
+                                                                      0x8824ad5bU,
+                                                                      0xa2b7289dU,
+                                                                      0x705495c7U,
+                                                                      0x2df1424bU,
+                                                                      0x9efc4947U,
+                                                                      0x5c6bfb31U};
+  return uint32_t{1} << ((h * salts[word]) >> 27);
+}
+
+template <typename vertex_t>
+struct edge_existence_filter_insert_t {
+  raft::device_span<uint32_t> blocks{};
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto h = edge_existence_filter_hash(static_cast<uint64_t>(thrust::get<0>(e)),
+                                        static_cast<uint64_t>(thrust::get<1>(e)));
+    auto num_blocks = blocks.size() / edge_existence_filter_words_per_block;
+    auto block_first =
+      blocks.data() + ((h >> 32) % num_blocks) * edge_existence_filter_words_per_block;
+    for (size_t i = 0; i < edge_existence_filter_words_per_block; ++i) {
+      cuda::atomic_ref<uint32_t, cuda::thread_scope_device> word(block_first[i]);
+      word.fetch_or(edge_existence_filter_word_mask(static_cast<uint32_t>(h), i),
+                    cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+template <typename vertex_t>
+struct edge_existence_filter_contains_t {
+  raft::device_span<uint32_t const> blocks{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto h = edge_existence_filter_hash(static_cast<uint64_t>(thrust::get<0>(e)),
+                                        static_cast<uint64_t>(thrust::get<1>(e)));
+    auto num_blocks = blocks.size() / edge_existence_filter_words_per_block;
+    auto block_first =
+      blocks.data() + ((h >> 32) % num_blocks) * edge_existence_filter_words_per_block;
+    for (size_t i = 0; i < edge_existence_filter_words_per_block; ++i) {
+      auto mask = edge_existence_filter_word_mask(static_cast<uint32_t>(h), i);
+      if ((block_first[i] & mask) != mask) { return false; }
+    }
+    return true;
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+edge_existence_filter_t build_edge_existence_filter(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  size_t bits_per_edge)
+{
+  CUGRAPH_EXPECTS(bits_per_edge > 0, "Invalid input argument: bits_per_edge should be positive.");
+
+  auto [edge_srcs, edge_dsts, edge_weights, edge_ids, edge_types] =
+    decompress_to_edgelist<vertex_t, edge_t, float, int32_t, store_transposed, multi_gpu>(
+      handle, graph_view, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+
+  size_t constexpr bits_per_block = detail::edge_existence_filter_words_per_block * 32;
+  auto num_blocks =
+    std::max((edge_srcs.size() * bits_per_edge + bits_per_block - 1) / bits_per_block, size_t{1});
+
+  edge_existence_filter_t filter{rmm::device_uvector<uint32_t>(
+    num_blocks * detail::edge_existence_filter_words_per_block, handle.get_stream())};
+  thrust::fill(
+    handle.get_thrust_policy(), filter.blocks.begin(), filter.blocks.end(), uint32_t{0});
+
+  auto edge_first = thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin());
+  thrust::for_each(handle.get_thrust_policy(),
+                   edge_first,
+                   edge_first + edge_srcs.size(),
+                   detail::edge_existence_filter_insert_t<vertex_t>{
+                     raft::device_span<uint32_t>(filter.blocks.data(), filter.blocks.size())});
+
+  return filter;
+}
+
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+rmm::device_uvector<bool> has_edges(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_existence_filter_t const& filter,
+  raft::device_span<vertex_t const> edge_srcs,
+  raft::device_span<vertex_t const> edge_dsts,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    edge_srcs.size() == edge_dsts.size(),
+    "Invalid input arguments: edge_srcs.size() does not coincide with edge_dsts.size().");
+  CUGRAPH_EXPECTS(
+    (filter.blocks.size() > 0) &&
+      (filter.blocks.size() % detail::edge_existence_filter_words_per_block == 0),
+    "Invalid input argument: filter is not a valid edge existence filter.");
+
+  if (do_expensive_check) {
+    auto edge_first =
+      thrust::make_zip_iterator(store_transposed ? edge_dsts.begin() : edge_srcs.begin(),
+                                store_transposed ? edge_srcs.begin() : edge_dsts.begin());
+    auto num_invalids = detail::count_invalid_vertex_pairs(
+      handle, graph_view, edge_first, edge_first + edge_srcs.size());
+    CUGRAPH_EXPECTS(num_invalids == 0,
+                    "Invalid input argument: there are invalid edge (src, dst) pairs.");
+  }
+
+  rmm::device_uvector<bool> ret(edge_srcs.size(), handle.get_stream());
+
+  auto pair_first = thrust::make_zip_iterator(edge_srcs.begin(), edge_dsts.begin());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + edge_srcs.size(),
+    ret.begin(),
+    detail::edge_existence_filter_contains_t<vertex_t>{
+      raft::device_span<uint32_t const>(filter.blocks.data(), filter.blocks.size())});
+
+  // confirm the filter hits (edges and false positives) by searching the adjacency lists
+
+  rmm::device_uvector<size_t> hit_indices(edge_srcs.size(), handle.get_stream());
+  auto hit_last = thrust::copy_if(handle.get_thrust_policy(),
+                                  thrust::make_counting_iterator(size_t{0}),
+                                  thrust::make_counting_iterator(edge_srcs.size()),
+                                  ret.begin(),
+                                  hit_indices.begin(),
+                                  thrust::identity<bool>{});
+  hit_indices.resize(thrust::distance(hit_indices.begin(), hit_last), handle.get_stream());
+
+  rmm::device_uvector<vertex_t> hit_srcs(hit_indices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> hit_dsts(hit_indices.size(), handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 hit_indices.begin(),
+                 hit_indices.end(),
+                 pair_first,
+                 thrust::make_zip_iterator(hit_srcs.begin(), hit_dsts.begin()));
+
+  auto hit_edge_exists =
+    graph_view.has_edge(handle,
+                        raft::device_span<vertex_t const>(hit_srcs.data(), hit_srcs.size()),
+                        raft::device_span<vertex_t const>(hit_dsts.data(), hit_dsts.size()));
+  thrust::scatter(handle.get_thrust_policy(),
+                  hit_edge_exists.begin(),
+                  hit_edge_exists.end(),
+                  hit_indices.begin(),
+                  ret.begin());
+
+  return ret;
+}
+
+}  // namespace cugraph
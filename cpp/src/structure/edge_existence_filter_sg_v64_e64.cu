@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/edge_existence_filter_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template edge_existence_filter_t build_edge_existence_filter(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  size_t bits_per_edge);
+
+template rmm::device_uvector<bool> has_edges(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_existence_filter_t const& filter,
+  raft::device_span<int64_t const> edge_srcs,
+  raft::device_span<int64_t const> edge_dsts,
+  bool do_expensive_check);
+
+template edge_existence_filter_t build_edge_existence_filter(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  size_t bits_per_edge);
+
+template rmm::device_uvector<bool> has_edges(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_existence_filter_t const& filter,
+  raft::device_span<int64_t const> edge_srcs,
+  raft::device_span<int64_t const> edge_dsts,
+  bool do_expensive_check);
+
+}  // namespace cugraph
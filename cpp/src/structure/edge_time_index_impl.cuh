@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_partition_edge_time_index.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename edge_t>
+struct update_edge_mask_bit_t {
+  raft::device_span<edge_t const> edge_indices{};
+  uint32_t* edge_mask{};
+  bool set{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto e = edge_indices[i];
+    cuda::atomic_ref<uint32_t, cuda::thread_scope_device> word(edge_mask[packed_bool_offset(e)]);
+    if (set) {
+      word.fetch_or(packed_bool_mask(e), cuda::std::memory_order_relaxed);
+    } else {
+      word.fetch_and(~packed_bool_mask(e), cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+// position of the first edge with time >= t in the time-sorted order
+template <typename edge_t, typename edge_time_t>
+size_t time_lower_bound(raft::handle_t const& handle,
+                        edge_partition_edge_time_index_view_t<edge_t, edge_time_t> index_view,
+                        edge_time_t t)
+{
+  auto sorted_times = index_view.sorted_times();
+  return static_cast<size_t>(thrust::distance(
+    sorted_times.begin(),
+    thrust::lower_bound(
+      handle.get_thrust_policy(), sorted_times.begin(), sorted_times.end(), t)));
+}
+
+template <typename edge_t, typename edge_time_t>
+void update_edge_mask_bits(raft::handle_t const& handle,
+                           edge_partition_edge_time_index_view_t<edge_t, edge_time_t> index_view,
+                           uint32_t* edge_mask,
+                           size_t first,
+                           size_t last,
+                           bool set)
+{
+  if (first < last) {
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(first),
+                     thrust::make_counting_iterator(last),
+                     update_edge_mask_bit_t<edge_t>{index_view.edge_indices(), edge_mask, set});
+  }
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>>
+build_edge_partition_edge_time_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_time_t const*> edge_time_view)
+{
+  CUGRAPH_EXPECTS(
+    edge_time_view.value_firsts().size() == graph_view.number_of_local_edge_partitions(),
+    "Invalid input argument: edge_time_view does not match graph_view.");
+
+  std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>> time_indices{};
+  time_indices.reserve(graph_view.number_of_local_edge_partitions());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto num_edges = static_cast<size_t>(graph_view.local_edge_partition_view(i).number_of_edges());
+    CUGRAPH_EXPECTS(static_cast<size_t>(edge_time_view.edge_counts()[i]) == num_edges,
+                    "Invalid input argument: edge_time_view does not match graph_view.");
+
+    rmm::device_uvector<edge_time_t> sorted_times(num_edges, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 edge_time_view.value_firsts()[i],
+                 edge_time_view.value_firsts()[i] + num_edges,
+                 sorted_times.begin());
+    rmm::device_uvector<edge_t> edge_indices(num_edges, handle.get_stream());
+    thrust::sequence(
+      handle.get_thrust_policy(), edge_indices.begin(), edge_indices.end(), edge_t{0});
+    thrust::stable_sort_by_key(
+      handle.get_thrust_policy(), sorted_times.begin(), sorted_times.end(), edge_indices.begin());
+
+    time_indices.emplace_back(std::move(sorted_times), std::move(edge_indices));
+  }
+
+  return time_indices;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
+create_edge_time_window_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>> const& edge_time_indices,
+  edge_time_t window_start,
+  edge_time_t window_end)
+{
+  CUGRAPH_EXPECTS(edge_time_indices.size() == graph_view.number_of_local_edge_partitions(),
+                  "Invalid input argument: edge_time_indices does not match graph_view.");
+  CUGRAPH_EXPECTS(window_start <= window_end,
+                  "Invalid input argument: window_start should not exceed window_end.");
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool> edge_mask(
+    handle, graph_view);
+  auto edge_mask_view = edge_mask.mutable_view();
+  for (size_t i = 0; i < edge_time_indices.size(); ++i) {
+    auto index_view = edge_time_indices[i].view();
+    auto mask_first = edge_mask_view.value_firsts()[i];
+    thrust::fill(handle.get_thrust_policy(),
+                 mask_first,
+                 mask_first + packed_bool_size(edge_mask_view.edge_counts()[i]),
+                 packed_bool_empty_mask());
+    update_edge_mask_bits(handle,
+                          index_view,
+                          mask_first,
+                          time_lower_bound(handle, index_view, window_start),
+                          time_lower_bound(handle, index_view, window_end),
+                          true);
+  }
+
+  return edge_mask;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_time_t,
+          bool store_transposed,
+          bool multi_gpu>
+void update_edge_time_window_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<edge_t, edge_time_t>> const& edge_time_indices,
+  edge_property_view_t<edge_t, uint32_t*, bool> edge_mask_view,
+  edge_time_t old_window_start,
+  edge_time_t old_window_end,
+  edge_time_t new_window_start,
+  edge_time_t new_window_end)
+{
+  CUGRAPH_EXPECTS(edge_time_indices.size() == graph_view.number_of_local_edge_partitions(),
+                  "Invalid input argument: edge_time_indices does not match graph_view.");
+  CUGRAPH_EXPECTS(edge_mask_view.value_firsts().size() == edge_time_indices.size(),
+                  "Invalid input argument: edge_mask_view does not match graph_view.");
+  CUGRAPH_EXPECTS(
+    (old_window_start <= old_window_end) && (new_window_start <= new_window_end),
+    "Invalid input argument: window start times should not exceed window end times.");
+
+  for (size_t i = 0; i < edge_time_indices.size(); ++i) {
+    auto index_view = edge_time_indices[i].view();
+    auto mask_first = edge_mask_view.value_firsts()[i];
+
+    // windows map to position ranges [old_first, old_last) and [new_first, new_last) in the
+    // time-sorted order, clear the positions leaving the window and set the positions entering it
+
+    auto old_first = time_lower_bound(handle, index_view, old_window_start);
+    auto old_last  = time_lower_bound(handle, index_view, old_window_end);
+    auto new_first = time_lower_bound(handle, index_view, new_window_start);
+    auto new_last  = time_lower_bound(handle, index_view, new_window_end);
+
+    update_edge_mask_bits(
+      handle, index_view, mask_first, old_first, std::min(old_last, new_first), false);
+    update_edge_mask_bits(
+      handle, index_view, mask_first, std::max(old_first, new_last), old_last, false);
+    update_edge_mask_bits(
+      handle, index_view, mask_first, new_first, std::min(new_last, old_first), true);
+    update_edge_mask_bits(
+      handle, index_view, mask_first, std::max(new_first, old_last), new_last, true);
+  }
+}
+
+}  // namespace cugraph
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/edge_time_index_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>>
+build_edge_partition_edge_time_index<int64_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_time_view);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, bool>
+create_edge_time_window_mask<int64_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>> const& edge_time_indices,
+  int32_t window_start,
+  int32_t window_end);
+
+template void update_edge_time_window_mask<int64_t, int64_t, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>> const& edge_time_indices,
+  edge_property_view_t<int64_t, uint32_t*, bool> edge_mask_view,
+  int32_t old_window_start,
+  int32_t old_window_end,
+  int32_t new_window_start,
+  int32_t new_window_end);
+
+template std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>>
+build_edge_partition_edge_time_index<int64_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int32_t const*> edge_time_view);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, bool>
+create_edge_time_window_mask<int64_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>> const& edge_time_indices,
+  int32_t window_start,
+  int32_t window_end);
+
+template void update_edge_time_window_mask<int64_t, int64_t, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int32_t>> const& edge_time_indices,
+  edge_property_view_t<int64_t, uint32_t*, bool> edge_mask_view,
+  int32_t old_window_start,
+  int32_t old_window_end,
+  int32_t new_window_start,
+  int32_t new_window_end);
+
+template std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>>
+build_edge_partition_edge_time_index<int64_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_time_view);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, false, false>, bool>
+create_edge_time_window_mask<int64_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>> const& edge_time_indices,
+  int64_t window_start,
+  int64_t window_end);
+
+template void update_edge_time_window_mask<int64_t, int64_t, int64_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>> const& edge_time_indices,
+  edge_property_view_t<int64_t, uint32_t*, bool> edge_mask_view,
+  int64_t old_window_start,
+  int64_t old_window_end,
+  int64_t new_window_start,
+  int64_t new_window_end);
+
+template std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>>
+build_edge_partition_edge_time_index<int64_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  edge_property_view_t<int64_t, int64_t const*> edge_time_view);
+
+template edge_property_t<graph_view_t<int64_t, int64_t, true, false>, bool>
+create_edge_time_window_mask<int64_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>> const& edge_time_indices,
+  int64_t window_start,
+  int64_t window_end);
+
+template void update_edge_time_window_mask<int64_t, int64_t, int64_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::vector<edge_partition_edge_time_index_t<int64_t, int64_t>> const& edge_time_indices,
+  edge_property_view_t<int64_t, uint32_t*, bool> edge_mask_view,
+  int64_t old_window_start,
+  int64_t old_window_end,
+  int64_t new_window_start,
+  int64_t new_window_end);
+
+}  // namespace cugraph
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_partition_edge_type_index.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename edge_t, typename edge_type_t>
+struct compute_major_type_key_t {
+  raft::device_span<edge_t const> offsets{};
+  edge_type_t const* edge_types{};
+  edge_type_t num_edge_types{};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    auto major_idx = static_cast<size_t>(
+      thrust::distance(offsets.begin() + 1,
+                       thrust::upper_bound(
+                         thrust::seq, offsets.begin() + 1, offsets.end(), static_cast<edge_t>(i))));
+    return major_idx * static_cast<size_t>(num_edge_types) + static_cast<size_t>(edge_types[i]);
+  }
+};
+
+template <typename edge_type_t>
+struct is_invalid_edge_type_t {
+  edge_type_t num_edge_types{};
+
+  __device__ bool operator()(edge_type_t type) const
+  {
+    return (type < edge_type_t{0}) || (type >= num_edge_types);
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::vector<edge_partition_edge_type_index_t<vertex_t, edge_t, edge_type_t>>
+build_edge_partition_edge_type_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, edge_type_t const*> edge_type_view,
+  edge_type_t num_edge_types,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(num_edge_types > edge_type_t{0},
+                  "Invalid input argument: num_edge_types should be positive.");
+
+  if (do_expensive_check) {
+    size_t num_invalid_types{0};
+    for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+      auto types = edge_type_view.value_firsts()[i];
+      num_invalid_types += static_cast<size_t>(
+        thrust::count_if(handle.get_thrust_policy(),
+                         types,
+                         types + edge_type_view.edge_counts()[i],
+                         is_invalid_edge_type_t<edge_type_t>{num_edge_types}));
+    }
+    if constexpr (multi_gpu) {
+      num_invalid_types = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_types, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_types == 0,
+                    "Invalid input argument: edge types should be in [0, num_edge_types).");
+  }
+
+  std::vector<edge_partition_edge_type_index_t<vertex_t, edge_t, edge_type_t>> type_indices{};
+  type_indices.reserve(graph_view.number_of_local_edge_partitions());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition_view = graph_view.local_edge_partition_view(i);
+    auto offsets             = edge_partition_view.offsets();
+    auto num_edges           = edge_partition_view.indices().size();
+    auto num_major_indices   = offsets.size() - 1;
+
+    // stable sort to keep the minor vertex order within each (major, type) pair
+
+    rmm::device_uvector<size_t> keys(num_edges, handle.get_stream());
+    thrust::tabulate(handle.get_thrust_policy(),
+                     keys.begin(),
+                     keys.end(),
+                     compute_major_type_key_t<edge_t, edge_type_t>{
+                       offsets, edge_type_view.value_firsts()[i], num_edge_types});
+    rmm::device_uvector<edge_t> edge_indices(num_edges, handle.get_stream());
+    thrust::sequence(
+      handle.get_thrust_policy(), edge_indices.begin(), edge_indices.end(), edge_t{0});
+    thrust::stable_sort_by_key(
+      handle.get_thrust_policy(), keys.begin(), keys.end(), edge_indices.begin());
+
+    rmm::device_uvector<edge_t> type_offsets(
+      num_major_indices * static_cast<size_t>(num_edge_types) + 1, handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        keys.begin(),
+                        keys.end(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(type_offsets.size()),
+                        type_offsets.begin());
+
+    type_indices.emplace_back(std::move(type_offsets), std::move(edge_indices), num_edge_types);
+  }
+
+  return type_indices;
+}
+
+}  // namespace cugraph
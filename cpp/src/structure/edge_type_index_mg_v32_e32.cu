@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/edge_type_index_impl.cuh"
+
+namespace cugraph {
+
+// MG instantiation
+
+template std::vector<edge_partition_edge_type_index_t<int32_t, int32_t, int32_t>>
+build_edge_partition_edge_type_index<int32_t, int32_t, int32_t, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_type_view,
+  int32_t num_edge_types,
+  bool do_expensive_check);
+
+template std::vector<edge_partition_edge_type_index_t<int32_t, int32_t, int32_t>>
+build_edge_partition_edge_type_index<int32_t, int32_t, int32_t, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, int32_t const*> edge_type_view,
+  int32_t num_edge_types,
+  bool do_expensive_check);
+
+}  // namespace cugraph
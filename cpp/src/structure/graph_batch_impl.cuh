@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_batch.hpp>
+#include <cugraph/utilities/atomic_ops.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cub/cub.cuh>
+#include <cuda/std/iterator>
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// FIXME: block size requires tuning (one block processes one graph, and the graphs in a batch
+// typically have tens to thousands of vertices)
+int32_t constexpr graph_batch_block_size = 128;
+
+template <typename vertex_t, typename edge_t>
+__global__ static void batched_bfs_kernel(raft::device_span<vertex_t const> vertex_offsets,
+                                          raft::device_span<edge_t const> offsets,
+                                          raft::device_span<vertex_t const> indices,
+                                          raft::device_span<vertex_t const> sources,
+                                          vertex_t* distances,
+                                          vertex_t* predecessors /* nullptr if not computed */,
+                                          vertex_t depth_limit)
+{
+  auto constexpr unreachable = std::numeric_limits<vertex_t>::max();
+  __shared__ int updated;
+
+  for (size_t g = blockIdx.x; g < vertex_offsets.size() - 1; g += gridDim.x) {
+    auto v_first = vertex_offsets[g];
+    auto v_last  = vertex_offsets[g + 1];
+    for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+      distances[v] = unreachable;
+      if (predecessors != nullptr) { predecessors[v] = invalid_vertex_id<vertex_t>::value; }
+    }
+    __syncthreads();
+    if (threadIdx.x == 0) { distances[v_first + sources[g]] = vertex_t{0}; }
+    __syncthreads();
+
+    for (vertex_t level = 0; level < depth_limit; ++level) {
+      if (threadIdx.x == 0) { updated = 0; }
+      __syncthreads();
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        if (distances[v] != level) { continue; }
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+          auto nbr = indices[e];
+          if (elementwise_atomic_cas(distances + nbr, unreachable, level + 1) == unreachable) {
+            if (predecessors != nullptr) { predecessors[nbr] = v - v_first; }
+            updated = 1;
+          }
+        }
+      }
+      __syncthreads();
+      auto done = (updated == 0);
+      __syncthreads();  // updated is reset in the next iteration
+      if (done) { break; }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+__global__ static void batched_weakly_connected_components_kernel(
+  raft::device_span<vertex_t const> vertex_offsets,
+  raft::device_span<edge_t const> offsets,
+  raft::device_span<vertex_t const> indices,
+  vertex_t* components)
+{
+  __shared__ int updated;
+
+  for (size_t g = blockIdx.x; g < vertex_offsets.size() - 1; g += gridDim.x) {
+    auto v_first = vertex_offsets[g];
+    auto v_last  = vertex_offsets[g + 1];
+    for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+      components[v] = v - v_first;
+    }
+    __syncthreads();
+
+    // labels only decrease and components[v] <= (v - v_first) always holds
+    while (true) {
+      if (threadIdx.x == 0) { updated = 0; }
+      __syncthreads();
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        auto label = components[v];
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+          auto nbr_label = components[indices[e]];
+          if (nbr_label < label) { label = nbr_label; }
+        }
+        if (label < components[v]) {
+          elementwise_atomic_min(components + v, label);
+          updated = 1;
+        }
+      }
+      __syncthreads();
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        auto label = components[v];
+        auto root  = components[v_first + label];
+        if (root < label) { elementwise_atomic_min(components + v, root); }
+      }
+      __syncthreads();
+      auto done = (updated == 0);
+      __syncthreads();
+      if (done) { break; }
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+__global__ static void batched_triangle_count_kernel(
+  raft::device_span<vertex_t const> vertex_offsets,
+  raft::device_span<edge_t const> offsets,
+  raft::device_span<vertex_t const> indices,
+  edge_t* counts)
+{
+  for (size_t g = blockIdx.x; g < vertex_offsets.size() - 1; g += gridDim.x) {
+    auto v_first = vertex_offsets[g];
+    auto v_last  = vertex_offsets[g + 1];
+    for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+      counts[v] = edge_t{0};
+    }
+    __syncthreads();
+
+    // find each triangle (u, v, w) with u < v < w once, from the edge (u, v)
+    auto e_first = offsets[v_first];
+    auto e_last  = offsets[v_last];
+    for (auto e = e_first + static_cast<edge_t>(threadIdx.x); e < e_last; e += blockDim.x) {
+      auto u = static_cast<vertex_t>(
+        cuda::std::distance(
+          offsets.begin(),
+          thrust::upper_bound(
+            thrust::seq, offsets.begin() + v_first, offsets.begin() + v_last + 1, e)) -
+        1);
+      auto v = indices[e];
+      if (v <= u) { continue; }
+      auto u_nbr_first = indices.begin() + (e + 1);
+      auto u_nbr_last  = indices.begin() + offsets[u + 1];
+      auto v_nbr_first = indices.begin() + offsets[v];
+      auto v_nbr_last  = indices.begin() + offsets[v + 1];
+      edge_t count{0};
+      while ((u_nbr_first != u_nbr_last) && (v_nbr_first != v_nbr_last)) {
+        if (*u_nbr_first < *v_nbr_first) {
+          ++u_nbr_first;
+        } else if (*v_nbr_first < *u_nbr_first) {
+          ++v_nbr_first;
+        } else {
+          if (*u_nbr_first > v) {
+            atomic_add(counts + *u_nbr_first, edge_t{1});
+            ++count;
+          }
+          ++u_nbr_first;
+          ++v_nbr_first;
+        }
+      }
+      if (count > 0) {
+        atomic_add(counts + u, count);
+        atomic_add(counts + v, count);
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+__global__ static void batched_pagerank_kernel(raft::device_span<vertex_t const> vertex_offsets,
+                                               raft::device_span<edge_t const> offsets,
+                                               raft::device_span<vertex_t const> indices,
+                                               weight_t const* weights /* nullptr if unweighted */,
+                                               weight_t alpha,
+                                               weight_t epsilon,
+                                               size_t max_iterations,
+                                               weight_t* pageranks,
+                                               weight_t* new_pageranks,
+                                               weight_t* out_weight_sums,
+                                               bool* converged)
+{
+  using BlockReduce = cub::BlockReduce<weight_t, graph_batch_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  __shared__ weight_t block_sum;
+
+  auto block_reduce = [&](weight_t val) {
+    auto sum = BlockReduce(temp_storage).Sum(val);
+    if (threadIdx.x == 0) { block_sum = sum; }
+    __syncthreads();
+    auto ret = block_sum;
+    __syncthreads();  // temp_storage & block_sum are re-used in the next call
+    return ret;
+  };
+
+  for (size_t g = blockIdx.x; g < vertex_offsets.size() - 1; g += gridDim.x) {
+    auto v_first = vertex_offsets[g];
+    auto v_last  = vertex_offsets[g + 1];
+    auto n       = static_cast<weight_t>(v_last - v_first);
+    if (v_first == v_last) {
+      if (threadIdx.x == 0) { converged[g] = true; }
+      continue;
+    }
+
+    for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+      pageranks[v] = weight_t{1.0} / n;
+      weight_t w_sum{0.0};
+      for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+        w_sum += (weights != nullptr) ? weights[e] : weight_t{1.0};
+      }
+      out_weight_sums[v] = w_sum;
+    }
+    __syncthreads();
+
+    bool graph_converged{false};
+    for (size_t iter = 0; iter < max_iterations; ++iter) {
+      weight_t dangling_sum{0.0};
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        if (out_weight_sums[v] == weight_t{0.0}) { dangling_sum += pageranks[v]; }
+      }
+      dangling_sum = block_reduce(dangling_sum);
+
+      auto base = (weight_t{1.0} - alpha) / n + alpha * dangling_sum / n;
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        new_pageranks[v] = base;
+      }
+      __syncthreads();
+
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        if (out_weight_sums[v] == weight_t{0.0}) { continue; }
+        auto scale = alpha * pageranks[v] / out_weight_sums[v];
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+          atomic_add(new_pageranks + indices[e],
+                     scale * ((weights != nullptr) ? weights[e] : weight_t{1.0}));
+        }
+      }
+      __syncthreads();
+
+      weight_t diff_sum{0.0};
+      for (auto v = v_first + static_cast<vertex_t>(threadIdx.x); v < v_last; v += blockDim.x) {
+        auto diff = new_pageranks[v] - pageranks[v];
+        diff_sum += (diff < weight_t{0.0}) ? -diff : diff;
+        pageranks[v] = new_pageranks[v];
+      }
+      diff_sum = block_reduce(diff_sum);
+      if (diff_sum < epsilon) {
+        graph_converged = true;
+        break;
+      }
+    }
+    if (threadIdx.x == 0) { converged[g] = graph_converged; }
+    __syncthreads();
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_graph_batch_is_symmetric(graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch,
+                                    char const* algorithm)
+{
+  CUGRAPH_EXPECTS(graph_batch.is_symmetric(),
+                  std::string("Invalid input argument: ") + algorithm +
+                    " requires a symmetric graph batch.");
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+raft::grid_1d_block_t graph_batch_grid(raft::handle_t const& handle,
+                                       graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch)
+{
+  return raft::grid_1d_block_t(std::max(graph_batch.number_of_graphs(), size_t{1}),
+                               graph_batch_block_size,
+                               handle.get_device_properties().maxGridSize[0]);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+graph_batch_t<vertex_t, edge_t, weight_t> create_graph_batch(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> graph_vertex_counts,
+  rmm::device_uvector<vertex_t>&& edgelist_graph_ids,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  graph_properties_t graph_properties,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((edgelist_graph_ids.size() == edgelist_srcs.size()) &&
+                    (edgelist_srcs.size() == edgelist_dsts.size()),
+                  "Invalid input argument: edgelist_graph_ids, edgelist_srcs, and edgelist_dsts "
+                  "should have the same size.");
+  CUGRAPH_EXPECTS(!edgelist_weights || ((*edgelist_weights).size() == edgelist_srcs.size()),
+                  "Invalid input argument: edgelist_weights.size() != edgelist_srcs.size().");
+
+  auto num_graphs = graph_vertex_counts.size();
+
+  rmm::device_uvector<vertex_t> vertex_offsets(num_graphs + 1, handle.get_stream());
+  vertex_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         graph_vertex_counts.begin(),
+                         graph_vertex_counts.end(),
+                         vertex_offsets.begin() + 1);
+  auto num_vertices = vertex_offsets.back_element(handle.get_stream());
+
+  if (do_expensive_check) {
+    auto num_invalid_edges = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(
+        edgelist_graph_ids.begin(), edgelist_srcs.begin(), edgelist_dsts.begin()),
+      thrust::make_zip_iterator(
+        edgelist_graph_ids.end(), edgelist_srcs.end(), edgelist_dsts.end()),
+      [graph_vertex_counts] __device__(auto triplet) {
+        auto g = thrust::get<0>(triplet);
+        if ((g < 0) || (static_cast<size_t>(g) >= graph_vertex_counts.size())) { return true; }
+        auto src = thrust::get<1>(triplet);
+        auto dst = thrust::get<2>(triplet);
+        return (src < 0) || (src >= graph_vertex_counts[g]) || (dst < 0) ||
+               (dst >= graph_vertex_counts[g]);
+      });
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid input argument: edge list has invalid graph IDs or vertex IDs.");
+  }
+
+  // 1. convert local vertex IDs to concatenated vertex IDs
+
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(edgelist_graph_ids.begin(), edgelist_srcs.begin()),
+    thrust::make_zip_iterator(edgelist_graph_ids.end(), edgelist_srcs.end()),
+    edgelist_srcs.begin(),
+    [vertex_offsets = vertex_offsets.data()] __device__(auto pair) {
+      return vertex_offsets[thrust::get<0>(pair)] + thrust::get<1>(pair);
+    });
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(edgelist_graph_ids.begin(), edgelist_dsts.begin()),
+    thrust::make_zip_iterator(edgelist_graph_ids.end(), edgelist_dsts.end()),
+    edgelist_dsts.begin(),
+    [vertex_offsets = vertex_offsets.data()] __device__(auto pair) {
+      return vertex_offsets[thrust::get<0>(pair)] + thrust::get<1>(pair);
+    });
+  edgelist_graph_ids.resize(0, handle.get_stream());
+  edgelist_graph_ids.shrink_to_fit(handle.get_stream());
+
+  // 2. build a CSR with sorted neighbor lists
+
+  auto edge_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+  if (edgelist_weights) {
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        edge_first,
+                        edge_first + edgelist_srcs.size(),
+                        (*edgelist_weights).begin());
+  } else {
+    thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + edgelist_srcs.size());
+  }
+
+  rmm::device_uvector<edge_t> offsets(static_cast<size_t>(num_vertices) + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      edgelist_srcs.begin(),
+                      edgelist_srcs.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_vertices + 1),
+                      offsets.begin());
+  edgelist_srcs.resize(0, handle.get_stream());
+  edgelist_srcs.shrink_to_fit(handle.get_stream());
+
+  return graph_batch_t<vertex_t, edge_t, weight_t>(std::move(vertex_offsets),
+                                                   std::move(offsets),
+                                                   std::move(edgelist_dsts),
+                                                   std::move(edgelist_weights),
+                                                   graph_properties);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<vertex_t>>>
+batched_bfs(raft::handle_t const& handle,
+            graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch,
+            raft::device_span<vertex_t const> sources,
+            bool compute_predecessors,
+            vertex_t depth_limit,
+            bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(sources.size() == graph_batch.number_of_graphs(),
+                  "Invalid input argument: sources.size() should match the number of graphs.");
+
+  if (do_expensive_check) {
+    auto num_invalid_sources = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(sources.size()),
+      [sources, vertex_offsets = graph_batch.vertex_offsets()] __device__(size_t g) {
+        return (sources[g] < 0) || (sources[g] >= vertex_offsets[g + 1] - vertex_offsets[g]);
+      });
+    CUGRAPH_EXPECTS(num_invalid_sources == 0,
+                    "Invalid input argument: sources have out-of-range vertex IDs.");
+  }
+
+  rmm::device_uvector<vertex_t> distances(graph_batch.number_of_vertices(), handle.get_stream());
+  auto predecessors = compute_predecessors
+                        ? std::make_optional<rmm::device_uvector<vertex_t>>(
+                            graph_batch.number_of_vertices(), handle.get_stream())
+                        : std::nullopt;
+
+  if (graph_batch.number_of_graphs() > 0) {
+    auto update_grid = detail::graph_batch_grid(handle, graph_batch);
+    detail::batched_bfs_kernel<<<update_grid.num_blocks,
+                                 update_grid.block_size,
+                                 0,
+                                 handle.get_stream()>>>(
+      graph_batch.vertex_offsets(),
+      graph_batch.offsets(),
+      graph_batch.indices(),
+      sources,
+      distances.data(),
+      predecessors ? (*predecessors).data() : static_cast<vertex_t*>(nullptr),
+      depth_limit);
+  }
+
+  return std::make_tuple(std::move(distances), std::move(predecessors));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<vertex_t> batched_weakly_connected_components(
+  raft::handle_t const& handle, graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch)
+{
+  detail::check_graph_batch_is_symmetric(graph_batch, "batched_weakly_connected_components");
+
+  rmm::device_uvector<vertex_t> components(graph_batch.number_of_vertices(), handle.get_stream());
+
+  if (graph_batch.number_of_graphs() > 0) {
+    auto update_grid = detail::graph_batch_grid(handle, graph_batch);
+    detail::batched_weakly_connected_components_kernel<<<update_grid.num_blocks,
+                                                         update_grid.block_size,
+                                                         0,
+                                                         handle.get_stream()>>>(
+      graph_batch.vertex_offsets(),
+      graph_batch.offsets(),
+      graph_batch.indices(),
+      components.data());
+  }
+
+  return components;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<edge_t> batched_triangle_count(
+  raft::handle_t const& handle, graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch)
+{
+  detail::check_graph_batch_is_symmetric(graph_batch, "batched_triangle_count");
+  CUGRAPH_EXPECTS(!graph_batch.is_multigraph(),
+                  "Invalid input argument: batched_triangle_count does not support multi-graphs.");
+
+  rmm::device_uvector<edge_t> counts(graph_batch.number_of_vertices(), handle.get_stream());
+
+  if (graph_batch.number_of_graphs() > 0) {
+    auto update_grid = detail::graph_batch_grid(handle, graph_batch);
+    detail::batched_triangle_count_kernel<<<update_grid.num_blocks,
+                                            update_grid.block_size,
+                                            0,
+                                            handle.get_stream()>>>(
+      graph_batch.vertex_offsets(), graph_batch.offsets(), graph_batch.indices(), counts.data());
+  }
+
+  return counts;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> batched_pagerank(
+  raft::handle_t const& handle,
+  graph_batch_t<vertex_t, edge_t, weight_t> const& graph_batch,
+  weight_t alpha,
+  weight_t epsilon,
+  size_t max_iterations)
+{
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  rmm::device_uvector<weight_t> pageranks(graph_batch.number_of_vertices(), handle.get_stream());
+
+  if (graph_batch.number_of_graphs() > 0) {
+    rmm::device_uvector<weight_t> new_pageranks(pageranks.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> out_weight_sums(pageranks.size(), handle.get_stream());
+    rmm::device_uvector<bool> converged(graph_batch.number_of_graphs(), handle.get_stream());
+
+    auto weights     = graph_batch.weights();
+    auto update_grid = detail::graph_batch_grid(handle, graph_batch);
+    detail::batched_pagerank_kernel<<<update_grid.num_blocks,
+                                      update_grid.block_size,
+                                      0,
+                                      handle.get_stream()>>>(
+      graph_batch.vertex_offsets(),
+      graph_batch.offsets(),
+      graph_batch.indices(),
+      weights ? (*weights).data() : static_cast<weight_t const*>(nullptr),
+      alpha,
+      epsilon,
+      max_iterations,
+      pageranks.data(),
+      new_pageranks.data(),
+      out_weight_sums.data(),
+      converged.data());
+
+    auto num_unconverged = thrust::count(
+      handle.get_thrust_policy(), converged.begin(), converged.end(), false);
+    CUGRAPH_EXPECTS(num_unconverged == 0,
+                    "batched_pagerank failed to converge within max_iterations for some graphs.");
+  }
+
+  return pageranks;
+}
+
+}  // namespace cugraph
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/graph_batch_impl.cuh"
+
+namespace cugraph {
+
+// explicit instantiations
+
+template graph_batch_t<int32_t, int32_t, float> create_graph_batch(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> graph_vertex_counts,
+  rmm::device_uvector<int32_t>&& edgelist_graph_ids,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<float>>&& edgelist_weights,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<int32_t>>>
+batched_bfs(raft::handle_t const& handle,
+            graph_batch_t<int32_t, int32_t, float> const& graph_batch,
+            raft::device_span<int32_t const> sources,
+            bool compute_predecessors,
+            int32_t depth_limit,
+            bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> batched_weakly_connected_components(
+  raft::handle_t const& handle, graph_batch_t<int32_t, int32_t, float> const& graph_batch);
+
+template rmm::device_uvector<int32_t> batched_triangle_count(
+  raft::handle_t const& handle, graph_batch_t<int32_t, int32_t, float> const& graph_batch);
+
+template rmm::device_uvector<float> batched_pagerank(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int32_t, float> const& graph_batch,
+  float alpha,
+  float epsilon,
+  size_t max_iterations);
+
+template graph_batch_t<int32_t, int32_t, double> create_graph_batch(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> graph_vertex_counts,
+  rmm::device_uvector<int32_t>&& edgelist_graph_ids,
+  rmm::device_uvector<int32_t>&& edgelist_srcs,
+  rmm::device_uvector<int32_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<double>>&& edgelist_weights,
+  graph_properties_t graph_properties,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::optional<rmm::device_uvector<int32_t>>>
+batched_bfs(raft::handle_t const& handle,
+            graph_batch_t<int32_t, int32_t, double> const& graph_batch,
+            raft::device_span<int32_t const> sources,
+            bool compute_predecessors,
+            int32_t depth_limit,
+            bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> batched_weakly_connected_components(
+  raft::handle_t const& handle, graph_batch_t<int32_t, int32_t, double> const& graph_batch);
+
+template rmm::device_uvector<int32_t> batched_triangle_count(
+  raft::handle_t const& handle, graph_batch_t<int32_t, int32_t, double> const& graph_batch);
+
+template rmm::device_uvector<double> batched_pagerank(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int32_t, double> const& graph_batch,
+  double alpha,
+  double epsilon,
+  size_t max_iterations);
+
+}  // namespace cugraph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,6 +35,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/functional>
 #include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
@@ -163,9 +164,14 @@ update_local_sorted_unique_edge_majors_minors(
   // if # unique edge majors/minors << V / major_comm_size|minor_comm_size, store unique edge
   // majors/minors to support storing edge major/minor properties in (key, value) pairs.
 
+  auto kv_pair_fill_ratio_threshold =
+    meta.properties.is_bipartite
+      ? detail::bipartite_edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold
+      : detail::edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold;
+
   // 1. Update local_sorted_unique_edge_minors & local_sorted_unique_edge_minor_offsets
 
-  if (detail::edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold > 0.0) {
+  if (kv_pair_fill_ratio_threshold > 0.0) {
     auto [minor_range_first, minor_range_last] = meta.partition.local_edge_partition_minor_range();
     auto minor_range_size = meta.partition.local_edge_partition_minor_range_size();
     rmm::device_uvector<uint32_t> minor_bitmaps(packed_bool_size(minor_range_size),
@@ -191,8 +197,7 @@ update_local_sorted_unique_edge_majors_minors(
       raft::comms::op_t::MAX,
       handle.get_stream());
 
-    if (max_minor_properties_fill_ratio <
-        detail::edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold) {
+    if (max_minor_properties_fill_ratio < kv_pair_fill_ratio_threshold) {
       auto const chunk_size =
         static_cast<size_t>(std::min(1.0 / max_minor_properties_fill_ratio, 1024.0));
 
@@ -281,7 +286,7 @@ update_local_sorted_unique_edge_majors_minors(
 
   // 2. Update local_sorted_unique_edge_majors & local_sorted_unique_edge_major_offsets
 
-  if (detail::edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold > 0.0) {
+  if (kv_pair_fill_ratio_threshold > 0.0) {
     std::vector<vertex_t> num_local_unique_edge_major_counts(edge_partition_offsets.size());
     for (size_t i = 0; i < edge_partition_offsets.size(); ++i) {
       num_local_unique_edge_major_counts[i] = thrust::count_if(
@@ -305,8 +310,7 @@ update_local_sorted_unique_edge_majors_minors(
                             raft::comms::op_t::MAX,
                             handle.get_stream());
 
-    if (max_major_properties_fill_ratio <
-        detail::edge_partition_src_dst_property_values_kv_pair_fill_ratio_threshold) {
+    if (max_major_properties_fill_ratio < kv_pair_fill_ratio_threshold) {
       auto const chunk_size =
         static_cast<size_t>(std::min(1.0 / max_major_properties_fill_ratio, 1024.0));
 
@@ -511,4 +515,106 @@ graph_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!multi_g
 {
 }
 
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+graph_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::graph_t(
+  raft::handle_t const& handle,
+  raft::device_span<edge_t const> offsets,
+  raft::device_span<vertex_t const> indices,
+  graph_meta_t<vertex_t, edge_t, multi_gpu> meta,
+  bool do_expensive_check)
+  : detail::graph_base_t<vertex_t, edge_t>(
+      meta.number_of_vertices, static_cast<edge_t>(indices.size()), meta.properties),
+    offsets_(0, handle.get_stream()),
+    indices_(0, handle.get_stream()),
+    external_offsets_(offsets),
+    external_indices_(indices),
+    segment_offsets_(meta.segment_offsets),
+    hypersparse_degree_offsets_(meta.hypersparse_degree_offsets)
+{
+  CUGRAPH_EXPECTS(offsets.size() == static_cast<size_t>(meta.number_of_vertices) + 1,
+                  "Invalid input argument: offsets.size() should be number_of_vertices + 1.");
+  CUGRAPH_EXPECTS(!meta.segment_offsets || ((*(meta.segment_offsets)).size() ==
+                                            detail::num_sparse_segments_per_vertex_partition + 2),
+                  "Invalid input argument: (*(meta.segment_offsets)).size() returns an invalid "
+                  "value.");
+
+  if (do_expensive_check) {
+    std::vector<edge_t> h_first_last(2);
+    raft::update_host(h_first_last.data(), offsets.data(), 1, handle.get_stream());
+    raft::update_host(
+      h_first_last.data() + 1, offsets.data() + offsets.size() - 1, 1, handle.get_stream());
+    handle.sync_stream();
+    CUGRAPH_EXPECTS(
+      (h_first_last[0] == 0) && (h_first_last[1] == static_cast<edge_t>(indices.size())),
+      "Invalid input argument: offsets should start at 0 and end at indices.size().");
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(), offsets.begin(), offsets.end()),
+                    "Invalid input argument: offsets should be non-decreasing.");
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     indices.begin(),
+                                     indices.end(),
+                                     detail::check_out_of_range_t<vertex_t>{
+                                       vertex_t{0}, meta.number_of_vertices}) == 0,
+                    "Invalid input argument: indices should be in [0, number_of_vertices).");
+    if (meta.segment_offsets) {
+      auto recomputed =
+        compute_sorted_degree_segment_offsets<vertex_t, edge_t>(handle, offsets, true);
+      CUGRAPH_EXPECTS(recomputed == *(meta.segment_offsets),
+                      "Invalid input argument: meta.segment_offsets does not match the degrees.");
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> compute_sorted_degree_segment_offsets(
+  raft::handle_t const& handle, raft::device_span<edge_t const> offsets, bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(offsets.size() > 0, "Invalid input argument: offsets should not be empty.");
+
+  auto num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+  auto degree_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(vertex_t{0}),
+    cuda::proclaim_return_type<edge_t>(
+      [offsets] __device__(vertex_t v) { return offsets[v + 1] - offsets[v]; }));
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(),
+                                      degree_first,
+                                      degree_first + num_vertices,
+                                      thrust::greater<edge_t>{}),
+                    "Invalid input argument: vertices should be sorted by degree (non-ascending).");
+  }
+
+  // same thresholds as the renumbering (single-GPU, so no hypersparse segment)
+  static_assert(detail::num_sparse_segments_per_vertex_partition == 3);
+  size_t low_degree_threshold{detail::low_degree_threshold};
+  if (get_degree_segment_policy_hint(handle) == degree_segment_policy_t::adaptive) {
+    low_degree_threshold = detail::compute_adaptive_low_degree_threshold(
+      handle, degree_first, degree_first + num_vertices, detail::mid_degree_threshold, size_t{1});
+  }
+  std::vector<edge_t> h_thresholds{static_cast<edge_t>(detail::mid_degree_threshold),
+                                   static_cast<edge_t>(low_degree_threshold),
+                                   edge_t{1}};
+  rmm::device_uvector<edge_t> d_thresholds(h_thresholds.size(), handle.get_stream());
+  raft::update_device(
+    d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), handle.get_stream());
+
+  rmm::device_uvector<vertex_t> d_boundaries(h_thresholds.size(), handle.get_stream());
+  thrust::upper_bound(handle.get_thrust_policy(),
+                      degree_first,
+                      degree_first + num_vertices,
+                      d_thresholds.begin(),
+                      d_thresholds.end(),
+                      d_boundaries.begin(),
+                      thrust::greater<edge_t>{});
+
+  std::vector<vertex_t> segment_offsets(detail::num_sparse_segments_per_vertex_partition + 2);
+  segment_offsets[0] = vertex_t{0};
+  raft::update_host(
+    segment_offsets.data() + 1, d_boundaries.data(), d_boundaries.size(), handle.get_stream());
+  segment_offsets.back() = num_vertices;
+  handle.sync_stream();
+
+  return segment_offsets;
+}
+
 }  // namespace cugraph
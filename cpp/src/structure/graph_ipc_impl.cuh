@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_ipc.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+inline cudaUUID_t current_device_uuid()
+{
+  int device_id{};
+  RAFT_CUDA_TRY(cudaGetDevice(&device_id));
+  cudaDeviceProp prop{};
+  RAFT_CUDA_TRY(cudaGetDeviceProperties(&prop, device_id));
+  return prop.uuid;
+}
+
+// CUDA IPC handle of the allocation containing ptr and the byte offset of ptr in the allocation
+inline std::tuple<cudaIpcMemHandle_t, size_t> get_ipc_mem_handle(void const* ptr)
+{
+  CUdeviceptr base{};
+  size_t size{};
+  CUGRAPH_EXPECTS(
+    cuMemGetAddressRange(&base, &size, reinterpret_cast<CUdeviceptr>(ptr)) == CUDA_SUCCESS,
+    "cuMemGetAddressRange failed.");
+  cudaIpcMemHandle_t mem_handle{};
+  RAFT_CUDA_TRY(cudaIpcGetMemHandle(&mem_handle, reinterpret_cast<void*>(base)));
+  return std::make_tuple(mem_handle,
+                         static_cast<size_t>(reinterpret_cast<CUdeviceptr>(ptr) - base));
+}
+
+inline std::shared_ptr<void> open_ipc_mem_handle(cudaIpcMemHandle_t const& mem_handle)
+{
+  void* ptr{nullptr};
+  RAFT_CUDA_TRY(cudaIpcOpenMemHandle(&ptr, mem_handle, cudaIpcMemLazyEnablePeerAccess));
+  return std::shared_ptr<void>(ptr,
+                               [](void* p) { RAFT_CUDA_TRY_NO_THROW(cudaIpcCloseMemHandle(p)); });
+}
+
+template <typename vertex_t, typename edge_t>
+std::shared_ptr<void> open_graph_ipc_offsets(graph_ipc_handle_t<vertex_t, edge_t> const& ipc_handle,
+                                             bool store_transposed)
+{
+  auto device_uuid = current_device_uuid();
+  CUGRAPH_EXPECTS(
+    std::memcmp(&device_uuid, &(ipc_handle.device_uuid), sizeof(cudaUUID_t)) == 0,
+    "Invalid input argument: ipc_handle is exported from a device other than the current device.");
+  CUGRAPH_EXPECTS(ipc_handle.store_transposed == store_transposed,
+                  "Invalid input argument: store_transposed does not match with the exported "
+                  "graph.");
+
+  return open_ipc_mem_handle(ipc_handle.offsets_mem_handle);
+}
+
+template <typename vertex_t, typename edge_t>
+std::shared_ptr<void> open_graph_ipc_indices(graph_ipc_handle_t<vertex_t, edge_t> const& ipc_handle,
+                                             std::shared_ptr<void> const& offsets_mapping)
+{
+  if (ipc_handle.number_of_edges == 0) { return std::shared_ptr<void>{}; }
+
+  // an allocation can be opened only once per process
+  if (std::memcmp(&(ipc_handle.indices_mem_handle),
+                  &(ipc_handle.offsets_mem_handle),
+                  sizeof(cudaIpcMemHandle_t)) == 0) {
+    return offsets_mapping;
+  }
+  return open_ipc_mem_handle(ipc_handle.indices_mem_handle);
+}
+
+template <typename T>
+raft::device_span<T const> mapped_span(std::shared_ptr<void> const& mapping,
+                                       size_t byte_offset,
+                                       size_t size)
+{
+  return size > 0 ? raft::device_span<T const>(
+                      reinterpret_cast<T const*>(static_cast<char const*>(mapping.get()) +
+                                                 byte_offset),
+                      size)
+                  : raft::device_span<T const>();
+}
+
+template <typename vertex_t, typename edge_t>
+graph_meta_t<vertex_t, edge_t, false> graph_ipc_meta(
+  graph_ipc_handle_t<vertex_t, edge_t> const& ipc_handle)
+{
+  return graph_meta_t<vertex_t, edge_t, false>{
+    ipc_handle.number_of_vertices,
+    ipc_handle.properties,
+    ipc_handle.has_segment_offsets
+      ? std::make_optional<std::vector<vertex_t>>(ipc_handle.segment_offsets.begin(),
+                                                  ipc_handle.segment_offsets.end())
+      : std::nullopt,
+    std::nullopt};
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool store_transposed>
+graph_ipc_handle_t<vertex_t, edge_t> export_graph_ipc_handle(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, false> const& graph_view)
+{
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(),
+                  "Invalid input argument: graph_view should not have an edge mask.");
+  CUGRAPH_EXPECTS(!graph_view.local_vertex_partition_hypersparse_degree_offsets(),
+                  "Invalid input argument: graphs with hypersparse degree offsets are not "
+                  "supported.");
+
+  graph_ipc_handle_t<vertex_t, edge_t> ipc_handle{};
+  ipc_handle.device_uuid        = detail::current_device_uuid();
+  ipc_handle.store_transposed   = store_transposed;
+  ipc_handle.number_of_vertices = graph_view.number_of_vertices();
+  ipc_handle.number_of_edges    = graph_view.number_of_edges();
+  ipc_handle.properties         =
+    graph_properties_t{graph_view.is_symmetric(), graph_view.is_multigraph()};
+
+  auto edge_partition = graph_view.local_edge_partition_view();
+  std::tie(ipc_handle.offsets_mem_handle, ipc_handle.offsets_byte_offset) =
+    detail::get_ipc_mem_handle(edge_partition.offsets().data());
+  if (ipc_handle.number_of_edges > 0) {
+    std::tie(ipc_handle.indices_mem_handle, ipc_handle.indices_byte_offset) =
+      detail::get_ipc_mem_handle(edge_partition.indices().data());
+  }
+
+  auto segment_offsets = graph_view.local_vertex_partition_segment_offsets();
+  if (segment_offsets) {
+    CUGRAPH_EXPECTS((*segment_offsets).size() == ipc_handle.segment_offsets.size(),
+                    "Invalid input argument: graph_view has an invalid number of segment offsets.");
+    ipc_handle.has_segment_offsets = true;
+    std::copy((*segment_offsets).begin(),
+              (*segment_offsets).end(),
+              ipc_handle.segment_offsets.begin());
+  }
+
+  // the other processes read the arrays without synchronizing with this process's streams
+  handle.sync_stream();
+
+  return ipc_handle;
+}
+
+template <typename vertex_t, typename edge_t, bool store_transposed>
+attached_graph_t<vertex_t, edge_t, store_transposed>::attached_graph_t(
+  raft::handle_t const& handle,
+  graph_ipc_handle_t<vertex_t, edge_t> const& ipc_handle,
+  bool do_expensive_check)
+  : offsets_mapping_(detail::open_graph_ipc_offsets(ipc_handle, store_transposed)),
+    indices_mapping_(detail::open_graph_ipc_indices(ipc_handle, offsets_mapping_)),
+    graph_(handle,
+           detail::mapped_span<edge_t>(offsets_mapping_,
+                                       ipc_handle.offsets_byte_offset,
+                                       static_cast<size_t>(ipc_handle.number_of_vertices) + 1),
+           detail::mapped_span<vertex_t>(indices_mapping_,
+                                         ipc_handle.indices_byte_offset,
+                                         static_cast<size_t>(ipc_handle.number_of_edges)),
+           detail::graph_ipc_meta(ipc_handle),
+           do_expensive_check)
+{
+}
+
+}  // namespace cugraph
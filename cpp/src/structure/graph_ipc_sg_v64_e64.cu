@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/graph_ipc_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template graph_ipc_handle_t<int64_t, int64_t> export_graph_ipc_handle<int64_t, int64_t, false>(
+  raft::handle_t const& handle, graph_view_t<int64_t, int64_t, false, false> const& graph_view);
+
+template graph_ipc_handle_t<int64_t, int64_t> export_graph_ipc_handle<int64_t, int64_t, true>(
+  raft::handle_t const& handle, graph_view_t<int64_t, int64_t, true, false> const& graph_view);
+
+template class attached_graph_t<int64_t, int64_t, false>;
+template class attached_graph_t<int64_t, int64_t, true>;
+
+}  // namespace cugraph
@@ -22,4 +22,9 @@ namespace cugraph {
 template class graph_t<int32_t, int32_t, true, false>;
 template class graph_t<int32_t, int32_t, false, false>;
 
+template std::vector<int32_t> compute_sorted_degree_segment_offsets<int32_t, int32_t>(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> offsets,
+  bool do_expensive_check);
+
 }  // namespace cugraph
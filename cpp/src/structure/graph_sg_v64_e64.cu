@@ -22,4 +22,9 @@ namespace cugraph {
 template class graph_t<int64_t, int64_t, true, false>;
 template class graph_t<int64_t, int64_t, false, false>;
 
+template std::vector<int64_t> compute_sorted_degree_segment_offsets<int64_t, int64_t>(
+  raft::handle_t const& handle,
+  raft::device_span<int64_t const> offsets,
+  bool do_expensive_check);
+
 }  // namespace cugraph
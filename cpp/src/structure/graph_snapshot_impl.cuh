@@ -0,0 +1,706 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#ifdef CUGRAPH_ENABLE_CUFILE
+#include <cufile.h>
+#endif
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// Snapshot file layout: a fixed size header followed by a sequence of sections. Each section
+// stores its size in bytes (as a uint64_t) followed by the section data, and every section starts
+// at a snapshot_section_alignment byte boundary (so the section data can be read in place from the
+// memory mapped file).
+//
+// sections (in this order; optional sections are present only if the matching flag is set):
+//   vertex partition range offsets (multi-GPU only, comm_size + 1 vertex_t values)
+//   edge partition segment offsets (concatenated over the local edge partitions, optional in SG)
+//   edge partition hypersparse degree offsets (concatenated, optional)
+//   for each local edge partition:
+//     offsets, indices, DCS non-zero major vertices (optional), edge weights (optional), edge IDs
+//     (optional), edge types (optional)
+//   renumber map (optional, local vertex partition range size vertex_t values)
+
+constexpr char snapshot_magic[8]            = {'C', 'U', 'G', 'R', 'A', 'P', 'H', 'S'};
+constexpr uint32_t snapshot_version         = 1;
+constexpr size_t snapshot_section_alignment = 64;
+
+constexpr uint32_t snapshot_flag_store_transposed           = uint32_t{1} << 0;
+constexpr uint32_t snapshot_flag_multi_gpu                  = uint32_t{1} << 1;
+constexpr uint32_t snapshot_flag_symmetric                  = uint32_t{1} << 2;
+constexpr uint32_t snapshot_flag_multigraph                 = uint32_t{1} << 3;
+constexpr uint32_t snapshot_flag_segment_offsets            = uint32_t{1} << 4;
+constexpr uint32_t snapshot_flag_hypersparse_degree_offsets = uint32_t{1} << 5;
+constexpr uint32_t snapshot_flag_dcs_nzd_vertices           = uint32_t{1} << 6;
+constexpr uint32_t snapshot_flag_edge_weights               = uint32_t{1} << 7;
+constexpr uint32_t snapshot_flag_edge_ids                   = uint32_t{1} << 8;
+constexpr uint32_t snapshot_flag_edge_types                 = uint32_t{1} << 9;
+constexpr uint32_t snapshot_flag_renumber_map               = uint32_t{1} << 10;
+
+struct snapshot_header_t {
+  char magic[8]{};
+  uint32_t version{};
+  uint32_t flags{};
+  uint32_t vertex_size{};
+  uint32_t edge_size{};
+  uint32_t weight_size{};
+  uint32_t edge_type_size{};
+  int32_t comm_size{};
+  int32_t major_comm_size{};
+  int32_t minor_comm_size{};
+  int32_t comm_rank{};
+  int64_t number_of_vertices{};
+  int64_t number_of_edges{};
+  uint64_t number_of_local_edge_partitions{};
+};
+
+inline std::string snapshot_filename(std::string const& filename, bool multi_gpu, int comm_rank)
+{
+  return multi_gpu ? filename + "." + std::to_string(comm_rank) : filename;
+}
+
+inline void write_snapshot_padding(std::ofstream& ofs)
+{
+  auto pos = static_cast<size_t>(ofs.tellp());
+  auto pad = (snapshot_section_alignment - (pos % snapshot_section_alignment)) %
+             snapshot_section_alignment;
+  char zeros[snapshot_section_alignment]{};
+  ofs.write(zeros, pad);
+}
+
+template <typename T>
+void write_snapshot_host_section(std::ofstream& ofs, T const* values, size_t count)
+{
+  write_snapshot_padding(ofs);
+  uint64_t num_bytes = count * sizeof(T);
+  ofs.write(reinterpret_cast<char const*>(&num_bytes), sizeof(num_bytes));
+  write_snapshot_padding(ofs);
+  ofs.write(reinterpret_cast<char const*>(values), num_bytes);
+}
+
+#ifdef CUGRAPH_ENABLE_CUFILE
+// GPUDirect Storage file handle, data is moved between the storage and the device memory by DMA
+// without a host bounce buffer. The handle is invalid if the cuFile driver cannot be opened or the
+// file cannot be registered (e.g. the file system does not support O_DIRECT).
+class cufile_handle_t {
+ public:
+  cufile_handle_t(std::string const& filename, bool write)
+  {
+    if (cuFileDriverOpen().err != CU_FILE_SUCCESS) { return; }
+    driver_opened_ = true;
+    fd_            = ::open(filename.c_str(), (write ? O_WRONLY : O_RDONLY) | O_DIRECT);
+    if (fd_ == -1) { return; }
+    CUfileDescr_t descr{};
+    descr.handle.fd = fd_;
+    descr.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    registered_     = (cuFileHandleRegister(&handle_, &descr).err == CU_FILE_SUCCESS);
+  }
+
+  cufile_handle_t(cufile_handle_t const&)            = delete;
+  cufile_handle_t& operator=(cufile_handle_t const&) = delete;
+
+  ~cufile_handle_t()
+  {
+    if (registered_) { cuFileHandleDeregister(handle_); }
+    if (fd_ != -1) { ::close(fd_); }
+    if (driver_opened_) { cuFileDriverClose(); }
+  }
+
+  bool valid() const { return registered_; }
+
+  void read(void* dst, size_t num_bytes, size_t file_offset)
+  {
+    size_t num_read{0};
+    while (num_read < num_bytes) {
+      auto ret = cuFileRead(handle_,
+                            dst,
+                            num_bytes - num_read,
+                            static_cast<off_t>(file_offset + num_read),
+                            static_cast<off_t>(num_read));
+      CUGRAPH_EXPECTS(ret > 0, "Failed to read the snapshot file with cuFile.");
+      num_read += static_cast<size_t>(ret);
+    }
+  }
+
+  void write(void const* src, size_t num_bytes, size_t file_offset)
+  {
+    size_t num_written{0};
+    while (num_written < num_bytes) {
+      auto ret = cuFileWrite(handle_,
+                             src,
+                             num_bytes - num_written,
+                             static_cast<off_t>(file_offset + num_written),
+                             static_cast<off_t>(num_written));
+      CUGRAPH_EXPECTS(ret > 0, "Failed to write the snapshot file with cuFile.");
+      num_written += static_cast<size_t>(ret);
+    }
+  }
+
+ private:
+  bool driver_opened_{false};
+  int fd_{-1};
+  bool registered_{false};
+  CUfileHandle_t handle_{};
+};
+#endif
+
+// device section data to write with cuFile after the buffered (std::ofstream) writes are complete
+struct snapshot_deferred_section_t {
+  void const* values{};
+  size_t num_bytes{};
+  size_t file_offset{};
+};
+
+// if deferred_sections.has_value(), only the section size is written and the section data is left
+// as a hole (to be written with cuFile after closing ofs, buffered and O_DIRECT writes are not
+// interleaved); otherwise, the section data is staged in host memory
+template <typename T>
+void write_snapshot_device_section(
+  raft::handle_t const& handle,
+  std::ofstream& ofs,
+  std::optional<std::vector<snapshot_deferred_section_t>>& deferred_sections,
+  T const* values,
+  size_t count)
+{
+  if (deferred_sections) {
+    write_snapshot_padding(ofs);
+    uint64_t num_bytes = count * sizeof(T);
+    ofs.write(reinterpret_cast<char const*>(&num_bytes), sizeof(num_bytes));
+    write_snapshot_padding(ofs);
+    auto file_offset = static_cast<size_t>(ofs.tellp());
+    (*deferred_sections).push_back(
+      snapshot_deferred_section_t{values, static_cast<size_t>(num_bytes), file_offset});
+    ofs.seekp(static_cast<std::streamoff>(file_offset + num_bytes));
+    return;
+  }
+  std::vector<T> h_values(count);
+  raft::update_host(h_values.data(), values, count, handle.get_stream());
+  handle.sync_stream();
+  write_snapshot_host_section(ofs, h_values.data(), count);
+}
+
+// memory mapped (read-only) snapshot file, sections are read sequentially (device sections are
+// read with cuFile if available, so their data is never paged into host memory)
+class snapshot_reader_t {
+ public:
+  snapshot_reader_t(std::string const& filename)
+#ifdef CUGRAPH_ENABLE_CUFILE
+    : cufile_(filename, false)
+#endif
+  {
+    fd_ = ::open(filename.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd_ != -1, "Failed to open the snapshot file (%s).", filename.c_str());
+    struct stat st {};
+    if (::fstat(fd_, &st) != 0) {
+      ::close(fd_);
+      CUGRAPH_FAIL("Failed to query the snapshot file size.");
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+      auto ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (ptr == MAP_FAILED) {
+        ::close(fd_);
+        CUGRAPH_FAIL("Failed to memory map the snapshot file.");
+      }
+      base_ = static_cast<std::byte const*>(ptr);
+    }
+  }
+
+  snapshot_reader_t(snapshot_reader_t const&)            = delete;
+  snapshot_reader_t& operator=(snapshot_reader_t const&) = delete;
+
+  ~snapshot_reader_t()
+  {
+    if (base_ != nullptr) { ::munmap(const_cast<std::byte*>(base_), size_); }
+    if (fd_ != -1) { ::close(fd_); }
+  }
+
+  snapshot_header_t read_header()
+  {
+    CUGRAPH_EXPECTS(size_ >= sizeof(snapshot_header_t), "Invalid snapshot file: truncated header.");
+    snapshot_header_t header{};
+    std::memcpy(&header, base_, sizeof(snapshot_header_t));
+    offset_ = sizeof(snapshot_header_t);
+    CUGRAPH_EXPECTS(std::memcmp(header.magic, snapshot_magic, sizeof(snapshot_magic)) == 0,
+                    "Invalid snapshot file: magic number mismatch.");
+    CUGRAPH_EXPECTS(header.version == snapshot_version,
+                    "Unsupported snapshot file version (%u).",
+                    static_cast<unsigned>(header.version));
+    return header;
+  }
+
+  template <typename T>
+  raft::host_span<T const> next_section()
+  {
+    auto num_bytes = next_section_size<T>();
+    auto first     = reinterpret_cast<T const*>(base_ + offset_);
+    offset_ += num_bytes;
+    return raft::host_span<T const>(first, num_bytes / sizeof(T));
+  }
+
+  // the returned buffer is valid only after synchronizing the stream (and the mapped memory should
+  // remain valid until then)
+  template <typename T>
+  rmm::device_uvector<T> next_device_section(rmm::cuda_stream_view stream_view)
+  {
+#ifdef CUGRAPH_ENABLE_CUFILE
+    if (cufile_.valid()) {
+      auto num_bytes = next_section_size<T>();
+      rmm::device_uvector<T> d_values(num_bytes / sizeof(T), stream_view);
+      stream_view.synchronize();  // cuFileRead is not stream ordered
+      if (num_bytes > 0) { cufile_.read(d_values.data(), num_bytes, offset_); }
+      offset_ += num_bytes;
+      return d_values;
+    }
+#endif
+    auto values = next_section<T>();
+    rmm::device_uvector<T> d_values(values.size(), stream_view);
+    raft::update_device(d_values.data(), values.data(), values.size(), stream_view);
+    return d_values;
+  }
+
+ private:
+  // reads the section size and moves to the start of the section data
+  template <typename T>
+  size_t next_section_size()
+  {
+    align();
+    CUGRAPH_EXPECTS(offset_ + sizeof(uint64_t) <= size_, "Invalid snapshot file: truncated.");
+    uint64_t num_bytes{};
+    std::memcpy(&num_bytes, base_ + offset_, sizeof(uint64_t));
+    offset_ += sizeof(uint64_t);
+    align();
+    CUGRAPH_EXPECTS((offset_ + num_bytes <= size_) && (num_bytes % sizeof(T) == 0),
+                    "Invalid snapshot file: invalid section size.");
+    return static_cast<size_t>(num_bytes);
+  }
+
+  void align()
+  {
+    offset_ = ((offset_ + snapshot_section_alignment - 1) / snapshot_section_alignment) *
+              snapshot_section_alignment;
+  }
+
+  int fd_{-1};
+  std::byte const* base_{nullptr};
+  size_t size_{0};
+  size_t offset_{0};
+#ifdef CUGRAPH_ENABLE_CUFILE
+  cufile_handle_t cufile_;
+#endif
+};
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+void write_graph_snapshot(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<edge_property_view_t<edge_t, edge_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<edge_t, edge_type_t const*>> edge_type_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  std::string const& filename)
+{
+  CUGRAPH_EXPECTS(
+    !graph_view.has_edge_mask(),
+    "Invalid input argument: graph_view should not have an edge mask (compact the graph first).");
+  CUGRAPH_EXPECTS(
+    !renumber_map || ((*renumber_map).size() ==
+                      static_cast<size_t>(graph_view.local_vertex_partition_range_size())),
+    "Invalid input argument: renumber_map size does not match with the local vertex partition "
+    "range size.");
+
+  detail::snapshot_header_t header{};
+  std::memcpy(header.magic, detail::snapshot_magic, sizeof(detail::snapshot_magic));
+  header.version         = detail::snapshot_version;
+  header.vertex_size     = sizeof(vertex_t);
+  header.edge_size       = sizeof(edge_t);
+  header.weight_size     = sizeof(weight_t);
+  header.edge_type_size  = sizeof(edge_type_t);
+  header.comm_size       = 1;
+  header.major_comm_size = 1;
+  header.minor_comm_size = 1;
+  header.comm_rank       = 0;
+  if constexpr (multi_gpu) {
+    header.comm_size = handle.get_comms().get_size();
+    header.comm_rank = handle.get_comms().get_rank();
+    header.major_comm_size =
+      handle.get_subcomm(cugraph::partition_manager::major_comm_name()).get_size();
+    header.minor_comm_size =
+      handle.get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size();
+  }
+  header.number_of_vertices = static_cast<int64_t>(graph_view.number_of_vertices());
+  header.number_of_edges    = static_cast<int64_t>(graph_view.compute_number_of_edges(handle));
+  header.number_of_local_edge_partitions = graph_view.number_of_local_edge_partitions();
+
+  auto num_partitions = graph_view.number_of_local_edge_partitions();
+
+  std::vector<vertex_t> segment_offsets{};
+  std::vector<vertex_t> hypersparse_degree_offsets{};
+  bool has_segment_offsets{false};
+  bool has_hypersparse_degree_offsets{false};
+  bool has_dcs_nzd_vertices{false};
+  for (size_t i = 0; i < num_partitions; ++i) {
+    auto offsets = graph_view.local_edge_partition_segment_offsets(i);
+    if (offsets) {
+      has_segment_offsets = true;
+      segment_offsets.insert(segment_offsets.end(), (*offsets).begin(), (*offsets).end());
+    }
+    auto degree_offsets = graph_view.local_edge_partition_hypersparse_degree_offsets(i);
+    if (degree_offsets) {
+      has_hypersparse_degree_offsets = true;
+      hypersparse_degree_offsets.insert(
+        hypersparse_degree_offsets.end(), (*degree_offsets).begin(), (*degree_offsets).end());
+    }
+    if (graph_view.local_edge_partition_view(i).dcs_nzd_vertices()) { has_dcs_nzd_vertices = true; }
+  }
+
+  header.flags =
+    (store_transposed ? detail::snapshot_flag_store_transposed : uint32_t{0}) |
+    (multi_gpu ? detail::snapshot_flag_multi_gpu : uint32_t{0}) |
+    (graph_view.is_symmetric() ? detail::snapshot_flag_symmetric : uint32_t{0}) |
+    (graph_view.is_multigraph() ? detail::snapshot_flag_multigraph : uint32_t{0}) |
+    (has_segment_offsets ? detail::snapshot_flag_segment_offsets : uint32_t{0}) |
+    (has_hypersparse_degree_offsets ? detail::snapshot_flag_hypersparse_degree_offsets
+                                    : uint32_t{0}) |
+    (has_dcs_nzd_vertices ? detail::snapshot_flag_dcs_nzd_vertices : uint32_t{0}) |
+    (edge_weight_view ? detail::snapshot_flag_edge_weights : uint32_t{0}) |
+    (edge_id_view ? detail::snapshot_flag_edge_ids : uint32_t{0}) |
+    (edge_type_view ? detail::snapshot_flag_edge_types : uint32_t{0}) |
+    (renumber_map ? detail::snapshot_flag_renumber_map : uint32_t{0});
+
+  auto path = detail::snapshot_filename(filename, multi_gpu, header.comm_rank);
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  CUGRAPH_EXPECTS(ofs.is_open(), "Failed to open the snapshot file (%s).", path.c_str());
+
+  ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+  // device sections are written with cuFile (after the other sections) if the file can be
+  // registered with cuFile
+#ifdef CUGRAPH_ENABLE_CUFILE
+  detail::cufile_handle_t cufile(path, true);
+  auto deferred_sections =
+    cufile.valid() ? std::make_optional(std::vector<detail::snapshot_deferred_section_t>{})
+                   : std::nullopt;
+#else
+  std::optional<std::vector<detail::snapshot_deferred_section_t>> deferred_sections{std::nullopt};
+#endif
+
+  if constexpr (multi_gpu) {
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    std::vector<vertex_t> vertex_partition_range_offsets(vertex_partition_range_lasts.size() + 1,
+                                                         vertex_t{0});
+    std::copy(vertex_partition_range_lasts.begin(),
+              vertex_partition_range_lasts.end(),
+              vertex_partition_range_offsets.begin() + 1);
+    detail::write_snapshot_host_section(
+      ofs, vertex_partition_range_offsets.data(), vertex_partition_range_offsets.size());
+  }
+  if (has_segment_offsets) {
+    detail::write_snapshot_host_section(ofs, segment_offsets.data(), segment_offsets.size());
+  }
+  if (has_hypersparse_degree_offsets) {
+    detail::write_snapshot_host_section(
+      ofs, hypersparse_degree_offsets.data(), hypersparse_degree_offsets.size());
+  }
+
+  for (size_t i = 0; i < num_partitions; ++i) {
+    auto edge_partition = graph_view.local_edge_partition_view(i);
+    detail::write_snapshot_device_section(handle,
+                                          ofs,
+                                          deferred_sections,
+                                          edge_partition.offsets().data(),
+                                          edge_partition.offsets().size());
+    detail::write_snapshot_device_section(handle,
+                                          ofs,
+                                          deferred_sections,
+                                          edge_partition.indices().data(),
+                                          edge_partition.indices().size());
+    if (has_dcs_nzd_vertices) {
+      auto dcs_nzd_vertices = edge_partition.dcs_nzd_vertices();
+      CUGRAPH_EXPECTS(dcs_nzd_vertices.has_value(),
+                      "Invalid input argument: every local edge partition should have DCS non-zero "
+                      "major vertices if any does.");
+      detail::write_snapshot_device_section(
+        handle, ofs, deferred_sections, (*dcs_nzd_vertices).data(), (*dcs_nzd_vertices).size());
+    }
+    if (edge_weight_view) {
+      detail::write_snapshot_device_section(
+        handle,
+        ofs,
+        deferred_sections,
+        (*edge_weight_view).value_firsts()[i],
+        static_cast<size_t>((*edge_weight_view).edge_counts()[i]));
+    }
+    if (edge_id_view) {
+      detail::write_snapshot_device_section(
+        handle,
+        ofs,
+        deferred_sections,
+        (*edge_id_view).value_firsts()[i],
+        static_cast<size_t>((*edge_id_view).edge_counts()[i]));
+    }
+    if (edge_type_view) {
+      detail::write_snapshot_device_section(
+        handle,
+        ofs,
+        deferred_sections,
+        (*edge_type_view).value_firsts()[i],
+        static_cast<size_t>((*edge_type_view).edge_counts()[i]));
+    }
+  }
+
+  if (renumber_map) {
+    detail::write_snapshot_device_section(
+      handle, ofs, deferred_sections, (*renumber_map).data(), (*renumber_map).size());
+  }
+
+  ofs.flush();
+  CUGRAPH_EXPECTS(ofs.good(), "Failed to write the snapshot file (%s).", path.c_str());
+  ofs.close();
+
+#ifdef CUGRAPH_ENABLE_CUFILE
+  if (deferred_sections) {
+    handle.sync_stream();  // cuFileWrite is not stream ordered
+    for (auto const& section : *deferred_sections) {
+      if (section.num_bytes > 0) {
+        cufile.write(section.values, section.num_bytes, section.file_offset);
+      }
+    }
+  }
+#endif
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+read_graph_snapshot(raft::handle_t const& handle,
+                    std::string const& filename,
+                    bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+
+  int comm_size{1};
+  int comm_rank{0};
+  int major_comm_size{1};
+  int minor_comm_size{1};
+  if constexpr (multi_gpu) {
+    comm_size       = handle.get_comms().get_size();
+    comm_rank       = handle.get_comms().get_rank();
+    major_comm_size = handle.get_subcomm(cugraph::partition_manager::major_comm_name()).get_size();
+    minor_comm_size = handle.get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size();
+  }
+
+  detail::snapshot_reader_t reader(detail::snapshot_filename(filename, multi_gpu, comm_rank));
+  auto header = reader.read_header();
+
+  CUGRAPH_EXPECTS((header.vertex_size == sizeof(vertex_t)) && (header.edge_size == sizeof(edge_t)),
+                  "Invalid template parameters: vertex_t or edge_t does not match with the "
+                  "snapshot file.");
+  CUGRAPH_EXPECTS(
+    ((header.flags & detail::snapshot_flag_store_transposed) != 0) == store_transposed,
+    "Invalid template parameter: store_transposed does not match with the snapshot file.");
+  CUGRAPH_EXPECTS(((header.flags & detail::snapshot_flag_multi_gpu) != 0) == multi_gpu,
+                  "Invalid template parameter: multi_gpu does not match with the snapshot file.");
+  CUGRAPH_EXPECTS(!(header.flags & detail::snapshot_flag_edge_weights) ||
+                    (header.weight_size == sizeof(weight_t)),
+                  "Invalid template parameter: weight_t does not match with the snapshot file.");
+  CUGRAPH_EXPECTS(!(header.flags & detail::snapshot_flag_edge_types) ||
+                    (header.edge_type_size == sizeof(edge_type_t)),
+                  "Invalid template parameter: edge_type_t does not match with the snapshot file.");
+  CUGRAPH_EXPECTS((header.comm_size == comm_size) && (header.comm_rank == comm_rank) &&
+                    (header.major_comm_size == major_comm_size) &&
+                    (header.minor_comm_size == minor_comm_size),
+                  "Invalid input argument: the snapshot file should be read with the same GPU "
+                  "partitioning it was written with.");
+
+  auto num_partitions = static_cast<size_t>(header.number_of_local_edge_partitions);
+  CUGRAPH_EXPECTS(num_partitions == (multi_gpu ? static_cast<size_t>(minor_comm_size) : size_t{1}),
+                  "Invalid snapshot file: invalid number of local edge partitions.");
+
+  std::vector<vertex_t> vertex_partition_range_offsets{};
+  if constexpr (multi_gpu) {
+    auto offsets = reader.template next_section<vertex_t>();
+    CUGRAPH_EXPECTS(offsets.size() == static_cast<size_t>(comm_size + 1),
+                    "Invalid snapshot file: invalid vertex partition range offsets.");
+    vertex_partition_range_offsets.assign(offsets.begin(), offsets.end());
+  }
+  std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
+  if (header.flags & detail::snapshot_flag_segment_offsets) {
+    auto offsets    = reader.template next_section<vertex_t>();
+    segment_offsets = std::vector<vertex_t>(offsets.begin(), offsets.end());
+  }
+  std::optional<std::vector<vertex_t>> hypersparse_degree_offsets{std::nullopt};
+  if (header.flags & detail::snapshot_flag_hypersparse_degree_offsets) {
+    auto offsets               = reader.template next_section<vertex_t>();
+    hypersparse_degree_offsets = std::vector<vertex_t>(offsets.begin(), offsets.end());
+  }
+
+  std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices{};
+  auto edge_partition_dcs_nzd_vertices =
+    (header.flags & detail::snapshot_flag_dcs_nzd_vertices)
+      ? std::make_optional<std::vector<rmm::device_uvector<vertex_t>>>()
+      : std::nullopt;
+  auto edge_partition_weights = (header.flags & detail::snapshot_flag_edge_weights)
+                                  ? std::make_optional<std::vector<rmm::device_uvector<weight_t>>>()
+                                  : std::nullopt;
+  auto edge_partition_ids     = (header.flags & detail::snapshot_flag_edge_ids)
+                                  ? std::make_optional<std::vector<rmm::device_uvector<edge_t>>>()
+                                  : std::nullopt;
+  auto edge_partition_types =
+    (header.flags & detail::snapshot_flag_edge_types)
+      ? std::make_optional<std::vector<rmm::device_uvector<edge_type_t>>>()
+      : std::nullopt;
+  edge_partition_offsets.reserve(num_partitions);
+  edge_partition_indices.reserve(num_partitions);
+  for (size_t i = 0; i < num_partitions; ++i) {
+    edge_partition_offsets.push_back(
+      reader.template next_device_section<edge_t>(handle.get_stream()));
+    edge_partition_indices.push_back(
+      reader.template next_device_section<vertex_t>(handle.get_stream()));
+    if (edge_partition_dcs_nzd_vertices) {
+      (*edge_partition_dcs_nzd_vertices)
+        .push_back(reader.template next_device_section<vertex_t>(handle.get_stream()));
+    }
+    if (edge_partition_weights) {
+      (*edge_partition_weights)
+        .push_back(reader.template next_device_section<weight_t>(handle.get_stream()));
+    }
+    if (edge_partition_ids) {
+      (*edge_partition_ids)
+        .push_back(reader.template next_device_section<edge_t>(handle.get_stream()));
+    }
+    if (edge_partition_types) {
+      (*edge_partition_types)
+        .push_back(reader.template next_device_section<edge_type_t>(handle.get_stream()));
+    }
+  }
+
+  std::optional<rmm::device_uvector<vertex_t>> renumber_map{std::nullopt};
+  if (header.flags & detail::snapshot_flag_renumber_map) {
+    renumber_map = reader.template next_device_section<vertex_t>(handle.get_stream());
+  }
+
+  handle.sync_stream();  // the mapped memory is released when reader goes out of scope
+
+  graph_properties_t properties{(header.flags & detail::snapshot_flag_symmetric) != 0,
+                                (header.flags & detail::snapshot_flag_multigraph) != 0};
+
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu> graph(handle);
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    CUGRAPH_EXPECTS(segment_offsets.has_value(),
+                    "Invalid snapshot file: multi-GPU graphs should have segment offsets.");
+    graph = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(edge_partition_offsets),
+      std::move(edge_partition_indices),
+      std::move(edge_partition_dcs_nzd_vertices),
+      graph_meta_t<vertex_t, edge_t, multi_gpu>{
+        static_cast<vertex_t>(header.number_of_vertices),
+        static_cast<edge_t>(header.number_of_edges),
+        properties,
+        partition_t<vertex_t>(vertex_partition_range_offsets,
+                              major_comm.get_size(),
+                              minor_comm.get_size(),
+                              major_comm.get_rank(),
+                              minor_comm.get_rank()),
+        *segment_offsets,
+        hypersparse_degree_offsets},
+      do_expensive_check);
+  } else {
+    graph = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(edge_partition_offsets[0]),
+      std::move(edge_partition_indices[0]),
+      graph_meta_t<vertex_t, edge_t, multi_gpu>{static_cast<vertex_t>(header.number_of_vertices),
+                                                properties,
+                                                segment_offsets,
+                                                hypersparse_degree_offsets},
+      do_expensive_check);
+  }
+
+  if (renumber_map) {
+    CUGRAPH_EXPECTS(
+      (*renumber_map).size() ==
+        static_cast<size_t>(graph.view().local_vertex_partition_range_size()),
+      "Invalid snapshot file: renumber map size does not match with the local vertex partition "
+      "range size.");
+  }
+
+  return std::make_tuple(
+    std::move(graph),
+    edge_partition_weights ? std::make_optional<edge_property_t<graph_view_type, weight_t>>(
+                               std::move(*edge_partition_weights))
+                           : std::nullopt,
+    edge_partition_ids ? std::make_optional<edge_property_t<graph_view_type, edge_t>>(
+                           std::move(*edge_partition_ids))
+                       : std::nullopt,
+    edge_partition_types ? std::make_optional<edge_property_t<graph_view_type, edge_type_t>>(
+                             std::move(*edge_partition_types))
+                         : std::nullopt,
+    std::move(renumber_map));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/graph_snapshot_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template void write_graph_snapshot<int64_t, int64_t, float, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  std::string const& filename);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, float>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int64_t>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int32_t>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+read_graph_snapshot<int64_t, int64_t, float, int32_t, false, false>(raft::handle_t const& handle,
+                                                                    std::string const& filename,
+                                                                    bool do_expensive_check);
+
+template void write_graph_snapshot<int64_t, int64_t, float, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, float const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  std::string const& filename);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, float>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int64_t>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int32_t>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+read_graph_snapshot<int64_t, int64_t, float, int32_t, true, false>(raft::handle_t const& handle,
+                                                                   std::string const& filename,
+                                                                   bool do_expensive_check);
+
+template void write_graph_snapshot<int64_t, int64_t, double, int32_t, false, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  std::string const& filename);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, double>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int64_t>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, false, false>, int32_t>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+read_graph_snapshot<int64_t, int64_t, double, int32_t, false, false>(raft::handle_t const& handle,
+                                                                     std::string const& filename,
+                                                                     bool do_expensive_check);
+
+template void write_graph_snapshot<int64_t, int64_t, double, int32_t, true, false>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, true, false> const& graph_view,
+  std::optional<edge_property_view_t<int64_t, double const*>> edge_weight_view,
+  std::optional<edge_property_view_t<int64_t, int64_t const*>> edge_id_view,
+  std::optional<edge_property_view_t<int64_t, int32_t const*>> edge_type_view,
+  std::optional<raft::device_span<int64_t const>> renumber_map,
+  std::string const& filename);
+
+template std::tuple<
+  graph_t<int64_t, int64_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, double>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int64_t>>,
+  std::optional<edge_property_t<graph_view_t<int64_t, int64_t, true, false>, int32_t>>,
+  std::optional<rmm::device_uvector<int64_t>>>
+read_graph_snapshot<int64_t, int64_t, double, int32_t, true, false>(raft::handle_t const& handle,
+                                                                    std::string const& filename,
+                                                                    bool do_expensive_check);
+
+}  // namespace cugraph
@@ -56,6 +56,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 
@@ -248,6 +249,26 @@ rmm::device_uvector<edge_t> compute_minor_degrees(
   return minor_degrees;
 }
 
+// the minor degrees (a pass over the edges and a reduction over the GPUs in multi-GPU) of a graph
+// view without an edge mask are computed once per graph_t object
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+rmm::device_uvector<edge_t> compute_minor_degrees_with_cache(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  detail::graph_metadata_cache_t<edge_t>* metadata_cache)
+{
+  if ((metadata_cache == nullptr) || graph_view.has_edge_mask()) {
+    return compute_minor_degrees(handle, graph_view);
+  }
+
+  std::lock_guard<std::mutex> lock(metadata_cache->mutex);
+  if (!(metadata_cache->minor_degrees)) {
+    metadata_cache->minor_degrees = compute_minor_degrees(handle, graph_view);
+    handle.sync_stream();  // the cached values can be read on a different stream
+  }
+  return rmm::device_uvector<edge_t>(*(metadata_cache->minor_degrees), handle.get_stream());
+}
+
 // FIXME: block size requires tuning
 int32_t constexpr count_edge_partition_multi_edges_block_size = 1024;
 
@@ -512,7 +533,8 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<mul
       meta.local_sorted_unique_edge_dst_chunk_start_offsets),
     local_sorted_unique_edge_dst_chunk_size_(meta.local_sorted_unique_edge_dst_chunk_size),
     local_sorted_unique_edge_dst_vertex_partition_offsets_(
-      meta.local_sorted_unique_edge_dst_vertex_partition_offsets)
+      meta.local_sorted_unique_edge_dst_vertex_partition_offsets),
+    metadata_cache_(meta.metadata_cache)
 {
   // cheap error checks
 
@@ -544,7 +566,8 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!mu
     offsets_(offsets),
     indices_(indices),
     segment_offsets_(meta.segment_offsets),
-    hypersparse_degree_offsets_(meta.hypersparse_degree_offsets)
+    hypersparse_degree_offsets_(meta.hypersparse_degree_offsets),
+    metadata_cache_(meta.metadata_cache)
 {
   // cheap error checks
 
@@ -620,7 +643,7 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<mul
                                  this->partition_,
                                  this->edge_partition_segment_offsets_);
   } else {
-    return compute_minor_degrees(handle, *this);
+    return compute_minor_degrees_with_cache(handle, *this, this->metadata_cache_);
   }
 }
 
@@ -639,7 +662,7 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!mu
                                    : std::nullopt,
                                  this->local_vertex_partition_range_size());
   } else {
-    return compute_minor_degrees(handle, *this);
+    return compute_minor_degrees_with_cache(handle, *this, this->metadata_cache_);
   }
 }
 
@@ -649,7 +672,7 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<mul
   compute_out_degrees(raft::handle_t const& handle) const
 {
   if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
+    return compute_minor_degrees_with_cache(handle, *this, this->metadata_cache_);
   } else {
     std::optional<std::vector<raft::device_span<uint32_t const>>> edge_partition_masks{
       std::nullopt};
@@ -678,7 +701,7 @@ graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu, std::enable_if_t<!mu
   compute_out_degrees(raft::handle_t const& handle) const
 {
   if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
+    return compute_minor_degrees_with_cache(handle, *this, this->metadata_cache_);
   } else {
     return compute_major_degrees(handle,
                                  this->offsets_,
@@ -24,6 +24,8 @@
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/reduced_precision_weights.hpp>
 
 #include <raft/core/handle.hpp>
 #include <raft/util/cudart_utils.hpp>
@@ -31,7 +33,10 @@
 #include <rmm/device_scalar.hpp>
 
 #include <thrust/extrema.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
 
 namespace cugraph {
@@ -78,6 +83,32 @@ rmm::device_uvector<weight_t> compute_weight_sums(
   return weight_sums;
 }
 
+template <typename weight_t>
+struct encode_half_edge_weight_t {
+  half_precision_t precision{half_precision_t::float16};
+
+  __device__ uint16_t operator()(weight_t w) const
+  {
+    if (precision == half_precision_t::float16) {
+      return static_cast<__half_raw>(__float2half_rn(static_cast<float>(w))).x;
+    } else {
+      return static_cast<__nv_bfloat16_raw>(__float2bfloat16_rn(static_cast<float>(w))).x;
+    }
+  }
+};
+
+template <typename weight_t>
+struct quantize_edge_weight_t {
+  float scale{1.0};
+  float offset{0.0};
+
+  __device__ uint8_t operator()(weight_t w) const
+  {
+    auto q = scale > 0.0f ? rintf((static_cast<float>(w) - offset) / scale) : 0.0f;
+    return static_cast<uint8_t>(fminf(fmaxf(q, 0.0f), 255.0f));
+  }
+};
+
 }  // namespace
 
 template <typename vertex_t,
@@ -182,4 +213,87 @@ weight_t compute_total_edge_weight(
     weight_t{0});
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint16_t>
+encode_half_edge_weights(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  half_precision_t precision)
+{
+  edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint16_t>
+    encoded_weights(handle, graph_view);
+  auto encoded_view = encoded_weights.mutable_view();
+  for (size_t i = 0; i < edge_weight_view.value_firsts().size(); ++i) {
+    thrust::transform(handle.get_thrust_policy(),
+                      edge_weight_view.value_firsts()[i],
+                      edge_weight_view.value_firsts()[i] + edge_weight_view.edge_counts()[i],
+                      encoded_view.value_firsts()[i],
+                      encode_half_edge_weight_t<weight_t>{precision});
+  }
+
+  return encoded_weights;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint8_t>,
+           uint8_edge_weight_decoder_t>
+quantize_edge_weights(raft::handle_t const& handle,
+                      graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+                      edge_property_view_t<edge_t, weight_t const*> edge_weight_view)
+{
+  // 1. find the range of the edge weights
+
+  auto min_w = std::numeric_limits<weight_t>::max();
+  auto max_w = std::numeric_limits<weight_t>::lowest();
+  for (size_t i = 0; i < edge_weight_view.value_firsts().size(); ++i) {
+    if (edge_weight_view.edge_counts()[i] == 0) { continue; }
+    auto [min_it, max_it] =
+      thrust::minmax_element(handle.get_thrust_policy(),
+                             edge_weight_view.value_firsts()[i],
+                             edge_weight_view.value_firsts()[i] + edge_weight_view.edge_counts()[i]);
+    weight_t tmp_min{}, tmp_max{};
+    raft::update_host(&tmp_min, min_it, 1, handle.get_stream());
+    raft::update_host(&tmp_max, max_it, 1, handle.get_stream());
+    handle.sync_stream();
+    min_w = std::min(min_w, tmp_min);
+    max_w = std::max(max_w, tmp_max);
+  }
+  if constexpr (multi_gpu) {
+    min_w =
+      host_scalar_allreduce(handle.get_comms(), min_w, raft::comms::op_t::MIN, handle.get_stream());
+    max_w =
+      host_scalar_allreduce(handle.get_comms(), max_w, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  uint8_edge_weight_decoder_t decoder{};
+  if (min_w <= max_w) {
+    decoder.offset = static_cast<float>(min_w);
+    decoder.scale  = static_cast<float>(max_w - min_w) / 255.0f;
+  }
+
+  // 2. quantize
+
+  edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, uint8_t>
+    quantized_weights(handle, graph_view);
+  auto quantized_view = quantized_weights.mutable_view();
+  for (size_t i = 0; i < edge_weight_view.value_firsts().size(); ++i) {
+    thrust::transform(handle.get_thrust_policy(),
+                      edge_weight_view.value_firsts()[i],
+                      edge_weight_view.value_firsts()[i] + edge_weight_view.edge_counts()[i],
+                      quantized_view.value_firsts()[i],
+                      quantize_edge_weight_t<weight_t>{decoder.scale, decoder.offset});
+  }
+
+  return std::make_tuple(std::move(quantized_weights), decoder);
+}
+
 }  // namespace cugraph
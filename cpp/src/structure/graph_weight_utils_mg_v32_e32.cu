@@ -121,4 +121,64 @@ template double compute_total_edge_weight<int32_t, int32_t, double, true, true>(
   graph_view_t<int32_t, int32_t, true, true> const& graph_view,
   edge_property_view_t<int32_t, double const*> edge_weight_view);
 
+// encode_half_edge_weights
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, true>, uint16_t>
+encode_half_edge_weights<int32_t, int32_t, float, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  half_precision_t precision);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, true>, uint16_t>
+encode_half_edge_weights<int32_t, int32_t, float, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  half_precision_t precision);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, true>, uint16_t>
+encode_half_edge_weights<int32_t, int32_t, double, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  half_precision_t precision);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, true>, uint16_t>
+encode_half_edge_weights<int32_t, int32_t, double, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  half_precision_t precision);
+
+// quantize_edge_weights
+
+template std::tuple<edge_property_t<graph_view_t<int32_t, int32_t, false, true>, uint8_t>,
+                    uint8_edge_weight_decoder_t>
+quantize_edge_weights<int32_t, int32_t, float, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view);
+
+template std::tuple<edge_property_t<graph_view_t<int32_t, int32_t, true, true>, uint8_t>,
+                    uint8_edge_weight_decoder_t>
+quantize_edge_weights<int32_t, int32_t, float, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view);
+
+template std::tuple<edge_property_t<graph_view_t<int32_t, int32_t, false, true>, uint8_t>,
+                    uint8_edge_weight_decoder_t>
+quantize_edge_weights<int32_t, int32_t, double, false, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view);
+
+template std::tuple<edge_property_t<graph_view_t<int32_t, int32_t, true, true>, uint8_t>,
+                    uint8_edge_weight_decoder_t>
+quantize_edge_weights<int32_t, int32_t, double, true, true>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view);
+
 }  // namespace cugraph
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "prims/extract_transform_v_frontier_outgoing_e.cuh"
+#include "prims/key_store.cuh"
 #include "prims/vertex_frontier.cuh"
 #include "structure/detail/structure_utils.cuh"
 #include "utilities/collect_comm.cuh"
@@ -28,18 +29,21 @@
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/misc_utils.cuh>
+#include <cugraph/utilities/packed_bool_utils.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
 
+#include <cuda/atomic>
 #include <cuda/std/optional>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -50,19 +54,65 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <limits>
 #include <tuple>
 
 namespace cugraph {
 
 namespace detail {
 
-template <typename vertex_t, typename weight_t, typename property_t>
-struct induced_subgraph_weighted_edge_op {
-  using return_type = cuda::std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, size_t>>;
+// Membership tests for (subgraph, destination vertex) pairs. Binary search in the sorted
+// per-subgraph vertex lists needs no extra memory, a hash set of (subgraph, vertex) keys avoids the
+// logarithmic search cost for large subgraphs, and a bitmap over (subgraph, destination vertex
+// range) is the fastest when the subgraphs cover a large fraction of the destination range.
 
+template <typename vertex_t>
+struct binary_search_subgraph_membership_t {
   raft::device_span<size_t const> dst_subgraph_offsets;
   raft::device_span<vertex_t const> dst_subgraph_vertices;
 
+  __device__ bool operator()(size_t subgraph, vertex_t dst) const
+  {
+    return thrust::binary_search(thrust::seq,
+                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph],
+                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph + 1],
+                                 dst);
+  }
+};
+
+template <typename vertex_t, typename KeySetDeviceView>
+struct hash_subgraph_membership_t {
+  KeySetDeviceView key_set;
+  vertex_t minor_range_first;
+  vertex_t minor_range_size;
+
+  __device__ bool operator()(size_t subgraph, vertex_t dst) const
+  {
+    return key_set.contains(subgraph * static_cast<size_t>(minor_range_size) +
+                            static_cast<size_t>(dst - minor_range_first));
+  }
+};
+
+template <typename vertex_t>
+struct bitmap_subgraph_membership_t {
+  raft::device_span<uint32_t const> bitmap;
+  vertex_t minor_range_first;
+  vertex_t minor_range_size;
+
+  __device__ bool operator()(size_t subgraph, vertex_t dst) const
+  {
+    auto offset = subgraph * static_cast<size_t>(minor_range_size) +
+                  static_cast<size_t>(dst - minor_range_first);
+    return (bitmap[packed_bool_offset(offset)] & packed_bool_mask(offset)) != 0;
+  }
+};
+
+template <typename vertex_t, typename weight_t, typename property_t, typename MembershipOp>
+struct induced_subgraph_weighted_edge_op {
+  using return_type = cuda::std::optional<thrust::tuple<vertex_t, vertex_t, weight_t, size_t>>;
+
+  MembershipOp is_member;
+
   return_type __device__ operator()(thrust::tuple<vertex_t, size_t> tagged_src,
                                     vertex_t dst,
                                     property_t sv,
@@ -70,22 +120,18 @@ struct induced_subgraph_weighted_edge_op {
                                     weight_t wgt) const
   {
     size_t subgraph = thrust::get<1>(tagged_src);
-    return thrust::binary_search(thrust::seq,
-                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph],
-                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph + 1],
-                                 dst)
+    return is_member(subgraph, dst)
              ? cuda::std::make_optional(
                  thrust::make_tuple(thrust::get<0>(tagged_src), dst, wgt, subgraph))
              : cuda::std::nullopt;
   }
 };
 
-template <typename vertex_t, typename property_t>
+template <typename vertex_t, typename property_t, typename MembershipOp>
 struct induced_subgraph_unweighted_edge_op {
   using return_type = cuda::std::optional<thrust::tuple<vertex_t, vertex_t, size_t>>;
 
-  raft::device_span<size_t const> dst_subgraph_offsets;
-  raft::device_span<vertex_t const> dst_subgraph_vertices;
+  MembershipOp is_member;
 
   return_type __device__ operator()(thrust::tuple<vertex_t, size_t> tagged_src,
                                     vertex_t dst,
@@ -94,16 +140,36 @@ struct induced_subgraph_unweighted_edge_op {
                                     cuda::std::nullopt_t) const
   {
     size_t subgraph = thrust::get<1>(tagged_src);
-    return thrust::binary_search(thrust::seq,
-                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph],
-                                 dst_subgraph_vertices.data() + dst_subgraph_offsets[subgraph + 1],
-                                 dst)
+    return is_member(subgraph, dst)
              ? cuda::std::make_optional(
                  thrust::make_tuple(thrust::get<0>(tagged_src), dst, subgraph))
              : cuda::std::nullopt;
   }
 };
 
+// use a bitmap if it is no larger than twice the subgraph vertex lists, a hash set if the
+// average subgraph is large enough to make binary search expensive, and binary search otherwise
+enum class subgraph_membership_t { binary_search, hash, bitmap };
+
+constexpr size_t bitmap_membership_size_ratio      = 2;
+constexpr size_t hash_membership_min_subgraph_size = 1024;
+
+template <typename vertex_t>
+subgraph_membership_t select_subgraph_membership(size_t num_subgraphs,
+                                                 size_t num_subgraph_vertices,
+                                                 vertex_t minor_range_size)
+{
+  auto bitmap_bits = num_subgraphs * static_cast<size_t>(minor_range_size);
+  auto list_bits   = num_subgraph_vertices * sizeof(vertex_t) * size_t{8};
+  if (bitmap_bits <= list_bits * bitmap_membership_size_ratio) {
+    return subgraph_membership_t::bitmap;
+  } else if (num_subgraph_vertices >= num_subgraphs * hash_membership_min_subgraph_size) {
+    return subgraph_membership_t::hash;
+  } else {
+    return subgraph_membership_t::binary_search;
+  }
+}
+
 }  // namespace detail
 
 template <typename vertex_t,
@@ -205,8 +271,8 @@ extract_induced_subgraphs(
                                                             dst_subgraph_vertices_v.size());
 
   // 3. Call extract_transform_v_frontier_outgoing_e with a functor that returns cuda::std::nullopt
-  // if the destination vertex has a property of 0, return the edge if the destination vertex has a
-  // property of 1
+  // if the destination vertex is not in the subgraph of the tagged source vertex and returns the
+  // edge otherwise
   vertex_frontier_t<vertex_t, size_t, multi_gpu, false> vertex_frontier(handle, 1);
 
   graph_ids_v = detail::expand_sparse_offsets(subgraph_offsets, size_t{0}, handle.get_stream());
@@ -223,21 +289,122 @@ extract_induced_subgraphs(
   std::optional<rmm::device_uvector<weight_t>> edge_weights{std::nullopt};
   rmm::device_uvector<size_t> subgraph_edge_graph_ids(0, handle.get_stream());
 
-  if (edge_weight_view) {
-    edge_weights = std::make_optional(rmm::device_uvector<weight_t>(0, handle.get_stream()));
-
-    std::tie(edge_majors, edge_minors, *edge_weights, subgraph_edge_graph_ids) =
-      extract_transform_v_frontier_outgoing_e(
-        handle,
-        graph_view,
-        vertex_frontier.bucket(0),
-        edge_src_dummy_property_t{}.view(),
-        edge_dst_dummy_property_t{}.view(),
-        *edge_weight_view,
-        detail::induced_subgraph_weighted_edge_op<vertex_t, weight_t, cuda::std::nullopt_t>{
-          dst_subgraph_offsets, dst_subgraph_vertices},
-        do_expensive_check);
+  auto extract_subgraph_edges = [&](auto is_member) {
+    using membership_op_t = decltype(is_member);
+    if (edge_weight_view) {
+      edge_weights = std::make_optional(rmm::device_uvector<weight_t>(0, handle.get_stream()));
+
+      std::tie(edge_majors, edge_minors, *edge_weights, subgraph_edge_graph_ids) =
+        extract_transform_v_frontier_outgoing_e(
+          handle,
+          graph_view,
+          vertex_frontier.bucket(0),
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
+          *edge_weight_view,
+          detail::induced_subgraph_weighted_edge_op<vertex_t,
+                                                    weight_t,
+                                                    cuda::std::nullopt_t,
+                                                    membership_op_t>{is_member},
+          do_expensive_check);
+    } else {
+      std::tie(edge_majors, edge_minors, subgraph_edge_graph_ids) =
+        extract_transform_v_frontier_outgoing_e(
+          handle,
+          graph_view,
+          vertex_frontier.bucket(0),
+          edge_src_dummy_property_t{}.view(),
+          edge_dst_dummy_property_t{}.view(),
+          edge_dummy_property_t{}.view(),
+          detail::induced_subgraph_unweighted_edge_op<vertex_t,
+                                                      cuda::std::nullopt_t,
+                                                      membership_op_t>{is_member},
+          do_expensive_check);
+    }
+  };
+
+  auto num_subgraphs     = subgraph_offsets.size() - 1;
+  auto minor_range_first = graph_view.local_edge_partition_dst_range_first();
+  auto minor_range_size  = graph_view.local_edge_partition_dst_range_size();
+  auto membership        = detail::select_subgraph_membership(
+    num_subgraphs, dst_subgraph_vertices.size(), minor_range_size);
+
+  if (membership == detail::subgraph_membership_t::bitmap) {
+    rmm::device_uvector<uint32_t> bitmap(
+      packed_bool_size(num_subgraphs * static_cast<size_t>(minor_range_size)),
+      handle.get_stream());
+    thrust::fill(
+      handle.get_thrust_policy(), bitmap.begin(), bitmap.end(), packed_bool_empty_mask());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(dst_subgraph_vertices.size()),
+      [bitmap = raft::device_span<uint32_t>(bitmap.data(), bitmap.size()),
+       dst_subgraph_offsets,
+       dst_subgraph_vertices,
+       minor_range_first,
+       minor_range_size] __device__(size_t i) {
+        auto subgraph = static_cast<size_t>(
+          thrust::distance(dst_subgraph_offsets.begin() + 1,
+                           thrust::upper_bound(thrust::seq,
+                                               dst_subgraph_offsets.begin() + 1,
+                                               dst_subgraph_offsets.end(),
+                                               i)));
+        auto offset = subgraph * static_cast<size_t>(minor_range_size) +
+                      static_cast<size_t>(dst_subgraph_vertices[i] - minor_range_first);
+        cuda::atomic_ref<uint32_t, cuda::thread_scope_device> word(
+          bitmap[packed_bool_offset(offset)]);
+        word.fetch_or(packed_bool_mask(offset), cuda::std::memory_order_relaxed);
+      });
+    dst_subgraph_vertices_v.resize(0, handle.get_stream());
+    dst_subgraph_vertices_v.shrink_to_fit(handle.get_stream());
+    dst_subgraph_offsets_v.resize(0, handle.get_stream());
+    dst_subgraph_offsets_v.shrink_to_fit(handle.get_stream());
+
+    extract_subgraph_edges(detail::bitmap_subgraph_membership_t<vertex_t>{
+      raft::device_span<uint32_t const>(bitmap.data(), bitmap.size()),
+      minor_range_first,
+      minor_range_size});
+  } else if (membership == detail::subgraph_membership_t::hash) {
+    rmm::device_uvector<size_t> keys(dst_subgraph_vertices.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(dst_subgraph_vertices.size()),
+      keys.begin(),
+      [dst_subgraph_offsets,
+       dst_subgraph_vertices,
+       minor_range_first,
+       minor_range_size] __device__(size_t i) {
+        auto subgraph = static_cast<size_t>(
+          thrust::distance(dst_subgraph_offsets.begin() + 1,
+                           thrust::upper_bound(thrust::seq,
+                                               dst_subgraph_offsets.begin() + 1,
+                                               dst_subgraph_offsets.end(),
+                                               i)));
+        return subgraph * static_cast<size_t>(minor_range_size) +
+               static_cast<size_t>(dst_subgraph_vertices[i] - minor_range_first);
+      });
+    dst_subgraph_vertices_v.resize(0, handle.get_stream());
+    dst_subgraph_vertices_v.shrink_to_fit(handle.get_stream());
+    dst_subgraph_offsets_v.resize(0, handle.get_stream());
+    dst_subgraph_offsets_v.shrink_to_fit(handle.get_stream());
+
+    key_store_t<size_t, false> key_set(
+      keys.begin(), keys.end(), std::numeric_limits<size_t>::max(), handle.get_stream());
+    keys.resize(0, handle.get_stream());
+    keys.shrink_to_fit(handle.get_stream());
+
+    auto key_set_view = detail::key_cuco_store_contains_device_view_t(key_set.view());
+    extract_subgraph_edges(
+      detail::hash_subgraph_membership_t<vertex_t, decltype(key_set_view)>{
+        key_set_view, minor_range_first, minor_range_size});
+  } else {
+    extract_subgraph_edges(detail::binary_search_subgraph_membership_t<vertex_t>{
+      dst_subgraph_offsets, dst_subgraph_vertices});
+  }
 
+  if (edge_weights) {
     thrust::sort_by_key(
       handle.get_thrust_policy(),
       thrust::make_zip_iterator(
@@ -246,18 +413,6 @@ extract_induced_subgraphs(
         subgraph_edge_graph_ids.end(), edge_majors.end(), edge_minors.end()),
       edge_weights->begin());
   } else {
-    std::tie(edge_majors, edge_minors, subgraph_edge_graph_ids) =
-      extract_transform_v_frontier_outgoing_e(
-        handle,
-        graph_view,
-        vertex_frontier.bucket(0),
-        edge_src_dummy_property_t{}.view(),
-        edge_dst_dummy_property_t{}.view(),
-        edge_dummy_property_t{}.view(),
-        detail::induced_subgraph_unweighted_edge_op<vertex_t, cuda::std::nullopt_t>{
-          dst_subgraph_offsets, dst_subgraph_vertices},
-        do_expensive_check);
-
     thrust::sort(handle.get_thrust_policy(),
                  thrust::make_zip_iterator(
                    subgraph_edge_graph_ids.begin(), edge_majors.begin(), edge_minors.begin()),
@@ -0,0 +1,847 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/edge_bucket.cuh"
+#include "prims/fill_edge_property.cuh"
+#include "prims/transform_e.cuh"
+#include "structure/detail/structure_utils.cuh"
+
+#include <cugraph/detail/decompress_edge_partition.cuh>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/edge_partition_edge_property_device_view.cuh>
+#include <cugraph/mutable_graph.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/mask_utils.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <cuda/std/optional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct clear_edge_mask_e_op_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, cuda::std::nullopt_t, cuda::std::nullopt_t) const
+  {
+    return false;
+  }
+};
+
+// true if the (src, dst[, weight]) tuple matches one of the sorted (major, minor) pairs
+template <typename vertex_t, bool store_transposed>
+struct is_deleted_edge_t {
+  raft::device_span<vertex_t const> sorted_majors{};
+  raft::device_span<vertex_t const> sorted_minors{};
+
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e) const
+  {
+    auto major      = store_transposed ? thrust::get<1>(e) : thrust::get<0>(e);
+    auto minor      = store_transposed ? thrust::get<0>(e) : thrust::get<1>(e);
+    auto pair_first = thrust::make_zip_iterator(sorted_majors.begin(), sorted_minors.begin());
+    return thrust::binary_search(
+      thrust::seq, pair_first, pair_first + sorted_majors.size(), thrust::make_tuple(major, minor));
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>>
+shuffle_edges_to_local_gpu(raft::handle_t const& handle,
+                           rmm::device_uvector<vertex_t>&& edge_srcs,
+                           rmm::device_uvector<vertex_t>&& edge_dsts,
+                           std::optional<rmm::device_uvector<weight_t>>&& edge_weights,
+                           std::vector<vertex_t> const& vertex_partition_range_lasts)
+{
+  rmm::device_uvector<vertex_t> majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(0, handle.get_stream());
+  std::tie(majors,
+           minors,
+           edge_weights,
+           std::ignore,
+           std::ignore,
+           std::ignore,
+           std::ignore,
+           std::ignore) =
+    detail::shuffle_int_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                   edge_t,
+                                                                                   weight_t,
+                                                                                   int32_t,
+                                                                                   int32_t>(
+      handle,
+      std::move(store_transposed ? edge_dsts : edge_srcs),
+      std::move(store_transposed ? edge_srcs : edge_dsts),
+      std::move(edge_weights),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      vertex_partition_range_lasts);
+
+  return std::make_tuple(std::move(store_transposed ? minors : majors),
+                         std::move(store_transposed ? majors : minors),
+                         std::move(edge_weights));
+}
+
+template <typename GraphViewType>
+typename GraphViewType::edge_type count_local_masked_edges(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view /* without edge mask */,
+  edge_property_view_t<typename GraphViewType::edge_type, uint32_t const*, bool> edge_mask_view)
+{
+  using edge_t = typename GraphViewType::edge_type;
+
+  edge_t ret{0};
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto num_edges = graph_view.local_edge_partition_view(i).number_of_edges();
+    ret += num_edges - static_cast<edge_t>(detail::count_set_bits(
+                         handle, edge_mask_view.value_firsts()[i], num_edges));
+  }
+  return ret;
+}
+
+// degrees of the majors in [major_range_first, major_range_last) in a compressed edge partition
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<edge_t> compute_edge_partition_major_degrees(
+  raft::handle_t const& handle,
+  raft::device_span<edge_t const> offsets,
+  std::optional<raft::device_span<vertex_t const>> dcs_nzd_vertices,
+  vertex_t major_range_first,
+  std::optional<vertex_t> major_hypersparse_first,
+  vertex_t major_range_last)
+{
+  rmm::device_uvector<edge_t> degrees(major_range_last - major_range_first, handle.get_stream());
+  auto num_sparse_majors =
+    static_cast<size_t>(major_hypersparse_first ? (*major_hypersparse_first - major_range_first)
+                                                : (major_range_last - major_range_first));
+  thrust::transform(handle.get_thrust_policy(),
+                    offsets.begin() + 1,
+                    offsets.begin() + 1 + num_sparse_majors,
+                    offsets.begin(),
+                    degrees.begin(),
+                    thrust::minus<edge_t>{});
+  if (dcs_nzd_vertices) {
+    thrust::fill(
+      handle.get_thrust_policy(), degrees.begin() + num_sparse_majors, degrees.end(), edge_t{0});
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator((*dcs_nzd_vertices).size()),
+      [offsets,
+       dcs_nzd_vertices = *dcs_nzd_vertices,
+       degrees          = raft::device_span<edge_t>(degrees.data(), degrees.size()),
+       major_range_first,
+       num_sparse_majors] __device__(size_t i) {
+        degrees[dcs_nzd_vertices[i] - major_range_first] =
+          offsets[num_sparse_majors + i + 1] - offsets[num_sparse_majors + i];
+      });
+  }
+  return degrees;
+}
+
+// Vertices are inserted to the degree based segments at renumbering. Inserting edges can turn a
+// zero-degree vertex to a non-zero-degree vertex (and the primitives skip the zero-degree
+// segment), and in the hypersparse segment, the primitives assume that the vertices in the last
+// range of hypersparse_degree_offsets have degree 1. Recompute the first vertex of the
+// zero-degree segment and the degree 1 range from the current (global) major degrees; the other
+// segment boundaries are kept (a vertex in a wrong high/mid/low segment affects performance
+// only).
+template <typename vertex_t, typename edge_t>
+std::tuple<std::vector<vertex_t>, std::optional<std::vector<vertex_t>>> update_segment_offsets(
+  raft::handle_t const& handle,
+  raft::device_span<edge_t const> major_degrees,
+  std::vector<vertex_t> const& segment_offsets,
+  std::optional<std::vector<vertex_t>> const& hypersparse_degree_offsets)
+{
+  auto zero_segment_idx = segment_offsets.size() - 2;
+  auto last_nonzero_segment_first = segment_offsets[zero_segment_idx - 1];
+
+  auto nonzero_degree_last = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(static_cast<vertex_t>(major_degrees.size())),
+    cuda::proclaim_return_type<vertex_t>([major_degrees] __device__(vertex_t i) {
+      return major_degrees[i] > edge_t{0} ? (i + 1) : vertex_t{0};
+    }),
+    vertex_t{0},
+    thrust::maximum<vertex_t>{});
+  auto zero_segment_first = std::max(nonzero_degree_last, last_nonzero_segment_first);
+
+  auto new_segment_offsets              = segment_offsets;
+  new_segment_offsets[zero_segment_idx] = zero_segment_first;
+
+  auto new_hypersparse_degree_offsets = hypersparse_degree_offsets;
+  if (new_hypersparse_degree_offsets) {
+    auto degree_one_first = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(last_nonzero_segment_first),
+      thrust::make_counting_iterator(zero_segment_first),
+      cuda::proclaim_return_type<vertex_t>(
+        [major_degrees, last_nonzero_segment_first] __device__(vertex_t i) {
+          return major_degrees[i] != edge_t{1} ? (i + 1) : last_nonzero_segment_first;
+        }),
+      last_nonzero_segment_first,
+      thrust::maximum<vertex_t>{});
+    auto& offsets = *new_hypersparse_degree_offsets;
+    for (size_t i = 0; i < offsets.size() - 2; ++i) {
+      offsets[i] = std::min(offsets[i], degree_one_first - last_nonzero_segment_first);
+    }
+    offsets[offsets.size() - 2] = degree_one_first - last_nonzero_segment_first;
+    offsets.back()              = zero_segment_first;  // follows the renumbering output
+  }
+
+  return std::make_tuple(std::move(new_segment_offsets), std::move(new_hypersparse_degree_offsets));
+}
+
+// concatenate the offset vectors of the GPUs in minor_comm (in the rank order), the edge partition
+// i's majors are in the vertex partition of the minor_comm rank i GPU
+template <typename vertex_t>
+std::vector<vertex_t> allgather_minor_comm_offset_vectors(raft::handle_t const& handle,
+                                                          std::vector<vertex_t> const& offsets)
+{
+  auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+
+  rmm::device_uvector<vertex_t> d_offsets(offsets.size(), handle.get_stream());
+  raft::update_device(d_offsets.data(), offsets.data(), offsets.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_aggregate_offset_vectors(minor_comm.get_size() * d_offsets.size(),
+                                                           handle.get_stream());
+  minor_comm.allgather(
+    d_offsets.data(), d_aggregate_offset_vectors.data(), d_offsets.size(), handle.get_stream());
+
+  std::vector<vertex_t> h_aggregate_offset_vectors(d_aggregate_offset_vectors.size());
+  raft::update_host(h_aggregate_offset_vectors.data(),
+                    d_aggregate_offset_vectors.data(),
+                    d_aggregate_offset_vectors.size(),
+                    handle.get_stream());
+  handle.sync_stream();
+
+  return h_aggregate_offset_vectors;
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::mutable_graph_t(
+  raft::handle_t const& handle,
+  graph_type&& graph,
+  std::optional<edge_property_t<graph_view_type, weight_t>>&& edge_weights,
+  double compaction_threshold)
+  : graph_(std::move(graph)),
+    edge_weights_(std::move(edge_weights)),
+    delta_srcs_(0, handle.get_stream()),
+    delta_dsts_(0, handle.get_stream()),
+    delta_weights_(edge_weights_ ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                     0, handle.get_stream())
+                                 : std::nullopt),
+    compaction_threshold_(compaction_threshold)
+{
+  CUGRAPH_EXPECTS(compaction_threshold >= 0.0,
+                  "Invalid input argument: compaction_threshold should be non-negative.");
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::insert_edges(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> edge_srcs,
+  raft::device_span<vertex_t const> edge_dsts,
+  std::optional<raft::device_span<weight_t const>> edge_weights,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(edge_srcs.size() == edge_dsts.size(),
+                  "Invalid input arguments: edge_srcs.size() != edge_dsts.size().");
+  CUGRAPH_EXPECTS(edge_weights.has_value() == edge_weights_.has_value(),
+                  "Invalid input arguments: edge_weights should be valid if and only if the graph "
+                  "is weighted.");
+  CUGRAPH_EXPECTS(!edge_weights || ((*edge_weights).size() == edge_srcs.size()),
+                  "Invalid input arguments: edge_weights.size() != edge_srcs.size().");
+
+  auto graph_view = graph_.view();
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_srcs.begin(),
+                       edge_srcs.end(),
+                       detail::check_out_of_range_t<vertex_t>{
+                         vertex_t{0}, graph_view.number_of_vertices()}) +
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_dsts.begin(),
+                       edge_dsts.end(),
+                       detail::check_out_of_range_t<vertex_t>{
+                         vertex_t{0}, graph_view.number_of_vertices()});
+    if constexpr (multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input arguments: edge_srcs and edge_dsts should be valid (internal) "
+                    "vertex IDs.");
+  }
+
+  rmm::device_uvector<vertex_t> srcs(edge_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(edge_dsts.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), edge_srcs.begin(), edge_srcs.end(), srcs.begin());
+  thrust::copy(handle.get_thrust_policy(), edge_dsts.begin(), edge_dsts.end(), dsts.begin());
+  auto weights = edge_weights ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                  (*edge_weights).size(), handle.get_stream())
+                              : std::nullopt;
+  if (weights) {
+    thrust::copy(handle.get_thrust_policy(),
+                 (*edge_weights).begin(),
+                 (*edge_weights).end(),
+                 (*weights).begin());
+  }
+
+  if constexpr (multi_gpu) {
+    std::tie(srcs, dsts, weights) =
+      shuffle_edges_to_local_gpu<vertex_t, edge_t, weight_t, store_transposed>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::move(weights),
+        graph_view.vertex_partition_range_lasts());
+  }
+
+  auto old_size = delta_srcs_.size();
+  delta_srcs_.resize(old_size + srcs.size(), handle.get_stream());
+  delta_dsts_.resize(delta_srcs_.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), srcs.begin(), srcs.end(), delta_srcs_.begin() + old_size);
+  thrust::copy(
+    handle.get_thrust_policy(), dsts.begin(), dsts.end(), delta_dsts_.begin() + old_size);
+  if (weights) {
+    (*delta_weights_).resize(delta_srcs_.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 (*weights).begin(),
+                 (*weights).end(),
+                 (*delta_weights_).begin() + old_size);
+  }
+
+  // bound the delta buffer size
+
+  auto num_pending = delta_srcs_.size();
+  if constexpr (multi_gpu) {
+    num_pending = host_scalar_allreduce(
+      handle.get_comms(), num_pending, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (static_cast<double>(num_pending) >
+      compaction_threshold_ * static_cast<double>(graph_.number_of_edges())) {
+    merge(handle);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::delete_edges(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> edge_srcs,
+  raft::device_span<vertex_t const> edge_dsts,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(edge_srcs.size() == edge_dsts.size(),
+                  "Invalid input arguments: edge_srcs.size() != edge_dsts.size().");
+
+  auto graph_view = graph_.view();
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_srcs.begin(),
+                       edge_srcs.end(),
+                       detail::check_out_of_range_t<vertex_t>{
+                         vertex_t{0}, graph_view.number_of_vertices()}) +
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_dsts.begin(),
+                       edge_dsts.end(),
+                       detail::check_out_of_range_t<vertex_t>{
+                         vertex_t{0}, graph_view.number_of_vertices()});
+    if constexpr (multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input arguments: edge_srcs and edge_dsts should be valid (internal) "
+                    "vertex IDs.");
+  }
+
+  rmm::device_uvector<vertex_t> srcs(edge_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(edge_dsts.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), edge_srcs.begin(), edge_srcs.end(), srcs.begin());
+  thrust::copy(handle.get_thrust_policy(), edge_dsts.begin(), edge_dsts.end(), dsts.begin());
+
+  if constexpr (multi_gpu) {
+    std::tie(srcs, dsts, std::ignore) =
+      shuffle_edges_to_local_gpu<vertex_t, edge_t, weight_t, store_transposed>(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::optional<rmm::device_uvector<weight_t>>{std::nullopt},
+        graph_view.vertex_partition_range_lasts());
+  }
+
+  auto& majors    = store_transposed ? dsts : srcs;
+  auto& minors    = store_transposed ? srcs : dsts;
+  auto pair_first = thrust::make_zip_iterator(majors.begin(), minors.begin());
+  thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + majors.size());
+  majors.resize(thrust::distance(pair_first,
+                                 thrust::unique(handle.get_thrust_policy(),
+                                                pair_first,
+                                                pair_first + majors.size())),
+                handle.get_stream());
+  minors.resize(majors.size(), handle.get_stream());
+
+  // 1. drop the matching pending insertions
+
+  if (delta_srcs_.size() > 0) {
+    is_deleted_edge_t<vertex_t, store_transposed> pred{
+      raft::device_span<vertex_t const>(majors.data(), majors.size()),
+      raft::device_span<vertex_t const>(minors.data(), minors.size())};
+    size_t new_size{};
+    if (delta_weights_) {
+      auto delta_first = thrust::make_zip_iterator(
+        delta_srcs_.begin(), delta_dsts_.begin(), (*delta_weights_).begin());
+      new_size = thrust::distance(
+        delta_first,
+        thrust::remove_if(
+          handle.get_thrust_policy(), delta_first, delta_first + delta_srcs_.size(), pred));
+      (*delta_weights_).resize(new_size, handle.get_stream());
+    } else {
+      auto delta_first = thrust::make_zip_iterator(delta_srcs_.begin(), delta_dsts_.begin());
+      new_size         = thrust::distance(
+        delta_first,
+        thrust::remove_if(
+          handle.get_thrust_policy(), delta_first, delta_first + delta_srcs_.size(), pred));
+    }
+    delta_srcs_.resize(new_size, handle.get_stream());
+    delta_dsts_.resize(new_size, handle.get_stream());
+  }
+
+  // 2. mask out the matching edges in the compressed graph
+
+  if (edge_mask_) { graph_view.attach_edge_mask((*edge_mask_).view()); }
+  auto exists = graph_view.has_edge(handle,
+                                    raft::device_span<vertex_t const>(srcs.data(), srcs.size()),
+                                    raft::device_span<vertex_t const>(dsts.data(), dsts.size()));
+  {
+    auto edge_first = thrust::make_zip_iterator(srcs.begin(), dsts.begin());
+    srcs.resize(thrust::distance(edge_first,
+                                 thrust::remove_if(handle.get_thrust_policy(),
+                                                   edge_first,
+                                                   edge_first + srcs.size(),
+                                                   exists.begin(),
+                                                   detail::is_equal_t<bool>{false})),
+                handle.get_stream());
+    dsts.resize(srcs.size(), handle.get_stream());
+  }
+
+  size_t num_local_deletions = srcs.size();
+  if constexpr (multi_gpu) {
+    num_local_deletions = host_scalar_allreduce(
+      handle.get_comms(), num_local_deletions, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (num_local_deletions == 0) { return; }
+
+  if (!edge_mask_) {
+    graph_view.clear_edge_mask();
+    edge_mask_ = edge_property_t<graph_view_type, bool>(handle, graph_view);
+    fill_edge_property(handle, graph_view, (*edge_mask_).mutable_view(), true);
+    graph_view.attach_edge_mask((*edge_mask_).view());
+  }
+
+  // (srcs, dsts) remain sorted (and unique) in the major, minor order
+  edge_bucket_t<vertex_t, void, !store_transposed, multi_gpu, true> edge_list(
+    handle, std::move(srcs), std::move(dsts));
+  transform_e(handle,
+              graph_view,
+              edge_list,
+              edge_src_dummy_property_t{}.view(),
+              edge_dst_dummy_property_t{}.view(),
+              edge_dummy_property_t{}.view(),
+              clear_edge_mask_e_op_t<vertex_t>{},
+              (*edge_mask_).mutable_view());
+
+  graph_view.clear_edge_mask();
+  num_local_masked_edges_ = count_local_masked_edges(handle, graph_view, (*edge_mask_).view());
+
+  auto num_masked = static_cast<size_t>(num_local_masked_edges_);
+  if constexpr (multi_gpu) {
+    num_masked = host_scalar_allreduce(
+      handle.get_comms(), num_masked, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (static_cast<double>(num_masked) >
+      compaction_threshold_ * static_cast<double>(graph_.number_of_edges())) {
+    merge(handle);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::compact(
+  raft::handle_t const& handle)
+{
+  auto num_updates = delta_srcs_.size() + static_cast<size_t>(num_local_masked_edges_);
+  if constexpr (multi_gpu) {
+    num_updates = host_scalar_allreduce(
+      handle.get_comms(), num_updates, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (num_updates > 0) { merge(handle); }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>
+mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::view(
+  raft::handle_t const& handle)
+{
+  auto num_pending = delta_srcs_.size();
+  if constexpr (multi_gpu) {
+    num_pending = host_scalar_allreduce(
+      handle.get_comms(), num_pending, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  if (num_pending > 0) { merge(handle); }
+
+  auto graph_view = graph_.view();
+  if (edge_mask_) { graph_view.attach_edge_mask((*edge_mask_).view()); }
+  return graph_view;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::merge(
+  raft::handle_t const& handle)
+{
+  auto graph_view = graph_.view();
+
+  // 1. sort the pending insertions by major to split them by local edge partition
+
+  auto& delta_majors = store_transposed ? delta_dsts_ : delta_srcs_;
+  auto& delta_minors = store_transposed ? delta_srcs_ : delta_dsts_;
+  if (delta_weights_) {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(),
+      delta_majors.begin(),
+      delta_majors.end(),
+      thrust::make_zip_iterator(delta_minors.begin(), (*delta_weights_).begin()));
+  } else {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), delta_majors.begin(), delta_majors.end(), delta_minors.begin());
+  }
+
+  auto total_global_mem = handle.get_device_properties().totalGlobalMem;
+  auto element_size     = sizeof(vertex_t) * 2 + (edge_weights_ ? sizeof(weight_t) : size_t{0});
+  auto constexpr mem_frugal_ratio =
+    0.05;  // if the expected temporary buffer size exceeds the mem_frugal_ratio of the
+           // total_global_mem, switch to the memory frugal approach
+  auto mem_frugal_threshold =
+    static_cast<size_t>(static_cast<double>(total_global_mem / element_size) * mem_frugal_ratio);
+
+  // 2. decompress the unmasked edges of each local edge partition, append the pending insertions,
+  // and recompress (using the same vertex partitioning), also compute the local vertex partition's
+  // major degrees to update the segment offsets
+
+  std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices{};
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> edge_partition_weights{std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<vertex_t>>> edge_partition_dcs_nzd_vertices{
+    std::nullopt};
+  edge_partition_offsets.reserve(graph_view.number_of_local_edge_partitions());
+  edge_partition_indices.reserve(graph_view.number_of_local_edge_partitions());
+  if (edge_weights_) {
+    edge_partition_weights = std::vector<rmm::device_uvector<weight_t>>{};
+    (*edge_partition_weights).reserve(graph_view.number_of_local_edge_partitions());
+  }
+
+  rmm::device_uvector<edge_t> major_degrees(graph_view.local_vertex_partition_range_size(),
+                                             handle.get_stream());
+
+  auto weight_view = edge_weight_view();
+  size_t number_of_local_edges{0};
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition_view = graph_view.local_edge_partition_view(i);
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t, edge_t, multi_gpu>(edge_partition_view);
+    auto major_range_first = edge_partition_view.major_range_first();
+    auto major_range_last  = edge_partition_view.major_range_last();
+
+    size_t num_edges = edge_partition.number_of_edges();
+    if (edge_mask_) {
+      num_edges = detail::count_set_bits(
+        handle, (*edge_mask_).view().value_firsts()[i], edge_partition.number_of_edges());
+    }
+    auto delta_first = static_cast<size_t>(thrust::distance(
+      delta_majors.begin(),
+      thrust::lower_bound(
+        handle.get_thrust_policy(), delta_majors.begin(), delta_majors.end(), major_range_first)));
+    auto delta_last = static_cast<size_t>(thrust::distance(
+      delta_majors.begin(),
+      thrust::lower_bound(
+        handle.get_thrust_policy(), delta_majors.begin(), delta_majors.end(), major_range_last)));
+
+    rmm::device_uvector<vertex_t> majors(num_edges + (delta_last - delta_first),
+                                         handle.get_stream());
+    rmm::device_uvector<vertex_t> minors(majors.size(), handle.get_stream());
+    auto weights = edge_weights_ ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                     majors.size(), handle.get_stream())
+                                 : std::nullopt;
+
+    detail::decompress_edge_partition_to_edgelist<vertex_t, edge_t, weight_t, int32_t, multi_gpu>(
+      handle,
+      edge_partition,
+      weight_view
+        ? std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, weight_t const*>>(
+            *weight_view, i)
+        : std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      edge_mask_
+        ? std::make_optional<
+            detail::edge_partition_edge_property_device_view_t<edge_t, uint32_t const*, bool>>(
+            (*edge_mask_).view(), i)
+        : std::nullopt,
+      raft::device_span<vertex_t>(majors.data(), num_edges),
+      raft::device_span<vertex_t>(minors.data(), num_edges),
+      weights ? std::make_optional<raft::device_span<weight_t>>((*weights).data(), num_edges)
+              : std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      graph_view.local_edge_partition_segment_offsets(i));
+
+    thrust::copy(handle.get_thrust_policy(),
+                 delta_majors.begin() + delta_first,
+                 delta_majors.begin() + delta_last,
+                 majors.begin() + num_edges);
+    thrust::copy(handle.get_thrust_policy(),
+                 delta_minors.begin() + delta_first,
+                 delta_minors.begin() + delta_last,
+                 minors.begin() + num_edges);
+    if (weights) {
+      thrust::copy(handle.get_thrust_policy(),
+                   (*delta_weights_).begin() + delta_first,
+                   (*delta_weights_).begin() + delta_last,
+                   (*weights).begin() + num_edges);
+    }
+    number_of_local_edges += majors.size();
+
+    rmm::device_uvector<edge_t> offsets(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> indices(0, handle.get_stream());
+    std::optional<rmm::device_uvector<vertex_t>> dcs_nzd_vertices{std::nullopt};
+    if (weights) {
+      rmm::device_uvector<weight_t> values(0, handle.get_stream());
+      std::tie(offsets, indices, values, dcs_nzd_vertices) =
+        detail::sort_and_compress_edgelist<vertex_t, edge_t, weight_t, store_transposed>(
+          std::move(store_transposed ? minors : majors),
+          std::move(store_transposed ? majors : minors),
+          std::move(*weights),
+          major_range_first,
+          edge_partition_view.major_hypersparse_first(),
+          major_range_last,
+          edge_partition_view.minor_range_first(),
+          edge_partition_view.minor_range_last(),
+          mem_frugal_threshold,
+          handle.get_stream());
+      (*edge_partition_weights).push_back(std::move(values));
+    } else {
+      std::tie(offsets, indices, dcs_nzd_vertices) =
+        detail::sort_and_compress_edgelist<vertex_t, edge_t, store_transposed>(
+          std::move(store_transposed ? minors : majors),
+          std::move(store_transposed ? majors : minors),
+          major_range_first,
+          edge_partition_view.major_hypersparse_first(),
+          major_range_last,
+          edge_partition_view.minor_range_first(),
+          edge_partition_view.minor_range_last(),
+          mem_frugal_threshold,
+          handle.get_stream());
+    }
+
+    auto local_major_degrees = compute_edge_partition_major_degrees(
+      handle,
+      raft::device_span<edge_t const>(offsets.data(), offsets.size()),
+      dcs_nzd_vertices ? std::make_optional<raft::device_span<vertex_t const>>(
+                           (*dcs_nzd_vertices).data(), (*dcs_nzd_vertices).size())
+                       : std::nullopt,
+      major_range_first,
+      edge_partition_view.major_hypersparse_first(),
+      major_range_last);
+    if constexpr (multi_gpu) {
+      auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+      device_reduce(minor_comm,
+                    local_major_degrees.data(),
+                    major_degrees.data(),
+                    local_major_degrees.size(),
+                    raft::comms::op_t::SUM,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    } else {
+      major_degrees = std::move(local_major_degrees);
+    }
+
+    edge_partition_offsets.push_back(std::move(offsets));
+    edge_partition_indices.push_back(std::move(indices));
+    if (dcs_nzd_vertices) {
+      if (!edge_partition_dcs_nzd_vertices) {
+        edge_partition_dcs_nzd_vertices = std::vector<rmm::device_uvector<vertex_t>>{};
+        (*edge_partition_dcs_nzd_vertices).reserve(graph_view.number_of_local_edge_partitions());
+      }
+      (*edge_partition_dcs_nzd_vertices).push_back(std::move(*dcs_nzd_vertices));
+    }
+  }
+
+  // 3. reconstruct the graph object
+
+  graph_properties_t properties{graph_view.is_symmetric(), graph_view.is_multigraph()};
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    std::vector<vertex_t> vertex_partition_range_offsets(vertex_partition_range_lasts.size() + 1,
+                                                         vertex_t{0});
+    std::copy(vertex_partition_range_lasts.begin(),
+              vertex_partition_range_lasts.end(),
+              vertex_partition_range_offsets.begin() + 1);
+
+    auto segment_offsets = graph_view.local_vertex_partition_segment_offsets();
+    CUGRAPH_EXPECTS(segment_offsets.has_value(),
+                    "Invalid graph object: multi-GPU graphs should have segment offsets.");
+    auto hypersparse_degree_offsets =
+      graph_view.local_vertex_partition_hypersparse_degree_offsets();
+    std::tie(*segment_offsets, hypersparse_degree_offsets) =
+      update_segment_offsets(handle,
+                             raft::device_span<edge_t const>(major_degrees.data(),
+                                                             major_degrees.size()),
+                             *segment_offsets,
+                             hypersparse_degree_offsets);
+    auto edge_partition_segment_offsets =
+      allgather_minor_comm_offset_vectors(handle, *segment_offsets);
+    auto edge_partition_hypersparse_degree_offsets =
+      hypersparse_degree_offsets ? std::make_optional(allgather_minor_comm_offset_vectors(
+                                     handle, *hypersparse_degree_offsets))
+                                 : std::nullopt;
+
+    auto number_of_edges = static_cast<edge_t>(host_scalar_allreduce(
+      handle.get_comms(), number_of_local_edges, raft::comms::op_t::SUM, handle.get_stream()));
+
+    graph_ = graph_type(handle,
+                        std::move(edge_partition_offsets),
+                        std::move(edge_partition_indices),
+                        std::move(edge_partition_dcs_nzd_vertices),
+                        graph_meta_t<vertex_t, edge_t, multi_gpu>{
+                          graph_view.number_of_vertices(),
+                          number_of_edges,
+                          properties,
+                          partition_t<vertex_t>(vertex_partition_range_offsets,
+                                                major_comm.get_size(),
+                                                minor_comm.get_size(),
+                                                major_comm.get_rank(),
+                                                minor_comm.get_rank()),
+                          edge_partition_segment_offsets,
+                          edge_partition_hypersparse_degree_offsets});
+  } else {
+    auto segment_offsets = graph_view.local_vertex_partition_segment_offsets();
+    auto hypersparse_degree_offsets =
+      graph_view.local_vertex_partition_hypersparse_degree_offsets();
+    if (segment_offsets) {
+      std::tie(*segment_offsets, hypersparse_degree_offsets) =
+        update_segment_offsets(handle,
+                               raft::device_span<edge_t const>(major_degrees.data(),
+                                                               major_degrees.size()),
+                               *segment_offsets,
+                               hypersparse_degree_offsets);
+    }
+
+    graph_ = graph_type(handle,
+                        std::move(edge_partition_offsets[0]),
+                        std::move(edge_partition_indices[0]),
+                        graph_meta_t<vertex_t, edge_t, multi_gpu>{graph_view.number_of_vertices(),
+                                                                  properties,
+                                                                  segment_offsets,
+                                                                  hypersparse_degree_offsets});
+  }
+
+  if (edge_partition_weights) {
+    edge_weights_ =
+      edge_property_t<graph_view_type, weight_t>(std::move(*edge_partition_weights));
+  }
+  edge_mask_              = std::nullopt;
+  num_local_masked_edges_ = 0;
+
+  delta_srcs_.resize(0, handle.get_stream());
+  delta_srcs_.shrink_to_fit(handle.get_stream());
+  delta_dsts_.resize(0, handle.get_stream());
+  delta_dsts_.shrink_to_fit(handle.get_stream());
+  if (delta_weights_) {
+    (*delta_weights_).resize(0, handle.get_stream());
+    (*delta_weights_).shrink_to_fit(handle.get_stream());
+  }
+}
+
+}  // namespace cugraph
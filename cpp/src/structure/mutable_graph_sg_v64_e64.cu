@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/mutable_graph_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template class mutable_graph_t<int64_t, int64_t, float, true, false>;
+template class mutable_graph_t<int64_t, int64_t, float, false, false>;
+template class mutable_graph_t<int64_t, int64_t, double, true, false>;
+template class mutable_graph_t<int64_t, int64_t, double, false, false>;
+
+}  // namespace cugraph
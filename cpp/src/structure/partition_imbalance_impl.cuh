@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/mask_utils.cuh>
+
+#include <raft/core/handle.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename count_t>
+double compute_imbalance(std::vector<count_t> const& counts)
+{
+  auto max_count = *std::max_element(counts.begin(), counts.end());
+  auto sum = std::reduce(counts.begin(), counts.end(), double{0.0}, [](double lhs, auto rhs) {
+    return lhs + static_cast<double>(rhs);
+  });
+  return sum > 0.0 ? static_cast<double>(max_count) * static_cast<double>(counts.size()) / sum
+                   : 1.0;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+partition_imbalance_t<vertex_t, edge_t> compute_partition_imbalance(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view)
+{
+  auto edge_mask_view = graph_view.edge_mask_view();
+
+  edge_t local_edge_count{0};
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    if (edge_mask_view) {
+      local_edge_count += static_cast<edge_t>(
+        detail::count_set_bits(handle,
+                               (*edge_mask_view).value_firsts()[i],
+                               static_cast<size_t>((*edge_mask_view).edge_counts()[i])));
+    } else {
+      local_edge_count += graph_view.local_edge_partition_view(i).number_of_edges();
+    }
+  }
+
+  partition_imbalance_t<vertex_t, edge_t> ret{};
+  if constexpr (multi_gpu) {
+    ret.vertex_counts = host_scalar_allgather(
+      handle.get_comms(), graph_view.local_vertex_partition_range_size(), handle.get_stream());
+    ret.edge_counts =
+      host_scalar_allgather(handle.get_comms(), local_edge_count, handle.get_stream());
+  } else {
+    ret.vertex_counts = {graph_view.local_vertex_partition_range_size()};
+    ret.edge_counts   = {local_edge_count};
+  }
+  ret.vertex_imbalance = detail::compute_imbalance(ret.vertex_counts);
+  ret.edge_imbalance   = detail::compute_imbalance(ret.edge_counts);
+
+  return ret;
+}
+
+}  // namespace cugraph
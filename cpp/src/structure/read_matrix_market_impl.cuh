@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "utilities/shuffle_vertex_pairs.cuh"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+struct matrix_market_header_t {
+  bool is_pattern{false};
+  bool is_symmetric{false};
+  size_t number_of_rows{0};
+  size_t number_of_columns{0};
+  size_t number_of_entries{0};
+  size_t data_offset{0};  // file offset of the first byte after the size line
+};
+
+inline matrix_market_header_t read_matrix_market_header(std::ifstream& ifs)
+{
+  auto to_lower = [](std::string s) {
+    std::transform(
+      s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+    return s;
+  };
+
+  std::string line{};
+  CUGRAPH_EXPECTS(static_cast<bool>(std::getline(ifs, line)),
+                  "Invalid Matrix Market file: failed to read the banner.");
+  std::istringstream banner(line);
+  std::string magic{}, object{}, format{}, field{}, symmetry{};
+  banner >> magic >> object >> format >> field >> symmetry;
+  object   = to_lower(object);
+  format   = to_lower(format);
+  field    = to_lower(field);
+  symmetry = to_lower(symmetry);
+  CUGRAPH_EXPECTS(magic == "%%MatrixMarket", "Invalid Matrix Market file: invalid banner.");
+  CUGRAPH_EXPECTS((object == "matrix") && (format == "coordinate"),
+                  "Invalid Matrix Market file: only sparse (coordinate) matrices are supported.");
+  CUGRAPH_EXPECTS((field == "real") || (field == "integer") || (field == "pattern"),
+                  "Invalid Matrix Market file: complex matrices are not supported.");
+  CUGRAPH_EXPECTS((symmetry == "general") || (symmetry == "symmetric"),
+                  "Invalid Matrix Market file: skew-symmetric and Hermitian matrices are not "
+                  "supported.");
+
+  matrix_market_header_t header{};
+  header.is_pattern   = (field == "pattern");
+  header.is_symmetric = (symmetry == "symmetric");
+
+  while (std::getline(ifs, line)) {
+    auto first = line.find_first_not_of(" \t\r");
+    if ((first == std::string::npos) || (line[first] == '%')) { continue; }
+    std::istringstream size_line(line);
+    CUGRAPH_EXPECTS(static_cast<bool>(size_line >> header.number_of_rows >>
+                                      header.number_of_columns >> header.number_of_entries),
+                    "Invalid Matrix Market file: failed to read the size line.");
+    header.data_offset = static_cast<size_t>(ifs.tellg());
+    return header;
+  }
+  CUGRAPH_FAIL("Invalid Matrix Market file: missing the size line.");
+  return header;
+}
+
+struct is_owned_line_start_t {
+  char const* chunk{nullptr};
+  size_t num_owned_bytes{0};  // lines starting at or after this position belong to another rank
+
+  __device__ bool operator()(size_t i) const
+  {
+    return (i < num_owned_bytes) && ((i == 0) || (chunk[i - 1] == '\n'));
+  }
+};
+
+// parse a "row column [value]" line (1-based indices), comment or empty lines are invalid
+template <typename vertex_t, typename weight_t>
+struct parse_matrix_market_line_t {
+  char const* chunk{nullptr};
+  size_t chunk_size{0};
+  bool parse_weight{false};
+
+  __device__ bool is_space(char c) const { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+  __device__ bool is_digit(char c) const { return (c >= '0') && (c <= '9'); }
+
+  __device__ size_t skip_spaces(size_t i) const
+  {
+    while ((i < chunk_size) && is_space(chunk[i])) {
+      ++i;
+    }
+    return i;
+  }
+
+  __device__ cuda::std::optional<int64_t> parse_index(size_t& i) const
+  {
+    i = skip_spaces(i);
+    if ((i >= chunk_size) || !is_digit(chunk[i])) { return cuda::std::nullopt; }
+    int64_t v{0};
+    while ((i < chunk_size) && is_digit(chunk[i])) {
+      v = v * 10 + (chunk[i] - '0');
+      ++i;
+    }
+    return v;
+  }
+
+  __device__ cuda::std::optional<double> parse_value(size_t& i) const
+  {
+    i = skip_spaces(i);
+    if (i >= chunk_size) { return cuda::std::nullopt; }
+    double sign{1.0};
+    if ((chunk[i] == '-') || (chunk[i] == '+')) {
+      sign = (chunk[i] == '-') ? -1.0 : 1.0;
+      ++i;
+    }
+    double v{0.0};
+    bool has_digits{false};
+    while ((i < chunk_size) && is_digit(chunk[i])) {
+      v          = v * 10.0 + (chunk[i] - '0');
+      has_digits = true;
+      ++i;
+    }
+    if ((i < chunk_size) && (chunk[i] == '.')) {
+      ++i;
+      double scale{0.1};
+      while ((i < chunk_size) && is_digit(chunk[i])) {
+        v += (chunk[i] - '0') * scale;
+        scale *= 0.1;
+        has_digits = true;
+        ++i;
+      }
+    }
+    if (!has_digits) { return cuda::std::nullopt; }
+    if ((i < chunk_size) && ((chunk[i] == 'e') || (chunk[i] == 'E'))) {
+      ++i;
+      int exp_sign{1};
+      if ((i < chunk_size) && ((chunk[i] == '-') || (chunk[i] == '+'))) {
+        exp_sign = (chunk[i] == '-') ? -1 : 1;
+        ++i;
+      }
+      int exponent{0};
+      while ((i < chunk_size) && is_digit(chunk[i])) {
+        exponent = exponent * 10 + (chunk[i] - '0');
+        ++i;
+      }
+      v *= pow(10.0, static_cast<double>(exp_sign * exponent));
+    }
+    return sign * v;
+  }
+
+  __device__ thrust::tuple<vertex_t, vertex_t, weight_t> operator()(size_t line_start) const
+  {
+    auto invalid = thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                                      invalid_vertex_id<vertex_t>::value,
+                                      weight_t{0.0});
+    size_t i = line_start;
+    auto row = parse_index(i);
+    if (!row || (*row == 0)) { return invalid; }
+    auto col = parse_index(i);
+    if (!col || (*col == 0)) { return invalid; }
+    weight_t w{1.0};
+    if (parse_weight) {
+      auto value = parse_value(i);
+      if (!value) { return invalid; }
+      w = static_cast<weight_t>(*value);
+    }
+    return thrust::make_tuple(static_cast<vertex_t>(*row - 1), static_cast<vertex_t>(*col - 1), w);
+  }
+};
+
+template <typename vertex_t>
+struct is_invalid_edge_t {
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e) const
+  {
+    return thrust::get<0>(e) == invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+struct is_off_diagonal_t {
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e) const
+  {
+    return thrust::get<0>(e) != thrust::get<1>(e);
+  }
+};
+
+template <typename vertex_t>
+struct is_out_of_range_edge_t {
+  vertex_t number_of_vertices{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    return (thrust::get<0>(e) < 0) || (thrust::get<0>(e) >= number_of_vertices) ||
+           (thrust::get<1>(e) < 0) || (thrust::get<1>(e) >= number_of_vertices);
+  }
+};
+
+template <typename vertex_t>
+struct is_not_local_vertex_t {
+  compute_gpu_id_from_ext_vertex_t<vertex_t> key_func{};
+  int comm_rank{};
+
+  __device__ bool operator()(vertex_t v) const { return key_func(v) != comm_rank; }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<weight_t>>,
+           rmm::device_uvector<vertex_t>,
+           bool>
+read_matrix_market_edgelist(raft::handle_t const& handle,
+                            std::string const& filename,
+                            bool read_weights,
+                            bool store_transposed,
+                            size_t chunk_size,
+                            bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(chunk_size > 0, "Invalid input argument: chunk_size should be positive.");
+
+  std::ifstream ifs(filename, std::ios::binary);
+  CUGRAPH_EXPECTS(ifs.is_open(), "Failed to open the Matrix Market file (%s).", filename.c_str());
+
+  auto header = detail::read_matrix_market_header(ifs);
+  CUGRAPH_EXPECTS(
+    std::max(header.number_of_rows, header.number_of_columns) <
+      static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid template parameter: vertex_t overflow.");
+  auto number_of_vertices =
+    static_cast<vertex_t>(std::max(header.number_of_rows, header.number_of_columns));
+  bool parse_weights = read_weights && !header.is_pattern;
+
+  ifs.seekg(0, std::ios::end);
+  auto file_size = static_cast<size_t>(ifs.tellg());
+
+  // 1. find the byte range of this rank, a rank owns the lines starting in its byte range
+
+  auto range_first = header.data_offset;
+  auto range_last  = file_size;
+  if constexpr (multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+    auto const comm_rank = handle.get_comms().get_rank();
+    auto data_size       = file_size - header.data_offset;
+    range_first = header.data_offset + (data_size / comm_size) * comm_rank +
+                  std::min(data_size % comm_size, static_cast<size_t>(comm_rank));
+    range_last  = range_first + (data_size / comm_size) +
+                 ((static_cast<size_t>(comm_rank) < (data_size % comm_size)) ? 1 : 0);
+    if (range_first > header.data_offset) {  // skip the line started in the previous rank's range
+      ifs.clear();
+      ifs.seekg(range_first - 1);
+      ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+      range_first = ifs.good() ? static_cast<size_t>(ifs.tellg()) : file_size;
+    }
+  }
+
+  // 2. stream chunks of complete lines to the GPU and parse them there
+
+  rmm::device_uvector<vertex_t> edgelist_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> edgelist_dsts(0, handle.get_stream());
+  auto edgelist_weights = read_weights
+                            ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                0, handle.get_stream())
+                            : std::nullopt;
+  {
+    auto num_expected_edges = header.number_of_entries;
+    if constexpr (multi_gpu) {
+      auto const comm_size = handle.get_comms().get_size();
+      num_expected_edges   = (header.number_of_entries / comm_size) * 11 / 10;
+    }
+    edgelist_srcs.reserve(num_expected_edges, handle.get_stream());
+    edgelist_dsts.reserve(num_expected_edges, handle.get_stream());
+    if (edgelist_weights) { (*edgelist_weights).reserve(num_expected_edges, handle.get_stream()); }
+  }
+
+  if (range_first < range_last) {
+    std::vector<char> h_chunk(chunk_size);
+    rmm::device_uvector<char> d_chunk(chunk_size, handle.get_stream());
+    rmm::device_uvector<size_t> line_starts(0, handle.get_stream());
+
+    ifs.clear();
+    ifs.seekg(range_first);
+    auto chunk_offset = range_first;  // file offset of h_chunk[0]
+    size_t num_carried_bytes{0};
+    while (true) {
+      ifs.read(h_chunk.data() + num_carried_bytes, chunk_size - num_carried_bytes);
+      auto num_read_bytes = static_cast<size_t>(ifs.gcount());
+      bool eof            = num_read_bytes < (chunk_size - num_carried_bytes);
+      auto num_bytes      = num_carried_bytes + num_read_bytes;
+      if (num_bytes == 0) { break; }
+
+      size_t num_complete_bytes = num_bytes;
+      if (!eof) {
+        auto last_newline = std::find(std::make_reverse_iterator(h_chunk.begin() + num_bytes),
+                                      std::make_reverse_iterator(h_chunk.begin()),
+                                      '\n');
+        CUGRAPH_EXPECTS(last_newline != std::make_reverse_iterator(h_chunk.begin()),
+                        "Invalid input argument: chunk_size is smaller than a line.");
+        num_complete_bytes =
+          static_cast<size_t>(std::distance(h_chunk.begin(), last_newline.base()));
+      }
+      auto num_owned_bytes = std::min(num_complete_bytes, range_last - chunk_offset);
+
+      raft::update_device(d_chunk.data(), h_chunk.data(), num_complete_bytes, handle.get_stream());
+
+      auto num_lines = static_cast<size_t>(
+        thrust::count_if(handle.get_thrust_policy(),
+                         thrust::make_counting_iterator(size_t{0}),
+                         thrust::make_counting_iterator(num_owned_bytes),
+                         detail::is_owned_line_start_t{d_chunk.data(), num_owned_bytes}));
+      line_starts.resize(num_lines, handle.get_stream());
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_owned_bytes),
+                      line_starts.begin(),
+                      detail::is_owned_line_start_t{d_chunk.data(), num_owned_bytes});
+
+      auto old_size = edgelist_srcs.size();
+      edgelist_srcs.resize(old_size + line_starts.size(), handle.get_stream());
+      edgelist_dsts.resize(edgelist_srcs.size(), handle.get_stream());
+      rmm::device_uvector<weight_t> tmp_weights(line_starts.size(), handle.get_stream());
+      thrust::transform(
+        handle.get_thrust_policy(),
+        line_starts.begin(),
+        line_starts.end(),
+        thrust::make_zip_iterator(edgelist_srcs.begin() + old_size,
+                                  edgelist_dsts.begin() + old_size,
+                                  tmp_weights.begin()),
+        detail::parse_matrix_market_line_t<vertex_t, weight_t>{
+          d_chunk.data(), num_complete_bytes, parse_weights});
+
+      size_t new_size{};
+      if (edgelist_weights) {
+        (*edgelist_weights).resize(edgelist_srcs.size(), handle.get_stream());
+        thrust::copy(handle.get_thrust_policy(),
+                     tmp_weights.begin(),
+                     tmp_weights.end(),
+                     (*edgelist_weights).begin() + old_size);
+        auto edge_first = thrust::make_zip_iterator(
+          edgelist_srcs.begin(), edgelist_dsts.begin(), (*edgelist_weights).begin());
+        new_size = thrust::distance(
+          edge_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            edge_first + old_size,
+                            edge_first + edgelist_srcs.size(),
+                            detail::is_invalid_edge_t<vertex_t>{}));
+        (*edgelist_weights).resize(new_size, handle.get_stream());
+      } else {
+        auto edge_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+        new_size        = thrust::distance(
+          edge_first,
+          thrust::remove_if(handle.get_thrust_policy(),
+                            edge_first + old_size,
+                            edge_first + edgelist_srcs.size(),
+                            detail::is_invalid_edge_t<vertex_t>{}));
+      }
+      edgelist_srcs.resize(new_size, handle.get_stream());
+      edgelist_dsts.resize(new_size, handle.get_stream());
+
+      handle.sync_stream();  // h_chunk is reused in the next iteration
+
+      if (eof || (chunk_offset + num_complete_bytes >= range_last)) { break; }
+      std::memmove(h_chunk.data(),
+                   h_chunk.data() + num_complete_bytes,
+                   num_bytes - num_complete_bytes);
+      num_carried_bytes = num_bytes - num_complete_bytes;
+      chunk_offset += num_complete_bytes;
+    }
+  }
+  edgelist_srcs.shrink_to_fit(handle.get_stream());
+  edgelist_dsts.shrink_to_fit(handle.get_stream());
+  if (edgelist_weights) { (*edgelist_weights).shrink_to_fit(handle.get_stream()); }
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+    auto num_invalid_edges =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_first,
+                       edge_first + edgelist_srcs.size(),
+                       detail::is_out_of_range_edge_t<vertex_t>{number_of_vertices});
+    if constexpr (multi_gpu) {
+      num_invalid_edges = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_edges, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid Matrix Market file: entries have out-of-range row or column indices.");
+  }
+
+  // 3. add the symmetric complements of the off-diagonal entries
+
+  if (header.is_symmetric) {
+    auto edge_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+    auto num_edges  = edgelist_srcs.size();
+    auto num_off_diagonal_edges = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(), edge_first, edge_first + num_edges, detail::is_off_diagonal_t{}));
+    edgelist_srcs.resize(num_edges + num_off_diagonal_edges, handle.get_stream());
+    edgelist_dsts.resize(edgelist_srcs.size(), handle.get_stream());
+    if (edgelist_weights) {
+      (*edgelist_weights).resize(edgelist_srcs.size(), handle.get_stream());
+      auto input_first = thrust::make_zip_iterator(
+        edgelist_srcs.begin(), edgelist_dsts.begin(), (*edgelist_weights).begin());
+      thrust::copy_if(handle.get_thrust_policy(),
+                      input_first,
+                      input_first + num_edges,
+                      thrust::make_zip_iterator(edgelist_dsts.begin() + num_edges,
+                                                edgelist_srcs.begin() + num_edges,
+                                                (*edgelist_weights).begin() + num_edges),
+                      detail::is_off_diagonal_t{});
+    } else {
+      auto input_first = thrust::make_zip_iterator(edgelist_srcs.begin(), edgelist_dsts.begin());
+      thrust::copy_if(handle.get_thrust_policy(),
+                      input_first,
+                      input_first + num_edges,
+                      thrust::make_zip_iterator(edgelist_dsts.begin() + num_edges,
+                                                edgelist_srcs.begin() + num_edges),
+                      detail::is_off_diagonal_t{});
+    }
+  }
+
+  // 4. shuffle the edges and vertices to their owning GPUs
+
+  rmm::device_uvector<vertex_t> vertices(number_of_vertices, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), vertices.begin(), vertices.end(), vertex_t{0});
+
+  if constexpr (multi_gpu) {
+    auto& comm                 = handle.get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto const major_comm_size = major_comm.get_size();
+    auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+    auto const minor_comm_size = minor_comm.get_size();
+
+    vertices.resize(
+      thrust::distance(vertices.begin(),
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         vertices.begin(),
+                                         vertices.end(),
+                                         detail::is_not_local_vertex_t<vertex_t>{
+                                           detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+                                             comm_size, major_comm_size, minor_comm_size},
+                                           comm_rank})),
+      handle.get_stream());
+    vertices.shrink_to_fit(handle.get_stream());
+
+    // shuffle_external_edges treats the first vertex of each pair as the major
+    auto& majors = store_transposed ? edgelist_dsts : edgelist_srcs;
+    auto& minors = store_transposed ? edgelist_srcs : edgelist_dsts;
+    std::optional<rmm::device_uvector<vertex_t>> edge_ids{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> edge_types{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> edge_start_times{std::nullopt};
+    std::optional<rmm::device_uvector<int32_t>> edge_end_times{std::nullopt};
+    std::tie(majors,
+             minors,
+             edgelist_weights,
+             edge_ids,
+             edge_types,
+             edge_start_times,
+             edge_end_times,
+             std::ignore) =
+      shuffle_external_edges<vertex_t, vertex_t, weight_t, int32_t, int32_t>(
+        handle,
+        std::move(majors),
+        std::move(minors),
+        std::move(edgelist_weights),
+        std::move(edge_ids),
+        std::move(edge_types),
+        std::move(edge_start_times),
+        std::move(edge_end_times));
+  }
+
+  return std::make_tuple(std::move(edgelist_srcs),
+                         std::move(edgelist_dsts),
+                         std::move(edgelist_weights),
+                         std::move(vertices),
+                         header.is_symmetric);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/read_matrix_market_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    rmm::device_uvector<int32_t>,
+                    bool>
+read_matrix_market_edgelist<int32_t, float, false>(raft::handle_t const& handle,
+                                                   std::string const& filename,
+                                                   bool read_weights,
+                                                   bool store_transposed,
+                                                   size_t chunk_size,
+                                                   bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    rmm::device_uvector<int32_t>,
+                    bool>
+read_matrix_market_edgelist<int32_t, double, false>(raft::handle_t const& handle,
+                                                    std::string const& filename,
+                                                    bool read_weights,
+                                                    bool store_transposed,
+                                                    size_t chunk_size,
+                                                    bool do_expensive_check);
+
+}  // namespace cugraph
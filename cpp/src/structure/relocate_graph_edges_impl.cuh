@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>>
+relocate_graph_edges(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>&& graph,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check)
+{
+  using graph_type      = graph_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+  using graph_view_type = graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+
+  auto graph_view = graph.view();
+
+  if (do_expensive_check) {
+    if (edge_weights) {
+      auto edge_weight_view = (*edge_weights).view();
+      CUGRAPH_EXPECTS(
+        edge_weight_view.edge_counts().size() == graph_view.number_of_local_edge_partitions(),
+        "Invalid input argument: edge_weights does not match with graph.");
+      for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+        auto num_edges =
+          static_cast<edge_t>(graph_view.local_edge_partition_view(i).indices().size());
+        CUGRAPH_EXPECTS(edge_weight_view.edge_counts()[i] == num_edges,
+                        "Invalid input argument: edge_weights does not match with graph.");
+      }
+    }
+  }
+
+  // 1. copy the edge partition indices (and edge weights) to memory allocated from mr, offsets
+  // and DCSR/DCSC non-zero vertices stay in the GPU memory
+
+  std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices{};
+  std::optional<std::vector<rmm::device_uvector<vertex_t>>> edge_partition_dcs_nzd_vertices{
+    std::nullopt};
+  std::optional<std::vector<rmm::device_uvector<weight_t>>> edge_partition_weights{std::nullopt};
+  edge_partition_offsets.reserve(graph_view.number_of_local_edge_partitions());
+  edge_partition_indices.reserve(graph_view.number_of_local_edge_partitions());
+  if (edge_weights) {
+    edge_partition_weights = std::vector<rmm::device_uvector<weight_t>>{};
+    (*edge_partition_weights).reserve(graph_view.number_of_local_edge_partitions());
+  }
+
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition = graph_view.local_edge_partition_view(i);
+
+    rmm::device_uvector<edge_t> offsets(edge_partition.offsets().size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 edge_partition.offsets().begin(),
+                 edge_partition.offsets().end(),
+                 offsets.begin());
+    edge_partition_offsets.push_back(std::move(offsets));
+
+    rmm::device_uvector<vertex_t> indices(
+      edge_partition.indices().size(), handle.get_stream(), mr);
+    thrust::copy(handle.get_thrust_policy(),
+                 edge_partition.indices().begin(),
+                 edge_partition.indices().end(),
+                 indices.begin());
+    edge_partition_indices.push_back(std::move(indices));
+
+    if (edge_partition.dcs_nzd_vertices()) {
+      if (!edge_partition_dcs_nzd_vertices) {
+        edge_partition_dcs_nzd_vertices = std::vector<rmm::device_uvector<vertex_t>>{};
+        (*edge_partition_dcs_nzd_vertices).reserve(graph_view.number_of_local_edge_partitions());
+      }
+      auto dcs_nzd_vertices = *(edge_partition.dcs_nzd_vertices());
+      rmm::device_uvector<vertex_t> nzd_vertices(dcs_nzd_vertices.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   dcs_nzd_vertices.begin(),
+                   dcs_nzd_vertices.end(),
+                   nzd_vertices.begin());
+      (*edge_partition_dcs_nzd_vertices).push_back(std::move(nzd_vertices));
+    }
+
+    if (edge_weights) {
+      auto edge_weight_view = (*edge_weights).view();
+      rmm::device_uvector<weight_t> weights(
+        edge_weight_view.edge_counts()[i], handle.get_stream(), mr);
+      thrust::copy(handle.get_thrust_policy(),
+                   edge_weight_view.value_firsts()[i],
+                   edge_weight_view.value_firsts()[i] + edge_weight_view.edge_counts()[i],
+                   weights.begin());
+      (*edge_partition_weights).push_back(std::move(weights));
+    }
+  }
+
+  // 2. collect the graph meta data before releasing the input graph
+
+  graph_properties_t properties{graph_view.is_symmetric(), graph_view.is_multigraph()};
+  auto number_of_vertices = graph_view.number_of_vertices();
+
+  std::optional<graph_type> relocated_graph{std::nullopt};
+  if constexpr (multi_gpu) {
+    auto& major_comm = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+    auto& minor_comm = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+
+    auto vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    std::vector<vertex_t> vertex_partition_range_offsets(vertex_partition_range_lasts.size() + 1,
+                                                         vertex_t{0});
+    std::copy(vertex_partition_range_lasts.begin(),
+              vertex_partition_range_lasts.end(),
+              vertex_partition_range_offsets.begin() + 1);
+
+    std::vector<vertex_t> edge_partition_segment_offsets{};
+    std::optional<std::vector<vertex_t>> edge_partition_hypersparse_degree_offsets{std::nullopt};
+    for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+      auto segment_offsets = graph_view.local_edge_partition_segment_offsets(i);
+      CUGRAPH_EXPECTS(segment_offsets.has_value(),
+                      "Invalid graph object: multi-GPU graphs should have segment offsets.");
+      edge_partition_segment_offsets.insert(
+        edge_partition_segment_offsets.end(), (*segment_offsets).begin(), (*segment_offsets).end());
+      auto hypersparse_degree_offsets =
+        graph_view.local_edge_partition_hypersparse_degree_offsets(i);
+      if (hypersparse_degree_offsets) {
+        if (!edge_partition_hypersparse_degree_offsets) {
+          edge_partition_hypersparse_degree_offsets = std::vector<vertex_t>{};
+        }
+        (*edge_partition_hypersparse_degree_offsets)
+          .insert((*edge_partition_hypersparse_degree_offsets).end(),
+                  (*hypersparse_degree_offsets).begin(),
+                  (*hypersparse_degree_offsets).end());
+      }
+    }
+
+    auto number_of_edges = graph_view.compute_number_of_edges(handle);
+
+    graph           = graph_type(handle);  // release the input graph's edges
+    edge_weights    = std::nullopt;
+    relocated_graph = graph_type(handle,
+                                 std::move(edge_partition_offsets),
+                                 std::move(edge_partition_indices),
+                                 std::move(edge_partition_dcs_nzd_vertices),
+                                 graph_meta_t<vertex_t, edge_t, multi_gpu>{
+                                   number_of_vertices,
+                                   number_of_edges,
+                                   properties,
+                                   partition_t<vertex_t>(vertex_partition_range_offsets,
+                                                         major_comm.get_size(),
+                                                         minor_comm.get_size(),
+                                                         major_comm.get_rank(),
+                                                         minor_comm.get_rank()),
+                                   edge_partition_segment_offsets,
+                                   edge_partition_hypersparse_degree_offsets},
+                                 do_expensive_check);
+  } else {
+    auto segment_offsets = graph_view.local_vertex_partition_segment_offsets();
+    auto hypersparse_degree_offsets =
+      graph_view.local_vertex_partition_hypersparse_degree_offsets();
+
+    graph           = graph_type(handle);  // release the input graph's edges
+    edge_weights    = std::nullopt;
+    relocated_graph = graph_type(handle,
+                                 std::move(edge_partition_offsets[0]),
+                                 std::move(edge_partition_indices[0]),
+                                 graph_meta_t<vertex_t, edge_t, multi_gpu>{
+                                   number_of_vertices,
+                                   properties,
+                                   segment_offsets,
+                                   hypersparse_degree_offsets},
+                                 do_expensive_check);
+  }
+
+  std::optional<edge_property_t<graph_view_type, weight_t>> relocated_edge_weights{std::nullopt};
+  if (edge_partition_weights) {
+    relocated_edge_weights =
+      edge_property_t<graph_view_type, weight_t>(std::move(*edge_partition_weights));
+  }
+
+  return std::make_tuple(std::move(*relocated_graph), std::move(relocated_edge_weights));
+}
+
+}  // namespace cugraph
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/relocate_graph_edges_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<
+  graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>>
+relocate_graph_edges<int32_t, int32_t, float, false, false>(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, float>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, float>>>
+relocate_graph_edges<int32_t, int32_t, float, true, false>(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, true, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, float>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, false, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>>
+relocate_graph_edges<int32_t, int32_t, double, false, false>(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, false, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, false>, double>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, false>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, double>>>
+relocate_graph_edges<int32_t, int32_t, double, true, false>(
+  raft::handle_t const& handle,
+  graph_t<int32_t, int32_t, true, false>&& graph,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, false>, double>>&&
+    edge_weights,
+  rmm::device_async_resource_ref mr,
+  bool do_expensive_check);
+
+}  // namespace cugraph
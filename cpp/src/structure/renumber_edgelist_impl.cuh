@@ -16,7 +16,9 @@
 #pragma once
 
 #include "detail/graph_partition_utils.cuh"
+#include "prims/key_store.cuh"
 #include "prims/kv_store.cuh"
+#include "structure/detail/structure_utils.cuh"
 
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
@@ -25,11 +27,13 @@
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/memory_resource_hints.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/core/handle.hpp>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
@@ -45,6 +49,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/merge.h>
 #include <thrust/reduce.h>
 #include <thrust/sort.h>
@@ -55,6 +60,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -116,6 +122,162 @@ struct search_and_increment_degree_t {
   }
 };
 
+// tuning parameter: number of hash bins in single-GPU hash-based renumbering, the hash map for each
+// bin is sized to the number of edge end points in the bin, so increasing this cuts peak memory
+// usage at the expense of additional passes over the edge list
+constexpr size_t num_hash_renumber_bins{8};
+constexpr uint32_t renumber_hash_seed{
+  1};  // shouldn't be 0 (in that case this hash function will coincide with the hash function used
+       // to map vertices to GPUs, and we may not see the expected randomization)
+
+// insert the vertices in hash bin "bin" to a (vertex ID to degree) hash map and increment the
+// degrees of edge majors
+template <typename RefType, typename vertex_t, typename edge_t>
+struct insert_and_increment_degree_t {
+  RefType device_ref{};
+  vertex_t invalid_vertex{};  // empty key sentinel, this vertex ID is handled separately
+  uint32_t hash_seed{};
+  size_t num_bins{};
+  size_t bin{};
+  edge_t increment{};  // 1 for edge majors, 0 for edge minors
+
+  __device__ void operator()(vertex_t v)
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{hash_seed};
+    if ((v == invalid_vertex) || (static_cast<size_t>(hash_func(v) % num_bins) != bin)) { return; }
+    auto [iter, inserted] = device_ref.insert_and_find(thrust::make_tuple(v, edge_t{0}));
+    if (increment != edge_t{0}) {
+      cuda::atomic_ref<typename RefType::mapped_type, cuda::thread_scope_device> degree(
+        (*iter).second);
+      degree.fetch_add(increment, cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+// returns the unique vertices in hash bin "bin" and their (edge major) degrees, in an unspecified
+// order, without sorting the edge end points
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<edge_t>>
+hash_unique_vertices_and_degrees(raft::handle_t const& handle,
+                                 vertex_t const* majors,
+                                 vertex_t const* minors,
+                                 edge_t num_edges,
+                                 size_t max_unique_vertices,
+                                 uint32_t hash_seed,
+                                 size_t num_bins,
+                                 size_t bin,
+                                 rmm::device_async_resource_ref scratch_mr)
+{
+  using cuco_map_type =
+    cuco::static_map<vertex_t,
+                     edge_t,
+                     cuco::extent<std::size_t>,
+                     cuda::thread_scope_device,
+                     thrust::equal_to<vertex_t>,
+                     cuco::linear_probing<1,  // CG size
+                                          cuco::murmurhash3_32<vertex_t>>,
+                     rmm::mr::stream_allocator_adaptor<rmm::mr::polymorphic_allocator<std::byte>>,
+                     cuco_storage_type>;
+
+  auto constexpr invalid_vertex = std::numeric_limits<vertex_t>::max();
+
+  double constexpr load_factor = 0.7;
+  auto stream_adapter          = rmm::mr::stream_allocator_adaptor(
+    rmm::mr::polymorphic_allocator<std::byte>(scratch_mr), handle.get_stream());
+  cuco_map_type map(std::max(static_cast<size_t>(static_cast<double>(max_unique_vertices) /
+                                                 load_factor),
+                             max_unique_vertices + 1),
+                    cuco::empty_key<vertex_t>{invalid_vertex},
+                    cuco::empty_value<edge_t>{edge_t{0}},
+                    thrust::equal_to<vertex_t>{},
+                    cuco::linear_probing<1,  // CG size
+                                         cuco::murmurhash3_32<vertex_t>>{},
+                    cuco::thread_scope_device,
+                    cuco_storage_type{},
+                    stream_adapter,
+                    handle.get_stream());
+
+  auto device_ref = map.ref(cuco::insert_and_find);
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    majors,
+    majors + num_edges,
+    insert_and_increment_degree_t<decltype(device_ref), vertex_t, edge_t>{
+      device_ref, invalid_vertex, hash_seed, num_bins, bin, edge_t{1}});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    minors,
+    minors + num_edges,
+    insert_and_increment_degree_t<decltype(device_ref), vertex_t, edge_t>{
+      device_ref, invalid_vertex, hash_seed, num_bins, bin, edge_t{0}});
+
+  // the empty key sentinel can't be inserted to the hash map
+
+  edge_t invalid_vertex_degree{0};
+  bool invalid_vertex_found{false};
+  cuco::detail::MurmurHash3_32<vertex_t> hash_func{hash_seed};
+  if (static_cast<size_t>(hash_func(invalid_vertex) % num_bins) == bin) {
+    invalid_vertex_degree = static_cast<edge_t>(
+      thrust::count(handle.get_thrust_policy(), majors, majors + num_edges, invalid_vertex));
+    invalid_vertex_found =
+      (invalid_vertex_degree > edge_t{0}) ||
+      thrust::any_of(handle.get_thrust_policy(),
+                     minors,
+                     minors + num_edges,
+                     is_equal_t<vertex_t>{invalid_vertex});
+  }
+
+  auto num_inserted = map.size(handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(
+    num_inserted + (invalid_vertex_found ? size_t{1} : size_t{0}), handle.get_stream());
+  rmm::device_uvector<edge_t> degrees(vertices.size(), handle.get_stream());
+  map.retrieve_all(vertices.begin(), degrees.begin(), handle.get_stream());
+  if (invalid_vertex_found) {
+    vertices.set_element(num_inserted, invalid_vertex, handle.get_stream());
+    degrees.set_element(num_inserted, invalid_vertex_degree, handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(vertices), std::move(degrees));
+}
+
+// sort and unique vertices, if hash_based is true, remove duplicates with a hash set first so only
+// the unique vertices are sorted
+template <typename vertex_t>
+void sort_and_unique_vertices(raft::handle_t const& handle,
+                              rmm::device_uvector<vertex_t>& vertices,
+                              bool hash_based,
+                              rmm::device_async_resource_ref scratch_mr)
+{
+  if (hash_based) {
+    auto constexpr invalid_vertex = std::numeric_limits<vertex_t>::max();
+    auto invalid_vertex_found     = thrust::any_of(handle.get_thrust_policy(),
+                                               vertices.begin(),
+                                               vertices.end(),
+                                               is_equal_t<vertex_t>{invalid_vertex});
+    key_store_t<vertex_t, false> store(vertices.size(), invalid_vertex, handle.get_stream());
+    store.insert_if(vertices.begin(),
+                    vertices.end(),
+                    vertices.begin(),
+                    is_not_equal_t<vertex_t>{invalid_vertex},
+                    handle.get_stream());
+    vertices = store.release(handle.get_stream());
+    if (invalid_vertex_found) {
+      vertices.resize(vertices.size() + 1, handle.get_stream());
+      vertices.set_element(vertices.size() - 1, invalid_vertex, handle.get_stream());
+    }
+    thrust::sort(
+      rmm::exec_policy(handle.get_stream(), scratch_mr), vertices.begin(), vertices.end());
+  } else {
+    thrust::sort(
+      rmm::exec_policy(handle.get_stream(), scratch_mr), vertices.begin(), vertices.end());
+    vertices.resize(thrust::distance(vertices.begin(),
+                                     thrust::unique(handle.get_thrust_policy(),
+                                                    vertices.begin(),
+                                                    vertices.end())),
+                    handle.get_stream());
+  }
+}
+
 template <typename vertex_t>
 std::optional<vertex_t> find_locally_unused_ext_vertex_id(
   raft::handle_t const& handle,
@@ -235,6 +397,34 @@ std::optional<vertex_t> find_locally_unused_ext_vertex_id(
            : std::nullopt /* if the entire range of vertex_t is used */;
 }
 
+// compute the smallest minor neighbor of each of the sorted majors
+// (std::numeric_limits<vertex_t>::max() if a major has no edge)
+template <typename vertex_t, typename edge_t>
+void compute_min_nbrs(raft::handle_t const& handle,
+                      raft::device_span<vertex_t const> sorted_majors,
+                      vertex_t const* edgelist_majors,
+                      vertex_t const* edgelist_minors,
+                      edge_t num_edges,
+                      raft::device_span<vertex_t> min_nbrs /* [OUT] */)
+{
+  thrust::fill(handle.get_thrust_policy(),
+               min_nbrs.begin(),
+               min_nbrs.end(),
+               std::numeric_limits<vertex_t>::max());
+  auto edge_first = thrust::make_zip_iterator(edgelist_majors, edgelist_minors);
+  thrust::for_each(handle.get_thrust_policy(),
+                   edge_first,
+                   edge_first + num_edges,
+                   [sorted_majors, min_nbrs] __device__(auto e) {
+                     auto it = thrust::lower_bound(
+                       thrust::seq, sorted_majors.begin(), sorted_majors.end(), thrust::get<0>(e));
+                     assert((it != sorted_majors.end()) && (*it == thrust::get<0>(e)));
+                     cuda::atomic_ref<vertex_t, cuda::thread_scope_device> min_nbr(
+                       min_nbrs[thrust::distance(sorted_majors.begin(), it)]);
+                     min_nbr.fetch_min(thrust::get<1>(e), cuda::std::memory_order_relaxed);
+                   });
+}
+
 // returns renumber map, segment_offsets, and hypersparse_degree_offsets
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 std::tuple<rmm::device_uvector<vertex_t>,
@@ -247,11 +437,90 @@ compute_renumber_map(raft::handle_t const& handle,
                      std::vector<vertex_t const*> const& edgelist_minors,
                      std::vector<edge_t> const& edgelist_edge_counts)
 {
+  // sort temporary storage and per-partition degree buffers are allocated from the scratch memory
+  // resource (if set)
+  auto scratch_mr = get_scratch_memory_resource(handle);
+  auto hash_based = (get_renumber_method_hint(handle) == renumber_method_t::hash);
+  auto order      = get_renumber_order_hint(handle);
+
   // 1. if local_vertices.has_value() is false, find unique vertices from edge majors & minors (to
   // construct local_vertices)
 
   rmm::device_uvector<vertex_t> sorted_local_vertices(0, handle.get_stream());
-  if (!local_vertices) {
+  std::optional<rmm::device_uvector<edge_t>> hashed_local_vertex_degrees{
+    std::nullopt};  // degrees are counted while finding unique vertices in single-GPU hash-based
+                    // renumbering
+  if (!local_vertices && hash_based && !multi_gpu) {
+    assert(edgelist_majors.size() == 1);
+
+    std::vector<rmm::device_uvector<vertex_t>> bin_vertices{};
+    std::vector<rmm::device_uvector<edge_t>> bin_degrees{};
+    bin_vertices.reserve(num_hash_renumber_bins);
+    bin_degrees.reserve(num_hash_renumber_bins);
+    std::vector<edge_t> h_bin_counts(num_hash_renumber_bins,
+                                     static_cast<edge_t>(edgelist_edge_counts[0]));
+    if (num_hash_renumber_bins > 1) {
+      rmm::device_uvector<edge_t> d_bin_counts(num_hash_renumber_bins, handle.get_stream());
+      thrust::fill(
+        handle.get_thrust_policy(), d_bin_counts.begin(), d_bin_counts.end(), edge_t{0});
+      for (auto edgelist_vertices : {edgelist_majors[0], edgelist_minors[0]}) {
+        thrust::for_each(
+          handle.get_thrust_policy(),
+          edgelist_vertices,
+          edgelist_vertices + edgelist_edge_counts[0],
+          [counts = raft::device_span<edge_t>(d_bin_counts.data(),
+                                              d_bin_counts.size())] __device__(auto v) {
+            cuco::detail::MurmurHash3_32<vertex_t> hash_func{renumber_hash_seed};
+            cuda::atomic_ref<edge_t, cuda::thread_scope_device> atomic_counter(
+              counts[hash_func(v) % num_hash_renumber_bins]);
+            atomic_counter.fetch_add(edge_t{1}, cuda::std::memory_order_relaxed);
+          });
+      }
+      raft::update_host(
+        h_bin_counts.data(), d_bin_counts.data(), d_bin_counts.size(), handle.get_stream());
+      handle.sync_stream();
+    }
+
+    size_t num_vertices{0};
+    for (size_t i = 0; i < num_hash_renumber_bins; ++i) {
+      auto [vertices, degrees] =
+        hash_unique_vertices_and_degrees(handle,
+                                         edgelist_majors[0],
+                                         edgelist_minors[0],
+                                         edgelist_edge_counts[0],
+                                         static_cast<size_t>(h_bin_counts[i]),
+                                         renumber_hash_seed,
+                                         num_hash_renumber_bins,
+                                         i,
+                                         scratch_mr);
+      num_vertices += vertices.size();
+      bin_vertices.push_back(std::move(vertices));
+      bin_degrees.push_back(std::move(degrees));
+    }
+
+    sorted_local_vertices.resize(num_vertices, handle.get_stream());
+    hashed_local_vertex_degrees = rmm::device_uvector<edge_t>(num_vertices, handle.get_stream());
+    size_t output_offset{0};
+    for (size_t i = 0; i < num_hash_renumber_bins; ++i) {
+      thrust::copy(handle.get_thrust_policy(),
+                   bin_vertices[i].begin(),
+                   bin_vertices[i].end(),
+                   sorted_local_vertices.begin() + output_offset);
+      thrust::copy(handle.get_thrust_policy(),
+                   bin_degrees[i].begin(),
+                   bin_degrees[i].end(),
+                   (*hashed_local_vertex_degrees).begin() + output_offset);
+      output_offset += bin_vertices[i].size();
+      bin_vertices[i].resize(0, handle.get_stream());
+      bin_vertices[i].shrink_to_fit(handle.get_stream());
+      bin_degrees[i].resize(0, handle.get_stream());
+      bin_degrees[i].shrink_to_fit(handle.get_stream());
+    }
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                        sorted_local_vertices.begin(),
+                        sorted_local_vertices.end(),
+                        (*hashed_local_vertex_degrees).begin());
+  } else if (!local_vertices) {
     constexpr size_t num_bins{
       8};  // increase the number of bins to cut peak memory usage (at the expense of additional
            // computing), limit the maximum temporary memory usage to "size of local edge list
@@ -344,12 +613,7 @@ compute_renumber_map(raft::handle_t const& handle,
                          edgelist_majors[j] + edgelist_edge_counts[j],
                          tmp_majors.begin());
           }
-          thrust::sort(handle.get_thrust_policy(), tmp_majors.begin(), tmp_majors.end());
-          tmp_majors.resize(
-            thrust::distance(
-              tmp_majors.begin(),
-              thrust::unique(handle.get_thrust_policy(), tmp_majors.begin(), tmp_majors.end())),
-            handle.get_stream());
+          sort_and_unique_vertices(handle, tmp_majors, hash_based, scratch_mr);
           tmp_majors.shrink_to_fit(handle.get_stream());
 
           edge_partition_tmp_majors.push_back(std::move(tmp_majors));
@@ -405,12 +669,7 @@ compute_renumber_map(raft::handle_t const& handle,
                          edgelist_minors[j] + edgelist_edge_counts[j],
                          tmp_minors.begin());
           }
-          thrust::sort(handle.get_thrust_policy(), tmp_minors.begin(), tmp_minors.end());
-          tmp_minors.resize(
-            thrust::distance(
-              tmp_minors.begin(),
-              thrust::unique(handle.get_thrust_policy(), tmp_minors.begin(), tmp_minors.end())),
-            handle.get_stream());
+          sort_and_unique_vertices(handle, tmp_minors, hash_based, scratch_mr);
           tmp_minors.shrink_to_fit(handle.get_stream());
 
           edge_partition_tmp_minors.push_back(std::move(tmp_minors));
@@ -522,8 +781,9 @@ compute_renumber_map(raft::handle_t const& handle,
     }
   } else {
     sorted_local_vertices = std::move(*local_vertices);
-    thrust::sort(
-      handle.get_thrust_policy(), sorted_local_vertices.begin(), sorted_local_vertices.end());
+    thrust::sort(rmm::exec_policy(handle.get_stream(), scratch_mr),
+                 sorted_local_vertices.begin(),
+                 sorted_local_vertices.end());
   }
 
   // 2. find an unused vertex ID
@@ -539,6 +799,8 @@ compute_renumber_map(raft::handle_t const& handle,
   // 3. compute global degrees for the sorted local vertices
 
   rmm::device_uvector<edge_t> sorted_local_vertex_degrees(0, handle.get_stream());
+  std::optional<rmm::device_uvector<vertex_t>> sorted_local_vertex_min_nbrs{
+    std::nullopt};  // valid only if order == renumber_order_t::neighbor
 
   if constexpr (multi_gpu) {
     auto& comm                 = handle.get_comms();
@@ -552,8 +814,8 @@ compute_renumber_map(raft::handle_t const& handle,
       host_scalar_allgather(minor_comm, sorted_local_vertices.size(), handle.get_stream());
 
     for (int i = 0; i < minor_comm_size; ++i) {
-      rmm::device_uvector<vertex_t> sorted_majors(edge_partition_major_range_sizes[i],
-                                                  handle.get_stream());
+      rmm::device_uvector<vertex_t> sorted_majors(
+        edge_partition_major_range_sizes[i], handle.get_stream(), scratch_mr);
       device_bcast(minor_comm,
                    sorted_local_vertices.data(),
                    sorted_majors.data(),
@@ -561,7 +823,8 @@ compute_renumber_map(raft::handle_t const& handle,
                    i,
                    handle.get_stream());
 
-      rmm::device_uvector<edge_t> sorted_major_degrees(sorted_majors.size(), handle.get_stream());
+      rmm::device_uvector<edge_t> sorted_major_degrees(
+        sorted_majors.size(), handle.get_stream(), scratch_mr);
       thrust::fill(handle.get_thrust_policy(),
                    sorted_major_degrees.begin(),
                    sorted_major_degrees.end(),
@@ -591,7 +854,32 @@ compute_renumber_map(raft::handle_t const& handle,
                     i,
                     handle.get_stream());
       if (i == minor_comm_rank) { sorted_local_vertex_degrees = std::move(sorted_major_degrees); }
+
+      if (order == renumber_order_t::neighbor) {
+        rmm::device_uvector<vertex_t> sorted_major_min_nbrs(
+          sorted_majors.size(), handle.get_stream(), scratch_mr);
+        compute_min_nbrs(handle,
+                         raft::device_span<vertex_t const>(sorted_majors.data(),
+                                                           sorted_majors.size()),
+                         edgelist_majors[i],
+                         edgelist_minors[i],
+                         edgelist_edge_counts[i],
+                         raft::device_span<vertex_t>(sorted_major_min_nbrs.data(),
+                                                     sorted_major_min_nbrs.size()));
+        device_reduce(minor_comm,
+                      sorted_major_min_nbrs.begin(),
+                      sorted_major_min_nbrs.begin(),
+                      edge_partition_major_range_sizes[i],
+                      raft::comms::op_t::MIN,
+                      i,
+                      handle.get_stream());
+        if (i == minor_comm_rank) {
+          sorted_local_vertex_min_nbrs = std::move(sorted_major_min_nbrs);
+        }
+      }
     }
+  } else if (hashed_local_vertex_degrees) {
+    sorted_local_vertex_degrees = std::move(*hashed_local_vertex_degrees);
   } else {
     assert(edgelist_majors.size() == 1);
 
@@ -618,13 +906,39 @@ compute_renumber_map(raft::handle_t const& handle,
                      });
   }
 
+  if constexpr (!multi_gpu) {
+    if (order == renumber_order_t::neighbor) {
+      assert(edgelist_majors.size() == 1);
+
+      sorted_local_vertex_min_nbrs =
+        rmm::device_uvector<vertex_t>(sorted_local_vertices.size(), handle.get_stream());
+      compute_min_nbrs(handle,
+                       raft::device_span<vertex_t const>(sorted_local_vertices.data(),
+                                                         sorted_local_vertices.size()),
+                       edgelist_majors[0],
+                       edgelist_minors[0],
+                       edgelist_edge_counts[0],
+                       raft::device_span<vertex_t>((*sorted_local_vertex_min_nbrs).data(),
+                                                   (*sorted_local_vertex_min_nbrs).size()));
+    }
+  }
+
   // 5. sort local vertices by degree (descending)
 
-  thrust::sort_by_key(handle.get_thrust_policy(),
-                      sorted_local_vertex_degrees.begin(),
-                      sorted_local_vertex_degrees.end(),
-                      sorted_local_vertices.begin(),
-                      thrust::greater<edge_t>());
+  if (sorted_local_vertex_min_nbrs) {
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        sorted_local_vertex_degrees.begin(),
+                        sorted_local_vertex_degrees.end(),
+                        thrust::make_zip_iterator(sorted_local_vertices.begin(),
+                                                  (*sorted_local_vertex_min_nbrs).begin()),
+                        thrust::greater<edge_t>());
+  } else {
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        sorted_local_vertex_degrees.begin(),
+                        sorted_local_vertex_degrees.end(),
+                        sorted_local_vertices.begin(),
+                        thrust::greater<edge_t>());
+  }
 
   // 6. compute segment_offsets
 
@@ -637,6 +951,7 @@ compute_renumber_map(raft::handle_t const& handle,
   size_t mid_degree_threshold{detail::mid_degree_threshold};
   size_t low_degree_threshold{detail::low_degree_threshold};
   size_t hypersparse_degree_threshold{1};
+  size_t degree_scale{1};
   if (multi_gpu) {
     auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
     auto const minor_comm_size = minor_comm.get_size();
@@ -644,6 +959,15 @@ compute_renumber_map(raft::handle_t const& handle,
     low_degree_threshold *= minor_comm_size;
     hypersparse_degree_threshold = std::max(
       static_cast<size_t>(minor_comm_size * detail::hypersparse_threshold_ratio), size_t{1});
+    degree_scale = static_cast<size_t>(minor_comm_size);
+  }
+  if (get_degree_segment_policy_hint(handle) == degree_segment_policy_t::adaptive) {
+    low_degree_threshold =
+      detail::compute_adaptive_low_degree_threshold(handle,
+                                                    sorted_local_vertex_degrees.begin(),
+                                                    sorted_local_vertex_degrees.end(),
+                                                    mid_degree_threshold,
+                                                    degree_scale);
   }
 
   std::vector<vertex_t> h_segment_offsets{};
@@ -711,6 +1035,26 @@ compute_renumber_map(raft::handle_t const& handle,
     }
   }
 
+  // 7. reorder vertices within the high, mid, and low degree segments for locality (vertices in
+  // the hypersparse segment should stay grouped by degree and 0-degree vertices have no edges)
+
+  if (order != renumber_order_t::degree) {
+    for (size_t i = 0; i < detail::num_sparse_segments_per_vertex_partition; ++i) {
+      if (order == renumber_order_t::input) {
+        thrust::sort(handle.get_thrust_policy(),
+                     sorted_local_vertices.begin() + h_segment_offsets[i],
+                     sorted_local_vertices.begin() + h_segment_offsets[i + 1]);
+      } else {
+        assert(order == renumber_order_t::neighbor);
+        auto pair_first = thrust::make_zip_iterator((*sorted_local_vertex_min_nbrs).begin(),
+                                                    sorted_local_vertices.begin());
+        thrust::sort(handle.get_thrust_policy(),
+                     pair_first + h_segment_offsets[i],
+                     pair_first + h_segment_offsets[i + 1]);
+      }
+    }
+  }
+
   return std::make_tuple(std::move(sorted_local_vertices),
                          h_segment_offsets,
                          h_hypersparse_degree_offsets,
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/graph_functions.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace cugraph {
+
+namespace {
+
+// renumbering method hints per handle (process-wide)
+std::mutex renumber_method_hint_mutex{};
+std::map<raft::handle_t const*, renumber_method_t> renumber_method_hints{};
+
+// renumbering vertex order hints per handle (process-wide)
+std::mutex renumber_order_hint_mutex{};
+std::map<raft::handle_t const*, renumber_order_t> renumber_order_hints{};
+
+// degree segment policy hints per handle (process-wide)
+std::mutex degree_segment_policy_hint_mutex{};
+std::map<raft::handle_t const*, degree_segment_policy_t> degree_segment_policy_hints{};
+
+}  // namespace
+
+void set_renumber_method_hint(raft::handle_t const& handle, renumber_method_t method)
+{
+  std::lock_guard<std::mutex> lock(renumber_method_hint_mutex);
+  if (method == renumber_method_t::sort) {
+    renumber_method_hints.erase(&handle);
+  } else {
+    renumber_method_hints.insert_or_assign(&handle, method);
+  }
+}
+
+renumber_method_t get_renumber_method_hint(raft::handle_t const& handle)
+{
+  std::lock_guard<std::mutex> lock(renumber_method_hint_mutex);
+  auto it = renumber_method_hints.find(&handle);
+  return it != renumber_method_hints.end() ? it->second : renumber_method_t::sort;
+}
+
+void set_renumber_order_hint(raft::handle_t const& handle, renumber_order_t order)
+{
+  std::lock_guard<std::mutex> lock(renumber_order_hint_mutex);
+  if (order == renumber_order_t::degree) {
+    renumber_order_hints.erase(&handle);
+  } else {
+    renumber_order_hints.insert_or_assign(&handle, order);
+  }
+}
+
+renumber_order_t get_renumber_order_hint(raft::handle_t const& handle)
+{
+  std::lock_guard<std::mutex> lock(renumber_order_hint_mutex);
+  auto it = renumber_order_hints.find(&handle);
+  return it != renumber_order_hints.end() ? it->second : renumber_order_t::degree;
+}
+
+void set_degree_segment_policy_hint(raft::handle_t const& handle, degree_segment_policy_t policy)
+{
+  std::lock_guard<std::mutex> lock(degree_segment_policy_hint_mutex);
+  if (policy == degree_segment_policy_t::fixed) {
+    degree_segment_policy_hints.erase(&handle);
+  } else {
+    degree_segment_policy_hints.insert_or_assign(&handle, policy);
+  }
+}
+
+degree_segment_policy_t get_degree_segment_policy_hint(raft::handle_t const& handle)
+{
+  std::lock_guard<std::mutex> lock(degree_segment_policy_hint_mutex);
+  auto it = degree_segment_policy_hints.find(&handle);
+  return it != degree_segment_policy_hints.end() ? it->second : degree_segment_policy_t::fixed;
+}
+
+}  // namespace cugraph
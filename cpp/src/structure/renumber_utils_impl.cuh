@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,9 +16,11 @@
 #pragma once
 
 #include "detail/graph_partition_utils.cuh"
+#include "prims/key_store.cuh"
 #include "prims/kv_store.cuh"
 #include "utilities/collect_comm.cuh"
 
+#include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/device_functors.cuh>
@@ -26,9 +28,13 @@
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
+#include <raft/core/device_span.hpp>
+#include <raft/core/host_span.hpp>
+
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
 
+#include <cuda/functional>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
@@ -37,11 +43,15 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/remove.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
+#include <limits>
+
 namespace cugraph {
 
 namespace detail {
@@ -575,6 +585,31 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
     auto local_int_vertex_first = vertex_partition_id == 0
                                     ? vertex_t{0}
                                     : vertex_partition_range_lasts[vertex_partition_id - 1];
+    auto local_int_vertex_last = vertex_partition_range_lasts[vertex_partition_id];
+
+    // if every GPU holds only local vertices (e.g. when unrenumbering per-vertex algorithm
+    // outputs), a direct gather from the local renumber map suffices and we can skip collecting
+    // external vertices from the owning GPUs
+
+    auto all_local = thrust::all_of(
+      handle.get_thrust_policy(),
+      vertices,
+      vertices + num_vertices,
+      [local_int_vertex_first, local_int_vertex_last] __device__(auto v) {
+        return v == invalid_vertex_id<vertex_t>::value ||
+               ((v >= local_int_vertex_first) && (v < local_int_vertex_last));
+      });
+    if (host_scalar_allreduce(
+          comm, static_cast<int>(all_local), raft::comms::op_t::MIN, handle.get_stream()) == 1) {
+      unrenumber_local_int_vertices(handle,
+                                    vertices,
+                                    num_vertices,
+                                    renumber_map_labels,
+                                    local_int_vertex_first,
+                                    local_int_vertex_last,
+                                    false);
+      return;
+    }
 
     rmm::device_uvector<vertex_t> sorted_unique_int_vertices(num_vertices, handle.get_stream());
     sorted_unique_int_vertices.resize(
@@ -586,9 +621,13 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
                         sorted_unique_int_vertices.begin(),
                         [] __device__(auto v) { return v != invalid_vertex_id<vertex_t>::value; })),
       handle.get_stream());
-    thrust::sort(handle.get_thrust_policy(),
-                 sorted_unique_int_vertices.begin(),
-                 sorted_unique_int_vertices.end());
+    if (!thrust::is_sorted(handle.get_thrust_policy(),
+                           sorted_unique_int_vertices.begin(),
+                           sorted_unique_int_vertices.end())) {
+      thrust::sort(handle.get_thrust_policy(),
+                   sorted_unique_int_vertices.begin(),
+                   sorted_unique_int_vertices.end());
+    }
     sorted_unique_int_vertices.resize(
       thrust::distance(sorted_unique_int_vertices.begin(),
                        thrust::unique(handle.get_thrust_policy(),
@@ -626,6 +665,67 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
   }
 }
 
+template <typename vertex_t>
+size_t unrenumber_local_int_vertices_to_host(
+  raft::handle_t const& handle,
+  raft::device_span<vertex_t const> vertices,
+  vertex_t const* renumber_map_labels /* size = local_int_vertex_last - local_int_vertex_first */,
+  vertex_t local_int_vertex_first,
+  vertex_t local_int_vertex_last,
+  raft::host_span<vertex_t> ext_vertices /* [OUT] */,
+  bool do_expensive_check)
+{
+  cudaPointerAttributes attributes{};
+  RAFT_CUDA_TRY(cudaPointerGetAttributes(&attributes, ext_vertices.data()));
+  CUGRAPH_EXPECTS(
+    (ext_vertices.size() == 0) || (attributes.type == cudaMemoryTypeHost),
+    "Invalid input arguments: ext_vertices should point to page-locked (pinned) host memory.");
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       vertices.begin(),
+                       vertices.end(),
+                       [local_int_vertex_first, local_int_vertex_last] __device__(auto v) {
+                         return v != invalid_vertex_id<vertex_t>::value &&
+                                (v < local_int_vertex_first || v >= local_int_vertex_last);
+                       }) == 0,
+      "Invalid input arguments: there are non-local vertices in vertices.");
+  }
+
+  auto num_valid_vertices = static_cast<size_t>(
+    thrust::count_if(handle.get_thrust_policy(),
+                     vertices.begin(),
+                     vertices.end(),
+                     detail::is_not_equal_t<vertex_t>{invalid_vertex_id<vertex_t>::value}));
+  CUGRAPH_EXPECTS(ext_vertices.size() >= num_valid_vertices,
+                  "Invalid input arguments: ext_vertices.size() is smaller than the number of "
+                  "valid vertices.");
+
+  // gather, compact, and write directly to the (device accessible) pinned host buffer in a single
+  // pass, this avoids materializing the unrenumbered vertices in device memory
+
+  if (num_valid_vertices > 0) {
+    auto ext_vertex_first = thrust::make_transform_iterator(
+      vertices.begin(),
+      cuda::proclaim_return_type<vertex_t>(
+        [renumber_map_labels, local_int_vertex_first] __device__(auto v) {
+          return v == invalid_vertex_id<vertex_t>::value
+                   ? v
+                   : renumber_map_labels[v - local_int_vertex_first];
+        }));
+    thrust::copy_if(handle.get_thrust_policy(),
+                    ext_vertex_first,
+                    ext_vertex_first + vertices.size(),
+                    vertices.begin(),
+                    static_cast<vertex_t*>(attributes.devicePointer),
+                    detail::is_not_equal_t<vertex_t>{invalid_vertex_id<vertex_t>::value});
+  }
+  handle.sync_stream();
+
+  return num_valid_vertices;
+}
+
 template <typename vertex_t, bool store_transposed, bool multi_gpu>
 std::enable_if_t<multi_gpu, void> unrenumber_local_int_edges(
   raft::handle_t const& handle,
@@ -672,4 +772,86 @@ std::enable_if_t<!multi_gpu, void> unrenumber_local_int_edges(raft::handle_t con
                                 do_expensive_check);
 }
 
+template <typename vertex_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extend_renumber_map(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& renumber_map_labels,
+  raft::device_span<vertex_t const> new_ext_vertices,
+  bool do_expensive_check)
+{
+  auto labels = std::move(renumber_map_labels);
+
+  if (do_expensive_check) {
+    rmm::device_uvector<vertex_t> sorted_labels(labels.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), sorted_labels.begin());
+    thrust::sort(handle.get_thrust_policy(), sorted_labels.begin(), sorted_labels.end());
+    CUGRAPH_EXPECTS(thrust::unique(handle.get_thrust_policy(),
+                                   sorted_labels.begin(),
+                                   sorted_labels.end()) == sorted_labels.end(),
+                    "Invalid input arguments: renumber_map_labels have duplicate elements.");
+    CUGRAPH_EXPECTS(
+      thrust::count(handle.get_thrust_policy(),
+                    new_ext_vertices.begin(),
+                    new_ext_vertices.end(),
+                    invalid_vertex_id<vertex_t>::value) == 0,
+      "Invalid input arguments: new_ext_vertices should not include invalid vertex IDs.");
+  }
+
+  // 1. collect the new vertices assigned to this GPU
+
+  rmm::device_uvector<vertex_t> new_vertices(new_ext_vertices.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               new_ext_vertices.begin(),
+               new_ext_vertices.end(),
+               new_vertices.begin());
+  thrust::sort(handle.get_thrust_policy(), new_vertices.begin(), new_vertices.end());
+  new_vertices.resize(
+    thrust::distance(
+      new_vertices.begin(),
+      thrust::unique(handle.get_thrust_policy(), new_vertices.begin(), new_vertices.end())),
+    handle.get_stream());
+
+  if constexpr (multi_gpu) {
+    new_vertices = detail::shuffle_ext_vertices_to_local_gpu_by_vertex_partitioning(
+      handle, std::move(new_vertices));
+    thrust::sort(handle.get_thrust_policy(), new_vertices.begin(), new_vertices.end());
+    new_vertices.resize(
+      thrust::distance(
+        new_vertices.begin(),
+        thrust::unique(handle.get_thrust_policy(), new_vertices.begin(), new_vertices.end())),
+      handle.get_stream());
+  }
+
+  // 2. remove the vertices already in the renumber map (hash lookup) and append the remaining
+
+  {
+    key_store_t<vertex_t, false> existing_vertices(
+      labels.begin(), labels.end(), invalid_vertex_id<vertex_t>::value, handle.get_stream());
+    rmm::device_uvector<bool> existing_flags(new_vertices.size(), handle.get_stream());
+    existing_vertices.view().contains(
+      new_vertices.begin(), new_vertices.end(), existing_flags.begin(), handle.get_stream());
+    new_vertices.resize(thrust::distance(new_vertices.begin(),
+                                         thrust::remove_if(handle.get_thrust_policy(),
+                                                           new_vertices.begin(),
+                                                           new_vertices.end(),
+                                                           existing_flags.begin(),
+                                                           thrust::identity<bool>{})),
+                        handle.get_stream());
+  }
+
+  auto num_appended = static_cast<vertex_t>(new_vertices.size());
+  CUGRAPH_EXPECTS(
+    labels.size() + new_vertices.size() <=
+      static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input arguments: the extended renumber map overflows vertex_t, use 64 bit vertex_t.");
+  auto old_size = labels.size();
+  labels.resize(old_size + new_vertices.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               new_vertices.begin(),
+               new_vertices.end(),
+               labels.begin() + old_size);
+
+  return std::make_tuple(std::move(labels), num_appended);
+}
+
 }  // namespace cugraph
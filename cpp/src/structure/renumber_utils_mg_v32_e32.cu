@@ -64,4 +64,10 @@ template void unrenumber_local_int_edges<int32_t, true, true>(
   std::optional<std::vector<std::vector<size_t>>> const& edgelist_intra_partition_segment_offsets,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int32_t>, int32_t> extend_renumber_map<int32_t, true>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int32_t>&& renumber_map_labels,
+  raft::device_span<int32_t const> new_ext_vertices,
+  bool do_expensive_check);
+
 }  // namespace cugraph
@@ -64,4 +64,10 @@ template void unrenumber_local_int_edges<int64_t, true, true>(
   std::optional<std::vector<std::vector<size_t>>> const& edgelist_intra_partition_segment_offsets,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int64_t>, int64_t> extend_renumber_map<int64_t, true>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int64_t>&& renumber_map_labels,
+  raft::device_span<int64_t const> new_ext_vertices,
+  bool do_expensive_check);
+
 }  // namespace cugraph
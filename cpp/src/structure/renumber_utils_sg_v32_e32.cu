@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,6 +44,15 @@ template void unrenumber_local_int_vertices<int32_t>(raft::handle_t const& handl
                                                      int32_t local_int_vertex_last,
                                                      bool do_expensive_check);
 
+template size_t unrenumber_local_int_vertices_to_host<int32_t>(
+  raft::handle_t const& handle,
+  raft::device_span<int32_t const> vertices,
+  int32_t const* renumber_map_labels,
+  int32_t local_int_vertex_first,
+  int32_t local_int_vertex_last,
+  raft::host_span<int32_t> ext_vertices,
+  bool do_expensive_check);
+
 template void unrenumber_int_vertices<int32_t, false>(
   raft::handle_t const& handle,
   int32_t* vertices,
@@ -69,4 +78,10 @@ template void unrenumber_local_int_edges<int32_t, true, false>(raft::handle_t co
                                                                int32_t num_vertices,
                                                                bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int32_t>, int32_t> extend_renumber_map<int32_t, false>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int32_t>&& renumber_map_labels,
+  raft::device_span<int32_t const> new_ext_vertices,
+  bool do_expensive_check);
+
 }  // namespace cugraph
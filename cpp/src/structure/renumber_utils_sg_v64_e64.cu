@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,6 +44,15 @@ template void unrenumber_local_int_vertices<int64_t>(raft::handle_t const& handl
                                                      int64_t local_int_vertex_last,
                                                      bool do_expensive_check);
 
+template size_t unrenumber_local_int_vertices_to_host<int64_t>(
+  raft::handle_t const& handle,
+  raft::device_span<int64_t const> vertices,
+  int64_t const* renumber_map_labels,
+  int64_t local_int_vertex_first,
+  int64_t local_int_vertex_last,
+  raft::host_span<int64_t> ext_vertices,
+  bool do_expensive_check);
+
 template void unrenumber_int_vertices<int64_t, false>(
   raft::handle_t const& handle,
   int64_t* vertices,
@@ -69,4 +78,10 @@ template void unrenumber_local_int_edges<int64_t, true, false>(raft::handle_t co
                                                                int64_t num_vertices,
                                                                bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int64_t>, int64_t> extend_renumber_map<int64_t, false>(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int64_t>&& renumber_map_labels,
+  raft::device_span<int64_t const> new_ext_vertices,
+  bool do_expensive_check);
+
 }  // namespace cugraph
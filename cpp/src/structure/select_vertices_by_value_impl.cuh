@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/select_if_v.cuh"
+#include "prims/select_top_k_v.cuh"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t, typename value_t>
+struct threshold_v_op_t {
+  value_t threshold{};
+  bool greater{};
+
+  __device__ bool operator()(vertex_t, value_t val) const
+  {
+    return greater ? (val >= threshold) : (val <= threshold);
+  }
+};
+
+template <typename vertex_t>
+void unrenumber_selected_local_vertices(raft::handle_t const& handle,
+                                        rmm::device_uvector<vertex_t>& vertices,
+                                        raft::device_span<vertex_t const> renumber_map,
+                                        vertex_t local_vertex_partition_range_first)
+{
+  thrust::transform(handle.get_thrust_policy(),
+                    vertices.begin(),
+                    vertices.end(),
+                    vertices.begin(),
+                    cuda::proclaim_return_type<vertex_t>(
+                      [renumber_map, local_vertex_partition_range_first] __device__(auto v) {
+                        return renumber_map[v - local_vertex_partition_range_first];
+                      }));
+}
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<value_t>> select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  raft::device_span<value_t const> vertex_values,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    vertex_values.size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input arguments: vertex_values.size() should coincide with the local vertex "
+    "partition range size.");
+  if (renumber_map) {
+    CUGRAPH_EXPECTS(
+      (*renumber_map).size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+      "Invalid input arguments: (*renumber_map).size() should coincide with the local vertex "
+      "partition range size.");
+  }
+
+  rmm::device_uvector<vertex_t> vertices(0, handle.get_stream());
+  rmm::device_uvector<value_t> values(0, handle.get_stream());
+  if (largest) {
+    std::tie(vertices, values) = select_top_k_v(
+      handle, graph_view, vertex_values.begin(), k, thrust::greater<value_t>{}, do_expensive_check);
+  } else {
+    std::tie(vertices, values) = select_top_k_v(
+      handle, graph_view, vertex_values.begin(), k, thrust::less<value_t>{}, do_expensive_check);
+  }
+
+  // vertices are unrenumbered in their owning GPUs before being replicated
+
+  if (renumber_map) {
+    detail::unrenumber_selected_local_vertices(
+      handle, vertices, *renumber_map, graph_view.local_vertex_partition_range_first());
+  }
+
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto rx_sizes = host_scalar_allgather(comm, vertices.size(), handle.get_stream());
+    std::vector<size_t> rx_displs(rx_sizes.size(), size_t{0});
+    std::exclusive_scan(rx_sizes.begin(), rx_sizes.end(), rx_displs.begin(), size_t{0});
+
+    rmm::device_uvector<vertex_t> rx_vertices(rx_displs.back() + rx_sizes.back(),
+                                              handle.get_stream());
+    rmm::device_uvector<value_t> rx_values(rx_vertices.size(), handle.get_stream());
+    device_allgatherv(comm,
+                      thrust::make_zip_iterator(vertices.begin(), values.begin()),
+                      thrust::make_zip_iterator(rx_vertices.begin(), rx_values.begin()),
+                      rx_sizes,
+                      rx_displs,
+                      handle.get_stream());
+
+    // restore the selection order (by value and internal vertex ID), internal vertex IDs increase
+    // with the GPU rank, so the (stable) rank order breaks ties after the value based sort
+
+    if (largest) {
+      thrust::stable_sort_by_key(handle.get_thrust_policy(),
+                                 rx_values.begin(),
+                                 rx_values.end(),
+                                 rx_vertices.begin(),
+                                 thrust::greater<value_t>{});
+    } else {
+      thrust::stable_sort_by_key(
+        handle.get_thrust_policy(), rx_values.begin(), rx_values.end(), rx_vertices.begin());
+    }
+
+    vertices = std::move(rx_vertices);
+    values   = std::move(rx_values);
+  }
+
+  return std::make_tuple(std::move(vertices), std::move(values));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename value_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<value_t>>
+select_vertices_by_threshold(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  raft::device_span<value_t const> vertex_values,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  value_t threshold,
+  bool greater,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    vertex_values.size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input arguments: vertex_values.size() should coincide with the local vertex "
+    "partition range size.");
+  if (renumber_map) {
+    CUGRAPH_EXPECTS(
+      (*renumber_map).size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+      "Invalid input arguments: (*renumber_map).size() should coincide with the local vertex "
+      "partition range size.");
+  }
+
+  auto [vertices, values] =
+    select_if_v(handle,
+                graph_view,
+                vertex_values.begin(),
+                detail::threshold_v_op_t<vertex_t, value_t>{threshold, greater},
+                do_expensive_check);
+
+  if (renumber_map) {
+    detail::unrenumber_selected_local_vertices(
+      handle, vertices, *renumber_map, graph_view.local_vertex_partition_range_first());
+  }
+
+  return std::make_tuple(std::move(vertices), std::move(values));
+}
+
+}  // namespace cugraph
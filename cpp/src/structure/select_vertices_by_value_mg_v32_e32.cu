@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "structure/select_vertices_by_value_impl.cuh"
+
+namespace cugraph {
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>> select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  raft::device_span<float const> vertex_values,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>>
+select_vertices_by_threshold(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+                             raft::device_span<float const> vertex_values,
+                             std::optional<raft::device_span<int32_t const>> renumber_map,
+                             float threshold,
+                             bool greater,
+                             bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>> select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  raft::device_span<float const> vertex_values,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>>
+select_vertices_by_threshold(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+                             raft::device_span<float const> vertex_values,
+                             std::optional<raft::device_span<int32_t const>> renumber_map,
+                             float threshold,
+                             bool greater,
+                             bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  raft::device_span<double const> vertex_values,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+select_vertices_by_threshold(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+                             raft::device_span<double const> vertex_values,
+                             std::optional<raft::device_span<int32_t const>> renumber_map,
+                             double threshold,
+                             bool greater,
+                             bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+select_top_k_vertices(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  raft::device_span<double const> vertex_values,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  size_t k,
+  bool largest,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+select_vertices_by_threshold(raft::handle_t const& handle,
+                             graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+                             raft::device_span<double const> vertex_values,
+                             std::optional<raft::device_span<int32_t const>> renumber_map,
+                             double threshold,
+                             bool greater,
+                             bool do_expensive_check);
+
+}  // namespace cugraph
@@ -25,6 +25,7 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/sequence.h>
 
 #include <algorithm>
@@ -230,6 +231,112 @@ transpose_graph_storage_impl(
                          std::move(new_renumber_map));
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+transpose_graph_storage_copy_impl(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(!multi_gpu || renumber_map.has_value(),
+                  "Invalid input arguments: renumber_map.has_value() should be true if multi-GPU.");
+  CUGRAPH_EXPECTS(
+    !renumber_map.has_value() ||
+      (*renumber_map).size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input arguments: if renumber_map.has_value() == true, (*renumber_map).size() should "
+    "match with the local vertex partition range size.");
+
+  if (do_expensive_check) { /* currently, nothing to do */
+  }
+
+  bool renumber = renumber_map.has_value();
+
+  rmm::device_uvector<vertex_t> edgelist_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> edgelist_dsts(0, handle.get_stream());
+  std::optional<rmm::device_uvector<weight_t>> edgelist_weights{std::nullopt};
+
+  std::tie(edgelist_srcs, edgelist_dsts, edgelist_weights, std::ignore, std::ignore) =
+    decompress_to_edgelist(
+      handle,
+      graph_view,
+      edge_weight_view,
+      std::optional<edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+      std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+      renumber_map);
+
+  if constexpr (multi_gpu) {
+    std::tie(!store_transposed ? edgelist_dsts : edgelist_srcs,
+             !store_transposed ? edgelist_srcs : edgelist_dsts,
+             edgelist_weights,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore,
+             std::ignore) =
+      detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning<vertex_t,
+                                                                                     edge_t,
+                                                                                     weight_t,
+                                                                                     int32_t,
+                                                                                     int32_t>(
+        handle,
+        std::move(!store_transposed ? edgelist_dsts : edgelist_srcs),
+        std::move(!store_transposed ? edgelist_srcs : edgelist_dsts),
+        std::move(edgelist_weights),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
+  }
+
+  // the input renumber map is kept, so the vertex list is a copy
+  auto vertices = std::make_optional<rmm::device_uvector<vertex_t>>(
+    graph_view.local_vertex_partition_range_size(), handle.get_stream());
+  if (renumber) {
+    thrust::copy(handle.get_thrust_policy(),
+                 (*renumber_map).begin(),
+                 (*renumber_map).end(),
+                 (*vertices).begin());
+  } else {
+    thrust::sequence(
+      handle.get_thrust_policy(), (*vertices).begin(), (*vertices).end(), vertex_t{0});
+  }
+
+  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu> storage_transposed_graph(handle);
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>
+    storage_transposed_edge_weights{};
+  std::optional<rmm::device_uvector<vertex_t>> new_renumber_map{std::nullopt};
+  std::tie(storage_transposed_graph,
+           storage_transposed_edge_weights,
+           std::ignore,
+           std::ignore,
+           new_renumber_map) =
+    create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, !store_transposed, multi_gpu>(
+      handle,
+      std::move(vertices),
+      std::move(edgelist_srcs),
+      std::move(edgelist_dsts),
+      std::move(edgelist_weights),
+      std::nullopt,
+      std::nullopt,
+      graph_properties_t{graph_view.is_symmetric(), graph_view.is_multigraph()},
+      renumber);
+
+  return std::make_tuple(std::move(storage_transposed_graph),
+                         std::move(storage_transposed_edge_weights),
+                         std::move(new_renumber_map));
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -255,4 +362,25 @@ transpose_graph_storage(
     handle, std::move(graph), std::move(edge_weights), std::move(renumber_map), do_expensive_check);
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, !store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, !store_transposed, multi_gpu>, weight_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  bool do_expensive_check)
+{
+  return transpose_graph_storage_copy_impl<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle, graph_view, edge_weight_view, renumber_map, do_expensive_check);
+}
+
 }  // namespace cugraph
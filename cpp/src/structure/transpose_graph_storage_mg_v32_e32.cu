@@ -64,4 +64,48 @@ transpose_graph_storage(
   std::optional<rmm::device_uvector<int32_t>>&& renumber_map,
   bool do_expensive_check);
 
+template std::tuple<
+  graph_t<int32_t, int32_t, false, true>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, true>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, true>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, true>, float>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, float const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, false, true>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, false, true>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, true, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  bool do_expensive_check);
+
+template std::tuple<
+  graph_t<int32_t, int32_t, true, true>,
+  std::optional<edge_property_t<graph_view_t<int32_t, int32_t, true, true>, double>>,
+  std::optional<rmm::device_uvector<int32_t>>>
+transpose_graph_storage(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, true> const& graph_view,
+  std::optional<edge_property_view_t<int32_t, double const*>> edge_weight_view,
+  std::optional<raft::device_span<int32_t const>> renumber_map,
+  bool do_expensive_check);
+
 }  // namespace cugraph
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "detail/graph_partition_utils.cuh"
+#include "prims/kv_store.cuh"
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/iterator>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <limits>
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t>
+struct is_hashed_to_comm_rank_t {
+  compute_gpu_id_from_ext_vertex_t<vertex_t> key_func{};
+  int comm_rank{};
+
+  __device__ bool operator()(vertex_t v) const { return key_func(v) == comm_rank; }
+};
+
+template <typename vertex_t>
+struct proxy_to_ext_vertex_t {
+  raft::device_span<vertex_t const> sorted_proxies{};
+  vertex_t const* ext_vertices{nullptr};
+
+  __device__ vertex_t operator()(vertex_t proxy) const
+  {
+    auto it = thrust::lower_bound(thrust::seq, sorted_proxies.begin(), sorted_proxies.end(), proxy);
+    return ext_vertices[cuda::std::distance(sorted_proxies.begin(), it)];
+  }
+};
+
+// Find the num_proxies smallest non-negative vertex IDs hashed to this GPU. Proxy IDs generated in
+// different GPUs never collide, and the returned IDs are sorted.
+template <typename vertex_t>
+rmm::device_uvector<vertex_t> generate_local_proxy_vertices(raft::handle_t const& handle,
+                                                            size_t num_proxies)
+{
+  auto& comm                 = handle.get_comms();
+  auto const comm_size       = comm.get_size();
+  auto const comm_rank       = comm.get_rank();
+  auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+  auto const major_comm_size = major_comm.get_size();
+  auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+  auto const minor_comm_size = minor_comm.get_size();
+
+  is_hashed_to_comm_rank_t<vertex_t> pred{
+    compute_gpu_id_from_ext_vertex_t<vertex_t>{comm_size, major_comm_size, minor_comm_size},
+    comm_rank};
+
+  // std::numeric_limits<vertex_t>::max() is reserved for invalid_vertex_id
+  auto const max_range_size = static_cast<size_t>(std::numeric_limits<vertex_t>::max());
+  auto range_size =
+    std::min(std::max(num_proxies * static_cast<size_t>(comm_size) +
+                        (num_proxies * static_cast<size_t>(comm_size)) / 4,
+                      size_t{1024}),
+             max_range_size);
+  size_t num_candidates{0};
+  while (true) {
+    num_candidates = static_cast<size_t>(
+      thrust::count_if(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(vertex_t{0}),
+                       thrust::make_counting_iterator(static_cast<vertex_t>(range_size)),
+                       pred));
+    if (num_candidates >= num_proxies) { break; }
+    CUGRAPH_EXPECTS(range_size < max_range_size,
+                    "Invalid input argument: the number of vertices assigned to a GPU is too large "
+                    "to generate proxy vertex IDs in vertex_t, use a wider vertex_t.");
+    range_size = (range_size > max_range_size / 2) ? max_range_size : range_size * 2;
+  }
+
+  rmm::device_uvector<vertex_t> proxies(num_candidates, handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  thrust::make_counting_iterator(vertex_t{0}),
+                  thrust::make_counting_iterator(static_cast<vertex_t>(range_size)),
+                  proxies.begin(),
+                  pred);
+  proxies.resize(num_proxies, handle.get_stream());
+  proxies.shrink_to_fit(handle.get_stream());
+
+  return proxies;
+}
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<
+  graph_t<vertex_t, edge_t, store_transposed, multi_gpu>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, weight_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_t>>,
+  std::optional<
+    edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, edge_type_t>>,
+  std::optional<rmm::device_uvector<vertex_t>>>
+create_graph_from_edgelist(
+  raft::handle_t const& handle,
+  std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>>&& vertex_gpu_assignment,
+  rmm::device_uvector<vertex_t>&& edgelist_srcs,
+  rmm::device_uvector<vertex_t>&& edgelist_dsts,
+  std::optional<rmm::device_uvector<weight_t>>&& edgelist_weights,
+  std::optional<rmm::device_uvector<edge_t>>&& edgelist_edge_ids,
+  std::optional<rmm::device_uvector<edge_type_t>>&& edgelist_edge_types,
+  graph_properties_t graph_properties,
+  bool do_expensive_check)
+{
+  static_assert(multi_gpu,
+                "create_graph_from_edgelist with a vertex to GPU assignment is multi-GPU only.");
+
+  auto& comm                 = handle.get_comms();
+  auto const comm_size       = comm.get_size();
+  auto& major_comm           = handle.get_subcomm(cugraph::partition_manager::major_comm_name());
+  auto const major_comm_size = major_comm.get_size();
+  auto& minor_comm           = handle.get_subcomm(cugraph::partition_manager::minor_comm_name());
+  auto const minor_comm_size = minor_comm.get_size();
+
+  auto vertices = std::move(std::get<0>(vertex_gpu_assignment));
+  auto ranks    = std::move(std::get<1>(vertex_gpu_assignment));
+
+  CUGRAPH_EXPECTS(vertices.size() == ranks.size(),
+                  "Invalid input argument: vertex_gpu_assignment vertices and ranks should have "
+                  "the same size.");
+  CUGRAPH_EXPECTS(edgelist_srcs.size() == edgelist_dsts.size(),
+                  "Invalid input argument: edgelist_srcs.size() != edgelist_dsts.size().");
+
+  if (do_expensive_check) {
+    auto num_invalid_ranks = thrust::count_if(
+      handle.get_thrust_policy(), ranks.begin(), ranks.end(), [comm_size] __device__(int r) {
+        return (r < 0) || (r >= comm_size);
+      });
+    num_invalid_ranks =
+      host_scalar_allreduce(comm, num_invalid_ranks, raft::comms::op_t::SUM, handle.get_stream());
+    CUGRAPH_EXPECTS(num_invalid_ranks == 0,
+                    "Invalid input argument: vertex_gpu_assignment has out-of-range GPU ranks.");
+
+    rmm::device_uvector<vertex_t> tmp_vertices(vertices.size(), handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), vertices.begin(), vertices.end(), tmp_vertices.begin());
+    std::tie(tmp_vertices, std::ignore) = groupby_gpu_id_and_shuffle_values(
+      comm,
+      tmp_vertices.begin(),
+      tmp_vertices.end(),
+      detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+        comm_size, major_comm_size, minor_comm_size},
+      handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), tmp_vertices.begin(), tmp_vertices.end());
+    auto num_duplicates = static_cast<size_t>(cuda::std::distance(
+      thrust::unique(handle.get_thrust_policy(), tmp_vertices.begin(), tmp_vertices.end()),
+      tmp_vertices.end()));
+    num_duplicates =
+      host_scalar_allreduce(comm, num_duplicates, raft::comms::op_t::SUM, handle.get_stream());
+    CUGRAPH_EXPECTS(num_duplicates == 0,
+                    "Invalid input argument: vertex_gpu_assignment has duplicate vertices.");
+  }
+
+  // 1. move every vertex to its assigned GPU and pair it with a proxy vertex ID hashed to the GPU
+
+  {
+    auto pair_first = thrust::make_zip_iterator(vertices.begin(), ranks.begin());
+    auto [rx_pairs, rx_counts] = groupby_gpu_id_and_shuffle_values(
+      comm,
+      pair_first,
+      pair_first + vertices.size(),
+      [] __device__(auto pair) { return thrust::get<1>(pair); },
+      handle.get_stream());
+    vertices = std::move(std::get<0>(rx_pairs));
+  }
+  ranks.resize(0, handle.get_stream());
+  ranks.shrink_to_fit(handle.get_stream());
+
+  auto proxies = detail::generate_local_proxy_vertices<vertex_t>(handle, vertices.size());
+
+  // 2. relabel edge end points with the proxy vertex IDs (the external vertex ID to proxy vertex ID
+  // map is distributed by hashing the external vertex IDs)
+
+  {
+    rmm::device_uvector<vertex_t> keys(vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> values(proxies.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), vertices.begin(), vertices.end(), keys.begin());
+    thrust::copy(handle.get_thrust_policy(), proxies.begin(), proxies.end(), values.begin());
+    std::tie(keys, values, std::ignore) = groupby_gpu_id_and_shuffle_kv_pairs(
+      comm,
+      keys.begin(),
+      keys.end(),
+      values.begin(),
+      detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+        comm_size, major_comm_size, minor_comm_size},
+      handle.get_stream());
+
+    kv_store_t<vertex_t, vertex_t, true> ext_to_proxy_map(std::move(keys),
+                                                          std::move(values),
+                                                          invalid_vertex_id<vertex_t>::value,
+                                                          false,
+                                                          handle.get_stream());
+    auto key_to_comm_rank_op = detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+      comm_size, major_comm_size, minor_comm_size};
+    edgelist_srcs = collect_values_for_keys(comm,
+                                            ext_to_proxy_map.view(),
+                                            edgelist_srcs.begin(),
+                                            edgelist_srcs.end(),
+                                            key_to_comm_rank_op,
+                                            handle.get_stream());
+    edgelist_dsts = collect_values_for_keys(comm,
+                                            ext_to_proxy_map.view(),
+                                            edgelist_dsts.begin(),
+                                            edgelist_dsts.end(),
+                                            key_to_comm_rank_op,
+                                            handle.get_stream());
+  }
+
+  {
+    auto is_invalid = [] __device__(vertex_t v) { return v == invalid_vertex_id<vertex_t>::value; };
+    auto num_unassigned =
+      static_cast<size_t>(
+        thrust::count_if(
+          handle.get_thrust_policy(), edgelist_srcs.begin(), edgelist_srcs.end(), is_invalid)) +
+      static_cast<size_t>(thrust::count_if(
+        handle.get_thrust_policy(), edgelist_dsts.begin(), edgelist_dsts.end(), is_invalid));
+    num_unassigned =
+      host_scalar_allreduce(comm, num_unassigned, raft::comms::op_t::SUM, handle.get_stream());
+    CUGRAPH_EXPECTS(num_unassigned == 0,
+                    "Invalid input argument: edge end points should appear in "
+                    "vertex_gpu_assignment.");
+  }
+
+  // 3. shuffle edges and create a graph; as the proxy vertex IDs are hashed to the assigned GPUs,
+  // the hash-based vertex partitioning coincides with the given assignment
+
+  std::optional<rmm::device_uvector<int32_t>> edgelist_edge_start_times{std::nullopt};
+  std::optional<rmm::device_uvector<int32_t>> edgelist_edge_end_times{std::nullopt};
+  std::tie(store_transposed ? edgelist_dsts : edgelist_srcs,
+           store_transposed ? edgelist_srcs : edgelist_dsts,
+           edgelist_weights,
+           edgelist_edge_ids,
+           edgelist_edge_types,
+           edgelist_edge_start_times,
+           edgelist_edge_end_times,
+           std::ignore) =
+    detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning(
+      handle,
+      std::move(store_transposed ? edgelist_dsts : edgelist_srcs),
+      std::move(store_transposed ? edgelist_srcs : edgelist_dsts),
+      std::move(edgelist_weights),
+      std::move(edgelist_edge_ids),
+      std::move(edgelist_edge_types),
+      std::move(edgelist_edge_start_times),
+      std::move(edgelist_edge_end_times));
+
+  rmm::device_uvector<vertex_t> local_vertices(proxies.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), proxies.begin(), proxies.end(), local_vertices.begin());
+
+  auto [graph, edge_weights, edge_ids, edge_types, renumber_map] =
+    create_graph_from_edgelist<vertex_t,
+                               edge_t,
+                               weight_t,
+                               edge_type_t,
+                               store_transposed,
+                               multi_gpu>(handle,
+                                          std::make_optional(std::move(local_vertices)),
+                                          std::move(edgelist_srcs),
+                                          std::move(edgelist_dsts),
+                                          std::move(edgelist_weights),
+                                          std::move(edgelist_edge_ids),
+                                          std::move(edgelist_edge_types),
+                                          graph_properties,
+                                          true,
+                                          do_expensive_check);
+
+  // 4. translate the renumber map back to the external vertex IDs (proxies are locally generated
+  // and already sorted)
+
+  thrust::transform(handle.get_thrust_policy(),
+                    (*renumber_map).begin(),
+                    (*renumber_map).end(),
+                    (*renumber_map).begin(),
+                    detail::proxy_to_ext_vertex_t<vertex_t>{
+                      raft::device_span<vertex_t const>(proxies.data(), proxies.size()),
+                      vertices.data()});
+
+  return std::make_tuple(std::move(graph),
+                         std::move(edge_weights),
+                         std::move(edge_ids),
+                         std::move(edge_types),
+                         std::move(renumber_map));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>> compute_vertex_gpu_assignment(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+  raft::device_span<vertex_t const> renumber_map,
+  double imbalance_tolerance,
+  bool do_expensive_check)
+{
+  static_assert(multi_gpu, "compute_vertex_gpu_assignment is multi-GPU only.");
+
+  CUGRAPH_EXPECTS(
+    renumber_map.size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size()),
+    "Invalid input argument: renumber_map.size() should match the local vertex partition range "
+    "size.");
+
+  auto const comm_size = handle.get_comms().get_size();
+
+  auto [partitions, edge_cut] = multilevel_partition(handle,
+                                                     graph_view,
+                                                     edge_weight_view,
+                                                     static_cast<size_t>(comm_size),
+                                                     imbalance_tolerance,
+                                                     size_t{20},
+                                                     do_expensive_check);
+
+  rmm::device_uvector<vertex_t> vertices(renumber_map.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), renumber_map.begin(), renumber_map.end(), vertices.begin());
+  rmm::device_uvector<int> ranks(partitions.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    partitions.begin(),
+                    partitions.end(),
+                    ranks.begin(),
+                    [] __device__(vertex_t p) { return static_cast<int>(p); });
+
+  return std::make_tuple(std::move(vertices), std::move(ranks));
+}
+
+}  // namespace cugraph
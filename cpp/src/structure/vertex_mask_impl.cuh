@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/fill_edge_property.cuh"
+#include "prims/transform_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct unpack_vertex_mask_t {
+  raft::device_span<uint32_t const> vertex_mask{};
+
+  __device__ bool operator()(vertex_t v_offset) const
+  {
+    return (vertex_mask[packed_bool_offset(v_offset)] & packed_bool_mask(v_offset)) !=
+           packed_bool_empty_mask();
+  }
+};
+
+template <typename vertex_t>
+struct both_end_points_kept_t {
+  __device__ bool operator()(
+    vertex_t, vertex_t, bool src_kept, bool dst_kept, cuda::std::nullopt_t) const
+  {
+    return src_kept && dst_kept;
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, bool store_transposed, bool multi_gpu>
+edge_property_t<graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>, bool>
+compute_edge_mask_from_vertex_mask(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu> const& graph_view)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, store_transposed, multi_gpu>;
+
+  CUGRAPH_EXPECTS(graph_view.has_vertex_mask(),
+                  "Invalid input argument: graph_view should have a vertex mask attached.");
+
+  auto kept_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(vertex_t{0}),
+    unpack_vertex_mask_t<vertex_t>{*(graph_view.vertex_mask_view())});
+
+  edge_src_property_t<graph_view_type, bool> edge_src_kept_flags(handle, graph_view);
+  edge_dst_property_t<graph_view_type, bool> edge_dst_kept_flags(handle, graph_view);
+  update_edge_src_property(handle, graph_view, kept_first, edge_src_kept_flags.mutable_view());
+  update_edge_dst_property(handle, graph_view, kept_first, edge_dst_kept_flags.mutable_view());
+
+  // transform_e skips the edges masked out by the attached edge mask, initialize every edge to
+  // false so that these edges remain masked out
+
+  auto unmasked_graph_view = graph_view;
+  if (unmasked_graph_view.has_edge_mask()) { unmasked_graph_view.clear_edge_mask(); }
+
+  edge_property_t<graph_view_type, bool> edge_mask(handle, graph_view);
+  fill_edge_property(handle, unmasked_graph_view, edge_mask.mutable_view(), false);
+  transform_e(handle,
+              graph_view,
+              edge_src_kept_flags.view(),
+              edge_dst_kept_flags.view(),
+              edge_dummy_property_t{}.view(),
+              both_end_points_kept_t<vertex_t>{},
+              edge_mask.mutable_view());
+
+  return edge_mask;
+}
+
+}  // namespace cugraph
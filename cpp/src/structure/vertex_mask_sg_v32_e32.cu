@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structure/vertex_mask_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template edge_property_t<graph_view_t<int32_t, int32_t, false, false>, bool>
+compute_edge_mask_from_vertex_mask(raft::handle_t const& handle,
+                                   graph_view_t<int32_t, int32_t, false, false> const& graph_view);
+
+template edge_property_t<graph_view_t<int32_t, int32_t, true, false>, bool>
+compute_edge_mask_from_vertex_mask(raft::handle_t const& handle,
+                                   graph_view_t<int32_t, int32_t, true, false> const& graph_view);
+
+}  // namespace cugraph
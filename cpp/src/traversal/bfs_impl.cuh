@@ -15,8 +15,11 @@
  */
 #pragma once
 
+#include "prims/detail/multi_stream_utils.cuh"
 #include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/kv_store.cuh"
 #include "prims/per_v_transform_reduce_if_incoming_outgoing_e.cuh"
+#include "prims/prefetch_frontier_edge_partitions.cuh"
 #include "prims/reduce_op.cuh"
 #include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
 #include "prims/update_v_frontier.cuh"
@@ -26,7 +29,9 @@
 #include <cugraph/edge_property.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
 #include <raft/core/handle.hpp>
@@ -41,11 +46,18 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
 #include <thrust/set_operations.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <limits>
+#include <tuple>
 #include <type_traits>
 
 namespace cugraph {
@@ -119,6 +131,50 @@ struct bottomup_pred_op_t {
   }
 };
 
+template <typename vertex_t>
+struct sparse_e_op_t {
+  __device__ cuda::std::optional<vertex_t> operator()(vertex_t src,
+                                                      vertex_t,
+                                                      cuda::std::nullopt_t,
+                                                      cuda::std::nullopt_t,
+                                                      cuda::std::nullopt_t) const
+  {
+    return src;
+  }
+};
+
+// alpha is the break-even ratio of the per-edge push cost to the per-edge pull cost (push is
+// cheaper while m_f * alpha <= m_u), so the measured cost ratio replaces alpha; beta is scaled by
+// the same factor. The scaling factor is clamped to guard against timing noise in small iterations.
+template <bool multi_gpu>
+std::tuple<double, double> tune_direction_optimizing_thresholds(raft::handle_t const& handle,
+                                                                double alpha,
+                                                                double beta,
+                                                                double topdown_time,
+                                                                double topdown_edges,
+                                                                double bottomup_time,
+                                                                double bottomup_edges)
+{
+  if constexpr (multi_gpu) {  // thresholds should be identical in every GPU
+    thrust::tie(topdown_time, bottomup_time) =
+      host_scalar_allreduce(handle.get_comms(),
+                            thrust::make_tuple(topdown_time, bottomup_time),
+                            raft::comms::op_t::MAX,
+                            handle.get_stream());
+  }
+
+  if ((topdown_edges <= 0.0) || (bottomup_edges <= 0.0) || (topdown_time <= 0.0) ||
+      (bottomup_time <= 0.0)) {
+    return std::make_tuple(alpha, beta);
+  }
+
+  constexpr double max_scale = 16.0;
+  auto measured_alpha = (topdown_time / topdown_edges) / (bottomup_time / bottomup_edges);
+  auto scale          = std::clamp(measured_alpha / alpha, 1.0 / max_scale, max_scale);
+
+  return std::make_tuple(alpha * scale, beta * scale);
+}
+
 }  // namespace
 
 namespace detail {
@@ -130,13 +186,15 @@ void bfs(raft::handle_t const& handle,
          PredecessorIterator predecessor_first,
          typename GraphViewType::vertex_type const* sources,
          size_t n_sources,
-         bool direction_optimizing,
+         bfs_options_t const& options,
          typename GraphViewType::vertex_type depth_limit,
          bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
 
+  auto const direction_optimizing = options.direction_optimizing;
+
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
   static_assert(!GraphViewType::is_storage_transposed,
@@ -170,6 +228,9 @@ void bfs(raft::handle_t const& handle,
   CUGRAPH_EXPECTS(
     graph_view.is_symmetric() || !direction_optimizing,
     "Invalid input argument: input graph should be symmetric for direction optimizing BFS.");
+  CUGRAPH_EXPECTS(!direction_optimizing || ((!options.alpha || (*options.alpha > 0.0)) &&
+                                            (!options.beta || (*options.beta > 0.0))),
+                  "Invalid input argument: direction optimizing thresholds should be positive.");
 
   auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
     graph_view.local_vertex_partition_view());
@@ -239,13 +300,29 @@ void bfs(raft::handle_t const& handle,
 
   auto segment_offsets = graph_view.local_vertex_partition_segment_offsets();
 
-  double direction_optimizing_alpha =
-    (graph_view.number_of_vertices() > 0)
-      ? ((static_cast<double>(graph_view.compute_number_of_edges(handle)) /
-          static_cast<double>(graph_view.number_of_vertices())) *
-         (1.0 / 3.75) /* tuning parametger */)
-      : double{1.0};
-  constexpr vertex_t direction_optimizing_beta = 24;  // tuning parameter
+  double direction_optimizing_alpha{1.0};
+  double direction_optimizing_beta{24.0};
+  if (direction_optimizing) {
+    if (options.alpha) {
+      direction_optimizing_alpha = *(options.alpha);
+    } else if (graph_view.number_of_vertices() > 0) {
+      direction_optimizing_alpha =
+        (static_cast<double>(graph_view.compute_number_of_edges(handle)) /
+         static_cast<double>(graph_view.number_of_vertices())) *
+        (1.0 / 3.75) /* tuning parametger */;
+    }
+    if (options.beta) { direction_optimizing_beta = *(options.beta); }
+  }
+
+  // auto-tuning state: wall-clock time & the (approximate) number of edges checked in the sampled
+  // push and pull iterations; the measured cost ratio scales alpha & beta once both directions
+  // are sampled
+  bool auto_tune = direction_optimizing && options.auto_tune;
+  double topdown_sample_time{0.0};
+  double topdown_sample_edges{0.0};
+  std::optional<double> cur_aggregate_m_f{std::nullopt};  // edges to check from the current
+                                                          // frontier (if computed)
+  std::optional<double> bottomup_sample_edges{std::nullopt};
 
   std::optional<direction_optimizing_info_t<vertex_t, edge_t>> aux_info{std::nullopt};
   if (direction_optimizing) {
@@ -377,14 +454,33 @@ void bfs(raft::handle_t const& handle,
                          prev_dst_visited_flags.mutable_view(),
                          true);
 
+  // if the edges reside in managed memory (e.g. for graphs larger than the GPU memory), prefetch
+  // the edges of the current frontier's range in every top-down iteration
+  bool const prefetch_edges = has_managed_edge_partitions(handle, graph_view);
+
   // 4. BFS iteration
   vertex_t depth{0};
   bool topdown = true;
   auto cur_aggregate_frontier_size =
     static_cast<vertex_t>(vertex_frontier.bucket(bucket_idx_cur).aggregate_size());
   while (true) {
+    prim_profile_range_t iteration_range(handle.get_stream(), "bfs iteration");
     vertex_t next_aggregate_frontier_size{};
+    bool sample_level =
+      auto_tune && (topdown ? (cur_aggregate_m_f.has_value() &&
+                               (static_cast<size_t>(depth) < options.auto_tune_levels))
+                            : bottomup_sample_edges.has_value());
+    std::chrono::steady_clock::time_point level_start{};
+    if (sample_level) {
+      handle.sync_stream();
+      level_start = std::chrono::steady_clock::now();
+    }
     if (topdown) {
+      if (prefetch_edges) {
+        prefetch_frontier_edge_partitions(
+          handle, graph_view, vertex_frontier.bucket(bucket_idx_cur));
+      }
+
       topdown_e_op_t<vertex_t, GraphViewType::is_multi_gpu> e_op{};
       e_op.prev_visited_flags =
         detail::edge_partition_endpoint_property_device_view_t<vertex_t, uint32_t*, bool>(
@@ -421,6 +517,13 @@ void bfs(raft::handle_t const& handle,
 
       next_aggregate_frontier_size =
         static_cast<vertex_t>(vertex_frontier.bucket(bucket_idx_next).aggregate_size());
+      if constexpr (GraphViewType::is_multi_gpu) { iteration_range.add_host_syncs(1); }
+      if (sample_level) {
+        handle.sync_stream();
+        topdown_sample_time +=
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - level_start).count();
+        topdown_sample_edges += *cur_aggregate_m_f;
+      }
       if (next_aggregate_frontier_size == 0) { break; }
 
       fill_edge_dst_property(handle,
@@ -471,6 +574,7 @@ void bfs(raft::handle_t const& handle,
               raft::host_span<vertex_t const>((*segment_offsets).data(), (*segment_offsets).size()),
               graph_view.local_vertex_partition_range_first(),
               handle.get_stream());
+            iteration_range.add_host_syncs(1);
             *((*aux_info).num_nzd_unvisited_low_degree_vertices) -=
               (f_segment_offsets[3] - f_segment_offsets[2]);
             if (graph_view.use_dcs()) {
@@ -493,27 +597,32 @@ void bfs(raft::handle_t const& handle,
             }
           }
 
-          m_f += static_cast<double>(thrust::transform_reduce(
-            handle.get_thrust_policy(),
+          // the degree sums are reduced on device (and in multi-GPU, allreduced with the host
+          // computed segment estimates) and read back with a single synchronization
+          rmm::device_uvector<double> d_m_f_m_u(4, handle.get_stream());
+          std::array<double, 2> h_segment_estimates{m_f, m_u};
+          raft::update_device(d_m_f_m_u.data() + 2,
+                              h_segment_estimates.data(),
+                              h_segment_estimates.size(),
+                              handle.get_stream());
+
+          auto f_degree_first = thrust::make_transform_iterator(
             f_vertex_first,
-            f_vertex_last,
-            cuda::proclaim_return_type<edge_t>(
+            cuda::proclaim_return_type<double>(
               [out_degrees = raft::device_span<edge_t const>((*aux_info).approx_out_degrees.data(),
                                                              (*aux_info).approx_out_degrees.size()),
                v_first = graph_view.local_vertex_partition_range_first()] __device__(vertex_t v) {
                 auto v_offset = v - v_first;
-                return out_degrees[v_offset];
-              }),
-            edge_t{0},
-            thrust::plus<edge_t>{}));
-
-          m_u += static_cast<double>(thrust::transform_reduce(
-            handle.get_thrust_policy(),
+                return static_cast<double>(out_degrees[v_offset]);
+              }));
+          detail::sum_nosync(f_degree_first,
+                             f_degree_first + thrust::distance(f_vertex_first, f_vertex_last),
+                             raft::device_span<double>(d_m_f_m_u.data(), 1),
+                             handle.get_stream());
+
+          auto u_degree_first = thrust::make_transform_iterator(
             thrust::make_counting_iterator(vertex_t{0}),
-            thrust::make_counting_iterator(segment_offsets
-                                             ? (*segment_offsets)[2]
-                                             : graph_view.local_vertex_partition_range_size()),
-            cuda::proclaim_return_type<edge_t>(
+            cuda::proclaim_return_type<double>(
               [out_degrees = raft::device_span<edge_t const>((*aux_info).approx_out_degrees.data(),
                                                              (*aux_info).approx_out_degrees.size()),
                bitmap      = raft::device_span<uint32_t const>(
@@ -521,28 +630,42 @@ void bfs(raft::handle_t const& handle,
                  (*aux_info).visited_bitmap.size())] __device__(vertex_t v_offset) {
                 auto word = bitmap[packed_bool_offset(v_offset)];
                 if ((word & packed_bool_mask(v_offset)) != packed_bool_empty_mask()) {  // visited
-                  return edge_t{0};
+                  return 0.0;
                 } else {
-                  return out_degrees[v_offset];
+                  return static_cast<double>(out_degrees[v_offset]);
                 }
-              }),
-            edge_t{0},
-            thrust::plus<edge_t>{}));
+              }));
+          detail::sum_nosync(u_degree_first,
+                             u_degree_first + (segment_offsets
+                                                 ? (*segment_offsets)[2]
+                                                 : graph_view.local_vertex_partition_range_size()),
+                             raft::device_span<double>(d_m_f_m_u.data() + 1, 1),
+                             handle.get_stream());
+
+          if constexpr (GraphViewType::is_multi_gpu) {
+            device_allreduce(handle.get_comms(),
+                             d_m_f_m_u.begin(),
+                             d_m_f_m_u.begin(),
+                             d_m_f_m_u.size(),
+                             raft::comms::op_t::SUM,
+                             handle.get_stream());
+          }
+          std::array<double, 4> h_m_f_m_u{};
+          raft::update_host(
+            h_m_f_m_u.data(), d_m_f_m_u.data(), h_m_f_m_u.size(), handle.get_stream());
+          handle.sync_stream();
+          iteration_range.add_host_syncs(1);
+          m_f = h_m_f_m_u[0] + h_m_f_m_u[2];
+          m_u = h_m_f_m_u[1] + h_m_f_m_u[3];
         }
 
         auto aggregate_m_f = m_f;
         auto aggregate_m_u = m_u;
-        if constexpr (GraphViewType::is_multi_gpu) {
-          auto tmp      = host_scalar_allreduce(handle.get_comms(),
-                                           thrust::make_tuple(m_f, m_u),
-                                           raft::comms::op_t::SUM,
-                                           handle.get_stream());
-          aggregate_m_f = thrust::get<0>(tmp);
-          aggregate_m_u = thrust::get<1>(tmp);
-        }
+        cur_aggregate_m_f = aggregate_m_f;
         if ((aggregate_m_f * direction_optimizing_alpha > aggregate_m_u) &&
             (next_aggregate_frontier_size >= cur_aggregate_frontier_size)) {
-          topdown                            = false;
+          topdown = false;
+          if (auto_tune) { bottomup_sample_edges = aggregate_m_u; }
           (*aux_info).nzd_unvisited_vertices = rmm::device_uvector<vertex_t>(
             segment_offsets ? *((*segment_offsets).rbegin() + 1)
                             : graph_view.local_vertex_partition_range_size(),
@@ -691,6 +814,23 @@ void bfs(raft::handle_t const& handle,
           handle.get_stream());
         next_aggregate_frontier_size     = thrust::get<0>(tmp);
         aggregate_nzd_unvisited_vertices = thrust::get<1>(tmp);
+        iteration_range.add_host_syncs(1);
+      }
+
+      if (sample_level) {
+        handle.sync_stream();
+        auto bottomup_sample_time =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - level_start).count();
+        std::tie(direction_optimizing_alpha, direction_optimizing_beta) =
+          tune_direction_optimizing_thresholds<GraphViewType::is_multi_gpu>(
+            handle,
+            direction_optimizing_alpha,
+            direction_optimizing_beta,
+            topdown_sample_time,
+            topdown_sample_edges,
+            bottomup_sample_time,
+            *bottomup_sample_edges);
+        auto_tune = false;
       }
 
       if (next_aggregate_frontier_size == 0) { break; }
@@ -702,13 +842,14 @@ void bfs(raft::handle_t const& handle,
                              prev_dst_visited_flags.mutable_view(),
                              true);
 
-      if ((next_aggregate_frontier_size * direction_optimizing_beta <
-           aggregate_nzd_unvisited_vertices) &&
+      if ((static_cast<double>(next_aggregate_frontier_size) * direction_optimizing_beta <
+           static_cast<double>(aggregate_nzd_unvisited_vertices)) &&
           (next_aggregate_frontier_size < cur_aggregate_frontier_size)) {
         topdown = true;
       }
 
       if (topdown) {  // swithcing to top-down
+        cur_aggregate_m_f = std::nullopt;
         vertex_frontier.bucket(bucket_idx_cur) =
           key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
             handle, std::move(new_frontier_vertex_buffer));
@@ -727,6 +868,157 @@ void bfs(raft::handle_t const& handle,
   }
 }
 
+// Top-down BFS touching only the reached vertices. Visited vertices are tracked in a hash map
+// (instead of O(V) distance & predecessor arrays) and newly visited vertices are appended to the
+// output, so the memory footprint and the work in every iteration are bounded by the number of
+// reached vertices and their out-going edges.
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>>>
+sparse_bfs(raft::handle_t const& handle,
+           GraphViewType const& graph_view,
+           raft::device_span<typename GraphViewType::vertex_type const> sources,
+           bool compute_predecessors,
+           typename GraphViewType::vertex_type depth_limit,
+           bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  auto aggregate_n_sources = sources.size();
+  if constexpr (GraphViewType::is_multi_gpu) {
+    aggregate_n_sources = host_scalar_allreduce(
+      handle.get_comms(), aggregate_n_sources, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(aggregate_n_sources > 0,
+                  "Invalid input argument: input should have at least one source.");
+
+  if (do_expensive_check) {
+    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+      graph_view.local_vertex_partition_view());
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       sources.begin(),
+                       sources.end(),
+                       [vertex_partition] __device__(auto val) {
+                         return !(vertex_partition.is_valid_vertex(val) &&
+                                  vertex_partition.in_local_vertex_partition_range_nocheck(val));
+                       });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+  }
+
+  // 2. initialize the visited vertex map, the output, and the frontier
+
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  rmm::device_uvector<vertex_t> vertices(sources.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), sources.begin(), sources.end(), vertices.begin());
+  thrust::sort(handle.get_thrust_policy(), vertices.begin(), vertices.end());
+  vertices.resize(static_cast<size_t>(thrust::distance(
+                    vertices.begin(),
+                    thrust::unique(handle.get_thrust_policy(), vertices.begin(), vertices.end()))),
+                  handle.get_stream());
+  rmm::device_uvector<vertex_t> distances(vertices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(vertices.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), distances.begin(), distances.end(), vertex_t{0});
+  thrust::fill(
+    handle.get_thrust_policy(), predecessors.begin(), predecessors.end(), invalid_vertex);
+
+  kv_store_t<vertex_t, vertex_t, false> visited_map(
+    std::max(vertices.size(), size_t{1024}) /* grows on insertion */,
+    invalid_vertex,
+    invalid_vertex,
+    handle.get_stream());
+  visited_map.insert(vertices.begin(), vertices.end(), distances.begin(), handle.get_stream());
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(
+    handle, num_buckets);
+  vertex_frontier.bucket(bucket_idx_cur).insert(vertices.begin(), vertices.end());
+
+  // 3. BFS iteration
+
+  vertex_t depth{0};
+  while (depth < depth_limit) {
+    auto [new_vertices, new_predecessors] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    graph_view,
+                                                    vertex_frontier.bucket(bucket_idx_cur),
+                                                    edge_src_dummy_property_t{}.view(),
+                                                    edge_dst_dummy_property_t{}.view(),
+                                                    edge_dummy_property_t{}.view(),
+                                                    sparse_e_op_t<vertex_t>{},
+                                                    reduce_op::any<vertex_t>(),
+                                                    do_expensive_check);
+
+    // drop the vertices visited in the previous iterations
+
+    rmm::device_uvector<bool> visited_flags(new_vertices.size(), handle.get_stream());
+    visited_map.view().contains(
+      new_vertices.begin(), new_vertices.end(), visited_flags.begin(), handle.get_stream());
+    auto pair_first = thrust::make_zip_iterator(new_vertices.begin(), new_predecessors.begin());
+    auto num_new_vertices = static_cast<size_t>(
+      thrust::distance(pair_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         pair_first,
+                                         pair_first + new_vertices.size(),
+                                         visited_flags.begin(),
+                                         thrust::identity<bool>{})));
+    new_vertices.resize(num_new_vertices, handle.get_stream());
+    new_predecessors.resize(num_new_vertices, handle.get_stream());
+
+    ++depth;
+
+    // record the newly visited vertices (new_vertices are sorted and unique)
+
+    visited_map.insert(new_vertices.begin(),
+                       new_vertices.end(),
+                       thrust::make_constant_iterator(depth),
+                       handle.get_stream());
+    auto old_size = vertices.size();
+    vertices.resize(old_size + num_new_vertices, handle.get_stream());
+    distances.resize(old_size + num_new_vertices, handle.get_stream());
+    predecessors.resize(old_size + num_new_vertices, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 pair_first,
+                 pair_first + num_new_vertices,
+                 thrust::make_zip_iterator(vertices.begin(), predecessors.begin()) + old_size);
+    thrust::fill(
+      handle.get_thrust_policy(), distances.begin() + old_size, distances.end(), depth);
+
+    vertex_frontier.bucket(bucket_idx_cur) =
+      key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
+        handle, std::move(new_vertices));
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+  }
+
+  // 4. return the reached (local) vertices sorted by vertex ID
+
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      vertices.begin(),
+                      vertices.end(),
+                      thrust::make_zip_iterator(distances.begin(), predecessors.begin()));
+
+  return std::make_tuple(std::move(vertices),
+                         std::move(distances),
+                         compute_predecessors ? std::make_optional(std::move(predecessors))
+                                              : std::nullopt);
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -736,7 +1028,7 @@ void bfs(raft::handle_t const& handle,
          vertex_t* predecessors,
          vertex_t const* sources,
          size_t n_sources,
-         bool direction_optimizing,
+         bfs_options_t const& options,
          vertex_t depth_limit,
          bool do_expensive_check)
 {
@@ -747,7 +1039,7 @@ void bfs(raft::handle_t const& handle,
                 predecessors,
                 sources,
                 n_sources,
-                direction_optimizing,
+                options,
                 depth_limit,
                 do_expensive_check);
   } else {
@@ -757,10 +1049,49 @@ void bfs(raft::handle_t const& handle,
                 thrust::make_discard_iterator(),
                 sources,
                 n_sources,
-                direction_optimizing,
+                options,
                 depth_limit,
                 do_expensive_check);
   }
 }
 
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void bfs(raft::handle_t const& handle,
+         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+         vertex_t* distances,
+         vertex_t* predecessors,
+         vertex_t const* sources,
+         size_t n_sources,
+         bool direction_optimizing,
+         vertex_t depth_limit,
+         bool do_expensive_check)
+{
+  bfs_options_t options{};
+  options.direction_optimizing = direction_optimizing;
+  bfs(handle,
+      graph_view,
+      distances,
+      predecessors,
+      sources,
+      n_sources,
+      options,
+      depth_limit,
+      do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+sparse_bfs(raft::handle_t const& handle,
+           graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+           raft::device_span<vertex_t const> sources,
+           bool compute_predecessors,
+           vertex_t depth_limit,
+           bool do_expensive_check)
+{
+  return detail::sparse_bfs(
+    handle, graph_view, sources, compute_predecessors, depth_limit, do_expensive_check);
+}
+
 }  // namespace cugraph
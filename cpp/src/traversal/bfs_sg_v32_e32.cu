@@ -30,4 +30,24 @@ template void bfs(raft::handle_t const& handle,
                   int32_t depth_limit,
                   bool do_expensive_check);
 
+template void bfs(raft::handle_t const& handle,
+                  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+                  int32_t* distances,
+                  int32_t* predecessors,
+                  int32_t const* sources,
+                  size_t n_sources,
+                  bfs_options_t const& options,
+                  int32_t depth_limit,
+                  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<int32_t>>>
+sparse_bfs(raft::handle_t const& handle,
+           graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+           raft::device_span<int32_t const> sources,
+           bool compute_predecessors,
+           int32_t depth_limit,
+           bool do_expensive_check);
+
 }  // namespace cugraph
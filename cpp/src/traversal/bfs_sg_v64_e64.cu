@@ -30,4 +30,24 @@ template void bfs(raft::handle_t const& handle,
                   int64_t depth_limit,
                   bool do_expensive_check);
 
+template void bfs(raft::handle_t const& handle,
+                  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                  int64_t* distances,
+                  int64_t* predecessors,
+                  int64_t const* sources,
+                  size_t n_sources,
+                  bfs_options_t const& options,
+                  int64_t depth_limit,
+                  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+sparse_bfs(raft::handle_t const& handle,
+           graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+           raft::device_span<int64_t const> sources,
+           bool compute_predecessors,
+           int64_t depth_limit,
+           bool do_expensive_check);
+
 }  // namespace cugraph
@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/count_if_e.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <cuco/hash_functions.cuh>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+// vertices with a smaller degree are contracted first, ties are broken by a hash of the vertex ID
+// (breaking ties by the vertex ID itself contracts a path or a grid one vertex at a time)
+template <typename vertex_t>
+struct contraction_priority_t {
+  vertex_t const* degrees{nullptr};
+
+  __device__ thrust::tuple<vertex_t, uint32_t, vertex_t> operator()(vertex_t v) const
+  {
+    cuco::murmurhash3_32<vertex_t> hash_func{};
+    return thrust::make_tuple(degrees[v], static_cast<uint32_t>(hash_func(v)), v);
+  }
+};
+
+// sort the (key0, key1, value) triplets by (key0, key1) and keep only the minimum value for each
+// (key0, key1) pair
+template <typename key0_t, typename key1_t, typename value_t>
+void sort_and_keep_minimum_values(raft::handle_t const& handle,
+                                  rmm::device_uvector<key0_t>& keys0,
+                                  rmm::device_uvector<key1_t>& keys1,
+                                  rmm::device_uvector<value_t>& values)
+{
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(keys0.begin(), keys1.begin()));
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), pair_first, pair_first + keys0.size(), values.begin());
+
+  auto num_uniques = thrust::count_if(handle.get_thrust_policy(),
+                                      thrust::make_counting_iterator(size_t{0}),
+                                      thrust::make_counting_iterator(keys0.size()),
+                                      is_first_in_run_t<decltype(pair_first)>{pair_first});
+
+  rmm::device_uvector<key0_t> tmp_keys0(num_uniques, handle.get_stream());
+  rmm::device_uvector<key1_t> tmp_keys1(tmp_keys0.size(), handle.get_stream());
+  rmm::device_uvector<value_t> tmp_values(tmp_keys0.size(), handle.get_stream());
+  thrust::reduce_by_key(
+    handle.get_thrust_policy(),
+    pair_first,
+    pair_first + keys0.size(),
+    values.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(tmp_keys0.begin(), tmp_keys1.begin())),
+    tmp_values.begin(),
+    thrust::equal_to<thrust::tuple<key0_t, key1_t>>{},
+    thrust::minimum<value_t>{});
+
+  keys0  = std::move(tmp_keys0);
+  keys1  = std::move(tmp_keys1);
+  values = std::move(tmp_values);
+}
+
+// Bellman-Ford style search from every start vertex concurrently on the upward graph (which is
+// acyclic, so the number of iterations is bounded by the number of contraction rounds). Returns
+// the (start index, vertex, distance) triplets of every reached vertex sorted by (start index,
+// vertex).
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<uint32_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+upward_search(raft::handle_t const& handle,
+              raft::device_span<edge_t const> offsets,
+              raft::device_span<vertex_t const> indices,
+              raft::device_span<weight_t const> weights,
+              raft::device_span<vertex_t const> starts)
+{
+  using idx_t = uint32_t;
+
+  rmm::device_uvector<idx_t> reached_idxs(starts.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> reached_vertices(starts.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> reached_distances(starts.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), reached_idxs.begin(), reached_idxs.end(), idx_t{0});
+  thrust::copy(
+    handle.get_thrust_policy(), starts.begin(), starts.end(), reached_vertices.begin());
+  thrust::fill(
+    handle.get_thrust_policy(), reached_distances.begin(), reached_distances.end(), weight_t{0.0});
+
+  rmm::device_uvector<idx_t> frontier_idxs(reached_idxs, handle.get_stream());
+  rmm::device_uvector<vertex_t> frontier_vertices(reached_vertices, handle.get_stream());
+  rmm::device_uvector<weight_t> frontier_distances(reached_distances, handle.get_stream());
+
+  while (frontier_idxs.size() > 0) {
+    // 1. enumerate the (start index, neighbor, distance) candidates of the frontier
+
+    rmm::device_uvector<size_t> frontier_offsets(frontier_vertices.size() + 1, handle.get_stream());
+    frontier_offsets.set_element_to_zero_async(0, handle.get_stream());
+    auto degree_first = thrust::make_transform_iterator(
+      frontier_vertices.begin(),
+      cuda::proclaim_return_type<size_t>([offsets] __device__(vertex_t v) {
+        return static_cast<size_t>(offsets[v + 1] - offsets[v]);
+      }));
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           degree_first,
+                           degree_first + frontier_vertices.size(),
+                           frontier_offsets.begin() + 1);
+    auto num_candidates = frontier_offsets.back_element(handle.get_stream());
+
+    rmm::device_uvector<idx_t> candidate_idxs(num_candidates, handle.get_stream());
+    rmm::device_uvector<vertex_t> candidate_vertices(num_candidates, handle.get_stream());
+    rmm::device_uvector<weight_t> candidate_distances(num_candidates, handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_candidates),
+      [offsets,
+       indices,
+       weights,
+       frontier_offsets    = raft::device_span<size_t const>(frontier_offsets.data(),
+                                                             frontier_offsets.size()),
+       frontier_idxs       = frontier_idxs.data(),
+       frontier_vertices   = frontier_vertices.data(),
+       frontier_distances  = frontier_distances.data(),
+       candidate_idxs      = candidate_idxs.data(),
+       candidate_vertices  = candidate_vertices.data(),
+       candidate_distances = candidate_distances.data()] __device__(size_t i) {
+        auto f = static_cast<size_t>(thrust::distance(
+                   frontier_offsets.begin() + 1,
+                   thrust::upper_bound(
+                     thrust::seq, frontier_offsets.begin() + 1, frontier_offsets.end(), i)));
+        auto e = offsets[frontier_vertices[f]] + static_cast<edge_t>(i - frontier_offsets[f]);
+        candidate_idxs[i]      = frontier_idxs[f];
+        candidate_vertices[i]  = indices[e];
+        candidate_distances[i] = frontier_distances[f] + weights[e];
+      });
+
+    // 2. keep the shortest candidate for each (start index, vertex) pair
+
+    sort_and_keep_minimum_values(
+      handle, candidate_idxs, candidate_vertices, candidate_distances);
+
+    // 3. the candidates improving the current distances become the next frontier
+
+    auto reached_pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(reached_idxs.begin(), reached_vertices.begin()));
+    auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+      candidate_idxs.begin(), candidate_vertices.begin(), candidate_distances.begin()));
+    auto num_improved = static_cast<size_t>(thrust::distance(
+      candidate_first,
+      thrust::remove_if(
+        handle.get_thrust_policy(),
+        candidate_first,
+        candidate_first + candidate_idxs.size(),
+        [reached_pair_first,
+         num_reached       = reached_idxs.size(),
+         reached_distances = reached_distances.data()] __device__(auto triplet) {
+          auto pair = thrust::make_tuple(thrust::get<0>(triplet), thrust::get<1>(triplet));
+          auto it   = thrust::lower_bound(
+            thrust::seq, reached_pair_first, reached_pair_first + num_reached, pair);
+          return (it != reached_pair_first + num_reached) &&
+                 (thrust::make_tuple(thrust::get<0>(*it), thrust::get<1>(*it)) == pair) &&
+                 (reached_distances[thrust::distance(reached_pair_first, it)] <=
+                  thrust::get<2>(triplet));
+        })));
+    candidate_idxs.resize(num_improved, handle.get_stream());
+    candidate_vertices.resize(num_improved, handle.get_stream());
+    candidate_distances.resize(num_improved, handle.get_stream());
+
+    auto old_num_reached = reached_idxs.size();
+    reached_idxs.resize(old_num_reached + num_improved, handle.get_stream());
+    reached_vertices.resize(reached_idxs.size(), handle.get_stream());
+    reached_distances.resize(reached_idxs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 candidate_first,
+                 candidate_first + num_improved,
+                 thrust::make_zip_iterator(thrust::make_tuple(reached_idxs.begin(),
+                                                              reached_vertices.begin(),
+                                                              reached_distances.begin())) +
+                   old_num_reached);
+    sort_and_keep_minimum_values(handle, reached_idxs, reached_vertices, reached_distances);
+
+    frontier_idxs      = std::move(candidate_idxs);
+    frontier_vertices  = std::move(candidate_vertices);
+    frontier_distances = std::move(candidate_distances);
+  }
+
+  return std::make_tuple(
+    std::move(reached_idxs), std::move(reached_vertices), std::move(reached_distances));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  bool do_expensive_check)
+{
+  static_assert(std::is_integral<vertex_t>::value, "vertex_t should be integral.");
+  static_assert(std::is_floating_point<weight_t>::value,
+                "weight_t should be a floating-point type.");
+  static_assert(!multi_gpu, "We currently do not support multi-GPU.");
+
+  // contract an independent set of vertices (vertices with a smaller priority than all their
+  // neighbors) in every round, see
+  // R. Geisberger, P. Sanders, D. Schultes, and D. Delling, "Contraction hierarchies: faster and
+  // simpler hierarchical routing in road networks," 2008.
+  // Contracting an independent set in a round avoids the sequential vertex-by-vertex contraction of
+  // the original algorithm, and no witness search is performed (every pair of neighbors gets a
+  // shortcut unless there is already an edge with a smaller or equal weight).
+
+  // 1. check input arguments
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: the input graph should be symmetric.");
+
+  if (do_expensive_check) {
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input edge weights should have non-negative values.");
+  }
+
+  // 2. extract the edge list (without self-loops and multi-edges)
+
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  std::optional<rmm::device_uvector<weight_t>> tmp_weights{std::nullopt};
+  std::tie(srcs, dsts, tmp_weights, std::ignore, std::ignore) =
+    decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t>(
+      handle,
+      graph_view,
+      std::make_optional(edge_weight_view),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+  auto weights = std::move(*tmp_weights);
+
+  {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+    auto num_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        edge_first,
+                        edge_first + srcs.size(),
+                        [] __device__(auto e) { return thrust::get<0>(e) == thrust::get<1>(e); })));
+    srcs.resize(num_edges, handle.get_stream());
+    dsts.resize(num_edges, handle.get_stream());
+    weights.resize(num_edges, handle.get_stream());
+  }
+  detail::sort_and_keep_minimum_values(handle, srcs, dsts, weights);
+
+  // 3. contract vertices round by round until no edge remains
+
+  rmm::device_uvector<vertex_t> vertex_levels(num_vertices, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), vertex_levels.begin(), vertex_levels.end(), vertex_t{0});
+
+  rmm::device_uvector<vertex_t> degrees(num_vertices, handle.get_stream());
+  rmm::device_uvector<uint8_t> contracted(num_vertices, handle.get_stream());
+
+  rmm::device_uvector<vertex_t> upward_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> upward_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> upward_weights(0, handle.get_stream());
+
+  vertex_t level{0};
+  while (srcs.size() > 0) {
+    // 3-1. compute the degrees of the remaining vertices (srcs are sorted)
+
+    rmm::device_uvector<vertex_t> remaining_vertices(srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> remaining_degrees(srcs.size(), handle.get_stream());
+    auto num_remaining_vertices = static_cast<size_t>(thrust::distance(
+      remaining_vertices.begin(),
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           srcs.begin(),
+                                           srcs.end(),
+                                           thrust::make_constant_iterator(vertex_t{1}),
+                                           remaining_vertices.begin(),
+                                           remaining_degrees.begin()))));
+    remaining_vertices.resize(num_remaining_vertices, handle.get_stream());
+    remaining_degrees.resize(num_remaining_vertices, handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    remaining_degrees.begin(),
+                    remaining_degrees.end(),
+                    remaining_vertices.begin(),
+                    degrees.begin());
+
+    // 3-2. select the remaining vertices with a smaller priority than all their neighbors
+
+    thrust::fill(handle.get_thrust_policy(), contracted.begin(), contracted.end(), uint8_t{0});
+    thrust::scatter(handle.get_thrust_policy(),
+                    thrust::make_constant_iterator(uint8_t{1}),
+                    thrust::make_constant_iterator(uint8_t{1}) + num_remaining_vertices,
+                    remaining_vertices.begin(),
+                    contracted.begin());
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(srcs.size()),
+                     [srcs       = srcs.data(),
+                      dsts       = dsts.data(),
+                      priority   = detail::contraction_priority_t<vertex_t>{degrees.data()},
+                      contracted = contracted.data()] __device__(size_t i) {
+                       if (priority(dsts[i]) < priority(srcs[i])) { contracted[srcs[i]] = 0; }
+                     });
+
+    // 3-3. move the edges of the contracted vertices to the upward graph (the neighbors of a
+    // contracted vertex are contracted in later rounds)
+
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+    auto src_contracted_first = thrust::make_transform_iterator(
+      srcs.begin(),
+      cuda::proclaim_return_type<bool>(
+        [contracted = contracted.data()] __device__(vertex_t v) { return contracted[v] != 0; }));
+    auto num_contracted_edges = static_cast<size_t>(thrust::count(
+      handle.get_thrust_policy(), src_contracted_first, src_contracted_first + srcs.size(), true));
+
+    rmm::device_uvector<vertex_t> contracted_srcs(num_contracted_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> contracted_dsts(num_contracted_edges, handle.get_stream());
+    rmm::device_uvector<weight_t> contracted_weights(num_contracted_edges, handle.get_stream());
+    thrust::copy_if(handle.get_thrust_policy(),
+                    edge_first,
+                    edge_first + srcs.size(),
+                    src_contracted_first,
+                    thrust::make_zip_iterator(thrust::make_tuple(contracted_srcs.begin(),
+                                                                 contracted_dsts.begin(),
+                                                                 contracted_weights.begin())),
+                    thrust::identity<bool>{});
+
+    auto num_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        edge_first,
+                        edge_first + srcs.size(),
+                        [contracted = contracted.data()] __device__(auto e) {
+                          return (contracted[thrust::get<0>(e)] != 0) ||
+                                 (contracted[thrust::get<1>(e)] != 0);
+                        })));
+    srcs.resize(num_edges, handle.get_stream());
+    dsts.resize(num_edges, handle.get_stream());
+    weights.resize(num_edges, handle.get_stream());
+
+    auto old_num_upward_edges = upward_srcs.size();
+    upward_srcs.resize(old_num_upward_edges + num_contracted_edges, handle.get_stream());
+    upward_dsts.resize(upward_srcs.size(), handle.get_stream());
+    upward_weights.resize(upward_srcs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 thrust::make_zip_iterator(thrust::make_tuple(
+                   contracted_srcs.begin(), contracted_dsts.begin(), contracted_weights.begin())),
+                 thrust::make_zip_iterator(thrust::make_tuple(
+                   contracted_srcs.end(), contracted_dsts.end(), contracted_weights.end())),
+                 thrust::make_zip_iterator(thrust::make_tuple(
+                   upward_srcs.begin(), upward_dsts.begin(), upward_weights.begin())) +
+                   old_num_upward_edges);
+
+    // 3-4. add a shortcut for every ordered pair of neighbors of each contracted vertex
+
+    rmm::device_uvector<vertex_t> contracted_vertices(num_contracted_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> contracted_degrees(num_contracted_edges, handle.get_stream());
+    auto num_contracted_vertices = static_cast<size_t>(thrust::distance(
+      contracted_vertices.begin(),
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           contracted_srcs.begin(),
+                                           contracted_srcs.end(),
+                                           thrust::make_constant_iterator(vertex_t{1}),
+                                           contracted_vertices.begin(),
+                                           contracted_degrees.begin()))));
+    contracted_vertices.resize(num_contracted_vertices, handle.get_stream());
+    contracted_degrees.resize(num_contracted_vertices, handle.get_stream());
+
+    thrust::fill(handle.get_thrust_policy(),
+                 thrust::make_permutation_iterator(vertex_levels.begin(),
+                                                   contracted_vertices.begin()),
+                 thrust::make_permutation_iterator(vertex_levels.begin(),
+                                                   contracted_vertices.end()),
+                 level);
+
+    rmm::device_uvector<size_t> edge_offsets(num_contracted_vertices + 1, handle.get_stream());
+    rmm::device_uvector<size_t> shortcut_offsets(num_contracted_vertices + 1,
+                                                 handle.get_stream());
+    edge_offsets.set_element_to_zero_async(0, handle.get_stream());
+    shortcut_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           contracted_degrees.begin(),
+                           contracted_degrees.end(),
+                           edge_offsets.begin() + 1);
+    auto num_pair_first = thrust::make_transform_iterator(
+      contracted_degrees.begin(), cuda::proclaim_return_type<size_t>([] __device__(vertex_t d) {
+        return static_cast<size_t>(d) * static_cast<size_t>(d - 1);
+      }));
+    thrust::inclusive_scan(handle.get_thrust_policy(),
+                           num_pair_first,
+                           num_pair_first + num_contracted_vertices,
+                           shortcut_offsets.begin() + 1);
+    auto num_shortcuts = shortcut_offsets.back_element(handle.get_stream());
+
+    srcs.resize(num_edges + num_shortcuts, handle.get_stream());
+    dsts.resize(srcs.size(), handle.get_stream());
+    weights.resize(srcs.size(), handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_shortcuts),
+      [edge_offsets = raft::device_span<size_t const>(edge_offsets.data(), edge_offsets.size()),
+       shortcut_offsets =
+         raft::device_span<size_t const>(shortcut_offsets.data(), shortcut_offsets.size()),
+       contracted_dsts    = contracted_dsts.data(),
+       contracted_weights = contracted_weights.data(),
+       shortcut_srcs      = srcs.data() + num_edges,
+       shortcut_dsts      = dsts.data() + num_edges,
+       shortcut_weights   = weights.data() + num_edges] __device__(size_t i) {
+        auto idx       = static_cast<size_t>(thrust::distance(
+          shortcut_offsets.begin() + 1,
+          thrust::upper_bound(
+            thrust::seq, shortcut_offsets.begin() + 1, shortcut_offsets.end(), i)));
+        auto degree    = edge_offsets[idx + 1] - edge_offsets[idx];
+        auto pair_idx  = i - shortcut_offsets[idx];
+        auto first     = pair_idx / (degree - 1);
+        auto second    = pair_idx % (degree - 1);
+        if (second >= first) { ++second; }
+        first += edge_offsets[idx];
+        second += edge_offsets[idx];
+        shortcut_srcs[i]    = contracted_dsts[first];
+        shortcut_dsts[i]    = contracted_dsts[second];
+        shortcut_weights[i] = contracted_weights[first] + contracted_weights[second];
+      });
+    detail::sort_and_keep_minimum_values(handle, srcs, dsts, weights);
+
+    ++level;
+  }
+
+  // 4. create the upward graph (vertex IDs are preserved)
+
+  rmm::device_uvector<vertex_t> vertices(num_vertices, handle.get_stream());
+  detail::sequence_fill(handle.get_stream(), vertices.data(), vertices.size(), vertex_t{0});
+
+  graph_t<vertex_t, edge_t, false, false> upward_graph(handle);
+  std::optional<edge_property_t<graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+    upward_edge_weights{std::nullopt};
+  std::tie(upward_graph, upward_edge_weights, std::ignore, std::ignore, std::ignore) =
+    create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, false, false>(
+      handle,
+      std::make_optional(std::move(vertices)),
+      std::move(upward_srcs),
+      std::move(upward_dsts),
+      std::make_optional(std::move(upward_weights)),
+      std::nullopt,
+      std::nullopt,
+      graph_properties_t{false, false},
+      false);
+
+  return contraction_hierarchy_t<vertex_t, edge_t, weight_t>{
+    std::move(upward_graph), std::move(*upward_edge_weights), std::move(vertex_levels)};
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> contraction_hierarchy_shortest_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& contraction_hierarchy,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  bool do_expensive_check)
+{
+  using idx_t = uint32_t;
+
+  auto graph_view   = contraction_hierarchy.upward_graph.view();
+  auto num_vertices = graph_view.number_of_vertices();
+
+  CUGRAPH_EXPECTS(sources.size() == targets.size(),
+                  "Invalid input arguments: sources.size() and targets.size() should coincide.");
+  CUGRAPH_EXPECTS(sources.size() <= std::numeric_limits<idx_t>::max(),
+                  "Invalid input arguments: sources.size() too large, the current implementation "
+                  "assumes that the pair index can be represented using a 32 bit value.");
+
+  if (do_expensive_check) {
+    auto is_invalid_vertex = [num_vertices] __device__(auto v) {
+      return !is_valid_vertex(num_vertices, v);
+    };
+    auto num_invalid_vertices =
+      thrust::count_if(
+        handle.get_thrust_policy(), sources.begin(), sources.end(), is_invalid_vertex) +
+      thrust::count_if(
+        handle.get_thrust_policy(), targets.begin(), targets.end(), is_invalid_vertex);
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input arguments: sources or targets contain invalid vertex IDs.");
+  }
+
+  // the upward searches from a source and a target meet at the highest level vertex on a shortest
+  // path (the input graph is symmetric, so the upward graph serves both search directions)
+
+  auto edge_partition = graph_view.local_edge_partition_view();
+  auto offsets        = edge_partition.offsets();
+  auto indices        = edge_partition.indices();
+  auto weights        = raft::device_span<weight_t const>(
+    contraction_hierarchy.upward_edge_weights.view().value_firsts()[0], indices.size());
+
+  auto [forward_idxs, forward_vertices, forward_distances] =
+    detail::upward_search(handle, offsets, indices, weights, sources);
+  auto [backward_idxs, backward_vertices, backward_distances] =
+    detail::upward_search(handle, offsets, indices, weights, targets);
+
+  auto backward_pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(backward_idxs.begin(), backward_vertices.begin()));
+  auto meeting_distance_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(size_t{0}),
+    cuda::proclaim_return_type<weight_t>(
+      [forward_idxs       = forward_idxs.data(),
+       forward_vertices   = forward_vertices.data(),
+       forward_distances  = forward_distances.data(),
+       backward_pair_first,
+       num_backward       = backward_idxs.size(),
+       backward_distances = backward_distances.data()] __device__(size_t i) {
+        auto pair = thrust::make_tuple(forward_idxs[i], forward_vertices[i]);
+        auto it   = thrust::lower_bound(
+          thrust::seq, backward_pair_first, backward_pair_first + num_backward, pair);
+        if ((it != backward_pair_first + num_backward) &&
+            (thrust::make_tuple(thrust::get<0>(*it), thrust::get<1>(*it)) == pair)) {
+          return forward_distances[i] +
+                 backward_distances[thrust::distance(backward_pair_first, it)];
+        } else {
+          return std::numeric_limits<weight_t>::max();
+        }
+      }));
+
+  // every pair index appears in the forward search result (each source reaches itself)
+  rmm::device_uvector<idx_t> pair_idxs(sources.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> shortest_distances(sources.size(), handle.get_stream());
+  thrust::reduce_by_key(handle.get_thrust_policy(),
+                        forward_idxs.begin(),
+                        forward_idxs.end(),
+                        meeting_distance_first,
+                        pair_idxs.begin(),
+                        shortest_distances.begin(),
+                        thrust::equal_to<idx_t>{},
+                        thrust::minimum<weight_t>{});
+
+  rmm::device_uvector<weight_t> distances(sources.size(), handle.get_stream());
+  thrust::scatter(handle.get_thrust_policy(),
+                  shortest_distances.begin(),
+                  shortest_distances.end(),
+                  pair_idxs.begin(),
+                  distances.begin());
+
+  return distances;
+}
+
+}  // namespace cugraph
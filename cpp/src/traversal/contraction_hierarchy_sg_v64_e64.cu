@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traversal/contraction_hierarchy_impl.cuh"
+
+namespace cugraph {
+
+// SG instantiation
+
+template contraction_hierarchy_t<int64_t, int64_t, float> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, float const*> edge_weight_view,
+  bool do_expensive_check);
+
+template contraction_hierarchy_t<int64_t, int64_t, double> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+  edge_property_view_t<int64_t, double const*> edge_weight_view,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> contraction_hierarchy_shortest_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<int64_t, int64_t, float> const& contraction_hierarchy,
+  raft::device_span<int64_t const> sources,
+  raft::device_span<int64_t const> targets,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> contraction_hierarchy_shortest_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<int64_t, int64_t, double> const& contraction_hierarchy,
+  raft::device_span<int64_t const> sources,
+  raft::device_span<int64_t const> targets,
+  bool do_expensive_check);
+
+}  // namespace cugraph
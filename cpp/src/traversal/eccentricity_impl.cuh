@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "utilities/collect_comm.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace {
+
+// the sources of a sweep (one multi-source BFS batch) are split evenly between the vertices with
+// the largest upper bounds and the vertices with the smallest lower bounds (Takes & Kosters)
+constexpr size_t eccentricity_sources_per_sweep{64};
+
+// (bound, degree, vertex), larger (or smaller) bound first, then larger degree, then smaller vertex
+template <typename vertex_t, typename edge_t>
+struct eccentricity_candidate_less_t {
+  bool larger_bound_first{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, edge_t, vertex_t> lhs,
+                             thrust::tuple<vertex_t, edge_t, vertex_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return larger_bound_first ? (thrust::get<0>(lhs) > thrust::get<0>(rhs))
+                                : (thrust::get<0>(lhs) < thrust::get<0>(rhs));
+    }
+    if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    }
+    return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+  }
+};
+
+template <typename vertex_t>
+struct eccentricity_source_max_t {
+  size_t const* source_indices{};
+  vertex_t const* distances{};
+  vertex_t* source_eccentricities{};
+
+  __device__ void operator()(size_t i) const
+  {
+    cuda::atomic_ref<vertex_t, cuda::thread_scope_device> eccentricity(
+      source_eccentricities[source_indices[i]]);
+    eccentricity.fetch_max(distances[i], cuda::std::memory_order_relaxed);
+  }
+};
+
+// ecc(v) >= max(d(s, v), ecc(s) - d(s, v)) and ecc(v) <= ecc(s) + d(s, v) if s reaches v
+template <typename vertex_t>
+struct eccentricity_update_bounds_t {
+  size_t const* source_indices{};
+  vertex_t const* vertices{};
+  vertex_t const* distances{};
+  vertex_t const* source_eccentricities{};
+  vertex_t* lower_bounds{};
+  vertex_t* upper_bounds{};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v_offset            = vertices[i] - local_vertex_partition_range_first;
+    auto d                   = distances[i];
+    auto source_eccentricity = source_eccentricities[source_indices[i]];
+    cuda::atomic_ref<vertex_t, cuda::thread_scope_device> lower(lower_bounds[v_offset]);
+    lower.fetch_max(cuda::std::max(d, source_eccentricity - d), cuda::std::memory_order_relaxed);
+    cuda::atomic_ref<vertex_t, cuda::thread_scope_device> upper(upper_bounds[v_offset]);
+    upper.fetch_min(source_eccentricity + d, cuda::std::memory_order_relaxed);
+  }
+};
+
+// select the num_candidates best (bound, degree) candidates over all the GPUs, the result is
+// identical in every GPU
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> select_eccentricity_candidates(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& vertices,
+  rmm::device_uvector<vertex_t>&& bounds,
+  rmm::device_uvector<edge_t>&& degrees,
+  bool larger_bound_first,
+  size_t num_candidates)
+{
+  auto sort_and_trim = [&]() {
+    auto triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(bounds.begin(), degrees.begin(), vertices.begin()));
+    thrust::sort(handle.get_thrust_policy(),
+                 triplet_first,
+                 triplet_first + vertices.size(),
+                 eccentricity_candidate_less_t<vertex_t, edge_t>{larger_bound_first});
+    auto new_size = std::min(vertices.size(), num_candidates);
+    vertices.resize(new_size, handle.get_stream());
+    bounds.resize(new_size, handle.get_stream());
+    degrees.resize(new_size, handle.get_stream());
+  };
+
+  sort_and_trim();
+  if constexpr (multi_gpu) {
+    auto& comm = handle.get_comms();
+    vertices   = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<vertex_t const>(vertices.data(), vertices.size()));
+    bounds = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<vertex_t const>(bounds.data(), bounds.size()));
+    degrees = cugraph::device_allgatherv(
+      handle, comm, raft::device_span<edge_t const>(degrees.data(), degrees.size()));
+    sort_and_trim();
+  }
+
+  return std::move(vertices);
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           typename GraphViewType::vertex_type>
+eccentricity(raft::handle_t const& handle,
+             GraphViewType const& graph_view,
+             bool diameter_only,
+             bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: input graph should be symmetric (undirected).");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto const local_vertex_partition_range_size = graph_view.local_vertex_partition_range_size();
+
+  // 2. every vertex starts with the trivial bounds [0, infinity)
+
+  rmm::device_uvector<vertex_t> lower_bounds(local_vertex_partition_range_size,
+                                             handle.get_stream());
+  rmm::device_uvector<vertex_t> upper_bounds(local_vertex_partition_range_size,
+                                             handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), lower_bounds.begin(), lower_bounds.end(), vertex_t{0});
+  thrust::fill(
+    handle.get_thrust_policy(), upper_bounds.begin(), upper_bounds.end(), invalid_distance);
+
+  auto degrees = graph_view.compute_out_degrees(handle);
+
+  auto global_max = [&handle](auto first, auto last) {
+    using value_t = typename thrust::iterator_traits<decltype(first)>::value_type;
+    auto ret     = thrust::reduce(
+      handle.get_thrust_policy(), first, last, value_t{0}, thrust::maximum<value_t>{});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      ret = host_scalar_allreduce(
+        handle.get_comms(), ret, raft::comms::op_t::MAX, handle.get_stream());
+    }
+    return ret;
+  };
+
+  // 3. run multi-source BFS sweeps from the candidates with the most promising bounds, and tighten
+  // the bounds of all the vertices till every eccentricity (or the diameter) is determined
+
+  while (true) {
+    rmm::device_uvector<vertex_t> unresolved_vertices(local_vertex_partition_range_size,
+                                                      handle.get_stream());
+    unresolved_vertices.resize(
+      thrust::distance(
+        unresolved_vertices.begin(),
+        thrust::copy_if(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+          unresolved_vertices.begin(),
+          [lower_bounds = lower_bounds.data(),
+           upper_bounds = upper_bounds.data(),
+           v_first      = graph_view.local_vertex_partition_range_first()] __device__(vertex_t v) {
+            return lower_bounds[v - v_first] != upper_bounds[v - v_first];
+          })),
+      handle.get_stream());
+
+    auto num_unresolved_vertices = unresolved_vertices.size();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_unresolved_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_unresolved_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_unresolved_vertices == 0) { break; }
+
+    rmm::device_uvector<vertex_t> unresolved_upper_bounds(unresolved_vertices.size(),
+                                                          handle.get_stream());
+    rmm::device_uvector<edge_t> unresolved_degrees(unresolved_vertices.size(), handle.get_stream());
+    auto local_offset_first = thrust::make_transform_iterator(
+      unresolved_vertices.begin(),
+      [v_first = graph_view.local_vertex_partition_range_first()] __device__(vertex_t v) {
+        return v - v_first;
+      });
+    thrust::gather(handle.get_thrust_policy(),
+                   local_offset_first,
+                   local_offset_first + unresolved_vertices.size(),
+                   upper_bounds.begin(),
+                   unresolved_upper_bounds.begin());
+    thrust::gather(handle.get_thrust_policy(),
+                   local_offset_first,
+                   local_offset_first + unresolved_vertices.size(),
+                   degrees.begin(),
+                   unresolved_degrees.begin());
+
+    if (diameter_only) {
+      // the diameter is determined once no unresolved vertex can exceed the largest lower bound
+      auto max_lower_bound = global_max(lower_bounds.begin(), lower_bounds.end());
+      auto max_unresolved_upper_bound =
+        global_max(unresolved_upper_bounds.begin(), unresolved_upper_bounds.end());
+      if (max_unresolved_upper_bound <= max_lower_bound) { break; }
+    }
+
+    rmm::device_uvector<vertex_t> unresolved_lower_bounds(unresolved_vertices.size(),
+                                                          handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   local_offset_first,
+                   local_offset_first + unresolved_vertices.size(),
+                   lower_bounds.begin(),
+                   unresolved_lower_bounds.begin());
+    rmm::device_uvector<vertex_t> tmp_vertices(unresolved_vertices.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> tmp_degrees(unresolved_degrees.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 unresolved_vertices.begin(),
+                 unresolved_vertices.end(),
+                 tmp_vertices.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 unresolved_degrees.begin(),
+                 unresolved_degrees.end(),
+                 tmp_degrees.begin());
+
+    auto upper_candidates =
+      select_eccentricity_candidates<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+        handle,
+        std::move(unresolved_vertices),
+        std::move(unresolved_upper_bounds),
+        std::move(unresolved_degrees),
+        true,
+        eccentricity_sources_per_sweep / 2);
+    auto lower_candidates =
+      select_eccentricity_candidates<vertex_t, edge_t, GraphViewType::is_multi_gpu>(
+        handle,
+        std::move(tmp_vertices),
+        std::move(unresolved_lower_bounds),
+        std::move(tmp_degrees),
+        false,
+        eccentricity_sources_per_sweep / 2);
+
+    rmm::device_uvector<vertex_t> sources(upper_candidates.size() + lower_candidates.size(),
+                                          handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 upper_candidates.begin(),
+                 upper_candidates.end(),
+                 sources.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 lower_candidates.begin(),
+                 lower_candidates.end(),
+                 sources.begin() + upper_candidates.size());
+    thrust::sort(handle.get_thrust_policy(), sources.begin(), sources.end());
+    sources.resize(thrust::distance(sources.begin(),
+                                    thrust::unique(handle.get_thrust_policy(),
+                                                   sources.begin(),
+                                                   sources.end())),
+                   handle.get_stream());
+
+    auto [source_indices, reached_vertices, distances] = multi_source_bfs(
+      handle, graph_view, raft::device_span<vertex_t const>(sources.data(), sources.size()));
+
+    rmm::device_uvector<vertex_t> source_eccentricities(sources.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 source_eccentricities.begin(),
+                 source_eccentricities.end(),
+                 vertex_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(distances.size()),
+                     eccentricity_source_max_t<vertex_t>{
+                       source_indices.data(), distances.data(), source_eccentricities.data()});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       source_eccentricities.data(),
+                       source_eccentricities.data(),
+                       source_eccentricities.size(),
+                       raft::comms::op_t::MAX,
+                       handle.get_stream());
+    }
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(distances.size()),
+      eccentricity_update_bounds_t<vertex_t>{source_indices.data(),
+                                             reached_vertices.data(),
+                                             distances.data(),
+                                             source_eccentricities.data(),
+                                             lower_bounds.data(),
+                                             upper_bounds.data(),
+                                             graph_view.local_vertex_partition_range_first()});
+  }
+
+  // 4. every resolved vertex has lower bound == eccentricity, and (in diameter_only mode) no
+  // unresolved vertex has an eccentricity larger than the largest lower bound
+
+  auto diameter = global_max(lower_bounds.begin(), lower_bounds.end());
+
+  return std::make_tuple(std::move(lower_bounds), diameter);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> eccentricity(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check)
+{
+  return std::get<0>(detail::eccentricity(handle, graph_view, false, do_expensive_check));
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+vertex_t diameter(raft::handle_t const& handle,
+                  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                  bool do_expensive_check)
+{
+  return std::get<1>(detail::eccentricity(handle, graph_view, true, do_expensive_check));
+}
+
+}  // namespace cugraph
@@ -39,12 +39,18 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <optional>
+
 namespace cugraph {
 
 namespace detail {
@@ -112,6 +118,47 @@ struct decrement_position {
   size_t __device__ operator()(size_t offset) { return offset - 1; }
 };
 
+template <typename vertex_t, bool is_multi_gpu>
+struct compute_path_last_offset {
+  vertex_partition_device_view_t<vertex_t, is_multi_gpu> vertex_partition_;
+  vertex_t invalid_vertex_;
+  vertex_t const* predecessors_;
+  vertex_t const* distances_;
+  vertex_t const* destinations_;
+
+  vertex_t __device__ operator()(size_t idx)
+  {
+    auto offset =
+      vertex_partition_.local_vertex_partition_offset_from_vertex_nocheck(destinations_[idx]);
+
+    return (predecessors_[offset] == invalid_vertex_) ? vertex_t{0} : distances_[offset];
+  }
+};
+
+// (vertex, paths offset) pairs to look up the 2^k'th ancestors of the path vertices at the 0th,
+// 1st, ..., (2^k - 1)th hops from the destinations (the result is the path vertex 2^k hops further
+// away from the destination), invalid_vertex_ if the ancestor is beyond the source
+template <typename vertex_t>
+struct pointer_jumping_query_t {
+  vertex_t const* paths_;
+  vertex_t const* last_offsets_;
+  size_t destination_first_;
+  vertex_t max_path_length_;
+  vertex_t step_;
+  vertex_t invalid_vertex_;
+
+  thrust::tuple<vertex_t, size_t> __device__ operator()(size_t i) const
+  {
+    auto idx    = destination_first_ + i / static_cast<size_t>(step_);
+    auto hop    = static_cast<vertex_t>(i % static_cast<size_t>(step_));
+    auto last   = last_offsets_[idx];
+    auto offset = idx * static_cast<size_t>(max_path_length_);
+    return (hop + step_ <= last)
+             ? thrust::make_tuple(paths_[offset + (last - hop)], offset + (last - hop - step_))
+             : thrust::make_tuple(invalid_vertex_, size_t{0});
+  }
+};
+
 template <typename vertex_t>
 std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<size_t>> shrink_extraction_list(
   raft::handle_t const& handle,
@@ -251,4 +298,169 @@ std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
   return std::make_tuple(std::move(paths), max_path_length);
 }
 
+// Pointer jumping (doubling) path extraction, after the k'th round, the paths hold the vertices
+// within 2^k hops from the destinations and the jump table holds the 2^k'th ancestor of every local
+// vertex; the next round fills the vertices 2^k to (2^(k + 1) - 1) hops away from the destinations
+// by looking up the jump table and squares the jump table. This finishes in
+// O(log(max_path_length)) rounds (each a collect round in multi-GPU) instead of max_path_length
+// rounds. The look-ups are processed in batches of destinations to bound the temporary memory.
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, vertex_t> extract_bfs_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  vertex_t const* distances,
+  vertex_t const* predecessors,
+  vertex_t const* destinations,
+  size_t n_destinations,
+  std::optional<size_t> max_destinations_per_batch)
+{
+  CUGRAPH_EXPECTS((graph_view.local_vertex_partition_range_size() == 0) || (distances != nullptr),
+                  "Invalid input argument: distances cannot be null");
+  CUGRAPH_EXPECTS(
+    (graph_view.local_vertex_partition_range_size() == 0) || (predecessors != nullptr),
+    "Invalid input argument: predecessors cannot be null");
+
+  CUGRAPH_EXPECTS((n_destinations == 0) || (destinations != nullptr),
+                  "Invalid input argument: destinations cannot be null");
+  CUGRAPH_EXPECTS(!max_destinations_per_batch || (*max_destinations_per_batch > 0),
+                  "Invalid input argument: max_destinations_per_batch should be positive.");
+
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition_device_view(
+    graph_view.local_vertex_partition_view());
+
+  if constexpr (multi_gpu) {
+    CUGRAPH_EXPECTS(0 == thrust::count_if(handle.get_thrust_policy(),
+                                          destinations,
+                                          destinations + n_destinations,
+                                          [vertex_partition_device_view] __device__(auto v) {
+                                            return !vertex_partition_device_view.is_valid_vertex(v);
+                                          }),
+                    "Invalid input argument: destinations must be partitioned on the correct GPU");
+  }
+
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  // 1. place the destinations at their path offsets
+
+  rmm::device_uvector<vertex_t> last_offsets(n_destinations, handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    last_offsets.begin(),
+    last_offsets.end(),
+    detail::compute_path_last_offset<vertex_t, multi_gpu>{
+      vertex_partition_device_view, invalid_vertex, predecessors, distances, destinations});
+
+  vertex_t max_path_length = 1 + thrust::reduce(handle.get_thrust_policy(),
+                                                last_offsets.begin(),
+                                                last_offsets.end(),
+                                                vertex_t{0},
+                                                detail::compute_max<vertex_t>{});
+
+  auto batch_size  = std::max(
+    max_destinations_per_batch ? *max_destinations_per_batch : n_destinations, size_t{1});
+  auto num_batches = (n_destinations + (batch_size - 1)) / batch_size;
+
+  if constexpr (multi_gpu) {
+    host_scalar_allreduce_batch_t<size_t> maxima(
+      handle.get_comms(), raft::comms::op_t::MAX, handle.get_stream());
+    maxima.add(static_cast<size_t>(max_path_length));
+    maxima.add(num_batches);
+    auto reduced    = maxima.flush();
+    max_path_length = static_cast<vertex_t>(reduced[0]);
+    num_batches     = reduced[1];
+  }
+
+  rmm::device_uvector<vertex_t> paths(n_destinations * max_path_length, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), paths.begin(), paths.end(), invalid_vertex);
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(n_destinations),
+                   [paths = paths.data(),
+                    last_offsets = last_offsets.data(),
+                    destinations,
+                    max_path_length] __device__(size_t idx) {
+                     paths[idx * max_path_length + last_offsets[idx]] = destinations[idx];
+                   });
+
+  // 2. pointer jumping
+
+  auto h_vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+
+  rmm::device_uvector<vertex_t> jumps(graph_view.local_vertex_partition_range_size(),
+                                      handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), predecessors, predecessors + jumps.size(), jumps.begin());
+
+  auto lookup_jumps = [&](rmm::device_uvector<vertex_t> const& vertices) {
+    rmm::device_uvector<vertex_t> ancestors(0, handle.get_stream());
+    if constexpr (multi_gpu) {
+      ancestors =
+        collect_values_for_int_vertices(handle.get_comms(),
+                                        vertices.begin(),
+                                        vertices.end(),
+                                        jumps.begin(),
+                                        h_vertex_partition_range_lasts,
+                                        graph_view.local_vertex_partition_range_first(),
+                                        handle.get_stream());
+    } else {
+      ancestors.resize(vertices.size(), handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        vertices.begin(),
+                        vertices.end(),
+                        ancestors.begin(),
+                        detail::sg_lookup_predecessor<vertex_t>{jumps.data()});
+    }
+    return ancestors;
+  };
+
+  for (vertex_t step = 1; step < max_path_length; step *= 2) {
+    for (size_t b = 0; b < num_batches; ++b) {
+      auto destination_first = std::min(b * batch_size, n_destinations);
+      auto destination_last  = std::min(destination_first + batch_size, n_destinations);
+      auto num_queries = (destination_last - destination_first) * static_cast<size_t>(step);
+
+      rmm::device_uvector<vertex_t> query_vertices(num_queries, handle.get_stream());
+      rmm::device_uvector<size_t> query_offsets(num_queries, handle.get_stream());
+      thrust::tabulate(handle.get_thrust_policy(),
+                       thrust::make_zip_iterator(query_vertices.begin(), query_offsets.begin()),
+                       thrust::make_zip_iterator(query_vertices.end(), query_offsets.end()),
+                       detail::pointer_jumping_query_t<vertex_t>{paths.data(),
+                                                                 last_offsets.data(),
+                                                                 destination_first,
+                                                                 max_path_length,
+                                                                 step,
+                                                                 invalid_vertex});
+      std::tie(query_vertices, query_offsets) = detail::shrink_extraction_list(
+        handle, std::move(query_vertices), std::move(query_offsets));
+
+      auto ancestors = lookup_jumps(query_vertices);
+      thrust::for_each_n(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(ancestors.begin(), query_offsets.begin())),
+        ancestors.size(),
+        detail::update_paths<vertex_t>{paths.data(), invalid_vertex});
+    }
+
+    if (step * 2 < max_path_length) {  // square the jump table for the next round
+      rmm::device_uvector<vertex_t> valid_jumps(jumps.size(), handle.get_stream());
+      rmm::device_uvector<size_t> valid_offsets(jumps.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(), jumps.begin(), jumps.end(), valid_jumps.begin());
+      thrust::sequence(
+        handle.get_thrust_policy(), valid_offsets.begin(), valid_offsets.end(), size_t{0});
+      std::tie(valid_jumps, valid_offsets) = detail::shrink_extraction_list(
+        handle, std::move(valid_jumps), std::move(valid_offsets));
+
+      auto ancestors = lookup_jumps(valid_jumps);
+      thrust::fill(handle.get_thrust_policy(), jumps.begin(), jumps.end(), invalid_vertex);
+      thrust::scatter(handle.get_thrust_policy(),
+                      ancestors.begin(),
+                      ancestors.end(),
+                      valid_offsets.begin(),
+                      jumps.begin());
+    }
+  }
+
+  return std::make_tuple(std::move(paths), max_path_length);
+}
+
 }  // namespace cugraph
@@ -28,4 +28,13 @@ template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
   int64_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<int64_t>, int64_t> extract_bfs_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, false, true> const& graph_view,
+  int64_t const* distances,
+  int64_t const* predecessors,
+  int64_t const* destinations,
+  size_t n_destinations,
+  std::optional<size_t> max_destinations_per_batch);
+
 }  // namespace cugraph
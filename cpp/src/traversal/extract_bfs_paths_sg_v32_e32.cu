@@ -28,4 +28,13 @@ template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
   int32_t const* destinations,
   size_t n_destinations);
 
+template std::tuple<rmm::device_uvector<int32_t>, int32_t> extract_bfs_paths(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  int32_t const* distances,
+  int32_t const* predecessors,
+  int32_t const* destinations,
+  size_t n_destinations,
+  std::optional<size_t> max_destinations_per_batch);
+
 }  // namespace cugraph
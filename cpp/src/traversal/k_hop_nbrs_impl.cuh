@@ -15,14 +15,19 @@
  */
 #pragma once
 
+#include "prims/key_store.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
 #include "prims/reduce_op.cuh"
 #include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
 #include "prims/vertex_frontier.cuh"
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 #include <cugraph/vertex_partition_device_view.cuh>
 
@@ -30,6 +35,7 @@
 
 #include <rmm/exec_policy.hpp>
 
+#include <cuda/atomic>
 #include <cuda/std/optional>
 #include <thrust/count.h>
 #include <thrust/fill.h>
@@ -37,10 +43,18 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 
@@ -73,20 +87,15 @@ struct compute_gpu_id_t {
 namespace detail {
 
 template <typename GraphViewType>
-std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<typename GraphViewType::vertex_type>>
-k_hop_nbrs(raft::handle_t const& handle,
-           GraphViewType const& push_graph_view,
-           raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
-           size_t k,
-           bool do_expensive_check)
+std::tuple<std::vector<size_t>, std::vector<size_t>> check_k_hop_nbrs_input(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
+  size_t k,
+  bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
 
-  static_assert(!GraphViewType::is_storage_transposed,
-                "GraphViewType should support the push model.");
-
-  // 1. check input arguments
-
   std::vector<size_t> start_vertex_counts{};
   if constexpr (GraphViewType::is_multi_gpu) {
     start_vertex_counts =
@@ -127,6 +136,27 @@ k_hop_nbrs(raft::handle_t const& handle,
                     "Invalid input argument: start_vertices have invalid vertex IDs.");
   }
 
+  return std::make_tuple(std::move(start_vertex_counts), std::move(start_vertex_displacements));
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<typename GraphViewType::vertex_type>>
+k_hop_nbrs(raft::handle_t const& handle,
+           GraphViewType const& push_graph_view,
+           raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
+           size_t k,
+           bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  auto [start_vertex_counts, start_vertex_displacements] =
+    check_k_hop_nbrs_input(handle, push_graph_view, start_vertices, k, do_expensive_check);
+
   // 2. initialize the frontier
 
   constexpr size_t bucket_idx_cur = 0;
@@ -223,6 +253,358 @@ k_hop_nbrs(raft::handle_t const& handle,
   return std::make_tuple(std::move(offsets), std::move(nbrs));
 }
 
+// Visited (start vertex index, vertex) pairs are tracked on the owner of the vertex, as a bitmap
+// over (start vertex index, local vertex) if the number of start vertices is small enough to keep
+// the bitmap within a few words per local vertex and as a hash set otherwise.
+constexpr size_t k_hop_visited_bitmap_max_start_vertices = 128;
+
+template <typename GraphViewType>
+void k_hop_nbrs_streamed(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
+  size_t k,
+  typename k_hop_nbrs_callback<typename GraphViewType::vertex_type>::type const& hop_callback,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  auto [start_vertex_counts, start_vertex_displacements] =
+    check_k_hop_nbrs_input(handle, push_graph_view, start_vertices, k, do_expensive_check);
+  auto num_start_vertices = start_vertex_displacements.back() + start_vertex_counts.back();
+  auto start_vertex_index_first =
+    start_vertex_displacements[GraphViewType::is_multi_gpu ? handle.get_comms().get_rank() : 0];
+
+  rmm::device_uvector<size_t> lasts(0, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    lasts.resize(handle.get_comms().get_size(), handle.get_stream());
+    raft::update_device(lasts.data(),
+                        start_vertex_displacements.data() + 1,
+                        start_vertex_displacements.size() - 1,
+                        handle.get_stream());
+    lasts.set_element(lasts.size() - 1, num_start_vertices, handle.get_stream());
+  }
+
+  // 2. initialize the frontier and the visited set
+
+  auto local_vertex_first = push_graph_view.local_vertex_partition_range_first();
+  auto local_vertex_size =
+    static_cast<size_t>(push_graph_view.local_vertex_partition_range_size());
+  auto to_key = [local_vertex_first, local_vertex_size] __device__(auto tagged_v) {
+    return thrust::get<1>(tagged_v) * local_vertex_size +
+           static_cast<size_t>(thrust::get<0>(tagged_v) - local_vertex_first);
+  };
+
+  std::optional<rmm::device_uvector<uint32_t>> visited_bitmap{std::nullopt};
+  std::optional<key_store_t<size_t, false>> visited_set{std::nullopt};
+  if (num_start_vertices <= k_hop_visited_bitmap_max_start_vertices) {
+    visited_bitmap = rmm::device_uvector<uint32_t>(
+      packed_bool_size(num_start_vertices * local_vertex_size), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 visited_bitmap->begin(),
+                 visited_bitmap->end(),
+                 packed_bool_empty_mask());
+  } else {
+    visited_set.emplace(
+      start_vertices.size(), std::numeric_limits<size_t>::max(), handle.get_stream());
+  }
+
+  auto insert_visited = [&](auto key_first, auto key_last) {
+    auto num_keys = static_cast<size_t>(thrust::distance(key_first, key_last));
+    if (visited_bitmap) {
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        key_first,
+        key_last,
+        [bitmap = raft::device_span<uint32_t>(visited_bitmap->data(),
+                                              visited_bitmap->size())] __device__(size_t key) {
+          cuda::atomic_ref<uint32_t, cuda::thread_scope_device> word(
+            bitmap[packed_bool_offset(key)]);
+          word.fetch_or(packed_bool_mask(key), cuda::std::memory_order_relaxed);
+        });
+    } else {
+      if (visited_set->size() + num_keys > visited_set->capacity()) {
+        auto keys = visited_set->release(handle.get_stream());
+        visited_set.emplace((keys.size() + num_keys) * 2,
+                            std::numeric_limits<size_t>::max(),
+                            handle.get_stream());
+        visited_set->insert(keys.begin(), keys.end(), handle.get_stream());
+      }
+      visited_set->insert(key_first, key_last, handle.get_stream());
+    }
+  };
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, size_t, GraphViewType::is_multi_gpu, false> frontier(handle,
+                                                                                   num_buckets);
+
+  {
+    auto tagged_start_first =
+      thrust::make_zip_iterator(start_vertices.begin(),
+                                thrust::make_counting_iterator(start_vertex_index_first));
+    frontier.bucket(bucket_idx_cur)
+      .insert(tagged_start_first, tagged_start_first + start_vertices.size());
+
+    rmm::device_uvector<size_t> keys(start_vertices.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      tagged_start_first,
+                      tagged_start_first + start_vertices.size(),
+                      keys.begin(),
+                      to_key);
+    insert_visited(keys.begin(), keys.end());
+  }
+
+  // 3. K-hop nbrs iteration, each hop reports only the vertices not visited in the previous hops
+
+  for (size_t hop = 1; hop <= k; ++hop) {
+    auto [nbrs, start_vertex_indices] =
+      cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                             push_graph_view,
+                                                             frontier.bucket(bucket_idx_cur),
+                                                             edge_src_dummy_property_t{}.view(),
+                                                             edge_dst_dummy_property_t{}.view(),
+                                                             edge_dummy_property_t{}.view(),
+                                                             e_op_t<vertex_t>{},
+                                                             reduce_op::null{},
+                                                             do_expensive_check);
+
+    auto pair_first = thrust::make_zip_iterator(nbrs.begin(), start_vertex_indices.begin());
+    thrust::sort(handle.get_thrust_policy(), pair_first, pair_first + nbrs.size());
+    auto num_pairs = static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::unique(handle.get_thrust_policy(), pair_first, pair_first + nbrs.size())));
+
+    rmm::device_uvector<size_t> keys(num_pairs, handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(), pair_first, pair_first + num_pairs, keys.begin(), to_key);
+    rmm::device_uvector<bool> visited_flags(num_pairs, handle.get_stream());
+    if (visited_bitmap) {
+      thrust::transform(
+        handle.get_thrust_policy(),
+        keys.begin(),
+        keys.end(),
+        visited_flags.begin(),
+        [bitmap = raft::device_span<uint32_t const>(
+           visited_bitmap->data(), visited_bitmap->size())] __device__(size_t key) {
+          return (bitmap[packed_bool_offset(key)] & packed_bool_mask(key)) != 0;
+        });
+    } else {
+      visited_set->view().contains(
+        keys.begin(), keys.end(), visited_flags.begin(), handle.get_stream());
+    }
+    auto triplet_first =
+      thrust::make_zip_iterator(nbrs.begin(), start_vertex_indices.begin(), keys.begin());
+    num_pairs = static_cast<size_t>(
+      thrust::distance(triplet_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         triplet_first,
+                                         triplet_first + num_pairs,
+                                         visited_flags.begin(),
+                                         thrust::identity<bool>{})));
+    visited_flags.resize(0, handle.get_stream());
+    visited_flags.shrink_to_fit(handle.get_stream());
+    nbrs.resize(num_pairs, handle.get_stream());
+    start_vertex_indices.resize(num_pairs, handle.get_stream());
+    keys.resize(num_pairs, handle.get_stream());
+
+    insert_visited(keys.begin(), keys.end());
+    keys.resize(0, handle.get_stream());
+    keys.shrink_to_fit(handle.get_stream());
+
+    frontier.bucket(bucket_idx_cur).clear();
+    if (hop < k) {
+      frontier.bucket(bucket_idx_cur).insert(pair_first, pair_first + num_pairs);
+    }
+    frontier.bucket(bucket_idx_cur).shrink_to_fit();
+
+    // stream this hop's (start vertex index, neighbor) pairs out (to the GPUs owning the start
+    // vertices)
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      std::tie(start_vertex_indices, nbrs, std::ignore) = groupby_gpu_id_and_shuffle_kv_pairs(
+        handle.get_comms(),
+        start_vertex_indices.begin(),
+        start_vertex_indices.end(),
+        nbrs.begin(),
+        compute_gpu_id_t{raft::device_span<size_t>(lasts.data(), lasts.size())},
+        handle.get_stream());
+    }
+    thrust::transform(handle.get_thrust_policy(),
+                      start_vertex_indices.begin(),
+                      start_vertex_indices.end(),
+                      start_vertex_indices.begin(),
+                      shift_left_t<size_t>{start_vertex_index_first});
+    thrust::sort(handle.get_thrust_policy(),
+                 thrust::make_zip_iterator(start_vertex_indices.begin(), nbrs.begin()),
+                 thrust::make_zip_iterator(start_vertex_indices.end(), nbrs.end()));
+    hop_callback(
+      hop,
+      raft::device_span<size_t const>(start_vertex_indices.data(), start_vertex_indices.size()),
+      raft::device_span<vertex_t const>(nbrs.data(), nbrs.size()));
+
+    if (hop < k && frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+struct two_hop_walk_count_e_op_t {
+  __device__ size_t operator()(
+    vertex_t, vertex_t, cuda::std::nullopt_t, edge_t dst_out_degree, cuda::std::nullopt_t) const
+  {
+    return static_cast<size_t>(dst_out_degree);
+  }
+};
+
+template <typename GraphViewType>
+rmm::device_uvector<size_t> two_hop_nbr_count_upper_bounds(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  check_k_hop_nbrs_input(handle, push_graph_view, start_vertices, size_t{2}, do_expensive_check);
+
+  // the number of two-hop walks from v (sum of the out-degrees of v's out-neighbors) bounds the
+  // number of two-hop neighbors of v
+
+  auto out_degrees = push_graph_view.compute_out_degrees(handle);
+  edge_dst_property_t<GraphViewType, edge_t> edge_dst_out_degrees(handle, push_graph_view);
+  update_edge_dst_property(
+    handle, push_graph_view, out_degrees.begin(), edge_dst_out_degrees.mutable_view());
+  out_degrees.resize(0, handle.get_stream());
+  out_degrees.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> walk_counts(push_graph_view.local_vertex_partition_range_size(),
+                                          handle.get_stream());
+  per_v_transform_reduce_outgoing_e(handle,
+                                    push_graph_view,
+                                    edge_src_dummy_property_t{}.view(),
+                                    edge_dst_out_degrees.view(),
+                                    edge_dummy_property_t{}.view(),
+                                    two_hop_walk_count_e_op_t<vertex_t, edge_t>{},
+                                    size_t{0},
+                                    reduce_op::plus<size_t>{},
+                                    walk_counts.begin());
+
+  rmm::device_uvector<size_t> upper_bounds(start_vertices.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    start_vertices.begin(),
+                    start_vertices.end(),
+                    upper_bounds.begin(),
+                    [walk_counts = walk_counts.data(),
+                     v_first = push_graph_view.local_vertex_partition_range_first()] __device__(
+                      auto v) { return walk_counts[v - v_first]; });
+
+  return upper_bounds;
+}
+
+// Two-hop neighbors for chunks of start vertices, each chunk's two-hop walk count upper bound is
+// no larger than max_chunk_size (except for a chunk holding a single start vertex exceeding the
+// limit), so the intermediate (start vertex, neighbor) pairs of a chunk stay within the caller's
+// budget. The edge scans of each chunk are load balanced by the vertex frontier prims (high-degree
+// frontier vertices are processed by a thread block or a warp).
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<typename GraphViewType::vertex_type>>
+two_hop_nbrs(raft::handle_t const& handle,
+             GraphViewType const& push_graph_view,
+             raft::device_span<typename GraphViewType::vertex_type const> start_vertices,
+             size_t max_chunk_size,
+             bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  CUGRAPH_EXPECTS(max_chunk_size > 0,
+                  "Invalid input argument: max_chunk_size should be a positive integer.");
+
+  auto upper_bounds =
+    two_hop_nbr_count_upper_bounds(handle, push_graph_view, start_vertices, do_expensive_check);
+  thrust::inclusive_scan(
+    handle.get_thrust_policy(), upper_bounds.begin(), upper_bounds.end(), upper_bounds.begin());
+  std::vector<size_t> h_upper_bound_sums(upper_bounds.size());
+  raft::update_host(
+    h_upper_bound_sums.data(), upper_bounds.data(), upper_bounds.size(), handle.get_stream());
+  handle.sync_stream();
+  upper_bounds.resize(0, handle.get_stream());
+  upper_bounds.shrink_to_fit(handle.get_stream());
+
+  std::vector<size_t> h_chunk_offsets{0};
+  while (h_chunk_offsets.back() < h_upper_bound_sums.size()) {
+    auto first = h_chunk_offsets.back();
+    auto base  = first > 0 ? h_upper_bound_sums[first - 1] : size_t{0};
+    auto last  = static_cast<size_t>(std::distance(
+      h_upper_bound_sums.begin(),
+      std::upper_bound(
+        h_upper_bound_sums.begin() + first, h_upper_bound_sums.end(), base + max_chunk_size)));
+    h_chunk_offsets.push_back(std::max(last, first + 1));
+  }
+  auto num_chunks = h_chunk_offsets.size() - 1;
+  if constexpr (GraphViewType::is_multi_gpu) {
+    num_chunks = host_scalar_allreduce(
+      handle.get_comms(), num_chunks, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  std::vector<rmm::device_uvector<size_t>> chunk_offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> chunk_nbrs{};
+  chunk_offsets.reserve(num_chunks);
+  chunk_nbrs.reserve(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto chunk_first = i < h_chunk_offsets.size() - 1 ? h_chunk_offsets[i] : start_vertices.size();
+    auto chunk_last =
+      i < h_chunk_offsets.size() - 1 ? h_chunk_offsets[i + 1] : start_vertices.size();
+    auto [offsets, nbrs] = k_hop_nbrs(
+      handle,
+      push_graph_view,
+      raft::device_span<vertex_t const>(start_vertices.data() + chunk_first,
+                                        chunk_last - chunk_first),
+      size_t{2},
+      false);
+    chunk_offsets.push_back(std::move(offsets));
+    chunk_nbrs.push_back(std::move(nbrs));
+  }
+
+  size_t num_nbrs{0};
+  for (auto const& nbrs : chunk_nbrs) {
+    num_nbrs += nbrs.size();
+  }
+  rmm::device_uvector<size_t> offsets(start_vertices.size() + 1, handle.get_stream());
+  rmm::device_uvector<vertex_t> nbrs(num_nbrs, handle.get_stream());
+  offsets.set_element_to_zero_async(0, handle.get_stream());
+  size_t offset_first{0};
+  size_t nbr_first{0};
+  for (size_t i = 0; i < num_chunks; ++i) {
+    thrust::transform(handle.get_thrust_policy(),
+                      chunk_offsets[i].begin() + 1,
+                      chunk_offsets[i].end(),
+                      offsets.begin() + offset_first + 1,
+                      shift_right_t<size_t>{nbr_first});
+    thrust::copy(handle.get_thrust_policy(),
+                 chunk_nbrs[i].begin(),
+                 chunk_nbrs[i].end(),
+                 nbrs.begin() + nbr_first);
+    offset_first += chunk_offsets[i].size() - 1;
+    nbr_first += chunk_nbrs[i].size();
+    chunk_offsets[i].resize(0, handle.get_stream());
+    chunk_offsets[i].shrink_to_fit(handle.get_stream());
+    chunk_nbrs[i].resize(0, handle.get_stream());
+    chunk_nbrs[i].shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(offsets), std::move(nbrs));
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -236,4 +618,39 @@ std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> k_hop_nbr
   return detail::k_hop_nbrs(handle, graph_view, start_vertices, k, do_expensive_check);
 }
 
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void k_hop_nbrs_streamed(raft::handle_t const& handle,
+                         graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                         raft::device_span<vertex_t const> start_vertices,
+                         size_t k,
+                         typename k_hop_nbrs_callback<vertex_t>::type const& hop_callback,
+                         bool do_expensive_check)
+{
+  detail::k_hop_nbrs_streamed(
+    handle, graph_view, start_vertices, k, hop_callback, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+rmm::device_uvector<size_t> two_hop_nbr_count_upper_bounds(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> start_vertices,
+  bool do_expensive_check)
+{
+  return detail::two_hop_nbr_count_upper_bounds(
+    handle, graph_view, start_vertices, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>> two_hop_nbrs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> start_vertices,
+  size_t max_chunk_size,
+  bool do_expensive_check)
+{
+  return detail::two_hop_nbrs(
+    handle, graph_view, start_vertices, max_chunk_size, do_expensive_check);
+}
+
 }  // namespace cugraph
@@ -26,4 +26,25 @@ template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>> k
   size_t k,
   bool do_expensive_check);
 
+template void k_hop_nbrs_streamed(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t k,
+  k_hop_nbrs_callback<int32_t>::type const& hop_callback,
+  bool do_expensive_check);
+
+template rmm::device_uvector<size_t> two_hop_nbr_count_upper_bounds(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  raft::device_span<int32_t const> start_vertices,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>> two_hop_nbrs(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  raft::device_span<int32_t const> start_vertices,
+  size_t max_chunk_size,
+  bool do_expensive_check);
+
 }  // namespace cugraph
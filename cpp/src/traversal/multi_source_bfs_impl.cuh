@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "prims/reduce_op.cuh"
+#include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+#include "prims/vertex_frontier.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/vertex_partition_device_view.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/optional>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace {
+
+// one bit per source in a batch, the number of edge scans is reduced by a factor of the word width
+using ms_bfs_word_t = uint64_t;
+
+template <typename vertex_t>
+struct ms_bfs_e_op_t {
+  __device__ cuda::std::optional<ms_bfs_word_t> operator()(vertex_t,
+                                                           vertex_t,
+                                                           ms_bfs_word_t src_frontier_word,
+                                                           cuda::std::nullopt_t,
+                                                           cuda::std::nullopt_t) const
+  {
+    return src_frontier_word;
+  }
+};
+
+template <typename vertex_t>
+struct ms_bfs_init_sources_t {
+  raft::device_span<vertex_t const> sources{};
+  raft::device_span<ms_bfs_word_t> visited_words{};
+  raft::device_span<ms_bfs_word_t> frontier_words{};
+  size_t batch_first{};
+  vertex_t local_vertex_partition_range_first{};
+  vertex_t local_vertex_partition_range_last{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v = sources[batch_first + i];
+    if ((v >= local_vertex_partition_range_first) && (v < local_vertex_partition_range_last)) {
+      auto v_offset = v - local_vertex_partition_range_first;
+      auto mask     = ms_bfs_word_t{1} << i;
+      cuda::atomic_ref<ms_bfs_word_t, cuda::thread_scope_device> visited(visited_words[v_offset]);
+      visited.fetch_or(mask, cuda::std::memory_order_relaxed);
+      cuda::atomic_ref<ms_bfs_word_t, cuda::thread_scope_device> frontier(
+        frontier_words[v_offset]);
+      frontier.fetch_or(mask, cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+// keys are unique, so every (vertex, reached bits) pair updates its own vertex without atomics
+template <typename vertex_t>
+struct ms_bfs_update_t {
+  vertex_t const* keys{};
+  ms_bfs_word_t const* reached_words{};
+  raft::device_span<ms_bfs_word_t> visited_words{};
+  raft::device_span<ms_bfs_word_t> frontier_words{};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v_offset = keys[i] - local_vertex_partition_range_first;
+    auto new_bits = reached_words[i] & ~visited_words[v_offset];
+    visited_words[v_offset] |= new_bits;
+    frontier_words[v_offset] = new_bits;
+  }
+};
+
+template <typename vertex_t>
+struct ms_bfs_has_frontier_bits_t {
+  raft::device_span<ms_bfs_word_t const> frontier_words{};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return frontier_words[v - local_vertex_partition_range_first] != ms_bfs_word_t{0};
+  }
+};
+
+template <typename vertex_t>
+struct ms_bfs_frontier_bit_count_t {
+  raft::device_span<ms_bfs_word_t const> frontier_words{};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ size_t operator()(vertex_t v) const
+  {
+    return static_cast<size_t>(__popcll(static_cast<unsigned long long>(
+      frontier_words[v - local_vertex_partition_range_first])));
+  }
+};
+
+// store a (source index, vertex, distance) triplet per frontier bit of each frontier vertex
+template <typename vertex_t>
+struct ms_bfs_store_reached_t {
+  vertex_t const* frontier_vertices{};
+  size_t const* output_offsets{};
+  raft::device_span<ms_bfs_word_t const> frontier_words{};
+  size_t* source_indices{};
+  vertex_t* vertices{};
+  vertex_t* distances{};
+  size_t batch_first{};
+  vertex_t local_vertex_partition_range_first{};
+  vertex_t depth{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v      = frontier_vertices[i];
+    auto bits   = frontier_words[v - local_vertex_partition_range_first];
+    auto offset = output_offsets[i];
+    while (bits != ms_bfs_word_t{0}) {
+      auto j                 = __ffsll(static_cast<unsigned long long>(bits)) - 1;
+      source_indices[offset] = batch_first + j;
+      vertices[offset]       = v;
+      distances[offset]      = depth;
+      ++offset;
+      bits &= bits - 1;
+    }
+  }
+};
+
+// append the vertices reached (for the first time) at depth to the output triplets
+template <typename vertex_t>
+void append_ms_bfs_reached(raft::handle_t const& handle,
+                           raft::device_span<vertex_t const> frontier_vertices,
+                           raft::device_span<ms_bfs_word_t const> frontier_words,
+                           size_t batch_first,
+                           vertex_t local_vertex_partition_range_first,
+                           vertex_t depth,
+                           rmm::device_uvector<size_t>& source_indices,
+                           rmm::device_uvector<vertex_t>& vertices,
+                           rmm::device_uvector<vertex_t>& distances)
+{
+  rmm::device_uvector<size_t> output_offsets(frontier_vertices.size() + 1, handle.get_stream());
+  output_offsets.set_element_to_zero_async(0, handle.get_stream());
+  auto count_first = thrust::make_transform_iterator(
+    frontier_vertices.begin(),
+    ms_bfs_frontier_bit_count_t<vertex_t>{frontier_words, local_vertex_partition_range_first});
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         count_first,
+                         count_first + frontier_vertices.size(),
+                         output_offsets.begin() + 1);
+  auto num_reached = output_offsets.back_element(handle.get_stream());
+
+  auto old_size = vertices.size();
+  if (old_size + num_reached > vertices.capacity()) {
+    // grow geometrically, the number of triplets is unknown until the traversal finishes
+    auto new_capacity = std::max(old_size + num_reached, vertices.capacity() * 2);
+    source_indices.reserve(new_capacity, handle.get_stream());
+    vertices.reserve(new_capacity, handle.get_stream());
+    distances.reserve(new_capacity, handle.get_stream());
+  }
+  source_indices.resize(old_size + num_reached, handle.get_stream());
+  vertices.resize(old_size + num_reached, handle.get_stream());
+  distances.resize(old_size + num_reached, handle.get_stream());
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(frontier_vertices.size()),
+                   ms_bfs_store_reached_t<vertex_t>{frontier_vertices.data(),
+                                                    output_offsets.data(),
+                                                    frontier_words,
+                                                    source_indices.data() + old_size,
+                                                    vertices.data() + old_size,
+                                                    distances.data() + old_size,
+                                                    batch_first,
+                                                    local_vertex_partition_range_first,
+                                                    depth});
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+multi_source_bfs(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> sources,
+  typename GraphViewType::vertex_type depth_limit,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  constexpr size_t sources_per_batch = sizeof(ms_bfs_word_t) * 8;
+
+  auto local_vertex_partition_range_size = graph_view.local_vertex_partition_range_size();
+
+  // 1. check input arguments
+
+  if (do_expensive_check) {
+    auto num_vertices         = graph_view.number_of_vertices();
+    auto num_invalid_vertices = thrust::count_if(
+      handle.get_thrust_policy(),
+      sources.begin(),
+      sources.end(),
+      [num_vertices] __device__(auto v) { return (v < 0) || (v >= num_vertices); });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+
+      auto min_num_sources = host_scalar_allreduce(
+        handle.get_comms(), sources.size(), raft::comms::op_t::MIN, handle.get_stream());
+      auto max_num_sources = host_scalar_allreduce(
+        handle.get_comms(), sources.size(), raft::comms::op_t::MAX, handle.get_stream());
+      CUGRAPH_EXPECTS(min_num_sources == max_num_sources,
+                      "Invalid input argument: sources should be identical in every GPU.");
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+  }
+
+  // 2. initialize the output (source index, vertex, distance) triplets of the reached vertices
+
+  rmm::device_uvector<size_t> source_indices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> distances(0, handle.get_stream());
+
+  if (sources.size() == 0) {
+    return std::make_tuple(std::move(source_indices), std::move(vertices), std::move(distances));
+  }
+
+  // 3. run one traversal per batch of sources_per_batch sources, a vertex frontier word holds the
+  // bits of the sources that reached the vertex in the previous iteration
+
+  rmm::device_uvector<ms_bfs_word_t> visited_words(local_vertex_partition_range_size,
+                                                   handle.get_stream());
+  rmm::device_uvector<ms_bfs_word_t> frontier_words(local_vertex_partition_range_size,
+                                                    handle.get_stream());
+  edge_src_property_t<GraphViewType, ms_bfs_word_t> edge_src_frontier_words(handle, graph_view);
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
+                                                                                       num_buckets);
+
+  for (size_t batch_first = 0; batch_first < sources.size(); batch_first += sources_per_batch) {
+    auto batch_size = std::min(sources_per_batch, sources.size() - batch_first);
+
+    thrust::fill(handle.get_thrust_policy(),
+                 visited_words.begin(),
+                 visited_words.end(),
+                 ms_bfs_word_t{0});
+    thrust::fill(handle.get_thrust_policy(),
+                 frontier_words.begin(),
+                 frontier_words.end(),
+                 ms_bfs_word_t{0});
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(batch_size),
+      ms_bfs_init_sources_t<vertex_t>{
+        sources,
+        raft::device_span<ms_bfs_word_t>(visited_words.data(), visited_words.size()),
+        raft::device_span<ms_bfs_word_t>(frontier_words.data(), frontier_words.size()),
+        batch_first,
+        graph_view.local_vertex_partition_range_first(),
+        graph_view.local_vertex_partition_range_last()});
+
+    rmm::device_uvector<vertex_t> frontier_vertices(local_vertex_partition_range_size,
+                                                    handle.get_stream());
+    frontier_vertices.resize(
+      thrust::distance(
+        frontier_vertices.begin(),
+        thrust::copy_if(
+          handle.get_thrust_policy(),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+          thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+          frontier_vertices.begin(),
+          ms_bfs_has_frontier_bits_t<vertex_t>{
+            raft::device_span<ms_bfs_word_t const>(frontier_words.data(), frontier_words.size()),
+            graph_view.local_vertex_partition_range_first()})),
+      handle.get_stream());
+    append_ms_bfs_reached(
+      handle,
+      raft::device_span<vertex_t const>(frontier_vertices.data(), frontier_vertices.size()),
+      raft::device_span<ms_bfs_word_t const>(frontier_words.data(), frontier_words.size()),
+      batch_first,
+      graph_view.local_vertex_partition_range_first(),
+      vertex_t{0},
+      source_indices,
+      vertices,
+      distances);
+    vertex_frontier.bucket(bucket_idx_cur) =
+      key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
+        handle, std::move(frontier_vertices));
+
+    vertex_t depth{0};
+    while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+      if (depth >= depth_limit) { break; }
+
+      update_edge_src_property(handle,
+                               graph_view,
+                               vertex_frontier.bucket(bucket_idx_cur).begin(),
+                               vertex_frontier.bucket(bucket_idx_cur).end(),
+                               frontier_words.begin(),
+                               edge_src_frontier_words.mutable_view());
+
+      auto [reached_vertices, reached_words] =
+        cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
+          handle,
+          graph_view,
+          vertex_frontier.bucket(bucket_idx_cur),
+          edge_src_frontier_words.view(),
+          edge_dst_dummy_property_t{}.view(),
+          edge_dummy_property_t{}.view(),
+          ms_bfs_e_op_t<vertex_t>{},
+          reduce_op::bitwise_or<ms_bfs_word_t>());
+
+      thrust::fill(handle.get_thrust_policy(),
+                   frontier_words.begin(),
+                   frontier_words.end(),
+                   ms_bfs_word_t{0});
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(reached_vertices.size()),
+        ms_bfs_update_t<vertex_t>{
+          reached_vertices.data(),
+          reached_words.data(),
+          raft::device_span<ms_bfs_word_t>(visited_words.data(), visited_words.size()),
+          raft::device_span<ms_bfs_word_t>(frontier_words.data(), frontier_words.size()),
+          graph_view.local_vertex_partition_range_first()});
+
+      reached_vertices.resize(
+        thrust::distance(
+          reached_vertices.begin(),
+          thrust::remove_if(
+            handle.get_thrust_policy(),
+            reached_vertices.begin(),
+            reached_vertices.end(),
+            [pred = ms_bfs_has_frontier_bits_t<vertex_t>{
+               raft::device_span<ms_bfs_word_t const>(frontier_words.data(),
+                                                      frontier_words.size()),
+               graph_view.local_vertex_partition_range_first()}] __device__(auto v) {
+              return !pred(v);
+            })),
+        handle.get_stream());
+      append_ms_bfs_reached(
+        handle,
+        raft::device_span<vertex_t const>(reached_vertices.data(), reached_vertices.size()),
+        raft::device_span<ms_bfs_word_t const>(frontier_words.data(), frontier_words.size()),
+        batch_first,
+        graph_view.local_vertex_partition_range_first(),
+        depth + 1,
+        source_indices,
+        vertices,
+        distances);
+      vertex_frontier.bucket(bucket_idx_cur) =
+        key_bucket_t<vertex_t, void, GraphViewType::is_multi_gpu, true>(
+          handle, std::move(reached_vertices));
+
+      ++depth;
+    }
+  }
+
+  source_indices.shrink_to_fit(handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+  distances.shrink_to_fit(handle.get_stream());
+
+  return std::make_tuple(std::move(source_indices), std::move(vertices), std::move(distances));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+multi_source_bfs(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  vertex_t depth_limit,
+  bool do_expensive_check)
+{
+  return detail::multi_source_bfs(handle, graph_view, sources, depth_limit, do_expensive_check);
+}
+
+}  // namespace cugraph
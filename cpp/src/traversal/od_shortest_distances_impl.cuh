@@ -37,17 +37,23 @@
 #include <raft/util/cudart_utils.hpp>
 #include <raft/util/integer_utils.hpp>
 
+#include <cuda/functional>
 #include <cuda/std/optional>
+#include <thrust/copy.h>
 #include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/set_operations.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <limits>
+#include <optional>
 
 CUCO_DECLARE_BITWISE_COMPARABLE(float)
 CUCO_DECLARE_BITWISE_COMPARABLE(double)
@@ -132,6 +138,11 @@ struct e_op_t {
   tag_t num_origins{};
   weight_t cutoff{};
   weight_t invalid_distance{};
+  // lower bounds of the distances from each vertex to the (nearest) destination & upper bounds of
+  // the distances from each origin to the (farthest) destination, empty if landmark distances are
+  // not provided
+  raft::device_span<weight_t const> lower_bounds{};
+  raft::device_span<weight_t const> upper_bounds{};
 
   __device__ cuda::std::optional<thrust::tuple<tag_t, weight_t>> operator()(
     thrust::tuple<vertex_t, tag_t> tagged_src,
@@ -149,6 +160,11 @@ struct e_op_t {
     auto threshold    = cutoff;
     auto dst_val      = key_to_dist_map.find(aggregator(thrust::make_tuple(dst, origin_idx)));
     if (dst_val != invalid_distance) { threshold = dst_val < threshold ? dst_val : threshold; }
+    if (lower_bounds.size() > 0) {  // dst can't be on a path improving any (origin, destination)
+      if (new_distance + lower_bounds[dst] >= upper_bounds[origin_idx]) {
+        return cuda::std::nullopt;
+      }
+    }
     return (new_distance < threshold)
              ? cuda::std::optional<thrust::tuple<tag_t, weight_t>>{thrust::make_tuple(origin_idx,
                                                                                       new_distance)}
@@ -156,6 +172,32 @@ struct e_op_t {
   }
 };
 
+// ALT (A*, landmarks, and triangle inequality) lower bound of the distance from v to the nearest
+// destination, d(v, t) >= d(l, t) - d(l, v) for every landmark l and destination t
+template <typename vertex_t, typename weight_t>
+struct compute_landmark_lower_bound_t {
+  raft::device_span<weight_t const> landmark_distances{};  // landmark-major
+  raft::device_span<weight_t const>
+    min_landmark_to_destination_distances{};  // min_t d(l, t) for each landmark l
+  vertex_t num_vertices{};
+
+  __device__ weight_t operator()(vertex_t v) const
+  {
+    auto constexpr max_distance = std::numeric_limits<weight_t>::max();
+    weight_t lower_bound{0.0};
+    for (size_t l = 0; l < min_landmark_to_destination_distances.size(); ++l) {
+      auto d_lv = landmark_distances[l * static_cast<size_t>(num_vertices) + v];
+      auto d_lt = min_landmark_to_destination_distances[l];
+      if (d_lv == max_distance) { continue; }  // no bound
+      if (d_lt == max_distance) {
+        return max_distance;  // l reaches v but no destination, so v can't reach any destination
+      }
+      lower_bound = cuda::std::max(lower_bound, d_lt - d_lv);
+    }
+    return lower_bound;
+  }
+};
+
 template <typename vertex_t, typename edge_t, typename tag_t, typename key_t>
 struct insert_nbr_key_t {
   raft::device_span<edge_t const> offsets{};
@@ -411,6 +453,7 @@ rmm::device_uvector<weight_t> od_shortest_distances(
   edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
   raft::device_span<typename GraphViewType::vertex_type const> origins,
   raft::device_span<typename GraphViewType::vertex_type const> destinations,
+  std::optional<raft::device_span<weight_t const>> landmark_distances,
   weight_t cutoff,
   weight_t delta,
   bool do_expensive_check)
@@ -429,6 +472,11 @@ rmm::device_uvector<weight_t> od_shortest_distances(
   // concurrently runs multiple instances of the Near-Far Pile method in
   // A. Davidson, S. Baxter, M. Garland, and J. D. Owens, "Work-efficient parallel GPU methods for
   // single-source shortest paths," 2014.
+  //
+  // If landmark distances are provided, (origin, vertex) pairs that can't be on a path improving
+  // any (origin, destination) distance are pruned using the ALT lower bounds in
+  // A. V. Goldberg and C. Harrelson, "Computing the shortest path: A* search meets graph theory,"
+  // 2005. This reduces the number of (origin, vertex) pairs inserted to key_to_dist_map.
 
   // 1. check input arguments
 
@@ -552,6 +600,48 @@ rmm::device_uvector<weight_t> od_shortest_distances(
                      raft::device_span<od_idx_t>(v_to_destination_indices.data(),
                                                  v_to_destination_indices.size())});
 
+  // 3-1. compute the landmark lower bounds (per vertex) & initialize the upper bounds (per origin)
+
+  rmm::device_uvector<weight_t> lower_bounds(0, handle.get_stream());
+  rmm::device_uvector<weight_t> upper_bounds(0, handle.get_stream());
+  if (landmark_distances) {
+    auto num_landmarks = (*landmark_distances).size() / static_cast<size_t>(num_vertices);
+
+    rmm::device_uvector<weight_t> min_landmark_to_destination_distances(num_landmarks,
+                                                                        handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_landmarks),
+      min_landmark_to_destination_distances.begin(),
+      cuda::proclaim_return_type<weight_t>(
+        [landmark_distances = *landmark_distances, destinations, num_vertices] __device__(
+          size_t l) {
+          auto min_distance = std::numeric_limits<weight_t>::max();
+          for (size_t i = 0; i < destinations.size(); ++i) {
+            min_distance = cuda::std::min(
+              min_distance,
+              landmark_distances[l * static_cast<size_t>(num_vertices) + destinations[i]]);
+          }
+          return min_distance;
+        }));
+
+    lower_bounds.resize(num_vertices, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_vertices),
+                      lower_bounds.begin(),
+                      compute_landmark_lower_bound_t<vertex_t, weight_t>{
+                        *landmark_distances,
+                        raft::device_span<weight_t const>(
+                          min_landmark_to_destination_distances.data(),
+                          min_landmark_to_destination_distances.size()),
+                        num_vertices});
+
+    upper_bounds.resize(origins.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), upper_bounds.begin(), upper_bounds.end(), cutoff);
+  }
+
   // 4. initialize SSSP frontier
 
   constexpr size_t bucket_idx_near = 0;
@@ -639,7 +729,9 @@ rmm::device_uvector<weight_t> od_shortest_distances(
         detail::kv_cuco_store_find_device_view_t(key_to_dist_map.view()),
         static_cast<od_idx_t>(origins.size()),
         cutoff,
-        invalid_distance};
+        invalid_distance,
+        raft::device_span<weight_t const>(lower_bounds.data(), lower_bounds.size()),
+        raft::device_span<weight_t const>(upper_bounds.data(), upper_bounds.size())};
       detail::transform_reduce_v_frontier_call_e_op_t<
         thrust::tuple<vertex_t, od_idx_t>,
         weight_t,
@@ -846,6 +938,33 @@ rmm::device_uvector<weight_t> od_shortest_distances(
       }
 
       if (num_aggregate_far_keys > 0) {  // near queue is empty, split the far queue
+        if (landmark_distances) {
+          // tighten the upper bounds, max_t od_matrix[o][t] (the current distance to the farthest
+          // destination)
+          auto num_destinations = destinations.size();
+          thrust::reduce_by_key(
+            handle.get_thrust_policy(),
+            thrust::make_transform_iterator(
+              thrust::make_counting_iterator(size_t{0}),
+              cuda::proclaim_return_type<size_t>(
+                [num_destinations] __device__(size_t i) { return i / num_destinations; })),
+            thrust::make_transform_iterator(
+              thrust::make_counting_iterator(od_matrix.size()),
+              cuda::proclaim_return_type<size_t>(
+                [num_destinations] __device__(size_t i) { return i / num_destinations; })),
+            od_matrix.begin(),
+            thrust::make_discard_iterator(),
+            upper_bounds.begin(),
+            thrust::equal_to<size_t>{},
+            thrust::maximum<weight_t>{});
+          thrust::transform(handle.get_thrust_policy(),
+                            upper_bounds.begin(),
+                            upper_bounds.end(),
+                            upper_bounds.begin(),
+                            cuda::proclaim_return_type<weight_t>(
+                              [cutoff] __device__(auto ub) { return cuda::std::min(ub, cutoff); }));
+        }
+
         std::vector<weight_t> invalid_thresholds(num_far_buffers);
         for (size_t i = 0; i < invalid_thresholds.size(); ++i) {
           invalid_thresholds[i] = (i == 0) ? near_far_threshold : next_far_thresholds[i - 1];
@@ -1047,12 +1166,23 @@ rmm::device_uvector<weight_t> od_shortest_distances(
   edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
   raft::device_span<vertex_t const> origins,
   raft::device_span<vertex_t const> destinations,
+  std::optional<raft::device_span<weight_t const>> landmark_distances,
+  std::optional<size_t> max_origins_per_batch,
   weight_t cutoff,
   bool do_expensive_check)
 {
   auto const num_vertices = graph_view.number_of_vertices();
   auto const num_edges    = graph_view.compute_number_of_edges(handle);
 
+  CUGRAPH_EXPECTS(
+    !landmark_distances ||
+      ((num_vertices > 0) &&
+       ((*landmark_distances).size() % static_cast<size_t>(num_vertices) == 0)),
+    "Invalid input argument: landmark_distances.size() should be a multiple of "
+    "graph_view.number_of_vertices().");
+  CUGRAPH_EXPECTS(!max_origins_per_batch || (*max_origins_per_batch > 0),
+                  "Invalid input argument: max_origins_per_batch should be positive.");
+
   weight_t average_vertex_degree =
     static_cast<weight_t>(num_edges) / static_cast<weight_t>(num_vertices);
   auto average_edge_weight = transform_reduce_e(
@@ -1082,15 +1212,96 @@ rmm::device_uvector<weight_t> od_shortest_distances(
   // reduction.
   auto delta = std::max(average_edge_weight * 0.5, std::numeric_limits<weight_t>::min() * 1e3);
 
-  return od_shortest_distances<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>(
-    handle,
-    graph_view,
-    edge_weight_view,
-    raft::device_span<vertex_t const>(origins.data(), origins.size()),
-    raft::device_span<vertex_t const>(destinations.data(), destinations.size()),
-    cutoff,
-    delta,
-    do_expensive_check);
+  auto batch_size = max_origins_per_batch ? *max_origins_per_batch : origins.size();
+  if (batch_size >= origins.size()) {
+    return od_shortest_distances<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>(
+      handle,
+      graph_view,
+      edge_weight_view,
+      origins,
+      destinations,
+      landmark_distances,
+      cutoff,
+      delta,
+      do_expensive_check);
+  }
+
+  // the peak memory usage (dominated by key_to_dist_map) grows with the number of origins searched
+  // concurrently, so process the origins in batches and fill the od_matrix rows of each batch
+
+  rmm::device_uvector<weight_t> od_matrix(origins.size() * destinations.size(),
+                                          handle.get_stream());
+  for (size_t batch_first = 0; batch_first < origins.size(); batch_first += batch_size) {
+    auto this_batch_size = std::min(batch_size, origins.size() - batch_first);
+    auto batch_od_matrix =
+      od_shortest_distances<graph_view_t<vertex_t, edge_t, false, multi_gpu>, weight_t>(
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<vertex_t const>(origins.data() + batch_first, this_batch_size),
+        destinations,
+        landmark_distances,
+        cutoff,
+        delta,
+        do_expensive_check);
+    thrust::copy(handle.get_thrust_policy(),
+                 batch_od_matrix.begin(),
+                 batch_od_matrix.end(),
+                 od_matrix.begin() + batch_first * destinations.size());
+  }
+
+  return od_matrix;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> od_shortest_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> origins,
+  raft::device_span<vertex_t const> destinations,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  return od_shortest_distances(handle,
+                               graph_view,
+                               edge_weight_view,
+                               origins,
+                               destinations,
+                               std::optional<raft::device_span<weight_t const>>{std::nullopt},
+                               std::optional<size_t>{std::nullopt},
+                               cutoff,
+                               do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<weight_t> compute_landmark_distances(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+  raft::device_span<vertex_t const> landmarks,
+  bool do_expensive_check)
+{
+  auto h_landmarks = std::vector<vertex_t>(landmarks.size());
+  raft::update_host(h_landmarks.data(), landmarks.data(), landmarks.size(), handle.get_stream());
+  handle.sync_stream();
+
+  auto num_local_vertices =
+    static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+  rmm::device_uvector<weight_t> landmark_distances(h_landmarks.size() * num_local_vertices,
+                                                   handle.get_stream());
+  for (size_t i = 0; i < h_landmarks.size(); ++i) {
+    sssp(handle,
+         graph_view,
+         edge_weight_view,
+         landmark_distances.data() + i * num_local_vertices,
+         static_cast<vertex_t*>(nullptr),
+         h_landmarks[i],
+         std::numeric_limits<weight_t>::max(),
+         do_expensive_check);
+  }
+
+  return landmark_distances;
 }
 
 }  // namespace cugraph
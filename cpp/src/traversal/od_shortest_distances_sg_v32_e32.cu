@@ -37,4 +37,40 @@ template rmm::device_uvector<double> od_shortest_distances(
   double cutoff,
   bool do_expensive_check);
 
+template rmm::device_uvector<float> od_shortest_distances(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  raft::device_span<int32_t const> origins,
+  raft::device_span<int32_t const> destinations,
+  std::optional<raft::device_span<float const>> landmark_distances,
+  std::optional<size_t> max_origins_per_batch,
+  float cutoff,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> od_shortest_distances(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  raft::device_span<int32_t const> origins,
+  raft::device_span<int32_t const> destinations,
+  std::optional<raft::device_span<double const>> landmark_distances,
+  std::optional<size_t> max_origins_per_batch,
+  double cutoff,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> compute_landmark_distances(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, float const*> edge_weight_view,
+  raft::device_span<int32_t const> landmarks,
+  bool do_expensive_check);
+
+template rmm::device_uvector<double> compute_landmark_distances(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, false, false> const& graph_view,
+  edge_property_view_t<int32_t, double const*> edge_weight_view,
+  raft::device_span<int32_t const> landmarks,
+  bool do_expensive_check);
+
 }  // namespace cugraph
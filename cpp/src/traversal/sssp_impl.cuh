@@ -17,6 +17,8 @@
 
 #include "prims/count_if_e.cuh"
 #include "prims/fill_edge_src_dst_property.cuh"
+#include "prims/kv_store.cuh"
+#include "prims/prefetch_frontier_edge_partitions.cuh"
 #include "prims/reduce_op.cuh"
 #include "prims/transform_reduce_e.cuh"
 #include "prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh"
@@ -27,20 +29,37 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/vertex_partition_device_view.cuh>
 
+#include <raft/core/device_span.hpp>
 #include <raft/util/cudart_utils.hpp>
 
+#include <cuda/atomic>
+#include <cuda/functional>
 #include <cuda/std/optional>
+#include <thrust/count.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
 
 namespace cugraph {
 
@@ -51,9 +70,12 @@ struct e_op_t {
   vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
   weight_t const* distances{};
   weight_t cutoff{};
+  // no need to push if the A* key (distance + heuristic) is no smaller than the largest target key
+  weight_t key_cutoff{std::numeric_limits<weight_t>::max()};
 
+  template <typename DstHeuristic>
   __device__ cuda::std::optional<thrust::tuple<weight_t, vertex_t>> operator()(
-    vertex_t src, vertex_t dst, weight_t src_val, cuda::std::nullopt_t, weight_t w) const
+    vertex_t src, vertex_t dst, weight_t src_val, DstHeuristic dst_heuristic, weight_t w) const
   {
     auto push         = true;
     auto new_distance = src_val + w;
@@ -65,12 +87,183 @@ struct e_op_t {
       threshold         = old_distance < threshold ? old_distance : threshold;
     }
     if (new_distance >= threshold) { push = false; }
+    if constexpr (!std::is_same_v<DstHeuristic, cuda::std::nullopt_t>) {
+      if (new_distance + dst_heuristic >= key_cutoff) { push = false; }
+    } else {
+      if (new_distance >= key_cutoff) { push = false; }
+    }
     return push ? cuda::std::optional<thrust::tuple<weight_t, vertex_t>>{thrust::make_tuple(
                     new_distance, src)}
                 : cuda::std::nullopt;
   }
 };
 
+// frontier vertices are tagged with their tentative distances (so no per-vertex distance array is
+// necessary to relax the out-going edges), returns (new distance, predecessor)
+template <typename vertex_t, typename weight_t>
+struct sparse_e_op_t {
+  weight_t cutoff{};
+
+  __device__ cuda::std::optional<thrust::tuple<weight_t, vertex_t>> operator()(
+    thrust::tuple<vertex_t, weight_t> tagged_src,
+    vertex_t,
+    cuda::std::nullopt_t,
+    cuda::std::nullopt_t,
+    weight_t w) const
+  {
+    auto new_distance = thrust::get<1>(tagged_src) + w;
+    return new_distance < cutoff ? cuda::std::optional<thrust::tuple<weight_t, vertex_t>>{
+                                     thrust::make_tuple(new_distance, thrust::get<0>(tagged_src))}
+                                 : cuda::std::nullopt;
+  }
+};
+
+// distance + heuristic (0 if heuristics is nullptr) of a local vertex, this is the A* key used to
+// assign vertices to the near & far piles
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+struct vertex_key_op_t {
+  vertex_partition_device_view_t<vertex_t, multi_gpu> vertex_partition{};
+  weight_t const* distances{};
+  weight_t const* heuristics{nullptr};
+
+  __device__ weight_t operator()(vertex_t v) const
+  {
+    auto offset = vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v);
+    auto dist   = *(distances + offset);
+    if ((heuristics != nullptr) && (dist != std::numeric_limits<weight_t>::max())) {
+      dist += *(heuristics + offset);
+    }
+    return dist;
+  }
+};
+
+// Returns the largest key of the targets (std::numeric_limits<weight_t>::max() if any target is not
+// reached yet), targets should be identical in every GPU
+template <typename GraphViewType, typename weight_t>
+weight_t compute_max_target_key(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> targets,
+  vertex_key_op_t<typename GraphViewType::vertex_type, weight_t, GraphViewType::is_multi_gpu>
+    key_op)
+{
+  auto max_key = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    targets.begin(),
+    targets.end(),
+    cuda::proclaim_return_type<weight_t>([key_op] __device__(auto v) {
+      return key_op.vertex_partition.in_local_vertex_partition_range_nocheck(v)
+               ? key_op(v)
+               : std::numeric_limits<weight_t>::lowest();
+    }),
+    std::numeric_limits<weight_t>::lowest(),
+    thrust::maximum<weight_t>{});
+  if constexpr (GraphViewType::is_multi_gpu) {
+    max_key = host_scalar_allreduce(
+      handle.get_comms(), max_key, raft::comms::op_t::MAX, handle.get_stream());
+  }
+  return max_key;
+}
+
+// Compute the next near-far threshold (in the adaptive delta mode) from a histogram of the
+// (non-stale) far bucket keys (distances if there is no heuristic), the threshold is set to the
+// smallest histogram bin boundary that moves at least target_near_size vertices (or all the
+// remaining far vertices if there are fewer) to the next near bucket. Returns std::nullopt if
+// there is no non-stale vertex in the far bucket.
+template <typename GraphViewType, typename weight_t>
+std::optional<weight_t> compute_adaptive_near_far_threshold(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> far_vertices,
+  vertex_key_op_t<typename GraphViewType::vertex_type, weight_t, GraphViewType::is_multi_gpu>
+    key_op,
+  weight_t old_near_far_threshold,
+  size_t target_near_size)
+{
+  constexpr size_t num_bins = 64;  // tuning parameter
+
+  // 1. find the (non-stale) distance range, -max is computed as min(-distance) to use a single
+  // reduction
+
+  weight_t min_distance{};
+  weight_t neg_max_distance{};
+  thrust::tie(min_distance, neg_max_distance) = thrust::transform_reduce(
+    handle.get_thrust_policy(),
+    far_vertices.begin(),
+    far_vertices.end(),
+    cuda::proclaim_return_type<thrust::tuple<weight_t, weight_t>>(
+      [key_op, old_near_far_threshold] __device__(auto v) {
+        auto dist = key_op(v);
+        return dist >= old_near_far_threshold
+                 ? thrust::make_tuple(dist, -dist)
+                 : thrust::make_tuple(std::numeric_limits<weight_t>::max(),
+                                      std::numeric_limits<weight_t>::max());
+      }),
+    thrust::make_tuple(std::numeric_limits<weight_t>::max(), std::numeric_limits<weight_t>::max()),
+    reduce_op::elementwise_minimum<thrust::tuple<weight_t, weight_t>>());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    thrust::tie(min_distance, neg_max_distance) =
+      host_scalar_allreduce(handle.get_comms(),
+                            thrust::make_tuple(min_distance, neg_max_distance),
+                            raft::comms::op_t::MIN,
+                            handle.get_stream());
+  }
+  if (min_distance == std::numeric_limits<weight_t>::max()) { return std::nullopt; }
+  auto max_distance = -neg_max_distance;
+  auto bin_width    = (max_distance - min_distance) / static_cast<weight_t>(num_bins);
+  // a single distance or a range too narrow to split (bin_width underflows to 0, and the bin index
+  // computation would divide by 0), move all the remaining far vertices to the near bucket
+  if (!(bin_width > weight_t{0})) {
+    return std::nextafter(max_distance, std::numeric_limits<weight_t>::max());
+  }
+
+  // 2. build a histogram of the far bucket distances
+
+  rmm::device_uvector<size_t> d_histogram(num_bins, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), d_histogram.begin(), d_histogram.end(), size_t{0});
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    far_vertices.begin(),
+    far_vertices.end(),
+    [key_op,
+     old_near_far_threshold,
+     min_distance,
+     bin_width,
+     histogram =
+       raft::device_span<size_t>(d_histogram.data(), d_histogram.size())] __device__(auto v) {
+      auto dist = key_op(v);
+      if (dist >= old_near_far_threshold) {
+        auto bin = static_cast<size_t>((dist - min_distance) / bin_width);
+        bin      = cuda::std::min(bin, histogram.size() - 1);
+        cuda::atomic_ref<size_t, cuda::thread_scope_device> counter(histogram[bin]);
+        counter.fetch_add(size_t{1}, cuda::std::memory_order_relaxed);
+      }
+    });
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     d_histogram.begin(),
+                     d_histogram.begin(),
+                     d_histogram.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  std::vector<size_t> h_histogram(d_histogram.size());
+  raft::update_host(
+    h_histogram.data(), d_histogram.data(), d_histogram.size(), handle.get_stream());
+  handle.sync_stream();
+
+  // 3. pick the threshold
+
+  size_t num_selected{0};
+  size_t bin{0};
+  for (; bin < num_bins - 1; ++bin) {
+    num_selected += h_histogram[bin];
+    if (num_selected >= target_near_size) { break; }
+  }
+  return (bin == num_bins - 1) ? std::nextafter(max_distance, std::numeric_limits<weight_t>::max())
+                               : min_distance + bin_width * static_cast<weight_t>(bin + 1);
+}
+
 }  // namespace
 
 namespace detail {
@@ -83,6 +276,9 @@ void sssp(raft::handle_t const& handle,
           PredecessorIterator predecessor_first,
           typename GraphViewType::vertex_type source_vertex,
           weight_t cutoff,
+          sssp_delta_mode_t delta_mode,
+          raft::device_span<typename GraphViewType::vertex_type const> targets,
+          weight_t const* heuristics,
           bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
@@ -99,6 +295,20 @@ void sssp(raft::handle_t const& handle,
   // implements the Near-Far Pile method in
   // A. Davidson, S. Baxter, M. Garland, and J. D. Owens, "Work-efficient parallel GPU methods for
   // single-source shortest paths," 2014.
+  //
+  // In the adaptive delta mode, 1) the near-far threshold is advanced based on a histogram of the
+  // far pile distances (instead of a fixed delta) to avoid many small iterations on high diameter
+  // graphs and 2) far pile insertions from consecutive near pile iterations are buffered in a
+  // (small) separate bucket and merged into the (large, sorted) far pile in batches, only when the
+  // near pile is exhausted (or the buffer grows large), instead of merging into the far pile in
+  // every iteration.
+  //
+  // If targets are given, this function terminates once the distances to every target are settled
+  // (every vertex with a key smaller than the near-far threshold is settled once the near pile is
+  // exhausted) and stops pushing vertices with a key no smaller than the largest target key. If
+  // heuristics are given, vertices are assigned to the near & far piles based on distance +
+  // heuristic (A*), this is equivalent to running the Near-Far Pile method on the edge weights
+  // reduced by the heuristics (w(u, v) - h(u) + h(v), non-negative if the heuristic is consistent).
 
   // 1. check input arguments
 
@@ -106,6 +316,14 @@ void sssp(raft::handle_t const& handle,
                   "Invalid input argument: source vertex out-of-range.");
 
   if (do_expensive_check) {
+    auto num_invalid_targets = thrust::count_if(
+      handle.get_thrust_policy(),
+      targets.begin(),
+      targets.end(),
+      [num_vertices] __device__(auto v) { return !is_valid_vertex(num_vertices, v); });
+    CUGRAPH_EXPECTS(num_invalid_targets == 0,
+                    "Invalid input argument: targets include out-of-range vertices.");
+
     auto num_negative_edge_weights =
       count_if_e(handle,
                  push_graph_view,
@@ -157,10 +375,21 @@ void sssp(raft::handle_t const& handle,
 
   // 4. initialize SSSP frontier
 
-  constexpr size_t bucket_idx_cur_near  = 0;
-  constexpr size_t bucket_idx_next_near = 1;
-  constexpr size_t bucket_idx_far       = 2;
-  constexpr size_t num_buckets          = 3;
+  constexpr size_t bucket_idx_cur_near    = 0;
+  constexpr size_t bucket_idx_next_near   = 1;
+  constexpr size_t bucket_idx_far         = 2;
+  constexpr size_t bucket_idx_far_buffer  = 3;  // valid only in the adaptive delta mode
+
+  bool const adaptive_delta          = (delta_mode == sssp_delta_mode_t::ADAPTIVE);
+  size_t const num_buckets           = adaptive_delta ? size_t{4} : size_t{3};
+  size_t const bucket_idx_far_insert = adaptive_delta ? bucket_idx_far_buffer : bucket_idx_far;
+
+  // the next near pile should be large enough to saturate the GPUs (used only in the adaptive delta
+  // mode)
+  size_t target_near_size = size_t{16384};  // tuning parameter
+  if constexpr (GraphViewType::is_multi_gpu) {
+    target_near_size *= static_cast<size_t>(handle.get_comms().get_size());
+  }
 
   vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu, true> vertex_frontier(handle,
                                                                                        num_buckets);
@@ -178,12 +407,39 @@ void sssp(raft::handle_t const& handle,
                            std::numeric_limits<weight_t>::max());
   }
 
+  // the heuristics of the destination vertices are necessary to prune pushes to vertices that
+  // can't be on a shortest path to any target
+  std::optional<edge_dst_property_t<GraphViewType, weight_t>> edge_dst_heuristics{std::nullopt};
+  if (GraphViewType::is_multi_gpu && (heuristics != nullptr)) {
+    edge_dst_heuristics = edge_dst_property_t<GraphViewType, weight_t>(handle, push_graph_view);
+    update_edge_dst_property(
+      handle, push_graph_view, heuristics, (*edge_dst_heuristics).mutable_view());
+  }
+
+  auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
+    push_graph_view.local_vertex_partition_view());
+  auto key_op = vertex_key_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
+    vertex_partition, distances, heuristics};
+
   if (push_graph_view.in_local_vertex_partition_range_nocheck(source_vertex)) {
     vertex_frontier.bucket(bucket_idx_cur_near).insert(source_vertex);
   }
 
+  // if the edges reside in managed memory (e.g. for graphs larger than the GPU memory), prefetch
+  // the edges of the current near frontier's range in every iteration
+  bool const prefetch_edges =
+    has_managed_edge_partitions(handle, push_graph_view, std::make_optional(edge_weight_view));
+
   auto near_far_threshold = delta;
+  auto max_target_key     = std::numeric_limits<weight_t>::max();
   while (true) {
+    if (prefetch_edges) {
+      prefetch_frontier_edge_partitions(handle,
+                                        push_graph_view,
+                                        vertex_frontier.bucket(bucket_idx_cur_near),
+                                        std::make_optional(edge_weight_view));
+    }
+
     if (GraphViewType::is_multi_gpu) {
       update_edge_src_property(handle,
                                push_graph_view,
@@ -193,22 +449,28 @@ void sssp(raft::handle_t const& handle,
                                edge_src_distances.mutable_view());
     }
 
-    auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
-      push_graph_view.local_vertex_partition_view());
-
-    auto [new_frontier_vertex_buffer, distance_predecessor_buffer] =
-      cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
+    auto e_op = e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
+      vertex_partition, distances, cutoff, max_target_key};
+    auto push = [&](auto edge_dst_value_view) {
+      return cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
         handle,
         push_graph_view,
         vertex_frontier.bucket(bucket_idx_cur_near),
         GraphViewType::is_multi_gpu
           ? edge_src_distances.view()
           : detail::edge_major_property_view_t<vertex_t, weight_t const*>(distances),
-        edge_dst_dummy_property_t{}.view(),
+        edge_dst_value_view,
         edge_weight_view,
-        e_op_t<vertex_t, weight_t, GraphViewType::is_multi_gpu>{
-          vertex_partition, distances, cutoff},
+        e_op,
         reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+    };
+    auto [new_frontier_vertex_buffer, distance_predecessor_buffer] =
+      (heuristics != nullptr)
+        ? push(GraphViewType::is_multi_gpu
+                 ? (*edge_dst_heuristics).view()
+                 : detail::edge_minor_property_view_t<vertex_t, weight_t const*>(heuristics,
+                                                                                 vertex_t{0}))
+        : push(edge_dst_dummy_property_t{}.view());
 
     update_v_frontier(
       handle,
@@ -216,28 +478,88 @@ void sssp(raft::handle_t const& handle,
       std::move(new_frontier_vertex_buffer),
       std::move(distance_predecessor_buffer),
       vertex_frontier,
-      std::vector<size_t>{bucket_idx_next_near, bucket_idx_far},
+      std::vector<size_t>{bucket_idx_next_near, bucket_idx_far_insert},
       distances,
       thrust::make_zip_iterator(thrust::make_tuple(distances, predecessor_first)),
-      [near_far_threshold] __device__(auto v, auto v_val, auto pushed_val) {
+      [vertex_partition, heuristics, near_far_threshold, bucket_idx_far_insert] __device__(
+        auto v, auto v_val, auto pushed_val) {
         auto new_dist = thrust::get<0>(pushed_val);
         auto update   = (new_dist < v_val);
+        auto new_key  = new_dist;
+        if (heuristics != nullptr) {
+          new_key +=
+            *(heuristics + vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v));
+        }
         return thrust::make_tuple(
-          update ? cuda::std::optional<size_t>{new_dist < near_far_threshold ? bucket_idx_next_near
-                                                                             : bucket_idx_far}
+          update ? cuda::std::optional<size_t>{new_key < near_far_threshold
+                                                 ? bucket_idx_next_near
+                                                 : bucket_idx_far_insert}
                  : cuda::std::nullopt,
           update ? cuda::std::optional<thrust::tuple<weight_t, vertex_t>>{pushed_val}
                  : cuda::std::nullopt);
       });
 
+    if (targets.size() > 0) {
+      max_target_key = compute_max_target_key(handle, push_graph_view, targets, key_op);
+    }
+
     vertex_frontier.bucket(bucket_idx_cur_near).clear();
     vertex_frontier.bucket(bucket_idx_cur_near).shrink_to_fit();
-    if (vertex_frontier.bucket(bucket_idx_next_near).aggregate_size() > 0) {
+
+    // the aggregate far bucket size is needed only if the near pile is exhausted, and in that case
+    // every GPU merges its far buffer bucket into the far bucket, so both sizes are reduced
+    // together (before the merge) in a single collective call
+    auto next_near_aggregate_size = vertex_frontier.bucket(bucket_idx_next_near).size();
+    auto far_aggregate_size =
+      vertex_frontier.bucket(bucket_idx_far).size() +
+      (adaptive_delta ? vertex_frontier.bucket(bucket_idx_far_buffer).size() : size_t{0});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      host_scalar_allreduce_batch_t<size_t> aggregate_sizes(
+        handle.get_comms(), raft::comms::op_t::SUM, handle.get_stream());
+      aggregate_sizes.add(next_near_aggregate_size);
+      aggregate_sizes.add(far_aggregate_size);
+      auto reduced_sizes       = aggregate_sizes.flush();
+      next_near_aggregate_size = reduced_sizes[0];
+      far_aggregate_size       = reduced_sizes[1];
+    }
+    if (adaptive_delta) {
+      // merge the far buffer bucket into the far bucket (this is a local operation) if the near
+      // pile is exhausted or the buffer becomes large relative to the far bucket (to bound the cost
+      // of inserting to the buffer)
+      auto& far_buffer_bucket = vertex_frontier.bucket(bucket_idx_far_buffer);
+      if ((far_buffer_bucket.size() > 0) &&
+          ((next_near_aggregate_size == 0) ||
+           (far_buffer_bucket.size() * 4 /* tuning parameter */ >
+            vertex_frontier.bucket(bucket_idx_far).size()))) {
+        vertex_frontier.bucket(bucket_idx_far).insert(far_buffer_bucket.begin(),
+                                                      far_buffer_bucket.end());
+        far_buffer_bucket.clear();
+        far_buffer_bucket.shrink_to_fit();
+      }
+    }
+
+    if (next_near_aggregate_size > 0) {
       vertex_frontier.swap_buckets(bucket_idx_cur_near, bucket_idx_next_near);
-    } else if (vertex_frontier.bucket(bucket_idx_far).aggregate_size() >
-               0) {  // near queue is empty, split the far queue
+    } else if (max_target_key < near_far_threshold) {  // every target is settled
+      break;
+    } else if (far_aggregate_size > 0) {  // near queue is empty, split the far queue
       auto old_near_far_threshold = near_far_threshold;
-      near_far_threshold += delta;
+      if (adaptive_delta) {
+        auto new_threshold = compute_adaptive_near_far_threshold(
+          handle,
+          push_graph_view,
+          raft::device_span<vertex_t const>(vertex_frontier.bucket(bucket_idx_far).cbegin(),
+                                            vertex_frontier.bucket(bucket_idx_far).size()),
+          key_op,
+          old_near_far_threshold,
+          target_near_size);
+        if (!new_threshold) { break; }  // all the vertices in the far queue are stale
+        // the new threshold is larger than the smallest non-stale far key, so the next near pile
+        // is not empty (no delta floor is necessary to guarantee progress)
+        near_far_threshold = *new_threshold;
+      } else {
+        near_far_threshold += delta;
+      }
 
       size_t near_size{0};
       size_t far_size{0};
@@ -245,17 +567,25 @@ void sssp(raft::handle_t const& handle,
         vertex_frontier.split_bucket(
           bucket_idx_far,
           std::vector<size_t>{bucket_idx_cur_near},
-          [vertex_partition, distances, old_near_far_threshold, near_far_threshold] __device__(
+          [key_op, old_near_far_threshold, near_far_threshold, max_target_key] __device__(
             auto v) {
-            auto dist =
-              *(distances + vertex_partition.local_vertex_partition_offset_from_vertex_nocheck(v));
-            return dist >= old_near_far_threshold
-                     ? cuda::std::optional<size_t>{dist < near_far_threshold ? bucket_idx_cur_near
-                                                                             : bucket_idx_far}
+            auto key = key_op(v);
+            return ((key >= old_near_far_threshold) && (key < max_target_key))
+                     ? cuda::std::optional<size_t>{key < near_far_threshold ? bucket_idx_cur_near
+                                                                            : bucket_idx_far}
                      : cuda::std::nullopt;
           });
-        near_size = vertex_frontier.bucket(bucket_idx_cur_near).aggregate_size();
-        far_size  = vertex_frontier.bucket(bucket_idx_far).aggregate_size();
+        near_size = vertex_frontier.bucket(bucket_idx_cur_near).size();
+        far_size  = vertex_frontier.bucket(bucket_idx_far).size();
+        if constexpr (GraphViewType::is_multi_gpu) {
+          host_scalar_allreduce_batch_t<size_t> aggregate_sizes(
+            handle.get_comms(), raft::comms::op_t::SUM, handle.get_stream());
+          aggregate_sizes.add(near_size);
+          aggregate_sizes.add(far_size);
+          auto reduced_sizes = aggregate_sizes.flush();
+          near_size          = reduced_sizes[0];
+          far_size           = reduced_sizes[1];
+        }
         if ((near_size > 0) || (far_size == 0)) {
           break;
         } else {
@@ -269,6 +599,155 @@ void sssp(raft::handle_t const& handle,
   }
 }
 
+// Label-correcting SSSP touching only the vertices reached within the cutoff. Tentative distances
+// and predecessors are stored in a hash map (instead of O(V) arrays) and frontier vertices carry
+// their tentative distances as tags. A vertex re-enters the frontier only if its tentative distance
+// improves, so every iteration (and the hash map size) is bounded by the number of reached vertices
+// and their out-going edges.
+template <typename GraphViewType, typename weight_t>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<weight_t>,
+           std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>>>
+sparse_sssp(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  edge_property_view_t<typename GraphViewType::edge_type, weight_t const*> edge_weight_view,
+  typename GraphViewType::vertex_type source_vertex,
+  weight_t cutoff,
+  bool compute_predecessors,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_valid_vertex(source_vertex),
+                  "Invalid input argument: source vertex out-of-range.");
+
+  if (do_expensive_check) {
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 push_graph_view,
+                 edge_src_dummy_property_t{}.view(),
+                 edge_dst_dummy_property_t{}.view(),
+                 edge_weight_view,
+                 [] __device__(vertex_t, vertex_t, auto, auto, weight_t w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input edge weights should have non-negative values.");
+  }
+
+  // 2. initialize the reached vertex map and the frontier
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  kv_store_t<vertex_t, thrust::tuple<weight_t, vertex_t>, false> reached_map(
+    size_t{1024} /* grows on insertion */,
+    invalid_vertex,
+    thrust::make_tuple(invalid_distance, invalid_vertex),
+    handle.get_stream());
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, weight_t, GraphViewType::is_multi_gpu, false> vertex_frontier(
+    handle, num_buckets);
+
+  if (push_graph_view.in_local_vertex_partition_range_nocheck(source_vertex)) {
+    auto key_first = thrust::make_constant_iterator(source_vertex);
+    auto val_first = thrust::make_zip_iterator(thrust::make_constant_iterator(weight_t{0.0}),
+                                               thrust::make_constant_iterator(invalid_vertex));
+    reached_map.insert(key_first, key_first + 1, val_first, handle.get_stream());
+    vertex_frontier.bucket(bucket_idx_cur).insert(thrust::make_tuple(source_vertex, weight_t{0.0}));
+  }
+
+  // 3. SSSP iteration
+
+  while (true) {
+    auto [new_frontier_key_buffer, new_predecessors] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    push_graph_view,
+                                                    vertex_frontier.bucket(bucket_idx_cur),
+                                                    edge_src_dummy_property_t{}.view(),
+                                                    edge_dst_dummy_property_t{}.view(),
+                                                    edge_weight_view,
+                                                    sparse_e_op_t<vertex_t, weight_t>{cutoff},
+                                                    reduce_op::any<vertex_t>(),
+                                                    do_expensive_check);
+    auto& new_vertices  = std::get<0>(new_frontier_key_buffer);
+    auto& new_distances = std::get<1>(new_frontier_key_buffer);
+
+    // keys are sorted by (vertex, distance), keep the shortest candidate distance per vertex
+
+    auto num_candidates = static_cast<size_t>(thrust::distance(
+      new_vertices.begin(),
+      thrust::get<0>(thrust::unique_by_key(
+        handle.get_thrust_policy(),
+        new_vertices.begin(),
+        new_vertices.end(),
+        thrust::make_zip_iterator(new_distances.begin(), new_predecessors.begin())))));
+
+    // drop the candidates no shorter than the current tentative distances
+
+    auto old_vals = allocate_dataframe_buffer<thrust::tuple<weight_t, vertex_t>>(
+      num_candidates, handle.get_stream());
+    reached_map.view().find(new_vertices.begin(),
+                            new_vertices.begin() + num_candidates,
+                            get_dataframe_buffer_begin(old_vals),
+                            handle.get_stream());
+    auto quad_first = thrust::make_zip_iterator(new_vertices.begin(),
+                                                new_distances.begin(),
+                                                new_predecessors.begin(),
+                                                std::get<0>(old_vals).begin());
+    num_candidates  = static_cast<size_t>(thrust::distance(
+      quad_first,
+      thrust::remove_if(
+        handle.get_thrust_policy(),
+        quad_first,
+        quad_first + num_candidates,
+        [] __device__(auto quad) { return thrust::get<1>(quad) >= thrust::get<3>(quad); })));
+    new_vertices.resize(num_candidates, handle.get_stream());
+    new_distances.resize(num_candidates, handle.get_stream());
+    new_predecessors.resize(num_candidates, handle.get_stream());
+
+    // record the improved tentative distances and re-visit the improved vertices
+
+    reached_map.insert_and_assign(
+      new_vertices.begin(),
+      new_vertices.end(),
+      thrust::make_zip_iterator(new_distances.begin(), new_predecessors.begin()),
+      handle.get_stream());
+
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur)
+      .insert(thrust::make_zip_iterator(new_vertices.begin(), new_distances.begin()),
+              thrust::make_zip_iterator(new_vertices.end(), new_distances.end()));
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+  }
+
+  // 4. return the reached (local) vertices sorted by vertex ID
+
+  auto [vertices, vals] = reached_map.release(handle.get_stream());
+  auto& distances       = std::get<0>(vals);
+  auto& predecessors    = std::get<1>(vals);
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      vertices.begin(),
+                      vertices.end(),
+                      thrust::make_zip_iterator(distances.begin(), predecessors.begin()));
+
+  return std::make_tuple(std::move(vertices),
+                         std::move(distances),
+                         compute_predecessors ? std::make_optional(std::move(predecessors))
+                                              : std::nullopt);
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
@@ -279,6 +758,7 @@ void sssp(raft::handle_t const& handle,
           vertex_t* predecessors,
           vertex_t source_vertex,
           weight_t cutoff,
+          sssp_delta_mode_t delta_mode,
           bool do_expensive_check)
 {
   if (predecessors != nullptr) {
@@ -289,6 +769,9 @@ void sssp(raft::handle_t const& handle,
                  predecessors,
                  source_vertex,
                  cutoff,
+                 delta_mode,
+                 raft::device_span<vertex_t const>{},
+                 static_cast<weight_t const*>(nullptr),
                  do_expensive_check);
   } else {
     detail::sssp(handle,
@@ -298,8 +781,105 @@ void sssp(raft::handle_t const& handle,
                  thrust::make_discard_iterator(),
                  source_vertex,
                  cutoff,
+                 delta_mode,
+                 raft::device_span<vertex_t const>{},
+                 static_cast<weight_t const*>(nullptr),
                  do_expensive_check);
   }
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+          edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+          weight_t* distances,
+          vertex_t* predecessors,
+          vertex_t source_vertex,
+          weight_t cutoff,
+          bool do_expensive_check)
+{
+  sssp(handle,
+       graph_view,
+       edge_weight_view,
+       distances,
+       predecessors,
+       source_vertex,
+       cutoff,
+       sssp_delta_mode_t::FIXED,
+       do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sssp_to_targets(raft::handle_t const& handle,
+                     graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                     edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                     weight_t* distances,
+                     vertex_t* predecessors,
+                     vertex_t source_vertex,
+                     raft::device_span<vertex_t const> targets,
+                     std::optional<raft::device_span<weight_t const>> heuristics,
+                     weight_t cutoff,
+                     bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    !heuristics ||
+      ((*heuristics).size() == static_cast<size_t>(graph_view.local_vertex_partition_range_size())),
+    "Invalid input argument: heuristics size does not match with the local vertex partition range "
+    "size.");
+  if constexpr (multi_gpu) {
+    auto num_targets = host_scalar_allreduce(
+      handle.get_comms(), targets.size(), raft::comms::op_t::MAX, handle.get_stream());
+    CUGRAPH_EXPECTS(num_targets == targets.size(),
+                    "Invalid input argument: targets should be identical in every GPU.");
+  }
+
+  auto heuristic_first = heuristics ? (*heuristics).data() : static_cast<weight_t const*>(nullptr);
+  if (predecessors != nullptr) {
+    detail::sssp(handle,
+                 graph_view,
+                 edge_weight_view,
+                 distances,
+                 predecessors,
+                 source_vertex,
+                 cutoff,
+                 sssp_delta_mode_t::FIXED,
+                 targets,
+                 heuristic_first,
+                 do_expensive_check);
+  } else {
+    detail::sssp(handle,
+                 graph_view,
+                 edge_weight_view,
+                 distances,
+                 thrust::make_discard_iterator(),
+                 source_vertex,
+                 cutoff,
+                 sssp_delta_mode_t::FIXED,
+                 targets,
+                 heuristic_first,
+                 do_expensive_check);
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           std::optional<rmm::device_uvector<vertex_t>>>
+sparse_sssp(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+            edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+            vertex_t source_vertex,
+            weight_t cutoff,
+            bool compute_predecessors,
+            bool do_expensive_check)
+{
+  return detail::sparse_sssp(handle,
+                             graph_view,
+                             edge_weight_view,
+                             source_vertex,
+                             cutoff,
+                             compute_predecessors,
+                             do_expensive_check);
+}
+
 }  // namespace cugraph
@@ -28,6 +28,25 @@ template void sssp(raft::handle_t const& handle,
                    float cutoff,
                    bool do_expensive_check);
 
+template void sssp(raft::handle_t const& handle,
+                   graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                   edge_property_view_t<int64_t, float const*> edge_weight_view,
+                   float* distances,
+                   int64_t* predecessors,
+                   int64_t source_vertex,
+                   float cutoff,
+                   sssp_delta_mode_t delta_mode,
+                   bool do_expensive_check);
+
+template void sssp(raft::handle_t const& handle,
+                   graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                   edge_property_view_t<int64_t, double const*> edge_weight_view,
+                   double* distances,
+                   int64_t* predecessors,
+                   int64_t source_vertex,
+                   double cutoff,
+                   bool do_expensive_check);
+
 template void sssp(raft::handle_t const& handle,
                    graph_view_t<int64_t, int64_t, false, false> const& graph_view,
                    edge_property_view_t<int64_t, double const*> edge_weight_view,
@@ -35,6 +54,51 @@ template void sssp(raft::handle_t const& handle,
                    int64_t* predecessors,
                    int64_t source_vertex,
                    double cutoff,
+                   sssp_delta_mode_t delta_mode,
                    bool do_expensive_check);
 
+template void sssp_to_targets(raft::handle_t const& handle,
+                              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                              edge_property_view_t<int64_t, float const*> edge_weight_view,
+                              float* distances,
+                              int64_t* predecessors,
+                              int64_t source_vertex,
+                              raft::device_span<int64_t const> targets,
+                              std::optional<raft::device_span<float const>> heuristics,
+                              float cutoff,
+                              bool do_expensive_check);
+
+template void sssp_to_targets(raft::handle_t const& handle,
+                              graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+                              edge_property_view_t<int64_t, double const*> edge_weight_view,
+                              double* distances,
+                              int64_t* predecessors,
+                              int64_t source_vertex,
+                              raft::device_span<int64_t const> targets,
+                              std::optional<raft::device_span<double const>> heuristics,
+                              double cutoff,
+                              bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+sparse_sssp(raft::handle_t const& handle,
+            graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+            edge_property_view_t<int64_t, float const*> edge_weight_view,
+            int64_t source_vertex,
+            float cutoff,
+            bool compute_predecessors,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    std::optional<rmm::device_uvector<int64_t>>>
+sparse_sssp(raft::handle_t const& handle,
+            graph_view_t<int64_t, int64_t, false, false> const& graph_view,
+            edge_property_view_t<int64_t, double const*> edge_weight_view,
+            int64_t source_vertex,
+            double cutoff,
+            bool compute_predecessors,
+            bool do_expensive_check);
+
 }  // namespace cugraph
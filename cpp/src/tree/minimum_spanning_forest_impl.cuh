@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "components/weakly_connected_components_impl.cuh"
+#include "detail/graph_partition_utils.cuh"
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/property_op_utils.cuh"
+#include "prims/reduce_op.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// edges are ordered by (weight, smaller end point, larger end point); this total order breaks ties
+// between equal weight edges consistently, so the edges selected in a Borůvka round never form a
+// cycle
+template <typename vertex_t, typename weight_t>
+using boruvka_edge_t = thrust::tuple<weight_t, vertex_t, vertex_t, vertex_t /* dst component */>;
+
+template <typename vertex_t, typename weight_t>
+struct min_cross_component_edge_e_op_t {
+  __device__ boruvka_edge_t<vertex_t, weight_t> operator()(
+    vertex_t src, vertex_t dst, vertex_t src_component, vertex_t dst_component, weight_t w) const
+  {
+    if (src_component == dst_component) {
+      return max_identity_element<boruvka_edge_t<vertex_t, weight_t>>();
+    }
+    return thrust::make_tuple(w, src < dst ? src : dst, src < dst ? dst : src, dst_component);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                        bool do_expensive_check)
+{
+  using GraphViewType = graph_view_t<vertex_t, edge_t, false, multi_gpu>;
+  using key_t         = boruvka_edge_t<vertex_t, weight_t>;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: input graph should be symmetric for minimum spanning "
+                  "forest.");
+  CUGRAPH_EXPECTS(!graph_view.has_edge_mask(), "unimplemented.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  auto const local_size = graph_view.local_vertex_partition_range_size();
+
+  rmm::device_uvector<vertex_t> forest_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> forest_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> forest_weights(0, handle.get_stream());
+
+  // 2. Borůvka rounds; every component is contracted implicitly by labeling its vertices with a
+  // common component ID (coarsening the graph would collapse the multi-edges between two
+  // components to a single edge with the summed weight, but we need the minimum weight edge)
+
+  rmm::device_uvector<vertex_t> components(local_size, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(),
+                   components.begin(),
+                   components.end(),
+                   graph_view.local_vertex_partition_range_first());
+
+  edge_src_property_t<GraphViewType, vertex_t> edge_src_components(handle, graph_view);
+  edge_dst_property_t<GraphViewType, vertex_t> edge_dst_components(handle, graph_view);
+
+  while (true) {
+    // 2-1. find the minimum weight edge leaving each vertex's component
+
+    update_edge_src_property(
+      handle, graph_view, components.begin(), edge_src_components.mutable_view());
+    update_edge_dst_property(
+      handle, graph_view, components.begin(), edge_dst_components.mutable_view());
+
+    auto min_edges = allocate_dataframe_buffer<key_t>(local_size, handle.get_stream());
+    per_v_transform_reduce_outgoing_e(handle,
+                                      graph_view,
+                                      edge_src_components.view(),
+                                      edge_dst_components.view(),
+                                      edge_weight_view,
+                                      min_cross_component_edge_e_op_t<vertex_t, weight_t>{},
+                                      reduce_op::minimum<key_t>::identity_element,
+                                      reduce_op::minimum<key_t>{},
+                                      get_dataframe_buffer_begin(min_edges));
+
+    // 2-2. reduce to the minimum weight edge leaving each component
+
+    rmm::device_uvector<vertex_t> keys(local_size, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), components.begin(), components.end(), keys.begin());
+    auto kv_first = thrust::make_zip_iterator(thrust::make_tuple(keys.begin(),
+                                                                 std::get<0>(min_edges).begin(),
+                                                                 std::get<1>(min_edges).begin(),
+                                                                 std::get<2>(min_edges).begin(),
+                                                                 std::get<3>(min_edges).begin()));
+    auto num_candidates = static_cast<size_t>(thrust::distance(
+      kv_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        kv_first,
+                        kv_first + keys.size(),
+                        [] __device__(auto kv) {
+                          return thrust::get<2>(kv) == max_identity_element<vertex_t>();
+                        })));
+
+    // sorting by (component ID, edge) places the minimum edge of each component first
+    auto sort_and_unique_by_component = [&handle](auto& keys, auto& min_edges, size_t size) {
+      auto kv_first = thrust::make_zip_iterator(thrust::make_tuple(keys.begin(),
+                                                                   std::get<0>(min_edges).begin(),
+                                                                   std::get<1>(min_edges).begin(),
+                                                                   std::get<2>(min_edges).begin(),
+                                                                   std::get<3>(min_edges).begin()));
+      thrust::sort(handle.get_thrust_policy(), kv_first, kv_first + size);
+      auto num_uniques = static_cast<size_t>(thrust::distance(
+        keys.begin(),
+        thrust::get<0>(thrust::unique_by_key(handle.get_thrust_policy(),
+                                             keys.begin(),
+                                             keys.begin() + size,
+                                             get_dataframe_buffer_begin(min_edges)))));
+      keys.resize(num_uniques, handle.get_stream());
+      resize_dataframe_buffer(min_edges, num_uniques, handle.get_stream());
+    };
+    sort_and_unique_by_component(keys, min_edges, num_candidates);
+
+    if constexpr (multi_gpu) {
+      auto& comm                 = handle.get_comms();
+      auto const comm_size       = comm.get_size();
+      auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+      auto const minor_comm_size = minor_comm.get_size();
+
+      std::tie(keys, min_edges, std::ignore) = groupby_gpu_id_and_shuffle_kv_pairs(
+        comm,
+        keys.begin(),
+        keys.end(),
+        get_dataframe_buffer_begin(min_edges),
+        compute_gpu_id_from_ext_vertex_t<vertex_t>{comm_size, major_comm_size, minor_comm_size},
+        handle.get_stream());
+      sort_and_unique_by_component(keys, min_edges, keys.size());
+    }
+
+    auto num_selected = keys.size();
+    if constexpr (multi_gpu) {
+      num_selected = host_scalar_allreduce(
+        handle.get_comms(), num_selected, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_selected == 0) { break; }
+
+    // 2-3. add the selected edges to the forest (an edge can be selected by both the components
+    // it connects)
+
+    auto new_srcs    = std::move(std::get<1>(min_edges));
+    auto new_dsts    = std::move(std::get<2>(min_edges));
+    auto new_weights = std::move(std::get<0>(min_edges));
+    auto link_dsts   = std::move(std::get<3>(min_edges));
+
+    rmm::device_uvector<vertex_t> link_srcs(keys.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(), keys.begin(), keys.end(), link_srcs.begin());
+    keys.resize(0, handle.get_stream());
+    keys.shrink_to_fit(handle.get_stream());
+
+    if constexpr (multi_gpu) {
+      auto& comm                 = handle.get_comms();
+      auto const comm_size       = comm.get_size();
+      auto& major_comm           = handle.get_subcomm(partition_manager::major_comm_name());
+      auto const major_comm_size = major_comm.get_size();
+      auto& minor_comm           = handle.get_subcomm(partition_manager::minor_comm_name());
+      auto const minor_comm_size = minor_comm.get_size();
+
+      auto edge_value_first =
+        thrust::make_zip_iterator(thrust::make_tuple(new_dsts.begin(), new_weights.begin()));
+      std::forward_as_tuple(new_srcs, std::tie(new_dsts, new_weights), std::ignore) =
+        groupby_gpu_id_and_shuffle_kv_pairs(
+          comm,
+          new_srcs.begin(),
+          new_srcs.end(),
+          edge_value_first,
+          compute_gpu_id_from_ext_vertex_t<vertex_t>{comm_size, major_comm_size, minor_comm_size},
+          handle.get_stream());
+    }
+
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(new_srcs.begin(), new_dsts.begin(), new_weights.begin()));
+    thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + new_srcs.size());
+    auto num_new_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::unique(handle.get_thrust_policy(), edge_first, edge_first + new_srcs.size())));
+
+    auto old_size = forest_srcs.size();
+    forest_srcs.resize(old_size + num_new_edges, handle.get_stream());
+    forest_dsts.resize(forest_srcs.size(), handle.get_stream());
+    forest_weights.resize(forest_srcs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 edge_first,
+                 edge_first + num_new_edges,
+                 thrust::make_zip_iterator(thrust::make_tuple(forest_srcs.begin() + old_size,
+                                                              forest_dsts.begin() + old_size,
+                                                              forest_weights.begin() + old_size)));
+
+    // 2-4. merge the components linked by the selected edges
+
+    merge_linked_components<GraphViewType>(
+      handle, std::move(link_srcs), std::move(link_dsts), components.data(), local_size);
+  }
+
+  return std::make_tuple(
+    std::move(forest_srcs), std::move(forest_dsts), std::move(forest_weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+                        edge_property_view_t<edge_t, weight_t const*> edge_weight_view,
+                        bool do_expensive_check)
+{
+  return detail::minimum_spanning_forest(handle, graph_view, edge_weight_view, do_expensive_check);
+}
+
+}  // namespace cugraph
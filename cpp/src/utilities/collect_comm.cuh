@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,9 +17,11 @@
 
 #include "detail/graph_partition_utils.cuh"
 #include "prims/kv_store.cuh"
+#include "utilities/peer_memory_utils.cuh"
 
 #include <cugraph/graph.hpp>
 #include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
@@ -33,23 +35,96 @@
 #include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 #include <memory>
 #include <vector>
 
 namespace cugraph {
 
+namespace detail {
+
+// find values for [collect_key_first, collect_key_last) from the (sorted) unique (key, value) pairs
+template <typename KVStoreViewType, typename KeyIterator>
+dataframe_buffer_type_t<typename KVStoreViewType::value_type> find_values_from_unique_kv_pairs(
+  KVStoreViewType kv_store_view,
+  rmm::device_uvector<typename KVStoreViewType::key_type>&& unique_keys,
+  dataframe_buffer_type_t<typename KVStoreViewType::value_type>&& values_for_unique_keys,
+  KeyIterator collect_key_first,
+  KeyIterator collect_key_last,
+  rmm::cuda_stream_view stream_view)
+{
+  using key_t   = typename KVStoreViewType::key_type;
+  using value_t = typename KVStoreViewType::value_type;
+
+  // build a kv_store_t object for the k, v pairs in unique_keys, values_for_unique_keys.
+
+  kv_store_t<key_t, value_t, KVStoreViewType::binary_search> unique_key_value_store(stream_view);
+  if constexpr (KVStoreViewType::binary_search) {
+    unique_key_value_store = kv_store_t<key_t, value_t, true>(std::move(unique_keys),
+                                                              std::move(values_for_unique_keys),
+                                                              kv_store_view.invalid_value(),
+                                                              false,
+                                                              stream_view);
+  } else {
+    auto kv_pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(unique_keys.begin(), get_dataframe_buffer_begin(values_for_unique_keys)));
+    auto valid_kv_pair_last =
+      thrust::remove_if(rmm::exec_policy(stream_view),
+                        kv_pair_first,
+                        kv_pair_first + unique_keys.size(),
+                        [invalid_value = kv_store_view.invalid_value()] __device__(auto pair) {
+                          return thrust::get<1>(pair) == invalid_value;
+                        });  // remove (k,v) pairs with unmatched keys (it is invalid to insert a
+                             // (k,v) pair with v = empty_key_sentinel)
+    auto num_valid_pairs = static_cast<size_t>(thrust::distance(kv_pair_first, valid_kv_pair_last));
+    unique_key_value_store =
+      kv_store_t<key_t, value_t, false>(unique_keys.begin(),
+                                        unique_keys.begin() + num_valid_pairs,
+                                        get_dataframe_buffer_begin(values_for_unique_keys),
+                                        kv_store_view.invalid_key(),
+                                        kv_store_view.invalid_value(),
+                                        stream_view);
+
+    unique_keys.resize(0, stream_view);
+    resize_dataframe_buffer(values_for_unique_keys, 0, stream_view);
+    unique_keys.shrink_to_fit(stream_view);
+    shrink_to_fit_dataframe_buffer(values_for_unique_keys, stream_view);
+  }
+  auto unique_key_value_store_view = unique_key_value_store.view();
+
+  // find values for [collect_key_first, collect_key_last)
+
+  auto value_buffer = allocate_dataframe_buffer<value_t>(
+    thrust::distance(collect_key_first, collect_key_last), stream_view);
+  unique_key_value_store_view.find(
+    collect_key_first, collect_key_last, get_dataframe_buffer_begin(value_buffer), stream_view);
+
+  return value_buffer;
+}
+
+}  // namespace detail
+
 // for the keys in kv_store_view, key_to_comm_rank_op(key) should coincide with comm.get_rank()
 template <typename KVStoreViewType, typename KeyIterator, typename KeyToCommRankOp>
 dataframe_buffer_type_t<typename KVStoreViewType::value_type> collect_values_for_keys(
@@ -103,50 +178,14 @@ dataframe_buffer_type_t<typename KVStoreViewType::value_type> collect_values_for
     values_for_unique_keys = std::move(rx_values_for_unique_keys);
   }
 
-  // 2. build a kv_store_t object for the k, v pairs in unique_keys, values_for_unique_keys.
-
-  kv_store_t<key_t, value_t, KVStoreViewType::binary_search> unique_key_value_store(stream_view);
-  if constexpr (KVStoreViewType::binary_search) {
-    unique_key_value_store = kv_store_t<key_t, value_t, true>(std::move(unique_keys),
-                                                              std::move(values_for_unique_keys),
-                                                              kv_store_view.invalid_value(),
-                                                              false,
-                                                              stream_view);
-  } else {
-    auto kv_pair_first = thrust::make_zip_iterator(
-      thrust::make_tuple(unique_keys.begin(), get_dataframe_buffer_begin(values_for_unique_keys)));
-    auto valid_kv_pair_last =
-      thrust::remove_if(rmm::exec_policy(stream_view),
-                        kv_pair_first,
-                        kv_pair_first + unique_keys.size(),
-                        [invalid_value = kv_store_view.invalid_value()] __device__(auto pair) {
-                          return thrust::get<1>(pair) == invalid_value;
-                        });  // remove (k,v) pairs with unmatched keys (it is invalid to insert a
-                             // (k,v) pair with v = empty_key_sentinel)
-    auto num_valid_pairs = static_cast<size_t>(thrust::distance(kv_pair_first, valid_kv_pair_last));
-    unique_key_value_store =
-      kv_store_t<key_t, value_t, false>(unique_keys.begin(),
-                                        unique_keys.begin() + num_valid_pairs,
-                                        get_dataframe_buffer_begin(values_for_unique_keys),
-                                        kv_store_view.invalid_key(),
-                                        kv_store_view.invalid_value(),
-                                        stream_view);
-
-    unique_keys.resize(0, stream_view);
-    resize_dataframe_buffer(values_for_unique_keys, 0, stream_view);
-    unique_keys.shrink_to_fit(stream_view);
-    shrink_to_fit_dataframe_buffer(values_for_unique_keys, stream_view);
-  }
-  auto unique_key_value_store_view = unique_key_value_store.view();
-
-  // 3. find values for [collect_key_first, collect_key_last)
+  // 2. find values for [collect_key_first, collect_key_last)
 
-  auto value_buffer = allocate_dataframe_buffer<value_t>(
-    thrust::distance(collect_key_first, collect_key_last), stream_view);
-  unique_key_value_store_view.find(
-    collect_key_first, collect_key_last, get_dataframe_buffer_begin(value_buffer), stream_view);
-
-  return value_buffer;
+  return detail::find_values_from_unique_kv_pairs(kv_store_view,
+                                                  std::move(unique_keys),
+                                                  std::move(values_for_unique_keys),
+                                                  collect_key_first,
+                                                  collect_key_last,
+                                                  stream_view);
 }
 
 // for the keys in kv_store_view, key_to_comm_rank_op(key) should coincide with comm.get_rank()
@@ -185,6 +224,320 @@ collect_values_for_unique_keys(
   return std::make_tuple(std::move(collect_unique_keys), std::move(values_for_collect_unique_keys));
 }
 
+// Same as collect_values_for_unique_keys but the keys are shuffled and the values are shuffled back
+// in rounds of at most max_keys_per_round (local) keys. This bounds the size of the receive buffers
+// (and the kv_store_view.find() working set) on the owning ranks when collecting values for very
+// large key sets. Every rank participates in the same number of rounds.
+template <typename KVStoreViewType, typename KeyToCommRankOp>
+std::tuple<rmm::device_uvector<typename KVStoreViewType::key_type>,
+           dataframe_buffer_type_t<typename KVStoreViewType::value_type>>
+collect_values_for_unique_keys(
+  raft::comms::comms_t const& comm,
+  KVStoreViewType kv_store_view,
+  rmm::device_uvector<typename KVStoreViewType::key_type>&& collect_unique_keys,
+  KeyToCommRankOp key_to_comm_rank_op,
+  size_t max_keys_per_round,
+  rmm::cuda_stream_view stream_view)
+{
+  using value_t = typename KVStoreViewType::value_type;
+
+  CUGRAPH_EXPECTS(max_keys_per_round > 0,
+                  "Invalid input argument: max_keys_per_round should be a positive number.");
+
+  auto num_rounds = host_scalar_allreduce(
+    comm,
+    (collect_unique_keys.size() + (max_keys_per_round - 1)) / max_keys_per_round,
+    raft::comms::op_t::MAX,
+    stream_view);
+
+  auto values_for_collect_unique_keys =
+    allocate_dataframe_buffer<value_t>(collect_unique_keys.size(), stream_view);
+  for (size_t i = 0; i < num_rounds; ++i) {
+    auto round_first = std::min(i * max_keys_per_round, collect_unique_keys.size());
+    auto round_last  = std::min(round_first + max_keys_per_round, collect_unique_keys.size());
+
+    auto [rx_unique_keys, rx_value_counts] = groupby_gpu_id_and_shuffle_values(
+      comm,
+      collect_unique_keys.begin() + round_first,
+      collect_unique_keys.begin() + round_last,
+      [key_to_comm_rank_op] __device__(auto val) { return key_to_comm_rank_op(val); },
+      stream_view);
+    auto values_for_rx_unique_keys =
+      allocate_dataframe_buffer<value_t>(rx_unique_keys.size(), stream_view);
+    kv_store_view.find(rx_unique_keys.begin(),
+                       rx_unique_keys.end(),
+                       get_dataframe_buffer_begin(values_for_rx_unique_keys),
+                       stream_view);
+    rx_unique_keys.resize(0, stream_view);
+    rx_unique_keys.shrink_to_fit(stream_view);
+
+    auto round_values = std::get<0>(shuffle_values(
+      comm, get_dataframe_buffer_begin(values_for_rx_unique_keys), rx_value_counts, stream_view));
+    thrust::copy(rmm::exec_policy_nosync(stream_view),
+                 get_dataframe_buffer_begin(round_values),
+                 get_dataframe_buffer_end(round_values),
+                 get_dataframe_buffer_begin(values_for_collect_unique_keys) + round_first);
+  }
+
+  return std::make_tuple(std::move(collect_unique_keys), std::move(values_for_collect_unique_keys));
+}
+
+/**
+ * @brief Device resident least recently used (LRU) cache of the (key, value) pairs collected from
+ * the remote ranks by collect_values_for_keys.
+ *
+ * A cache object is valid only while the values stored in the kv_store_view passed to
+ * collect_values_for_keys do not change (e.g. renumber maps or static vertex features); the caller
+ * should clear() the cache otherwise. Keys are stored sorted, every lookup stamps the hit entries
+ * with a logical clock, and the entries with the oldest stamps are evicted once more than
+ * capacity() entries are cached.
+ */
+template <typename key_t, typename value_t>
+class collect_values_cache_t {
+ public:
+  collect_values_cache_t(size_t capacity, rmm::cuda_stream_view stream_view)
+    : keys_(0, stream_view),
+      values_(allocate_dataframe_buffer<value_t>(0, stream_view)),
+      last_used_(0, stream_view),
+      capacity_(capacity)
+  {
+  }
+
+  size_t capacity() const { return capacity_; }
+  size_t size() const { return keys_.size(); }
+
+  void clear(rmm::cuda_stream_view stream_view)
+  {
+    keys_.resize(0, stream_view);
+    keys_.shrink_to_fit(stream_view);
+    resize_dataframe_buffer(values_, 0, stream_view);
+    shrink_to_fit_dataframe_buffer(values_, stream_view);
+    last_used_.resize(0, stream_view);
+    last_used_.shrink_to_fit(stream_view);
+  }
+
+  // Remove the cached keys from sorted_unique_keys (the remaining keys stay sorted) and return the
+  // removed keys with their cached values.
+  std::tuple<rmm::device_uvector<key_t>, dataframe_buffer_type_t<value_t>> find_and_remove_hits(
+    rmm::device_uvector<key_t>& sorted_unique_keys, rmm::cuda_stream_view stream_view)
+  {
+    ++clock_;
+
+    rmm::device_uvector<size_t> positions(sorted_unique_keys.size(), stream_view);
+    thrust::transform(
+      rmm::exec_policy_nosync(stream_view),
+      sorted_unique_keys.begin(),
+      sorted_unique_keys.end(),
+      positions.begin(),
+      [cache_keys = raft::device_span<key_t const>(keys_.data(), keys_.size())] __device__(
+        auto key) {
+        auto it = thrust::lower_bound(thrust::seq, cache_keys.begin(), cache_keys.end(), key);
+        return ((it != cache_keys.end()) && (*it == key))
+                 ? static_cast<size_t>(thrust::distance(cache_keys.begin(), it))
+                 : std::numeric_limits<size_t>::max();
+      });
+
+    auto num_hits = static_cast<size_t>(
+      thrust::count_if(rmm::exec_policy(stream_view),
+                       positions.begin(),
+                       positions.end(),
+                       [] __device__(auto p) { return p != std::numeric_limits<size_t>::max(); }));
+
+    rmm::device_uvector<key_t> hit_keys(num_hits, stream_view);
+    rmm::device_uvector<size_t> hit_positions(num_hits, stream_view);
+    auto pair_first = thrust::make_zip_iterator(sorted_unique_keys.begin(), positions.begin());
+    thrust::copy_if(rmm::exec_policy_nosync(stream_view),
+                    pair_first,
+                    pair_first + sorted_unique_keys.size(),
+                    thrust::make_zip_iterator(hit_keys.begin(), hit_positions.begin()),
+                    [] __device__(auto pair) {
+                      return thrust::get<1>(pair) != std::numeric_limits<size_t>::max();
+                    });
+    sorted_unique_keys.resize(
+      thrust::distance(sorted_unique_keys.begin(),
+                       thrust::remove_if(rmm::exec_policy_nosync(stream_view),
+                                         sorted_unique_keys.begin(),
+                                         sorted_unique_keys.end(),
+                                         positions.begin(),
+                                         [] __device__(auto p) {
+                                           return p != std::numeric_limits<size_t>::max();
+                                         })),
+      stream_view);
+
+    auto hit_values = allocate_dataframe_buffer<value_t>(num_hits, stream_view);
+    thrust::gather(rmm::exec_policy_nosync(stream_view),
+                   hit_positions.begin(),
+                   hit_positions.end(),
+                   get_dataframe_buffer_begin(values_),
+                   get_dataframe_buffer_begin(hit_values));
+    thrust::for_each(rmm::exec_policy_nosync(stream_view),
+                     hit_positions.begin(),
+                     hit_positions.end(),
+                     [last_used = last_used_.data(), clock = clock_] __device__(auto p) {
+                       last_used[p] = clock;
+                     });
+
+    return std::make_tuple(std::move(hit_keys), std::move(hit_values));
+  }
+
+  // Insert (key, value) pairs (sorted unique keys not in the cache) and evict the least recently
+  // used entries if the cache exceeds its capacity.
+  template <typename ValueIterator>
+  void insert(raft::device_span<key_t const> sorted_unique_keys,
+              ValueIterator value_first,
+              rmm::cuda_stream_view stream_view)
+  {
+    rmm::device_uvector<key_t> merged_keys(keys_.size() + sorted_unique_keys.size(), stream_view);
+    auto merged_values = allocate_dataframe_buffer<value_t>(merged_keys.size(), stream_view);
+    rmm::device_uvector<uint64_t> merged_last_used(merged_keys.size(), stream_view);
+    thrust::merge_by_key(
+      rmm::exec_policy_nosync(stream_view),
+      keys_.begin(),
+      keys_.end(),
+      sorted_unique_keys.begin(),
+      sorted_unique_keys.end(),
+      thrust::make_zip_iterator(get_dataframe_buffer_begin(values_), last_used_.begin()),
+      thrust::make_zip_iterator(value_first, thrust::make_constant_iterator(clock_)),
+      merged_keys.begin(),
+      thrust::make_zip_iterator(get_dataframe_buffer_begin(merged_values),
+                                merged_last_used.begin()));
+
+    if (merged_keys.size() > capacity_) {
+      rmm::device_uvector<size_t> indices(merged_keys.size(), stream_view);
+      thrust::sequence(rmm::exec_policy_nosync(stream_view), indices.begin(), indices.end());
+      {
+        rmm::device_uvector<uint64_t> tmp_last_used(merged_last_used.size(), stream_view);
+        thrust::copy(rmm::exec_policy_nosync(stream_view),
+                     merged_last_used.begin(),
+                     merged_last_used.end(),
+                     tmp_last_used.begin());
+        thrust::stable_sort_by_key(rmm::exec_policy_nosync(stream_view),
+                                   tmp_last_used.begin(),
+                                   tmp_last_used.end(),
+                                   indices.begin(),
+                                   thrust::greater<uint64_t>{});
+      }
+      indices.resize(capacity_, stream_view);
+      thrust::sort(rmm::exec_policy_nosync(stream_view), indices.begin(), indices.end());
+
+      keys_.resize(indices.size(), stream_view);
+      resize_dataframe_buffer(values_, indices.size(), stream_view);
+      last_used_.resize(indices.size(), stream_view);
+      thrust::gather(rmm::exec_policy_nosync(stream_view),
+                     indices.begin(),
+                     indices.end(),
+                     thrust::make_zip_iterator(merged_keys.begin(),
+                                               get_dataframe_buffer_begin(merged_values),
+                                               merged_last_used.begin()),
+                     thrust::make_zip_iterator(
+                       keys_.begin(), get_dataframe_buffer_begin(values_), last_used_.begin()));
+    } else {
+      keys_      = std::move(merged_keys);
+      values_    = std::move(merged_values);
+      last_used_ = std::move(merged_last_used);
+    }
+  }
+
+ private:
+  rmm::device_uvector<key_t> keys_;  // sorted
+  dataframe_buffer_type_t<value_t> values_;
+  rmm::device_uvector<uint64_t> last_used_;
+  size_t capacity_{0};
+  uint64_t clock_{0};
+};
+
+// Same as collect_values_for_keys but the values of the keys found in @p cache are not collected
+// again, and the values collected for the remote keys (key_to_comm_rank_op(key) !=
+// comm.get_rank()) are inserted to @p cache.
+template <typename KVStoreViewType, typename KeyIterator, typename KeyToCommRankOp>
+dataframe_buffer_type_t<typename KVStoreViewType::value_type> collect_values_for_keys(
+  raft::comms::comms_t const& comm,
+  KVStoreViewType kv_store_view,
+  KeyIterator collect_key_first,
+  KeyIterator collect_key_last,
+  KeyToCommRankOp key_to_comm_rank_op,
+  collect_values_cache_t<typename KVStoreViewType::key_type,
+                         typename KVStoreViewType::value_type>& cache,
+  rmm::cuda_stream_view stream_view)
+{
+  using key_t = typename KVStoreViewType::key_type;
+  static_assert(std::is_same_v<typename thrust::iterator_traits<KeyIterator>::value_type, key_t>);
+  using value_t = typename KVStoreViewType::value_type;
+
+  auto const comm_rank = comm.get_rank();
+
+  // 1. find the unique keys in [collect_key_first, collect_key_last) and look them up in the cache
+
+  rmm::device_uvector<key_t> unique_keys(thrust::distance(collect_key_first, collect_key_last),
+                                         stream_view);
+  thrust::copy(
+    rmm::exec_policy_nosync(stream_view), collect_key_first, collect_key_last, unique_keys.begin());
+  thrust::sort(rmm::exec_policy_nosync(stream_view), unique_keys.begin(), unique_keys.end());
+  unique_keys.resize(
+    thrust::distance(
+      unique_keys.begin(),
+      thrust::unique(rmm::exec_policy(stream_view), unique_keys.begin(), unique_keys.end())),
+    stream_view);
+
+  auto [hit_keys, hit_values] = cache.find_and_remove_hits(unique_keys, stream_view);
+
+  // 2. collect values for the cache misses and cache the values for the remote keys
+
+  auto values_for_unique_keys = allocate_dataframe_buffer<value_t>(0, stream_view);
+  std::tie(unique_keys, values_for_unique_keys) = collect_values_for_unique_keys(
+    comm, kv_store_view, std::move(unique_keys), key_to_comm_rank_op, stream_view);
+
+  {
+    rmm::device_uvector<key_t> remote_keys(unique_keys.size(), stream_view);
+    auto remote_values = allocate_dataframe_buffer<value_t>(remote_keys.size(), stream_view);
+    auto pair_first    = thrust::make_zip_iterator(unique_keys.begin(),
+                                                get_dataframe_buffer_begin(values_for_unique_keys));
+    auto remote_pair_last = thrust::copy_if(
+      rmm::exec_policy(stream_view),
+      pair_first,
+      pair_first + unique_keys.size(),
+      thrust::make_zip_iterator(remote_keys.begin(), get_dataframe_buffer_begin(remote_values)),
+      [key_to_comm_rank_op, comm_rank] __device__(auto pair) {
+        return key_to_comm_rank_op(thrust::get<0>(pair)) != comm_rank;
+      });
+    remote_keys.resize(
+      thrust::distance(
+        thrust::make_zip_iterator(remote_keys.begin(), get_dataframe_buffer_begin(remote_values)),
+        remote_pair_last),
+      stream_view);
+    cache.insert(raft::device_span<key_t const>(remote_keys.data(), remote_keys.size()),
+                 get_dataframe_buffer_begin(remote_values),
+                 stream_view);
+  }
+
+  // 3. merge the cache hits and the collected values
+
+  rmm::device_uvector<key_t> merged_keys(hit_keys.size() + unique_keys.size(), stream_view);
+  auto merged_values = allocate_dataframe_buffer<value_t>(merged_keys.size(), stream_view);
+  thrust::merge_by_key(rmm::exec_policy_nosync(stream_view),
+                       hit_keys.begin(),
+                       hit_keys.end(),
+                       unique_keys.begin(),
+                       unique_keys.end(),
+                       get_dataframe_buffer_begin(hit_values),
+                       get_dataframe_buffer_begin(values_for_unique_keys),
+                       merged_keys.begin(),
+                       get_dataframe_buffer_begin(merged_values));
+  hit_keys.resize(0, stream_view);
+  hit_keys.shrink_to_fit(stream_view);
+  unique_keys.resize(0, stream_view);
+  unique_keys.shrink_to_fit(stream_view);
+
+  // 4. find values for [collect_key_first, collect_key_last)
+
+  return detail::find_values_from_unique_kv_pairs(kv_store_view,
+                                                  std::move(merged_keys),
+                                                  std::move(merged_values),
+                                                  collect_key_first,
+                                                  collect_key_last,
+                                                  stream_view);
+}
+
 template <typename vertex_t, typename ValueIterator>
 dataframe_buffer_type_t<typename thrust::iterator_traits<ValueIterator>::value_type>
 collect_values_for_sorted_unique_int_vertices(
@@ -206,6 +559,42 @@ collect_values_for_sorted_unique_int_vertices(
                       comm_rank_vertex_partition_range_lasts.size(),
                       stream_view);
 
+#ifdef CUGRAPH_ENABLE_PEER_ACCESS_COLLECT
+  // When every rank can directly access every other rank's device memory (single node, NVLink or
+  // PCIe P2P), map the local vertex partition values to every rank and replace the two shuffles
+  // below with direct loads.
+  if constexpr (std::is_arithmetic_v<value_t>) {
+    if (detail::all_ranks_peer_accessible(comm, stream_view)) {
+      auto local_size = static_cast<size_t>(comm_rank_vertex_partition_range_lasts[comm.get_rank()] -
+                                            local_vertex_partition_range_first);
+      detail::peer_mapped_buffer_t<value_t> peer_values(comm, local_size, stream_view);
+      thrust::copy(rmm::exec_policy_nosync(stream_view),
+                   local_value_first,
+                   local_value_first + local_size,
+                   peer_values.local_data());
+      peer_values.fence();
+
+      auto value_buffer =
+        allocate_dataframe_buffer<value_t>(collect_sorted_unique_int_vertices.size(), stream_view);
+      thrust::transform(
+        rmm::exec_policy_nosync(stream_view),
+        collect_sorted_unique_int_vertices.begin(),
+        collect_sorted_unique_int_vertices.end(),
+        get_dataframe_buffer_begin(value_buffer),
+        [range_lasts = raft::device_span<vertex_t const>(d_range_lasts.data(), d_range_lasts.size()),
+         peer_ptrs   = peer_values.peer_data()] __device__(auto v) {
+          auto rank = static_cast<int>(thrust::distance(
+            range_lasts.begin(),
+            thrust::upper_bound(thrust::seq, range_lasts.begin(), range_lasts.end(), v)));
+          auto range_first = rank > 0 ? range_lasts[rank - 1] : vertex_t{0};
+          return peer_ptrs[rank][v - range_first];
+        });
+
+      return value_buffer;  // peer_values' destructor synchronizes before unmapping
+    }
+  }
+#endif
+
   rmm::device_uvector<size_t> d_offsets(d_range_lasts.size() - 1, stream_view);
   thrust::lower_bound(rmm::exec_policy_nosync(stream_view),
                       collect_sorted_unique_int_vertices.begin(),
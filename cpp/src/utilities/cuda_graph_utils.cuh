@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+namespace cugraph {
+
+namespace detail {
+
+// Captures the work a callable enqueues on a stream once (as a CUDA graph) and replays it with a
+// single launch. The captured work should neither synchronize the stream (use
+// rmm::exec_policy_nosync for thrust calls) nor allocate or deallocate memory; the device pointers
+// are baked into the graph, so the buffers the work touches should outlive this object.
+class cuda_graph_t {
+ public:
+  template <typename WorkOp>
+  cuda_graph_t(rmm::cuda_stream_view stream_view, WorkOp work_op)
+  {
+    RAFT_CUDA_TRY(cudaStreamBeginCapture(stream_view.value(), cudaStreamCaptureModeThreadLocal));
+    cudaGraph_t graph{nullptr};
+    try {
+      work_op(stream_view);
+    } catch (...) {
+      cudaStreamEndCapture(stream_view.value(), &graph);
+      if (graph != nullptr) { cudaGraphDestroy(graph); }
+      throw;
+    }
+    RAFT_CUDA_TRY(cudaStreamEndCapture(stream_view.value(), &graph));
+    auto status = cudaGraphInstantiateWithFlags(&graph_exec_, graph, 0);
+    cudaGraphDestroy(graph);
+    RAFT_CUDA_TRY(status);
+  }
+
+  cuda_graph_t(cuda_graph_t const&)            = delete;
+  cuda_graph_t& operator=(cuda_graph_t const&) = delete;
+
+  ~cuda_graph_t()
+  {
+    if (graph_exec_ != nullptr) { cudaGraphExecDestroy(graph_exec_); }
+  }
+
+  void launch(rmm::cuda_stream_view stream_view) const
+  {
+    RAFT_CUDA_TRY(cudaGraphLaunch(graph_exec_, stream_view.value()));
+  }
+
+ private:
+  cudaGraphExec_t graph_exec_{nullptr};
+};
+
+}  // namespace detail
+
+}  // namespace cugraph
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/hierarchical_shuffle.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// handles with the two-level shuffle enabled (process-wide)
+std::mutex hierarchical_shuffle_mutex{};
+std::set<raft::handle_t const*> hierarchical_shuffle_handles{};
+
+}  // namespace
+
+bool enable_hierarchical_shuffle(raft::handle_t& handle, bool enable)
+{
+  if (!enable) {
+    std::lock_guard<std::mutex> lock(hierarchical_shuffle_mutex);
+    hierarchical_shuffle_handles.erase(&handle);
+    return false;
+  }
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+
+  char hostname[HOST_NAME_MAX + 1]{};
+  gethostname(hostname, HOST_NAME_MAX);
+  auto host_hashes = host_scalar_allgather(
+    comm, std::hash<std::string>{}(std::string(hostname)), handle.get_stream());
+
+  // node IDs are assigned in the order of the first comm rank in each node, local ranks are
+  // assigned in the comm rank order
+
+  std::vector<size_t> node_hashes{};
+  std::vector<int> node_ids(comm_size);
+  std::vector<int> local_ranks(comm_size);
+  std::vector<int> node_sizes{};
+  for (int r = 0; r < comm_size; ++r) {
+    auto it = std::find(node_hashes.begin(), node_hashes.end(), host_hashes[r]);
+    if (it == node_hashes.end()) {
+      node_hashes.push_back(host_hashes[r]);
+      node_sizes.push_back(0);
+      it = node_hashes.end() - 1;
+    }
+    node_ids[r]    = static_cast<int>(std::distance(node_hashes.begin(), it));
+    local_ranks[r] = node_sizes[node_ids[r]]++;
+  }
+
+  auto num_nodes = static_cast<int>(node_sizes.size());
+  if ((num_nodes <= 1) || (node_sizes[0] <= 1) ||
+      !std::all_of(node_sizes.begin(), node_sizes.end(), [size = node_sizes[0]](auto s) {
+        return s == size;
+      })) {
+    std::lock_guard<std::mutex> lock(hierarchical_shuffle_mutex);
+    hierarchical_shuffle_handles.erase(&handle);
+    return false;
+  }
+
+  auto rank = comm.get_rank();
+  handle.set_subcomm(
+    node_local_comm_name(),
+    std::make_shared<raft::comms::comms_t>(comm.comm_split(node_ids[rank], local_ranks[rank])));
+  handle.set_subcomm(
+    node_cross_comm_name(),
+    std::make_shared<raft::comms::comms_t>(comm.comm_split(local_ranks[rank], node_ids[rank])));
+
+  std::lock_guard<std::mutex> lock(hierarchical_shuffle_mutex);
+  hierarchical_shuffle_handles.insert(&handle);
+  return true;
+}
+
+bool is_hierarchical_shuffle_enabled(raft::handle_t const& handle)
+{
+  std::lock_guard<std::mutex> lock(hierarchical_shuffle_mutex);
+  return hierarchical_shuffle_handles.find(&handle) != hierarchical_shuffle_handles.end();
+}
+
+}  // namespace cugraph
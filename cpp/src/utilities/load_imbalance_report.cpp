@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/load_imbalance_report.hpp>
+#include <cugraph/utilities/prim_profiler.hpp>
+
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cugraph {
+
+namespace {
+
+template <typename T>
+double max_over_mean(std::vector<T> const& values)
+{
+  if (values.size() == 0) { return 1.0; }
+  auto sum  = std::accumulate(values.begin(), values.end(), double{0.0});
+  auto mean = sum / static_cast<double>(values.size());
+  return mean > 0.0 ? static_cast<double>(*std::max_element(values.begin(), values.end())) / mean
+                    : 1.0;
+}
+
+}  // namespace
+
+double phase_load_imbalance_record_t::compute_seconds(size_t i) const
+{
+  return std::max(elapsed_seconds[i] - comm_wait_seconds[i], 0.0);
+}
+
+int phase_load_imbalance_record_t::straggler_rank() const
+{
+  int ret{0};
+  for (size_t i = 1; i < elapsed_seconds.size(); ++i) {
+    if (compute_seconds(i) > compute_seconds(ret)) { ret = static_cast<int>(i); }
+  }
+  return ret;
+}
+
+double phase_load_imbalance_record_t::compute_imbalance() const
+{
+  std::vector<double> compute(elapsed_seconds.size());
+  for (size_t i = 0; i < compute.size(); ++i) {
+    compute[i] = compute_seconds(i);
+  }
+  return max_over_mean(compute);
+}
+
+double load_imbalance_report_t::vertex_imbalance() const
+{
+  return max_over_mean(num_local_vertices);
+}
+
+double load_imbalance_report_t::edge_imbalance() const { return max_over_mean(num_local_edges); }
+
+load_imbalance_report_t build_load_imbalance_report(raft::handle_t const& handle,
+                                                    size_t num_local_vertices,
+                                                    size_t num_local_edges,
+                                                    bool clear_profiler)
+{
+  auto& profiler = prim_profiler_t::instance();
+  auto records   = profiler.report();
+  if (clear_profiler) { profiler.clear(); }
+
+  load_imbalance_report_t report{};
+  report.phases.resize(records.size());
+
+  if (!handle.comms_initialized()) {
+    report.num_local_vertices = {num_local_vertices};
+    report.num_local_edges    = {num_local_edges};
+    for (size_t i = 0; i < records.size(); ++i) {
+      report.phases[i] = phase_load_imbalance_record_t{
+        records[i].name, {records[i].elapsed_seconds}, {records[i].comm_wait_seconds}};
+    }
+    return report;
+  }
+
+  auto& comm = handle.get_comms();
+
+  auto num_records = host_scalar_allgather(comm, records.size(), handle.get_stream());
+  CUGRAPH_EXPECTS(
+    std::all_of(num_records.begin(),
+                num_records.end(),
+                [n = num_records[0]](auto num) { return num == n; }),
+    "Invalid input argument: every GPU should have recorded the same phases.");
+
+  auto counts = host_scalar_allgather(
+    comm, thrust::make_tuple(num_local_vertices, num_local_edges), handle.get_stream());
+  report.num_local_vertices.resize(counts.size());
+  report.num_local_edges.resize(counts.size());
+  for (size_t i = 0; i < counts.size(); ++i) {
+    report.num_local_vertices[i] = thrust::get<0>(counts[i]);
+    report.num_local_edges[i]    = thrust::get<1>(counts[i]);
+  }
+
+  // the records are sorted by name, so the i'th record of every GPU is the same phase
+  for (size_t i = 0; i < records.size(); ++i) {
+    auto times = host_scalar_allgather(
+      comm,
+      thrust::make_tuple(records[i].elapsed_seconds, records[i].comm_wait_seconds),
+      handle.get_stream());
+    auto& phase = report.phases[i];
+    phase.name  = records[i].name;
+    phase.elapsed_seconds.resize(times.size());
+    phase.comm_wait_seconds.resize(times.size());
+    for (size_t j = 0; j < times.size(); ++j) {
+      phase.elapsed_seconds[j]   = thrust::get<0>(times[j]);
+      phase.comm_wait_seconds[j] = thrust::get<1>(times[j]);
+    }
+  }
+
+  return report;
+}
+
+}  // namespace cugraph
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/memory_estimates.hpp>
+
+#include <algorithm>
+
+namespace cugraph {
+
+namespace {
+
+// kv_store_t (used to renumber edge end points) capacity = # keys / 0.7, use 2.5 (as in
+// renumber_edgelist) to account for the load factor in both keys and values
+double constexpr kv_store_overhead = 2.5;
+
+struct local_sizes_t {
+  size_t vertex_partition_size{};  // V / P
+  size_t major_range_size{};       // V / major_comm_size (sum over the local edge partitions)
+  size_t minor_range_size{};       // V / minor_comm_size
+  size_t number_of_edges{};        // E / P
+  size_t number_of_edge_partitions{};
+};
+
+local_sizes_t compute_local_sizes(size_t number_of_vertices,
+                                  size_t number_of_edges,
+                                  int major_comm_size,
+                                  int minor_comm_size)
+{
+  CUGRAPH_EXPECTS((major_comm_size > 0) && (minor_comm_size > 0),
+                  "Invalid input argument: communicator sizes should be positive.");
+  auto comm_size = static_cast<size_t>(major_comm_size) * static_cast<size_t>(minor_comm_size);
+  auto div_ceil  = [](size_t a, size_t b) { return (a + b - 1) / b; };
+  return local_sizes_t{div_ceil(number_of_vertices, comm_size),
+                       div_ceil(number_of_vertices, static_cast<size_t>(major_comm_size)),
+                       div_ceil(number_of_vertices, static_cast<size_t>(minor_comm_size)),
+                       div_ceil(number_of_edges, comm_size),
+                       static_cast<size_t>(minor_comm_size)};
+}
+
+// temporary buffer size of renumber_edgelist excluding the input edge list and the renumber map
+template <typename vertex_t, typename edge_t>
+size_t renumber_temporary_bytes(local_sizes_t const& sizes)
+{
+  // 1. compute the renumber map: each edge partition's majors are copied and sorted (double
+  // buffered) to find the unique vertices and their degrees, and the (unique vertex, degree) pairs
+  // of every local edge partition are shuffled to the owning ranks (send + receive buffers)
+  auto max_partition_edges =
+    (sizes.number_of_edges + sizes.number_of_edge_partitions - 1) / sizes.number_of_edge_partitions;
+  auto sort_bytes = max_partition_edges * sizeof(vertex_t) * 2;
+  auto unique_bytes =
+    (sizes.major_range_size + sizes.minor_range_size) * (sizeof(vertex_t) + sizeof(edge_t)) * 2;
+  auto map_bytes = sort_bytes + unique_bytes;
+
+  // 2. renumber edge end points: renumber map labels for the largest major range + kv_store_t, and
+  // then renumber map labels for the minor range + kv_store_t (the minor range is not chunked for
+  // the upper bound)
+  auto kv_bytes = [](size_t n) {
+    return n * sizeof(vertex_t) +
+           static_cast<size_t>(static_cast<double>(n * sizeof(vertex_t) * 2) * kv_store_overhead);
+  };
+  auto relabel_bytes =
+    std::max(kv_bytes(sizes.vertex_partition_size), kv_bytes(sizes.minor_range_size));
+
+  return std::max(map_bytes, relabel_bytes);
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_renumber_edgelist_memory(size_t number_of_vertices,
+                                                    size_t number_of_edges,
+                                                    int major_comm_size,
+                                                    int minor_comm_size)
+{
+  auto sizes =
+    compute_local_sizes(number_of_vertices, number_of_edges, major_comm_size, minor_comm_size);
+
+  auto input_bytes = sizes.number_of_edges * sizeof(vertex_t) * 2;
+  auto map_bytes   = sizes.vertex_partition_size * sizeof(vertex_t);
+
+  return memory_estimate_t{
+    map_bytes, input_bytes + map_bytes + renumber_temporary_bytes<vertex_t, edge_t>(sizes)};
+}
+
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_create_graph_from_edgelist_memory(size_t number_of_vertices,
+                                                             size_t number_of_edges,
+                                                             size_t edge_property_bytes,
+                                                             bool renumber,
+                                                             int major_comm_size,
+                                                             int minor_comm_size)
+{
+  auto sizes =
+    compute_local_sizes(number_of_vertices, number_of_edges, major_comm_size, minor_comm_size);
+
+  auto edge_bytes  = sizeof(vertex_t) * 2 + edge_property_bytes;
+  auto input_bytes = sizes.number_of_edges * edge_bytes;
+  auto map_bytes   = renumber ? sizes.vertex_partition_size * sizeof(vertex_t) : size_t{0};
+
+  // 1. renumber (in-place)
+  auto renumber_peak =
+    renumber ? input_bytes + map_bytes + renumber_temporary_bytes<vertex_t, edge_t>(sizes)
+             : size_t{0};
+
+  // 2. split the edge list to the local edge partitions (multi-GPU), each element array is copied
+  // to per-partition buffers and released one at a time
+  auto split_peak = sizes.number_of_edge_partitions > 1
+                      ? input_bytes + map_bytes + sizes.number_of_edges * sizeof(vertex_t)
+                      : size_t{0};
+
+  // 3. sort_and_compress_edgelist (per edge partition): the (major, minor, property) tuples are
+  // sorted (double buffered), then the offsets are computed and the minors become the indices
+  auto offsets_bytes = (sizes.major_range_size + sizes.number_of_edge_partitions) * sizeof(edge_t);
+  auto max_partition_edges =
+    (sizes.number_of_edges + sizes.number_of_edge_partitions - 1) / sizes.number_of_edge_partitions;
+  auto compress_peak = input_bytes + map_bytes + max_partition_edges * edge_bytes + offsets_bytes;
+
+  auto graph_bytes =
+    offsets_bytes + sizes.number_of_edges * (sizeof(vertex_t) + edge_property_bytes);
+
+  return memory_estimate_t{graph_bytes + map_bytes,
+                           std::max({renumber_peak, split_peak, compress_peak})};
+}
+
+template <typename vertex_t, typename edge_t>
+memory_estimate_t estimate_neighbor_sample_memory(size_t number_of_seeds_per_rank,
+                                                  raft::host_span<int32_t const> fan_out,
+                                                  size_t edge_property_bytes,
+                                                  bool return_hops,
+                                                  int major_comm_size,
+                                                  int minor_comm_size)
+{
+  CUGRAPH_EXPECTS((major_comm_size > 0) && (minor_comm_size > 0),
+                  "Invalid input argument: communicator sizes should be positive.");
+  auto multi_gpu = (major_comm_size * minor_comm_size) > 1;
+
+  auto output_edge_bytes =
+    sizeof(vertex_t) * 2 + edge_property_bytes + (return_hops ? sizeof(int32_t) : size_t{0});
+
+  size_t frontier_size{number_of_seeds_per_rank};
+  size_t output_edges{0};
+  size_t max_hop_temporary_bytes{0};
+  for (size_t i = 0; i < fan_out.size(); ++i) {
+    CUGRAPH_EXPECTS(fan_out[i] >= 0,
+                    "Invalid input argument: fan_out values should be non-negative.");
+    auto hop_edges = frontier_size * static_cast<size_t>(fan_out[i]);
+    // sample_edges: frontier (+ frontier gathered over the minor communicator in multi-GPU), per
+    // sample local edge indices and random numbers, and the sampled edges (double buffered when
+    // appended to the hop's result)
+    auto frontier_bytes = frontier_size * sizeof(vertex_t) *
+                          (multi_gpu ? static_cast<size_t>(minor_comm_size) + 1 : size_t{1});
+    auto hop_temporary_bytes = frontier_bytes + hop_edges * (sizeof(edge_t) + sizeof(double)) +
+                               hop_edges * output_edge_bytes;
+    max_hop_temporary_bytes =
+      std::max(max_hop_temporary_bytes, output_edges * output_edge_bytes + hop_temporary_bytes);
+    output_edges += hop_edges;
+    frontier_size = hop_edges;
+  }
+
+  // the per-hop results are concatenated (and shuffled back to the seed owners in multi-GPU)
+  auto output_bytes = output_edges * output_edge_bytes;
+  auto concat_peak  = output_bytes * (multi_gpu ? size_t{3} : size_t{2});
+
+  return memory_estimate_t{output_bytes, std::max(max_hop_temporary_bytes, concat_peak)};
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+memory_estimate_t estimate_louvain_memory(size_t number_of_vertices,
+                                          size_t number_of_edges,
+                                          int major_comm_size,
+                                          int minor_comm_size)
+{
+  auto sizes =
+    compute_local_sizes(number_of_vertices, number_of_edges, major_comm_size, minor_comm_size);
+
+  // dendrogram level + next clusters + vertex weights + cluster keys & weights
+  auto vertex_bytes = sizes.vertex_partition_size * (sizeof(vertex_t) * 3 + sizeof(weight_t) * 2);
+  // edge source/destination property caches (cluster assignments & vertex weights)
+  auto cache_bytes =
+    (sizes.major_range_size + sizes.minor_range_size) * (sizeof(vertex_t) + sizeof(weight_t));
+
+  // update_clustering: (source, destination cluster) keys and weights per edge, sorted (double
+  // buffered) and reduced
+  auto update_bytes = sizes.number_of_edges * (sizeof(vertex_t) * 2 + sizeof(weight_t)) * 2;
+
+  // coarsen_graph: relabeled edge list, sorted & reduced (double buffered), shuffled (send +
+  // receive buffers in multi-GPU), and the coarsened graph (no larger than the input graph)
+  auto coarsen_edge_bytes = sizes.number_of_edges * (sizeof(vertex_t) * 2 + sizeof(weight_t));
+  auto coarse_graph_bytes =
+    (sizes.major_range_size + sizes.number_of_edge_partitions) * sizeof(edge_t) +
+    sizes.number_of_edges * (sizeof(vertex_t) + sizeof(weight_t));
+  auto coarsen_bytes = coarsen_edge_bytes * 2 + coarse_graph_bytes;
+
+  return memory_estimate_t{sizes.vertex_partition_size * sizeof(vertex_t),
+                           vertex_bytes + cache_bytes + std::max(update_bytes, coarsen_bytes)};
+}
+
+template memory_estimate_t estimate_renumber_edgelist_memory<int32_t, int32_t>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+template memory_estimate_t estimate_create_graph_from_edgelist_memory<int32_t, int32_t>(
+  size_t number_of_vertices,
+  size_t number_of_edges,
+  size_t edge_property_bytes,
+  bool renumber,
+  int major_comm_size,
+  int minor_comm_size);
+
+template memory_estimate_t estimate_neighbor_sample_memory<int32_t, int32_t>(
+  size_t number_of_seeds_per_rank,
+  raft::host_span<int32_t const> fan_out,
+  size_t edge_property_bytes,
+  bool return_hops,
+  int major_comm_size,
+  int minor_comm_size);
+
+template memory_estimate_t estimate_louvain_memory<int32_t, int32_t, float>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+template memory_estimate_t estimate_louvain_memory<int32_t, int32_t, double>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+template memory_estimate_t estimate_renumber_edgelist_memory<int64_t, int64_t>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+template memory_estimate_t estimate_create_graph_from_edgelist_memory<int64_t, int64_t>(
+  size_t number_of_vertices,
+  size_t number_of_edges,
+  size_t edge_property_bytes,
+  bool renumber,
+  int major_comm_size,
+  int minor_comm_size);
+
+template memory_estimate_t estimate_neighbor_sample_memory<int64_t, int64_t>(
+  size_t number_of_seeds_per_rank,
+  raft::host_span<int32_t const> fan_out,
+  size_t edge_property_bytes,
+  bool return_hops,
+  int major_comm_size,
+  int minor_comm_size);
+
+template memory_estimate_t estimate_louvain_memory<int64_t, int64_t, float>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+template memory_estimate_t estimate_louvain_memory<int64_t, int64_t, double>(
+  size_t number_of_vertices, size_t number_of_edges, int major_comm_size, int minor_comm_size);
+
+}  // namespace cugraph
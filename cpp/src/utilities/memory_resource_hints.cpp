@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/memory_resource_hints.hpp>
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace cugraph {
+
+namespace {
+
+// memory resource hints per (handle, usage) (process-wide)
+std::mutex memory_resource_hint_mutex{};
+std::map<std::pair<raft::handle_t const*, memory_usage_t>, rmm::device_async_resource_ref>
+  memory_resource_hints{};
+
+}  // namespace
+
+void set_memory_resource_hint(raft::handle_t const& handle,
+                              memory_usage_t usage,
+                              std::optional<rmm::device_async_resource_ref> mr)
+{
+  std::lock_guard<std::mutex> lock(memory_resource_hint_mutex);
+  auto key = std::make_pair(&handle, usage);
+  if (mr) {
+    memory_resource_hints.insert_or_assign(key, *mr);
+  } else {
+    memory_resource_hints.erase(key);
+  }
+}
+
+std::optional<rmm::device_async_resource_ref> get_memory_resource_hint(
+  raft::handle_t const& handle, memory_usage_t usage)
+{
+  std::lock_guard<std::mutex> lock(memory_resource_hint_mutex);
+  auto it = memory_resource_hints.find(std::make_pair(&handle, usage));
+  return it != memory_resource_hints.end() ? std::make_optional(it->second) : std::nullopt;
+}
+
+}  // namespace cugraph
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/comms.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cuda_runtime_api.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// Returns true if every rank in comm can directly load from every other rank's device memory
+// (all ranks run on one node and every pair of devices has peer access, e.g. over NVLink). This is
+// a collective call.
+inline bool all_ranks_peer_accessible(raft::comms::comms_t const& comm,
+                                      rmm::cuda_stream_view stream_view)
+{
+  char hostname[HOST_NAME_MAX + 1]{};
+  gethostname(hostname, HOST_NAME_MAX);
+  auto host_hash = std::hash<std::string>{}(std::string(hostname));
+  int device_id{};
+  RAFT_CUDA_TRY(cudaGetDevice(&device_id));
+
+  auto host_hashes = host_scalar_allgather(comm, host_hash, stream_view.value());
+  auto device_ids  = host_scalar_allgather(comm, device_id, stream_view.value());
+
+  int accessible{1};
+  for (size_t i = 0; i < host_hashes.size(); ++i) {
+    if (host_hashes[i] != host_hash) {
+      accessible = 0;
+      break;
+    }
+    if (device_ids[i] != device_id) {
+      int can_access{0};
+      RAFT_CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, device_id, device_ids[i]));
+      if (can_access == 0) {
+        accessible = 0;
+        break;
+      }
+    }
+  }
+
+  return host_scalar_allreduce(comm, accessible, raft::comms::op_t::MIN, stream_view.value()) > 0;
+}
+
+// A device buffer (one per rank) mapped to every rank's address space with CUDA IPC, so remote
+// values can be read with direct loads instead of a request/response all-to-all. The buffer is
+// allocated with cudaMalloc (not RMM) as CUDA IPC handles refer to the base of an allocation. The
+// constructor and the destructor are collective calls; call all_ranks_peer_accessible() first.
+template <typename T>
+class peer_mapped_buffer_t {
+ public:
+  peer_mapped_buffer_t(raft::comms::comms_t const& comm,
+                       size_t local_size,
+                       rmm::cuda_stream_view stream_view)
+    : comm_(comm),
+      stream_view_(stream_view),
+      local_size_(local_size),
+      peer_ptrs_(static_cast<size_t>(comm.get_size()), stream_view)
+  {
+    RAFT_CUDA_TRY(cudaMalloc(&local_ptr_, std::max(local_size, size_t{1}) * sizeof(T)));
+
+    cudaIpcMemHandle_t local_handle{};
+    RAFT_CUDA_TRY(cudaIpcGetMemHandle(&local_handle, local_ptr_));
+
+    rmm::device_uvector<uint8_t> d_handles(sizeof(cudaIpcMemHandle_t) * comm.get_size(),
+                                           stream_view);
+    raft::update_device(d_handles.data() + sizeof(cudaIpcMemHandle_t) * comm.get_rank(),
+                        reinterpret_cast<uint8_t const*>(&local_handle),
+                        sizeof(cudaIpcMemHandle_t),
+                        stream_view);
+    device_allgather(comm,
+                     d_handles.data() + sizeof(cudaIpcMemHandle_t) * comm.get_rank(),
+                     d_handles.data(),
+                     sizeof(cudaIpcMemHandle_t),
+                     stream_view);
+    std::vector<uint8_t> h_handles(d_handles.size());
+    raft::update_host(h_handles.data(), d_handles.data(), d_handles.size(), stream_view);
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view));
+
+    h_peer_ptrs_.resize(comm.get_size(), nullptr);
+    for (int i = 0; i < comm.get_size(); ++i) {
+      if (i == comm.get_rank()) {
+        h_peer_ptrs_[i] = local_ptr_;
+      } else {
+        cudaIpcMemHandle_t handle{};
+        std::memcpy(&handle, h_handles.data() + sizeof(cudaIpcMemHandle_t) * i, sizeof(handle));
+        void* ptr{nullptr};
+        RAFT_CUDA_TRY(cudaIpcOpenMemHandle(&ptr, handle, cudaIpcMemLazyEnablePeerAccess));
+        h_peer_ptrs_[i] = static_cast<T*>(ptr);
+      }
+    }
+    raft::update_device(peer_ptrs_.data(), h_peer_ptrs_.data(), h_peer_ptrs_.size(), stream_view);
+  }
+
+  peer_mapped_buffer_t(peer_mapped_buffer_t const&)            = delete;
+  peer_mapped_buffer_t& operator=(peer_mapped_buffer_t const&) = delete;
+
+  ~peer_mapped_buffer_t()
+  {
+    // no rank should unmap or free its buffer before the other ranks finish reading from it
+    RAFT_CUDA_TRY_NO_THROW(cudaStreamSynchronize(stream_view_));
+    comm_.barrier();
+    for (int i = 0; i < static_cast<int>(h_peer_ptrs_.size()); ++i) {
+      if (i != comm_.get_rank()) { RAFT_CUDA_TRY_NO_THROW(cudaIpcCloseMemHandle(h_peer_ptrs_[i])); }
+    }
+    RAFT_CUDA_TRY_NO_THROW(cudaFree(local_ptr_));
+  }
+
+  T* local_data() { return local_ptr_; }
+  size_t local_size() const { return local_size_; }
+
+  // device array of pointers to every rank's buffer (only read through these)
+  T* const* peer_data() const { return peer_ptrs_.data(); }
+
+  // call after updating the local buffer (on stream_view) and before reading remote buffers
+  void fence()
+  {
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
+    comm_.barrier();
+  }
+
+ private:
+  raft::comms::comms_t const& comm_;
+  rmm::cuda_stream_view stream_view_{};
+  size_t local_size_{0};
+  T* local_ptr_{nullptr};
+  std::vector<T*> h_peer_ptrs_{};
+  rmm::device_uvector<T*> peer_ptrs_;
+};
+
+}  // namespace detail
+
+}  // namespace cugraph
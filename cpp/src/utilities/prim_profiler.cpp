@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/prim_profiler.hpp>
+
+namespace cugraph {
+
+prim_profiler_t& prim_profiler_t::instance()
+{
+  // defined in a translation unit (instead of an inline function in the header) to have a single
+  // instance per process
+  static prim_profiler_t profiler{};
+  return profiler;
+}
+
+void prim_profiler_t::record(char const* name,
+                             double elapsed_seconds,
+                             size_t bytes_communicated,
+                             size_t edges_touched,
+                             size_t host_syncs,
+                             double comm_wait_seconds)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = records_.find(name);
+  if (it == records_.end()) {
+    it              = records_.emplace(name, prim_profile_record_t{}).first;
+    it->second.name = name;
+  }
+  auto& record = it->second;
+  ++record.num_calls;
+  record.elapsed_seconds += elapsed_seconds;
+  record.bytes_communicated += bytes_communicated;
+  record.edges_touched += edges_touched;
+  record.host_syncs += host_syncs;
+  record.comm_wait_seconds += comm_wait_seconds;
+}
+
+prim_profiler_t::thread_comm_state_t& prim_profiler_t::thread_comm_state()
+{
+  thread_local thread_comm_state_t state{};
+  return state;
+}
+
+std::vector<prim_profile_record_t> prim_profiler_t::report() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<prim_profile_record_t> ret{};
+  ret.reserve(records_.size());
+  for (auto const& [name, record] : records_) {
+    ret.push_back(record);
+  }
+  return ret;
+}
+
+void prim_profiler_t::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.clear();
+}
+
+}  // namespace cugraph
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/progress_callback.hpp>
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace cugraph {
+
+namespace {
+
+// progress callbacks per handle (process-wide)
+std::mutex progress_callback_mutex{};
+std::map<raft::handle_t const*, progress_callback_t> progress_callbacks{};
+
+}  // namespace
+
+void set_progress_callback(raft::handle_t const& handle, progress_callback_t callback)
+{
+  std::lock_guard<std::mutex> lock(progress_callback_mutex);
+  if (callback) {
+    progress_callbacks.insert_or_assign(&handle, std::move(callback));
+  } else {
+    progress_callbacks.erase(&handle);
+  }
+}
+
+namespace detail {
+
+bool report_progress(raft::handle_t const& handle,
+                     iteration_progress_t const& progress,
+                     bool multi_gpu)
+{
+  progress_callback_t callback{};
+  {
+    std::lock_guard<std::mutex> lock(progress_callback_mutex);
+    auto it = progress_callbacks.find(&handle);
+    if (it == progress_callbacks.end()) { return false; }
+    callback = it->second;  // invoke without holding the lock
+  }
+
+  auto stop = callback(progress);
+  if (multi_gpu) {
+    stop = host_scalar_allreduce(handle.get_comms(),
+                                 static_cast<int>(stop),
+                                 raft::comms::op_t::MAX,
+                                 handle.get_stream()) != 0;
+  }
+  return stop;
+}
+
+}  // namespace detail
+
+}  // namespace cugraph
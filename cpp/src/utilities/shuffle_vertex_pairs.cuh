@@ -22,14 +22,20 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/hierarchical_shuffle.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
+#include <thrust/copy.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <optional>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace cugraph {
 
@@ -246,78 +252,75 @@ shuffle_vertex_pairs_with_values_by_gpu_id_impl(
                     handle.get_stream());
   handle.sync_stream();
 
+  // use the two-level (intra-node first, then inter-node) shuffle if enabled for this handle
+  auto shuffle = [&handle, &comm, hierarchical = is_hierarchical_shuffle_enabled(handle)](
+                   auto tx_value_first, std::vector<size_t> const& tx_value_counts) {
+    if (hierarchical) {
+      return hierarchical_shuffle_values(comm,
+                                         handle.get_subcomm(node_local_comm_name()),
+                                         handle.get_subcomm(node_cross_comm_name()),
+                                         tx_value_first,
+                                         tx_value_counts,
+                                         handle.get_stream());
+    } else {
+      return shuffle_values(comm, tx_value_first, tx_value_counts, handle.get_stream());
+    }
+  };
+
   std::vector<size_t> rx_counts{};
 
   if (mem_frugal_flag ||
       (edge_property_count > 1)) {  // trade-off potential parallelism to lower peak memory
-    std::tie(majors, rx_counts) =
-      shuffle_values(comm, majors.begin(), h_tx_value_counts, handle.get_stream());
+    std::tie(majors, rx_counts) = shuffle(majors.begin(), h_tx_value_counts);
 
-    std::tie(minors, rx_counts) =
-      shuffle_values(comm, minors.begin(), h_tx_value_counts, handle.get_stream());
+    std::tie(minors, rx_counts) = shuffle(minors.begin(), h_tx_value_counts);
 
     if (weights) {
-      std::tie(weights, rx_counts) =
-        shuffle_values(comm, (*weights).begin(), h_tx_value_counts, handle.get_stream());
+      std::tie(weights, rx_counts) = shuffle((*weights).begin(), h_tx_value_counts);
     }
 
     if (edge_ids) {
-      std::tie(edge_ids, rx_counts) =
-        shuffle_values(comm, (*edge_ids).begin(), h_tx_value_counts, handle.get_stream());
+      std::tie(edge_ids, rx_counts) = shuffle((*edge_ids).begin(), h_tx_value_counts);
     }
 
     if (edge_types) {
-      std::tie(edge_types, rx_counts) =
-        shuffle_values(comm, (*edge_types).begin(), h_tx_value_counts, handle.get_stream());
+      std::tie(edge_types, rx_counts) = shuffle((*edge_types).begin(), h_tx_value_counts);
     }
 
     if (edge_start_times) {
       std::tie(edge_start_times, rx_counts) =
-        shuffle_values(comm, (*edge_start_times).begin(), h_tx_value_counts, handle.get_stream());
+        shuffle((*edge_start_times).begin(), h_tx_value_counts);
     }
 
     if (edge_end_times) {
       std::tie(edge_end_times, rx_counts) =
-        shuffle_values(comm, (*edge_end_times).begin(), h_tx_value_counts, handle.get_stream());
+        shuffle((*edge_end_times).begin(), h_tx_value_counts);
     }
   } else {
     // There is at most one edge property set
     if (weights) {
       std::forward_as_tuple(std::tie(majors, minors, weights), rx_counts) =
-        shuffle_values(comm,
-                       thrust::make_zip_iterator(majors.begin(), minors.begin(), weights->begin()),
-                       h_tx_value_counts,
-                       handle.get_stream());
+        shuffle(thrust::make_zip_iterator(majors.begin(), minors.begin(), weights->begin()),
+                h_tx_value_counts);
     } else if (edge_ids) {
       std::forward_as_tuple(std::tie(majors, minors, edge_ids), rx_counts) =
-        shuffle_values(comm,
-                       thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_ids->begin()),
-                       h_tx_value_counts,
-                       handle.get_stream());
+        shuffle(thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_ids->begin()),
+                h_tx_value_counts);
     } else if (edge_types) {
-      std::forward_as_tuple(std::tie(majors, minors, edge_types), rx_counts) = shuffle_values(
-        comm,
-        thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_types->begin()),
-        h_tx_value_counts,
-        handle.get_stream());
+      std::forward_as_tuple(std::tie(majors, minors, edge_types), rx_counts) =
+        shuffle(thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_types->begin()),
+                h_tx_value_counts);
     } else if (edge_start_times) {
-      std::forward_as_tuple(std::tie(majors, minors, edge_start_times), rx_counts) = shuffle_values(
-        comm,
+      std::forward_as_tuple(std::tie(majors, minors, edge_start_times), rx_counts) = shuffle(
         thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_start_times->begin()),
-        h_tx_value_counts,
-        handle.get_stream());
+        h_tx_value_counts);
     } else if (edge_end_times) {
-      std::forward_as_tuple(std::tie(majors, minors, edge_end_times), rx_counts) = shuffle_values(
-        comm,
-        thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_end_times->begin()),
-        h_tx_value_counts,
-        handle.get_stream());
+      std::forward_as_tuple(std::tie(majors, minors, edge_end_times), rx_counts) =
+        shuffle(thrust::make_zip_iterator(majors.begin(), minors.begin(), edge_end_times->begin()),
+                h_tx_value_counts);
     } else {
       std::forward_as_tuple(std::tie(majors, minors), rx_counts) =
-        shuffle_values(comm,
-                       thrust::make_zip_iterator(majors.begin(), minors.begin()),
-                       h_tx_value_counts,
-                       handle.get_stream());
+        shuffle(thrust::make_zip_iterator(majors.begin(), minors.begin()), h_tx_value_counts);
     }
   }
 
@@ -475,4 +478,128 @@ shuffle_external_edges(raft::handle_t const& handle,
     std::move(edge_end_times));
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_type_t,
+          typename edge_time_t>
+std::tuple<std::vector<rmm::device_uvector<vertex_t>>,
+           std::vector<rmm::device_uvector<vertex_t>>,
+           std::optional<std::vector<rmm::device_uvector<weight_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_type_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_time_t>>>,
+           std::optional<std::vector<rmm::device_uvector<edge_time_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<vertex_t>&& edge_srcs,
+                                 rmm::device_uvector<vertex_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<weight_t>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<edge_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<edge_type_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<edge_time_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<edge_time_t>>&& edge_end_times,
+                                 size_t memory_budget)
+{
+  auto& comm = handle.get_comms();
+
+  CUGRAPH_EXPECTS(memory_budget > 0, "Invalid input argument: memory_budget should be positive.");
+
+  size_t element_size = sizeof(vertex_t) * 2;
+  if (edge_weights) { element_size += sizeof(weight_t); }
+  if (edge_ids) { element_size += sizeof(edge_t); }
+  if (edge_types) { element_size += sizeof(edge_type_t); }
+  if (edge_start_times) { element_size += sizeof(edge_time_t); }
+  if (edge_end_times) { element_size += sizeof(edge_time_t); }
+
+  // a chunk is copied out of the input, grouped by the destination GPU (thrust::sort requires a
+  // temporary buffer comparable to the chunk size), and received; the received chunks are kept
+  size_t constexpr temporary_buffer_to_chunk_size_ratio = 3;  // tuning parameter
+  auto chunk_size =
+    std::max(memory_budget / (element_size * temporary_buffer_to_chunk_size_ratio), size_t{1});
+  auto num_chunks = host_scalar_allreduce(comm,
+                                          (edge_srcs.size() + (chunk_size - 1)) / chunk_size,
+                                          raft::comms::op_t::MAX,
+                                          handle.get_stream());
+  num_chunks      = std::max(num_chunks, size_t{1});
+
+  std::vector<rmm::device_uvector<vertex_t>> chunk_srcs{};
+  std::vector<rmm::device_uvector<vertex_t>> chunk_dsts{};
+  auto chunk_weights =
+    edge_weights ? std::make_optional<std::vector<rmm::device_uvector<weight_t>>>() : std::nullopt;
+  auto chunk_edge_ids =
+    edge_ids ? std::make_optional<std::vector<rmm::device_uvector<edge_t>>>() : std::nullopt;
+  auto chunk_edge_types =
+    edge_types ? std::make_optional<std::vector<rmm::device_uvector<edge_type_t>>>()
+               : std::nullopt;
+  auto chunk_edge_start_times =
+    edge_start_times ? std::make_optional<std::vector<rmm::device_uvector<edge_time_t>>>()
+                     : std::nullopt;
+  auto chunk_edge_end_times =
+    edge_end_times ? std::make_optional<std::vector<rmm::device_uvector<edge_time_t>>>()
+                   : std::nullopt;
+
+  auto copy_chunk = [&handle](auto const& input, size_t first, size_t last) {
+    rmm::device_uvector<typename std::remove_reference_t<decltype(input)>::value_type> ret(
+      last - first, handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), input.begin() + first, input.begin() + last, ret.begin());
+    return ret;
+  };
+
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto first = std::min(i * chunk_size, edge_srcs.size());
+    auto last  = std::min(first + chunk_size, edge_srcs.size());
+
+    auto srcs    = copy_chunk(edge_srcs, first, last);
+    auto dsts    = copy_chunk(edge_dsts, first, last);
+    auto weights = edge_weights ? std::make_optional(copy_chunk(*edge_weights, first, last))
+                                : std::nullopt;
+    auto ids = edge_ids ? std::make_optional(copy_chunk(*edge_ids, first, last)) : std::nullopt;
+    auto types =
+      edge_types ? std::make_optional(copy_chunk(*edge_types, first, last)) : std::nullopt;
+    auto start_times = edge_start_times
+                         ? std::make_optional(copy_chunk(*edge_start_times, first, last))
+                         : std::nullopt;
+    auto end_times =
+      edge_end_times ? std::make_optional(copy_chunk(*edge_end_times, first, last)) : std::nullopt;
+
+    std::tie(srcs, dsts, weights, ids, types, start_times, end_times, std::ignore) =
+      detail::shuffle_ext_vertex_pairs_with_values_to_local_gpu_by_edge_partitioning(
+        handle,
+        std::move(srcs),
+        std::move(dsts),
+        std::move(weights),
+        std::move(ids),
+        std::move(types),
+        std::move(start_times),
+        std::move(end_times));
+
+    chunk_srcs.push_back(std::move(srcs));
+    chunk_dsts.push_back(std::move(dsts));
+    if (chunk_weights) { (*chunk_weights).push_back(std::move(*weights)); }
+    if (chunk_edge_ids) { (*chunk_edge_ids).push_back(std::move(*ids)); }
+    if (chunk_edge_types) { (*chunk_edge_types).push_back(std::move(*types)); }
+    if (chunk_edge_start_times) { (*chunk_edge_start_times).push_back(std::move(*start_times)); }
+    if (chunk_edge_end_times) { (*chunk_edge_end_times).push_back(std::move(*end_times)); }
+  }
+
+  edge_srcs.resize(0, handle.get_stream());
+  edge_srcs.shrink_to_fit(handle.get_stream());
+  edge_dsts.resize(0, handle.get_stream());
+  edge_dsts.shrink_to_fit(handle.get_stream());
+  edge_weights     = std::nullopt;
+  edge_ids         = std::nullopt;
+  edge_types       = std::nullopt;
+  edge_start_times = std::nullopt;
+  edge_end_times   = std::nullopt;
+
+  return std::make_tuple(std::move(chunk_srcs),
+                         std::move(chunk_dsts),
+                         std::move(chunk_weights),
+                         std::move(chunk_edge_ids),
+                         std::move(chunk_edge_types),
+                         std::move(chunk_edge_start_times),
+                         std::move(chunk_edge_end_times));
+}
+
 }  // namespace cugraph
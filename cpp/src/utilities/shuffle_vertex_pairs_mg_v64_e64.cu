@@ -250,4 +250,72 @@ shuffle_external_edges(raft::handle_t const& handle,
                        std::optional<rmm::device_uvector<int64_t>>&& edge_start_times,
                        std::optional<rmm::device_uvector<int64_t>>&& edge_end_times);
 
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<rmm::device_uvector<float>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<int64_t>&& edge_srcs,
+                                 rmm::device_uvector<int64_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<float>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_end_times,
+                                 size_t memory_budget);
+
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<rmm::device_uvector<double>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<int64_t>&& edge_srcs,
+                                 rmm::device_uvector<int64_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<double>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_end_times,
+                                 size_t memory_budget);
+
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<rmm::device_uvector<float>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<int64_t>&& edge_srcs,
+                                 rmm::device_uvector<int64_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<float>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_end_times,
+                                 size_t memory_budget);
+
+template std::tuple<std::vector<rmm::device_uvector<int64_t>>,
+                    std::vector<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<rmm::device_uvector<double>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int32_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>,
+                    std::optional<std::vector<rmm::device_uvector<int64_t>>>>
+shuffle_external_edges_in_chunks(raft::handle_t const& handle,
+                                 rmm::device_uvector<int64_t>&& edge_srcs,
+                                 rmm::device_uvector<int64_t>&& edge_dsts,
+                                 std::optional<rmm::device_uvector<double>>&& edge_weights,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_ids,
+                                 std::optional<rmm::device_uvector<int32_t>>&& edge_types,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_start_times,
+                                 std::optional<rmm::device_uvector<int64_t>>&& edge_end_times,
+                                 size_t memory_budget);
+
 }  // namespace cugraph
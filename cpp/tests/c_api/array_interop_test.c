@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/array.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+
+/*
+ * Export an array owned by cugraph to a consumer stream, import the exported memory back as a
+ * view, and release the array while the consumer's work is still pending.
+ */
+int test_export_import_round_trip()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle = NULL;
+
+  cugraph_type_erased_device_array_t* array               = NULL;
+  cugraph_type_erased_device_array_view_t* array_view     = NULL;
+  cugraph_type_erased_device_array_view_t* imported_view  = NULL;
+  cugraph_type_erased_device_array_t* imported_array_copy = NULL;
+  cugraph_type_erased_device_array_view_t* copy_view      = NULL;
+
+  size_t num_elems = 1 << 20;
+
+  vertex_t* h_data   = (vertex_t*)malloc(num_elems * sizeof(vertex_t));
+  vertex_t* h_result = (vertex_t*)malloc(num_elems * sizeof(vertex_t));
+  for (size_t i = 0; i < num_elems; ++i) {
+    h_data[i] = (vertex_t)(i * 7 + 3);
+  }
+
+  cudaStream_t consumer_stream;
+  vertex_t* d_consumer_buffer = NULL;
+  TEST_ALWAYS_ASSERT(cudaStreamCreate(&consumer_stream) == cudaSuccess,
+                     "consumer stream creation failed.");
+  TEST_ALWAYS_ASSERT(cudaMalloc((void**)&d_consumer_buffer, num_elems * sizeof(vertex_t)) ==
+                       cudaSuccess,
+                     "consumer buffer allocation failed.");
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(handle, num_elems, INT32, &array, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "array create failed.");
+
+  array_view = cugraph_type_erased_device_array_view(array);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    handle, array_view, (byte_t*)h_data, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_from_host failed.");
+
+  // export: the consumer stream is ordered after the handle's stream, no host synchronization
+  ret_code = cugraph_type_erased_device_array_view_export_to_stream(
+    handle, array_view, (uintptr_t)consumer_stream, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "export_to_stream failed.");
+
+  const void* exported_pointer = cugraph_type_erased_device_array_view_pointer(array_view);
+
+  // import the exported memory back, this should wrap (not copy) the memory
+  ret_code = cugraph_type_erased_device_array_view_create_from_stream(handle,
+                                                                      (void*)exported_pointer,
+                                                                      num_elems,
+                                                                      INT32,
+                                                                      (uintptr_t)consumer_stream,
+                                                                      &imported_view,
+                                                                      &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_from_stream failed.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_pointer(imported_view) == exported_pointer,
+              "imported view does not wrap the exported memory.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_size(imported_view) == num_elems,
+              "imported view size does not match.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_type(imported_view) == INT32,
+              "imported view type does not match.");
+
+  // a copy made through the imported view should hold the original data
+  ret_code = cugraph_type_erased_device_array_create(
+    handle, num_elems, INT32, &imported_array_copy, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "array create failed.");
+
+  copy_view = cugraph_type_erased_device_array_view(imported_array_copy);
+
+  ret_code =
+    cugraph_type_erased_device_array_view_copy(handle, copy_view, imported_view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "view copy failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result, copy_view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (size_t i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_data[i], "imported data does not match.");
+  }
+
+  // the views do not own the memory, freeing them leaves the array intact
+  cugraph_type_erased_device_array_view_free(imported_view);
+
+  // the consumer reads the exported memory on its stream, then the array is released (ordered
+  // after the consumer's read) while the read may still be pending
+  TEST_ALWAYS_ASSERT(cudaMemcpyAsync(d_consumer_buffer,
+                                     exported_pointer,
+                                     num_elems * sizeof(vertex_t),
+                                     cudaMemcpyDeviceToDevice,
+                                     consumer_stream) == cudaSuccess,
+                     "consumer copy failed.");
+
+  cugraph_type_erased_device_array_view_free(array_view);
+
+  ret_code = cugraph_type_erased_device_array_free_on_stream(
+    handle, array, (uintptr_t)consumer_stream, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "free_on_stream failed.");
+
+  TEST_ALWAYS_ASSERT(cudaStreamSynchronize(consumer_stream) == cudaSuccess,
+                     "consumer stream synchronization failed.");
+  TEST_ALWAYS_ASSERT(cudaMemcpy(h_result,
+                                d_consumer_buffer,
+                                num_elems * sizeof(vertex_t),
+                                cudaMemcpyDeviceToHost) == cudaSuccess,
+                     "consumer result copy failed.");
+
+  for (size_t i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_data[i], "consumer data does not match.");
+  }
+
+  cugraph_type_erased_device_array_view_free(copy_view);
+  cugraph_type_erased_device_array_free(imported_array_copy);
+  cudaFree(d_consumer_buffer);
+  cudaStreamDestroy(consumer_stream);
+  cugraph_free_resource_handle(handle);
+  cugraph_error_free(ret_error);
+  free(h_data);
+  free(h_result);
+
+  return test_ret_value;
+}
+
+/*
+ * Import memory owned (and produced on a different stream) by the caller, cugraph should read it
+ * in order and never take over its ownership.
+ */
+int test_import_caller_owned_memory()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle = NULL;
+
+  cugraph_type_erased_device_array_view_t* imported_view = NULL;
+
+  size_t num_elems = 1 << 20;
+
+  vertex_t* h_data   = (vertex_t*)malloc(num_elems * sizeof(vertex_t));
+  vertex_t* h_result = (vertex_t*)malloc(num_elems * sizeof(vertex_t));
+  for (size_t i = 0; i < num_elems; ++i) {
+    h_data[i] = (vertex_t)(num_elems - i);
+  }
+
+  cudaStream_t producer_stream;
+  vertex_t* d_caller_buffer = NULL;
+  TEST_ALWAYS_ASSERT(cudaStreamCreate(&producer_stream) == cudaSuccess,
+                     "producer stream creation failed.");
+  TEST_ALWAYS_ASSERT(cudaMalloc((void**)&d_caller_buffer, num_elems * sizeof(vertex_t)) ==
+                       cudaSuccess,
+                     "caller buffer allocation failed.");
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  // produce the data on the producer stream without synchronizing the host
+  TEST_ALWAYS_ASSERT(cudaMemcpyAsync(d_caller_buffer,
+                                     h_data,
+                                     num_elems * sizeof(vertex_t),
+                                     cudaMemcpyHostToDevice,
+                                     producer_stream) == cudaSuccess,
+                     "producer copy failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_create_from_stream(handle,
+                                                                      d_caller_buffer,
+                                                                      num_elems,
+                                                                      INT32,
+                                                                      (uintptr_t)producer_stream,
+                                                                      &imported_view,
+                                                                      &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_from_stream failed.");
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_pointer(imported_view) == d_caller_buffer,
+              "imported view does not wrap the caller's memory.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result, imported_view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (size_t i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_data[i], "imported data does not match.");
+  }
+
+  // freeing the view (and the handle) should leave the caller's memory valid
+  cugraph_type_erased_device_array_view_free(imported_view);
+  cugraph_free_resource_handle(handle);
+
+  for (size_t i = 0; i < num_elems; ++i) {
+    h_result[i] = 0;
+  }
+  TEST_ASSERT(test_ret_value,
+              cudaMemcpy(h_result,
+                         d_caller_buffer,
+                         num_elems * sizeof(vertex_t),
+                         cudaMemcpyDeviceToHost) == cudaSuccess,
+              "caller memory is no longer accessible.");
+
+  for (size_t i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_data[i], "caller memory was modified.");
+  }
+
+  TEST_ASSERT(
+    test_ret_value, cudaFree(d_caller_buffer) == cudaSuccess, "caller memory free failed.");
+  cudaStreamDestroy(producer_stream);
+  cugraph_error_free(ret_error);
+  free(h_data);
+  free(h_result);
+
+  return test_ret_value;
+}
+
+/*
+ * Exporting with stream 0 synchronizes the handle's stream, and the functions reject a NULL
+ * handle.
+ */
+int test_export_synchronous_and_invalid_handle()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle = NULL;
+
+  cugraph_type_erased_device_array_t* array              = NULL;
+  cugraph_type_erased_device_array_view_t* array_view    = NULL;
+  cugraph_type_erased_device_array_view_t* imported_view = NULL;
+
+  vertex_t h_data[]   = {5, 3, 1, 2, 4, 0};
+  vertex_t h_result[] = {0, 0, 0, 0, 0, 0};
+  size_t num_elems    = sizeof(h_data) / sizeof(h_data[0]);
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(handle, num_elems, INT32, &array, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "array create failed.");
+
+  array_view = cugraph_type_erased_device_array_view(array);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    handle, array_view, (byte_t*)h_data, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_from_host failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_view_export_to_stream(handle, array_view, 0, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "export_to_stream failed.");
+
+  // the data is ready, a plain (legacy default stream) copy can read it
+  TEST_ASSERT(test_ret_value,
+              cudaMemcpy(h_result,
+                         cugraph_type_erased_device_array_view_pointer(array_view),
+                         num_elems * sizeof(vertex_t),
+                         cudaMemcpyDeviceToHost) == cudaSuccess,
+              "exported memory copy failed.");
+
+  for (size_t i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_data[i], "exported data does not match.");
+  }
+
+  ret_code = cugraph_type_erased_device_array_view_create_from_stream(
+    NULL, h_data, num_elems, INT32, 0, &imported_view, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_HANDLE,
+              "create_from_stream should fail with a NULL handle.");
+  TEST_ASSERT(test_ret_value, imported_view == NULL, "no view should be created.");
+  cugraph_error_free(ret_error);
+
+  ret_code =
+    cugraph_type_erased_device_array_view_export_to_stream(NULL, array_view, 0, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_HANDLE,
+              "export_to_stream should fail with a NULL handle.");
+  cugraph_error_free(ret_error);
+
+  ret_code = cugraph_type_erased_device_array_free_on_stream(NULL, array, 0, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_HANDLE,
+              "free_on_stream should fail with a NULL handle.");
+  cugraph_error_free(ret_error);
+
+  // the array is still owned by the caller after the failed free
+  cugraph_type_erased_device_array_view_free(array_view);
+  ret_code = cugraph_type_erased_device_array_free_on_stream(handle, array, 0, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "free_on_stream failed.");
+
+  cugraph_free_resource_handle(handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_export_import_round_trip);
+  result |= RUN_TEST(test_import_caller_owned_memory);
+  result |= RUN_TEST(test_export_synchronous_and_invalid_handle);
+  return result;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 
 #include <cugraph_c/algorithms.h>
 #include <cugraph_c/graph.h>
+#include <cugraph_c/resource_handle.h>
 
 #include <math.h>
 
@@ -35,7 +36,9 @@ int generic_bfs_test(vertex_t* h_src,
                      size_t num_edges,
                      size_t num_seeds,
                      size_t depth_limit,
-                     bool_t store_transposed)
+                     bool_t store_transposed,
+                     bool_t is_symmetric,
+                     cugraph_bfs_options_t const* options)
 {
   int test_ret_value = 0;
 
@@ -51,8 +54,16 @@ int generic_bfs_test(vertex_t* h_src,
   p_handle = cugraph_create_resource_handle(NULL);
   TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
 
-  ret_code = create_test_graph(
-    p_handle, h_src, h_dst, h_wgt, num_edges, store_transposed, FALSE, FALSE, &p_graph, &ret_error);
+  ret_code = create_test_graph(p_handle,
+                               h_src,
+                               h_dst,
+                               h_wgt,
+                               num_edges,
+                               store_transposed,
+                               FALSE,
+                               is_symmetric,
+                               &p_graph,
+                               &ret_error);
 
   /*
    * FIXME: in create_graph_test.c, variables are defined but then hard-coded to
@@ -69,8 +80,13 @@ int generic_bfs_test(vertex_t* h_src,
     p_handle, p_source_view, (byte_t*)h_seeds, &ret_error);
   TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
 
-  ret_code = cugraph_bfs(
-    p_handle, p_graph, p_source_view, FALSE, depth_limit, TRUE, FALSE, &p_result, &ret_error);
+  if (options == NULL) {
+    ret_code = cugraph_bfs(
+      p_handle, p_graph, p_source_view, FALSE, depth_limit, TRUE, FALSE, &p_result, &ret_error);
+  } else {
+    ret_code = cugraph_bfs_with_options(
+      p_handle, p_graph, p_source_view, options, depth_limit, TRUE, FALSE, &p_result, &ret_error);
+  }
   TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs failed.");
 
   cugraph_type_erased_device_array_view_t* vertices;
@@ -191,7 +207,9 @@ int test_bfs()
                           num_edges,
                           1,
                           10,
-                          FALSE);
+                          FALSE,
+                          FALSE,
+                          NULL);
 }
 
 int test_bfs_with_transpose()
@@ -218,7 +236,147 @@ int test_bfs_with_transpose()
                           num_edges,
                           1,
                           10,
-                          TRUE);
+                          TRUE,
+                          FALSE,
+                          NULL);
+}
+
+int test_bfs_with_options()
+{
+  size_t num_edges    = 10;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 0, 2, 1, 3, 1, 4, 3, 5};
+  vertex_t dst[]                   = {1, 0, 2, 0, 3, 1, 4, 1, 5, 3};
+  weight_t wgt[]                   = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+  vertex_t seeds[]                 = {0};
+  vertex_t expected_distances[]    = {0, 1, 1, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, 0, 1, 1, 3};
+
+  int test_ret_value               = 0;
+  cugraph_error_t* ret_error       = NULL;
+  cugraph_bfs_options_t* p_options = NULL;
+
+  cugraph_error_code_t ret_code = cugraph_bfs_options_create(&p_options, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "bfs options create failed.");
+
+  cugraph_bfs_options_set_direction_optimizing(p_options, TRUE);
+  cugraph_bfs_options_set_alpha(p_options, 0.5);
+  cugraph_bfs_options_set_beta(p_options, 2.0);
+  cugraph_bfs_options_set_auto_tune(p_options, TRUE, 2);
+
+  test_ret_value = generic_bfs_test(src,
+                                    dst,
+                                    wgt,
+                                    seeds,
+                                    expected_distances,
+                                    expected_predecessors,
+                                    num_vertices,
+                                    num_edges,
+                                    1,
+                                    10,
+                                    FALSE,
+                                    TRUE,
+                                    p_options);
+
+  cugraph_bfs_options_free(p_options);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_bfs_with_cloned_handles()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+  size_t num_clones   = 2;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t seeds[]                 = {0};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 3};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                    = NULL;
+  cugraph_resource_handle_t* p_clones[2]                 = {NULL, NULL};
+  cugraph_graph_t* p_graph                               = NULL;
+  cugraph_type_erased_device_array_t* p_sources          = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, 1, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  // every clone runs BFS on the graph created with the original handle
+  for (size_t c = 0; (c < num_clones) && (test_ret_value == 0); ++c) {
+    ret_code = cugraph_resource_handle_clone(p_handle, 0, &p_clones[c], &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "resource handle clone failed.");
+
+    cugraph_paths_result_t* p_result = NULL;
+
+    ret_code = cugraph_bfs(
+      p_clones[c], p_graph, p_source_view, FALSE, 10, TRUE, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs failed.");
+
+    vertex_t h_vertices[num_vertices];
+    vertex_t h_distances[num_vertices];
+    vertex_t h_predecessors[num_vertices];
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_clones[c], (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_clones[c], (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_clones[c],
+      (byte_t*)h_predecessors,
+      cugraph_paths_result_get_predecessors(p_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  expected_distances[h_vertices[i]] == h_distances[i],
+                  "bfs distances don't match");
+
+      TEST_ASSERT(test_ret_value,
+                  expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                  "bfs predecessors don't match");
+    }
+
+    cugraph_paths_result_free(p_result);
+  }
+
+  for (size_t c = 0; c < num_clones; ++c) {
+    if (p_clones[c] != NULL) { cugraph_free_resource_handle(p_clones[c]); }
+  }
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
 }
 
 /******************************************************************************/
@@ -228,6 +386,8 @@ int main(int argc, char** argv)
   int result = 0;
   result |= RUN_TEST(test_bfs);
   result |= RUN_TEST(test_bfs_with_transpose);
+  result |= RUN_TEST(test_bfs_with_options);
   result |= RUN_TEST(test_bfs_exceptions);
+  result |= RUN_TEST(test_bfs_with_cloned_handles);
   return result;
 }
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/graph.h>
+#include <cugraph_c/graph_functions.h>
+
+#include <stdio.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+const char* edge_op_source =
+  "__device__ double edge_op(long long src, long long dst, double weight)\n"
+  "{\n"
+  "  return 2.0 * weight + static_cast<double>(src * 10 + dst);\n"
+  "}\n";
+
+const char* edge_op_and_reduce_op_source =
+  "__device__ double edge_op(long long src, long long dst, double weight)\n"
+  "{\n"
+  "  return 2.0 * weight + static_cast<double>(src * 10 + dst);\n"
+  "}\n"
+  "__device__ double reduce_op(double a, double b) { return a > b ? a : b; }\n";
+
+int generic_jit_edge_op_test(vertex_t* h_src,
+                             vertex_t* h_dst,
+                             weight_t* h_wgt,
+                             size_t num_vertices,
+                             size_t num_edges,
+                             bool_t store_transposed,
+                             size_t num_repeats)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle    = NULL;
+  cugraph_graph_t* graph               = NULL;
+  cugraph_jit_edge_op_result_t* result = NULL;
+
+  double h_expected[num_vertices];
+
+  for (size_t i = 0; i < num_vertices; ++i) {
+    h_expected[i] = 0.0;
+  }
+  for (size_t i = 0; i < num_edges; ++i) {
+    h_expected[h_src[i]] += 2.0 * h_wgt[i] + (double)(h_src[i] * 10 + h_dst[i]);
+  }
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    handle, h_src, h_dst, h_wgt, num_edges, store_transposed, FALSE, FALSE, &graph, &ret_error);
+
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  // the later calls reuse the cached kernel
+  for (size_t r = 0; (r < num_repeats) && (test_ret_value == 0); ++r) {
+    ret_code =
+      cugraph_jit_sum_outgoing_edge_op(handle, graph, edge_op_source, FALSE, &result, &ret_error);
+
+    TEST_ASSERT(
+      test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_jit_sum_outgoing_edge_op failed.");
+    TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+    cugraph_type_erased_device_array_view_t* result_vertices;
+    cugraph_type_erased_device_array_view_t* result_values;
+
+    result_vertices = cugraph_jit_edge_op_result_get_vertices(result);
+    result_values   = cugraph_jit_edge_op_result_get_values(result);
+
+    size_t num_result_vertices = cugraph_type_erased_device_array_view_size(result_vertices);
+
+    vertex_t h_result_vertices[num_result_vertices];
+    double h_result_values[num_result_vertices];
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      handle, (byte_t*)h_result_vertices, result_vertices, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      handle, (byte_t*)h_result_values, result_values, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    TEST_ASSERT(test_ret_value, num_result_vertices == num_vertices, "results not the same size");
+
+    for (size_t i = 0; (i < num_result_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  nearlyEqualDouble(h_result_values[i], h_expected[h_result_vertices[i]], 0.001),
+                  "edge operator sum did not match");
+    }
+
+    cugraph_jit_edge_op_result_free(result);
+  }
+
+  cugraph_graph_free(graph);
+  cugraph_error_free(ret_error);
+  cugraph_free_resource_handle(handle);
+
+  return test_ret_value;
+}
+
+int test_jit_edge_op()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  return generic_jit_edge_op_test(h_src, h_dst, h_wgt, num_vertices, num_edges, FALSE, 2);
+}
+
+int test_jit_edge_op_transposed()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  return generic_jit_edge_op_test(h_src, h_dst, h_wgt, num_vertices, num_edges, TRUE, 1);
+}
+
+int test_jit_edge_op_compile_error()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle    = NULL;
+  cugraph_graph_t* graph               = NULL;
+  cugraph_jit_edge_op_result_t* result = NULL;
+
+  vertex_t h_src[] = {0, 1, 1, 2};
+  vertex_t h_dst[] = {1, 3, 4, 0};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f};
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  ret_code =
+    create_test_graph(handle, h_src, h_dst, h_wgt, 4, FALSE, FALSE, FALSE, &graph, &ret_error);
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code = cugraph_jit_sum_outgoing_edge_op(
+    handle, graph, "__device__ double edge_op(long long src) {", FALSE, &result, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code != CUGRAPH_SUCCESS,
+              "cugraph_jit_sum_outgoing_edge_op should fail on an invalid source.");
+
+  cugraph_graph_free(graph);
+  cugraph_error_free(ret_error);
+  cugraph_free_resource_handle(handle);
+
+  return test_ret_value;
+}
+
+int test_jit_reduce_edge_op()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle    = NULL;
+  cugraph_graph_t* graph               = NULL;
+  cugraph_jit_edge_op_result_t* result = NULL;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  // maximum of the edge operator outputs, vertices without an outgoing edge get init
+  double init = -1.0;
+  double h_expected[num_vertices];
+  for (size_t i = 0; i < num_vertices; ++i) {
+    h_expected[i] = init;
+  }
+  for (size_t i = 0; i < num_edges; ++i) {
+    double value = 2.0 * h_wgt[i] + (double)(h_src[i] * 10 + h_dst[i]);
+    if (value > h_expected[h_src[i]]) { h_expected[h_src[i]] = value; }
+  }
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    handle, h_src, h_dst, h_wgt, num_edges, FALSE, FALSE, FALSE, &graph, &ret_error);
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code = cugraph_jit_reduce_outgoing_edge_op(
+    handle, graph, edge_op_and_reduce_op_source, init, FALSE, &result, &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_jit_reduce_outgoing_edge_op failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  cugraph_type_erased_device_array_view_t* result_vertices;
+  cugraph_type_erased_device_array_view_t* result_values;
+
+  result_vertices = cugraph_jit_edge_op_result_get_vertices(result);
+  result_values   = cugraph_jit_edge_op_result_get_values(result);
+
+  size_t num_result_vertices = cugraph_type_erased_device_array_view_size(result_vertices);
+
+  vertex_t h_result_vertices[num_result_vertices];
+  double h_result_values[num_result_vertices];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result_vertices, result_vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result_values, result_values, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  TEST_ASSERT(test_ret_value, num_result_vertices == num_vertices, "results not the same size");
+
+  for (size_t i = 0; (i < num_result_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqualDouble(h_result_values[i], h_expected[h_result_vertices[i]], 0.001),
+                "edge operator maximum did not match");
+  }
+
+  cugraph_jit_edge_op_result_free(result);
+  cugraph_graph_free(graph);
+  cugraph_error_free(ret_error);
+  cugraph_free_resource_handle(handle);
+
+  return test_ret_value;
+}
+
+int test_jit_transform_edge_op()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* handle = NULL;
+  cugraph_graph_t* graph            = NULL;
+  cugraph_edgelist_t* result        = NULL;
+
+  size_t num_edges = 8;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, handle != NULL, "resource handle creation failed.");
+
+  // the transposed storage is transposed back to apply the edge operator
+  ret_code = create_test_graph(
+    handle, h_src, h_dst, h_wgt, num_edges, TRUE, FALSE, FALSE, &graph, &ret_error);
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code =
+    cugraph_jit_transform_edge_op(handle, graph, edge_op_source, FALSE, &result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_jit_transform_edge_op failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  cugraph_type_erased_device_array_view_t* result_srcs;
+  cugraph_type_erased_device_array_view_t* result_dsts;
+  cugraph_type_erased_device_array_view_t* result_values;
+
+  result_srcs   = cugraph_edgelist_get_sources(result);
+  result_dsts   = cugraph_edgelist_get_destinations(result);
+  result_values = cugraph_edgelist_get_edge_weights(result);
+
+  size_t num_result_edges = cugraph_type_erased_device_array_view_size(result_srcs);
+
+  vertex_t h_result_srcs[num_result_edges];
+  vertex_t h_result_dsts[num_result_edges];
+  double h_result_values[num_result_edges];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result_srcs, result_srcs, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result_dsts, result_dsts, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    handle, (byte_t*)h_result_values, result_values, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  TEST_ASSERT(test_ret_value, num_result_edges == num_edges, "results not the same size");
+
+  // every output edge should match an input edge (the edges are unique) and its value
+  for (size_t i = 0; (i < num_result_edges) && (test_ret_value == 0); ++i) {
+    int found = 0;
+    for (size_t j = 0; j < num_edges; ++j) {
+      if ((h_result_srcs[i] == h_src[j]) && (h_result_dsts[i] == h_dst[j])) {
+        found = 1;
+        TEST_ASSERT(test_ret_value,
+                    nearlyEqualDouble(h_result_values[i],
+                                      2.0 * h_wgt[j] + (double)(h_src[j] * 10 + h_dst[j]),
+                                      0.001),
+                    "edge operator output did not match");
+      }
+    }
+    TEST_ASSERT(test_ret_value, found, "output edge not in the input edges");
+  }
+
+  cugraph_edgelist_free(result);
+  cugraph_graph_free(graph);
+  cugraph_error_free(ret_error);
+  cugraph_free_resource_handle(handle);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_jit_edge_op);
+  result |= RUN_TEST(test_jit_edge_op_transposed);
+  result |= RUN_TEST(test_jit_edge_op_compile_error);
+  result |= RUN_TEST(test_jit_reduce_edge_op);
+  result |= RUN_TEST(test_jit_transform_edge_op);
+  return result;
+}
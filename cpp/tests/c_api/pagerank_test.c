@@ -433,6 +433,111 @@ int test_pagerank_with_transpose()
     h_src, h_dst, h_wgt, h_result, num_vertices, num_edges, FALSE, alpha, epsilon, max_iterations);
 }
 
+int test_pagerank_with_cached_transpose()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]     = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]     = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]     = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t h_result[]  = {0.0915528, 0.168382, 0.0656831, 0.191468, 0.120677, 0.362237};
+  vertex_t h_sources[] = {0};
+
+  double alpha          = 0.95;
+  double epsilon        = 0.0001;
+  size_t max_iterations = 20;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle                     = NULL;
+  cugraph_graph_t* p_graph                                = NULL;
+  cugraph_centrality_result_t* p_result                   = NULL;
+  cugraph_paths_result_t* p_paths_result                  = NULL;
+  cugraph_type_erased_device_array_t* p_sources           = NULL;
+  cugraph_type_erased_device_array_view_t* p_sources_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, h_src, h_dst, h_wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code = cugraph_graph_set_cache_transposed_storage(p_graph, TRUE, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_SUCCESS,
+              "cugraph_graph_set_cache_transposed_storage failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, 1, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_sources_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_sources_view, (byte_t*)h_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  // PageRank transposes the storage, BFS switches back to the cached storage and the second
+  // PageRank call switches to the cached transposed storage
+  for (int run = 0; (run < 2) && (test_ret_value == 0); ++run) {
+    ret_code = cugraph_pagerank(p_handle,
+                                p_graph,
+                                NULL,
+                                NULL,
+                                NULL,
+                                NULL,
+                                alpha,
+                                epsilon,
+                                max_iterations,
+                                FALSE,
+                                &p_result,
+                                &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+    TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+    vertex_t h_vertices[num_vertices];
+    weight_t h_pageranks[num_vertices];
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_vertices, cugraph_centrality_result_get_vertices(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_pageranks, cugraph_centrality_result_get_values(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  nearlyEqual(h_result[h_vertices[i]], h_pageranks[i], 0.001),
+                  "pagerank results don't match");
+    }
+
+    cugraph_centrality_result_free(p_result);
+
+    if (run == 0) {
+      ret_code = cugraph_bfs(
+        p_handle, p_graph, p_sources_view, FALSE, 10, FALSE, FALSE, &p_paths_result, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs failed.");
+      TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+      cugraph_paths_result_free(p_paths_result);
+    }
+  }
+
+  cugraph_type_erased_device_array_view_free(p_sources_view);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
 int test_pagerank_4()
 {
   size_t num_edges    = 3;
@@ -561,6 +666,7 @@ int main(int argc, char** argv)
   int result = 0;
   result |= RUN_TEST(test_pagerank);
   result |= RUN_TEST(test_pagerank_with_transpose);
+  result |= RUN_TEST(test_pagerank_with_cached_transpose);
   result |= RUN_TEST(test_pagerank_4);
   result |= RUN_TEST(test_pagerank_4_with_transpose);
   result |= RUN_TEST(test_pagerank_non_convergence);
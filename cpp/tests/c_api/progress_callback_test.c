@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+#include <cugraph_c/resource_handle.h>
+
+#include <string.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+typedef struct {
+  size_t num_calls;
+  size_t stop_iteration;
+} progress_state_t;
+
+static bool_t stop_at_iteration(const cugraph_progress_t* progress, void* user_data)
+{
+  progress_state_t* state = (progress_state_t*)user_data;
+  if (strcmp(progress->algorithm, "pagerank") != 0) { return FALSE; }
+  ++(state->num_calls);
+  return (progress->iteration >= state->stop_iteration) ? TRUE : FALSE;
+}
+
+int test_pagerank_progress_callback_early_stop()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges = 8;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  double alpha          = 0.95;
+  double epsilon        = 0.0001;
+  size_t max_iterations = 20;
+
+  progress_state_t state = {0, 3};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  cugraph_resource_handle_t* p_handle   = NULL;
+  cugraph_graph_t* p_graph              = NULL;
+  cugraph_centrality_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, FALSE, FALSE, &p_graph, &ret_error);
+
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code =
+    cugraph_resource_handle_set_progress_callback(p_handle, stop_at_iteration, &state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "set_progress_callback failed.");
+
+  ret_code = cugraph_pagerank_allow_nonconvergence(p_handle,
+                                                   p_graph,
+                                                   NULL,
+                                                   NULL,
+                                                   NULL,
+                                                   NULL,
+                                                   alpha,
+                                                   epsilon,
+                                                   max_iterations,
+                                                   FALSE,
+                                                   &p_result,
+                                                   &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  TEST_ASSERT(test_ret_value,
+              state.num_calls == state.stop_iteration,
+              "progress callback invoked an unexpected number of times");
+  TEST_ASSERT(test_ret_value,
+              cugraph_centrality_result_get_num_iterations(p_result) == state.stop_iteration,
+              "pagerank did not stop at the requested iteration");
+  TEST_ASSERT(test_ret_value,
+              cugraph_centrality_result_converged(p_result) == FALSE,
+              "pagerank stopped early should not report convergence");
+
+  cugraph_centrality_result_free(p_result);
+
+  // the algorithm runs to convergence once the callback is removed
+  ret_code = cugraph_resource_handle_set_progress_callback(p_handle, NULL, NULL, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "set_progress_callback failed.");
+
+  state.num_calls = 0;
+  ret_code        = cugraph_pagerank_allow_nonconvergence(p_handle,
+                                                   p_graph,
+                                                   NULL,
+                                                   NULL,
+                                                   NULL,
+                                                   NULL,
+                                                   alpha,
+                                                   epsilon,
+                                                   max_iterations,
+                                                   FALSE,
+                                                   &p_result,
+                                                   &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+  TEST_ALWAYS_ASSERT(ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  TEST_ASSERT(test_ret_value, state.num_calls == 0, "removed progress callback was invoked");
+  TEST_ASSERT(test_ret_value,
+              cugraph_centrality_result_converged(p_result) == TRUE,
+              "pagerank should converge without the progress callback");
+
+  cugraph_centrality_result_free(p_result);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_pagerank_progress_callback_early_stop);
+  return result;
+}
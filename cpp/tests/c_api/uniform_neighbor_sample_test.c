@@ -61,7 +61,8 @@ int generic_uniform_neighbor_sample_test(const cugraph_resource_handle_t* handle
                                          bool_t return_hops,
                                          cugraph_prior_sources_behavior_t prior_sources_behavior,
                                          bool_t dedupe_sources,
-                                         bool_t renumber_results)
+                                         bool_t renumber_results,
+                                         cugraph_compression_type_t compression)
 {
   // Create graph
   int test_ret_value              = 0;
@@ -133,6 +134,7 @@ int generic_uniform_neighbor_sample_test(const cugraph_resource_handle_t* handle
   cugraph_sampling_set_prior_sources_behavior(sampling_options, prior_sources_behavior);
   cugraph_sampling_set_dedupe_sources(sampling_options, dedupe_sources);
   cugraph_sampling_set_renumber_results(sampling_options, renumber_results);
+  cugraph_sampling_set_compression_type(sampling_options, compression);
 
   ret_code = cugraph_uniform_neighbor_sample(handle,
                                              graph,
@@ -235,6 +237,16 @@ int generic_uniform_neighbor_sample_test(const cugraph_resource_handle_t* handle
     }
   }
 
+  if (compression == COO_DST_MAJOR) {
+    for (int k = 0; k < result_offsets_size - 1; ++k) {
+      for (int i = h_result_offsets[k] + 1; i < h_result_offsets[k + 1]; ++i) {
+        TEST_ASSERT(test_ret_value,
+                    h_result_dsts[i - 1] <= h_result_dsts[i],
+                    "uniform_neighbor_sample output is not sorted by destination");
+      }
+    }
+  }
+
   for (int k = 0; k < num_start_labels + 1; ++k) {
     h_result_offsets[k] = h_result_offsets[k * fan_out_size];
   }
@@ -815,7 +827,8 @@ int test_uniform_neighbor_sample_clean(const cugraph_resource_handle_t* handle)
                                               return_hops,
                                               prior_sources_behavior,
                                               dedupe_sources,
-                                              renumber_results);
+                                              renumber_results,
+                                              COO);
 }
 
 int test_uniform_neighbor_sample_dedupe_sources(const cugraph_resource_handle_t* handle)
@@ -869,7 +882,8 @@ int test_uniform_neighbor_sample_dedupe_sources(const cugraph_resource_handle_t*
                                               return_hops,
                                               prior_sources_behavior,
                                               dedupe_sources,
-                                              renumber_results);
+                                              renumber_results,
+                                              COO);
 }
 
 int test_uniform_neighbor_sample_unique_sources(const cugraph_resource_handle_t* handle)
@@ -923,7 +937,8 @@ int test_uniform_neighbor_sample_unique_sources(const cugraph_resource_handle_t*
                                               return_hops,
                                               prior_sources_behavior,
                                               dedupe_sources,
-                                              renumber_results);
+                                              renumber_results,
+                                              COO);
 }
 
 int test_uniform_neighbor_sample_carry_over_sources(const cugraph_resource_handle_t* handle)
@@ -977,7 +992,8 @@ int test_uniform_neighbor_sample_carry_over_sources(const cugraph_resource_handl
                                               return_hops,
                                               prior_sources_behavior,
                                               dedupe_sources,
-                                              renumber_results);
+                                              renumber_results,
+                                              COO);
 }
 
 int test_uniform_neighbor_sample_renumber_results(const cugraph_resource_handle_t* handle)
@@ -1031,7 +1047,63 @@ int test_uniform_neighbor_sample_renumber_results(const cugraph_resource_handle_
                                               return_hops,
                                               prior_sources_behavior,
                                               dedupe_sources,
-                                              renumber_results);
+                                              renumber_results,
+                                              COO);
+}
+
+int test_uniform_neighbor_sample_renumber_results_dst_major(const cugraph_resource_handle_t* handle)
+{
+  cugraph_data_type_id_t vertex_tid    = INT32;
+  cugraph_data_type_id_t edge_tid      = INT32;
+  cugraph_data_type_id_t weight_tid    = FLOAT32;
+  cugraph_data_type_id_t edge_id_tid   = INT32;
+  cugraph_data_type_id_t edge_type_tid = INT32;
+
+  size_t num_edges        = 9;
+  size_t num_vertices     = 6;
+  size_t fan_out_size     = 3;
+  size_t num_starts       = 2;
+  size_t num_start_labels = 2;
+
+  vertex_t src[]       = {0, 0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]       = {1, 2, 3, 4, 0, 1, 3, 5, 5};
+  edge_t edge_ids[]    = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  weight_t weight[]    = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9};
+  int32_t edge_types[] = {8, 7, 6, 5, 4, 3, 2, 1, 0};
+  vertex_t start[]     = {2, 3};
+  int start_labels[]   = {6, 12};
+  int fan_out[]        = {-1, -1, -1};
+
+  int test_ret_value            = 0;
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  bool_t with_replacement                                 = FALSE;
+  bool_t return_hops                                      = TRUE;
+  cugraph_prior_sources_behavior_t prior_sources_behavior = DEFAULT;
+  bool_t dedupe_sources                                   = FALSE;
+  bool_t renumber_results                                 = TRUE;
+
+  return generic_uniform_neighbor_sample_test(handle,
+                                              src,
+                                              dst,
+                                              weight,
+                                              edge_ids,
+                                              edge_types,
+                                              num_vertices,
+                                              num_edges,
+                                              start,
+                                              start_labels,
+                                              num_starts,
+                                              num_start_labels,
+                                              fan_out,
+                                              fan_out_size,
+                                              with_replacement,
+                                              return_hops,
+                                              prior_sources_behavior,
+                                              dedupe_sources,
+                                              renumber_results,
+                                              COO_DST_MAJOR);
 }
 
 int main(int argc, char** argv)
@@ -1047,6 +1119,7 @@ int main(int argc, char** argv)
   result |= RUN_TEST_NEW(test_uniform_neighbor_sample_unique_sources, handle);
   result |= RUN_TEST_NEW(test_uniform_neighbor_sample_carry_over_sources, handle);
   result |= RUN_TEST_NEW(test_uniform_neighbor_sample_renumber_results, handle);
+  result |= RUN_TEST_NEW(test_uniform_neighbor_sample_renumber_results_dst_major, handle);
 
   cugraph_free_resource_handle(handle);
 
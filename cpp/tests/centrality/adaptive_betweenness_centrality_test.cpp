@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+struct AdaptiveBetweennessCentrality_Usecase {
+  double epsilon{0.05};
+  double delta{0.01};
+  size_t initial_num_sources{64};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_AdaptiveBetweennessCentrality
+  : public ::testing::TestWithParam<
+      std::tuple<AdaptiveBetweennessCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_AdaptiveBetweennessCentrality() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(AdaptiveBetweennessCentrality_Usecase const& adaptive_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, true);
+
+    auto graph_view = graph.view();
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Adaptive betweenness centrality");
+    }
+
+    auto [d_centralities, bound, num_sources] = cugraph::adaptive_betweenness_centrality(
+      handle,
+      rng_state,
+      graph_view,
+      std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+      static_cast<weight_t>(adaptive_usecase.epsilon),
+      static_cast<weight_t>(adaptive_usecase.delta),
+      adaptive_usecase.initial_num_sources);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (adaptive_usecase.check_correctness) {
+      ASSERT_GT(num_sources, size_t{0});
+
+      auto d_exact_centralities = cugraph::betweenness_centrality(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+        true,
+        false);
+
+      auto h_centralities       = cugraph::test::to_host(handle, d_centralities);
+      auto h_exact_centralities = cugraph::test::to_host(handle, d_exact_centralities);
+
+      // the bound holds with probability 1 - delta
+      for (size_t i = 0; i < h_centralities.size(); ++i) {
+        ASSERT_LE(std::abs(h_centralities[i] - h_exact_centralities[i]), bound)
+          << "Estimated centrality " << h_centralities[i] << " of vertex " << i
+          << " is off the exact centrality " << h_exact_centralities[i]
+          << " by more than the achieved error bound " << bound << ".";
+      }
+    }
+  }
+};
+
+using Tests_AdaptiveBetweennessCentrality_File =
+  Tests_AdaptiveBetweennessCentrality<cugraph::test::File_Usecase>;
+using Tests_AdaptiveBetweennessCentrality_Rmat =
+  Tests_AdaptiveBetweennessCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_AdaptiveBetweennessCentrality_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_AdaptiveBetweennessCentrality_File,
+  ::testing::Combine(::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.1, 0.01, 16},
+                                       AdaptiveBetweennessCentrality_Usecase{0.05, 0.01, 64}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_AdaptiveBetweennessCentrality_Rmat,
+  ::testing::Combine(::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.05, 0.01, 64}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_AdaptiveBetweennessCentrality_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(AdaptiveBetweennessCentrality_Usecase{0.01, 0.1, 256, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct BatchedKatzCentrality_Usecase {
+  size_t batch_size{8};
+  bool personalize{true};
+  bool test_weighted{false};
+  bool check_correctness{true};
+  size_t convergence_check_interval{1};
+  bool use_cuda_graph{false};
+};
+
+template <typename input_usecase_t>
+class Tests_BatchedKatzCentrality
+  : public ::testing::TestWithParam<std::tuple<BatchedKatzCentrality_Usecase, input_usecase_t>> {
+ public:
+  Tests_BatchedKatzCentrality() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BatchedKatzCentrality_Usecase const& batched_katz_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, batched_katz_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    auto num_vertices = graph_view.number_of_vertices();
+    auto batch_size   = batched_katz_usecase.batch_size;
+
+    auto degrees   = graph_view.compute_in_degrees(handle);
+    auto h_degrees = cugraph::test::to_host(handle, degrees);
+    auto max_it    = std::max_element(h_degrees.begin(), h_degrees.end());
+
+    // sweep alpha up to 1 / (max in-degree + 1), every other column adds a constant beta, and (if
+    // personalize) every column adds 1.0 to a random seed vertex
+
+    result_t const max_alpha = result_t{1.0} / static_cast<result_t>(*max_it + 1);
+    std::vector<result_t> h_alphas(batch_size);
+    std::vector<result_t> h_betas(batch_size);
+    for (size_t k = 0; k < batch_size; ++k) {
+      h_alphas[k] = max_alpha * static_cast<result_t>(k + 1) / static_cast<result_t>(batch_size);
+      h_betas[k]  = ((k % 2 == 0) || !batched_katz_usecase.personalize) ? result_t{1.0}
+                                                                        : result_t{0.0};
+    }
+
+    std::vector<size_t> h_offsets(batch_size + 1, 0);
+    std::vector<vertex_t> h_seeds{};
+    std::vector<result_t> h_values{};
+    if (batched_katz_usecase.personalize) {
+      std::default_random_engine generator{};
+      std::uniform_int_distribution<vertex_t> vertex_distribution{0, num_vertices - 1};
+      for (size_t k = 0; k < batch_size; ++k) {
+        h_seeds.push_back(vertex_distribution(generator));
+        h_values.push_back(result_t{1.0});
+        h_offsets[k + 1] = h_seeds.size();
+      }
+    }
+
+    auto d_alphas  = cugraph::test::to_device(handle, h_alphas);
+    auto d_betas   = cugraph::test::to_device(handle, h_betas);
+    auto d_offsets = cugraph::test::to_device(handle, h_offsets);
+    auto d_seeds   = cugraph::test::to_device(handle, h_seeds);
+    auto d_values  = cugraph::test::to_device(handle, h_values);
+
+    result_t constexpr epsilon{1e-6};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Batched Katz centrality");
+    }
+
+    auto [d_katz_centralities, metadata] =
+      cugraph::batched_katz_centrality<vertex_t, edge_t, weight_t, result_t>(
+        handle,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<result_t const>(d_alphas.data(), d_alphas.size()),
+        raft::device_span<result_t const>(d_betas.data(), d_betas.size()),
+        batched_katz_usecase.personalize
+          ? std::make_optional(std::make_tuple(
+              raft::device_span<size_t const>(d_offsets.data(), d_offsets.size()),
+              raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+              raft::device_span<result_t const>(d_values.data(), d_values.size())))
+          : std::nullopt,
+        epsilon,
+        std::numeric_limits<size_t>::max(),
+        true,
+        false,
+        cugraph::centrality_iteration_schedule_t{size_t{1},
+                                                 batched_katz_usecase.convergence_check_interval,
+                                                 std::nullopt,
+                                                 batched_katz_usecase.use_cuda_graph});
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_TRUE(metadata.converged_) << "Batched Katz centrality failed to converge.";
+
+    if (batched_katz_usecase.check_correctness) {
+      auto h_cugraph_katz_centralities = cugraph::test::to_host(handle, d_katz_centralities);
+
+      auto threshold_ratio     = 1e-3;
+      auto threshold_magnitude = 1e-6;  // skip comparison for low Katz centrality vertices
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      for (size_t k = 0; k < batch_size; ++k) {
+        std::vector<result_t> h_reference_betas(num_vertices, h_betas[k]);
+        for (size_t i = h_offsets[k]; i < h_offsets[k + 1]; ++i) {
+          h_reference_betas[h_seeds[i]] += h_values[i];
+        }
+        auto d_reference_betas = cugraph::test::to_device(handle, h_reference_betas);
+
+        rmm::device_uvector<result_t> d_reference_katz_centralities(num_vertices,
+                                                                    handle.get_stream());
+        cugraph::katz_centrality(handle,
+                                 graph_view,
+                                 edge_weight_view,
+                                 d_reference_betas.data(),
+                                 d_reference_katz_centralities.data(),
+                                 h_alphas[k],
+                                 result_t{0.0},
+                                 epsilon,
+                                 std::numeric_limits<size_t>::max(),
+                                 false,
+                                 true,
+                                 false);
+        auto h_reference_katz_centralities =
+          cugraph::test::to_host(handle, d_reference_katz_centralities);
+
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          ASSERT_TRUE(
+            nearly_equal(h_reference_katz_centralities[v],
+                         h_cugraph_katz_centralities[static_cast<size_t>(v) * batch_size + k]))
+            << "Batched Katz centrality values do not match with the reference values (vertex "
+            << v << ", column " << k << ").";
+        }
+      }
+    }
+  }
+};
+
+using Tests_BatchedKatzCentrality_File = Tests_BatchedKatzCentrality<cugraph::test::File_Usecase>;
+using Tests_BatchedKatzCentrality_Rmat = Tests_BatchedKatzCentrality<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BatchedKatzCentrality_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BatchedKatzCentrality_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BatchedKatzCentrality_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BatchedKatzCentrality_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedKatzCentrality_Usecase{8, false, false},
+                      BatchedKatzCentrality_Usecase{8, true, false},
+                      BatchedKatzCentrality_Usecase{8, true, true},
+                      BatchedKatzCentrality_Usecase{33, true, true},
+                      BatchedKatzCentrality_Usecase{8, true, true, true, 4, false},
+                      BatchedKatzCentrality_Usecase{8, true, true, true, 4, true},
+                      BatchedKatzCentrality_Usecase{8, true, true, true, 5, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BatchedKatzCentrality_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedKatzCentrality_Usecase{8, true, false},
+                      BatchedKatzCentrality_Usecase{8, true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BatchedKatzCentrality_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BatchedKatzCentrality_Usecase{64, true, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -102,6 +102,8 @@ struct EigenvectorCentrality_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  cugraph::centrality_eigensolver_t solver{cugraph::centrality_eigensolver_t::power_iteration};
 };
 
 template <typename input_usecase_t>
@@ -168,7 +170,9 @@ class Tests_EigenvectorCentrality
                                       std::optional<raft::device_span<weight_t const>>{},
                                       epsilon,
                                       eigenvector_usecase.max_iterations,
-                                      false);
+                                      false,
+                                      cugraph::centrality_iteration_schedule_t{},
+                                      eigenvector_usecase.solver);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -269,7 +273,11 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(EigenvectorCentrality_Usecase{500, false, false},
                       EigenvectorCentrality_Usecase{500, false, true},
                       EigenvectorCentrality_Usecase{500, true, false},
-                      EigenvectorCentrality_Usecase{500, true, true}),
+                      EigenvectorCentrality_Usecase{500, true, true},
+                      EigenvectorCentrality_Usecase{
+                        500, false, false, true, cugraph::centrality_eigensolver_t::lanczos},
+                      EigenvectorCentrality_Usecase{
+                        500, true, false, true, cugraph::centrality_eigensolver_t::lanczos}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -293,7 +301,11 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(EigenvectorCentrality_Usecase{500, false, false},
                       EigenvectorCentrality_Usecase{500, false, true},
                       EigenvectorCentrality_Usecase{500, true, false},
-                      EigenvectorCentrality_Usecase{500, true, true}),
+                      EigenvectorCentrality_Usecase{500, true, true},
+                      EigenvectorCentrality_Usecase{
+                        500, false, false, true, cugraph::centrality_eigensolver_t::lanczos},
+                      EigenvectorCentrality_Usecase{
+                        500, true, false, true, cugraph::centrality_eigensolver_t::lanczos}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <vector>
+
+struct HyperANF_Usecase {
+  size_t log2_num_registers{8};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_HyperANF
+  : public ::testing::TestWithParam<std::tuple<HyperANF_Usecase, input_usecase_t>> {
+ public:
+  Tests_HyperANF() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(HyperANF_Usecase const& hyper_anf_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber);
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("HyperANF");
+    }
+
+    auto [neighborhood_function, d_harmonic_centralities, d_closeness_centralities, diameter] =
+      cugraph::hyper_anf(handle, graph_view, hyper_anf_usecase.log2_num_registers);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (hyper_anf_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+      std::vector<std::vector<vertex_t>> adjacency_lists(num_vertices);
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        adjacency_lists[h_srcs[i]].push_back(h_dsts[i]);
+      }
+
+      // exact neighborhood function & harmonic centralities from a BFS per vertex
+
+      std::vector<double> ref_neighborhood_function{};
+      std::vector<double> ref_harmonic_centralities(num_vertices, 0.0);
+      for (size_t s = 0; s < num_vertices; ++s) {
+        std::vector<size_t> distances(num_vertices, std::numeric_limits<size_t>::max());
+        std::queue<vertex_t> queue{};
+        distances[s] = 0;
+        queue.push(static_cast<vertex_t>(s));
+        while (!queue.empty()) {
+          auto v = queue.front();
+          queue.pop();
+          for (auto nbr : adjacency_lists[v]) {
+            if (distances[nbr] == std::numeric_limits<size_t>::max()) {
+              distances[nbr] = distances[v] + 1;
+              queue.push(nbr);
+            }
+          }
+        }
+        for (auto d : distances) {
+          if (d == std::numeric_limits<size_t>::max()) { continue; }
+          if (ref_neighborhood_function.size() <= d) { ref_neighborhood_function.resize(d + 1); }
+          ref_neighborhood_function[d] += 1.0;
+          if (d > 0) { ref_harmonic_centralities[s] += 1.0 / static_cast<double>(d); }
+        }
+      }
+      for (size_t t = 1; t < ref_neighborhood_function.size(); ++t) {
+        ref_neighborhood_function[t] += ref_neighborhood_function[t - 1];
+      }
+
+      auto ref_threshold = 0.9 * ref_neighborhood_function.back();
+      double ref_diameter{0.0};
+      for (size_t t = 0; t < ref_neighborhood_function.size(); ++t) {
+        if (ref_neighborhood_function[t] >= ref_threshold) {
+          if (t > 0) {
+            auto prev    = ref_neighborhood_function[t - 1];
+            ref_diameter = static_cast<double>(t - 1) +
+                           (ref_threshold - prev) / (ref_neighborhood_function[t] - prev);
+          }
+          break;
+        }
+      }
+
+      // the estimates are approximate, compare with a loose tolerance (the relative standard error
+      // of each counter is 1.04 / sqrt(2^log2_num_registers))
+
+      auto tolerance = 4.0 * 1.04 / std::sqrt(std::pow(2.0, hyper_anf_usecase.log2_num_registers));
+
+      ASSERT_TRUE(neighborhood_function.size() > 0);
+      for (size_t t = 0;
+           t < std::min(neighborhood_function.size(), ref_neighborhood_function.size());
+           ++t) {
+        ASSERT_TRUE(std::abs(neighborhood_function[t] - ref_neighborhood_function[t]) <=
+                    tolerance * ref_neighborhood_function[t])
+          << "t=" << t << " estimated N(t)=" << neighborhood_function[t]
+          << " exact N(t)=" << ref_neighborhood_function[t];
+      }
+      ASSERT_TRUE(std::abs(neighborhood_function.back() - ref_neighborhood_function.back()) <=
+                  tolerance * ref_neighborhood_function.back());
+
+      ASSERT_TRUE(std::abs(diameter - ref_diameter) <= 1.0)
+        << "estimated effective diameter=" << diameter
+        << " exact effective diameter=" << ref_diameter;
+
+      auto h_harmonic_centralities  = cugraph::test::to_host(handle, d_harmonic_centralities);
+      auto h_closeness_centralities = cugraph::test::to_host(handle, d_closeness_centralities);
+      ASSERT_EQ(h_harmonic_centralities.size(), num_vertices);
+      ASSERT_EQ(h_closeness_centralities.size(), num_vertices);
+      ASSERT_TRUE(std::all_of(h_closeness_centralities.begin(),
+                              h_closeness_centralities.end(),
+                              [](auto val) { return std::isfinite(val) && (val >= 0.0); }));
+
+      double error_sum{0.0};
+      double ref_sum{0.0};
+      for (size_t v = 0; v < num_vertices; ++v) {
+        error_sum += std::abs(h_harmonic_centralities[v] - ref_harmonic_centralities[v]);
+        ref_sum += ref_harmonic_centralities[v];
+      }
+      ASSERT_TRUE(error_sum <= tolerance * ref_sum)
+        << "The harmonic centrality estimates are too far from the exact values.";
+    }
+  }
+};
+
+using Tests_HyperANF_File = Tests_HyperANF<cugraph::test::File_Usecase>;
+using Tests_HyperANF_Rmat = Tests_HyperANF<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_HyperANF_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_HyperANF_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_HyperANF_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_HyperANF_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperANF_Usecase{6}, HyperANF_Usecase{8}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_HyperANF_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperANF_Usecase{8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_HyperANF_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(HyperANF_Usecase{6, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
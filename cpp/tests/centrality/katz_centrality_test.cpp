@@ -99,6 +99,8 @@ struct KatzCentrality_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  cugraph::centrality_iteration_schedule_t schedule{};
 };
 
 template <typename input_usecase_t>
@@ -174,7 +176,9 @@ class Tests_KatzCentrality
                              epsilon,
                              std::numeric_limits<size_t>::max(),
                              false,
-                             true);
+                             true,
+                             false,
+                             katz_usecase.schedule);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -273,7 +277,9 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(KatzCentrality_Usecase{false, false},
                       KatzCentrality_Usecase{false, true},
                       KatzCentrality_Usecase{true, false},
-                      KatzCentrality_Usecase{true, true}),
+                      KatzCentrality_Usecase{true, true},
+                      KatzCentrality_Usecase{false, false, true, {4, 3}},
+                      KatzCentrality_Usecase{true, false, true, {4, 3}}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
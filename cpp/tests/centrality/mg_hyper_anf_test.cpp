@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct HyperANF_Usecase {
+  size_t log2_num_registers{8};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGHyperANF
+  : public ::testing::TestWithParam<std::tuple<HyperANF_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGHyperANF() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running HyperANF on multiple GPUs to that of a single-GPU run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(HyperANF_Usecase const& hyper_anf_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG HyperANF");
+    }
+
+    auto [mg_neighborhood_function,
+          d_mg_harmonic_centralities,
+          d_mg_closeness_centralities,
+          mg_diameter] =
+      cugraph::hyper_anf(*handle_, mg_graph_view, hyper_anf_usecase.log2_num_registers);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (hyper_anf_usecase.check_correctness) {
+      // 1. gather the results and the graph (in MG vertex IDs, the register hashes are computed
+      // from the vertex IDs, so an SG run on the same vertex IDs should produce the same
+      // estimates)
+
+      auto d_harmonic_centralities = cugraph::test::device_gatherv(
+        *handle_,
+        raft::device_span<double const>(d_mg_harmonic_centralities.data(),
+                                        d_mg_harmonic_centralities.size()));
+      auto d_closeness_centralities = cugraph::test::device_gatherv(
+        *handle_,
+        raft::device_span<double const>(d_mg_closeness_centralities.data(),
+                                        d_mg_closeness_centralities.size()));
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+      std::tie(sg_graph, std::ignore, std::ignore, std::ignore, std::ignore) =
+        cugraph::test::mg_graph_to_sg_graph(
+          *handle_,
+          mg_graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+          false);
+
+      if (handle_->get_comms().get_rank() == 0) {
+        // 2. run SG HyperANF
+
+        auto sg_graph_view = sg_graph.view();
+
+        auto [sg_neighborhood_function,
+              d_sg_harmonic_centralities,
+              d_sg_closeness_centralities,
+              sg_diameter] =
+          cugraph::hyper_anf(*handle_, sg_graph_view, hyper_anf_usecase.log2_num_registers);
+
+        // 3. compare
+
+        auto nearly_equal = [](double lhs, double rhs) {
+          return std::abs(lhs - rhs) <= std::max(std::abs(lhs), std::abs(rhs)) * 1e-6 + 1e-12;
+        };
+
+        ASSERT_EQ(mg_neighborhood_function.size(), sg_neighborhood_function.size());
+        ASSERT_TRUE(std::equal(mg_neighborhood_function.begin(),
+                               mg_neighborhood_function.end(),
+                               sg_neighborhood_function.begin(),
+                               nearly_equal))
+          << "MG and SG neighborhood functions do not match.";
+        ASSERT_TRUE(nearly_equal(mg_diameter, sg_diameter))
+          << "MG and SG effective diameters do not match.";
+
+        auto h_mg_harmonic_centralities = cugraph::test::to_host(*handle_, d_harmonic_centralities);
+        auto h_sg_harmonic_centralities =
+          cugraph::test::to_host(*handle_, d_sg_harmonic_centralities);
+        ASSERT_TRUE(std::equal(h_mg_harmonic_centralities.begin(),
+                               h_mg_harmonic_centralities.end(),
+                               h_sg_harmonic_centralities.begin(),
+                               nearly_equal))
+          << "MG and SG harmonic centralities do not match.";
+
+        auto h_mg_closeness_centralities =
+          cugraph::test::to_host(*handle_, d_closeness_centralities);
+        auto h_sg_closeness_centralities =
+          cugraph::test::to_host(*handle_, d_sg_closeness_centralities);
+        ASSERT_TRUE(std::equal(h_mg_closeness_centralities.begin(),
+                               h_mg_closeness_centralities.end(),
+                               h_sg_closeness_centralities.begin(),
+                               nearly_equal))
+          << "MG and SG closeness centralities do not match.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGHyperANF<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGHyperANF_File = Tests_MGHyperANF<cugraph::test::File_Usecase>;
+using Tests_MGHyperANF_Rmat = Tests_MGHyperANF<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGHyperANF_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGHyperANF_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGHyperANF_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGHyperANF_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperANF_Usecase{6}, HyperANF_Usecase{8}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGHyperANF_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperANF_Usecase{8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGHyperANF_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(HyperANF_Usecase{6, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
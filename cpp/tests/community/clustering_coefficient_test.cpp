@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+struct ClusteringCoefficient_Usecase {
+  size_t num_wedge_samples_per_vertex{256};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ClusteringCoefficient
+  : public ::testing::TestWithParam<std::tuple<ClusteringCoefficient_Usecase, input_usecase_t>> {
+ public:
+  Tests_ClusteringCoefficient() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(ClusteringCoefficient_Usecase const& clustering_coefficient_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber, false, true);
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Clustering coefficient");
+    }
+
+    auto [d_coefficients, transitivity, average_coefficient] =
+      cugraph::clustering_coefficient(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Approximate clustering coefficient");
+    }
+
+    auto [d_approximate_coefficients,
+          d_standard_errors,
+          approximate_transitivity,
+          transitivity_standard_error] =
+      cugraph::approximate_clustering_coefficient(
+        handle, rng_state, graph_view, clustering_coefficient_usecase.num_wedge_samples_per_vertex);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+    ASSERT_EQ(d_coefficients.size(), num_vertices);
+    ASSERT_EQ(d_approximate_coefficients.size(), num_vertices);
+    ASSERT_EQ(d_standard_errors.size(), num_vertices);
+
+    if (clustering_coefficient_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      // 1. reference values (count the closed wedges centered at every vertex)
+
+      std::vector<std::vector<vertex_t>> adjacency_lists(num_vertices);
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] != h_dsts[i]) { adjacency_lists[h_srcs[i]].push_back(h_dsts[i]); }
+      }
+      for (auto& adjacency_list : adjacency_lists) {
+        std::sort(adjacency_list.begin(), adjacency_list.end());
+      }
+
+      std::vector<double> h_reference_coefficients(num_vertices, 0.0);
+      double closed_wedge_sum{0.0};
+      double wedge_sum{0.0};
+      for (size_t v = 0; v < num_vertices; ++v) {
+        auto const& nbrs = adjacency_lists[v];
+        if (nbrs.size() < 2) { continue; }
+        auto num_wedges =
+          static_cast<double>(nbrs.size()) * static_cast<double>(nbrs.size() - 1) * 0.5;
+        double num_closed_wedges{0.0};
+        for (size_t i = 0; i < nbrs.size(); ++i) {
+          auto const& nbr_nbrs = adjacency_lists[nbrs[i]];
+          for (size_t j = i + 1; j < nbrs.size(); ++j) {
+            if (std::binary_search(nbr_nbrs.begin(), nbr_nbrs.end(), nbrs[j])) {
+              num_closed_wedges += 1.0;
+            }
+          }
+        }
+        h_reference_coefficients[v] = num_closed_wedges / num_wedges;
+        closed_wedge_sum += num_closed_wedges;
+        wedge_sum += num_wedges;
+      }
+      auto reference_transitivity = wedge_sum > 0.0 ? closed_wedge_sum / wedge_sum : 0.0;
+      auto reference_average_coefficient =
+        num_vertices > 0 ? std::accumulate(h_reference_coefficients.begin(),
+                                           h_reference_coefficients.end(),
+                                           0.0) /
+                             static_cast<double>(num_vertices)
+                         : 0.0;
+
+      // 2. compare the exact results
+
+      auto nearly_equal = [](double lhs, double rhs) {
+        return std::abs(lhs - rhs) <= std::max(std::abs(lhs), std::abs(rhs)) * 1e-6 + 1e-12;
+      };
+
+      auto h_coefficients = cugraph::test::to_host(handle, d_coefficients);
+      ASSERT_TRUE(std::equal(h_reference_coefficients.begin(),
+                             h_reference_coefficients.end(),
+                             h_coefficients.begin(),
+                             nearly_equal))
+        << "local clustering coefficients do not match with the reference values.";
+      ASSERT_TRUE(nearly_equal(transitivity, reference_transitivity))
+        << "transitivity (" << transitivity << ") does not match with the reference value ("
+        << reference_transitivity << ").";
+      ASSERT_TRUE(nearly_equal(average_coefficient, reference_average_coefficient))
+        << "average clustering coefficient (" << average_coefficient
+        << ") does not match with the reference value (" << reference_average_coefficient << ").";
+
+      // 3. check the approximate results (the estimates should fall within a few standard errors;
+      // a per-vertex estimate with a zero standard error can still miss if only a few valid
+      // wedges were sampled, so only a small fraction of the vertices may fall outside)
+
+      auto h_approximate_coefficients = cugraph::test::to_host(handle, d_approximate_coefficients);
+      auto h_standard_errors          = cugraph::test::to_host(handle, d_standard_errors);
+      size_t num_outliers{0};
+      for (size_t v = 0; v < num_vertices; ++v) {
+        ASSERT_TRUE(h_approximate_coefficients[v] >= 0.0 && h_approximate_coefficients[v] <= 1.0);
+        if (std::abs(h_approximate_coefficients[v] - h_reference_coefficients[v]) >
+            4.0 * h_standard_errors[v] + 1e-6) {
+          ++num_outliers;
+        }
+      }
+      ASSERT_TRUE(num_outliers <= std::max(size_t{2}, num_vertices / 20))
+        << num_outliers
+        << " approximate local clustering coefficients fall outside the error bars.";
+      ASSERT_TRUE(std::abs(approximate_transitivity - reference_transitivity) <=
+                  4.0 * transitivity_standard_error + 1e-2)
+        << "approximate transitivity (" << approximate_transitivity << " +/- "
+        << transitivity_standard_error << ") is too far from the reference value ("
+        << reference_transitivity << ").";
+    }
+  }
+};
+
+using Tests_ClusteringCoefficient_File = Tests_ClusteringCoefficient<cugraph::test::File_Usecase>;
+using Tests_ClusteringCoefficient_Rmat = Tests_ClusteringCoefficient<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ClusteringCoefficient_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ClusteringCoefficient_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ClusteringCoefficient_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ClusteringCoefficient_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClusteringCoefficient_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ClusteringCoefficient_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClusteringCoefficient_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ClusteringCoefficient_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ClusteringCoefficient_Usecase{64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -15,6 +15,7 @@
  */
 #include "community/egonet_validate.hpp"
 #include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
 #include "utilities/test_graphs.hpp"
 
 #include <cugraph/algorithms.hpp>
@@ -31,6 +32,10 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+#include <tuple>
+#include <vector>
+
 struct Egonet_Usecase {
   std::vector<int32_t> ego_sources_{};
   int32_t radius_{1};
@@ -133,6 +138,62 @@ class Tests_Egonet : public ::testing::TestWithParam<std::tuple<Egonet_Usecase,
                                      d_reference_dst,
                                      d_reference_wgt,
                                      d_reference_offsets);
+
+      // the batched extraction should produce the same EgoNet subgraphs (after expanding the
+      // edge indices into the shared edge list)
+
+      auto [d_batched_src, d_batched_dst, d_batched_wgt, d_batched_offsets, d_batched_indices] =
+        cugraph::extract_ego_batched(
+          handle,
+          graph_view,
+          edge_weight_view,
+          raft::device_span<vertex_t const>{d_ego_sources.data(), d_ego_sources.size()},
+          egonet_usecase.radius_);
+
+      auto h_batched_src     = cugraph::test::to_host(handle, d_batched_src);
+      auto h_batched_dst     = cugraph::test::to_host(handle, d_batched_dst);
+      auto h_batched_offsets = cugraph::test::to_host(handle, d_batched_offsets);
+      auto h_batched_indices = cugraph::test::to_host(handle, d_batched_indices);
+      std::optional<std::vector<weight_t>> h_batched_wgt{std::nullopt};
+      if (d_batched_wgt) { h_batched_wgt = cugraph::test::to_host(handle, *d_batched_wgt); }
+
+      ASSERT_EQ(h_batched_offsets.size(), d_ego_sources.size() + 1);
+      std::set<std::tuple<vertex_t, vertex_t, weight_t>> unique_edges{};
+      for (size_t i = 0; i < h_batched_src.size(); ++i) {
+        unique_edges.insert(std::make_tuple(h_batched_src[i],
+                                            h_batched_dst[i],
+                                            h_batched_wgt ? (*h_batched_wgt)[i] : weight_t{0}));
+      }
+      ASSERT_EQ(unique_edges.size(), h_batched_src.size())
+        << "the shared edge list should not have duplicate edges.";
+
+      std::vector<vertex_t> h_expanded_src(h_batched_indices.size());
+      std::vector<vertex_t> h_expanded_dst(h_batched_indices.size());
+      for (size_t i = 0; i < h_batched_indices.size(); ++i) {
+        ASSERT_LT(h_batched_indices[i], h_batched_src.size());
+        h_expanded_src[i] = h_batched_src[h_batched_indices[i]];
+        h_expanded_dst[i] = h_batched_dst[h_batched_indices[i]];
+      }
+      auto d_expanded_src = cugraph::test::to_device(handle, h_expanded_src);
+      auto d_expanded_dst = cugraph::test::to_device(handle, h_expanded_dst);
+      std::optional<rmm::device_uvector<weight_t>> d_expanded_wgt{std::nullopt};
+      if (h_batched_wgt) {
+        std::vector<weight_t> h_expanded_wgt(h_batched_indices.size());
+        for (size_t i = 0; i < h_batched_indices.size(); ++i) {
+          h_expanded_wgt[i] = (*h_batched_wgt)[h_batched_indices[i]];
+        }
+        d_expanded_wgt = cugraph::test::to_device(handle, h_expanded_wgt);
+      }
+
+      cugraph::test::egonet_validate(handle,
+                                     d_expanded_src,
+                                     d_expanded_dst,
+                                     d_expanded_wgt,
+                                     d_batched_offsets,
+                                     d_reference_src,
+                                     d_reference_dst,
+                                     d_reference_wgt,
+                                     d_reference_offsets);
     }
   }
 };
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+struct GraphletCount_Usecase {
+  bool induced{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphletCount
+  : public ::testing::TestWithParam<std::tuple<GraphletCount_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphletCount() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(GraphletCount_Usecase const& graphlet_count_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using graphlet_t = cugraph::four_node_graphlet_t;
+
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber, false, true);
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("4-node graphlet count");
+    }
+
+    auto counts =
+      cugraph::four_node_graphlet_count(handle, graph_view, graphlet_count_usecase.induced);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (graphlet_count_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      // 1. reference induced counts (classify every 4-vertex subset, the test graphs should be
+      // small)
+
+      auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+      std::vector<std::vector<bool>> adjacency_matrix(num_vertices,
+                                                      std::vector<bool>(num_vertices, false));
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] != h_dsts[i]) { adjacency_matrix[h_srcs[i]][h_dsts[i]] = true; }
+      }
+
+      std::array<size_t, static_cast<size_t>(graphlet_t::NUM_TYPES)> h_reference_counts{};
+      for (size_t v0 = 0; v0 < num_vertices; ++v0) {
+        for (size_t v1 = v0 + 1; v1 < num_vertices; ++v1) {
+          for (size_t v2 = v1 + 1; v2 < num_vertices; ++v2) {
+            for (size_t v3 = v2 + 1; v3 < num_vertices; ++v3) {
+              std::array<size_t, 4> vs{v0, v1, v2, v3};
+              std::array<int, 4> degrees{0, 0, 0, 0};
+              int num_edges{0};
+              for (size_t i = 0; i < 4; ++i) {
+                for (size_t j = i + 1; j < 4; ++j) {
+                  if (adjacency_matrix[vs[i]][vs[j]]) {
+                    ++degrees[i];
+                    ++degrees[j];
+                    ++num_edges;
+                  }
+                }
+              }
+              std::sort(degrees.begin(), degrees.end());
+              if (degrees[0] == 0) { continue; }  // disconnected
+              if (num_edges == 3) {
+                if (degrees[3] == 3) {
+                  ++h_reference_counts[static_cast<size_t>(graphlet_t::STAR)];
+                } else if (degrees[0] == 1 && degrees[1] == 1) {
+                  ++h_reference_counts[static_cast<size_t>(graphlet_t::PATH)];
+                }
+              } else if (num_edges == 4) {
+                if (degrees[0] == 2) {
+                  ++h_reference_counts[static_cast<size_t>(graphlet_t::CYCLE)];
+                } else {
+                  ++h_reference_counts[static_cast<size_t>(graphlet_t::TAILED_TRIANGLE)];
+                }
+              } else if (num_edges == 5) {
+                ++h_reference_counts[static_cast<size_t>(graphlet_t::DIAMOND)];
+              } else if (num_edges == 6) {
+                ++h_reference_counts[static_cast<size_t>(graphlet_t::CLIQUE)];
+              }
+            }
+          }
+        }
+      }
+
+      if (!graphlet_count_usecase.induced) {
+        // embeddings[i][j]: the number of (non-induced) copies of graphlet i in graphlet j
+        std::array<std::array<size_t, 6>, 6> embeddings{{{1, 0, 4, 2, 6, 12},
+                                                         {0, 1, 0, 1, 2, 4},
+                                                         {0, 0, 1, 0, 1, 3},
+                                                         {0, 0, 0, 1, 4, 12},
+                                                         {0, 0, 0, 0, 1, 6},
+                                                         {0, 0, 0, 0, 0, 1}}};
+        std::array<size_t, static_cast<size_t>(graphlet_t::NUM_TYPES)> non_induced_counts{};
+        for (size_t i = 0; i < non_induced_counts.size(); ++i) {
+          for (size_t j = 0; j < h_reference_counts.size(); ++j) {
+            non_induced_counts[i] += embeddings[i][j] * h_reference_counts[j];
+          }
+        }
+        h_reference_counts = non_induced_counts;
+      }
+
+      // 2. compare
+
+      for (size_t i = 0; i < counts.size(); ++i) {
+        ASSERT_EQ(counts[i], h_reference_counts[i])
+          << "graphlet type " << i << " count does not match with the reference value.";
+      }
+    }
+  }
+};
+
+using Tests_GraphletCount_File = Tests_GraphletCount<cugraph::test::File_Usecase>;
+using Tests_GraphletCount_Rmat = Tests_GraphletCount<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphletCount_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphletCount_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphletCount_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphletCount_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphletCount_Usecase{true}, GraphletCount_Usecase{false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphletCount_Rmat,
+  ::testing::Combine(
+    // enable correctness checks (the reference implementation enumerates every 4-vertex subset)
+    ::testing::Values(GraphletCount_Usecase{true}, GraphletCount_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(7, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_GraphletCount_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(GraphletCount_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+void k_clique_count_reference(std::vector<std::vector<vertex_t>> const& out_nbrs /* DAG */,
+                              std::vector<vertex_t>& clique,
+                              std::vector<vertex_t> const& candidates,
+                              size_t k,
+                              size_t& num_cliques,
+                              std::vector<edge_t>& vertex_counts,
+                              std::map<std::tuple<vertex_t, vertex_t>, edge_t>& edge_counts)
+{
+  if (clique.size() == k) {
+    ++num_cliques;
+    for (size_t i = 0; i < k; ++i) {
+      ++vertex_counts[clique[i]];
+      for (size_t j = 0; j < k; ++j) {
+        if (i != j) { ++edge_counts[std::make_tuple(clique[i], clique[j])]; }
+      }
+    }
+    return;
+  }
+  for (auto v : candidates) {
+    std::vector<vertex_t> new_candidates{};
+    std::set_intersection(candidates.begin(),
+                          candidates.end(),
+                          out_nbrs[v].begin(),
+                          out_nbrs[v].end(),
+                          std::back_inserter(new_candidates));
+    clique.push_back(v);
+    k_clique_count_reference(
+      out_nbrs, clique, new_candidates, k, num_cliques, vertex_counts, edge_counts);
+    clique.pop_back();
+  }
+}
+
+struct KCliqueCount_Usecase {
+  size_t k{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_KCliqueCount
+  : public ::testing::TestWithParam<std::tuple<KCliqueCount_Usecase, input_usecase_t>> {
+ public:
+  Tests_KCliqueCount() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(KCliqueCount_Usecase const& k_clique_count_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber, false, true);
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("K-clique count");
+    }
+
+    auto [num_cliques, d_vertex_counts, edge_counts] = cugraph::k_clique_count(
+      handle, graph_view, k_clique_count_usecase.k, true, k_clique_count_usecase.check_correctness);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_TRUE(d_vertex_counts.has_value());
+    ASSERT_EQ((*d_vertex_counts).size(), static_cast<size_t>(graph_view.number_of_vertices()));
+
+    if (k_clique_count_usecase.check_correctness) {
+      ASSERT_TRUE(edge_counts.has_value());
+
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::make_optional((*edge_counts).view()),
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs        = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts        = cugraph::test::to_host(handle, d_dsts);
+      auto h_edge_counts = cugraph::test::to_host(handle, *d_ids);
+
+      // 1. reference counts (orient the edges by (degree, vertex ID) and enumerate every clique
+      // from its lowest ranked vertex)
+
+      auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+      std::vector<edge_t> degrees(num_vertices, edge_t{0});
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] != h_dsts[i]) { ++degrees[h_srcs[i]]; }
+      }
+      std::vector<std::vector<vertex_t>> out_nbrs(num_vertices);
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto src = h_srcs[i];
+        auto dst = h_dsts[i];
+        if ((degrees[src] < degrees[dst]) || ((degrees[src] == degrees[dst]) && (src < dst))) {
+          out_nbrs[src].push_back(dst);
+        }
+      }
+      for (auto& nbrs : out_nbrs) {
+        std::sort(nbrs.begin(), nbrs.end());
+      }
+
+      size_t h_reference_num_cliques{0};
+      std::vector<edge_t> h_reference_vertex_counts(num_vertices, edge_t{0});
+      std::map<std::tuple<vertex_t, vertex_t>, edge_t> h_reference_edge_counts{};
+      for (size_t v = 0; v < num_vertices; ++v) {
+        std::vector<vertex_t> clique{static_cast<vertex_t>(v)};
+        k_clique_count_reference(out_nbrs,
+                                 clique,
+                                 out_nbrs[v],
+                                 k_clique_count_usecase.k,
+                                 h_reference_num_cliques,
+                                 h_reference_vertex_counts,
+                                 h_reference_edge_counts);
+      }
+
+      // 2. compare
+
+      ASSERT_EQ(num_cliques, h_reference_num_cliques)
+        << "the k-clique count does not match with the reference value.";
+
+      auto h_vertex_counts = cugraph::test::to_host(handle, *d_vertex_counts);
+      ASSERT_TRUE(std::equal(h_reference_vertex_counts.begin(),
+                             h_reference_vertex_counts.end(),
+                             h_vertex_counts.begin()))
+        << "per-vertex k-clique counts do not match with the reference values.";
+
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto it = h_reference_edge_counts.find(std::make_tuple(h_srcs[i], h_dsts[i]));
+        ASSERT_EQ(h_edge_counts[i], it != h_reference_edge_counts.end() ? it->second : edge_t{0})
+          << "per-edge k-clique counts do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_KCliqueCount_File = Tests_KCliqueCount<cugraph::test::File_Usecase>;
+using Tests_KCliqueCount_Rmat = Tests_KCliqueCount<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_KCliqueCount_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KCliqueCount_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KCliqueCount_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_KCliqueCount_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KCliqueCount_Usecase{3},
+                      KCliqueCount_Usecase{4},
+                      KCliqueCount_Usecase{5},
+                      KCliqueCount_Usecase{6}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_KCliqueCount_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KCliqueCount_Usecase{4}, KCliqueCount_Usecase{5}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_KCliqueCount_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(KCliqueCount_Usecase{4, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -37,6 +37,7 @@
 #include <numeric>
 #include <random>
 #include <set>
+#include <tuple>
 #include <vector>
 
 struct KTruss_Usecase {
@@ -246,6 +247,37 @@ class Tests_KTruss : public ::testing::TestWithParam<std::tuple<KTruss_Usecase,
       ASSERT_TRUE(
         std::equal(h_cugraph_dsts.begin(), h_cugraph_dsts.end(), h_reference_dsts.begin()));
 
+      // edges with the truss number of k or larger should coincide with the K-Truss edges
+
+      auto d_truss_numbers = cugraph::truss_number<vertex_t, edge_t, false>(handle, graph_view);
+
+      auto [d_truss_srcs, d_truss_dsts, d_truss_wgts, d_edge_truss_numbers, d_truss_types] =
+        cugraph::decompress_to_edgelist(
+          handle,
+          graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+          std::make_optional(d_truss_numbers.view()),
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+
+      auto h_truss_srcs         = cugraph::test::to_host(handle, d_truss_srcs);
+      auto h_truss_dsts         = cugraph::test::to_host(handle, d_truss_dsts);
+      auto h_edge_truss_numbers = cugraph::test::to_host(handle, *d_edge_truss_numbers);
+      std::vector<std::tuple<vertex_t, vertex_t>> h_k_truss_edges{};
+      for (size_t i = 0; i < h_edge_truss_numbers.size(); ++i) {
+        if (h_edge_truss_numbers[i] >= k_truss_usecase.k_) {
+          h_k_truss_edges.emplace_back(h_truss_srcs[i], h_truss_dsts[i]);
+        }
+      }
+      std::sort(h_k_truss_edges.begin(), h_k_truss_edges.end());
+
+      ASSERT_EQ(h_k_truss_edges.size(), h_reference_srcs.size());
+      for (size_t i = 0; i < h_k_truss_edges.size(); ++i) {
+        ASSERT_TRUE(h_k_truss_edges[i] == std::make_tuple(h_reference_srcs[i], h_reference_dsts[i]))
+          << "Edges with the truss number of " << k_truss_usecase.k_
+          << " or larger do not coincide with the K-Truss edges.";
+      }
+
       if (edge_weight) {
         auto h_cugraph_wgts  = cugraph::test::to_host(handle, d_sorted_cugraph_wgts);
         auto compare_functor = host_nearly_equal<weight_t>{
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+struct LabelPropagation_Usecase {
+  bool semi_synchronous{false};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_LabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_LabelPropagation() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, label_propagation_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    size_t constexpr max_iterations{1000};
+
+    rmm::device_uvector<vertex_t> d_labels(graph_view.number_of_vertices(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Label propagation");
+    }
+
+    auto num_iterations = cugraph::label_propagation(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<vertex_t>(d_labels.data(), d_labels.size()),
+      false,
+      label_propagation_usecase.semi_synchronous,
+      max_iterations);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (label_propagation_usecase.check_correctness) {
+      // synchronous updates may oscillate, check only the converged results
+      if (label_propagation_usecase.semi_synchronous) {
+        ASSERT_TRUE(num_iterations < max_iterations)
+          << "Semi-synchronous label propagation should converge.";
+      }
+      if (num_iterations == max_iterations) { return; }
+
+      auto h_labels = cugraph::test::to_host(handle, d_labels);
+
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        edge_weight_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+      auto h_wgts = d_wgts ? cugraph::test::to_host(handle, *d_wgts)
+                           : std::vector<weight_t>(h_srcs.size(), weight_t{1});
+
+      // at convergence, every vertex holds (one of) the label(s) with the largest sum of edge
+      // weights among its neighbors' labels
+
+      std::vector<std::map<vertex_t, double>> label_weights(h_labels.size());
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        label_weights[h_srcs[i]][h_labels[h_dsts[i]]] += static_cast<double>(h_wgts[i]);
+      }
+      for (size_t v = 0; v < label_weights.size(); ++v) {
+        if (label_weights[v].empty()) { continue; }
+        double max_weight{0.0};
+        for (auto const& pair : label_weights[v]) {
+          max_weight = std::max(max_weight, pair.second);
+        }
+        auto it = label_weights[v].find(h_labels[v]);
+        ASSERT_TRUE(it != label_weights[v].end())
+          << "Vertex " << v << "'s label does not appear in its neighborhood.";
+        ASSERT_TRUE(it->second >= max_weight * (1.0 - 1e-4))
+          << "Vertex " << v << "'s label is not the most heavily weighted label in its "
+          << "neighborhood.";
+      }
+
+      // warm starting from the converged labels should not change any label
+
+      num_iterations = cugraph::label_propagation(
+        handle,
+        rng_state,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<vertex_t>(d_labels.data(), d_labels.size()),
+        true,
+        label_propagation_usecase.semi_synchronous,
+        max_iterations,
+        true);
+      ASSERT_EQ(num_iterations, size_t{1});
+      auto h_warm_start_labels = cugraph::test::to_host(handle, d_labels);
+      ASSERT_TRUE(std::equal(h_labels.begin(), h_labels.end(), h_warm_start_labels.begin()))
+        << "Warm starting from the converged labels should not change the labels.";
+    }
+  }
+};
+
+using Tests_LabelPropagation_File = Tests_LabelPropagation<cugraph::test::File_Usecase>;
+using Tests_LabelPropagation_Rmat = Tests_LabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_LabelPropagation_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_LabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{false, false},
+                      LabelPropagation_Usecase{false, true},
+                      LabelPropagation_Usecase{true, false},
+                      LabelPropagation_Usecase{true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{false, false}, LabelPropagation_Usecase{true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(LabelPropagation_Usecase{false, false, false},
+                      LabelPropagation_Usecase{true, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
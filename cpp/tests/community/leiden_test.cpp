@@ -36,6 +36,10 @@ struct Leiden_Usecase {
   bool check_correctness_{false};
   int expected_level_{0};
   float expected_modularity_{0};
+  cugraph::leiden_refinement_method_t refinement_method_{
+    cugraph::leiden_refinement_method_t::maximal_independent_moves};
+  // checked even if check_correctness_ is false (the results vary with the random seed)
+  float min_modularity_{std::numeric_limits<float>::lowest()};
 };
 
 template <typename input_usecase_t>
@@ -92,7 +96,9 @@ class Tests_Leiden : public ::testing::TestWithParam<std::tuple<Leiden_Usecase,
            leiden_usecase.resolution_,
            leiden_usecase.check_correctness_,
            leiden_usecase.expected_level_,
-           leiden_usecase.expected_modularity_);
+           leiden_usecase.expected_modularity_,
+           leiden_usecase.min_modularity_,
+           leiden_usecase.refinement_method_);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -110,7 +116,9 @@ class Tests_Leiden : public ::testing::TestWithParam<std::tuple<Leiden_Usecase,
     float resolution,
     bool check_correctness,
     int expected_level,
-    float expected_modularity)
+    float expected_modularity,
+    float min_modularity,
+    cugraph::leiden_refinement_method_t refinement_method)
   {
     raft::handle_t handle{};
 
@@ -120,8 +128,26 @@ class Tests_Leiden : public ::testing::TestWithParam<std::tuple<Leiden_Usecase,
     unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
     raft::random::RngState rng_state(seed);
 
-    std::tie(level, modularity) = cugraph::leiden(
-      handle, rng_state, graph_view, edge_weight_view, clustering_v.data(), max_level, resolution);
+    if (refinement_method == cugraph::leiden_refinement_method_t::maximal_independent_moves) {
+      std::tie(level, modularity) = cugraph::leiden(handle,
+                                                    rng_state,
+                                                    graph_view,
+                                                    edge_weight_view,
+                                                    clustering_v.data(),
+                                                    max_level,
+                                                    resolution);
+    } else {
+      std::tie(level, modularity) = cugraph::leiden(handle,
+                                                    rng_state,
+                                                    graph_view,
+                                                    edge_weight_view,
+                                                    clustering_v.data(),
+                                                    max_level,
+                                                    static_cast<weight_t>(resolution),
+                                                    weight_t{1},
+                                                    false,
+                                                    refinement_method);
+    }
 
     float compare_modularity = static_cast<float>(modularity);
 
@@ -129,6 +155,7 @@ class Tests_Leiden : public ::testing::TestWithParam<std::tuple<Leiden_Usecase,
       ASSERT_FLOAT_EQ(compare_modularity, expected_modularity);
       ASSERT_EQ(level, expected_level);
     }
+    ASSERT_GE(compare_modularity, min_modularity);
 
     auto unique_clustering_v = cugraph::test::sort<vertex_t>(handle, clustering_v);
 
@@ -211,8 +238,16 @@ TEST_P(Tests_Leiden_Rmat64, CheckInt64Int64FloatFloat)
 INSTANTIATE_TEST_SUITE_P(
   simple_test,
   Tests_Leiden_File,
-  ::testing::Combine(::testing::Values(Leiden_Usecase{100, 1, false, 3, 0.408695}),
-                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+  ::testing::Combine(
+    ::testing::Values(Leiden_Usecase{100, 1, false, 3, 0.408695},
+                      Leiden_Usecase{100,
+                                     1,
+                                     false,
+                                     0,
+                                     0,
+                                     cugraph::leiden_refinement_method_t::color_classes,
+                                     0.40}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   file_benchmark_test, /* note that the test filename can be overridden in benchmarking (with
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.  All rights reserved.
  *
  * NVIDIA CORPORATION and its licensors retain all intellectual property
  * and proprietary rights in and to this software, related documentation
@@ -37,6 +37,7 @@ struct Louvain_Usecase {
   bool check_correctness_{false};
   int expected_level_{0};
   float expected_modularity_{0};
+  bool prune_inactive_vertices_{false};
 };
 
 template <typename input_usecase_t>
@@ -95,7 +96,8 @@ class Tests_Louvain
             louvain_usecase.resolution_,
             louvain_usecase.check_correctness_,
             louvain_usecase.expected_level_,
-            louvain_usecase.expected_modularity_);
+            louvain_usecase.expected_modularity_,
+            louvain_usecase.prune_inactive_vertices_);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -114,7 +116,8 @@ class Tests_Louvain
     std::optional<double> resolution,
     bool check_correctness,
     int expected_level,
-    float expected_modularity)
+    float expected_modularity,
+    bool prune_inactive_vertices)
   {
     raft::handle_t handle{};
 
@@ -122,7 +125,18 @@ class Tests_Louvain
     size_t level;
     weight_t modularity;
 
-    if (resolution) {
+    if (prune_inactive_vertices) {
+      std::tie(level, modularity) = cugraph::louvain(
+        handle,
+        std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+        graph_view,
+        edge_weight_view,
+        clustering_v.data(),
+        max_level ? *max_level : size_t{100},
+        threshold ? static_cast<weight_t>(*threshold) : weight_t{1e-7},
+        resolution ? static_cast<weight_t>(*resolution) : weight_t{1},
+        true);
+    } else if (resolution) {
       std::tie(level, modularity) = cugraph::louvain(
         handle,
         std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
@@ -163,8 +177,106 @@ class Tests_Louvain
     float compare_modularity = static_cast<float>(modularity);
 
     if (check_correctness) {
-      ASSERT_FLOAT_EQ(compare_modularity, expected_modularity);
-      ASSERT_EQ(level, expected_level);
+      if (prune_inactive_vertices) {
+        // pruning changes the order of the moves, so the clustering may differ slightly
+        ASSERT_NEAR(compare_modularity, expected_modularity, 0.02);
+      } else {
+        ASSERT_FLOAT_EQ(compare_modularity, expected_modularity);
+        ASSERT_EQ(level, expected_level);
+
+        // the flat clustering is folded level by level, this should match with flattening every
+        // level of the dendrogram at the end
+        auto [dendrogram, dendrogram_modularity] = cugraph::louvain(
+          handle,
+          std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+          graph_view,
+          edge_weight_view,
+          max_level ? *max_level : size_t{100},
+          threshold ? static_cast<weight_t>(*threshold) : weight_t{1e-7},
+          resolution ? static_cast<weight_t>(*resolution) : weight_t{1});
+        ASSERT_EQ(dendrogram->num_levels(), level);
+        ASSERT_FLOAT_EQ(static_cast<float>(dendrogram_modularity), compare_modularity);
+
+        rmm::device_uvector<vertex_t> flattened_clustering_v(num_vertices, handle.get_stream());
+        cugraph::flatten_dendrogram(handle, graph_view, *dendrogram, flattened_clustering_v.data());
+        ASSERT_TRUE(cugraph::test::to_host(handle, clustering_v) ==
+                    cugraph::test::to_host(handle, flattened_clustering_v))
+          << "The folded clustering does not match with the flattened dendrogram.";
+      }
+
+      // resume from the state checkpointed after the first level
+      std::optional<rmm::device_uvector<vertex_t>> d_checkpoint_clustering{std::nullopt};
+      weight_t checkpoint_modularity{};
+      cugraph::clustering_checkpoint_options_t<vertex_t, weight_t> checkpoint_options{
+        size_t{1},
+        [&handle, &d_checkpoint_clustering, &checkpoint_modularity](
+          cugraph::clustering_checkpoint_view_t<vertex_t, weight_t> const& state) {
+          if (state.num_levels == 1) {
+            d_checkpoint_clustering =
+              rmm::device_uvector<vertex_t>(state.clustering.size(), handle.get_stream());
+            raft::copy(d_checkpoint_clustering->data(),
+                       state.clustering.data(),
+                       state.clustering.size(),
+                       handle.get_stream());
+            checkpoint_modularity = state.modularity;
+          }
+        }};
+
+      auto louvain_with_checkpoint =
+        [&](std::optional<cugraph::clustering_checkpoint_view_t<vertex_t, weight_t>> resume_state) {
+          return cugraph::louvain(
+            handle,
+            std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+            graph_view,
+            edge_weight_view,
+            clustering_v.data(),
+            max_level ? *max_level : size_t{100},
+            threshold ? static_cast<weight_t>(*threshold) : weight_t{1e-7},
+            resolution ? static_cast<weight_t>(*resolution) : weight_t{1},
+            prune_inactive_vertices,
+            checkpoint_options,
+            resume_state);
+        };
+
+      std::tie(level, modularity) = louvain_with_checkpoint(std::nullopt);
+      ASSERT_NEAR(static_cast<float>(modularity), expected_modularity, 0.02);
+
+      if (d_checkpoint_clustering) {
+        std::tie(level, modularity) =
+          louvain_with_checkpoint(cugraph::clustering_checkpoint_view_t<vertex_t, weight_t>{
+            size_t{1},
+            checkpoint_modularity,
+            raft::device_span<vertex_t const>{d_checkpoint_clustering->data(),
+                                              d_checkpoint_clustering->size()},
+            std::nullopt});
+
+        // the coarsened graph vertices are numbered differently in the resumed run, so the moves
+        // in the later levels may be visited in a different order
+        ASSERT_NEAR(static_cast<float>(modularity), expected_modularity, 0.02);
+        ASSERT_TRUE(level >= 1);
+      }
+
+      // warm start from the previous result, the cluster IDs do not need to be vertex IDs
+      auto h_initial_clustering = cugraph::test::to_host(handle, clustering_v);
+      std::transform(h_initial_clustering.begin(),
+                     h_initial_clustering.end(),
+                     h_initial_clustering.begin(),
+                     [](vertex_t c) { return c * 2 + 1; });
+      auto initial_clustering_v = cugraph::test::to_device(handle, h_initial_clustering);
+
+      std::tie(level, modularity) = cugraph::louvain(
+        handle,
+        std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+        graph_view,
+        edge_weight_view,
+        raft::device_span<vertex_t const>{initial_clustering_v.data(),
+                                          initial_clustering_v.size()},
+        clustering_v.data(),
+        max_level ? *max_level : size_t{100},
+        threshold ? static_cast<weight_t>(*threshold) : weight_t{1e-7},
+        resolution ? static_cast<weight_t>(*resolution) : weight_t{1});
+
+      ASSERT_TRUE(static_cast<float>(modularity) >= expected_modularity - 0.02);
     }
   }
 };
@@ -239,7 +351,9 @@ INSTANTIATE_TEST_SUITE_P(
                        Louvain_Usecase{
                          std::nullopt, std::nullopt, std::nullopt, true, 3, 0.39907956},
                        Louvain_Usecase{20, double{1e-3}, std::nullopt, true, 3, 0.39907956},
-                       Louvain_Usecase{100, double{1e-3}, double{0.8}, true, 3, 0.47547662}),
+                       Louvain_Usecase{100, double{1e-3}, double{0.8}, true, 3, 0.47547662},
+                       Louvain_Usecase{
+                         std::nullopt, std::nullopt, std::nullopt, true, 3, 0.39907956, true}),
                      ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "community/detail/common_methods.hpp"
+#include "detail/graph_partition_utils.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+struct ClusterPlacement_Usecase {
+  size_t num_local_vertices{0};  // per GPU
+  size_t num_clusters{0};
+  double local_fraction{0.0};  // fraction of the vertices in clusters preferred by their GPUs
+  uint64_t seed{0};
+};
+
+// relabel_clusters_to_majority_gpus should move every cluster to the GPU holding the most of its
+// members (ties go to the lower rank) while keeping the partition of the vertices unchanged
+class Tests_MGClusterPlacement : public ::testing::TestWithParam<ClusterPlacement_Usecase> {
+ public:
+  Tests_MGClusterPlacement() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t>
+  void run_current_test(ClusterPlacement_Usecase const& usecase)
+  {
+    auto& comm                 = handle_->get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto const major_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::major_comm_name()).get_size();
+    auto const minor_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size();
+
+    auto vertex_to_gpu_id_op = cugraph::detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{
+      comm_size, major_comm_size, minor_comm_size};
+
+    // 1. create the local labels, cluster c has ID c * 7 + 3 (so the IDs are non-contiguous) and
+    // local_fraction of the vertices go to the clusters c with c % comm_size == comm_rank (so most
+    // clusters have a clear majority GPU)
+
+    std::mt19937_64 gen(usecase.seed + comm_rank);
+    std::uniform_real_distribution<double> fraction_distribution(0.0, 1.0);
+    std::uniform_int_distribution<size_t> cluster_distribution(0, usecase.num_clusters - 1);
+
+    std::vector<vertex_t> h_labels(usecase.num_local_vertices);
+    for (size_t i = 0; i < h_labels.size(); ++i) {
+      auto c = cluster_distribution(gen);
+      if (fraction_distribution(gen) < usecase.local_fraction) {
+        c = (c / comm_size) * comm_size + comm_rank;
+        if (c >= usecase.num_clusters) { c = comm_rank % usecase.num_clusters; }
+      }
+      h_labels[i] = static_cast<vertex_t>(c * 7 + 3);
+    }
+    auto d_labels = cugraph::test::to_device(*handle_, h_labels);
+
+    auto d_aggregate_old_labels = cugraph::test::device_gatherv(
+      *handle_, raft::device_span<vertex_t const>(d_labels.data(), d_labels.size()));
+    auto h_aggregate_sizes =
+      cugraph::host_scalar_allgather(comm, h_labels.size(), handle_->get_stream());
+
+    // 2. relabel
+
+    auto [old_clusters, new_clusters] =
+      cugraph::detail::relabel_clusters_to_majority_gpus<vertex_t, true>(
+        *handle_, raft::device_span<vertex_t>(d_labels.data(), d_labels.size()));
+
+    // 3. every (old cluster ID, new cluster ID) pair should be stored in the GPU owning the new
+    // cluster ID
+
+    ASSERT_EQ(old_clusters.size(), new_clusters.size());
+    auto h_new_clusters = cugraph::test::to_host(*handle_, new_clusters);
+    for (auto c : h_new_clusters) {
+      ASSERT_EQ(vertex_to_gpu_id_op(c), comm_rank)
+        << "A new cluster ID (" << c << ") is stored in a GPU not owning it.";
+    }
+
+    auto d_aggregate_new_labels = cugraph::test::device_gatherv(
+      *handle_, raft::device_span<vertex_t const>(d_labels.data(), d_labels.size()));
+
+    if (comm_rank == 0) {
+      auto h_aggregate_old_labels = cugraph::test::to_host(*handle_, d_aggregate_old_labels);
+      auto h_aggregate_new_labels = cugraph::test::to_host(*handle_, d_aggregate_new_labels);
+      ASSERT_EQ(h_aggregate_old_labels.size(), h_aggregate_new_labels.size());
+
+      // 4. the relabeling should be one-to-one
+
+      std::map<vertex_t, vertex_t> old_to_new{};
+      std::set<vertex_t> new_labels{};
+      for (size_t i = 0; i < h_aggregate_old_labels.size(); ++i) {
+        auto [it, inserted] =
+          old_to_new.insert({h_aggregate_old_labels[i], h_aggregate_new_labels[i]});
+        ASSERT_EQ(it->second, h_aggregate_new_labels[i])
+          << "Members of cluster " << h_aggregate_old_labels[i] << " got different new IDs.";
+        if (inserted) {
+          ASSERT_TRUE(new_labels.insert(h_aggregate_new_labels[i]).second)
+            << "Multiple clusters got the same new ID (" << h_aggregate_new_labels[i] << ").";
+        }
+      }
+
+      // 5. every new cluster ID should be owned by the GPU holding the most members of the
+      // cluster (ties go to the lower rank)
+
+      std::map<vertex_t, std::vector<size_t>> member_counts{};  // old cluster ID => counts per GPU
+      size_t offset{0};
+      for (int r = 0; r < comm_size; ++r) {
+        for (size_t i = offset; i < offset + h_aggregate_sizes[r]; ++i) {
+          auto& counts = member_counts[h_aggregate_old_labels[i]];
+          counts.resize(comm_size, size_t{0});
+          ++counts[r];
+        }
+        offset += h_aggregate_sizes[r];
+      }
+
+      for (auto const& [old_label, counts] : member_counts) {
+        auto majority_rank = static_cast<int>(std::distance(
+          counts.begin(), std::max_element(counts.begin(), counts.end())));  // first max
+        ASSERT_EQ(vertex_to_gpu_id_op(old_to_new[old_label]), majority_rank)
+          << "Cluster " << old_label << " (new ID " << old_to_new[old_label]
+          << ") is not owned by its majority GPU.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+std::unique_ptr<raft::handle_t> Tests_MGClusterPlacement::handle_ = nullptr;
+
+struct ClusterPlacementClustering_Usecase {
+  size_t max_level{100};
+  double threshold{1e-7};
+  double resolution{1.0};
+  double theta{1.0};
+};
+
+// Louvain and Leiden with cluster_placement_t::majority should find clusterings as good as the
+// clusterings with the default (hash) placement (cluster IDs break ties in the cluster moves, so
+// the clusterings may slightly differ)
+template <typename input_usecase_t>
+class Tests_MGClusterPlacementClustering
+  : public ::testing::TestWithParam<
+      std::tuple<ClusterPlacementClustering_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGClusterPlacementClustering() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown()
+  {
+    cugraph::set_cluster_placement_hint(*handle_, cugraph::cluster_placement_t::hash);
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(
+    std::tuple<ClusterPlacementClustering_Usecase const&, input_usecase_t const&> const& param)
+  {
+    auto [clustering_usecase, input_usecase] = param;
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+
+    auto [mg_graph, mg_edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, true, true);
+
+    auto mg_graph_view = mg_graph.view();
+    auto mg_edge_weight_view =
+      mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
+
+    uint64_t seed{0};
+
+    std::vector<weight_t> louvain_modularities{};
+    std::vector<weight_t> leiden_modularities{};
+    for (auto placement :
+         {cugraph::cluster_placement_t::hash, cugraph::cluster_placement_t::majority}) {
+      cugraph::set_cluster_placement_hint(*handle_, placement);
+      ASSERT_EQ(cugraph::get_cluster_placement_hint(*handle_), placement);
+
+      auto [louvain_dendrogram, louvain_modularity] =
+        cugraph::louvain<vertex_t, edge_t, weight_t, true>(
+          *handle_,
+          std::optional<std::reference_wrapper<raft::random::RngState>>{std::nullopt},
+          mg_graph_view,
+          mg_edge_weight_view,
+          clustering_usecase.max_level,
+          static_cast<weight_t>(clustering_usecase.threshold),
+          static_cast<weight_t>(clustering_usecase.resolution));
+      louvain_modularities.push_back(louvain_modularity);
+
+      raft::random::RngState rng_state(seed);
+      auto [leiden_dendrogram, leiden_modularity] =
+        cugraph::leiden<vertex_t, edge_t, weight_t, true>(
+          *handle_,
+          rng_state,
+          mg_graph_view,
+          mg_edge_weight_view,
+          clustering_usecase.max_level,
+          static_cast<weight_t>(clustering_usecase.resolution),
+          static_cast<weight_t>(clustering_usecase.theta));
+      leiden_modularities.push_back(leiden_modularity);
+    }
+
+    if (comm_rank == 0) {
+      EXPECT_NEAR(louvain_modularities[1],
+                  louvain_modularities[0],
+                  std::max(louvain_modularities[0], louvain_modularities[1]) * 1e-2)
+        << "Louvain modularity with the majority placement differs from the hash placement.";
+      EXPECT_NEAR(leiden_modularities[1],
+                  leiden_modularities[0],
+                  std::max(leiden_modularities[0], leiden_modularities[1]) * 1e-2)
+        << "Leiden modularity with the majority placement differs from the hash placement.";
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGClusterPlacementClustering<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGClusterPlacementClustering_File =
+  Tests_MGClusterPlacementClustering<cugraph::test::File_Usecase>;
+using Tests_MGClusterPlacementClustering_Rmat =
+  Tests_MGClusterPlacementClustering<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGClusterPlacement, CheckInt32) { run_current_test<int32_t>(GetParam()); }
+
+TEST_P(Tests_MGClusterPlacement, CheckInt64) { run_current_test<int64_t>(GetParam()); }
+
+TEST_P(Tests_MGClusterPlacementClustering_File, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MGClusterPlacementClustering_File, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MGClusterPlacementClustering_Rmat, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_MGClusterPlacement,
+                         ::testing::Values(ClusterPlacement_Usecase{1024, 64, 0.8, 0},
+                                           ClusterPlacement_Usecase{1024, 64, 0.0, 1},
+                                           // many ties (few members per cluster)
+                                           ClusterPlacement_Usecase{256, 512, 0.5, 2},
+                                           ClusterPlacement_Usecase{16384, 4096, 0.9, 3}));
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGClusterPlacementClustering_File,
+  ::testing::Combine(::testing::Values(ClusterPlacementClustering_Usecase{}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGClusterPlacementClustering_Rmat,
+  ::testing::Combine(
+    ::testing::Values(ClusterPlacementClustering_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct ClusteringCoefficient_Usecase {
+  size_t num_wedge_samples_per_vertex{256};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGClusteringCoefficient
+  : public ::testing::TestWithParam<std::tuple<ClusteringCoefficient_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGClusteringCoefficient() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running clustering coefficient on multiple GPUs to that of a single-GPU
+  // run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(ClusteringCoefficient_Usecase const& clustering_coefficient_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, true>(
+        *handle_, input_usecase, false, true, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG Clustering coefficient");
+    }
+
+    auto [d_mg_coefficients, mg_transitivity, mg_average_coefficient] =
+      cugraph::clustering_coefficient(*handle_, mg_graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    raft::random::RngState rng_state(handle_->get_comms().get_rank());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG Approximate clustering coefficient");
+    }
+
+    auto [d_mg_approximate_coefficients,
+          d_mg_standard_errors,
+          mg_approximate_transitivity,
+          mg_transitivity_standard_error] =
+      cugraph::approximate_clustering_coefficient(
+        *handle_,
+        rng_state,
+        mg_graph_view,
+        clustering_coefficient_usecase.num_wedge_samples_per_vertex);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (clustering_coefficient_usecase.check_correctness) {
+      // 1. gather the results and the graph (in MG vertex IDs)
+
+      auto d_coefficients = cugraph::test::device_gatherv(
+        *handle_,
+        raft::device_span<double const>(d_mg_coefficients.data(), d_mg_coefficients.size()));
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+      std::tie(sg_graph, std::ignore, std::ignore, std::ignore, std::ignore) =
+        cugraph::test::mg_graph_to_sg_graph(
+          *handle_,
+          mg_graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+          false);
+
+      if (handle_->get_comms().get_rank() == 0) {
+        // 2. run SG clustering coefficient
+
+        auto sg_graph_view = sg_graph.view();
+
+        auto [d_sg_coefficients, sg_transitivity, sg_average_coefficient] =
+          cugraph::clustering_coefficient(*handle_, sg_graph_view);
+
+        // 3. compare
+
+        auto nearly_equal = [](double lhs, double rhs) {
+          return std::abs(lhs - rhs) <= std::max(std::abs(lhs), std::abs(rhs)) * 1e-6 + 1e-12;
+        };
+
+        auto h_mg_coefficients = cugraph::test::to_host(*handle_, d_coefficients);
+        auto h_sg_coefficients = cugraph::test::to_host(*handle_, d_sg_coefficients);
+        ASSERT_TRUE(std::equal(h_mg_coefficients.begin(),
+                               h_mg_coefficients.end(),
+                               h_sg_coefficients.begin(),
+                               nearly_equal))
+          << "MG and SG local clustering coefficients do not match.";
+        ASSERT_TRUE(nearly_equal(mg_transitivity, sg_transitivity))
+          << "MG and SG transitivities do not match.";
+        ASSERT_TRUE(nearly_equal(mg_average_coefficient, sg_average_coefficient))
+          << "MG and SG average clustering coefficients do not match.";
+
+        // the samples differ from an SG run, so check the MG estimate against the exact value
+        ASSERT_TRUE(std::abs(mg_approximate_transitivity - sg_transitivity) <=
+                    4.0 * mg_transitivity_standard_error + 1e-2)
+          << "MG approximate transitivity (" << mg_approximate_transitivity << " +/- "
+          << mg_transitivity_standard_error << ") is too far from the exact value ("
+          << sg_transitivity << ").";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGClusteringCoefficient<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGClusteringCoefficient_File =
+  Tests_MGClusteringCoefficient<cugraph::test::File_Usecase>;
+using Tests_MGClusteringCoefficient_Rmat =
+  Tests_MGClusteringCoefficient<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGClusteringCoefficient_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGClusteringCoefficient_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGClusteringCoefficient_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGClusteringCoefficient_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClusteringCoefficient_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGClusteringCoefficient_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ClusteringCoefficient_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGClusteringCoefficient_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ClusteringCoefficient_Usecase{64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
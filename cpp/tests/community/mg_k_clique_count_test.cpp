@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct KCliqueCount_Usecase {
+  size_t k{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGKCliqueCount
+  : public ::testing::TestWithParam<std::tuple<KCliqueCount_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGKCliqueCount() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running k-clique count on multiple GPUs to that of a single-GPU run
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(KCliqueCount_Usecase const& k_clique_count_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, true>(
+        *handle_, input_usecase, false, true, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG K-clique count");
+    }
+
+    auto [mg_num_cliques, d_mg_vertex_counts, mg_edge_counts] =
+      cugraph::k_clique_count(*handle_, mg_graph_view, k_clique_count_usecase.k, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (k_clique_count_usecase.check_correctness) {
+      // 1. gather the results and the graph (in MG vertex IDs)
+
+      auto d_vertex_counts = cugraph::test::device_gatherv(
+        *handle_,
+        raft::device_span<edge_t const>((*d_mg_vertex_counts).data(),
+                                        (*d_mg_vertex_counts).size()));
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+      std::tie(sg_graph, std::ignore, std::ignore, std::ignore, std::ignore) =
+        cugraph::test::mg_graph_to_sg_graph(
+          *handle_,
+          mg_graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+          false);
+
+      if (handle_->get_comms().get_rank() == 0) {
+        // 2. run SG k-clique count
+
+        auto sg_graph_view = sg_graph.view();
+
+        auto [sg_num_cliques, d_sg_vertex_counts, sg_edge_counts] =
+          cugraph::k_clique_count(*handle_, sg_graph_view, k_clique_count_usecase.k, true);
+
+        // 3. compare
+
+        ASSERT_EQ(mg_num_cliques, sg_num_cliques) << "MG and SG k-clique counts do not match.";
+
+        auto h_mg_vertex_counts = cugraph::test::to_host(*handle_, d_vertex_counts);
+        auto h_sg_vertex_counts = cugraph::test::to_host(*handle_, *d_sg_vertex_counts);
+        ASSERT_TRUE(std::equal(
+          h_mg_vertex_counts.begin(), h_mg_vertex_counts.end(), h_sg_vertex_counts.begin()))
+          << "MG and SG per-vertex k-clique counts do not match.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGKCliqueCount<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGKCliqueCount_File = Tests_MGKCliqueCount<cugraph::test::File_Usecase>;
+using Tests_MGKCliqueCount_Rmat = Tests_MGKCliqueCount<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGKCliqueCount_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGKCliqueCount_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGKCliqueCount_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGKCliqueCount_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KCliqueCount_Usecase{4}, KCliqueCount_Usecase{5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGKCliqueCount_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KCliqueCount_Usecase{4}, KCliqueCount_Usecase{5}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGKCliqueCount_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(KCliqueCount_Usecase{4, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+struct LabelPropagation_Usecase {
+  bool semi_synchronous{false};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGLabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGLabelPropagation() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, label_propagation_usecase.test_weighted, true);
+
+    auto mg_graph_view = mg_graph.view();
+    auto mg_edge_weight_view =
+      mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(handle_->get_comms().get_rank());
+
+    size_t constexpr max_iterations{1000};
+
+    rmm::device_uvector<vertex_t> d_mg_labels(mg_graph_view.local_vertex_partition_range_size(),
+                                              handle_->get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG Label propagation");
+    }
+
+    auto num_iterations = cugraph::label_propagation(
+      *handle_,
+      rng_state,
+      mg_graph_view,
+      mg_edge_weight_view,
+      raft::device_span<vertex_t>(d_mg_labels.data(), d_mg_labels.size()),
+      false,
+      label_propagation_usecase.semi_synchronous,
+      max_iterations);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (label_propagation_usecase.check_correctness) {
+      // synchronous updates may oscillate, check only the converged results
+      if (label_propagation_usecase.semi_synchronous) {
+        ASSERT_TRUE(num_iterations < max_iterations)
+          << "Semi-synchronous label propagation should converge.";
+      }
+      if (num_iterations == max_iterations) { return; }
+
+      // 1. warm starting from the converged labels should not change any label
+
+      rmm::device_uvector<vertex_t> d_mg_warm_start_labels(d_mg_labels.size(),
+                                                           handle_->get_stream());
+      raft::copy(d_mg_warm_start_labels.data(),
+                 d_mg_labels.data(),
+                 d_mg_labels.size(),
+                 handle_->get_stream());
+      num_iterations = cugraph::label_propagation(
+        *handle_,
+        rng_state,
+        mg_graph_view,
+        mg_edge_weight_view,
+        raft::device_span<vertex_t>(d_mg_warm_start_labels.data(), d_mg_warm_start_labels.size()),
+        true,
+        label_propagation_usecase.semi_synchronous,
+        max_iterations,
+        true);
+      ASSERT_EQ(num_iterations, size_t{1});
+
+      // 2. gather the results and the graph (in MG vertex IDs)
+
+      auto d_labels = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(d_mg_labels.data(), d_mg_labels.size()));
+      auto d_warm_start_labels = cugraph::test::device_gatherv(
+        *handle_,
+        raft::device_span<vertex_t const>(d_mg_warm_start_labels.data(),
+                                          d_mg_warm_start_labels.size()));
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+        sg_edge_weights{std::nullopt};
+      std::tie(sg_graph, sg_edge_weights, std::ignore, std::ignore, std::ignore) =
+        cugraph::test::mg_graph_to_sg_graph(
+          *handle_,
+          mg_graph_view,
+          mg_edge_weight_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+          false);
+
+      if (handle_->get_comms().get_rank() == 0) {
+        auto sg_graph_view = sg_graph.view();
+        auto sg_edge_weight_view =
+          sg_edge_weights ? std::make_optional((*sg_edge_weights).view()) : std::nullopt;
+
+        auto h_labels            = cugraph::test::to_host(*handle_, d_labels);
+        auto h_warm_start_labels = cugraph::test::to_host(*handle_, d_warm_start_labels);
+        ASSERT_TRUE(std::equal(h_labels.begin(), h_labels.end(), h_warm_start_labels.begin()))
+          << "Warm starting from the converged labels should not change the labels.";
+
+        auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+          *handle_,
+          sg_graph_view,
+          sg_edge_weight_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+        auto h_srcs = cugraph::test::to_host(*handle_, d_srcs);
+        auto h_dsts = cugraph::test::to_host(*handle_, d_dsts);
+        auto h_wgts = d_wgts ? cugraph::test::to_host(*handle_, *d_wgts)
+                             : std::vector<weight_t>(h_srcs.size(), weight_t{1});
+
+        // 3. at convergence, every vertex holds (one of) the label(s) with the largest sum of edge
+        // weights among its neighbors' labels
+
+        std::vector<std::map<vertex_t, double>> label_weights(h_labels.size());
+        for (size_t i = 0; i < h_srcs.size(); ++i) {
+          label_weights[h_srcs[i]][h_labels[h_dsts[i]]] += static_cast<double>(h_wgts[i]);
+        }
+        for (size_t v = 0; v < label_weights.size(); ++v) {
+          if (label_weights[v].empty()) { continue; }
+          double max_weight{0.0};
+          for (auto const& pair : label_weights[v]) {
+            max_weight = std::max(max_weight, pair.second);
+          }
+          auto it = label_weights[v].find(h_labels[v]);
+          ASSERT_TRUE(it != label_weights[v].end())
+            << "Vertex " << v << "'s label does not appear in its neighborhood.";
+          ASSERT_TRUE(it->second >= max_weight * (1.0 - 1e-4))
+            << "Vertex " << v << "'s label is not the most heavily weighted label in its "
+            << "neighborhood.";
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGLabelPropagation<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGLabelPropagation_File = Tests_MGLabelPropagation<cugraph::test::File_Usecase>;
+using Tests_MGLabelPropagation_Rmat = Tests_MGLabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGLabelPropagation_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGLabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{false, false},
+                      LabelPropagation_Usecase{true, false},
+                      LabelPropagation_Usecase{true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{false, false}, LabelPropagation_Usecase{true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(LabelPropagation_Usecase{true, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct MultilevelPartition_Usecase {
+  size_t num_partitions{2};
+  double imbalance_tolerance{0.03};
+  bool test_weighted{false};
+  double max_cut_edge_ratio{1.0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MultilevelPartition
+  : public ::testing::TestWithParam<std::tuple<MultilevelPartition_Usecase, input_usecase_t>> {
+ public:
+  Tests_MultilevelPartition() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MultilevelPartition_Usecase const& multilevel_partition_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::optional<cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>,
+                                           weight_t>>
+      edge_weights{std::nullopt};
+    std::tie(graph, edge_weights, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, multilevel_partition_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Multilevel partitioning works only on symmetric graphs.";
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Multilevel partition");
+    }
+
+    auto [d_partitions, edge_cut] =
+      cugraph::multilevel_partition(handle,
+                                    graph_view,
+                                    edge_weight_view,
+                                    multilevel_partition_usecase.num_partitions,
+                                    multilevel_partition_usecase.imbalance_tolerance,
+                                    size_t{20},
+                                    true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (multilevel_partition_usecase.check_correctness) {
+      auto num_partitions = multilevel_partition_usecase.num_partitions;
+
+      auto h_partitions = cugraph::test::to_host(handle, d_partitions);
+      ASSERT_EQ(h_partitions.size(), static_cast<size_t>(graph_view.number_of_vertices()));
+      ASSERT_TRUE(std::all_of(h_partitions.begin(), h_partitions.end(), [num_partitions](auto p) {
+        return (p >= 0) && (static_cast<size_t>(p) < num_partitions);
+      })) << "partition IDs should be in [0, num_partitions).";
+
+      std::vector<size_t> partition_sizes(num_partitions, 0);
+      for (auto p : h_partitions) {
+        ++partition_sizes[p];
+      }
+      auto max_partition_size = static_cast<size_t>(
+        std::ceil((1.0 + multilevel_partition_usecase.imbalance_tolerance) *
+                  static_cast<double>(h_partitions.size()) / static_cast<double>(num_partitions)));
+      ASSERT_LE(*std::max_element(partition_sizes.begin(), partition_sizes.end()),
+                max_partition_size)
+        << "the partitioning violates the balance constraint.";
+
+      auto [d_srcs, d_dsts, d_weights, d_ids, d_types] =
+        cugraph::decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t>(
+          handle,
+          graph_view,
+          edge_weight_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs    = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts    = cugraph::test::to_host(handle, d_dsts);
+      auto h_weights = d_weights ? cugraph::test::to_host(handle, *d_weights)
+                                 : std::vector<weight_t>(h_srcs.size(), weight_t{1});
+
+      size_t num_cut_edges{0};
+      double reference_edge_cut{0.0};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_partitions[h_srcs[i]] != h_partitions[h_dsts[i]]) {
+          ++num_cut_edges;
+          reference_edge_cut += static_cast<double>(h_weights[i]);
+        }
+      }
+      reference_edge_cut /= 2.0;  // every undirected edge is stored in both directions
+      ASSERT_NEAR(static_cast<double>(edge_cut),
+                  reference_edge_cut,
+                  std::max(reference_edge_cut, 1.0) * 1e-4)
+        << "the returned edge cut does not match with the reference value.";
+
+      auto cut_edge_ratio = static_cast<double>(num_cut_edges) /
+                            static_cast<double>(std::max(h_srcs.size(), size_t{1}));
+      ASSERT_LE(cut_edge_ratio, multilevel_partition_usecase.max_cut_edge_ratio)
+        << "the partitioning cuts more edges than expected.";
+    }
+  }
+};
+
+using Tests_MultilevelPartition_File = Tests_MultilevelPartition<cugraph::test::File_Usecase>;
+using Tests_MultilevelPartition_Rmat = Tests_MultilevelPartition<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MultilevelPartition_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultilevelPartition_File, CheckInt32Int32Double)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, double>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultilevelPartition_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultilevelPartition_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MultilevelPartition_File,
+  ::testing::Combine(
+    // enable correctness checks, a random balanced k-way partitioning cuts (1 - 1/k) of the edges
+    // in expectation
+    ::testing::Values(MultilevelPartition_Usecase{2, 0.03, false, 0.3},
+                      MultilevelPartition_Usecase{2, 0.03, true, 0.3},
+                      MultilevelPartition_Usecase{4, 0.05, false, 0.5},
+                      MultilevelPartition_Usecase{8, 0.1, false, 0.7}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MultilevelPartition_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MultilevelPartition_Usecase{4, 0.03, false, 0.75},
+                      MultilevelPartition_Usecase{16, 0.05, false, 0.94}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(12, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MultilevelPartition_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MultilevelPartition_Usecase{64, 0.03, false, 1.0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct SpectralClustering_Usecase {
+  size_t num_clusters{2};
+  size_t num_eigenvectors{2};
+  bool test_weighted{false};
+  double max_cut_edge_ratio{1.0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_SpectralClustering
+  : public ::testing::TestWithParam<std::tuple<SpectralClustering_Usecase, input_usecase_t>> {
+ public:
+  Tests_SpectralClustering() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SpectralClustering_Usecase const& spectral_clustering_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::optional<cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>,
+                                           weight_t>>
+      edge_weights{std::nullopt};
+    std::tie(graph, edge_weights, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, spectral_clustering_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Spectral clustering works only on symmetric graphs.";
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Spectral clustering");
+    }
+
+    auto d_clusters = cugraph::spectral_clustering(handle,
+                                                   rng_state,
+                                                   graph_view,
+                                                   edge_weight_view,
+                                                   spectral_clustering_usecase.num_clusters,
+                                                   spectral_clustering_usecase.num_eigenvectors,
+                                                   weight_t{1e-5},
+                                                   size_t{4000},
+                                                   weight_t{1e-4},
+                                                   size_t{200},
+                                                   true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (spectral_clustering_usecase.check_correctness) {
+      auto h_clusters = cugraph::test::to_host(handle, d_clusters);
+      ASSERT_EQ(h_clusters.size(), static_cast<size_t>(graph_view.number_of_vertices()));
+      ASSERT_TRUE(std::all_of(h_clusters.begin(),
+                              h_clusters.end(),
+                              [num_clusters = spectral_clustering_usecase.num_clusters](auto c) {
+                                return (c >= 0) && (static_cast<size_t>(c) < num_clusters);
+                              }))
+        << "cluster IDs should be in [0, num_clusters).";
+
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+
+      size_t num_cut_edges{0};
+      for (vertex_t u = 0; u < graph_view.number_of_vertices(); ++u) {
+        for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+          if (h_clusters[u] != h_clusters[h_indices[i]]) { ++num_cut_edges; }
+        }
+      }
+      auto cut_edge_ratio =
+        static_cast<double>(num_cut_edges) / static_cast<double>(h_indices.size());
+      ASSERT_LE(cut_edge_ratio, spectral_clustering_usecase.max_cut_edge_ratio)
+        << "the clustering cuts more edges than expected.";
+    }
+  }
+};
+
+using Tests_SpectralClustering_File = Tests_SpectralClustering<cugraph::test::File_Usecase>;
+using Tests_SpectralClustering_Rmat = Tests_SpectralClustering<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_SpectralClustering_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SpectralClustering_File, CheckInt32Int32DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, double>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_SpectralClustering_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_SpectralClustering_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SpectralClustering_Usecase{2, 2, false, 0.25},
+                      SpectralClustering_Usecase{2, 2, true, 0.25},
+                      SpectralClustering_Usecase{4, 4, false, 0.5}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_SpectralClustering_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(SpectralClustering_Usecase{16, 16, false, 1.0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
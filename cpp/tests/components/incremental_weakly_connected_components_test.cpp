@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+template <typename vertex_t>
+vertex_t find_reference_root(std::vector<vertex_t>& parents, vertex_t v)
+{
+  while (parents[v] != v) {
+    parents[v] = parents[parents[v]];
+    v          = parents[v];
+  }
+  return v;
+}
+
+// returns component IDs of the graph with the edges (srcs[i], dsts[i]) for which include[i] is true
+template <typename vertex_t>
+std::vector<vertex_t> incremental_weakly_connected_components_reference(
+  std::vector<vertex_t> const& srcs,
+  std::vector<vertex_t> const& dsts,
+  std::vector<bool> const& include,
+  vertex_t num_vertices)
+{
+  std::vector<vertex_t> parents(num_vertices);
+  std::iota(parents.begin(), parents.end(), vertex_t{0});
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    if (!include[i]) { continue; }
+    auto u = find_reference_root(parents, srcs[i]);
+    auto v = find_reference_root(parents, dsts[i]);
+    if (u != v) { parents[std::max(u, v)] = std::min(u, v); }
+  }
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    parents[v] = find_reference_root(parents, v);
+  }
+  return parents;
+}
+
+struct IncrementalWeaklyConnectedComponents_Usecase {
+  int32_t hash_bin_count{4};  // 1 / hash_bin_count of the edges are new
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_IncrementalWeaklyConnectedComponents
+  : public ::testing::TestWithParam<
+      std::tuple<IncrementalWeaklyConnectedComponents_Usecase, input_usecase_t>> {
+ public:
+  Tests_IncrementalWeaklyConnectedComponents() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(IncrementalWeaklyConnectedComponents_Usecase const& usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::tie(graph, std::ignore, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+
+    auto graph_view = graph.view();
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Weakly connected components works only on undirected (symmetric) graphs.";
+
+    auto num_vertices = graph_view.number_of_vertices();
+
+    // split the undirected edges (u, v) with u < v to the old edges and the new edges
+
+    auto h_offsets =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+    auto h_indices =
+      cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+        if (u < h_indices[i]) {
+          h_srcs.push_back(u);
+          h_dsts.push_back(h_indices[i]);
+        }
+      }
+    }
+    std::vector<bool> h_is_new(h_srcs.size());
+    std::vector<vertex_t> h_new_srcs{};
+    std::vector<vertex_t> h_new_dsts{};
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      h_is_new[i] = ((h_srcs[i] * 31 + h_dsts[i]) % usecase.hash_bin_count) == 0;
+      if (h_is_new[i]) {
+        h_new_srcs.push_back(h_srcs[i]);
+        h_new_dsts.push_back(h_dsts[i]);
+      }
+    }
+    std::vector<bool> h_is_old(h_is_new.size());
+    std::transform(h_is_new.begin(), h_is_new.end(), h_is_old.begin(), [](auto b) { return !b; });
+
+    auto d_components = cugraph::test::to_device(
+      handle,
+      incremental_weakly_connected_components_reference(h_srcs, h_dsts, h_is_old, num_vertices));
+    auto d_new_srcs = cugraph::test::to_device(handle, h_new_srcs);
+    auto d_new_dsts = cugraph::test::to_device(handle, h_new_dsts);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Incremental weakly connected components");
+    }
+
+    cugraph::incremental_weakly_connected_components(
+      handle,
+      graph_view,
+      raft::device_span<vertex_t const>(d_new_srcs.data(), d_new_srcs.size()),
+      raft::device_span<vertex_t const>(d_new_dsts.data(), d_new_dsts.size()),
+      raft::device_span<vertex_t>(d_components.data(), d_components.size()),
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (usecase.check_correctness) {
+      auto h_reference_components = incremental_weakly_connected_components_reference(
+        h_srcs, h_dsts, std::vector<bool>(h_srcs.size(), true), num_vertices);
+      auto h_cugraph_components = cugraph::test::to_host(handle, d_components);
+
+      // the two labelings should be identical up to a bijective renaming of the component IDs
+      std::unordered_map<vertex_t, vertex_t> cugraph_to_reference_map{};
+      std::unordered_map<vertex_t, vertex_t> reference_to_cugraph_map{};
+      for (size_t i = 0; i < h_reference_components.size(); ++i) {
+        auto [it0, inserted0] =
+          cugraph_to_reference_map.insert({h_cugraph_components[i], h_reference_components[i]});
+        auto [it1, inserted1] =
+          reference_to_cugraph_map.insert({h_reference_components[i], h_cugraph_components[i]});
+        ASSERT_TRUE((it0->second == h_reference_components[i]) &&
+                    (it1->second == h_cugraph_components[i]))
+          << "components do not match with the reference values.";
+      }
+    }
+  }
+};
+
+using Tests_IncrementalWeaklyConnectedComponents_File =
+  Tests_IncrementalWeaklyConnectedComponents<cugraph::test::File_Usecase>;
+using Tests_IncrementalWeaklyConnectedComponents_Rmat =
+  Tests_IncrementalWeaklyConnectedComponents<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_IncrementalWeaklyConnectedComponents_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_IncrementalWeaklyConnectedComponents_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{4},
+                      IncrementalWeaklyConnectedComponents_Usecase{64}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_IncrementalWeaklyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{4},
+                      IncrementalWeaklyConnectedComponents_Usecase{64}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_IncrementalWeaklyConnectedComponents_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(IncrementalWeaklyConnectedComponents_Usecase{64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
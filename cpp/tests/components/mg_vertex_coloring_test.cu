@@ -44,6 +44,8 @@
 
 struct GraphColoring_UseCase {
   bool check_correctness{true};
+  cugraph::vertex_coloring_method_t method{
+    cugraph::vertex_coloring_method_t::maximal_independent_set};
 };
 
 template <typename input_usecase_t>
@@ -89,8 +91,8 @@ class Tests_MGGraphColoring
       mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
 
     raft::random::RngState rng_state(multi_gpu ? handle_->get_comms().get_rank() : 0);
-    auto d_colors =
-      cugraph::vertex_coloring<vertex_t, edge_t, multi_gpu>(*handle_, mg_graph_view, rng_state);
+    auto d_colors = cugraph::vertex_coloring<vertex_t, edge_t, multi_gpu>(
+      *handle_, mg_graph_view, rng_state, coloring_usecase.method);
 
     // Test Graph Coloring
 
@@ -239,15 +241,21 @@ bool constexpr check_correctness = false;
 INSTANTIATE_TEST_SUITE_P(
   file_test,
   Tests_MGGraphColoring_File,
-  ::testing::Combine(::testing::Values(GraphColoring_UseCase{check_correctness},
-                                       GraphColoring_UseCase{check_correctness}),
-                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+  ::testing::Combine(
+    ::testing::Values(
+      GraphColoring_UseCase{check_correctness},
+      GraphColoring_UseCase{true, cugraph::vertex_coloring_method_t::speculative_first_fit},
+      GraphColoring_UseCase{true, cugraph::vertex_coloring_method_t::speculative_largest_first}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
   Tests_MGGraphColoring_Rmat,
   ::testing::Combine(
-    ::testing::Values(GraphColoring_UseCase{check_correctness}),
+    ::testing::Values(
+      GraphColoring_UseCase{check_correctness},
+      GraphColoring_UseCase{true, cugraph::vertex_coloring_method_t::speculative_first_fit},
+      GraphColoring_UseCase{true, cugraph::vertex_coloring_method_t::speculative_largest_first}),
     ::testing::Values(cugraph::test::Rmat_Usecase(3, 4, 0.57, 0.19, 0.19, 0, true, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governin_from_mtxg permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+void strongly_connected_components_reference(edge_t const* offsets,
+                                             vertex_t const* indices,
+                                             vertex_t* components,
+                                             vertex_t num_vertices)
+{
+  // iterative version of Tarjan's algorithm, component IDs are the smallest vertex IDs in each
+  // component
+
+  auto constexpr invalid_index = std::numeric_limits<vertex_t>::max();
+
+  std::vector<vertex_t> indices_(num_vertices, invalid_index);
+  std::vector<vertex_t> lowlinks(num_vertices, invalid_index);
+  std::vector<bool> on_stack(num_vertices, false);
+  std::vector<vertex_t> scc_stack{};
+  std::vector<std::tuple<vertex_t, edge_t>> call_stack{};  // (vertex, next neighbor offset)
+
+  std::fill(components, components + num_vertices, cugraph::invalid_component_id<vertex_t>::value);
+
+  vertex_t index{0};
+  for (vertex_t root = 0; root < num_vertices; ++root) {
+    if (indices_[root] != invalid_index) { continue; }
+    call_stack.push_back(std::make_tuple(root, offsets[root]));
+    indices_[root] = index;
+    lowlinks[root] = index;
+    ++index;
+    scc_stack.push_back(root);
+    on_stack[root] = true;
+
+    while (call_stack.size() > 0) {
+      auto [v, nbr_offset] = call_stack.back();
+      if (nbr_offset < offsets[v + 1]) {
+        std::get<1>(call_stack.back()) = nbr_offset + 1;
+        auto nbr                       = indices[nbr_offset];
+        if (indices_[nbr] == invalid_index) {
+          indices_[nbr] = index;
+          lowlinks[nbr] = index;
+          ++index;
+          scc_stack.push_back(nbr);
+          on_stack[nbr] = true;
+          call_stack.push_back(std::make_tuple(nbr, offsets[nbr]));
+        } else if (on_stack[nbr]) {
+          lowlinks[v] = std::min(lowlinks[v], indices_[nbr]);
+        }
+      } else {
+        call_stack.pop_back();
+        if (call_stack.size() > 0) {
+          auto parent      = std::get<0>(call_stack.back());
+          lowlinks[parent] = std::min(lowlinks[parent], lowlinks[v]);
+        }
+        if (lowlinks[v] == indices_[v]) {
+          auto first        = std::find(scc_stack.begin(), scc_stack.end(), v);
+          auto component_id = *std::min_element(first, scc_stack.end());
+          std::for_each(first, scc_stack.end(), [&](auto u) {
+            components[u] = component_id;
+            on_stack[u]   = false;
+          });
+          scc_stack.erase(first, scc_stack.end());
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+struct StronglyConnectedComponents_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_StronglyConnectedComponent
+  : public ::testing::TestWithParam<
+      std::tuple<StronglyConnectedComponents_Usecase, input_usecase_t>> {
+ public:
+  Tests_StronglyConnectedComponent() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(
+    StronglyConnectedComponents_Usecase const& strongly_connected_components_usecase,
+    input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::optional<rmm::device_uvector<vertex_t>> d_renumber_map_labels{std::nullopt};
+    std::tie(graph, std::ignore, d_renumber_map_labels) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<vertex_t> d_components(graph_view.number_of_vertices(),
+                                               handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Strongly_connected_components");
+    }
+
+    cugraph::strongly_connected_components(handle, graph_view, d_components.data());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (strongly_connected_components_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, false, false> unrenumbered_graph(handle);
+      if (renumber) {
+        std::tie(unrenumbered_graph, std::ignore, std::ignore) =
+          cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+            handle, input_usecase, false, false);
+      }
+      auto unrenumbered_graph_view = renumber ? unrenumbered_graph.view() : graph_view;
+
+      auto h_offsets = cugraph::test::to_host(
+        handle, unrenumbered_graph_view.local_edge_partition_view().offsets());
+      auto h_indices = cugraph::test::to_host(
+        handle, unrenumbered_graph_view.local_edge_partition_view().indices());
+
+      std::vector<vertex_t> h_reference_components(unrenumbered_graph_view.number_of_vertices());
+
+      strongly_connected_components_reference(h_offsets.data(),
+                                              h_indices.data(),
+                                              h_reference_components.data(),
+                                              unrenumbered_graph_view.number_of_vertices());
+
+      std::vector<vertex_t> h_cugraph_components{};
+      if (renumber) {
+        rmm::device_uvector<vertex_t> d_unrenumbered_components(size_t{0}, handle.get_stream());
+        std::tie(std::ignore, d_unrenumbered_components) =
+          cugraph::test::sort_by_key<vertex_t, vertex_t>(
+            handle, *d_renumber_map_labels, d_components);
+        h_cugraph_components = cugraph::test::to_host(handle, d_unrenumbered_components);
+      } else {
+        h_cugraph_components = cugraph::test::to_host(handle, d_components);
+      }
+
+      // the two labelings should define the same partition (i.e. a bijection between the
+      // component IDs should exist)
+      std::unordered_map<vertex_t, vertex_t> cuda_to_reference_map{};
+      std::unordered_map<vertex_t, vertex_t> reference_to_cuda_map{};
+      for (size_t i = 0; i < h_reference_components.size(); ++i) {
+        cuda_to_reference_map.insert({h_cugraph_components[i], h_reference_components[i]});
+        reference_to_cuda_map.insert({h_reference_components[i], h_cugraph_components[i]});
+      }
+      ASSERT_EQ(cuda_to_reference_map.size(), reference_to_cuda_map.size())
+        << "the number of components does not match with the reference.";
+      std::transform(
+        h_cugraph_components.begin(),
+        h_cugraph_components.end(),
+        h_cugraph_components.begin(),
+        [&cuda_to_reference_map](auto cugraph_c) { return cuda_to_reference_map[cugraph_c]; });
+
+      ASSERT_TRUE(std::equal(
+        h_reference_components.begin(), h_reference_components.end(), h_cugraph_components.begin()))
+        << "components do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_StronglyConnectedComponents_File =
+  Tests_StronglyConnectedComponent<cugraph::test::File_Usecase>;
+using Tests_StronglyConnectedComponents_Rmat =
+  Tests_StronglyConnectedComponent<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_StronglyConnectedComponents_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_StronglyConnectedComponents_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_StronglyConnectedComponents_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_StronglyConnectedComponents_File,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(StronglyConnectedComponents_Usecase{},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(StronglyConnectedComponents_Usecase{},
+                    cugraph::test::File_Usecase("test/datasets/cage6.mtx")),
+    std::make_tuple(StronglyConnectedComponents_Usecase{},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_StronglyConnectedComponents_Rmat,
+  ::testing::Values(
+    // enable correctness checks
+    std::make_tuple(StronglyConnectedComponents_Usecase{},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_StronglyConnectedComponents_Rmat,
+  ::testing::Values(
+    // disable correctness checks
+    std::make_tuple(StronglyConnectedComponents_Usecase{false},
+                    cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <vector>
 
 template <typename vertex_t, typename edge_t>
@@ -81,6 +82,7 @@ void weakly_connected_components_reference(edge_t const* offsets,
 
 struct WeaklyConnectedComponents_Usecase {
   bool check_correctness{true};
+  std::optional<size_t> num_sampled_neighbors{std::nullopt};
 };
 
 template <typename input_usecase_t>
@@ -137,7 +139,11 @@ class Tests_WeaklyConnectedComponent
       hr_timer.start("Weakly_connected_components");
     }
 
-    cugraph::weakly_connected_components(handle, graph_view, d_components.data());
+    cugraph::weakly_connected_components(handle,
+                                         graph_view,
+                                         d_components.data(),
+                                         false,
+                                         weakly_connected_components_usecase.num_sampled_neighbors);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -230,6 +236,10 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(WeaklyConnectedComponents_Usecase{},
                     cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
     std::make_tuple(WeaklyConnectedComponents_Usecase{},
+                    cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
+    std::make_tuple(WeaklyConnectedComponents_Usecase{true, 2},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(WeaklyConnectedComponents_Usecase{true, 2},
                     cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -238,6 +248,8 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     // enable correctness checks
     std::make_tuple(WeaklyConnectedComponents_Usecase{},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false)),
+    std::make_tuple(WeaklyConnectedComponents_Usecase{true, 2},
                     cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
 
 INSTANTIATE_TEST_SUITE_P(
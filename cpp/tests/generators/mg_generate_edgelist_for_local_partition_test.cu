@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail/graph_partition_utils.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+
+#include <cugraph/graph_generators.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+struct GenerateEdgelistForLocalPartition_Usecase {
+  bool rmat{true};  // R-mat if true, G(n,p) otherwise
+  size_t scale{10};
+  size_t edge_factor{16};  // R-mat only
+  float p{0.0};            // G(n,p) only
+  bool clip_and_flip{false};
+  bool scramble_vertex_ids{false};
+  bool store_transposed{false};
+  size_t max_chunk_size{size_t{1} << 26};
+  bool check_correctness{true};
+};
+
+class Tests_MGGenerateEdgelistForLocalPartition
+  : public ::testing::TestWithParam<GenerateEdgelistForLocalPartition_Usecase> {
+ public:
+  Tests_MGGenerateEdgelistForLocalPartition() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t>
+  void run_current_test(GenerateEdgelistForLocalPartition_Usecase const& usecase)
+  {
+    auto& comm                 = handle_->get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto const major_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::major_comm_name()).get_size();
+    auto const minor_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size();
+
+    auto num_vertices   = static_cast<vertex_t>(size_t{1} << usecase.scale);
+    auto base_vertex_id = usecase.rmat ? vertex_t{0} : vertex_t{7};
+    uint64_t seed{0};
+
+    // 1. generate the local edges (every GPU uses the same seed)
+
+    std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+    std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+    if (usecase.rmat) {
+      raft::random::RngState rng_state(seed);
+      std::tie(src_chunks, dst_chunks) =
+        cugraph::generate_rmat_edgelist_for_local_partition<vertex_t, true>(
+          *handle_,
+          rng_state,
+          usecase.scale,
+          usecase.edge_factor << usecase.scale,
+          0.57,
+          0.19,
+          0.19,
+          usecase.clip_and_flip,
+          usecase.scramble_vertex_ids,
+          usecase.store_transposed,
+          usecase.max_chunk_size);
+    } else {
+      std::tie(src_chunks, dst_chunks) =
+        cugraph::generate_erdos_renyi_graph_edgelist_gnp_for_local_partition<vertex_t, true>(
+          *handle_,
+          num_vertices,
+          usecase.p,
+          base_vertex_id,
+          seed,
+          usecase.store_transposed,
+          usecase.max_chunk_size);
+    }
+
+    // 2. every edge should belong to this GPU's edge partition and no chunk should exceed
+    // max_chunk_size
+
+    ASSERT_EQ(src_chunks.size(), dst_chunks.size());
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    for (size_t i = 0; i < src_chunks.size(); ++i) {
+      ASSERT_EQ(src_chunks[i].size(), dst_chunks[i].size());
+      ASSERT_TRUE(src_chunks[i].size() <= usecase.max_chunk_size)
+        << "A chunk holds more than max_chunk_size edges.";
+      auto h_src_chunk = cugraph::test::to_host(*handle_, src_chunks[i]);
+      auto h_dst_chunk = cugraph::test::to_host(*handle_, dst_chunks[i]);
+      h_srcs.insert(h_srcs.end(), h_src_chunk.begin(), h_src_chunk.end());
+      h_dsts.insert(h_dsts.end(), h_dst_chunk.begin(), h_dst_chunk.end());
+    }
+
+    auto gpu_id_func = cugraph::detail::compute_gpu_id_from_ext_edge_endpoints_t<vertex_t>{
+      comm_size, major_comm_size, minor_comm_size};
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      ASSERT_TRUE((h_srcs[i] >= base_vertex_id) && (h_srcs[i] < base_vertex_id + num_vertices) &&
+                  (h_dsts[i] >= base_vertex_id) && (h_dsts[i] < base_vertex_id + num_vertices))
+        << "Edge (" << h_srcs[i] << "," << h_dsts[i] << ") has an invalid vertex ID.";
+      auto gpu_id = usecase.store_transposed ? gpu_id_func(h_dsts[i], h_srcs[i])
+                                             : gpu_id_func(h_srcs[i], h_dsts[i]);
+      ASSERT_EQ(gpu_id, comm_rank) << "Edge (" << h_srcs[i] << "," << h_dsts[i]
+                                   << ") does not belong to this GPU's edge partition.";
+    }
+
+    if (usecase.rmat) {
+      auto num_edges = cugraph::host_scalar_allreduce(
+        comm, h_srcs.size(), raft::comms::op_t::SUM, handle_->get_stream());
+      ASSERT_EQ(num_edges, usecase.edge_factor << usecase.scale)
+        << "The number of edges over the GPUs does not match the requested number of edges.";
+    }
+
+    if (usecase.check_correctness) {
+      // 3. the union of the local edges over the GPUs should be identical to the edges generated
+      // (on a single GPU) with the same seed
+
+      auto d_srcs = cugraph::test::to_device(*handle_, h_srcs);
+      auto d_dsts = cugraph::test::to_device(*handle_, h_dsts);
+
+      auto d_aggregate_srcs = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()));
+      auto d_aggregate_dsts = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()));
+
+      if (comm_rank == 0) {
+        rmm::device_uvector<vertex_t> d_ref_srcs(0, handle_->get_stream());
+        rmm::device_uvector<vertex_t> d_ref_dsts(0, handle_->get_stream());
+        if (usecase.rmat) {
+          raft::random::RngState rng_state(seed);
+          std::tie(d_ref_srcs, d_ref_dsts) =
+            cugraph::generate_rmat_edgelist<vertex_t>(*handle_,
+                                                      rng_state,
+                                                      usecase.scale,
+                                                      usecase.edge_factor << usecase.scale,
+                                                      0.57,
+                                                      0.19,
+                                                      0.19,
+                                                      usecase.clip_and_flip,
+                                                      usecase.scramble_vertex_ids);
+        } else {
+          std::tie(d_ref_srcs, d_ref_dsts) = cugraph::generate_erdos_renyi_graph_edgelist_gnp(
+            *handle_, num_vertices, usecase.p, base_vertex_id, seed);
+        }
+
+        auto h_ref_srcs = cugraph::test::to_host(*handle_, d_ref_srcs);
+        auto h_ref_dsts = cugraph::test::to_host(*handle_, d_ref_dsts);
+        if (!usecase.rmat) {
+          // generate_erdos_renyi_graph_edgelist_gnp ignores base_vertex_id
+          std::transform(h_ref_srcs.begin(),
+                         h_ref_srcs.end(),
+                         h_ref_srcs.begin(),
+                         [base_vertex_id](auto v) { return v + base_vertex_id; });
+          std::transform(h_ref_dsts.begin(),
+                         h_ref_dsts.end(),
+                         h_ref_dsts.begin(),
+                         [base_vertex_id](auto v) { return v + base_vertex_id; });
+        }
+
+        auto to_sorted_edges = [](auto const& srcs, auto const& dsts) {
+          std::vector<std::tuple<vertex_t, vertex_t>> edges(srcs.size());
+          for (size_t i = 0; i < edges.size(); ++i) {
+            edges[i] = std::make_tuple(srcs[i], dsts[i]);
+          }
+          std::sort(edges.begin(), edges.end());
+          return edges;
+        };
+
+        ASSERT_TRUE(to_sorted_edges(cugraph::test::to_host(*handle_, d_aggregate_srcs),
+                                    cugraph::test::to_host(*handle_, d_aggregate_dsts)) ==
+                    to_sorted_edges(h_ref_srcs, h_ref_dsts))
+          << "The union of the local edges does not match the edges generated on a single GPU.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+std::unique_ptr<raft::handle_t> Tests_MGGenerateEdgelistForLocalPartition::handle_ = nullptr;
+
+TEST_P(Tests_MGGenerateEdgelistForLocalPartition, CheckInt32)
+{
+  run_current_test<int32_t>(GetParam());
+}
+
+TEST_P(Tests_MGGenerateEdgelistForLocalPartition, CheckInt64)
+{
+  run_current_test<int64_t>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MGGenerateEdgelistForLocalPartition,
+  ::testing::Values(
+    // R-mat
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16},
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16, 0.0, true, false},
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16, 0.0, false, true},
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16, 0.0, false, true, true},
+    // small chunks
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16, 0.0, false, false, false, 1000},
+    GenerateEdgelistForLocalPartition_Usecase{true, 10, 16, 0.0, false, true, true, 1000},
+    // G(n,p)
+    GenerateEdgelistForLocalPartition_Usecase{false, 8, 0, 0.05},
+    GenerateEdgelistForLocalPartition_Usecase{false, 8, 0, 0.05, false, false, true},
+    GenerateEdgelistForLocalPartition_Usecase{false, 8, 0, 0.05, false, false, false, 100}));
+
+INSTANTIATE_TEST_SUITE_P(
+  benchmark_test,
+  Tests_MGGenerateEdgelistForLocalPartition,
+  ::testing::Values(GenerateEdgelistForLocalPartition_Usecase{
+    true, 20, 32, 0.0, false, true, false, size_t{1} << 26, false}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
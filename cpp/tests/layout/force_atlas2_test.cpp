@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "layout/legacy/trust_worthiness.h"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct ForceAtlas2_Usecase {
+  size_t max_iterations{500};
+  size_t num_coarsening_levels{0};
+  bool test_weighted{false};
+  double min_trustworthiness{0.6};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ForceAtlas2
+  : public ::testing::TestWithParam<std::tuple<ForceAtlas2_Usecase, input_usecase_t>> {
+ public:
+  Tests_ForceAtlas2() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(ForceAtlas2_Usecase const& force_atlas2_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::optional<cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>,
+                                           weight_t>>
+      edge_weights{std::nullopt};
+    std::tie(graph, edge_weights, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, force_atlas2_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    ASSERT_TRUE(graph_view.is_symmetric()) << "ForceAtlas2 works only on symmetric graphs.";
+
+    auto num_vertices = graph_view.number_of_vertices();
+
+    rmm::device_uvector<float> d_x_positions(num_vertices, handle.get_stream());
+    rmm::device_uvector<float> d_y_positions(num_vertices, handle.get_stream());
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("ForceAtlas2");
+    }
+
+    cugraph::force_atlas2(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      raft::device_span<float>(d_x_positions.data(), d_x_positions.size()),
+      raft::device_span<float>(d_y_positions.data(), d_y_positions.size()),
+      true,
+      force_atlas2_usecase.max_iterations,
+      force_atlas2_usecase.num_coarsening_levels);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (force_atlas2_usecase.check_correctness) {
+      auto h_x_positions = cugraph::test::to_host(handle, d_x_positions);
+      auto h_y_positions = cugraph::test::to_host(handle, d_y_positions);
+
+      ASSERT_TRUE(std::all_of(h_x_positions.begin(),
+                              h_x_positions.end(),
+                              [](auto x) { return std::isfinite(x); }) &&
+                  std::all_of(h_y_positions.begin(),
+                              h_y_positions.end(),
+                              [](auto y) { return std::isfinite(y); }))
+        << "positions should be finite.";
+
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+
+      std::vector<std::vector<int>> adj_matrix(num_vertices, std::vector<int>(num_vertices, 0));
+      for (vertex_t u = 0; u < num_vertices; ++u) {
+        for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+          adj_matrix[u][h_indices[i]] = 1;
+        }
+      }
+      std::vector<std::vector<double>> embedding(num_vertices, std::vector<double>(2));
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        embedding[v][0] = h_x_positions[v];
+        embedding[v][1] = h_y_positions[v];
+      }
+
+      auto score = trustworthiness_score(adj_matrix, embedding, num_vertices, 2, 5);
+      ASSERT_GT(score, force_atlas2_usecase.min_trustworthiness)
+        << "trustworthiness of the layout is lower than expected.";
+    }
+  }
+};
+
+using Tests_ForceAtlas2_File = Tests_ForceAtlas2<cugraph::test::File_Usecase>;
+using Tests_ForceAtlas2_Rmat = Tests_ForceAtlas2<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ForceAtlas2_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ForceAtlas2_File, CheckInt32Int32DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, double>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ForceAtlas2_Rmat, CheckInt64Int64FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ForceAtlas2_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ForceAtlas2_Usecase{500, 0, false},
+                      ForceAtlas2_Usecase{500, 0, true},
+                      ForceAtlas2_Usecase{100, 4, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ForceAtlas2_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ForceAtlas2_Usecase{100, 8, false, 0.0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
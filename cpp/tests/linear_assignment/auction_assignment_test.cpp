@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// minimum cost assignment of every row to a distinct column (num_rows <= num_cols) with the
+// Hungarian algorithm (shortest augmenting paths with potentials), missing entries are infinite
+template <typename weight_t>
+weight_t linear_assignment_reference(std::vector<std::vector<weight_t>> const& costs,
+                                     size_t num_cols)
+{
+  auto const num_rows = costs.size();
+  auto const inf      = std::numeric_limits<weight_t>::max() / 4;
+  std::vector<weight_t> u(num_rows + 1, 0), v(num_cols + 1, 0);
+  std::vector<size_t> p(num_cols + 1, 0), way(num_cols + 1, 0);
+  for (size_t i = 1; i <= num_rows; ++i) {
+    p[0]      = i;
+    size_t j0 = 0;
+    std::vector<weight_t> minv(num_cols + 1, inf);
+    std::vector<bool> used(num_cols + 1, false);
+    do {
+      used[j0]   = true;
+      auto i0    = p[j0];
+      auto delta = inf;
+      size_t j1  = 0;
+      for (size_t j = 1; j <= num_cols; ++j) {
+        if (!used[j]) {
+          auto cur = costs[i0 - 1][j - 1] - u[i0] - v[j];
+          if (cur < minv[j]) {
+            minv[j] = cur;
+            way[j]  = j0;
+          }
+          if (minv[j] < delta) {
+            delta = minv[j];
+            j1    = j;
+          }
+        }
+      }
+      for (size_t j = 0; j <= num_cols; ++j) {
+        if (used[j]) {
+          u[p[j]] += delta;
+          v[j] -= delta;
+        } else {
+          minv[j] -= delta;
+        }
+      }
+      j0 = j1;
+    } while (p[j0] != 0);
+    do {
+      auto j1 = way[j0];
+      p[j0]   = p[j1];
+      j0      = j1;
+    } while (j0 != 0);
+  }
+
+  weight_t total{0};
+  for (size_t j = 1; j <= num_cols; ++j) {
+    if (p[j] != 0) { total += costs[p[j] - 1][j - 1]; }
+  }
+  return total;
+}
+
+struct AuctionAssignment_Usecase {
+  size_t num_workers{0};
+  size_t num_jobs{0};
+  size_t num_edges_per_worker{0};
+  bool check_correctness{true};
+};
+
+class Tests_AuctionAssignment : public ::testing::TestWithParam<AuctionAssignment_Usecase> {
+ public:
+  Tests_AuctionAssignment() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(AuctionAssignment_Usecase const& usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    // workers are [0, num_workers) and jobs are [num_workers, num_workers + num_jobs); every
+    // worker has an edge to a distinct job (so a complete assignment exists) and random integer
+    // costs
+
+    auto num_workers = static_cast<vertex_t>(usecase.num_workers);
+    auto num_jobs    = static_cast<vertex_t>(usecase.num_jobs);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> job_dist(0, num_jobs - 1);
+    std::uniform_int_distribution<int> cost_dist(0, 99);
+    std::vector<vertex_t> job_permutation(num_jobs);
+    std::iota(job_permutation.begin(), job_permutation.end(), vertex_t{0});
+    std::shuffle(job_permutation.begin(), job_permutation.end(), gen);
+
+    std::map<std::pair<vertex_t, vertex_t>, weight_t> h_edges{};
+    for (vertex_t i = 0; i < num_workers; ++i) {
+      h_edges[{i, job_permutation[i]}] = static_cast<weight_t>(cost_dist(gen));
+      for (size_t k = 1; k < usecase.num_edges_per_worker; ++k) {
+        h_edges[{i, job_dist(gen)}] = static_cast<weight_t>(cost_dist(gen));
+      }
+    }
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    for (auto const& [e, w] : h_edges) {
+      h_srcs.push_back(e.first);
+      h_dsts.push_back(num_workers + e.second);
+      h_weights.push_back(w);
+    }
+    std::vector<vertex_t> h_vertices(num_workers + num_jobs);
+    std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+    std::vector<vertex_t> h_workers(num_workers);
+    std::iota(h_workers.begin(), h_workers.end(), vertex_t{0});
+
+    cugraph::graph_t<vertex_t, edge_t, false, false> graph(handle);
+    std::optional<
+      cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+      edge_weights{std::nullopt};
+    std::tie(graph, edge_weights, std::ignore, std::ignore, std::ignore) =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, false, false>(
+        handle,
+        std::make_optional(cugraph::test::to_device(handle, h_vertices)),
+        cugraph::test::to_device(handle, h_srcs),
+        cugraph::test::to_device(handle, h_dsts),
+        std::make_optional(cugraph::test::to_device(handle, h_weights)),
+        std::nullopt,
+        std::nullopt,
+        cugraph::graph_properties_t{false, false},
+        false);
+    auto graph_view = graph.view();
+
+    auto d_workers = cugraph::test::to_device(handle, h_workers);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Auction assignment");
+    }
+
+    auto [d_assignments, total_cost] = cugraph::auction_assignment(
+      handle,
+      graph_view,
+      (*edge_weights).view(),
+      raft::device_span<vertex_t const>(d_workers.data(), d_workers.size()),
+      std::nullopt,
+      weight_t{4.0},
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (usecase.check_correctness) {
+      auto h_assignments = cugraph::test::to_host(handle, d_assignments);
+
+      std::vector<bool> assigned(num_jobs, false);
+      weight_t h_total_cost{0};
+      for (vertex_t i = 0; i < num_workers; ++i) {
+        auto job = h_assignments[i] - num_workers;
+        ASSERT_TRUE((job >= 0) && (job < num_jobs)) << "every worker should be assigned a job.";
+        ASSERT_FALSE(assigned[job]) << "a job is assigned to more than one worker.";
+        assigned[job] = true;
+        auto it       = h_edges.find({i, job});
+        ASSERT_TRUE(it != h_edges.end()) << "a worker is assigned a job without an edge.";
+        h_total_cost += it->second;
+      }
+      ASSERT_EQ(h_total_cost, total_cost) << "the returned total cost is inconsistent.";
+
+      std::vector<std::vector<weight_t>> h_costs(
+        num_workers,
+        std::vector<weight_t>(num_jobs, static_cast<weight_t>(100 * (num_workers + 1))));
+      for (auto const& [e, w] : h_edges) {
+        h_costs[e.first][e.second] = w;
+      }
+      auto h_reference_cost = linear_assignment_reference(h_costs, num_jobs);
+      ASSERT_EQ(h_total_cost, h_reference_cost) << "the assignment is not optimal.";
+    }
+  }
+};
+
+TEST_P(Tests_AuctionAssignment, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_AuctionAssignment, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_AuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{10, 10, 3},
+                                           AuctionAssignment_Usecase{100, 100, 8},
+                                           AuctionAssignment_Usecase{200, 500, 4},
+                                           AuctionAssignment_Usecase{500, 500, 16}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test,
+                         Tests_AuctionAssignment,
+                         ::testing::Values(AuctionAssignment_Usecase{
+                           1000000, 1000000, 10, false}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+struct ApproximatePageRank_Usecase {
+  double epsilon{1e-6};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ApproximatePageRank
+  : public ::testing::TestWithParam<std::tuple<ApproximatePageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_ApproximatePageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(ApproximatePageRank_Usecase const& approximate_pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, approximate_pagerank_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    // a single personalization vertex, the vertex with the largest out-degree
+    auto out_degrees   = cugraph::test::to_host(handle, graph_view.compute_out_degrees(handle));
+    vertex_t seed      = static_cast<vertex_t>(std::distance(
+      out_degrees.begin(), std::max_element(out_degrees.begin(), out_degrees.end())));
+    auto d_seeds       = cugraph::test::to_device(handle, std::vector<vertex_t>{seed});
+    auto d_seed_values = cugraph::test::to_device(handle, std::vector<result_t>{1.0});
+
+    result_t constexpr alpha{0.85};
+    auto epsilon = static_cast<result_t>(approximate_pagerank_usecase.epsilon);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Approximate personalized PageRank");
+    }
+
+    auto [d_pageranks, metadata] =
+      cugraph::approximate_personalized_pagerank<vertex_t, edge_t, weight_t, result_t, false>(
+        handle,
+        graph_view,
+        edge_weight_view,
+        std::nullopt,
+        std::make_tuple(raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+                        raft::device_span<result_t const>(d_seed_values.data(),
+                                                          d_seed_values.size())),
+        alpha,
+        epsilon,
+        std::numeric_limits<size_t>::max(),
+        false);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_TRUE(metadata.converged_) << "Approximate personalized PageRank failed to converge.";
+
+    if (approximate_pagerank_usecase.check_correctness) {
+      auto [transposed_graph, transposed_edge_weights, new_renumber_map] =
+        cugraph::transpose_graph_storage(handle,
+                                         graph_view,
+                                         edge_weight_view,
+                                         std::optional<raft::device_span<vertex_t const>>{});
+      auto transposed_graph_view = transposed_graph.view();
+
+      auto [d_reference_pageranks, reference_metadata] =
+        cugraph::pagerank<vertex_t, edge_t, weight_t, result_t, false>(
+          handle,
+          transposed_graph_view,
+          transposed_edge_weights ? std::make_optional((*transposed_edge_weights).view())
+                                  : std::nullopt,
+          std::nullopt,
+          std::make_optional(std::make_tuple(
+            raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+            raft::device_span<result_t const>(d_seed_values.data(), d_seed_values.size()))),
+          std::nullopt,
+          alpha,
+          result_t{1e-6},
+          std::numeric_limits<size_t>::max(),
+          false);
+
+      auto h_pageranks           = cugraph::test::to_host(handle, d_pageranks);
+      auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+
+      // the scores differ from the exact scores by the residual left, which is less than epsilon
+      // times the out-going edge weight sum (or epsilon) of every vertex
+      double residual_bound{0.0};
+      if (edge_weight_view) {
+        auto out_weight_sums = cugraph::test::to_host(
+          handle, cugraph::compute_out_weight_sums(handle, graph_view, *edge_weight_view));
+        for (auto w : out_weight_sums) {
+          residual_bound += epsilon * (w > 0.0 ? w : 1.0);
+        }
+      } else {
+        for (auto d : out_degrees) {
+          residual_bound += epsilon * (d > 0 ? d : 1);
+        }
+      }
+
+      double l1_error{0.0};
+      for (size_t i = 0; i < h_pageranks.size(); ++i) {
+        l1_error += std::abs(h_pageranks[i] - h_reference_pageranks[i]);
+      }
+      ASSERT_TRUE(l1_error <= residual_bound + 1e-3)
+        << "Approximate personalized PageRank values are too far from the reference values (L1 "
+           "error "
+        << l1_error << ", bound " << residual_bound << ").";
+    }
+  }
+};
+
+using Tests_ApproximatePageRank_File = Tests_ApproximatePageRank<cugraph::test::File_Usecase>;
+using Tests_ApproximatePageRank_Rmat = Tests_ApproximatePageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ApproximatePageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ApproximatePageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ApproximatePageRank_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ApproximatePageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ApproximatePageRank_Usecase{1e-6, false},
+                      ApproximatePageRank_Usecase{1e-6, true},
+                      ApproximatePageRank_Usecase{1e-4, false}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ApproximatePageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(ApproximatePageRank_Usecase{1e-7, false},
+                      ApproximatePageRank_Usecase{1e-7, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ApproximatePageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(ApproximatePageRank_Usecase{1e-6, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
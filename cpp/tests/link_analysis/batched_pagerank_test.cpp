@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct BatchedPageRank_Usecase {
+  size_t batch_size{8};
+  size_t personalization_vector_size{4};
+  bool test_weighted{false};
+  bool check_correctness{true};
+  size_t convergence_check_interval{1};
+  bool use_cuda_graph{false};
+};
+
+template <typename input_usecase_t>
+class Tests_BatchedPageRank
+  : public ::testing::TestWithParam<std::tuple<BatchedPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_BatchedPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BatchedPageRank_Usecase const& batched_pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+        handle, input_usecase, batched_pagerank_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    auto num_vertices = graph_view.number_of_vertices();
+
+    // K personalization vectors of distinct random vertices with random values
+
+    std::vector<size_t> h_offsets(batched_pagerank_usecase.batch_size + 1, 0);
+    std::vector<vertex_t> h_vertices{};
+    std::vector<result_t> h_values{};
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<result_t> value_distribution{0.1, 1.0};
+    std::vector<vertex_t> all_vertices(num_vertices);
+    std::iota(all_vertices.begin(), all_vertices.end(), vertex_t{0});
+    for (size_t k = 0; k < batched_pagerank_usecase.batch_size; ++k) {
+      std::shuffle(all_vertices.begin(), all_vertices.end(), generator);
+      auto size = std::min(batched_pagerank_usecase.personalization_vector_size,
+                           static_cast<size_t>(num_vertices));
+      h_vertices.insert(h_vertices.end(), all_vertices.begin(), all_vertices.begin() + size);
+      for (size_t i = 0; i < size; ++i) {
+        h_values.push_back(value_distribution(generator));
+      }
+      h_offsets[k + 1] = h_vertices.size();
+    }
+
+    auto d_offsets  = cugraph::test::to_device(handle, h_offsets);
+    auto d_vertices = cugraph::test::to_device(handle, h_vertices);
+    auto d_values   = cugraph::test::to_device(handle, h_values);
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Batched personalized PageRank");
+    }
+
+    auto [d_pageranks, metadata] =
+      cugraph::batched_personalized_pagerank<vertex_t, edge_t, weight_t, result_t>(
+        handle,
+        graph_view,
+        edge_weight_view,
+        std::nullopt,
+        raft::device_span<size_t const>(d_offsets.data(), d_offsets.size()),
+        raft::device_span<vertex_t const>(d_vertices.data(), d_vertices.size()),
+        raft::device_span<result_t const>(d_values.data(), d_values.size()),
+        alpha,
+        epsilon,
+        std::numeric_limits<size_t>::max(),
+        false,
+        cugraph::centrality_iteration_schedule_t{
+          size_t{1},
+          batched_pagerank_usecase.convergence_check_interval,
+          std::nullopt,
+          batched_pagerank_usecase.use_cuda_graph});
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_TRUE(metadata.converged_) << "Batched personalized PageRank failed to converge.";
+
+    if (batched_pagerank_usecase.check_correctness) {
+      auto batch_size          = batched_pagerank_usecase.batch_size;
+      auto h_cugraph_pageranks = cugraph::test::to_host(handle, d_pageranks);
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        1e-6;  // skip comparison for low PageRank verties (lowly ranked vertices)
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      for (size_t k = 0; k < batch_size; ++k) {
+        auto [d_reference_pageranks, reference_metadata] =
+          cugraph::pagerank<vertex_t, edge_t, weight_t, result_t, false>(
+            handle,
+            graph_view,
+            edge_weight_view,
+            std::nullopt,
+            std::make_optional(std::make_tuple(
+              raft::device_span<vertex_t const>(d_vertices.data() + h_offsets[k],
+                                                h_offsets[k + 1] - h_offsets[k]),
+              raft::device_span<result_t const>(d_values.data() + h_offsets[k],
+                                                h_offsets[k + 1] - h_offsets[k]))),
+            std::nullopt,
+            alpha,
+            epsilon,
+            std::numeric_limits<size_t>::max(),
+            false);
+        auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          ASSERT_TRUE(nearly_equal(h_reference_pageranks[v],
+                                   h_cugraph_pageranks[static_cast<size_t>(v) * batch_size + k]))
+            << "Batched personalized PageRank values do not match with the reference values "
+               "(vertex "
+            << v << ", personalization vector " << k << ").";
+        }
+      }
+    }
+  }
+};
+
+using Tests_BatchedPageRank_File = Tests_BatchedPageRank<cugraph::test::File_Usecase>;
+using Tests_BatchedPageRank_Rmat = Tests_BatchedPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BatchedPageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BatchedPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BatchedPageRank_Rmat, CheckInt64Int64DoubleDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BatchedPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedPageRank_Usecase{8, 4, false},
+                      BatchedPageRank_Usecase{8, 4, true},
+                      BatchedPageRank_Usecase{33, 1, true},
+                      BatchedPageRank_Usecase{8, 4, true, true, 4, false},
+                      BatchedPageRank_Usecase{8, 4, true, true, 4, true},
+                      BatchedPageRank_Usecase{8, 4, true, true, 5, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BatchedPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BatchedPageRank_Usecase{8, 16, false}, BatchedPageRank_Usecase{8, 16, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BatchedPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BatchedPageRank_Usecase{64, 16, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -136,6 +136,8 @@ struct Hits_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  cugraph::centrality_eigensolver_t solver{cugraph::centrality_eigensolver_t::power_iteration};
 };
 
 template <typename input_usecase_t>
@@ -229,7 +231,8 @@ class Tests_Hits : public ::testing::TestWithParam<std::tuple<Hits_Usecase, inpu
                                 maximum_iterations,
                                 hits_usecase.check_initial_input,
                                 true,
-                                hits_usecase.check_initial_input);
+                                hits_usecase.check_initial_input,
+                                hits_usecase.solver);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -327,10 +330,13 @@ INSTANTIATE_TEST_SUITE_P(
   Tests_Hits_File,
   ::testing::Combine(
     // enable correctness checks
-    ::testing::Values(Hits_Usecase{false, false, true},
-                      Hits_Usecase{false, true, true},
-                      Hits_Usecase{true, false, true},
-                      Hits_Usecase{true, true, true}),
+    ::testing::Values(
+      Hits_Usecase{false, false, true},
+      Hits_Usecase{false, true, true},
+      Hits_Usecase{true, false, true},
+      Hits_Usecase{true, true, true},
+      Hits_Usecase{false, false, true, cugraph::centrality_eigensolver_t::lanczos},
+      Hits_Usecase{true, false, true, cugraph::centrality_eigensolver_t::lanczos}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
 
@@ -350,10 +356,16 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(rmat_small_test,
                          Tests_Hits_Rmat,
                          // enable correctness checks
-                         ::testing::Combine(::testing::Values(Hits_Usecase{false, false, true},
-                                                              Hits_Usecase{false, true, true},
-                                                              Hits_Usecase{true, false, true},
-                                                              Hits_Usecase{true, true, true}),
+                         ::testing::Combine(::testing::Values(
+                                              Hits_Usecase{false, false, true},
+                                              Hits_Usecase{false, true, true},
+                                              Hits_Usecase{true, false, true},
+                                              Hits_Usecase{true, true, true},
+                                              Hits_Usecase{
+                                                false,
+                                                false,
+                                                true,
+                                                cugraph::centrality_eigensolver_t::lanczos}),
                                             ::testing::Values(cugraph::test::Rmat_Usecase(
                                               10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
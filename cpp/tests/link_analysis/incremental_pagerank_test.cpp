@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+// power iteration on the CSR (outgoing edges) representation of the graph
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+std::vector<result_t> pagerank_reference(std::vector<edge_t> const& offsets,
+                                         std::vector<vertex_t> const& indices,
+                                         std::optional<std::vector<weight_t>> const& weights,
+                                         vertex_t num_vertices,
+                                         result_t alpha,
+                                         result_t epsilon)
+{
+  std::vector<result_t> pageranks(num_vertices,
+                                  result_t{1.0} / static_cast<result_t>(num_vertices));
+  if (num_vertices == 0) { return pageranks; }
+
+  std::vector<weight_t> out_weight_sums(num_vertices, weight_t{0.0});
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+      out_weight_sums[i] += weights ? (*weights)[j] : weight_t{1.0};
+    }
+  }
+
+  std::vector<result_t> old_pageranks(num_vertices, result_t{0.0});
+  while (true) {
+    std::copy(pageranks.begin(), pageranks.end(), old_pageranks.begin());
+    result_t dangling_sum{0.0};
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      if (out_weight_sums[i] == weight_t{0.0}) { dangling_sum += old_pageranks[i]; }
+    }
+    std::fill(pageranks.begin(),
+              pageranks.end(),
+              (dangling_sum * alpha + (1.0 - alpha)) / static_cast<result_t>(num_vertices));
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+        auto w = weights ? (*weights)[j] : weight_t{1.0};
+        pageranks[indices[j]] += alpha * old_pageranks[i] * (w / out_weight_sums[i]);
+      }
+    }
+    result_t diff_sum{0.0};
+    for (vertex_t i = 0; i < num_vertices; ++i) {
+      diff_sum += std::abs(pageranks[i] - old_pageranks[i]);
+    }
+    if (diff_sum < epsilon) { break; }
+  }
+
+  return pageranks;
+}
+
+struct IncrementalPageRank_Usecase {
+  int32_t hash_bin_count{16};  // 1 / hash_bin_count of the edges change
+  bool insertion{false};       // the changed edges are inserted (true) or deleted (false)
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_IncrementalPageRank
+  : public ::testing::TestWithParam<std::tuple<IncrementalPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_IncrementalPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(IncrementalPageRank_Usecase const& incremental_pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, incremental_pagerank_usecase.test_weighted, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    // edges with a false mask value change, the delta mask is the complement of the mask
+
+    auto edge_mask = cugraph::test::generate<decltype(graph_view), bool>::edge_property(
+      handle, graph_view, incremental_pagerank_usecase.hash_bin_count);
+    cugraph::edge_property_t<decltype(graph_view), bool> edge_mask_delta(handle, graph_view);
+    {
+      auto packed_size = cugraph::packed_bool_size(edge_mask.view().edge_counts()[0]);
+      std::vector<uint32_t> h_packed(packed_size);
+      raft::update_host(
+        h_packed.data(), edge_mask.view().value_firsts()[0], packed_size, handle.get_stream());
+      handle.sync_stream();
+      std::transform(
+        h_packed.begin(), h_packed.end(), h_packed.begin(), [](auto word) { return ~word; });
+      raft::update_device(edge_mask_delta.mutable_view().value_firsts()[0],
+                          h_packed.data(),
+                          packed_size,
+                          handle.get_stream());
+    }
+
+    auto prev_graph_view = graph_view;
+    if (incremental_pagerank_usecase.insertion) {
+      prev_graph_view.attach_edge_mask(edge_mask.view());
+    } else {
+      graph_view.attach_edge_mask(edge_mask.view());
+    }
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    auto [h_prev_offsets, h_prev_indices, h_prev_weights] =
+      cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+        handle, prev_graph_view, edge_weight_view, std::nullopt);
+    auto h_prev_pageranks = pagerank_reference(h_prev_offsets,
+                                               h_prev_indices,
+                                               h_prev_weights,
+                                               prev_graph_view.number_of_vertices(),
+                                               alpha,
+                                               epsilon);
+    auto d_prev_pageranks = cugraph::test::to_device(handle, h_prev_pageranks);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Incremental PageRank");
+    }
+
+    auto [d_pageranks, metadata] = cugraph::incremental_pagerank<vertex_t, edge_t, weight_t>(
+      handle,
+      graph_view,
+      edge_weight_view,
+      edge_mask_delta.view(),
+      raft::device_span<result_t const>(d_prev_pageranks.data(), d_prev_pageranks.size()),
+      alpha,
+      epsilon,
+      std::numeric_limits<size_t>::max(),
+      false);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_TRUE(metadata.converged_) << "Incremental PageRank failed to converge.";
+
+    if (incremental_pagerank_usecase.check_correctness) {
+      auto [h_offsets, h_indices, h_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+          handle, graph_view, edge_weight_view, std::nullopt);
+      auto h_reference_pageranks = pagerank_reference(
+        h_offsets, h_indices, h_weights, graph_view.number_of_vertices(), alpha, epsilon);
+
+      auto h_cugraph_pageranks = cugraph::test::to_host(handle, d_pageranks);
+
+      auto threshold_ratio = 1e-3;
+      auto threshold_magnitude =
+        1e-6;  // skip comparison for low PageRank verties (lowly ranked vertices)
+      auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <
+               std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+      };
+
+      ASSERT_TRUE(std::equal(h_reference_pageranks.begin(),
+                             h_reference_pageranks.end(),
+                             h_cugraph_pageranks.begin(),
+                             nearly_equal))
+        << "Incremental PageRank values do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_IncrementalPageRank_File = Tests_IncrementalPageRank<cugraph::test::File_Usecase>;
+using Tests_IncrementalPageRank_Rmat = Tests_IncrementalPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_IncrementalPageRank_File, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt32Int32FloatFloat)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_IncrementalPageRank_Rmat, CheckInt64Int64FloatDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_IncrementalPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{16, false, false},
+                      IncrementalPageRank_Usecase{16, true, false},
+                      IncrementalPageRank_Usecase{16, false, true},
+                      IncrementalPageRank_Usecase{4, true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(IncrementalPageRank_Usecase{1000, false, false},
+                      IncrementalPageRank_Usecase{1000, true, false},
+                      IncrementalPageRank_Usecase{16, false, true},
+                      IncrementalPageRank_Usecase{16, true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_IncrementalPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(IncrementalPageRank_Usecase{1000, false, false, false},
+                      IncrementalPageRank_Usecase{1000, true, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -39,6 +39,7 @@
 #include <limits>
 #include <numeric>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
@@ -137,6 +138,8 @@ struct PageRank_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  cugraph::centrality_iteration_schedule_t schedule{};
 };
 
 template <typename input_usecase_t>
@@ -240,7 +243,8 @@ class Tests_PageRank
       alpha,
       epsilon,
       std::numeric_limits<size_t>::max(),
-      false);
+      false,
+      pagerank_usecase.schedule);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -349,6 +353,118 @@ class Tests_PageRank
                              h_cugraph_pageranks.begin(),
                              nearly_equal))
         << "PageRank values do not match with the reference values.";
+
+      if constexpr (std::is_same_v<result_t, float>) {
+        if (edge_weight_view) {
+          auto half_edge_weights = cugraph::encode_half_edge_weights(
+            handle, graph_view, *edge_weight_view, cugraph::half_precision_t::float16);
+
+          auto [d_half_pageranks, half_metadata] = cugraph::pagerank<vertex_t, edge_t>(
+            handle,
+            graph_view,
+            half_edge_weights.view(),
+            cugraph::half_edge_weight_decoder_t{cugraph::half_precision_t::float16},
+            std::optional<raft::device_span<result_t const>>{std::nullopt},
+            d_personalization_vertices
+              ? std::make_optional(std::make_tuple(
+                  raft::device_span<vertex_t const>{d_personalization_vertices->data(),
+                                                    d_personalization_vertices->size()},
+                  raft::device_span<result_t const>{d_personalization_values->data(),
+                                                    d_personalization_values->size()}))
+              : std::nullopt,
+            std::optional<raft::device_span<result_t const>>{std::nullopt},
+            alpha,
+            epsilon,
+            std::numeric_limits<size_t>::max(),
+            false);
+
+          auto h_pageranks      = cugraph::test::to_host(handle, d_pageranks);
+          auto h_half_pageranks = cugraph::test::to_host(handle, d_half_pageranks);
+
+          // FP16 edge weights carry ~3 decimal digits
+          auto half_nearly_equal = [threshold_magnitude](auto lhs, auto rhs) {
+            return std::abs(lhs - rhs) <
+                   std::max(std::max(lhs, rhs) * result_t{1e-2}, threshold_magnitude);
+          };
+
+          ASSERT_TRUE(std::equal(h_pageranks.begin(),
+                                 h_pageranks.end(),
+                                 h_half_pageranks.begin(),
+                                 half_nearly_equal))
+            << "PageRank values with FP16 edge weights do not match with the FP32 values.";
+        }
+      }
+
+      // interrupt a run after a few iterations and resume it from its last checkpoint
+      size_t constexpr checkpoint_iteration{2};
+      if (metadata.number_of_iterations_ > checkpoint_iteration) {
+        std::optional<rmm::device_uvector<result_t>> d_checkpoint_pageranks{std::nullopt};
+        size_t checkpointed_iterations{0};
+        cugraph::pagerank_checkpoint_options_t<result_t> checkpoint_options{
+          size_t{1},
+          [&handle, &d_checkpoint_pageranks, &checkpointed_iterations](
+            size_t iteration, raft::device_span<result_t const> pageranks) {
+            d_checkpoint_pageranks = rmm::device_uvector<result_t>(pageranks.size(),
+                                                                   handle.get_stream());
+            raft::copy(d_checkpoint_pageranks->data(),
+                       pageranks.data(),
+                       pageranks.size(),
+                       handle.get_stream());
+            checkpointed_iterations = iteration;
+          }};
+
+        auto personalization =
+          d_personalization_vertices
+            ? std::make_optional(std::make_tuple(
+                raft::device_span<vertex_t const>{d_personalization_vertices->data(),
+                                                  d_personalization_vertices->size()},
+                raft::device_span<result_t const>{d_personalization_values->data(),
+                                                  d_personalization_values->size()}))
+            : std::nullopt;
+
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(
+          handle,
+          graph_view,
+          edge_weight_view,
+          std::nullopt,
+          personalization,
+          std::optional<raft::device_span<result_t const>>{std::nullopt},
+          alpha,
+          epsilon,
+          checkpoint_iteration,
+          checkpoint_options,
+          size_t{0},
+          false,
+          pagerank_usecase.schedule);
+        ASSERT_EQ(checkpointed_iterations, checkpoint_iteration);
+
+        auto [d_resumed_pageranks, resumed_metadata] =
+          cugraph::pagerank<vertex_t, edge_t, weight_t>(
+            handle,
+            graph_view,
+            edge_weight_view,
+            std::nullopt,
+            personalization,
+            std::make_optional<raft::device_span<result_t const>>(d_checkpoint_pageranks->data(),
+                                                                  d_checkpoint_pageranks->size()),
+            alpha,
+            epsilon,
+            std::numeric_limits<size_t>::max(),
+            cugraph::pagerank_checkpoint_options_t<result_t>{},
+            checkpointed_iterations,
+            false,
+            pagerank_usecase.schedule);
+        ASSERT_TRUE(resumed_metadata.number_of_iterations_ > checkpoint_iteration);
+
+        auto h_pageranks         = cugraph::test::to_host(handle, d_pageranks);
+        auto h_resumed_pageranks = cugraph::test::to_host(handle, d_resumed_pageranks);
+
+        ASSERT_TRUE(std::equal(h_pageranks.begin(),
+                               h_pageranks.end(),
+                               h_resumed_pageranks.begin(),
+                               nearly_equal))
+          << "PageRank values of the resumed run do not match with the uninterrupted run.";
+      }
     }
   }
 };
@@ -386,7 +502,21 @@ INSTANTIATE_TEST_SUITE_P(file_test,
                                              PageRank_Usecase{0.5, false, false},
                                              PageRank_Usecase{0.0, false, true},
                                              PageRank_Usecase{0.5, true, false},
-                                             PageRank_Usecase{0.5, true, true}),
+                                             PageRank_Usecase{0.5, true, true},
+                                             PageRank_Usecase{0.0, false, false, true, {4, 3}},
+                                             PageRank_Usecase{0.5, true, false, true, {4, 3}},
+                                             PageRank_Usecase{
+                                               0.0,
+                                               true,
+                                               false,
+                                               true,
+                                               {1, 1, cugraph::half_precision_t::float16}},
+                                             PageRank_Usecase{
+                                               0.5,
+                                               false,
+                                               false,
+                                               true,
+                                               {4, 1, cugraph::half_precision_t::bfloat16}}),
                            ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
                                              cugraph::test::File_Usecase("dolphins.csv"))));
 
@@ -402,7 +532,13 @@ INSTANTIATE_TEST_SUITE_P(
                       PageRank_Usecase{0.5, false, false},
                       PageRank_Usecase{0.0, false, true},
                       PageRank_Usecase{0.5, true, false},
-                      PageRank_Usecase{0.5, true, true}),
+                      PageRank_Usecase{0.5, true, true},
+                      PageRank_Usecase{0.0, false, false, true, {4, 3}},
+                      PageRank_Usecase{0.5, true, false, true, {4, 3}},
+                      PageRank_Usecase{
+                        0.0, true, false, true, {1, 1, cugraph::half_precision_t::float16}},
+                      PageRank_Usecase{
+                        0.5, false, false, true, {4, 1, cugraph::half_precision_t::bfloat16}}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+struct BipartiteProjection_Similarity_Usecase {
+  bool use_weights{false};
+  std::optional<size_t> topk_per_item{std::nullopt};
+  size_t max_seeds{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BipartiteProjection_Similarity
+  : public ::testing::TestWithParam<
+      std::tuple<BipartiteProjection_Similarity_Usecase, input_usecase_t>> {
+ public:
+  Tests_BipartiteProjection_Similarity() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(BipartiteProjection_Similarity_Usecase const& similarity_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, similarity_usecase.use_weights, true, false, true);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    std::vector<vertex_t> h_items(
+      std::min(static_cast<size_t>(graph_view.number_of_vertices()), similarity_usecase.max_seeds));
+    std::iota(h_items.begin(), h_items.end(), vertex_t{0});
+    auto d_items = cugraph::test::to_device(handle, h_items);
+    auto items   = raft::device_span<vertex_t const>(d_items.data(), d_items.size());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Jaccard bipartite projection");
+    }
+
+    auto [d_jaccard_v1, d_jaccard_v2, d_jaccard_scores] =
+      cugraph::jaccard_bipartite_projection_coefficients(
+        handle, graph_view, edge_weight_view, items, similarity_usecase.topk_per_item, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto [d_cosine_v1, d_cosine_v2, d_cosine_scores] =
+      cugraph::cosine_bipartite_projection_coefficients(
+        handle, graph_view, edge_weight_view, items, similarity_usecase.topk_per_item, true);
+
+    if (similarity_usecase.check_correctness) {
+      auto check = [&handle, &graph_view, &edge_weight_view, &similarity_usecase](
+                     auto const& d_v1, auto const& d_v2, auto const& d_scores, auto reference) {
+        auto vertex_pairs =
+          std::make_tuple(raft::device_span<vertex_t const>(d_v1.data(), d_v1.size()),
+                          raft::device_span<vertex_t const>(d_v2.data(), d_v2.size()));
+        auto d_reference_scores = reference(handle, graph_view, edge_weight_view, vertex_pairs);
+
+        auto h_v1               = cugraph::test::to_host(handle, d_v1);
+        auto h_v2               = cugraph::test::to_host(handle, d_v2);
+        auto h_scores           = cugraph::test::to_host(handle, d_scores);
+        auto h_reference_scores = cugraph::test::to_host(handle, d_reference_scores);
+
+        std::map<vertex_t, size_t> num_pairs_per_item{};
+        for (size_t i = 0; i < h_scores.size(); ++i) {
+          ASSERT_NE(h_v1[i], h_v2[i]) << "Self pairs should be excluded.";
+          ASSERT_NEAR(h_scores[i], h_reference_scores[i], 1e-4)
+            << "Score mismatch for the pair (" << h_v1[i] << ", " << h_v2[i] << ").";
+          ++num_pairs_per_item[h_v1[i]];
+        }
+        if (similarity_usecase.topk_per_item) {
+          for (auto [item, num_pairs] : num_pairs_per_item) {
+            ASSERT_LE(num_pairs, *(similarity_usecase.topk_per_item))
+              << "Item " << item << " has more than topk_per_item pairs.";
+          }
+        }
+      };
+
+      check(d_jaccard_v1,
+            d_jaccard_v2,
+            d_jaccard_scores,
+            [](auto const& handle, auto const& graph_view, auto edge_weight_view, auto pairs) {
+              return cugraph::jaccard_coefficients(handle, graph_view, edge_weight_view, pairs);
+            });
+      check(d_cosine_v1,
+            d_cosine_v2,
+            d_cosine_scores,
+            [](auto const& handle, auto const& graph_view, auto edge_weight_view, auto pairs) {
+              return cugraph::cosine_similarity_coefficients(
+                handle, graph_view, edge_weight_view, pairs);
+            });
+
+      // every two-hop pair of the seed items should be returned if topk_per_item is not set
+
+      if (!similarity_usecase.topk_per_item) {
+        auto [d_all_pairs_v1, d_all_pairs_v2, d_all_pairs_scores] =
+          cugraph::jaccard_all_pairs_coefficients(handle,
+                                                  graph_view,
+                                                  edge_weight_view,
+                                                  std::make_optional(items),
+                                                  std::optional<size_t>{std::nullopt});
+        ASSERT_EQ(d_jaccard_v1.size(), d_all_pairs_v1.size())
+          << "The number of returned pairs does not match jaccard_all_pairs_coefficients.";
+      }
+    }
+  }
+};
+
+using Tests_BipartiteProjection_Similarity_File =
+  Tests_BipartiteProjection_Similarity<cugraph::test::File_Usecase>;
+using Tests_BipartiteProjection_Similarity_Rmat =
+  Tests_BipartiteProjection_Similarity<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BipartiteProjection_Similarity_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BipartiteProjection_Similarity_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BipartiteProjection_Similarity_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BipartiteProjection_Similarity_File,
+  ::testing::Combine(::testing::Values(BipartiteProjection_Similarity_Usecase{false},
+                                       BipartiteProjection_Similarity_Usecase{true},
+                                       BipartiteProjection_Similarity_Usecase{false, 5},
+                                       BipartiteProjection_Similarity_Usecase{true, 5}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BipartiteProjection_Similarity_Rmat,
+  ::testing::Combine(::testing::Values(BipartiteProjection_Similarity_Usecase{false, 10, 100},
+                                       BipartiteProjection_Similarity_Usecase{true, 10, 100}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BipartiteProjection_Similarity_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(::testing::Values(BipartiteProjection_Similarity_Usecase{
+                       false, 10, std::numeric_limits<size_t>::max(), false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+struct MinHash_Similarity_Usecase {
+  size_t sketch_size{128};
+  size_t max_vertex_pairs_to_check{std::numeric_limits<size_t>::max()};
+  double max_mean_absolute_error{0.05};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MinHash_Similarity
+  : public ::testing::TestWithParam<std::tuple<MinHash_Similarity_Usecase, input_usecase_t>> {
+ public:
+  Tests_MinHash_Similarity() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MinHash_Similarity_Usecase const& minhash_similarity_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr uint64_t seed{0};
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, true, false, true);
+
+    auto graph_view  = graph.view();
+    auto sketch_size = minhash_similarity_usecase.sketch_size;
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Compute MinHash sketches");
+    }
+
+    auto d_sketches = cugraph::compute_minhash_sketches(handle, graph_view, sketch_size, seed);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // the graph edges are used as the vertex pairs to estimate
+
+    auto [h_srcs, h_dsts, h_wgts] = cugraph::test::graph_to_host_coo(
+      handle,
+      graph_view,
+      std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+      std::optional<raft::device_span<vertex_t const>>(std::nullopt));
+
+    auto num_vertex_pairs =
+      std::min(h_srcs.size(), minhash_similarity_usecase.max_vertex_pairs_to_check);
+    std::vector<vertex_t> h_v1(h_srcs.begin(), h_srcs.begin() + num_vertex_pairs);
+    std::vector<vertex_t> h_v2(h_dsts.begin(), h_dsts.begin() + num_vertex_pairs);
+    auto d_v1 = cugraph::test::to_device(handle, h_v1);
+    auto d_v2 = cugraph::test::to_device(handle, h_v2);
+    auto vertex_pairs =
+      std::make_tuple(raft::device_span<vertex_t const>(d_v1.data(), d_v1.size()),
+                      raft::device_span<vertex_t const>(d_v2.data(), d_v2.size()));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Approximate Jaccard");
+    }
+
+    auto d_approx_jaccard = cugraph::approx_jaccard_coefficients<vertex_t, edge_t, weight_t>(
+      handle,
+      graph_view,
+      raft::device_span<uint64_t const>(d_sketches.data(), d_sketches.size()),
+      sketch_size,
+      vertex_pairs);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (minhash_similarity_usecase.check_correctness) {
+      auto d_approx_sorensen = cugraph::approx_sorensen_coefficients<vertex_t, edge_t, weight_t>(
+        handle,
+        graph_view,
+        raft::device_span<uint64_t const>(d_sketches.data(), d_sketches.size()),
+        sketch_size,
+        vertex_pairs);
+      auto d_jaccard = cugraph::jaccard_coefficients(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+        vertex_pairs);
+      auto d_sorensen = cugraph::sorensen_coefficients(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+        vertex_pairs);
+
+      auto h_approx_jaccard  = cugraph::test::to_host(handle, d_approx_jaccard);
+      auto h_approx_sorensen = cugraph::test::to_host(handle, d_approx_sorensen);
+      auto h_jaccard         = cugraph::test::to_host(handle, d_jaccard);
+      auto h_sorensen        = cugraph::test::to_host(handle, d_sorensen);
+
+      // MinHash is an estimator, check the mean error over the vertex pairs
+
+      double jaccard_error{0.0};
+      double sorensen_error{0.0};
+      for (size_t i = 0; i < h_jaccard.size(); ++i) {
+        ASSERT_TRUE((h_approx_jaccard[i] >= weight_t{0}) && (h_approx_jaccard[i] <= weight_t{1}))
+          << "Estimated Jaccard coefficient " << h_approx_jaccard[i] << " is out of range.";
+        jaccard_error += std::abs(static_cast<double>(h_approx_jaccard[i] - h_jaccard[i]));
+        sorensen_error += std::abs(static_cast<double>(h_approx_sorensen[i] - h_sorensen[i]));
+      }
+      if (h_jaccard.size() > 0) {
+        ASSERT_LE(jaccard_error / h_jaccard.size(),
+                  minhash_similarity_usecase.max_mean_absolute_error);
+        ASSERT_LE(sorensen_error / h_sorensen.size(),
+                  minhash_similarity_usecase.max_mean_absolute_error);
+      }
+
+      // sketches updated edge by edge from empty sketches should coincide with the sketches built
+      // from the graph
+
+      std::vector<uint64_t> h_empty_sketches(d_sketches.size(),
+                                             std::numeric_limits<uint64_t>::max());
+      auto d_updated_sketches = cugraph::test::to_device(handle, h_empty_sketches);
+      auto d_srcs             = cugraph::test::to_device(handle, h_srcs);
+      auto d_dsts             = cugraph::test::to_device(handle, h_dsts);
+      cugraph::update_minhash_sketches(
+        handle,
+        graph_view,
+        raft::device_span<uint64_t>(d_updated_sketches.data(), d_updated_sketches.size()),
+        sketch_size,
+        seed,
+        raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()),
+        raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()),
+        true);
+
+      auto h_sketches         = cugraph::test::to_host(handle, d_sketches);
+      auto h_updated_sketches = cugraph::test::to_host(handle, d_updated_sketches);
+      ASSERT_TRUE(std::equal(h_sketches.begin(), h_sketches.end(), h_updated_sketches.begin()))
+        << "Incrementally updated sketches do not match the sketches built from the graph.";
+    }
+  }
+};
+
+using Tests_MinHash_Similarity_File = Tests_MinHash_Similarity<cugraph::test::File_Usecase>;
+using Tests_MinHash_Similarity_Rmat = Tests_MinHash_Similarity<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MinHash_Similarity_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MinHash_Similarity_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MinHash_Similarity_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MinHash_Similarity_File,
+  ::testing::Combine(::testing::Values(MinHash_Similarity_Usecase{128},
+                                       MinHash_Similarity_Usecase{512}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MinHash_Similarity_Rmat,
+  ::testing::Combine(::testing::Values(MinHash_Similarity_Usecase{128, 10000}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MinHash_Similarity_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(::testing::Values(MinHash_Similarity_Usecase{128, 1 << 20, 0.05, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -66,6 +66,19 @@ struct test_jaccard_t {
     return cugraph::jaccard_all_pairs_coefficients(
       handle, graph_view, edge_weight_view, vertices, topk);
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  auto run_per_vertex_topk(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    bool use_weights,
+    size_t topk_per_vertex) const
+  {
+    return cugraph::jaccard_per_vertex_topk_coefficients(
+      handle, graph_view, edge_weight_view, vertices, topk_per_vertex, true);
+  }
 };
 
 struct test_sorensen_t {
@@ -108,6 +121,19 @@ struct test_sorensen_t {
     return cugraph::sorensen_all_pairs_coefficients(
       handle, graph_view, edge_weight_view, vertices, topk);
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  auto run_per_vertex_topk(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    bool use_weights,
+    size_t topk_per_vertex) const
+  {
+    return cugraph::sorensen_per_vertex_topk_coefficients(
+      handle, graph_view, edge_weight_view, vertices, topk_per_vertex, true);
+  }
 };
 
 struct test_overlap_t {
@@ -150,6 +176,19 @@ struct test_overlap_t {
     return cugraph::overlap_all_pairs_coefficients(
       handle, graph_view, edge_weight_view, vertices, topk);
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  auto run_per_vertex_topk(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    bool use_weights,
+    size_t topk_per_vertex) const
+  {
+    return cugraph::overlap_per_vertex_topk_coefficients(
+      handle, graph_view, edge_weight_view, vertices, topk_per_vertex, true);
+  }
 };
 
 struct test_cosine_t {
@@ -193,6 +232,19 @@ struct test_cosine_t {
     return cugraph::cosine_similarity_all_pairs_coefficients(
       handle, graph_view, edge_weight_view, vertices, topk);
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  auto run_per_vertex_topk(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+    std::optional<edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+    std::optional<raft::device_span<vertex_t const>> vertices,
+    bool use_weights,
+    size_t topk_per_vertex) const
+  {
+    return cugraph::cosine_similarity_per_vertex_topk_coefficients(
+      handle, graph_view, edge_weight_view, vertices, topk_per_vertex, true);
+  }
 };
 
 template <typename vertex_t, typename weight_t, typename test_t>
@@ -34,6 +34,7 @@ struct Similarity_Usecase {
   std::optional<size_t> max_seeds{std::nullopt};
   std::optional<size_t> max_vertex_pairs_to_check{std::nullopt};
   std::optional<size_t> topk{std::nullopt};
+  std::optional<size_t> topk_per_vertex{std::nullopt};
 };
 
 template <typename input_usecase_t>
@@ -111,12 +112,22 @@ class Tests_Similarity
         hr_timer.start("Similarity test");
       }
 
-      std::tie(v1, v2, result_score) = test_functor.run(handle,
-                                                        graph_view,
-                                                        edge_weight_view,
-                                                        sources_span,
-                                                        similarity_usecase.use_weights,
-                                                        similarity_usecase.topk);
+      if (similarity_usecase.topk_per_vertex) {
+        std::tie(v1, v2, result_score) =
+          test_functor.run_per_vertex_topk(handle,
+                                           graph_view,
+                                           edge_weight_view,
+                                           sources_span,
+                                           similarity_usecase.use_weights,
+                                           *similarity_usecase.topk_per_vertex);
+      } else {
+        std::tie(v1, v2, result_score) = test_functor.run(handle,
+                                                          graph_view,
+                                                          edge_weight_view,
+                                                          sources_span,
+                                                          similarity_usecase.use_weights,
+                                                          similarity_usecase.topk);
+      }
     } else {
       if (!sources_span) {
         sources.resize(graph_view.number_of_vertices(), handle.get_stream());
@@ -187,6 +198,22 @@ class Tests_Similarity
       raft::update_host(
         h_result_score.data(), result_score.data(), check_size, handle.get_stream());
 
+      if (similarity_usecase.topk_per_vertex) {
+        auto h_v1    = cugraph::test::to_host(handle, v1);
+        auto h_score = cugraph::test::to_host(handle, result_score);
+
+        size_t count{0};
+        for (size_t i = 0; i < h_v1.size(); ++i) {
+          count = ((i > 0) && (h_v1[i] == h_v1[i - 1])) ? count + 1 : size_t{1};
+          ASSERT_TRUE(count <= *similarity_usecase.topk_per_vertex)
+            << "Vertex " << h_v1[i] << " has more than topk_per_vertex results.";
+          if (count > 1) {
+            ASSERT_TRUE(h_score[i] <= h_score[i - 1])
+              << "Results of vertex " << h_v1[i] << " are not sorted by score.";
+          }
+        }
+      }
+
       if (similarity_usecase.use_weights) {
         weighted_similarity_compare(graph_view.number_of_vertices(),
                                     std::tie(src, dst, wgt),
@@ -287,7 +314,9 @@ INSTANTIATE_TEST_SUITE_P(
                                        Similarity_Usecase{false, true, false, 20, 100, 10},
                                        Similarity_Usecase{false, true, true, 20, 100},
                                        Similarity_Usecase{false, true, true, 20, 100},
-                                       Similarity_Usecase{false, true, true, 20, 100, 10}),
+                                       Similarity_Usecase{false, true, true, 20, 100, 10},
+                                       Similarity_Usecase{
+                                         false, true, true, 20, 100, std::nullopt, 3}),
 #if 0
                       // FIXME: See Issue #4132... these tests don't work for multi-graph right now
                                        Similarity_Usecase{true, true, false, 20, 100},
@@ -320,7 +349,8 @@ INSTANTIATE_TEST_SUITE_P(
                       Similarity_Usecase{true, true, true, 20, 100, 10},
 #endif
                       Similarity_Usecase{false, true, true, std::nullopt, std::nullopt, 100},
-                      Similarity_Usecase{false, true, true, std::nullopt, std::nullopt, 10}),
+                      Similarity_Usecase{false, true, true, std::nullopt, std::nullopt, 10},
+                      Similarity_Usecase{false, true, true, 1000, 10000, std::nullopt, 5}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -27,6 +27,7 @@
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/sampling_functions.hpp>
+#include <cugraph/src_dst_lookup_container.hpp>
 #include <cugraph/utilities/high_res_timer.hpp>
 
 #include <raft/random/rng_state.hpp>
@@ -37,6 +38,7 @@
 #include <execution>
 #include <iostream>
 #include <random>
+#include <thread>
 
 struct EdgeSrcDstLookup_UseCase {
   // FIXME: Test with edge mask once the graph generator is updated to generate edge ids and types
@@ -237,6 +239,48 @@ class Tests_SGLookupEdgeSrcDst
       EXPECT_EQ(h_dsts_expected.size(), h_dsts_results.size());
       ASSERT_TRUE(
         std::equal(h_dsts_expected.begin(), h_dsts_expected.end(), h_dsts_results.begin()));
+
+      // concurrent lookups from multiple host threads, coalesced by lookup_batcher_t
+
+      raft::handle_t batcher_handle{};
+      cugraph::lookup_batcher_t<edge_t, int32_t, vertex_t> batcher(
+        batcher_handle, search_container, std::chrono::microseconds{100}, size_t{1} << 16, false);
+
+      size_t constexpr num_threads{4};
+      auto chunk_size = (h_mg_edge_ids->size() + num_threads - 1) / num_threads;
+      std::vector<std::vector<vertex_t>> h_batched_srcs(num_threads);
+      std::vector<std::vector<vertex_t>> h_batched_dsts(num_threads);
+      std::vector<std::thread> threads{};
+      for (size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i] {
+          auto first = std::min(i * chunk_size, h_mg_edge_ids->size());
+          auto last  = std::min(first + chunk_size, h_mg_edge_ids->size());
+          std::tie(h_batched_srcs[i], h_batched_dsts[i]) =
+            batcher.lookup(std::vector<edge_t>(h_mg_edge_ids->begin() + first,
+                                               h_mg_edge_ids->begin() + last),
+                           std::vector<int32_t>(h_mg_edge_types->begin() + first,
+                                                h_mg_edge_types->begin() + last));
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+
+      std::vector<vertex_t> h_srcs_batched{};
+      std::vector<vertex_t> h_dsts_batched{};
+      for (size_t i = 0; i < num_threads; ++i) {
+        h_srcs_batched.insert(
+          h_srcs_batched.end(), h_batched_srcs[i].begin(), h_batched_srcs[i].end());
+        h_dsts_batched.insert(
+          h_dsts_batched.end(), h_batched_dsts[i].begin(), h_batched_dsts[i].end());
+      }
+
+      ASSERT_EQ(h_srcs_expected.size(), h_srcs_batched.size());
+      ASSERT_TRUE(
+        std::equal(h_srcs_expected.begin(), h_srcs_expected.end(), h_srcs_batched.begin()));
+      ASSERT_EQ(h_dsts_expected.size(), h_dsts_batched.size());
+      ASSERT_TRUE(
+        std::equal(h_dsts_expected.begin(), h_dsts_expected.end(), h_dsts_batched.begin()));
     }
   }
 };
@@ -28,6 +28,7 @@
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/sampling_functions.hpp>
+#include <cugraph/src_dst_lookup_container.hpp>
 #include <cugraph/utilities/dataframe_buffer.hpp>
 #include <cugraph/utilities/high_res_timer.hpp>
 
@@ -38,6 +39,7 @@
 #include <chrono>
 #include <execution>
 #include <iostream>
+#include <numeric>
 #include <random>
 
 struct EdgeSrcDstLookup_UseCase {
@@ -274,6 +276,27 @@ class Tests_MGLookupEdgeSrcDst
       EXPECT_EQ(h_dsts_expected.size(), h_dsts_results.size());
       ASSERT_TRUE(
         std::equal(h_dsts_expected.begin(), h_dsts_expected.end(), h_dsts_results.begin()));
+
+      // lookups of replicated edge types are served locally and should return the same results
+
+      std::vector<int32_t> replicated_types(number_of_edge_types);
+      std::iota(replicated_types.begin(), replicated_types.end(), int32_t{0});
+      search_container.replicate(*handle_, replicated_types, multi_gpu);
+
+      auto [replicated_srcs, replicated_dsts] =
+        cugraph::lookup_endpoints_from_edge_ids_and_types<vertex_t, edge_t, int32_t, multi_gpu>(
+          *handle_,
+          search_container,
+          raft::device_span<edge_t>((*d_mg_edge_ids).begin(), (*d_mg_edge_ids).size()),
+          raft::device_span<int32_t>((*d_mg_edge_types).begin(), (*d_mg_edge_types).size()));
+
+      auto h_replicated_srcs = cugraph::test::to_host(*handle_, replicated_srcs);
+      auto h_replicated_dsts = cugraph::test::to_host(*handle_, replicated_dsts);
+
+      ASSERT_TRUE(std::equal(
+        h_srcs_expected.begin(), h_srcs_expected.end(), h_replicated_srcs.begin()));
+      ASSERT_TRUE(std::equal(
+        h_dsts_expected.begin(), h_dsts_expected.end(), h_replicated_dsts.begin()));
     }
   }
 
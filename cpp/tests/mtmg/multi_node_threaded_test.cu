@@ -23,6 +23,7 @@
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/mtmg/bootstrap.hpp>
 #include <cugraph/mtmg/edgelist.hpp>
 #include <cugraph/mtmg/graph.hpp>
 #include <cugraph/mtmg/per_thread_edgelist.hpp>
@@ -50,8 +51,40 @@ struct Multithreaded_Usecase {
   bool check_correctness{true};
 };
 
+// Bootstrap on top of the MPI launcher used by the tests (file_bootstrap_t or tcp_bootstrap_t
+// work without MPI)
+class mpi_bootstrap_t : public cugraph::mtmg::bootstrap_t {
+ public:
+  mpi_bootstrap_t(int node_rank, int num_nodes) : node_rank_{node_rank}, num_nodes_{num_nodes} {}
+
+  int get_node_rank() const override { return node_rank_; }
+
+  int get_num_nodes() const override { return num_nodes_; }
+
+  void broadcast(void* data, size_t size) override
+  {
+    RAFT_MPI_TRY(MPI_Bcast(data, static_cast<int>(size), MPI_CHAR, 0, MPI_COMM_WORLD));
+  }
+
+  void allgather(void const* input, void* output, size_t size) override
+  {
+    RAFT_MPI_TRY(MPI_Allgather(input,
+                               static_cast<int>(size),
+                               MPI_CHAR,
+                               output,
+                               static_cast<int>(size),
+                               MPI_CHAR,
+                               MPI_COMM_WORLD));
+  }
+
+ private:
+  int node_rank_{0};
+  int num_nodes_{1};
+};
+
 // Global variable defining resource manager
 static cugraph::mtmg::resource_manager_t g_resource_manager{};
+static std::unique_ptr<mpi_bootstrap_t> g_bootstrap{};
 static int g_node_rank{-1};
 static int g_num_nodes{-1};
 
@@ -102,15 +135,8 @@ class Tests_Multithreaded
     int num_local_gpus = gpu_list.size();
     int num_threads    = num_local_gpus * 4;
 
-    ncclUniqueId instance_manager_id{};
-
-    if (g_node_rank == 0) RAFT_NCCL_TRY(ncclGetUniqueId(&instance_manager_id));
-
-    RAFT_MPI_TRY(
-      MPI_Bcast(&instance_manager_id, sizeof(instance_manager_id), MPI_CHAR, 0, MPI_COMM_WORLD));
-
     auto instance_manager = g_resource_manager.create_instance_manager(
-      g_resource_manager.registered_ranks(), instance_manager_id);
+      g_resource_manager.registered_ranks(), *g_bootstrap);
 
     cugraph::mtmg::edgelist_t<vertex_t, weight_t, edge_t, edge_type_t> edgelist;
     cugraph::mtmg::graph_t<vertex_t, edge_t, true, multi_gpu> graph;
@@ -500,33 +526,16 @@ int main(int argc, char** argv)
       : std::nullopt;
 
   //
-  //  Set global values for the test.  Need to know the rank of this process,
-  //  the comm size, number of GPUs per node, and the NCCL Id for rank 0.
+  //  Set global values for the test and register the GPUs of every node.
   //
-  int num_gpus_this_node{-1};
-  std::vector<int> num_gpus_per_node{};
-
   g_node_rank = comm_rank;
   g_num_nodes = comm_size;
 
-  num_gpus_per_node.resize(comm_size);
-
-  RAFT_CUDA_TRY(cudaGetDeviceCount(&num_gpus_this_node));
-  RAFT_MPI_TRY(MPI_Allgather(
-    &num_gpus_this_node, 1, MPI_INT, num_gpus_per_node.data(), 1, MPI_INT, MPI_COMM_WORLD));
-
-  int node_rank{0};
-
-  for (int i = 0; i < comm_size; ++i) {
-    for (int j = 0; j < num_gpus_per_node[i]; ++j) {
-      if (i != comm_rank)
-        g_resource_manager.register_remote_gpu(node_rank++);
-      else
-        g_resource_manager.register_local_gpu(node_rank++, rmm::cuda_device_id{j});
-    }
-  }
+  g_bootstrap = std::make_unique<mpi_bootstrap_t>(comm_rank, comm_size);
+  g_resource_manager.register_gpus(*g_bootstrap);
 
   auto result = RUN_ALL_TESTS();
+  g_bootstrap.reset();
   cugraph::test::finalize_mpi();
   return result;
 }
@@ -29,6 +29,7 @@
 #include <cugraph/mtmg/renumber_map.hpp>
 #include <cugraph/mtmg/resource_manager.hpp>
 #include <cugraph/mtmg/vertex_result.hpp>
+#include <cugraph/mtmg/vertex_result_gather_batcher.hpp>
 
 #include <raft/util/cudart_utils.hpp>
 
@@ -305,17 +306,16 @@ class Tests_Multithreaded
     auto pageranks_view    = pageranks.view();
     auto renumber_map_view = renumber_map ? std::make_optional(renumber_map->view()) : std::nullopt;
 
-    // Load computed_pageranks from different threads.
-    for (int i = 0; i < num_gpus; ++i) {
+    // Load computed_pageranks from different threads, the gathers of the threads sharing a GPU
+    // are combined into one collective
+    cugraph::mtmg::vertex_result_gather_batcher_t<vertex_t, edge_t, result_t, true, multi_gpu>
+      gather_batcher(pageranks_view, graph_view, renumber_map_view, num_threads_per_gpu);
+
+    for (int i = 0; i < num_threads; ++i) {
       running_threads.emplace_back([&instance_manager,
-                                    &graph_view,
-                                    &renumber_map_view,
-                                    &pageranks_view,
+                                    &gather_batcher,
                                     &computed_pageranks_lock,
                                     &computed_pageranks_v,
-                                    &h_src_v,
-                                    &h_dst_v,
-                                    &h_weights_v,
                                     &unique_vertices,
                                     i,
                                     num_threads]() {
@@ -330,25 +330,12 @@ class Tests_Multithreaded
           my_vertex_list.push_back(unique_vertices[j]);
         }
 
-        rmm::device_uvector<vertex_t> d_my_vertex_list(my_vertex_list.size(),
-                                                       thread_handle.raft_handle().get_stream());
-        raft::update_device(d_my_vertex_list.data(),
-                            my_vertex_list.data(),
-                            my_vertex_list.size(),
-                            thread_handle.raft_handle().get_stream());
-
-        auto d_my_pageranks = pageranks_view.gather(
+        auto my_result = gather_batcher.gather(
           thread_handle,
-          raft::device_span<vertex_t const>{d_my_vertex_list.data(), d_my_vertex_list.size()},
-          graph_view.get_vertex_partition_range_lasts(thread_handle),
-          graph_view.get_vertex_partition_view(thread_handle),
-          renumber_map_view);
-
-        std::vector<result_t> my_pageranks(d_my_pageranks.size());
-        raft::update_host(my_pageranks.data(),
-                          d_my_pageranks.data(),
-                          d_my_pageranks.size(),
-                          thread_handle.raft_handle().get_stream());
+          raft::host_span<vertex_t const>{my_vertex_list.data(), my_vertex_list.size()});
+
+        auto h_my_pageranks = my_result.get();
+        std::vector<result_t> my_pageranks(h_my_pageranks.begin(), h_my_pageranks.end());
 
         {
           std::lock_guard<std::mutex> lock(computed_pageranks_lock);
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utilities/base_fixture.hpp"
+#include "utilities/check_utilities.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+#include "utilities/thrust_wrapper.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/mtmg/edgelist.hpp>
+#include <cugraph/mtmg/graph.hpp>
+#include <cugraph/mtmg/per_thread_edgelist.hpp>
+#include <cugraph/mtmg/query_scheduler.hpp>
+#include <cugraph/mtmg/renumber_map.hpp>
+#include <cugraph/mtmg/resource_manager.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+
+#include <gtest/gtest.h>
+#include <nccl.h>
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+struct QueryScheduler_Usecase {
+  bool test_weighted{false};
+  size_t num_lanes{2};
+  size_t num_queries{8};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_QueryScheduler
+  : public ::testing::TestWithParam<std::tuple<QueryScheduler_Usecase, input_usecase_t>> {
+ public:
+  Tests_QueryScheduler() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  std::vector<int> get_gpu_list()
+  {
+    int num_gpus_per_node{1};
+    RAFT_CUDA_TRY(cudaGetDeviceCount(&num_gpus_per_node));
+
+    std::vector<int> gpu_list(num_gpus_per_node);
+    std::iota(gpu_list.begin(), gpu_list.end(), 0);
+
+    return gpu_list;
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename result_t,
+            bool multi_gpu>
+  void run_current_test(
+    std::tuple<QueryScheduler_Usecase const&, input_usecase_t const&> const& param,
+    std::vector<int> gpu_list)
+  {
+    using edge_type_t = int32_t;
+
+    constexpr bool renumber           = true;
+    constexpr bool do_expensive_check = false;
+
+    auto [query_scheduler_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+
+    result_t constexpr epsilon{1e-6};
+
+    size_t device_buffer_size{64 * 1024 * 1024};
+    size_t thread_buffer_size{4 * 1024 * 1024};
+
+    int num_gpus = gpu_list.size();
+
+    cugraph::mtmg::resource_manager_t resource_manager;
+
+    std::for_each(gpu_list.begin(), gpu_list.end(), [&resource_manager](int gpu_id) {
+      resource_manager.register_local_gpu(gpu_id, rmm::cuda_device_id{gpu_id});
+    });
+
+    ncclUniqueId instance_manager_id;
+    ncclGetUniqueId(&instance_manager_id);
+
+    auto instance_manager = resource_manager.create_instance_manager(
+      resource_manager.registered_ranks(), instance_manager_id, 1);
+
+    cugraph::mtmg::edgelist_t<vertex_t, weight_t, edge_t, edge_type_t> edgelist;
+    cugraph::mtmg::graph_t<vertex_t, edge_t, true, multi_gpu> graph;
+    cugraph::mtmg::graph_view_t<vertex_t, edge_t, true, multi_gpu> graph_view;
+    std::optional<cugraph::mtmg::renumber_map_t<vertex_t>> renumber_map =
+      std::make_optional<cugraph::mtmg::renumber_map_t<vertex_t>>();
+
+    auto edge_weights = query_scheduler_usecase.test_weighted
+                          ? std::make_optional<cugraph::mtmg::edge_property_t<
+                              cugraph::mtmg::graph_view_t<vertex_t, edge_t, true, multi_gpu>,
+                              weight_t>>()
+                          : std::nullopt;
+
+    // 1. create the graph with an instance manager (one thread per GPU)
+
+    rmm::device_uvector<vertex_t> d_src_v(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dst_v(0, handle.get_stream());
+    std::optional<rmm::device_uvector<weight_t>> d_weights_v{std::nullopt};
+    std::optional<rmm::device_uvector<vertex_t>> d_vertices_v{std::nullopt};
+    bool is_symmetric{};
+    {
+      std::vector<rmm::device_uvector<vertex_t>> src_chunks{};
+      std::vector<rmm::device_uvector<vertex_t>> dst_chunks{};
+      std::optional<std::vector<rmm::device_uvector<weight_t>>> weight_chunks{std::nullopt};
+      std::tie(src_chunks, dst_chunks, weight_chunks, d_vertices_v, is_symmetric) =
+        input_usecase.template construct_edgelist<vertex_t, weight_t>(
+          handle, query_scheduler_usecase.test_weighted, false, false);
+
+      std::tie(d_src_v, d_dst_v, d_weights_v) = cugraph::test::detail::concatenate_edge_chunks(
+        handle, std::move(src_chunks), std::move(dst_chunks), std::move(weight_chunks));
+    }
+
+    auto h_src_v     = cugraph::test::to_host(handle, d_src_v);
+    auto h_dst_v     = cugraph::test::to_host(handle, d_dst_v);
+    auto h_weights_v = cugraph::test::to_host(handle, d_weights_v);
+
+    std::vector<std::thread> running_threads;
+
+    for (int i = 0; i < num_gpus; ++i) {
+      running_threads.emplace_back([&instance_manager,
+                                    &edgelist,
+                                    &graph,
+                                    &edge_weights,
+                                    &renumber_map,
+                                    &h_src_v,
+                                    &h_dst_v,
+                                    &h_weights_v,
+                                    device_buffer_size,
+                                    thread_buffer_size,
+                                    num_gpus,
+                                    is_symmetric = is_symmetric,
+                                    renumber,
+                                    do_expensive_check]() {
+        auto thread_handle = instance_manager->get_handle();
+
+        edgelist.set(thread_handle, device_buffer_size, true, false, false);
+
+        {
+          cugraph::mtmg::per_thread_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t>
+            per_thread_edgelist(edgelist.get(thread_handle), thread_buffer_size);
+
+          for (size_t j = thread_handle.get_rank(); j < h_src_v.size(); j += num_gpus) {
+            per_thread_edgelist.append(
+              h_src_v[j],
+              h_dst_v[j],
+              h_weights_v ? std::make_optional((*h_weights_v)[j]) : std::nullopt,
+              std::nullopt,
+              std::nullopt,
+              thread_handle.get_stream());
+          }
+
+          per_thread_edgelist.flush(thread_handle.get_stream());
+        }
+
+        std::optional<cugraph::mtmg::edge_property_t<
+          cugraph::mtmg::graph_view_t<vertex_t, edge_t, true, multi_gpu>,
+          edge_t>>
+          edge_ids{std::nullopt};
+        std::optional<cugraph::mtmg::edge_property_t<
+          cugraph::mtmg::graph_view_t<vertex_t, edge_t, true, multi_gpu>,
+          int32_t>>
+          edge_types{std::nullopt};
+
+        edgelist.finalize_buffer(thread_handle);
+        edgelist.consolidate_and_shuffle(thread_handle, true);
+
+        cugraph::mtmg::
+          create_graph_from_edgelist<vertex_t, edge_t, weight_t, edge_t, int32_t, true, multi_gpu>(
+            thread_handle,
+            edgelist,
+            cugraph::graph_properties_t{is_symmetric, true},
+            renumber,
+            graph,
+            edge_weights,
+            edge_ids,
+            edge_types,
+            renumber_map,
+            do_expensive_check);
+      });
+    }
+
+    std::for_each(running_threads.begin(), running_threads.end(), [](auto& t) { t.join(); });
+    running_threads.resize(0);
+    instance_manager->reset_threads();
+
+    graph_view = graph.view();
+
+    // 2. submit PageRank queries (with a different alpha each) from multiple threads, each query
+    // stores the global maximum PageRank value (which does not depend on the renumbering)
+
+    std::vector<ncclUniqueId> lane_ids(query_scheduler_usecase.num_lanes);
+    std::for_each(lane_ids.begin(), lane_ids.end(), [](auto& id) { ncclGetUniqueId(&id); });
+
+    auto query_scheduler =
+      resource_manager.create_query_scheduler(resource_manager.registered_ranks(), lane_ids);
+    ASSERT_EQ(query_scheduler->get_lane_count(), query_scheduler_usecase.num_lanes);
+
+    auto alpha = [](size_t query_id) {
+      return result_t{0.5} + result_t{0.05} * static_cast<result_t>(query_id % 10);
+    };
+
+    std::vector<result_t> max_pageranks(query_scheduler_usecase.num_queries, result_t{0});
+    std::atomic<size_t> num_invocations{0};
+    std::vector<std::future<void>> futures(query_scheduler_usecase.num_queries);
+
+    std::vector<std::thread> submitting_threads;
+    size_t num_submitting_threads{2};
+    for (size_t i = 0; i < num_submitting_threads; ++i) {
+      submitting_threads.emplace_back([&, i]() {
+        for (size_t q = i; q < query_scheduler_usecase.num_queries; q += num_submitting_threads) {
+          futures[q] = query_scheduler->submit([&, q](cugraph::mtmg::handle_t const& lane_handle) {
+            ++num_invocations;
+
+            auto [local_pageranks, metadata] =
+              cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, true>(
+                lane_handle.raft_handle(),
+                graph_view.get(lane_handle),
+                edge_weights ? std::make_optional(edge_weights->get(lane_handle).view())
+                             : std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                alpha(q),
+                epsilon,
+                500,
+                true);
+
+            auto local_max = thrust::reduce(lane_handle.raft_handle().get_thrust_policy(),
+                                            local_pageranks.begin(),
+                                            local_pageranks.end(),
+                                            result_t{0},
+                                            thrust::maximum<result_t>{});
+            auto global_max =
+              cugraph::host_scalar_allreduce(lane_handle.raft_handle().get_comms(),
+                                             local_max,
+                                             raft::comms::op_t::MAX,
+                                             lane_handle.raft_handle().get_stream());
+            if (lane_handle.get_rank() == 0) { max_pageranks[q] = global_max; }
+          });
+        }
+      });
+    }
+    std::for_each(submitting_threads.begin(), submitting_threads.end(), [](auto& t) { t.join(); });
+
+    // 3. every query should complete on every GPU
+
+    std::for_each(futures.begin(), futures.end(), [](auto& f) { ASSERT_NO_THROW(f.get()); });
+    ASSERT_EQ(num_invocations.load(), query_scheduler_usecase.num_queries * num_gpus);
+
+    // an exception thrown by a query is reported through its future and does not stop the lane
+
+    auto failing_future = query_scheduler->submit(
+      [](cugraph::mtmg::handle_t const&) { throw std::runtime_error("query failure"); });
+    ASSERT_THROW(failing_future.get(), std::runtime_error);
+    for (size_t i = 0; i < query_scheduler_usecase.num_lanes; ++i) {
+      ASSERT_NO_THROW(query_scheduler->submit([](cugraph::mtmg::handle_t const&) {}).get());
+    }
+
+    if (query_scheduler_usecase.check_correctness) {
+      // 4. compare with SG PageRank
+
+      cugraph::graph_t<vertex_t, edge_t, true, false> sg_graph(handle);
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, true, false>, weight_t>>
+        sg_edge_weights{std::nullopt};
+      std::tie(sg_graph, sg_edge_weights, std::ignore, std::ignore, std::ignore) = cugraph::
+        create_graph_from_edgelist<vertex_t, edge_t, weight_t, edge_t, int32_t, true, false>(
+          handle,
+          std::nullopt,
+          std::move(d_src_v),
+          std::move(d_dst_v),
+          std::move(d_weights_v),
+          std::nullopt,
+          std::nullopt,
+          cugraph::graph_properties_t{is_symmetric, true},
+          true);
+
+      for (size_t q = 0; q < query_scheduler_usecase.num_queries; ++q) {
+        auto [sg_pageranks, metadata] =
+          cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, false>(
+            handle,
+            sg_graph.view(),
+            sg_edge_weights ? std::make_optional(sg_edge_weights->view()) : std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            alpha(q),
+            epsilon);
+        auto sg_max_pagerank = thrust::reduce(handle.get_thrust_policy(),
+                                              sg_pageranks.begin(),
+                                              sg_pageranks.end(),
+                                              result_t{0},
+                                              thrust::maximum<result_t>{});
+
+        auto compare_functor = cugraph::test::nearly_equal<result_t>{
+          result_t{1e-3},
+          (result_t{1} / static_cast<result_t>(sg_pageranks.size())) * result_t{1e-3}};
+        ASSERT_TRUE(compare_functor(max_pageranks[q], sg_max_pagerank))
+          << "query " << q << ", SG max PageRank = " << sg_max_pagerank
+          << ", query scheduler max PageRank = " << max_pageranks[q];
+      }
+    }
+  }
+};
+
+using Tests_QueryScheduler_File = Tests_QueryScheduler<cugraph::test::File_Usecase>;
+using Tests_QueryScheduler_Rmat = Tests_QueryScheduler<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_QueryScheduler_File, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float, true>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()), std::vector<int>{{0, 1}});
+}
+
+TEST_P(Tests_QueryScheduler_Rmat, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float, true>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()), std::vector<int>{{0, 1}});
+}
+
+INSTANTIATE_TEST_SUITE_P(file_test,
+                         Tests_QueryScheduler_File,
+                         ::testing::Combine(
+                           // enable correctness checks
+                           ::testing::Values(QueryScheduler_Usecase{false, 1, 4, true},
+                                             QueryScheduler_Usecase{false, 2, 8, true},
+                                             QueryScheduler_Usecase{true, 3, 8, true}),
+                           ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                                             cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_QueryScheduler_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(QueryScheduler_Usecase{false, 2, 8, true},
+                      QueryScheduler_Usecase{true, 4, 16, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_QueryScheduler_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(QueryScheduler_Usecase{true, 4, 64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
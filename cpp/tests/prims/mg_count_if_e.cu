@@ -15,6 +15,7 @@
  */
 
 #include "prims/count_if_e.cuh"
+#include "prims/update_edge_src_dst_property.cuh"
 #include "utilities/base_fixture.hpp"
 #include "utilities/conversion_utilities.hpp"
 #include "utilities/device_comm_wrapper.hpp"
@@ -150,6 +151,26 @@ class Tests_MGCountIfE
     // 3. compare SG & MG results
 
     if (prims_usecase.check_correctness) {
+      // edge src/dst property values storing only the vertices with non-default values should
+      // produce the same result
+
+      auto mg_sparse_src_prop = cugraph::create_sparse_edge_src_property(
+        *handle_, mg_graph_view, cugraph::get_dataframe_buffer_cbegin(mg_vertex_prop), result_t{});
+      auto mg_sparse_dst_prop = cugraph::create_sparse_edge_dst_property(
+        *handle_, mg_graph_view, cugraph::get_dataframe_buffer_cbegin(mg_vertex_prop), result_t{});
+
+      auto sparse_result =
+        count_if_e(*handle_,
+                   mg_graph_view,
+                   mg_sparse_src_prop.view(),
+                   mg_sparse_dst_prop.view(),
+                   cugraph::edge_dummy_property_t{}.view(),
+                   [] __device__(
+                     auto row, auto col, auto src_property, auto dst_property, cuda::std::nullopt_t) {
+                     return src_property < dst_property;
+                   });
+      ASSERT_TRUE(sparse_result == result);
+
       cugraph::graph_t<vertex_t, edge_t, store_transposed, false> sg_graph(*handle_);
       std::tie(sg_graph, std::ignore, std::ignore, std::ignore, std::ignore) =
         cugraph::test::mg_graph_to_sg_graph(
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prims/edge_expression.cuh"
+#include "prims/reduce_op.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+struct Prims_Usecase {
+  bool edge_masking{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGEdgeExpression
+  : public ::testing::TestWithParam<std::tuple<Prims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGEdgeExpression() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of evaluating a composed edge expression in a single pass with the results
+  // of materializing the intermediate edge property values first
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(Prims_Usecase const& prims_usecase, input_usecase_t const& input_usecase)
+  {
+    using result_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    // 1. create MG graph
+
+    cugraph::graph_t<vertex_t, edge_t, false, true> mg_graph(*handle_);
+    std::optional<rmm::device_uvector<vertex_t>> mg_renumber_map{std::nullopt};
+    std::tie(mg_graph, std::ignore, mg_renumber_map) =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    std::optional<cugraph::edge_property_t<decltype(mg_graph_view), bool>> edge_mask{std::nullopt};
+    if (prims_usecase.edge_masking) {
+      edge_mask = cugraph::test::generate<decltype(mg_graph_view), bool>::edge_property(
+        *handle_, mg_graph_view, 2);
+      mg_graph_view.attach_edge_mask((*edge_mask).view());
+    }
+
+    // 2. build the expression ((src value + dst value) * edge value, then * 2 + 1)
+
+    int const hash_bin_count = 5;
+
+    auto mg_vertex_prop =
+      cugraph::test::generate<decltype(mg_graph_view), result_t>::vertex_property(
+        *handle_, *mg_renumber_map, hash_bin_count);
+    auto mg_src_prop = cugraph::test::generate<decltype(mg_graph_view), result_t>::src_property(
+      *handle_, mg_graph_view, mg_vertex_prop);
+    auto mg_dst_prop = cugraph::test::generate<decltype(mg_graph_view), result_t>::dst_property(
+      *handle_, mg_graph_view, mg_vertex_prop);
+    auto mg_edge_prop = cugraph::test::generate<decltype(mg_graph_view), result_t>::edge_property(
+      *handle_, mg_graph_view, hash_bin_count);
+
+    auto first_op = [] __device__(auto, auto, result_t src_val, result_t dst_val, result_t e_val) {
+      return (src_val + dst_val) * e_val;
+    };
+    auto second_op = [] __device__(auto, auto, result_t, result_t, result_t val) {
+      return val * 2 + 1;
+    };
+
+    auto expression =
+      cugraph::make_edge_expression(
+        mg_src_prop.view(), mg_dst_prop.view(), mg_edge_prop.view(), first_op)
+        .then(second_op);
+
+    // 3. evaluate the expression in a single pass
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG fused edge expression");
+    }
+
+    auto fused_sum = cugraph::transform_reduce_e(*handle_, mg_graph_view, expression, result_t{0});
+    rmm::device_uvector<result_t> fused_out_sums(mg_graph_view.local_vertex_partition_range_size(),
+                                                 handle_->get_stream());
+    cugraph::per_v_transform_reduce_outgoing_e(*handle_,
+                                               mg_graph_view,
+                                               expression,
+                                               result_t{0},
+                                               cugraph::reduce_op::plus<result_t>{},
+                                               fused_out_sums.begin());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 4. compare with materializing the intermediate values
+
+    if (prims_usecase.check_correctness) {
+      cugraph::edge_property_t<decltype(mg_graph_view), result_t> intermediate(*handle_,
+                                                                               mg_graph_view);
+      cugraph::transform_e(*handle_,
+                           mg_graph_view,
+                           cugraph::make_edge_expression(
+                             mg_src_prop.view(), mg_dst_prop.view(), mg_edge_prop.view(), first_op),
+                           intermediate.mutable_view());
+
+      auto expected_sum = cugraph::transform_reduce_e(*handle_,
+                                                      mg_graph_view,
+                                                      mg_src_prop.view(),
+                                                      mg_dst_prop.view(),
+                                                      intermediate.view(),
+                                                      second_op,
+                                                      result_t{0});
+      rmm::device_uvector<result_t> expected_out_sums(
+        mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      cugraph::per_v_transform_reduce_outgoing_e(*handle_,
+                                                 mg_graph_view,
+                                                 mg_src_prop.view(),
+                                                 mg_dst_prop.view(),
+                                                 intermediate.view(),
+                                                 second_op,
+                                                 result_t{0},
+                                                 cugraph::reduce_op::plus<result_t>{},
+                                                 expected_out_sums.begin());
+
+      ASSERT_EQ(fused_sum, expected_sum);
+      ASSERT_EQ(cugraph::test::to_host(*handle_, fused_out_sums),
+                cugraph::test::to_host(*handle_, expected_out_sums));
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGEdgeExpression<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGEdgeExpression_File = Tests_MGEdgeExpression<cugraph::test::File_Usecase>;
+using Tests_MGEdgeExpression_Rmat = Tests_MGEdgeExpression<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGEdgeExpression_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGEdgeExpression_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGEdgeExpression_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGEdgeExpression_File,
+  ::testing::Combine(::testing::Values(Prims_Usecase{false, true}, Prims_Usecase{true, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGEdgeExpression_Rmat,
+                         ::testing::Combine(::testing::Values(Prims_Usecase{false, true},
+                                                              Prims_Usecase{true, true}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGEdgeExpression_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Prims_Usecase{false, false}, Prims_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prims/per_v_top_k_outgoing_e.cuh"
+#include "prims/sample_sort.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/functional.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+struct Prims_Usecase {
+  size_t k{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGPerVTopKOutgoingE
+  : public ::testing::TestWithParam<std::tuple<Prims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGPerVTopKOutgoingE() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of per_v_top_k_outgoing_e & sample_sort primitives with the SG results
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Prims_Usecase const& prims_usecase, input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+
+    HighResTimer hr_timer{};
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG Construct graph");
+    }
+
+    cugraph::graph_t<vertex_t, edge_t, false, true> mg_graph(*handle_);
+    std::optional<cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, true>,
+                                           weight_t>>
+      mg_edge_weights{std::nullopt};
+    std::optional<rmm::device_uvector<vertex_t>> mg_renumber_map{std::nullopt};
+    std::tie(mg_graph, mg_edge_weights, mg_renumber_map) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, true, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto mg_graph_view       = mg_graph.view();
+    auto mg_edge_weight_view = (*mg_edge_weights).view();
+
+    // 2. run MG per_v_top_k_outgoing_e & sample_sort
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG per_v_top_k_outgoing_e");
+    }
+
+    auto [mg_offsets, mg_dsts, mg_values] = cugraph::per_v_top_k_outgoing_e(
+      *handle_, mg_graph_view, mg_edge_weight_view, prims_usecase.k, thrust::greater<weight_t>{});
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    std::vector<vertex_t> h_keys(size_t{1} << 12);
+    std::mt19937 gen(handle_->get_comms().get_rank());
+    std::uniform_int_distribution<vertex_t> dist(0, vertex_t{1} << 10);  // create duplicates
+    std::generate(h_keys.begin(), h_keys.end(), [&] { return dist(gen); });
+    auto mg_sorted_keys = cugraph::sample_sort<vertex_t, true>(
+      *handle_, cugraph::test::to_device(*handle_, h_keys), size_t{16});
+
+    // 3. compare SG & MG results
+
+    if (prims_usecase.check_correctness) {
+      // selected values per source (tie breaking differs as SG uses external vertex IDs)
+
+      auto h_mg_offsets      = cugraph::test::to_host(*handle_, mg_offsets);
+      auto h_mg_values       = cugraph::test::to_host(*handle_, mg_values);
+      auto h_mg_renumber_map = cugraph::test::to_host(*handle_, *mg_renumber_map);
+      std::vector<vertex_t> h_mg_srcs(h_mg_values.size());
+      for (size_t i = 0; i + 1 < h_mg_offsets.size(); ++i) {
+        ASSERT_LE(h_mg_offsets[i + 1] - h_mg_offsets[i], prims_usecase.k);
+        std::fill(h_mg_srcs.begin() + h_mg_offsets[i],
+                  h_mg_srcs.begin() + h_mg_offsets[i + 1],
+                  h_mg_renumber_map[i]);
+      }
+      auto d_mg_srcs   = cugraph::test::to_device(*handle_, h_mg_srcs);
+      auto d_mg_values = cugraph::test::to_device(*handle_, h_mg_values);
+      auto mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto mg_aggregate_values =
+        cugraph::test::device_gatherv(*handle_, d_mg_values.data(), d_mg_values.size());
+      auto mg_aggregate_keys =
+        cugraph::test::device_gatherv(*handle_, mg_sorted_keys.data(), mg_sorted_keys.size());
+      auto d_keys = cugraph::test::to_device(*handle_, h_keys);
+      auto mg_aggregate_input_keys =
+        cugraph::test::device_gatherv(*handle_, d_keys.data(), d_keys.size());
+
+      cugraph::graph_t<vertex_t, edge_t, false, false> sg_graph(*handle_);
+      std::optional<
+        cugraph::edge_property_t<cugraph::graph_view_t<vertex_t, edge_t, false, false>, weight_t>>
+        sg_edge_weights{std::nullopt};
+      std::tie(sg_graph, sg_edge_weights, std::ignore, std::ignore, std::ignore) =
+        cugraph::test::mg_graph_to_sg_graph(
+          *handle_,
+          mg_graph_view,
+          std::make_optional(mg_edge_weight_view),
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_type_t const*>>{std::nullopt},
+          std::make_optional<raft::device_span<vertex_t const>>((*mg_renumber_map).data(),
+                                                                (*mg_renumber_map).size()),
+          false);
+
+      if (handle_->get_comms().get_rank() == 0) {
+        auto sg_graph_view = sg_graph.view();
+
+        auto [sg_offsets, sg_dsts, sg_values] =
+          cugraph::per_v_top_k_outgoing_e(*handle_,
+                                          sg_graph_view,
+                                          (*sg_edge_weights).view(),
+                                          prims_usecase.k,
+                                          thrust::greater<weight_t>{});
+
+        auto h_sg_offsets = cugraph::test::to_host(*handle_, sg_offsets);
+        auto h_sg_values  = cugraph::test::to_host(*handle_, sg_values);
+        std::vector<std::pair<vertex_t, weight_t>> sg_pairs{};
+        for (size_t i = 0; i + 1 < h_sg_offsets.size(); ++i) {
+          for (size_t j = h_sg_offsets[i]; j < h_sg_offsets[i + 1]; ++j) {
+            sg_pairs.push_back(std::make_pair(static_cast<vertex_t>(i), h_sg_values[j]));
+          }
+        }
+
+        auto h_mg_aggregate_srcs   = cugraph::test::to_host(*handle_, mg_aggregate_srcs);
+        auto h_mg_aggregate_values = cugraph::test::to_host(*handle_, mg_aggregate_values);
+        std::vector<std::pair<vertex_t, weight_t>> mg_pairs(h_mg_aggregate_srcs.size());
+        for (size_t i = 0; i < mg_pairs.size(); ++i) {
+          mg_pairs[i] = std::make_pair(h_mg_aggregate_srcs[i], h_mg_aggregate_values[i]);
+        }
+
+        std::sort(sg_pairs.begin(), sg_pairs.end());
+        std::sort(mg_pairs.begin(), mg_pairs.end());
+        ASSERT_TRUE(sg_pairs == mg_pairs)
+          << "MG per_v_top_k_outgoing_e results do not match with the SG results.";
+
+        // sample_sort results should be globally sorted (in the rank order) and a permutation of
+        // the input keys
+
+        auto h_mg_aggregate_keys = cugraph::test::to_host(*handle_, mg_aggregate_keys);
+        auto h_mg_aggregate_input_keys =
+          cugraph::test::to_host(*handle_, mg_aggregate_input_keys);
+        std::sort(h_mg_aggregate_input_keys.begin(), h_mg_aggregate_input_keys.end());
+        ASSERT_TRUE(h_mg_aggregate_keys == h_mg_aggregate_input_keys)
+          << "MG sample_sort results are not globally sorted.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGPerVTopKOutgoingE<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGPerVTopKOutgoingE_File = Tests_MGPerVTopKOutgoingE<cugraph::test::File_Usecase>;
+using Tests_MGPerVTopKOutgoingE_Rmat = Tests_MGPerVTopKOutgoingE<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGPerVTopKOutgoingE_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGPerVTopKOutgoingE_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGPerVTopKOutgoingE_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGPerVTopKOutgoingE_File,
+  ::testing::Combine(::testing::Values(Prims_Usecase{1}, Prims_Usecase{4}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGPerVTopKOutgoingE_Rmat,
+                         ::testing::Combine(::testing::Values(Prims_Usecase{8}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGPerVTopKOutgoingE_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Prims_Usecase{16, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
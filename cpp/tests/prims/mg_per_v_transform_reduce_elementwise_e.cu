@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prims/per_v_transform_reduce_incoming_outgoing_e.cuh"
+#include "prims/reduce_op.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/edge_property.hpp>
+#include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+template <typename vertex_t, typename result_t>
+struct sum_min_max_e_op_t {
+  __device__ thrust::tuple<result_t, result_t, result_t> operator()(
+    vertex_t, vertex_t, result_t src_property, result_t dst_property, cuda::std::nullopt_t) const
+  {
+    return thrust::make_tuple(src_property + dst_property,
+                              src_property < dst_property ? src_property : dst_property,
+                              src_property < dst_property ? dst_property : src_property);
+  }
+};
+
+template <typename vertex_t, typename result_t, size_t I>
+struct element_e_op_t {
+  __device__ result_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 result_t src_property,
+                                 result_t dst_property,
+                                 cuda::std::nullopt_t) const
+  {
+    return thrust::get<I>(sum_min_max_e_op_t<vertex_t, result_t>{}(
+      src, dst, src_property, dst_property, cuda::std::nullopt));
+  }
+};
+
+struct Prims_Usecase {
+  bool edge_masking{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGPerVTransformReduceElementwiseE
+  : public ::testing::TestWithParam<std::tuple<Prims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGPerVTransformReduceElementwiseE() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of a single per_v_transform_reduce_incoming|outgoing_e call with
+  // reduce_op::elementwise (sum, min, and max) with the results of separate calls per reduction
+  template <typename vertex_t, typename edge_t, bool store_transposed>
+  void run_current_test(Prims_Usecase const& prims_usecase, input_usecase_t const& input_usecase)
+  {
+    using result_t = int32_t;
+    using reduce_op_t =
+      cugraph::reduce_op::elementwise<cugraph::reduce_op::plus<result_t>,
+                                      cugraph::reduce_op::minimum<result_t>,
+                                      cugraph::reduce_op::maximum<result_t>>;
+
+    HighResTimer hr_timer{};
+
+    // 1. create MG graph
+
+    cugraph::graph_t<vertex_t, edge_t, store_transposed, true> mg_graph(*handle_);
+    std::optional<rmm::device_uvector<vertex_t>> mg_renumber_map{std::nullopt};
+    std::tie(mg_graph, std::ignore, mg_renumber_map) =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, store_transposed, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    std::optional<cugraph::edge_property_t<decltype(mg_graph_view), bool>> edge_mask{std::nullopt};
+    if (prims_usecase.edge_masking) {
+      edge_mask = cugraph::test::generate<decltype(mg_graph_view), bool>::edge_property(
+        *handle_, mg_graph_view, 2);
+      mg_graph_view.attach_edge_mask((*edge_mask).view());
+    }
+
+    int const hash_bin_count = 5;
+    result_t const init      = 4;
+
+    auto mg_vertex_prop =
+      cugraph::test::generate<decltype(mg_graph_view), result_t>::vertex_property(
+        *handle_, *mg_renumber_map, hash_bin_count);
+    auto mg_src_prop = cugraph::test::generate<decltype(mg_graph_view), result_t>::src_property(
+      *handle_, mg_graph_view, mg_vertex_prop);
+    auto mg_dst_prop = cugraph::test::generate<decltype(mg_graph_view), result_t>::dst_property(
+      *handle_, mg_graph_view, mg_vertex_prop);
+
+    auto local_size = mg_graph_view.local_vertex_partition_range_size();
+
+    // 2. run the batched reductions (one edge pass per direction)
+
+    std::array<rmm::device_uvector<result_t>, 3> in_results{
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream())};
+    std::array<rmm::device_uvector<result_t>, 3> out_results{
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+      rmm::device_uvector<result_t>(local_size, handle_->get_stream())};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG per_v_transform_reduce_incoming|outgoing_e (elementwise)");
+    }
+
+    per_v_transform_reduce_incoming_e(
+      *handle_,
+      mg_graph_view,
+      mg_src_prop.view(),
+      mg_dst_prop.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      sum_min_max_e_op_t<vertex_t, result_t>{},
+      thrust::make_tuple(init, init, init),
+      reduce_op_t{},
+      thrust::make_zip_iterator(thrust::make_tuple(
+        in_results[0].begin(), in_results[1].begin(), in_results[2].begin())));
+    per_v_transform_reduce_outgoing_e(
+      *handle_,
+      mg_graph_view,
+      mg_src_prop.view(),
+      mg_dst_prop.view(),
+      cugraph::edge_dummy_property_t{}.view(),
+      sum_min_max_e_op_t<vertex_t, result_t>{},
+      thrust::make_tuple(init, init, init),
+      reduce_op_t{},
+      thrust::make_zip_iterator(thrust::make_tuple(
+        out_results[0].begin(), out_results[1].begin(), out_results[2].begin())));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 3. compare with separate reductions
+
+    if (prims_usecase.check_correctness) {
+      std::array<rmm::device_uvector<result_t>, 3> expected_in_results{
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream())};
+      std::array<rmm::device_uvector<result_t>, 3> expected_out_results{
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream()),
+        rmm::device_uvector<result_t>(local_size, handle_->get_stream())};
+
+      auto run_separate = [&](auto e_op, auto reduce_op, size_t i) {
+        per_v_transform_reduce_incoming_e(*handle_,
+                                          mg_graph_view,
+                                          mg_src_prop.view(),
+                                          mg_dst_prop.view(),
+                                          cugraph::edge_dummy_property_t{}.view(),
+                                          e_op,
+                                          init,
+                                          reduce_op,
+                                          expected_in_results[i].begin());
+        per_v_transform_reduce_outgoing_e(*handle_,
+                                          mg_graph_view,
+                                          mg_src_prop.view(),
+                                          mg_dst_prop.view(),
+                                          cugraph::edge_dummy_property_t{}.view(),
+                                          e_op,
+                                          init,
+                                          reduce_op,
+                                          expected_out_results[i].begin());
+      };
+      run_separate(element_e_op_t<vertex_t, result_t, 0>{},
+                   cugraph::reduce_op::plus<result_t>{},
+                   size_t{0});
+      run_separate(element_e_op_t<vertex_t, result_t, 1>{},
+                   cugraph::reduce_op::minimum<result_t>{},
+                   size_t{1});
+      run_separate(element_e_op_t<vertex_t, result_t, 2>{},
+                   cugraph::reduce_op::maximum<result_t>{},
+                   size_t{2});
+
+      for (size_t i = 0; i < in_results.size(); ++i) {
+        ASSERT_EQ(cugraph::test::to_host(*handle_, in_results[i]),
+                  cugraph::test::to_host(*handle_, expected_in_results[i]))
+          << "incoming reduction " << i << " does not match.";
+        ASSERT_EQ(cugraph::test::to_host(*handle_, out_results[i]),
+                  cugraph::test::to_host(*handle_, expected_out_results[i]))
+          << "outgoing reduction " << i << " does not match.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGPerVTransformReduceElementwiseE<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGPerVTransformReduceElementwiseE_File =
+  Tests_MGPerVTransformReduceElementwiseE<cugraph::test::File_Usecase>;
+using Tests_MGPerVTransformReduceElementwiseE_Rmat =
+  Tests_MGPerVTransformReduceElementwiseE<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGPerVTransformReduceElementwiseE_File, CheckInt32Int32TransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGPerVTransformReduceElementwiseE_File, CheckInt32Int32TransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGPerVTransformReduceElementwiseE_Rmat, CheckInt32Int32TransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGPerVTransformReduceElementwiseE_Rmat, CheckInt64Int64TransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, true>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGPerVTransformReduceElementwiseE_File,
+  ::testing::Combine(::testing::Values(Prims_Usecase{false, true}, Prims_Usecase{true, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(rmat_small_test,
+                         Tests_MGPerVTransformReduceElementwiseE_Rmat,
+                         ::testing::Combine(::testing::Values(Prims_Usecase{false, true},
+                                                              Prims_Usecase{true, true}),
+                                            ::testing::Values(cugraph::test::Rmat_Usecase(
+                                              10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGPerVTransformReduceElementwiseE_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Prims_Usecase{false, false}, Prims_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
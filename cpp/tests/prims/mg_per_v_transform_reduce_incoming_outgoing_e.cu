@@ -28,6 +28,7 @@
 #include <cugraph/algorithms.hpp>
 #include <cugraph/edge_partition_view.hpp>
 #include <cugraph/edge_src_dst_property.hpp>
+#include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/utilities/dataframe_buffer.hpp>
 #include <cugraph/utilities/high_res_timer.hpp>
@@ -76,6 +77,7 @@ struct Prims_Usecase {
   bool test_weighted{false};
   bool edge_masking{false};
   bool check_correctness{true};
+  bool adaptive_degree_segments{false};
 };
 
 template <typename input_usecase_t>
@@ -103,6 +105,12 @@ class Tests_MGPerVTransformReduceIncomingOutgoingE
 
     HighResTimer hr_timer{};
 
+    // set for every test as handle_ is shared by the tests
+    cugraph::set_degree_segment_policy_hint(*handle_,
+                                            prims_usecase.adaptive_degree_segments
+                                              ? cugraph::degree_segment_policy_t::adaptive
+                                              : cugraph::degree_segment_policy_t::fixed);
+
     // 1. create MG graph
 
     if (cugraph::test::g_perf) {
@@ -582,7 +590,9 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Combine(::testing::Values(Prims_Usecase{false, false, true},
                                        Prims_Usecase{false, true, true},
                                        Prims_Usecase{true, false, true},
-                                       Prims_Usecase{true, true, true}),
+                                       Prims_Usecase{true, true, true},
+                                       Prims_Usecase{false, false, true, true},
+                                       Prims_Usecase{false, true, true, true}),
                      ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -602,7 +612,11 @@ INSTANTIATE_TEST_SUITE_P(rmat_small_test,
                          ::testing::Combine(::testing::Values(Prims_Usecase{false, false, true},
                                                               Prims_Usecase{false, true, true},
                                                               Prims_Usecase{true, false, true},
-                                                              Prims_Usecase{true, true, true}),
+                                                              Prims_Usecase{true, true, true},
+                                                              Prims_Usecase{
+                                                                false, false, true, true},
+                                                              Prims_Usecase{
+                                                                false, true, true, true}),
                                             ::testing::Values(cugraph::test::Rmat_Usecase(
                                               10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
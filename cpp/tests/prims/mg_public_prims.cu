@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This test uses only the public primitive interfaces (cugraph/prims.cuh) to implement a custom
+// algorithm (level synchronous BFS) and compares the results with cugraph::bfs.
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/prims.cuh>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda/std/optional>
+#include <thrust/fill.h>
+#include <thrust/tuple.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+template <typename vertex_t>
+struct custom_bfs_e_op_t {
+  __device__ cuda::std::optional<vertex_t> operator()(vertex_t src,
+                                                      vertex_t,
+                                                      cuda::std::nullopt_t,
+                                                      cuda::std::nullopt_t,
+                                                      cuda::std::nullopt_t) const
+  {
+    return src;
+  }
+};
+
+template <typename vertex_t>
+struct custom_bfs_v_op_t {
+  vertex_t depth{};
+  size_t next_bucket_idx{};
+
+  __device__ thrust::tuple<cuda::std::optional<size_t>, cuda::std::optional<vertex_t>> operator()(
+    vertex_t, vertex_t distance, vertex_t /* predecessor */) const
+  {
+    if (distance != std::numeric_limits<vertex_t>::max()) {  // already visited
+      return thrust::tuple<cuda::std::optional<size_t>, cuda::std::optional<vertex_t>>{
+        cuda::std::nullopt, cuda::std::nullopt};
+    }
+    return thrust::tuple<cuda::std::optional<size_t>, cuda::std::optional<vertex_t>>{
+      cuda::std::optional<size_t>{next_bucket_idx}, cuda::std::optional<vertex_t>{depth}};
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<vertex_t> custom_bfs(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, true> const& graph_view,
+  vertex_t source)
+{
+  constexpr size_t bucket_idx_cur  = 0;
+  constexpr size_t bucket_idx_next = 1;
+  constexpr size_t num_buckets     = 2;
+
+  rmm::device_uvector<vertex_t> distances(graph_view.local_vertex_partition_range_size(),
+                                          handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               distances.begin(),
+               distances.end(),
+               std::numeric_limits<vertex_t>::max());
+
+  cugraph::vertex_frontier_t<vertex_t, void, true, true> vertex_frontier(handle, num_buckets);
+  if (graph_view.in_local_vertex_partition_range_nocheck(source)) {
+    thrust::fill(handle.get_thrust_policy(),
+                 distances.begin() + (source - graph_view.local_vertex_partition_range_first()),
+                 distances.begin() + (source - graph_view.local_vertex_partition_range_first()) + 1,
+                 vertex_t{0});
+    vertex_frontier.bucket(bucket_idx_cur).insert(source);
+  }
+
+  vertex_t depth{0};
+  while (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0) {
+    ++depth;
+    auto [new_vertices, new_predecessors] =
+      cugraph::transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        graph_view,
+        vertex_frontier.bucket(bucket_idx_cur),
+        cugraph::edge_src_dummy_property_t{}.view(),
+        cugraph::edge_dst_dummy_property_t{}.view(),
+        cugraph::edge_dummy_property_t{}.view(),
+        custom_bfs_e_op_t<vertex_t>{},
+        cugraph::reduce_op::any<vertex_t>());
+
+    cugraph::update_v_frontier(handle,
+                               graph_view,
+                               std::move(new_vertices),
+                               std::move(new_predecessors),
+                               vertex_frontier,
+                               std::vector<size_t>{bucket_idx_next},
+                               distances.begin(),
+                               distances.begin(),
+                               custom_bfs_v_op_t<vertex_t>{depth, bucket_idx_next});
+
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+  }
+
+  return distances;
+}
+
+struct PublicPrims_Usecase {
+  size_t source{0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGPublicPrims
+  : public ::testing::TestWithParam<std::tuple<PublicPrims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGPublicPrims() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(PublicPrims_Usecase const& public_prims_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, mg_renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    ASSERT_TRUE(static_cast<vertex_t>(public_prims_usecase.source) >= 0 &&
+                static_cast<vertex_t>(public_prims_usecase.source) <
+                  mg_graph_view.number_of_vertices())
+      << "Invalid starting source.";
+
+    auto source = static_cast<vertex_t>(public_prims_usecase.source);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG custom BFS (public prims)");
+    }
+
+    auto d_mg_distances = custom_bfs(*handle_, mg_graph_view, source);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (public_prims_usecase.check_correctness) {
+      rmm::device_uvector<vertex_t> d_mg_bfs_distances(
+        mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      rmm::device_uvector<vertex_t> d_mg_bfs_predecessors(
+        mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      auto d_mg_source = mg_graph_view.in_local_vertex_partition_range_nocheck(source)
+                           ? std::make_optional<rmm::device_uvector<vertex_t>>(
+                               cugraph::test::to_device(*handle_, std::vector<vertex_t>{source}))
+                           : std::nullopt;
+      cugraph::bfs(*handle_,
+                   mg_graph_view,
+                   d_mg_bfs_distances.data(),
+                   d_mg_bfs_predecessors.data(),
+                   d_mg_source ? (*d_mg_source).data() : static_cast<vertex_t const*>(nullptr),
+                   d_mg_source ? size_t{1} : size_t{0},
+                   false,
+                   std::numeric_limits<vertex_t>::max());
+
+      ASSERT_EQ(cugraph::test::to_host(*handle_, d_mg_distances),
+                cugraph::test::to_host(*handle_, d_mg_bfs_distances))
+        << "distances computed with the public primitives do not match cugraph::bfs.";
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGPublicPrims<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGPublicPrims_File = Tests_MGPublicPrims<cugraph::test::File_Usecase>;
+using Tests_MGPublicPrims_Rmat = Tests_MGPublicPrims<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGPublicPrims_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGPublicPrims_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGPublicPrims_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGPublicPrims_File,
+  ::testing::Combine(::testing::Values(PublicPrims_Usecase{0}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGPublicPrims_Rmat,
+  ::testing::Combine(
+    ::testing::Values(PublicPrims_Usecase{0}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGPublicPrims_Rmat,
+  ::testing::Combine(
+    ::testing::Values(PublicPrims_Usecase{0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #include "detail/nbr_sampling_validate.hpp"
 #include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
 #include "utilities/property_generator_utilities.hpp"
 
 #include <cugraph/sampling_functions.hpp>
@@ -23,6 +24,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 struct Homogeneous_Uniform_Neighbor_Sampling_Usecase {
   std::vector<int32_t> fanout{{-1}};
   int32_t batch_size{10};
@@ -30,6 +35,7 @@ struct Homogeneous_Uniform_Neighbor_Sampling_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+  bool counter_based_rng{false};
 };
 
 template <typename input_usecase_t>
@@ -90,7 +96,10 @@ class Tests_Homogeneous_Uniform_Neighbor_Sampling
     //         of seed...
     constexpr uint64_t seed{0};
 
-    raft::random::RngState rng_state(seed);
+    raft::random::RngState rng_state(seed,
+                                     homogeneous_uniform_neighbor_sampling_usecase.counter_based_rng
+                                       ? raft::random::GenPhilox
+                                       : raft::random::GenPC);
 
     auto random_sources = cugraph::select_random_vertices(
       handle,
@@ -122,6 +131,8 @@ class Tests_Homogeneous_Uniform_Neighbor_Sampling
 
     std::optional<raft::device_span<int32_t const>> label_to_output_comm_rank_mapping{std::nullopt};
 
+    auto sampling_rng_state = rng_state;
+
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
       hr_timer.start("Uniform neighbor sampling");
@@ -153,6 +164,66 @@ class Tests_Homogeneous_Uniform_Neighbor_Sampling
       hr_timer.display_and_clear(std::cout);
     }
 
+    if (homogeneous_uniform_neighbor_sampling_usecase.check_correctness &&
+        homogeneous_uniform_neighbor_sampling_usecase.counter_based_rng &&
+        homogeneous_uniform_neighbor_sampling_usecase.flag_replacement) {
+      // with counter-based random number generation, the samples of a (seed, label) pair should
+      // not depend on the seed's position in the batch, re-sample with the seeds in the reverse
+      // order and compare
+
+      auto h_sources = cugraph::test::to_host(handle, random_sources);
+      auto h_labels  = cugraph::test::to_host(handle, *batch_number);
+      std::reverse(h_sources.begin(), h_sources.end());
+      std::reverse(h_labels.begin(), h_labels.end());
+      auto reversed_sources = cugraph::test::to_device(handle, h_sources);
+      auto reversed_labels  = cugraph::test::to_device(handle, h_labels);
+
+      auto&& [reversed_src_out,
+              reversed_dst_out,
+              reversed_wgt_out,
+              reversed_edge_id,
+              reversed_edge_type,
+              reversed_hop,
+              reversed_offsets] =
+        cugraph::homogeneous_uniform_neighbor_sample(
+          handle,
+          sampling_rng_state,
+          graph_view,
+          edge_weight_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          raft::device_span<vertex_t const>{reversed_sources.data(), reversed_sources.size()},
+          std::make_optional(
+            raft::device_span<int32_t const>{reversed_labels.data(), reversed_labels.size()}),
+          label_to_output_comm_rank_mapping,
+          raft::host_span<int32_t const>(
+            homogeneous_uniform_neighbor_sampling_usecase.fanout.data(),
+            homogeneous_uniform_neighbor_sampling_usecase.fanout.size()),
+          cugraph::sampling_flags_t{cugraph::prior_sources_behavior_t{0}, true, false, true});
+
+      ASSERT_EQ(cugraph::test::to_host(handle, *offsets),
+                cugraph::test::to_host(handle, *reversed_offsets));
+
+      auto h_offsets = cugraph::test::to_host(handle, *offsets);
+      auto sorted_edges =
+        [&handle, &h_offsets](auto const& srcs, auto const& dsts, auto const& hops) {
+          auto h_srcs = cugraph::test::to_host(handle, srcs);
+          auto h_dsts = cugraph::test::to_host(handle, dsts);
+          auto h_hops = cugraph::test::to_host(handle, hops);
+          std::vector<std::tuple<size_t, int32_t, vertex_t, vertex_t>> edges(h_srcs.size());
+          for (size_t i = 0; i + 1 < h_offsets.size(); ++i) {
+            for (size_t j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+              edges[j] = std::make_tuple(i, h_hops[j], h_srcs[j], h_dsts[j]);
+            }
+          }
+          std::sort(edges.begin(), edges.end());
+          return edges;
+        };
+      ASSERT_TRUE(sorted_edges(src_out, dst_out, *hop) ==
+                  sorted_edges(reversed_src_out, reversed_dst_out, *reversed_hop))
+        << "Counter-based sampling results depend on the seed order.";
+    }
+
     if (homogeneous_uniform_neighbor_sampling_usecase.check_correctness) {
       //  First validate that the extracted edges are actually a subset of the
       //  edges in the input graph
@@ -237,7 +308,9 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, false},
                       Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, true},
                       Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, false},
-                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, true}),
+                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, true},
+                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{
+                        {4, 10}, 128, true, false, true, true}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -256,10 +329,15 @@ INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
   Tests_Homogeneous_Uniform_Neighbor_Sampling_Rmat,
   ::testing::Combine(
-    ::testing::Values(Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, false},
-                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, true},
-                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, false},
-                      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, true}),
+    ::testing::Values(
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, false},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, false, true},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, false},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, true},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{10, 10, 10}, 128, false, false},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{10, 10, 10}, 128, true, false},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, false, true, true},
+      Homogeneous_Uniform_Neighbor_Sampling_Usecase{{4, 10}, 128, true, true, true, true}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0))));
 
 INSTANTIATE_TEST_SUITE_P(
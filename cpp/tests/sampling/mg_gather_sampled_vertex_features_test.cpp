@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+struct Gather_Sampled_Vertex_Features_Usecase {
+  size_t feature_dim{4};
+  size_t num_vertices_to_gather{1024};  // per GPU (may include duplicates)
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGGather_Sampled_Vertex_Features
+  : public ::testing::TestWithParam<
+      std::tuple<Gather_Sampled_Vertex_Features_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGGather_Sampled_Vertex_Features() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(
+    std::tuple<Gather_Sampled_Vertex_Features_Usecase, input_usecase_t> const& param)
+  {
+    auto [gather_sampled_vertex_features_usecase, input_usecase] = param;
+
+    HighResTimer hr_timer{};
+
+    // 1. create MG graph
+
+    auto [graph, edge_weights, renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto graph_view = graph.view();
+
+    auto feature_dim = gather_sampled_vertex_features_usecase.feature_dim;
+    auto rank        = handle_->get_comms().get_rank();
+
+    // 2. feature of vertex v = [v * feature_dim, (v + 1) * feature_dim)
+
+    std::vector<float> h_vertex_features(graph_view.local_vertex_partition_range_size() *
+                                         feature_dim);
+    for (size_t i = 0; i < h_vertex_features.size(); ++i) {
+      h_vertex_features[i] = static_cast<float>(
+        graph_view.local_vertex_partition_range_first() * feature_dim + i);
+    }
+    auto d_vertex_features = cugraph::test::to_device(*handle_, h_vertex_features);
+
+    // 3. vertices to gather (spread over every vertex partition, with duplicates)
+
+    std::vector<vertex_t> h_renumber_map(
+      gather_sampled_vertex_features_usecase.num_vertices_to_gather);
+    for (size_t i = 0; i < h_renumber_map.size(); ++i) {
+      h_renumber_map[i] = static_cast<vertex_t>((i * 7919 + static_cast<size_t>(rank) * 131) %
+                                                graph_view.number_of_vertices());
+    }
+    auto d_renumber_map = cugraph::test::to_device(*handle_, h_renumber_map);
+
+    // 4. gather
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG gather sampled vertex features");
+    }
+
+    auto d_gathered_features = cugraph::gather_sampled_vertex_features(
+      *handle_,
+      graph_view,
+      raft::device_span<float const>(d_vertex_features.data(), d_vertex_features.size()),
+      feature_dim,
+      raft::device_span<vertex_t const>(d_renumber_map.data(), d_renumber_map.size()),
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 5. validate
+
+    if (gather_sampled_vertex_features_usecase.check_correctness) {
+      auto h_gathered_features = cugraph::test::to_host(*handle_, d_gathered_features);
+      ASSERT_EQ(h_gathered_features.size(), h_renumber_map.size() * feature_dim);
+      for (size_t i = 0; i < h_renumber_map.size(); ++i) {
+        for (size_t j = 0; j < feature_dim; ++j) {
+          ASSERT_EQ(h_gathered_features[i * feature_dim + j],
+                    static_cast<float>(h_renumber_map[i] * feature_dim + j))
+            << "Gathered feature " << j << " of vertex " << h_renumber_map[i] << " is invalid.";
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGGather_Sampled_Vertex_Features<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGGather_Sampled_Vertex_Features_File =
+  Tests_MGGather_Sampled_Vertex_Features<cugraph::test::File_Usecase>;
+
+using Tests_MGGather_Sampled_Vertex_Features_Rmat =
+  Tests_MGGather_Sampled_Vertex_Features<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGGather_Sampled_Vertex_Features_File, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MGGather_Sampled_Vertex_Features_Rmat, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MGGather_Sampled_Vertex_Features_Rmat, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGGather_Sampled_Vertex_Features_File,
+  ::testing::Combine(::testing::Values(Gather_Sampled_Vertex_Features_Usecase{1, 64},
+                                       Gather_Sampled_Vertex_Features_Usecase{4, 256}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGGather_Sampled_Vertex_Features_Rmat,
+  ::testing::Combine(::testing::Values(Gather_Sampled_Vertex_Features_Usecase{1, 1024},
+                                       Gather_Sampled_Vertex_Features_Usecase{16, 1024}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGGather_Sampled_Vertex_Features_Rmat,
+  ::testing::Combine(::testing::Values(Gather_Sampled_Vertex_Features_Usecase{128, 1 << 20, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+struct LabelToOutputCommRank_Usecase {
+  std::vector<int32_t> fanout{{10}};
+  size_t num_seeds{256};
+  int32_t num_labels{16};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGLabelToOutputCommRank
+  : public ::testing::TestWithParam<std::tuple<LabelToOutputCommRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGLabelToOutputCommRank() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LabelToOutputCommRank_Usecase const& label_to_output_comm_rank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, mg_renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+
+    auto comm_rank = handle_->get_comms().get_rank();
+    auto comm_size = handle_->get_comms().get_size();
+
+    // skewed seed batches: only rank 0 provides seeds (local to rank 0)
+
+    raft::random::RngState rng_state(comm_rank);
+    auto seeds = cugraph::select_random_vertices(
+      *handle_,
+      mg_graph_view,
+      std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+      rng_state,
+      std::min(label_to_output_comm_rank_usecase.num_seeds,
+               static_cast<size_t>(mg_graph_view.number_of_vertices())),
+      false,
+      false);
+    if (comm_rank != 0) { seeds.resize(0, handle_->get_stream()); }
+
+    std::vector<int32_t> h_labels(seeds.size());
+    for (size_t i = 0; i < h_labels.size(); ++i) {
+      h_labels[i] = static_cast<int32_t>(i % label_to_output_comm_rank_usecase.num_labels);
+    }
+    auto labels = cugraph::test::to_device(*handle_, h_labels);
+
+    auto fan_out = raft::host_span<int32_t const>(label_to_output_comm_rank_usecase.fanout.data(),
+                                                  label_to_output_comm_rank_usecase.fanout.size());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG compute_balanced_label_to_output_comm_rank");
+    }
+
+    auto label_to_output_comm_rank = cugraph::compute_balanced_label_to_output_comm_rank(
+      *handle_,
+      mg_graph_view,
+      raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+      raft::device_span<int32_t const>(labels.data(), labels.size()),
+      fan_out);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (label_to_output_comm_rank_usecase.check_correctness) {
+      int32_t num_labels =
+        h_labels.size() > 0 ? (*std::max_element(h_labels.begin(), h_labels.end()) + 1) : 0;
+      num_labels = cugraph::host_scalar_allreduce(
+        handle_->get_comms(), num_labels, raft::comms::op_t::MAX, handle_->get_stream());
+      ASSERT_EQ(label_to_output_comm_rank.size(), static_cast<size_t>(num_labels));
+
+      auto h_label_to_output_comm_rank =
+        cugraph::test::to_host(*handle_, label_to_output_comm_rank);
+      ASSERT_TRUE(std::all_of(h_label_to_output_comm_rank.begin(),
+                              h_label_to_output_comm_rank.end(),
+                              [comm_size](auto rank) { return (rank >= 0) && (rank < comm_size); }))
+        << "Invalid output rank.";
+
+      // the mapping should be identical on every rank
+      auto h_all_mappings = cugraph::test::to_host(
+        *handle_,
+        cugraph::test::device_allgatherv(*handle_,
+                                         label_to_output_comm_rank.data(),
+                                         label_to_output_comm_rank.size()));
+      for (int i = 0; i < comm_size; ++i) {
+        ASSERT_TRUE(std::equal(h_label_to_output_comm_rank.begin(),
+                               h_label_to_output_comm_rank.end(),
+                               h_all_mappings.begin() + i * h_label_to_output_comm_rank.size()))
+          << "label_to_output_comm_rank differs between ranks.";
+      }
+
+      // the sampling outputs should be balanced (single hop sampling without replacement returns
+      // min(degree, fanout) samples per seed, the estimated cost is this + 1, so the largest
+      // output size is bounded by the average + the largest label output size)
+
+      if (label_to_output_comm_rank_usecase.fanout.size() == 1) {
+        auto [srcs, dsts, weights, edge_ids, edge_types, hops, offsets] =
+          cugraph::homogeneous_uniform_neighbor_sample(
+            *handle_,
+            rng_state,
+            mg_graph_view,
+            std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+            std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+            std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+            raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+            std::make_optional(raft::device_span<int32_t const>(labels.data(), labels.size())),
+            std::make_optional(raft::device_span<int32_t const>(
+              label_to_output_comm_rank.data(), label_to_output_comm_rank.size())),
+            fan_out,
+            cugraph::sampling_flags_t{
+              cugraph::prior_sources_behavior_t::DEFAULT, false, false, false});
+
+        auto h_offsets = cugraph::test::to_host(*handle_, *offsets);
+        size_t max_label_size{0};
+        for (size_t i = 0; i + 1 < h_offsets.size(); ++i) {
+          max_label_size = std::max(max_label_size, h_offsets[i + 1] - h_offsets[i]);
+        }
+        max_label_size = cugraph::host_scalar_allreduce(
+          handle_->get_comms(), max_label_size, raft::comms::op_t::MAX, handle_->get_stream());
+        auto total_size = cugraph::host_scalar_allreduce(
+          handle_->get_comms(), srcs.size(), raft::comms::op_t::SUM, handle_->get_stream());
+        auto max_size = cugraph::host_scalar_allreduce(
+          handle_->get_comms(), srcs.size(), raft::comms::op_t::MAX, handle_->get_stream());
+        auto num_seeds = cugraph::host_scalar_allreduce(
+          handle_->get_comms(), seeds.size(), raft::comms::op_t::SUM, handle_->get_stream());
+        auto max_label_seeds = (num_seeds + label_to_output_comm_rank_usecase.num_labels - 1) /
+                               label_to_output_comm_rank_usecase.num_labels;
+
+        ASSERT_LE(max_size,
+                  (total_size + num_seeds) / comm_size + 1 + max_label_size + max_label_seeds)
+          << "Sampling outputs are not balanced.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGLabelToOutputCommRank<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGLabelToOutputCommRank_File =
+  Tests_MGLabelToOutputCommRank<cugraph::test::File_Usecase>;
+using Tests_MGLabelToOutputCommRank_Rmat =
+  Tests_MGLabelToOutputCommRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGLabelToOutputCommRank_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelToOutputCommRank_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelToOutputCommRank_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGLabelToOutputCommRank_File,
+  ::testing::Combine(::testing::Values(LabelToOutputCommRank_Usecase{{10}, 16, 8},
+                                       LabelToOutputCommRank_Usecase{{10, 5}, 16, 8}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGLabelToOutputCommRank_Rmat,
+  ::testing::Combine(
+    ::testing::Values(LabelToOutputCommRank_Usecase{{10}, 256, 16},
+                      LabelToOutputCommRank_Usecase{{10, -1}, 256, 16},
+                      LabelToOutputCommRank_Usecase{{10, 5, 2}, 256, 64}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGLabelToOutputCommRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(LabelToOutputCommRank_Usecase{{10, 25}, 65536, 1024, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail/nbr_sampling_validate.hpp"
+#include "utilities/base_fixture.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/neighbor_sampling_state.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct MGNeighborSamplingState_Usecase {
+  std::vector<int32_t> fanout{{10}};
+  size_t batch_size{16};
+  size_t num_batches{8};
+  size_t num_hot_vertices{16};
+  bool biased{false};
+  bool with_replacement{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGNeighborSamplingState
+  : public ::testing::TestWithParam<std::tuple<MGNeighborSamplingState_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGNeighborSamplingState() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MGNeighborSamplingState_Usecase const& neighbor_sampling_state_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResTimer hr_timer{};
+
+    auto [mg_graph, mg_edge_weights, mg_renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, true, true);
+
+    auto mg_graph_view = mg_graph.view();
+    auto mg_edge_weight_view =
+      mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
+    if (neighbor_sampling_state_usecase.biased) { ASSERT_TRUE(mg_edge_weight_view.has_value()); }
+    auto mg_edge_bias_view =
+      neighbor_sampling_state_usecase.biased ? mg_edge_weight_view : std::nullopt;
+
+    raft::random::RngState rng_state(handle_->get_comms().get_rank());
+
+    std::vector<rmm::device_uvector<vertex_t>> d_seed_batches{};
+    d_seed_batches.reserve(neighbor_sampling_state_usecase.num_batches);
+    for (size_t i = 0; i < neighbor_sampling_state_usecase.num_batches; ++i) {
+      d_seed_batches.push_back(cugraph::select_random_vertices(
+        *handle_,
+        mg_graph_view,
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+        rng_state,
+        std::min(neighbor_sampling_state_usecase.batch_size,
+                 static_cast<size_t>(mg_graph_view.number_of_vertices())),
+        false,
+        true));
+    }
+
+    cugraph::sampling_flags_t sampling_flags{cugraph::prior_sources_behavior_t::DEFAULT,
+                                             true,
+                                             false,
+                                             neighbor_sampling_state_usecase.with_replacement};
+    auto fan_out = raft::host_span<int32_t const>(neighbor_sampling_state_usecase.fanout.data(),
+                                                  neighbor_sampling_state_usecase.fanout.size());
+
+    cugraph::neighbor_sampling_state_t<vertex_t, edge_t, weight_t, int32_t, true> state(
+      *handle_, mg_graph_view, mg_edge_weight_view, std::nullopt, std::nullopt, mg_edge_bias_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG cache hot vertices");
+    }
+
+    state.cache_hot_vertices(*handle_, neighbor_sampling_state_usecase.num_hot_vertices);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_LE(state.number_of_cached_hot_vertices(),
+              neighbor_sampling_state_usecase.num_hot_vertices);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG neighbor sampling (with the hot vertex cache)");
+    }
+
+    raft::random::RngState state_rng_state(handle_->get_comms().get_rank() + 1);
+    std::vector<std::tuple<rmm::device_uvector<vertex_t>,
+                           rmm::device_uvector<vertex_t>,
+                           std::optional<rmm::device_uvector<weight_t>>>>
+      state_results{};
+    for (size_t i = 0; i < d_seed_batches.size(); ++i) {
+      auto [srcs, dsts, weights, edge_ids, edge_types, hops, offsets] = state.sample(
+        *handle_,
+        state_rng_state,
+        raft::device_span<vertex_t const>(d_seed_batches[i].data(), d_seed_batches[i].size()),
+        std::nullopt,
+        std::nullopt,
+        fan_out,
+        sampling_flags);
+      state_results.push_back(
+        std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights)));
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (neighbor_sampling_state_usecase.check_correctness) {
+      // every sampled edge should be an edge of the input graph, and single hop sampling without
+      // replacement should return the same number of samples with or without the cache
+
+      auto [mg_graph_srcs, mg_graph_dsts, mg_graph_weights, mg_graph_edge_ids, mg_graph_types] =
+        cugraph::decompress_to_edgelist(
+          *handle_,
+          mg_graph_view,
+          mg_edge_weight_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+
+      auto graph_srcs = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>{mg_graph_srcs.data(), mg_graph_srcs.size()});
+      auto graph_dsts = cugraph::test::device_gatherv(
+        *handle_, raft::device_span<vertex_t const>{mg_graph_dsts.data(), mg_graph_dsts.size()});
+      auto graph_weights =
+        mg_graph_weights
+          ? std::make_optional(cugraph::test::device_gatherv(
+              *handle_,
+              raft::device_span<weight_t const>{mg_graph_weights->data(),
+                                                mg_graph_weights->size()}))
+          : std::nullopt;
+
+      cugraph::neighbor_sampling_state_t<vertex_t, edge_t, weight_t, int32_t, true>
+        reference_state(*handle_,
+                        mg_graph_view,
+                        mg_edge_weight_view,
+                        std::nullopt,
+                        std::nullopt,
+                        mg_edge_bias_view);
+
+      raft::random::RngState reference_rng_state(handle_->get_comms().get_rank() + 1);
+      for (size_t i = 0; i < state_results.size(); ++i) {
+        auto const& [srcs, dsts, weights] = state_results[i];
+
+        auto sampled_srcs = cugraph::test::device_gatherv(
+          *handle_, raft::device_span<vertex_t const>{srcs.data(), srcs.size()});
+        auto sampled_dsts = cugraph::test::device_gatherv(
+          *handle_, raft::device_span<vertex_t const>{dsts.data(), dsts.size()});
+        auto sampled_weights =
+          weights
+            ? std::make_optional(cugraph::test::device_gatherv(
+                *handle_, raft::device_span<weight_t const>{weights->data(), weights->size()}))
+            : std::nullopt;
+
+        if (handle_->get_comms().get_rank() == 0) {
+          ASSERT_TRUE(cugraph::test::validate_extracted_graph_is_subgraph(*handle_,
+                                                                          graph_srcs,
+                                                                          graph_dsts,
+                                                                          graph_weights,
+                                                                          sampled_srcs,
+                                                                          sampled_dsts,
+                                                                          sampled_weights))
+            << "Sampled edges for seed batch " << i << " are not in the input graph.";
+        }
+
+        if ((neighbor_sampling_state_usecase.fanout.size() == 1) &&
+            !neighbor_sampling_state_usecase.with_replacement) {
+          auto [reference_srcs,
+                reference_dsts,
+                reference_weights,
+                reference_edge_ids,
+                reference_edge_types,
+                reference_hops,
+                reference_offsets] =
+            reference_state.sample(*handle_,
+                                   reference_rng_state,
+                                   raft::device_span<vertex_t const>(d_seed_batches[i].data(),
+                                                                     d_seed_batches[i].size()),
+                                   std::nullopt,
+                                   std::nullopt,
+                                   fan_out,
+                                   sampling_flags);
+
+          auto num_samples           = cugraph::host_scalar_allreduce(handle_->get_comms(),
+                                                            srcs.size(),
+                                                            raft::comms::op_t::SUM,
+                                                            handle_->get_stream());
+          auto num_reference_samples = cugraph::host_scalar_allreduce(handle_->get_comms(),
+                                                                      reference_srcs.size(),
+                                                                      raft::comms::op_t::SUM,
+                                                                      handle_->get_stream());
+          ASSERT_EQ(num_samples, num_reference_samples)
+            << "Sampling with the hot vertex cache returned a wrong number of samples for seed "
+               "batch "
+            << i << ".";
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGNeighborSamplingState<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGNeighborSamplingState_File =
+  Tests_MGNeighborSamplingState<cugraph::test::File_Usecase>;
+using Tests_MGNeighborSamplingState_Rmat =
+  Tests_MGNeighborSamplingState<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGNeighborSamplingState_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGNeighborSamplingState_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGNeighborSamplingState_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGNeighborSamplingState_File,
+  ::testing::Combine(
+    ::testing::Values(MGNeighborSamplingState_Usecase{{10}, 4, 4, 4, false, false},
+                      MGNeighborSamplingState_Usecase{{10, 5}, 4, 4, 4, false, true},
+                      MGNeighborSamplingState_Usecase{{-1, 5}, 4, 4, 4, false, false},
+                      MGNeighborSamplingState_Usecase{{10, 5}, 4, 4, 4, true, true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGNeighborSamplingState_Rmat,
+  ::testing::Combine(
+    ::testing::Values(MGNeighborSamplingState_Usecase{{10}, 16, 8, 64, false, false},
+                      MGNeighborSamplingState_Usecase{{10, 5, 2}, 16, 8, 64, false, true},
+                      MGNeighborSamplingState_Usecase{{10, 5, 2}, 16, 8, 64, true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGNeighborSamplingState_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      MGNeighborSamplingState_Usecase{{10, 25}, 1024, 64, 4096, false, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
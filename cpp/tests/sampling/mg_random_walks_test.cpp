@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,7 +16,9 @@
 
 #include "sampling/random_walks_check.hpp"
 #include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
 #include "utilities/mg_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
 #include "utilities/test_graphs.hpp"
 #include "utilities/thrust_wrapper.hpp"
 
@@ -31,6 +33,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 struct UniformRandomWalks_Usecase {
   bool test_weighted{false};
   uint64_t seed{0};
@@ -53,6 +57,47 @@ struct UniformRandomWalks_Usecase {
   bool expect_throw() { return false; }
 };
 
+struct MetapathRandomWalks_Usecase {
+  int32_t num_edge_types{3};
+  bool test_weighted{false};
+  uint64_t seed{0};
+  bool check_correctness{false};
+
+  // the metapath cycles through the edge types
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+  operator()(raft::handle_t const& handle,
+             cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+             std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+             raft::device_span<vertex_t const> start_vertices,
+             size_t max_depth)
+  {
+    raft::random::RngState rng_state(static_cast<uint64_t>(handle.get_comms().get_rank()));
+
+    auto edge_types =
+      cugraph::test::generate<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                              int32_t>::edge_property(handle, graph_view, num_edge_types);
+
+    std::vector<int32_t> h_metapath(max_depth);
+    for (size_t i = 0; i < max_depth; ++i) {
+      h_metapath[i] = static_cast<int32_t>(i % num_edge_types);
+    }
+    auto d_metapath = cugraph::test::to_device(handle, h_metapath);
+
+    return cugraph::metapath_random_walks(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      edge_types.view(),
+      num_edge_types,
+      start_vertices,
+      raft::device_span<int32_t const>(d_metapath.data(), d_metapath.size()));
+  }
+
+  bool expect_throw() { return false; }
+};
+
 struct BiasedRandomWalks_Usecase {
   bool test_weighted{true};
   uint64_t seed{0};
@@ -214,6 +259,8 @@ using Tests_UniformRandomWalks_File =
   Tests_MGRandomWalks<std::tuple<UniformRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_UniformRandomWalks_Rmat =
   Tests_MGRandomWalks<std::tuple<UniformRandomWalks_Usecase, cugraph::test::Rmat_Usecase>>;
+using Tests_MetapathRandomWalks_File =
+  Tests_MGRandomWalks<std::tuple<MetapathRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_BiasedRandomWalks_File =
   Tests_MGRandomWalks<std::tuple<BiasedRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_BiasedRandomWalks_Rmat =
@@ -245,6 +292,17 @@ TEST_P(Tests_UniformRandomWalks_Rmat, Initialize_i32_i32_f)
   }
 }
 
+TEST_P(Tests_MetapathRandomWalks_File, Initialize_i32_i32_f)
+{
+  try {
+    run_current_test<int32_t, int32_t, float>(
+      override_File_Usecase_with_cmd_line_arguments(GetParam()));
+  } catch (const std::exception& e) {
+    std::cerr << "exception in rank = " << get_rank() << std::endl;
+    throw e;
+  }
+}
+
 TEST_P(Tests_BiasedRandomWalks_File, Initialize_i32_i32_f)
 {
   try {
@@ -296,6 +354,14 @@ INSTANTIATE_TEST_SUITE_P(
                                        UniformRandomWalks_Usecase{true, 0, true}),
                      ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MetapathRandomWalks_File,
+  ::testing::Combine(::testing::Values(MetapathRandomWalks_Usecase{1, false, 0, true},
+                                       MetapathRandomWalks_Usecase{3, false, 0, true},
+                                       MetapathRandomWalks_Usecase{3, true, 0, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
 INSTANTIATE_TEST_SUITE_P(
   file_test,
   Tests_BiasedRandomWalks_File,
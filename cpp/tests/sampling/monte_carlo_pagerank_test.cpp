@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+struct MonteCarloPageRank_Usecase {
+  size_t num_seeds{2};
+  size_t num_walks_per_seed{20000};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MonteCarloPageRank
+  : public ::testing::TestWithParam<std::tuple<MonteCarloPageRank_Usecase, input_usecase_t>> {
+ public:
+  Tests_MonteCarloPageRank() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MonteCarloPageRank_Usecase const& monte_carlo_pagerank_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, monte_carlo_pagerank_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    // the seeds are the vertices with the largest out-degrees
+    auto out_degrees = cugraph::test::to_host(handle, graph_view.compute_out_degrees(handle));
+    std::vector<vertex_t> h_seeds(out_degrees.size());
+    std::iota(h_seeds.begin(), h_seeds.end(), vertex_t{0});
+    std::sort(h_seeds.begin(), h_seeds.end(), [&out_degrees](auto lhs, auto rhs) {
+      return out_degrees[lhs] > out_degrees[rhs];
+    });
+    h_seeds.resize(std::min(h_seeds.size(), monte_carlo_pagerank_usecase.num_seeds));
+    auto d_seeds = cugraph::test::to_device(handle, h_seeds);
+
+    weight_t constexpr alpha{0.85};
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Monte Carlo personalized PageRank");
+    }
+
+    auto [d_offsets, d_vertices, d_scores] =
+      cugraph::monte_carlo_personalized_pagerank<vertex_t, edge_t, weight_t, false>(
+        handle,
+        rng_state,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<vertex_t const>(d_seeds.data(), d_seeds.size()),
+        monte_carlo_pagerank_usecase.num_walks_per_seed,
+        alpha);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (monte_carlo_pagerank_usecase.check_correctness) {
+      auto h_offsets  = cugraph::test::to_host(handle, d_offsets);
+      auto h_vertices = cugraph::test::to_host(handle, d_vertices);
+      auto h_scores   = cugraph::test::to_host(handle, d_scores);
+
+      ASSERT_EQ(h_offsets.size(), h_seeds.size() + 1);
+      ASSERT_EQ(h_offsets.back(), h_vertices.size());
+
+      auto [transposed_graph, transposed_edge_weights, new_renumber_map] =
+        cugraph::transpose_graph_storage(handle,
+                                         graph_view,
+                                         edge_weight_view,
+                                         std::optional<raft::device_span<vertex_t const>>{});
+      auto transposed_graph_view = transposed_graph.view();
+
+      for (size_t i = 0; i < h_seeds.size(); ++i) {
+        auto d_seed        = cugraph::test::to_device(handle, std::vector<vertex_t>{h_seeds[i]});
+        auto d_seed_values = cugraph::test::to_device(handle, std::vector<weight_t>{1.0});
+
+        auto [d_reference_pageranks, reference_metadata] =
+          cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, false>(
+            handle,
+            transposed_graph_view,
+            transposed_edge_weights ? std::make_optional((*transposed_edge_weights).view())
+                                    : std::nullopt,
+            std::nullopt,
+            std::make_optional(std::make_tuple(
+              raft::device_span<vertex_t const>(d_seed.data(), d_seed.size()),
+              raft::device_span<weight_t const>(d_seed_values.data(), d_seed_values.size()))),
+            std::nullopt,
+            alpha,
+            weight_t{1e-6},
+            std::numeric_limits<size_t>::max(),
+            false);
+        auto h_reference_pageranks = cugraph::test::to_host(handle, d_reference_pageranks);
+
+        std::vector<weight_t> h_estimates(h_reference_pageranks.size(), weight_t{0.0});
+        for (size_t j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+          ASSERT_TRUE((j == h_offsets[i]) || (h_vertices[j - 1] < h_vertices[j]))
+            << "Vertices of a seed should be sorted and unique.";
+          h_estimates[h_vertices[j]] = h_scores[j];
+        }
+
+        // a score p is estimated with a standard error of about sqrt(p / num_walks_per_seed), the
+        // L1 error is bounded by sum(sqrt(p)) / sqrt(num_walks_per_seed) times a safety factor
+        double expected_error{0.0};
+        double l1_error{0.0};
+        for (size_t j = 0; j < h_reference_pageranks.size(); ++j) {
+          expected_error += std::sqrt(static_cast<double>(h_reference_pageranks[j]));
+          l1_error += std::abs(h_estimates[j] - h_reference_pageranks[j]);
+        }
+        expected_error /=
+          std::sqrt(static_cast<double>(monte_carlo_pagerank_usecase.num_walks_per_seed));
+
+        ASSERT_TRUE(l1_error <= 4.0 * expected_error)
+          << "Monte Carlo personalized PageRank values for seed " << h_seeds[i]
+          << " are too far from the reference values (L1 error " << l1_error << ", expected "
+          << expected_error << ").";
+      }
+    }
+  }
+};
+
+using Tests_MonteCarloPageRank_File = Tests_MonteCarloPageRank<cugraph::test::File_Usecase>;
+using Tests_MonteCarloPageRank_Rmat = Tests_MonteCarloPageRank<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MonteCarloPageRank_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MonteCarloPageRank_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MonteCarloPageRank_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MonteCarloPageRank_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MonteCarloPageRank_Usecase{2, 20000, false},
+                      MonteCarloPageRank_Usecase{2, 20000, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MonteCarloPageRank_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MonteCarloPageRank_Usecase{4, 20000, false},
+                      MonteCarloPageRank_Usecase{4, 20000, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MonteCarloPageRank_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MonteCarloPageRank_Usecase{10000, 100, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/neighbor_sampler.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_pool.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+struct NeighborSampler_Usecase {
+  std::vector<int32_t> fanout{{10}};
+  size_t batch_size{16};
+  size_t num_batches{8};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_NeighborSampler
+  : public ::testing::TestWithParam<std::tuple<NeighborSampler_Usecase, input_usecase_t>> {
+ public:
+  Tests_NeighborSampler() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(NeighborSampler_Usecase const& neighbor_sampler_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    auto stream_pool = std::make_shared<rmm::cuda_stream_pool>(2);
+    raft::handle_t handle(rmm::cuda_stream_per_thread, stream_pool);
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    std::vector<std::vector<vertex_t>> h_seed_batches(neighbor_sampler_usecase.num_batches);
+    for (size_t i = 0; i < h_seed_batches.size(); ++i) {
+      auto d_seeds = cugraph::select_random_vertices(
+        handle,
+        graph_view,
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+        rng_state,
+        std::min(neighbor_sampler_usecase.batch_size,
+                 static_cast<size_t>(graph_view.number_of_vertices())),
+        false,
+        true);
+      h_seed_batches[i] = cugraph::test::to_host(handle, d_seeds);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Pipelined neighbor sampling");
+    }
+
+    cugraph::neighbor_sampler_t<vertex_t, edge_t, weight_t, int32_t> sampler(
+      handle,
+      graph_view,
+      edge_weight_view,
+      std::nullopt,
+      std::nullopt,
+      neighbor_sampler_usecase.fanout,
+      cugraph::sampling_flags_t{cugraph::prior_sources_behavior_t::EXCLUDE, true, true, false},
+      uint64_t{0},
+      neighbor_sampler_usecase.fanout.size() > 1 /* compress_per_hop */);
+
+    for (size_t i = 0; i < h_seed_batches.size(); ++i) {
+      auto d_seeds = cugraph::test::to_device(handle, h_seed_batches[i]);
+      handle.sync_stream();
+      ASSERT_EQ(sampler.enqueue(std::move(d_seeds)), i);
+    }
+    sampler.close();
+
+    std::vector<typename decltype(sampler)::minibatch_t> minibatches{};
+    while (true) {
+      auto minibatch = sampler.next();
+      if (!minibatch) { break; }
+      minibatches.push_back(std::move(*minibatch));
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(minibatches.size(), h_seed_batches.size());
+
+    if (neighbor_sampler_usecase.check_correctness) {
+      auto [h_offsets, h_indices, h_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+          handle, graph_view, edge_weight_view, std::nullopt);
+
+      for (size_t i = 0; i < minibatches.size(); ++i) {
+        auto& minibatch = minibatches[i];
+        ASSERT_EQ(minibatch.minibatch_id, i) << "Minibatches are not returned in the queue order.";
+        ASSERT_FALSE(minibatch.majors.has_value());
+        ASSERT_EQ(minibatch.hop_offsets.has_value(), neighbor_sampler_usecase.fanout.size() > 1);
+
+        auto h_major_offsets = cugraph::test::to_host(handle, minibatch.major_offsets);
+        auto h_minors        = cugraph::test::to_host(handle, minibatch.minors);
+        auto h_renumber_map  = cugraph::test::to_host(handle, minibatch.renumber_map);
+
+        ASSERT_EQ(h_major_offsets.back(), h_minors.size());
+        ASSERT_TRUE(std::all_of(h_minors.begin(), h_minors.end(), [&h_renumber_map](auto v) {
+          return (v >= 0) && (static_cast<size_t>(v) < h_renumber_map.size());
+        })) << "Renumbered minor vertices are out of range.";
+
+        // seed vertices precede the other vertices in renumbering
+        auto h_seeds = h_seed_batches[i];
+        std::sort(h_seeds.begin(), h_seeds.end());
+        ASSERT_TRUE(h_renumber_map.size() >= h_seeds.size());
+        std::vector<vertex_t> h_renumbered_seeds(h_renumber_map.begin(),
+                                                 h_renumber_map.begin() + h_seeds.size());
+        std::sort(h_renumbered_seeds.begin(), h_renumbered_seeds.end());
+        ASSERT_TRUE(h_renumbered_seeds == h_seeds) << "Seed vertices should be renumbered first.";
+
+        if (neighbor_sampler_usecase.fanout.size() == 1) {
+          // every sampled edge should exist in the input graph
+          for (size_t j = 0; j + 1 < h_major_offsets.size(); ++j) {
+            auto src = h_renumber_map[j];
+            for (auto k = h_major_offsets[j]; k < h_major_offsets[j + 1]; ++k) {
+              auto dst = h_renumber_map[h_minors[k]];
+              ASSERT_TRUE(std::find(h_indices.begin() + h_offsets[src],
+                                    h_indices.begin() + h_offsets[src + 1],
+                                    dst) != h_indices.begin() + h_offsets[src + 1])
+                << "Sampled edge (" << src << ", " << dst << ") is not in the input graph.";
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_NeighborSampler_File = Tests_NeighborSampler<cugraph::test::File_Usecase>;
+using Tests_NeighborSampler_Rmat = Tests_NeighborSampler<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_NeighborSampler_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_NeighborSampler_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_NeighborSampler_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_NeighborSampler_File,
+  ::testing::Combine(::testing::Values(NeighborSampler_Usecase{{10}, 4, 4},
+                                       NeighborSampler_Usecase{{10, 5}, 4, 4}),
+                     ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                                       cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_NeighborSampler_Rmat,
+  ::testing::Combine(
+    ::testing::Values(NeighborSampler_Usecase{{10}, 16, 8},
+                      NeighborSampler_Usecase{{10, 5, 2}, 16, 8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_NeighborSampler_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(NeighborSampler_Usecase{{10, 25}, 1024, 64, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/neighbor_sampling_state.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct NeighborSamplingState_Usecase {
+  std::vector<int32_t> fanout{{10}};
+  size_t batch_size{16};
+  size_t num_batches{8};
+  bool biased{false};
+  bool with_replacement{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_NeighborSamplingState
+  : public ::testing::TestWithParam<std::tuple<NeighborSamplingState_Usecase, input_usecase_t>> {
+ public:
+  Tests_NeighborSamplingState() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(NeighborSamplingState_Usecase const& neighbor_sampling_state_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+    if (neighbor_sampling_state_usecase.biased) { ASSERT_TRUE(edge_weight_view.has_value()); }
+    auto edge_bias_view = neighbor_sampling_state_usecase.biased ? edge_weight_view : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    std::vector<rmm::device_uvector<vertex_t>> d_seed_batches{};
+    d_seed_batches.reserve(neighbor_sampling_state_usecase.num_batches);
+    for (size_t i = 0; i < neighbor_sampling_state_usecase.num_batches; ++i) {
+      d_seed_batches.push_back(cugraph::select_random_vertices(
+        handle,
+        graph_view,
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+        rng_state,
+        std::min(neighbor_sampling_state_usecase.batch_size,
+                 static_cast<size_t>(graph_view.number_of_vertices())),
+        false,
+        true));
+    }
+
+    cugraph::sampling_flags_t sampling_flags{cugraph::prior_sources_behavior_t::DEFAULT,
+                                             true,
+                                             false,
+                                             neighbor_sampling_state_usecase.with_replacement};
+    auto fan_out = raft::host_span<int32_t const>(neighbor_sampling_state_usecase.fanout.data(),
+                                                  neighbor_sampling_state_usecase.fanout.size());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Neighbor sampling (with neighbor_sampling_state_t)");
+    }
+
+    cugraph::neighbor_sampling_state_t<vertex_t, edge_t, weight_t, int32_t, false> state(
+      handle, graph_view, edge_weight_view, std::nullopt, std::nullopt, edge_bias_view);
+
+    raft::random::RngState state_rng_state(1);
+    std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>>
+      state_results{};
+    for (size_t i = 0; i < d_seed_batches.size(); ++i) {
+      auto [srcs, dsts, weights, edge_ids, edge_types, hops, offsets] = state.sample(
+        handle,
+        state_rng_state,
+        raft::device_span<vertex_t const>(d_seed_batches[i].data(), d_seed_batches[i].size()),
+        std::nullopt,
+        std::nullopt,
+        fan_out,
+        sampling_flags);
+      state_results.push_back(std::make_tuple(std::move(srcs), std::move(dsts)));
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (neighbor_sampling_state_usecase.check_correctness) {
+      // the free functions with the same random number generator state should return the same
+      // samples
+
+      auto [h_offsets, h_indices, h_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+          handle, graph_view, edge_weight_view, std::nullopt);
+
+      raft::random::RngState reference_rng_state(1);
+      for (size_t i = 0; i < d_seed_batches.size(); ++i) {
+        auto starting_vertices =
+          raft::device_span<vertex_t const>(d_seed_batches[i].data(), d_seed_batches[i].size());
+        auto [srcs, dsts, weights, edge_ids, edge_types, hops, offsets] =
+          neighbor_sampling_state_usecase.biased
+            ? cugraph::homogeneous_biased_neighbor_sample(handle,
+                                                          reference_rng_state,
+                                                          graph_view,
+                                                          edge_weight_view,
+                                                          std::nullopt,
+                                                          std::nullopt,
+                                                          *edge_bias_view,
+                                                          starting_vertices,
+                                                          std::nullopt,
+                                                          std::nullopt,
+                                                          fan_out,
+                                                          sampling_flags)
+            : cugraph::homogeneous_uniform_neighbor_sample(handle,
+                                                           reference_rng_state,
+                                                           graph_view,
+                                                           edge_weight_view,
+                                                           std::nullopt,
+                                                           std::nullopt,
+                                                           starting_vertices,
+                                                           std::nullopt,
+                                                           std::nullopt,
+                                                           fan_out,
+                                                           sampling_flags);
+
+        auto h_reference_srcs = cugraph::test::to_host(handle, srcs);
+        auto h_reference_dsts = cugraph::test::to_host(handle, dsts);
+        auto h_srcs           = cugraph::test::to_host(handle, std::get<0>(state_results[i]));
+        auto h_dsts           = cugraph::test::to_host(handle, std::get<1>(state_results[i]));
+
+        if (neighbor_sampling_state_usecase.biased &&
+            neighbor_sampling_state_usecase.with_replacement) {
+          // samples are drawn using the pre-computed edge bias inclusive sums, so the samples can
+          // differ (due to floating point rounding) but the number of samples should match (for
+          // single hop sampling) and every sample should be a valid edge with a positive bias
+          // value
+          if (neighbor_sampling_state_usecase.fanout.size() == 1) {
+            ASSERT_EQ(h_srcs.size(), h_reference_srcs.size())
+              << "neighbor_sampling_state_t::sample() returned a wrong number of samples for "
+                 "seed batch "
+              << i << ".";
+          }
+          for (size_t j = 0; j < h_srcs.size(); ++j) {
+            bool found{false};
+            for (auto k = h_offsets[h_srcs[j]]; k < h_offsets[h_srcs[j] + 1]; ++k) {
+              if ((h_indices[k] == h_dsts[j]) && ((*h_weights)[k] > 0.0)) {
+                found = true;
+                break;
+              }
+            }
+            ASSERT_TRUE(found) << "Sampled edge (" << h_srcs[j] << ", " << h_dsts[j]
+                               << ") is not in the input graph or has a zero bias.";
+          }
+        } else {
+          ASSERT_TRUE(h_srcs == h_reference_srcs && h_dsts == h_reference_dsts)
+            << "neighbor_sampling_state_t::sample() result does not match with the free function "
+               "result for seed batch "
+            << i << ".";
+        }
+      }
+    }
+  }
+};
+
+using Tests_NeighborSamplingState_File = Tests_NeighborSamplingState<cugraph::test::File_Usecase>;
+using Tests_NeighborSamplingState_Rmat = Tests_NeighborSamplingState<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_NeighborSamplingState_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_NeighborSamplingState_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_NeighborSamplingState_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_NeighborSamplingState_File,
+  ::testing::Combine(::testing::Values(NeighborSamplingState_Usecase{{10}, 4, 4, false},
+                                       NeighborSamplingState_Usecase{{10, 5}, 4, 4, true, false},
+                                       NeighborSamplingState_Usecase{{10}, 4, 4, true, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                                       cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_NeighborSamplingState_Rmat,
+  ::testing::Combine(
+    ::testing::Values(NeighborSamplingState_Usecase{{10}, 16, 8, false},
+                      NeighborSamplingState_Usecase{{10, 5, 2}, 16, 8, true, false},
+                      NeighborSamplingState_Usecase{{10}, 16, 8, true, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_NeighborSamplingState_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(NeighborSamplingState_Usecase{{10, 25}, 1024, 64, true, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+struct Node2VecEmbedding_Usecase {
+  size_t embedding_dimension{16};
+  double p{1.0};
+  double q{1.0};
+  size_t walk_chunk_size{size_t{1} << 20};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_Node2VecEmbedding
+  : public ::testing::TestWithParam<std::tuple<Node2VecEmbedding_Usecase, input_usecase_t>> {
+ public:
+  Tests_Node2VecEmbedding() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Node2VecEmbedding_Usecase const& node2vec_embedding_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, node2vec_embedding_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("node2vec embedding");
+    }
+
+    auto d_embeddings = cugraph::node2vec_embedding<vertex_t, edge_t, weight_t>(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      node2vec_embedding_usecase.embedding_dimension,
+      size_t{20},
+      size_t{20},
+      static_cast<weight_t>(node2vec_embedding_usecase.p),
+      static_cast<weight_t>(node2vec_embedding_usecase.q),
+      size_t{5},
+      size_t{5},
+      size_t{2},
+      float{0.025},
+      node2vec_embedding_usecase.walk_chunk_size);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (node2vec_embedding_usecase.check_correctness) {
+      auto dimension    = node2vec_embedding_usecase.embedding_dimension;
+      auto h_embeddings = cugraph::test::to_host(handle, d_embeddings);
+      ASSERT_EQ(h_embeddings.size(),
+                static_cast<size_t>(graph_view.number_of_vertices()) * dimension);
+      ASSERT_TRUE(std::all_of(
+        h_embeddings.begin(), h_embeddings.end(), [](auto val) { return std::isfinite(val); }))
+        << "Embeddings should be finite.";
+
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      auto cosine_similarity = [&h_embeddings, dimension](vertex_t u, vertex_t v) {
+        double dot{0.0};
+        double u_norm{0.0};
+        double v_norm{0.0};
+        for (size_t d = 0; d < dimension; ++d) {
+          auto u_val = static_cast<double>(h_embeddings[u * dimension + d]);
+          auto v_val = static_cast<double>(h_embeddings[v * dimension + d]);
+          dot += u_val * v_val;
+          u_norm += u_val * u_val;
+          v_norm += v_val * v_val;
+        }
+        return dot / std::max(std::sqrt(u_norm * v_norm), 1e-12);
+      };
+
+      // vertices co-occurring in the walks (adjacent vertices) should be closer in the embedding
+      // space than random vertex pairs
+
+      std::set<std::tuple<vertex_t, vertex_t>> edges{};
+      double edge_similarity_sum{0.0};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        edges.insert(std::make_tuple(h_srcs[i], h_dsts[i]));
+        edge_similarity_sum += cosine_similarity(h_srcs[i], h_dsts[i]);
+      }
+
+      std::mt19937 gen(0);
+      std::uniform_int_distribution<vertex_t> dist(0, graph_view.number_of_vertices() - 1);
+      double random_pair_similarity_sum{0.0};
+      size_t num_random_pairs{0};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto u = dist(gen);
+        auto v = dist(gen);
+        if ((u == v) || (edges.find(std::make_tuple(u, v)) != edges.end())) { continue; }
+        random_pair_similarity_sum += cosine_similarity(u, v);
+        ++num_random_pairs;
+      }
+
+      ASSERT_TRUE(h_srcs.size() > 0);
+      ASSERT_TRUE(num_random_pairs > 0);
+      auto edge_similarity        = edge_similarity_sum / static_cast<double>(h_srcs.size());
+      auto random_pair_similarity = random_pair_similarity_sum / num_random_pairs;
+      ASSERT_TRUE(edge_similarity > random_pair_similarity)
+        << "The average cosine similarity of the adjacent vertices (" << edge_similarity
+        << ") should be larger than that of random vertex pairs (" << random_pair_similarity
+        << ").";
+    }
+  }
+};
+
+using Tests_Node2VecEmbedding_File = Tests_Node2VecEmbedding<cugraph::test::File_Usecase>;
+using Tests_Node2VecEmbedding_Rmat = Tests_Node2VecEmbedding<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Node2VecEmbedding_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Node2VecEmbedding_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Node2VecEmbedding_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Node2VecEmbedding_File,
+  ::testing::Combine(
+    // enable correctness checks, the small walk chunk size tests training over multiple chunks
+    ::testing::Values(Node2VecEmbedding_Usecase{16, 1.0, 1.0, size_t{1} << 20, false},
+                      Node2VecEmbedding_Usecase{16, 1.0, 1.0, 100, false},
+                      Node2VecEmbedding_Usecase{16, 1.0, 1.0, 100, true},
+                      Node2VecEmbedding_Usecase{16, 4.0, 0.5, 100, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Node2VecEmbedding_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Node2VecEmbedding_Usecase{32, 1.0, 1.0, 1000, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Node2VecEmbedding_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(Node2VecEmbedding_Usecase{128, 1.0, 1.0, size_t{1} << 20, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+
+#include <cugraph/sampling_functions.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+struct SamplingResultCompressionTest : public ::testing::Test {};
+
+template <typename value_t>
+void run_bit_pack_test(std::vector<value_t> const& h_values,
+                       std::optional<std::vector<size_t>> const& h_segment_offsets,
+                       std::optional<int32_t> expected_bit_width)
+{
+  raft::handle_t handle{};
+
+  auto d_values = cugraph::test::to_device(handle, h_values);
+  std::optional<rmm::device_uvector<size_t>> d_segment_offsets{std::nullopt};
+  std::optional<raft::device_span<size_t const>> segment_offsets{std::nullopt};
+  if (h_segment_offsets) {
+    d_segment_offsets = cugraph::test::to_device(handle, *h_segment_offsets);
+    segment_offsets =
+      raft::device_span<size_t const>((*d_segment_offsets).data(), (*d_segment_offsets).size());
+  }
+
+  auto [packed_words, bit_width, base] = cugraph::bit_pack_sampled_values(
+    handle,
+    raft::device_span<value_t const>(d_values.data(), d_values.size()),
+    segment_offsets,
+    true);
+
+  if (expected_bit_width) { ASSERT_EQ(bit_width, *expected_bit_width); }
+  ASSERT_EQ(packed_words.size(), (h_values.size() * bit_width + 31) / 32);
+
+  auto d_unpacked = cugraph::bit_unpack_sampled_values(
+    handle,
+    raft::device_span<uint32_t const>(packed_words.data(), packed_words.size()),
+    h_values.size(),
+    bit_width,
+    base,
+    segment_offsets);
+
+  auto h_unpacked = cugraph::test::to_host(handle, d_unpacked);
+  ASSERT_EQ(h_unpacked, h_values);
+}
+
+TEST_F(SamplingResultCompressionTest, FrameOfReference)
+{
+  run_bit_pack_test<int32_t>({5, 9, 7, 12, 5, 20}, std::nullopt, 4);
+  run_bit_pack_test<int64_t>({-3, 4, 1000, 17}, std::nullopt, 10);
+  run_bit_pack_test<int32_t>({7, 7, 7}, std::nullopt, 0);
+  run_bit_pack_test<int32_t>({}, std::nullopt, 0);
+  run_bit_pack_test<int64_t>(
+    {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()}, std::nullopt, 64);
+}
+
+TEST_F(SamplingResultCompressionTest, DeltaPerSegment)
+{
+  run_bit_pack_test<int32_t>({0, 1, 3, 4, 0, 2, 2, 5}, std::vector<size_t>{0, 4, 8}, 2);
+  run_bit_pack_test<size_t>({0, 10, 20, 30, 40}, std::vector<size_t>{0, 5}, 4);
+}
+
+TEST_F(SamplingResultCompressionTest, RandomSortedSegments)
+{
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int32_t> value_distribution(0, 1 << 20);
+  std::uniform_int_distribution<size_t> size_distribution(0, 1000);
+
+  std::vector<int32_t> h_values{};
+  std::vector<size_t> h_segment_offsets{0};
+  for (size_t i = 0; i < 32; ++i) {
+    std::vector<int32_t> segment(size_distribution(gen));
+    std::generate(segment.begin(), segment.end(), [&]() { return value_distribution(gen); });
+    std::sort(segment.begin(), segment.end());
+    h_values.insert(h_values.end(), segment.begin(), segment.end());
+    h_segment_offsets.push_back(h_values.size());
+  }
+
+  run_bit_pack_test<int32_t>(h_values, std::nullopt, std::nullopt);
+  run_bit_pack_test<int32_t>(h_values, h_segment_offsets, std::nullopt);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
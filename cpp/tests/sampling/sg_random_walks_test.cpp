@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,10 +16,13 @@
 
 #include "sampling/random_walks_check.hpp"
 #include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
 #include "utilities/test_graphs.hpp"
 #include "utilities/thrust_wrapper.hpp"
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/edge_partition_edge_type_index.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
@@ -27,6 +30,50 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+#include <tuple>
+#include <vector>
+
+// convert paths in the compacted (CSR-like) format to the padded format (to share the validation
+// code with the other random walk functions)
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+to_padded_paths(raft::handle_t const& handle,
+                rmm::device_uvector<size_t> const& d_offsets,
+                rmm::device_uvector<vertex_t> const& d_vertices,
+                std::optional<rmm::device_uvector<weight_t>> const& d_weights,
+                size_t num_paths,
+                size_t max_length)
+{
+  auto h_offsets  = cugraph::test::to_host(handle, d_offsets);
+  auto h_vertices = cugraph::test::to_host(handle, d_vertices);
+  auto h_weights  = cugraph::test::to_host(handle, d_weights);
+
+  EXPECT_EQ(h_offsets.size(), num_paths + 1);
+  EXPECT_EQ(h_offsets.back(), h_vertices.size());
+
+  std::vector<vertex_t> h_padded_vertices(num_paths * (max_length + 1),
+                                          cugraph::invalid_vertex_id<vertex_t>::value);
+  auto h_padded_weights =
+    h_weights ? std::make_optional<std::vector<weight_t>>(num_paths * max_length, weight_t{0})
+              : std::nullopt;
+  for (size_t i = 0; i < num_paths; ++i) {
+    auto length = h_offsets[i + 1] - h_offsets[i];
+    EXPECT_TRUE((length >= 1) && (length <= max_length + 1));
+    std::copy(h_vertices.begin() + h_offsets[i],
+              h_vertices.begin() + h_offsets[i + 1],
+              h_padded_vertices.begin() + i * (max_length + 1));
+    if (h_weights) {
+      std::copy((*h_weights).begin() + (h_offsets[i] - i),
+                (*h_weights).begin() + (h_offsets[i + 1] - (i + 1)),
+                (*h_padded_weights).begin() + i * max_length);
+    }
+  }
+
+  return std::make_tuple(cugraph::test::to_device(handle, h_padded_vertices),
+                         cugraph::test::to_device(handle, h_padded_weights));
+}
+
 struct UniformRandomWalks_Usecase {
   bool test_weighted{false};
   uint64_t seed{0};
@@ -49,6 +96,180 @@ struct UniformRandomWalks_Usecase {
   bool expect_throw() { return false; }
 };
 
+struct CompactedUniformRandomWalks_Usecase {
+  bool test_weighted{false};
+  uint64_t seed{0};
+  bool check_correctness{false};
+
+  // returns the paths in the padded format (to share the validation code with the other random
+  // walk functions)
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+  operator()(raft::handle_t const& handle,
+             cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+             std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+             raft::device_span<vertex_t const> start_vertices,
+             size_t max_length)
+  {
+    raft::random::RngState rng_state(0);
+
+    auto [d_offsets, d_vertices, d_weights] = cugraph::compacted_uniform_random_walks(
+      handle, rng_state, graph_view, edge_weight_view, start_vertices, max_length);
+
+    return to_padded_paths(
+      handle, d_offsets, d_vertices, d_weights, start_vertices.size(), max_length);
+  }
+
+  bool expect_throw() { return false; }
+};
+
+// check that the k'th step of every path (in the padded format) traverses an edge of type
+// metapath[k] and that a path terminates early only if the last vertex does not have an outgoing
+// edge of the required type
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+void check_metapath_edge_types(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+  cugraph::edge_property_view_t<edge_t, int32_t const*> edge_type_view,
+  std::vector<int32_t> const& h_metapath,
+  rmm::device_uvector<vertex_t> const& d_padded_vertices)
+{
+  auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+    handle,
+    graph_view,
+    std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+    std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+    std::make_optional(edge_type_view),
+    std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+  auto h_srcs  = cugraph::test::to_host(handle, d_srcs);
+  auto h_dsts  = cugraph::test::to_host(handle, d_dsts);
+  auto h_types = cugraph::test::to_host(handle, *d_types);
+
+  std::set<std::tuple<vertex_t, vertex_t, int32_t>> typed_edges{};
+  std::set<std::tuple<vertex_t, int32_t>> src_types{};
+  for (size_t i = 0; i < h_srcs.size(); ++i) {
+    typed_edges.insert(std::make_tuple(h_srcs[i], h_dsts[i], h_types[i]));
+    src_types.insert(std::make_tuple(h_srcs[i], h_types[i]));
+  }
+
+  auto max_length = h_metapath.size();
+  auto h_vertices = cugraph::test::to_host(handle, d_padded_vertices);
+  for (size_t i = 0; i < h_vertices.size() / (max_length + 1); ++i) {
+    auto path = h_vertices.begin() + i * (max_length + 1);
+    for (size_t j = 0; j < max_length; ++j) {
+      if (path[j + 1] == cugraph::invalid_vertex_id<vertex_t>::value) {
+        EXPECT_TRUE(src_types.find(std::make_tuple(path[j], h_metapath[j])) == src_types.end())
+          << "A path terminated early although an edge of the required type exists.";
+        break;
+      }
+      EXPECT_TRUE(typed_edges.find(std::make_tuple(path[j], path[j + 1], h_metapath[j])) !=
+                  typed_edges.end())
+        << "A traversed edge does not have the edge type required by the metapath.";
+    }
+  }
+}
+
+struct CompactedMetapathRandomWalks_Usecase {
+  int32_t num_edge_types{3};
+  bool test_weighted{false};
+  uint64_t seed{0};
+  bool check_correctness{false};
+
+  // the metapath cycles through the edge types, the edge types of the traversed edges are checked
+  // here, and the paths are returned in the padded format for the shared validation
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+  operator()(raft::handle_t const& handle,
+             cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+             std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+             raft::device_span<vertex_t const> start_vertices,
+             size_t max_length)
+  {
+    raft::random::RngState rng_state(0);
+
+    auto edge_types =
+      cugraph::test::generate<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                              int32_t>::edge_property(handle, graph_view, num_edge_types);
+    auto edge_type_index = cugraph::build_edge_partition_edge_type_index(
+      handle, graph_view, edge_types.view(), num_edge_types, true);
+
+    std::vector<int32_t> h_metapath(max_length);
+    for (size_t i = 0; i < max_length; ++i) {
+      h_metapath[i] = static_cast<int32_t>(i % num_edge_types);
+    }
+    auto d_metapath = cugraph::test::to_device(handle, h_metapath);
+
+    auto [d_offsets, d_vertices, d_weights] = cugraph::compacted_metapath_random_walks(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      edge_type_index[0].view(),
+      start_vertices,
+      raft::device_span<int32_t const>(d_metapath.data(), d_metapath.size()));
+
+    auto [d_padded_vertices, d_padded_weights] = to_padded_paths(
+      handle, d_offsets, d_vertices, d_weights, start_vertices.size(), max_length);
+
+    if (check_correctness) {
+      check_metapath_edge_types(
+        handle, graph_view, edge_types.view(), h_metapath, d_padded_vertices);
+    }
+
+    return std::make_tuple(std::move(d_padded_vertices), std::move(d_padded_weights));
+  }
+
+  bool expect_throw() { return false; }
+};
+
+struct MetapathRandomWalks_Usecase {
+  int32_t num_edge_types{3};
+  bool test_weighted{false};
+  uint64_t seed{0};
+  bool check_correctness{false};
+
+  // the metapath cycles through the edge types, the edge types of the traversed edges are checked
+  // here
+  template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+  std::tuple<rmm::device_uvector<vertex_t>, std::optional<rmm::device_uvector<weight_t>>>
+  operator()(raft::handle_t const& handle,
+             cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu> const& graph_view,
+             std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view,
+             raft::device_span<vertex_t const> start_vertices,
+             size_t max_length)
+  {
+    raft::random::RngState rng_state(0);
+
+    auto edge_types =
+      cugraph::test::generate<cugraph::graph_view_t<vertex_t, edge_t, false, multi_gpu>,
+                              int32_t>::edge_property(handle, graph_view, num_edge_types);
+
+    std::vector<int32_t> h_metapath(max_length);
+    for (size_t i = 0; i < max_length; ++i) {
+      h_metapath[i] = static_cast<int32_t>(i % num_edge_types);
+    }
+    auto d_metapath = cugraph::test::to_device(handle, h_metapath);
+
+    auto [d_vertices, d_weights] = cugraph::metapath_random_walks(
+      handle,
+      rng_state,
+      graph_view,
+      edge_weight_view,
+      edge_types.view(),
+      num_edge_types,
+      start_vertices,
+      raft::device_span<int32_t const>(d_metapath.data(), d_metapath.size()));
+
+    if (check_correctness) {
+      check_metapath_edge_types(handle, graph_view, edge_types.view(), h_metapath, d_vertices);
+    }
+
+    return std::make_tuple(std::move(d_vertices), std::move(d_weights));
+  }
+
+  bool expect_throw() { return false; }
+};
+
 struct BiasedRandomWalks_Usecase {
   bool test_weighted{true};
   uint64_t seed{0};
@@ -192,6 +413,14 @@ using Tests_UniformRandomWalks_File =
   Tests_RandomWalks<std::tuple<UniformRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_UniformRandomWalks_Rmat =
   Tests_RandomWalks<std::tuple<UniformRandomWalks_Usecase, cugraph::test::Rmat_Usecase>>;
+using Tests_CompactedUniformRandomWalks_File =
+  Tests_RandomWalks<std::tuple<CompactedUniformRandomWalks_Usecase, cugraph::test::File_Usecase>>;
+using Tests_CompactedUniformRandomWalks_Rmat =
+  Tests_RandomWalks<std::tuple<CompactedUniformRandomWalks_Usecase, cugraph::test::Rmat_Usecase>>;
+using Tests_CompactedMetapathRandomWalks_File =
+  Tests_RandomWalks<std::tuple<CompactedMetapathRandomWalks_Usecase, cugraph::test::File_Usecase>>;
+using Tests_MetapathRandomWalks_File =
+  Tests_RandomWalks<std::tuple<MetapathRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_BiasedRandomWalks_File =
   Tests_RandomWalks<std::tuple<BiasedRandomWalks_Usecase, cugraph::test::File_Usecase>>;
 using Tests_BiasedRandomWalks_Rmat =
@@ -213,6 +442,30 @@ TEST_P(Tests_UniformRandomWalks_Rmat, Initialize_i32_i32_f)
     override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
 }
 
+TEST_P(Tests_CompactedUniformRandomWalks_File, Initialize_i32_i32_f)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_CompactedUniformRandomWalks_Rmat, Initialize_i32_i32_f)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_CompactedMetapathRandomWalks_File, Initialize_i32_i32_f)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MetapathRandomWalks_File, Initialize_i32_i32_f)
+{
+  run_current_test<int32_t, int32_t, float>(
+    override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
 TEST_P(Tests_BiasedRandomWalks_File, Initialize_i32_i32_f)
 {
   run_current_test<int32_t, int32_t, float>(
@@ -244,6 +497,29 @@ INSTANTIATE_TEST_SUITE_P(
                                        UniformRandomWalks_Usecase{true, 0, true}),
                      ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
 
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_CompactedUniformRandomWalks_File,
+  ::testing::Combine(::testing::Values(CompactedUniformRandomWalks_Usecase{false, 0, true},
+                                       CompactedUniformRandomWalks_Usecase{true, 0, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_CompactedMetapathRandomWalks_File,
+  ::testing::Combine(::testing::Values(CompactedMetapathRandomWalks_Usecase{1, false, 0, true},
+                                       CompactedMetapathRandomWalks_Usecase{3, false, 0, true},
+                                       CompactedMetapathRandomWalks_Usecase{3, true, 0, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MetapathRandomWalks_File,
+  ::testing::Combine(::testing::Values(MetapathRandomWalks_Usecase{1, false, 0, true},
+                                       MetapathRandomWalks_Usecase{3, false, 0, true},
+                                       MetapathRandomWalks_Usecase{3, true, 0, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"))));
+
 INSTANTIATE_TEST_SUITE_P(
   file_test,
   Tests_BiasedRandomWalks_File,
@@ -303,6 +579,21 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(UniformRandomWalks_Usecase{true, 0, false}),
     ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
 
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_CompactedUniformRandomWalks_Rmat,
+  ::testing::Combine(
+    ::testing::Values(CompactedUniformRandomWalks_Usecase{false, 0, true},
+                      CompactedUniformRandomWalks_Usecase{true, 0, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test,
+  Tests_CompactedUniformRandomWalks_Rmat,
+  ::testing::Combine(
+    ::testing::Values(CompactedUniformRandomWalks_Usecase{true, 0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
   Tests_BiasedRandomWalks_Rmat,
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+struct Subgraph_Sampling_Usecase {
+  size_t clusters_per_subgraph{4};
+  size_t num_subgraphs{8};
+  size_t num_roots_per_subgraph{4};
+  size_t walk_length{0};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t, typename vertex_t, typename edge_t, typename weight_t>
+class Tests_Subgraph_Sampling
+  : public ::testing::TestWithParam<std::tuple<Subgraph_Sampling_Usecase, input_usecase_t>> {
+ public:
+  Tests_Subgraph_Sampling() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void run_current_test(Subgraph_Sampling_Usecase const& subgraph_sampling_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    raft::random::RngState rng_state(0);
+
+    // 1. cluster subgraph sampling (vertices are assigned to clusters in a round robin fashion)
+
+    std::vector<vertex_t> h_clustering(graph_view.number_of_vertices());
+    auto num_clusters = std::max(graph_view.number_of_vertices() / vertex_t{8}, vertex_t{1});
+    for (size_t i = 0; i < h_clustering.size(); ++i) {
+      h_clustering[i] = static_cast<vertex_t>(i) % num_clusters;
+    }
+    auto d_clustering = cugraph::test::to_device(handle, h_clustering);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Cluster subgraph sampling");
+    }
+
+    auto [cluster_srcs, cluster_dsts, cluster_weights, cluster_offsets] =
+      cugraph::cluster_subgraph_sample(
+        handle,
+        rng_state,
+        graph_view,
+        edge_weight_view,
+        raft::device_span<vertex_t const>(d_clustering.data(), d_clustering.size()),
+        subgraph_sampling_usecase.clusters_per_subgraph);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 2. random vertex (GraphSAINT) subgraph sampling
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Random vertex subgraph sampling");
+    }
+
+    auto [vertex_srcs, vertex_dsts, vertex_weights, vertex_offsets] =
+      cugraph::random_vertex_subgraph_sample(
+        handle,
+        rng_state,
+        graph_view,
+        edge_weight_view,
+        subgraph_sampling_usecase.num_subgraphs,
+        std::min(subgraph_sampling_usecase.num_roots_per_subgraph,
+                 static_cast<size_t>(graph_view.number_of_vertices())),
+        subgraph_sampling_usecase.walk_length);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (subgraph_sampling_usecase.check_correctness) {
+      rmm::device_uvector<vertex_t> d_graph_srcs(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_graph_dsts(0, handle.get_stream());
+      std::tie(d_graph_srcs, d_graph_dsts, std::ignore, std::ignore, std::ignore) =
+        cugraph::decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t, false, false>(
+          handle, graph_view, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+      auto h_graph_srcs = cugraph::test::to_host(handle, d_graph_srcs);
+      auto h_graph_dsts = cugraph::test::to_host(handle, d_graph_dsts);
+      std::set<std::pair<vertex_t, vertex_t>> graph_edges{};
+      for (size_t i = 0; i < h_graph_srcs.size(); ++i) {
+        graph_edges.insert(std::make_pair(h_graph_srcs[i], h_graph_dsts[i]));
+      }
+
+      // every subgraph edge should be an input graph edge, and the cluster subgraphs should
+      // include every edge with both end points in the clusters of the same subgraph
+
+      auto h_cluster_srcs    = cugraph::test::to_host(handle, cluster_srcs);
+      auto h_cluster_dsts    = cugraph::test::to_host(handle, cluster_dsts);
+      auto h_cluster_offsets = cugraph::test::to_host(handle, cluster_offsets);
+      auto num_cluster_subgraphs =
+        (static_cast<size_t>(num_clusters) + subgraph_sampling_usecase.clusters_per_subgraph - 1) /
+        subgraph_sampling_usecase.clusters_per_subgraph;
+      ASSERT_EQ(h_cluster_offsets.size(), num_cluster_subgraphs + 1);
+      ASSERT_EQ(h_cluster_offsets.back(), h_cluster_srcs.size());
+
+      std::map<vertex_t, size_t> cluster_to_subgraph{};
+      for (size_t i = 0; i + 1 < h_cluster_offsets.size(); ++i) {
+        std::set<vertex_t> subgraph_clusters{};
+        for (size_t j = h_cluster_offsets[i]; j < h_cluster_offsets[i + 1]; ++j) {
+          ASSERT_TRUE(graph_edges.find(std::make_pair(h_cluster_srcs[j], h_cluster_dsts[j])) !=
+                      graph_edges.end())
+            << "Sampled edge is not in the input graph.";
+          subgraph_clusters.insert(h_clustering[h_cluster_srcs[j]]);
+          subgraph_clusters.insert(h_clustering[h_cluster_dsts[j]]);
+        }
+        ASSERT_LE(subgraph_clusters.size(), subgraph_sampling_usecase.clusters_per_subgraph);
+        for (auto c : subgraph_clusters) {
+          ASSERT_TRUE(cluster_to_subgraph.find(c) == cluster_to_subgraph.end())
+            << "A cluster is included in multiple subgraphs.";
+          cluster_to_subgraph.insert(std::make_pair(c, i));
+        }
+      }
+
+      size_t num_intra_subgraph_edges{0};
+      for (size_t i = 0; i < h_graph_srcs.size(); ++i) {
+        auto src_it = cluster_to_subgraph.find(h_clustering[h_graph_srcs[i]]);
+        auto dst_it = cluster_to_subgraph.find(h_clustering[h_graph_dsts[i]]);
+        if ((src_it != cluster_to_subgraph.end()) && (dst_it != cluster_to_subgraph.end()) &&
+            (src_it->second == dst_it->second)) {
+          ++num_intra_subgraph_edges;
+        }
+      }
+      ASSERT_EQ(num_intra_subgraph_edges, h_cluster_srcs.size())
+        << "Cluster subgraphs do not include every intra-subgraph edge.";
+
+      auto h_vertex_srcs    = cugraph::test::to_host(handle, vertex_srcs);
+      auto h_vertex_dsts    = cugraph::test::to_host(handle, vertex_dsts);
+      auto h_vertex_offsets = cugraph::test::to_host(handle, vertex_offsets);
+      ASSERT_EQ(h_vertex_offsets.size(), subgraph_sampling_usecase.num_subgraphs + 1);
+      ASSERT_EQ(h_vertex_offsets.back(), h_vertex_srcs.size());
+      for (size_t i = 0; i < h_vertex_srcs.size(); ++i) {
+        ASSERT_TRUE(graph_edges.find(std::make_pair(h_vertex_srcs[i], h_vertex_dsts[i])) !=
+                    graph_edges.end())
+          << "Sampled edge is not in the input graph.";
+      }
+      if (subgraph_sampling_usecase.walk_length == 0) {
+        for (size_t i = 0; i + 1 < h_vertex_offsets.size(); ++i) {
+          std::set<vertex_t> subgraph_vertices{};
+          for (size_t j = h_vertex_offsets[i]; j < h_vertex_offsets[i + 1]; ++j) {
+            subgraph_vertices.insert(h_vertex_srcs[j]);
+            subgraph_vertices.insert(h_vertex_dsts[j]);
+          }
+          ASSERT_LE(subgraph_vertices.size(), subgraph_sampling_usecase.num_roots_per_subgraph);
+        }
+      }
+    }
+  }
+};
+
+using Tests_Subgraph_Sampling_File =
+  Tests_Subgraph_Sampling<cugraph::test::File_Usecase, int32_t, int32_t, float>;
+
+using Tests_Subgraph_Sampling_Rmat =
+  Tests_Subgraph_Sampling<cugraph::test::Rmat_Usecase, int64_t, int64_t, float>;
+
+TEST_P(Tests_Subgraph_Sampling_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test(std::get<0>(param),
+                   override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Subgraph_Sampling_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test(std::get<0>(param),
+                   override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Subgraph_Sampling_File,
+  ::testing::Combine(::testing::Values(Subgraph_Sampling_Usecase{1, 4, 8, 0},
+                                       Subgraph_Sampling_Usecase{2, 4, 4, 3}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Subgraph_Sampling_Rmat,
+  ::testing::Combine(::testing::Values(Subgraph_Sampling_Usecase{4, 8, 64, 0},
+                                       Subgraph_Sampling_Usecase{4, 8, 16, 4}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Subgraph_Sampling_Rmat,
+  ::testing::Combine(::testing::Values(Subgraph_Sampling_Usecase{64, 16, 4096, 4, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
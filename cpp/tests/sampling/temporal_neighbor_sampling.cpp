@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/property_generator_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+struct Temporal_Neighbor_Sampling_Usecase {
+  std::vector<int32_t> fanout{{10}};
+  size_t num_starting_vertices{64};
+  std::optional<int64_t> time_window{std::nullopt};
+  bool with_replacement{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_Temporal_Neighbor_Sampling
+  : public ::testing::TestWithParam<
+      std::tuple<Temporal_Neighbor_Sampling_Usecase, input_usecase_t>> {
+ public:
+  Tests_Temporal_Neighbor_Sampling() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(
+    Temporal_Neighbor_Sampling_Usecase const& temporal_neighbor_sampling_usecase,
+    input_usecase_t const& input_usecase)
+  {
+    using edge_time_t = int64_t;
+
+    constexpr int32_t num_time_stamps{100};
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, true);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    auto edge_ids = cugraph::test::generate<decltype(graph_view), edge_t>::unique_edge_property(
+      handle, graph_view);
+    auto edge_times = cugraph::test::generate<decltype(graph_view), edge_time_t>::edge_property(
+      handle, graph_view, num_time_stamps);
+
+    raft::random::RngState rng_state(0);
+
+    auto starting_vertices = cugraph::select_random_vertices(
+      handle,
+      graph_view,
+      std::optional<raft::device_span<vertex_t const>>{std::nullopt},
+      rng_state,
+      std::min(temporal_neighbor_sampling_usecase.num_starting_vertices,
+               static_cast<size_t>(graph_view.number_of_vertices())),
+      true,
+      false);
+
+    // every starting vertex gets its own label (to map the sampled edges back to the time bound of
+    // their starting vertex)
+
+    std::vector<edge_time_t> h_time_bounds(starting_vertices.size());
+    for (size_t i = 0; i < h_time_bounds.size(); ++i) {
+      h_time_bounds[i] = static_cast<edge_time_t>((i * 37) % num_time_stamps) + 1;
+    }
+    std::vector<int32_t> h_labels(starting_vertices.size());
+    std::iota(h_labels.begin(), h_labels.end(), int32_t{0});
+
+    auto d_time_bounds = cugraph::test::to_device(handle, h_time_bounds);
+    auto d_labels      = cugraph::test::to_device(handle, h_labels);
+
+    cugraph::sampling_flags_t sampling_flags{cugraph::prior_sources_behavior_t::DEFAULT,
+                                             false,
+                                             false,
+                                             temporal_neighbor_sampling_usecase.with_replacement};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Temporal neighbor sampling");
+    }
+
+    auto [srcs, dsts, weights, sampled_edge_ids, edge_types, hops, offsets] =
+      cugraph::heterogeneous_uniform_temporal_neighbor_sample(
+        handle,
+        rng_state,
+        graph_view,
+        edge_weight_view,
+        std::make_optional(edge_ids.view()),
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        edge_times.view(),
+        raft::device_span<vertex_t const>(starting_vertices.data(), starting_vertices.size()),
+        raft::device_span<edge_time_t const>(d_time_bounds.data(), d_time_bounds.size()),
+        temporal_neighbor_sampling_usecase.time_window,
+        std::make_optional(raft::device_span<int32_t const>(d_labels.data(), d_labels.size())),
+        std::nullopt,
+        raft::host_span<int32_t const>(temporal_neighbor_sampling_usecase.fanout.data(),
+                                       temporal_neighbor_sampling_usecase.fanout.size()),
+        int32_t{1},
+        sampling_flags);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (temporal_neighbor_sampling_usecase.check_correctness) {
+      ASSERT_TRUE(sampled_edge_ids.has_value());
+      ASSERT_TRUE(offsets.has_value());
+      ASSERT_EQ((*offsets).size(), h_labels.size() + 1);
+
+      // edge ID => edge time
+
+      auto num_edges = edge_ids.view().edge_counts()[0];
+      std::vector<edge_t> h_edge_ids(num_edges);
+      std::vector<edge_time_t> h_edge_times(num_edges);
+      raft::update_host(
+        h_edge_ids.data(), edge_ids.view().value_firsts()[0], num_edges, handle.get_stream());
+      raft::update_host(
+        h_edge_times.data(), edge_times.view().value_firsts()[0], num_edges, handle.get_stream());
+      handle.sync_stream();
+
+      std::vector<edge_time_t> h_edge_id_to_time(num_edges);
+      for (edge_t i = 0; i < num_edges; ++i) {
+        h_edge_id_to_time[h_edge_ids[i]] = h_edge_times[i];
+      }
+
+      auto h_sampled_edge_ids = cugraph::test::to_host(handle, *sampled_edge_ids);
+      auto h_offsets          = cugraph::test::to_host(handle, *offsets);
+
+      ASSERT_EQ(h_offsets.back(), h_sampled_edge_ids.size());
+
+      for (size_t l = 0; l < h_labels.size(); ++l) {
+        for (auto i = h_offsets[l]; i < h_offsets[l + 1]; ++i) {
+          auto edge_time = h_edge_id_to_time[h_sampled_edge_ids[i]];
+          ASSERT_TRUE(edge_time < h_time_bounds[l])
+            << "Sampled edge " << h_sampled_edge_ids[i] << " (time " << edge_time
+            << ") is not older than the time bound (" << h_time_bounds[l]
+            << ") of its starting vertex.";
+          if (temporal_neighbor_sampling_usecase.time_window) {
+            ASSERT_TRUE(edge_time >=
+                        h_time_bounds[l] - *(temporal_neighbor_sampling_usecase.time_window))
+              << "Sampled edge " << h_sampled_edge_ids[i] << " (time " << edge_time
+              << ") is outside the time window of its starting vertex.";
+          }
+        }
+      }
+    }
+  }
+};
+
+using Tests_Temporal_Neighbor_Sampling_File =
+  Tests_Temporal_Neighbor_Sampling<cugraph::test::File_Usecase>;
+using Tests_Temporal_Neighbor_Sampling_Rmat =
+  Tests_Temporal_Neighbor_Sampling<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Temporal_Neighbor_Sampling_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_Temporal_Neighbor_Sampling_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Temporal_Neighbor_Sampling_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Temporal_Neighbor_Sampling_File,
+  ::testing::Combine(
+    ::testing::Values(Temporal_Neighbor_Sampling_Usecase{{10}, 16, std::nullopt, true},
+                      Temporal_Neighbor_Sampling_Usecase{{10, 5}, 16, std::nullopt, false},
+                      Temporal_Neighbor_Sampling_Usecase{{10, 5}, 16, int64_t{20}, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Temporal_Neighbor_Sampling_Rmat,
+  ::testing::Combine(
+    ::testing::Values(Temporal_Neighbor_Sampling_Usecase{{10}, 64, std::nullopt, true},
+                      Temporal_Neighbor_Sampling_Usecase{{10, 5, 2}, 64, std::nullopt, false},
+                      Temporal_Neighbor_Sampling_Usecase{{10, 5, 2}, 64, int64_t{30}, true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Temporal_Neighbor_Sampling_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      Temporal_Neighbor_Sampling_Usecase{{10, 25}, 1024, int64_t{50}, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
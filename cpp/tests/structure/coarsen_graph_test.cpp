@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -228,6 +228,8 @@ struct CoarsenGraph_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+  cugraph::coarsen_groupby_t groupby{cugraph::coarsen_groupby_t::sort};
+  bool consume_input{false};  // use the coarsen_graph overload consuming the input graph
 };
 
 template <typename input_usecase_t>
@@ -294,13 +296,45 @@ class Tests_CoarsenGraph
     rmm::device_uvector<vertex_t> d_labels(h_labels.size(), handle.get_stream());
     raft::update_device(d_labels.data(), h_labels.data(), h_labels.size(), handle.get_stream());
 
+    // the input graph is released while coarsening if coarsen_graph_usecase.consume_input is true
+    std::vector<edge_t> h_org_offsets{};
+    std::vector<vertex_t> h_org_indices{};
+    std::optional<std::vector<weight_t>> h_org_weights{std::nullopt};
+    if (coarsen_graph_usecase.check_correctness) {
+      std::tie(h_org_offsets, h_org_indices, h_org_weights) =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, store_transposed, false>(
+          handle, graph_view, edge_weight_view, std::nullopt);
+    }
+    auto org_number_of_vertices = graph_view.number_of_vertices();
+
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
       hr_timer.start("Graph coarsening");
     }
 
-    auto [coarse_graph, coarse_edge_weights, coarse_vertices_to_labels] =
-      cugraph::coarsen_graph(handle, graph_view, edge_weight_view, d_labels.begin(), true);
+    cugraph::graph_t<vertex_t, edge_t, store_transposed, false> coarse_graph(handle);
+    std::optional<cugraph::edge_property_t<decltype(graph_view), weight_t>> coarse_edge_weights{
+      std::nullopt};
+    std::optional<rmm::device_uvector<vertex_t>> coarse_vertices_to_labels{std::nullopt};
+    if (coarsen_graph_usecase.consume_input) {
+      ASSERT_FALSE(coarsen_graph_usecase.edge_masking)
+        << "Invalid test usecase: graph_t cannot hold an edge mask.";
+      std::tie(coarse_graph, coarse_edge_weights, coarse_vertices_to_labels) =
+        cugraph::coarsen_graph(
+          handle, std::move(graph), std::move(edge_weights), d_labels.begin(), true);
+      ASSERT_EQ(graph.number_of_edges(), edge_t{0})
+        << "The input graph should be released while coarsening.";
+      ASSERT_FALSE(edge_weights.has_value())
+        << "The input edge weights should be released while coarsening.";
+    } else {
+      std::tie(coarse_graph, coarse_edge_weights, coarse_vertices_to_labels) =
+        cugraph::coarsen_graph(handle,
+                               graph_view,
+                               edge_weight_view,
+                               d_labels.begin(),
+                               true,
+                               coarsen_graph_usecase.groupby);
+    }
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -309,10 +343,6 @@ class Tests_CoarsenGraph
     }
 
     if (coarsen_graph_usecase.check_correctness) {
-      auto [h_org_offsets, h_org_indices, h_org_weights] =
-        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, store_transposed, false>(
-          handle, graph_view, edge_weight_view, std::nullopt);
-
       auto coarse_graph_view = coarse_graph.view();
       auto coarse_edge_weight_view =
         coarse_edge_weights ? std::make_optional((*coarse_edge_weights).view()) : std::nullopt;
@@ -333,7 +363,7 @@ class Tests_CoarsenGraph
         h_coarse_weights ? std::optional<weight_t const*>{(*h_coarse_weights).data()}
                          : std::nullopt,
         h_coarse_vertices_to_labels.data(),
-        graph_view.number_of_vertices(),
+        org_number_of_vertices,
         coarse_graph_view.number_of_vertices());
     }
   }
@@ -386,7 +416,13 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(CoarsenGraph_Usecase{0.2, false, false},
                       CoarsenGraph_Usecase{0.2, false, true},
                       CoarsenGraph_Usecase{0.2, true, false},
-                      CoarsenGraph_Usecase{0.2, true, true}),
+                      CoarsenGraph_Usecase{0.2, true, true},
+                      CoarsenGraph_Usecase{
+                        0.2, false, false, true, cugraph::coarsen_groupby_t::hash},
+                      CoarsenGraph_Usecase{
+                        0.2, true, true, true, cugraph::coarsen_groupby_t::hash},
+                      CoarsenGraph_Usecase{
+                        0.2, true, false, true, cugraph::coarsen_groupby_t::sort, true}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
 
@@ -398,7 +434,13 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(CoarsenGraph_Usecase{0.2, false, false},
                       CoarsenGraph_Usecase{0.2, false, true},
                       CoarsenGraph_Usecase{0.2, true, false},
-                      CoarsenGraph_Usecase{0.2, true, true}),
+                      CoarsenGraph_Usecase{0.2, true, true},
+                      CoarsenGraph_Usecase{
+                        0.2, false, false, true, cugraph::coarsen_groupby_t::hash},
+                      CoarsenGraph_Usecase{
+                        0.2, true, true, true, cugraph::coarsen_groupby_t::hash},
+                      CoarsenGraph_Usecase{
+                        0.2, true, false, true, cugraph::coarsen_groupby_t::sort, true}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false),
                       cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
 
@@ -427,7 +469,12 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(CoarsenGraph_Usecase{0.2, false, false, false},
                       CoarsenGraph_Usecase{0.2, false, true, false},
                       CoarsenGraph_Usecase{0.2, true, false, false},
-                      CoarsenGraph_Usecase{0.2, true, true, false}),
+                      CoarsenGraph_Usecase{0.2, true, true, false},
+                      // compare with the sort based groupby
+                      CoarsenGraph_Usecase{
+                        0.2, false, false, false, cugraph::coarsen_groupby_t::hash},
+                      CoarsenGraph_Usecase{
+                        0.2, true, false, false, cugraph::coarsen_groupby_t::hash}),
     ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false),
                       cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/detail/utility_wrappers.hpp>
+#include <cugraph/edge_partition_edge_time_index.hpp>
+#include <cugraph/edge_property.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/random/rng_state.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+struct EdgeTimeWindow_Usecase {
+  int32_t window_size{};
+  int32_t window_step{};
+  size_t num_steps{};
+  bool check_correctness{true};
+};
+
+using edge_time_t = int32_t;
+
+template <typename input_usecase_t>
+class Tests_EdgeTimeWindow
+  : public ::testing::TestWithParam<std::tuple<EdgeTimeWindow_Usecase, input_usecase_t>> {
+ public:
+  Tests_EdgeTimeWindow() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, bool store_transposed>
+  void run_current_test(EdgeTimeWindow_Usecase const& edge_time_window_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    constexpr edge_time_t max_time{1000};
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    cugraph::graph_t<vertex_t, edge_t, store_transposed, false> graph(handle);
+    std::tie(graph, std::ignore, std::ignore) =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, false, true);
+    auto graph_view = graph.view();
+
+    cugraph::edge_property_t<decltype(graph_view), edge_time_t> edge_times(handle, graph_view);
+    raft::random::RngState rng_state(0);
+    cugraph::detail::uniform_random_fill(handle.get_stream(),
+                                         edge_times.mutable_view().value_firsts()[0],
+                                         edge_times.mutable_view().edge_counts()[0],
+                                         edge_time_t{0},
+                                         max_time,
+                                         rng_state);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Build edge time index");
+    }
+
+    auto edge_time_indices =
+      cugraph::build_edge_partition_edge_time_index(handle, graph_view, edge_times.view());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto h_edge_times = cugraph::test::to_host(
+      handle,
+      raft::device_span<edge_time_t const>(edge_times.view().value_firsts()[0],
+                                           edge_times.view().edge_counts()[0]));
+
+    auto window_size = edge_time_window_usecase.window_size;
+
+    auto check_window = [&](auto const& edge_mask, edge_time_t window_start) {
+      auto h_mask = cugraph::test::to_host(
+        handle,
+        raft::device_span<uint32_t const>(
+          edge_mask.view().value_firsts()[0],
+          cugraph::packed_bool_size(edge_mask.view().edge_counts()[0])));
+      for (size_t i = 0; i < h_edge_times.size(); ++i) {
+        bool in_window =
+          (h_edge_times[i] >= window_start) && (h_edge_times[i] < window_start + window_size);
+        bool selected = (h_mask[cugraph::packed_bool_offset(i)] & cugraph::packed_bool_mask(i)) !=
+                        cugraph::packed_bool_empty_mask();
+        ASSERT_EQ(in_window, selected) << "edge " << i << " (time " << h_edge_times[i]
+                                       << ") window start " << window_start;
+      }
+    };
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Create and slide edge time window mask");
+    }
+
+    edge_time_t window_start{0};
+    auto edge_mask = cugraph::create_edge_time_window_mask(
+      handle, graph_view, edge_time_indices, window_start, window_start + window_size);
+
+    if (edge_time_window_usecase.check_correctness) { check_window(edge_mask, window_start); }
+
+    for (size_t i = 0; i < edge_time_window_usecase.num_steps; ++i) {
+      auto new_window_start = window_start + edge_time_window_usecase.window_step;
+      cugraph::update_edge_time_window_mask(handle,
+                                            graph_view,
+                                            edge_time_indices,
+                                            edge_mask.mutable_view(),
+                                            window_start,
+                                            window_start + window_size,
+                                            new_window_start,
+                                            new_window_start + window_size);
+      window_start = new_window_start;
+
+      if (edge_time_window_usecase.check_correctness) { check_window(edge_mask, window_start); }
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (edge_time_window_usecase.check_correctness) {
+      graph_view.attach_edge_mask(edge_mask.view());
+      size_t num_window_edges{0};
+      for (auto t : h_edge_times) {
+        if ((t >= window_start) && (t < window_start + window_size)) { ++num_window_edges; }
+      }
+      ASSERT_EQ(static_cast<size_t>(graph_view.compute_number_of_edges(handle)),
+                num_window_edges);
+    }
+  }
+};
+
+using Tests_EdgeTimeWindow_File = Tests_EdgeTimeWindow<cugraph::test::File_Usecase>;
+using Tests_EdgeTimeWindow_Rmat = Tests_EdgeTimeWindow<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_EdgeTimeWindow_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgeTimeWindow_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgeTimeWindow_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_EdgeTimeWindow_Rmat, CheckInt32Int32Transposed)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_EdgeTimeWindow_File,
+  ::testing::Combine(
+    // sliding (overlapping windows), hopping (disjoint windows), and shrinking to empty windows
+    ::testing::Values(EdgeTimeWindow_Usecase{100, 10, 20},
+                      EdgeTimeWindow_Usecase{100, 250, 4},
+                      EdgeTimeWindow_Usecase{0, 50, 2}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_EdgeTimeWindow_Rmat,
+  ::testing::Combine(
+    ::testing::Values(EdgeTimeWindow_Usecase{100, 10, 20}, EdgeTimeWindow_Usecase{100, 250, 4}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_EdgeTimeWindow_Rmat,
+  ::testing::Combine(
+    ::testing::Values(EdgeTimeWindow_Usecase{100, 10, 20, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
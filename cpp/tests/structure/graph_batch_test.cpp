@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+
+#include <cugraph/graph_batch.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+template <typename vertex_t, typename weight_t>
+struct host_graph_t {
+  std::vector<std::vector<vertex_t>> nbrs{};
+  std::vector<std::vector<weight_t>> weights{};
+};
+
+template <typename vertex_t>
+std::vector<vertex_t> bfs_reference(std::vector<std::vector<vertex_t>> const& nbrs,
+                                    vertex_t source)
+{
+  std::vector<vertex_t> distances(nbrs.size(), std::numeric_limits<vertex_t>::max());
+  std::queue<vertex_t> q{};
+  distances[source] = 0;
+  q.push(source);
+  while (!q.empty()) {
+    auto v = q.front();
+    q.pop();
+    for (auto nbr : nbrs[v]) {
+      if (distances[nbr] == std::numeric_limits<vertex_t>::max()) {
+        distances[nbr] = distances[v] + 1;
+        q.push(nbr);
+      }
+    }
+  }
+  return distances;
+}
+
+template <typename vertex_t>
+std::vector<vertex_t> connected_components_reference(
+  std::vector<std::vector<vertex_t>> const& nbrs)
+{
+  std::vector<vertex_t> components(nbrs.size(), std::numeric_limits<vertex_t>::max());
+  for (vertex_t v = 0; v < static_cast<vertex_t>(nbrs.size()); ++v) {
+    if (components[v] != std::numeric_limits<vertex_t>::max()) { continue; }
+    auto distances = bfs_reference(nbrs, v);
+    for (size_t i = 0; i < nbrs.size(); ++i) {
+      if (distances[i] != std::numeric_limits<vertex_t>::max()) { components[i] = v; }
+    }
+  }
+  return components;
+}
+
+template <typename vertex_t, typename edge_t>
+std::vector<edge_t> triangle_count_reference(std::vector<std::vector<vertex_t>> const& nbrs)
+{
+  std::vector<edge_t> counts(nbrs.size(), edge_t{0});
+  for (vertex_t u = 0; u < static_cast<vertex_t>(nbrs.size()); ++u) {
+    for (auto v : nbrs[u]) {
+      if (v <= u) { continue; }
+      for (auto w : nbrs[v]) {
+        if ((w > v) && std::binary_search(nbrs[u].begin(), nbrs[u].end(), w)) {
+          ++counts[u];
+          ++counts[v];
+          ++counts[w];
+        }
+      }
+    }
+  }
+  return counts;
+}
+
+template <typename vertex_t, typename weight_t>
+std::vector<weight_t> pagerank_reference(host_graph_t<vertex_t, weight_t> const& graph,
+                                         weight_t alpha,
+                                         weight_t epsilon,
+                                         size_t max_iterations)
+{
+  auto n = graph.nbrs.size();
+  std::vector<weight_t> pageranks(n, weight_t{1.0} / static_cast<weight_t>(n));
+  std::vector<weight_t> out_weight_sums(n);
+  for (size_t v = 0; v < n; ++v) {
+    out_weight_sums[v] =
+      std::accumulate(graph.weights[v].begin(), graph.weights[v].end(), weight_t{0.0});
+  }
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    weight_t dangling_sum{0.0};
+    for (size_t v = 0; v < n; ++v) {
+      if (out_weight_sums[v] == weight_t{0.0}) { dangling_sum += pageranks[v]; }
+    }
+    std::vector<weight_t> new_pageranks(
+      n, (weight_t{1.0} - alpha) / n + alpha * dangling_sum / static_cast<weight_t>(n));
+    for (size_t v = 0; v < n; ++v) {
+      if (out_weight_sums[v] == weight_t{0.0}) { continue; }
+      for (size_t i = 0; i < graph.nbrs[v].size(); ++i) {
+        new_pageranks[graph.nbrs[v][i]] +=
+          alpha * pageranks[v] * graph.weights[v][i] / out_weight_sums[v];
+      }
+    }
+    weight_t diff_sum{0.0};
+    for (size_t v = 0; v < n; ++v) {
+      diff_sum += std::abs(new_pageranks[v] - pageranks[v]);
+    }
+    pageranks = std::move(new_pageranks);
+    if (diff_sum < epsilon) { break; }
+  }
+  return pageranks;
+}
+
+struct GraphBatch_Usecase {
+  size_t num_graphs{0};
+  size_t min_vertices{1};
+  size_t max_vertices{1};
+  double edge_probability{0.0};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+class Tests_GraphBatch : public ::testing::TestWithParam<GraphBatch_Usecase> {
+ public:
+  Tests_GraphBatch() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(GraphBatch_Usecase const& usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    // 1. generate a batch of small random symmetric graphs on the host
+
+    std::mt19937 gen(static_cast<unsigned>(usecase.num_graphs));
+    std::uniform_int_distribution<size_t> size_dist(usecase.min_vertices, usecase.max_vertices);
+    std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
+    std::uniform_real_distribution<weight_t> weight_dist(0.1, 1.0);
+
+    std::vector<host_graph_t<vertex_t, weight_t>> h_graphs(usecase.num_graphs);
+    std::vector<vertex_t> h_graph_vertex_counts(usecase.num_graphs);
+    std::vector<vertex_t> h_sources(usecase.num_graphs);
+    std::vector<vertex_t> h_graph_ids{};
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    for (size_t g = 0; g < usecase.num_graphs; ++g) {
+      auto n                   = static_cast<vertex_t>(size_dist(gen));
+      h_graph_vertex_counts[g] = n;
+      h_sources[g]             = static_cast<vertex_t>(gen() % n);
+      h_graphs[g].nbrs.resize(n);
+      h_graphs[g].weights.resize(n);
+      for (vertex_t u = 0; u < n; ++u) {  // neighbor lists are filled in sorted order
+        for (vertex_t v = u + 1; v < n; ++v) {
+          if (prob_dist(gen) >= usecase.edge_probability) { continue; }
+          auto w = usecase.test_weighted ? weight_dist(gen) : weight_t{1.0};
+          for (auto [a, b] : {std::make_pair(u, v), std::make_pair(v, u)}) {
+            h_graphs[g].nbrs[a].push_back(b);
+            h_graphs[g].weights[a].push_back(w);
+            h_graph_ids.push_back(static_cast<vertex_t>(g));
+            h_srcs.push_back(a);
+            h_dsts.push_back(b);
+            h_weights.push_back(w);
+          }
+        }
+      }
+    }
+
+    auto d_graph_vertex_counts = cugraph::test::to_device(handle, h_graph_vertex_counts);
+    auto d_sources             = cugraph::test::to_device(handle, h_sources);
+
+    // 2. create a graph batch
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Create graph batch");
+    }
+
+    auto graph_batch = cugraph::create_graph_batch<vertex_t, edge_t, weight_t>(
+      handle,
+      raft::device_span<vertex_t const>(d_graph_vertex_counts.data(),
+                                        d_graph_vertex_counts.size()),
+      cugraph::test::to_device(handle, h_graph_ids),
+      cugraph::test::to_device(handle, h_srcs),
+      cugraph::test::to_device(handle, h_dsts),
+      usecase.test_weighted
+        ? std::make_optional(cugraph::test::to_device(handle, h_weights))
+        : std::nullopt,
+      cugraph::graph_properties_t{true, false},
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 3. run batched algorithms
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Batched algorithms (BFS, WCC, triangle count, PageRank)");
+    }
+
+    auto [d_distances, d_predecessors] = cugraph::batched_bfs(
+      handle,
+      graph_batch,
+      raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+      true,
+      std::numeric_limits<vertex_t>::max(),
+      true);
+    auto d_components = cugraph::batched_weakly_connected_components(handle, graph_batch);
+    auto d_triangle_counts = cugraph::batched_triangle_count(handle, graph_batch);
+    auto alpha             = weight_t{0.85};
+    auto epsilon           = weight_t{1e-6};
+    auto d_pageranks       = cugraph::batched_pagerank(handle, graph_batch, alpha, epsilon);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 4. compare with the reference results
+
+    if (usecase.check_correctness) {
+      ASSERT_EQ(graph_batch.number_of_graphs(), usecase.num_graphs);
+      ASSERT_EQ(static_cast<size_t>(graph_batch.number_of_edges()), h_srcs.size());
+
+      auto h_vertex_offsets  = cugraph::test::to_host(handle, graph_batch.vertex_offsets());
+      auto h_offsets         = cugraph::test::to_host(handle, graph_batch.offsets());
+      auto h_indices         = cugraph::test::to_host(handle, graph_batch.indices());
+      auto h_distances       = cugraph::test::to_host(handle, d_distances);
+      auto h_predecessors    = cugraph::test::to_host(handle, *d_predecessors);
+      auto h_components      = cugraph::test::to_host(handle, d_components);
+      auto h_triangle_counts = cugraph::test::to_host(handle, d_triangle_counts);
+      auto h_pageranks       = cugraph::test::to_host(handle, d_pageranks);
+
+      auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+        return std::abs(lhs - rhs) < std::max(std::max(lhs, rhs) * weight_t{1e-3}, weight_t{1e-5});
+      };
+
+      for (size_t g = 0; g < usecase.num_graphs; ++g) {
+        auto const& h_graph = h_graphs[g];
+        auto v_first        = h_vertex_offsets[g];
+        auto n              = static_cast<vertex_t>(h_graph.nbrs.size());
+        ASSERT_EQ(h_vertex_offsets[g + 1] - v_first, n);
+
+        for (vertex_t v = 0; v < n; ++v) {
+          std::vector<vertex_t> nbrs(h_indices.begin() + h_offsets[v_first + v],
+                                     h_indices.begin() + h_offsets[v_first + v + 1]);
+          std::transform(
+            nbrs.begin(), nbrs.end(), nbrs.begin(), [v_first](auto nbr) { return nbr - v_first; });
+          ASSERT_EQ(nbrs, h_graph.nbrs[v]) << "graph " << g << " vertex " << v;
+        }
+
+        auto reference_distances = bfs_reference(h_graph.nbrs, h_sources[g]);
+        ASSERT_TRUE(std::equal(reference_distances.begin(),
+                               reference_distances.end(),
+                               h_distances.begin() + v_first))
+          << "BFS distances do not match with the reference values (graph " << g << ").";
+        for (vertex_t v = 0; v < n; ++v) {
+          auto pred = h_predecessors[v_first + v];
+          if ((v == h_sources[g]) ||
+              (reference_distances[v] == std::numeric_limits<vertex_t>::max())) {
+            ASSERT_EQ(pred, cugraph::invalid_vertex_id<vertex_t>::value);
+          } else {
+            ASSERT_TRUE((pred >= 0) && (pred < n) &&
+                        (reference_distances[pred] + 1 == reference_distances[v]) &&
+                        std::binary_search(h_graph.nbrs[pred].begin(), h_graph.nbrs[pred].end(), v))
+              << "Invalid BFS predecessor (graph " << g << ", vertex " << v << ").";
+          }
+        }
+
+        auto reference_components = connected_components_reference(h_graph.nbrs);
+        ASSERT_TRUE(std::equal(reference_components.begin(),
+                               reference_components.end(),
+                               h_components.begin() + v_first))
+          << "Component labels do not match with the reference values (graph " << g << ").";
+
+        auto reference_triangle_counts = triangle_count_reference<vertex_t, edge_t>(h_graph.nbrs);
+        ASSERT_TRUE(std::equal(reference_triangle_counts.begin(),
+                               reference_triangle_counts.end(),
+                               h_triangle_counts.begin() + v_first))
+          << "Triangle counts do not match with the reference values (graph " << g << ").";
+
+        auto reference_pageranks = pagerank_reference(h_graph, alpha, epsilon, size_t{500});
+        ASSERT_TRUE(std::equal(reference_pageranks.begin(),
+                               reference_pageranks.end(),
+                               h_pageranks.begin() + v_first,
+                               nearly_equal))
+          << "PageRank values do not match with the reference values (graph " << g << ").";
+      }
+    }
+  }
+};
+
+TEST_P(Tests_GraphBatch, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_GraphBatch, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(simple_test,
+                         Tests_GraphBatch,
+                         ::testing::Values(GraphBatch_Usecase{1, 1, 1, 0.0, false},
+                                           GraphBatch_Usecase{100, 10, 50, 0.1, false},
+                                           GraphBatch_Usecase{100, 10, 50, 0.3, true},
+                                           GraphBatch_Usecase{20, 200, 1000, 0.01, true}));
+
+INSTANTIATE_TEST_SUITE_P(benchmark_test,
+                         Tests_GraphBatch,
+                         ::testing::Values(GraphBatch_Usecase{
+                           100000, 10, 50, 0.1, false, false}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct GraphFromExternalCSR_Usecase {
+  bool test_weighted{false};
+  bool renumber{true};  // the renumbered CSR is sorted by degree, so segment offsets are set
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphFromExternalCSR
+  : public ::testing::TestWithParam<std::tuple<GraphFromExternalCSR_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphFromExternalCSR() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // BFS if store_transposed is false, PageRank if store_transposed is true
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphFromExternalCSR_Usecase const& csr_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    // 1. create a regular (owning) graph
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, csr_usecase.test_weighted, csr_usecase.renumber);
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    // 2. copy the CSR (CSC if store_transposed) into caller-owned buffers and construct a graph
+    // referencing them
+
+    auto edge_partition = graph_view.local_edge_partition_view();
+    rmm::device_uvector<edge_t> d_offsets(edge_partition.offsets().size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_indices(edge_partition.indices().size(), handle.get_stream());
+    raft::copy(d_offsets.data(),
+               edge_partition.offsets().data(),
+               edge_partition.offsets().size(),
+               handle.get_stream());
+    raft::copy(d_indices.data(),
+               edge_partition.indices().data(),
+               edge_partition.indices().size(),
+               handle.get_stream());
+
+    std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
+    if (csr_usecase.renumber) {
+      segment_offsets = cugraph::compute_sorted_degree_segment_offsets<vertex_t, edge_t>(
+        handle, raft::device_span<edge_t const>(d_offsets.data(), d_offsets.size()), true);
+      ASSERT_TRUE(segment_offsets == graph_view.local_vertex_partition_segment_offsets())
+        << "compute_sorted_degree_segment_offsets does not match the renumbering's segment "
+           "offsets.";
+    }
+
+    cugraph::graph_t<vertex_t, edge_t, store_transposed, false> external_graph(
+      handle,
+      raft::device_span<edge_t const>(d_offsets.data(), d_offsets.size()),
+      raft::device_span<vertex_t const>(d_indices.data(), d_indices.size()),
+      cugraph::graph_meta_t<vertex_t, edge_t, false>{
+        graph_view.number_of_vertices(),
+        cugraph::graph_properties_t{graph_view.is_symmetric(), graph_view.is_multigraph()},
+        segment_offsets},
+      true);
+    auto external_graph_view = external_graph.view();
+
+    // the graph should reference (not copy) the caller's buffers
+    auto external_edge_partition = external_graph_view.local_edge_partition_view();
+    ASSERT_EQ(external_edge_partition.offsets().data(), d_offsets.data());
+    ASSERT_EQ(external_edge_partition.indices().data(), d_indices.data());
+    ASSERT_EQ(external_graph_view.number_of_vertices(), graph_view.number_of_vertices());
+    ASSERT_EQ(external_graph_view.number_of_edges(), graph_view.number_of_edges());
+
+    if (csr_usecase.check_correctness) {
+      // 3. run the same algorithm on both graphs and compare (the edge weights are stored in the
+      // same CSR order, so the original edge weights work with both graphs)
+
+      if constexpr (store_transposed) {
+        auto run_pagerank = [&handle, &edge_weight_view](auto const& view) {
+          auto [d_pageranks, metadata] =
+            cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, false>(
+              handle,
+              view,
+              edge_weight_view,
+              std::nullopt,
+              std::nullopt,
+              std::nullopt,
+              weight_t{0.85},
+              weight_t{1e-6},
+              size_t{500},
+              true);
+          return cugraph::test::to_host(handle, d_pageranks);
+        };
+
+        auto h_pageranks          = run_pagerank(graph_view);
+        auto h_external_pageranks = run_pagerank(external_graph_view);
+
+        ASSERT_EQ(h_pageranks.size(), h_external_pageranks.size());
+        for (size_t i = 0; i < h_pageranks.size(); ++i) {
+          ASSERT_TRUE(std::abs(h_pageranks[i] - h_external_pageranks[i]) <=
+                      std::max(std::abs(h_pageranks[i]) * weight_t{1e-4}, weight_t{1e-6}))
+            << "PageRank values do not match for vertex " << i << ".";
+        }
+      } else {
+        auto run_bfs = [&handle](auto const& view) {
+          rmm::device_uvector<vertex_t> d_distances(view.number_of_vertices(),
+                                                    handle.get_stream());
+          rmm::device_uvector<vertex_t> d_predecessors(view.number_of_vertices(),
+                                                       handle.get_stream());
+          rmm::device_uvector<vertex_t> d_sources(1, handle.get_stream());
+          d_sources.set_element_to_zero_async(0, handle.get_stream());
+          cugraph::bfs(handle,
+                       view,
+                       d_distances.data(),
+                       d_predecessors.data(),
+                       d_sources.data(),
+                       size_t{1},
+                       false,
+                       std::numeric_limits<vertex_t>::max(),
+                       true);
+          return cugraph::test::to_host(handle, d_distances);
+        };
+
+        auto h_distances          = run_bfs(graph_view);
+        auto h_external_distances = run_bfs(external_graph_view);
+
+        ASSERT_TRUE(h_distances == h_external_distances) << "BFS distances do not match.";
+      }
+    }
+  }
+};
+
+using Tests_GraphFromExternalCSR_File = Tests_GraphFromExternalCSR<cugraph::test::File_Usecase>;
+using Tests_GraphFromExternalCSR_Rmat = Tests_GraphFromExternalCSR<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphFromExternalCSR_File, CheckInt32Int32FloatBFS)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphFromExternalCSR_File, CheckInt32Int32FloatPageRank)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphFromExternalCSR_Rmat, CheckInt32Int32FloatBFS)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphFromExternalCSR_Rmat, CheckInt32Int32FloatPageRank)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphFromExternalCSR_Rmat, CheckInt64Int64FloatBFS)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphFromExternalCSR_Rmat, CheckInt64Int64FloatPageRank)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphFromExternalCSR_File,
+  ::testing::Combine(
+    ::testing::Values(GraphFromExternalCSR_Usecase{false, true},
+                      GraphFromExternalCSR_Usecase{true, true},
+                      GraphFromExternalCSR_Usecase{false, false},
+                      GraphFromExternalCSR_Usecase{true, false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphFromExternalCSR_Rmat,
+  ::testing::Combine(::testing::Values(GraphFromExternalCSR_Usecase{false, true},
+                                       GraphFromExternalCSR_Usecase{true, true},
+                                       GraphFromExternalCSR_Usecase{false, false},
+                                       GraphFromExternalCSR_Usecase{true, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_GraphFromExternalCSR_Rmat,
+  ::testing::Combine(
+    ::testing::Values(GraphFromExternalCSR_Usecase{false, true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_ipc.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <tuple>
+#include <vector>
+
+extern char** environ;
+
+namespace {
+
+// set (to "<handle pipe read fd>,<result pipe write fd>") only in the child processes
+constexpr char graph_ipc_test_fds_env[] = "CUGRAPH_GRAPH_IPC_TEST_FDS";
+
+void write_fully(int fd, void const* data, size_t num_bytes)
+{
+  auto ptr = static_cast<char const*>(data);
+  while (num_bytes > 0) {
+    auto ret = ::write(fd, ptr, num_bytes);
+    if (ret <= 0) { break; }
+    ptr += ret;
+    num_bytes -= static_cast<size_t>(ret);
+  }
+}
+
+bool read_fully(int fd, void* data, size_t num_bytes)
+{
+  auto ptr = static_cast<char*>(data);
+  while (num_bytes > 0) {
+    auto ret = ::read(fd, ptr, num_bytes);
+    if (ret <= 0) { return false; }
+    ptr += ret;
+    num_bytes -= static_cast<size_t>(ret);
+  }
+  return true;
+}
+
+// out-degrees and BFS distances from vertex 0
+template <typename vertex_t, typename edge_t>
+std::tuple<std::vector<edge_t>, std::vector<vertex_t>> out_degrees_and_bfs_distances(
+  raft::handle_t const& handle, cugraph::graph_view_t<vertex_t, edge_t, false, false> const& view)
+{
+  auto d_out_degrees = view.compute_out_degrees(handle);
+
+  rmm::device_uvector<vertex_t> d_distances(view.number_of_vertices(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_sources(1, handle.get_stream());
+  d_sources.set_element_to_zero_async(0, handle.get_stream());
+  cugraph::bfs(handle,
+               view,
+               d_distances.data(),
+               static_cast<vertex_t*>(nullptr),
+               d_sources.data(),
+               size_t{1});
+
+  return std::make_tuple(cugraph::test::to_host(handle, d_out_degrees),
+                         cugraph::test::to_host(handle, d_distances));
+}
+
+// runs in the child process, attaches to the graph exported by the parent process and sends back
+// the out-degrees and BFS distances computed on the attached graph
+template <typename vertex_t, typename edge_t>
+void run_attached_graph_child(int handle_fd, int result_fd)
+{
+  cugraph::graph_ipc_handle_t<vertex_t, edge_t> ipc_handle{};
+  ASSERT_TRUE(read_fully(handle_fd, &ipc_handle, sizeof(ipc_handle)))
+    << "Failed to receive the IPC handle.";
+
+  raft::handle_t handle{};
+  cugraph::attached_graph_t<vertex_t, edge_t, false> attached_graph(handle, ipc_handle, true);
+  auto attached_graph_view = attached_graph.view();
+
+  ASSERT_EQ(attached_graph_view.number_of_vertices(), ipc_handle.number_of_vertices);
+  ASSERT_EQ(attached_graph_view.number_of_edges(), ipc_handle.number_of_edges);
+
+  auto [h_out_degrees, h_distances] = out_degrees_and_bfs_distances(handle, attached_graph_view);
+
+  write_fully(result_fd, h_out_degrees.data(), h_out_degrees.size() * sizeof(edge_t));
+  write_fully(result_fd, h_distances.data(), h_distances.size() * sizeof(vertex_t));
+}
+
+template <typename vertex_t, typename edge_t>
+void run_child_test()
+{
+  auto fds = std::getenv(graph_ipc_test_fds_env);
+  if (fds == nullptr) { GTEST_SKIP() << "Runs only in the child processes of Tests_GraphIPC."; }
+  int handle_fd{-1};
+  int result_fd{-1};
+  ASSERT_EQ(std::sscanf(fds, "%d,%d", &handle_fd, &result_fd), 2);
+  run_attached_graph_child<vertex_t, edge_t>(handle_fd, result_fd);
+  ::close(handle_fd);
+  ::close(result_fd);
+}
+
+}  // namespace
+
+struct GraphIPC_Usecase {
+  bool check_correctness{true};
+};
+
+// export_graph_ipc_handle in this process, attached_graph_t in a forked (and exec'd, CUDA cannot be
+// used in a forked child of a process that has initialized CUDA) child process
+template <typename input_usecase_t>
+class Tests_GraphIPC
+  : public ::testing::TestWithParam<std::tuple<GraphIPC_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphIPC() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(GraphIPC_Usecase const& graph_ipc_usecase,
+                        input_usecase_t const& input_usecase,
+                        std::string const& child_test_name)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+
+    auto ipc_handle = cugraph::export_graph_ipc_handle(handle, graph_view);
+
+    int handle_pipe[2]{};
+    int result_pipe[2]{};
+    ASSERT_EQ(::pipe(handle_pipe), 0);
+    ASSERT_EQ(::pipe(result_pipe), 0);
+
+    // the IPC handle fits in the pipe buffer, so this does not block
+    write_fully(handle_pipe[1], &ipc_handle, sizeof(ipc_handle));
+    ::close(handle_pipe[1]);
+
+    // prepare the child's arguments and environment before fork (only async-signal-safe functions
+    // should be called in the child before exec)
+    std::string arg0{"graph_ipc_test"};
+    std::string filter_arg = "--gtest_filter=GraphIPC_Child." + child_test_name;
+    std::vector<char*> args{arg0.data(), filter_arg.data(), nullptr};
+    std::string fds_env = std::string(graph_ipc_test_fds_env) + "=" +
+                          std::to_string(handle_pipe[0]) + "," + std::to_string(result_pipe[1]);
+    std::vector<char*> envs{};
+    for (auto env = environ; *env != nullptr; ++env) {
+      envs.push_back(*env);
+    }
+    envs.push_back(fds_env.data());
+    envs.push_back(nullptr);
+
+    auto pid = ::fork();
+    ASSERT_NE(pid, -1) << "fork failed.";
+    if (pid == 0) {
+      ::close(result_pipe[0]);
+      ::execve("/proc/self/exe", args.data(), envs.data());
+      ::_exit(127);
+    }
+    ::close(handle_pipe[0]);
+    ::close(result_pipe[1]);
+
+    auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+    std::vector<edge_t> h_child_out_degrees(num_vertices);
+    std::vector<vertex_t> h_child_distances(num_vertices);
+    auto received =
+      read_fully(result_pipe[0], h_child_out_degrees.data(), num_vertices * sizeof(edge_t)) &&
+      read_fully(result_pipe[0], h_child_distances.data(), num_vertices * sizeof(vertex_t));
+    ::close(result_pipe[0]);
+
+    // graph should stay alive until the child process detaches
+    int status{};
+    ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status) && (WEXITSTATUS(status) == 0))
+      << "The child process attaching to the graph failed.";
+    ASSERT_TRUE(received) << "Failed to receive the results from the child process.";
+
+    if (graph_ipc_usecase.check_correctness) {
+      auto [h_out_degrees, h_distances] = out_degrees_and_bfs_distances(handle, graph_view);
+
+      ASSERT_TRUE(h_child_out_degrees == h_out_degrees)
+        << "Out-degrees of the attached graph do not match.";
+      ASSERT_TRUE(h_child_distances == h_distances)
+        << "BFS distances on the attached graph do not match.";
+    }
+  }
+};
+
+using Tests_GraphIPC_File = Tests_GraphIPC<cugraph::test::File_Usecase>;
+using Tests_GraphIPC_Rmat = Tests_GraphIPC<cugraph::test::Rmat_Usecase>;
+
+TEST(GraphIPC_Child, Int32Int32) { run_child_test<int32_t, int32_t>(); }
+
+TEST(GraphIPC_Child, Int64Int64) { run_child_test<int64_t, int64_t>(); }
+
+TEST_P(Tests_GraphIPC_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param), "Int32Int32");
+}
+
+TEST_P(Tests_GraphIPC_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param),
+    override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)),
+    "Int32Int32");
+}
+
+TEST_P(Tests_GraphIPC_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param),
+    override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)),
+    "Int64Int64");
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphIPC_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphIPC_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphIPC_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphIPC_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
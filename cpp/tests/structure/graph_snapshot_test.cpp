@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct GraphSnapshot_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphSnapshot
+  : public ::testing::TestWithParam<std::tuple<GraphSnapshot_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphSnapshot() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphSnapshot_Usecase const& graph_snapshot_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, graph_snapshot_usecase.test_weighted, renumber);
+
+    auto graph_view = graph.view();
+    auto edge_weight_view =
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt;
+
+    auto filename =
+      (std::filesystem::temp_directory_path() / "cugraph_graph_snapshot_test.bin").string();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Write graph snapshot");
+    }
+
+    cugraph::write_graph_snapshot<vertex_t, edge_t, weight_t, int32_t, store_transposed, false>(
+      handle,
+      graph_view,
+      edge_weight_view,
+      std::nullopt,
+      std::nullopt,
+      d_renumber_map_labels ? std::make_optional<raft::device_span<vertex_t const>>(
+                                (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                            : std::nullopt,
+      filename);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+      hr_timer.start("Read graph snapshot");
+    }
+
+    auto [snapshot_graph,
+          snapshot_edge_weights,
+          snapshot_edge_ids,
+          snapshot_edge_types,
+          snapshot_renumber_map] =
+      cugraph::read_graph_snapshot<vertex_t, edge_t, weight_t, int32_t, store_transposed, false>(
+        handle, filename, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    std::remove(filename.c_str());
+
+    auto snapshot_graph_view = snapshot_graph.view();
+
+    ASSERT_EQ(snapshot_graph_view.number_of_vertices(), graph_view.number_of_vertices());
+    ASSERT_EQ(snapshot_graph_view.number_of_edges(), graph_view.number_of_edges());
+    ASSERT_EQ(snapshot_graph_view.is_symmetric(), graph_view.is_symmetric());
+    ASSERT_EQ(snapshot_graph_view.is_multigraph(), graph_view.is_multigraph());
+    ASSERT_EQ(snapshot_edge_weights.has_value(), edge_weights.has_value());
+    ASSERT_FALSE(snapshot_edge_ids.has_value());
+    ASSERT_FALSE(snapshot_edge_types.has_value());
+    ASSERT_EQ(snapshot_renumber_map.has_value(), d_renumber_map_labels.has_value());
+    ASSERT_TRUE(snapshot_graph_view.local_vertex_partition_segment_offsets() ==
+                graph_view.local_vertex_partition_segment_offsets());
+
+    if (graph_snapshot_usecase.check_correctness) {
+      auto [h_offsets, h_indices, h_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, store_transposed, false>(
+          handle, graph_view, edge_weight_view, std::nullopt);
+      auto [h_snapshot_offsets, h_snapshot_indices, h_snapshot_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, store_transposed, false>(
+          handle,
+          snapshot_graph_view,
+          snapshot_edge_weights ? std::make_optional((*snapshot_edge_weights).view())
+                                : std::nullopt,
+          std::nullopt);
+
+      ASSERT_TRUE(h_snapshot_offsets == h_offsets) << "Offsets do not match.";
+      ASSERT_TRUE(h_snapshot_indices == h_indices) << "Indices do not match.";
+      ASSERT_TRUE(h_snapshot_weights == h_weights) << "Edge weights do not match.";
+
+      if (d_renumber_map_labels) {
+        auto h_renumber_map          = cugraph::test::to_host(handle, *d_renumber_map_labels);
+        auto h_snapshot_renumber_map = cugraph::test::to_host(handle, *snapshot_renumber_map);
+        ASSERT_TRUE(h_snapshot_renumber_map == h_renumber_map) << "Renumber maps do not match.";
+      }
+    }
+  }
+};
+
+using Tests_GraphSnapshot_File = Tests_GraphSnapshot<cugraph::test::File_Usecase>;
+using Tests_GraphSnapshot_Rmat = Tests_GraphSnapshot<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphSnapshot_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphSnapshot_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphSnapshot_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphSnapshot_Rmat, CheckInt64Int64DoubleTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphSnapshot_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphSnapshot_Usecase{false}, GraphSnapshot_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphSnapshot_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(GraphSnapshot_Usecase{false}, GraphSnapshot_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_GraphSnapshot_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(GraphSnapshot_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+struct GraphTopologyFromEdgelist_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_GraphTopologyFromEdgelist
+  : public ::testing::TestWithParam<
+      std::tuple<GraphTopologyFromEdgelist_Usecase, input_usecase_t>> {
+ public:
+  Tests_GraphTopologyFromEdgelist() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphTopologyFromEdgelist_Usecase const& topology_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [edge_src_chunks, edge_dst_chunks, edge_weight_chunks, d_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        handle, true, store_transposed, false);
+
+    auto [d_srcs, d_dsts, d_weights, d_edge_ids, d_edge_types, d_start_times, d_end_times] =
+      cugraph::test::detail::concatenate_edge_chunks<vertex_t, edge_t, weight_t, int32_t, int32_t>(
+        handle,
+        std::move(edge_src_chunks),
+        std::move(edge_dst_chunks),
+        std::move(edge_weight_chunks),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt);
+
+    std::vector<vertex_t> h_input_srcs{};
+    std::vector<vertex_t> h_input_dsts{};
+    if (topology_usecase.check_correctness) {
+      h_input_srcs = cugraph::test::to_host(handle, d_srcs);
+      h_input_dsts = cugraph::test::to_host(handle, d_dsts);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Create graph topology from edgelist");
+    }
+
+    auto [graph, edge_permutation, d_renumber_map] =
+      cugraph::create_graph_topology_from_edgelist<vertex_t, edge_t, store_transposed, false>(
+        handle,
+        std::move(d_vertices),
+        std::move(d_srcs),
+        std::move(d_dsts),
+        cugraph::graph_properties_t{is_symmetric, false},
+        renumber);
+
+    auto graph_view = graph.view();
+
+    auto edge_weights = cugraph::attach_edgelist_property(
+      handle,
+      graph_view,
+      edge_permutation.view(),
+      raft::device_span<weight_t const>((*d_weights).data(), (*d_weights).size()),
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(static_cast<size_t>(graph_view.compute_number_of_edges(handle)),
+              (*d_weights).size());
+
+    if (topology_usecase.check_correctness) {
+      auto h_input_weights = cugraph::test::to_host(handle, *d_weights);
+
+      auto [d_output_srcs, d_output_dsts, d_output_weights, d_output_ids, d_output_types] =
+        cugraph::decompress_to_edgelist<vertex_t,
+                                        edge_t,
+                                        weight_t,
+                                        int32_t,
+                                        store_transposed,
+                                        false>(
+          handle,
+          graph_view,
+          std::make_optional(edge_weights.view()),
+          std::nullopt,
+          std::nullopt,
+          std::make_optional<raft::device_span<vertex_t const>>((*d_renumber_map).data(),
+                                                                (*d_renumber_map).size()));
+
+      auto h_output_srcs    = cugraph::test::to_host(handle, d_output_srcs);
+      auto h_output_dsts    = cugraph::test::to_host(handle, d_output_dsts);
+      auto h_output_weights = cugraph::test::to_host(handle, *d_output_weights);
+
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> input_triplets(h_input_srcs.size());
+      for (size_t i = 0; i < input_triplets.size(); ++i) {
+        input_triplets[i] = std::make_tuple(h_input_srcs[i], h_input_dsts[i], h_input_weights[i]);
+      }
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> output_triplets(h_output_srcs.size());
+      for (size_t i = 0; i < output_triplets.size(); ++i) {
+        output_triplets[i] =
+          std::make_tuple(h_output_srcs[i], h_output_dsts[i], h_output_weights[i]);
+      }
+      std::sort(input_triplets.begin(), input_triplets.end());
+      std::sort(output_triplets.begin(), output_triplets.end());
+
+      ASSERT_TRUE(input_triplets == output_triplets)
+        << "Edge property values attached with the edge permutation do not match with the input.";
+    }
+  }
+};
+
+using Tests_GraphTopologyFromEdgelist_File =
+  Tests_GraphTopologyFromEdgelist<cugraph::test::File_Usecase>;
+using Tests_GraphTopologyFromEdgelist_Rmat =
+  Tests_GraphTopologyFromEdgelist<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_GraphTopologyFromEdgelist_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphTopologyFromEdgelist_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_GraphTopologyFromEdgelist_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_GraphTopologyFromEdgelist_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_GraphTopologyFromEdgelist_File,
+  ::testing::Combine(::testing::Values(GraphTopologyFromEdgelist_Usecase{true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_GraphTopologyFromEdgelist_Rmat,
+  ::testing::Combine(
+    ::testing::Values(GraphTopologyFromEdgelist_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_GraphTopologyFromEdgelist_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(GraphTopologyFromEdgelist_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -122,6 +122,37 @@ class Tests_HasEdgeAndComputeMultiplicity
       hr_timer.display_and_clear(std::cout);
     }
 
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Building edge existence filter");
+    }
+
+    auto edge_existence_filter = cugraph::build_edge_existence_filter(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Querying edge existence (with filter)");
+    }
+
+    auto filtered_edge_exists =
+      cugraph::has_edges(handle,
+                         graph_view,
+                         edge_existence_filter,
+                         raft::device_span<vertex_t const>(edge_srcs.data(), edge_srcs.size()),
+                         raft::device_span<vertex_t const>(edge_dsts.data(), edge_dsts.size()));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
       hr_timer.start("Computing multiplicity");
@@ -175,8 +206,9 @@ class Tests_HasEdgeAndComputeMultiplicity
       auto h_unrenumbered_edge_srcs = cugraph::test::to_host(handle, d_unrenumbered_edge_srcs);
       auto h_unrenumbered_edge_dsts = cugraph::test::to_host(handle, d_unrenumbered_edge_dsts);
 
-      auto h_cugraph_edge_exists         = cugraph::test::to_host(handle, edge_exists);
-      auto h_cugraph_edge_multiplicities = cugraph::test::to_host(handle, edge_multiplicities);
+      auto h_cugraph_edge_exists          = cugraph::test::to_host(handle, edge_exists);
+      auto h_cugraph_filtered_edge_exists = cugraph::test::to_host(handle, filtered_edge_exists);
+      auto h_cugraph_edge_multiplicities  = cugraph::test::to_host(handle, edge_multiplicities);
       std::vector<bool> h_reference_edge_exists(edge_srcs.size());
       std::vector<edge_t> h_reference_edge_multiplicities(edge_srcs.size());
       for (size_t i = 0; i < edge_srcs.size(); ++i) {
@@ -197,6 +229,10 @@ class Tests_HasEdgeAndComputeMultiplicity
                              h_reference_edge_exists.end(),
                              h_cugraph_edge_exists.begin()))
         << "has_edge() return values do not match with the reference values.";
+      ASSERT_TRUE(std::equal(h_reference_edge_exists.begin(),
+                             h_reference_edge_exists.end(),
+                             h_cugraph_filtered_edge_exists.begin()))
+        << "has_edges() return values do not match with the reference values.";
       ASSERT_TRUE(std::equal(h_reference_edge_multiplicities.begin(),
                              h_reference_edge_multiplicities.end(),
                              h_cugraph_edge_multiplicities.begin()))
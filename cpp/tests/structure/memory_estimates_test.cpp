@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/memory_estimates.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+struct MemoryEstimates_Usecase {
+  bool test_weighted{false};
+  bool renumber{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MemoryEstimates
+  : public ::testing::TestWithParam<std::tuple<MemoryEstimates_Usecase, input_usecase_t>> {
+ public:
+  Tests_MemoryEstimates() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, bool store_transposed>
+  void run_current_test(MemoryEstimates_Usecase const& memory_estimates_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t    = float;
+    using edge_type_t = int32_t;
+    using edge_time_t = int32_t;
+
+    // allowance for the CUB/Thrust temporary storage (not modeled by the estimates)
+    constexpr size_t temporary_storage_allowance = size_t{16} << 20;
+
+    raft::handle_t handle{};
+
+    auto [edge_src_chunks, edge_dst_chunks, edge_weight_chunks, d_vertices_v, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        handle, memory_estimates_usecase.test_weighted, store_transposed, false);
+
+    size_t number_of_edges{0};
+    vertex_t max_vertex_id{0};
+    for (size_t i = 0; i < edge_src_chunks.size(); ++i) {
+      number_of_edges += edge_src_chunks[i].size();
+      auto h_srcs = cugraph::test::to_host(handle, edge_src_chunks[i]);
+      auto h_dsts = cugraph::test::to_host(handle, edge_dst_chunks[i]);
+      for (size_t j = 0; j < h_srcs.size(); ++j) {
+        max_vertex_id = std::max({max_vertex_id, h_srcs[j], h_dsts[j]});
+      }
+    }
+    size_t number_of_vertices =
+      d_vertices_v ? (*d_vertices_v).size() : static_cast<size_t>(max_vertex_id) + 1;
+
+    auto estimate = cugraph::estimate_create_graph_from_edgelist_memory<vertex_t, edge_t>(
+      number_of_vertices,
+      number_of_edges,
+      memory_estimates_usecase.test_weighted ? sizeof(weight_t) : size_t{0},
+      memory_estimates_usecase.renumber);
+
+    // the input edge list is allocated before installing the statistics adaptor (so deallocating
+    // the input edge list is not visible to the adaptor), the measured peak excludes the input
+
+    auto input_bytes =
+      number_of_edges * (sizeof(vertex_t) * 2 +
+                         (memory_estimates_usecase.test_weighted ? sizeof(weight_t) : size_t{0}));
+
+    auto upstream = rmm::mr::get_current_device_resource();
+    rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics(upstream);
+    rmm::mr::set_current_device_resource(&statistics);
+
+    {
+      auto graph_and_properties =
+        cugraph::create_graph_from_edgelist<vertex_t,
+                                            edge_t,
+                                            weight_t,
+                                            edge_type_t,
+                                            edge_time_t,
+                                            store_transposed,
+                                            false>(
+          handle,
+          std::move(d_vertices_v),
+          std::move(edge_src_chunks),
+          std::move(edge_dst_chunks),
+          std::move(edge_weight_chunks),
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          std::nullopt,
+          cugraph::graph_properties_t{is_symmetric, true},
+          memory_estimates_usecase.renumber);
+      handle.sync_stream();
+    }
+
+    rmm::mr::set_current_device_resource(upstream);
+
+    auto measured_peak = static_cast<size_t>(statistics.get_bytes_counter().peak) + input_bytes;
+
+    if (cugraph::test::g_perf) {
+      std::cout << "create_graph_from_edgelist estimated peak: " << estimate.peak_bytes
+                << " bytes, measured peak: " << measured_peak << " bytes" << std::endl;
+    }
+
+    ASSERT_LE(measured_peak, estimate.peak_bytes + temporary_storage_allowance)
+      << "create_graph_from_edgelist peak device memory usage exceeds the estimate.";
+    ASSERT_GE(estimate.peak_bytes, estimate.persistent_bytes);
+  }
+};
+
+using Tests_MemoryEstimates_File = Tests_MemoryEstimates<cugraph::test::File_Usecase>;
+using Tests_MemoryEstimates_Rmat = Tests_MemoryEstimates<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MemoryEstimates_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MemoryEstimates_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MemoryEstimates_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MemoryEstimates_Rmat, CheckInt32Int32Transposed)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, true>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MemoryEstimates_File,
+  ::testing::Combine(::testing::Values(MemoryEstimates_Usecase{false, true},
+                                       MemoryEstimates_Usecase{true, true},
+                                       MemoryEstimates_Usecase{true, false}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MemoryEstimates_Rmat,
+  ::testing::Combine(::testing::Values(MemoryEstimates_Usecase{false, true},
+                                       MemoryEstimates_Usecase{true, true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MemoryEstimates_Rmat,
+  ::testing::Combine(::testing::Values(MemoryEstimates_Usecase{true, true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
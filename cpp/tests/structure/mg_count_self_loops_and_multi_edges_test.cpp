@@ -36,6 +36,7 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
 #include <random>
 
 struct CountSelfLoopsAndMultiEdges_Usecase {
@@ -122,10 +123,27 @@ class Tests_MGCountSelfLoopsAndMultiEdges
       hr_timer.display_and_clear(std::cout);
     }
 
-    // 3. copmare SG & MG results
+    // 3. check the partition load balance statistics
+
+    auto imbalance = cugraph::compute_partition_imbalance(*handle_, mg_graph_view);
+    ASSERT_EQ(imbalance.vertex_counts.size(),
+              static_cast<size_t>(handle_->get_comms().get_size()));
+    ASSERT_EQ(imbalance.edge_counts.size(), static_cast<size_t>(handle_->get_comms().get_size()));
+    ASSERT_EQ(std::reduce(imbalance.vertex_counts.begin(), imbalance.vertex_counts.end()),
+              mg_graph_view.number_of_vertices());
+    ASSERT_EQ(std::reduce(imbalance.edge_counts.begin(), imbalance.edge_counts.end()),
+              mg_graph_view.compute_number_of_edges(*handle_));
+    ASSERT_GE(imbalance.vertex_imbalance, 1.0 - 1e-6);
+    ASSERT_GE(imbalance.edge_imbalance, 1.0 - 1e-6);
+    if (cugraph::test::g_perf && (handle_->get_comms().get_rank() == 0)) {
+      std::cout << "vertex imbalance: " << imbalance.vertex_imbalance
+                << ", edge imbalance: " << imbalance.edge_imbalance << std::endl;
+    }
+
+    // 4. copmare SG & MG results
 
     if (count_self_loops_and_multi_edges_usecase.check_correctness) {
-      // 3-1. aggregate MG results
+      // 4-1. aggregate MG results
 
       cugraph::graph_t<vertex_t, edge_t, store_transposed, false> sg_graph(*handle_);
       std::tie(sg_graph, std::ignore, std::ignore, std::ignore, std::ignore) =
@@ -144,12 +162,12 @@ class Tests_MGCountSelfLoopsAndMultiEdges
 
         ASSERT_EQ(mg_graph_view.number_of_vertices(), sg_graph_view.number_of_vertices());
 
-        // 3-2. run SG count_self_loops & count_multi_edges
+        // 4-2. run SG count_self_loops & count_multi_edges
 
         auto sg_num_self_loops  = sg_graph_view.count_self_loops(*handle_);
         auto sg_num_multi_edges = sg_graph_view.count_multi_edges(*handle_);
 
-        // 3-3. compare
+        // 4-3. compare
 
         ASSERT_EQ(num_self_loops, sg_num_self_loops);
         ASSERT_EQ(num_multi_edges, sg_num_multi_edges);
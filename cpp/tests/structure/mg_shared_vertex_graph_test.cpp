@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+#include "utilities/thrust_wrapper.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+struct SharedVertexGraph_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGSharedVertexGraph
+  : public ::testing::TestWithParam<std::tuple<SharedVertexGraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGSharedVertexGraph() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SharedVertexGraph_Usecase const& shared_vertex_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResTimer hr_timer{};
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+
+    // 1. create the base MG graph
+
+    auto [mg_graph, mg_edge_weights, mg_renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, shared_vertex_usecase.test_weighted, true);
+    auto mg_graph_view = mg_graph.view();
+    auto mg_edge_weight_view =
+      mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
+
+    // 2. create a layer edge list (every other edge of the base graph, in external vertex IDs)
+
+    rmm::device_uvector<vertex_t> d_mg_srcs(0, handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_dsts(0, handle_->get_stream());
+    std::optional<rmm::device_uvector<weight_t>> d_mg_weights{std::nullopt};
+    std::tie(d_mg_srcs, d_mg_dsts, d_mg_weights, std::ignore, std::ignore) =
+      cugraph::decompress_to_edgelist(
+        *handle_,
+        mg_graph_view,
+        mg_edge_weight_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::make_optional<raft::device_span<vertex_t const>>((*mg_renumber_map).data(),
+                                                              (*mg_renumber_map).size()));
+
+    auto h_mg_srcs    = cugraph::test::to_host(*handle_, d_mg_srcs);
+    auto h_mg_dsts    = cugraph::test::to_host(*handle_, d_mg_dsts);
+    auto h_mg_weights = cugraph::test::to_host(*handle_, d_mg_weights);
+
+    std::vector<vertex_t> h_layer_srcs{};
+    std::vector<vertex_t> h_layer_dsts{};
+    std::optional<std::vector<weight_t>> h_layer_weights{
+      h_mg_weights ? std::make_optional(std::vector<weight_t>{}) : std::nullopt};
+    for (size_t i = 0; i < h_mg_srcs.size(); i += 2) {
+      h_layer_srcs.push_back(h_mg_srcs[i]);
+      h_layer_dsts.push_back(h_mg_dsts[i]);
+      if (h_layer_weights) { (*h_layer_weights).push_back((*h_mg_weights)[i]); }
+    }
+
+    auto d_layer_input_srcs    = cugraph::test::to_device(*handle_, h_layer_srcs);
+    auto d_layer_input_dsts    = cugraph::test::to_device(*handle_, h_layer_dsts);
+    auto d_layer_input_weights = cugraph::test::to_device(*handle_, h_layer_weights);
+
+    auto d_mg_aggregate_layer_srcs =
+      cugraph::test::device_gatherv(*handle_, d_layer_input_srcs.data(), d_layer_input_srcs.size());
+    auto d_mg_aggregate_layer_dsts =
+      cugraph::test::device_gatherv(*handle_, d_layer_input_dsts.data(), d_layer_input_dsts.size());
+    std::optional<rmm::device_uvector<weight_t>> d_mg_aggregate_layer_weights{std::nullopt};
+    if (d_layer_input_weights) {
+      d_mg_aggregate_layer_weights = cugraph::test::device_gatherv(
+        *handle_, (*d_layer_input_weights).data(), (*d_layer_input_weights).size());
+    }
+
+    // 3. create the layer graph sharing the vertex set of the base graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG create graph with shared vertices");
+    }
+
+    auto [layer_graph, layer_edge_weights, layer_edge_ids, layer_edge_types] =
+      cugraph::create_graph_from_edgelist_with_shared_vertices<vertex_t,
+                                                               edge_t,
+                                                               weight_t,
+                                                               int32_t,
+                                                               false,
+                                                               true>(
+        *handle_,
+        mg_graph_view,
+        raft::device_span<vertex_t const>((*mg_renumber_map).data(), (*mg_renumber_map).size()),
+        std::move(d_layer_input_srcs),
+        std::move(d_layer_input_dsts),
+        std::move(d_layer_input_weights),
+        std::optional<rmm::device_uvector<edge_t>>{std::nullopt},
+        std::optional<rmm::device_uvector<int32_t>>{std::nullopt},
+        cugraph::graph_properties_t{false, true},
+        true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 4. validate
+
+    if (shared_vertex_usecase.check_correctness) {
+      auto layer_graph_view = layer_graph.view();
+
+      // 4-1. the vertex partitioning should be identical to the base graph's
+
+      ASSERT_EQ(layer_graph_view.number_of_vertices(), mg_graph_view.number_of_vertices());
+      ASSERT_TRUE(layer_graph_view.vertex_partition_range_offsets() ==
+                  mg_graph_view.vertex_partition_range_offsets());
+
+      // 4-2. the layer edges (in external vertex IDs, unrenumbered with the base renumber map)
+      // should be preserved
+
+      rmm::device_uvector<vertex_t> d_layer_srcs(0, handle_->get_stream());
+      rmm::device_uvector<vertex_t> d_layer_dsts(0, handle_->get_stream());
+      std::optional<rmm::device_uvector<weight_t>> d_layer_weights{std::nullopt};
+      std::tie(d_layer_srcs, d_layer_dsts, d_layer_weights, std::ignore, std::ignore) =
+        cugraph::decompress_to_edgelist(
+          *handle_,
+          layer_graph_view,
+          layer_edge_weights ? std::make_optional((*layer_edge_weights).view()) : std::nullopt,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::make_optional<raft::device_span<vertex_t const>>((*mg_renumber_map).data(),
+                                                                (*mg_renumber_map).size()));
+
+      auto d_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_layer_srcs.data(), d_layer_srcs.size());
+      auto d_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_layer_dsts.data(), d_layer_dsts.size());
+      std::optional<rmm::device_uvector<weight_t>> d_aggregate_weights{std::nullopt};
+      if (d_layer_weights) {
+        d_aggregate_weights = cugraph::test::device_gatherv(
+          *handle_, (*d_layer_weights).data(), (*d_layer_weights).size());
+      }
+
+      if (comm_rank == int{0}) {
+        auto h_srcs       = cugraph::test::to_host(*handle_, d_mg_aggregate_layer_srcs);
+        auto h_dsts       = cugraph::test::to_host(*handle_, d_mg_aggregate_layer_dsts);
+        auto h_weights    = cugraph::test::to_host(*handle_, d_mg_aggregate_layer_weights);
+        auto h_ct_srcs    = cugraph::test::to_host(*handle_, d_aggregate_srcs);
+        auto h_ct_dsts    = cugraph::test::to_host(*handle_, d_aggregate_dsts);
+        auto h_ct_weights = cugraph::test::to_host(*handle_, d_aggregate_weights);
+
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_srcs.size());
+        for (size_t i = 0; i < edges.size(); ++i) {
+          edges[i] =
+            std::make_tuple(h_srcs[i], h_dsts[i], h_weights ? (*h_weights)[i] : weight_t{1.0});
+        }
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> layer_edges(h_ct_srcs.size());
+        for (size_t i = 0; i < layer_edges.size(); ++i) {
+          layer_edges[i] = std::make_tuple(
+            h_ct_srcs[i], h_ct_dsts[i], h_ct_weights ? (*h_ct_weights)[i] : weight_t{1.0});
+        }
+        std::sort(edges.begin(), edges.end());
+        std::sort(layer_edges.begin(), layer_edges.end());
+        ASSERT_TRUE(
+          std::equal(edges.begin(), edges.end(), layer_edges.begin(), layer_edges.end()));
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGSharedVertexGraph<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGSharedVertexGraph_File = Tests_MGSharedVertexGraph<cugraph::test::File_Usecase>;
+using Tests_MGSharedVertexGraph_Rmat = Tests_MGSharedVertexGraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGSharedVertexGraph_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGSharedVertexGraph_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGSharedVertexGraph_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGSharedVertexGraph_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SharedVertexGraph_Usecase{false}, SharedVertexGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGSharedVertexGraph_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(SharedVertexGraph_Usecase{false}, SharedVertexGraph_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGSharedVertexGraph_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(SharedVertexGraph_Usecase{false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail/graph_partition_utils.cuh"
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct ShuffleExternalEdgesInChunks_Usecase {
+  bool test_weighted{false};
+  size_t memory_budget{size_t{1} << 30};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGShuffleExternalEdgesInChunks
+  : public ::testing::TestWithParam<
+      std::tuple<ShuffleExternalEdgesInChunks_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGShuffleExternalEdgesInChunks() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(ShuffleExternalEdgesInChunks_Usecase const& shuffle_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using edge_type_t = int32_t;
+    using edge_time_t = int32_t;
+
+    auto& comm                 = handle_->get_comms();
+    auto const comm_size       = comm.get_size();
+    auto const comm_rank       = comm.get_rank();
+    auto const major_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::major_comm_name()).get_size();
+    auto const minor_comm_size =
+      handle_->get_subcomm(cugraph::partition_manager::minor_comm_name()).get_size();
+
+    // 1. create this GPU's (unshuffled) part of the input edge list, edge IDs are globally unique
+    // to identify the edges after shuffling
+
+    auto [src_chunks, dst_chunks, weight_chunks, d_vertices, is_symmetric] =
+      input_usecase.template construct_edgelist<vertex_t, weight_t>(
+        *handle_, shuffle_usecase.test_weighted, false, true, false);
+
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    auto h_weights = weight_chunks ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+    for (size_t i = 0; i < src_chunks.size(); ++i) {
+      auto h_src_chunk = cugraph::test::to_host(*handle_, src_chunks[i]);
+      auto h_dst_chunk = cugraph::test::to_host(*handle_, dst_chunks[i]);
+      h_srcs.insert(h_srcs.end(), h_src_chunk.begin(), h_src_chunk.end());
+      h_dsts.insert(h_dsts.end(), h_dst_chunk.begin(), h_dst_chunk.end());
+      if (h_weights) {
+        auto h_weight_chunk = cugraph::test::to_host(*handle_, (*weight_chunks)[i]);
+        (*h_weights).insert((*h_weights).end(), h_weight_chunk.begin(), h_weight_chunk.end());
+      }
+    }
+
+    auto edge_counts = cugraph::host_scalar_allgather(
+      comm, static_cast<edge_t>(h_srcs.size()), handle_->get_stream());
+    std::vector<edge_t> h_edge_ids(h_srcs.size());
+    std::iota(h_edge_ids.begin(),
+              h_edge_ids.end(),
+              std::reduce(edge_counts.begin(), edge_counts.begin() + comm_rank, edge_t{0}));
+
+    // 2. shuffle in chunks
+
+    auto [shuffled_src_chunks,
+          shuffled_dst_chunks,
+          shuffled_weight_chunks,
+          shuffled_edge_id_chunks,
+          shuffled_edge_type_chunks,
+          shuffled_start_time_chunks,
+          shuffled_end_time_chunks] =
+      cugraph::shuffle_external_edges_in_chunks<vertex_t,
+                                                edge_t,
+                                                weight_t,
+                                                edge_type_t,
+                                                edge_time_t>(
+        *handle_,
+        cugraph::test::to_device(*handle_, h_srcs),
+        cugraph::test::to_device(*handle_, h_dsts),
+        h_weights ? std::make_optional(cugraph::test::to_device(*handle_, *h_weights))
+                  : std::nullopt,
+        std::make_optional(cugraph::test::to_device(*handle_, h_edge_ids)),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        shuffle_usecase.memory_budget);
+
+    ASSERT_EQ(shuffled_weight_chunks.has_value(), h_weights.has_value());
+    ASSERT_TRUE(shuffled_edge_id_chunks.has_value());
+    ASSERT_FALSE(shuffled_edge_type_chunks.has_value() || shuffled_start_time_chunks.has_value() ||
+                 shuffled_end_time_chunks.has_value());
+
+    // every GPU should return the same number of chunks (padded with empty chunks)
+
+    auto num_chunks = shuffled_src_chunks.size();
+    auto min_num_chunks = cugraph::host_scalar_allreduce(
+      comm, num_chunks, raft::comms::op_t::MIN, handle_->get_stream());
+    auto max_num_chunks = cugraph::host_scalar_allreduce(
+      comm, num_chunks, raft::comms::op_t::MAX, handle_->get_stream());
+    ASSERT_EQ(min_num_chunks, max_num_chunks) << "The number of chunks differs between GPUs.";
+
+    if (shuffle_usecase.check_correctness) {
+      // 3. shuffle the same edge list at once
+
+      auto [ref_srcs,
+            ref_dsts,
+            ref_weights,
+            ref_edge_ids,
+            ref_edge_types,
+            ref_start_times,
+            ref_end_times,
+            ref_rx_counts] =
+        cugraph::shuffle_external_edges<vertex_t, edge_t, weight_t, edge_type_t, edge_time_t>(
+          *handle_,
+          cugraph::test::to_device(*handle_, h_srcs),
+          cugraph::test::to_device(*handle_, h_dsts),
+          h_weights ? std::make_optional(cugraph::test::to_device(*handle_, *h_weights))
+                    : std::nullopt,
+          std::make_optional(cugraph::test::to_device(*handle_, h_edge_ids)),
+          std::nullopt,
+          std::nullopt,
+          std::nullopt);
+
+      // 4. every received edge should be owned by this GPU
+
+      std::vector<vertex_t> h_shuffled_srcs{};
+      std::vector<vertex_t> h_shuffled_dsts{};
+      std::vector<edge_t> h_shuffled_edge_ids{};
+      auto h_shuffled_weights =
+        shuffled_weight_chunks ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+      for (size_t i = 0; i < num_chunks; ++i) {
+        auto h_src_chunk     = cugraph::test::to_host(*handle_, shuffled_src_chunks[i]);
+        auto h_dst_chunk     = cugraph::test::to_host(*handle_, shuffled_dst_chunks[i]);
+        auto h_edge_id_chunk = cugraph::test::to_host(*handle_, (*shuffled_edge_id_chunks)[i]);
+        ASSERT_EQ(h_src_chunk.size(), h_dst_chunk.size());
+        ASSERT_EQ(h_src_chunk.size(), h_edge_id_chunk.size());
+        h_shuffled_srcs.insert(h_shuffled_srcs.end(), h_src_chunk.begin(), h_src_chunk.end());
+        h_shuffled_dsts.insert(h_shuffled_dsts.end(), h_dst_chunk.begin(), h_dst_chunk.end());
+        h_shuffled_edge_ids.insert(
+          h_shuffled_edge_ids.end(), h_edge_id_chunk.begin(), h_edge_id_chunk.end());
+        if (h_shuffled_weights) {
+          auto h_weight_chunk = cugraph::test::to_host(*handle_, (*shuffled_weight_chunks)[i]);
+          ASSERT_EQ(h_src_chunk.size(), h_weight_chunk.size());
+          (*h_shuffled_weights)
+            .insert((*h_shuffled_weights).end(), h_weight_chunk.begin(), h_weight_chunk.end());
+        }
+      }
+
+      auto gpu_id_func = cugraph::detail::compute_gpu_id_from_ext_edge_endpoints_t<vertex_t>{
+        comm_size, major_comm_size, minor_comm_size};
+      for (size_t i = 0; i < h_shuffled_srcs.size(); ++i) {
+        ASSERT_EQ(gpu_id_func(h_shuffled_srcs[i], h_shuffled_dsts[i]), comm_rank)
+          << "Edge (" << h_shuffled_srcs[i] << "," << h_shuffled_dsts[i]
+          << ") is shuffled to a GPU that does not own the edge.";
+      }
+
+      // 5. this GPU should receive the same edges (with the same edge properties) as
+      // shuffle_external_edges
+
+      auto h_ref_srcs     = cugraph::test::to_host(*handle_, ref_srcs);
+      auto h_ref_dsts     = cugraph::test::to_host(*handle_, ref_dsts);
+      auto h_ref_edge_ids = cugraph::test::to_host(*handle_, *ref_edge_ids);
+      auto h_ref_weights  = cugraph::test::to_host(*handle_, ref_weights);
+
+      auto to_sorted_edges =
+        [](auto const& srcs, auto const& dsts, auto const& edge_ids, auto const& weights) {
+          std::vector<std::tuple<edge_t, vertex_t, vertex_t, weight_t>> edges(srcs.size());
+          for (size_t i = 0; i < edges.size(); ++i) {
+            edges[i] = std::make_tuple(
+              edge_ids[i], srcs[i], dsts[i], weights ? (*weights)[i] : weight_t{1.0});
+          }
+          std::sort(edges.begin(), edges.end());
+          return edges;
+        };
+
+      ASSERT_TRUE(to_sorted_edges(
+                    h_shuffled_srcs, h_shuffled_dsts, h_shuffled_edge_ids, h_shuffled_weights) ==
+                  to_sorted_edges(h_ref_srcs, h_ref_dsts, h_ref_edge_ids, h_ref_weights))
+        << "shuffle_external_edges_in_chunks and shuffle_external_edges return different edges.";
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGShuffleExternalEdgesInChunks<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGShuffleExternalEdgesInChunks_Rmat =
+  Tests_MGShuffleExternalEdgesInChunks<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGShuffleExternalEdgesInChunks_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGShuffleExternalEdgesInChunks_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGShuffleExternalEdgesInChunks_Rmat,
+  ::testing::Combine(
+    // small memory budgets force shuffling the edges in multiple chunks
+    ::testing::Values(ShuffleExternalEdgesInChunks_Usecase{false, size_t{1} << 30},
+                      ShuffleExternalEdgesInChunks_Usecase{true, size_t{1} << 30},
+                      ShuffleExternalEdgesInChunks_Usecase{false, size_t{1} << 14},
+                      ShuffleExternalEdgesInChunks_Usecase{true, size_t{1} << 14},
+                      ShuffleExternalEdgesInChunks_Usecase{true, size_t{1} << 10}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGShuffleExternalEdgesInChunks_Rmat,
+  ::testing::Combine(
+    ::testing::Values(ShuffleExternalEdgesInChunks_Usecase{true, size_t{1} << 28, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+#include "utilities/thrust_wrapper.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/core/comms.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+struct VertexGpuAssignment_Usecase {
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGVertexGpuAssignment
+  : public ::testing::TestWithParam<std::tuple<VertexGpuAssignment_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGVertexGpuAssignment() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(VertexGpuAssignment_Usecase const& assignment_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResTimer hr_timer{};
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+
+    // 1. create MG graph (hash-based vertex partitioning)
+
+    auto [mg_graph, mg_edge_weights, mg_renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, assignment_usecase.test_weighted, true);
+    auto mg_graph_view = mg_graph.view();
+    auto mg_edge_weight_view =
+      mg_edge_weights ? std::make_optional((*mg_edge_weights).view()) : std::nullopt;
+
+    // 2. compute a vertex to GPU assignment
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG compute vertex GPU assignment");
+    }
+
+    auto [assigned_vertices, assigned_ranks] =
+      cugraph::compute_vertex_gpu_assignment<vertex_t, edge_t, weight_t, true>(
+        *handle_,
+        mg_graph_view,
+        mg_edge_weight_view,
+        raft::device_span<vertex_t const>((*mg_renumber_map).data(), (*mg_renumber_map).size()));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 3. re-create the graph following the assignment
+
+    rmm::device_uvector<vertex_t> d_mg_srcs(0, handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_dsts(0, handle_->get_stream());
+    std::optional<rmm::device_uvector<weight_t>> d_mg_weights{std::nullopt};
+    std::tie(d_mg_srcs, d_mg_dsts, d_mg_weights, std::ignore, std::ignore) =
+      cugraph::decompress_to_edgelist(
+        *handle_,
+        mg_graph_view,
+        mg_edge_weight_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::make_optional<raft::device_span<vertex_t const>>((*mg_renumber_map).data(),
+                                                              (*mg_renumber_map).size()));
+
+    auto d_mg_aggregate_assigned_vertices = cugraph::test::device_allgatherv(
+      *handle_, assigned_vertices.data(), assigned_vertices.size());
+    auto d_mg_aggregate_assigned_ranks =
+      cugraph::test::device_allgatherv(*handle_, assigned_ranks.data(), assigned_ranks.size());
+    auto d_mg_aggregate_hash_vertices = cugraph::test::device_gatherv(
+      *handle_, (*mg_renumber_map).data(), (*mg_renumber_map).size());
+    auto d_mg_aggregate_srcs =
+      cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+    auto d_mg_aggregate_dsts =
+      cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+    std::optional<rmm::device_uvector<weight_t>> d_mg_aggregate_weights{std::nullopt};
+    if (d_mg_weights) {
+      d_mg_aggregate_weights =
+        cugraph::test::device_gatherv(*handle_, (*d_mg_weights).data(), (*d_mg_weights).size());
+    }
+
+    auto hash_vertex_partition_range_lasts = mg_graph_view.vertex_partition_range_lasts();
+    auto number_of_vertices                = mg_graph_view.number_of_vertices();
+    auto number_of_edges                   = mg_graph_view.compute_number_of_edges(*handle_);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.start("MG create graph from vertex GPU assignment");
+    }
+
+    auto [new_graph, new_edge_weights, new_edge_ids, new_edge_types, new_renumber_map] =
+      cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, int32_t, false, true>(
+        *handle_,
+        std::make_tuple(std::move(assigned_vertices), std::move(assigned_ranks)),
+        std::move(d_mg_srcs),
+        std::move(d_mg_dsts),
+        std::move(d_mg_weights),
+        std::optional<rmm::device_uvector<edge_t>>{std::nullopt},
+        std::optional<rmm::device_uvector<int32_t>>{std::nullopt},
+        cugraph::graph_properties_t{true, false},
+        true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    // 4. validate
+
+    if (assignment_usecase.check_correctness) {
+      auto new_graph_view = new_graph.view();
+
+      ASSERT_EQ(new_graph_view.number_of_vertices(), number_of_vertices);
+      ASSERT_EQ(new_graph_view.compute_number_of_edges(*handle_), number_of_edges);
+
+      // 4-1. the local vertex partition should coincide with the vertices assigned to this GPU
+
+      auto h_assigned_vertices =
+        cugraph::test::to_host(*handle_, d_mg_aggregate_assigned_vertices);
+      auto h_assigned_ranks   = cugraph::test::to_host(*handle_, d_mg_aggregate_assigned_ranks);
+      auto h_new_renumber_map = cugraph::test::to_host(*handle_, *new_renumber_map);
+
+      std::unordered_map<vertex_t, int> assigned_rank_map{};
+      size_t num_local_assigned_vertices{0};
+      for (size_t i = 0; i < h_assigned_vertices.size(); ++i) {
+        assigned_rank_map.insert({h_assigned_vertices[i], h_assigned_ranks[i]});
+        if (h_assigned_ranks[i] == comm_rank) { ++num_local_assigned_vertices; }
+      }
+      ASSERT_EQ(h_new_renumber_map.size(), num_local_assigned_vertices);
+      for (auto v : h_new_renumber_map) {
+        auto it = assigned_rank_map.find(v);
+        ASSERT_TRUE((it != assigned_rank_map.end()) && (it->second == comm_rank))
+          << "vertex " << v << " is not assigned to GPU " << comm_rank << ".";
+      }
+
+      // 4-2. the edges (in external vertex IDs) should be preserved
+
+      rmm::device_uvector<vertex_t> d_new_srcs(0, handle_->get_stream());
+      rmm::device_uvector<vertex_t> d_new_dsts(0, handle_->get_stream());
+      std::optional<rmm::device_uvector<weight_t>> d_new_weights{std::nullopt};
+      std::tie(d_new_srcs, d_new_dsts, d_new_weights, std::ignore, std::ignore) =
+        cugraph::decompress_to_edgelist(
+          *handle_,
+          new_graph_view,
+          new_edge_weights ? std::make_optional((*new_edge_weights).view()) : std::nullopt,
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::make_optional<raft::device_span<vertex_t const>>((*new_renumber_map).data(),
+                                                                (*new_renumber_map).size()));
+
+      auto d_new_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_new_srcs.data(), d_new_srcs.size());
+      auto d_new_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_new_dsts.data(), d_new_dsts.size());
+      std::optional<rmm::device_uvector<weight_t>> d_new_aggregate_weights{std::nullopt};
+      if (d_new_weights) {
+        d_new_aggregate_weights = cugraph::test::device_gatherv(
+          *handle_, (*d_new_weights).data(), (*d_new_weights).size());
+      }
+
+      if (comm_rank == int{0}) {
+        auto h_srcs        = cugraph::test::to_host(*handle_, d_mg_aggregate_srcs);
+        auto h_dsts        = cugraph::test::to_host(*handle_, d_mg_aggregate_dsts);
+        auto h_weights     = cugraph::test::to_host(*handle_, d_mg_aggregate_weights);
+        auto h_new_srcs    = cugraph::test::to_host(*handle_, d_new_aggregate_srcs);
+        auto h_new_dsts    = cugraph::test::to_host(*handle_, d_new_aggregate_dsts);
+        auto h_new_weights = cugraph::test::to_host(*handle_, d_new_aggregate_weights);
+
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_srcs.size());
+        for (size_t i = 0; i < edges.size(); ++i) {
+          edges[i] =
+            std::make_tuple(h_srcs[i], h_dsts[i], h_weights ? (*h_weights)[i] : weight_t{1.0});
+        }
+        std::vector<std::tuple<vertex_t, vertex_t, weight_t>> new_edges(h_new_srcs.size());
+        for (size_t i = 0; i < new_edges.size(); ++i) {
+          new_edges[i] = std::make_tuple(
+            h_new_srcs[i], h_new_dsts[i], h_new_weights ? (*h_new_weights)[i] : weight_t{1.0});
+        }
+        std::sort(edges.begin(), edges.end());
+        std::sort(new_edges.begin(), new_edges.end());
+        ASSERT_TRUE(std::equal(edges.begin(), edges.end(), new_edges.begin(), new_edges.end()));
+
+        // 4-3. the assignment should not cut more edges than the hash-based vertex partitioning
+
+        auto h_hash_vertices = cugraph::test::to_host(*handle_, d_mg_aggregate_hash_vertices);
+        std::unordered_map<vertex_t, int> hash_rank_map{};
+        for (size_t i = 0; i < hash_vertex_partition_range_lasts.size(); ++i) {
+          auto first = (i == 0) ? vertex_t{0} : hash_vertex_partition_range_lasts[i - 1];
+          for (auto v = first; v < hash_vertex_partition_range_lasts[i]; ++v) {
+            hash_rank_map.insert({h_hash_vertices[v], static_cast<int>(i)});
+          }
+        }
+        size_t hash_cut{0};
+        size_t assigned_cut{0};
+        for (size_t i = 0; i < h_srcs.size(); ++i) {
+          if (hash_rank_map[h_srcs[i]] != hash_rank_map[h_dsts[i]]) { ++hash_cut; }
+          if (assigned_rank_map[h_srcs[i]] != assigned_rank_map[h_dsts[i]]) { ++assigned_cut; }
+        }
+        ASSERT_LE(assigned_cut, hash_cut)
+          << "the vertex GPU assignment cuts more edges than the hash-based partitioning.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGVertexGpuAssignment<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGVertexGpuAssignment_File = Tests_MGVertexGpuAssignment<cugraph::test::File_Usecase>;
+using Tests_MGVertexGpuAssignment_Rmat = Tests_MGVertexGpuAssignment<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGVertexGpuAssignment_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGVertexGpuAssignment_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGVertexGpuAssignment_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGVertexGpuAssignment_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(VertexGpuAssignment_Usecase{false}, VertexGpuAssignment_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGVertexGpuAssignment_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(VertexGpuAssignment_Usecase{false}, VertexGpuAssignment_Usecase{true}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGVertexGpuAssignment_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(VertexGpuAssignment_Usecase{false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
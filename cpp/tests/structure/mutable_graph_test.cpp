@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/mutable_graph.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <set>
+#include <tuple>
+#include <vector>
+
+struct MutableGraph_Usecase {
+  size_t deletion_stride{7};       // delete every deletion_stride-th edge
+  size_t num_insertions{100};      // number of (non-existing) edges to insert
+  double compaction_threshold{0.1};
+  bool test_weighted{false};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MutableGraph
+  : public ::testing::TestWithParam<std::tuple<MutableGraph_Usecase, input_usecase_t>> {
+ public:
+  Tests_MutableGraph() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> to_sorted_host_edges(
+    raft::handle_t const& handle,
+    cugraph::graph_view_t<vertex_t, edge_t, store_transposed, false> const& graph_view,
+    std::optional<cugraph::edge_property_view_t<edge_t, weight_t const*>> edge_weight_view)
+  {
+    auto [d_srcs, d_dsts, d_weights, d_ids, d_types] =
+      cugraph::decompress_to_edgelist<vertex_t, edge_t, weight_t, int32_t, store_transposed, false>(
+        handle, graph_view, edge_weight_view, std::nullopt, std::nullopt, std::nullopt);
+    auto h_srcs    = cugraph::test::to_host(handle, d_srcs);
+    auto h_dsts    = cugraph::test::to_host(handle, d_dsts);
+    auto h_weights = d_weights ? cugraph::test::to_host(handle, *d_weights)
+                               : std::vector<weight_t>(h_srcs.size(), weight_t{1.0});
+
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_srcs.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+      edges[i] = std::make_tuple(h_srcs[i], h_dsts[i], h_weights[i]);
+    }
+    std::sort(edges.begin(), edges.end());
+    return edges;
+  }
+
+  // BFS is implemented with the primitives, which skip the vertices in the zero-degree segment
+  template <typename vertex_t, typename edge_t>
+  std::vector<vertex_t> bfs_distances(raft::handle_t const& handle,
+                                      cugraph::graph_view_t<vertex_t, edge_t, false, false> const&
+                                        graph_view,
+                                      vertex_t source)
+  {
+    rmm::device_uvector<vertex_t> d_distances(graph_view.number_of_vertices(),
+                                              handle.get_stream());
+    auto d_sources = cugraph::test::to_device(handle, std::vector<vertex_t>{source});
+    cugraph::bfs(handle,
+                 graph_view,
+                 d_distances.data(),
+                 static_cast<vertex_t*>(nullptr),
+                 d_sources.data(),
+                 size_t{1});
+    return cugraph::test::to_host(handle, d_distances);
+  }
+
+  template <typename vertex_t, typename weight_t>
+  std::vector<vertex_t> host_bfs_distances(
+    std::vector<std::tuple<vertex_t, vertex_t, weight_t>> const& sorted_edges,
+    vertex_t num_vertices,
+    vertex_t source)
+  {
+    std::vector<size_t> offsets(num_vertices + 1, 0);
+    for (auto const& e : sorted_edges) {
+      ++offsets[std::get<0>(e) + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<vertex_t> distances(num_vertices, std::numeric_limits<vertex_t>::max());
+    std::queue<vertex_t> queue{};
+    distances[source] = vertex_t{0};
+    queue.push(source);
+    while (!queue.empty()) {
+      auto v = queue.front();
+      queue.pop();
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+        auto nbr = std::get<1>(sorted_edges[i]);
+        if (distances[nbr] == std::numeric_limits<vertex_t>::max()) {
+          distances[nbr] = distances[v] + 1;
+          queue.push(nbr);
+        }
+      }
+    }
+    return distances;
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(MutableGraph_Usecase const& mutable_graph_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, mutable_graph_usecase.test_weighted, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto num_vertices = graph.view().number_of_vertices();
+    auto is_symmetric = graph.view().is_symmetric();
+
+    // 1. pick the edges to delete and insert (both directions if the graph is symmetric)
+
+    auto h_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t, store_transposed>(
+      handle,
+      graph.view(),
+      edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt);
+
+    std::set<std::tuple<vertex_t, vertex_t>> h_deleted_pairs{};
+    for (size_t i = 0; i < h_edges.size(); i += mutable_graph_usecase.deletion_stride) {
+      auto [src, dst, w] = h_edges[i];
+      h_deleted_pairs.insert(std::make_tuple(src, dst));
+      if (is_symmetric) { h_deleted_pairs.insert(std::make_tuple(dst, src)); }
+    }
+
+    std::set<std::tuple<vertex_t, vertex_t>> h_existing_pairs{};
+    for (auto const& e : h_edges) {
+      h_existing_pairs.insert(std::make_tuple(std::get<0>(e), std::get<1>(e)));
+    }
+    std::vector<vertex_t> h_insert_srcs{};
+    std::vector<vertex_t> h_insert_dsts{};
+    std::vector<weight_t> h_insert_weights{};
+    for (size_t i = 0; (h_insert_srcs.size() < mutable_graph_usecase.num_insertions) &&
+                       (i < mutable_graph_usecase.num_insertions * 4);
+         ++i) {
+      auto src = static_cast<vertex_t>((i * 7919) % num_vertices);
+      auto dst = static_cast<vertex_t>((i * 104729 + 17) % num_vertices);
+      if ((src == dst) || (h_existing_pairs.find(std::make_tuple(src, dst)) !=
+                           h_existing_pairs.end())) {
+        continue;
+      }
+      auto w = static_cast<weight_t>(1.0 + static_cast<double>(i % 10) * 0.25);
+      h_existing_pairs.insert(std::make_tuple(src, dst));
+      h_insert_srcs.push_back(src);
+      h_insert_dsts.push_back(dst);
+      h_insert_weights.push_back(w);
+      if (is_symmetric) {
+        h_existing_pairs.insert(std::make_tuple(dst, src));
+        h_insert_srcs.push_back(dst);
+        h_insert_dsts.push_back(src);
+        h_insert_weights.push_back(w);
+      }
+    }
+
+    // connect a vertex in the zero-degree segment (merging should move the vertex out of the
+    // zero-degree segment)
+    std::optional<vertex_t> h_zero_degree_vertex{std::nullopt};
+    auto h_segment_offsets = graph.view().local_vertex_partition_segment_offsets();
+    if (h_segment_offsets && (*((*h_segment_offsets).rbegin() + 1) < num_vertices) &&
+        (h_insert_srcs.size() > 0)) {
+      auto v   = num_vertices - 1;  // the last vertex is in the zero-degree segment
+      auto nbr = vertex_t{0};
+      auto src = store_transposed ? nbr : v;
+      auto dst = store_transposed ? v : nbr;
+      if ((v != nbr) &&
+          (h_existing_pairs.find(std::make_tuple(src, dst)) == h_existing_pairs.end())) {
+        h_zero_degree_vertex = v;
+        h_existing_pairs.insert(std::make_tuple(src, dst));
+        h_insert_srcs.push_back(src);
+        h_insert_dsts.push_back(dst);
+        h_insert_weights.push_back(weight_t{1.0});
+        if (is_symmetric) {
+          h_existing_pairs.insert(std::make_tuple(dst, src));
+          h_insert_srcs.push_back(dst);
+          h_insert_dsts.push_back(src);
+          h_insert_weights.push_back(weight_t{1.0});
+        }
+      }
+    }
+
+    std::vector<vertex_t> h_delete_srcs{};
+    std::vector<vertex_t> h_delete_dsts{};
+    for (auto const& pair : h_deleted_pairs) {
+      h_delete_srcs.push_back(std::get<0>(pair));
+      h_delete_dsts.push_back(std::get<1>(pair));
+    }
+    // also delete the first inserted edge (after inserting, to exercise the delta buffer)
+    std::vector<vertex_t> h_undo_srcs{};
+    std::vector<vertex_t> h_undo_dsts{};
+    if (h_insert_srcs.size() > 0) {
+      h_undo_srcs.push_back(h_insert_srcs[0]);
+      h_undo_dsts.push_back(h_insert_dsts[0]);
+      if (is_symmetric) {
+        h_undo_srcs.push_back(h_insert_dsts[0]);
+        h_undo_dsts.push_back(h_insert_srcs[0]);
+      }
+    }
+
+    auto d_delete_srcs    = cugraph::test::to_device(handle, h_delete_srcs);
+    auto d_delete_dsts    = cugraph::test::to_device(handle, h_delete_dsts);
+    auto d_insert_srcs    = cugraph::test::to_device(handle, h_insert_srcs);
+    auto d_insert_dsts    = cugraph::test::to_device(handle, h_insert_dsts);
+    auto d_insert_weights = cugraph::test::to_device(handle, h_insert_weights);
+    auto d_undo_srcs      = cugraph::test::to_device(handle, h_undo_srcs);
+    auto d_undo_dsts      = cugraph::test::to_device(handle, h_undo_dsts);
+
+    // 2. apply the updates
+
+    cugraph::mutable_graph_t<vertex_t, edge_t, weight_t, store_transposed, false> mutable_graph(
+      handle,
+      std::move(graph),
+      std::move(edge_weights),
+      mutable_graph_usecase.compaction_threshold);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Update graph");
+    }
+
+    mutable_graph.delete_edges(
+      handle,
+      raft::device_span<vertex_t const>(d_delete_srcs.data(), d_delete_srcs.size()),
+      raft::device_span<vertex_t const>(d_delete_dsts.data(), d_delete_dsts.size()),
+      true);
+    mutable_graph.insert_edges(
+      handle,
+      raft::device_span<vertex_t const>(d_insert_srcs.data(), d_insert_srcs.size()),
+      raft::device_span<vertex_t const>(d_insert_dsts.data(), d_insert_dsts.size()),
+      mutable_graph_usecase.test_weighted
+        ? std::make_optional<raft::device_span<weight_t const>>(d_insert_weights.data(),
+                                                                d_insert_weights.size())
+        : std::nullopt,
+      true);
+    mutable_graph.delete_edges(
+      handle,
+      raft::device_span<vertex_t const>(d_undo_srcs.data(), d_undo_srcs.size()),
+      raft::device_span<vertex_t const>(d_undo_dsts.data(), d_undo_dsts.size()),
+      true);
+    auto graph_view = mutable_graph.view(handle);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(mutable_graph.number_of_local_pending_insertions(), size_t{0})
+      << "view() should merge the pending insertions.";
+
+    if (mutable_graph_usecase.check_correctness) {
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> h_reference_edges{};
+      for (auto const& e : h_edges) {
+        if (h_deleted_pairs.find(std::make_tuple(std::get<0>(e), std::get<1>(e))) ==
+            h_deleted_pairs.end()) {
+          h_reference_edges.push_back(e);
+        }
+      }
+      for (size_t i = h_undo_srcs.size(); i < h_insert_srcs.size(); ++i) {
+        h_reference_edges.push_back(std::make_tuple(
+          h_insert_srcs[i],
+          h_insert_dsts[i],
+          mutable_graph_usecase.test_weighted ? h_insert_weights[i] : weight_t{1.0}));
+      }
+      std::sort(h_reference_edges.begin(), h_reference_edges.end());
+
+      auto h_updated_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t, store_transposed>(
+        handle, graph_view, mutable_graph.edge_weight_view());
+      ASSERT_TRUE(h_updated_edges == h_reference_edges)
+        << "Updated edges do not match with the reference edges.";
+
+      auto bfs_source = h_zero_degree_vertex ? *h_zero_degree_vertex : vertex_t{0};
+      if constexpr (!store_transposed) {
+        ASSERT_TRUE(bfs_distances(handle, graph_view, bfs_source) ==
+                    host_bfs_distances(h_reference_edges, num_vertices, bfs_source))
+          << "BFS distances on the updated graph do not match with the reference distances.";
+      }
+
+      // a density threshold of 1.0 compacts whenever any edge is masked out
+      auto compacted = cugraph::compact_graph_if_sparse(
+        handle, graph_view, mutable_graph.edge_weight_view(), 1.0);
+      ASSERT_EQ(compacted.has_value(), graph_view.has_edge_mask());
+      if (compacted) {
+        auto compacted_graph_view = std::get<0>(*compacted).view();
+        ASSERT_FALSE(compacted_graph_view.has_edge_mask());
+        auto h_compacted_graph_edges =
+          to_sorted_host_edges<vertex_t, edge_t, weight_t, store_transposed>(
+            handle,
+            compacted_graph_view,
+            std::get<1>(*compacted) ? std::make_optional((*std::get<1>(*compacted)).view())
+                                    : std::nullopt);
+        ASSERT_TRUE(h_compacted_graph_edges == h_reference_edges)
+          << "Edges of the compacted graph do not match with the reference edges.";
+      }
+
+      // compact on a separate stream while graph_view stays readable
+      {
+        rmm::cuda_stream background_stream{};
+        raft::handle_t background_handle(background_stream.view());
+        handle.sync_stream();
+        auto [background_graph, background_edge_weights] =
+          cugraph::compact_graph(background_handle, graph_view, mutable_graph.edge_weight_view());
+        background_handle.sync_stream();
+        auto background_graph_view = background_graph.view();
+        ASSERT_FALSE(background_graph_view.has_edge_mask());
+        ASSERT_EQ(background_graph_view.number_of_edges(),
+                  static_cast<edge_t>(h_reference_edges.size()));
+        ASSERT_TRUE(background_graph_view.local_vertex_partition_segment_offsets() ==
+                    graph_view.local_vertex_partition_segment_offsets());
+        auto h_background_graph_edges =
+          to_sorted_host_edges<vertex_t, edge_t, weight_t, store_transposed>(
+            handle,
+            background_graph_view,
+            background_edge_weights ? std::make_optional((*background_edge_weights).view())
+                                    : std::nullopt);
+        ASSERT_TRUE(h_background_graph_edges == h_reference_edges)
+          << "Edges of the graph compacted on a separate stream do not match with the reference "
+             "edges.";
+      }
+
+      mutable_graph.compact(handle);
+      ASSERT_EQ(mutable_graph.number_of_local_masked_edges(), edge_t{0});
+      graph_view = mutable_graph.view(handle);
+      ASSERT_FALSE(graph_view.has_edge_mask());
+      ASSERT_EQ(graph_view.number_of_edges(), static_cast<edge_t>(h_reference_edges.size()));
+
+      auto h_compacted_edges = to_sorted_host_edges<vertex_t, edge_t, weight_t, store_transposed>(
+        handle, graph_view, mutable_graph.edge_weight_view());
+      ASSERT_TRUE(h_compacted_edges == h_reference_edges)
+        << "Compacted edges do not match with the reference edges.";
+
+      if constexpr (!store_transposed) {
+        ASSERT_TRUE(bfs_distances(handle, graph_view, bfs_source) ==
+                    host_bfs_distances(h_reference_edges, num_vertices, bfs_source))
+          << "BFS distances on the compacted graph do not match with the reference distances.";
+      }
+    }
+  }
+};
+
+using Tests_MutableGraph_File = Tests_MutableGraph<cugraph::test::File_Usecase>;
+using Tests_MutableGraph_Rmat = Tests_MutableGraph<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MutableGraph_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MutableGraph_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MutableGraph_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MutableGraph_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MutableGraph_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MutableGraph_Usecase{7, 20, 0.1, false},
+                      MutableGraph_Usecase{7, 20, 0.1, true},
+                      MutableGraph_Usecase{3, 50, 1.0, true}),
+    ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                      cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MutableGraph_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MutableGraph_Usecase{7, 100, 0.1, false},
+                      MutableGraph_Usecase{7, 100, 0.1, true},
+                      MutableGraph_Usecase{101, 1000, 1.0, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MutableGraph_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MutableGraph_Usecase{1000, 100000, 0.1, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
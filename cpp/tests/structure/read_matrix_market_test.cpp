@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/matrix_market_file_utilities.hpp"
+#include "utilities/misc_utilities.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct ReadMatrixMarket_Usecase {
+  std::string graph_file_path{};
+  size_t chunk_size{size_t{1} << 28};
+  bool test_weighted{false};
+};
+
+class Tests_ReadMatrixMarket : public ::testing::TestWithParam<ReadMatrixMarket_Usecase> {
+ public:
+  Tests_ReadMatrixMarket() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename weight_t>
+  void run_current_test(ReadMatrixMarket_Usecase const& read_matrix_market_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" +
+                                read_matrix_market_usecase.graph_file_path;
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Read Matrix Market file");
+    }
+
+    auto [d_srcs, d_dsts, d_weights, d_vertices, is_symmetric] =
+      cugraph::read_matrix_market_edgelist<vertex_t, weight_t, false>(
+        handle,
+        graph_file_full_path,
+        read_matrix_market_usecase.test_weighted,
+        false,
+        read_matrix_market_usecase.chunk_size,
+        true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto [d_reference_srcs,
+          d_reference_dsts,
+          d_reference_weights,
+          d_reference_vertices,
+          reference_is_symmetric] =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+        handle,
+        graph_file_full_path,
+        read_matrix_market_usecase.test_weighted,
+        false,
+        false);
+
+    ASSERT_EQ(is_symmetric, reference_is_symmetric);
+    ASSERT_EQ(d_weights.has_value(), d_reference_weights.has_value());
+    ASSERT_EQ(d_vertices.size(), d_reference_vertices.size());
+    ASSERT_EQ(d_srcs.size(), d_reference_srcs.size());
+
+    auto to_sorted_host_edges = [&handle](auto const& srcs, auto const& dsts, auto const& weights) {
+      auto h_srcs    = cugraph::test::to_host(handle, srcs);
+      auto h_dsts    = cugraph::test::to_host(handle, dsts);
+      auto h_weights = weights ? cugraph::test::to_host(handle, *weights)
+                               : std::vector<weight_t>(h_srcs.size(), weight_t{1.0});
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(h_srcs.size());
+      for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i] = std::make_tuple(h_srcs[i], h_dsts[i], h_weights[i]);
+      }
+      std::sort(edges.begin(), edges.end());
+      return edges;
+    };
+
+    auto h_edges           = to_sorted_host_edges(d_srcs, d_dsts, d_weights);
+    auto h_reference_edges =
+      to_sorted_host_edges(d_reference_srcs, d_reference_dsts, d_reference_weights);
+
+    auto nearly_equal = [](auto lhs, auto rhs) {
+      auto threshold_ratio = weight_t{1e-4};
+      return (std::get<0>(lhs) == std::get<0>(rhs)) && (std::get<1>(lhs) == std::get<1>(rhs)) &&
+             (std::abs(std::get<2>(lhs) - std::get<2>(rhs)) <=
+              std::max(std::abs(std::get<2>(lhs)), std::abs(std::get<2>(rhs))) * threshold_ratio);
+    };
+    ASSERT_TRUE(
+      std::equal(h_edges.begin(), h_edges.end(), h_reference_edges.begin(), nearly_equal))
+      << "Edges do not match with the reference edges.";
+  }
+};
+
+TEST_P(Tests_ReadMatrixMarket, CheckInt32Float)
+{
+  run_current_test<int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_ReadMatrixMarket, CheckInt64Float)
+{
+  run_current_test<int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ReadMatrixMarket,
+  ::testing::Values(ReadMatrixMarket_Usecase{"test/datasets/karate.mtx", size_t{1} << 28, false},
+                    ReadMatrixMarket_Usecase{"test/datasets/karate.mtx", size_t{1} << 28, true},
+                    // small chunks to test lines spanning chunk boundaries
+                    ReadMatrixMarket_Usecase{"test/datasets/karate.mtx", size_t{128}, true},
+                    ReadMatrixMarket_Usecase{"test/datasets/dolphins.mtx", size_t{1} << 28, true},
+                    ReadMatrixMarket_Usecase{"test/datasets/dolphins.mtx", size_t{97}, true},
+                    ReadMatrixMarket_Usecase{"test/datasets/web-Google.mtx", size_t{4096}, true}));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/managed_memory_resource.hpp>
+#include <rmm/mr/pinned_host_memory_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <vector>
+
+struct RelocateGraphEdges_Usecase {
+  bool use_managed_memory{true};  // use pinned host memory if false
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_RelocateGraphEdges
+  : public ::testing::TestWithParam<std::tuple<RelocateGraphEdges_Usecase, input_usecase_t>> {
+ public:
+  Tests_RelocateGraphEdges() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(RelocateGraphEdges_Usecase const& relocate_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    rmm::mr::managed_memory_resource managed_mr{};
+    rmm::mr::pinned_host_memory_resource pinned_mr{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, renumber);
+
+    auto graph_view       = graph.view();
+    auto edge_weight_view = (*edge_weights).view();
+
+    vertex_t source{0};
+
+    std::vector<edge_t> h_offsets{};
+    std::vector<vertex_t> h_indices{};
+    std::optional<std::vector<weight_t>> h_weights{std::nullopt};
+    std::vector<weight_t> h_distances{};
+    if (relocate_usecase.check_correctness) {
+      std::tie(h_offsets, h_indices, h_weights) =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+          handle, graph_view, std::make_optional(edge_weight_view), std::nullopt);
+
+      rmm::device_uvector<weight_t> d_distances(graph_view.number_of_vertices(),
+                                                handle.get_stream());
+      cugraph::sssp(handle,
+                    graph_view,
+                    edge_weight_view,
+                    d_distances.data(),
+                    static_cast<vertex_t*>(nullptr),
+                    source);
+      h_distances = cugraph::test::to_host(handle, d_distances);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Relocate graph edges");
+    }
+
+    auto [relocated_graph, relocated_edge_weights] =
+      cugraph::relocate_graph_edges<vertex_t, edge_t, weight_t, false, false>(
+        handle,
+        std::move(graph),
+        std::move(edge_weights),
+        relocate_usecase.use_managed_memory ? rmm::device_async_resource_ref{managed_mr}
+                                            : rmm::device_async_resource_ref{pinned_mr},
+        true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto relocated_graph_view       = relocated_graph.view();
+    auto relocated_edge_weight_view = (*relocated_edge_weights).view();
+
+    ASSERT_EQ(relocated_graph_view.number_of_vertices(), graph_view.number_of_vertices());
+    ASSERT_EQ(relocated_graph_view.number_of_edges(), graph_view.number_of_edges());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("SSSP (relocated edges)");
+    }
+
+    rmm::device_uvector<weight_t> d_relocated_distances(relocated_graph_view.number_of_vertices(),
+                                                        handle.get_stream());
+    cugraph::sssp(handle,
+                  relocated_graph_view,
+                  relocated_edge_weight_view,
+                  d_relocated_distances.data(),
+                  static_cast<vertex_t*>(nullptr),
+                  source);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (relocate_usecase.check_correctness) {
+      auto [h_relocated_offsets, h_relocated_indices, h_relocated_weights] =
+        cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
+          handle,
+          relocated_graph_view,
+          std::make_optional(relocated_edge_weight_view),
+          std::nullopt);
+
+      ASSERT_TRUE(h_relocated_offsets == h_offsets) << "Offsets do not match.";
+      ASSERT_TRUE(h_relocated_indices == h_indices) << "Indices do not match.";
+      ASSERT_TRUE(h_relocated_weights == h_weights) << "Edge weights do not match.";
+
+      auto h_relocated_distances = cugraph::test::to_host(handle, d_relocated_distances);
+      ASSERT_TRUE(h_relocated_distances == h_distances) << "SSSP distances do not match.";
+    }
+  }
+};
+
+using Tests_RelocateGraphEdges_File = Tests_RelocateGraphEdges<cugraph::test::File_Usecase>;
+using Tests_RelocateGraphEdges_Rmat = Tests_RelocateGraphEdges<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_RelocateGraphEdges_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_RelocateGraphEdges_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_RelocateGraphEdges_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_RelocateGraphEdges_File,
+  ::testing::Combine(::testing::Values(RelocateGraphEdges_Usecase{true},
+                                       RelocateGraphEdges_Usecase{false}),
+                     ::testing::Values(cugraph::test::File_Usecase("karate.csv"),
+                                       cugraph::test::File_Usecase("dolphins.csv"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_RelocateGraphEdges_Rmat,
+  ::testing::Combine(
+    ::testing::Values(RelocateGraphEdges_Usecase{true}, RelocateGraphEdges_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_RelocateGraphEdges_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(RelocateGraphEdges_Usecase{true, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -41,6 +41,8 @@
 
 struct Renumbering_Usecase {
   bool check_correctness{true};
+  bool hash_based{false};
+  cugraph::renumber_order_t order{cugraph::renumber_order_t::degree};
 };
 
 template <typename input_usecase_t>
@@ -89,10 +91,30 @@ class Tests_Renumbering
             std::nullopt);
     }
 
+    // renumber map and segment offsets with the sort method and the degree order
+    std::vector<vertex_t> h_reference_renumber_map_labels{};
+    std::vector<vertex_t> h_reference_segment_offsets{};
     if (renumbering_usecase.check_correctness) {
       h_original_src_v = cugraph::test::to_host(handle, src_v);
       h_original_dst_v = cugraph::test::to_host(handle, dst_v);
+
+      if (renumbering_usecase.hash_based ||
+          (renumbering_usecase.order != cugraph::renumber_order_t::degree)) {
+        auto tmp_src_v = cugraph::test::to_device(handle, h_original_src_v);
+        auto tmp_dst_v = cugraph::test::to_device(handle, h_original_dst_v);
+        rmm::device_uvector<vertex_t> renumber_map_labels_v(0, handle.get_stream());
+        cugraph::renumber_meta_t<vertex_t, edge_t, false> meta{};
+        std::tie(renumber_map_labels_v, meta) = cugraph::renumber_edgelist<vertex_t, edge_t, false>(
+          handle, std::nullopt, tmp_src_v.begin(), tmp_dst_v.begin(), tmp_src_v.size(), false);
+        h_reference_renumber_map_labels = cugraph::test::to_host(handle, renumber_map_labels_v);
+        h_reference_segment_offsets     = meta.segment_offsets;
+      }
+    }
+
+    if (renumbering_usecase.hash_based) {
+      cugraph::set_renumber_method_hint(handle, cugraph::renumber_method_t::hash);
     }
+    cugraph::set_renumber_order_hint(handle, renumbering_usecase.order);
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -110,7 +132,39 @@ class Tests_Renumbering
       hr_timer.display_and_clear(std::cout);
     }
 
+    if (renumbering_usecase.hash_based) {
+      cugraph::set_renumber_method_hint(handle, cugraph::renumber_method_t::sort);
+    }
+    cugraph::set_renumber_order_hint(handle, cugraph::renumber_order_t::degree);
+
     if (renumbering_usecase.check_correctness) {
+      if (renumbering_usecase.order != cugraph::renumber_order_t::degree) {
+        // the order should only permute vertices within the high, mid, and low degree segments
+        auto h_renumber_map_labels = cugraph::test::to_host(handle, renumber_map_labels_v);
+        ASSERT_EQ(h_renumber_map_labels.size(), h_reference_renumber_map_labels.size());
+        for (size_t i = 0; i < h_reference_segment_offsets.size() - 1; ++i) {
+          auto first = h_reference_segment_offsets[i];
+          auto last  = h_reference_segment_offsets[i + 1];
+          std::vector<vertex_t> segment(h_renumber_map_labels.begin() + first,
+                                        h_renumber_map_labels.begin() + last);
+          std::vector<vertex_t> reference_segment(h_reference_renumber_map_labels.begin() + first,
+                                                  h_reference_renumber_map_labels.begin() + last);
+          if (i < cugraph::detail::num_sparse_segments_per_vertex_partition) {
+            if (renumbering_usecase.order == cugraph::renumber_order_t::input) {
+              EXPECT_TRUE(std::is_sorted(segment.begin(), segment.end()))
+                << "vertices should be ordered by external ID within a segment.";
+            }
+            std::sort(segment.begin(), segment.end());
+            std::sort(reference_segment.begin(), reference_segment.end());
+          }
+          EXPECT_EQ(segment, reference_segment)
+            << "reordering should not move vertices across degree segments.";
+        }
+      } else if (renumbering_usecase.hash_based) {
+        auto h_renumber_map_labels = cugraph::test::to_host(handle, renumber_map_labels_v);
+        EXPECT_EQ(h_renumber_map_labels, h_reference_renumber_map_labels);
+      }
+
       cugraph::unrenumber_local_int_vertices(handle,
                                              src_v.data(),
                                              src_v.size(),
@@ -129,6 +183,73 @@ class Tests_Renumbering
 
       EXPECT_EQ(h_original_src_v, h_original_src_v);
       EXPECT_EQ(h_original_dst_v, h_original_dst_v);
+
+      // unrenumber, compact, and copy to a page-locked host buffer in a single call
+
+      {
+        auto num_labels = static_cast<vertex_t>(renumber_map_labels_v.size());
+        std::vector<vertex_t> h_int_vertices{};
+        for (vertex_t v = 0; v < num_labels; ++v) {
+          h_int_vertices.push_back(num_labels - 1 - v);
+          if (v % 3 == 0) { h_int_vertices.push_back(cugraph::invalid_vertex_id<vertex_t>::value); }
+        }
+        auto d_int_vertices = cugraph::test::to_device(handle, h_int_vertices);
+
+        vertex_t* pinned_ext_vertices{nullptr};
+        RAFT_CUDA_TRY(
+          cudaMallocHost(reinterpret_cast<void**>(&pinned_ext_vertices),
+                         std::max(h_int_vertices.size(), size_t{1}) * sizeof(vertex_t)));
+        auto num_copied = cugraph::unrenumber_local_int_vertices_to_host(
+          handle,
+          raft::device_span<vertex_t const>(d_int_vertices.data(), d_int_vertices.size()),
+          renumber_map_labels_v.data(),
+          vertex_t{0},
+          num_labels,
+          raft::host_span<vertex_t>(pinned_ext_vertices, h_int_vertices.size()),
+          true);
+        std::vector<vertex_t> h_ext_vertices(pinned_ext_vertices, pinned_ext_vertices + num_copied);
+        RAFT_CUDA_TRY(cudaFreeHost(pinned_ext_vertices));
+
+        auto h_labels = cugraph::test::to_host(handle, renumber_map_labels_v);
+        std::vector<vertex_t> h_reference_ext_vertices{};
+        for (auto v : h_int_vertices) {
+          if (v != cugraph::invalid_vertex_id<vertex_t>::value) {
+            h_reference_ext_vertices.push_back(h_labels[v]);
+          }
+        }
+        EXPECT_EQ(h_ext_vertices, h_reference_ext_vertices);
+      }
+
+      // extend the renumber map with a batch of seen and unseen vertices
+
+      auto h_renumber_map_labels = cugraph::test::to_host(handle, renumber_map_labels_v);
+      auto max_label =
+        *std::max_element(h_renumber_map_labels.begin(), h_renumber_map_labels.end());
+      std::vector<vertex_t> h_new_vertices(h_original_src_v.begin(),
+                                           h_original_src_v.begin() +
+                                             std::min(h_original_src_v.size(), size_t{1024}));
+      auto num_seen = h_new_vertices.size();
+      for (size_t i = 0; i < num_seen; ++i) {
+        h_new_vertices.push_back(max_label + 1 + static_cast<vertex_t>(i % 16));
+      }
+      auto d_new_vertices = cugraph::test::to_device(handle, h_new_vertices);
+
+      auto [extended_labels_v, num_appended] = cugraph::extend_renumber_map<vertex_t, false>(
+        handle,
+        std::move(renumber_map_labels_v),
+        raft::device_span<vertex_t const>(d_new_vertices.data(), d_new_vertices.size()),
+        true);
+      auto h_extended_labels = cugraph::test::to_host(handle, extended_labels_v);
+
+      ASSERT_EQ(num_appended, static_cast<vertex_t>(std::min(num_seen, size_t{16})));
+      ASSERT_EQ(h_extended_labels.size(), h_renumber_map_labels.size() + num_appended);
+      EXPECT_TRUE(std::equal(h_renumber_map_labels.begin(),
+                             h_renumber_map_labels.end(),
+                             h_extended_labels.begin()))
+        << "existing vertices should keep their internal IDs.";
+      EXPECT_TRUE(std::all_of(h_extended_labels.begin() + h_renumber_map_labels.size(),
+                              h_extended_labels.end(),
+                              [max_label](auto v) { return v > max_label; }));
     }
   }
 };
@@ -154,7 +275,11 @@ INSTANTIATE_TEST_SUITE_P(file_test,
                          Tests_Renumbering_File,
                          ::testing::Combine(
                            // enable correctness checks
-                           ::testing::Values(Renumbering_Usecase{}),
+                           ::testing::Values(
+                             Renumbering_Usecase{},
+                             Renumbering_Usecase{true, true},
+                             Renumbering_Usecase{true, false, cugraph::renumber_order_t::input},
+                             Renumbering_Usecase{true, false, cugraph::renumber_order_t::neighbor}),
                            ::testing::Values(cugraph::test::File_Usecase("negative-vertex-id.csv"),
                                              cugraph::test::File_Usecase("karate.csv"))));
 
@@ -173,7 +298,10 @@ INSTANTIATE_TEST_SUITE_P(
   Tests_Renumbering_Rmat,
   ::testing::Combine(
     // enable correctness checks
-    ::testing::Values(Renumbering_Usecase{}),
+    ::testing::Values(Renumbering_Usecase{},
+                      Renumbering_Usecase{true, true},
+                      Renumbering_Usecase{true, false, cugraph::renumber_order_t::input},
+                      Renumbering_Usecase{true, true, cugraph::renumber_order_t::neighbor}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -185,7 +313,7 @@ INSTANTIATE_TEST_SUITE_P(
   Tests_Renumbering_Rmat,
   ::testing::Combine(
     // disable correctness checks for large graphs
-    ::testing::Values(Renumbering_Usecase{false}),
+    ::testing::Values(Renumbering_Usecase{false}, Renumbering_Usecase{false, true}),
     ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct Select_Vertices_By_Value_Usecase {
+  size_t k{16};
+  bool largest{true};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t, typename vertex_t, typename edge_t, typename value_t>
+class Tests_Select_Vertices_By_Value
+  : public ::testing::TestWithParam<std::tuple<Select_Vertices_By_Value_Usecase, input_usecase_t>> {
+ public:
+  Tests_Select_Vertices_By_Value() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  void run_current_test(Select_Vertices_By_Value_Usecase const& select_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, true);
+    auto graph_view = graph.view();
+
+    // values are drawn from a small range to create ties
+
+    std::vector<value_t> h_values(graph_view.number_of_vertices());
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> dist(0, 63);
+    std::generate(
+      h_values.begin(), h_values.end(), [&] { return static_cast<value_t>(dist(gen)); });
+    auto d_values = cugraph::test::to_device(handle, h_values);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Select top-k vertices");
+    }
+
+    auto [top_vertices, top_values] = cugraph::select_top_k_vertices(
+      handle,
+      graph_view,
+      raft::device_span<value_t const>(d_values.data(), d_values.size()),
+      std::make_optional<raft::device_span<vertex_t const>>((*renumber_map).data(),
+                                                            (*renumber_map).size()),
+      select_usecase.k,
+      select_usecase.largest);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    value_t threshold = select_usecase.largest ? value_t{48} : value_t{15};
+    auto [threshold_vertices, threshold_values] = cugraph::select_vertices_by_threshold(
+      handle,
+      graph_view,
+      raft::device_span<value_t const>(d_values.data(), d_values.size()),
+      std::make_optional<raft::device_span<vertex_t const>>((*renumber_map).data(),
+                                                            (*renumber_map).size()),
+      threshold,
+      select_usecase.largest);
+
+    if (select_usecase.check_correctness) {
+      auto h_renumber_map = cugraph::test::to_host(handle, *renumber_map);
+
+      std::vector<vertex_t> h_order(h_values.size());
+      std::iota(h_order.begin(), h_order.end(), vertex_t{0});
+      std::stable_sort(h_order.begin(), h_order.end(), [&](auto lhs, auto rhs) {
+        return select_usecase.largest ? (h_values[lhs] > h_values[rhs])
+                                      : (h_values[lhs] < h_values[rhs]);
+      });
+      h_order.resize(std::min(h_order.size(), select_usecase.k));
+      std::vector<vertex_t> h_reference_top_vertices(h_order.size());
+      std::vector<value_t> h_reference_top_values(h_order.size());
+      for (size_t i = 0; i < h_order.size(); ++i) {
+        h_reference_top_vertices[i] = h_renumber_map[h_order[i]];
+        h_reference_top_values[i]   = h_values[h_order[i]];
+      }
+
+      EXPECT_EQ(cugraph::test::to_host(handle, top_vertices), h_reference_top_vertices);
+      EXPECT_EQ(cugraph::test::to_host(handle, top_values), h_reference_top_values);
+
+      std::vector<vertex_t> h_reference_threshold_vertices{};
+      std::vector<value_t> h_reference_threshold_values{};
+      for (size_t i = 0; i < h_values.size(); ++i) {
+        if (select_usecase.largest ? (h_values[i] >= threshold) : (h_values[i] <= threshold)) {
+          h_reference_threshold_vertices.push_back(h_renumber_map[i]);
+          h_reference_threshold_values.push_back(h_values[i]);
+        }
+      }
+
+      EXPECT_EQ(cugraph::test::to_host(handle, threshold_vertices), h_reference_threshold_vertices);
+      EXPECT_EQ(cugraph::test::to_host(handle, threshold_values), h_reference_threshold_values);
+    }
+  }
+};
+
+using Tests_Select_Vertices_By_Value_File =
+  Tests_Select_Vertices_By_Value<cugraph::test::File_Usecase, int32_t, int32_t, float>;
+
+using Tests_Select_Vertices_By_Value_Rmat =
+  Tests_Select_Vertices_By_Value<cugraph::test::Rmat_Usecase, int64_t, int64_t, double>;
+
+TEST_P(Tests_Select_Vertices_By_Value_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test(std::get<0>(param),
+                   override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Select_Vertices_By_Value_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test(std::get<0>(param),
+                   override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Select_Vertices_By_Value_File,
+  ::testing::Combine(::testing::Values(Select_Vertices_By_Value_Usecase{10, true},
+                                       Select_Vertices_By_Value_Usecase{10, false},
+                                       Select_Vertices_By_Value_Usecase{1000, true}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Select_Vertices_By_Value_Rmat,
+  ::testing::Combine(::testing::Values(Select_Vertices_By_Value_Usecase{100, true},
+                                       Select_Vertices_By_Value_Usecase{100, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Select_Vertices_By_Value_Rmat,
+  ::testing::Combine(::testing::Values(Select_Vertices_By_Value_Usecase{1000, true, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
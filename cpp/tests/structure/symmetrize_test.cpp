@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <map>
 #include <numeric>
 #include <vector>
 
@@ -405,6 +406,66 @@ class Tests_Symmetrize
   }
 };
 
+TEST(CleanEdgelist, CheckInt32Int32Float)
+{
+  raft::handle_t handle{};
+
+  // self-loops (2, 2) and (4, 4), multi-edges (0, 1) and (1, 3), opposite edges (1, 0) and (2, 1)
+  std::vector<int32_t> h_srcs{0, 0, 1, 2, 2, 1, 1, 3, 4};
+  std::vector<int32_t> h_dsts{1, 1, 0, 1, 2, 2, 3, 1, 4};
+  std::vector<float> h_weights{1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0};
+
+  for (auto op : {cugraph::edge_weight_reduce_op_t::sum,
+                  cugraph::edge_weight_reduce_op_t::min,
+                  cugraph::edge_weight_reduce_op_t::max}) {
+    for (bool symmetrize : {false, true}) {
+      // reference
+
+      std::map<std::pair<int32_t, int32_t>, float> h_ref_edges{};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_srcs[i] == h_dsts[i]) { continue; }
+        std::vector<std::pair<int32_t, int32_t>> pairs{{h_srcs[i], h_dsts[i]}};
+        if (symmetrize) { pairs.push_back({h_dsts[i], h_srcs[i]}); }
+        for (auto pair : pairs) {
+          auto it = h_ref_edges.find(pair);
+          if (it == h_ref_edges.end()) {
+            h_ref_edges[pair] = h_weights[i];
+          } else if (op == cugraph::edge_weight_reduce_op_t::sum) {
+            it->second += h_weights[i];
+          } else if (op == cugraph::edge_weight_reduce_op_t::min) {
+            it->second = std::min(it->second, h_weights[i]);
+          } else {
+            it->second = std::max(it->second, h_weights[i]);
+          }
+        }
+      }
+
+      auto [d_srcs, d_dsts, d_weights] =
+        cugraph::clean_edgelist<int32_t, int32_t, float, false>(
+          handle,
+          cugraph::test::to_device(handle, h_srcs),
+          cugraph::test::to_device(handle, h_dsts),
+          std::make_optional(cugraph::test::to_device(handle, h_weights)),
+          true,
+          symmetrize,
+          op);
+
+      auto h_cleaned_srcs    = cugraph::test::to_host(handle, d_srcs);
+      auto h_cleaned_dsts    = cugraph::test::to_host(handle, d_dsts);
+      auto h_cleaned_weights = cugraph::test::to_host(handle, *d_weights);
+
+      ASSERT_EQ(h_cleaned_srcs.size(), h_ref_edges.size());
+      size_t i{0};
+      for (auto [pair, w] : h_ref_edges) {  // std::map iterates in the (src, dst) order
+        ASSERT_EQ(h_cleaned_srcs[i], pair.first);
+        ASSERT_EQ(h_cleaned_dsts[i], pair.second);
+        ASSERT_EQ(h_cleaned_weights[i], w);
+        ++i;
+      }
+    }
+  }
+}
+
 using Tests_Symmetrize_File = Tests_Symmetrize<cugraph::test::File_Usecase>;
 using Tests_Symmetrize_Rmat = Tests_Symmetrize<cugraph::test::Rmat_Usecase>;
 
@@ -89,6 +89,45 @@ class Tests_Transpose
             ? std::make_optional<raft::device_span<vertex_t const>>((*d_renumber_map_labels).data(),
                                                                     (*d_renumber_map_labels).size())
             : std::nullopt);
+
+      // decompressing in (pinned host memory) chunks should produce the same edges
+
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> chunked_edges{};
+      cugraph::decompress_to_host_edgelist_in_chunks<vertex_t,
+                                                     edge_t,
+                                                     weight_t,
+                                                     int32_t,
+                                                     store_transposed,
+                                                     false>(
+        handle,
+        graph.view(),
+        edge_weights ? std::make_optional((*edge_weights).view()) : std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        d_renumber_map_labels
+          ? std::make_optional<raft::device_span<vertex_t const>>((*d_renumber_map_labels).data(),
+                                                                  (*d_renumber_map_labels).size())
+          : std::nullopt,
+        size_t{1000},
+        [&chunked_edges](auto srcs, auto dsts, auto weights, auto, auto) {
+          ASSERT_TRUE(srcs.size() <= size_t{1000});
+          for (size_t i = 0; i < srcs.size(); ++i) {
+            chunked_edges.emplace_back(srcs[i], dsts[i], weights ? (*weights)[i] : weight_t{1.0});
+          }
+        });
+
+      auto h_org_srcs    = cugraph::test::to_host(handle, d_org_srcs);
+      auto h_org_dsts    = cugraph::test::to_host(handle, d_org_dsts);
+      auto h_org_weights = cugraph::test::to_host(handle, d_org_weights);
+      std::vector<std::tuple<vertex_t, vertex_t, weight_t>> org_edges(h_org_srcs.size());
+      for (size_t i = 0; i < org_edges.size(); ++i) {
+        org_edges[i] = std::make_tuple(
+          h_org_srcs[i], h_org_dsts[i], h_org_weights ? (*h_org_weights)[i] : weight_t{1.0});
+      }
+      std::sort(org_edges.begin(), org_edges.end());
+      std::sort(chunked_edges.begin(), chunked_edges.end());
+      ASSERT_TRUE(org_edges == chunked_edges)
+        << "decompress_to_host_edgelist_in_chunks does not match decompress_to_edgelist.";
     }
 
     if (cugraph::test::g_perf) {
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+#include <cugraph/utilities/packed_bool_utils.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+struct VertexMask_Usecase {
+  double keep_probability{0.5};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_VertexMask
+  : public ::testing::TestWithParam<std::tuple<VertexMask_Usecase, input_usecase_t>> {
+ public:
+  Tests_VertexMask() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, bool store_transposed>
+  void run_current_test(VertexMask_Usecase const& vertex_mask_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, renumber_map] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, store_transposed, false>(
+        handle, input_usecase, false, true);
+    auto graph_view = graph.view();
+
+    std::vector<bool> h_kept(graph_view.number_of_vertices());
+    std::mt19937 gen(0);
+    std::bernoulli_distribution dist(vertex_mask_usecase.keep_probability);
+    for (size_t i = 0; i < h_kept.size(); ++i) {
+      h_kept[i] = dist(gen);
+    }
+    std::vector<uint32_t> h_vertex_mask(cugraph::packed_bool_size(h_kept.size()),
+                                        cugraph::packed_bool_empty_mask());
+    for (size_t i = 0; i < h_kept.size(); ++i) {
+      if (h_kept[i]) {
+        h_vertex_mask[cugraph::packed_bool_offset(i)] |= cugraph::packed_bool_mask(i);
+      }
+    }
+    auto d_vertex_mask = cugraph::test::to_device(handle, h_vertex_mask);
+
+    auto masked_graph_view = graph_view;
+    masked_graph_view.attach_vertex_mask(
+      raft::device_span<uint32_t const>(d_vertex_mask.data(), d_vertex_mask.size()));
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Compute edge mask from vertex mask");
+    }
+
+    auto edge_mask = cugraph::compute_edge_mask_from_vertex_mask(handle, masked_graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    masked_graph_view.attach_edge_mask(edge_mask.view());
+
+    if (vertex_mask_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_weights, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      edge_t h_reference_num_edges{0};
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        if (h_kept[h_srcs[i]] && h_kept[h_dsts[i]]) { ++h_reference_num_edges; }
+      }
+
+      auto [d_masked_srcs, d_masked_dsts, d_masked_weights, d_masked_ids, d_masked_types] =
+        cugraph::decompress_to_edgelist(
+          handle,
+          masked_graph_view,
+          std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+          std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+          std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_masked_srcs = cugraph::test::to_host(handle, d_masked_srcs);
+      auto h_masked_dsts = cugraph::test::to_host(handle, d_masked_dsts);
+
+      ASSERT_EQ(static_cast<edge_t>(h_masked_srcs.size()), h_reference_num_edges);
+      ASSERT_EQ(masked_graph_view.compute_number_of_edges(handle), h_reference_num_edges);
+      for (size_t i = 0; i < h_masked_srcs.size(); ++i) {
+        ASSERT_TRUE(h_kept[h_masked_srcs[i]] && h_kept[h_masked_dsts[i]])
+          << "An edge incident to a masked out vertex is not masked out.";
+      }
+    }
+  }
+};
+
+using Tests_VertexMask_File = Tests_VertexMask<cugraph::test::File_Usecase>;
+using Tests_VertexMask_Rmat = Tests_VertexMask<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_VertexMask_File, CheckInt32Int32TransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, false>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_VertexMask_File, CheckInt32Int32TransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, true>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_VertexMask_Rmat, CheckInt64Int64TransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_VertexMask_File,
+  ::testing::Combine(::testing::Values(VertexMask_Usecase{0.5}, VertexMask_Usecase{0.9}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_VertexMask_Rmat,
+  ::testing::Combine(::testing::Values(VertexMask_Usecase{0.5}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_VertexMask_Rmat,
+  ::testing::Combine(::testing::Values(VertexMask_Usecase{0.5, false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -85,6 +85,10 @@ struct BFS_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  bool auto_tune{false};
+  std::optional<double> alpha{std::nullopt};
+  std::optional<double> beta{std::nullopt};
 };
 
 template <typename input_usecase_t>
@@ -161,13 +165,19 @@ class Tests_BFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, input_
 
     rmm::device_scalar<vertex_t> const d_source(bfs_usecase.source, handle.get_stream());
 
+    cugraph::bfs_options_t options{};
+    options.direction_optimizing = graph_view.is_symmetric() ? true : false;
+    options.alpha                = bfs_usecase.alpha;
+    options.beta                 = bfs_usecase.beta;
+    options.auto_tune            = bfs_usecase.auto_tune;
+
     cugraph::bfs(handle,
                  graph_view,
                  d_distances.data(),
                  d_predecessors.data(),
                  d_source.data(),
                  size_t{1},
-                 graph_view.is_symmetric() ? true : false,
+                 options,
                  std::numeric_limits<vertex_t>::max());
 
     if (cugraph::test::g_perf) {
@@ -177,6 +187,37 @@ class Tests_BFS : public ::testing::TestWithParam<std::tuple<BFS_Usecase, input_
     }
 
     if (bfs_usecase.check_correctness) {
+      // sparse_bfs should return the vertices within the depth limit with the bfs distances
+
+      {
+        vertex_t constexpr depth_limit{2};
+        auto [d_sparse_vertices, d_sparse_distances, d_sparse_predecessors] =
+          cugraph::sparse_bfs(handle,
+                              graph_view,
+                              raft::device_span<vertex_t const>(d_source.data(), size_t{1}),
+                              true,
+                              depth_limit);
+        auto h_distances           = cugraph::test::to_host(handle, d_distances);
+        auto h_sparse_vertices     = cugraph::test::to_host(handle, d_sparse_vertices);
+        auto h_sparse_distances    = cugraph::test::to_host(handle, d_sparse_distances);
+        auto h_sparse_predecessors = cugraph::test::to_host(handle, *d_sparse_predecessors);
+
+        std::vector<vertex_t> h_expected_vertices{};
+        for (vertex_t v = 0; v < graph_view.number_of_vertices(); ++v) {
+          if (h_distances[v] <= depth_limit) { h_expected_vertices.push_back(v); }
+        }
+        ASSERT_TRUE(h_sparse_vertices == h_expected_vertices)
+          << "sparse_bfs reached vertices do not match with the bfs results.";
+        for (size_t i = 0; i < h_sparse_vertices.size(); ++i) {
+          ASSERT_EQ(h_sparse_distances[i], h_distances[h_sparse_vertices[i]])
+            << "sparse_bfs distances do not match with the bfs distances.";
+          if (h_sparse_distances[i] > 0) {
+            ASSERT_EQ(h_distances[h_sparse_predecessors[i]] + 1, h_sparse_distances[i])
+              << "distance to this vertex != distance to the predecessor vertex + 1.";
+          }
+        }
+      }
+
       std::vector<edge_t> h_offsets{};
       std::vector<vertex_t> h_indices{};
       std::tie(h_offsets, h_indices, std::ignore) =
@@ -304,6 +345,15 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(BFS_Usecase{1000, false},
                     cugraph::test::File_Usecase("test/datasets/wiki-Talk.mtx")),
     std::make_tuple(BFS_Usecase{1000, true},
+                    cugraph::test::File_Usecase("test/datasets/wiki-Talk.mtx")),
+    // direction optimizing thresholds
+    std::make_tuple(BFS_Usecase{0, false, true, true},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(BFS_Usecase{1000, false, true, false, 1.0, 4.0},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+    std::make_tuple(BFS_Usecase{1000, false, true, true},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+    std::make_tuple(BFS_Usecase{1000, true, true, true, 1.0, 4.0},
                     cugraph::test::File_Usecase("test/datasets/wiki-Talk.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -316,6 +366,9 @@ INSTANTIATE_TEST_SUITE_P(
       cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true /* undirected */, false)),
     std::make_tuple(
       BFS_Usecase{0, true},
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true /* undirected */, false)),
+    std::make_tuple(
+      BFS_Usecase{0, false, true, true},
       cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true /* undirected */, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <vector>
+
+struct Eccentricity_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_Eccentricity
+  : public ::testing::TestWithParam<std::tuple<Eccentricity_Usecase, input_usecase_t>> {
+ public:
+  Tests_Eccentricity() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(Eccentricity_Usecase const& eccentricity_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = true;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, float, false, false>(
+        handle, input_usecase, false, renumber);
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Eccentricity");
+    }
+
+    auto d_eccentricities = cugraph::eccentricity(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Diameter");
+    }
+
+    auto diameter = cugraph::diameter(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(d_eccentricities.size(), static_cast<size_t>(graph_view.number_of_vertices()));
+
+    if (eccentricity_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_wgts, d_ids, d_types] = cugraph::decompress_to_edgelist(
+        handle,
+        graph_view,
+        std::optional<cugraph::edge_property_view_t<edge_t, float const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, edge_t const*>>{std::nullopt},
+        std::optional<cugraph::edge_property_view_t<edge_t, int32_t const*>>{std::nullopt},
+        std::optional<raft::device_span<vertex_t const>>{std::nullopt});
+      auto h_srcs = cugraph::test::to_host(handle, d_srcs);
+      auto h_dsts = cugraph::test::to_host(handle, d_dsts);
+
+      auto num_vertices = static_cast<size_t>(graph_view.number_of_vertices());
+      std::vector<std::vector<vertex_t>> adjacency_lists(num_vertices);
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        adjacency_lists[h_srcs[i]].push_back(h_dsts[i]);
+      }
+
+      // exact eccentricities from a BFS per vertex
+
+      std::vector<vertex_t> h_reference_eccentricities(num_vertices, vertex_t{0});
+      for (size_t s = 0; s < num_vertices; ++s) {
+        std::vector<vertex_t> distances(num_vertices, std::numeric_limits<vertex_t>::max());
+        std::queue<vertex_t> queue{};
+        distances[s] = 0;
+        queue.push(static_cast<vertex_t>(s));
+        while (!queue.empty()) {
+          auto v = queue.front();
+          queue.pop();
+          h_reference_eccentricities[s] = std::max(h_reference_eccentricities[s], distances[v]);
+          for (auto nbr : adjacency_lists[v]) {
+            if (distances[nbr] == std::numeric_limits<vertex_t>::max()) {
+              distances[nbr] = distances[v] + 1;
+              queue.push(nbr);
+            }
+          }
+        }
+      }
+
+      auto h_eccentricities = cugraph::test::to_host(handle, d_eccentricities);
+      ASSERT_TRUE(std::equal(h_reference_eccentricities.begin(),
+                             h_reference_eccentricities.end(),
+                             h_eccentricities.begin()))
+        << "eccentricities do not match with the reference values.";
+
+      auto reference_diameter =
+        *std::max_element(h_reference_eccentricities.begin(), h_reference_eccentricities.end());
+      ASSERT_EQ(diameter, reference_diameter);
+    }
+  }
+};
+
+using Tests_Eccentricity_File = Tests_Eccentricity<cugraph::test::File_Usecase>;
+using Tests_Eccentricity_Rmat = Tests_Eccentricity<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_Eccentricity_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_File_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Eccentricity_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_Eccentricity_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_Eccentricity_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Eccentricity_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_Eccentricity_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Eccentricity_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_Eccentricity_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(Eccentricity_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -195,6 +195,23 @@ class Tests_ExtractBfsPaths
       ASSERT_TRUE(
         std::equal(h_reference_paths.begin(), h_reference_paths.end(), h_cugraph_paths.begin()))
         << "extracted paths do not match with the reference values.";
+
+      // the pointer jumping path extraction should return the same paths (the batch size is set
+      // small to test batching)
+
+      auto [d_jumping_paths, jumping_max_path_length] =
+        extract_bfs_paths(handle,
+                          graph_view,
+                          d_distances.data(),
+                          d_predecessors.data(),
+                          d_destinations.data(),
+                          d_destinations.size(),
+                          std::make_optional(size_t{3}));
+      ASSERT_EQ(jumping_max_path_length, max_path_length);
+      auto h_jumping_paths = cugraph::test::to_host(handle, d_jumping_paths);
+      ASSERT_TRUE(
+        std::equal(h_reference_paths.begin(), h_reference_paths.end(), h_jumping_paths.begin()))
+        << "pointer jumping paths do not match with the reference values.";
     }
   }
 };
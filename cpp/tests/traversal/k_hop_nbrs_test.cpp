@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <tuple>
 #include <vector>
 
 template <typename vertex_t, typename edge_t>
@@ -97,6 +98,40 @@ std::tuple<std::vector<size_t>, std::vector<vertex_t>> k_hop_nbrs_reference(
   return std::make_tuple(std::move(nbr_offsets), std::move(nbrs));
 }
 
+// (start vertex index, hop distance, vertex) triplets for the vertices within k hops (excluding
+// the start vertex itself)
+template <typename vertex_t, typename edge_t>
+std::vector<std::tuple<size_t, size_t, vertex_t>> k_hop_nbrs_by_distance_reference(
+  edge_t const* offsets,
+  vertex_t const* indices,
+  vertex_t num_vertices,
+  vertex_t const* start_vertices,
+  size_t num_start_vertices,
+  size_t k)
+{
+  std::vector<std::tuple<size_t, size_t, vertex_t>> triplets{};
+  for (size_t i = 0; i < num_start_vertices; ++i) {
+    std::vector<bool> visited(num_vertices, false);
+    visited[start_vertices[i]] = true;
+    std::vector<vertex_t> frontier{start_vertices[i]};
+    for (size_t hop = 1; hop <= k; ++hop) {
+      std::vector<vertex_t> new_frontier{};
+      for (auto v : frontier) {
+        for (edge_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+          if (!visited[indices[j]]) {
+            visited[indices[j]] = true;
+            new_frontier.push_back(indices[j]);
+            triplets.push_back(std::make_tuple(i, hop, indices[j]));
+          }
+        }
+      }
+      frontier = std::move(new_frontier);
+    }
+  }
+  std::sort(triplets.begin(), triplets.end());
+  return triplets;
+}
+
 struct KHopNbrs_Usecase {
   size_t num_start_vertices{0};
   size_t k{0};
@@ -235,6 +270,78 @@ class Tests_KHopNbrs
       ASSERT_TRUE(
         std::equal(h_reference_nbrs.begin(), h_reference_nbrs.end(), h_cugraph_nbrs.begin()))
         << "neighbors do not match with the reference values.";
+
+      // the streamed variant reports each vertex within k hops once, at its hop distance
+
+      std::vector<std::tuple<size_t, size_t, vertex_t>> h_streamed_triplets{};
+      cugraph::k_hop_nbrs_streamed(
+        handle,
+        graph_view,
+        raft::device_span<vertex_t const>(d_start_vertices.data(), d_start_vertices.size()),
+        k_hop_nbrs_usecase.k,
+        [&handle, &h_streamed_triplets](size_t hop,
+                                        raft::device_span<size_t const> start_vertex_indices,
+                                        raft::device_span<vertex_t const> hop_nbrs) {
+          auto h_indices = cugraph::test::to_host(handle, start_vertex_indices);
+          auto h_nbrs    = cugraph::test::to_host(handle, hop_nbrs);
+          for (size_t i = 0; i < h_indices.size(); ++i) {
+            h_streamed_triplets.push_back(std::make_tuple(h_indices[i], hop, h_nbrs[i]));
+          }
+        });
+      if (renumber) {
+        auto h_renumber_map_labels = cugraph::test::to_host(handle, *d_renumber_map_labels);
+        for (auto& triplet : h_streamed_triplets) {
+          std::get<2>(triplet) = h_renumber_map_labels[std::get<2>(triplet)];
+        }
+      }
+      std::sort(h_streamed_triplets.begin(), h_streamed_triplets.end());
+
+      auto h_reference_triplets =
+        k_hop_nbrs_by_distance_reference(h_offsets.data(),
+                                         h_indices.data(),
+                                         graph_view.number_of_vertices(),
+                                         unrenumbered_start_vertices.data(),
+                                         unrenumbered_start_vertices.size(),
+                                         k_hop_nbrs_usecase.k);
+      ASSERT_TRUE(h_streamed_triplets == h_reference_triplets)
+        << "streamed neighbors do not match with the reference values.";
+
+      if (k_hop_nbrs_usecase.k == 2) {
+        // chunked two-hop neighbors (with a chunk size small enough to force multiple chunks)
+        // should match k_hop_nbrs, and the upper bounds should bound the neighbor counts
+
+        auto d_upper_bounds = cugraph::two_hop_nbr_count_upper_bounds(
+          handle,
+          graph_view,
+          raft::device_span<vertex_t const>(d_start_vertices.data(), d_start_vertices.size()));
+        auto [two_hop_offsets, two_hop_nbrs] = cugraph::two_hop_nbrs(
+          handle,
+          graph_view,
+          raft::device_span<vertex_t const>(d_start_vertices.data(), d_start_vertices.size()),
+          std::max(static_cast<size_t>(graph_view.compute_number_of_edges(handle)) / 8,
+                   size_t{1}));
+
+        auto h_upper_bounds    = cugraph::test::to_host(handle, d_upper_bounds);
+        auto h_two_hop_offsets = cugraph::test::to_host(handle, two_hop_offsets);
+        auto h_two_hop_nbrs    = cugraph::test::to_host(handle, two_hop_nbrs);
+        if (renumber) {
+          auto h_renumber_map_labels = cugraph::test::to_host(handle, *d_renumber_map_labels);
+          for (auto& v : h_two_hop_nbrs) {
+            v = h_renumber_map_labels[v];
+          }
+        }
+
+        ASSERT_TRUE(h_two_hop_offsets == h_cugraph_offsets)
+          << "two-hop neighbor offsets do not match with the k_hop_nbrs offsets.";
+        for (size_t i = 0; i < k_hop_nbrs_usecase.num_start_vertices; ++i) {
+          ASSERT_LE(h_two_hop_offsets[i + 1] - h_two_hop_offsets[i], h_upper_bounds[i])
+            << "the upper bound is smaller than the number of two-hop neighbors.";
+          std::sort(h_two_hop_nbrs.begin() + h_two_hop_offsets[i],
+                    h_two_hop_nbrs.begin() + h_two_hop_offsets[i + 1]);
+        }
+        ASSERT_TRUE(h_two_hop_nbrs == h_cugraph_nbrs)
+          << "two-hop neighbors do not match with the k_hop_nbrs neighbors.";
+      }
     }
   }
 };
@@ -272,6 +379,8 @@ INSTANTIATE_TEST_SUITE_P(
                     cugraph::test::File_Usecase("test/datasets/karate.mtx")),
     std::make_tuple(KHopNbrs_Usecase{1024, 5, true},
                     cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(KHopNbrs_Usecase{64, 3, false},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
     std::make_tuple(KHopNbrs_Usecase{1024, 4, false},
                     cugraph::test::File_Usecase("test/datasets/polbooks.mtx")),
     std::make_tuple(KHopNbrs_Usecase{1024, 4, true},
@@ -186,6 +186,25 @@ class Tests_MGExtractBFSPaths
     }
 
     if (extract_bfs_paths_usecase.check_correctness) {
+      // the pointer jumping path extraction should return the same paths (the batch size is set
+      // small to test batching)
+
+      {
+        auto [d_mg_jumping_paths, mg_jumping_max_path_length] =
+          extract_bfs_paths(*handle_,
+                            mg_graph_view,
+                            d_mg_distances.data(),
+                            d_mg_predecessors.data(),
+                            d_mg_destinations.data(),
+                            d_mg_destinations.size(),
+                            std::make_optional(size_t{3}));
+        ASSERT_EQ(mg_jumping_max_path_length, mg_max_path_length);
+        auto h_mg_paths         = cugraph::test::to_host(*handle_, d_mg_paths);
+        auto h_mg_jumping_paths = cugraph::test::to_host(*handle_, d_mg_jumping_paths);
+        ASSERT_TRUE(h_mg_jumping_paths == h_mg_paths)
+          << "pointer jumping paths do not match with the extracted paths.";
+      }
+
       // unrenumber & aggregate MG destination vertices to extract paths, & results
       // collect MG BFS results instead of re-running SG BFS as BFS is non-deterministic
 
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+struct MultiSourceBFS_Usecase {
+  size_t num_sources{1};
+  size_t depth_limit{std::numeric_limits<size_t>::max()};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MultiSourceBFS
+  : public ::testing::TestWithParam<std::tuple<MultiSourceBFS_Usecase, input_usecase_t>> {
+ public:
+  Tests_MultiSourceBFS() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(MultiSourceBFS_Usecase const& multi_source_bfs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber      = true;
+    bool constexpr test_weighted = false;
+
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, test_weighted, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+    auto graph_view = graph.view();
+
+    auto num_sources = std::min(multi_source_bfs_usecase.num_sources,
+                                static_cast<size_t>(graph_view.number_of_vertices()));
+    auto depth_limit = static_cast<vertex_t>(
+      std::min(multi_source_bfs_usecase.depth_limit,
+               static_cast<size_t>(std::numeric_limits<vertex_t>::max())));
+
+    // spread the sources over the vertex ID range, sources are neither sorted nor unique
+    std::vector<vertex_t> h_sources(num_sources);
+    for (size_t i = 0; i < num_sources; ++i) {
+      h_sources[i] = static_cast<vertex_t>((i * 7919) % graph_view.number_of_vertices());
+    }
+    if (num_sources > 1) { h_sources.back() = h_sources.front(); }
+    auto d_sources = cugraph::test::to_device(handle, h_sources);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Multi-source BFS");
+    }
+
+    auto [d_source_indices, d_vertices, d_distances] = cugraph::multi_source_bfs(
+      handle,
+      graph_view,
+      raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+      depth_limit);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    ASSERT_EQ(d_vertices.size(), d_source_indices.size());
+    ASSERT_EQ(d_distances.size(), d_source_indices.size());
+
+    if (multi_source_bfs_usecase.check_correctness) {
+      auto h_source_indices    = cugraph::test::to_host(handle, d_source_indices);
+      auto h_vertices          = cugraph::test::to_host(handle, d_vertices);
+      auto h_reached_distances = cugraph::test::to_host(handle, d_distances);
+
+      // unreachable (source, vertex) pairs are omitted from the output
+      std::vector<vertex_t> h_distances(num_sources * graph_view.number_of_vertices(),
+                                        std::numeric_limits<vertex_t>::max());
+      for (size_t i = 0; i < h_source_indices.size(); ++i) {
+        ASSERT_TRUE(h_source_indices[i] < num_sources) << "Invalid source index.";
+        ASSERT_TRUE((h_vertices[i] >= 0) && (h_vertices[i] < graph_view.number_of_vertices()))
+          << "Invalid vertex.";
+        auto& distance =
+          h_distances[h_source_indices[i] * graph_view.number_of_vertices() + h_vertices[i]];
+        ASSERT_EQ(distance, std::numeric_limits<vertex_t>::max())
+          << "Duplicate (source, vertex) pair.";
+        distance = h_reached_distances[i];
+      }
+
+      rmm::device_uvector<vertex_t> d_reference_distances(graph_view.number_of_vertices(),
+                                                          handle.get_stream());
+      for (size_t i = 0; i < num_sources; ++i) {
+        cugraph::bfs(handle,
+                     graph_view,
+                     d_reference_distances.data(),
+                     static_cast<vertex_t*>(nullptr),
+                     d_sources.data() + i,
+                     size_t{1},
+                     false,
+                     depth_limit);
+        auto h_reference_distances = cugraph::test::to_host(handle, d_reference_distances);
+
+        ASSERT_TRUE(std::equal(h_reference_distances.begin(),
+                               h_reference_distances.end(),
+                               h_distances.begin() + i * graph_view.number_of_vertices()))
+          << "distances from source " << h_sources[i]
+          << " do not match with the single-source BFS results.";
+      }
+    }
+  }
+};
+
+using Tests_MultiSourceBFS_File = Tests_MultiSourceBFS<cugraph::test::File_Usecase>;
+using Tests_MultiSourceBFS_Rmat = Tests_MultiSourceBFS<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MultiSourceBFS_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MultiSourceBFS_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MultiSourceBFS_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MultiSourceBFS_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MultiSourceBFS_Usecase{1},
+                      MultiSourceBFS_Usecase{33},
+                      MultiSourceBFS_Usecase{130},
+                      MultiSourceBFS_Usecase{100, 2}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MultiSourceBFS_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MultiSourceBFS_Usecase{64}, MultiSourceBFS_Usecase{200}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MultiSourceBFS_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MultiSourceBFS_Usecase{1024, std::numeric_limits<size_t>::max(), false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
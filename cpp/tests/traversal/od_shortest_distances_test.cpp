@@ -85,6 +85,11 @@ struct ODShortestDistances_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+
+  size_t num_landmarks{0};          // 0: no landmark (ALT) pruning
+  size_t max_origins_per_batch{0};  // 0: search for every origin concurrently
+
+  bool contraction_hierarchy{false};  // query a contraction hierarchy index (symmetric graphs only)
 };
 
 template <typename input_usecase_t>
@@ -145,14 +150,62 @@ class Tests_ODShortestDistances
       hr_timer.start("ODShortestDistances");
     }
 
-    auto od_matrix = cugraph::od_shortest_distances(
-      handle,
-      graph_view,
-      *edge_weight_view,
-      raft::device_span<vertex_t const>(origins.data(), origins.size()),
-      raft::device_span<vertex_t const>(destinations.data(), destinations.size()),
-      std::numeric_limits<weight_t>::max(),
-      false);
+    std::optional<rmm::device_uvector<weight_t>> landmark_distances{std::nullopt};
+    if (od_usecase.num_landmarks > 0) {
+      auto landmarks = cugraph::select_random_vertices<vertex_t, edge_t, false, false>(
+        handle, graph_view, std::nullopt, rng_state, od_usecase.num_landmarks, false, true);
+      landmark_distances = cugraph::compute_landmark_distances(
+        handle,
+        graph_view,
+        *edge_weight_view,
+        raft::device_span<vertex_t const>(landmarks.data(), landmarks.size()));
+    }
+
+    rmm::device_uvector<weight_t> od_matrix(0, handle.get_stream());
+    if (od_usecase.contraction_hierarchy) {
+      auto contraction_hierarchy =
+        cugraph::build_contraction_hierarchy(handle, graph_view, *edge_weight_view);
+
+      auto h_origins      = cugraph::test::to_host(handle, origins);
+      auto h_destinations = cugraph::test::to_host(handle, destinations);
+      std::vector<vertex_t> h_sources(h_origins.size() * h_destinations.size());
+      std::vector<vertex_t> h_targets(h_sources.size());
+      for (size_t i = 0; i < h_sources.size(); ++i) {
+        h_sources[i] = h_origins[i / h_destinations.size()];
+        h_targets[i] = h_destinations[i % h_destinations.size()];
+      }
+      auto sources = cugraph::test::to_device(handle, h_sources);
+      auto targets = cugraph::test::to_device(handle, h_targets);
+
+      od_matrix = cugraph::contraction_hierarchy_shortest_distances(
+        handle,
+        contraction_hierarchy,
+        raft::device_span<vertex_t const>(sources.data(), sources.size()),
+        raft::device_span<vertex_t const>(targets.data(), targets.size()));
+    } else if ((od_usecase.num_landmarks > 0) || (od_usecase.max_origins_per_batch > 0)) {
+      od_matrix = cugraph::od_shortest_distances(
+        handle,
+        graph_view,
+        *edge_weight_view,
+        raft::device_span<vertex_t const>(origins.data(), origins.size()),
+        raft::device_span<vertex_t const>(destinations.data(), destinations.size()),
+        landmark_distances ? std::make_optional<raft::device_span<weight_t const>>(
+                               (*landmark_distances).data(), (*landmark_distances).size())
+                           : std::nullopt,
+        od_usecase.max_origins_per_batch > 0 ? std::make_optional(od_usecase.max_origins_per_batch)
+                                             : std::nullopt,
+        std::numeric_limits<weight_t>::max(),
+        false);
+    } else {
+      od_matrix = cugraph::od_shortest_distances(
+        handle,
+        graph_view,
+        *edge_weight_view,
+        raft::device_span<vertex_t const>(origins.data(), origins.size()),
+        raft::device_span<vertex_t const>(destinations.data(), destinations.size()),
+        std::numeric_limits<weight_t>::max(),
+        false);
+    }
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -257,7 +310,15 @@ INSTANTIATE_TEST_SUITE_P(
                     std::make_tuple(ODShortestDistances_Usecase{50, 100, false},
                                     cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
                     std::make_tuple(ODShortestDistances_Usecase{50, 100, true},
-                                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+                                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+                    std::make_tuple(ODShortestDistances_Usecase{10, 20, false, true, 4, 3},
+                                    cugraph::test::File_Usecase("test/datasets/netscience.mtx")),
+                    std::make_tuple(ODShortestDistances_Usecase{50, 100, false, true, 8, 16},
+                                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+                    std::make_tuple(ODShortestDistances_Usecase{5, 5, false, true, 0, 0, true},
+                                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+                    std::make_tuple(ODShortestDistances_Usecase{10, 20, false, true, 0, 0, true},
+                                    cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_small_test,
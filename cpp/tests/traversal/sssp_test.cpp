@@ -89,6 +89,7 @@ struct SSSP_Usecase {
 
   bool edge_masking{false};
   bool check_correctness{true};
+  bool adaptive_delta{false};
 };
 
 template <typename input_usecase_t>
@@ -155,6 +156,8 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
                   d_predecessors.data(),
                   static_cast<vertex_t>(sssp_usecase.source),
                   std::numeric_limits<weight_t>::max(),
+                  sssp_usecase.adaptive_delta ? cugraph::sssp_delta_mode_t::ADAPTIVE
+                                              : cugraph::sssp_delta_mode_t::FIXED,
                   false);
 
     if (cugraph::test::g_perf) {
@@ -164,6 +167,96 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
     }
 
     if (sssp_usecase.check_correctness) {
+      // sssp_to_targets should find the same distances for the targets (with and without an A*
+      // heuristic)
+
+      auto h_sssp_distances = cugraph::test::to_host(handle, d_distances);
+
+      std::vector<vertex_t> h_targets{};
+      for (size_t i = 0; i < 4; ++i) {
+        h_targets.push_back(static_cast<vertex_t>(i * graph_view.number_of_vertices() / 4));
+      }
+      auto d_targets = cugraph::test::to_device(handle, h_targets);
+
+      // (d(s, t) - d(s, v)) is a consistent lower bound of d(v, t) for a single target t
+      auto target_distance = h_sssp_distances[h_targets.back()];
+      std::vector<weight_t> h_heuristics(h_sssp_distances.size(), weight_t{0.0});
+      if (target_distance != std::numeric_limits<weight_t>::max()) {
+        std::transform(h_sssp_distances.begin(),
+                       h_sssp_distances.end(),
+                       h_heuristics.begin(),
+                       [target_distance](auto d) {
+                         return d < target_distance ? target_distance - d : weight_t{0.0};
+                       });
+      }
+      auto d_heuristics = cugraph::test::to_device(handle, h_heuristics);
+
+      for (bool a_star : {false, true}) {
+        rmm::device_uvector<weight_t> d_target_distances(graph_view.number_of_vertices(),
+                                                         handle.get_stream());
+        auto targets = a_star ? raft::device_span<vertex_t const>(d_targets.data() + 3, 1)
+                              : raft::device_span<vertex_t const>(d_targets.data(), 4);
+        cugraph::sssp_to_targets(
+          handle,
+          graph_view,
+          *edge_weight_view,
+          d_target_distances.data(),
+          static_cast<vertex_t*>(nullptr),
+          static_cast<vertex_t>(sssp_usecase.source),
+          targets,
+          a_star ? std::make_optional<raft::device_span<weight_t const>>(d_heuristics.data(),
+                                                                          d_heuristics.size())
+                 : std::nullopt);
+        auto h_target_distances = cugraph::test::to_host(handle, d_target_distances);
+        for (size_t i = a_star ? 3 : 0; i < h_targets.size(); ++i) {
+          auto expected = h_sssp_distances[h_targets[i]];
+          ASSERT_NEAR(h_target_distances[h_targets[i]],
+                      expected,
+                      std::max(expected, weight_t{1.0}) * weight_t{1e-5})
+            << "sssp_to_targets distances do not match with the sssp distances.";
+        }
+      }
+
+      // sparse_sssp should return the vertices closer than the cutoff with the sssp distances
+
+      {
+        std::vector<weight_t> h_finite_distances{};
+        std::copy_if(h_sssp_distances.begin(),
+                     h_sssp_distances.end(),
+                     std::back_inserter(h_finite_distances),
+                     [](auto d) { return d != std::numeric_limits<weight_t>::max(); });
+        std::sort(h_finite_distances.begin(), h_finite_distances.end());
+        auto cutoff = h_finite_distances[h_finite_distances.size() / 2] + weight_t{1e-3};
+
+        auto [d_sparse_vertices, d_sparse_distances, d_sparse_predecessors] =
+          cugraph::sparse_sssp(handle,
+                               graph_view,
+                               *edge_weight_view,
+                               static_cast<vertex_t>(sssp_usecase.source),
+                               cutoff,
+                               true);
+        auto h_sparse_vertices  = cugraph::test::to_host(handle, d_sparse_vertices);
+        auto h_sparse_distances = cugraph::test::to_host(handle, d_sparse_distances);
+
+        // vertices with distances (nearly) equal to the cutoff may or may not be reached
+        auto tolerance = std::max(cutoff, weight_t{1.0}) * weight_t{1e-5};
+        size_t num_expected{0};
+        for (auto d : h_sssp_distances) {
+          if (d < cutoff - tolerance) { ++num_expected; }
+        }
+        size_t num_reached_below{0};
+        for (size_t i = 0; i < h_sparse_vertices.size(); ++i) {
+          auto expected = h_sssp_distances[h_sparse_vertices[i]];
+          ASSERT_NEAR(h_sparse_distances[i], expected, std::max(expected, weight_t{1.0}) * 1e-5)
+            << "sparse_sssp distances do not match with the sssp distances.";
+          ASSERT_TRUE(expected < cutoff + tolerance)
+            << "sparse_sssp reached a vertex farther than the cutoff.";
+          if (expected < cutoff - tolerance) { ++num_reached_below; }
+        }
+        ASSERT_EQ(num_reached_below, num_expected)
+          << "sparse_sssp failed to reach some vertices closer than the cutoff.";
+      }
+
       auto [h_offsets, h_indices, h_weights] =
         cugraph::test::graph_to_host_csr<vertex_t, edge_t, weight_t, false, false>(
           handle,
@@ -291,6 +384,12 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(SSSP_Usecase{1000, false},
                     cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
     std::make_tuple(SSSP_Usecase{1000, true},
+                    cugraph::test::File_Usecase("test/datasets/wiki2003.mtx")),
+    std::make_tuple(SSSP_Usecase{0, false, true, true},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(SSSP_Usecase{0, false, true, true},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx")),
+    std::make_tuple(SSSP_Usecase{1000, true, true, true},
                     cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -301,6 +400,8 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(SSSP_Usecase{0, false},
                     cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
     std::make_tuple(SSSP_Usecase{0, true},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    std::make_tuple(SSSP_Usecase{0, false, true, true},
                     cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/test_graphs.hpp"
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+template <typename vertex_t>
+vertex_t find_reference_root(std::vector<vertex_t>& parents, vertex_t v)
+{
+  while (parents[v] != v) {
+    parents[v] = parents[parents[v]];
+    v          = parents[v];
+  }
+  return v;
+}
+
+// Kruskal's algorithm, returns (# forest edges, forest weight)
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<size_t, double> minimum_spanning_forest_reference(edge_t const* offsets,
+                                                             vertex_t const* indices,
+                                                             weight_t const* weights,
+                                                             vertex_t num_vertices)
+{
+  std::vector<std::tuple<weight_t, vertex_t, vertex_t>> edges{};
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+      edges.emplace_back(weights[i], u, indices[i]);
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  std::vector<vertex_t> parents(num_vertices);
+  std::iota(parents.begin(), parents.end(), vertex_t{0});
+  size_t num_forest_edges{0};
+  double forest_weight{0.0};
+  for (auto [w, u, v] : edges) {
+    auto u_root = find_reference_root(parents, u);
+    auto v_root = find_reference_root(parents, v);
+    if (u_root != v_root) {
+      parents[std::max(u_root, v_root)] = std::min(u_root, v_root);
+      ++num_forest_edges;
+      forest_weight += w;
+    }
+  }
+  return std::make_tuple(num_forest_edges, forest_weight);
+}
+
+struct MinimumSpanningForest_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MinimumSpanningForest
+  : public ::testing::TestWithParam<std::tuple<MinimumSpanningForest_Usecase, input_usecase_t>> {
+ public:
+  Tests_MinimumSpanningForest() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MinimumSpanningForest_Usecase const& minimum_spanning_forest_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    bool constexpr renumber = false;
+
+    raft::handle_t handle{};
+    HighResTimer hr_timer{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Construct graph");
+    }
+
+    auto [graph, edge_weights, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    auto graph_view = graph.view();
+    ASSERT_TRUE(graph_view.is_symmetric())
+      << "Minimum spanning forest works only on undirected (symmetric) graphs.";
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.start("Minimum spanning forest");
+    }
+
+    auto [d_forest_srcs, d_forest_dsts, d_forest_weights] =
+      cugraph::minimum_spanning_forest<vertex_t, edge_t, weight_t, false>(
+        handle, graph_view, (*edge_weights).view());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_timer.stop();
+      hr_timer.display_and_clear(std::cout);
+    }
+
+    if (minimum_spanning_forest_usecase.check_correctness) {
+      auto h_offsets =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().offsets());
+      auto h_indices =
+        cugraph::test::to_host(handle, graph_view.local_edge_partition_view().indices());
+      auto h_weights = cugraph::test::to_host(
+        handle,
+        raft::device_span<weight_t const>((*edge_weights).view().value_firsts()[0],
+                                          (*edge_weights).view().edge_counts()[0]));
+
+      auto [reference_num_edges, reference_weight] = minimum_spanning_forest_reference(
+        h_offsets.data(), h_indices.data(), h_weights.data(), graph_view.number_of_vertices());
+
+      auto h_forest_srcs    = cugraph::test::to_host(handle, d_forest_srcs);
+      auto h_forest_dsts    = cugraph::test::to_host(handle, d_forest_dsts);
+      auto h_forest_weights = cugraph::test::to_host(handle, d_forest_weights);
+
+      ASSERT_EQ(h_forest_srcs.size(), reference_num_edges)
+        << "The number of minimum spanning forest edges does not match with the reference value.";
+
+      // the forest edges should not form a cycle
+      std::vector<vertex_t> parents(graph_view.number_of_vertices());
+      std::iota(parents.begin(), parents.end(), vertex_t{0});
+      double forest_weight{0.0};
+      for (size_t i = 0; i < h_forest_srcs.size(); ++i) {
+        ASSERT_TRUE(h_forest_srcs[i] < h_forest_dsts[i]);
+        auto u_root = find_reference_root(parents, h_forest_srcs[i]);
+        auto v_root = find_reference_root(parents, h_forest_dsts[i]);
+        ASSERT_TRUE(u_root != v_root) << "Minimum spanning forest edges form a cycle.";
+        parents[std::max(u_root, v_root)] = std::min(u_root, v_root);
+        forest_weight += h_forest_weights[i];
+      }
+
+      auto threshold_ratio     = 1e-4;
+      auto threshold_magnitude = 1e-6;
+      ASSERT_TRUE(std::abs(forest_weight - reference_weight) <=
+                  std::max(reference_weight * threshold_ratio, threshold_magnitude))
+        << "The minimum spanning forest weight " << forest_weight
+        << " does not match with the reference value " << reference_weight << ".";
+    }
+  }
+};
+
+using Tests_MinimumSpanningForest_File = Tests_MinimumSpanningForest<cugraph::test::File_Usecase>;
+using Tests_MinimumSpanningForest_Rmat = Tests_MinimumSpanningForest<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MinimumSpanningForest_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MinimumSpanningForest_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MinimumSpanningForest_Rmat, CheckInt64Int64Double)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, double>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MinimumSpanningForest_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MinimumSpanningForest_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(MinimumSpanningForest_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MinimumSpanningForest_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(MinimumSpanningForest_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,11 +29,14 @@
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <gtest/gtest.h>
 
+#include <iostream>
 #include <limits>
+#include <memory>
 #include <optional>
 
 namespace cugraph {
@@ -118,6 +121,51 @@ inline std::shared_ptr<rmm::mr::device_memory_resource> create_memory_resource(
   CUGRAPH_FAIL("Invalid RMM allocation mode");
 }
 
+/**
+ * @brief Google Test event listener reporting the device memory high-water mark of each test.
+ *
+ * The high-water mark is the peak of the bytes allocated (minus the bytes deallocated) from the
+ * statistics adaptor since the test started, e.g. to validate the estimates of
+ * cugraph/utilities/memory_estimates.hpp in benchmarks.
+ */
+class memory_high_water_mark_listener_t : public ::testing::EmptyTestEventListener {
+ public:
+  explicit memory_high_water_mark_listener_t(
+    rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>* statistics)
+    : statistics_(statistics)
+  {
+  }
+
+  void OnTestStart(::testing::TestInfo const&) override { statistics_->push_counters(); }
+
+  void OnTestEnd(::testing::TestInfo const& test_info) override
+  {
+    auto [bytes, allocations] = statistics_->pop_counters();
+    std::cout << "[ MEMORY   ] " << test_info.test_suite_name() << "." << test_info.name()
+              << " peak device memory: " << bytes.peak << " bytes (" << allocations.total
+              << " allocations)" << std::endl;
+  }
+
+ private:
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>* statistics_{};
+};
+
+/**
+ * @brief Wrap a memory resource with an rmm::mr::statistics_resource_adaptor and report the device
+ * memory high-water mark of every test.
+ *
+ * @param resource Memory resource to wrap.
+ * @return Memory resource instance (should be set as the current device resource)
+ */
+inline std::shared_ptr<rmm::mr::device_memory_resource> add_memory_high_water_mark_tracking(
+  std::shared_ptr<rmm::mr::device_memory_resource> resource)
+{
+  auto mr = rmm::mr::make_owning_wrapper<rmm::mr::statistics_resource_adaptor>(resource);
+  ::testing::UnitTest::GetInstance()->listeners().Append(
+    new memory_high_water_mark_listener_t(&(mr->wrapped())));
+  return mr;
+}
+
 // these variables are updated by command line arguments
 static bool g_perf{false};
 static std::optional<size_t> g_rmat_scale{std::nullopt};
@@ -159,11 +207,13 @@ inline std::tuple<T, File_Usecase> override_File_Usecase_with_cmd_line_arguments
 /**
  * @brief Parses the cuGraph test command line options.
  *
- * Currently supports 'rmm_mode', 'perf', 'rmat_scale', and 'rmat_edge_factor'.
+ * Currently supports 'rmm_mode', 'perf', 'memory_stats', 'rmat_scale', and 'rmat_edge_factor'.
  * 'rmm_mode` string paramater sets the rmm allocation mode. The default value of the parameter is
  * 'pool'.
  * `perf` boolean parameter enables performance measurements. The default value of the
  * parameter is 'false' (if this option is not provided).
+ * `memory_stats` boolean parameter enables reporting the device memory high-water mark of each
+ * test. The default value of the parameter is 'false' (if this option is not provided).
  * 'rmat_scale' integer parameter overrides the hardcoded R-mat scale if provided.
  * 'rmat_edge_factor' integer parameter overrides the hardcoded R-mat edge factor if provided.
  *
@@ -185,9 +235,15 @@ inline auto parse_test_options(int argc, char** argv)
     options.allow_unrecognised_options().add_options()(
       "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"))(
       "perf", "enalbe performance measurements", cxxopts::value<bool>()->default_value("false"))(
+      "memory_stats",
+      "report the device memory high-water mark of each test",
+      cxxopts::value<bool>()->default_value("false"))(
       "rmat_scale", "override the hardcoded R-mat scale", cxxopts::value<size_t>())(
       "rmat_edge_factor", "override the hardcoded R-mat edge factor", cxxopts::value<size_t>())(
-      "test_file_name", "override the hardcoded test filename", cxxopts::value<std::string>());
+      "test_file_name", "override the hardcoded test filename", cxxopts::value<std::string>())(
+      "partition_shape",
+      "2D GPU partition shape in multi-GPU tests (square or node)",
+      cxxopts::value<std::string>()->default_value("square"));
 
     return options.parse(argc, argv);
   } catch (const cxxopts::OptionException& e) {
@@ -211,6 +267,9 @@ inline auto parse_test_options(int argc, char** argv)
     auto const cmd_opts = parse_test_options(argc, argv);                               \
     auto const rmm_mode = cmd_opts["rmm_mode"].as<std::string>();                       \
     auto resource       = cugraph::test::create_memory_resource(rmm_mode);              \
+    if (cmd_opts["memory_stats"].as<bool>()) {                                          \
+      resource = cugraph::test::add_memory_high_water_mark_tracking(resource);          \
+    }                                                                                   \
     rmm::mr::set_current_device_resource(resource.get());                               \
     cugraph::test::g_perf = cmd_opts["perf"].as<bool>();                                \
     cugraph::test::g_rmat_scale =                                                       \
@@ -242,6 +301,9 @@ inline auto parse_test_options(int argc, char** argv)
     auto const cmd_opts = parse_test_options(argc, argv);                               \
     auto const rmm_mode = cmd_opts["rmm_mode"].as<std::string>();                       \
     auto resource       = cugraph::test::create_memory_resource(rmm_mode);              \
+    if (cmd_opts["memory_stats"].as<bool>()) {                                          \
+      resource = cugraph::test::add_memory_high_water_mark_tracking(resource);          \
+    }                                                                                   \
     rmm::mr::set_current_device_resource(resource.get());                               \
     cugraph::test::g_perf = cmd_opts["perf"].as<bool>();                                \
     cugraph::test::g_rmat_scale =                                                       \
@@ -256,6 +318,13 @@ inline auto parse_test_options(int argc, char** argv)
       (cmd_opts.count("test_file_name") > 0)                                            \
         ? std::make_optional<std::string>(cmd_opts["test_file_name"].as<std::string>()) \
         : std::nullopt;                                                                 \
+    auto const partition_shape = cmd_opts["partition_shape"].as<std::string>();         \
+    CUGRAPH_EXPECTS((partition_shape == "square") || (partition_shape == "node"),       \
+                    "Invalid partition_shape, should be square or node.");              \
+    cugraph::test::set_mg_partition_shape(                                              \
+      (partition_shape == "node") ? cugraph::partition_shape_t::gpu_row_comm_per_node   \
+                                  : cugraph::partition_shape_t::square,                 \
+      num_gpus_per_node);                                                               \
                                                                                         \
     auto ret = RUN_ALL_TESTS();                                                         \
     cugraph::test::finalize_mpi();                                                      \
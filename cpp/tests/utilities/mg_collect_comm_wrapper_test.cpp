@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/conversion_utilities.hpp"
+#include "utilities/device_comm_wrapper.hpp"
+#include "utilities/mg_utilities.hpp"
+
+#include <cugraph/detail/collect_comm_wrapper.hpp>
+
+#include <raft/core/device_span.hpp>
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+struct CollectCommWrapper_Usecase {
+  size_t local_size{0};  // rank r holds local_size + r elements (so the sizes differ by rank)
+  size_t max_chunk_size{0};
+  bool gather_to_root{false};  // gather to rank 0 (gatherv) if true, to every rank otherwise
+  bool host_output{false};
+};
+
+class Tests_MGCollectCommWrapper : public ::testing::TestWithParam<CollectCommWrapper_Usecase> {
+ public:
+  Tests_MGCollectCommWrapper() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename T>
+  void run_current_test(CollectCommWrapper_Usecase const& usecase)
+  {
+    auto const& comm     = handle_->get_comms();
+    auto const comm_rank = comm.get_rank();
+
+    // 1. create the local input
+
+    std::vector<T> h_input(usecase.local_size + comm_rank);
+    for (size_t i = 0; i < h_input.size(); ++i) {
+      h_input[i] = static_cast<T>(comm_rank * 1000000 + i);
+    }
+    auto d_input = cugraph::test::to_device(*handle_, h_input);
+    raft::device_span<T const> input_span(d_input.data(), d_input.size());
+
+    // 2. the unchunked collective
+
+    auto d_reference = usecase.gather_to_root
+                         ? cugraph::test::device_gatherv(*handle_, input_span)
+                         : cugraph::detail::device_allgatherv(*handle_, comm, input_span);
+    auto h_reference = cugraph::test::to_host(*handle_, d_reference);
+
+    // 3. the chunked collective into a caller-provided buffer
+
+    auto root    = usecase.gather_to_root ? std::make_optional<int>(0) : std::nullopt;
+    bool receive = !root || (*root == comm_rank);
+
+    size_t total_size{0};
+    for (int i = 0; i < comm.get_size(); ++i) {
+      total_size += usecase.local_size + i;
+    }
+    auto output_size = receive ? total_size : size_t{0};
+
+    std::vector<T> h_output(usecase.host_output ? output_size : size_t{0});
+    rmm::device_uvector<T> d_output(usecase.host_output ? size_t{0} : output_size,
+                                    handle_->get_stream());
+    T* output = usecase.host_output ? h_output.data() : d_output.data();
+
+    auto gathered_size = cugraph::detail::device_gatherv_to_buffer(
+      *handle_, comm, input_span, output, output_size, usecase.max_chunk_size, root);
+    if (usecase.host_output) {
+      handle_->sync_stream();
+    } else {
+      h_output = cugraph::test::to_host(*handle_, d_output);
+    }
+
+    // 4. compare
+
+    ASSERT_EQ(gathered_size, total_size);
+    if (receive) {
+      ASSERT_TRUE(h_output == h_reference)
+        << "The chunked collective does not match the unchunked collective.";
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+std::unique_ptr<raft::handle_t> Tests_MGCollectCommWrapper::handle_ = nullptr;
+
+TEST_P(Tests_MGCollectCommWrapper, CheckInt32) { run_current_test<int32_t>(GetParam()); }
+
+TEST_P(Tests_MGCollectCommWrapper, CheckDouble) { run_current_test<double>(GetParam()); }
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_MGCollectCommWrapper,
+  ::testing::Values(
+    // every local size below the chunk size (a single round)
+    CollectCommWrapper_Usecase{0, 1024, false, false},
+    CollectCommWrapper_Usecase{100, 1024, false, false},
+    CollectCommWrapper_Usecase{100, 1024, true, false},
+    CollectCommWrapper_Usecase{100, 1024, false, true},
+    CollectCommWrapper_Usecase{100, 1024, true, true},
+    // local sizes at and above the chunk size (multiple rounds, the last round is partial)
+    CollectCommWrapper_Usecase{1024, 1024, false, false},
+    CollectCommWrapper_Usecase{5000, 1024, false, false},
+    CollectCommWrapper_Usecase{5000, 1024, true, false},
+    CollectCommWrapper_Usecase{5000, 1024, false, true},
+    CollectCommWrapper_Usecase{5000, 1024, true, true},
+    CollectCommWrapper_Usecase{37, 1, false, false},
+    CollectCommWrapper_Usecase{37, 1, true, true}));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -26,6 +26,19 @@
 namespace cugraph {
 namespace test {
 
+namespace {
+
+cugraph::partition_shape_t mg_partition_shape{cugraph::partition_shape_t::square};
+int mg_num_gpus_per_node{1};
+
+}  // namespace
+
+void set_mg_partition_shape(cugraph::partition_shape_t shape, int num_gpus_per_node)
+{
+  mg_partition_shape   = shape;
+  mg_num_gpus_per_node = num_gpus_per_node;
+}
+
 void initialize_mpi(int argc, char** argv) { RAFT_MPI_TRY(MPI_Init(&argc, &argv)); }
 
 void finalize_mpi() { RAFT_MPI_TRY(MPI_Finalize()); }
@@ -55,12 +68,9 @@ std::unique_ptr<raft::handle_t> initialize_mg_handle(size_t pool_size)
 
   raft::comms::initialize_mpi_comms(handle.get(), MPI_COMM_WORLD);
 
-  auto gpu_row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
-  while (comm_size % gpu_row_comm_size != 0) {
-    --gpu_row_comm_size;
-  }
-
-  cugraph::partition_manager::init_subcomm(*handle, gpu_row_comm_size);
+  cugraph::partition_manager::init_subcomm(*handle,
+                                           cugraph::partition_manager::compute_gpu_row_comm_size(
+                                             comm_size, mg_partition_shape, mg_num_gpus_per_node));
 
   return std::move(handle);
 }
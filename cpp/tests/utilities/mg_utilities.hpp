@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <cugraph/partition_manager.hpp>
+
 #include <raft/core/handle.hpp>
 
 #include <memory>
@@ -29,6 +31,9 @@ void finalize_mpi();
 int query_mpi_comm_world_rank();
 int query_mpi_comm_world_size();
 
+// set the 2D partition shape used by initialize_mg_handle (default: as square as possible)
+void set_mg_partition_shape(cugraph::partition_shape_t shape, int num_gpus_per_node);
+
 std::unique_ptr<raft::handle_t> initialize_mg_handle(
   size_t pool_size = 8 /* default value of CUDA_DEVICE_MAX_CONNECTIONS */);
 
@@ -299,6 +299,7 @@ cdef extern from "cugraph_c/algorithms.h":
         CSC
         DCSR
         DCSC
+        COO_DST_MAJOR
 
     cdef cugraph_error_code_t \
         cugraph_sampling_options_create(